@@ -1,95 +1,292 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
-// 
+//
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or bawrite to start the write and not wait for it.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
-// 
+//
 // The implementation uses three state flags internally:
 // * B_BUSY: the block has been returned from bread
-//     and has not been passed back to brelse.  
+//     and has not been passed back to brelse.
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed on (dev, sector) into NBUCKET chains, each
+// with its own lock, so a cache hit only takes the lock of one
+// bucket and CPUs working on different blocks do not contend.
+// Eviction uses a clock over all buffers: brelse sets b->used,
+// and the clock hand clears it, recycling the first idle, clean
+// buffer whose bit is already clear.
+//
+// The buffers themselves live in chunks of BCHUNK bytes from
+// kallocn(), holding BPCHUNK buf headers followed by their data;
+// a chunk is a page per sector in a block, so it holds as many
+// buffers whatever BSIZE is.  binit()
+// sizes the cache from the memory kinit2() left free, or from
+// nbuf= on the boot command line.  The cache grows by a chunk when
+// every buffer is in use, and kalloc() calls bshrink() to give
+// idle chunks back when it runs out of pages.
+//
+// Locking:
+// * bucket.lock protects the bucket's chain and the B_BUSY flag
+//     and used bit of the buffers on it.
+// * bcache.lock serializes misses: it protects the clock ring and
+//     the chunk list, and is the only way a buffer changes identity
+//     (dev, sector).  It is always taken before any bucket lock.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
+#include "fs.h"
 #include "buf.h"
+#include "kstat.h"
+
+#define NBUCKET 1021
+
+// Each bucket is a cache line apart from the next, by its lock's
+// alignment, so that CPUs working in different ones stay apart.
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;   // chain through hnext
+};
+
+struct bchunk {
+  struct bchunk *next;
+  struct buf buf[];
+};
+
+// Pages per chunk, as a kallocn() order, and buffers per chunk,
+// after the chunk header.  A chunk is aligned to its size, so
+// no buffer's data crosses a page.
+#define BCHUNKORDER (BSIZE == 4096 ? 3 : BSIZE == 2048 ? 2 : BSIZE == 1024 ? 1 : 0)
+#define BCHUNK (PGSIZE << BCHUNKORDER)
+#define BPCHUNK ((BCHUNK - sizeof(struct bchunk)) / (sizeof(struct buf) + BSIZE))
 
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct bchunk *chunks;
+  int nbuf;           // buffers in the cache
+  int target;         // size chosen at boot
+  struct buf *hand;   // clock hand; ring through prev/next
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+static struct bucket*
+bhash(uint dev, uint sector)
+{
+  return &bcache.bucket[(dev * 31 + sector) % NBUCKET];
+}
+
+// Add a chunk of fresh buffers to the clock ring at the hand,
+// so they are the first candidates for reuse.  Buffers with
+// dev == -1 are on no hash chain.
+// Caller must hold bcache.lock, except during binit.
+static int
+bgrow(void)
+{
+  struct bchunk *c;
+  struct buf *b;
+  uchar *data;
+  int i;
+
+  if((c = (struct bchunk*)kallocn(BCHUNKORDER)) == 0)
+    return -1;
+  data = (uchar*)c + BCHUNK - BPCHUNK*BSIZE;
+  for(i = 0; i < BPCHUNK; i++){
+    b = &c->buf[i];
+    b->flags = 0;
+    b->dev = -1;
+    b->hnext = 0;
+    b->used = 0;
+    b->data = data + i*BSIZE;
+    if(bcache.hand == 0){
+      b->next = b->prev = b;
+      bcache.hand = b;
+    } else {
+      b->next = bcache.hand;
+      b->prev = bcache.hand->prev;
+      b->prev->next = b;
+      bcache.hand->prev = b;
+    }
+  }
+  bcache.hand = &c->buf[0];
+  c->next = bcache.chunks;
+  bcache.chunks = c;
+  bcache.nbuf += BPCHUNK;
+  return 0;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  struct bucket *bk;
+  int n;
 
   initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    initlock(&bk->lock, "bcache.bucket");
+    bk->head = 0;
+  }
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    b->dev = -1;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  n = bootarg("nbuf", NBUF);
+  if(n <= 0)
+    n = (kfreepages() >> BCHUNKORDER) / BCACHEFRAC * BPCHUNK;
+  if(n < NBUFMIN)
+    n = NBUFMIN;
+  while(bcache.nbuf < n)
+    if(bgrow() < 0)
+      break;
+  if(bcache.nbuf < NBUFMIN)
+    panic("binit: no memory for buffers");
+  bcache.target = bcache.nbuf;
+  cprintf("bcache: %d buffers\n", bcache.nbuf);
+}
+
+// Look for sector on device dev in bucket bk.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint sector)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->sector == sector)
+      return b;
+  return 0;
+}
+
+// Remove b from the hash chain of bucket bk.
+// Caller must hold bk->lock.
+static void
+bunhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+    if(*pp == b){
+      *pp = b->hnext;
+      b->hnext = 0;
+      return;
+    }
   }
+  panic("bunhash");
+}
+
+// Run the clock to find an idle, clean buffer and take it off
+// its hash chain.  Returns the buffer marked B_BUSY.
+// Caller must hold bcache.lock.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  struct bucket *bk;
+  int n;
+
+  // Two full sweeps: the first may only clear used bits.
+  for(n = 0; n < 2*bcache.nbuf; n++){
+    b = bcache.hand;
+    bcache.hand = b->next;
+    if(b->dev == -1){
+      b->flags = B_BUSY;
+      return b;
+    }
+    bk = bhash(b->dev, b->sector);
+    acquire(&bk->lock);
+    if((b->flags & (B_BUSY|B_DIRTY)) == 0){
+      if(b->used)
+        b->used = 0;
+      else {
+        bunhash(bk, b);
+        b->flags = B_BUSY;
+        release(&bk->lock);
+        return b;
+      }
+    }
+    release(&bk->lock);
+  }
+  return 0;
 }
 
 // Look through buffer cache for sector on device dev.
 // If not found, allocate fresh block.
 // In either case, return B_BUSY buffer.
+// With nowait set, return 0 instead if the sector is already
+// cached or no buffer is free; read-ahead only wants new blocks.
 static struct buf*
-bget(uint dev, uint sector)
+bget(uint dev, uint sector, int nowait)
 {
   struct buf *b;
+  struct bucket *bk;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, sector);
+  acquire(&bk->lock);
 
  loop:
   // Is the sector already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->sector == sector){
-      if(!(b->flags & B_BUSY)){
-        b->flags |= B_BUSY;
-        release(&bcache.lock);
-        return b;
-      }
-      sleep(b, &bcache.lock);
-      goto loop;
+  if((b = bfind(bk, dev, sector)) != 0){
+    if(nowait){
+      release(&bk->lock);
+      return 0;
+    }
+    if(!(b->flags & B_BUSY)){
+      b->flags |= B_BUSY;
+      release(&bk->lock);
+      kstatinc(KS_BHIT);
+      return b;
     }
+    kstatinc(KS_BWAIT);
+    sleep(b, &bk->lock);
+    goto loop;
   }
+  release(&bk->lock);
 
-  // Not cached; recycle some non-busy and clean buffer.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
-      b->dev = dev;
-      b->sector = sector;
-      b->flags = B_BUSY;
+  // Not cached.  Only misses take bcache.lock, and only they
+  // insert into chains, so no one can add this sector while
+  // we hold it; check again in case someone did before.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if(bfind(bk, dev, sector) != 0){
+    release(&bcache.lock);
+    goto loop;
+  }
+  release(&bk->lock);
+
+  // Refill a cache that bshrink() trimmed while memory is
+  // plentiful again; otherwise recycle some non-busy and clean
+  // buffer, growing past the boot size only if all are in use.
+  if(bcache.nbuf < bcache.target && kfreepages() > KRESERVE)
+    bgrow();
+  if((b = bvictim()) == 0){
+    if(nowait){
       release(&bcache.lock);
-      return b;
+      return 0;
     }
+    if(bcache.nbuf >= 2*bcache.target || bgrow() < 0 || (b = bvictim()) == 0)
+      panic("bget: no buffers");
   }
-  panic("bget: no buffers");
+  b->dev = dev;
+  b->sector = sector;
+  acquire(&bk->lock);
+  b->hnext = bk->head;
+  bk->head = b;
+  release(&bk->lock);
+  release(&bcache.lock);
+  kstatinc(KS_BMISS);
+  return b;
 }
 
 // Return a B_BUSY buf with the contents of the indicated disk sector.
@@ -98,12 +295,61 @@ bread(uint dev, uint sector)
 {
   struct buf *b;
 
-  b = bget(dev, sector);
+  b = bget(dev, sector, 0);
   if(!(b->flags & B_VALID))
     iderw(b);
   return b;
 }
 
+// Return a B_BUSY buf for sector holding zeroes, without reading
+// the disk: for a block whose old contents do not matter.
+struct buf*
+bnew(uint dev, uint sector)
+{
+  struct buf *b;
+
+  b = bget(dev, sector, 0);
+  memset(b->data, 0, BSIZE);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Return sector's buffer, B_BUSY, if it is cached, or else 0,
+// without caching it: for I/O that goes around the cache but
+// must not miss a newer copy in it.
+struct buf*
+bpeek(uint dev, uint sector)
+{
+  struct buf *b;
+  struct bucket *bk;
+
+  bk = bhash(dev, sector);
+  acquire(&bk->lock);
+  while((b = bfind(bk, dev, sector)) != 0 && (b->flags & B_BUSY))
+    sleep(b, &bk->lock);
+  if(b)
+    b->flags |= B_BUSY;
+  release(&bk->lock);
+  if(b && !(b->flags & B_VALID))
+    iderw(b);
+  return b;
+}
+
+// Start reading sector into the cache, unless it is already
+// cached.  Does not wait: the disk interrupt handler releases
+// the buffer when the read completes.
+void
+breadahead(uint dev, uint sector)
+{
+  struct buf *b;
+
+  if((b = bget(dev, sector, 1)) == 0)
+    return;
+  kstatinc(KS_BREADAHEAD);
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
 // Write b's contents to disk.  Must be B_BUSY.
 void
 bwrite(struct buf *b)
@@ -114,26 +360,109 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start writing b's contents to disk, and release b when
+// the write completes.  Must be B_BUSY; caller gives it up.
+void
+bawrite(struct buf *b)
+{
+  if((b->flags & B_BUSY) == 0)
+    panic("bawrite");
+  b->flags |= B_DIRTY|B_ASYNC;
+  iderw(b);
+}
+
 // Release a B_BUSY buffer.
-// Move to the head of the MRU list.
+// Mark it recently used for the clock.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if((b->flags & B_BUSY) == 0)
     panic("brelse");
 
-  acquire(&bcache.lock);
-
-  b->next->prev = b->prev;
-  b->prev->next = b->next;
-  b->next = bcache.head.next;
-  b->prev = &bcache.head;
-  bcache.head.next->prev = b;
-  bcache.head.next = b;
+  bk = bhash(b->dev, b->sector);
+  acquire(&bk->lock);
 
+  b->used = 1;
   b->flags &= ~B_BUSY;
-  wakeup(b);
+  wakeone(b);
 
+  release(&bk->lock);
+}
+
+// Give one chunk of idle, clean buffers back to the page
+// allocator.  Called by kalloc() when it runs out of memory.
+// Returns the number of pages freed.
+int
+bshrink(void)
+{
+  struct bchunk *c, **pc;
+  struct buf *b;
+  struct bucket *bk;
+  int i, ok;
+
+  // kalloc() from bgrow() must not recurse into the cache.
+  if(holding(&bcache.lock))
+    return 0;
+  acquire(&bcache.lock);
+  if(bcache.nbuf - BPCHUNK < NBUFMIN){
+    release(&bcache.lock);
+    return 0;
+  }
+  for(pc = &bcache.chunks; (c = *pc) != 0; pc = &c->next){
+    // Drop the chunk's blocks from the cache.  A busy or dirty
+    // buffer keeps the chunk; the ones already dropped just
+    // stay on the ring as free buffers.
+    ok = 1;
+    for(i = 0; i < BPCHUNK && ok; i++){
+      b = &c->buf[i];
+      if(b->dev == -1)
+        continue;
+      bk = bhash(b->dev, b->sector);
+      acquire(&bk->lock);
+      if(b->flags & (B_BUSY|B_DIRTY))
+        ok = 0;
+      else {
+        bunhash(bk, b);
+        b->dev = -1;
+        b->flags = 0;
+      }
+      release(&bk->lock);
+    }
+    if(!ok)
+      continue;
+
+    for(i = 0; i < BPCHUNK; i++){
+      b = &c->buf[i];
+      if(bcache.hand == b)
+        bcache.hand = b->next;
+      b->prev->next = b->next;
+      b->next->prev = b->prev;
+    }
+    *pc = c->next;
+    bcache.nbuf -= BPCHUNK;
+    release(&bcache.lock);
+    kfreen((char*)c, BCHUNKORDER);
+    return 1 << BCHUNKORDER;
+  }
   release(&bcache.lock);
+  return 0;
 }
 
+// Report on the cache for /stats/bcache.
+void
+bstats(struct report *r)
+{
+  uint hit, miss;
+
+  hit = kstatsum(KS_BHIT);
+  miss = kstatsum(KS_BMISS);
+  report(r, "hits", hit);
+  report(r, "misses", miss);
+  reportpct(r, "hit%", hit, hit + miss);
+  report(r, "waits", kstatsum(KS_BWAIT));
+  report(r, "readaheads", kstatsum(KS_BREADAHEAD));
+  report(r, "buffers", bcache.nbuf);
+  report(r, "target", bcache.target);
+}
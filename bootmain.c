@@ -11,6 +11,7 @@
 #include "memlayout.h"
 
 #define SECTSIZE  512
+#define SEGSECTS  32   // sectors per read command
 
 void readseg(uchar*, uint, uint);
 
@@ -55,22 +56,27 @@ waitdisk(void)
     ;
 }
 
-// Read a single sector at offset into dst.
+// Read n sectors, 1 to 256, from sector offset on into dst,
+// with one command.
 void
-readsect(void *dst, uint offset)
+readsect(uchar *dst, uint offset, uint n)
 {
   // Issue command.
   waitdisk();
-  outb(0x1F2, 1);   // count = 1
+  outb(0x1F2, n);   // count; 0 means 256
   outb(0x1F3, offset);
   outb(0x1F4, offset >> 8);
   outb(0x1F5, offset >> 16);
   outb(0x1F6, (offset >> 24) | 0xE0);
   outb(0x1F7, 0x20);  // cmd 0x20 - read sectors
 
-  // Read data.
-  waitdisk();
-  insl(0x1F0, dst, SECTSIZE/4);
+  // Read data, a sector at a time as the disk has it ready:
+  // not busy, data request set.
+  for(; n > 0; n--, dst += SECTSIZE){
+    while((inb(0x1F7) & 0x88) != 0x08)
+      ;
+    insl(0x1F0, dst, SECTSIZE/4);
+  }
 }
 
 // Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
@@ -88,9 +94,8 @@ readseg(uchar* pa, uint count, uint offset)
   // Translate from bytes to sectors; kernel starts at sector 1.
   offset = (offset / SECTSIZE) + 1;
 
-  // If this is too slow, we could read lots of sectors at a time.
-  // We'd write more to memory than asked, but it doesn't matter --
-  // we load in increasing order.
-  for(; pa < epa; pa += SECTSIZE, offset++)
-    readsect(pa, offset);
+  // Read SEGSECTS sectors per command.  We write more to memory
+  // than asked, but it doesn't matter -- we load in increasing order.
+  for(; pa < epa; pa += SEGSECTS*SECTSIZE, offset += SEGSECTS)
+    readsect(pa, offset, SEGSECTS);
 }
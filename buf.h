@@ -2,12 +2,20 @@ struct buf {
   int flags;
   uint dev;
   uint sector;
-  struct buf *prev; // LRU cache list
+  struct buf *prev;  // clock ring
   struct buf *next;
+  struct buf *hnext; // hash chain
+  int used;          // clock reference bit
   struct buf *qnext; // disk queue
-  uchar data[512];
-};
+  uint qtick;        // ticks when queued, for deadlines
+  uint qtsc;         // rdtsc() when queued, for latency
+  int qcpu;          // CPU that queued it, for its interrupt
+  uint disk;         // disk and sector of it that it goes to
+  uint lba;
+  uchar *data;       // BSIZE bytes, in the buffer's chunk page
+} __attribute__((aligned(CACHELINE)));  // a line each, as a chunk fits them anyway
 #define B_BUSY  0x1  // buffer is locked by some process
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // no one waits; disk driver calls brelse when done
 
@@ -0,0 +1,141 @@
+// Callouts: calls made at a given clock tick, for sleeping with a
+// timeout.
+//
+// Pending callouts wait in a hierarchical timer wheel, WLEVELS
+// levels of WSIZE slots.  Level l holds the callouts due WSIZE^l
+// to WSIZE^(l+1) ticks from now, by bits WBITS*l on of their
+// deadline.  Each tick runs the one level-0 slot for that tick;
+// each time a level's index wraps, the next level's current slot
+// is cascaded down, each callout in it placed again nearer the
+// bottom.  So a tick costs the callouts actually due, not a pass
+// over every sleeper.  Callouts run at interrupt time on CPU 0
+// with tickslock held, which also guards the wheel.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "callout.h"
+
+#define WBITS    6
+#define WSIZE    (1<<WBITS)
+#define WLEVELS  4
+#define WMAX     ((1u<<(WBITS*WLEVELS)) - 1)   // farthest deadline placed exactly
+
+static struct callout *wheel[WLEVELS][WSIZE];
+
+// Put c in the slot for its deadline.  Deadlines past WMAX ticks
+// away go in the top level as if WMAX away, and are placed again
+// when cascaded.  Caller holds tickslock.
+static void
+place(struct callout *c)
+{
+  struct callout **pp;
+  uint d, when;
+  int l;
+
+  d = c->when - ticks;
+  if((int)d < 0)
+    d = 0;
+  if(d > WMAX)
+    d = WMAX;
+  when = ticks + d;
+  for(l = 0; l < WLEVELS-1 && d >= 1u<<(WBITS*(l+1)); l++)
+    ;
+  pp = &wheel[l][(when >> (WBITS*l)) & (WSIZE-1)];
+  c->next = *pp;
+  if(c->next)
+    c->next->pprev = &c->next;
+  c->pprev = pp;
+  *pp = c;
+}
+
+static void
+unlink(struct callout *c)
+{
+  *c->pprev = c->next;
+  if(c->next)
+    c->next->pprev = c->pprev;
+  c->pprev = 0;
+}
+
+// Arrange to call fn(arg) n ticks from now, at least one.  c must
+// not be pending.  Caller holds tickslock.
+void
+callout(struct callout *c, uint n, void (*fn)(void*), void *arg)
+{
+  if(n == 0)
+    n = 1;
+  c->when = ticks + n;
+  c->fn = fn;
+  c->arg = arg;
+  place(c);
+}
+
+// Cancel c if it is pending; return 1 if it was.
+// Caller holds tickslock.
+int
+calloutstop(struct callout *c)
+{
+  if(c->pprev == 0)
+    return 0;
+  unlink(c);
+  return 1;
+}
+
+// Move the callouts in slot i of level l down the wheel.
+static void
+cascade(int l, int i)
+{
+  struct callout *c;
+
+  while((c = wheel[l][i]) != 0){
+    unlink(c);
+    place(c);
+  }
+}
+
+// The clock has just ticked: run the callouts now due.
+// Caller holds tickslock.
+void
+callouttick(void)
+{
+  struct callout *c;
+  int l, i;
+
+  for(l = 1; l < WLEVELS; l++){
+    if((ticks >> (WBITS*(l-1))) & (WSIZE-1))
+      break;
+    cascade(l, (ticks >> (WBITS*l)) & (WSIZE-1));
+  }
+
+  i = ticks & (WSIZE-1);
+  while((c = wheel[0][i]) != 0){
+    unlink(c);
+    c->fn(c->arg);
+  }
+}
+
+// Sleep for n clock ticks.  Return 0, or -1 if killed first.
+int
+tsleep(uint n)
+{
+  struct callout c;
+
+  if(n == 0)
+    return 0;
+  acquire(&tickslock);
+  callout(&c, n, wakeup, &c);
+  while(c.pprev){
+    if(proc->killed){
+      calloutstop(&c);
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&c, &tickslock);
+  }
+  release(&tickslock);
+  return 0;
+}
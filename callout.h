@@ -0,0 +1,8 @@
+// A call of fn(arg) due at clock tick when; see callout.c.
+struct callout {
+  uint when;
+  void (*fn)(void*);
+  void *arg;
+  struct callout *next;        // in its timer wheel slot
+  struct callout **pprev;      // 0 if not pending
+};
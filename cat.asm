@@ -0,0 +1,1891 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  // Have the kernel move the data if it can.
+  while((n = sendfile(1, fd, 4096)) > 0)
+   6:	90                   	nop
+   7:	83 ec 04             	sub    $0x4,%esp
+   a:	68 00 10 00 00       	push   $0x1000
+   f:	ff 75 08             	push   0x8(%ebp)
+  12:	6a 01                	push   $0x1
+  14:	e8 a8 04 00 00       	call   4c1 <sendfile>
+  19:	83 c4 10             	add    $0x10,%esp
+  1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  23:	7f e2                	jg     7 <cat+0x7>
+    ;
+  if(n == 0)
+  25:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  29:	74 55                	je     80 <cat+0x80>
+    return;
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  2b:	eb 15                	jmp    42 <cat+0x42>
+    write(1, buf, n);
+  2d:	83 ec 04             	sub    $0x4,%esp
+  30:	ff 75 f4             	push   -0xc(%ebp)
+  33:	68 00 13 00 00       	push   $0x1300
+  38:	6a 01                	push   $0x1
+  3a:	e8 a8 03 00 00       	call   3e7 <write>
+  3f:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  42:	83 ec 04             	sub    $0x4,%esp
+  45:	68 00 02 00 00       	push   $0x200
+  4a:	68 00 13 00 00       	push   $0x1300
+  4f:	ff 75 08             	push   0x8(%ebp)
+  52:	e8 89 03 00 00       	call   3e0 <read>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  61:	7f ca                	jg     2d <cat+0x2d>
+  if(n < 0){
+  63:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  67:	79 18                	jns    81 <cat+0x81>
+    printf(1, "cat: read error\n");
+  69:	83 ec 08             	sub    $0x8,%esp
+  6c:	68 f5 0e 00 00       	push   $0xef5
+  71:	6a 01                	push   $0x1
+  73:	e8 e3 07 00 00       	call   85b <printf>
+  78:	83 c4 10             	add    $0x10,%esp
+    exit();
+  7b:	e8 4b 03 00 00       	call   3cb <exit>
+    return;
+  80:	90                   	nop
+  }
+}
+  81:	c9                   	leave
+  82:	c3                   	ret
+
+00000083 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  83:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  87:	83 e4 f0             	and    $0xfffffff0,%esp
+  8a:	ff 71 fc             	push   -0x4(%ecx)
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	53                   	push   %ebx
+  91:	51                   	push   %ecx
+  92:	83 ec 10             	sub    $0x10,%esp
+  95:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  97:	83 3b 01             	cmpl   $0x1,(%ebx)
+  9a:	7f 12                	jg     ae <main+0x2b>
+    cat(0);
+  9c:	83 ec 0c             	sub    $0xc,%esp
+  9f:	6a 00                	push   $0x0
+  a1:	e8 5a ff ff ff       	call   0 <cat>
+  a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a9:	e8 1d 03 00 00       	call   3cb <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  ae:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  b5:	eb 71                	jmp    128 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  ba:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  c1:	8b 43 04             	mov    0x4(%ebx),%eax
+  c4:	01 d0                	add    %edx,%eax
+  c6:	8b 00                	mov    (%eax),%eax
+  c8:	83 ec 08             	sub    $0x8,%esp
+  cb:	6a 00                	push   $0x0
+  cd:	50                   	push   %eax
+  ce:	e8 30 03 00 00       	call   403 <open>
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  dd:	79 29                	jns    108 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  e2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  ec:	01 d0                	add    %edx,%eax
+  ee:	8b 00                	mov    (%eax),%eax
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	50                   	push   %eax
+  f4:	68 06 0f 00 00       	push   $0xf06
+  f9:	6a 01                	push   $0x1
+  fb:	e8 5b 07 00 00       	call   85b <printf>
+ 100:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 103:	e8 c3 02 00 00       	call   3cb <exit>
+    }
+    cat(fd);
+ 108:	83 ec 0c             	sub    $0xc,%esp
+ 10b:	ff 75 f0             	push   -0x10(%ebp)
+ 10e:	e8 ed fe ff ff       	call   0 <cat>
+ 113:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 116:	83 ec 0c             	sub    $0xc,%esp
+ 119:	ff 75 f0             	push   -0x10(%ebp)
+ 11c:	e8 cd 02 00 00       	call   3ee <close>
+ 121:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 124:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 128:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12b:	3b 03                	cmp    (%ebx),%eax
+ 12d:	7c 88                	jl     b7 <main+0x34>
+  }
+  exit();
+ 12f:	e8 97 02 00 00       	call   3cb <exit>
+
+00000134 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 134:	55                   	push   %ebp
+ 135:	89 e5                	mov    %esp,%ebp
+ 137:	57                   	push   %edi
+ 138:	53                   	push   %ebx
+    if(cc < 1)
+ 139:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 13f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 142:	89 cb                	mov    %ecx,%ebx
+ 144:	89 df                	mov    %ebx,%edi
+ 146:	89 d1                	mov    %edx,%ecx
+ 148:	fc                   	cld
+ 149:	f3 aa                	rep stos %al,%es:(%edi)
+ 14b:	89 ca                	mov    %ecx,%edx
+ 14d:	89 fb                	mov    %edi,%ebx
+ 14f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 152:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 155:	90                   	nop
+ 156:	5b                   	pop    %ebx
+ 157:	5f                   	pop    %edi
+ 158:	5d                   	pop    %ebp
+ 159:	c3                   	ret
+
+0000015a <strcpy>:
+{
+ 15a:	55                   	push   %ebp
+ 15b:	89 e5                	mov    %esp,%ebp
+ 15d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 160:	8b 45 08             	mov    0x8(%ebp),%eax
+ 163:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 166:	90                   	nop
+ 167:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 16a:	8d 42 01             	lea    0x1(%edx),%eax
+ 16d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 170:	8b 45 08             	mov    0x8(%ebp),%eax
+ 173:	8d 48 01             	lea    0x1(%eax),%ecx
+ 176:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 179:	0f b6 12             	movzbl (%edx),%edx
+ 17c:	88 10                	mov    %dl,(%eax)
+ 17e:	0f b6 00             	movzbl (%eax),%eax
+ 181:	84 c0                	test   %al,%al
+ 183:	75 e2                	jne    167 <strcpy+0xd>
+  return os;
+ 185:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 188:	c9                   	leave
+ 189:	c3                   	ret
+
+0000018a <strcmp>:
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 18d:	eb 08                	jmp    197 <strcmp+0xd>
+    p++, q++;
+ 18f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 193:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	0f b6 00             	movzbl (%eax),%eax
+ 19d:	84 c0                	test   %al,%al
+ 19f:	74 10                	je     1b1 <strcmp+0x27>
+ 1a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a4:	0f b6 10             	movzbl (%eax),%edx
+ 1a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1aa:	0f b6 00             	movzbl (%eax),%eax
+ 1ad:	38 c2                	cmp    %al,%dl
+ 1af:	74 de                	je     18f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	0f b6 00             	movzbl (%eax),%eax
+ 1b7:	0f b6 d0             	movzbl %al,%edx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	0f b6 00             	movzbl (%eax),%eax
+ 1c0:	0f b6 c0             	movzbl %al,%eax
+ 1c3:	29 c2                	sub    %eax,%edx
+ 1c5:	89 d0                	mov    %edx,%eax
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+
+000001c9 <strlen>:
+{
+ 1c9:	55                   	push   %ebp
+ 1ca:	89 e5                	mov    %esp,%ebp
+ 1cc:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1cf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1d6:	eb 04                	jmp    1dc <strlen+0x13>
+ 1d8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1dc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	01 d0                	add    %edx,%eax
+ 1e4:	0f b6 00             	movzbl (%eax),%eax
+ 1e7:	84 c0                	test   %al,%al
+ 1e9:	75 ed                	jne    1d8 <strlen+0xf>
+  return n;
+ 1eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1ee:	c9                   	leave
+ 1ef:	c3                   	ret
+
+000001f0 <memset>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1f3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1f6:	50                   	push   %eax
+ 1f7:	ff 75 0c             	push   0xc(%ebp)
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 32 ff ff ff       	call   134 <stosb>
+ 202:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 205:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <strchr>:
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 213:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 216:	eb 14                	jmp    22c <strchr+0x22>
+    if(*s == c)
+ 218:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 221:	75 05                	jne    228 <strchr+0x1e>
+      return (char*)s;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	eb 13                	jmp    23b <strchr+0x31>
+  for(; *s; s++)
+ 228:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 22c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22f:	0f b6 00             	movzbl (%eax),%eax
+ 232:	84 c0                	test   %al,%al
+ 234:	75 e2                	jne    218 <strchr+0xe>
+  return 0;
+ 236:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+
+0000023d <gets>:
+{
+ 23d:	55                   	push   %ebp
+ 23e:	89 e5                	mov    %esp,%ebp
+ 240:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 243:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 24a:	eb 42                	jmp    28e <gets+0x51>
+    cc = read(0, &c, 1);
+ 24c:	83 ec 04             	sub    $0x4,%esp
+ 24f:	6a 01                	push   $0x1
+ 251:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 254:	50                   	push   %eax
+ 255:	6a 00                	push   $0x0
+ 257:	e8 84 01 00 00       	call   3e0 <read>
+ 25c:	83 c4 10             	add    $0x10,%esp
+ 25f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 262:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 266:	7e 33                	jle    29b <gets+0x5e>
+    buf[i++] = c;
+ 268:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26b:	8d 50 01             	lea    0x1(%eax),%edx
+ 26e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 271:	89 c2                	mov    %eax,%edx
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	01 c2                	add    %eax,%edx
+ 278:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 27c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 27e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 282:	3c 0a                	cmp    $0xa,%al
+ 284:	74 16                	je     29c <gets+0x5f>
+ 286:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 28a:	3c 0d                	cmp    $0xd,%al
+ 28c:	74 0e                	je     29c <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 28e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 291:	83 c0 01             	add    $0x1,%eax
+ 294:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 297:	7f b3                	jg     24c <gets+0xf>
+ 299:	eb 01                	jmp    29c <gets+0x5f>
+      break;
+ 29b:	90                   	nop
+  }
+  buf[i] = '\0';
+ 29c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 29f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a2:	01 d0                	add    %edx,%eax
+ 2a4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+
+000002ac <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ac:	55                   	push   %ebp
+ 2ad:	89 e5                	mov    %esp,%ebp
+ 2af:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b2:	83 ec 08             	sub    $0x8,%esp
+ 2b5:	6a 00                	push   $0x0
+ 2b7:	ff 75 08             	push   0x8(%ebp)
+ 2ba:	e8 44 01 00 00       	call   403 <open>
+ 2bf:	83 c4 10             	add    $0x10,%esp
+ 2c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2c9:	79 07                	jns    2d2 <stat+0x26>
+    return -1;
+ 2cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d0:	eb 25                	jmp    2f7 <stat+0x4b>
+  r = fstat(fd, st);
+ 2d2:	83 ec 08             	sub    $0x8,%esp
+ 2d5:	ff 75 0c             	push   0xc(%ebp)
+ 2d8:	ff 75 f4             	push   -0xc(%ebp)
+ 2db:	e8 41 01 00 00       	call   421 <fstat>
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2e6:	83 ec 0c             	sub    $0xc,%esp
+ 2e9:	ff 75 f4             	push   -0xc(%ebp)
+ 2ec:	e8 fd 00 00 00       	call   3ee <close>
+ 2f1:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+
+000002f9 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f9:	55                   	push   %ebp
+ 2fa:	89 e5                	mov    %esp,%ebp
+ 2fc:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 306:	eb 25                	jmp    32d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 308:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 30b:	89 d0                	mov    %edx,%eax
+ 30d:	c1 e0 02             	shl    $0x2,%eax
+ 310:	01 d0                	add    %edx,%eax
+ 312:	01 c0                	add    %eax,%eax
+ 314:	89 c1                	mov    %eax,%ecx
+ 316:	8b 45 08             	mov    0x8(%ebp),%eax
+ 319:	8d 50 01             	lea    0x1(%eax),%edx
+ 31c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 31f:	0f b6 00             	movzbl (%eax),%eax
+ 322:	0f be c0             	movsbl %al,%eax
+ 325:	01 c8                	add    %ecx,%eax
+ 327:	83 e8 30             	sub    $0x30,%eax
+ 32a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 32d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 330:	0f b6 00             	movzbl (%eax),%eax
+ 333:	3c 2f                	cmp    $0x2f,%al
+ 335:	7e 0a                	jle    341 <atoi+0x48>
+ 337:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33a:	0f b6 00             	movzbl (%eax),%eax
+ 33d:	3c 39                	cmp    $0x39,%al
+ 33f:	7e c7                	jle    308 <atoi+0xf>
+  return n;
+ 341:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+
+00000346 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 346:	55                   	push   %ebp
+ 347:	89 e5                	mov    %esp,%ebp
+ 349:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 34c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 352:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 355:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 358:	eb 17                	jmp    371 <memmove+0x2b>
+    *dst++ = *src++;
+ 35a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 35d:	8d 42 01             	lea    0x1(%edx),%eax
+ 360:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 363:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 366:	8d 48 01             	lea    0x1(%eax),%ecx
+ 369:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 36c:	0f b6 12             	movzbl (%edx),%edx
+ 36f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 371:	8b 45 10             	mov    0x10(%ebp),%eax
+ 374:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 377:	89 55 10             	mov    %edx,0x10(%ebp)
+ 37a:	85 c0                	test   %eax,%eax
+ 37c:	7f dc                	jg     35a <memmove+0x14>
+  return vdst;
+ 37e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 381:	c9                   	leave
+ 382:	c3                   	ret
+
+00000383 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 383:	83 3d cc 12 00 00 00 	cmpl   $0x0,0x12cc
+  jg 2f
+ 38a:	7f 2e                	jg     3ba <dosyscall+0x37>
+  jl 1f
+ 38c:	7c 29                	jl     3b7 <dosyscall+0x34>
+  pushl %eax
+ 38e:	50                   	push   %eax
+  pushl %ebx
+ 38f:	53                   	push   %ebx
+  movl $1, %eax
+ 390:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 395:	0f a2                	cpuid
+  popl %ebx
+ 397:	5b                   	pop    %ebx
+  popl %eax
+ 398:	58                   	pop    %eax
+  movl $-1, sysmode
+ 399:	c7 05 cc 12 00 00 ff 	movl   $0xffffffff,0x12cc
+ 3a0:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 3a3:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 3a9:	74 0c                	je     3b7 <dosyscall+0x34>
+  movl $1, sysmode
+ 3ab:	c7 05 cc 12 00 00 01 	movl   $0x1,0x12cc
+ 3b2:	00 00 00 
+  jmp 2f
+ 3b5:	eb 03                	jmp    3ba <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 3b7:	cd 40                	int    $0x40
+  ret
+ 3b9:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 3ba:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 3bc:	ba c3 03 00 00       	mov    $0x3c3,%edx
+  sysenter
+ 3c1:	0f 34                	sysenter
+3:
+  ret
+ 3c3:	c3                   	ret
+
+000003c4 <fork>:
+
+SYSCALL(fork)
+ 3c4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c9:	eb b8                	jmp    383 <dosyscall>
+
+000003cb <exit>:
+SYSCALL(exit)
+ 3cb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d0:	eb b1                	jmp    383 <dosyscall>
+
+000003d2 <wait>:
+SYSCALL(wait)
+ 3d2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d7:	eb aa                	jmp    383 <dosyscall>
+
+000003d9 <pipe>:
+SYSCALL(pipe)
+ 3d9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3de:	eb a3                	jmp    383 <dosyscall>
+
+000003e0 <read>:
+SYSCALL(read)
+ 3e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e5:	eb 9c                	jmp    383 <dosyscall>
+
+000003e7 <write>:
+SYSCALL(write)
+ 3e7:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ec:	eb 95                	jmp    383 <dosyscall>
+
+000003ee <close>:
+SYSCALL(close)
+ 3ee:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f3:	eb 8e                	jmp    383 <dosyscall>
+
+000003f5 <kill>:
+SYSCALL(kill)
+ 3f5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3fa:	eb 87                	jmp    383 <dosyscall>
+
+000003fc <exec>:
+SYSCALL(exec)
+ 3fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 401:	eb 80                	jmp    383 <dosyscall>
+
+00000403 <open>:
+SYSCALL(open)
+ 403:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 408:	e9 76 ff ff ff       	jmp    383 <dosyscall>
+
+0000040d <mknod>:
+SYSCALL(mknod)
+ 40d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 412:	e9 6c ff ff ff       	jmp    383 <dosyscall>
+
+00000417 <unlink>:
+SYSCALL(unlink)
+ 417:	b8 12 00 00 00       	mov    $0x12,%eax
+ 41c:	e9 62 ff ff ff       	jmp    383 <dosyscall>
+
+00000421 <fstat>:
+SYSCALL(fstat)
+ 421:	b8 08 00 00 00       	mov    $0x8,%eax
+ 426:	e9 58 ff ff ff       	jmp    383 <dosyscall>
+
+0000042b <link>:
+SYSCALL(link)
+ 42b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 430:	e9 4e ff ff ff       	jmp    383 <dosyscall>
+
+00000435 <mkdir>:
+SYSCALL(mkdir)
+ 435:	b8 14 00 00 00       	mov    $0x14,%eax
+ 43a:	e9 44 ff ff ff       	jmp    383 <dosyscall>
+
+0000043f <chdir>:
+SYSCALL(chdir)
+ 43f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 444:	e9 3a ff ff ff       	jmp    383 <dosyscall>
+
+00000449 <dup>:
+SYSCALL(dup)
+ 449:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 44e:	e9 30 ff ff ff       	jmp    383 <dosyscall>
+
+00000453 <getpid>:
+SYSCALL(getpid)
+ 453:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 458:	e9 26 ff ff ff       	jmp    383 <dosyscall>
+
+0000045d <sbrk>:
+SYSCALL(sbrk)
+ 45d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 462:	e9 1c ff ff ff       	jmp    383 <dosyscall>
+
+00000467 <sleep>:
+SYSCALL(sleep)
+ 467:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 46c:	e9 12 ff ff ff       	jmp    383 <dosyscall>
+
+00000471 <uptime>:
+SYSCALL(uptime)
+ 471:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 476:	e9 08 ff ff ff       	jmp    383 <dosyscall>
+
+0000047b <symlink>:
+SYSCALL(symlink)
+ 47b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 480:	e9 fe fe ff ff       	jmp    383 <dosyscall>
+
+00000485 <readlink>:
+SYSCALL(readlink)
+ 485:	b8 17 00 00 00       	mov    $0x17,%eax
+ 48a:	e9 f4 fe ff ff       	jmp    383 <dosyscall>
+
+0000048f <fprot>:
+SYSCALL(fprot)
+ 48f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 494:	e9 ea fe ff ff       	jmp    383 <dosyscall>
+
+00000499 <funprot>:
+SYSCALL(funprot)
+ 499:	b8 19 00 00 00       	mov    $0x19,%eax
+ 49e:	e9 e0 fe ff ff       	jmp    383 <dosyscall>
+
+000004a3 <funlock>:
+SYSCALL(funlock)
+ 4a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a8:	e9 d6 fe ff ff       	jmp    383 <dosyscall>
+
+000004ad <mmap>:
+SYSCALL(mmap)
+ 4ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b2:	e9 cc fe ff ff       	jmp    383 <dosyscall>
+
+000004b7 <munmap>:
+SYSCALL(munmap)
+ 4b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4bc:	e9 c2 fe ff ff       	jmp    383 <dosyscall>
+
+000004c1 <sendfile>:
+SYSCALL(sendfile)
+ 4c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c6:	e9 b8 fe ff ff       	jmp    383 <dosyscall>
+
+000004cb <readv>:
+SYSCALL(readv)
+ 4cb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4d0:	e9 ae fe ff ff       	jmp    383 <dosyscall>
+
+000004d5 <writev>:
+SYSCALL(writev)
+ 4d5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4da:	e9 a4 fe ff ff       	jmp    383 <dosyscall>
+
+000004df <pread>:
+SYSCALL(pread)
+ 4df:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4e4:	e9 9a fe ff ff       	jmp    383 <dosyscall>
+
+000004e9 <pwrite>:
+SYSCALL(pwrite)
+ 4e9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4ee:	e9 90 fe ff ff       	jmp    383 <dosyscall>
+
+000004f3 <lseek>:
+SYSCALL(lseek)
+ 4f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4f8:	e9 86 fe ff ff       	jmp    383 <dosyscall>
+
+000004fd <spawn>:
+SYSCALL(spawn)
+ 4fd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 502:	e9 7c fe ff ff       	jmp    383 <dosyscall>
+
+00000507 <setpriority>:
+SYSCALL(setpriority)
+ 507:	b8 24 00 00 00       	mov    $0x24,%eax
+ 50c:	e9 72 fe ff ff       	jmp    383 <dosyscall>
+
+00000511 <kthread_create>:
+SYSCALL(kthread_create)
+ 511:	b8 25 00 00 00       	mov    $0x25,%eax
+ 516:	e9 68 fe ff ff       	jmp    383 <dosyscall>
+
+0000051b <kthread_id>:
+SYSCALL(kthread_id)
+ 51b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 520:	e9 5e fe ff ff       	jmp    383 <dosyscall>
+
+00000525 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 525:	b8 27 00 00 00       	mov    $0x27,%eax
+ 52a:	e9 54 fe ff ff       	jmp    383 <dosyscall>
+
+0000052f <kthread_join>:
+SYSCALL(kthread_join)
+ 52f:	b8 28 00 00 00       	mov    $0x28,%eax
+ 534:	e9 4a fe ff ff       	jmp    383 <dosyscall>
+
+00000539 <futex>:
+SYSCALL(futex)
+ 539:	b8 29 00 00 00       	mov    $0x29,%eax
+ 53e:	e9 40 fe ff ff       	jmp    383 <dosyscall>
+
+00000543 <signal>:
+SYSCALL(signal)
+ 543:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 548:	e9 36 fe ff ff       	jmp    383 <dosyscall>
+
+0000054d <alarm>:
+SYSCALL(alarm)
+ 54d:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 552:	e9 2c fe ff ff       	jmp    383 <dosyscall>
+
+00000557 <usleep>:
+SYSCALL(usleep)
+ 557:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 55c:	e9 22 fe ff ff       	jmp    383 <dosyscall>
+
+00000561 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 561:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 566:	e9 18 fe ff ff       	jmp    383 <dosyscall>
+
+0000056b <ioring_enter>:
+SYSCALL(ioring_enter)
+ 56b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 570:	e9 0e fe ff ff       	jmp    383 <dosyscall>
+
+00000575 <getrusage>:
+SYSCALL(getrusage)
+ 575:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 57a:	e9 04 fe ff ff       	jmp    383 <dosyscall>
+
+0000057f <mount>:
+SYSCALL(mount)
+ 57f:	b8 30 00 00 00       	mov    $0x30,%eax
+ 584:	e9 fa fd ff ff       	jmp    383 <dosyscall>
+
+00000589 <getdents>:
+SYSCALL(getdents)
+ 589:	b8 31 00 00 00       	mov    $0x31,%eax
+ 58e:	e9 f0 fd ff ff       	jmp    383 <dosyscall>
+
+00000593 <yield>:
+SYSCALL(yield)
+ 593:	b8 32 00 00 00       	mov    $0x32,%eax
+ 598:	e9 e6 fd ff ff       	jmp    383 <dosyscall>
+
+0000059d <ncpu>:
+SYSCALL(ncpu)
+ 59d:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5a2:	e9 dc fd ff ff       	jmp    383 <dosyscall>
+
+000005a7 <fallocate>:
+SYSCALL(fallocate)
+ 5a7:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5ac:	e9 d2 fd ff ff       	jmp    383 <dosyscall>
+
+000005b1 <ftruncate>:
+SYSCALL(ftruncate)
+ 5b1:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5b6:	e9 c8 fd ff ff       	jmp    383 <dosyscall>
+
+000005bb <fsync>:
+SYSCALL(fsync)
+ 5bb:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5c0:	e9 be fd ff ff       	jmp    383 <dosyscall>
+
+000005c5 <fdatasync>:
+SYSCALL(fdatasync)
+ 5c5:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5ca:	e9 b4 fd ff ff       	jmp    383 <dosyscall>
+
+000005cf <poll>:
+SYSCALL(poll)
+ 5cf:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5d4:	e9 aa fd ff ff       	jmp    383 <dosyscall>
+
+000005d9 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 5d9:	55                   	push   %ebp
+ 5da:	89 e5                	mov    %esp,%ebp
+ 5dc:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 5df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e2:	8b 40 04             	mov    0x4(%eax),%eax
+ 5e5:	85 c0                	test   %eax,%eax
+ 5e7:	7e 1f                	jle    608 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 5e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ec:	8b 50 04             	mov    0x4(%eax),%edx
+ 5ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f2:	8d 48 08             	lea    0x8(%eax),%ecx
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	8b 00                	mov    (%eax),%eax
+ 5fa:	83 ec 04             	sub    $0x4,%esp
+ 5fd:	52                   	push   %edx
+ 5fe:	51                   	push   %ecx
+ 5ff:	50                   	push   %eax
+ 600:	e8 d0 fe ff ff       	call   4d5 <writev>
+ 605:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 608:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 612:	8b 45 08             	mov    0x8(%ebp),%eax
+ 615:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 61c:	00 00 00 
+}
+ 61f:	90                   	nop
+ 620:	c9                   	leave
+ 621:	c3                   	ret
+
+00000622 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 622:	55                   	push   %ebp
+ 623:	89 e5                	mov    %esp,%ebp
+ 625:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 628:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 62c:	0f 84 94 00 00 00    	je     6c6 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 632:	8b 45 08             	mov    0x8(%ebp),%eax
+ 635:	8b 40 04             	mov    0x4(%eax),%eax
+ 638:	85 c0                	test   %eax,%eax
+ 63a:	7e 40                	jle    67c <put+0x5a>
+    v = &o->iov[o->n-1];
+ 63c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63f:	8b 40 04             	mov    0x4(%eax),%eax
+ 642:	83 e8 01             	sub    $0x1,%eax
+ 645:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 64c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64f:	01 d0                	add    %edx,%eax
+ 651:	83 c0 08             	add    $0x8,%eax
+ 654:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 657:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65a:	8b 10                	mov    (%eax),%edx
+ 65c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65f:	8b 40 04             	mov    0x4(%eax),%eax
+ 662:	01 d0                	add    %edx,%eax
+ 664:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 667:	75 13                	jne    67c <put+0x5a>
+      v->iov_len += n;
+ 669:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 66c:	8b 50 04             	mov    0x4(%eax),%edx
+ 66f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 672:	01 c2                	add    %eax,%edx
+ 674:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 677:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 67a:	eb 4b                	jmp    6c7 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 67c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67f:	8b 40 04             	mov    0x4(%eax),%eax
+ 682:	83 f8 10             	cmp    $0x10,%eax
+ 685:	75 0e                	jne    695 <put+0x73>
+    flush(o);
+ 687:	83 ec 0c             	sub    $0xc,%esp
+ 68a:	ff 75 08             	push   0x8(%ebp)
+ 68d:	e8 47 ff ff ff       	call   5d9 <flush>
+ 692:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 695:	8b 45 08             	mov    0x8(%ebp),%eax
+ 698:	8b 50 04             	mov    0x4(%eax),%edx
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 6a1:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 6a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a8:	8b 50 04             	mov    0x4(%eax),%edx
+ 6ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6b1:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 6b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6bb:	8d 50 01             	lea    0x1(%eax),%edx
+ 6be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c1:	89 50 04             	mov    %edx,0x4(%eax)
+ 6c4:	eb 01                	jmp    6c7 <put+0xa5>
+    return;
+ 6c6:	90                   	nop
+}
+ 6c7:	c9                   	leave
+ 6c8:	c3                   	ret
+
+000006c9 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 6c9:	55                   	push   %ebp
+ 6ca:	89 e5                	mov    %esp,%ebp
+ 6cc:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 6cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d2:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 6d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6db:	01 d0                	add    %edx,%eax
+ 6dd:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 6e2:	77 0b                	ja     6ef <room+0x26>
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ea:	83 f8 10             	cmp    $0x10,%eax
+ 6ed:	75 0e                	jne    6fd <room+0x34>
+    flush(o);
+ 6ef:	83 ec 0c             	sub    $0xc,%esp
+ 6f2:	ff 75 08             	push   0x8(%ebp)
+ 6f5:	e8 df fe ff ff       	call   5d9 <flush>
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 6fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 700:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 706:	8b 45 08             	mov    0x8(%ebp),%eax
+ 709:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 70f:	01 d0                	add    %edx,%eax
+}
+ 711:	c9                   	leave
+ 712:	c3                   	ret
+
+00000713 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 713:	55                   	push   %ebp
+ 714:	89 e5                	mov    %esp,%ebp
+ 716:	83 ec 28             	sub    $0x28,%esp
+ 719:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 71c:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 71f:	83 ec 08             	sub    $0x8,%esp
+ 722:	6a 01                	push   $0x1
+ 724:	ff 75 08             	push   0x8(%ebp)
+ 727:	e8 9d ff ff ff       	call   6c9 <room>
+ 72c:	83 c4 10             	add    $0x10,%esp
+ 72f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 735:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 739:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 73b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 744:	8d 50 01             	lea    0x1(%eax),%edx
+ 747:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74a:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	6a 01                	push   $0x1
+ 755:	ff 75 f4             	push   -0xc(%ebp)
+ 758:	ff 75 08             	push   0x8(%ebp)
+ 75b:	e8 c2 fe ff ff       	call   622 <put>
+ 760:	83 c4 10             	add    $0x10,%esp
+}
+ 763:	90                   	nop
+ 764:	c9                   	leave
+ 765:	c3                   	ret
+
+00000766 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 766:	55                   	push   %ebp
+ 767:	89 e5                	mov    %esp,%ebp
+ 769:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 76c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 773:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 777:	74 17                	je     790 <printint+0x2a>
+ 779:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 77d:	79 11                	jns    790 <printint+0x2a>
+    neg = 1;
+ 77f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 786:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 789:	f7 d8                	neg    %eax
+ 78b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 78e:	eb 06                	jmp    796 <printint+0x30>
+  } else {
+    x = xx;
+ 790:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 793:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 796:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 79d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7a3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7a8:	f7 f1                	div    %ecx
+ 7aa:	89 d1                	mov    %edx,%ecx
+ 7ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7af:	8d 50 01             	lea    0x1(%eax),%edx
+ 7b2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7b5:	0f b6 91 d0 12 00 00 	movzbl 0x12d0(%ecx),%edx
+ 7bc:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7c0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7c3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7c6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7cb:	f7 f1                	div    %ecx
+ 7cd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7d4:	75 c7                	jne    79d <printint+0x37>
+  if(neg)
+ 7d6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7da:	74 0e                	je     7ea <printint+0x84>
+    buf[i++] = '-';
+ 7dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7df:	8d 50 01             	lea    0x1(%eax),%edx
+ 7e2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7e5:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 7ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ed:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 7f0:	83 ec 08             	sub    $0x8,%esp
+ 7f3:	ff 75 e8             	push   -0x18(%ebp)
+ 7f6:	ff 75 08             	push   0x8(%ebp)
+ 7f9:	e8 cb fe ff ff       	call   6c9 <room>
+ 7fe:	83 c4 10             	add    $0x10,%esp
+ 801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 804:	eb 1d                	jmp    823 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 806:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 809:	83 e8 01             	sub    $0x1,%eax
+ 80c:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 80f:	89 c2                	mov    %eax,%edx
+ 811:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 814:	01 c2                	add    %eax,%edx
+ 816:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 819:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81c:	01 c8                	add    %ecx,%eax
+ 81e:	0f b6 00             	movzbl (%eax),%eax
+ 821:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 823:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 827:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 82b:	79 d9                	jns    806 <printint+0xa0>
+  o->used += n;
+ 82d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 830:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 836:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 839:	01 c2                	add    %eax,%edx
+ 83b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 83e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 844:	83 ec 04             	sub    $0x4,%esp
+ 847:	ff 75 e8             	push   -0x18(%ebp)
+ 84a:	ff 75 e4             	push   -0x1c(%ebp)
+ 84d:	ff 75 08             	push   0x8(%ebp)
+ 850:	e8 cd fd ff ff       	call   622 <put>
+ 855:	83 c4 10             	add    $0x10,%esp
+}
+ 858:	90                   	nop
+ 859:	c9                   	leave
+ 85a:	c3                   	ret
+
+0000085b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 85b:	55                   	push   %ebp
+ 85c:	89 e5                	mov    %esp,%ebp
+ 85e:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 864:	8b 45 08             	mov    0x8(%ebp),%eax
+ 867:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 86d:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 874:	00 00 00 
+  o.used = 0;
+ 877:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 87e:	00 00 00 
+  state = 0;
+ 881:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 888:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 88b:	83 c0 04             	add    $0x4,%eax
+ 88e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 891:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 898:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 89f:	e9 82 01 00 00       	jmp    a26 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 8a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8aa:	01 d0                	add    %edx,%eax
+ 8ac:	0f b6 00             	movzbl (%eax),%eax
+ 8af:	0f be c0             	movsbl %al,%eax
+ 8b2:	25 ff 00 00 00       	and    $0xff,%eax
+ 8b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 8ba:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 8be:	75 38                	jne    8f8 <printf+0x9d>
+      if(c == '%'){
+ 8c0:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 8c4:	0f 85 58 01 00 00    	jne    a22 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 8ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8cd:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 8d3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8d6:	01 ca                	add    %ecx,%edx
+ 8d8:	83 ec 04             	sub    $0x4,%esp
+ 8db:	50                   	push   %eax
+ 8dc:	52                   	push   %edx
+ 8dd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8e3:	50                   	push   %eax
+ 8e4:	e8 39 fd ff ff       	call   622 <put>
+ 8e9:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 8ec:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 8f3:	e9 2a 01 00 00       	jmp    a22 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 8f8:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 8fc:	0f 85 20 01 00 00    	jne    a22 <printf+0x1c7>
+      if(c == 'd'){
+ 902:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 906:	75 22                	jne    92a <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 908:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 90b:	8b 00                	mov    (%eax),%eax
+ 90d:	6a 01                	push   $0x1
+ 90f:	6a 0a                	push   $0xa
+ 911:	50                   	push   %eax
+ 912:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 918:	50                   	push   %eax
+ 919:	e8 48 fe ff ff       	call   766 <printint>
+ 91e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 921:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 925:	e9 e8 00 00 00       	jmp    a12 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 92a:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 92e:	74 06                	je     936 <printf+0xdb>
+ 930:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 934:	75 22                	jne    958 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 936:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 939:	8b 00                	mov    (%eax),%eax
+ 93b:	6a 00                	push   $0x0
+ 93d:	6a 10                	push   $0x10
+ 93f:	50                   	push   %eax
+ 940:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 946:	50                   	push   %eax
+ 947:	e8 1a fe ff ff       	call   766 <printint>
+ 94c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 94f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 953:	e9 ba 00 00 00       	jmp    a12 <printf+0x1b7>
+      } else if(c == 's'){
+ 958:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 95c:	75 3f                	jne    99d <printf+0x142>
+        s = (char*)*ap;
+ 95e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 961:	8b 00                	mov    (%eax),%eax
+ 963:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 966:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 96a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 96e:	75 07                	jne    977 <printf+0x11c>
+          s = "(null)";
+ 970:	c7 45 f4 1b 0f 00 00 	movl   $0xf1b,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 977:	83 ec 0c             	sub    $0xc,%esp
+ 97a:	ff 75 f4             	push   -0xc(%ebp)
+ 97d:	e8 47 f8 ff ff       	call   1c9 <strlen>
+ 982:	83 c4 10             	add    $0x10,%esp
+ 985:	83 ec 04             	sub    $0x4,%esp
+ 988:	50                   	push   %eax
+ 989:	ff 75 f4             	push   -0xc(%ebp)
+ 98c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 992:	50                   	push   %eax
+ 993:	e8 8a fc ff ff       	call   622 <put>
+ 998:	83 c4 10             	add    $0x10,%esp
+ 99b:	eb 75                	jmp    a12 <printf+0x1b7>
+      } else if(c == 'c'){
+ 99d:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 9a1:	75 21                	jne    9c4 <printf+0x169>
+        putc(&o, *ap);
+ 9a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9a6:	8b 00                	mov    (%eax),%eax
+ 9a8:	0f be c0             	movsbl %al,%eax
+ 9ab:	83 ec 08             	sub    $0x8,%esp
+ 9ae:	50                   	push   %eax
+ 9af:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9b5:	50                   	push   %eax
+ 9b6:	e8 58 fd ff ff       	call   713 <putc>
+ 9bb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9be:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9c2:	eb 4e                	jmp    a12 <printf+0x1b7>
+      } else if(c == '%'){
+ 9c4:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9c8:	75 1b                	jne    9e5 <printf+0x18a>
+        putc(&o, c);
+ 9ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9cd:	0f be c0             	movsbl %al,%eax
+ 9d0:	83 ec 08             	sub    $0x8,%esp
+ 9d3:	50                   	push   %eax
+ 9d4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9da:	50                   	push   %eax
+ 9db:	e8 33 fd ff ff       	call   713 <putc>
+ 9e0:	83 c4 10             	add    $0x10,%esp
+ 9e3:	eb 2d                	jmp    a12 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 9e5:	83 ec 08             	sub    $0x8,%esp
+ 9e8:	6a 25                	push   $0x25
+ 9ea:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9f0:	50                   	push   %eax
+ 9f1:	e8 1d fd ff ff       	call   713 <putc>
+ 9f6:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 9f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9fc:	0f be c0             	movsbl %al,%eax
+ 9ff:	83 ec 08             	sub    $0x8,%esp
+ a02:	50                   	push   %eax
+ a03:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a09:	50                   	push   %eax
+ a0a:	e8 04 fd ff ff       	call   713 <putc>
+ a0f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a12:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ a19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1c:	83 c0 01             	add    $0x1,%eax
+ a1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a22:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a26:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a2c:	01 d0                	add    %edx,%eax
+ a2e:	0f b6 00             	movzbl (%eax),%eax
+ a31:	84 c0                	test   %al,%al
+ a33:	0f 85 6b fe ff ff    	jne    8a4 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ a39:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ a3d:	75 22                	jne    a61 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ a3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a42:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a48:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a4b:	01 ca                	add    %ecx,%edx
+ a4d:	83 ec 04             	sub    $0x4,%esp
+ a50:	50                   	push   %eax
+ a51:	52                   	push   %edx
+ a52:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a58:	50                   	push   %eax
+ a59:	e8 c4 fb ff ff       	call   622 <put>
+ a5e:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ a61:	83 ec 0c             	sub    $0xc,%esp
+ a64:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a6a:	50                   	push   %eax
+ a6b:	e8 69 fb ff ff       	call   5d9 <flush>
+ a70:	83 c4 10             	add    $0x10,%esp
+}
+ a73:	90                   	nop
+ a74:	c9                   	leave
+ a75:	c3                   	ret
+
+00000a76 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ a76:	55                   	push   %ebp
+ a77:	89 e5                	mov    %esp,%ebp
+ a79:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+ a7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ a85:	f0 87 02             	lock xchg %eax,(%edx)
+ a88:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a8e:	c9                   	leave
+ a8f:	c3                   	ret
+
+00000a90 <lock>:
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a96:	a1 00 15 00 00       	mov    0x1500,%eax
+ a9b:	85 c0                	test   %eax,%eax
+ a9d:	74 09                	je     aa8 <lock+0x18>
+ a9f:	a1 00 15 00 00       	mov    0x1500,%eax
+ aa4:	ff d0                	call   *%eax
+ aa6:	eb 05                	jmp    aad <lock+0x1d>
+ aa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ aad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ ab0:	90                   	nop
+ ab1:	83 ec 08             	sub    $0x8,%esp
+ ab4:	6a 01                	push   $0x1
+ ab6:	68 38 15 00 00       	push   $0x1538
+ abb:	e8 b6 ff ff ff       	call   a76 <xchg>
+ ac0:	83 c4 10             	add    $0x10,%esp
+ ac3:	85 c0                	test   %eax,%eax
+ ac5:	75 ea                	jne    ab1 <lock+0x21>
+  return pin;
+ ac7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ aca:	c9                   	leave
+ acb:	c3                   	ret
+
+00000acc <unlock>:
+{
+ acc:	55                   	push   %ebp
+ acd:	89 e5                	mov    %esp,%ebp
+ acf:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ ad2:	6a 00                	push   $0x0
+ ad4:	68 38 15 00 00       	push   $0x1538
+ ad9:	e8 98 ff ff ff       	call   a76 <xchg>
+ ade:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ ae1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ae5:	78 10                	js     af7 <unlock+0x2b>
+    mallocunpin(pin);
+ ae7:	a1 04 15 00 00       	mov    0x1504,%eax
+ aec:	83 ec 0c             	sub    $0xc,%esp
+ aef:	ff 75 08             	push   0x8(%ebp)
+ af2:	ff d0                	call   *%eax
+ af4:	83 c4 10             	add    $0x10,%esp
+}
+ af7:	90                   	nop
+ af8:	c9                   	leave
+ af9:	c3                   	ret
+
+00000afa <sizeclass>:
+{
+ afa:	55                   	push   %ebp
+ afb:	89 e5                	mov    %esp,%ebp
+ afd:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ b00:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ b07:	eb 1c                	jmp    b25 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ b09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0c:	ba 02 00 00 00       	mov    $0x2,%edx
+ b11:	89 c1                	mov    %eax,%ecx
+ b13:	d3 e2                	shl    %cl,%edx
+ b15:	89 d0                	mov    %edx,%eax
+ b17:	3b 45 08             	cmp    0x8(%ebp),%eax
+ b1a:	72 05                	jb     b21 <sizeclass+0x27>
+      return c;
+ b1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1f:	eb 0f                	jmp    b30 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ b21:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ b25:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ b29:	7e de                	jle    b09 <sizeclass+0xf>
+  return -1;
+ b2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b30:	c9                   	leave
+ b31:	c3                   	ret
+
+00000b32 <bigfree>:
+{
+ b32:	55                   	push   %ebp
+ b33:	89 e5                	mov    %esp,%ebp
+ b35:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b38:	a1 10 15 00 00       	mov    0x1510,%eax
+ b3d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b40:	eb 24                	jmp    b66 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b45:	8b 00                	mov    (%eax),%eax
+ b47:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b4a:	72 12                	jb     b5e <bigfree+0x2c>
+ b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b52:	72 24                	jb     b78 <bigfree+0x46>
+ b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b57:	8b 00                	mov    (%eax),%eax
+ b59:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b5c:	72 1a                	jb     b78 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b5e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b61:	8b 00                	mov    (%eax),%eax
+ b63:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b66:	8b 45 08             	mov    0x8(%ebp),%eax
+ b69:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b6c:	73 d4                	jae    b42 <bigfree+0x10>
+ b6e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b71:	8b 00                	mov    (%eax),%eax
+ b73:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b76:	73 ca                	jae    b42 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ b78:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7b:	8b 40 04             	mov    0x4(%eax),%eax
+ b7e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b85:	8b 45 08             	mov    0x8(%ebp),%eax
+ b88:	01 c2                	add    %eax,%edx
+ b8a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8d:	8b 00                	mov    (%eax),%eax
+ b8f:	39 c2                	cmp    %eax,%edx
+ b91:	75 24                	jne    bb7 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b93:	8b 45 08             	mov    0x8(%ebp),%eax
+ b96:	8b 50 04             	mov    0x4(%eax),%edx
+ b99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9c:	8b 00                	mov    (%eax),%eax
+ b9e:	8b 40 04             	mov    0x4(%eax),%eax
+ ba1:	01 c2                	add    %eax,%edx
+ ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba6:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ba9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bac:	8b 00                	mov    (%eax),%eax
+ bae:	8b 10                	mov    (%eax),%edx
+ bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb3:	89 10                	mov    %edx,(%eax)
+ bb5:	eb 0a                	jmp    bc1 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ bb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bba:	8b 10                	mov    (%eax),%edx
+ bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbf:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ bc1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc4:	8b 40 04             	mov    0x4(%eax),%eax
+ bc7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd1:	01 d0                	add    %edx,%eax
+ bd3:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bd6:	75 20                	jne    bf8 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ bd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bdb:	8b 50 04             	mov    0x4(%eax),%edx
+ bde:	8b 45 08             	mov    0x8(%ebp),%eax
+ be1:	8b 40 04             	mov    0x4(%eax),%eax
+ be4:	01 c2                	add    %eax,%edx
+ be6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bec:	8b 45 08             	mov    0x8(%ebp),%eax
+ bef:	8b 10                	mov    (%eax),%edx
+ bf1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf4:	89 10                	mov    %edx,(%eax)
+ bf6:	eb 08                	jmp    c00 <bigfree+0xce>
+    p->s.ptr = bp;
+ bf8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+ bfe:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c03:	a3 10 15 00 00       	mov    %eax,0x1510
+}
+ c08:	90                   	nop
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
+
+00000c0b <free>:
+{
+ c0b:	55                   	push   %ebp
+ c0c:	89 e5                	mov    %esp,%ebp
+ c0e:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ c11:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ c15:	74 68                	je     c7f <free+0x74>
+  bp = (Header*)ap - 1;
+ c17:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1a:	83 e8 08             	sub    $0x8,%eax
+ c1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ c20:	e8 6b fe ff ff       	call   a90 <lock>
+ c25:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ c28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2b:	8b 40 04             	mov    0x4(%eax),%eax
+ c2e:	83 ec 0c             	sub    $0xc,%esp
+ c31:	50                   	push   %eax
+ c32:	e8 c3 fe ff ff       	call   afa <sizeclass>
+ c37:	83 c4 10             	add    $0x10,%esp
+ c3a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ c3d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ c41:	78 1e                	js     c61 <free+0x56>
+    bp->s.ptr = classfree[c];
+ c43:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c46:	8b 14 85 14 15 00 00 	mov    0x1514(,%eax,4),%edx
+ c4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c50:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ c52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c58:	89 14 85 14 15 00 00 	mov    %edx,0x1514(,%eax,4)
+ c5f:	eb 0e                	jmp    c6f <free+0x64>
+    bigfree(bp);
+ c61:	83 ec 0c             	sub    $0xc,%esp
+ c64:	ff 75 f4             	push   -0xc(%ebp)
+ c67:	e8 c6 fe ff ff       	call   b32 <bigfree>
+ c6c:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ c6f:	83 ec 0c             	sub    $0xc,%esp
+ c72:	ff 75 f0             	push   -0x10(%ebp)
+ c75:	e8 52 fe ff ff       	call   acc <unlock>
+ c7a:	83 c4 10             	add    $0x10,%esp
+ c7d:	eb 01                	jmp    c80 <free+0x75>
+    return;
+ c7f:	90                   	nop
+}
+ c80:	c9                   	leave
+ c81:	c3                   	ret
+
+00000c82 <morecore>:
+{
+ c82:	55                   	push   %ebp
+ c83:	89 e5                	mov    %esp,%ebp
+ c85:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c88:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c8f:	77 07                	ja     c98 <morecore+0x16>
+    nu = 4096;
+ c91:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c98:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9b:	c1 e0 03             	shl    $0x3,%eax
+ c9e:	83 ec 0c             	sub    $0xc,%esp
+ ca1:	50                   	push   %eax
+ ca2:	e8 b6 f7 ff ff       	call   45d <sbrk>
+ ca7:	83 c4 10             	add    $0x10,%esp
+ caa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ cad:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ cb1:	75 07                	jne    cba <morecore+0x38>
+    return 0;
+ cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+ cb8:	eb 22                	jmp    cdc <morecore+0x5a>
+  hp = (Header*)p;
+ cba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ cc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+ cc6:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ cc9:	83 ec 0c             	sub    $0xc,%esp
+ ccc:	ff 75 f0             	push   -0x10(%ebp)
+ ccf:	e8 5e fe ff ff       	call   b32 <bigfree>
+ cd4:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cd7:	a1 10 15 00 00       	mov    0x1510,%eax
+}
+ cdc:	c9                   	leave
+ cdd:	c3                   	ret
+
+00000cde <bigalloc>:
+{
+ cde:	55                   	push   %ebp
+ cdf:	89 e5                	mov    %esp,%ebp
+ ce1:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ ce4:	a1 10 15 00 00       	mov    0x1510,%eax
+ ce9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cec:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cf0:	75 23                	jne    d15 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ cf2:	c7 45 f0 08 15 00 00 	movl   $0x1508,-0x10(%ebp)
+ cf9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cfc:	a3 10 15 00 00       	mov    %eax,0x1510
+ d01:	a1 10 15 00 00       	mov    0x1510,%eax
+ d06:	a3 08 15 00 00       	mov    %eax,0x1508
+    base.s.size = 0;
+ d0b:	c7 05 0c 15 00 00 00 	movl   $0x0,0x150c
+ d12:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d18:	8b 00                	mov    (%eax),%eax
+ d1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d20:	8b 40 04             	mov    0x4(%eax),%eax
+ d23:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d26:	72 4a                	jb     d72 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ d28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2b:	8b 40 04             	mov    0x4(%eax),%eax
+ d2e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ d31:	75 0c                	jne    d3f <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d36:	8b 10                	mov    (%eax),%edx
+ d38:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d3b:	89 10                	mov    %edx,(%eax)
+ d3d:	eb 26                	jmp    d65 <bigalloc+0x87>
+        p->s.size -= nunits;
+ d3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d42:	8b 40 04             	mov    0x4(%eax),%eax
+ d45:	2b 45 08             	sub    0x8(%ebp),%eax
+ d48:	89 c2                	mov    %eax,%edx
+ d4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d53:	8b 40 04             	mov    0x4(%eax),%eax
+ d56:	c1 e0 03             	shl    $0x3,%eax
+ d59:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+ d62:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ d65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d68:	a3 10 15 00 00       	mov    %eax,0x1510
+      return p;
+ d6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d70:	eb 3b                	jmp    dad <bigalloc+0xcf>
+    if(p == freep)
+ d72:	a1 10 15 00 00       	mov    0x1510,%eax
+ d77:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d7a:	75 1e                	jne    d9a <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ d7c:	83 ec 0c             	sub    $0xc,%esp
+ d7f:	ff 75 08             	push   0x8(%ebp)
+ d82:	e8 fb fe ff ff       	call   c82 <morecore>
+ d87:	83 c4 10             	add    $0x10,%esp
+ d8a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d8d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d91:	75 07                	jne    d9a <bigalloc+0xbc>
+        return 0;
+ d93:	b8 00 00 00 00       	mov    $0x0,%eax
+ d98:	eb 13                	jmp    dad <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ da0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da3:	8b 00                	mov    (%eax),%eax
+ da5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ da8:	e9 70 ff ff ff       	jmp    d1d <bigalloc+0x3f>
+}
+ dad:	c9                   	leave
+ dae:	c3                   	ret
+
+00000daf <alloc>:
+alloc(uint nbytes)
+{
+ daf:	55                   	push   %ebp
+ db0:	89 e5                	mov    %esp,%ebp
+ db2:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ db5:	8b 45 08             	mov    0x8(%ebp),%eax
+ db8:	83 c0 07             	add    $0x7,%eax
+ dbb:	c1 e8 03             	shr    $0x3,%eax
+ dbe:	83 c0 01             	add    $0x1,%eax
+ dc1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ dc4:	ff 75 f4             	push   -0xc(%ebp)
+ dc7:	e8 2e fd ff ff       	call   afa <sizeclass>
+ dcc:	83 c4 04             	add    $0x4,%esp
+ dcf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dd2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ dd6:	79 2c                	jns    e04 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ dd8:	83 ec 0c             	sub    $0xc,%esp
+ ddb:	ff 75 f4             	push   -0xc(%ebp)
+ dde:	e8 fb fe ff ff       	call   cde <bigalloc>
+ de3:	83 c4 10             	add    $0x10,%esp
+ de6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ de9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ded:	75 0a                	jne    df9 <alloc+0x4a>
+      return 0;
+ def:	b8 00 00 00 00       	mov    $0x0,%eax
+ df4:	e9 c8 00 00 00       	jmp    ec1 <alloc+0x112>
+    return (void*)(p + 1);
+ df9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dfc:	83 c0 08             	add    $0x8,%eax
+ dff:	e9 bd 00 00 00       	jmp    ec1 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ e04:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e07:	8b 04 85 14 15 00 00 	mov    0x1514(,%eax,4),%eax
+ e0e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e11:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e15:	74 1a                	je     e31 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ e17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e1a:	8b 10                	mov    (%eax),%edx
+ e1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e1f:	89 14 85 14 15 00 00 	mov    %edx,0x1514(,%eax,4)
+    return (void*)(p + 1);
+ e26:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e29:	83 c0 08             	add    $0x8,%eax
+ e2c:	e9 90 00 00 00       	jmp    ec1 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ e31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e34:	ba 02 00 00 00       	mov    $0x2,%edx
+ e39:	89 c1                	mov    %eax,%ecx
+ e3b:	d3 e2                	shl    %cl,%edx
+ e3d:	89 d0                	mov    %edx,%eax
+ e3f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ e42:	a1 30 15 00 00       	mov    0x1530,%eax
+ e47:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e4a:	c1 e2 03             	shl    $0x3,%edx
+ e4d:	01 d0                	add    %edx,%eax
+ e4f:	8b 15 34 15 00 00    	mov    0x1534,%edx
+ e55:	39 c2                	cmp    %eax,%edx
+ e57:	73 3f                	jae    e98 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ e59:	83 ec 0c             	sub    $0xc,%esp
+ e5c:	68 00 08 00 00       	push   $0x800
+ e61:	e8 78 fe ff ff       	call   cde <bigalloc>
+ e66:	83 c4 10             	add    $0x10,%esp
+ e69:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e70:	75 07                	jne    e79 <alloc+0xca>
+      return 0;
+ e72:	b8 00 00 00 00       	mov    $0x0,%eax
+ e77:	eb 48                	jmp    ec1 <alloc+0x112>
+    bump = (char*)p;
+ e79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e7c:	a3 30 15 00 00       	mov    %eax,0x1530
+    bumpend = (char*)(p + p->s.size);
+ e81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e84:	8b 40 04             	mov    0x4(%eax),%eax
+ e87:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e91:	01 d0                	add    %edx,%eax
+ e93:	a3 34 15 00 00       	mov    %eax,0x1534
+  }
+  p = (Header*)bump;
+ e98:	a1 30 15 00 00       	mov    0x1530,%eax
+ e9d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ ea0:	a1 30 15 00 00       	mov    0x1530,%eax
+ ea5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ea8:	c1 e2 03             	shl    $0x3,%edx
+ eab:	01 d0                	add    %edx,%eax
+ ead:	a3 30 15 00 00       	mov    %eax,0x1530
+  p->s.size = nunits;
+ eb2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ eb8:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ ebb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ebe:	83 c0 08             	add    $0x8,%eax
+}
+ ec1:	c9                   	leave
+ ec2:	c3                   	ret
+
+00000ec3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ec3:	55                   	push   %ebp
+ ec4:	89 e5                	mov    %esp,%ebp
+ ec6:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ ec9:	e8 c2 fb ff ff       	call   a90 <lock>
+ ece:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ ed1:	83 ec 0c             	sub    $0xc,%esp
+ ed4:	ff 75 08             	push   0x8(%ebp)
+ ed7:	e8 d3 fe ff ff       	call   daf <alloc>
+ edc:	83 c4 10             	add    $0x10,%esp
+ edf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ ee2:	83 ec 0c             	sub    $0xc,%esp
+ ee5:	ff 75 f4             	push   -0xc(%ebp)
+ ee8:	e8 df fb ff ff       	call   acc <unlock>
+ eed:	83 c4 10             	add    $0x10,%esp
+  return p;
+ ef0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ef3:	c9                   	leave
+ ef4:	c3                   	ret
@@ -13,8 +13,10 @@
 #include "mmu.h"
 #include "proc.h"
 #include "x86.h"
+#include "poll.h"
 
 static void consputc(int);
+static void cgaflush(void);
 
 static int panicked = 0;
 
@@ -98,6 +100,7 @@ cprintf(char *fmt, ...)
     }
   }
 
+  cgaflush();
   if(locking)
     release(&cons.lock);
 }
@@ -110,6 +113,7 @@ panic(char *s)
   
   cli();
   cons.locking = 0;
+  uartpanic();
   cprintf("cpu%d: panic: ", cpu->id);
   cprintf(s);
   cprintf("\n");
@@ -126,21 +130,28 @@ panic(char *s)
 #define CRTPORT 0x3d4
 static ushort *crt = (ushort*)P2V(0xb8000);  // CGA memory
 
+// Characters go into CGA memory as they come, but the cursor, which
+// takes port I/O to move, moves only in cgaflush, after a batch.
+static int cgapos = -1;  // cursor position: col + 80*row; -1: ask the CRT
+
 static void
 cgaputc(int c)
 {
   int pos;
   
-  // Cursor position: col + 80*row.
-  outb(CRTPORT, 14);
-  pos = inb(CRTPORT+1) << 8;
-  outb(CRTPORT, 15);
-  pos |= inb(CRTPORT+1);
+  if(cgapos < 0){
+    outb(CRTPORT, 14);
+    cgapos = inb(CRTPORT+1) << 8;
+    outb(CRTPORT, 15);
+    cgapos |= inb(CRTPORT+1);
+  }
+  pos = cgapos;
 
   if(c == '\n')
     pos += 80 - pos%80;
   else if(c == BACKSPACE){
     if(pos > 0) --pos;
+    crt[pos] = ' ' | 0x0700;
   } else
     crt[pos++] = (c&0xff) | 0x0700;  // black on white
   
@@ -149,15 +160,23 @@ cgaputc(int c)
     pos -= 80;
     memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
   }
-  
+  cgapos = pos;
+}
+
+// Move the cursor to where the output has got to.
+static void
+cgaflush(void)
+{
+  if(cgapos < 0)
+    return;
   outb(CRTPORT, 14);
-  outb(CRTPORT+1, pos>>8);
+  outb(CRTPORT+1, cgapos>>8);
   outb(CRTPORT, 15);
-  outb(CRTPORT+1, pos);
-  crt[pos] = ' ' | 0x0700;
+  outb(CRTPORT+1, cgapos);
+  crt[cgapos] = ' ' | 0x0700;
 }
 
-void
+static void
 consputc(int c)
 {
   if(panicked){
@@ -194,6 +213,7 @@ consoleintr(int (*getc)(void))
     switch(c){
     case C('P'):  // Process listing.
       procdump();
+      idedump();
       break;
     case C('U'):  // Kill line.
       while(input.e != input.w &&
@@ -216,16 +236,18 @@ consoleintr(int (*getc)(void))
         if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
           input.w = input.e;
           wakeup(&input.r);
+          pollwake();
         }
       }
       break;
     }
   }
+  cgaflush();
   release(&input.lock);
 }
 
 int
-consoleread(struct inode *ip, char *dst, int n)
+consoleread(struct inode *ip, char *dst, uint off, int n)
 {
   uint target;
   int c;
@@ -262,19 +284,48 @@ consoleread(struct inode *ip, char *dst, int n)
   return target - n;
 }
 
+// Queue the n bytes at buf for the serial port, a ringful at a
+// time, and put them on the screen.  Sleep while the ring is full
+// rather than wait on the UART.
 int
-consolewrite(struct inode *ip, char *buf, int n)
+consolewrite(struct inode *ip, char *buf, uint off, int n)
 {
-  int i;
+  int i, j, m;
 
   iunlock(ip);
-  acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
-  release(&cons.lock);
+  for(i = 0; i < n; i += m){
+    if(panicked){
+      cli();
+      for(;;)
+        ;
+    }
+    acquire(&cons.lock);
+    m = uartwrite(buf + i, n - i);
+    for(j = i; j < i + m; j++)
+      cgaputc(buf[j] & 0xff);
+    cgaflush();
+    release(&cons.lock);
+    if(m == 0){
+      if(proc->killed)
+        break;
+      uartwait();
+    }
+  }
   ilock(ip);
 
-  return n;
+  return i > 0 || n == 0 ? i : -1;
+}
+
+// A read would not block once a line is in; writes never do.
+int
+consolepoll(struct inode *ip)
+{
+  int r;
+
+  acquire(&input.lock);
+  r = input.r != input.w ? POLLIN | POLLOUT : POLLOUT;
+  release(&input.lock);
+  return r;
 }
 
 void
@@ -285,9 +336,10 @@ consoleinit(void)
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
   cons.locking = 1;
 
   picenable(IRQ_KBD);
-  ioapicenable(IRQ_KBD, 0);
+  ioapicenable(IRQ_KBD, -1);
 }
 
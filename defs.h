@@ -1,18 +1,41 @@
 struct buf;
+struct callout;
 struct context;
+struct dent;
 struct file;
+struct image;
 struct inode;
+struct iovec;
+struct page;
 struct pipe;
+struct pollfd;
 struct proc;
+struct report;
+struct slabcache;
 struct spinlock;
 struct stat;
 struct superblock;
+struct sysstat;
+struct trapframe;
+struct usage;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bnew(uint, uint);
+struct buf*     bpeek(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bawrite(struct buf*);
+int             bshrink(void);
+void            bstats(struct report*);
+
+// callout.c
+void            callout(struct callout*, uint, void (*)(void*), void*);
+int             calloutstop(struct callout*);
+void            callouttick(void);
+int             tsleep(uint);
 
 // console.c
 void            consoleinit(void);
@@ -22,6 +45,9 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execload(char*, char**, struct image*);
+void            execfree(struct image*);
+void            execinstall(struct proc*, struct image*);
 
 // file.c
 struct file*    filealloc(void);
@@ -30,11 +56,22 @@ struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
+int             filegetdents(struct file*, struct dent*, int);
 int             filewrite(struct file*, char*, int n);
+int             filereadat(struct file*, char*, int n, uint off);
+int             filewriteat(struct file*, char*, int n, uint off);
+int             fileseek(struct file*, int, int);
+int             filereadv(struct file*, struct iovec*, int);
+int             filewritev(struct file*, struct iovec*, int);
+int             filesend(struct file*, struct file*, int n);
+int             filefalloc(struct file*, uint, uint);
+int             filetrunc(struct file*, uint);
+int             filesync(struct file*, int);
+void            pollwake(void);
+int             filepollv(struct file**, struct pollfd*, int, int);
 /*vvv  TASK 1.2  vvv*/
 int             filesymlink(const char *oldpath, const char *newpath);
 int             filereadlink(const char *pathname, char *buf, int bufsiz);
-int             filereadlinki(const char *pathname, char *buf, int bufsiz);
 /*^^^^^^^^^^^^^^^^^^*/
 /*vvv  TASK 2    vvv*/
 int             filefprot(const char *pathname, const char *password);
@@ -43,45 +80,77 @@ int             filefunlock(const char *pathname, const char *password);
 /*^^^^^^^^^^^^^^^^^^*/
 
 // fs.c
+void            istats(struct report*);
 void            readsb(int dev, struct superblock *sb);
+void            fsinit(int);
 int             dirlink(struct inode*, char*, uint);
+int             dirlist(struct inode*, uint*, struct dent*, int);
+void            dirindex(struct inode*, int);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+void            dcset(struct inode*, char*, uint, uint);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+int             ifalloc(struct inode*, uint*, uint, int);
 void            iinit(void);
+void            ireadahead(struct inode*, uint, uint);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
+struct page*    ipage(struct inode*, uint);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
+struct inode*   nameilink(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
+int             itruncate(struct inode*, uint);
 int             writei(struct inode*, char*, uint, uint);
+int             idirect(struct inode*, char*, uint, uint, int);
 /*vvv  TASK 2    vvv*/
-void            free_inode_locks(int pid);
-void            unlock_inode(struct inode* ip);
+int             unlock_inode(struct inode* ip);
 int             is_inode_unlocked(struct inode* ip);
-void            fork_pids(int old_pid, int new_pid);
 /*^^^^^^^^^^^^^^^^^^*/
 
+// futex.c
+void            futexinit(void);
+int             futex(uint, int, int);
+
 // ide.c
 void            ideinit(void);
-void            ideintr(void);
+void            ideintr(int);
 void            iderw(struct buf*);
+void            iderwv(struct buf*, int);
+void            idestats(struct report*);
+void            idestripe(uint, uint);
+void            idedump(void);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
+void            ioapicroute(int, int);
+
+// ioring.c
+int             ioringenter(int, int);
+void            ioringfree(struct proc*);
+int             ioringsetup(uint);
 
 // kalloc.c
+void            kmemstats(struct report*);
 char*           kalloc(void);
 void            kfree(char*);
+char*           kalloc_zeroed(void);
+void            kidle(void);
+void            kdup(char*);
+char*           kallocn(int);
+void            kfreen(char*, int);
+int             krefs(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kfreepages(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -90,55 +159,138 @@ void            kbdintr(void);
 int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicipi(int);
 void            lapicinit(int);
+void            lapictimer(int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
+// kstat.c
+void            kstatinit(void);
+void            kstatinc(int);
+void            kstatadd(int, uint);
+uint            kstatcpu(int, int);
+uint            kstatsum(int);
+void            report(struct report*, char*, uint);
+void            reportpct(struct report*, char*, uint, uint);
+
+// lockstat.c
+void            lockstatinit(void);
+void            lockregister(struct spinlock*);
+void            lockunregister(struct spinlock*);
+
 // log.c
 void            initlog(void);
+void            logstats(struct report*);
 void            log_write(struct buf*);
-void            begin_trans();
+int             log_maxblocks(void);
+int             log_tid(void);
+void            log_wait(int);
+void            begin_trans(int);
 void            commit_trans();
 
+// main.c
+int             bootarg(char*, int);
+
 // mp.c
 extern int      ismp;
 int             mpbcpu(void);
 void            mpinit(void);
 void            mpstartthem(void);
 
+// pci.c
+int             pcifind(int, int, uint*);
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
+// pcache.c
+void            pcinit(void);
+struct page*    pcget(struct inode*, uint);
+struct page*    pclookup(struct inode*, uint);
+int             pcfill(struct page*);
+void            pcfilled(struct page*);
+void            pcpin(struct page*);
+int             pccached(struct inode*, uint);
+void            pcput(struct page*);
+int             pcpurge(struct inode*);
+int             pctrunc(struct inode*, uint);
+int             pcshrink(void);
+
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
-int             piperead(struct pipe*, char*, int);
-int             pipewrite(struct pipe*, char*, int);
+int             piperead(struct pipe*, struct iovec*, int);
+int             pipewrite(struct pipe*, struct iovec*, int);
+int             pipepoll(struct pipe*, int);
 
 //PAGEBREAK: 16
+// prof.c
+void            profinit(void);
+int             proftick(struct trapframe*);
+
 // proc.c
+void            schedstats(struct report*);
+void            boost(void);
 struct proc*    copyproc(struct proc*);
+void            endthreads(void);
 void            exit(void);
+void            fdfree(struct proc*);
+int             fdgrow(struct proc*, int);
 int             fork(void);
+void            getusage(int, struct usage*);
 int             growproc(int);
 int             kill(int);
+struct proc*    kproc(char*, void(*)(void));
+int             kthreadcreate(uint, uint, uint);
+void            kthreadexit(void);
+int             kthreadjoin(int);
+int             kworker(char*, void(*)(void));
+void            kworkerexit(void);
+void            lockgroup(void);
 void            pinit(void);
 void            procdump(void);
+void            procstatclear(void);
+int             procstatread(char*, uint, int);
+int             register_handler(void (*)(void));
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setpriority(int, int);
 void            sleep(void*, struct spinlock*);
+struct proc*    swaplock(int, int);
+void            swapunlock(void);
+int             spawn(char*, char**, int*, int);
+int             tick(void);
+void            unlockgroup(void);
 void            userinit(void);
 int             wait(void);
+void            wakeone(void*);
+int             wakeupn(void*, int);
 void            wakeup(void*);
 void            yield(void);
-/*vvv  TASK 2    vvv*/
-int             is_inode_open(struct inode*);
-/*^^^^^^^^^^^^^^^^^^*/
+
+// swap.c
+int             swapalloc(void);
+void            swapdup(uint);
+void            swapfree(uint);
+void            swapinit(uint, uint, uint);
+void            swapio(uint, char*, int);
+int             swapready(void);
+void            swapstats(struct report*);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// slab.c
+void            slabinit(struct slabcache*, char*, uint, void (*)(void*),
+                         void (*)(void*));
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
@@ -156,20 +308,41 @@ char*           safestrcpy(char*, const char*, int);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
+int             snprintf(char*, int, char*, ...);
+void            emitline(char*, uint*, char*, uint, int);
 
 // syscall.c
 int             argint(int, int*);
-int             argptr(int, char**, int);
+int             argptr(int, char**, int, int);
+int             checkptr(uint, int, int);
 int             argstr(int, char**);
 int             fetchint(struct proc*, uint, int*);
 int             fetchstr(struct proc*, uint, char**);
+void            fmtsysstat(struct sysstat*, char*, int, int);
 void            syscall(void);
+void            sysstatinit(void);
+
+// sysfile.c
+int             closefd(int);
+struct file*    fdfile(int);
+int             openfd(char*, int);
 
 // timer.c
 void            timerinit(void);
 
+// tmpfs.c
+int             ismount(struct inode*);
+struct inode*   mountcross(struct inode*);
+struct inode*   mountup(struct inode*);
+void            tmpfree(int);
+void            tmpinit(void);
+uint            tmpinum(uint);
+int             tmpmount(struct inode*);
+struct page*    tmppage(struct inode*, uint);
+
 // trap.c
 void            idtinit(void);
+void            systrap(struct trapframe*);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -177,7 +350,10 @@ extern struct spinlock tickslock;
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
+void            uartpanic(void);
 void            uartputc(int);
+void            uartwait(void);
+int             uartwrite(char*, int);
 
 // vm.c
 void            seginit(void);
@@ -185,16 +361,35 @@ void            kvmalloc(void);
 void            vmenable(void);
 pde_t*          setupkvm();
 char*           uva2ka(pde_t*, char*);
+char*           uva2kafault(char*, int);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+int             cowfault(uint);
+int             lazyfault(uint);
+int             lazytouch(uint, uint, int);
+int             pagefault(uint, int);
+int             swapout(void);
+char*           ukey(uint);
+void            ucallerpcs(uint, uint*, int);
+char*           upin(uint);
+void            tlbintr(void);
+void            uflush(void);
+void            xdrop(struct inode*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             mappages(pde_t*, void*, uint, uint, int);
+int             mmap(struct file*, uint, uint, int, int);
+int             mmapcopy(struct proc*);
+int             mmapfault(uint, int);
+int             mmaptouch(uint, uint, int);
+int             munmap(uint, uint);
+void            munmapall(struct proc*);
+int             vmaoverlap(struct proc*, uint, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
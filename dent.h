@@ -0,0 +1,9 @@
+// Directory entries as getdents reports them: the name together
+// with what stat would say about the inode it names.
+struct dent {
+  uint ino;       // inode number
+  short type;     // T_DIR, T_FILE, ...
+  short nlink;
+  uint size;
+  char name[16];  // DIRSIZ bytes at most, then a 0
+};
@@ -0,0 +1,1794 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 26 0e 00 00       	mov    $0xe26,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 28 0e 00 00       	mov    $0xe28,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 2a 0e 00 00       	push   $0xe2a
+  4b:	6a 01                	push   $0x1
+  4d:	e8 3a 07 00 00       	call   78c <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 97 02 00 00       	call   2fc <exit>
+
+00000065 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+    if(cc < 1)
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 84 01 00 00       	call   311 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 44 01 00 00       	call   334 <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 41 01 00 00       	call   352 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 fd 00 00 00       	call   31f <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 2b4:	83 3d c0 11 00 00 00 	cmpl   $0x0,0x11c0
+  jg 2f
+ 2bb:	7f 2e                	jg     2eb <dosyscall+0x37>
+  jl 1f
+ 2bd:	7c 29                	jl     2e8 <dosyscall+0x34>
+  pushl %eax
+ 2bf:	50                   	push   %eax
+  pushl %ebx
+ 2c0:	53                   	push   %ebx
+  movl $1, %eax
+ 2c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 2c6:	0f a2                	cpuid
+  popl %ebx
+ 2c8:	5b                   	pop    %ebx
+  popl %eax
+ 2c9:	58                   	pop    %eax
+  movl $-1, sysmode
+ 2ca:	c7 05 c0 11 00 00 ff 	movl   $0xffffffff,0x11c0
+ 2d1:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 2d4:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 2da:	74 0c                	je     2e8 <dosyscall+0x34>
+  movl $1, sysmode
+ 2dc:	c7 05 c0 11 00 00 01 	movl   $0x1,0x11c0
+ 2e3:	00 00 00 
+  jmp 2f
+ 2e6:	eb 03                	jmp    2eb <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 2e8:	cd 40                	int    $0x40
+  ret
+ 2ea:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 2eb:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 2ed:	ba f4 02 00 00       	mov    $0x2f4,%edx
+  sysenter
+ 2f2:	0f 34                	sysenter
+3:
+  ret
+ 2f4:	c3                   	ret
+
+000002f5 <fork>:
+
+SYSCALL(fork)
+ 2f5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2fa:	eb b8                	jmp    2b4 <dosyscall>
+
+000002fc <exit>:
+SYSCALL(exit)
+ 2fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 301:	eb b1                	jmp    2b4 <dosyscall>
+
+00000303 <wait>:
+SYSCALL(wait)
+ 303:	b8 03 00 00 00       	mov    $0x3,%eax
+ 308:	eb aa                	jmp    2b4 <dosyscall>
+
+0000030a <pipe>:
+SYSCALL(pipe)
+ 30a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 30f:	eb a3                	jmp    2b4 <dosyscall>
+
+00000311 <read>:
+SYSCALL(read)
+ 311:	b8 05 00 00 00       	mov    $0x5,%eax
+ 316:	eb 9c                	jmp    2b4 <dosyscall>
+
+00000318 <write>:
+SYSCALL(write)
+ 318:	b8 10 00 00 00       	mov    $0x10,%eax
+ 31d:	eb 95                	jmp    2b4 <dosyscall>
+
+0000031f <close>:
+SYSCALL(close)
+ 31f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 324:	eb 8e                	jmp    2b4 <dosyscall>
+
+00000326 <kill>:
+SYSCALL(kill)
+ 326:	b8 06 00 00 00       	mov    $0x6,%eax
+ 32b:	eb 87                	jmp    2b4 <dosyscall>
+
+0000032d <exec>:
+SYSCALL(exec)
+ 32d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 332:	eb 80                	jmp    2b4 <dosyscall>
+
+00000334 <open>:
+SYSCALL(open)
+ 334:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 339:	e9 76 ff ff ff       	jmp    2b4 <dosyscall>
+
+0000033e <mknod>:
+SYSCALL(mknod)
+ 33e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 343:	e9 6c ff ff ff       	jmp    2b4 <dosyscall>
+
+00000348 <unlink>:
+SYSCALL(unlink)
+ 348:	b8 12 00 00 00       	mov    $0x12,%eax
+ 34d:	e9 62 ff ff ff       	jmp    2b4 <dosyscall>
+
+00000352 <fstat>:
+SYSCALL(fstat)
+ 352:	b8 08 00 00 00       	mov    $0x8,%eax
+ 357:	e9 58 ff ff ff       	jmp    2b4 <dosyscall>
+
+0000035c <link>:
+SYSCALL(link)
+ 35c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 361:	e9 4e ff ff ff       	jmp    2b4 <dosyscall>
+
+00000366 <mkdir>:
+SYSCALL(mkdir)
+ 366:	b8 14 00 00 00       	mov    $0x14,%eax
+ 36b:	e9 44 ff ff ff       	jmp    2b4 <dosyscall>
+
+00000370 <chdir>:
+SYSCALL(chdir)
+ 370:	b8 09 00 00 00       	mov    $0x9,%eax
+ 375:	e9 3a ff ff ff       	jmp    2b4 <dosyscall>
+
+0000037a <dup>:
+SYSCALL(dup)
+ 37a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 37f:	e9 30 ff ff ff       	jmp    2b4 <dosyscall>
+
+00000384 <getpid>:
+SYSCALL(getpid)
+ 384:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 389:	e9 26 ff ff ff       	jmp    2b4 <dosyscall>
+
+0000038e <sbrk>:
+SYSCALL(sbrk)
+ 38e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 393:	e9 1c ff ff ff       	jmp    2b4 <dosyscall>
+
+00000398 <sleep>:
+SYSCALL(sleep)
+ 398:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 39d:	e9 12 ff ff ff       	jmp    2b4 <dosyscall>
+
+000003a2 <uptime>:
+SYSCALL(uptime)
+ 3a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a7:	e9 08 ff ff ff       	jmp    2b4 <dosyscall>
+
+000003ac <symlink>:
+SYSCALL(symlink)
+ 3ac:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3b1:	e9 fe fe ff ff       	jmp    2b4 <dosyscall>
+
+000003b6 <readlink>:
+SYSCALL(readlink)
+ 3b6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3bb:	e9 f4 fe ff ff       	jmp    2b4 <dosyscall>
+
+000003c0 <fprot>:
+SYSCALL(fprot)
+ 3c0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3c5:	e9 ea fe ff ff       	jmp    2b4 <dosyscall>
+
+000003ca <funprot>:
+SYSCALL(funprot)
+ 3ca:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3cf:	e9 e0 fe ff ff       	jmp    2b4 <dosyscall>
+
+000003d4 <funlock>:
+SYSCALL(funlock)
+ 3d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3d9:	e9 d6 fe ff ff       	jmp    2b4 <dosyscall>
+
+000003de <mmap>:
+SYSCALL(mmap)
+ 3de:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3e3:	e9 cc fe ff ff       	jmp    2b4 <dosyscall>
+
+000003e8 <munmap>:
+SYSCALL(munmap)
+ 3e8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3ed:	e9 c2 fe ff ff       	jmp    2b4 <dosyscall>
+
+000003f2 <sendfile>:
+SYSCALL(sendfile)
+ 3f2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3f7:	e9 b8 fe ff ff       	jmp    2b4 <dosyscall>
+
+000003fc <readv>:
+SYSCALL(readv)
+ 3fc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 401:	e9 ae fe ff ff       	jmp    2b4 <dosyscall>
+
+00000406 <writev>:
+SYSCALL(writev)
+ 406:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 40b:	e9 a4 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000410 <pread>:
+SYSCALL(pread)
+ 410:	b8 20 00 00 00       	mov    $0x20,%eax
+ 415:	e9 9a fe ff ff       	jmp    2b4 <dosyscall>
+
+0000041a <pwrite>:
+SYSCALL(pwrite)
+ 41a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 41f:	e9 90 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000424 <lseek>:
+SYSCALL(lseek)
+ 424:	b8 22 00 00 00       	mov    $0x22,%eax
+ 429:	e9 86 fe ff ff       	jmp    2b4 <dosyscall>
+
+0000042e <spawn>:
+SYSCALL(spawn)
+ 42e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 433:	e9 7c fe ff ff       	jmp    2b4 <dosyscall>
+
+00000438 <setpriority>:
+SYSCALL(setpriority)
+ 438:	b8 24 00 00 00       	mov    $0x24,%eax
+ 43d:	e9 72 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000442 <kthread_create>:
+SYSCALL(kthread_create)
+ 442:	b8 25 00 00 00       	mov    $0x25,%eax
+ 447:	e9 68 fe ff ff       	jmp    2b4 <dosyscall>
+
+0000044c <kthread_id>:
+SYSCALL(kthread_id)
+ 44c:	b8 26 00 00 00       	mov    $0x26,%eax
+ 451:	e9 5e fe ff ff       	jmp    2b4 <dosyscall>
+
+00000456 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 456:	b8 27 00 00 00       	mov    $0x27,%eax
+ 45b:	e9 54 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000460 <kthread_join>:
+SYSCALL(kthread_join)
+ 460:	b8 28 00 00 00       	mov    $0x28,%eax
+ 465:	e9 4a fe ff ff       	jmp    2b4 <dosyscall>
+
+0000046a <futex>:
+SYSCALL(futex)
+ 46a:	b8 29 00 00 00       	mov    $0x29,%eax
+ 46f:	e9 40 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000474 <signal>:
+SYSCALL(signal)
+ 474:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 479:	e9 36 fe ff ff       	jmp    2b4 <dosyscall>
+
+0000047e <alarm>:
+SYSCALL(alarm)
+ 47e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 483:	e9 2c fe ff ff       	jmp    2b4 <dosyscall>
+
+00000488 <usleep>:
+SYSCALL(usleep)
+ 488:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 48d:	e9 22 fe ff ff       	jmp    2b4 <dosyscall>
+
+00000492 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 492:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 497:	e9 18 fe ff ff       	jmp    2b4 <dosyscall>
+
+0000049c <ioring_enter>:
+SYSCALL(ioring_enter)
+ 49c:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4a1:	e9 0e fe ff ff       	jmp    2b4 <dosyscall>
+
+000004a6 <getrusage>:
+SYSCALL(getrusage)
+ 4a6:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4ab:	e9 04 fe ff ff       	jmp    2b4 <dosyscall>
+
+000004b0 <mount>:
+SYSCALL(mount)
+ 4b0:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4b5:	e9 fa fd ff ff       	jmp    2b4 <dosyscall>
+
+000004ba <getdents>:
+SYSCALL(getdents)
+ 4ba:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4bf:	e9 f0 fd ff ff       	jmp    2b4 <dosyscall>
+
+000004c4 <yield>:
+SYSCALL(yield)
+ 4c4:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4c9:	e9 e6 fd ff ff       	jmp    2b4 <dosyscall>
+
+000004ce <ncpu>:
+SYSCALL(ncpu)
+ 4ce:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4d3:	e9 dc fd ff ff       	jmp    2b4 <dosyscall>
+
+000004d8 <fallocate>:
+SYSCALL(fallocate)
+ 4d8:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4dd:	e9 d2 fd ff ff       	jmp    2b4 <dosyscall>
+
+000004e2 <ftruncate>:
+SYSCALL(ftruncate)
+ 4e2:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4e7:	e9 c8 fd ff ff       	jmp    2b4 <dosyscall>
+
+000004ec <fsync>:
+SYSCALL(fsync)
+ 4ec:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4f1:	e9 be fd ff ff       	jmp    2b4 <dosyscall>
+
+000004f6 <fdatasync>:
+SYSCALL(fdatasync)
+ 4f6:	b8 37 00 00 00       	mov    $0x37,%eax
+ 4fb:	e9 b4 fd ff ff       	jmp    2b4 <dosyscall>
+
+00000500 <poll>:
+SYSCALL(poll)
+ 500:	b8 38 00 00 00       	mov    $0x38,%eax
+ 505:	e9 aa fd ff ff       	jmp    2b4 <dosyscall>
+
+0000050a <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+ 513:	8b 40 04             	mov    0x4(%eax),%eax
+ 516:	85 c0                	test   %eax,%eax
+ 518:	7e 1f                	jle    539 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 51a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51d:	8b 50 04             	mov    0x4(%eax),%edx
+ 520:	8b 45 08             	mov    0x8(%ebp),%eax
+ 523:	8d 48 08             	lea    0x8(%eax),%ecx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	8b 00                	mov    (%eax),%eax
+ 52b:	83 ec 04             	sub    $0x4,%esp
+ 52e:	52                   	push   %edx
+ 52f:	51                   	push   %ecx
+ 530:	50                   	push   %eax
+ 531:	e8 d0 fe ff ff       	call   406 <writev>
+ 536:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 539:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 54d:	00 00 00 
+}
+ 550:	90                   	nop
+ 551:	c9                   	leave
+ 552:	c3                   	ret
+
+00000553 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 553:	55                   	push   %ebp
+ 554:	89 e5                	mov    %esp,%ebp
+ 556:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 559:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 55d:	0f 84 94 00 00 00    	je     5f7 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	8b 40 04             	mov    0x4(%eax),%eax
+ 569:	85 c0                	test   %eax,%eax
+ 56b:	7e 40                	jle    5ad <put+0x5a>
+    v = &o->iov[o->n-1];
+ 56d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 570:	8b 40 04             	mov    0x4(%eax),%eax
+ 573:	83 e8 01             	sub    $0x1,%eax
+ 576:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 57d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 580:	01 d0                	add    %edx,%eax
+ 582:	83 c0 08             	add    $0x8,%eax
+ 585:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 588:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 58b:	8b 10                	mov    (%eax),%edx
+ 58d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 590:	8b 40 04             	mov    0x4(%eax),%eax
+ 593:	01 d0                	add    %edx,%eax
+ 595:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 598:	75 13                	jne    5ad <put+0x5a>
+      v->iov_len += n;
+ 59a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59d:	8b 50 04             	mov    0x4(%eax),%edx
+ 5a0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5a3:	01 c2                	add    %eax,%edx
+ 5a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a8:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 5ab:	eb 4b                	jmp    5f8 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 5ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b0:	8b 40 04             	mov    0x4(%eax),%eax
+ 5b3:	83 f8 10             	cmp    $0x10,%eax
+ 5b6:	75 0e                	jne    5c6 <put+0x73>
+    flush(o);
+ 5b8:	83 ec 0c             	sub    $0xc,%esp
+ 5bb:	ff 75 08             	push   0x8(%ebp)
+ 5be:	e8 47 ff ff ff       	call   50a <flush>
+ 5c3:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c9:	8b 50 04             	mov    0x4(%eax),%edx
+ 5cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 5d2:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d9:	8b 50 04             	mov    0x4(%eax),%edx
+ 5dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5e2:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 5e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e9:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ec:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f2:	89 50 04             	mov    %edx,0x4(%eax)
+ 5f5:	eb 01                	jmp    5f8 <put+0xa5>
+    return;
+ 5f7:	90                   	nop
+}
+ 5f8:	c9                   	leave
+ 5f9:	c3                   	ret
+
+000005fa <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 5fa:	55                   	push   %ebp
+ 5fb:	89 e5                	mov    %esp,%ebp
+ 5fd:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 600:	8b 45 08             	mov    0x8(%ebp),%eax
+ 603:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 609:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60c:	01 d0                	add    %edx,%eax
+ 60e:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 613:	77 0b                	ja     620 <room+0x26>
+ 615:	8b 45 08             	mov    0x8(%ebp),%eax
+ 618:	8b 40 04             	mov    0x4(%eax),%eax
+ 61b:	83 f8 10             	cmp    $0x10,%eax
+ 61e:	75 0e                	jne    62e <room+0x34>
+    flush(o);
+ 620:	83 ec 0c             	sub    $0xc,%esp
+ 623:	ff 75 08             	push   0x8(%ebp)
+ 626:	e8 df fe ff ff       	call   50a <flush>
+ 62b:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 62e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 631:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 637:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 640:	01 d0                	add    %edx,%eax
+}
+ 642:	c9                   	leave
+ 643:	c3                   	ret
+
+00000644 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 644:	55                   	push   %ebp
+ 645:	89 e5                	mov    %esp,%ebp
+ 647:	83 ec 28             	sub    $0x28,%esp
+ 64a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64d:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 650:	83 ec 08             	sub    $0x8,%esp
+ 653:	6a 01                	push   $0x1
+ 655:	ff 75 08             	push   0x8(%ebp)
+ 658:	e8 9d ff ff ff       	call   5fa <room>
+ 65d:	83 c4 10             	add    $0x10,%esp
+ 660:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 666:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 66a:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 66c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 675:	8d 50 01             	lea    0x1(%eax),%edx
+ 678:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67b:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 681:	83 ec 04             	sub    $0x4,%esp
+ 684:	6a 01                	push   $0x1
+ 686:	ff 75 f4             	push   -0xc(%ebp)
+ 689:	ff 75 08             	push   0x8(%ebp)
+ 68c:	e8 c2 fe ff ff       	call   553 <put>
+ 691:	83 c4 10             	add    $0x10,%esp
+}
+ 694:	90                   	nop
+ 695:	c9                   	leave
+ 696:	c3                   	ret
+
+00000697 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 697:	55                   	push   %ebp
+ 698:	89 e5                	mov    %esp,%ebp
+ 69a:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 69d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6a4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6a8:	74 17                	je     6c1 <printint+0x2a>
+ 6aa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6ae:	79 11                	jns    6c1 <printint+0x2a>
+    neg = 1;
+ 6b0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ba:	f7 d8                	neg    %eax
+ 6bc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6bf:	eb 06                	jmp    6c7 <printint+0x30>
+  } else {
+    x = xx;
+ 6c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6c7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6ce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6d4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6d9:	f7 f1                	div    %ecx
+ 6db:	89 d1                	mov    %edx,%ecx
+ 6dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e0:	8d 50 01             	lea    0x1(%eax),%edx
+ 6e3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6e6:	0f b6 91 c4 11 00 00 	movzbl 0x11c4(%ecx),%edx
+ 6ed:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6f7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6fc:	f7 f1                	div    %ecx
+ 6fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 701:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 705:	75 c7                	jne    6ce <printint+0x37>
+  if(neg)
+ 707:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 70b:	74 0e                	je     71b <printint+0x84>
+    buf[i++] = '-';
+ 70d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 710:	8d 50 01             	lea    0x1(%eax),%edx
+ 713:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 716:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 71b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 721:	83 ec 08             	sub    $0x8,%esp
+ 724:	ff 75 e8             	push   -0x18(%ebp)
+ 727:	ff 75 08             	push   0x8(%ebp)
+ 72a:	e8 cb fe ff ff       	call   5fa <room>
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 735:	eb 1d                	jmp    754 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 737:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73a:	83 e8 01             	sub    $0x1,%eax
+ 73d:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 740:	89 c2                	mov    %eax,%edx
+ 742:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 745:	01 c2                	add    %eax,%edx
+ 747:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 74a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 74d:	01 c8                	add    %ecx,%eax
+ 74f:	0f b6 00             	movzbl (%eax),%eax
+ 752:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 754:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 758:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 75c:	79 d9                	jns    737 <printint+0xa0>
+  o->used += n;
+ 75e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 761:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 767:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 76a:	01 c2                	add    %eax,%edx
+ 76c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 775:	83 ec 04             	sub    $0x4,%esp
+ 778:	ff 75 e8             	push   -0x18(%ebp)
+ 77b:	ff 75 e4             	push   -0x1c(%ebp)
+ 77e:	ff 75 08             	push   0x8(%ebp)
+ 781:	e8 cd fd ff ff       	call   553 <put>
+ 786:	83 c4 10             	add    $0x10,%esp
+}
+ 789:	90                   	nop
+ 78a:	c9                   	leave
+ 78b:	c3                   	ret
+
+0000078c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 78c:	55                   	push   %ebp
+ 78d:	89 e5                	mov    %esp,%ebp
+ 78f:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 795:	8b 45 08             	mov    0x8(%ebp),%eax
+ 798:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 79e:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 7a5:	00 00 00 
+  o.used = 0;
+ 7a8:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 7af:	00 00 00 
+  state = 0;
+ 7b2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7b9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7bc:	83 c0 04             	add    $0x4,%eax
+ 7bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 7c2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7c9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7d0:	e9 82 01 00 00       	jmp    957 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 7d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7db:	01 d0                	add    %edx,%eax
+ 7dd:	0f b6 00             	movzbl (%eax),%eax
+ 7e0:	0f be c0             	movsbl %al,%eax
+ 7e3:	25 ff 00 00 00       	and    $0xff,%eax
+ 7e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 7eb:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 7ef:	75 38                	jne    829 <printf+0x9d>
+      if(c == '%'){
+ 7f1:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 7f5:	0f 85 58 01 00 00    	jne    953 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 7fb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fe:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 801:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 804:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 807:	01 ca                	add    %ecx,%edx
+ 809:	83 ec 04             	sub    $0x4,%esp
+ 80c:	50                   	push   %eax
+ 80d:	52                   	push   %edx
+ 80e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 814:	50                   	push   %eax
+ 815:	e8 39 fd ff ff       	call   553 <put>
+ 81a:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 81d:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 824:	e9 2a 01 00 00       	jmp    953 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 829:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 82d:	0f 85 20 01 00 00    	jne    953 <printf+0x1c7>
+      if(c == 'd'){
+ 833:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 837:	75 22                	jne    85b <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 839:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 83c:	8b 00                	mov    (%eax),%eax
+ 83e:	6a 01                	push   $0x1
+ 840:	6a 0a                	push   $0xa
+ 842:	50                   	push   %eax
+ 843:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 849:	50                   	push   %eax
+ 84a:	e8 48 fe ff ff       	call   697 <printint>
+ 84f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 852:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 856:	e9 e8 00 00 00       	jmp    943 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 85b:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 85f:	74 06                	je     867 <printf+0xdb>
+ 861:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 865:	75 22                	jne    889 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 867:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 86a:	8b 00                	mov    (%eax),%eax
+ 86c:	6a 00                	push   $0x0
+ 86e:	6a 10                	push   $0x10
+ 870:	50                   	push   %eax
+ 871:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 877:	50                   	push   %eax
+ 878:	e8 1a fe ff ff       	call   697 <printint>
+ 87d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 880:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 884:	e9 ba 00 00 00       	jmp    943 <printf+0x1b7>
+      } else if(c == 's'){
+ 889:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 88d:	75 3f                	jne    8ce <printf+0x142>
+        s = (char*)*ap;
+ 88f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 892:	8b 00                	mov    (%eax),%eax
+ 894:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 897:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 89b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89f:	75 07                	jne    8a8 <printf+0x11c>
+          s = "(null)";
+ 8a1:	c7 45 f4 2f 0e 00 00 	movl   $0xe2f,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 8a8:	83 ec 0c             	sub    $0xc,%esp
+ 8ab:	ff 75 f4             	push   -0xc(%ebp)
+ 8ae:	e8 47 f8 ff ff       	call   fa <strlen>
+ 8b3:	83 c4 10             	add    $0x10,%esp
+ 8b6:	83 ec 04             	sub    $0x4,%esp
+ 8b9:	50                   	push   %eax
+ 8ba:	ff 75 f4             	push   -0xc(%ebp)
+ 8bd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8c3:	50                   	push   %eax
+ 8c4:	e8 8a fc ff ff       	call   553 <put>
+ 8c9:	83 c4 10             	add    $0x10,%esp
+ 8cc:	eb 75                	jmp    943 <printf+0x1b7>
+      } else if(c == 'c'){
+ 8ce:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 8d2:	75 21                	jne    8f5 <printf+0x169>
+        putc(&o, *ap);
+ 8d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8d7:	8b 00                	mov    (%eax),%eax
+ 8d9:	0f be c0             	movsbl %al,%eax
+ 8dc:	83 ec 08             	sub    $0x8,%esp
+ 8df:	50                   	push   %eax
+ 8e0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8e6:	50                   	push   %eax
+ 8e7:	e8 58 fd ff ff       	call   644 <putc>
+ 8ec:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8ef:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8f3:	eb 4e                	jmp    943 <printf+0x1b7>
+      } else if(c == '%'){
+ 8f5:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 8f9:	75 1b                	jne    916 <printf+0x18a>
+        putc(&o, c);
+ 8fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 8fe:	0f be c0             	movsbl %al,%eax
+ 901:	83 ec 08             	sub    $0x8,%esp
+ 904:	50                   	push   %eax
+ 905:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 90b:	50                   	push   %eax
+ 90c:	e8 33 fd ff ff       	call   644 <putc>
+ 911:	83 c4 10             	add    $0x10,%esp
+ 914:	eb 2d                	jmp    943 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 916:	83 ec 08             	sub    $0x8,%esp
+ 919:	6a 25                	push   $0x25
+ 91b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 921:	50                   	push   %eax
+ 922:	e8 1d fd ff ff       	call   644 <putc>
+ 927:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 92a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 92d:	0f be c0             	movsbl %al,%eax
+ 930:	83 ec 08             	sub    $0x8,%esp
+ 933:	50                   	push   %eax
+ 934:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 93a:	50                   	push   %eax
+ 93b:	e8 04 fd ff ff       	call   644 <putc>
+ 940:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 943:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 94a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 94d:	83 c0 01             	add    $0x1,%eax
+ 950:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 953:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 957:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95d:	01 d0                	add    %edx,%eax
+ 95f:	0f b6 00             	movzbl (%eax),%eax
+ 962:	84 c0                	test   %al,%al
+ 964:	0f 85 6b fe ff ff    	jne    7d5 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 96a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 96e:	75 22                	jne    992 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 970:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 973:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 976:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 979:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 97c:	01 ca                	add    %ecx,%edx
+ 97e:	83 ec 04             	sub    $0x4,%esp
+ 981:	50                   	push   %eax
+ 982:	52                   	push   %edx
+ 983:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 989:	50                   	push   %eax
+ 98a:	e8 c4 fb ff ff       	call   553 <put>
+ 98f:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 992:	83 ec 0c             	sub    $0xc,%esp
+ 995:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 99b:	50                   	push   %eax
+ 99c:	e8 69 fb ff ff       	call   50a <flush>
+ 9a1:	83 c4 10             	add    $0x10,%esp
+}
+ 9a4:	90                   	nop
+ 9a5:	c9                   	leave
+ 9a6:	c3                   	ret
+
+000009a7 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 9a7:	55                   	push   %ebp
+ 9a8:	89 e5                	mov    %esp,%ebp
+ 9aa:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 9ad:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 9b6:	f0 87 02             	lock xchg %eax,(%edx)
+ 9b9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ 9bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ 9bf:	c9                   	leave
+ 9c0:	c3                   	ret
+
+000009c1 <lock>:
+{
+ 9c1:	55                   	push   %ebp
+ 9c2:	89 e5                	mov    %esp,%ebp
+ 9c4:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ 9c7:	a1 d8 11 00 00       	mov    0x11d8,%eax
+ 9cc:	85 c0                	test   %eax,%eax
+ 9ce:	74 09                	je     9d9 <lock+0x18>
+ 9d0:	a1 d8 11 00 00       	mov    0x11d8,%eax
+ 9d5:	ff d0                	call   *%eax
+ 9d7:	eb 05                	jmp    9de <lock+0x1d>
+ 9d9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ 9e1:	90                   	nop
+ 9e2:	83 ec 08             	sub    $0x8,%esp
+ 9e5:	6a 01                	push   $0x1
+ 9e7:	68 10 12 00 00       	push   $0x1210
+ 9ec:	e8 b6 ff ff ff       	call   9a7 <xchg>
+ 9f1:	83 c4 10             	add    $0x10,%esp
+ 9f4:	85 c0                	test   %eax,%eax
+ 9f6:	75 ea                	jne    9e2 <lock+0x21>
+  return pin;
+ 9f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 9fb:	c9                   	leave
+ 9fc:	c3                   	ret
+
+000009fd <unlock>:
+{
+ 9fd:	55                   	push   %ebp
+ 9fe:	89 e5                	mov    %esp,%ebp
+ a00:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a03:	6a 00                	push   $0x0
+ a05:	68 10 12 00 00       	push   $0x1210
+ a0a:	e8 98 ff ff ff       	call   9a7 <xchg>
+ a0f:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a12:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a16:	78 10                	js     a28 <unlock+0x2b>
+    mallocunpin(pin);
+ a18:	a1 dc 11 00 00       	mov    0x11dc,%eax
+ a1d:	83 ec 0c             	sub    $0xc,%esp
+ a20:	ff 75 08             	push   0x8(%ebp)
+ a23:	ff d0                	call   *%eax
+ a25:	83 c4 10             	add    $0x10,%esp
+}
+ a28:	90                   	nop
+ a29:	c9                   	leave
+ a2a:	c3                   	ret
+
+00000a2b <sizeclass>:
+{
+ a2b:	55                   	push   %ebp
+ a2c:	89 e5                	mov    %esp,%ebp
+ a2e:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ a31:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ a38:	eb 1c                	jmp    a56 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	ba 02 00 00 00       	mov    $0x2,%edx
+ a42:	89 c1                	mov    %eax,%ecx
+ a44:	d3 e2                	shl    %cl,%edx
+ a46:	89 d0                	mov    %edx,%eax
+ a48:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a4b:	72 05                	jb     a52 <sizeclass+0x27>
+      return c;
+ a4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a50:	eb 0f                	jmp    a61 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a52:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a56:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ a5a:	7e de                	jle    a3a <sizeclass+0xf>
+  return -1;
+ a5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ a61:	c9                   	leave
+ a62:	c3                   	ret
+
+00000a63 <bigfree>:
+{
+ a63:	55                   	push   %ebp
+ a64:	89 e5                	mov    %esp,%ebp
+ a66:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a69:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ a6e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a71:	eb 24                	jmp    a97 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a76:	8b 00                	mov    (%eax),%eax
+ a78:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a7b:	72 12                	jb     a8f <bigfree+0x2c>
+ a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a80:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a83:	72 24                	jb     aa9 <bigfree+0x46>
+ a85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a8d:	72 1a                	jb     aa9 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	8b 00                	mov    (%eax),%eax
+ a94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a97:	8b 45 08             	mov    0x8(%ebp),%eax
+ a9a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a9d:	73 d4                	jae    a73 <bigfree+0x10>
+ a9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa2:	8b 00                	mov    (%eax),%eax
+ aa4:	39 45 08             	cmp    %eax,0x8(%ebp)
+ aa7:	73 ca                	jae    a73 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+ aac:	8b 40 04             	mov    0x4(%eax),%eax
+ aaf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab9:	01 c2                	add    %eax,%edx
+ abb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abe:	8b 00                	mov    (%eax),%eax
+ ac0:	39 c2                	cmp    %eax,%edx
+ ac2:	75 24                	jne    ae8 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac7:	8b 50 04             	mov    0x4(%eax),%edx
+ aca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acd:	8b 00                	mov    (%eax),%eax
+ acf:	8b 40 04             	mov    0x4(%eax),%eax
+ ad2:	01 c2                	add    %eax,%edx
+ ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ada:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ add:	8b 00                	mov    (%eax),%eax
+ adf:	8b 10                	mov    (%eax),%edx
+ ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae4:	89 10                	mov    %edx,(%eax)
+ ae6:	eb 0a                	jmp    af2 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ ae8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aeb:	8b 10                	mov    (%eax),%edx
+ aed:	8b 45 08             	mov    0x8(%ebp),%eax
+ af0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ af2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af5:	8b 40 04             	mov    0x4(%eax),%eax
+ af8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ aff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b02:	01 d0                	add    %edx,%eax
+ b04:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b07:	75 20                	jne    b29 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0c:	8b 50 04             	mov    0x4(%eax),%edx
+ b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b12:	8b 40 04             	mov    0x4(%eax),%eax
+ b15:	01 c2                	add    %eax,%edx
+ b17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b20:	8b 10                	mov    (%eax),%edx
+ b22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b25:	89 10                	mov    %edx,(%eax)
+ b27:	eb 08                	jmp    b31 <bigfree+0xce>
+    p->s.ptr = bp;
+ b29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2c:	8b 55 08             	mov    0x8(%ebp),%edx
+ b2f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b31:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b34:	a3 e8 11 00 00       	mov    %eax,0x11e8
+}
+ b39:	90                   	nop
+ b3a:	c9                   	leave
+ b3b:	c3                   	ret
+
+00000b3c <free>:
+{
+ b3c:	55                   	push   %ebp
+ b3d:	89 e5                	mov    %esp,%ebp
+ b3f:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b42:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b46:	74 68                	je     bb0 <free+0x74>
+  bp = (Header*)ap - 1;
+ b48:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4b:	83 e8 08             	sub    $0x8,%eax
+ b4e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b51:	e8 6b fe ff ff       	call   9c1 <lock>
+ b56:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ b59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5c:	8b 40 04             	mov    0x4(%eax),%eax
+ b5f:	83 ec 0c             	sub    $0xc,%esp
+ b62:	50                   	push   %eax
+ b63:	e8 c3 fe ff ff       	call   a2b <sizeclass>
+ b68:	83 c4 10             	add    $0x10,%esp
+ b6b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b6e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b72:	78 1e                	js     b92 <free+0x56>
+    bp->s.ptr = classfree[c];
+ b74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b77:	8b 14 85 ec 11 00 00 	mov    0x11ec(,%eax,4),%edx
+ b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b81:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ b83:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b89:	89 14 85 ec 11 00 00 	mov    %edx,0x11ec(,%eax,4)
+ b90:	eb 0e                	jmp    ba0 <free+0x64>
+    bigfree(bp);
+ b92:	83 ec 0c             	sub    $0xc,%esp
+ b95:	ff 75 f4             	push   -0xc(%ebp)
+ b98:	e8 c6 fe ff ff       	call   a63 <bigfree>
+ b9d:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ ba0:	83 ec 0c             	sub    $0xc,%esp
+ ba3:	ff 75 f0             	push   -0x10(%ebp)
+ ba6:	e8 52 fe ff ff       	call   9fd <unlock>
+ bab:	83 c4 10             	add    $0x10,%esp
+ bae:	eb 01                	jmp    bb1 <free+0x75>
+    return;
+ bb0:	90                   	nop
+}
+ bb1:	c9                   	leave
+ bb2:	c3                   	ret
+
+00000bb3 <morecore>:
+{
+ bb3:	55                   	push   %ebp
+ bb4:	89 e5                	mov    %esp,%ebp
+ bb6:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ bb9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bc0:	77 07                	ja     bc9 <morecore+0x16>
+    nu = 4096;
+ bc2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcc:	c1 e0 03             	shl    $0x3,%eax
+ bcf:	83 ec 0c             	sub    $0xc,%esp
+ bd2:	50                   	push   %eax
+ bd3:	e8 b6 f7 ff ff       	call   38e <sbrk>
+ bd8:	83 c4 10             	add    $0x10,%esp
+ bdb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ bde:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ be2:	75 07                	jne    beb <morecore+0x38>
+    return 0;
+ be4:	b8 00 00 00 00       	mov    $0x0,%eax
+ be9:	eb 22                	jmp    c0d <morecore+0x5a>
+  hp = (Header*)p;
+ beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bee:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ bf1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+ bf7:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ bfa:	83 ec 0c             	sub    $0xc,%esp
+ bfd:	ff 75 f0             	push   -0x10(%ebp)
+ c00:	e8 5e fe ff ff       	call   a63 <bigfree>
+ c05:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c08:	a1 e8 11 00 00       	mov    0x11e8,%eax
+}
+ c0d:	c9                   	leave
+ c0e:	c3                   	ret
+
+00000c0f <bigalloc>:
+{
+ c0f:	55                   	push   %ebp
+ c10:	89 e5                	mov    %esp,%ebp
+ c12:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c15:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ c1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c1d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c21:	75 23                	jne    c46 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c23:	c7 45 f0 e0 11 00 00 	movl   $0x11e0,-0x10(%ebp)
+ c2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c2d:	a3 e8 11 00 00       	mov    %eax,0x11e8
+ c32:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ c37:	a3 e0 11 00 00       	mov    %eax,0x11e0
+    base.s.size = 0;
+ c3c:	c7 05 e4 11 00 00 00 	movl   $0x0,0x11e4
+ c43:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c49:	8b 00                	mov    (%eax),%eax
+ c4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c51:	8b 40 04             	mov    0x4(%eax),%eax
+ c54:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c57:	72 4a                	jb     ca3 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ c59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5c:	8b 40 04             	mov    0x4(%eax),%eax
+ c5f:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c62:	75 0c                	jne    c70 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ c64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c67:	8b 10                	mov    (%eax),%edx
+ c69:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6c:	89 10                	mov    %edx,(%eax)
+ c6e:	eb 26                	jmp    c96 <bigalloc+0x87>
+        p->s.size -= nunits;
+ c70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c73:	8b 40 04             	mov    0x4(%eax),%eax
+ c76:	2b 45 08             	sub    0x8(%ebp),%eax
+ c79:	89 c2                	mov    %eax,%edx
+ c7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c84:	8b 40 04             	mov    0x4(%eax),%eax
+ c87:	c1 e0 03             	shl    $0x3,%eax
+ c8a:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c90:	8b 55 08             	mov    0x8(%ebp),%edx
+ c93:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ c96:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c99:	a3 e8 11 00 00       	mov    %eax,0x11e8
+      return p;
+ c9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca1:	eb 3b                	jmp    cde <bigalloc+0xcf>
+    if(p == freep)
+ ca3:	a1 e8 11 00 00       	mov    0x11e8,%eax
+ ca8:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cab:	75 1e                	jne    ccb <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ cad:	83 ec 0c             	sub    $0xc,%esp
+ cb0:	ff 75 08             	push   0x8(%ebp)
+ cb3:	e8 fb fe ff ff       	call   bb3 <morecore>
+ cb8:	83 c4 10             	add    $0x10,%esp
+ cbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cbe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc2:	75 07                	jne    ccb <bigalloc+0xbc>
+        return 0;
+ cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+ cc9:	eb 13                	jmp    cde <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ccb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd4:	8b 00                	mov    (%eax),%eax
+ cd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cd9:	e9 70 ff ff ff       	jmp    c4e <bigalloc+0x3f>
+}
+ cde:	c9                   	leave
+ cdf:	c3                   	ret
+
+00000ce0 <alloc>:
+alloc(uint nbytes)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce9:	83 c0 07             	add    $0x7,%eax
+ cec:	c1 e8 03             	shr    $0x3,%eax
+ cef:	83 c0 01             	add    $0x1,%eax
+ cf2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ cf5:	ff 75 f4             	push   -0xc(%ebp)
+ cf8:	e8 2e fd ff ff       	call   a2b <sizeclass>
+ cfd:	83 c4 04             	add    $0x4,%esp
+ d00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d03:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d07:	79 2c                	jns    d35 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d09:	83 ec 0c             	sub    $0xc,%esp
+ d0c:	ff 75 f4             	push   -0xc(%ebp)
+ d0f:	e8 fb fe ff ff       	call   c0f <bigalloc>
+ d14:	83 c4 10             	add    $0x10,%esp
+ d17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d1e:	75 0a                	jne    d2a <alloc+0x4a>
+      return 0;
+ d20:	b8 00 00 00 00       	mov    $0x0,%eax
+ d25:	e9 c8 00 00 00       	jmp    df2 <alloc+0x112>
+    return (void*)(p + 1);
+ d2a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d2d:	83 c0 08             	add    $0x8,%eax
+ d30:	e9 bd 00 00 00       	jmp    df2 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ d35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d38:	8b 04 85 ec 11 00 00 	mov    0x11ec(,%eax,4),%eax
+ d3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d42:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d46:	74 1a                	je     d62 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d48:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d4b:	8b 10                	mov    (%eax),%edx
+ d4d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d50:	89 14 85 ec 11 00 00 	mov    %edx,0x11ec(,%eax,4)
+    return (void*)(p + 1);
+ d57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d5a:	83 c0 08             	add    $0x8,%eax
+ d5d:	e9 90 00 00 00       	jmp    df2 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ d62:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d65:	ba 02 00 00 00       	mov    $0x2,%edx
+ d6a:	89 c1                	mov    %eax,%ecx
+ d6c:	d3 e2                	shl    %cl,%edx
+ d6e:	89 d0                	mov    %edx,%eax
+ d70:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ d73:	a1 08 12 00 00       	mov    0x1208,%eax
+ d78:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d7b:	c1 e2 03             	shl    $0x3,%edx
+ d7e:	01 d0                	add    %edx,%eax
+ d80:	8b 15 0c 12 00 00    	mov    0x120c,%edx
+ d86:	39 c2                	cmp    %eax,%edx
+ d88:	73 3f                	jae    dc9 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ d8a:	83 ec 0c             	sub    $0xc,%esp
+ d8d:	68 00 08 00 00       	push   $0x800
+ d92:	e8 78 fe ff ff       	call   c0f <bigalloc>
+ d97:	83 c4 10             	add    $0x10,%esp
+ d9a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ da1:	75 07                	jne    daa <alloc+0xca>
+      return 0;
+ da3:	b8 00 00 00 00       	mov    $0x0,%eax
+ da8:	eb 48                	jmp    df2 <alloc+0x112>
+    bump = (char*)p;
+ daa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dad:	a3 08 12 00 00       	mov    %eax,0x1208
+    bumpend = (char*)(p + p->s.size);
+ db2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ db5:	8b 40 04             	mov    0x4(%eax),%eax
+ db8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ dbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dc2:	01 d0                	add    %edx,%eax
+ dc4:	a3 0c 12 00 00       	mov    %eax,0x120c
+  }
+  p = (Header*)bump;
+ dc9:	a1 08 12 00 00       	mov    0x1208,%eax
+ dce:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ dd1:	a1 08 12 00 00       	mov    0x1208,%eax
+ dd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ dd9:	c1 e2 03             	shl    $0x3,%edx
+ ddc:	01 d0                	add    %edx,%eax
+ dde:	a3 08 12 00 00       	mov    %eax,0x1208
+  p->s.size = nunits;
+ de3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ de6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ de9:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ dec:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ def:	83 c0 08             	add    $0x8,%eax
+}
+ df2:	c9                   	leave
+ df3:	c3                   	ret
+
+00000df4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ df4:	55                   	push   %ebp
+ df5:	89 e5                	mov    %esp,%ebp
+ df7:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ dfa:	e8 c2 fb ff ff       	call   9c1 <lock>
+ dff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e02:	83 ec 0c             	sub    $0xc,%esp
+ e05:	ff 75 08             	push   0x8(%ebp)
+ e08:	e8 d3 fe ff ff       	call   ce0 <alloc>
+ e0d:	83 c4 10             	add    $0x10,%esp
+ e10:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e13:	83 ec 0c             	sub    $0xc,%esp
+ e16:	ff 75 f4             	push   -0xc(%ebp)
+ e19:	e8 df fb ff ff       	call   9fd <unlock>
+ e1e:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e24:	c9                   	leave
+ e25:	c3                   	ret
@@ -0,0 +1,127 @@
+
+bootblockother.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007000 <start>:
+#   - it uses the addresses at start-4, start-8, start-12 and start-16
+
+.code16           
+.globl start
+start:
+  cli            
+    7000:	fa                   	cli
+
+  xorw    %ax,%ax
+    7001:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds
+    7003:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es
+    7005:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss
+    7007:	8e d0                	mov    %eax,%ss
+
+  lgdt    gdtdesc
+    7009:	0f 01 16             	lgdtl  (%esi)
+    700c:	98                   	cwtl
+    700d:	70 0f                	jo     701e <start+0x1e>
+  movl    %cr0, %eax
+    700f:	20 c0                	and    %al,%al
+  orl     $CR0_PE, %eax
+    7011:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7015:	0f 22 c0             	mov    %eax,%cr0
+
+//PAGEBREAK!
+  ljmpl    $(SEG_KCODE<<3), $(start32)
+    7018:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+    701e:	08 00                	or     %al,(%eax)
+
+00007020 <start32>:
+
+.code32
+start32:
+  movw    $(SEG_KDATA<<3), %ax
+    7020:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds
+    7024:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es
+    7026:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss
+    7028:	8e d0                	mov    %eax,%ss
+  movw    $0, %ax
+    702a:	66 b8 00 00          	mov    $0x0,%ax
+  movw    %ax, %fs
+    702e:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs
+    7030:	8e e8                	mov    %eax,%gs
+
+  # Turn on page size extension for 4Mbyte pages,
+  # and global pages for the kernel's mappings
+  movl    %cr4, %eax
+    7032:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE|CR4_PGE), %eax
+    7035:	0d 90 00 00 00       	or     $0x90,%eax
+  movl    %eax, %cr4
+    703a:	0f 22 e0             	mov    %eax,%cr4
+  # Use enterpgdir as our initial page table
+  movl    (start-12), %eax
+    703d:	a1 f4 6f 00 00       	mov    0x6ff4,%eax
+  movl    %eax, %cr3
+    7042:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+    7045:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+    7048:	0d 01 00 01 80       	or     $0x80010001,%eax
+  movl    %eax, %cr0
+    704d:	0f 22 c0             	mov    %eax,%cr0
+
+  # Switch to a stack allocated by startothers()
+  movl    $1, %eax
+    7050:	b8 01 00 00 00       	mov    $0x1,%eax
+  lock
+    7055:	f0 0f c1 05 f0 6f 00 	lock xadd %eax,0x6ff0
+    705c:	00 
+  xaddl   %eax, (start-16)
+  movl    (start-4), %ebx
+    705d:	8b 1d fc 6f 00 00    	mov    0x6ffc,%ebx
+  movl    (%ebx,%eax,4), %esp
+    7063:	8b 24 83             	mov    (%ebx,%eax,4),%esp
+  # Call mpenter()
+  call	 *(start-8)
+    7066:	ff 15 f8 6f 00 00    	call   *0x6ff8
+
+  movw    $0x8a00, %ax
+    706c:	66 b8 00 8a          	mov    $0x8a00,%ax
+  movw    %ax, %dx
+    7070:	66 89 c2             	mov    %ax,%dx
+  outw    %ax, %dx
+    7073:	66 ef                	out    %ax,(%dx)
+  movw    $0x8ae0, %ax
+    7075:	66 b8 e0 8a          	mov    $0x8ae0,%ax
+  outw    %ax, %dx
+    7079:	66 ef                	out    %ax,(%dx)
+
+0000707b <spin>:
+spin:
+  jmp     spin
+    707b:	eb fe                	jmp    707b <spin>
+    707d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00007080 <gdt>:
+	...
+    7088:	ff                   	(bad)
+    7089:	ff 00                	incl   (%eax)
+    708b:	00 00                	add    %al,(%eax)
+    708d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7094:	00                   	.byte 0x0
+    7095:	92                   	xchg   %eax,%edx
+    7096:	cf                   	iret
+	...
+
+00007098 <gdtdesc>:
+    7098:	17                   	pop    %ss
+    7099:	00                   	.byte 0x0
+    709a:	80 70 00 00          	xorb   $0x0,0x0(%eax)
@@ -9,8 +9,11 @@
 #include "fs.h"
 #include "file.h"
 
+// Build a user image for the program at path, with argv pushed on
+// its stack, without touching the current process's memory.
+// Return 0 and fill in *img, or -1.
 int
-exec(char *path, char **argv)
+execload(char *path, char **argv, struct image *img)
 {
   char *s, *last;
   int i, off;
@@ -18,19 +21,14 @@ exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-
-/*vvv  TASK 1.2  vvv*/
-  char final_path[MAXPATH];
-
-  if(filereadlink(path, final_path, MAXPATH) < 0){
-    return -1;
-  }
+  struct execseg *seg;
 
-  if((ip = namei(final_path)) == 0)
+  if((ip = namei(path)) == 0)
     return -1;
-/*^^^^^^^^^^^^^^^^^^*/
   ilock(ip);
+  img->pgdir = 0;
+  img->exe = 0;
+  seg = img->seg;
 
 /*vvv  TASK 2    vvv*/
   if(ip->password[0] != '\0' && !is_inode_unlocked(ip)){
@@ -38,19 +36,19 @@ exec(char *path, char **argv)
   }
 /*^^^^^^^^^^^^^^^^^^*/
 
-  pgdir = 0;
-
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) < sizeof(elf))
     goto bad;
   if(elf.magic != ELF_MAGIC)
     goto bad;
 
-  if((pgdir = setupkvm(kalloc)) == 0)
+  if((img->pgdir = setupkvm(kalloc)) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Note where the program goes.  Its pages are read in from ip
+  // as they are touched; see lazyfault.
   sz = 0;
+  img->nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -58,20 +56,28 @@ exec(char *path, char **argv)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr % PGSIZE != 0 || ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE || img->nseg == NEXECSEG)
       goto bad;
+    seg[img->nseg].va = ph.vaddr;
+    seg[img->nseg].memsz = ph.memsz;
+    seg[img->nseg].off = ph.off;
+    seg[img->nseg].filesz = ph.filesz;
+    img->nseg++;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
-  iunlockput(ip);
+  iunlock(ip);
+  img->exe = ip;
   ip = 0;
 
   // Allocate two pages at the next page boundary.
   // Make the first inaccessible.  Use the second as the user stack.
   sz = PGROUNDUP(sz);
-  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+  if((sz = allocuvm(img->pgdir, sz, sz + 2*PGSIZE)) == 0)
     goto bad;
-  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+  clearpteu(img->pgdir, (char*)(sz - 2*PGSIZE));
   sp = sz;
 
   // Push argument strings, prepare rest of stack in ustack.
@@ -79,7 +85,7 @@ exec(char *path, char **argv)
     if(argc >= MAXARG)
       goto bad;
     sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
-    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+    if(copyout(img->pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
       goto bad;
     ustack[3+argc] = sp;
   }
@@ -90,29 +96,87 @@ exec(char *path, char **argv)
   ustack[2] = sp - (argc+1)*4;  // argv pointer
 
   sp -= (3+argc+1) * 4;
-  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+  if(copyout(img->pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
   // Save program name for debugging.
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(proc->name, last, sizeof(proc->name));
+  safestrcpy(img->name, last, sizeof(img->name));
 
-  // Commit to the user image.
-  oldpgdir = proc->pgdir;
-  proc->pgdir = pgdir;
-  proc->sz = sz;
-  proc->tf->eip = elf.entry;  // main
-  proc->tf->esp = sp;
-  switchuvm(proc);
-  freevm(oldpgdir);
+  img->sz = sz;
+  img->entry = elf.entry;
+  img->sp = sp;
   return 0;
 
  bad:
-  if(pgdir)
-    freevm(pgdir);
   if(ip)
     iunlockput(ip);
+  execfree(img);
   return -1;
 }
+
+// Release an image that execload built but nobody took.
+void
+execfree(struct image *img)
+{
+  if(img->pgdir)
+    freevm(img->pgdir);
+  if(img->exe){
+    begin_trans(MAXOPBLOCKS);
+    iput(img->exe);
+    commit_trans();
+  }
+  img->pgdir = 0;
+  img->exe = 0;
+}
+
+// Give process p the image img.  p must not be running the image it
+// has now, if any; the caller frees that.
+void
+execinstall(struct proc *p, struct image *img)
+{
+  p->pgdir = img->pgdir;
+  p->sz = img->sz;
+  p->exe = img->exe;
+  memmove(p->seg, img->seg, sizeof(img->seg));
+  p->nseg = img->nseg;
+  p->xshare = 1;
+  p->sighandler = 0;
+  p->alarm = 0;
+  p->alarmdue = 0;
+  p->tf->eip = img->entry;  // main
+  p->tf->esp = img->sp;
+  safestrcpy(p->name, img->name, sizeof(p->name));
+}
+
+int
+exec(char *path, char **argv)
+{
+  struct image img;
+  struct inode *oldexe;
+  pde_t *oldpgdir;
+
+  // The image belongs to the main thread.
+  if(proc->group != proc)
+    return -1;
+  if(execload(path, argv, &img) < 0)
+    return -1;
+
+  // Commit to the user image.  Other threads go with the old one.
+  endthreads();
+  ioringfree(proc);
+  munmapall(proc);
+  oldpgdir = proc->pgdir;
+  oldexe = proc->exe;
+  execinstall(proc, &img);
+  switchuvm(proc);
+  freevm(oldpgdir);
+  if(oldexe){
+    begin_trans(MAXOPBLOCKS);
+    iput(oldexe);
+    commit_trans();
+  }
+  return 0;
+}
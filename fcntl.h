@@ -5,3 +5,16 @@
 /*vvv  TASK 1.2  vvv*/
 #define O_IGNLINK 0x1000
 /*^^^^^^^^^^^^^^^^^^*/
+#define O_SYNC    0x2000  // writes return once they would survive a crash
+#define O_DIRECT  0x4000  // data moves between the disk and user memory
+
+// lseek
+#define SEEK_SET 0
+#define SEEK_CUR 1
+#define SEEK_END 2
+
+// mmap
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+#define MAP_SHARED  0x1
+#define MAP_PRIVATE 0x2
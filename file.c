@@ -9,17 +9,42 @@
 #include "file.h"
 #include "spinlock.h"
 #include "stat.h"
+#include "mmu.h"
+#include "proc.h"
+#include "uio.h"
+#include "fcntl.h"
+#include "poll.h"
+#include "callout.h"
+#include "slab.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 struct devsw devsw[NDEV];
+
+// Open files come from a slab cache, as many as memory allows.
+// ftable.lock protects their reference counts.
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
 } ftable;
 
+static struct slabcache filecache;
+
+// Processes in poll all sleep on polls.seq, which every change
+// that could make a pipe or the console ready bumps.  A poller
+// then looks at all of its files again.  Without pollers, a
+// change costs a look at nwait.
+struct {
+  struct spinlock lock;
+  uint seq;
+  int nwait;
+} polls;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  initlock(&polls.lock, "polls");
+  slabinit(&filecache, "file", sizeof(struct file), 0, 0);
 }
 
 // Allocate a file structure.
@@ -28,16 +53,11 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
-  }
-  release(&ftable.lock);
-  return 0;
+  if((f = slaballoc(&filecache)) == 0)
+    return 0;
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -69,12 +89,15 @@ fileclose(struct file *f)
   f->ref = 0;
   f->type = FD_NONE;
   release(&ftable.lock);
-  
+  slabfree(&filecache, f);
+
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    begin_trans();
-    iput(ff.ip);
+    begin_trans(MAXOPBLOCKS);
+    ilock(ff.ip);
+    ff.ip->nopen--;
+    iunlockput(ff.ip);
     commit_trans();
   }
 }
@@ -84,7 +107,7 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
     iunlock(f->ip);
     return 0;
@@ -92,67 +115,524 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
-// Read from file f.
+// Fill d with up to n entries of directory file f, from its
+// offset on.  Return the number of entries, 0 at the end.
 int
-fileread(struct file *f, char *addr, int n)
+filegetdents(struct file *f, struct dent *d, int n)
 {
   int r;
 
+  if(f->type != FD_INODE || f->readable == 0)
+    return -1;
+  ilock(f->ip);
+  r = dirlist(f->ip, &f->off, d, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Sequential read-ahead.  A read that starts where the last one
+// ended opens or doubles the window, up to RAMAX blocks; any
+// other read closes it.  Blocks within the window after the one
+// just read are queued to the disk without waiting, so a streaming
+// reader finds them cached.  Caller must hold f->ip locked.
+static void
+readahead(struct file *f, uint off, int n)
+{
+  uint bn, end;
+
+  if(off != f->ranext){
+    f->rawin = 0;
+    f->raend = 0;
+  } else if(f->rawin == 0)
+    f->rawin = RAMIN;
+  else if(f->rawin < RAMAX)
+    f->rawin *= 2;
+  f->ranext = off + n;
+  if(f->rawin == 0)
+    return;
+
+  bn = (off + n) / BSIZE;
+  end = bn + f->rawin;
+  if(f->raend > bn)
+    bn = f->raend;
+  if(bn < end){
+    ireadahead(f->ip, bn, end);
+    f->raend = end;
+  }
+}
+
+// Read from inode file f into the cnt buffers of iov in turn,
+// from offset off on, with one hold of the inode lock.  Set *offp
+// to the offset after the data if offp is not 0.  The lock is
+// shared unless *offp is f->off and someone else could be using f,
+// since reads of one file at its offset must not overlap.
+static int
+readiov(struct file *f, struct iovec *iov, int cnt, uint off, uint *offp)
+{
+  int r, v, n, direct;
+
+  if(offp == 0 || (f->ref == 1 && proc->group->nthreads == 1))
+    ilockshared(f->ip);
+  else
+    ilock(f->ip);
+  direct = (f->flags & O_DIRECT) && f->ip->type == T_FILE && f->ip->dev < TMPDEV;
+  n = 0;
+  for(v = 0; v < cnt; v++){
+    if(direct)
+      r = idirect(f->ip, iov[v].iov_base, off + n, iov[v].iov_len, 0);
+    else
+      r = readi(f->ip, iov[v].iov_base, off + n, iov[v].iov_len);
+    if(r < 0){
+      if(n == 0)
+        n = -1;
+      break;
+    }
+    n += r;
+    if(r < iov[v].iov_len)
+      break;
+  }
+  if(n > 0){
+    if(!direct)
+      readahead(f, off, n);
+    if(offp)
+      *offp = off + n;
+  }
+  iunlock(f->ip);
+  return n;
+}
+
+// Read from file f into the cnt buffers of iov in turn, with one
+// pass through the pipe or one hold of the inode lock.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
+    return piperead(f->pipe, iov, cnt);
+  if(f->type == FD_INODE)
+    return readiov(f, iov, cnt, f->off, &f->off);
+  panic("fileread");
+}
+
+// Read n bytes from inode file f at offset off, leaving f->off
+// alone.
+int
+filereadat(struct file *f, char *addr, int n, uint off)
+{
+  struct iovec iov;
+
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return readiov(f, &iov, 1, off, 0);
+}
+
+// Set the offset of file f as lseek does.  Return the new offset,
+// or -1 if f has none or it would be negative.
+int
+fileseek(struct file *f, int off, int whence)
+{
+  int base;
+
+  if(f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  switch(whence){
+  case SEEK_SET:
+    base = 0;
+    break;
+  case SEEK_CUR:
+    base = f->off;
+    break;
+  case SEEK_END:
+    base = f->ip->size;
+    break;
+  default:
     iunlock(f->ip);
-    return r;
+    return -1;
   }
-  panic("fileread");
+  if(base + off < 0){
+    iunlock(f->ip);
+    return -1;
+  }
+  f->off = base + off;
+  iunlock(f->ip);
+  return f->off;
+}
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filereadv(f, &iov, 1);
 }
 
 //PAGEBREAK!
-// Write to file f.
+// Write the cnt buffers of iov in turn to inode file f from offset
+// off on, leaving f->off alone.  Return the number of bytes written,
+// which is short if the file could not grow, or -1 if nothing
+// could be written.
+static int
+writeiov(struct file *f, struct iovec *iov, int cnt, uint off)
+{
+  int r, v, i, n, n1, nb, max, room, stop, mem, direct;
+  uint bn, end;
+  char *p;
+
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  direct = (f->flags & O_DIRECT) && f->ip->type == T_FILE && f->ip->dev < TMPDEV;
+
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size, including
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  // Consecutive buffers share a transaction, since
+  // they land next to each other in the file.  A tmpfs
+  // file needs no transaction at all.  O_DIRECT data is not
+  // logged, so a transaction writes as much as ifalloc can
+  // allocate in it, as filefalloc does.
+  mem = f->ip->dev >= TMPDEV;
+  nb = log_maxblocks();
+  max = ((nb-1-1-2) / 2) * BSIZE;
+  n = 0;
+  v = 0;
+  i = 0;  // bytes of iov[v] written
+  stop = 0;
+  if(mem || direct)
+    max = MAXFILE*BSIZE;
+  while(v < cnt && !stop){
+    if(!mem)
+      begin_trans(nb);
+    ilock(f->ip);
+    for(room = max; v < cnt && room > 0; ){
+      n1 = iov[v].iov_len - i;
+      if(n1 > room)
+        n1 = room;
+      p = (char*)iov[v].iov_base + i;
+      if(direct && ((off + n) | n1 | (uint)p) % BSIZE == 0){
+        // Allocate first, and write up to the end of what could be.
+        bn = (off + n) / BSIZE;
+        end = min(off + n + n1, MAXFILE*BSIZE);
+        if(ifalloc(f->ip, &bn, end, nb) == 0 && bn * BSIZE < off + n + n1)
+          n1 = bn * BSIZE - (off + n);
+        room = n1;  // and end the transaction after it
+      }
+      if(direct)
+        r = idirect(f->ip, p, off + n, n1, 1);
+      else
+        r = writei(f->ip, p, off + n, n1);
+      if(r > 0){
+        n += r;
+        i += r;
+        room -= r;
+      }
+      if(r != n1){
+        stop = 1;  // file cannot grow further
+        break;
+      }
+      if(i == iov[v].iov_len){
+        v++;
+        i = 0;
+      }
+    }
+    iunlock(f->ip);
+    if(!mem)
+      commit_trans();
+  }
+  if(n > 0 && (f->flags & O_SYNC))
+    filesync(f, 0);
+  return n > 0 || !stop ? n : -1;
+}
+
+// Write n bytes to inode file f at offset off, leaving f->off alone.
 int
-filewrite(struct file *f, char *addr, int n)
+filewriteat(struct file *f, char *addr, int n, uint off)
+{
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return writeiov(f, &iov, 1, off);
+}
+
+// Write the cnt buffers of iov in turn to file f.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
 {
   int r;
 
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+    return pipewrite(f->pipe, iov, cnt);
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_trans();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
+    if((r = writeiov(f, iov, cnt, f->off)) > 0)
+      f->off += r;
+    return r;
+  }
+  panic("filewrite");
+}
+
+// Write to file f.  Like filewritev, return the number of bytes
+// written, which may be short, or -1 if none could be.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filewritev(f, &iov, 1);
+}
+
+// Give regular file f disk blocks for its bytes up to off+len,
+// without changing its size, so that writing them later need not
+// allocate.  Data blocks are not logged, so one transaction covers
+// as many blocks as the metadata they change leaves room for in
+// the log (see ifalloc); bigger ranges take several.  Return 0, or
+// -1 if the file cannot grow that far.
+int
+filefalloc(struct file *f, uint off, uint len)
+{
+  uint bn, end;
+  int r, nb, mem;
+
+  if(f->writable == 0 || f->type != FD_INODE || off + len < off)
+    return -1;
+  mem = f->ip->dev >= TMPDEV;
+  end = off + len;
+  bn = 0;
+  nb = log_maxblocks();
+  do {
+    if(!mem)
+      begin_trans(nb);
+    ilock(f->ip);
+    r = ifalloc(f->ip, &bn, end, nb);
+    iunlock(f->ip);
+    if(!mem)
       commit_trans();
+  } while(r == 0 && bn < (end + BSIZE - 1) / BSIZE);
+  return r;
+}
 
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+// Cut regular file f down to len bytes.  Return 0, or -1 if it
+// is shorter or pages past len are mapped.
+int
+filetrunc(struct file *f, uint len)
+{
+  int r, mem;
+
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  mem = f->ip->dev >= TMPDEV;
+  if(!mem)
+    begin_trans(log_maxblocks());
+  ilock(f->ip);
+  r = itruncate(f->ip, len);
+  iunlock(f->ip);
+  if(!mem)
+    commit_trans();
+  return r;
+}
+
+// Wait until what has been written to file f is on disk, for
+// fsync: its data and size and, unless dataonly, the rest of its
+// inode too, such as its link count.
+// Transactions commit in order, so this is a matter of waiting
+// for the last one that touched f.  A tmpfs or device has
+// nothing to wait for.
+int
+filesync(struct file *f, int dataonly)
+{
+  struct inode *ip;
+  int tid;
+
+  if(f->type != FD_INODE)
+    return -1;
+  ip = f->ip;
+  if(ip->dev >= TMPDEV || ip->type == T_DEV)
+    return 0;
+  ilockshared(ip);
+  tid = ip->dtid;
+  if(!dataonly && ip->tid > tid)
+    tid = ip->tid;
+  iunlock(ip);
+  log_wait(tid);
+  return 0;
+}
+
+//PAGEBREAK!
+// Tell processes in poll that a file may have become ready.
+// Callers have just taken or released a lock after the change,
+// so seeing no pollers here means any poller that comes along
+// will see the change.
+void
+pollwake(void)
+{
+  if(polls.nwait == 0)
+    return;
+  acquire(&polls.lock);
+  polls.seq++;
+  wakeup(&polls.seq);
+  release(&polls.lock);
+}
+
+// Return which of events file f is ready for, with POLLERR and
+// POLLHUP if they are so.  Only pipes and the console can block;
+// other files are always ready.
+static int
+filepoll(struct file *f, int events)
+{
+  struct inode *ip;
+  int r;
+
+  if(!f->readable)
+    events &= ~POLLIN;
+  if(!f->writable)
+    events &= ~POLLOUT;
+  if(f->type == FD_PIPE)
+    return pipepoll(f->pipe, f->writable) & (events | POLLERR | POLLHUP);
+  ip = f->ip;
+  if(ip->type == T_DEV && ip->major >= 0 && ip->major < NDEV && devsw[ip->major].poll)
+    r = devsw[ip->major].poll(ip);
+  else
+    r = POLLIN | POLLOUT;
+  return r & events;
+}
+
+static void
+pollexpire(void *arg)
+{
+  acquire(&polls.lock);
+  *(int*)arg = 1;
+  wakeup(&polls.seq);
+  release(&polls.lock);
+}
+
+// Wait until one of the n files f is ready for what fds asks of
+// it, or for ms milliseconds if ms >= 0, and fill in revents.  A
+// null f[i] is an fd that is not open, or a negative one, which
+// is ignored.  Return how many files are
+// ready, 0 on timeout, or -1 if killed.
+int
+filepollv(struct file **f, struct pollfd *fds, int n, int ms)
+{
+  struct callout c;
+  int i, nready, expired;
+  uint seq;
+
+  acquire(&polls.lock);
+  polls.nwait++;
+  release(&polls.lock);
+  expired = ms == 0;
+  if(ms > 0){
+    acquire(&tickslock);
+    callout(&c, (ms + TICKUS/1000 - 1) / (TICKUS/1000), pollexpire, &expired);
+    release(&tickslock);
+  }
+
+  for(;;){
+    acquire(&polls.lock);
+    seq = polls.seq;
+    release(&polls.lock);
+    nready = 0;
+    for(i = 0; i < n; i++){
+      if(f[i])
+        fds[i].revents = filepoll(f[i], fds[i].events);
+      else
+        fds[i].revents = fds[i].fd >= 0 ? POLLNVAL : 0;
+      if(fds[i].revents)
+        nready++;
     }
-    return i == n ? n : -1;
+    if(nready > 0)
+      break;
+    acquire(&polls.lock);
+    while(polls.seq == seq && !expired && !proc->killed)
+      sleep(&polls.seq, &polls.lock);
+    release(&polls.lock);
+    if(expired || proc->killed)
+      break;
   }
-  panic("filewrite");
+
+  if(ms > 0){
+    acquire(&tickslock);
+    calloutstop(&c);
+    release(&tickslock);
+  }
+  acquire(&polls.lock);
+  polls.nwait--;
+  release(&polls.lock);
+  return proc->killed ? -1 : nready;
+}
+
+// Move up to n bytes from file in to file out without a trip
+// through user space, for sendfile.  A regular file's data goes
+// from the page cache straight into out; anything else passes
+// through a small kernel buffer.  Reading from a pipe stops after
+// the first chunk, as read() would.  Return the number of bytes
+// moved, or -1 if none could be.
+int
+filesend(struct file *out, struct file *in, int n)
+{
+  char buf[512], *src;
+  struct page *pg;
+  struct inode *ip;
+  int tot, m, r;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  for(tot = 0; tot < n; tot += m){
+    m = n - tot;
+    pg = 0;
+    if(in->type == FD_INODE){
+      ip = in->ip;
+      ilock(ip);
+      if(ip->type == T_FILE && !(ip->flags & I_INLINE) && in->off < ip->size){
+        m = min(m, ip->size - in->off);
+        m = min(m, PGSIZE - in->off % PGSIZE);
+        readahead(in, in->off, m);
+        pg = ipage(ip, in->off / PGSIZE);
+      }
+      if(pg == 0)
+        m = readi(ip, buf, in->off, min(m, sizeof(buf)));
+      iunlock(ip);
+      src = pg ? pg->data + in->off % PGSIZE : buf;
+    } else {
+      m = fileread(in, buf, min(m, sizeof(buf)));
+      src = buf;
+    }
+    if(m <= 0)
+      break;
+
+    r = filewrite(out, src, m);
+    if(pg)
+      pcput(pg);
+    if(r != m){
+      // Short write: what got out counts, and goes no further.
+      if(r > 0){
+        if(in->type == FD_INODE)
+          in->off += r;
+        tot += r;
+      }
+      return tot > 0 ? tot : -1;
+    }
+    if(in->type == FD_INODE)
+      in->off += m;
+    else
+      return tot + m;
+  }
+  if(m < 0 && tot == 0)
+    return -1;
+  return tot;
 }
 
 /**************/
@@ -162,14 +642,9 @@ filewrite(struct file *f, char *addr, int n)
 int
 filefprot(const char *pathname, const char *password)
 {
-  char final_path[MAXPATH];
   struct inode* ip;
 
-  if(filereadlinki(pathname, final_path, MAXPATH) < 0){
-    return -1;
-  }
-
-  ip = namei(final_path);
+  ip = nameilink((char*)pathname);
   if(!ip){
     return -1;
   }
@@ -187,7 +662,7 @@ filefprot(const char *pathname, const char *password)
     return -1;
   }
 
-  if(is_inode_open(ip)){
+  if(ip->nopen > 0){
     // File is already open by some process
     iunlock(ip);
     return -1;
@@ -202,14 +677,9 @@ filefprot(const char *pathname, const char *password)
 int
 filefunprot(const char *pathname, const char *password)
 {
-  char final_path[MAXPATH];
   struct inode* ip;
 
-  if(filereadlinki(pathname, final_path, MAXPATH) < 0){
-    return -1;
-  }
-
-  ip = namei(final_path);
+  ip = nameilink((char*)pathname);
   if(!ip){
     return -1;
   }
@@ -237,14 +707,9 @@ filefunprot(const char *pathname, const char *password)
 int
 filefunlock(const char *pathname, const char *password)
 {
-  char final_path[MAXPATH];
   struct inode* ip;
 
-  if(filereadlinki(pathname, final_path, MAXPATH) < 0){
-    return -1;
-  }
-
-  ip = namei(final_path);
+  ip = nameilink((char*)pathname);
   if(!ip){
     return -1;
   }
@@ -262,7 +727,11 @@ filefunlock(const char *pathname, const char *password)
     return -1;
   }
 
-  unlock_inode(ip);
+  if(unlock_inode(ip) < 0){
+    // Too many unlocked files
+    iunlock(ip);
+    return -1;
+  }
 
   iunlock(ip);
   return 0;
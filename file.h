@@ -6,15 +6,27 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  int flags;    // O_SYNC, O_DIRECT
+  uint ranext;  // offset at which a sequential read would start
+  uint raend;   // first block not yet read ahead
+  int rawin;    // read-ahead window, in blocks
 };
 
 
 // in-memory copy of an inode
+#define NBMAP 16  // indirect block mappings cached per inode
+
+// Each starts a cache line, with what iget's hash scans read
+// ahead of what locking and using it writes.
 struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
+  struct inode *hnext;  // icache hash chain
+
   int ref;            // Reference count
   int flags;          // I_BUSY, I_VALID
+  int readers;        // holders of a shared lock
+  int xwait;          // ilock() callers waiting
 
   short type;         // copy of disk inode
   short major;
@@ -24,17 +36,60 @@ struct inode {
   uint addrs[NDIRECT+1];
   uint indirect2;
   char password[PASSLEN];
-};
+  ushort nhash;
+  int nopen;          // open file table entries for it
+  int tid;            // last transaction that changed it; see log_tid
+  int dtid;           // last one that changed its data or size
+
+  // Window of NBMAP mappings copied from an indirect block,
+  // for file blocks bmbase on; valid if I_BMAP.  0 is unknown.
+  uint bmbase;
+  uint bmaddr[NBMAP];
+
+  uint pastart;       // blocks reserved for the file's next writes
+  uint palen;
+
+  struct page *pages;   // page cache pages of its data
+  char **xpages;        // pages of programs run from it; see vm.c
+
+  struct inode *lprev;  // icache LRU list, while ref == 0
+  struct inode *lnext;
+} __attribute__((aligned(CACHELINE)));
 #define I_BUSY 0x1
 #define I_VALID 0x2
+#define I_EXTENTS 0x4  // addrs[] hold extents (FS_EXTENTS)
+#define I_BMAP 0x8     // bmbase and bmaddr[] are valid
+#define I_INLINE 0x10  // data lives in addrs[] (DI_INLINE)
+#define I_PINNED 0x20  // tmpfs inode holding a reference to itself
 
 // table mapping major device number to
 // device functions
 struct devsw {
-  int (*read)(struct inode*, char*, int);
-  int (*write)(struct inode*, char*, int);
+  int (*read)(struct inode*, char*, uint, int);
+  int (*write)(struct inode*, char*, uint, int);
+  int (*poll)(struct inode*);  // POLLIN and POLLOUT if ready; 0: always
 };
 
 extern struct devsw devsw[];
 
 #define CONSOLE 1
+#define LOCKSTAT 2
+#define SYSSTAT 3  // minor 0: /dev/sysstat, 1: /dev/procstat
+#define PROF 4
+#define KSTAT 5    // the files under /stats; see kstat.c
+
+// A page of a regular file's data, in the page cache.
+struct page {
+  struct inode *ip;     // owner; 0 if not in use
+  uint pgno;            // page number within the file
+  int ref;              // users and mappings
+  int valid;            // data has been read in
+  int filling;          // being read in; see pcfill
+  int pinned;           // only copy of tmpfs data; see pcpin
+  char *data;           // PGSIZE bytes
+  struct page *hnext;   // hash chain
+  struct page *inext;   // ip's pages
+  struct page *iprev;
+  struct page *lnext;   // LRU list, least recent first
+  struct page *lprev;
+};
@@ -0,0 +1,2988 @@
+
+_find:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <set_default_search_options>:
+  uint max_size;
+} search_options;
+
+static void
+set_default_search_options(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+  search_options.follow = 0;
+       3:	c7 05 c0 20 00 00 00 	movl   $0x0,0x20c0
+       a:	00 00 00 
+  search_options.name_exact = 0;
+       d:	c7 05 c4 20 00 00 00 	movl   $0x0,0x20c4
+      14:	00 00 00 
+  search_options.type = FT_ANY;
+      17:	c7 05 c8 20 00 00 00 	movl   $0x0,0x20c8
+      1e:	00 00 00 
+  search_options.min_size = 0;
+      21:	c7 05 cc 20 00 00 00 	movl   $0x0,0x20cc
+      28:	00 00 00 
+  search_options.max_size = 0xFFFFFFFF;
+      2b:	c7 05 d0 20 00 00 ff 	movl   $0xffffffff,0x20d0
+      32:	ff ff ff 
+}
+      35:	90                   	nop
+      36:	5d                   	pop    %ebp
+      37:	c3                   	ret
+
+00000038 <basename>:
+
+static char*
+basename(char *path)
+{
+      38:	55                   	push   %ebp
+      39:	89 e5                	mov    %esp,%ebp
+      3b:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      3e:	83 ec 0c             	sub    $0xc,%esp
+      41:	ff 75 08             	push   0x8(%ebp)
+      44:	e8 7b 0c 00 00       	call   cc4 <strlen>
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	8b 55 08             	mov    0x8(%ebp),%edx
+      4f:	01 d0                	add    %edx,%eax
+      51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      54:	eb 04                	jmp    5a <basename+0x22>
+      56:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+      5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      5d:	3b 45 08             	cmp    0x8(%ebp),%eax
+      60:	72 0a                	jb     6c <basename+0x34>
+      62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      65:	0f b6 00             	movzbl (%eax),%eax
+      68:	3c 2f                	cmp    $0x2f,%al
+      6a:	75 ea                	jne    56 <basename+0x1e>
+    ;
+  p++;
+      6c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  return p;
+      70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+      73:	c9                   	leave
+      74:	c3                   	ret
+
+00000075 <search>:
+
+static void visit(char*, struct stat*, int);
+
+static void
+search(char *path, int following_symlink)
+{
+      75:	55                   	push   %ebp
+      76:	89 e5                	mov    %esp,%ebp
+      78:	83 ec 28             	sub    $0x28,%esp
+  int fd;
+  struct stat st;
+
+  fd = open(path, following_symlink ? 0 : O_IGNLINK);
+      7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      7f:	74 07                	je     88 <search+0x13>
+      81:	b8 00 00 00 00       	mov    $0x0,%eax
+      86:	eb 05                	jmp    8d <search+0x18>
+      88:	b8 00 10 00 00       	mov    $0x1000,%eax
+      8d:	83 ec 08             	sub    $0x8,%esp
+      90:	50                   	push   %eax
+      91:	ff 75 08             	push   0x8(%ebp)
+      94:	e8 65 0e 00 00       	call   efe <open>
+      99:	83 c4 10             	add    $0x10,%esp
+      9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  if(fd < 0 && following_symlink){
+      9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      a3:	79 06                	jns    ab <search+0x36>
+      a5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      a9:	75 75                	jne    120 <search+0xab>
+    // Error opening symlink or broken symlink. Ignore it
+    return;
+  }
+
+  if(fd < 0) {
+      ab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      af:	79 1a                	jns    cb <search+0x56>
+    printf(1, "Error opening file: %s\n", path);
+      b1:	83 ec 04             	sub    $0x4,%esp
+      b4:	ff 75 08             	push   0x8(%ebp)
+      b7:	68 f0 19 00 00       	push   $0x19f0
+      bc:	6a 01                	push   $0x1
+      be:	e8 93 12 00 00       	call   1356 <printf>
+      c3:	83 c4 10             	add    $0x10,%esp
+    exit();
+      c6:	e8 fb 0d 00 00       	call   ec6 <exit>
+  }
+
+  if(fstat(fd, &st) < 0){
+      cb:	83 ec 08             	sub    $0x8,%esp
+      ce:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      d1:	50                   	push   %eax
+      d2:	ff 75 f4             	push   -0xc(%ebp)
+      d5:	e8 42 0e 00 00       	call   f1c <fstat>
+      da:	83 c4 10             	add    $0x10,%esp
+      dd:	85 c0                	test   %eax,%eax
+      df:	79 1a                	jns    fb <search+0x86>
+    printf(1, "Error fstat file: %s\n", path);
+      e1:	83 ec 04             	sub    $0x4,%esp
+      e4:	ff 75 08             	push   0x8(%ebp)
+      e7:	68 08 1a 00 00       	push   $0x1a08
+      ec:	6a 01                	push   $0x1
+      ee:	e8 63 12 00 00       	call   1356 <printf>
+      f3:	83 c4 10             	add    $0x10,%esp
+    exit();
+      f6:	e8 cb 0d 00 00       	call   ec6 <exit>
+  }
+
+  close(fd);
+      fb:	83 ec 0c             	sub    $0xc,%esp
+      fe:	ff 75 f4             	push   -0xc(%ebp)
+     101:	e8 e3 0d 00 00       	call   ee9 <close>
+     106:	83 c4 10             	add    $0x10,%esp
+  visit(path, &st, following_symlink);
+     109:	83 ec 04             	sub    $0x4,%esp
+     10c:	ff 75 0c             	push   0xc(%ebp)
+     10f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     112:	50                   	push   %eax
+     113:	ff 75 08             	push   0x8(%ebp)
+     116:	e8 08 00 00 00       	call   123 <visit>
+     11b:	83 c4 10             	add    $0x10,%esp
+     11e:	eb 01                	jmp    121 <search+0xac>
+    return;
+     120:	90                   	nop
+}
+     121:	c9                   	leave
+     122:	c3                   	ret
+
+00000123 <visit>:
+
+// Report path, which st describes, if it matches, and descend
+// into it if it is a directory.
+static void
+visit(char *path, struct stat *st, int following_symlink)
+{
+     123:	55                   	push   %ebp
+     124:	89 e5                	mov    %esp,%ebp
+     126:	53                   	push   %ebx
+     127:	81 ec a4 01 00 00    	sub    $0x1a4,%esp
+  int fd;
+  int skip = 0;
+     12d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  struct stat cst;
+  int i, n;
+  char buf[MAXPATH];
+  char *p;
+
+  switch(st->type){
+     134:	8b 45 0c             	mov    0xc(%ebp),%eax
+     137:	0f b7 00             	movzwl (%eax),%eax
+     13a:	98                   	cwtl
+     13b:	83 f8 04             	cmp    $0x4,%eax
+     13e:	0f 84 f6 03 00 00    	je     53a <visit+0x417>
+     144:	83 f8 04             	cmp    $0x4,%eax
+     147:	0f 8f b6 04 00 00    	jg     603 <visit+0x4e0>
+     14d:	83 f8 03             	cmp    $0x3,%eax
+     150:	0f 84 43 03 00 00    	je     499 <visit+0x376>
+     156:	83 f8 03             	cmp    $0x3,%eax
+     159:	0f 8f a4 04 00 00    	jg     603 <visit+0x4e0>
+     15f:	83 f8 01             	cmp    $0x1,%eax
+     162:	74 0e                	je     172 <visit+0x4f>
+     164:	83 f8 02             	cmp    $0x2,%eax
+     167:	0f 84 81 02 00 00    	je     3ee <visit+0x2cb>
+     16d:	e9 91 04 00 00       	jmp    603 <visit+0x4e0>
+    case T_DIR:
+      if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
+     172:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     176:	75 35                	jne    1ad <visit+0x8a>
+     178:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     17d:	85 c0                	test   %eax,%eax
+     17f:	74 2c                	je     1ad <visit+0x8a>
+     181:	8b 1d c4 20 00 00    	mov    0x20c4,%ebx
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	ff 75 08             	push   0x8(%ebp)
+     18d:	e8 a6 fe ff ff       	call   38 <basename>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	83 ec 08             	sub    $0x8,%esp
+     198:	53                   	push   %ebx
+     199:	50                   	push   %eax
+     19a:	e8 e6 0a 00 00       	call   c85 <strcmp>
+     19f:	83 c4 10             	add    $0x10,%esp
+     1a2:	85 c0                	test   %eax,%eax
+     1a4:	74 07                	je     1ad <visit+0x8a>
+        skip = 1;
+     1a6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_DIR)){
+     1ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     1b1:	75 1a                	jne    1cd <visit+0xaa>
+     1b3:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     1b8:	85 c0                	test   %eax,%eax
+     1ba:	74 11                	je     1cd <visit+0xaa>
+     1bc:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     1c1:	83 f8 01             	cmp    $0x1,%eax
+     1c4:	74 07                	je     1cd <visit+0xaa>
+        skip = 1;
+     1c6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
+     1cd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     1d1:	75 26                	jne    1f9 <visit+0xd6>
+     1d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1d6:	8b 50 10             	mov    0x10(%eax),%edx
+     1d9:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     1de:	39 c2                	cmp    %eax,%edx
+     1e0:	72 10                	jb     1f2 <visit+0xcf>
+     1e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1e5:	8b 40 10             	mov    0x10(%eax),%eax
+     1e8:	8b 15 d0 20 00 00    	mov    0x20d0,%edx
+     1ee:	39 c2                	cmp    %eax,%edx
+     1f0:	73 07                	jae    1f9 <visit+0xd6>
+        skip = 1;
+     1f2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+
+      if(!skip){
+     1f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     1fd:	75 15                	jne    214 <visit+0xf1>
+        printf(1, "%s\n", path);
+     1ff:	83 ec 04             	sub    $0x4,%esp
+     202:	ff 75 08             	push   0x8(%ebp)
+     205:	68 1e 1a 00 00       	push   $0x1a1e
+     20a:	6a 01                	push   $0x1
+     20c:	e8 45 11 00 00       	call   1356 <printf>
+     211:	83 c4 10             	add    $0x10,%esp
+      }
+
+      strcpy(buf, path);
+     214:	83 ec 08             	sub    $0x8,%esp
+     217:	ff 75 08             	push   0x8(%ebp)
+     21a:	8d 85 60 fe ff ff    	lea    -0x1a0(%ebp),%eax
+     220:	50                   	push   %eax
+     221:	e8 2f 0a 00 00       	call   c55 <strcpy>
+     226:	83 c4 10             	add    $0x10,%esp
+      p = buf + strlen(path);
+     229:	83 ec 0c             	sub    $0xc,%esp
+     22c:	ff 75 08             	push   0x8(%ebp)
+     22f:	e8 90 0a 00 00       	call   cc4 <strlen>
+     234:	83 c4 10             	add    $0x10,%esp
+     237:	8d 95 60 fe ff ff    	lea    -0x1a0(%ebp),%edx
+     23d:	01 d0                	add    %edx,%eax
+     23f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(strcmp(path, "/") != 0){ // Handle special case of root directory
+     242:	83 ec 08             	sub    $0x8,%esp
+     245:	68 22 1a 00 00       	push   $0x1a22
+     24a:	ff 75 08             	push   0x8(%ebp)
+     24d:	e8 33 0a 00 00       	call   c85 <strcmp>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	74 0a                	je     263 <visit+0x140>
+        *p = '/';
+     259:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     25c:	c6 00 2f             	movb   $0x2f,(%eax)
+        p++;
+     25f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+      }
+
+      fd = open(path, following_symlink ? 0 : O_IGNLINK);
+     263:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     267:	74 07                	je     270 <visit+0x14d>
+     269:	b8 00 00 00 00       	mov    $0x0,%eax
+     26e:	eb 05                	jmp    275 <visit+0x152>
+     270:	b8 00 10 00 00       	mov    $0x1000,%eax
+     275:	83 ec 08             	sub    $0x8,%esp
+     278:	50                   	push   %eax
+     279:	ff 75 08             	push   0x8(%ebp)
+     27c:	e8 7d 0c 00 00       	call   efe <open>
+     281:	83 c4 10             	add    $0x10,%esp
+     284:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(fd < 0) {
+     287:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     28b:	0f 89 26 01 00 00    	jns    3b7 <visit+0x294>
+        printf(1, "Error opening file: %s\n", path);
+     291:	83 ec 04             	sub    $0x4,%esp
+     294:	ff 75 08             	push   0x8(%ebp)
+     297:	68 f0 19 00 00       	push   $0x19f0
+     29c:	6a 01                	push   $0x1
+     29e:	e8 b3 10 00 00       	call   1356 <printf>
+     2a3:	83 c4 10             	add    $0x10,%esp
+        exit();
+     2a6:	e8 1b 0c 00 00       	call   ec6 <exit>
+      }
+      // The entries come with the type and size of what they
+      // name, so only directories need opening.
+      while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+        for(i = 0; i < n; i++){
+     2ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     2b2:	e9 f4 00 00 00       	jmp    3ab <visit+0x288>
+          if(strcmp(d[i].name, ".") == 0 || strcmp(d[i].name, "..") == 0)
+     2b7:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+     2bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2c0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     2c3:	01 d0                	add    %edx,%eax
+     2c5:	83 c0 0c             	add    $0xc,%eax
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	68 24 1a 00 00       	push   $0x1a24
+     2d0:	50                   	push   %eax
+     2d1:	e8 af 09 00 00       	call   c85 <strcmp>
+     2d6:	83 c4 10             	add    $0x10,%esp
+     2d9:	85 c0                	test   %eax,%eax
+     2db:	0f 84 c5 00 00 00    	je     3a6 <visit+0x283>
+     2e1:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+     2e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2ea:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     2ed:	01 d0                	add    %edx,%eax
+     2ef:	83 c0 0c             	add    $0xc,%eax
+     2f2:	83 ec 08             	sub    $0x8,%esp
+     2f5:	68 26 1a 00 00       	push   $0x1a26
+     2fa:	50                   	push   %eax
+     2fb:	e8 85 09 00 00       	call   c85 <strcmp>
+     300:	83 c4 10             	add    $0x10,%esp
+     303:	85 c0                	test   %eax,%eax
+     305:	0f 84 9b 00 00 00    	je     3a6 <visit+0x283>
+            continue;
+          strcpy(p, d[i].name);
+     30b:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+     311:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     314:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     317:	01 d0                	add    %edx,%eax
+     319:	83 c0 0c             	add    $0xc,%eax
+     31c:	83 ec 08             	sub    $0x8,%esp
+     31f:	50                   	push   %eax
+     320:	ff 75 ec             	push   -0x14(%ebp)
+     323:	e8 2d 09 00 00       	call   c55 <strcpy>
+     328:	83 c4 10             	add    $0x10,%esp
+          cst.type = d[i].type;
+     32b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     32e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     331:	8d 40 f8             	lea    -0x8(%eax),%eax
+     334:	01 e8                	add    %ebp,%eax
+     336:	83 c0 80             	add    $0xffffff80,%eax
+     339:	0f b7 00             	movzwl (%eax),%eax
+     33c:	66 89 85 60 ff ff ff 	mov    %ax,-0xa0(%ebp)
+          cst.ino = d[i].ino;
+     343:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     346:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     349:	8d 40 f8             	lea    -0x8(%eax),%eax
+     34c:	01 e8                	add    %ebp,%eax
+     34e:	2d 84 00 00 00       	sub    $0x84,%eax
+     353:	8b 00                	mov    (%eax),%eax
+     355:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+          cst.nlink = d[i].nlink;
+     35b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     35e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     361:	8d 40 f8             	lea    -0x8(%eax),%eax
+     364:	01 e8                	add    %ebp,%eax
+     366:	83 e8 7e             	sub    $0x7e,%eax
+     369:	0f b7 00             	movzwl (%eax),%eax
+     36c:	66 89 85 6c ff ff ff 	mov    %ax,-0x94(%ebp)
+          cst.size = d[i].size;
+     373:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     376:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     379:	8d 40 f8             	lea    -0x8(%eax),%eax
+     37c:	01 e8                	add    %ebp,%eax
+     37e:	83 e8 7c             	sub    $0x7c,%eax
+     381:	8b 00                	mov    (%eax),%eax
+     383:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+          visit(buf, &cst, 0);
+     389:	83 ec 04             	sub    $0x4,%esp
+     38c:	6a 00                	push   $0x0
+     38e:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+     394:	50                   	push   %eax
+     395:	8d 85 60 fe ff ff    	lea    -0x1a0(%ebp),%eax
+     39b:	50                   	push   %eax
+     39c:	e8 82 fd ff ff       	call   123 <visit>
+     3a1:	83 c4 10             	add    $0x10,%esp
+     3a4:	eb 01                	jmp    3a7 <visit+0x284>
+            continue;
+     3a6:	90                   	nop
+        for(i = 0; i < n; i++){
+     3a7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     3ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3ae:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     3b1:	0f 8c 00 ff ff ff    	jl     2b7 <visit+0x194>
+      while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+     3b7:	83 ec 04             	sub    $0x4,%esp
+     3ba:	6a 04                	push   $0x4
+     3bc:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+     3c2:	50                   	push   %eax
+     3c3:	ff 75 e8             	push   -0x18(%ebp)
+     3c6:	e8 b9 0c 00 00       	call   1084 <getdents>
+     3cb:	83 c4 10             	add    $0x10,%esp
+     3ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     3d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     3d5:	0f 8f d0 fe ff ff    	jg     2ab <visit+0x188>
+        }
+      }
+      close(fd);
+     3db:	83 ec 0c             	sub    $0xc,%esp
+     3de:	ff 75 e8             	push   -0x18(%ebp)
+     3e1:	e8 03 0b 00 00       	call   ee9 <close>
+     3e6:	83 c4 10             	add    $0x10,%esp
+      return;
+     3e9:	e9 15 02 00 00       	jmp    603 <visit+0x4e0>
+    case T_FILE:
+      if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
+     3ee:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     3f2:	75 35                	jne    429 <visit+0x306>
+     3f4:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     3f9:	85 c0                	test   %eax,%eax
+     3fb:	74 2c                	je     429 <visit+0x306>
+     3fd:	8b 1d c4 20 00 00    	mov    0x20c4,%ebx
+     403:	83 ec 0c             	sub    $0xc,%esp
+     406:	ff 75 08             	push   0x8(%ebp)
+     409:	e8 2a fc ff ff       	call   38 <basename>
+     40e:	83 c4 10             	add    $0x10,%esp
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	53                   	push   %ebx
+     415:	50                   	push   %eax
+     416:	e8 6a 08 00 00       	call   c85 <strcmp>
+     41b:	83 c4 10             	add    $0x10,%esp
+     41e:	85 c0                	test   %eax,%eax
+     420:	74 07                	je     429 <visit+0x306>
+        skip = 1;
+     422:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_FILE)){
+     429:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     42d:	75 1a                	jne    449 <visit+0x326>
+     42f:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     434:	85 c0                	test   %eax,%eax
+     436:	74 11                	je     449 <visit+0x326>
+     438:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     43d:	83 f8 02             	cmp    $0x2,%eax
+     440:	74 07                	je     449 <visit+0x326>
+        skip = 1;
+     442:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
+     449:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     44d:	75 26                	jne    475 <visit+0x352>
+     44f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     452:	8b 50 10             	mov    0x10(%eax),%edx
+     455:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     45a:	39 c2                	cmp    %eax,%edx
+     45c:	72 10                	jb     46e <visit+0x34b>
+     45e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     461:	8b 40 10             	mov    0x10(%eax),%eax
+     464:	8b 15 d0 20 00 00    	mov    0x20d0,%edx
+     46a:	39 c2                	cmp    %eax,%edx
+     46c:	73 07                	jae    475 <visit+0x352>
+        skip = 1;
+     46e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+
+      if(!skip){
+     475:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     479:	0f 85 7d 01 00 00    	jne    5fc <visit+0x4d9>
+        printf(1, "%s\n", path);
+     47f:	83 ec 04             	sub    $0x4,%esp
+     482:	ff 75 08             	push   0x8(%ebp)
+     485:	68 1e 1a 00 00       	push   $0x1a1e
+     48a:	6a 01                	push   $0x1
+     48c:	e8 c5 0e 00 00       	call   1356 <printf>
+     491:	83 c4 10             	add    $0x10,%esp
+      }
+      return;
+     494:	e9 63 01 00 00       	jmp    5fc <visit+0x4d9>
+    case T_DEV:
+      if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
+     499:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     49d:	75 35                	jne    4d4 <visit+0x3b1>
+     49f:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     4a4:	85 c0                	test   %eax,%eax
+     4a6:	74 2c                	je     4d4 <visit+0x3b1>
+     4a8:	8b 1d c4 20 00 00    	mov    0x20c4,%ebx
+     4ae:	83 ec 0c             	sub    $0xc,%esp
+     4b1:	ff 75 08             	push   0x8(%ebp)
+     4b4:	e8 7f fb ff ff       	call   38 <basename>
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	83 ec 08             	sub    $0x8,%esp
+     4bf:	53                   	push   %ebx
+     4c0:	50                   	push   %eax
+     4c1:	e8 bf 07 00 00       	call   c85 <strcmp>
+     4c6:	83 c4 10             	add    $0x10,%esp
+     4c9:	85 c0                	test   %eax,%eax
+     4cb:	74 07                	je     4d4 <visit+0x3b1>
+        skip = 1;
+     4cd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && search_options.type != FT_ANY){
+     4d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4d8:	75 10                	jne    4ea <visit+0x3c7>
+     4da:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     4df:	85 c0                	test   %eax,%eax
+     4e1:	74 07                	je     4ea <visit+0x3c7>
+        skip = 1;
+     4e3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
+     4ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4ee:	75 26                	jne    516 <visit+0x3f3>
+     4f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4f3:	8b 50 10             	mov    0x10(%eax),%edx
+     4f6:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     4fb:	39 c2                	cmp    %eax,%edx
+     4fd:	72 10                	jb     50f <visit+0x3ec>
+     4ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+     502:	8b 40 10             	mov    0x10(%eax),%eax
+     505:	8b 15 d0 20 00 00    	mov    0x20d0,%edx
+     50b:	39 c2                	cmp    %eax,%edx
+     50d:	73 07                	jae    516 <visit+0x3f3>
+        skip = 1;
+     50f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      }
+
+      if(!skip){
+     516:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     51a:	0f 85 df 00 00 00    	jne    5ff <visit+0x4dc>
+        printf(1, "%s\n", path);
+     520:	83 ec 04             	sub    $0x4,%esp
+     523:	ff 75 08             	push   0x8(%ebp)
+     526:	68 1e 1a 00 00       	push   $0x1a1e
+     52b:	6a 01                	push   $0x1
+     52d:	e8 24 0e 00 00       	call   1356 <printf>
+     532:	83 c4 10             	add    $0x10,%esp
+      }
+      return;
+     535:	e9 c5 00 00 00       	jmp    5ff <visit+0x4dc>
+    case T_SYMLINK:
+      if(search_options.follow){
+     53a:	a1 c0 20 00 00       	mov    0x20c0,%eax
+     53f:	85 c0                	test   %eax,%eax
+     541:	74 15                	je     558 <visit+0x435>
+        search(path, 1);
+     543:	83 ec 08             	sub    $0x8,%esp
+     546:	6a 01                	push   $0x1
+     548:	ff 75 08             	push   0x8(%ebp)
+     54b:	e8 25 fb ff ff       	call   75 <search>
+     550:	83 c4 10             	add    $0x10,%esp
+
+        if(!skip){
+          printf(1, "%s\n", path);
+        }
+      }
+      return;
+     553:	e9 aa 00 00 00       	jmp    602 <visit+0x4df>
+        if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
+     558:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     55c:	75 35                	jne    593 <visit+0x470>
+     55e:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     563:	85 c0                	test   %eax,%eax
+     565:	74 2c                	je     593 <visit+0x470>
+     567:	8b 1d c4 20 00 00    	mov    0x20c4,%ebx
+     56d:	83 ec 0c             	sub    $0xc,%esp
+     570:	ff 75 08             	push   0x8(%ebp)
+     573:	e8 c0 fa ff ff       	call   38 <basename>
+     578:	83 c4 10             	add    $0x10,%esp
+     57b:	83 ec 08             	sub    $0x8,%esp
+     57e:	53                   	push   %ebx
+     57f:	50                   	push   %eax
+     580:	e8 00 07 00 00       	call   c85 <strcmp>
+     585:	83 c4 10             	add    $0x10,%esp
+     588:	85 c0                	test   %eax,%eax
+     58a:	74 07                	je     593 <visit+0x470>
+          skip = 1;
+     58c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+        if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_SYMLINK)){
+     593:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     597:	75 1a                	jne    5b3 <visit+0x490>
+     599:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     59e:	85 c0                	test   %eax,%eax
+     5a0:	74 11                	je     5b3 <visit+0x490>
+     5a2:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     5a7:	83 f8 03             	cmp    $0x3,%eax
+     5aa:	74 07                	je     5b3 <visit+0x490>
+          skip = 1;
+     5ac:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+        if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
+     5b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5b7:	75 26                	jne    5df <visit+0x4bc>
+     5b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5bc:	8b 50 10             	mov    0x10(%eax),%edx
+     5bf:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     5c4:	39 c2                	cmp    %eax,%edx
+     5c6:	72 10                	jb     5d8 <visit+0x4b5>
+     5c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5cb:	8b 40 10             	mov    0x10(%eax),%eax
+     5ce:	8b 15 d0 20 00 00    	mov    0x20d0,%edx
+     5d4:	39 c2                	cmp    %eax,%edx
+     5d6:	73 07                	jae    5df <visit+0x4bc>
+          skip = 1;
+     5d8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+        if(!skip){
+     5df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5e3:	75 1d                	jne    602 <visit+0x4df>
+          printf(1, "%s\n", path);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	ff 75 08             	push   0x8(%ebp)
+     5eb:	68 1e 1a 00 00       	push   $0x1a1e
+     5f0:	6a 01                	push   $0x1
+     5f2:	e8 5f 0d 00 00       	call   1356 <printf>
+     5f7:	83 c4 10             	add    $0x10,%esp
+      return;
+     5fa:	eb 06                	jmp    602 <visit+0x4df>
+      return;
+     5fc:	90                   	nop
+     5fd:	eb 04                	jmp    603 <visit+0x4e0>
+      return;
+     5ff:	90                   	nop
+     600:	eb 01                	jmp    603 <visit+0x4e0>
+      return;
+     602:	90                   	nop
+  }
+}
+     603:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     606:	c9                   	leave
+     607:	c3                   	ret
+
+00000608 <print_usage>:
+
+static void
+print_usage()
+{
+     608:	55                   	push   %ebp
+     609:	89 e5                	mov    %esp,%ebp
+     60b:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "Usage: find path <options> <preds>\n");
+     60e:	83 ec 08             	sub    $0x8,%esp
+     611:	68 2c 1a 00 00       	push   $0x1a2c
+     616:	6a 01                	push   $0x1
+     618:	e8 39 0d 00 00       	call   1356 <printf>
+     61d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+     620:	83 ec 08             	sub    $0x8,%esp
+     623:	68 50 1a 00 00       	push   $0x1a50
+     628:	6a 01                	push   $0x1
+     62a:	e8 27 0d 00 00       	call   1356 <printf>
+     62f:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Options:\n");
+     632:	83 ec 08             	sub    $0x8,%esp
+     635:	68 52 1a 00 00       	push   $0x1a52
+     63a:	6a 01                	push   $0x1
+     63c:	e8 15 0d 00 00       	call   1356 <printf>
+     641:	83 c4 10             	add    $0x10,%esp
+  printf(1, "  -follow\n");
+     644:	83 ec 08             	sub    $0x8,%esp
+     647:	68 5c 1a 00 00       	push   $0x1a5c
+     64c:	6a 01                	push   $0x1
+     64e:	e8 03 0d 00 00       	call   1356 <printf>
+     653:	83 c4 10             	add    $0x10,%esp
+  printf(1, "  -help\n");
+     656:	83 ec 08             	sub    $0x8,%esp
+     659:	68 67 1a 00 00       	push   $0x1a67
+     65e:	6a 01                	push   $0x1
+     660:	e8 f1 0c 00 00       	call   1356 <printf>
+     665:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+     668:	83 ec 08             	sub    $0x8,%esp
+     66b:	68 50 1a 00 00       	push   $0x1a50
+     670:	6a 01                	push   $0x1
+     672:	e8 df 0c 00 00       	call   1356 <printf>
+     677:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Predicates:\n");
+     67a:	83 ec 08             	sub    $0x8,%esp
+     67d:	68 70 1a 00 00       	push   $0x1a70
+     682:	6a 01                	push   $0x1
+     684:	e8 cd 0c 00 00       	call   1356 <printf>
+     689:	83 c4 10             	add    $0x10,%esp
+  printf(1, "  -name filename\n");
+     68c:	83 ec 08             	sub    $0x8,%esp
+     68f:	68 7d 1a 00 00       	push   $0x1a7d
+     694:	6a 01                	push   $0x1
+     696:	e8 bb 0c 00 00       	call   1356 <printf>
+     69b:	83 c4 10             	add    $0x10,%esp
+  printf(1, "  -size [+/-]n\n");
+     69e:	83 ec 08             	sub    $0x8,%esp
+     6a1:	68 8f 1a 00 00       	push   $0x1a8f
+     6a6:	6a 01                	push   $0x1
+     6a8:	e8 a9 0c 00 00       	call   1356 <printf>
+     6ad:	83 c4 10             	add    $0x10,%esp
+  printf(1, "  -type (d|f|s)\n");
+     6b0:	83 ec 08             	sub    $0x8,%esp
+     6b3:	68 9f 1a 00 00       	push   $0x1a9f
+     6b8:	6a 01                	push   $0x1
+     6ba:	e8 97 0c 00 00       	call   1356 <printf>
+     6bf:	83 c4 10             	add    $0x10,%esp
+}
+     6c2:	90                   	nop
+     6c3:	c9                   	leave
+     6c4:	c3                   	ret
+
+000006c5 <print_search_options>:
+
+static void
+print_search_options()
+{
+     6c5:	55                   	push   %ebp
+     6c6:	89 e5                	mov    %esp,%ebp
+     6c8:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "Search Options:\n");
+     6cb:	83 ec 08             	sub    $0x8,%esp
+     6ce:	68 b0 1a 00 00       	push   $0x1ab0
+     6d3:	6a 01                	push   $0x1
+     6d5:	e8 7c 0c 00 00       	call   1356 <printf>
+     6da:	83 c4 10             	add    $0x10,%esp
+  printf(1, "follow: %d\n", search_options.follow);
+     6dd:	a1 c0 20 00 00       	mov    0x20c0,%eax
+     6e2:	83 ec 04             	sub    $0x4,%esp
+     6e5:	50                   	push   %eax
+     6e6:	68 c1 1a 00 00       	push   $0x1ac1
+     6eb:	6a 01                	push   $0x1
+     6ed:	e8 64 0c 00 00       	call   1356 <printf>
+     6f2:	83 c4 10             	add    $0x10,%esp
+  printf(1, "name_exact: %s\n", search_options.name_exact);
+     6f5:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     6fa:	83 ec 04             	sub    $0x4,%esp
+     6fd:	50                   	push   %eax
+     6fe:	68 cd 1a 00 00       	push   $0x1acd
+     703:	6a 01                	push   $0x1
+     705:	e8 4c 0c 00 00       	call   1356 <printf>
+     70a:	83 c4 10             	add    $0x10,%esp
+  switch(search_options.type){
+     70d:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     712:	83 f8 03             	cmp    $0x3,%eax
+     715:	74 56                	je     76d <print_search_options+0xa8>
+     717:	83 f8 03             	cmp    $0x3,%eax
+     71a:	77 65                	ja     781 <print_search_options+0xbc>
+     71c:	83 f8 02             	cmp    $0x2,%eax
+     71f:	74 38                	je     759 <print_search_options+0x94>
+     721:	83 f8 02             	cmp    $0x2,%eax
+     724:	77 5b                	ja     781 <print_search_options+0xbc>
+     726:	85 c0                	test   %eax,%eax
+     728:	74 07                	je     731 <print_search_options+0x6c>
+     72a:	83 f8 01             	cmp    $0x1,%eax
+     72d:	74 16                	je     745 <print_search_options+0x80>
+     72f:	eb 50                	jmp    781 <print_search_options+0xbc>
+    case FT_ANY:
+      printf(1, "type: FT_ANY\n");
+     731:	83 ec 08             	sub    $0x8,%esp
+     734:	68 dd 1a 00 00       	push   $0x1add
+     739:	6a 01                	push   $0x1
+     73b:	e8 16 0c 00 00       	call   1356 <printf>
+     740:	83 c4 10             	add    $0x10,%esp
+      break;
+     743:	eb 59                	jmp    79e <print_search_options+0xd9>
+    case FT_DIR:
+      printf(1, "type: FT_DIR\n");
+     745:	83 ec 08             	sub    $0x8,%esp
+     748:	68 eb 1a 00 00       	push   $0x1aeb
+     74d:	6a 01                	push   $0x1
+     74f:	e8 02 0c 00 00       	call   1356 <printf>
+     754:	83 c4 10             	add    $0x10,%esp
+      break;
+     757:	eb 45                	jmp    79e <print_search_options+0xd9>
+    case FT_FILE:
+      printf(1, "type: FT_FILE\n");
+     759:	83 ec 08             	sub    $0x8,%esp
+     75c:	68 f9 1a 00 00       	push   $0x1af9
+     761:	6a 01                	push   $0x1
+     763:	e8 ee 0b 00 00       	call   1356 <printf>
+     768:	83 c4 10             	add    $0x10,%esp
+      break;
+     76b:	eb 31                	jmp    79e <print_search_options+0xd9>
+    case FT_SYMLINK:
+      printf(1, "type: FT_SYMLINK\n");
+     76d:	83 ec 08             	sub    $0x8,%esp
+     770:	68 08 1b 00 00       	push   $0x1b08
+     775:	6a 01                	push   $0x1
+     777:	e8 da 0b 00 00       	call   1356 <printf>
+     77c:	83 c4 10             	add    $0x10,%esp
+      break;
+     77f:	eb 1d                	jmp    79e <print_search_options+0xd9>
+    default:
+      printf(1, "Error, unknown type: %d\n", search_options.type);
+     781:	a1 c8 20 00 00       	mov    0x20c8,%eax
+     786:	83 ec 04             	sub    $0x4,%esp
+     789:	50                   	push   %eax
+     78a:	68 1a 1b 00 00       	push   $0x1b1a
+     78f:	6a 01                	push   $0x1
+     791:	e8 c0 0b 00 00       	call   1356 <printf>
+     796:	83 c4 10             	add    $0x10,%esp
+      exit();
+     799:	e8 28 07 00 00       	call   ec6 <exit>
+  }
+  printf(1, "min_size: %d\n", search_options.min_size);
+     79e:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     7a3:	83 ec 04             	sub    $0x4,%esp
+     7a6:	50                   	push   %eax
+     7a7:	68 33 1b 00 00       	push   $0x1b33
+     7ac:	6a 01                	push   $0x1
+     7ae:	e8 a3 0b 00 00       	call   1356 <printf>
+     7b3:	83 c4 10             	add    $0x10,%esp
+  printf(1, "max_size: %d\n", search_options.max_size);
+     7b6:	a1 d0 20 00 00       	mov    0x20d0,%eax
+     7bb:	83 ec 04             	sub    $0x4,%esp
+     7be:	50                   	push   %eax
+     7bf:	68 41 1b 00 00       	push   $0x1b41
+     7c4:	6a 01                	push   $0x1
+     7c6:	e8 8b 0b 00 00       	call   1356 <printf>
+     7cb:	83 c4 10             	add    $0x10,%esp
+}
+     7ce:	90                   	nop
+     7cf:	c9                   	leave
+     7d0:	c3                   	ret
+
+000007d1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     7d1:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     7d5:	83 e4 f0             	and    $0xfffffff0,%esp
+     7d8:	ff 71 fc             	push   -0x4(%ecx)
+     7db:	55                   	push   %ebp
+     7dc:	89 e5                	mov    %esp,%ebp
+     7de:	53                   	push   %ebx
+     7df:	51                   	push   %ecx
+     7e0:	83 ec 10             	sub    $0x10,%esp
+     7e3:	89 cb                	mov    %ecx,%ebx
+  int i;
+  char *path;
+
+  if(argc < 2){
+     7e5:	83 3b 01             	cmpl   $0x1,(%ebx)
+     7e8:	7f 1c                	jg     806 <main+0x35>
+    printf(1, "Error, not enough arguments\n");
+     7ea:	83 ec 08             	sub    $0x8,%esp
+     7ed:	68 4f 1b 00 00       	push   $0x1b4f
+     7f2:	6a 01                	push   $0x1
+     7f4:	e8 5d 0b 00 00       	call   1356 <printf>
+     7f9:	83 c4 10             	add    $0x10,%esp
+    print_usage();
+     7fc:	e8 07 fe ff ff       	call   608 <print_usage>
+    exit();
+     801:	e8 c0 06 00 00       	call   ec6 <exit>
+  }
+
+  set_default_search_options();
+     806:	e8 f5 f7 ff ff       	call   0 <set_default_search_options>
+
+  path = argv[1];
+     80b:	8b 43 04             	mov    0x4(%ebx),%eax
+     80e:	8b 40 04             	mov    0x4(%eax),%eax
+     811:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  // Special case:
+  if(strcmp(path, "-help") == 0){
+     814:	83 ec 08             	sub    $0x8,%esp
+     817:	68 6c 1b 00 00       	push   $0x1b6c
+     81c:	ff 75 f0             	push   -0x10(%ebp)
+     81f:	e8 61 04 00 00       	call   c85 <strcmp>
+     824:	83 c4 10             	add    $0x10,%esp
+     827:	85 c0                	test   %eax,%eax
+     829:	75 0a                	jne    835 <main+0x64>
+    print_usage();
+     82b:	e8 d8 fd ff ff       	call   608 <print_usage>
+    exit();
+     830:	e8 91 06 00 00       	call   ec6 <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+     835:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+     83c:	e9 ce 03 00 00       	jmp    c0f <main+0x43e>
+    if(strcmp(argv[i], "-help") == 0){
+     841:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     844:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     84b:	8b 43 04             	mov    0x4(%ebx),%eax
+     84e:	01 d0                	add    %edx,%eax
+     850:	8b 00                	mov    (%eax),%eax
+     852:	83 ec 08             	sub    $0x8,%esp
+     855:	68 6c 1b 00 00       	push   $0x1b6c
+     85a:	50                   	push   %eax
+     85b:	e8 25 04 00 00       	call   c85 <strcmp>
+     860:	83 c4 10             	add    $0x10,%esp
+     863:	85 c0                	test   %eax,%eax
+     865:	75 0a                	jne    871 <main+0xa0>
+      print_usage();
+     867:	e8 9c fd ff ff       	call   608 <print_usage>
+      exit();
+     86c:	e8 55 06 00 00       	call   ec6 <exit>
+    } else if(strcmp(argv[i], "-follow") == 0){
+     871:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     874:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     87b:	8b 43 04             	mov    0x4(%ebx),%eax
+     87e:	01 d0                	add    %edx,%eax
+     880:	8b 00                	mov    (%eax),%eax
+     882:	83 ec 08             	sub    $0x8,%esp
+     885:	68 72 1b 00 00       	push   $0x1b72
+     88a:	50                   	push   %eax
+     88b:	e8 f5 03 00 00       	call   c85 <strcmp>
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	85 c0                	test   %eax,%eax
+     895:	75 0f                	jne    8a6 <main+0xd5>
+      search_options.follow = 1;
+     897:	c7 05 c0 20 00 00 01 	movl   $0x1,0x20c0
+     89e:	00 00 00 
+     8a1:	e9 65 03 00 00       	jmp    c0b <main+0x43a>
+    } else if(strcmp(argv[i], "-name") == 0){
+     8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8a9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     8b0:	8b 43 04             	mov    0x4(%ebx),%eax
+     8b3:	01 d0                	add    %edx,%eax
+     8b5:	8b 00                	mov    (%eax),%eax
+     8b7:	83 ec 08             	sub    $0x8,%esp
+     8ba:	68 7a 1b 00 00       	push   $0x1b7a
+     8bf:	50                   	push   %eax
+     8c0:	e8 c0 03 00 00       	call   c85 <strcmp>
+     8c5:	83 c4 10             	add    $0x10,%esp
+     8c8:	85 c0                	test   %eax,%eax
+     8ca:	75 79                	jne    945 <main+0x174>
+      if(i+1 >= argc){
+     8cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8cf:	83 c0 01             	add    $0x1,%eax
+     8d2:	39 03                	cmp    %eax,(%ebx)
+     8d4:	7f 2e                	jg     904 <main+0x133>
+        printf(1, "Error, missing parameter for %s\n", argv[i]);
+     8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     8e0:	8b 43 04             	mov    0x4(%ebx),%eax
+     8e3:	01 d0                	add    %edx,%eax
+     8e5:	8b 00                	mov    (%eax),%eax
+     8e7:	83 ec 04             	sub    $0x4,%esp
+     8ea:	50                   	push   %eax
+     8eb:	68 80 1b 00 00       	push   $0x1b80
+     8f0:	6a 01                	push   $0x1
+     8f2:	e8 5f 0a 00 00       	call   1356 <printf>
+     8f7:	83 c4 10             	add    $0x10,%esp
+        print_usage();
+     8fa:	e8 09 fd ff ff       	call   608 <print_usage>
+        exit();
+     8ff:	e8 c2 05 00 00       	call   ec6 <exit>
+      }
+      i++;
+     904:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      search_options.name_exact = argv[i];
+     908:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     90b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     912:	8b 43 04             	mov    0x4(%ebx),%eax
+     915:	01 d0                	add    %edx,%eax
+     917:	8b 00                	mov    (%eax),%eax
+     919:	a3 c4 20 00 00       	mov    %eax,0x20c4
+      if(*search_options.name_exact == '\0'){
+     91e:	a1 c4 20 00 00       	mov    0x20c4,%eax
+     923:	0f b6 00             	movzbl (%eax),%eax
+     926:	84 c0                	test   %al,%al
+     928:	0f 85 dd 02 00 00    	jne    c0b <main+0x43a>
+        printf(1, "Error, name parameter cannot be empty\n");
+     92e:	83 ec 08             	sub    $0x8,%esp
+     931:	68 a4 1b 00 00       	push   $0x1ba4
+     936:	6a 01                	push   $0x1
+     938:	e8 19 0a 00 00       	call   1356 <printf>
+     93d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     940:	e8 81 05 00 00       	call   ec6 <exit>
+      }
+    } else if(strcmp(argv[i], "-size") == 0){
+     945:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     948:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     94f:	8b 43 04             	mov    0x4(%ebx),%eax
+     952:	01 d0                	add    %edx,%eax
+     954:	8b 00                	mov    (%eax),%eax
+     956:	83 ec 08             	sub    $0x8,%esp
+     959:	68 cb 1b 00 00       	push   $0x1bcb
+     95e:	50                   	push   %eax
+     95f:	e8 21 03 00 00       	call   c85 <strcmp>
+     964:	83 c4 10             	add    $0x10,%esp
+     967:	85 c0                	test   %eax,%eax
+     969:	0f 85 3e 01 00 00    	jne    aad <main+0x2dc>
+      if(i+1 >= argc){
+     96f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     972:	83 c0 01             	add    $0x1,%eax
+     975:	39 03                	cmp    %eax,(%ebx)
+     977:	7f 2e                	jg     9a7 <main+0x1d6>
+        printf(1, "Error, missing parameter for %s\n", argv[i]);
+     979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     983:	8b 43 04             	mov    0x4(%ebx),%eax
+     986:	01 d0                	add    %edx,%eax
+     988:	8b 00                	mov    (%eax),%eax
+     98a:	83 ec 04             	sub    $0x4,%esp
+     98d:	50                   	push   %eax
+     98e:	68 80 1b 00 00       	push   $0x1b80
+     993:	6a 01                	push   $0x1
+     995:	e8 bc 09 00 00       	call   1356 <printf>
+     99a:	83 c4 10             	add    $0x10,%esp
+        print_usage();
+     99d:	e8 66 fc ff ff       	call   608 <print_usage>
+        exit();
+     9a2:	e8 1f 05 00 00       	call   ec6 <exit>
+      }
+      i++;
+     9a7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      if(*argv[i] == '\0'){
+     9ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9ae:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     9b5:	8b 43 04             	mov    0x4(%ebx),%eax
+     9b8:	01 d0                	add    %edx,%eax
+     9ba:	8b 00                	mov    (%eax),%eax
+     9bc:	0f b6 00             	movzbl (%eax),%eax
+     9bf:	84 c0                	test   %al,%al
+     9c1:	75 17                	jne    9da <main+0x209>
+        printf(1, "Error, size parameter cannot be empty\n");
+     9c3:	83 ec 08             	sub    $0x8,%esp
+     9c6:	68 d4 1b 00 00       	push   $0x1bd4
+     9cb:	6a 01                	push   $0x1
+     9cd:	e8 84 09 00 00       	call   1356 <printf>
+     9d2:	83 c4 10             	add    $0x10,%esp
+        exit();
+     9d5:	e8 ec 04 00 00       	call   ec6 <exit>
+      }
+      if(argv[i][0] == '+'){
+     9da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9dd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     9e4:	8b 43 04             	mov    0x4(%ebx),%eax
+     9e7:	01 d0                	add    %edx,%eax
+     9e9:	8b 00                	mov    (%eax),%eax
+     9eb:	0f b6 00             	movzbl (%eax),%eax
+     9ee:	3c 2b                	cmp    $0x2b,%al
+     9f0:	75 2d                	jne    a1f <main+0x24e>
+        search_options.min_size = atoi(&argv[i][1]) + 1; // Add one since the + means "more than"
+     9f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9f5:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     9fc:	8b 43 04             	mov    0x4(%ebx),%eax
+     9ff:	01 d0                	add    %edx,%eax
+     a01:	8b 00                	mov    (%eax),%eax
+     a03:	83 c0 01             	add    $0x1,%eax
+     a06:	83 ec 0c             	sub    $0xc,%esp
+     a09:	50                   	push   %eax
+     a0a:	e8 e5 03 00 00       	call   df4 <atoi>
+     a0f:	83 c4 10             	add    $0x10,%esp
+     a12:	83 c0 01             	add    $0x1,%eax
+     a15:	a3 cc 20 00 00       	mov    %eax,0x20cc
+     a1a:	e9 ec 01 00 00       	jmp    c0b <main+0x43a>
+      } else if(argv[i][0] == '-'){
+     a1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a22:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     a29:	8b 43 04             	mov    0x4(%ebx),%eax
+     a2c:	01 d0                	add    %edx,%eax
+     a2e:	8b 00                	mov    (%eax),%eax
+     a30:	0f b6 00             	movzbl (%eax),%eax
+     a33:	3c 2d                	cmp    $0x2d,%al
+     a35:	75 2d                	jne    a64 <main+0x293>
+        search_options.max_size = atoi(&argv[i][1]) - 1; // Subtract one since the + means "more than"
+     a37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a3a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     a41:	8b 43 04             	mov    0x4(%ebx),%eax
+     a44:	01 d0                	add    %edx,%eax
+     a46:	8b 00                	mov    (%eax),%eax
+     a48:	83 c0 01             	add    $0x1,%eax
+     a4b:	83 ec 0c             	sub    $0xc,%esp
+     a4e:	50                   	push   %eax
+     a4f:	e8 a0 03 00 00       	call   df4 <atoi>
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	83 e8 01             	sub    $0x1,%eax
+     a5a:	a3 d0 20 00 00       	mov    %eax,0x20d0
+     a5f:	e9 a7 01 00 00       	jmp    c0b <main+0x43a>
+      } else {
+        search_options.min_size = atoi(argv[i]);
+     a64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a67:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     a6e:	8b 43 04             	mov    0x4(%ebx),%eax
+     a71:	01 d0                	add    %edx,%eax
+     a73:	8b 00                	mov    (%eax),%eax
+     a75:	83 ec 0c             	sub    $0xc,%esp
+     a78:	50                   	push   %eax
+     a79:	e8 76 03 00 00       	call   df4 <atoi>
+     a7e:	83 c4 10             	add    $0x10,%esp
+     a81:	a3 cc 20 00 00       	mov    %eax,0x20cc
+        search_options.max_size = atoi(argv[i]);
+     a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a89:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     a90:	8b 43 04             	mov    0x4(%ebx),%eax
+     a93:	01 d0                	add    %edx,%eax
+     a95:	8b 00                	mov    (%eax),%eax
+     a97:	83 ec 0c             	sub    $0xc,%esp
+     a9a:	50                   	push   %eax
+     a9b:	e8 54 03 00 00       	call   df4 <atoi>
+     aa0:	83 c4 10             	add    $0x10,%esp
+     aa3:	a3 d0 20 00 00       	mov    %eax,0x20d0
+     aa8:	e9 5e 01 00 00       	jmp    c0b <main+0x43a>
+      }
+    } else if(strcmp(argv[i], "-type") == 0){
+     aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ab0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     ab7:	8b 43 04             	mov    0x4(%ebx),%eax
+     aba:	01 d0                	add    %edx,%eax
+     abc:	8b 00                	mov    (%eax),%eax
+     abe:	83 ec 08             	sub    $0x8,%esp
+     ac1:	68 fb 1b 00 00       	push   $0x1bfb
+     ac6:	50                   	push   %eax
+     ac7:	e8 b9 01 00 00       	call   c85 <strcmp>
+     acc:	83 c4 10             	add    $0x10,%esp
+     acf:	85 c0                	test   %eax,%eax
+     ad1:	0f 85 06 01 00 00    	jne    bdd <main+0x40c>
+      if(i+1 >= argc){
+     ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ada:	83 c0 01             	add    $0x1,%eax
+     add:	39 03                	cmp    %eax,(%ebx)
+     adf:	7f 2e                	jg     b0f <main+0x33e>
+        printf(1, "Error, missing parameter for %s\n", argv[i]);
+     ae1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ae4:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     aeb:	8b 43 04             	mov    0x4(%ebx),%eax
+     aee:	01 d0                	add    %edx,%eax
+     af0:	8b 00                	mov    (%eax),%eax
+     af2:	83 ec 04             	sub    $0x4,%esp
+     af5:	50                   	push   %eax
+     af6:	68 80 1b 00 00       	push   $0x1b80
+     afb:	6a 01                	push   $0x1
+     afd:	e8 54 08 00 00       	call   1356 <printf>
+     b02:	83 c4 10             	add    $0x10,%esp
+        print_usage();
+     b05:	e8 fe fa ff ff       	call   608 <print_usage>
+        exit();
+     b0a:	e8 b7 03 00 00       	call   ec6 <exit>
+      }
+      i++;
+     b0f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      if(strcmp(argv[i], "d") == 0){
+     b13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b16:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     b1d:	8b 43 04             	mov    0x4(%ebx),%eax
+     b20:	01 d0                	add    %edx,%eax
+     b22:	8b 00                	mov    (%eax),%eax
+     b24:	83 ec 08             	sub    $0x8,%esp
+     b27:	68 01 1c 00 00       	push   $0x1c01
+     b2c:	50                   	push   %eax
+     b2d:	e8 53 01 00 00       	call   c85 <strcmp>
+     b32:	83 c4 10             	add    $0x10,%esp
+     b35:	85 c0                	test   %eax,%eax
+     b37:	75 0f                	jne    b48 <main+0x377>
+        search_options.type = FT_DIR;
+     b39:	c7 05 c8 20 00 00 01 	movl   $0x1,0x20c8
+     b40:	00 00 00 
+     b43:	e9 c3 00 00 00       	jmp    c0b <main+0x43a>
+      } else if(strcmp(argv[i], "f") == 0){
+     b48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b4b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     b52:	8b 43 04             	mov    0x4(%ebx),%eax
+     b55:	01 d0                	add    %edx,%eax
+     b57:	8b 00                	mov    (%eax),%eax
+     b59:	83 ec 08             	sub    $0x8,%esp
+     b5c:	68 03 1c 00 00       	push   $0x1c03
+     b61:	50                   	push   %eax
+     b62:	e8 1e 01 00 00       	call   c85 <strcmp>
+     b67:	83 c4 10             	add    $0x10,%esp
+     b6a:	85 c0                	test   %eax,%eax
+     b6c:	75 0f                	jne    b7d <main+0x3ac>
+        search_options.type = FT_FILE;
+     b6e:	c7 05 c8 20 00 00 02 	movl   $0x2,0x20c8
+     b75:	00 00 00 
+     b78:	e9 8e 00 00 00       	jmp    c0b <main+0x43a>
+      } else if(strcmp(argv[i], "s") == 0){
+     b7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b80:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     b87:	8b 43 04             	mov    0x4(%ebx),%eax
+     b8a:	01 d0                	add    %edx,%eax
+     b8c:	8b 00                	mov    (%eax),%eax
+     b8e:	83 ec 08             	sub    $0x8,%esp
+     b91:	68 05 1c 00 00       	push   $0x1c05
+     b96:	50                   	push   %eax
+     b97:	e8 e9 00 00 00       	call   c85 <strcmp>
+     b9c:	83 c4 10             	add    $0x10,%esp
+     b9f:	85 c0                	test   %eax,%eax
+     ba1:	75 0c                	jne    baf <main+0x3de>
+        search_options.type = FT_SYMLINK;
+     ba3:	c7 05 c8 20 00 00 03 	movl   $0x3,0x20c8
+     baa:	00 00 00 
+     bad:	eb 5c                	jmp    c0b <main+0x43a>
+      } else {
+        printf(1, "Error, unknown parameter for -type: %s\n", argv[i]);
+     baf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bb2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     bb9:	8b 43 04             	mov    0x4(%ebx),%eax
+     bbc:	01 d0                	add    %edx,%eax
+     bbe:	8b 00                	mov    (%eax),%eax
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	50                   	push   %eax
+     bc4:	68 08 1c 00 00       	push   $0x1c08
+     bc9:	6a 01                	push   $0x1
+     bcb:	e8 86 07 00 00       	call   1356 <printf>
+     bd0:	83 c4 10             	add    $0x10,%esp
+        print_usage();
+     bd3:	e8 30 fa ff ff       	call   608 <print_usage>
+        exit();
+     bd8:	e8 e9 02 00 00       	call   ec6 <exit>
+      }
+    } else {
+      printf(1, "Error, unrecognized argument: %s\n", argv[i]);
+     bdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     be0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     be7:	8b 43 04             	mov    0x4(%ebx),%eax
+     bea:	01 d0                	add    %edx,%eax
+     bec:	8b 00                	mov    (%eax),%eax
+     bee:	83 ec 04             	sub    $0x4,%esp
+     bf1:	50                   	push   %eax
+     bf2:	68 30 1c 00 00       	push   $0x1c30
+     bf7:	6a 01                	push   $0x1
+     bf9:	e8 58 07 00 00       	call   1356 <printf>
+     bfe:	83 c4 10             	add    $0x10,%esp
+      print_usage();
+     c01:	e8 02 fa ff ff       	call   608 <print_usage>
+      exit();
+     c06:	e8 bb 02 00 00       	call   ec6 <exit>
+  for(i = 2; i < argc; i++){
+     c0b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c12:	3b 03                	cmp    (%ebx),%eax
+     c14:	0f 8c 27 fc ff ff    	jl     841 <main+0x70>
+
+  if(0){ // Toggle to enable debugging output
+    print_search_options();
+  }
+
+  search(path, 0);
+     c1a:	83 ec 08             	sub    $0x8,%esp
+     c1d:	6a 00                	push   $0x0
+     c1f:	ff 75 f0             	push   -0x10(%ebp)
+     c22:	e8 4e f4 ff ff       	call   75 <search>
+     c27:	83 c4 10             	add    $0x10,%esp
+
+  exit();
+     c2a:	e8 97 02 00 00       	call   ec6 <exit>
+
+00000c2f <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     c2f:	55                   	push   %ebp
+     c30:	89 e5                	mov    %esp,%ebp
+     c32:	57                   	push   %edi
+     c33:	53                   	push   %ebx
+    if(cc < 1)
+     c34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c37:	8b 55 10             	mov    0x10(%ebp),%edx
+     c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c3d:	89 cb                	mov    %ecx,%ebx
+     c3f:	89 df                	mov    %ebx,%edi
+     c41:	89 d1                	mov    %edx,%ecx
+     c43:	fc                   	cld
+     c44:	f3 aa                	rep stos %al,%es:(%edi)
+     c46:	89 ca                	mov    %ecx,%edx
+     c48:	89 fb                	mov    %edi,%ebx
+     c4a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     c4d:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     c50:	90                   	nop
+     c51:	5b                   	pop    %ebx
+     c52:	5f                   	pop    %edi
+     c53:	5d                   	pop    %ebp
+     c54:	c3                   	ret
+
+00000c55 <strcpy>:
+{
+     c55:	55                   	push   %ebp
+     c56:	89 e5                	mov    %esp,%ebp
+     c58:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c5e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     c61:	90                   	nop
+     c62:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c65:	8d 42 01             	lea    0x1(%edx),%eax
+     c68:	89 45 0c             	mov    %eax,0xc(%ebp)
+     c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6e:	8d 48 01             	lea    0x1(%eax),%ecx
+     c71:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     c74:	0f b6 12             	movzbl (%edx),%edx
+     c77:	88 10                	mov    %dl,(%eax)
+     c79:	0f b6 00             	movzbl (%eax),%eax
+     c7c:	84 c0                	test   %al,%al
+     c7e:	75 e2                	jne    c62 <strcpy+0xd>
+  return os;
+     c80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     c83:	c9                   	leave
+     c84:	c3                   	ret
+
+00000c85 <strcmp>:
+{
+     c85:	55                   	push   %ebp
+     c86:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     c88:	eb 08                	jmp    c92 <strcmp+0xd>
+    p++, q++;
+     c8a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     c8e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     c92:	8b 45 08             	mov    0x8(%ebp),%eax
+     c95:	0f b6 00             	movzbl (%eax),%eax
+     c98:	84 c0                	test   %al,%al
+     c9a:	74 10                	je     cac <strcmp+0x27>
+     c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c9f:	0f b6 10             	movzbl (%eax),%edx
+     ca2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ca5:	0f b6 00             	movzbl (%eax),%eax
+     ca8:	38 c2                	cmp    %al,%dl
+     caa:	74 de                	je     c8a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     cac:	8b 45 08             	mov    0x8(%ebp),%eax
+     caf:	0f b6 00             	movzbl (%eax),%eax
+     cb2:	0f b6 d0             	movzbl %al,%edx
+     cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cb8:	0f b6 00             	movzbl (%eax),%eax
+     cbb:	0f b6 c0             	movzbl %al,%eax
+     cbe:	29 c2                	sub    %eax,%edx
+     cc0:	89 d0                	mov    %edx,%eax
+}
+     cc2:	5d                   	pop    %ebp
+     cc3:	c3                   	ret
+
+00000cc4 <strlen>:
+{
+     cc4:	55                   	push   %ebp
+     cc5:	89 e5                	mov    %esp,%ebp
+     cc7:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     cca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     cd1:	eb 04                	jmp    cd7 <strlen+0x13>
+     cd3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     cd7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     cda:	8b 45 08             	mov    0x8(%ebp),%eax
+     cdd:	01 d0                	add    %edx,%eax
+     cdf:	0f b6 00             	movzbl (%eax),%eax
+     ce2:	84 c0                	test   %al,%al
+     ce4:	75 ed                	jne    cd3 <strlen+0xf>
+  return n;
+     ce6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     ce9:	c9                   	leave
+     cea:	c3                   	ret
+
+00000ceb <memset>:
+{
+     ceb:	55                   	push   %ebp
+     cec:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     cee:	8b 45 10             	mov    0x10(%ebp),%eax
+     cf1:	50                   	push   %eax
+     cf2:	ff 75 0c             	push   0xc(%ebp)
+     cf5:	ff 75 08             	push   0x8(%ebp)
+     cf8:	e8 32 ff ff ff       	call   c2f <stosb>
+     cfd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     d00:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     d03:	c9                   	leave
+     d04:	c3                   	ret
+
+00000d05 <strchr>:
+{
+     d05:	55                   	push   %ebp
+     d06:	89 e5                	mov    %esp,%ebp
+     d08:	83 ec 04             	sub    $0x4,%esp
+     d0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d0e:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     d11:	eb 14                	jmp    d27 <strchr+0x22>
+    if(*s == c)
+     d13:	8b 45 08             	mov    0x8(%ebp),%eax
+     d16:	0f b6 00             	movzbl (%eax),%eax
+     d19:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     d1c:	75 05                	jne    d23 <strchr+0x1e>
+      return (char*)s;
+     d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d21:	eb 13                	jmp    d36 <strchr+0x31>
+  for(; *s; s++)
+     d23:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     d27:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2a:	0f b6 00             	movzbl (%eax),%eax
+     d2d:	84 c0                	test   %al,%al
+     d2f:	75 e2                	jne    d13 <strchr+0xe>
+  return 0;
+     d31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d36:	c9                   	leave
+     d37:	c3                   	ret
+
+00000d38 <gets>:
+{
+     d38:	55                   	push   %ebp
+     d39:	89 e5                	mov    %esp,%ebp
+     d3b:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     d3e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d45:	eb 42                	jmp    d89 <gets+0x51>
+    cc = read(0, &c, 1);
+     d47:	83 ec 04             	sub    $0x4,%esp
+     d4a:	6a 01                	push   $0x1
+     d4c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     d4f:	50                   	push   %eax
+     d50:	6a 00                	push   $0x0
+     d52:	e8 84 01 00 00       	call   edb <read>
+     d57:	83 c4 10             	add    $0x10,%esp
+     d5a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     d5d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d61:	7e 33                	jle    d96 <gets+0x5e>
+    buf[i++] = c;
+     d63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d66:	8d 50 01             	lea    0x1(%eax),%edx
+     d69:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     d6c:	89 c2                	mov    %eax,%edx
+     d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d71:	01 c2                	add    %eax,%edx
+     d73:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d77:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     d79:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d7d:	3c 0a                	cmp    $0xa,%al
+     d7f:	74 16                	je     d97 <gets+0x5f>
+     d81:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     d85:	3c 0d                	cmp    $0xd,%al
+     d87:	74 0e                	je     d97 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d8c:	83 c0 01             	add    $0x1,%eax
+     d8f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     d92:	7f b3                	jg     d47 <gets+0xf>
+     d94:	eb 01                	jmp    d97 <gets+0x5f>
+      break;
+     d96:	90                   	nop
+  }
+  buf[i] = '\0';
+     d97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d9d:	01 d0                	add    %edx,%eax
+     d9f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     da2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     da5:	c9                   	leave
+     da6:	c3                   	ret
+
+00000da7 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     da7:	55                   	push   %ebp
+     da8:	89 e5                	mov    %esp,%ebp
+     daa:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     dad:	83 ec 08             	sub    $0x8,%esp
+     db0:	6a 00                	push   $0x0
+     db2:	ff 75 08             	push   0x8(%ebp)
+     db5:	e8 44 01 00 00       	call   efe <open>
+     dba:	83 c4 10             	add    $0x10,%esp
+     dbd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     dc0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     dc4:	79 07                	jns    dcd <stat+0x26>
+    return -1;
+     dc6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     dcb:	eb 25                	jmp    df2 <stat+0x4b>
+  r = fstat(fd, st);
+     dcd:	83 ec 08             	sub    $0x8,%esp
+     dd0:	ff 75 0c             	push   0xc(%ebp)
+     dd3:	ff 75 f4             	push   -0xc(%ebp)
+     dd6:	e8 41 01 00 00       	call   f1c <fstat>
+     ddb:	83 c4 10             	add    $0x10,%esp
+     dde:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     de1:	83 ec 0c             	sub    $0xc,%esp
+     de4:	ff 75 f4             	push   -0xc(%ebp)
+     de7:	e8 fd 00 00 00       	call   ee9 <close>
+     dec:	83 c4 10             	add    $0x10,%esp
+  return r;
+     def:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     df2:	c9                   	leave
+     df3:	c3                   	ret
+
+00000df4 <atoi>:
+
+int
+atoi(const char *s)
+{
+     df4:	55                   	push   %ebp
+     df5:	89 e5                	mov    %esp,%ebp
+     df7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     dfa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     e01:	eb 25                	jmp    e28 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     e03:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e06:	89 d0                	mov    %edx,%eax
+     e08:	c1 e0 02             	shl    $0x2,%eax
+     e0b:	01 d0                	add    %edx,%eax
+     e0d:	01 c0                	add    %eax,%eax
+     e0f:	89 c1                	mov    %eax,%ecx
+     e11:	8b 45 08             	mov    0x8(%ebp),%eax
+     e14:	8d 50 01             	lea    0x1(%eax),%edx
+     e17:	89 55 08             	mov    %edx,0x8(%ebp)
+     e1a:	0f b6 00             	movzbl (%eax),%eax
+     e1d:	0f be c0             	movsbl %al,%eax
+     e20:	01 c8                	add    %ecx,%eax
+     e22:	83 e8 30             	sub    $0x30,%eax
+     e25:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     e28:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2b:	0f b6 00             	movzbl (%eax),%eax
+     e2e:	3c 2f                	cmp    $0x2f,%al
+     e30:	7e 0a                	jle    e3c <atoi+0x48>
+     e32:	8b 45 08             	mov    0x8(%ebp),%eax
+     e35:	0f b6 00             	movzbl (%eax),%eax
+     e38:	3c 39                	cmp    $0x39,%al
+     e3a:	7e c7                	jle    e03 <atoi+0xf>
+  return n;
+     e3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     e3f:	c9                   	leave
+     e40:	c3                   	ret
+
+00000e41 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e41:	55                   	push   %ebp
+     e42:	89 e5                	mov    %esp,%ebp
+     e44:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     e47:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     e4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e50:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     e53:	eb 17                	jmp    e6c <memmove+0x2b>
+    *dst++ = *src++;
+     e55:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     e58:	8d 42 01             	lea    0x1(%edx),%eax
+     e5b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     e5e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e61:	8d 48 01             	lea    0x1(%eax),%ecx
+     e64:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     e67:	0f b6 12             	movzbl (%edx),%edx
+     e6a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     e6c:	8b 45 10             	mov    0x10(%ebp),%eax
+     e6f:	8d 50 ff             	lea    -0x1(%eax),%edx
+     e72:	89 55 10             	mov    %edx,0x10(%ebp)
+     e75:	85 c0                	test   %eax,%eax
+     e77:	7f dc                	jg     e55 <memmove+0x14>
+  return vdst;
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     e7c:	c9                   	leave
+     e7d:	c3                   	ret
+
+00000e7e <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     e7e:	83 3d a8 20 00 00 00 	cmpl   $0x0,0x20a8
+  jg 2f
+     e85:	7f 2e                	jg     eb5 <dosyscall+0x37>
+  jl 1f
+     e87:	7c 29                	jl     eb2 <dosyscall+0x34>
+  pushl %eax
+     e89:	50                   	push   %eax
+  pushl %ebx
+     e8a:	53                   	push   %ebx
+  movl $1, %eax
+     e8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     e90:	0f a2                	cpuid
+  popl %ebx
+     e92:	5b                   	pop    %ebx
+  popl %eax
+     e93:	58                   	pop    %eax
+  movl $-1, sysmode
+     e94:	c7 05 a8 20 00 00 ff 	movl   $0xffffffff,0x20a8
+     e9b:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     e9e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     ea4:	74 0c                	je     eb2 <dosyscall+0x34>
+  movl $1, sysmode
+     ea6:	c7 05 a8 20 00 00 01 	movl   $0x1,0x20a8
+     ead:	00 00 00 
+  jmp 2f
+     eb0:	eb 03                	jmp    eb5 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     eb2:	cd 40                	int    $0x40
+  ret
+     eb4:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     eb5:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     eb7:	ba be 0e 00 00       	mov    $0xebe,%edx
+  sysenter
+     ebc:	0f 34                	sysenter
+3:
+  ret
+     ebe:	c3                   	ret
+
+00000ebf <fork>:
+
+SYSCALL(fork)
+     ebf:	b8 01 00 00 00       	mov    $0x1,%eax
+     ec4:	eb b8                	jmp    e7e <dosyscall>
+
+00000ec6 <exit>:
+SYSCALL(exit)
+     ec6:	b8 02 00 00 00       	mov    $0x2,%eax
+     ecb:	eb b1                	jmp    e7e <dosyscall>
+
+00000ecd <wait>:
+SYSCALL(wait)
+     ecd:	b8 03 00 00 00       	mov    $0x3,%eax
+     ed2:	eb aa                	jmp    e7e <dosyscall>
+
+00000ed4 <pipe>:
+SYSCALL(pipe)
+     ed4:	b8 04 00 00 00       	mov    $0x4,%eax
+     ed9:	eb a3                	jmp    e7e <dosyscall>
+
+00000edb <read>:
+SYSCALL(read)
+     edb:	b8 05 00 00 00       	mov    $0x5,%eax
+     ee0:	eb 9c                	jmp    e7e <dosyscall>
+
+00000ee2 <write>:
+SYSCALL(write)
+     ee2:	b8 10 00 00 00       	mov    $0x10,%eax
+     ee7:	eb 95                	jmp    e7e <dosyscall>
+
+00000ee9 <close>:
+SYSCALL(close)
+     ee9:	b8 15 00 00 00       	mov    $0x15,%eax
+     eee:	eb 8e                	jmp    e7e <dosyscall>
+
+00000ef0 <kill>:
+SYSCALL(kill)
+     ef0:	b8 06 00 00 00       	mov    $0x6,%eax
+     ef5:	eb 87                	jmp    e7e <dosyscall>
+
+00000ef7 <exec>:
+SYSCALL(exec)
+     ef7:	b8 07 00 00 00       	mov    $0x7,%eax
+     efc:	eb 80                	jmp    e7e <dosyscall>
+
+00000efe <open>:
+SYSCALL(open)
+     efe:	b8 0f 00 00 00       	mov    $0xf,%eax
+     f03:	e9 76 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f08 <mknod>:
+SYSCALL(mknod)
+     f08:	b8 11 00 00 00       	mov    $0x11,%eax
+     f0d:	e9 6c ff ff ff       	jmp    e7e <dosyscall>
+
+00000f12 <unlink>:
+SYSCALL(unlink)
+     f12:	b8 12 00 00 00       	mov    $0x12,%eax
+     f17:	e9 62 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f1c <fstat>:
+SYSCALL(fstat)
+     f1c:	b8 08 00 00 00       	mov    $0x8,%eax
+     f21:	e9 58 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f26 <link>:
+SYSCALL(link)
+     f26:	b8 13 00 00 00       	mov    $0x13,%eax
+     f2b:	e9 4e ff ff ff       	jmp    e7e <dosyscall>
+
+00000f30 <mkdir>:
+SYSCALL(mkdir)
+     f30:	b8 14 00 00 00       	mov    $0x14,%eax
+     f35:	e9 44 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f3a <chdir>:
+SYSCALL(chdir)
+     f3a:	b8 09 00 00 00       	mov    $0x9,%eax
+     f3f:	e9 3a ff ff ff       	jmp    e7e <dosyscall>
+
+00000f44 <dup>:
+SYSCALL(dup)
+     f44:	b8 0a 00 00 00       	mov    $0xa,%eax
+     f49:	e9 30 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f4e <getpid>:
+SYSCALL(getpid)
+     f4e:	b8 0b 00 00 00       	mov    $0xb,%eax
+     f53:	e9 26 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f58 <sbrk>:
+SYSCALL(sbrk)
+     f58:	b8 0c 00 00 00       	mov    $0xc,%eax
+     f5d:	e9 1c ff ff ff       	jmp    e7e <dosyscall>
+
+00000f62 <sleep>:
+SYSCALL(sleep)
+     f62:	b8 0d 00 00 00       	mov    $0xd,%eax
+     f67:	e9 12 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f6c <uptime>:
+SYSCALL(uptime)
+     f6c:	b8 0e 00 00 00       	mov    $0xe,%eax
+     f71:	e9 08 ff ff ff       	jmp    e7e <dosyscall>
+
+00000f76 <symlink>:
+SYSCALL(symlink)
+     f76:	b8 16 00 00 00       	mov    $0x16,%eax
+     f7b:	e9 fe fe ff ff       	jmp    e7e <dosyscall>
+
+00000f80 <readlink>:
+SYSCALL(readlink)
+     f80:	b8 17 00 00 00       	mov    $0x17,%eax
+     f85:	e9 f4 fe ff ff       	jmp    e7e <dosyscall>
+
+00000f8a <fprot>:
+SYSCALL(fprot)
+     f8a:	b8 18 00 00 00       	mov    $0x18,%eax
+     f8f:	e9 ea fe ff ff       	jmp    e7e <dosyscall>
+
+00000f94 <funprot>:
+SYSCALL(funprot)
+     f94:	b8 19 00 00 00       	mov    $0x19,%eax
+     f99:	e9 e0 fe ff ff       	jmp    e7e <dosyscall>
+
+00000f9e <funlock>:
+SYSCALL(funlock)
+     f9e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     fa3:	e9 d6 fe ff ff       	jmp    e7e <dosyscall>
+
+00000fa8 <mmap>:
+SYSCALL(mmap)
+     fa8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     fad:	e9 cc fe ff ff       	jmp    e7e <dosyscall>
+
+00000fb2 <munmap>:
+SYSCALL(munmap)
+     fb2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     fb7:	e9 c2 fe ff ff       	jmp    e7e <dosyscall>
+
+00000fbc <sendfile>:
+SYSCALL(sendfile)
+     fbc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     fc1:	e9 b8 fe ff ff       	jmp    e7e <dosyscall>
+
+00000fc6 <readv>:
+SYSCALL(readv)
+     fc6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     fcb:	e9 ae fe ff ff       	jmp    e7e <dosyscall>
+
+00000fd0 <writev>:
+SYSCALL(writev)
+     fd0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     fd5:	e9 a4 fe ff ff       	jmp    e7e <dosyscall>
+
+00000fda <pread>:
+SYSCALL(pread)
+     fda:	b8 20 00 00 00       	mov    $0x20,%eax
+     fdf:	e9 9a fe ff ff       	jmp    e7e <dosyscall>
+
+00000fe4 <pwrite>:
+SYSCALL(pwrite)
+     fe4:	b8 21 00 00 00       	mov    $0x21,%eax
+     fe9:	e9 90 fe ff ff       	jmp    e7e <dosyscall>
+
+00000fee <lseek>:
+SYSCALL(lseek)
+     fee:	b8 22 00 00 00       	mov    $0x22,%eax
+     ff3:	e9 86 fe ff ff       	jmp    e7e <dosyscall>
+
+00000ff8 <spawn>:
+SYSCALL(spawn)
+     ff8:	b8 23 00 00 00       	mov    $0x23,%eax
+     ffd:	e9 7c fe ff ff       	jmp    e7e <dosyscall>
+
+00001002 <setpriority>:
+SYSCALL(setpriority)
+    1002:	b8 24 00 00 00       	mov    $0x24,%eax
+    1007:	e9 72 fe ff ff       	jmp    e7e <dosyscall>
+
+0000100c <kthread_create>:
+SYSCALL(kthread_create)
+    100c:	b8 25 00 00 00       	mov    $0x25,%eax
+    1011:	e9 68 fe ff ff       	jmp    e7e <dosyscall>
+
+00001016 <kthread_id>:
+SYSCALL(kthread_id)
+    1016:	b8 26 00 00 00       	mov    $0x26,%eax
+    101b:	e9 5e fe ff ff       	jmp    e7e <dosyscall>
+
+00001020 <kthread_exit>:
+SYSCALL(kthread_exit)
+    1020:	b8 27 00 00 00       	mov    $0x27,%eax
+    1025:	e9 54 fe ff ff       	jmp    e7e <dosyscall>
+
+0000102a <kthread_join>:
+SYSCALL(kthread_join)
+    102a:	b8 28 00 00 00       	mov    $0x28,%eax
+    102f:	e9 4a fe ff ff       	jmp    e7e <dosyscall>
+
+00001034 <futex>:
+SYSCALL(futex)
+    1034:	b8 29 00 00 00       	mov    $0x29,%eax
+    1039:	e9 40 fe ff ff       	jmp    e7e <dosyscall>
+
+0000103e <signal>:
+SYSCALL(signal)
+    103e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1043:	e9 36 fe ff ff       	jmp    e7e <dosyscall>
+
+00001048 <alarm>:
+SYSCALL(alarm)
+    1048:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    104d:	e9 2c fe ff ff       	jmp    e7e <dosyscall>
+
+00001052 <usleep>:
+SYSCALL(usleep)
+    1052:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1057:	e9 22 fe ff ff       	jmp    e7e <dosyscall>
+
+0000105c <ioring_setup>:
+SYSCALL(ioring_setup)
+    105c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1061:	e9 18 fe ff ff       	jmp    e7e <dosyscall>
+
+00001066 <ioring_enter>:
+SYSCALL(ioring_enter)
+    1066:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    106b:	e9 0e fe ff ff       	jmp    e7e <dosyscall>
+
+00001070 <getrusage>:
+SYSCALL(getrusage)
+    1070:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1075:	e9 04 fe ff ff       	jmp    e7e <dosyscall>
+
+0000107a <mount>:
+SYSCALL(mount)
+    107a:	b8 30 00 00 00       	mov    $0x30,%eax
+    107f:	e9 fa fd ff ff       	jmp    e7e <dosyscall>
+
+00001084 <getdents>:
+SYSCALL(getdents)
+    1084:	b8 31 00 00 00       	mov    $0x31,%eax
+    1089:	e9 f0 fd ff ff       	jmp    e7e <dosyscall>
+
+0000108e <yield>:
+SYSCALL(yield)
+    108e:	b8 32 00 00 00       	mov    $0x32,%eax
+    1093:	e9 e6 fd ff ff       	jmp    e7e <dosyscall>
+
+00001098 <ncpu>:
+SYSCALL(ncpu)
+    1098:	b8 33 00 00 00       	mov    $0x33,%eax
+    109d:	e9 dc fd ff ff       	jmp    e7e <dosyscall>
+
+000010a2 <fallocate>:
+SYSCALL(fallocate)
+    10a2:	b8 34 00 00 00       	mov    $0x34,%eax
+    10a7:	e9 d2 fd ff ff       	jmp    e7e <dosyscall>
+
+000010ac <ftruncate>:
+SYSCALL(ftruncate)
+    10ac:	b8 35 00 00 00       	mov    $0x35,%eax
+    10b1:	e9 c8 fd ff ff       	jmp    e7e <dosyscall>
+
+000010b6 <fsync>:
+SYSCALL(fsync)
+    10b6:	b8 36 00 00 00       	mov    $0x36,%eax
+    10bb:	e9 be fd ff ff       	jmp    e7e <dosyscall>
+
+000010c0 <fdatasync>:
+SYSCALL(fdatasync)
+    10c0:	b8 37 00 00 00       	mov    $0x37,%eax
+    10c5:	e9 b4 fd ff ff       	jmp    e7e <dosyscall>
+
+000010ca <poll>:
+SYSCALL(poll)
+    10ca:	b8 38 00 00 00       	mov    $0x38,%eax
+    10cf:	e9 aa fd ff ff       	jmp    e7e <dosyscall>
+
+000010d4 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+    10d4:	55                   	push   %ebp
+    10d5:	89 e5                	mov    %esp,%ebp
+    10d7:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+    10da:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dd:	8b 40 04             	mov    0x4(%eax),%eax
+    10e0:	85 c0                	test   %eax,%eax
+    10e2:	7e 1f                	jle    1103 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+    10e4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e7:	8b 50 04             	mov    0x4(%eax),%edx
+    10ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ed:	8d 48 08             	lea    0x8(%eax),%ecx
+    10f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f3:	8b 00                	mov    (%eax),%eax
+    10f5:	83 ec 04             	sub    $0x4,%esp
+    10f8:	52                   	push   %edx
+    10f9:	51                   	push   %ecx
+    10fa:	50                   	push   %eax
+    10fb:	e8 d0 fe ff ff       	call   fd0 <writev>
+    1100:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1103:	8b 45 08             	mov    0x8(%ebp),%eax
+    1106:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+    110d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1110:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+    1117:	00 00 00 
+}
+    111a:	90                   	nop
+    111b:	c9                   	leave
+    111c:	c3                   	ret
+
+0000111d <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+    111d:	55                   	push   %ebp
+    111e:	89 e5                	mov    %esp,%ebp
+    1120:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+    1123:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    1127:	0f 84 94 00 00 00    	je     11c1 <put+0xa4>
+    return;
+  if(o->n > 0){
+    112d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1130:	8b 40 04             	mov    0x4(%eax),%eax
+    1133:	85 c0                	test   %eax,%eax
+    1135:	7e 40                	jle    1177 <put+0x5a>
+    v = &o->iov[o->n-1];
+    1137:	8b 45 08             	mov    0x8(%ebp),%eax
+    113a:	8b 40 04             	mov    0x4(%eax),%eax
+    113d:	83 e8 01             	sub    $0x1,%eax
+    1140:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1147:	8b 45 08             	mov    0x8(%ebp),%eax
+    114a:	01 d0                	add    %edx,%eax
+    114c:	83 c0 08             	add    $0x8,%eax
+    114f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+    1152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1155:	8b 10                	mov    (%eax),%edx
+    1157:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    115a:	8b 40 04             	mov    0x4(%eax),%eax
+    115d:	01 d0                	add    %edx,%eax
+    115f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    1162:	75 13                	jne    1177 <put+0x5a>
+      v->iov_len += n;
+    1164:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1167:	8b 50 04             	mov    0x4(%eax),%edx
+    116a:	8b 45 10             	mov    0x10(%ebp),%eax
+    116d:	01 c2                	add    %eax,%edx
+    116f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1172:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+    1175:	eb 4b                	jmp    11c2 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+    1177:	8b 45 08             	mov    0x8(%ebp),%eax
+    117a:	8b 40 04             	mov    0x4(%eax),%eax
+    117d:	83 f8 10             	cmp    $0x10,%eax
+    1180:	75 0e                	jne    1190 <put+0x73>
+    flush(o);
+    1182:	83 ec 0c             	sub    $0xc,%esp
+    1185:	ff 75 08             	push   0x8(%ebp)
+    1188:	e8 47 ff ff ff       	call   10d4 <flush>
+    118d:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+    1190:	8b 45 08             	mov    0x8(%ebp),%eax
+    1193:	8b 50 04             	mov    0x4(%eax),%edx
+    1196:	8b 45 08             	mov    0x8(%ebp),%eax
+    1199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    119c:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+    11a0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a3:	8b 50 04             	mov    0x4(%eax),%edx
+    11a6:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ac:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+    11b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b3:	8b 40 04             	mov    0x4(%eax),%eax
+    11b6:	8d 50 01             	lea    0x1(%eax),%edx
+    11b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    11bc:	89 50 04             	mov    %edx,0x4(%eax)
+    11bf:	eb 01                	jmp    11c2 <put+0xa5>
+    return;
+    11c1:	90                   	nop
+}
+    11c2:	c9                   	leave
+    11c3:	c3                   	ret
+
+000011c4 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+    11c4:	55                   	push   %ebp
+    11c5:	89 e5                	mov    %esp,%ebp
+    11c7:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+    11ca:	8b 45 08             	mov    0x8(%ebp),%eax
+    11cd:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    11d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11d6:	01 d0                	add    %edx,%eax
+    11d8:	3d 80 00 00 00       	cmp    $0x80,%eax
+    11dd:	77 0b                	ja     11ea <room+0x26>
+    11df:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e2:	8b 40 04             	mov    0x4(%eax),%eax
+    11e5:	83 f8 10             	cmp    $0x10,%eax
+    11e8:	75 0e                	jne    11f8 <room+0x34>
+    flush(o);
+    11ea:	83 ec 0c             	sub    $0xc,%esp
+    11ed:	ff 75 08             	push   0x8(%ebp)
+    11f0:	e8 df fe ff ff       	call   10d4 <flush>
+    11f5:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+    11f8:	8b 45 08             	mov    0x8(%ebp),%eax
+    11fb:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+    1201:	8b 45 08             	mov    0x8(%ebp),%eax
+    1204:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    120a:	01 d0                	add    %edx,%eax
+}
+    120c:	c9                   	leave
+    120d:	c3                   	ret
+
+0000120e <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+    120e:	55                   	push   %ebp
+    120f:	89 e5                	mov    %esp,%ebp
+    1211:	83 ec 28             	sub    $0x28,%esp
+    1214:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1217:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+    121a:	83 ec 08             	sub    $0x8,%esp
+    121d:	6a 01                	push   $0x1
+    121f:	ff 75 08             	push   0x8(%ebp)
+    1222:	e8 9d ff ff ff       	call   11c4 <room>
+    1227:	83 c4 10             	add    $0x10,%esp
+    122a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+    122d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1230:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+    1234:	88 10                	mov    %dl,(%eax)
+  o->used++;
+    1236:	8b 45 08             	mov    0x8(%ebp),%eax
+    1239:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    123f:	8d 50 01             	lea    0x1(%eax),%edx
+    1242:	8b 45 08             	mov    0x8(%ebp),%eax
+    1245:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+    124b:	83 ec 04             	sub    $0x4,%esp
+    124e:	6a 01                	push   $0x1
+    1250:	ff 75 f4             	push   -0xc(%ebp)
+    1253:	ff 75 08             	push   0x8(%ebp)
+    1256:	e8 c2 fe ff ff       	call   111d <put>
+    125b:	83 c4 10             	add    $0x10,%esp
+}
+    125e:	90                   	nop
+    125f:	c9                   	leave
+    1260:	c3                   	ret
+
+00001261 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1261:	55                   	push   %ebp
+    1262:	89 e5                	mov    %esp,%ebp
+    1264:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+    1267:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    126e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1272:	74 17                	je     128b <printint+0x2a>
+    1274:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1278:	79 11                	jns    128b <printint+0x2a>
+    neg = 1;
+    127a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    1281:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1284:	f7 d8                	neg    %eax
+    1286:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1289:	eb 06                	jmp    1291 <printint+0x30>
+  } else {
+    x = xx;
+    128b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    128e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    1291:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1298:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    129b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    129e:	ba 00 00 00 00       	mov    $0x0,%edx
+    12a3:	f7 f1                	div    %ecx
+    12a5:	89 d1                	mov    %edx,%ecx
+    12a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12aa:	8d 50 01             	lea    0x1(%eax),%edx
+    12ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    12b0:	0f b6 91 ac 20 00 00 	movzbl 0x20ac(%ecx),%edx
+    12b7:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    12bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12be:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12c1:	ba 00 00 00 00       	mov    $0x0,%edx
+    12c6:	f7 f1                	div    %ecx
+    12c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    12cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    12cf:	75 c7                	jne    1298 <printint+0x37>
+  if(neg)
+    12d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12d5:	74 0e                	je     12e5 <printint+0x84>
+    buf[i++] = '-';
+    12d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12da:	8d 50 01             	lea    0x1(%eax),%edx
+    12dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    12e0:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+    12e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+    12eb:	83 ec 08             	sub    $0x8,%esp
+    12ee:	ff 75 e8             	push   -0x18(%ebp)
+    12f1:	ff 75 08             	push   0x8(%ebp)
+    12f4:	e8 cb fe ff ff       	call   11c4 <room>
+    12f9:	83 c4 10             	add    $0x10,%esp
+    12fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+    12ff:	eb 1d                	jmp    131e <printint+0xbd>
+    p[n-1-i] = buf[i];
+    1301:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1304:	83 e8 01             	sub    $0x1,%eax
+    1307:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    130a:	89 c2                	mov    %eax,%edx
+    130c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    130f:	01 c2                	add    %eax,%edx
+    1311:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+    1314:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1317:	01 c8                	add    %ecx,%eax
+    1319:	0f b6 00             	movzbl (%eax),%eax
+    131c:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+    131e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    1322:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1326:	79 d9                	jns    1301 <printint+0xa0>
+  o->used += n;
+    1328:	8b 45 08             	mov    0x8(%ebp),%eax
+    132b:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    1331:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1334:	01 c2                	add    %eax,%edx
+    1336:	8b 45 08             	mov    0x8(%ebp),%eax
+    1339:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+    133f:	83 ec 04             	sub    $0x4,%esp
+    1342:	ff 75 e8             	push   -0x18(%ebp)
+    1345:	ff 75 e4             	push   -0x1c(%ebp)
+    1348:	ff 75 08             	push   0x8(%ebp)
+    134b:	e8 cd fd ff ff       	call   111d <put>
+    1350:	83 c4 10             	add    $0x10,%esp
+}
+    1353:	90                   	nop
+    1354:	c9                   	leave
+    1355:	c3                   	ret
+
+00001356 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1356:	55                   	push   %ebp
+    1357:	89 e5                	mov    %esp,%ebp
+    1359:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+    135f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1362:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+    1368:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+    136f:	00 00 00 
+  o.used = 0;
+    1372:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+    1379:	00 00 00 
+  state = 0;
+    137c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1383:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1386:	83 c0 04             	add    $0x4,%eax
+    1389:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+    138c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1393:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    139a:	e9 82 01 00 00       	jmp    1521 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+    139f:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13a5:	01 d0                	add    %edx,%eax
+    13a7:	0f b6 00             	movzbl (%eax),%eax
+    13aa:	0f be c0             	movsbl %al,%eax
+    13ad:	25 ff 00 00 00       	and    $0xff,%eax
+    13b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+    13b5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    13b9:	75 38                	jne    13f3 <printf+0x9d>
+      if(c == '%'){
+    13bb:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    13bf:	0f 85 58 01 00 00    	jne    151d <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+    13c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13c8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    13cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    13ce:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    13d1:	01 ca                	add    %ecx,%edx
+    13d3:	83 ec 04             	sub    $0x4,%esp
+    13d6:	50                   	push   %eax
+    13d7:	52                   	push   %edx
+    13d8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    13de:	50                   	push   %eax
+    13df:	e8 39 fd ff ff       	call   111d <put>
+    13e4:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+    13e7:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+    13ee:	e9 2a 01 00 00       	jmp    151d <printf+0x1c7>
+      }
+    } else if(state == '%'){
+    13f3:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+    13f7:	0f 85 20 01 00 00    	jne    151d <printf+0x1c7>
+      if(c == 'd'){
+    13fd:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+    1401:	75 22                	jne    1425 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+    1403:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1406:	8b 00                	mov    (%eax),%eax
+    1408:	6a 01                	push   $0x1
+    140a:	6a 0a                	push   $0xa
+    140c:	50                   	push   %eax
+    140d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1413:	50                   	push   %eax
+    1414:	e8 48 fe ff ff       	call   1261 <printint>
+    1419:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    141c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    1420:	e9 e8 00 00 00       	jmp    150d <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+    1425:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+    1429:	74 06                	je     1431 <printf+0xdb>
+    142b:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+    142f:	75 22                	jne    1453 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+    1431:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1434:	8b 00                	mov    (%eax),%eax
+    1436:	6a 00                	push   $0x0
+    1438:	6a 10                	push   $0x10
+    143a:	50                   	push   %eax
+    143b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1441:	50                   	push   %eax
+    1442:	e8 1a fe ff ff       	call   1261 <printint>
+    1447:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    144a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    144e:	e9 ba 00 00 00       	jmp    150d <printf+0x1b7>
+      } else if(c == 's'){
+    1453:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+    1457:	75 3f                	jne    1498 <printf+0x142>
+        s = (char*)*ap;
+    1459:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    145c:	8b 00                	mov    (%eax),%eax
+    145e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    1461:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+    1465:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1469:	75 07                	jne    1472 <printf+0x11c>
+          s = "(null)";
+    146b:	c7 45 f4 52 1c 00 00 	movl   $0x1c52,-0xc(%ebp)
+        put(&o, s, strlen(s));
+    1472:	83 ec 0c             	sub    $0xc,%esp
+    1475:	ff 75 f4             	push   -0xc(%ebp)
+    1478:	e8 47 f8 ff ff       	call   cc4 <strlen>
+    147d:	83 c4 10             	add    $0x10,%esp
+    1480:	83 ec 04             	sub    $0x4,%esp
+    1483:	50                   	push   %eax
+    1484:	ff 75 f4             	push   -0xc(%ebp)
+    1487:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    148d:	50                   	push   %eax
+    148e:	e8 8a fc ff ff       	call   111d <put>
+    1493:	83 c4 10             	add    $0x10,%esp
+    1496:	eb 75                	jmp    150d <printf+0x1b7>
+      } else if(c == 'c'){
+    1498:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+    149c:	75 21                	jne    14bf <printf+0x169>
+        putc(&o, *ap);
+    149e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    14a1:	8b 00                	mov    (%eax),%eax
+    14a3:	0f be c0             	movsbl %al,%eax
+    14a6:	83 ec 08             	sub    $0x8,%esp
+    14a9:	50                   	push   %eax
+    14aa:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    14b0:	50                   	push   %eax
+    14b1:	e8 58 fd ff ff       	call   120e <putc>
+    14b6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    14b9:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    14bd:	eb 4e                	jmp    150d <printf+0x1b7>
+      } else if(c == '%'){
+    14bf:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    14c3:	75 1b                	jne    14e0 <printf+0x18a>
+        putc(&o, c);
+    14c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    14c8:	0f be c0             	movsbl %al,%eax
+    14cb:	83 ec 08             	sub    $0x8,%esp
+    14ce:	50                   	push   %eax
+    14cf:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    14d5:	50                   	push   %eax
+    14d6:	e8 33 fd ff ff       	call   120e <putc>
+    14db:	83 c4 10             	add    $0x10,%esp
+    14de:	eb 2d                	jmp    150d <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+    14e0:	83 ec 08             	sub    $0x8,%esp
+    14e3:	6a 25                	push   $0x25
+    14e5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    14eb:	50                   	push   %eax
+    14ec:	e8 1d fd ff ff       	call   120e <putc>
+    14f1:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+    14f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    14f7:	0f be c0             	movsbl %al,%eax
+    14fa:	83 ec 08             	sub    $0x8,%esp
+    14fd:	50                   	push   %eax
+    14fe:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1504:	50                   	push   %eax
+    1505:	e8 04 fd ff ff       	call   120e <putc>
+    150a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    150d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+    1514:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1517:	83 c0 01             	add    $0x1,%eax
+    151a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    151d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1521:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1524:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1527:	01 d0                	add    %edx,%eax
+    1529:	0f b6 00             	movzbl (%eax),%eax
+    152c:	84 c0                	test   %al,%al
+    152e:	0f 85 6b fe ff ff    	jne    139f <printf+0x49>
+    }
+  }
+  if(state == 0)
+    1534:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1538:	75 22                	jne    155c <printf+0x206>
+    put(&o, fmt + start, i - start);
+    153a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    153d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1543:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1546:	01 ca                	add    %ecx,%edx
+    1548:	83 ec 04             	sub    $0x4,%esp
+    154b:	50                   	push   %eax
+    154c:	52                   	push   %edx
+    154d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1553:	50                   	push   %eax
+    1554:	e8 c4 fb ff ff       	call   111d <put>
+    1559:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+    155c:	83 ec 0c             	sub    $0xc,%esp
+    155f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1565:	50                   	push   %eax
+    1566:	e8 69 fb ff ff       	call   10d4 <flush>
+    156b:	83 c4 10             	add    $0x10,%esp
+}
+    156e:	90                   	nop
+    156f:	c9                   	leave
+    1570:	c3                   	ret
+
+00001571 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+    1571:	55                   	push   %ebp
+    1572:	89 e5                	mov    %esp,%ebp
+    1574:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+    1577:	8b 55 08             	mov    0x8(%ebp),%edx
+    157a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    157d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1580:	f0 87 02             	lock xchg %eax,(%edx)
+    1583:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+    1586:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+    1589:	c9                   	leave
+    158a:	c3                   	ret
+
+0000158b <lock>:
+{
+    158b:	55                   	push   %ebp
+    158c:	89 e5                	mov    %esp,%ebp
+    158e:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+    1591:	a1 d4 20 00 00       	mov    0x20d4,%eax
+    1596:	85 c0                	test   %eax,%eax
+    1598:	74 09                	je     15a3 <lock+0x18>
+    159a:	a1 d4 20 00 00       	mov    0x20d4,%eax
+    159f:	ff d0                	call   *%eax
+    15a1:	eb 05                	jmp    15a8 <lock+0x1d>
+    15a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+    15ab:	90                   	nop
+    15ac:	83 ec 08             	sub    $0x8,%esp
+    15af:	6a 01                	push   $0x1
+    15b1:	68 0c 21 00 00       	push   $0x210c
+    15b6:	e8 b6 ff ff ff       	call   1571 <xchg>
+    15bb:	83 c4 10             	add    $0x10,%esp
+    15be:	85 c0                	test   %eax,%eax
+    15c0:	75 ea                	jne    15ac <lock+0x21>
+  return pin;
+    15c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    15c5:	c9                   	leave
+    15c6:	c3                   	ret
+
+000015c7 <unlock>:
+{
+    15c7:	55                   	push   %ebp
+    15c8:	89 e5                	mov    %esp,%ebp
+    15ca:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+    15cd:	6a 00                	push   $0x0
+    15cf:	68 0c 21 00 00       	push   $0x210c
+    15d4:	e8 98 ff ff ff       	call   1571 <xchg>
+    15d9:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+    15dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    15e0:	78 10                	js     15f2 <unlock+0x2b>
+    mallocunpin(pin);
+    15e2:	a1 d8 20 00 00       	mov    0x20d8,%eax
+    15e7:	83 ec 0c             	sub    $0xc,%esp
+    15ea:	ff 75 08             	push   0x8(%ebp)
+    15ed:	ff d0                	call   *%eax
+    15ef:	83 c4 10             	add    $0x10,%esp
+}
+    15f2:	90                   	nop
+    15f3:	c9                   	leave
+    15f4:	c3                   	ret
+
+000015f5 <sizeclass>:
+{
+    15f5:	55                   	push   %ebp
+    15f6:	89 e5                	mov    %esp,%ebp
+    15f8:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+    15fb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    1602:	eb 1c                	jmp    1620 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+    1604:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1607:	ba 02 00 00 00       	mov    $0x2,%edx
+    160c:	89 c1                	mov    %eax,%ecx
+    160e:	d3 e2                	shl    %cl,%edx
+    1610:	89 d0                	mov    %edx,%eax
+    1612:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1615:	72 05                	jb     161c <sizeclass+0x27>
+      return c;
+    1617:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    161a:	eb 0f                	jmp    162b <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+    161c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1620:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+    1624:	7e de                	jle    1604 <sizeclass+0xf>
+  return -1;
+    1626:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    162b:	c9                   	leave
+    162c:	c3                   	ret
+
+0000162d <bigfree>:
+{
+    162d:	55                   	push   %ebp
+    162e:	89 e5                	mov    %esp,%ebp
+    1630:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1633:	a1 e4 20 00 00       	mov    0x20e4,%eax
+    1638:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    163b:	eb 24                	jmp    1661 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    163d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1640:	8b 00                	mov    (%eax),%eax
+    1642:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1645:	72 12                	jb     1659 <bigfree+0x2c>
+    1647:	8b 45 08             	mov    0x8(%ebp),%eax
+    164a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    164d:	72 24                	jb     1673 <bigfree+0x46>
+    164f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1652:	8b 00                	mov    (%eax),%eax
+    1654:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1657:	72 1a                	jb     1673 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1659:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    165c:	8b 00                	mov    (%eax),%eax
+    165e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1661:	8b 45 08             	mov    0x8(%ebp),%eax
+    1664:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1667:	73 d4                	jae    163d <bigfree+0x10>
+    1669:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    166c:	8b 00                	mov    (%eax),%eax
+    166e:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1671:	73 ca                	jae    163d <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+    1673:	8b 45 08             	mov    0x8(%ebp),%eax
+    1676:	8b 40 04             	mov    0x4(%eax),%eax
+    1679:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1680:	8b 45 08             	mov    0x8(%ebp),%eax
+    1683:	01 c2                	add    %eax,%edx
+    1685:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1688:	8b 00                	mov    (%eax),%eax
+    168a:	39 c2                	cmp    %eax,%edx
+    168c:	75 24                	jne    16b2 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+    168e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1691:	8b 50 04             	mov    0x4(%eax),%edx
+    1694:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1697:	8b 00                	mov    (%eax),%eax
+    1699:	8b 40 04             	mov    0x4(%eax),%eax
+    169c:	01 c2                	add    %eax,%edx
+    169e:	8b 45 08             	mov    0x8(%ebp),%eax
+    16a1:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16a7:	8b 00                	mov    (%eax),%eax
+    16a9:	8b 10                	mov    (%eax),%edx
+    16ab:	8b 45 08             	mov    0x8(%ebp),%eax
+    16ae:	89 10                	mov    %edx,(%eax)
+    16b0:	eb 0a                	jmp    16bc <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+    16b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16b5:	8b 10                	mov    (%eax),%edx
+    16b7:	8b 45 08             	mov    0x8(%ebp),%eax
+    16ba:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    16bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16bf:	8b 40 04             	mov    0x4(%eax),%eax
+    16c2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    16c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16cc:	01 d0                	add    %edx,%eax
+    16ce:	39 45 08             	cmp    %eax,0x8(%ebp)
+    16d1:	75 20                	jne    16f3 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+    16d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16d6:	8b 50 04             	mov    0x4(%eax),%edx
+    16d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    16dc:	8b 40 04             	mov    0x4(%eax),%eax
+    16df:	01 c2                	add    %eax,%edx
+    16e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16e4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    16e7:	8b 45 08             	mov    0x8(%ebp),%eax
+    16ea:	8b 10                	mov    (%eax),%edx
+    16ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16ef:	89 10                	mov    %edx,(%eax)
+    16f1:	eb 08                	jmp    16fb <bigfree+0xce>
+    p->s.ptr = bp;
+    16f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16f6:	8b 55 08             	mov    0x8(%ebp),%edx
+    16f9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    16fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16fe:	a3 e4 20 00 00       	mov    %eax,0x20e4
+}
+    1703:	90                   	nop
+    1704:	c9                   	leave
+    1705:	c3                   	ret
+
+00001706 <free>:
+{
+    1706:	55                   	push   %ebp
+    1707:	89 e5                	mov    %esp,%ebp
+    1709:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    170c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1710:	74 68                	je     177a <free+0x74>
+  bp = (Header*)ap - 1;
+    1712:	8b 45 08             	mov    0x8(%ebp),%eax
+    1715:	83 e8 08             	sub    $0x8,%eax
+    1718:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    171b:	e8 6b fe ff ff       	call   158b <lock>
+    1720:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    1723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1726:	8b 40 04             	mov    0x4(%eax),%eax
+    1729:	83 ec 0c             	sub    $0xc,%esp
+    172c:	50                   	push   %eax
+    172d:	e8 c3 fe ff ff       	call   15f5 <sizeclass>
+    1732:	83 c4 10             	add    $0x10,%esp
+    1735:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1738:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    173c:	78 1e                	js     175c <free+0x56>
+    bp->s.ptr = classfree[c];
+    173e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1741:	8b 14 85 e8 20 00 00 	mov    0x20e8(,%eax,4),%edx
+    1748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    174b:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    174d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1750:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1753:	89 14 85 e8 20 00 00 	mov    %edx,0x20e8(,%eax,4)
+    175a:	eb 0e                	jmp    176a <free+0x64>
+    bigfree(bp);
+    175c:	83 ec 0c             	sub    $0xc,%esp
+    175f:	ff 75 f4             	push   -0xc(%ebp)
+    1762:	e8 c6 fe ff ff       	call   162d <bigfree>
+    1767:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    176a:	83 ec 0c             	sub    $0xc,%esp
+    176d:	ff 75 f0             	push   -0x10(%ebp)
+    1770:	e8 52 fe ff ff       	call   15c7 <unlock>
+    1775:	83 c4 10             	add    $0x10,%esp
+    1778:	eb 01                	jmp    177b <free+0x75>
+    return;
+    177a:	90                   	nop
+}
+    177b:	c9                   	leave
+    177c:	c3                   	ret
+
+0000177d <morecore>:
+{
+    177d:	55                   	push   %ebp
+    177e:	89 e5                	mov    %esp,%ebp
+    1780:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    1783:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    178a:	77 07                	ja     1793 <morecore+0x16>
+    nu = 4096;
+    178c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    1793:	8b 45 08             	mov    0x8(%ebp),%eax
+    1796:	c1 e0 03             	shl    $0x3,%eax
+    1799:	83 ec 0c             	sub    $0xc,%esp
+    179c:	50                   	push   %eax
+    179d:	e8 b6 f7 ff ff       	call   f58 <sbrk>
+    17a2:	83 c4 10             	add    $0x10,%esp
+    17a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    17a8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    17ac:	75 07                	jne    17b5 <morecore+0x38>
+    return 0;
+    17ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    17b3:	eb 22                	jmp    17d7 <morecore+0x5a>
+  hp = (Header*)p;
+    17b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    17bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17be:	8b 55 08             	mov    0x8(%ebp),%edx
+    17c1:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    17c4:	83 ec 0c             	sub    $0xc,%esp
+    17c7:	ff 75 f0             	push   -0x10(%ebp)
+    17ca:	e8 5e fe ff ff       	call   162d <bigfree>
+    17cf:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    17d2:	a1 e4 20 00 00       	mov    0x20e4,%eax
+}
+    17d7:	c9                   	leave
+    17d8:	c3                   	ret
+
+000017d9 <bigalloc>:
+{
+    17d9:	55                   	push   %ebp
+    17da:	89 e5                	mov    %esp,%ebp
+    17dc:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    17df:	a1 e4 20 00 00       	mov    0x20e4,%eax
+    17e4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    17e7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    17eb:	75 23                	jne    1810 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    17ed:	c7 45 f0 dc 20 00 00 	movl   $0x20dc,-0x10(%ebp)
+    17f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17f7:	a3 e4 20 00 00       	mov    %eax,0x20e4
+    17fc:	a1 e4 20 00 00       	mov    0x20e4,%eax
+    1801:	a3 dc 20 00 00       	mov    %eax,0x20dc
+    base.s.size = 0;
+    1806:	c7 05 e0 20 00 00 00 	movl   $0x0,0x20e0
+    180d:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1810:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1813:	8b 00                	mov    (%eax),%eax
+    1815:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    181b:	8b 40 04             	mov    0x4(%eax),%eax
+    181e:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1821:	72 4a                	jb     186d <bigalloc+0x94>
+      if(p->s.size == nunits)
+    1823:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1826:	8b 40 04             	mov    0x4(%eax),%eax
+    1829:	39 45 08             	cmp    %eax,0x8(%ebp)
+    182c:	75 0c                	jne    183a <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    182e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1831:	8b 10                	mov    (%eax),%edx
+    1833:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1836:	89 10                	mov    %edx,(%eax)
+    1838:	eb 26                	jmp    1860 <bigalloc+0x87>
+        p->s.size -= nunits;
+    183a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    183d:	8b 40 04             	mov    0x4(%eax),%eax
+    1840:	2b 45 08             	sub    0x8(%ebp),%eax
+    1843:	89 c2                	mov    %eax,%edx
+    1845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1848:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    184b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    184e:	8b 40 04             	mov    0x4(%eax),%eax
+    1851:	c1 e0 03             	shl    $0x3,%eax
+    1854:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1857:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    185a:	8b 55 08             	mov    0x8(%ebp),%edx
+    185d:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1860:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1863:	a3 e4 20 00 00       	mov    %eax,0x20e4
+      return p;
+    1868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    186b:	eb 3b                	jmp    18a8 <bigalloc+0xcf>
+    if(p == freep)
+    186d:	a1 e4 20 00 00       	mov    0x20e4,%eax
+    1872:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1875:	75 1e                	jne    1895 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1877:	83 ec 0c             	sub    $0xc,%esp
+    187a:	ff 75 08             	push   0x8(%ebp)
+    187d:	e8 fb fe ff ff       	call   177d <morecore>
+    1882:	83 c4 10             	add    $0x10,%esp
+    1885:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1888:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    188c:	75 07                	jne    1895 <bigalloc+0xbc>
+        return 0;
+    188e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1893:	eb 13                	jmp    18a8 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1898:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    189b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    189e:	8b 00                	mov    (%eax),%eax
+    18a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    18a3:	e9 70 ff ff ff       	jmp    1818 <bigalloc+0x3f>
+}
+    18a8:	c9                   	leave
+    18a9:	c3                   	ret
+
+000018aa <alloc>:
+alloc(uint nbytes)
+{
+    18aa:	55                   	push   %ebp
+    18ab:	89 e5                	mov    %esp,%ebp
+    18ad:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    18b3:	83 c0 07             	add    $0x7,%eax
+    18b6:	c1 e8 03             	shr    $0x3,%eax
+    18b9:	83 c0 01             	add    $0x1,%eax
+    18bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    18bf:	ff 75 f4             	push   -0xc(%ebp)
+    18c2:	e8 2e fd ff ff       	call   15f5 <sizeclass>
+    18c7:	83 c4 04             	add    $0x4,%esp
+    18ca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    18cd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    18d1:	79 2c                	jns    18ff <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    18d3:	83 ec 0c             	sub    $0xc,%esp
+    18d6:	ff 75 f4             	push   -0xc(%ebp)
+    18d9:	e8 fb fe ff ff       	call   17d9 <bigalloc>
+    18de:	83 c4 10             	add    $0x10,%esp
+    18e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    18e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    18e8:	75 0a                	jne    18f4 <alloc+0x4a>
+      return 0;
+    18ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    18ef:	e9 c8 00 00 00       	jmp    19bc <alloc+0x112>
+    return (void*)(p + 1);
+    18f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18f7:	83 c0 08             	add    $0x8,%eax
+    18fa:	e9 bd 00 00 00       	jmp    19bc <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    18ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1902:	8b 04 85 e8 20 00 00 	mov    0x20e8(,%eax,4),%eax
+    1909:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    190c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1910:	74 1a                	je     192c <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1912:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1915:	8b 10                	mov    (%eax),%edx
+    1917:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    191a:	89 14 85 e8 20 00 00 	mov    %edx,0x20e8(,%eax,4)
+    return (void*)(p + 1);
+    1921:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1924:	83 c0 08             	add    $0x8,%eax
+    1927:	e9 90 00 00 00       	jmp    19bc <alloc+0x112>
+  }
+  nunits = 2 << c;
+    192c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    192f:	ba 02 00 00 00       	mov    $0x2,%edx
+    1934:	89 c1                	mov    %eax,%ecx
+    1936:	d3 e2                	shl    %cl,%edx
+    1938:	89 d0                	mov    %edx,%eax
+    193a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    193d:	a1 04 21 00 00       	mov    0x2104,%eax
+    1942:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1945:	c1 e2 03             	shl    $0x3,%edx
+    1948:	01 d0                	add    %edx,%eax
+    194a:	8b 15 08 21 00 00    	mov    0x2108,%edx
+    1950:	39 c2                	cmp    %eax,%edx
+    1952:	73 3f                	jae    1993 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1954:	83 ec 0c             	sub    $0xc,%esp
+    1957:	68 00 08 00 00       	push   $0x800
+    195c:	e8 78 fe ff ff       	call   17d9 <bigalloc>
+    1961:	83 c4 10             	add    $0x10,%esp
+    1964:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1967:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    196b:	75 07                	jne    1974 <alloc+0xca>
+      return 0;
+    196d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1972:	eb 48                	jmp    19bc <alloc+0x112>
+    bump = (char*)p;
+    1974:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1977:	a3 04 21 00 00       	mov    %eax,0x2104
+    bumpend = (char*)(p + p->s.size);
+    197c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    197f:	8b 40 04             	mov    0x4(%eax),%eax
+    1982:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1989:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    198c:	01 d0                	add    %edx,%eax
+    198e:	a3 08 21 00 00       	mov    %eax,0x2108
+  }
+  p = (Header*)bump;
+    1993:	a1 04 21 00 00       	mov    0x2104,%eax
+    1998:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    199b:	a1 04 21 00 00       	mov    0x2104,%eax
+    19a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    19a3:	c1 e2 03             	shl    $0x3,%edx
+    19a6:	01 d0                	add    %edx,%eax
+    19a8:	a3 04 21 00 00       	mov    %eax,0x2104
+  p->s.size = nunits;
+    19ad:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    19b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    19b3:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    19b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    19b9:	83 c0 08             	add    $0x8,%eax
+}
+    19bc:	c9                   	leave
+    19bd:	c3                   	ret
+
+000019be <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19be:	55                   	push   %ebp
+    19bf:	89 e5                	mov    %esp,%ebp
+    19c1:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    19c4:	e8 c2 fb ff ff       	call   158b <lock>
+    19c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    19cc:	83 ec 0c             	sub    $0xc,%esp
+    19cf:	ff 75 08             	push   0x8(%ebp)
+    19d2:	e8 d3 fe ff ff       	call   18aa <alloc>
+    19d7:	83 c4 10             	add    $0x10,%esp
+    19da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    19dd:	83 ec 0c             	sub    $0xc,%esp
+    19e0:	ff 75 f4             	push   -0xc(%ebp)
+    19e3:	e8 df fb ff ff       	call   15c7 <unlock>
+    19e8:	83 c4 10             	add    $0x10,%esp
+  return p;
+    19eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    19ee:	c9                   	leave
+    19ef:	c3                   	ret
@@ -3,6 +3,7 @@
 #include "fcntl.h"
 #include "stat.h"
 #include "fs.h"
+#include "dent.h"
 
 struct {
   int follow;                                         // boolean: 0 or 1
@@ -34,16 +35,13 @@ basename(char *path)
   return p;
 }
 
+static void visit(char*, struct stat*, int);
+
 static void
 search(char *path, int following_symlink)
 {
   int fd;
   struct stat st;
-  int skip = 0;
-  struct dirent de;
-  int cur_entry, i;
-  char buf[MAXPATH];
-  char *p;
 
   fd = open(path, following_symlink ? 0 : O_IGNLINK);
 
@@ -63,8 +61,23 @@ search(char *path, int following_symlink)
   }
 
   close(fd);
+  visit(path, &st, following_symlink);
+}
 
-  switch(st.type){
+// Report path, which st describes, if it matches, and descend
+// into it if it is a directory.
+static void
+visit(char *path, struct stat *st, int following_symlink)
+{
+  int fd;
+  int skip = 0;
+  struct dent d[4];
+  struct stat cst;
+  int i, n;
+  char buf[MAXPATH];
+  char *p;
+
+  switch(st->type){
     case T_DIR:
       if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
         skip = 1;
@@ -72,7 +85,7 @@ search(char *path, int following_symlink)
       if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_DIR)){
         skip = 1;
       }
-      if(!skip && !(st.size >= search_options.min_size && st.size <= search_options.max_size)){
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
         skip = 1;
       }
 
@@ -87,31 +100,26 @@ search(char *path, int following_symlink)
         p++;
       }
 
-      cur_entry = 0;
-      for(;;){
-        fd = open(path, following_symlink ? 0 : O_IGNLINK);
-        if(fd < 0) {
-          printf(1, "Error opening file: %s\n", path);
-          exit();
-        }
-        // Not possible to seek through files, so use read to skip forward
-        for(i = 0; i < cur_entry - 1; i++){
-          read(fd, &de, sizeof(de));
-        }
-        if(read(fd, &de, sizeof(de)) == sizeof(de)){
-          close(fd);
-          if(de.inum != 0 && strcmp(de.name, ".") != 0 && strcmp(de.name, "..") != 0){
-            memmove(p, de.name, DIRSIZ);
-            p[DIRSIZ] = '\0';
-
-            search(buf, 0);
-          }
-        } else {
-          close(fd);
-          break;
+      fd = open(path, following_symlink ? 0 : O_IGNLINK);
+      if(fd < 0) {
+        printf(1, "Error opening file: %s\n", path);
+        exit();
+      }
+      // The entries come with the type and size of what they
+      // name, so only directories need opening.
+      while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+        for(i = 0; i < n; i++){
+          if(strcmp(d[i].name, ".") == 0 || strcmp(d[i].name, "..") == 0)
+            continue;
+          strcpy(p, d[i].name);
+          cst.type = d[i].type;
+          cst.ino = d[i].ino;
+          cst.nlink = d[i].nlink;
+          cst.size = d[i].size;
+          visit(buf, &cst, 0);
         }
-        cur_entry++;
       }
+      close(fd);
       return;
     case T_FILE:
       if(!skip && search_options.name_exact && strcmp(basename(path), search_options.name_exact) != 0){
@@ -120,7 +128,7 @@ search(char *path, int following_symlink)
       if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_FILE)){
         skip = 1;
       }
-      if(!skip && !(st.size >= search_options.min_size && st.size <= search_options.max_size)){
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
         skip = 1;
       }
 
@@ -135,7 +143,7 @@ search(char *path, int following_symlink)
       if(!skip && search_options.type != FT_ANY){
         skip = 1;
       }
-      if(!skip && !(st.size >= search_options.min_size && st.size <= search_options.max_size)){
+      if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
         skip = 1;
       }
 
@@ -153,7 +161,7 @@ search(char *path, int following_symlink)
         if(!skip && !(search_options.type == FT_ANY || search_options.type == FT_SYMLINK)){
           skip = 1;
         }
-        if(!skip && !(st.size >= search_options.min_size && st.size <= search_options.max_size)){
+        if(!skip && !(st->size >= search_options.min_size && st->size <= search_options.max_size)){
           skip = 1;
         }
 
@@ -19,11 +19,18 @@
 #include "buf.h"
 #include "fs.h"
 #include "file.h"
+#include "dent.h"
+#include "kstat.h"
 
 #define MAX_SYMLINK_LOOPS 16
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define BPP (PGSIZE / BSIZE)  // blocks per page
 static void itrunc(struct inode*);
+static int iuninline(struct inode*);
+static void dcpurge(uint, uint);
+static void dcinit(void);
+static void dcdroplink(struct inode*);
 
 // Read the super block.
 void
@@ -36,45 +43,287 @@ readsb(int dev, struct superblock *sb)
   brelse(bp);
 }
 
+// Set up the disks under the file system on dev as its super
+// block says, before anything but the super block is read.
+// The kernel must be built for the block size mkfs used.
+void
+fsinit(int dev)
+{
+  struct superblock sb;
+
+  readsb(dev, &sb);
+  if((sb.bsize ? sb.bsize : 512) != BSIZE)
+    panic("fsinit: file system has another block size");
+  if(sb.stripe)
+    idestripe(dev, sb.stripe);
+  if(sb.nswap)
+    swapinit(dev, sb.size, sb.nswap);
+}
+
 // Zero a block.
 static void
 bzero(int dev, int bno)
 {
   struct buf *bp;
   
-  bp = bread(dev, bno);
-  memset(bp->data, 0, BSIZE);
+  bp = bnew(dev, bno);
   log_write(bp);
   brelse(bp);
 }
 
 // Blocks. 
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// Block allocation works from an in-memory copy of each disk's
+// free bitmap, loaded on first use.  A bit is set there if the
+// block is in use on disk or reserved for an in-core inode, and
+// a count of free blocks per bitmap block lets the search skip
+// full ones.  Allocation searches forward from a goal block,
+// normally the one after the file's previous block, and reserves
+// up to PREALLOC blocks following the one it returns so that the
+// file's next blocks come out contiguous.  Reservations live only
+// in memory, so a crash cannot leak them.  bmem.lock protects
+// the copies and all reservations; the on-disk bitmap blocks are
+// changed only after the copy, with their buffers held busy.
+//
+// The same load also builds a map of the inodes in use, so
+// that ialloc() need not scan the inode blocks.
+
+#define NBMEM 2          // disks with an in-memory bitmap
+#define NBMPAGE 16       // pages of bitmap per disk
+#define BMPBITS (PGSIZE*8)
+#define PREALLOC 8
+
+struct bmem {
+  uint dev;
+  int state;             // 0 unused, 1 loading, 2 ready
+  uint size;             // allocatable blocks: all but the log
+  uint rotor;            // goal for allocations without one
+  uchar *map[NBMPAGE];
+  uint nfree[NBMPAGE*BMPBITS/BPB];  // free blocks per bitmap block
+  uint ninodes;
+  uint irotor;           // where ialloc starts looking
+  uchar *imap;           // bit set: inode in use
+};
+
+static struct {
+  struct spinlock lock;
+  struct bmem m[NBMEM];
+} bmem;
+
+static int
+bmtest(struct bmem *m, uint b)
+{
+  return m->map[b/BMPBITS][b%BMPBITS/8] & (1 << (b%8));
+}
+
+static void
+bmset(struct bmem *m, uint b)
+{
+  m->map[b/BMPBITS][b%BMPBITS/8] |= 1 << (b%8);
+  m->nfree[b/BPB]--;
+}
+
+static void
+bmclear(struct bmem *m, uint b)
+{
+  m->map[b/BMPBITS][b%BMPBITS/8] &= ~(1 << (b%8));
+  m->nfree[b/BPB]++;
+}
+
+// Read dev's bitmap into m.  Caller has set m->state to 1.
+static void
+bmload(struct bmem *m, uint dev)
 {
-  int b, bi, m;
-  struct buf *bp;
   struct superblock sb;
+  struct buf *bp;
+  uint b, g;
+  int i;
 
-  bp = 0;
   readsb(dev, &sb);
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb.ninodes));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
+  m->size = sb.size - sb.nlog;
+  if(m->size > NBMPAGE*BMPBITS)
+    panic("bmload: disk too big");
+  for(i = 0; i*BMPBITS < m->size; i++)
+    if((m->map[i] = (uchar*)kalloc()) == 0)
+      panic("bmload: out of memory");
+  for(g = 0; g*BPB < m->size; g++){
+    bp = bread(dev, BBLOCK(g*BPB, sb.ninodes));
+    memmove(m->map[g*BPB/BMPBITS] + g*BPB%BMPBITS/8, bp->data, BSIZE);
+    brelse(bp);
+    m->nfree[g] = 0;
+    for(b = g*BPB; b < (g+1)*BPB; b++){
+      if(b >= m->size)
+        m->map[b/BMPBITS][b%BMPBITS/8] |= 1 << (b%8);
+      else if(!bmtest(m, b))
+        m->nfree[g]++;
+    }
+  }
+  m->rotor = 0;
+
+  m->ninodes = sb.ninodes;
+  if(m->ninodes > BMPBITS)
+    panic("bmload: too many inodes");
+  if((m->imap = (uchar*)kalloc()) == 0)
+    panic("bmload: out of memory");
+  memset(m->imap, 0, PGSIZE);
+  m->imap[0] = 1;  // inode 0 does not exist
+  bp = 0;
+  for(b = 1; b < m->ninodes; b++){
+    if(bp == 0 || IBLOCK(b) != bp->sector){
+      if(bp)
         brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+      bp = bread(dev, IBLOCK(b));
     }
+    if(((struct dinode*)bp->data + b%IPB)->type != 0)
+      m->imap[b/8] |= 1 << (b%8);
+  }
+  if(bp)
     brelse(bp);
+  m->irotor = 1;
+}
+
+// Return dev's in-memory bitmap, loading it if need be.
+static struct bmem*
+bmget(uint dev)
+{
+  struct bmem *m, *empty;
+
+  acquire(&bmem.lock);
+ loop:
+  empty = 0;
+  for(m = bmem.m; m < bmem.m+NBMEM; m++){
+    if(m->state != 0 && m->dev == dev){
+      if(m->state == 1){
+        sleep(m, &bmem.lock);
+        goto loop;
+      }
+      release(&bmem.lock);
+      return m;
+    }
+    if(m->state == 0 && empty == 0)
+      empty = m;
+  }
+  if(empty == 0)
+    panic("bmget: too many disks");
+  m = empty;
+  m->dev = dev;
+  m->state = 1;
+  release(&bmem.lock);
+
+  bmload(m, dev);
+
+  acquire(&bmem.lock);
+  m->state = 2;
+  wakeup(m);
+  release(&bmem.lock);
+  return m;
+}
+
+// Find a block free in m at or after goal, wrapping around.
+// Returns -1 if there is none.  Caller must hold bmem.lock.
+static int
+bmfind(struct bmem *m, uint goal)
+{
+  uint b, n;
+
+  b = goal < m->size ? goal : 0;
+  for(n = 0; n < m->size; ){
+    if(m->nfree[b/BPB] == 0){
+      n += BPB - b%BPB;
+      b += BPB - b%BPB;
+    } else if(b%8 == 0 && m->map[b/BMPBITS][b%BMPBITS/8] == 0xff){
+      n += 8;
+      b += 8;
+    } else if(!bmtest(m, b)){
+      return b;
+    } else {
+      n++;
+      b++;
+    }
+    if(b >= m->size)
+      b = 0;
+  }
+  return -1;
+}
+
+// Give back the blocks reserved for ip and not used.
+// Caller must hold bmem.lock.
+static void
+bunreserve1(struct bmem *m, struct inode *ip)
+{
+  for(; ip->palen > 0; ip->palen--)
+    bmclear(m, ip->pastart++);
+}
+
+static void
+bunreserve(struct inode *ip)
+{
+  struct bmem *m;
+
+  if(ip->palen == 0)
+    return;
+  m = bmget(ip->dev);
+  acquire(&bmem.lock);
+  bunreserve1(m, ip);
+  release(&bmem.lock);
+}
+
+// Allocate a disk block for inode ip, as close after goal as
+// possible, or exactly goal with BA_EXACT (returning 0 if goal
+// is taken).  A goal of 0 means none: continue the reserved run
+// if ip has one, else use the disk's rotor.  The block is zeroed
+// unless it is for file data (BA_DATA): nothing reads data blocks
+// past the end of a file, and writei zeroes a block when it writes
+// the first bytes into it.
+#define BA_EXACT 0x1
+#define BA_DATA  0x2
+
+static uint
+balloc(struct inode *ip, uint goal, int flags)
+{
+  struct bmem *m;
+  struct buf *bp;
+  struct superblock sb;
+  int b, bi, n;
+
+  m = bmget(ip->dev);
+  acquire(&bmem.lock);
+  if(goal == 0)
+    goal = ip->palen > 0 ? ip->pastart : m->rotor;
+  if(ip->palen > 0 && ip->pastart == goal){
+    // Next block of the reserved run.
+    b = ip->pastart++;
+    ip->palen--;
+  } else {
+    bunreserve1(m, ip);
+    if(flags & BA_EXACT){
+      if(goal >= m->size || bmtest(m, goal)){
+        release(&bmem.lock);
+        return 0;
+      }
+      b = goal;
+    } else if((b = bmfind(m, goal)) < 0)
+      panic("balloc: out of blocks");
+    bmset(m, b);
+    for(n = 0; n < PREALLOC-1 && b+1+n < m->size && !bmtest(m, b+1+n); n++)
+      bmset(m, b+1+n);
+    ip->pastart = b + 1;
+    ip->palen = n;
+    m->rotor = b + 1 + n;
   }
-  panic("balloc: out of blocks");
+  release(&bmem.lock);
+
+  readsb(ip->dev, &sb);
+  bp = bread(ip->dev, BBLOCK(b, sb.ninodes));
+  bi = b % BPB;
+  if(bp->data[bi/8] & (1 << (bi % 8)))
+    panic("balloc: block in use");
+  bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+  log_write(bp);
+  brelse(bp);
+  if(!(flags & BA_DATA))
+    bzero(ip->dev, b);
+  return b;
 }
 
 // Free a disk block.
@@ -83,6 +332,7 @@ bfree(int dev, uint b)
 {
   struct buf *bp;
   struct superblock sb;
+  struct bmem *bm;
   int bi, m;
 
   readsb(dev, &sb);
@@ -94,6 +344,11 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+
+  bm = bmget(dev);
+  acquire(&bmem.lock);
+  bmclear(bm, b);
+  release(&bmem.lock);
 }
 
 // Inodes.
@@ -121,24 +376,29 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, iput() frees if
 //   the link count has fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to an entry in the inode cache (open
 //   files and current directories). iget() to find or
 //   create a cache entry and increment its ref, iput()
-//   to decrement ref.
+//   to decrement ref.  An entry whose ref is zero stays
+//   cached, on an LRU list, until iget() recycles it.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when the I_VALID bit
 //   is set in ip->flags. ilock() reads the inode from
-//   the disk and sets I_VALID, while iput() clears
-//   I_VALID if ip->ref has fallen to zero.
+//   the disk and sets I_VALID, and it stays set until
+//   the entry is freed or recycled.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
 //   has first locked the inode. The I_BUSY flag indicates
 //   that the inode is locked. ilock() sets I_BUSY,
-//   while iunlock clears it.
+//   while iunlock clears it.  Code that only examines an
+//   inode and its content may instead lock it shared with
+//   ilockshared(), which counts holders in ip->readers;
+//   any number of them can hold it at once, but not along
+//   with an ilock() holder.  A waiting ilock() holds off new
+//   shared holders, so that writers are not starved.
 //
 // Thus a typical sequence is:
 //   ip = iget(dev, inum)
@@ -158,152 +418,240 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 
-struct {
-  struct spinlock lock;
-  struct inode inode[NINODE];
-} icache;
+// The cache hashes entries on (dev, inum).  Entries live in
+// chunks of one kalloc() page each; iinit() sizes the cache from
+// free memory, or from ninode= on the boot command line, and it
+// grows by a chunk whenever every entry is referenced.  Entries
+// with inum 0 hold no inode.  icache.lock protects all of it.
+#define NIHASH 127
 
-/**************/
-/*** TASK 2 ***/
-/**************/
+struct ichunk {
+  struct ichunk *next;
+  struct inode inode[];
+};
 
-#define NINODES 200
+#define IPCHUNK ((PGSIZE - sizeof(struct ichunk)) / sizeof(struct inode))
 
 struct {
   struct spinlock lock;
-  int pids[NINODES][NPROC];
-} unlocked_inodes;
+  struct ichunk *chunks;
+  int ninode;
+  struct inode lru;  // head of ref == 0 entries, least recent first
+  struct inode *hash[NIHASH];
+} icache;
 
-void unlock_inode(struct inode* ip)
+static struct inode**
+ihash(uint dev, uint inum)
 {
-  int i;
-  acquire(&unlocked_inodes.lock);
-  for(i = 0; i < NPROC; i++){
-    if(unlocked_inodes.pids[ip->inum][i] == proc->pid){
-      // The inode is already unlocked for this pid
-      release(&unlocked_inodes.lock);
-      return;
-    }
-  }
+  return &icache.hash[(dev * 31 + inum) % NIHASH];
+}
 
-  // The inode is not already unlocked, look for the first free slot
-  for(i = 0; i < NPROC; i++){
-    if(unlocked_inodes.pids[ip->inum][i] == 0){
-      // Found a free slot
-      unlocked_inodes.pids[ip->inum][i] = proc->pid;
-      release(&unlocked_inodes.lock);
-      return;
-    }
-  }
-  panic("unlock_inodes: No free pid slots found");
+static void
+lruremove(struct inode *ip)
+{
+  ip->lprev->lnext = ip->lnext;
+  ip->lnext->lprev = ip->lprev;
+}
+
+// Put ip on the LRU list: at the tail if it is worth keeping,
+// else at the head to be reused first.
+static void
+lruinsert(struct inode *ip, int keep)
+{
+  struct inode *at;
+
+  at = keep ? &icache.lru : icache.lru.lnext;
+  ip->lnext = at;
+  ip->lprev = at->lprev;
+  at->lprev->lnext = ip;
+  at->lprev = ip;
 }
 
-void free_inode_locks(int pid)
+static void
+iunhash(struct inode *ip)
 {
-  int i, j;
+  struct inode **pp;
 
-  acquire(&unlocked_inodes.lock);
-  for(i = 0; i < NINODES; i++){
-    for(j = 0; j < NPROC; j++){
-      if(unlocked_inodes.pids[i][j] == pid){
-        unlocked_inodes.pids[i][j] = 0;
-      }
+  for(pp = ihash(ip->dev, ip->inum); *pp; pp = &(*pp)->hnext){
+    if(*pp == ip){
+      *pp = ip->hnext;
+      ip->inum = 0;
+      return;
     }
   }
-  release(&unlocked_inodes.lock);
+  panic("iunhash");
 }
 
-int
-is_inode_unlocked(struct inode* ip)
+// Add a chunk of empty entries to the cache.
+// Caller must hold icache.lock, except during iinit.
+static int
+igrow(void)
 {
+  struct ichunk *c;
   int i;
 
-  acquire(&unlocked_inodes.lock);
+  if((c = (struct ichunk*)kalloc()) == 0)
+    return -1;
+  memset(c, 0, PGSIZE);
+  for(i = 0; i < IPCHUNK; i++)
+    lruinsert(&c->inode[i], 0);
+  c->next = icache.chunks;
+  icache.chunks = c;
+  icache.ninode += IPCHUNK;
+  return 0;
+}
 
-  for(i = 0; i < NPROC; i++){
-    if(unlocked_inodes.pids[ip->inum][i] == proc->pid){
-      release(&unlocked_inodes.lock);
-      return 1;
-    }
-  }
+/**************/
+/*** TASK 2 ***/
+/**************/
 
-  release(&unlocked_inodes.lock);
+// Each process keeps the protected files it has unlocked in a
+// short table in its struct proc, which fork copies and exit
+// discards.  Only the process itself touches its table.
+
+// Unlock ip for the current process.  Return -1 if the table is full.
+int
+unlock_inode(struct inode* ip)
+{
+  if(is_inode_unlocked(ip))
+    return 0;
+  if(proc->nunlocked == NUNLOCK)
+    return -1;
+  proc->unlocked[proc->nunlocked].dev = ip->dev;
+  proc->unlocked[proc->nunlocked].inum = ip->inum;
+  proc->nunlocked++;
   return 0;
 }
 
-void
-fork_pids(int old_pid, int new_pid)
+int
+is_inode_unlocked(struct inode* ip)
 {
-  int i, j, k;
-
-  acquire(&unlocked_inodes.lock);
-
-  for(i = 0; i < NINODES; i++){
-    for(j = 0; j < NPROC; j++){
-      if(unlocked_inodes.pids[i][j] == old_pid){
-        for(k = 0; k < NPROC; k++){
-          if(unlocked_inodes.pids[i][k] == 0){
-            unlocked_inodes.pids[i][k] = new_pid;
-            break;
-          }
-        }
-        if(k == NPROC){
-          panic("fork_pids: No free pid slots found");
-        }
-        break;
-      }
-    }
-  }
+  int i;
 
-  release(&unlocked_inodes.lock);
+  for(i = 0; i < proc->nunlocked; i++)
+    if(proc->unlocked[i].inum == ip->inum && proc->unlocked[i].dev == ip->dev)
+      return 1;
+  return 0;
 }
 
 void
 iinit(void)
 {
+  int n;
+
   initlock(&icache.lock, "icache");
-/*vvv  TASK 2    vvv*/
-  initlock(&unlocked_inodes.lock, "unlocked_inodes");
-/*^^^^^^^^^^^^^^^^^^*/
+  icache.lru.lnext = icache.lru.lprev = &icache.lru;
+  n = bootarg("ninode", NINODE);
+  if(n <= 0)
+    n = kfreepages() / ICACHEFRAC * IPCHUNK;
+  if(n < NINODEMIN)
+    n = NINODEMIN;
+  while(icache.ninode < n)
+    if(igrow() < 0)
+      panic("iinit: no memory for inodes");
+  cprintf("icache: %d inodes\n", icache.ninode);
+  dcinit();
+
+  initlock(&bmem.lock, "bmem");
 }
 
 static struct inode* iget(uint dev, uint inum);
 
 //PAGEBREAK!
 // Allocate a new inode with the given type on device dev.
-// A free inode has a type of zero.
+// A free inode has a type of zero; the in-memory inode map
+// says which ones are, starting from where the last search
+// stopped.  A tmpfs inode has only the in-memory copy, valid
+// from the start.
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  int inum, n;
   struct buf *bp;
   struct dinode *dip;
-  struct superblock sb;
+  struct bmem *m;
+  struct inode *ip;
 
-  readsb(dev, &sb);
+  if(dev >= TMPDEV){
+    ip = iget(dev, tmpinum(dev));
+    ip->type = type;
+    ip->major = 0;
+    ip->minor = 0;
+    ip->nlink = 0;
+    ip->size = 0;
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->indirect2 = 0;
+    memset(ip->password, 0, sizeof(ip->password));
+    ip->nhash = 0;
+    acquire(&icache.lock);
+    ip->flags |= I_VALID;
+    release(&icache.lock);
+    return ip;
+  }
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
-      brelse(bp);
-      return iget(dev, inum);
-    }
-    brelse(bp);
+  m = bmget(dev);
+  acquire(&bmem.lock);
+  inum = m->irotor;
+  for(n = 0; n < m->ninodes; n++, inum++){
+    if(inum >= m->ninodes)
+      inum = 1;
+    if((m->imap[inum/8] & (1 << (inum%8))) == 0)
+      break;
   }
-  panic("ialloc: no inodes");
+  if(n == m->ninodes)
+    panic("ialloc: no inodes");
+  m->imap[inum/8] |= 1 << (inum%8);
+  m->irotor = inum + 1;
+  release(&bmem.lock);
+
+  bp = bread(dev, IBLOCK(inum));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  if(dip->type != 0)
+    panic("ialloc: inode in use");
+  memset(dip, 0, sizeof(*dip));
+  dip->type = type;
+  if(type == T_FILE || type == T_SYMLINK)
+    dip->flags = DI_INLINE;
+  log_write(bp);   // mark it allocated on the disk
+  brelse(bp);
+  return iget(dev, inum);
+}
+
+// Mark inode inum of dev free in the inode map, after
+// iput has cleared its type.
+static void
+ifree(uint dev, uint inum)
+{
+  struct bmem *m;
+
+  m = bmget(dev);
+  acquire(&bmem.lock);
+  m->imap[inum/8] &= ~(1 << (inum%8));
+  release(&bmem.lock);
 }
 
-// Copy a modified in-memory inode to disk.
+// Copy a modified in-memory inode to disk.  A tmpfs inode, which
+// has no disk copy, instead holds a reference to itself while it
+// has links, so that iput does not let it go.
 void
 iupdate(struct inode *ip)
 {
   struct buf *bp;
   struct dinode *dip;
 
+  if(ip->dev >= TMPDEV){
+    acquire(&icache.lock);
+    if(ip->nlink > 0 && !(ip->flags & I_PINNED)){
+      ip->flags |= I_PINNED;
+      ip->ref++;
+    } else if(ip->nlink == 0 && (ip->flags & I_PINNED)){
+      ip->flags &= ~I_PINNED;
+      ip->ref--;
+    }
+    release(&icache.lock);
+    return;
+  }
+
   bp = bread(ip->dev, IBLOCK(ip->inum));
   dip = (struct dinode*)bp->data + ip->inum%IPB;
   dip->type = ip->type;
@@ -318,8 +666,11 @@ iupdate(struct inode *ip)
 /*vvv  TASK 2    vvv*/
   memmove(dip->password, ip->password, sizeof(ip->password));
 /*^^^^^^^^^^^^^^^^^^*/
+  dip->nhash = ip->nhash;
+  dip->flags = (ip->flags & I_INLINE) ? DI_INLINE : 0;
   log_write(bp);
   brelse(bp);
+  ip->tid = log_tid();
 }
 
 // Find the inode with number inum on device dev
@@ -328,36 +679,77 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **hp;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  hp = ihash(dev, inum);
+  for(ip = *hp; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lruremove(ip);
       release(&icache.lock);
+      kstatinc(KS_IHIT);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used entry, or grow
+  // the cache if every entry is in use.
+  if(icache.lru.lnext == &icache.lru && igrow() < 0)
     panic("iget: no inodes");
+  ip = icache.lru.lnext;
+  lruremove(ip);
+  if(ip->inum != 0){
+    pcpurge(ip);
+    xdrop(ip);
+    iunhash(ip);
+  }
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->flags = 0;
+  ip->tid = ip->dtid = log_tid();  // for all we know
+  ip->hnext = *hp;
+  *hp = ip;
   release(&icache.lock);
+  kstatinc(KS_IMISS);
 
   return ip;
 }
 
+// Report on the cache for /stats/icache: entries, the ones that
+// are referenced, and the ones that still hold an inode; and on
+// the directory name cache.
+void
+istats(struct report *r)
+{
+  struct inode *ip;
+  uint hit, miss;
+  int nfree, nempty;
+
+  hit = kstatsum(KS_IHIT);
+  miss = kstatsum(KS_IMISS);
+  nfree = nempty = 0;
+  acquire(&icache.lock);
+  for(ip = icache.lru.lnext; ip != &icache.lru; ip = ip->lnext){
+    nfree++;
+    if(ip->inum == 0)
+      nempty++;
+  }
+  report(r, "hits", hit);
+  report(r, "misses", miss);
+  reportpct(r, "hit%", hit, hit + miss);
+  report(r, "inodes", icache.ninode);
+  report(r, "inuse", icache.ninode - nfree);
+  report(r, "cached", icache.ninode - nempty);
+  release(&icache.lock);
+  report(r, "namehits", kstatsum(KS_DHIT));
+  report(r, "namemisses", kstatsum(KS_DMISS));
+}
+
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
 struct inode*
@@ -369,24 +761,18 @@ idup(struct inode *ip)
   return ip;
 }
 
-// Lock the given inode.
-// Reads the inode from disk if necessary.
-void
-ilock(struct inode *ip)
+// Read ip in from disk if it is not valid.  Caller holds I_BUSY.
+static void
+iload(struct inode *ip)
 {
   struct buf *bp;
   struct dinode *dip;
-
-  if(ip == 0 || ip->ref < 1)
-    panic("ilock");
-
-  acquire(&icache.lock);
-  while(ip->flags & I_BUSY)
-    sleep(ip, &icache.lock);
-  ip->flags |= I_BUSY;
-  release(&icache.lock);
+  struct superblock sb;
 
   if(!(ip->flags & I_VALID)){
+    readsb(ip->dev, &sb);
+    if(sb.features & FS_EXTENTS)
+      ip->flags |= I_EXTENTS;
     bp = bread(ip->dev, IBLOCK(ip->inum));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     ip->type = dip->type;
@@ -401,6 +787,9 @@ ilock(struct inode *ip)
 /*vvv  TASK 2    vvv*/
     memmove(ip->password, dip->password, sizeof(ip->password));
 /*^^^^^^^^^^^^^^^^^^*/
+    ip->nhash = dip->nhash;
+    if(dip->flags & DI_INLINE)
+      ip->flags |= I_INLINE;
     brelse(bp);
     ip->flags |= I_VALID;
     if(ip->type == 0)
@@ -408,16 +797,71 @@ ilock(struct inode *ip)
   }
 }
 
-// Unlock the given inode.
+// Lock the given inode exclusively.
+// Reads the inode from disk if necessary.
+void
+ilock(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilock");
+
+  acquire(&icache.lock);
+  if((ip->flags & I_BUSY) || ip->readers > 0){
+    ip->xwait++;
+    while((ip->flags & I_BUSY) || ip->readers > 0)
+      sleep(&ip->xwait, &icache.lock);
+    ip->xwait--;
+  }
+  ip->flags |= I_BUSY;
+  release(&icache.lock);
+
+  iload(ip);
+}
+
+// Lock the given inode shared, for reading it and its content.
+// Reads the inode from disk if necessary.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquire(&icache.lock);
+  while((ip->flags & I_BUSY) || ip->xwait > 0)
+    sleep(ip, &icache.lock);
+  if(!(ip->flags & I_VALID)){
+    // The first holder reads it in, with others kept out.
+    ip->flags |= I_BUSY;
+    release(&icache.lock);
+    iload(ip);
+    acquire(&icache.lock);
+    ip->flags &= ~I_BUSY;
+    wakeup(ip);
+  }
+  ip->readers++;
+  release(&icache.lock);
+}
+
+// Unlock the given inode, locked exclusive or shared.  A waiting
+// exclusive locker goes first once the inode is free; otherwise
+// all the waiting shared lockers go together.
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+  if(ip == 0 || !((ip->flags & I_BUSY) || ip->readers > 0) || ip->ref < 1)
     panic("iunlock");
 
   acquire(&icache.lock);
-  ip->flags &= ~I_BUSY;
-  wakeup(ip);
+  if(ip->flags & I_BUSY)
+    ip->flags &= ~I_BUSY;
+  else
+    ip->readers--;
+  if(ip->readers == 0){
+    if(ip->xwait > 0)
+      wakeone(&ip->xwait);
+    else
+      wakeup(ip);
+  }
   release(&icache.lock);
 }
 
@@ -437,13 +881,24 @@ iput(struct inode *ip)
     ip->flags |= I_BUSY;
     release(&icache.lock);
     itrunc(ip);
+    if(ip->type == T_DIR)
+      dcpurge(ip->dev, ip->inum);
     ip->type = 0;
     iupdate(ip);
+    if(ip->dev < TMPDEV)
+      ifree(ip->dev, ip->inum);
     acquire(&icache.lock);
     ip->flags = 0;
     wakeup(ip);
   }
   ip->ref--;
+  if(ip->ref == 0){
+    bunreserve(ip);
+    // Keep it cached, unless it no longer exists.
+    if(!(ip->flags & I_VALID))
+      iunhash(ip);
+    lruinsert(ip, ip->inum != 0);
+  }
   release(&icache.lock);
 }
 
@@ -461,33 +916,131 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are 
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  On an FS_EXTENTS file
+// system, ip->addrs[] hold extents instead; see emap.
+
+// Return the disk block address of the nth block of an
+// extent-mapped inode.  If there is no such block, allocate
+// one, growing the last extent when the disk block after it is
+// free.  Returns 0 if that needs a new extent and all are used.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent *e, *last;
+  struct buf *bp;
+  uint lbn, addr, goal;
+  int i, lastinbp;
+
+  bp = 0;
+  last = 0;
+  lastinbp = 0;
+  lbn = 0;
+  e = (struct extent*)ip->addrs;
+  for(i = 0; i < NIEXTENT + NBEXTENT; i++, e++){
+    if(i == NIEXTENT){
+      if(ip->addrs[NDIRECT] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      e = (struct extent*)bp->data;
+    }
+    if(e->len == 0)
+      break;
+    if(bn < lbn + e->len){
+      addr = e->start + (bn - lbn);
+      if(bp)
+        brelse(bp);
+      return addr;
+    }
+    lbn += e->len;
+    last = e;
+    lastinbp = bp != 0;
+  }
+  if(bn != lbn)
+    panic("emap: hole");
+
+  goal = last ? last->start + last->len : 0;
+  if(i == NIEXTENT + NBEXTENT){
+    // Out of extents: only growing the last one will do.
+    if(last && (addr = balloc(ip, goal, BA_EXACT|BA_DATA)) != 0){
+      last->len++;
+      if(lastinbp)
+        log_write(bp);
+    } else
+      addr = 0;
+  } else if(last && (addr = balloc(ip, goal, BA_DATA)) == goal){
+    last->len++;
+    if(lastinbp)
+      log_write(bp);
+  } else {
+    if(last == 0)
+      addr = balloc(ip, 0, BA_DATA);
+    if(i == NIEXTENT){
+      ip->addrs[NDIRECT] = balloc(ip, 0, 0);
+      bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      e = (struct extent*)bp->data;
+    }
+    e->start = addr;
+    e->len = 1;
+    if(bp)
+      log_write(bp);
+  }
+  if(bp)
+    brelse(bp);
+  return addr;
+}
+
+// Remember the NBMAP mappings of the aligned group around
+// a[i] of an indirect block, which maps file block fbn, so the
+// next lookups near fbn need not read the indirect blocks again.
+// Only an exclusive holder of ip's lock changes the window;
+// shared holders just use it.
+static void
+bmremember(struct inode *ip, uint fbn, uint *a, uint i)
+{
+  uint j;
+
+  if(!(ip->flags & I_BUSY))
+    return;
+  j = i & ~(NBMAP-1);
+  ip->bmbase = fbn - (i - j);
+  memmove(ip->bmaddr, a + j, sizeof(ip->bmaddr));
+  ip->flags |= I_BMAP;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
+// Returns 0 if the file cannot grow that far.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, fbn;
   struct buf *bp;
 
+  if(ip->flags & I_EXTENTS)
+    return emap(ip, bn);
+
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip, bn > 0 && ip->addrs[bn-1] ? ip->addrs[bn-1] + 1 : 0, BA_DATA);
     return addr;
   }
+  if((ip->flags & I_BMAP) && bn - ip->bmbase < NBMAP &&
+     (addr = ip->bmaddr[bn - ip->bmbase]) != 0)
+    return addr;
+  fbn = bn;
   bn -= NDIRECT;
 
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+      ip->addrs[NDIRECT] = addr = balloc(ip, 0, 0);
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      a[bn] = addr = balloc(ip, 0, BA_DATA);
       log_write(bp);
     }
+    bmremember(ip, fbn, a, bn);
     brelse(bp);
     return addr;
   }
@@ -497,11 +1050,11 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT * NINDIRECT){
     // Load double indirect block, allocating if necessary.
     if((addr = ip->indirect2) == 0)
-      ip->indirect2 = addr = balloc(ip->dev);
+      ip->indirect2 = addr = balloc(ip, 0, 0);
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn / NINDIRECT]) == 0){
-      a[bn / NINDIRECT] = addr = balloc(ip->dev);
+      a[bn / NINDIRECT] = addr = balloc(ip, 0, 0);
       log_write(bp);
     }
     brelse(bp);
@@ -509,9 +1062,10 @@ bmap(struct inode *ip, uint bn)
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn % NINDIRECT]) == 0){
-      a[bn % NINDIRECT] = addr = balloc(ip->dev);
+      a[bn % NINDIRECT] = addr = balloc(ip, 0, BA_DATA);
       log_write(bp);
     }
+    bmremember(ip, fbn, a, bn % NINDIRECT);
     brelse(bp);
     return addr;
   }
@@ -520,63 +1074,364 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
-// Truncate inode (discard contents).
-// Only called when the inode has no links
-// to it (no directory entries referring to it)
-// and has no in-memory reference to it (is
-// not an open file or current directory).
+// Free ip's blocks from file block nb on, and the indirect and
+// extent blocks that no longer map anything.
 static void
-itrunc(struct inode *ip)
+ifreefrom(struct inode *ip, uint nb)
 {
-  int i, j;
+  int i, j, dirty;
   struct buf *bp, *bp2;
-  uint *a, *a2;
+  uint *a, *a2, lbn, keep, first;
+  struct extent *e;
+
+  if(ip->flags & I_EXTENTS){
+    bp = 0;
+    dirty = 0;
+    first = 0;
+    lbn = 0;
+    e = (struct extent*)ip->addrs;
+    for(i = 0; i < NIEXTENT + NBEXTENT; i++, e++){
+      if(i == NIEXTENT){
+        if(ip->addrs[NDIRECT] == 0)
+          break;
+        first = lbn;  // first block the extent block maps
+        bp = bread(ip->dev, ip->addrs[NDIRECT]);
+        e = (struct extent*)bp->data;
+      }
+      if(e->len == 0)
+        break;
+      keep = nb > lbn ? min(nb - lbn, e->len) : 0;
+      lbn += e->len;
+      for(j = keep; j < e->len; j++)
+        bfree(ip->dev, e->start + j);
+      if(keep < e->len){
+        e->len = keep;
+        if(keep == 0)
+          e->start = 0;
+        if(bp)
+          dirty = 1;
+      }
+    }
+    if(bp){
+      if(nb > first && dirty)
+        log_write(bp);
+      brelse(bp);
+      if(nb <= first){
+        bfree(ip->dev, ip->addrs[NDIRECT]);
+        ip->addrs[NDIRECT] = 0;
+      }
+    }
+    return;
+  }
 
-  for(i = 0; i < NDIRECT; i++){
+  for(i = nb; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
       ip->addrs[i] = 0;
     }
   }
-  
-  if(ip->addrs[NDIRECT]){
+
+  first = nb > NDIRECT ? nb - NDIRECT : 0;
+  if(ip->addrs[NDIRECT] && first < NINDIRECT){
     bp = bread(ip->dev, ip->addrs[NDIRECT]);
     a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
+    for(j = first; j < NINDIRECT; j++){
+      if(a[j]){
         bfree(ip->dev, a[j]);
+        a[j] = 0;
+      }
     }
+    if(first > 0)
+      log_write(bp);
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+    if(first == 0){
+      bfree(ip->dev, ip->addrs[NDIRECT]);
+      ip->addrs[NDIRECT] = 0;
+    }
   }
 
-/*vvv  TASK 1.1  vvv*/
+  first = nb > NDIRECT + NINDIRECT ? nb - NDIRECT - NINDIRECT : 0;
   if(ip->indirect2){
     bp = bread(ip->dev, ip->indirect2);
     a = (uint*)bp->data;
-    for(i = 0; i < NINDIRECT; i++){
-      if(a[i]){
-        bp2 = bread(ip->dev, a[i]);
-        a2 = (uint*)bp2->data;
-        for(j = 0; j < NINDIRECT; j++){
-          if(a2[j])
-            bfree(ip->dev, a2[j]);
+    for(i = first / NINDIRECT; i < NINDIRECT; i++){
+      if(a[i] == 0)
+        continue;
+      bp2 = bread(ip->dev, a[i]);
+      a2 = (uint*)bp2->data;
+      keep = i == first / NINDIRECT ? first % NINDIRECT : 0;
+      for(j = keep; j < NINDIRECT; j++){
+        if(a2[j]){
+          bfree(ip->dev, a2[j]);
+          a2[j] = 0;
         }
-        brelse(bp2);
+      }
+      if(keep > 0)
+        log_write(bp2);
+      brelse(bp2);
+      if(keep == 0){
         bfree(ip->dev, a[i]);
+        a[i] = 0;
       }
     }
+    if(first > 0)
+      log_write(bp);
     brelse(bp);
-    bfree(ip->dev, ip->indirect2);
-    ip->indirect2 = 0;
+    if(first == 0){
+      bfree(ip->dev, ip->indirect2);
+      ip->indirect2 = 0;
+    }
   }
-/*^^^^^^^^^^^^^^^^^^*/
+}
 
+// Truncate inode (discard contents).
+// Only called when the inode has no links
+// to it (no directory entries referring to it)
+// and has no in-memory reference to it (is
+// not an open file or current directory).
+static void
+itrunc(struct inode *ip)
+{
+  int n;
+
+  ip->flags &= ~I_BMAP;
+  bunreserve(ip);
+  n = pcpurge(ip);
+  xdrop(ip);
+  if(ip->dev >= TMPDEV){
+    tmpfree(n);
+    ip->size = 0;
+    return;
+  }
+  if(ip->flags & I_INLINE){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->indirect2 = 0;
+  } else
+    ifreefrom(ip, 0);
   ip->size = 0;
   iupdate(ip);
 }
 
+// Cut regular file ip down to size bytes, freeing the blocks past
+// them, fallocated ones included.  Returns -1 if the file is
+// smaller, or if pages past size are mapped.  Caller must hold ip
+// locked, and be in a transaction unless ip is on a tmpfs.
+int
+itruncate(struct inode *ip, uint size)
+{
+  struct buf *bp;
+  int n;
+
+  if(ip->type != T_FILE || size > ip->size)
+    return -1;
+  if((n = pctrunc(ip, size)) < 0)
+    return -1;
+  ip->flags &= ~I_BMAP;
+  bunreserve(ip);
+  xdrop(ip);
+  if(ip->dev >= TMPDEV){
+    tmpfree(n);
+    ip->size = size;
+    return 0;
+  }
+  if(ip->flags & I_INLINE){
+    memset((char*)ip->addrs + size, 0, NINLINE - size);
+  } else {
+    ifreefrom(ip, (size + BSIZE - 1) / BSIZE);
+    // Bytes past the end of a block must read as zero.
+    if(size % BSIZE){
+      bp = bread(ip->dev, bmap(ip, size / BSIZE));
+      memset(bp->data + size % BSIZE, 0, BSIZE - size % BSIZE);
+      log_write(bp);
+      brelse(bp);
+    }
+  }
+  ip->size = size;
+  iupdate(ip);
+  ip->dtid = ip->tid;
+  return 0;
+}
+
+// Give ip disk blocks for its bytes up to end, from file block *bn
+// on, advancing *bn, and stopping before the transaction could log
+// more than max blocks.  Data blocks are not logged, but the
+// bitmap blocks, indirect blocks and inode that allocating them
+// changes are.  The blocks stay past ip->size, unwritten: they are
+// not zeroed, nothing reads them, and writei clears each one when
+// it first writes to it.  On a tmpfs this does nothing.  Returns 0,
+// or -1 if the file cannot grow that far.  Caller must hold ip
+// locked and be in a transaction.
+int
+ifalloc(struct inode *ip, uint *bn, uint end, int max)
+{
+  struct superblock sb;
+  uint nb, addr, bmb, last;
+  int need, first;
+
+  if(ip->type != T_FILE || end > MAXFILE*BSIZE)
+    return -1;
+  if(ip->dev >= TMPDEV){
+    *bn = (end + BSIZE - 1) / BSIZE;
+    return 0;
+  }
+  if(ip->flags & I_INLINE){
+    if(end <= NINLINE){
+      *bn = (end + BSIZE - 1) / BSIZE;
+      return 0;
+    }
+    if(iuninline(ip) < 0)
+      return -1;
+    max -= 2;  // its data block and bitmap block
+  }
+  nb = (end + BSIZE - 1) / BSIZE;
+  if(*bn < ip->size / BSIZE)
+    *bn = ip->size / BSIZE;  // all mapped before that
+  readsb(ip->dev, &sb);
+  max -= 3;  // the inode, the doubly-indirect block and its bitmap block
+  last = 0;
+  first = 1;
+  for(; *bn < nb; (*bn)++){
+    // Count a new indirect or extent block, and its bitmap block,
+    // for each run of NINDIRECT, then one more bitmap block.
+    need = 1;
+    if(first || (*bn >= NDIRECT && (*bn - NDIRECT) % NINDIRECT == 0))
+      need += 2;
+    if(max < need)
+      break;
+    max -= need - 1;
+    if((addr = bmap(ip, *bn)) == 0)
+      return -1;
+    first = 0;
+    if((bmb = BBLOCK(addr, sb.ninodes)) != last){
+      last = bmb;
+      max--;
+    }
+  }
+  iupdate(ip);
+  return 0;
+}
+
+// Start reading blocks [bn, end) of ip into the buffer cache
+// without waiting for them.  Blocks past the end of the file,
+// and blocks of pages already in the page cache, are skipped.
+// Caller must hold ip locked.
+void
+ireadahead(struct inode *ip, uint bn, uint end)
+{
+  uint nb;
+
+  if(ip->type == T_DEV || (ip->flags & I_INLINE) || ip->dev >= TMPDEV)
+    return;
+  nb = (ip->size + BSIZE - 1) / BSIZE;
+  if(end > nb)
+    end = nb;
+  for(; bn < end; bn++){
+    if(ip->type == T_FILE && pccached(ip, bn / BPP)){
+      bn = (bn / BPP + 1) * BPP - 1;  // rest of the page
+      continue;
+    }
+    breadahead(ip->dev, bmap(ip, bn));
+  }
+}
+
+// Return the page cache page holding page pgno of regular file
+// ip, reading it in if necessary, with a reference held.  The part
+// past the end of the file is zero.  Returns 0 if the page cache
+// has no page to spare.  Caller must hold ip locked, perhaps shared,
+// so pcfill() picks one caller to read a missing page in.
+// Any inode of a tmpfs keeps its data this way; see tmppage.
+struct page*
+ipage(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+  struct buf *bp;
+  uint bn, first, end;
+
+  if(ip->dev >= TMPDEV)
+    return tmppage(ip, pgno);
+  if(ip->type != T_FILE || (ip->flags & I_INLINE))
+    panic("ipage");
+  if((pg = pcget(ip, pgno)) == 0 || pg->valid || !pcfill(pg))
+    return pg;
+
+  first = pgno * BPP;
+  end = min(first + BPP, (ip->size + BSIZE - 1) / BSIZE);
+  if(end > first + 1)
+    for(bn = first; bn < end; bn++)
+      breadahead(ip->dev, bmap(ip, bn));
+  memset(pg->data, 0, PGSIZE);
+  for(bn = first; bn < end; bn++){
+    bp = bread(ip->dev, bmap(ip, bn));
+    memmove(pg->data + (bn - first)*BSIZE, bp->data, BSIZE);
+    brelse(bp);
+  }
+  pcfilled(pg);
+  return pg;
+}
+
+// Fill in the type, link count and size of inode inum of dev in
+// d, from the inode cache if it has the inode, else from the disk
+// copy, without locking the inode or bringing it into the cache.
+// The inode may be changing; d is a snapshot.
+static void
+dentstat(uint dev, uint inum, struct dent *d)
+{
+  struct inode *ip;
+  struct buf *bp;
+  struct dinode *dip;
+
+  acquire(&icache.lock);
+  for(ip = *ihash(dev, inum); ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum && (ip->flags & I_VALID)){
+      d->type = ip->type;
+      d->nlink = ip->nlink;
+      d->size = ip->size;
+      release(&icache.lock);
+      return;
+    }
+  }
+  release(&icache.lock);
+
+  if(dev >= TMPDEV){
+    // Every tmpfs inode is cached; this one must have just gone.
+    d->type = 0;
+    d->nlink = 0;
+    d->size = 0;
+    return;
+  }
+  bp = bread(dev, IBLOCK(inum));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  d->type = dip->type;
+  d->nlink = dip->nlink;
+  d->size = dip->size;
+  brelse(bp);
+}
+
+// Fill d with up to n entries of directory dp, from offset *off
+// on, and advance *off past them.  Return the number filled; 0
+// at the end of the directory.  Caller must hold dp locked.
+int
+dirlist(struct inode *dp, uint *off, struct dent *d, int n)
+{
+  struct dirent de;
+  int i;
+
+  if(dp->type != T_DIR)
+    return -1;
+  for(i = 0; i < n && *off + sizeof(de) <= dp->size; *off += sizeof(de)){
+    if(readi(dp, (char*)&de, *off, sizeof(de)) != sizeof(de))
+      return -1;
+    if(de.inum == 0)
+      continue;
+    d[i].ino = de.inum;
+    memmove(d[i].name, de.name, DIRSIZ);
+    d[i].name[DIRSIZ] = 0;
+    dentstat(dp->dev, de.inum, &d[i]);
+    i++;
+  }
+  return i;
+}
+
 // Copy stat information from inode.
 void
 stati(struct inode *ip, struct stat *st)
@@ -588,60 +1443,164 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Copy n bytes at off of ip from the buffer cache.
+static void
+readblocks(struct inode *ip, char *dst, uint off, uint n)
+{
+  uint tot, m;
+  struct buf *bp;
+
+  // Queue all the blocks at once, so the disk driver can
+  // merge runs of contiguous ones into single commands.
+  if(n > 0 && (off+n-1)/BSIZE > off/BSIZE)
+    ireadahead(ip, off/BSIZE, (off+n-1)/BSIZE + 1);
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+    memmove(dst, bp->data + off%BSIZE, m);
+    brelse(bp);
+  }
+}
+
 //PAGEBREAK!
 // Read data from inode.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
   uint tot, m;
-  struct buf *bp;
+  struct page *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
       return -1;
-    return devsw[ip->major].read(ip, dst, n);
+    return devsw[ip->major].read(ip, dst, off, n);
   }
 
   if(off > ip->size || off + n < off)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  if(ip->flags & I_INLINE){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
 
-  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
-    brelse(bp);
+  // Regular files are read a page at a time through the page
+  // cache, or straight from the buffer cache if it is out of pages.
+  // Everything on a tmpfs is in the page cache.
+  if(ip->type == T_FILE || ip->dev >= TMPDEV){
+    for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      if((pg = ipage(ip, off/PGSIZE)) == 0){
+        if(ip->dev >= TMPDEV)
+          return -1;
+        readblocks(ip, dst, off, m);
+        continue;
+      }
+      memmove(dst, pg->data + off%PGSIZE, m);
+      pcput(pg);
+    }
+    return n;
   }
+  readblocks(ip, dst, off, n);
   return n;
 }
 
+// Move the inline data of ip to a data block, so that the
+// file can grow past NINLINE bytes.
+static int
+iuninline(struct inode *ip)
+{
+  char data[NINLINE];
+  struct buf *bp;
+  uint addr;
+
+  memmove(data, ip->addrs, NINLINE);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  ip->indirect2 = 0;
+  ip->flags &= ~I_INLINE;
+  if(ip->size > 0){
+    if((addr = bmap(ip, 0)) == 0){
+      memmove(ip->addrs, data, NINLINE);
+      ip->flags |= I_INLINE;
+      return -1;
+    }
+    bp = bnew(ip->dev, addr);
+    memmove(bp->data, data, ip->size);
+    log_write(bp);
+    brelse(bp);
+  }
+  iupdate(ip);
+  return 0;
+}
+
 // PAGEBREAK!
 // Write data to inode.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
+  struct page *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
       return -1;
-    return devsw[ip->major].write(ip, src, n);
+    return devsw[ip->major].write(ip, src, off, n);
   }
 
   if(off > ip->size || off + n < off)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->type == T_SYMLINK)
+    dcdroplink(ip);
+  xdrop(ip);
+  if(ip->flags & I_INLINE){
+    if(off + n <= NINLINE){
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      ip->dtid = ip->tid;
+      return n;
+    }
+    if(iuninline(ip) < 0)
+      return -1;
+  }
 
-  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+  // A tmpfs is written straight into its pages.
+  for(tot=0; ip->dev >= TMPDEV && tot<n; tot+=m, off+=m, src+=m){
+    if((pg = ipage(ip, off/PGSIZE)) == 0)
+      break;
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    memmove(pg->data + off%PGSIZE, src, m);
+    pcput(pg);
+  }
+
+  for(; ip->dev < TMPDEV && tot<n; tot+=m, off+=m, src+=m){
+    if((addr = bmap(ip, off/BSIZE)) == 0)
+      break;
+    // A block wholly past the end holds nothing yet.
+    if(off - off%BSIZE >= ip->size)
+      bp = bnew(ip->dev, addr);
+    else
+      bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
+    if(ip->type == T_FILE && (pg = pclookup(ip, off/PGSIZE)) != 0){
+      memmove(pg->data + off%PGSIZE, src, m);
+      pcput(pg);
+    }
     log_write(bp);
     brelse(bp);
   }
+  if(tot == 0 && n > 0)
+    return -1;
+  n = tot;
+  if(ip->dev < TMPDEV)
+    ip->dtid = log_tid();
 
   if(n > 0 && off > ip->size){
     ip->size = off;
@@ -650,6 +1609,93 @@ writei(struct inode *ip, char *src, uint off, uint n)
   return n;
 }
 
+// O_DIRECT I/O: move n bytes of ip at off to or from user memory
+// at va straight between the disk and the user's pages, around
+// the buffer and page caches.  off, n and va must be multiples of
+// BSIZE.  A block the buffer cache holds is copied there instead,
+// since the cached copy may be newer than the disk's, and a page
+// cache page is kept up to date on writes, as writei does.
+// Caller must hold ip locked, and be in a transaction to write.
+int
+idirect(struct inode *ip, char *va, uint off, uint n, int write)
+{
+  struct buf *db, *bp;
+  struct page *pg;
+  uint tot, addr, bn;
+  char *p, *ka;
+  int nd;
+
+  if(ip->flags & I_INLINE){
+    if(!write)
+      return readi(ip, va, off, n);
+    if(off + n <= NINLINE)
+      return writei(ip, va, off, n);
+  }
+  if(ip->type != T_FILE || ip->dev >= TMPDEV || (off | n | (uint)va) % BSIZE)
+    return -1;
+  if(off > ip->size || off + n < off || off + n > MAXFILE*BSIZE)
+    return -1;
+  if(write){
+    xdrop(ip);
+    if((ip->flags & I_INLINE) && iuninline(ip) < 0)
+      return -1;
+  } else if(off + n > ip->size)
+    n = ip->size - off;
+  if((db = (struct buf*)kalloc()) == 0)
+    return -1;
+
+  nd = 0;
+  for(tot = 0; tot < n; tot += BSIZE){
+    bn = (off + tot) / BSIZE;
+    if((addr = bmap(ip, bn)) == 0)
+      break;
+    p = va + tot;
+    ka = uva2kafault(p, !write);
+    if((bp = bpeek(ip->dev, addr)) != 0 || ka == 0){
+      if(bp == 0)
+        bp = write ? bnew(ip->dev, addr) : bread(ip->dev, addr);
+      if(write){
+        memmove(bp->data, p, BSIZE);
+        if(bp->flags & B_DIRTY)
+          log_write(bp);  // part of this transaction already
+        else
+          bwrite(bp);
+      } else
+        memmove(p, bp->data, BSIZE);
+      brelse(bp);
+    } else {
+      bp = &db[nd++];
+      memset(bp, 0, sizeof(*bp));
+      bp->flags = B_BUSY | (write ? B_DIRTY : 0);
+      bp->dev = ip->dev;
+      bp->sector = addr;
+      bp->data = (uchar*)ka + (uint)p % PGSIZE;
+      if(nd == PGSIZE / sizeof(*db)){
+        iderwv(db, nd);
+        nd = 0;
+      }
+    }
+    if(write && (pg = pclookup(ip, bn / BPP)) != 0){
+      memmove(pg->data + bn % BPP * BSIZE, p, BSIZE);
+      pcput(pg);
+    }
+  }
+  if(nd > 0)
+    iderwv(db, nd);
+  kfree((char*)db);
+
+  if(!write)
+    return tot < n ? tot : n;
+  if(tot == 0 && n > 0)
+    return -1;
+  ip->dtid = log_tid();
+  if(off + tot > ip->size){
+    ip->size = off + tot;
+    iupdate(ip);
+  }
+  return tot;
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -659,18 +1705,215 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
-// Look for a directory entry in a directory.
-// If found, set *poff to byte offset of entry.
-struct inode*
-dirlookup(struct inode *dp, char *name, uint *poff)
+// Hash of a name, for indexed directories.  Must match mkfs.c.
+static uint
+dirhash(char *name)
 {
-  uint off, inum;
-  struct dirent de;
+  uint h;
+  int i;
 
-  if(dp->type != T_DIR)
-    panic("dirlookup not DIR");
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+    return 0;
+  h = 2166136261U;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+// Name cache.  Each entry maps (dev, directory inum, name) to the
+// inum and offset of the matching entry, or records with inum 0
+// that the name is absent.  All changes to a directory go through
+// dirlink and dcset while the directory is locked, so an entry is
+// correct as long as it is cached.  An entry for a symbolic link
+// may also hold the link's target, if it is short, so namex can
+// follow the link without locking or reading it.  Entries are
+// reused least recently used first.  dcache.lock protects all of it.
+#define NDHASH 127
+#define NDLINK 32
+
+struct dentry {
+  uint dev;   // 0: unused
+  uint pinum;
+  char name[DIRSIZ];
+  uint inum;  // 0: name not present
+  uint off;
+  int nlink;  // length of cached target; 0: none
+  char link[NDLINK];
+  struct dentry *hnext, *lprev, *lnext;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry entry[NDENTRY];
+  struct dentry lru;  // least recent first
+  struct dentry *hash[NDHASH];
+} dcache;
+
+static struct dentry**
+dchash(uint dev, uint pinum, char *name)
+{
+  return &dcache.hash[(dev * 31 + pinum * 17 + dirhash(name)) % NDHASH];
+}
+
+static void
+dcunlink(struct dentry *d)
+{
+  d->lprev->lnext = d->lnext;
+  d->lnext->lprev = d->lprev;
+}
+
+// Put d at the tail of the LRU list, or at the head if unused.
+static void
+dctouch(struct dentry *d)
+{
+  struct dentry *at;
+
+  at = d->dev ? &dcache.lru : dcache.lru.lnext;
+  d->lnext = at;
+  d->lprev = at->lprev;
+  at->lprev->lnext = d;
+  at->lprev = d;
+}
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
+static void
+dcunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = dchash(d->dev, d->pinum, d->name); *pp; pp = &(*pp)->hnext){
+    if(*pp == d){
+      *pp = d->hnext;
+      d->dev = 0;
+      return;
+    }
+  }
+  panic("dcunhash");
+}
+
+static void
+dcinit(void)
+{
+  int i;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.lnext = dcache.lru.lprev = &dcache.lru;
+  for(i = 0; i < NDENTRY; i++)
+    dctouch(&dcache.entry[i]);
+}
+
+// Find the entry for name in dp.  Caller must hold dcache.lock.
+static struct dentry*
+dcfind(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  for(d = *dchash(dp->dev, dp->inum, name); d; d = d->hnext)
+    if(d->pinum == dp->inum && d->dev == dp->dev && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Record that name in dp is the entry at off for inum, or that it
+// is absent if inum is 0.  Caller must hold dp locked, perhaps
+// shared.
+void
+dcset(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) == 0){
+    d = dcache.lru.lnext;
+    if(d->dev)
+      dcunhash(d);
+    d->dev = dp->dev;
+    d->pinum = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    d->hnext = *dchash(d->dev, d->pinum, d->name);
+    *dchash(d->dev, d->pinum, d->name) = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  d->nlink = 0;
+  dcunlink(d);
+  dctouch(d);
+  release(&dcache.lock);
+}
+
+// Copy the cached target of symbolic link name in dp, which
+// refers to inum, into buf.  Return its length, or 0 if not cached.
+static int
+dcgetlink(struct inode *dp, char *name, uint inum, char *buf)
+{
+  struct dentry *d;
+  int n;
+
+  n = 0;
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0 && d->inum == inum && d->nlink > 0){
+    n = d->nlink;
+    memmove(buf, d->link, n);
+  }
+  release(&dcache.lock);
+  return n;
+}
+
+// Remember the n-byte target of symbolic link name in dp, if the
+// entry still refers to inum.
+static void
+dcsetlink(struct inode *dp, char *name, uint inum, char *buf, int n)
+{
+  struct dentry *d;
+
+  if(n > NDLINK)
+    return;
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0 && d->inum == inum){
+    memmove(d->link, buf, n);
+    d->nlink = n;
+  }
+  release(&dcache.lock);
+}
+
+// Forget the cached target of symbolic link ip, which is
+// being rewritten.
+static void
+dcdroplink(struct inode *ip)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.entry; d < dcache.entry + NDENTRY; d++)
+    if(d->dev == ip->dev && d->inum == ip->inum)
+      d->nlink = 0;
+  release(&dcache.lock);
+}
+
+// Forget every name in directory inum, which is being freed.
+static void
+dcpurge(uint dev, uint inum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.entry; d < dcache.entry + NDENTRY; d++){
+    if(d->dev == dev && d->pinum == inum){
+      dcunhash(d);
+      dcunlink(d);
+      dctouch(d);
+    }
+  }
+  release(&dcache.lock);
+}
+
+// Look for name among the entries at offsets [off, end) of dp.
+static struct inode*
+dirscan(struct inode *dp, char *name, uint off, uint end, uint *poff)
+{
+  uint inum;
+  struct dirent de;
+
+  for(; off < end; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlink read");
     if(de.inum == 0)
@@ -683,15 +1926,76 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       return iget(dp->dev, inum);
     }
   }
-
   return 0;
 }
 
+// Look for a directory entry in a directory, consulting the
+// name cache first and recording the result there.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+  struct inode *ip;
+  struct dentry *d;
+  uint off, inum;
+
+  if(dp->type != T_DIR)
+    panic("dirlookup not DIR");
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0){
+    kstatinc(KS_DHIT);
+    inum = d->inum;
+    off = d->off;
+    dcunlink(d);
+    dctouch(d);
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  kstatinc(KS_DMISS);
+  release(&dcache.lock);
+
+  if(dp->nhash == 0)
+    ip = dirscan(dp, name, 0, dp->size, &off);
+  else {
+    off = dirhash(name) % dp->nhash * BSIZE;
+    if((ip = dirscan(dp, name, off, off + BSIZE, &off)) == 0)
+      ip = dirscan(dp, name, dp->nhash * BSIZE, dp->size, &off);
+  }
+  if(ip == 0){
+    dcset(dp, name, 0, 0);
+    return 0;
+  }
+  dcset(dp, name, ip->inum, off);
+  if(poff)
+    *poff = off;
+  return ip;
+}
+
+// Offset of the first empty entry in [off, end) of dp, or end.
+static uint
+dirfree(struct inode *dp, uint off, uint end)
+{
+  struct dirent de;
+
+  for(; off < end; off += sizeof(de)){
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirlink read");
+    if(de.inum == 0)
+      break;
+  }
+  return off;
+}
+
 // Write a new directory entry (name, inum) into the directory dp.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  uint off, b;
   struct dirent de;
   struct inode *ip;
 
@@ -701,22 +2005,42 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  // Look for an empty dirent: in the name's bucket, else among
+  // the overflow entries, else append.
+  if(dp->nhash == 0)
+    off = dirfree(dp, 0, dp->size);
+  else {
+    b = dirhash(name) % dp->nhash * BSIZE;
+    if((off = dirfree(dp, b, b + BSIZE)) == b + BSIZE)
+      off = dirfree(dp, dp->nhash * BSIZE, dp->size);
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcset(dp, name, inum, off);
   
   return 0;
 }
 
+// Make the new, empty directory dp an indexed one with nhash
+// buckets, by writing the empty bucket blocks.
+void
+dirindex(struct inode *dp, int nhash)
+{
+  static char zero[BSIZE];
+  int i;
+
+  if(dp->type != T_DIR || dp->size != 0)
+    panic("dirindex");
+  for(i = 0; i < nhash; i++)
+    if(writei(dp, zero, i*BSIZE, BSIZE) != BSIZE)
+      panic("dirindex: writei");
+  dp->nhash = nhash;
+  iupdate(dp);
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -757,21 +2081,52 @@ skipelem(char *path, char *name)
   return path;
 }
 
+// If ip, found as name in directory dp, is a symbolic link,
+// copy its target into buf and return the target's length.
+// Return 0 if ip is not a symbolic link.
+static int
+namelink(struct inode *dp, char *name, struct inode *ip, char *buf)
+{
+  int n;
+
+  if((n = dcgetlink(dp, name, ip->inum, buf)) > 0)
+    return n;
+  ilockshared(ip);
+  n = 0;
+  if(ip->type == T_SYMLINK && (n = readi(ip, buf, 0, MAXPATH-1)) > 0)
+    dcsetlink(dp, name, ip->inum, buf, n);
+  iunlock(ip);
+  return n < 0 ? 0 : n;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
+// Symbolic links are followed as they are met, by splicing the
+// target in front of the rest of the path and carrying on from the
+// directory holding the link (or the root, for absolute targets).
+// The last element is followed only if follow != 0.
 static struct inode*
-namex(char *path, int nameiparent, char *name)
+namex(char *path, int nameiparent, int follow, char *name)
 {
   struct inode *ip, *next;
+  char buf[MAXPATH], link[MAXPATH];
+  int n, len, nfollow;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(proc->cwd);
+    ip = idup(proc->group->cwd);
 
+  nfollow = 0;
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    if((!nameiparent || *path != '\0') && namecmp(name, "..") == 0 &&
+       (next = mountup(ip)) != 0){
+      // Up out of a mounted tmpfs.
+      iput(ip);
+      ip = next;
+    }
+    ilockshared(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
@@ -785,8 +2140,26 @@ namex(char *path, int nameiparent, char *name)
       iunlockput(ip);
       return 0;
     }
-    iunlockput(ip);
-    ip = next;
+    iunlock(ip);
+    if((*path != '\0' || follow) && (n = namelink(ip, name, next, link)) > 0){
+      iput(next);
+      len = strlen(path);
+      if(++nfollow > MAX_SYMLINK_LOOPS || n + 1 + len >= MAXPATH){
+        iput(ip);
+        return 0;
+      }
+      memmove(buf + n + 1, path, len + 1);
+      buf[n] = '/';
+      memmove(buf, link, n);
+      path = buf;
+      if(*path == '/'){
+        iput(ip);
+        ip = iget(ROOTDEV, ROOTINO);
+      }
+      continue;
+    }
+    iput(ip);
+    ip = mountcross(next);
   }
   if(nameiparent){
     iput(ip);
@@ -799,19 +2172,30 @@ struct inode*
 namei(char *path)
 {
   char name[DIRSIZ];
-  return namex(path, 0, name);
+  return namex(path, 0, 1, name);
+}
+
+// Like namei, but if the last element is a symbolic link,
+// return the link itself.
+struct inode*
+nameilink(char *path)
+{
+  char name[DIRSIZ];
+  return namex(path, 0, 0, name);
 }
 
 struct inode*
 nameiparent(char *path, char *name)
 {
-  return namex(path, 1, name);
+  return namex(path, 1, 1, name);
 }
 
 /****************/
 /*** TASK 1.2 ***/
 /****************/
 
+// Copy into buf the path pathname names once every symbolic link
+// in it is expanded, for readlink.  Lookups follow links in namex.
 int
 filereadlink(const char *pathname, char *buf, int bufsiz)
 {
@@ -863,13 +2247,13 @@ restart:
       result_off += strlen(name);
       result[result_off] = '\0';
 
-      ip = namei(result);
+      ip = nameilink(result);
       if(!ip){
         return -1;
       }
       ilock(ip);
       if(ip->type == T_FILE || ip->type == T_DEV || ip->type == T_DIR){
-        iunlock(ip);
+        iunlockput(ip);
         if(bufsiz < result_off + 1){
           return -1;
         } else {
@@ -878,7 +2262,7 @@ restart:
         }
       } else if(ip->type == T_SYMLINK) {
         l = readi(ip, origpath, 0, MAXPATH);
-        iunlock(ip);
+        iunlockput(ip);
         origpath[l] = '\0';
         if(origpath[0] != '/'){
           // Relative symlink
@@ -899,113 +2283,14 @@ restart:
       result_off += strlen(name);
       result[result_off] = '\0';
 
-      ip = namei(result);
-      if(!ip){
-        return -1;
-      }
-      ilock(ip);
-      if(ip->type == T_FILE || ip->type == T_DEV){
-        // Tried to traverse through a file/dev as if it was a directory
-        return -1;
-      } else if(ip->type == T_DIR) {
-        result[result_off] = '/';
-        result_off++;
-        result[result_off] = '\0';
-      } else if(ip->type == T_SYMLINK) {
-        result_off -= strlen(name);
-        l = readi(ip, &result[result_off], 0, MAXPATH);
-        iunlock(ip);
-        result[result_off+l] = '/';
-        safestrcpy(&result[result_off+l+1], origpath_p, MAXPATH);
-        if(result[result_off] == '/') {
-          // Absolute symlink
-          safestrcpy(origpath, &result[result_off], MAXPATH);
-        } else {
-          safestrcpy(origpath, result, MAXPATH);
-        }
-        loops_left--;
-        if(loops_left == 0){
-          return -1;
-        }
-        goto restart;
-      } else {
-        panic("filereadlink: unknown inode type");
-      }
-      iunlock(ip);
-    }
-  }
-}
-
-// Same as filereadlink, but doesn't dereference the final path element
-int
-filereadlinki(const char *pathname, char *buf, int bufsiz)
-{
-  int loops_left = MAX_SYMLINK_LOOPS;
-  int l;
-
-  char name[DIRSIZ+1];
-  char result[MAXPATH];
-  int result_off;
-  char origpath[MAXPATH];
-  char *origpath_p;
-
-  struct inode* ip;
-
-  if(*pathname == '\0'){
-    return -1;
-  }
-
-  if(pathname[0] == '/' && pathname[1] == '\0') {
-    buf[0] = '/';
-    buf[1] = '\0';
-    return 2;
-  }
-
-  strncpy(origpath, pathname, MAXPATH);
-
-restart:
-  result_off = 0;
-
-  if(origpath[0] == '/'){
-    result[0] = '/';
-    result_off = 1;
-  }
-  result[result_off] = '\0';
-
-  origpath_p = origpath;
-
-  for(;;){
-    origpath_p = skipelem(origpath_p, name);
-    if(!origpath_p){
-      return -1;
-    }
-
-    if(*origpath_p == '\0'){
-      // Last element
-      // `name' contains the filename
-
-      safestrcpy(&result[result_off], name, MAXPATH);
-      result_off += strlen(name);
-      result[result_off] = '\0';
-
-      if(bufsiz < result_off + 1){
-        return -1;
-      } else {
-        safestrcpy(buf, result, MAXPATH);
-        return result_off;
-      }
-    } else {
-      safestrcpy(&result[result_off], name, MAXPATH);
-      result_off += strlen(name);
-      result[result_off] = '\0';
-
-      ip = namei(result);
+      ip = nameilink(result);
       if(!ip){
         return -1;
       }
       ilock(ip);
       if(ip->type == T_FILE || ip->type == T_DEV){
         // Tried to traverse through a file/dev as if it was a directory
+        iunlockput(ip);
         return -1;
       } else if(ip->type == T_DIR) {
         result[result_off] = '/';
@@ -1014,7 +2299,7 @@ restart:
       } else if(ip->type == T_SYMLINK) {
         result_off -= strlen(name);
         l = readi(ip, &result[result_off], 0, MAXPATH);
-        iunlock(ip);
+        iunlockput(ip);
         result[result_off+l] = '/';
         safestrcpy(&result[result_off+l+1], origpath_p, MAXPATH);
         if(result[result_off] == '/') {
@@ -1031,7 +2316,7 @@ restart:
       } else {
         panic("filereadlink: unknown inode type");
       }
-      iunlock(ip);
+      iunlockput(ip);
     }
   }
 }
@@ -7,9 +7,20 @@
 // Then free bitmap blocks holding sb.size bits.
 // Then sb.nblocks data blocks.
 // Then sb.nlog log blocks.
+// Then, past the sb.size blocks so far, sb.nswap blocks of swap.
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+
+// Block size, a build option (make BSIZE=n).  mkfs records it in
+// the super block and the kernel refuses a file system made for
+// another.  The disk still moves 512-byte sectors, BSIZE/512 of
+// them per block.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
+#if BSIZE != 512 && BSIZE != 1024 && BSIZE != 2048 && BSIZE != 4096
+#error "BSIZE must be 512, 1024, 2048 or 4096"
+#endif
 
 // File system super block
 struct superblock {
@@ -17,13 +28,35 @@ struct superblock {
   uint nblocks;      // Number of data blocks
   uint ninodes;      // Number of inodes.
   uint nlog;         // Number of log blocks
+  uint features;     // FS_ flags below
+  uint stripe;       // blocks per unit striped over disks 1 and 2; 0: not
+  uint bsize;        // BSIZE it was made with; 0 for 512
+  uint nswap;        // Blocks of swap space after the size blocks
 };
 
+#define FS_EXTENTS 0x1   // inodes map their blocks with extents
+
 #define NDIRECT 12
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT + (NINDIRECT * NINDIRECT))
+#define NMAPPED (NDIRECT + NINDIRECT + (NINDIRECT * NINDIRECT))
+// Blocks in the largest file: all that the inode can map, or with
+// big blocks as many as keep its size in bytes, MAXFILE*BSIZE, a
+// positive int.
+#define MAXFILE (NMAPPED < 0x7fffffff/BSIZE ? NMAPPED : 0x7fffffff/BSIZE)
 #define PASSLEN 10
 
+// With FS_EXTENTS, addrs[0..NDIRECT-1] of an inode hold NIEXTENT
+// extents, and addrs[NDIRECT] a block of NBEXTENT more.  Extents
+// map a file's blocks in order: the first covers blocks 0 through
+// len-1, the next starts where it ends, and so on.  An extent with
+// len 0 ends the list.  indirect2 is unused.
+struct extent {
+  uint start;        // first disk block
+  uint len;          // number of blocks
+};
+#define NIEXTENT (NDIRECT / 2)
+#define NBEXTENT (BSIZE / sizeof(struct extent))
+
 // On-disk inode structure
 struct dinode {
   short type;           // File type
@@ -35,9 +68,18 @@ struct dinode {
   uint indirect2;       // Double indirection layer (Adds additional 8MB)
 
   char password[PASSLEN];    // Password for locking files
-  char padding[50];     // Unused. Pads the size of the struct to 128 bytes
+  ushort nhash;         // Hash buckets of an indexed directory, or 0
+  uchar flags;          // DI_INLINE
+  char padding[47];     // Unused. Pads the size of the struct to 128 bytes
 };
 
+// A file or symbolic link with DI_INLINE set keeps its data, at
+// most NINLINE bytes, in addrs[] and indirect2 instead of in data
+// blocks.  New ones start out that way; writei moves the data to a
+// block when the file outgrows the inode.
+#define DI_INLINE 0x1
+#define NINLINE ((NDIRECT+2) * sizeof(uint))
+
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
@@ -51,7 +93,13 @@ struct dinode {
 #define BBLOCK(b, ninodes) (b/BPB + (ninodes)/IPB + 3)
 
 // Directory is a file containing a sequence of dirent structures.
+// An indexed directory (nhash > 0) starts with nhash bucket blocks:
+// an entry goes in block dirhash(name) % nhash if that has room,
+// and otherwise in the overflow blocks after the buckets.  "." and
+// ".." hash to block 0.  Code that reads directories linearly
+// sees ordinary entries either way.
 #define DIRSIZ 14
+#define NDIRHASH 16  // most buckets a new directory inherits
 
 #define MAXPATH 256
 
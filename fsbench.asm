@@ -0,0 +1,3454 @@
+
+_fsbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fail>:
+int kb = 1024;           // size of a file read or written
+uint seed;
+
+static void
+fail(char *what, char *path)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "fsbench: %s %s failed\n", what, path);
+       6:	ff 75 0c             	push   0xc(%ebp)
+       9:	ff 75 08             	push   0x8(%ebp)
+       c:	68 6c 1e 00 00       	push   $0x1e6c
+      11:	6a 02                	push   $0x2
+      13:	e8 ba 17 00 00       	call   17d2 <printf>
+      18:	83 c4 10             	add    $0x10,%esp
+  exit();
+      1b:	e8 22 13 00 00       	call   1342 <exit>
+
+00000020 <rnd>:
+}
+
+static uint
+rnd(void)
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+  seed = seed * 1103515245 + 12345;
+      23:	a1 60 36 00 00       	mov    0x3660,%eax
+      28:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+      2e:	05 39 30 00 00       	add    $0x3039,%eax
+      33:	a3 60 36 00 00       	mov    %eax,0x3660
+  return seed >> 8;
+      38:	a1 60 36 00 00       	mov    0x3660,%eax
+      3d:	c1 e8 08             	shr    $0x8,%eax
+}
+      40:	5d                   	pop    %ebp
+      41:	c3                   	ret
+
+00000042 <join>:
+
+// Append name to path p, in buf.
+static char*
+join(char *buf, char *p, char *name)
+{
+      42:	55                   	push   %ebp
+      43:	89 e5                	mov    %esp,%ebp
+      45:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  n = strlen(p);
+      48:	83 ec 0c             	sub    $0xc,%esp
+      4b:	ff 75 0c             	push   0xc(%ebp)
+      4e:	e8 ed 10 00 00       	call   1140 <strlen>
+      53:	83 c4 10             	add    $0x10,%esp
+      56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(n + 1 + strlen(name) + 1 > MAXPATH)
+      59:	83 ec 0c             	sub    $0xc,%esp
+      5c:	ff 75 10             	push   0x10(%ebp)
+      5f:	e8 dc 10 00 00       	call   1140 <strlen>
+      64:	83 c4 10             	add    $0x10,%esp
+      67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      6a:	01 d0                	add    %edx,%eax
+      6c:	83 c0 02             	add    $0x2,%eax
+      6f:	3d 00 01 00 00       	cmp    $0x100,%eax
+      74:	76 13                	jbe    89 <join+0x47>
+    fail("path", p);
+      76:	83 ec 08             	sub    $0x8,%esp
+      79:	ff 75 0c             	push   0xc(%ebp)
+      7c:	68 83 1e 00 00       	push   $0x1e83
+      81:	e8 7a ff ff ff       	call   0 <fail>
+      86:	83 c4 10             	add    $0x10,%esp
+  if(buf != p)
+      89:	8b 45 08             	mov    0x8(%ebp),%eax
+      8c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+      8f:	74 11                	je     a2 <join+0x60>
+    strcpy(buf, p);
+      91:	83 ec 08             	sub    $0x8,%esp
+      94:	ff 75 0c             	push   0xc(%ebp)
+      97:	ff 75 08             	push   0x8(%ebp)
+      9a:	e8 32 10 00 00       	call   10d1 <strcpy>
+      9f:	83 c4 10             	add    $0x10,%esp
+  buf[n] = '/';
+      a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      a5:	8b 45 08             	mov    0x8(%ebp),%eax
+      a8:	01 d0                	add    %edx,%eax
+      aa:	c6 00 2f             	movb   $0x2f,(%eax)
+  strcpy(buf + n + 1, name);
+      ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      b0:	8d 50 01             	lea    0x1(%eax),%edx
+      b3:	8b 45 08             	mov    0x8(%ebp),%eax
+      b6:	01 d0                	add    %edx,%eax
+      b8:	83 ec 08             	sub    $0x8,%esp
+      bb:	ff 75 10             	push   0x10(%ebp)
+      be:	50                   	push   %eax
+      bf:	e8 0d 10 00 00       	call   10d1 <strcpy>
+      c4:	83 c4 10             	add    $0x10,%esp
+  return buf;
+      c7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+      ca:	c9                   	leave
+      cb:	c3                   	ret
+
+000000cc <numname>:
+
+static char*
+numname(char *buf, char *p, char *prefix, int i)
+{
+      cc:	55                   	push   %ebp
+      cd:	89 e5                	mov    %esp,%ebp
+      cf:	83 ec 28             	sub    $0x28,%esp
+  char name[DIRSIZ+1];
+  int n;
+
+  strcpy(name, prefix);
+      d2:	83 ec 08             	sub    $0x8,%esp
+      d5:	ff 75 10             	push   0x10(%ebp)
+      d8:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+      db:	50                   	push   %eax
+      dc:	e8 f0 0f 00 00       	call   10d1 <strcpy>
+      e1:	83 c4 10             	add    $0x10,%esp
+  n = strlen(name);
+      e4:	83 ec 0c             	sub    $0xc,%esp
+      e7:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+      ea:	50                   	push   %eax
+      eb:	e8 50 10 00 00       	call   1140 <strlen>
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  name[n++] = 'a' + i / 26 % 26;
+      f6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+      f9:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+      fe:	89 c8                	mov    %ecx,%eax
+     100:	f7 ea                	imul   %edx
+     102:	c1 fa 03             	sar    $0x3,%edx
+     105:	89 c8                	mov    %ecx,%eax
+     107:	c1 f8 1f             	sar    $0x1f,%eax
+     10a:	89 d1                	mov    %edx,%ecx
+     10c:	29 c1                	sub    %eax,%ecx
+     10e:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+     113:	89 c8                	mov    %ecx,%eax
+     115:	f7 ea                	imul   %edx
+     117:	89 d0                	mov    %edx,%eax
+     119:	c1 f8 03             	sar    $0x3,%eax
+     11c:	89 ca                	mov    %ecx,%edx
+     11e:	c1 fa 1f             	sar    $0x1f,%edx
+     121:	29 d0                	sub    %edx,%eax
+     123:	6b d0 1a             	imul   $0x1a,%eax,%edx
+     126:	89 c8                	mov    %ecx,%eax
+     128:	29 d0                	sub    %edx,%eax
+     12a:	8d 48 61             	lea    0x61(%eax),%ecx
+     12d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     130:	8d 50 01             	lea    0x1(%eax),%edx
+     133:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     136:	89 ca                	mov    %ecx,%edx
+     138:	88 54 05 e5          	mov    %dl,-0x1b(%ebp,%eax,1)
+  name[n++] = 'a' + i % 26;
+     13c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     13f:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+     144:	89 c8                	mov    %ecx,%eax
+     146:	f7 ea                	imul   %edx
+     148:	89 d0                	mov    %edx,%eax
+     14a:	c1 f8 03             	sar    $0x3,%eax
+     14d:	89 ca                	mov    %ecx,%edx
+     14f:	c1 fa 1f             	sar    $0x1f,%edx
+     152:	29 d0                	sub    %edx,%eax
+     154:	6b d0 1a             	imul   $0x1a,%eax,%edx
+     157:	89 c8                	mov    %ecx,%eax
+     159:	29 d0                	sub    %edx,%eax
+     15b:	8d 48 61             	lea    0x61(%eax),%ecx
+     15e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     161:	8d 50 01             	lea    0x1(%eax),%edx
+     164:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     167:	89 ca                	mov    %ecx,%edx
+     169:	88 54 05 e5          	mov    %dl,-0x1b(%ebp,%eax,1)
+  name[n] = 0;
+     16d:	8d 55 e5             	lea    -0x1b(%ebp),%edx
+     170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     173:	01 d0                	add    %edx,%eax
+     175:	c6 00 00             	movb   $0x0,(%eax)
+  return join(buf, p, name);
+     178:	83 ec 04             	sub    $0x4,%esp
+     17b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+     17e:	50                   	push   %eax
+     17f:	ff 75 0c             	push   0xc(%ebp)
+     182:	ff 75 08             	push   0x8(%ebp)
+     185:	e8 b8 fe ff ff       	call   42 <join>
+     18a:	83 c4 10             	add    $0x10,%esp
+}
+     18d:	c9                   	leave
+     18e:	c3                   	ret
+
+0000018f <mkfile>:
+
+// Sequential and random I/O on one file, base/file.
+
+static void
+mkfile(char *base)
+{
+     18f:	55                   	push   %ebp
+     190:	89 e5                	mov    %esp,%ebp
+     192:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int fd, i;
+
+  if((fd = open(join(path, base, "file"), O_CREATE | O_WRONLY)) < 0)
+     198:	83 ec 04             	sub    $0x4,%esp
+     19b:	68 88 1e 00 00       	push   $0x1e88
+     1a0:	ff 75 08             	push   0x8(%ebp)
+     1a3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     1a9:	50                   	push   %eax
+     1aa:	e8 93 fe ff ff       	call   42 <join>
+     1af:	83 c4 10             	add    $0x10,%esp
+     1b2:	83 ec 08             	sub    $0x8,%esp
+     1b5:	68 01 02 00 00       	push   $0x201
+     1ba:	50                   	push   %eax
+     1bb:	e8 ba 11 00 00       	call   137a <open>
+     1c0:	83 c4 10             	add    $0x10,%esp
+     1c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     1c6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1ca:	79 17                	jns    1e3 <mkfile+0x54>
+    fail("create", path);
+     1cc:	83 ec 08             	sub    $0x8,%esp
+     1cf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     1d5:	50                   	push   %eax
+     1d6:	68 8d 1e 00 00       	push   $0x1e8d
+     1db:	e8 20 fe ff ff       	call   0 <fail>
+     1e0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < kb * 1024 / IOSIZE; i++)
+     1e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1ea:	eb 3a                	jmp    226 <mkfile+0x97>
+    if(write(fd, data, IOSIZE) != IOSIZE)
+     1ec:	83 ec 04             	sub    $0x4,%esp
+     1ef:	68 00 10 00 00       	push   $0x1000
+     1f4:	68 60 26 00 00       	push   $0x2660
+     1f9:	ff 75 f0             	push   -0x10(%ebp)
+     1fc:	e8 5d 11 00 00       	call   135e <write>
+     201:	83 c4 10             	add    $0x10,%esp
+     204:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     209:	74 17                	je     222 <mkfile+0x93>
+      fail("write", path);
+     20b:	83 ec 08             	sub    $0x8,%esp
+     20e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     214:	50                   	push   %eax
+     215:	68 94 1e 00 00       	push   $0x1e94
+     21a:	e8 e1 fd ff ff       	call   0 <fail>
+     21f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < kb * 1024 / IOSIZE; i++)
+     222:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     226:	a1 a0 25 00 00       	mov    0x25a0,%eax
+     22b:	8d 50 03             	lea    0x3(%eax),%edx
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 48 c2             	cmovs  %edx,%eax
+     233:	c1 f8 02             	sar    $0x2,%eax
+     236:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     239:	7c b1                	jl     1ec <mkfile+0x5d>
+  close(fd);
+     23b:	83 ec 0c             	sub    $0xc,%esp
+     23e:	ff 75 f0             	push   -0x10(%ebp)
+     241:	e8 1f 11 00 00       	call   1365 <close>
+     246:	83 c4 10             	add    $0x10,%esp
+}
+     249:	90                   	nop
+     24a:	c9                   	leave
+     24b:	c3                   	ret
+
+0000024c <rmfile>:
+
+static void
+rmfile(char *base)
+{
+     24c:	55                   	push   %ebp
+     24d:	89 e5                	mov    %esp,%ebp
+     24f:	81 ec 08 01 00 00    	sub    $0x108,%esp
+  char path[MAXPATH];
+
+  unlink(join(path, base, "file"));
+     255:	83 ec 04             	sub    $0x4,%esp
+     258:	68 88 1e 00 00       	push   $0x1e88
+     25d:	ff 75 08             	push   0x8(%ebp)
+     260:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+     266:	50                   	push   %eax
+     267:	e8 d6 fd ff ff       	call   42 <join>
+     26c:	83 c4 10             	add    $0x10,%esp
+     26f:	83 ec 0c             	sub    $0xc,%esp
+     272:	50                   	push   %eax
+     273:	e8 16 11 00 00       	call   138e <unlink>
+     278:	83 c4 10             	add    $0x10,%esp
+}
+     27b:	90                   	nop
+     27c:	c9                   	leave
+     27d:	c3                   	ret
+
+0000027e <seqwrite>:
+
+static void
+seqwrite(char *base, struct result *r)
+{
+     27e:	55                   	push   %ebp
+     27f:	89 e5                	mov    %esp,%ebp
+     281:	83 ec 08             	sub    $0x8,%esp
+  mkfile(base);
+     284:	83 ec 0c             	sub    $0xc,%esp
+     287:	ff 75 08             	push   0x8(%ebp)
+     28a:	e8 00 ff ff ff       	call   18f <mkfile>
+     28f:	83 c4 10             	add    $0x10,%esp
+  r->ops = kb * 1024 / IOSIZE;
+     292:	a1 a0 25 00 00       	mov    0x25a0,%eax
+     297:	8d 50 03             	lea    0x3(%eax),%edx
+     29a:	85 c0                	test   %eax,%eax
+     29c:	0f 48 c2             	cmovs  %edx,%eax
+     29f:	c1 f8 02             	sar    $0x2,%eax
+     2a2:	89 c2                	mov    %eax,%edx
+     2a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a7:	89 10                	mov    %edx,(%eax)
+  r->bytes = kb * 1024;
+     2a9:	a1 a0 25 00 00       	mov    0x25a0,%eax
+     2ae:	c1 e0 0a             	shl    $0xa,%eax
+     2b1:	89 c2                	mov    %eax,%edx
+     2b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2b6:	89 50 04             	mov    %edx,0x4(%eax)
+}
+     2b9:	90                   	nop
+     2ba:	c9                   	leave
+     2bb:	c3                   	ret
+
+000002bc <seqread>:
+
+static void
+seqread(char *base, struct result *r)
+{
+     2bc:	55                   	push   %ebp
+     2bd:	89 e5                	mov    %esp,%ebp
+     2bf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int fd, n;
+
+  if((fd = open(join(path, base, "file"), O_RDONLY)) < 0)
+     2c5:	83 ec 04             	sub    $0x4,%esp
+     2c8:	68 88 1e 00 00       	push   $0x1e88
+     2cd:	ff 75 08             	push   0x8(%ebp)
+     2d0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     2d6:	50                   	push   %eax
+     2d7:	e8 66 fd ff ff       	call   42 <join>
+     2dc:	83 c4 10             	add    $0x10,%esp
+     2df:	83 ec 08             	sub    $0x8,%esp
+     2e2:	6a 00                	push   $0x0
+     2e4:	50                   	push   %eax
+     2e5:	e8 90 10 00 00       	call   137a <open>
+     2ea:	83 c4 10             	add    $0x10,%esp
+     2ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     2f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2f4:	79 37                	jns    32d <seqread+0x71>
+    fail("open", path);
+     2f6:	83 ec 08             	sub    $0x8,%esp
+     2f9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     2ff:	50                   	push   %eax
+     300:	68 9a 1e 00 00       	push   $0x1e9a
+     305:	e8 f6 fc ff ff       	call   0 <fail>
+     30a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, data, IOSIZE)) > 0){
+     30d:	eb 1e                	jmp    32d <seqread+0x71>
+    r->ops++;
+     30f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     312:	8b 00                	mov    (%eax),%eax
+     314:	8d 50 01             	lea    0x1(%eax),%edx
+     317:	8b 45 0c             	mov    0xc(%ebp),%eax
+     31a:	89 10                	mov    %edx,(%eax)
+    r->bytes += n;
+     31c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     31f:	8b 50 04             	mov    0x4(%eax),%edx
+     322:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     325:	01 c2                	add    %eax,%edx
+     327:	8b 45 0c             	mov    0xc(%ebp),%eax
+     32a:	89 50 04             	mov    %edx,0x4(%eax)
+  while((n = read(fd, data, IOSIZE)) > 0){
+     32d:	83 ec 04             	sub    $0x4,%esp
+     330:	68 00 10 00 00       	push   $0x1000
+     335:	68 60 26 00 00       	push   $0x2660
+     33a:	ff 75 f4             	push   -0xc(%ebp)
+     33d:	e8 15 10 00 00       	call   1357 <read>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     348:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     34c:	7f c1                	jg     30f <seqread+0x53>
+  }
+  close(fd);
+     34e:	83 ec 0c             	sub    $0xc,%esp
+     351:	ff 75 f4             	push   -0xc(%ebp)
+     354:	e8 0c 10 00 00       	call   1365 <close>
+     359:	83 c4 10             	add    $0x10,%esp
+}
+     35c:	90                   	nop
+     35d:	c9                   	leave
+     35e:	c3                   	ret
+
+0000035f <randio>:
+
+static void
+randio(char *base, struct result *r, int wr)
+{
+     35f:	55                   	push   %ebp
+     360:	89 e5                	mov    %esp,%ebp
+     362:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int fd, i, off;
+
+  if((fd = open(join(path, base, "file"), O_RDWR)) < 0)
+     368:	83 ec 04             	sub    $0x4,%esp
+     36b:	68 88 1e 00 00       	push   $0x1e88
+     370:	ff 75 08             	push   0x8(%ebp)
+     373:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     379:	50                   	push   %eax
+     37a:	e8 c3 fc ff ff       	call   42 <join>
+     37f:	83 c4 10             	add    $0x10,%esp
+     382:	83 ec 08             	sub    $0x8,%esp
+     385:	6a 02                	push   $0x2
+     387:	50                   	push   %eax
+     388:	e8 ed 0f 00 00       	call   137a <open>
+     38d:	83 c4 10             	add    $0x10,%esp
+     390:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     393:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     397:	79 17                	jns    3b0 <randio+0x51>
+    fail("open", path);
+     399:	83 ec 08             	sub    $0x8,%esp
+     39c:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     3a2:	50                   	push   %eax
+     3a3:	68 9a 1e 00 00       	push   $0x1e9a
+     3a8:	e8 53 fc ff ff       	call   0 <fail>
+     3ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NRAND; i++){
+     3b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3b7:	e9 93 00 00 00       	jmp    44f <randio+0xf0>
+    off = rnd() % (kb * 1024 / BSIZE) * BSIZE;
+     3bc:	e8 5f fc ff ff       	call   20 <rnd>
+     3c1:	8b 15 a0 25 00 00    	mov    0x25a0,%edx
+     3c7:	01 d2                	add    %edx,%edx
+     3c9:	89 d1                	mov    %edx,%ecx
+     3cb:	ba 00 00 00 00       	mov    $0x0,%edx
+     3d0:	f7 f1                	div    %ecx
+     3d2:	89 d0                	mov    %edx,%eax
+     3d4:	c1 e0 09             	shl    $0x9,%eax
+     3d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((wr ? pwrite(fd, data, BSIZE, off) : pread(fd, data, BSIZE, off)) != BSIZE)
+     3da:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     3de:	74 22                	je     402 <randio+0xa3>
+     3e0:	ff 75 ec             	push   -0x14(%ebp)
+     3e3:	68 00 02 00 00       	push   $0x200
+     3e8:	68 60 26 00 00       	push   $0x2660
+     3ed:	ff 75 f0             	push   -0x10(%ebp)
+     3f0:	e8 6b 10 00 00       	call   1460 <pwrite>
+     3f5:	83 c4 10             	add    $0x10,%esp
+     3f8:	3d 00 02 00 00       	cmp    $0x200,%eax
+     3fd:	0f 95 c0             	setne  %al
+     400:	eb 20                	jmp    422 <randio+0xc3>
+     402:	ff 75 ec             	push   -0x14(%ebp)
+     405:	68 00 02 00 00       	push   $0x200
+     40a:	68 60 26 00 00       	push   $0x2660
+     40f:	ff 75 f0             	push   -0x10(%ebp)
+     412:	e8 3f 10 00 00       	call   1456 <pread>
+     417:	83 c4 10             	add    $0x10,%esp
+     41a:	3d 00 02 00 00       	cmp    $0x200,%eax
+     41f:	0f 95 c0             	setne  %al
+     422:	84 c0                	test   %al,%al
+     424:	74 25                	je     44b <randio+0xec>
+      fail(wr ? "pwrite" : "pread", path);
+     426:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     42a:	74 07                	je     433 <randio+0xd4>
+     42c:	ba 9f 1e 00 00       	mov    $0x1e9f,%edx
+     431:	eb 05                	jmp    438 <randio+0xd9>
+     433:	ba a6 1e 00 00       	mov    $0x1ea6,%edx
+     438:	83 ec 08             	sub    $0x8,%esp
+     43b:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     441:	50                   	push   %eax
+     442:	52                   	push   %edx
+     443:	e8 b8 fb ff ff       	call   0 <fail>
+     448:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NRAND; i++){
+     44b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     44f:	81 7d f4 ff 01 00 00 	cmpl   $0x1ff,-0xc(%ebp)
+     456:	0f 8e 60 ff ff ff    	jle    3bc <randio+0x5d>
+  }
+  close(fd);
+     45c:	83 ec 0c             	sub    $0xc,%esp
+     45f:	ff 75 f0             	push   -0x10(%ebp)
+     462:	e8 fe 0e 00 00       	call   1365 <close>
+     467:	83 c4 10             	add    $0x10,%esp
+  r->ops = NRAND;
+     46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46d:	c7 00 00 02 00 00    	movl   $0x200,(%eax)
+  r->bytes = NRAND * BSIZE;
+     473:	8b 45 0c             	mov    0xc(%ebp),%eax
+     476:	c7 40 04 00 00 04 00 	movl   $0x40000,0x4(%eax)
+}
+     47d:	90                   	nop
+     47e:	c9                   	leave
+     47f:	c3                   	ret
+
+00000480 <randwrite>:
+
+static void
+randwrite(char *base, struct result *r)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	83 ec 08             	sub    $0x8,%esp
+  randio(base, r, 1);
+     486:	83 ec 04             	sub    $0x4,%esp
+     489:	6a 01                	push   $0x1
+     48b:	ff 75 0c             	push   0xc(%ebp)
+     48e:	ff 75 08             	push   0x8(%ebp)
+     491:	e8 c9 fe ff ff       	call   35f <randio>
+     496:	83 c4 10             	add    $0x10,%esp
+}
+     499:	90                   	nop
+     49a:	c9                   	leave
+     49b:	c3                   	ret
+
+0000049c <randread>:
+
+static void
+randread(char *base, struct result *r)
+{
+     49c:	55                   	push   %ebp
+     49d:	89 e5                	mov    %esp,%ebp
+     49f:	83 ec 08             	sub    $0x8,%esp
+  randio(base, r, 0);
+     4a2:	83 ec 04             	sub    $0x4,%esp
+     4a5:	6a 00                	push   $0x0
+     4a7:	ff 75 0c             	push   0xc(%ebp)
+     4aa:	ff 75 08             	push   0x8(%ebp)
+     4ad:	e8 ad fe ff ff       	call   35f <randio>
+     4b2:	83 c4 10             	add    $0x10,%esp
+}
+     4b5:	90                   	nop
+     4b6:	c9                   	leave
+     4b7:	c3                   	ret
+
+000004b8 <create>:
+
+// Small files made and removed as fast as possible.
+
+static void
+create(char *base, struct result *r)
+{
+     4b8:	55                   	push   %ebp
+     4b9:	89 e5                	mov    %esp,%ebp
+     4bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int fd, i;
+
+  for(i = 0; i < NCREATE; i++){
+     4c1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4c8:	e9 8e 00 00 00       	jmp    55b <create+0xa3>
+    if((fd = open(numname(path, base, "c", i), O_CREATE | O_WRONLY)) < 0)
+     4cd:	ff 75 f4             	push   -0xc(%ebp)
+     4d0:	68 ac 1e 00 00       	push   $0x1eac
+     4d5:	ff 75 08             	push   0x8(%ebp)
+     4d8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     4de:	50                   	push   %eax
+     4df:	e8 e8 fb ff ff       	call   cc <numname>
+     4e4:	83 c4 10             	add    $0x10,%esp
+     4e7:	83 ec 08             	sub    $0x8,%esp
+     4ea:	68 01 02 00 00       	push   $0x201
+     4ef:	50                   	push   %eax
+     4f0:	e8 85 0e 00 00       	call   137a <open>
+     4f5:	83 c4 10             	add    $0x10,%esp
+     4f8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     4fb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4ff:	79 17                	jns    518 <create+0x60>
+      fail("create", path);
+     501:	83 ec 08             	sub    $0x8,%esp
+     504:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     50a:	50                   	push   %eax
+     50b:	68 8d 1e 00 00       	push   $0x1e8d
+     510:	e8 eb fa ff ff       	call   0 <fail>
+     515:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, data, 100) != 100)
+     518:	83 ec 04             	sub    $0x4,%esp
+     51b:	6a 64                	push   $0x64
+     51d:	68 60 26 00 00       	push   $0x2660
+     522:	ff 75 f0             	push   -0x10(%ebp)
+     525:	e8 34 0e 00 00       	call   135e <write>
+     52a:	83 c4 10             	add    $0x10,%esp
+     52d:	83 f8 64             	cmp    $0x64,%eax
+     530:	74 17                	je     549 <create+0x91>
+      fail("write", path);
+     532:	83 ec 08             	sub    $0x8,%esp
+     535:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     53b:	50                   	push   %eax
+     53c:	68 94 1e 00 00       	push   $0x1e94
+     541:	e8 ba fa ff ff       	call   0 <fail>
+     546:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     549:	83 ec 0c             	sub    $0xc,%esp
+     54c:	ff 75 f0             	push   -0x10(%ebp)
+     54f:	e8 11 0e 00 00       	call   1365 <close>
+     554:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NCREATE; i++){
+     557:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     55b:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+     55f:	0f 8e 68 ff ff ff    	jle    4cd <create+0x15>
+  }
+  for(i = 0; i < NCREATE; i++)
+     565:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     56c:	eb 45                	jmp    5b3 <create+0xfb>
+    if(unlink(numname(path, base, "c", i)) < 0)
+     56e:	ff 75 f4             	push   -0xc(%ebp)
+     571:	68 ac 1e 00 00       	push   $0x1eac
+     576:	ff 75 08             	push   0x8(%ebp)
+     579:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     57f:	50                   	push   %eax
+     580:	e8 47 fb ff ff       	call   cc <numname>
+     585:	83 c4 10             	add    $0x10,%esp
+     588:	83 ec 0c             	sub    $0xc,%esp
+     58b:	50                   	push   %eax
+     58c:	e8 fd 0d 00 00       	call   138e <unlink>
+     591:	83 c4 10             	add    $0x10,%esp
+     594:	85 c0                	test   %eax,%eax
+     596:	79 17                	jns    5af <create+0xf7>
+      fail("unlink", path);
+     598:	83 ec 08             	sub    $0x8,%esp
+     59b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     5a1:	50                   	push   %eax
+     5a2:	68 ae 1e 00 00       	push   $0x1eae
+     5a7:	e8 54 fa ff ff       	call   0 <fail>
+     5ac:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NCREATE; i++)
+     5af:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     5b3:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+     5b7:	7e b5                	jle    56e <create+0xb6>
+  r->ops = 2 * NCREATE;
+     5b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5bc:	c7 00 80 00 00 00    	movl   $0x80,(%eax)
+}
+     5c2:	90                   	nop
+     5c3:	c9                   	leave
+     5c4:	c3                   	ret
+
+000005c5 <mktree>:
+// Lookups of base/link/d/.../d/file, where link is a symbolic
+// link to d/d/d and the path goes DEPTH directories down.
+
+static void
+mktree(char *base)
+{
+     5c5:	55                   	push   %ebp
+     5c6:	89 e5                	mov    %esp,%ebp
+     5c8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int i, fd;
+
+  strcpy(path, base);
+     5ce:	83 ec 08             	sub    $0x8,%esp
+     5d1:	ff 75 08             	push   0x8(%ebp)
+     5d4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     5da:	50                   	push   %eax
+     5db:	e8 f1 0a 00 00       	call   10d1 <strcpy>
+     5e0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++){
+     5e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     5ea:	eb 4f                	jmp    63b <mktree+0x76>
+    join(path, path, "d");
+     5ec:	83 ec 04             	sub    $0x4,%esp
+     5ef:	68 b5 1e 00 00       	push   $0x1eb5
+     5f4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     5fa:	50                   	push   %eax
+     5fb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     601:	50                   	push   %eax
+     602:	e8 3b fa ff ff       	call   42 <join>
+     607:	83 c4 10             	add    $0x10,%esp
+    if(mkdir(path) < 0)
+     60a:	83 ec 0c             	sub    $0xc,%esp
+     60d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     613:	50                   	push   %eax
+     614:	e8 93 0d 00 00       	call   13ac <mkdir>
+     619:	83 c4 10             	add    $0x10,%esp
+     61c:	85 c0                	test   %eax,%eax
+     61e:	79 17                	jns    637 <mktree+0x72>
+      fail("mkdir", path);
+     620:	83 ec 08             	sub    $0x8,%esp
+     623:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     629:	50                   	push   %eax
+     62a:	68 b7 1e 00 00       	push   $0x1eb7
+     62f:	e8 cc f9 ff ff       	call   0 <fail>
+     634:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++){
+     637:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     63b:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     63f:	7e ab                	jle    5ec <mktree+0x27>
+  }
+  if((fd = open(join(path, path, "file"), O_CREATE | O_WRONLY)) < 0)
+     641:	83 ec 04             	sub    $0x4,%esp
+     644:	68 88 1e 00 00       	push   $0x1e88
+     649:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     64f:	50                   	push   %eax
+     650:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     656:	50                   	push   %eax
+     657:	e8 e6 f9 ff ff       	call   42 <join>
+     65c:	83 c4 10             	add    $0x10,%esp
+     65f:	83 ec 08             	sub    $0x8,%esp
+     662:	68 01 02 00 00       	push   $0x201
+     667:	50                   	push   %eax
+     668:	e8 0d 0d 00 00       	call   137a <open>
+     66d:	83 c4 10             	add    $0x10,%esp
+     670:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     673:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     677:	79 17                	jns    690 <mktree+0xcb>
+    fail("create", path);
+     679:	83 ec 08             	sub    $0x8,%esp
+     67c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     682:	50                   	push   %eax
+     683:	68 8d 1e 00 00       	push   $0x1e8d
+     688:	e8 73 f9 ff ff       	call   0 <fail>
+     68d:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     690:	83 ec 0c             	sub    $0xc,%esp
+     693:	ff 75 f0             	push   -0x10(%ebp)
+     696:	e8 ca 0c 00 00       	call   1365 <close>
+     69b:	83 c4 10             	add    $0x10,%esp
+  if(symlink("d/d/d", join(path, base, "link")) < 0)
+     69e:	83 ec 04             	sub    $0x4,%esp
+     6a1:	68 bd 1e 00 00       	push   $0x1ebd
+     6a6:	ff 75 08             	push   0x8(%ebp)
+     6a9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     6af:	50                   	push   %eax
+     6b0:	e8 8d f9 ff ff       	call   42 <join>
+     6b5:	83 c4 10             	add    $0x10,%esp
+     6b8:	83 ec 08             	sub    $0x8,%esp
+     6bb:	50                   	push   %eax
+     6bc:	68 c2 1e 00 00       	push   $0x1ec2
+     6c1:	e8 2c 0d 00 00       	call   13f2 <symlink>
+     6c6:	83 c4 10             	add    $0x10,%esp
+     6c9:	85 c0                	test   %eax,%eax
+     6cb:	79 17                	jns    6e4 <mktree+0x11f>
+    fail("symlink", path);
+     6cd:	83 ec 08             	sub    $0x8,%esp
+     6d0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     6d6:	50                   	push   %eax
+     6d7:	68 c8 1e 00 00       	push   $0x1ec8
+     6dc:	e8 1f f9 ff ff       	call   0 <fail>
+     6e1:	83 c4 10             	add    $0x10,%esp
+}
+     6e4:	90                   	nop
+     6e5:	c9                   	leave
+     6e6:	c3                   	ret
+
+000006e7 <rmtree>:
+
+static void
+rmtree(char *base)
+{
+     6e7:	55                   	push   %ebp
+     6e8:	89 e5                	mov    %esp,%ebp
+     6ea:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int i, n;
+
+  unlink(join(path, base, "link"));
+     6f0:	83 ec 04             	sub    $0x4,%esp
+     6f3:	68 bd 1e 00 00       	push   $0x1ebd
+     6f8:	ff 75 08             	push   0x8(%ebp)
+     6fb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     701:	50                   	push   %eax
+     702:	e8 3b f9 ff ff       	call   42 <join>
+     707:	83 c4 10             	add    $0x10,%esp
+     70a:	83 ec 0c             	sub    $0xc,%esp
+     70d:	50                   	push   %eax
+     70e:	e8 7b 0c 00 00       	call   138e <unlink>
+     713:	83 c4 10             	add    $0x10,%esp
+  strcpy(path, base);
+     716:	83 ec 08             	sub    $0x8,%esp
+     719:	ff 75 08             	push   0x8(%ebp)
+     71c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     722:	50                   	push   %eax
+     723:	e8 a9 09 00 00       	call   10d1 <strcpy>
+     728:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++)
+     72b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     732:	eb 22                	jmp    756 <rmtree+0x6f>
+    join(path, path, "d");
+     734:	83 ec 04             	sub    $0x4,%esp
+     737:	68 b5 1e 00 00       	push   $0x1eb5
+     73c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     742:	50                   	push   %eax
+     743:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     749:	50                   	push   %eax
+     74a:	e8 f3 f8 ff ff       	call   42 <join>
+     74f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++)
+     752:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     756:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     75a:	7e d8                	jle    734 <rmtree+0x4d>
+  unlink(join(path, path, "file"));
+     75c:	83 ec 04             	sub    $0x4,%esp
+     75f:	68 88 1e 00 00       	push   $0x1e88
+     764:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     76a:	50                   	push   %eax
+     76b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     771:	50                   	push   %eax
+     772:	e8 cb f8 ff ff       	call   42 <join>
+     777:	83 c4 10             	add    $0x10,%esp
+     77a:	83 ec 0c             	sub    $0xc,%esp
+     77d:	50                   	push   %eax
+     77e:	e8 0b 0c 00 00       	call   138e <unlink>
+     783:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++){
+     786:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     78d:	eb 50                	jmp    7df <rmtree+0xf8>
+    n = strlen(path);
+     78f:	83 ec 0c             	sub    $0xc,%esp
+     792:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     798:	50                   	push   %eax
+     799:	e8 a2 09 00 00       	call   1140 <strlen>
+     79e:	83 c4 10             	add    $0x10,%esp
+     7a1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while(path[--n] != '/')
+     7a4:	90                   	nop
+     7a5:	83 6d f0 01          	subl   $0x1,-0x10(%ebp)
+     7a9:	8d 95 f0 fe ff ff    	lea    -0x110(%ebp),%edx
+     7af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7b2:	01 d0                	add    %edx,%eax
+     7b4:	0f b6 00             	movzbl (%eax),%eax
+     7b7:	3c 2f                	cmp    $0x2f,%al
+     7b9:	75 ea                	jne    7a5 <rmtree+0xbe>
+      ;
+    path[n] = 0;
+     7bb:	8d 95 f0 fe ff ff    	lea    -0x110(%ebp),%edx
+     7c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7c4:	01 d0                	add    %edx,%eax
+     7c6:	c6 00 00             	movb   $0x0,(%eax)
+    unlink(path);
+     7c9:	83 ec 0c             	sub    $0xc,%esp
+     7cc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     7d2:	50                   	push   %eax
+     7d3:	e8 b6 0b 00 00       	call   138e <unlink>
+     7d8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DEPTH; i++){
+     7db:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     7df:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     7e3:	7e aa                	jle    78f <rmtree+0xa8>
+  }
+}
+     7e5:	90                   	nop
+     7e6:	90                   	nop
+     7e7:	c9                   	leave
+     7e8:	c3                   	ret
+
+000007e9 <lookup>:
+
+static void
+lookup(char *base, struct result *r)
+{
+     7e9:	55                   	push   %ebp
+     7ea:	89 e5                	mov    %esp,%ebp
+     7ec:	81 ec 28 01 00 00    	sub    $0x128,%esp
+  char path[MAXPATH];
+  struct stat st;
+  int i;
+
+  join(path, base, "link");
+     7f2:	83 ec 04             	sub    $0x4,%esp
+     7f5:	68 bd 1e 00 00       	push   $0x1ebd
+     7fa:	ff 75 08             	push   0x8(%ebp)
+     7fd:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     803:	50                   	push   %eax
+     804:	e8 39 f8 ff ff       	call   42 <join>
+     809:	83 c4 10             	add    $0x10,%esp
+  for(i = 3; i < DEPTH; i++)
+     80c:	c7 45 f4 03 00 00 00 	movl   $0x3,-0xc(%ebp)
+     813:	eb 22                	jmp    837 <lookup+0x4e>
+    join(path, path, "d");
+     815:	83 ec 04             	sub    $0x4,%esp
+     818:	68 b5 1e 00 00       	push   $0x1eb5
+     81d:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     823:	50                   	push   %eax
+     824:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     82a:	50                   	push   %eax
+     82b:	e8 12 f8 ff ff       	call   42 <join>
+     830:	83 c4 10             	add    $0x10,%esp
+  for(i = 3; i < DEPTH; i++)
+     833:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     837:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     83b:	7e d8                	jle    815 <lookup+0x2c>
+  join(path, path, "file");
+     83d:	83 ec 04             	sub    $0x4,%esp
+     840:	68 88 1e 00 00       	push   $0x1e88
+     845:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     84b:	50                   	push   %eax
+     84c:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     852:	50                   	push   %eax
+     853:	e8 ea f7 ff ff       	call   42 <join>
+     858:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NLOOKUP; i++)
+     85b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     862:	eb 38                	jmp    89c <lookup+0xb3>
+    if(stat(path, &st) < 0)
+     864:	83 ec 08             	sub    $0x8,%esp
+     867:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+     86d:	50                   	push   %eax
+     86e:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     874:	50                   	push   %eax
+     875:	e8 a9 09 00 00       	call   1223 <stat>
+     87a:	83 c4 10             	add    $0x10,%esp
+     87d:	85 c0                	test   %eax,%eax
+     87f:	79 17                	jns    898 <lookup+0xaf>
+      fail("stat", path);
+     881:	83 ec 08             	sub    $0x8,%esp
+     884:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     88a:	50                   	push   %eax
+     88b:	68 d0 1e 00 00       	push   $0x1ed0
+     890:	e8 6b f7 ff ff       	call   0 <fail>
+     895:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NLOOKUP; i++)
+     898:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     89c:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+     8a3:	7e bf                	jle    864 <lookup+0x7b>
+  r->ops = NLOOKUP;
+     8a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8a8:	c7 00 f4 01 00 00    	movl   $0x1f4,(%eax)
+}
+     8ae:	90                   	nop
+     8af:	c9                   	leave
+     8b0:	c3                   	ret
+
+000008b1 <mkscan>:
+
+// Reading a directory of NSCANF files, with getdents.
+
+static void
+mkscan(char *base)
+{
+     8b1:	55                   	push   %ebp
+     8b2:	89 e5                	mov    %esp,%ebp
+     8b4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int fd, i;
+
+  if(mkdir(join(path, base, "scan")) < 0)
+     8ba:	83 ec 04             	sub    $0x4,%esp
+     8bd:	68 d5 1e 00 00       	push   $0x1ed5
+     8c2:	ff 75 08             	push   0x8(%ebp)
+     8c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     8cb:	50                   	push   %eax
+     8cc:	e8 71 f7 ff ff       	call   42 <join>
+     8d1:	83 c4 10             	add    $0x10,%esp
+     8d4:	83 ec 0c             	sub    $0xc,%esp
+     8d7:	50                   	push   %eax
+     8d8:	e8 cf 0a 00 00       	call   13ac <mkdir>
+     8dd:	83 c4 10             	add    $0x10,%esp
+     8e0:	85 c0                	test   %eax,%eax
+     8e2:	79 17                	jns    8fb <mkscan+0x4a>
+    fail("mkdir", path);
+     8e4:	83 ec 08             	sub    $0x8,%esp
+     8e7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     8ed:	50                   	push   %eax
+     8ee:	68 b7 1e 00 00       	push   $0x1eb7
+     8f3:	e8 08 f7 ff ff       	call   0 <fail>
+     8f8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSCANF; i++){
+     8fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     902:	eb 7b                	jmp    97f <mkscan+0xce>
+    join(path, base, "scan");
+     904:	83 ec 04             	sub    $0x4,%esp
+     907:	68 d5 1e 00 00       	push   $0x1ed5
+     90c:	ff 75 08             	push   0x8(%ebp)
+     90f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     915:	50                   	push   %eax
+     916:	e8 27 f7 ff ff       	call   42 <join>
+     91b:	83 c4 10             	add    $0x10,%esp
+    if((fd = open(numname(path, path, "s", i), O_CREATE | O_WRONLY)) < 0)
+     91e:	ff 75 f4             	push   -0xc(%ebp)
+     921:	68 da 1e 00 00       	push   $0x1eda
+     926:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     92c:	50                   	push   %eax
+     92d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     933:	50                   	push   %eax
+     934:	e8 93 f7 ff ff       	call   cc <numname>
+     939:	83 c4 10             	add    $0x10,%esp
+     93c:	83 ec 08             	sub    $0x8,%esp
+     93f:	68 01 02 00 00       	push   $0x201
+     944:	50                   	push   %eax
+     945:	e8 30 0a 00 00       	call   137a <open>
+     94a:	83 c4 10             	add    $0x10,%esp
+     94d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     950:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     954:	79 17                	jns    96d <mkscan+0xbc>
+      fail("create", path);
+     956:	83 ec 08             	sub    $0x8,%esp
+     959:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     95f:	50                   	push   %eax
+     960:	68 8d 1e 00 00       	push   $0x1e8d
+     965:	e8 96 f6 ff ff       	call   0 <fail>
+     96a:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     96d:	83 ec 0c             	sub    $0xc,%esp
+     970:	ff 75 f0             	push   -0x10(%ebp)
+     973:	e8 ed 09 00 00       	call   1365 <close>
+     978:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSCANF; i++){
+     97b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     97f:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+     983:	0f 8e 7b ff ff ff    	jle    904 <mkscan+0x53>
+  }
+}
+     989:	90                   	nop
+     98a:	90                   	nop
+     98b:	c9                   	leave
+     98c:	c3                   	ret
+
+0000098d <rmscan>:
+
+static void
+rmscan(char *base)
+{
+     98d:	55                   	push   %ebp
+     98e:	89 e5                	mov    %esp,%ebp
+     990:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char path[MAXPATH];
+  int i;
+
+  for(i = 0; i < NSCANF; i++){
+     996:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     99d:	eb 48                	jmp    9e7 <rmscan+0x5a>
+    join(path, base, "scan");
+     99f:	83 ec 04             	sub    $0x4,%esp
+     9a2:	68 d5 1e 00 00       	push   $0x1ed5
+     9a7:	ff 75 08             	push   0x8(%ebp)
+     9aa:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     9b0:	50                   	push   %eax
+     9b1:	e8 8c f6 ff ff       	call   42 <join>
+     9b6:	83 c4 10             	add    $0x10,%esp
+    unlink(numname(path, path, "s", i));
+     9b9:	ff 75 f4             	push   -0xc(%ebp)
+     9bc:	68 da 1e 00 00       	push   $0x1eda
+     9c1:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     9c7:	50                   	push   %eax
+     9c8:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     9ce:	50                   	push   %eax
+     9cf:	e8 f8 f6 ff ff       	call   cc <numname>
+     9d4:	83 c4 10             	add    $0x10,%esp
+     9d7:	83 ec 0c             	sub    $0xc,%esp
+     9da:	50                   	push   %eax
+     9db:	e8 ae 09 00 00       	call   138e <unlink>
+     9e0:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSCANF; i++){
+     9e3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     9e7:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+     9eb:	7e b2                	jle    99f <rmscan+0x12>
+  }
+  unlink(join(path, base, "scan"));
+     9ed:	83 ec 04             	sub    $0x4,%esp
+     9f0:	68 d5 1e 00 00       	push   $0x1ed5
+     9f5:	ff 75 08             	push   0x8(%ebp)
+     9f8:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     9fe:	50                   	push   %eax
+     9ff:	e8 3e f6 ff ff       	call   42 <join>
+     a04:	83 c4 10             	add    $0x10,%esp
+     a07:	83 ec 0c             	sub    $0xc,%esp
+     a0a:	50                   	push   %eax
+     a0b:	e8 7e 09 00 00       	call   138e <unlink>
+     a10:	83 c4 10             	add    $0x10,%esp
+}
+     a13:	90                   	nop
+     a14:	c9                   	leave
+     a15:	c3                   	ret
+
+00000a16 <scan>:
+
+static void
+scan(char *base, struct result *r)
+{
+     a16:	55                   	push   %ebp
+     a17:	89 e5                	mov    %esp,%ebp
+     a19:	81 ec d8 02 00 00    	sub    $0x2d8,%esp
+  char path[MAXPATH];
+  struct dent d[16];
+  int fd, i, n;
+
+  join(path, base, "scan");
+     a1f:	83 ec 04             	sub    $0x4,%esp
+     a22:	68 d5 1e 00 00       	push   $0x1ed5
+     a27:	ff 75 08             	push   0x8(%ebp)
+     a2a:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     a30:	50                   	push   %eax
+     a31:	e8 0c f6 ff ff       	call   42 <join>
+     a36:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSCAN; i++){
+     a39:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     a40:	eb 77                	jmp    ab9 <scan+0xa3>
+    if((fd = open(path, O_RDONLY)) < 0)
+     a42:	83 ec 08             	sub    $0x8,%esp
+     a45:	6a 00                	push   $0x0
+     a47:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     a4d:	50                   	push   %eax
+     a4e:	e8 27 09 00 00       	call   137a <open>
+     a53:	83 c4 10             	add    $0x10,%esp
+     a56:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     a59:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a5d:	79 28                	jns    a87 <scan+0x71>
+      fail("open", path);
+     a5f:	83 ec 08             	sub    $0x8,%esp
+     a62:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+     a68:	50                   	push   %eax
+     a69:	68 9a 1e 00 00       	push   $0x1e9a
+     a6e:	e8 8d f5 ff ff       	call   0 <fail>
+     a73:	83 c4 10             	add    $0x10,%esp
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+     a76:	eb 0f                	jmp    a87 <scan+0x71>
+      r->ops += n;
+     a78:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a7b:	8b 10                	mov    (%eax),%edx
+     a7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a80:	01 c2                	add    %eax,%edx
+     a82:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a85:	89 10                	mov    %edx,(%eax)
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+     a87:	83 ec 04             	sub    $0x4,%esp
+     a8a:	6a 10                	push   $0x10
+     a8c:	8d 85 2c fd ff ff    	lea    -0x2d4(%ebp),%eax
+     a92:	50                   	push   %eax
+     a93:	ff 75 f0             	push   -0x10(%ebp)
+     a96:	e8 65 0a 00 00       	call   1500 <getdents>
+     a9b:	83 c4 10             	add    $0x10,%esp
+     a9e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     aa1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     aa5:	7f d1                	jg     a78 <scan+0x62>
+    close(fd);
+     aa7:	83 ec 0c             	sub    $0xc,%esp
+     aaa:	ff 75 f0             	push   -0x10(%ebp)
+     aad:	e8 b3 08 00 00       	call   1365 <close>
+     ab2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSCAN; i++){
+     ab5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ab9:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     abd:	7e 83                	jle    a42 <scan+0x2c>
+  }
+}
+     abf:	90                   	nop
+     ac0:	90                   	nop
+     ac1:	c9                   	leave
+     ac2:	c3                   	ret
+
+00000ac3 <runbench>:
+
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+static void
+runbench(struct bench *b, char *dir, int nproc)
+{
+     ac3:	55                   	push   %ebp
+     ac4:	89 e5                	mov    %esp,%ebp
+     ac6:	53                   	push   %ebx
+     ac7:	81 ec 24 01 00 00    	sub    $0x124,%esp
+  char base[MAXPATH];
+  struct result r, sum;
+  int i, p[2], t;
+
+  for(i = 0; i < nproc; i++)
+     acd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ad4:	eb 37                	jmp    b0d <runbench+0x4a>
+    if(b->setup)
+     ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad9:	8b 40 04             	mov    0x4(%eax),%eax
+     adc:	85 c0                	test   %eax,%eax
+     ade:	74 29                	je     b09 <runbench+0x46>
+      b->setup(numname(base, dir, "fsb", i));
+     ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae3:	8b 58 04             	mov    0x4(%eax),%ebx
+     ae6:	ff 75 f4             	push   -0xc(%ebp)
+     ae9:	68 07 1f 00 00       	push   $0x1f07
+     aee:	ff 75 0c             	push   0xc(%ebp)
+     af1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     af7:	50                   	push   %eax
+     af8:	e8 cf f5 ff ff       	call   cc <numname>
+     afd:	83 c4 10             	add    $0x10,%esp
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	50                   	push   %eax
+     b04:	ff d3                	call   *%ebx
+     b06:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+     b09:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b10:	3b 45 10             	cmp    0x10(%ebp),%eax
+     b13:	7c c1                	jl     ad6 <runbench+0x13>
+  if(pipe(p) < 0)
+     b15:	83 ec 0c             	sub    $0xc,%esp
+     b18:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+     b1e:	50                   	push   %eax
+     b1f:	e8 2c 08 00 00       	call   1350 <pipe>
+     b24:	83 c4 10             	add    $0x10,%esp
+     b27:	85 c0                	test   %eax,%eax
+     b29:	79 15                	jns    b40 <runbench+0x7d>
+    fail("pipe", "");
+     b2b:	83 ec 08             	sub    $0x8,%esp
+     b2e:	68 0b 1f 00 00       	push   $0x1f0b
+     b33:	68 0c 1f 00 00       	push   $0x1f0c
+     b38:	e8 c3 f4 ff ff       	call   0 <fail>
+     b3d:	83 c4 10             	add    $0x10,%esp
+
+  t = uptime();
+     b40:	e8 a3 08 00 00       	call   13e8 <uptime>
+     b45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < nproc; i++){
+     b48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     b4f:	e9 94 00 00 00       	jmp    be8 <runbench+0x125>
+    if(fork() == 0){
+     b54:	e8 e2 07 00 00       	call   133b <fork>
+     b59:	85 c0                	test   %eax,%eax
+     b5b:	0f 85 83 00 00 00    	jne    be4 <runbench+0x121>
+      close(p[0]);
+     b61:	8b 85 d8 fe ff ff    	mov    -0x128(%ebp),%eax
+     b67:	83 ec 0c             	sub    $0xc,%esp
+     b6a:	50                   	push   %eax
+     b6b:	e8 f5 07 00 00       	call   1365 <close>
+     b70:	83 c4 10             	add    $0x10,%esp
+      seed = i + 1;
+     b73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b76:	83 c0 01             	add    $0x1,%eax
+     b79:	a3 60 36 00 00       	mov    %eax,0x3660
+      memset(&r, 0, sizeof(r));
+     b7e:	83 ec 04             	sub    $0x4,%esp
+     b81:	6a 08                	push   $0x8
+     b83:	6a 00                	push   $0x0
+     b85:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+     b8b:	50                   	push   %eax
+     b8c:	e8 d6 05 00 00       	call   1167 <memset>
+     b91:	83 c4 10             	add    $0x10,%esp
+      b->run(numname(base, dir, "fsb", i), &r);
+     b94:	8b 45 08             	mov    0x8(%ebp),%eax
+     b97:	8b 58 08             	mov    0x8(%eax),%ebx
+     b9a:	ff 75 f4             	push   -0xc(%ebp)
+     b9d:	68 07 1f 00 00       	push   $0x1f07
+     ba2:	ff 75 0c             	push   0xc(%ebp)
+     ba5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     bab:	50                   	push   %eax
+     bac:	e8 1b f5 ff ff       	call   cc <numname>
+     bb1:	83 c4 10             	add    $0x10,%esp
+     bb4:	83 ec 08             	sub    $0x8,%esp
+     bb7:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+     bbd:	52                   	push   %edx
+     bbe:	50                   	push   %eax
+     bbf:	ff d3                	call   *%ebx
+     bc1:	83 c4 10             	add    $0x10,%esp
+      write(p[1], &r, sizeof(r));
+     bc4:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+     bca:	83 ec 04             	sub    $0x4,%esp
+     bcd:	6a 08                	push   $0x8
+     bcf:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+     bd5:	52                   	push   %edx
+     bd6:	50                   	push   %eax
+     bd7:	e8 82 07 00 00       	call   135e <write>
+     bdc:	83 c4 10             	add    $0x10,%esp
+      exit();
+     bdf:	e8 5e 07 00 00       	call   1342 <exit>
+  for(i = 0; i < nproc; i++){
+     be4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     beb:	3b 45 10             	cmp    0x10(%ebp),%eax
+     bee:	0f 8c 60 ff ff ff    	jl     b54 <runbench+0x91>
+    }
+  }
+  close(p[1]);
+     bf4:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+     bfa:	83 ec 0c             	sub    $0xc,%esp
+     bfd:	50                   	push   %eax
+     bfe:	e8 62 07 00 00       	call   1365 <close>
+     c03:	83 c4 10             	add    $0x10,%esp
+  memset(&sum, 0, sizeof(sum));
+     c06:	83 ec 04             	sub    $0x4,%esp
+     c09:	6a 08                	push   $0x8
+     c0b:	6a 00                	push   $0x0
+     c0d:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+     c13:	50                   	push   %eax
+     c14:	e8 4e 05 00 00       	call   1167 <memset>
+     c19:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++){
+     c1c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c23:	eb 62                	jmp    c87 <runbench+0x1c4>
+    if(read(p[0], &r, sizeof(r)) != sizeof(r))
+     c25:	8b 85 d8 fe ff ff    	mov    -0x128(%ebp),%eax
+     c2b:	83 ec 04             	sub    $0x4,%esp
+     c2e:	6a 08                	push   $0x8
+     c30:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+     c36:	52                   	push   %edx
+     c37:	50                   	push   %eax
+     c38:	e8 1a 07 00 00       	call   1357 <read>
+     c3d:	83 c4 10             	add    $0x10,%esp
+     c40:	83 f8 08             	cmp    $0x8,%eax
+     c43:	74 16                	je     c5b <runbench+0x198>
+      fail(b->name, "run");
+     c45:	8b 45 08             	mov    0x8(%ebp),%eax
+     c48:	8b 00                	mov    (%eax),%eax
+     c4a:	83 ec 08             	sub    $0x8,%esp
+     c4d:	68 11 1f 00 00       	push   $0x1f11
+     c52:	50                   	push   %eax
+     c53:	e8 a8 f3 ff ff       	call   0 <fail>
+     c58:	83 c4 10             	add    $0x10,%esp
+    sum.ops += r.ops;
+     c5b:	8b 95 e0 fe ff ff    	mov    -0x120(%ebp),%edx
+     c61:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+     c67:	01 d0                	add    %edx,%eax
+     c69:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+    sum.bytes += r.bytes;
+     c6f:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+     c75:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+     c7b:	01 d0                	add    %edx,%eax
+     c7d:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+  for(i = 0; i < nproc; i++){
+     c83:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     c87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c8a:	3b 45 10             	cmp    0x10(%ebp),%eax
+     c8d:	7c 96                	jl     c25 <runbench+0x162>
+  }
+  for(i = 0; i < nproc; i++)
+     c8f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c96:	eb 09                	jmp    ca1 <runbench+0x1de>
+    wait();
+     c98:	e8 ac 06 00 00       	call   1349 <wait>
+  for(i = 0; i < nproc; i++)
+     c9d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ca1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ca4:	3b 45 10             	cmp    0x10(%ebp),%eax
+     ca7:	7c ef                	jl     c98 <runbench+0x1d5>
+  t = uptime() - t;
+     ca9:	e8 3a 07 00 00       	call   13e8 <uptime>
+     cae:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     cb1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(p[0]);
+     cb4:	8b 85 d8 fe ff ff    	mov    -0x128(%ebp),%eax
+     cba:	83 ec 0c             	sub    $0xc,%esp
+     cbd:	50                   	push   %eax
+     cbe:	e8 a2 06 00 00       	call   1365 <close>
+     cc3:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < nproc; i++)
+     cc6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ccd:	eb 37                	jmp    d06 <runbench+0x243>
+    if(b->cleanup)
+     ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd2:	8b 40 0c             	mov    0xc(%eax),%eax
+     cd5:	85 c0                	test   %eax,%eax
+     cd7:	74 29                	je     d02 <runbench+0x23f>
+      b->cleanup(numname(base, dir, "fsb", i));
+     cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     cdc:	8b 58 0c             	mov    0xc(%eax),%ebx
+     cdf:	ff 75 f4             	push   -0xc(%ebp)
+     ce2:	68 07 1f 00 00       	push   $0x1f07
+     ce7:	ff 75 0c             	push   0xc(%ebp)
+     cea:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+     cf0:	50                   	push   %eax
+     cf1:	e8 d6 f3 ff ff       	call   cc <numname>
+     cf6:	83 c4 10             	add    $0x10,%esp
+     cf9:	83 ec 0c             	sub    $0xc,%esp
+     cfc:	50                   	push   %eax
+     cfd:	ff d3                	call   *%ebx
+     cff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+     d02:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d09:	3b 45 10             	cmp    0x10(%ebp),%eax
+     d0c:	7c c1                	jl     ccf <runbench+0x20c>
+
+  printf(1, "%s: %d procs, %d ops in %d ticks", b->name, nproc, sum.ops, t);
+     d0e:	8b 95 e0 fe ff ff    	mov    -0x120(%ebp),%edx
+     d14:	8b 45 08             	mov    0x8(%ebp),%eax
+     d17:	8b 00                	mov    (%eax),%eax
+     d19:	83 ec 08             	sub    $0x8,%esp
+     d1c:	ff 75 f0             	push   -0x10(%ebp)
+     d1f:	52                   	push   %edx
+     d20:	ff 75 10             	push   0x10(%ebp)
+     d23:	50                   	push   %eax
+     d24:	68 18 1f 00 00       	push   $0x1f18
+     d29:	6a 01                	push   $0x1
+     d2b:	e8 a2 0a 00 00       	call   17d2 <printf>
+     d30:	83 c4 20             	add    $0x20,%esp
+  if(t == 0)
+     d33:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d37:	75 07                	jne    d40 <runbench+0x27d>
+    t = 1;
+     d39:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  printf(1, ", %d ops/s", sum.ops * HZ / t);
+     d40:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+     d46:	6b c0 64             	imul   $0x64,%eax,%eax
+     d49:	99                   	cltd
+     d4a:	f7 7d f0             	idivl  -0x10(%ebp)
+     d4d:	83 ec 04             	sub    $0x4,%esp
+     d50:	50                   	push   %eax
+     d51:	68 39 1f 00 00       	push   $0x1f39
+     d56:	6a 01                	push   $0x1
+     d58:	e8 75 0a 00 00       	call   17d2 <printf>
+     d5d:	83 c4 10             	add    $0x10,%esp
+  if(sum.bytes)
+     d60:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+     d66:	85 c0                	test   %eax,%eax
+     d68:	74 2e                	je     d98 <runbench+0x2d5>
+    printf(1, ", %d KB/s", sum.bytes / 1024 * HZ / t);
+     d6a:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+     d70:	8d 90 ff 03 00 00    	lea    0x3ff(%eax),%edx
+     d76:	85 c0                	test   %eax,%eax
+     d78:	0f 48 c2             	cmovs  %edx,%eax
+     d7b:	c1 f8 0a             	sar    $0xa,%eax
+     d7e:	6b c0 64             	imul   $0x64,%eax,%eax
+     d81:	99                   	cltd
+     d82:	f7 7d f0             	idivl  -0x10(%ebp)
+     d85:	83 ec 04             	sub    $0x4,%esp
+     d88:	50                   	push   %eax
+     d89:	68 44 1f 00 00       	push   $0x1f44
+     d8e:	6a 01                	push   $0x1
+     d90:	e8 3d 0a 00 00       	call   17d2 <printf>
+     d95:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+     d98:	83 ec 08             	sub    $0x8,%esp
+     d9b:	68 4e 1f 00 00       	push   $0x1f4e
+     da0:	6a 01                	push   $0x1
+     da2:	e8 2b 0a 00 00       	call   17d2 <printf>
+     da7:	83 c4 10             	add    $0x10,%esp
+}
+     daa:	90                   	nop
+     dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dae:	c9                   	leave
+     daf:	c3                   	ret
+
+00000db0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     db0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     db4:	83 e4 f0             	and    $0xfffffff0,%esp
+     db7:	ff 71 fc             	push   -0x4(%ecx)
+     dba:	55                   	push   %ebp
+     dbb:	89 e5                	mov    %esp,%ebp
+     dbd:	53                   	push   %ebx
+     dbe:	51                   	push   %ecx
+     dbf:	81 ec 10 01 00 00    	sub    $0x110,%esp
+     dc5:	89 cb                	mov    %ecx,%ebx
+  char base[MAXPATH], *dir;
+  int i, j, nproc;
+
+  nproc = 1;
+     dc7:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+  dir = ".";
+     dce:	c7 45 f4 50 1f 00 00 	movl   $0x1f50,-0xc(%ebp)
+  for(i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2){
+     dd5:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+     ddc:	e9 dc 00 00 00       	jmp    ebd <main+0x10d>
+    if(strcmp(argv[i], "-p") == 0)
+     de1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     de4:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     deb:	8b 43 04             	mov    0x4(%ebx),%eax
+     dee:	01 d0                	add    %edx,%eax
+     df0:	8b 00                	mov    (%eax),%eax
+     df2:	83 ec 08             	sub    $0x8,%esp
+     df5:	68 52 1f 00 00       	push   $0x1f52
+     dfa:	50                   	push   %eax
+     dfb:	e8 01 03 00 00       	call   1101 <strcmp>
+     e00:	83 c4 10             	add    $0x10,%esp
+     e03:	85 c0                	test   %eax,%eax
+     e05:	75 28                	jne    e2f <main+0x7f>
+      nproc = atoi(argv[i+1]);
+     e07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e0a:	83 c0 01             	add    $0x1,%eax
+     e0d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     e14:	8b 43 04             	mov    0x4(%ebx),%eax
+     e17:	01 d0                	add    %edx,%eax
+     e19:	8b 00                	mov    (%eax),%eax
+     e1b:	83 ec 0c             	sub    $0xc,%esp
+     e1e:	50                   	push   %eax
+     e1f:	e8 4c 04 00 00       	call   1270 <atoi>
+     e24:	83 c4 10             	add    $0x10,%esp
+     e27:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     e2a:	e9 8a 00 00 00       	jmp    eb9 <main+0x109>
+    else if(strcmp(argv[i], "-s") == 0)
+     e2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e32:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     e39:	8b 43 04             	mov    0x4(%ebx),%eax
+     e3c:	01 d0                	add    %edx,%eax
+     e3e:	8b 00                	mov    (%eax),%eax
+     e40:	83 ec 08             	sub    $0x8,%esp
+     e43:	68 55 1f 00 00       	push   $0x1f55
+     e48:	50                   	push   %eax
+     e49:	e8 b3 02 00 00       	call   1101 <strcmp>
+     e4e:	83 c4 10             	add    $0x10,%esp
+     e51:	85 c0                	test   %eax,%eax
+     e53:	75 27                	jne    e7c <main+0xcc>
+      kb = atoi(argv[i+1]);
+     e55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e58:	83 c0 01             	add    $0x1,%eax
+     e5b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     e62:	8b 43 04             	mov    0x4(%ebx),%eax
+     e65:	01 d0                	add    %edx,%eax
+     e67:	8b 00                	mov    (%eax),%eax
+     e69:	83 ec 0c             	sub    $0xc,%esp
+     e6c:	50                   	push   %eax
+     e6d:	e8 fe 03 00 00       	call   1270 <atoi>
+     e72:	83 c4 10             	add    $0x10,%esp
+     e75:	a3 a0 25 00 00       	mov    %eax,0x25a0
+     e7a:	eb 3d                	jmp    eb9 <main+0x109>
+    else if(strcmp(argv[i], "-d") == 0)
+     e7c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e7f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     e86:	8b 43 04             	mov    0x4(%ebx),%eax
+     e89:	01 d0                	add    %edx,%eax
+     e8b:	8b 00                	mov    (%eax),%eax
+     e8d:	83 ec 08             	sub    $0x8,%esp
+     e90:	68 58 1f 00 00       	push   $0x1f58
+     e95:	50                   	push   %eax
+     e96:	e8 66 02 00 00       	call   1101 <strcmp>
+     e9b:	83 c4 10             	add    $0x10,%esp
+     e9e:	85 c0                	test   %eax,%eax
+     ea0:	75 43                	jne    ee5 <main+0x135>
+      dir = argv[i+1];
+     ea2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ea5:	83 c0 01             	add    $0x1,%eax
+     ea8:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     eaf:	8b 43 04             	mov    0x4(%ebx),%eax
+     eb2:	01 d0                	add    %edx,%eax
+     eb4:	8b 00                	mov    (%eax),%eax
+     eb6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2){
+     eb9:	83 45 f0 02          	addl   $0x2,-0x10(%ebp)
+     ebd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ec0:	83 c0 01             	add    $0x1,%eax
+     ec3:	39 03                	cmp    %eax,(%ebx)
+     ec5:	7e 1f                	jle    ee6 <main+0x136>
+     ec7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eca:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     ed1:	8b 43 04             	mov    0x4(%ebx),%eax
+     ed4:	01 d0                	add    %edx,%eax
+     ed6:	8b 00                	mov    (%eax),%eax
+     ed8:	0f b6 00             	movzbl (%eax),%eax
+     edb:	3c 2d                	cmp    $0x2d,%al
+     edd:	0f 84 fe fe ff ff    	je     de1 <main+0x31>
+     ee3:	eb 01                	jmp    ee6 <main+0x136>
+    else
+      break;
+     ee5:	90                   	nop
+  }
+  if((i < argc && argv[i][0] == '-') || nproc < 1 || nproc > MAXPROC ||
+     ee6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ee9:	3b 03                	cmp    (%ebx),%eax
+     eeb:	7d 18                	jge    f05 <main+0x155>
+     eed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ef0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     ef7:	8b 43 04             	mov    0x4(%ebx),%eax
+     efa:	01 d0                	add    %edx,%eax
+     efc:	8b 00                	mov    (%eax),%eax
+     efe:	0f b6 00             	movzbl (%eax),%eax
+     f01:	3c 2d                	cmp    $0x2d,%al
+     f03:	74 16                	je     f1b <main+0x16b>
+     f05:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     f09:	7e 10                	jle    f1b <main+0x16b>
+     f0b:	83 7d e8 08          	cmpl   $0x8,-0x18(%ebp)
+     f0f:	7f 0a                	jg     f1b <main+0x16b>
+     kb < IOSIZE / 1024){
+     f11:	a1 a0 25 00 00       	mov    0x25a0,%eax
+  if((i < argc && argv[i][0] == '-') || nproc < 1 || nproc > MAXPROC ||
+     f16:	83 f8 03             	cmp    $0x3,%eax
+     f19:	7f 17                	jg     f32 <main+0x182>
+    printf(2, "usage: fsbench [-p nproc] [-s kb] [-d dir] [bench ...]\n");
+     f1b:	83 ec 08             	sub    $0x8,%esp
+     f1e:	68 5c 1f 00 00       	push   $0x1f5c
+     f23:	6a 02                	push   $0x2
+     f25:	e8 a8 08 00 00       	call   17d2 <printf>
+     f2a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f2d:	e8 10 04 00 00       	call   1342 <exit>
+  }
+
+  for(j = 0; j < nproc; j++)
+     f32:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     f39:	eb 45                	jmp    f80 <main+0x1d0>
+    if(mkdir(numname(base, dir, "fsb", j)) < 0)
+     f3b:	ff 75 ec             	push   -0x14(%ebp)
+     f3e:	68 07 1f 00 00       	push   $0x1f07
+     f43:	ff 75 f4             	push   -0xc(%ebp)
+     f46:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+     f4c:	50                   	push   %eax
+     f4d:	e8 7a f1 ff ff       	call   cc <numname>
+     f52:	83 c4 10             	add    $0x10,%esp
+     f55:	83 ec 0c             	sub    $0xc,%esp
+     f58:	50                   	push   %eax
+     f59:	e8 4e 04 00 00       	call   13ac <mkdir>
+     f5e:	83 c4 10             	add    $0x10,%esp
+     f61:	85 c0                	test   %eax,%eax
+     f63:	79 17                	jns    f7c <main+0x1cc>
+      fail("mkdir", base);
+     f65:	83 ec 08             	sub    $0x8,%esp
+     f68:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+     f6e:	50                   	push   %eax
+     f6f:	68 b7 1e 00 00       	push   $0x1eb7
+     f74:	e8 87 f0 ff ff       	call   0 <fail>
+     f79:	83 c4 10             	add    $0x10,%esp
+  for(j = 0; j < nproc; j++)
+     f7c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     f80:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f83:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     f86:	7c b3                	jl     f3b <main+0x18b>
+  if(i == argc)
+     f88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f8b:	3b 03                	cmp    (%ebx),%eax
+     f8d:	0f 85 cd 00 00 00    	jne    1060 <main+0x2b0>
+    for(j = 0; j < NBENCH; j++)
+     f93:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     f9a:	eb 21                	jmp    fbd <main+0x20d>
+      runbench(&benches[j], dir, nproc);
+     f9c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f9f:	c1 e0 04             	shl    $0x4,%eax
+     fa2:	05 c0 25 00 00       	add    $0x25c0,%eax
+     fa7:	83 ec 04             	sub    $0x4,%esp
+     faa:	ff 75 e8             	push   -0x18(%ebp)
+     fad:	ff 75 f4             	push   -0xc(%ebp)
+     fb0:	50                   	push   %eax
+     fb1:	e8 0d fb ff ff       	call   ac3 <runbench>
+     fb6:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < NBENCH; j++)
+     fb9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     fbd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc0:	83 f8 06             	cmp    $0x6,%eax
+     fc3:	76 d7                	jbe    f9c <main+0x1ec>
+  for(; i < argc; i++){
+     fc5:	e9 96 00 00 00       	jmp    1060 <main+0x2b0>
+    for(j = 0; j < NBENCH; j++)
+     fca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     fd1:	eb 33                	jmp    1006 <main+0x256>
+      if(strcmp(argv[i], benches[j].name) == 0)
+     fd3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fd6:	c1 e0 04             	shl    $0x4,%eax
+     fd9:	05 c0 25 00 00       	add    $0x25c0,%eax
+     fde:	8b 10                	mov    (%eax),%edx
+     fe0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fe3:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+     fea:	8b 43 04             	mov    0x4(%ebx),%eax
+     fed:	01 c8                	add    %ecx,%eax
+     fef:	8b 00                	mov    (%eax),%eax
+     ff1:	83 ec 08             	sub    $0x8,%esp
+     ff4:	52                   	push   %edx
+     ff5:	50                   	push   %eax
+     ff6:	e8 06 01 00 00       	call   1101 <strcmp>
+     ffb:	83 c4 10             	add    $0x10,%esp
+     ffe:	85 c0                	test   %eax,%eax
+    1000:	74 0e                	je     1010 <main+0x260>
+    for(j = 0; j < NBENCH; j++)
+    1002:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1006:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1009:	83 f8 06             	cmp    $0x6,%eax
+    100c:	76 c5                	jbe    fd3 <main+0x223>
+    100e:	eb 01                	jmp    1011 <main+0x261>
+        break;
+    1010:	90                   	nop
+    if(j < NBENCH)
+    1011:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1014:	83 f8 06             	cmp    $0x6,%eax
+    1017:	77 1f                	ja     1038 <main+0x288>
+      runbench(&benches[j], dir, nproc);
+    1019:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101c:	c1 e0 04             	shl    $0x4,%eax
+    101f:	05 c0 25 00 00       	add    $0x25c0,%eax
+    1024:	83 ec 04             	sub    $0x4,%esp
+    1027:	ff 75 e8             	push   -0x18(%ebp)
+    102a:	ff 75 f4             	push   -0xc(%ebp)
+    102d:	50                   	push   %eax
+    102e:	e8 90 fa ff ff       	call   ac3 <runbench>
+    1033:	83 c4 10             	add    $0x10,%esp
+    1036:	eb 24                	jmp    105c <main+0x2ac>
+    else
+      printf(2, "fsbench: no benchmark %s\n", argv[i]);
+    1038:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    103b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1042:	8b 43 04             	mov    0x4(%ebx),%eax
+    1045:	01 d0                	add    %edx,%eax
+    1047:	8b 00                	mov    (%eax),%eax
+    1049:	83 ec 04             	sub    $0x4,%esp
+    104c:	50                   	push   %eax
+    104d:	68 94 1f 00 00       	push   $0x1f94
+    1052:	6a 02                	push   $0x2
+    1054:	e8 79 07 00 00       	call   17d2 <printf>
+    1059:	83 c4 10             	add    $0x10,%esp
+  for(; i < argc; i++){
+    105c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1060:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1063:	3b 03                	cmp    (%ebx),%eax
+    1065:	0f 8c 5f ff ff ff    	jl     fca <main+0x21a>
+  }
+  for(j = 0; j < nproc; j++)
+    106b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1072:	eb 2a                	jmp    109e <main+0x2ee>
+    unlink(numname(base, dir, "fsb", j));
+    1074:	ff 75 ec             	push   -0x14(%ebp)
+    1077:	68 07 1f 00 00       	push   $0x1f07
+    107c:	ff 75 f4             	push   -0xc(%ebp)
+    107f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+    1085:	50                   	push   %eax
+    1086:	e8 41 f0 ff ff       	call   cc <numname>
+    108b:	83 c4 10             	add    $0x10,%esp
+    108e:	83 ec 0c             	sub    $0xc,%esp
+    1091:	50                   	push   %eax
+    1092:	e8 f7 02 00 00       	call   138e <unlink>
+    1097:	83 c4 10             	add    $0x10,%esp
+  for(j = 0; j < nproc; j++)
+    109a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    109e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10a1:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+    10a4:	7c ce                	jl     1074 <main+0x2c4>
+  exit();
+    10a6:	e8 97 02 00 00       	call   1342 <exit>
+
+000010ab <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    10ab:	55                   	push   %ebp
+    10ac:	89 e5                	mov    %esp,%ebp
+    10ae:	57                   	push   %edi
+    10af:	53                   	push   %ebx
+    if(cc < 1)
+    10b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10b3:	8b 55 10             	mov    0x10(%ebp),%edx
+    10b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10b9:	89 cb                	mov    %ecx,%ebx
+    10bb:	89 df                	mov    %ebx,%edi
+    10bd:	89 d1                	mov    %edx,%ecx
+    10bf:	fc                   	cld
+    10c0:	f3 aa                	rep stos %al,%es:(%edi)
+    10c2:	89 ca                	mov    %ecx,%edx
+    10c4:	89 fb                	mov    %edi,%ebx
+    10c6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    10c9:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+    10cc:	90                   	nop
+    10cd:	5b                   	pop    %ebx
+    10ce:	5f                   	pop    %edi
+    10cf:	5d                   	pop    %ebp
+    10d0:	c3                   	ret
+
+000010d1 <strcpy>:
+{
+    10d1:	55                   	push   %ebp
+    10d2:	89 e5                	mov    %esp,%ebp
+    10d4:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+    10d7:	8b 45 08             	mov    0x8(%ebp),%eax
+    10da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    10dd:	90                   	nop
+    10de:	8b 55 0c             	mov    0xc(%ebp),%edx
+    10e1:	8d 42 01             	lea    0x1(%edx),%eax
+    10e4:	89 45 0c             	mov    %eax,0xc(%ebp)
+    10e7:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ea:	8d 48 01             	lea    0x1(%eax),%ecx
+    10ed:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    10f0:	0f b6 12             	movzbl (%edx),%edx
+    10f3:	88 10                	mov    %dl,(%eax)
+    10f5:	0f b6 00             	movzbl (%eax),%eax
+    10f8:	84 c0                	test   %al,%al
+    10fa:	75 e2                	jne    10de <strcpy+0xd>
+  return os;
+    10fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    10ff:	c9                   	leave
+    1100:	c3                   	ret
+
+00001101 <strcmp>:
+{
+    1101:	55                   	push   %ebp
+    1102:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    1104:	eb 08                	jmp    110e <strcmp+0xd>
+    p++, q++;
+    1106:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    110a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    110e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1111:	0f b6 00             	movzbl (%eax),%eax
+    1114:	84 c0                	test   %al,%al
+    1116:	74 10                	je     1128 <strcmp+0x27>
+    1118:	8b 45 08             	mov    0x8(%ebp),%eax
+    111b:	0f b6 10             	movzbl (%eax),%edx
+    111e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1121:	0f b6 00             	movzbl (%eax),%eax
+    1124:	38 c2                	cmp    %al,%dl
+    1126:	74 de                	je     1106 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    1128:	8b 45 08             	mov    0x8(%ebp),%eax
+    112b:	0f b6 00             	movzbl (%eax),%eax
+    112e:	0f b6 d0             	movzbl %al,%edx
+    1131:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1134:	0f b6 00             	movzbl (%eax),%eax
+    1137:	0f b6 c0             	movzbl %al,%eax
+    113a:	29 c2                	sub    %eax,%edx
+    113c:	89 d0                	mov    %edx,%eax
+}
+    113e:	5d                   	pop    %ebp
+    113f:	c3                   	ret
+
+00001140 <strlen>:
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+    1146:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    114d:	eb 04                	jmp    1153 <strlen+0x13>
+    114f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1153:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    1156:	8b 45 08             	mov    0x8(%ebp),%eax
+    1159:	01 d0                	add    %edx,%eax
+    115b:	0f b6 00             	movzbl (%eax),%eax
+    115e:	84 c0                	test   %al,%al
+    1160:	75 ed                	jne    114f <strlen+0xf>
+  return n;
+    1162:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1165:	c9                   	leave
+    1166:	c3                   	ret
+
+00001167 <memset>:
+{
+    1167:	55                   	push   %ebp
+    1168:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    116a:	8b 45 10             	mov    0x10(%ebp),%eax
+    116d:	50                   	push   %eax
+    116e:	ff 75 0c             	push   0xc(%ebp)
+    1171:	ff 75 08             	push   0x8(%ebp)
+    1174:	e8 32 ff ff ff       	call   10ab <stosb>
+    1179:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    117c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    117f:	c9                   	leave
+    1180:	c3                   	ret
+
+00001181 <strchr>:
+{
+    1181:	55                   	push   %ebp
+    1182:	89 e5                	mov    %esp,%ebp
+    1184:	83 ec 04             	sub    $0x4,%esp
+    1187:	8b 45 0c             	mov    0xc(%ebp),%eax
+    118a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    118d:	eb 14                	jmp    11a3 <strchr+0x22>
+    if(*s == c)
+    118f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1192:	0f b6 00             	movzbl (%eax),%eax
+    1195:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    1198:	75 05                	jne    119f <strchr+0x1e>
+      return (char*)s;
+    119a:	8b 45 08             	mov    0x8(%ebp),%eax
+    119d:	eb 13                	jmp    11b2 <strchr+0x31>
+  for(; *s; s++)
+    119f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    11a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a6:	0f b6 00             	movzbl (%eax),%eax
+    11a9:	84 c0                	test   %al,%al
+    11ab:	75 e2                	jne    118f <strchr+0xe>
+  return 0;
+    11ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11b2:	c9                   	leave
+    11b3:	c3                   	ret
+
+000011b4 <gets>:
+{
+    11b4:	55                   	push   %ebp
+    11b5:	89 e5                	mov    %esp,%ebp
+    11b7:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+    11ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11c1:	eb 42                	jmp    1205 <gets+0x51>
+    cc = read(0, &c, 1);
+    11c3:	83 ec 04             	sub    $0x4,%esp
+    11c6:	6a 01                	push   $0x1
+    11c8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    11cb:	50                   	push   %eax
+    11cc:	6a 00                	push   $0x0
+    11ce:	e8 84 01 00 00       	call   1357 <read>
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    11d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11dd:	7e 33                	jle    1212 <gets+0x5e>
+    buf[i++] = c;
+    11df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11e2:	8d 50 01             	lea    0x1(%eax),%edx
+    11e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    11e8:	89 c2                	mov    %eax,%edx
+    11ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ed:	01 c2                	add    %eax,%edx
+    11ef:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    11f3:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    11f5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    11f9:	3c 0a                	cmp    $0xa,%al
+    11fb:	74 16                	je     1213 <gets+0x5f>
+    11fd:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1201:	3c 0d                	cmp    $0xd,%al
+    1203:	74 0e                	je     1213 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    1205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1208:	83 c0 01             	add    $0x1,%eax
+    120b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    120e:	7f b3                	jg     11c3 <gets+0xf>
+    1210:	eb 01                	jmp    1213 <gets+0x5f>
+      break;
+    1212:	90                   	nop
+  }
+  buf[i] = '\0';
+    1213:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1216:	8b 45 08             	mov    0x8(%ebp),%eax
+    1219:	01 d0                	add    %edx,%eax
+    121b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    121e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1221:	c9                   	leave
+    1222:	c3                   	ret
+
+00001223 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1223:	55                   	push   %ebp
+    1224:	89 e5                	mov    %esp,%ebp
+    1226:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1229:	83 ec 08             	sub    $0x8,%esp
+    122c:	6a 00                	push   $0x0
+    122e:	ff 75 08             	push   0x8(%ebp)
+    1231:	e8 44 01 00 00       	call   137a <open>
+    1236:	83 c4 10             	add    $0x10,%esp
+    1239:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    123c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1240:	79 07                	jns    1249 <stat+0x26>
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1247:	eb 25                	jmp    126e <stat+0x4b>
+  r = fstat(fd, st);
+    1249:	83 ec 08             	sub    $0x8,%esp
+    124c:	ff 75 0c             	push   0xc(%ebp)
+    124f:	ff 75 f4             	push   -0xc(%ebp)
+    1252:	e8 41 01 00 00       	call   1398 <fstat>
+    1257:	83 c4 10             	add    $0x10,%esp
+    125a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    125d:	83 ec 0c             	sub    $0xc,%esp
+    1260:	ff 75 f4             	push   -0xc(%ebp)
+    1263:	e8 fd 00 00 00       	call   1365 <close>
+    1268:	83 c4 10             	add    $0x10,%esp
+  return r;
+    126b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    126e:	c9                   	leave
+    126f:	c3                   	ret
+
+00001270 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    1276:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    127d:	eb 25                	jmp    12a4 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    127f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    1282:	89 d0                	mov    %edx,%eax
+    1284:	c1 e0 02             	shl    $0x2,%eax
+    1287:	01 d0                	add    %edx,%eax
+    1289:	01 c0                	add    %eax,%eax
+    128b:	89 c1                	mov    %eax,%ecx
+    128d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1290:	8d 50 01             	lea    0x1(%eax),%edx
+    1293:	89 55 08             	mov    %edx,0x8(%ebp)
+    1296:	0f b6 00             	movzbl (%eax),%eax
+    1299:	0f be c0             	movsbl %al,%eax
+    129c:	01 c8                	add    %ecx,%eax
+    129e:	83 e8 30             	sub    $0x30,%eax
+    12a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    12a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    12a7:	0f b6 00             	movzbl (%eax),%eax
+    12aa:	3c 2f                	cmp    $0x2f,%al
+    12ac:	7e 0a                	jle    12b8 <atoi+0x48>
+    12ae:	8b 45 08             	mov    0x8(%ebp),%eax
+    12b1:	0f b6 00             	movzbl (%eax),%eax
+    12b4:	3c 39                	cmp    $0x39,%al
+    12b6:	7e c7                	jle    127f <atoi+0xf>
+  return n;
+    12b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    12bb:	c9                   	leave
+    12bc:	c3                   	ret
+
+000012bd <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    12bd:	55                   	push   %ebp
+    12be:	89 e5                	mov    %esp,%ebp
+    12c0:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    12c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12c6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    12c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12cc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    12cf:	eb 17                	jmp    12e8 <memmove+0x2b>
+    *dst++ = *src++;
+    12d1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    12d4:	8d 42 01             	lea    0x1(%edx),%eax
+    12d7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    12da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12dd:	8d 48 01             	lea    0x1(%eax),%ecx
+    12e0:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    12e3:	0f b6 12             	movzbl (%edx),%edx
+    12e6:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    12e8:	8b 45 10             	mov    0x10(%ebp),%eax
+    12eb:	8d 50 ff             	lea    -0x1(%eax),%edx
+    12ee:	89 55 10             	mov    %edx,0x10(%ebp)
+    12f1:	85 c0                	test   %eax,%eax
+    12f3:	7f dc                	jg     12d1 <memmove+0x14>
+  return vdst;
+    12f5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    12f8:	c9                   	leave
+    12f9:	c3                   	ret
+
+000012fa <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+    12fa:	83 3d 30 26 00 00 00 	cmpl   $0x0,0x2630
+  jg 2f
+    1301:	7f 2e                	jg     1331 <dosyscall+0x37>
+  jl 1f
+    1303:	7c 29                	jl     132e <dosyscall+0x34>
+  pushl %eax
+    1305:	50                   	push   %eax
+  pushl %ebx
+    1306:	53                   	push   %ebx
+  movl $1, %eax
+    1307:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+    130c:	0f a2                	cpuid
+  popl %ebx
+    130e:	5b                   	pop    %ebx
+  popl %eax
+    130f:	58                   	pop    %eax
+  movl $-1, sysmode
+    1310:	c7 05 30 26 00 00 ff 	movl   $0xffffffff,0x2630
+    1317:	ff ff ff 
+  testl $CPUID_SEP, %edx
+    131a:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+    1320:	74 0c                	je     132e <dosyscall+0x34>
+  movl $1, sysmode
+    1322:	c7 05 30 26 00 00 01 	movl   $0x1,0x2630
+    1329:	00 00 00 
+  jmp 2f
+    132c:	eb 03                	jmp    1331 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+    132e:	cd 40                	int    $0x40
+  ret
+    1330:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+    1331:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+    1333:	ba 3a 13 00 00       	mov    $0x133a,%edx
+  sysenter
+    1338:	0f 34                	sysenter
+3:
+  ret
+    133a:	c3                   	ret
+
+0000133b <fork>:
+
+SYSCALL(fork)
+    133b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1340:	eb b8                	jmp    12fa <dosyscall>
+
+00001342 <exit>:
+SYSCALL(exit)
+    1342:	b8 02 00 00 00       	mov    $0x2,%eax
+    1347:	eb b1                	jmp    12fa <dosyscall>
+
+00001349 <wait>:
+SYSCALL(wait)
+    1349:	b8 03 00 00 00       	mov    $0x3,%eax
+    134e:	eb aa                	jmp    12fa <dosyscall>
+
+00001350 <pipe>:
+SYSCALL(pipe)
+    1350:	b8 04 00 00 00       	mov    $0x4,%eax
+    1355:	eb a3                	jmp    12fa <dosyscall>
+
+00001357 <read>:
+SYSCALL(read)
+    1357:	b8 05 00 00 00       	mov    $0x5,%eax
+    135c:	eb 9c                	jmp    12fa <dosyscall>
+
+0000135e <write>:
+SYSCALL(write)
+    135e:	b8 10 00 00 00       	mov    $0x10,%eax
+    1363:	eb 95                	jmp    12fa <dosyscall>
+
+00001365 <close>:
+SYSCALL(close)
+    1365:	b8 15 00 00 00       	mov    $0x15,%eax
+    136a:	eb 8e                	jmp    12fa <dosyscall>
+
+0000136c <kill>:
+SYSCALL(kill)
+    136c:	b8 06 00 00 00       	mov    $0x6,%eax
+    1371:	eb 87                	jmp    12fa <dosyscall>
+
+00001373 <exec>:
+SYSCALL(exec)
+    1373:	b8 07 00 00 00       	mov    $0x7,%eax
+    1378:	eb 80                	jmp    12fa <dosyscall>
+
+0000137a <open>:
+SYSCALL(open)
+    137a:	b8 0f 00 00 00       	mov    $0xf,%eax
+    137f:	e9 76 ff ff ff       	jmp    12fa <dosyscall>
+
+00001384 <mknod>:
+SYSCALL(mknod)
+    1384:	b8 11 00 00 00       	mov    $0x11,%eax
+    1389:	e9 6c ff ff ff       	jmp    12fa <dosyscall>
+
+0000138e <unlink>:
+SYSCALL(unlink)
+    138e:	b8 12 00 00 00       	mov    $0x12,%eax
+    1393:	e9 62 ff ff ff       	jmp    12fa <dosyscall>
+
+00001398 <fstat>:
+SYSCALL(fstat)
+    1398:	b8 08 00 00 00       	mov    $0x8,%eax
+    139d:	e9 58 ff ff ff       	jmp    12fa <dosyscall>
+
+000013a2 <link>:
+SYSCALL(link)
+    13a2:	b8 13 00 00 00       	mov    $0x13,%eax
+    13a7:	e9 4e ff ff ff       	jmp    12fa <dosyscall>
+
+000013ac <mkdir>:
+SYSCALL(mkdir)
+    13ac:	b8 14 00 00 00       	mov    $0x14,%eax
+    13b1:	e9 44 ff ff ff       	jmp    12fa <dosyscall>
+
+000013b6 <chdir>:
+SYSCALL(chdir)
+    13b6:	b8 09 00 00 00       	mov    $0x9,%eax
+    13bb:	e9 3a ff ff ff       	jmp    12fa <dosyscall>
+
+000013c0 <dup>:
+SYSCALL(dup)
+    13c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13c5:	e9 30 ff ff ff       	jmp    12fa <dosyscall>
+
+000013ca <getpid>:
+SYSCALL(getpid)
+    13ca:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13cf:	e9 26 ff ff ff       	jmp    12fa <dosyscall>
+
+000013d4 <sbrk>:
+SYSCALL(sbrk)
+    13d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13d9:	e9 1c ff ff ff       	jmp    12fa <dosyscall>
+
+000013de <sleep>:
+SYSCALL(sleep)
+    13de:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13e3:	e9 12 ff ff ff       	jmp    12fa <dosyscall>
+
+000013e8 <uptime>:
+SYSCALL(uptime)
+    13e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13ed:	e9 08 ff ff ff       	jmp    12fa <dosyscall>
+
+000013f2 <symlink>:
+SYSCALL(symlink)
+    13f2:	b8 16 00 00 00       	mov    $0x16,%eax
+    13f7:	e9 fe fe ff ff       	jmp    12fa <dosyscall>
+
+000013fc <readlink>:
+SYSCALL(readlink)
+    13fc:	b8 17 00 00 00       	mov    $0x17,%eax
+    1401:	e9 f4 fe ff ff       	jmp    12fa <dosyscall>
+
+00001406 <fprot>:
+SYSCALL(fprot)
+    1406:	b8 18 00 00 00       	mov    $0x18,%eax
+    140b:	e9 ea fe ff ff       	jmp    12fa <dosyscall>
+
+00001410 <funprot>:
+SYSCALL(funprot)
+    1410:	b8 19 00 00 00       	mov    $0x19,%eax
+    1415:	e9 e0 fe ff ff       	jmp    12fa <dosyscall>
+
+0000141a <funlock>:
+SYSCALL(funlock)
+    141a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    141f:	e9 d6 fe ff ff       	jmp    12fa <dosyscall>
+
+00001424 <mmap>:
+SYSCALL(mmap)
+    1424:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1429:	e9 cc fe ff ff       	jmp    12fa <dosyscall>
+
+0000142e <munmap>:
+SYSCALL(munmap)
+    142e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1433:	e9 c2 fe ff ff       	jmp    12fa <dosyscall>
+
+00001438 <sendfile>:
+SYSCALL(sendfile)
+    1438:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    143d:	e9 b8 fe ff ff       	jmp    12fa <dosyscall>
+
+00001442 <readv>:
+SYSCALL(readv)
+    1442:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1447:	e9 ae fe ff ff       	jmp    12fa <dosyscall>
+
+0000144c <writev>:
+SYSCALL(writev)
+    144c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1451:	e9 a4 fe ff ff       	jmp    12fa <dosyscall>
+
+00001456 <pread>:
+SYSCALL(pread)
+    1456:	b8 20 00 00 00       	mov    $0x20,%eax
+    145b:	e9 9a fe ff ff       	jmp    12fa <dosyscall>
+
+00001460 <pwrite>:
+SYSCALL(pwrite)
+    1460:	b8 21 00 00 00       	mov    $0x21,%eax
+    1465:	e9 90 fe ff ff       	jmp    12fa <dosyscall>
+
+0000146a <lseek>:
+SYSCALL(lseek)
+    146a:	b8 22 00 00 00       	mov    $0x22,%eax
+    146f:	e9 86 fe ff ff       	jmp    12fa <dosyscall>
+
+00001474 <spawn>:
+SYSCALL(spawn)
+    1474:	b8 23 00 00 00       	mov    $0x23,%eax
+    1479:	e9 7c fe ff ff       	jmp    12fa <dosyscall>
+
+0000147e <setpriority>:
+SYSCALL(setpriority)
+    147e:	b8 24 00 00 00       	mov    $0x24,%eax
+    1483:	e9 72 fe ff ff       	jmp    12fa <dosyscall>
+
+00001488 <kthread_create>:
+SYSCALL(kthread_create)
+    1488:	b8 25 00 00 00       	mov    $0x25,%eax
+    148d:	e9 68 fe ff ff       	jmp    12fa <dosyscall>
+
+00001492 <kthread_id>:
+SYSCALL(kthread_id)
+    1492:	b8 26 00 00 00       	mov    $0x26,%eax
+    1497:	e9 5e fe ff ff       	jmp    12fa <dosyscall>
+
+0000149c <kthread_exit>:
+SYSCALL(kthread_exit)
+    149c:	b8 27 00 00 00       	mov    $0x27,%eax
+    14a1:	e9 54 fe ff ff       	jmp    12fa <dosyscall>
+
+000014a6 <kthread_join>:
+SYSCALL(kthread_join)
+    14a6:	b8 28 00 00 00       	mov    $0x28,%eax
+    14ab:	e9 4a fe ff ff       	jmp    12fa <dosyscall>
+
+000014b0 <futex>:
+SYSCALL(futex)
+    14b0:	b8 29 00 00 00       	mov    $0x29,%eax
+    14b5:	e9 40 fe ff ff       	jmp    12fa <dosyscall>
+
+000014ba <signal>:
+SYSCALL(signal)
+    14ba:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14bf:	e9 36 fe ff ff       	jmp    12fa <dosyscall>
+
+000014c4 <alarm>:
+SYSCALL(alarm)
+    14c4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14c9:	e9 2c fe ff ff       	jmp    12fa <dosyscall>
+
+000014ce <usleep>:
+SYSCALL(usleep)
+    14ce:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14d3:	e9 22 fe ff ff       	jmp    12fa <dosyscall>
+
+000014d8 <ioring_setup>:
+SYSCALL(ioring_setup)
+    14d8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14dd:	e9 18 fe ff ff       	jmp    12fa <dosyscall>
+
+000014e2 <ioring_enter>:
+SYSCALL(ioring_enter)
+    14e2:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    14e7:	e9 0e fe ff ff       	jmp    12fa <dosyscall>
+
+000014ec <getrusage>:
+SYSCALL(getrusage)
+    14ec:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    14f1:	e9 04 fe ff ff       	jmp    12fa <dosyscall>
+
+000014f6 <mount>:
+SYSCALL(mount)
+    14f6:	b8 30 00 00 00       	mov    $0x30,%eax
+    14fb:	e9 fa fd ff ff       	jmp    12fa <dosyscall>
+
+00001500 <getdents>:
+SYSCALL(getdents)
+    1500:	b8 31 00 00 00       	mov    $0x31,%eax
+    1505:	e9 f0 fd ff ff       	jmp    12fa <dosyscall>
+
+0000150a <yield>:
+SYSCALL(yield)
+    150a:	b8 32 00 00 00       	mov    $0x32,%eax
+    150f:	e9 e6 fd ff ff       	jmp    12fa <dosyscall>
+
+00001514 <ncpu>:
+SYSCALL(ncpu)
+    1514:	b8 33 00 00 00       	mov    $0x33,%eax
+    1519:	e9 dc fd ff ff       	jmp    12fa <dosyscall>
+
+0000151e <fallocate>:
+SYSCALL(fallocate)
+    151e:	b8 34 00 00 00       	mov    $0x34,%eax
+    1523:	e9 d2 fd ff ff       	jmp    12fa <dosyscall>
+
+00001528 <ftruncate>:
+SYSCALL(ftruncate)
+    1528:	b8 35 00 00 00       	mov    $0x35,%eax
+    152d:	e9 c8 fd ff ff       	jmp    12fa <dosyscall>
+
+00001532 <fsync>:
+SYSCALL(fsync)
+    1532:	b8 36 00 00 00       	mov    $0x36,%eax
+    1537:	e9 be fd ff ff       	jmp    12fa <dosyscall>
+
+0000153c <fdatasync>:
+SYSCALL(fdatasync)
+    153c:	b8 37 00 00 00       	mov    $0x37,%eax
+    1541:	e9 b4 fd ff ff       	jmp    12fa <dosyscall>
+
+00001546 <poll>:
+SYSCALL(poll)
+    1546:	b8 38 00 00 00       	mov    $0x38,%eax
+    154b:	e9 aa fd ff ff       	jmp    12fa <dosyscall>
+
+00001550 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+    1556:	8b 45 08             	mov    0x8(%ebp),%eax
+    1559:	8b 40 04             	mov    0x4(%eax),%eax
+    155c:	85 c0                	test   %eax,%eax
+    155e:	7e 1f                	jle    157f <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+    1560:	8b 45 08             	mov    0x8(%ebp),%eax
+    1563:	8b 50 04             	mov    0x4(%eax),%edx
+    1566:	8b 45 08             	mov    0x8(%ebp),%eax
+    1569:	8d 48 08             	lea    0x8(%eax),%ecx
+    156c:	8b 45 08             	mov    0x8(%ebp),%eax
+    156f:	8b 00                	mov    (%eax),%eax
+    1571:	83 ec 04             	sub    $0x4,%esp
+    1574:	52                   	push   %edx
+    1575:	51                   	push   %ecx
+    1576:	50                   	push   %eax
+    1577:	e8 d0 fe ff ff       	call   144c <writev>
+    157c:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    157f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1582:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+    1589:	8b 45 08             	mov    0x8(%ebp),%eax
+    158c:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+    1593:	00 00 00 
+}
+    1596:	90                   	nop
+    1597:	c9                   	leave
+    1598:	c3                   	ret
+
+00001599 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+    1599:	55                   	push   %ebp
+    159a:	89 e5                	mov    %esp,%ebp
+    159c:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+    159f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    15a3:	0f 84 94 00 00 00    	je     163d <put+0xa4>
+    return;
+  if(o->n > 0){
+    15a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ac:	8b 40 04             	mov    0x4(%eax),%eax
+    15af:	85 c0                	test   %eax,%eax
+    15b1:	7e 40                	jle    15f3 <put+0x5a>
+    v = &o->iov[o->n-1];
+    15b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    15b6:	8b 40 04             	mov    0x4(%eax),%eax
+    15b9:	83 e8 01             	sub    $0x1,%eax
+    15bc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    15c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    15c6:	01 d0                	add    %edx,%eax
+    15c8:	83 c0 08             	add    $0x8,%eax
+    15cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+    15ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d1:	8b 10                	mov    (%eax),%edx
+    15d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d6:	8b 40 04             	mov    0x4(%eax),%eax
+    15d9:	01 d0                	add    %edx,%eax
+    15db:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    15de:	75 13                	jne    15f3 <put+0x5a>
+      v->iov_len += n;
+    15e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15e3:	8b 50 04             	mov    0x4(%eax),%edx
+    15e6:	8b 45 10             	mov    0x10(%ebp),%eax
+    15e9:	01 c2                	add    %eax,%edx
+    15eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15ee:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+    15f1:	eb 4b                	jmp    163e <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+    15f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    15f6:	8b 40 04             	mov    0x4(%eax),%eax
+    15f9:	83 f8 10             	cmp    $0x10,%eax
+    15fc:	75 0e                	jne    160c <put+0x73>
+    flush(o);
+    15fe:	83 ec 0c             	sub    $0xc,%esp
+    1601:	ff 75 08             	push   0x8(%ebp)
+    1604:	e8 47 ff ff ff       	call   1550 <flush>
+    1609:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+    160c:	8b 45 08             	mov    0x8(%ebp),%eax
+    160f:	8b 50 04             	mov    0x4(%eax),%edx
+    1612:	8b 45 08             	mov    0x8(%ebp),%eax
+    1615:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1618:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+    161c:	8b 45 08             	mov    0x8(%ebp),%eax
+    161f:	8b 50 04             	mov    0x4(%eax),%edx
+    1622:	8b 45 08             	mov    0x8(%ebp),%eax
+    1625:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1628:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+    162c:	8b 45 08             	mov    0x8(%ebp),%eax
+    162f:	8b 40 04             	mov    0x4(%eax),%eax
+    1632:	8d 50 01             	lea    0x1(%eax),%edx
+    1635:	8b 45 08             	mov    0x8(%ebp),%eax
+    1638:	89 50 04             	mov    %edx,0x4(%eax)
+    163b:	eb 01                	jmp    163e <put+0xa5>
+    return;
+    163d:	90                   	nop
+}
+    163e:	c9                   	leave
+    163f:	c3                   	ret
+
+00001640 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+    1646:	8b 45 08             	mov    0x8(%ebp),%eax
+    1649:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    164f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1652:	01 d0                	add    %edx,%eax
+    1654:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1659:	77 0b                	ja     1666 <room+0x26>
+    165b:	8b 45 08             	mov    0x8(%ebp),%eax
+    165e:	8b 40 04             	mov    0x4(%eax),%eax
+    1661:	83 f8 10             	cmp    $0x10,%eax
+    1664:	75 0e                	jne    1674 <room+0x34>
+    flush(o);
+    1666:	83 ec 0c             	sub    $0xc,%esp
+    1669:	ff 75 08             	push   0x8(%ebp)
+    166c:	e8 df fe ff ff       	call   1550 <flush>
+    1671:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+    1674:	8b 45 08             	mov    0x8(%ebp),%eax
+    1677:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+    167d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1680:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    1686:	01 d0                	add    %edx,%eax
+}
+    1688:	c9                   	leave
+    1689:	c3                   	ret
+
+0000168a <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+    168a:	55                   	push   %ebp
+    168b:	89 e5                	mov    %esp,%ebp
+    168d:	83 ec 28             	sub    $0x28,%esp
+    1690:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1693:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+    1696:	83 ec 08             	sub    $0x8,%esp
+    1699:	6a 01                	push   $0x1
+    169b:	ff 75 08             	push   0x8(%ebp)
+    169e:	e8 9d ff ff ff       	call   1640 <room>
+    16a3:	83 c4 10             	add    $0x10,%esp
+    16a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+    16a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16ac:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+    16b0:	88 10                	mov    %dl,(%eax)
+  o->used++;
+    16b2:	8b 45 08             	mov    0x8(%ebp),%eax
+    16b5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    16bb:	8d 50 01             	lea    0x1(%eax),%edx
+    16be:	8b 45 08             	mov    0x8(%ebp),%eax
+    16c1:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+    16c7:	83 ec 04             	sub    $0x4,%esp
+    16ca:	6a 01                	push   $0x1
+    16cc:	ff 75 f4             	push   -0xc(%ebp)
+    16cf:	ff 75 08             	push   0x8(%ebp)
+    16d2:	e8 c2 fe ff ff       	call   1599 <put>
+    16d7:	83 c4 10             	add    $0x10,%esp
+}
+    16da:	90                   	nop
+    16db:	c9                   	leave
+    16dc:	c3                   	ret
+
+000016dd <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    16dd:	55                   	push   %ebp
+    16de:	89 e5                	mov    %esp,%ebp
+    16e0:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+    16e3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    16ea:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    16ee:	74 17                	je     1707 <printint+0x2a>
+    16f0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    16f4:	79 11                	jns    1707 <printint+0x2a>
+    neg = 1;
+    16f6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    16fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1700:	f7 d8                	neg    %eax
+    1702:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1705:	eb 06                	jmp    170d <printint+0x30>
+  } else {
+    x = xx;
+    1707:	8b 45 0c             	mov    0xc(%ebp),%eax
+    170a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    170d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1714:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1717:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    171a:	ba 00 00 00 00       	mov    $0x0,%edx
+    171f:	f7 f1                	div    %ecx
+    1721:	89 d1                	mov    %edx,%ecx
+    1723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1726:	8d 50 01             	lea    0x1(%eax),%edx
+    1729:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    172c:	0f b6 91 34 26 00 00 	movzbl 0x2634(%ecx),%edx
+    1733:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    173a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    173d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1742:	f7 f1                	div    %ecx
+    1744:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1747:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    174b:	75 c7                	jne    1714 <printint+0x37>
+  if(neg)
+    174d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1751:	74 0e                	je     1761 <printint+0x84>
+    buf[i++] = '-';
+    1753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1756:	8d 50 01             	lea    0x1(%eax),%edx
+    1759:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    175c:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+    1761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1764:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+    1767:	83 ec 08             	sub    $0x8,%esp
+    176a:	ff 75 e8             	push   -0x18(%ebp)
+    176d:	ff 75 08             	push   0x8(%ebp)
+    1770:	e8 cb fe ff ff       	call   1640 <room>
+    1775:	83 c4 10             	add    $0x10,%esp
+    1778:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+    177b:	eb 1d                	jmp    179a <printint+0xbd>
+    p[n-1-i] = buf[i];
+    177d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1780:	83 e8 01             	sub    $0x1,%eax
+    1783:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1786:	89 c2                	mov    %eax,%edx
+    1788:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    178b:	01 c2                	add    %eax,%edx
+    178d:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+    1790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1793:	01 c8                	add    %ecx,%eax
+    1795:	0f b6 00             	movzbl (%eax),%eax
+    1798:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+    179a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    179e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    17a2:	79 d9                	jns    177d <printint+0xa0>
+  o->used += n;
+    17a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    17a7:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    17ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    17b0:	01 c2                	add    %eax,%edx
+    17b2:	8b 45 08             	mov    0x8(%ebp),%eax
+    17b5:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+    17bb:	83 ec 04             	sub    $0x4,%esp
+    17be:	ff 75 e8             	push   -0x18(%ebp)
+    17c1:	ff 75 e4             	push   -0x1c(%ebp)
+    17c4:	ff 75 08             	push   0x8(%ebp)
+    17c7:	e8 cd fd ff ff       	call   1599 <put>
+    17cc:	83 c4 10             	add    $0x10,%esp
+}
+    17cf:	90                   	nop
+    17d0:	c9                   	leave
+    17d1:	c3                   	ret
+
+000017d2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    17d2:	55                   	push   %ebp
+    17d3:	89 e5                	mov    %esp,%ebp
+    17d5:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+    17db:	8b 45 08             	mov    0x8(%ebp),%eax
+    17de:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+    17e4:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+    17eb:	00 00 00 
+  o.used = 0;
+    17ee:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+    17f5:	00 00 00 
+  state = 0;
+    17f8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    17ff:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1802:	83 c0 04             	add    $0x4,%eax
+    1805:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+    1808:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    180f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1816:	e9 82 01 00 00       	jmp    199d <printf+0x1cb>
+    c = fmt[i] & 0xff;
+    181b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    181e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1821:	01 d0                	add    %edx,%eax
+    1823:	0f b6 00             	movzbl (%eax),%eax
+    1826:	0f be c0             	movsbl %al,%eax
+    1829:	25 ff 00 00 00       	and    $0xff,%eax
+    182e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+    1831:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1835:	75 38                	jne    186f <printf+0x9d>
+      if(c == '%'){
+    1837:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    183b:	0f 85 58 01 00 00    	jne    1999 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+    1841:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1844:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1847:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    184a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    184d:	01 ca                	add    %ecx,%edx
+    184f:	83 ec 04             	sub    $0x4,%esp
+    1852:	50                   	push   %eax
+    1853:	52                   	push   %edx
+    1854:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    185a:	50                   	push   %eax
+    185b:	e8 39 fd ff ff       	call   1599 <put>
+    1860:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+    1863:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+    186a:	e9 2a 01 00 00       	jmp    1999 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+    186f:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+    1873:	0f 85 20 01 00 00    	jne    1999 <printf+0x1c7>
+      if(c == 'd'){
+    1879:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+    187d:	75 22                	jne    18a1 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+    187f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1882:	8b 00                	mov    (%eax),%eax
+    1884:	6a 01                	push   $0x1
+    1886:	6a 0a                	push   $0xa
+    1888:	50                   	push   %eax
+    1889:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    188f:	50                   	push   %eax
+    1890:	e8 48 fe ff ff       	call   16dd <printint>
+    1895:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1898:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    189c:	e9 e8 00 00 00       	jmp    1989 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+    18a1:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+    18a5:	74 06                	je     18ad <printf+0xdb>
+    18a7:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+    18ab:	75 22                	jne    18cf <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+    18ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18b0:	8b 00                	mov    (%eax),%eax
+    18b2:	6a 00                	push   $0x0
+    18b4:	6a 10                	push   $0x10
+    18b6:	50                   	push   %eax
+    18b7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    18bd:	50                   	push   %eax
+    18be:	e8 1a fe ff ff       	call   16dd <printint>
+    18c3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    18c6:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    18ca:	e9 ba 00 00 00       	jmp    1989 <printf+0x1b7>
+      } else if(c == 's'){
+    18cf:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+    18d3:	75 3f                	jne    1914 <printf+0x142>
+        s = (char*)*ap;
+    18d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18d8:	8b 00                	mov    (%eax),%eax
+    18da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    18dd:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+    18e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    18e5:	75 07                	jne    18ee <printf+0x11c>
+          s = "(null)";
+    18e7:	c7 45 f4 ae 1f 00 00 	movl   $0x1fae,-0xc(%ebp)
+        put(&o, s, strlen(s));
+    18ee:	83 ec 0c             	sub    $0xc,%esp
+    18f1:	ff 75 f4             	push   -0xc(%ebp)
+    18f4:	e8 47 f8 ff ff       	call   1140 <strlen>
+    18f9:	83 c4 10             	add    $0x10,%esp
+    18fc:	83 ec 04             	sub    $0x4,%esp
+    18ff:	50                   	push   %eax
+    1900:	ff 75 f4             	push   -0xc(%ebp)
+    1903:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1909:	50                   	push   %eax
+    190a:	e8 8a fc ff ff       	call   1599 <put>
+    190f:	83 c4 10             	add    $0x10,%esp
+    1912:	eb 75                	jmp    1989 <printf+0x1b7>
+      } else if(c == 'c'){
+    1914:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+    1918:	75 21                	jne    193b <printf+0x169>
+        putc(&o, *ap);
+    191a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    191d:	8b 00                	mov    (%eax),%eax
+    191f:	0f be c0             	movsbl %al,%eax
+    1922:	83 ec 08             	sub    $0x8,%esp
+    1925:	50                   	push   %eax
+    1926:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    192c:	50                   	push   %eax
+    192d:	e8 58 fd ff ff       	call   168a <putc>
+    1932:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1935:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    1939:	eb 4e                	jmp    1989 <printf+0x1b7>
+      } else if(c == '%'){
+    193b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    193f:	75 1b                	jne    195c <printf+0x18a>
+        putc(&o, c);
+    1941:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1944:	0f be c0             	movsbl %al,%eax
+    1947:	83 ec 08             	sub    $0x8,%esp
+    194a:	50                   	push   %eax
+    194b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1951:	50                   	push   %eax
+    1952:	e8 33 fd ff ff       	call   168a <putc>
+    1957:	83 c4 10             	add    $0x10,%esp
+    195a:	eb 2d                	jmp    1989 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+    195c:	83 ec 08             	sub    $0x8,%esp
+    195f:	6a 25                	push   $0x25
+    1961:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1967:	50                   	push   %eax
+    1968:	e8 1d fd ff ff       	call   168a <putc>
+    196d:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+    1970:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1973:	0f be c0             	movsbl %al,%eax
+    1976:	83 ec 08             	sub    $0x8,%esp
+    1979:	50                   	push   %eax
+    197a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1980:	50                   	push   %eax
+    1981:	e8 04 fd ff ff       	call   168a <putc>
+    1986:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1989:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+    1990:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1993:	83 c0 01             	add    $0x1,%eax
+    1996:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1999:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    199d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    19a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    19a3:	01 d0                	add    %edx,%eax
+    19a5:	0f b6 00             	movzbl (%eax),%eax
+    19a8:	84 c0                	test   %al,%al
+    19aa:	0f 85 6b fe ff ff    	jne    181b <printf+0x49>
+    }
+  }
+  if(state == 0)
+    19b0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    19b4:	75 22                	jne    19d8 <printf+0x206>
+    put(&o, fmt + start, i - start);
+    19b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    19b9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    19bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    19bf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    19c2:	01 ca                	add    %ecx,%edx
+    19c4:	83 ec 04             	sub    $0x4,%esp
+    19c7:	50                   	push   %eax
+    19c8:	52                   	push   %edx
+    19c9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    19cf:	50                   	push   %eax
+    19d0:	e8 c4 fb ff ff       	call   1599 <put>
+    19d5:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+    19d8:	83 ec 0c             	sub    $0xc,%esp
+    19db:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    19e1:	50                   	push   %eax
+    19e2:	e8 69 fb ff ff       	call   1550 <flush>
+    19e7:	83 c4 10             	add    $0x10,%esp
+}
+    19ea:	90                   	nop
+    19eb:	c9                   	leave
+    19ec:	c3                   	ret
+
+000019ed <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+    19ed:	55                   	push   %ebp
+    19ee:	89 e5                	mov    %esp,%ebp
+    19f0:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+    19f3:	8b 55 08             	mov    0x8(%ebp),%edx
+    19f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    19f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    19fc:	f0 87 02             	lock xchg %eax,(%edx)
+    19ff:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+    1a02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+    1a05:	c9                   	leave
+    1a06:	c3                   	ret
+
+00001a07 <lock>:
+{
+    1a07:	55                   	push   %ebp
+    1a08:	89 e5                	mov    %esp,%ebp
+    1a0a:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+    1a0d:	a1 64 36 00 00       	mov    0x3664,%eax
+    1a12:	85 c0                	test   %eax,%eax
+    1a14:	74 09                	je     1a1f <lock+0x18>
+    1a16:	a1 64 36 00 00       	mov    0x3664,%eax
+    1a1b:	ff d0                	call   *%eax
+    1a1d:	eb 05                	jmp    1a24 <lock+0x1d>
+    1a1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+    1a27:	90                   	nop
+    1a28:	83 ec 08             	sub    $0x8,%esp
+    1a2b:	6a 01                	push   $0x1
+    1a2d:	68 9c 36 00 00       	push   $0x369c
+    1a32:	e8 b6 ff ff ff       	call   19ed <xchg>
+    1a37:	83 c4 10             	add    $0x10,%esp
+    1a3a:	85 c0                	test   %eax,%eax
+    1a3c:	75 ea                	jne    1a28 <lock+0x21>
+  return pin;
+    1a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1a41:	c9                   	leave
+    1a42:	c3                   	ret
+
+00001a43 <unlock>:
+{
+    1a43:	55                   	push   %ebp
+    1a44:	89 e5                	mov    %esp,%ebp
+    1a46:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+    1a49:	6a 00                	push   $0x0
+    1a4b:	68 9c 36 00 00       	push   $0x369c
+    1a50:	e8 98 ff ff ff       	call   19ed <xchg>
+    1a55:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+    1a58:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1a5c:	78 10                	js     1a6e <unlock+0x2b>
+    mallocunpin(pin);
+    1a5e:	a1 68 36 00 00       	mov    0x3668,%eax
+    1a63:	83 ec 0c             	sub    $0xc,%esp
+    1a66:	ff 75 08             	push   0x8(%ebp)
+    1a69:	ff d0                	call   *%eax
+    1a6b:	83 c4 10             	add    $0x10,%esp
+}
+    1a6e:	90                   	nop
+    1a6f:	c9                   	leave
+    1a70:	c3                   	ret
+
+00001a71 <sizeclass>:
+{
+    1a71:	55                   	push   %ebp
+    1a72:	89 e5                	mov    %esp,%ebp
+    1a74:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+    1a77:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    1a7e:	eb 1c                	jmp    1a9c <sizeclass+0x2b>
+    if(nu <= (2 << c))
+    1a80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1a83:	ba 02 00 00 00       	mov    $0x2,%edx
+    1a88:	89 c1                	mov    %eax,%ecx
+    1a8a:	d3 e2                	shl    %cl,%edx
+    1a8c:	89 d0                	mov    %edx,%eax
+    1a8e:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1a91:	72 05                	jb     1a98 <sizeclass+0x27>
+      return c;
+    1a93:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1a96:	eb 0f                	jmp    1aa7 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+    1a98:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1a9c:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+    1aa0:	7e de                	jle    1a80 <sizeclass+0xf>
+  return -1;
+    1aa2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1aa7:	c9                   	leave
+    1aa8:	c3                   	ret
+
+00001aa9 <bigfree>:
+{
+    1aa9:	55                   	push   %ebp
+    1aaa:	89 e5                	mov    %esp,%ebp
+    1aac:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1aaf:	a1 74 36 00 00       	mov    0x3674,%eax
+    1ab4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1ab7:	eb 24                	jmp    1add <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1ab9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1abc:	8b 00                	mov    (%eax),%eax
+    1abe:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1ac1:	72 12                	jb     1ad5 <bigfree+0x2c>
+    1ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ac6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1ac9:	72 24                	jb     1aef <bigfree+0x46>
+    1acb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1ace:	8b 00                	mov    (%eax),%eax
+    1ad0:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1ad3:	72 1a                	jb     1aef <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1ad5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1ad8:	8b 00                	mov    (%eax),%eax
+    1ada:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1add:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ae0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1ae3:	73 d4                	jae    1ab9 <bigfree+0x10>
+    1ae5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1ae8:	8b 00                	mov    (%eax),%eax
+    1aea:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1aed:	73 ca                	jae    1ab9 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+    1aef:	8b 45 08             	mov    0x8(%ebp),%eax
+    1af2:	8b 40 04             	mov    0x4(%eax),%eax
+    1af5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1afc:	8b 45 08             	mov    0x8(%ebp),%eax
+    1aff:	01 c2                	add    %eax,%edx
+    1b01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b04:	8b 00                	mov    (%eax),%eax
+    1b06:	39 c2                	cmp    %eax,%edx
+    1b08:	75 24                	jne    1b2e <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+    1b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b0d:	8b 50 04             	mov    0x4(%eax),%edx
+    1b10:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b13:	8b 00                	mov    (%eax),%eax
+    1b15:	8b 40 04             	mov    0x4(%eax),%eax
+    1b18:	01 c2                	add    %eax,%edx
+    1b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b1d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1b20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b23:	8b 00                	mov    (%eax),%eax
+    1b25:	8b 10                	mov    (%eax),%edx
+    1b27:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b2a:	89 10                	mov    %edx,(%eax)
+    1b2c:	eb 0a                	jmp    1b38 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+    1b2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b31:	8b 10                	mov    (%eax),%edx
+    1b33:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b36:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    1b38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b3b:	8b 40 04             	mov    0x4(%eax),%eax
+    1b3e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1b45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b48:	01 d0                	add    %edx,%eax
+    1b4a:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1b4d:	75 20                	jne    1b6f <bigfree+0xc6>
+    p->s.size += bp->s.size;
+    1b4f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b52:	8b 50 04             	mov    0x4(%eax),%edx
+    1b55:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b58:	8b 40 04             	mov    0x4(%eax),%eax
+    1b5b:	01 c2                	add    %eax,%edx
+    1b5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b60:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1b63:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b66:	8b 10                	mov    (%eax),%edx
+    1b68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b6b:	89 10                	mov    %edx,(%eax)
+    1b6d:	eb 08                	jmp    1b77 <bigfree+0xce>
+    p->s.ptr = bp;
+    1b6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b72:	8b 55 08             	mov    0x8(%ebp),%edx
+    1b75:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    1b77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1b7a:	a3 74 36 00 00       	mov    %eax,0x3674
+}
+    1b7f:	90                   	nop
+    1b80:	c9                   	leave
+    1b81:	c3                   	ret
+
+00001b82 <free>:
+{
+    1b82:	55                   	push   %ebp
+    1b83:	89 e5                	mov    %esp,%ebp
+    1b85:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    1b88:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1b8c:	74 68                	je     1bf6 <free+0x74>
+  bp = (Header*)ap - 1;
+    1b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b91:	83 e8 08             	sub    $0x8,%eax
+    1b94:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    1b97:	e8 6b fe ff ff       	call   1a07 <lock>
+    1b9c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    1b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ba2:	8b 40 04             	mov    0x4(%eax),%eax
+    1ba5:	83 ec 0c             	sub    $0xc,%esp
+    1ba8:	50                   	push   %eax
+    1ba9:	e8 c3 fe ff ff       	call   1a71 <sizeclass>
+    1bae:	83 c4 10             	add    $0x10,%esp
+    1bb1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1bb4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1bb8:	78 1e                	js     1bd8 <free+0x56>
+    bp->s.ptr = classfree[c];
+    1bba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1bbd:	8b 14 85 78 36 00 00 	mov    0x3678(,%eax,4),%edx
+    1bc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bc7:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    1bc9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1bcc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1bcf:	89 14 85 78 36 00 00 	mov    %edx,0x3678(,%eax,4)
+    1bd6:	eb 0e                	jmp    1be6 <free+0x64>
+    bigfree(bp);
+    1bd8:	83 ec 0c             	sub    $0xc,%esp
+    1bdb:	ff 75 f4             	push   -0xc(%ebp)
+    1bde:	e8 c6 fe ff ff       	call   1aa9 <bigfree>
+    1be3:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    1be6:	83 ec 0c             	sub    $0xc,%esp
+    1be9:	ff 75 f0             	push   -0x10(%ebp)
+    1bec:	e8 52 fe ff ff       	call   1a43 <unlock>
+    1bf1:	83 c4 10             	add    $0x10,%esp
+    1bf4:	eb 01                	jmp    1bf7 <free+0x75>
+    return;
+    1bf6:	90                   	nop
+}
+    1bf7:	c9                   	leave
+    1bf8:	c3                   	ret
+
+00001bf9 <morecore>:
+{
+    1bf9:	55                   	push   %ebp
+    1bfa:	89 e5                	mov    %esp,%ebp
+    1bfc:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    1bff:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1c06:	77 07                	ja     1c0f <morecore+0x16>
+    nu = 4096;
+    1c08:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    1c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c12:	c1 e0 03             	shl    $0x3,%eax
+    1c15:	83 ec 0c             	sub    $0xc,%esp
+    1c18:	50                   	push   %eax
+    1c19:	e8 b6 f7 ff ff       	call   13d4 <sbrk>
+    1c1e:	83 c4 10             	add    $0x10,%esp
+    1c21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    1c24:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1c28:	75 07                	jne    1c31 <morecore+0x38>
+    return 0;
+    1c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c2f:	eb 22                	jmp    1c53 <morecore+0x5a>
+  hp = (Header*)p;
+    1c31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    1c37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1c3a:	8b 55 08             	mov    0x8(%ebp),%edx
+    1c3d:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    1c40:	83 ec 0c             	sub    $0xc,%esp
+    1c43:	ff 75 f0             	push   -0x10(%ebp)
+    1c46:	e8 5e fe ff ff       	call   1aa9 <bigfree>
+    1c4b:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1c4e:	a1 74 36 00 00       	mov    0x3674,%eax
+}
+    1c53:	c9                   	leave
+    1c54:	c3                   	ret
+
+00001c55 <bigalloc>:
+{
+    1c55:	55                   	push   %ebp
+    1c56:	89 e5                	mov    %esp,%ebp
+    1c58:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    1c5b:	a1 74 36 00 00       	mov    0x3674,%eax
+    1c60:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1c63:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1c67:	75 23                	jne    1c8c <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    1c69:	c7 45 f0 6c 36 00 00 	movl   $0x366c,-0x10(%ebp)
+    1c70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1c73:	a3 74 36 00 00       	mov    %eax,0x3674
+    1c78:	a1 74 36 00 00       	mov    0x3674,%eax
+    1c7d:	a3 6c 36 00 00       	mov    %eax,0x366c
+    base.s.size = 0;
+    1c82:	c7 05 70 36 00 00 00 	movl   $0x0,0x3670
+    1c89:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1c8c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1c8f:	8b 00                	mov    (%eax),%eax
+    1c91:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1c94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c97:	8b 40 04             	mov    0x4(%eax),%eax
+    1c9a:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1c9d:	72 4a                	jb     1ce9 <bigalloc+0x94>
+      if(p->s.size == nunits)
+    1c9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ca2:	8b 40 04             	mov    0x4(%eax),%eax
+    1ca5:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1ca8:	75 0c                	jne    1cb6 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cad:	8b 10                	mov    (%eax),%edx
+    1caf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1cb2:	89 10                	mov    %edx,(%eax)
+    1cb4:	eb 26                	jmp    1cdc <bigalloc+0x87>
+        p->s.size -= nunits;
+    1cb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cb9:	8b 40 04             	mov    0x4(%eax),%eax
+    1cbc:	2b 45 08             	sub    0x8(%ebp),%eax
+    1cbf:	89 c2                	mov    %eax,%edx
+    1cc1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cc4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1cc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cca:	8b 40 04             	mov    0x4(%eax),%eax
+    1ccd:	c1 e0 03             	shl    $0x3,%eax
+    1cd0:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1cd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cd6:	8b 55 08             	mov    0x8(%ebp),%edx
+    1cd9:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1cdc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1cdf:	a3 74 36 00 00       	mov    %eax,0x3674
+      return p;
+    1ce4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ce7:	eb 3b                	jmp    1d24 <bigalloc+0xcf>
+    if(p == freep)
+    1ce9:	a1 74 36 00 00       	mov    0x3674,%eax
+    1cee:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1cf1:	75 1e                	jne    1d11 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1cf3:	83 ec 0c             	sub    $0xc,%esp
+    1cf6:	ff 75 08             	push   0x8(%ebp)
+    1cf9:	e8 fb fe ff ff       	call   1bf9 <morecore>
+    1cfe:	83 c4 10             	add    $0x10,%esp
+    1d01:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1d04:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1d08:	75 07                	jne    1d11 <bigalloc+0xbc>
+        return 0;
+    1d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d0f:	eb 13                	jmp    1d24 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d14:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1d17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d1a:	8b 00                	mov    (%eax),%eax
+    1d1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1d1f:	e9 70 ff ff ff       	jmp    1c94 <bigalloc+0x3f>
+}
+    1d24:	c9                   	leave
+    1d25:	c3                   	ret
+
+00001d26 <alloc>:
+alloc(uint nbytes)
+{
+    1d26:	55                   	push   %ebp
+    1d27:	89 e5                	mov    %esp,%ebp
+    1d29:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d2f:	83 c0 07             	add    $0x7,%eax
+    1d32:	c1 e8 03             	shr    $0x3,%eax
+    1d35:	83 c0 01             	add    $0x1,%eax
+    1d38:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    1d3b:	ff 75 f4             	push   -0xc(%ebp)
+    1d3e:	e8 2e fd ff ff       	call   1a71 <sizeclass>
+    1d43:	83 c4 04             	add    $0x4,%esp
+    1d46:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1d49:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1d4d:	79 2c                	jns    1d7b <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    1d4f:	83 ec 0c             	sub    $0xc,%esp
+    1d52:	ff 75 f4             	push   -0xc(%ebp)
+    1d55:	e8 fb fe ff ff       	call   1c55 <bigalloc>
+    1d5a:	83 c4 10             	add    $0x10,%esp
+    1d5d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1d60:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d64:	75 0a                	jne    1d70 <alloc+0x4a>
+      return 0;
+    1d66:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d6b:	e9 c8 00 00 00       	jmp    1e38 <alloc+0x112>
+    return (void*)(p + 1);
+    1d70:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1d73:	83 c0 08             	add    $0x8,%eax
+    1d76:	e9 bd 00 00 00       	jmp    1e38 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1d7b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d7e:	8b 04 85 78 36 00 00 	mov    0x3678(,%eax,4),%eax
+    1d85:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1d88:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d8c:	74 1a                	je     1da8 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1d8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1d91:	8b 10                	mov    (%eax),%edx
+    1d93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d96:	89 14 85 78 36 00 00 	mov    %edx,0x3678(,%eax,4)
+    return (void*)(p + 1);
+    1d9d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1da0:	83 c0 08             	add    $0x8,%eax
+    1da3:	e9 90 00 00 00       	jmp    1e38 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1da8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1dab:	ba 02 00 00 00       	mov    $0x2,%edx
+    1db0:	89 c1                	mov    %eax,%ecx
+    1db2:	d3 e2                	shl    %cl,%edx
+    1db4:	89 d0                	mov    %edx,%eax
+    1db6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    1db9:	a1 94 36 00 00       	mov    0x3694,%eax
+    1dbe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1dc1:	c1 e2 03             	shl    $0x3,%edx
+    1dc4:	01 d0                	add    %edx,%eax
+    1dc6:	8b 15 98 36 00 00    	mov    0x3698,%edx
+    1dcc:	39 c2                	cmp    %eax,%edx
+    1dce:	73 3f                	jae    1e0f <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1dd0:	83 ec 0c             	sub    $0xc,%esp
+    1dd3:	68 00 08 00 00       	push   $0x800
+    1dd8:	e8 78 fe ff ff       	call   1c55 <bigalloc>
+    1ddd:	83 c4 10             	add    $0x10,%esp
+    1de0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1de3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1de7:	75 07                	jne    1df0 <alloc+0xca>
+      return 0;
+    1de9:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dee:	eb 48                	jmp    1e38 <alloc+0x112>
+    bump = (char*)p;
+    1df0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1df3:	a3 94 36 00 00       	mov    %eax,0x3694
+    bumpend = (char*)(p + p->s.size);
+    1df8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1dfb:	8b 40 04             	mov    0x4(%eax),%eax
+    1dfe:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1e05:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1e08:	01 d0                	add    %edx,%eax
+    1e0a:	a3 98 36 00 00       	mov    %eax,0x3698
+  }
+  p = (Header*)bump;
+    1e0f:	a1 94 36 00 00       	mov    0x3694,%eax
+    1e14:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1e17:	a1 94 36 00 00       	mov    0x3694,%eax
+    1e1c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e1f:	c1 e2 03             	shl    $0x3,%edx
+    1e22:	01 d0                	add    %edx,%eax
+    1e24:	a3 94 36 00 00       	mov    %eax,0x3694
+  p->s.size = nunits;
+    1e29:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1e2c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e2f:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1e32:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1e35:	83 c0 08             	add    $0x8,%eax
+}
+    1e38:	c9                   	leave
+    1e39:	c3                   	ret
+
+00001e3a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e3a:	55                   	push   %ebp
+    1e3b:	89 e5                	mov    %esp,%ebp
+    1e3d:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1e40:	e8 c2 fb ff ff       	call   1a07 <lock>
+    1e45:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1e48:	83 ec 0c             	sub    $0xc,%esp
+    1e4b:	ff 75 08             	push   0x8(%ebp)
+    1e4e:	e8 d3 fe ff ff       	call   1d26 <alloc>
+    1e53:	83 c4 10             	add    $0x10,%esp
+    1e56:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1e59:	83 ec 0c             	sub    $0xc,%esp
+    1e5c:	ff 75 f4             	push   -0xc(%ebp)
+    1e5f:	e8 df fb ff ff       	call   1a43 <unlock>
+    1e64:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1e67:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1e6a:	c9                   	leave
+    1e6b:	c3                   	ret
@@ -0,0 +1,396 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+#include "dent.h"
+
+// File system and I/O benchmarks.
+//
+//   fsbench [-p nproc] [-s kb] [-d dir] [bench ...]
+//
+// Runs each named benchmark, or all of them, in nproc processes at
+// once, each on its own files under dir, and reports operations
+// and kilobytes per second.  Setting up and cleaning up are not
+// timed.  Times come from uptime(), so runs should take many ticks.
+
+#define HZ       100     // clock ticks per second
+#define IOSIZE   4096    // bytes per sequential read or write
+#define NRAND    512     // random reads or writes, BSIZE each
+#define NCREATE  64      // files in a create and unlink storm
+#define NLOOKUP  500     // path lookups
+#define DEPTH    8       // directories in a looked-up path
+#define NSCANF   64      // files in a scanned directory
+#define NSCAN    20      // scans of it
+#define MAXPROC  8
+
+struct result {
+  int ops;
+  int bytes;
+};
+
+struct bench {
+  char *name;
+  void (*setup)(char*);
+  void (*run)(char*, struct result*);
+  void (*cleanup)(char*);
+};
+
+char data[IOSIZE];
+int kb = 1024;           // size of a file read or written
+uint seed;
+
+static void
+fail(char *what, char *path)
+{
+  printf(2, "fsbench: %s %s failed\n", what, path);
+  exit();
+}
+
+static uint
+rnd(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Append name to path p, in buf.
+static char*
+join(char *buf, char *p, char *name)
+{
+  int n;
+
+  n = strlen(p);
+  if(n + 1 + strlen(name) + 1 > MAXPATH)
+    fail("path", p);
+  if(buf != p)
+    strcpy(buf, p);
+  buf[n] = '/';
+  strcpy(buf + n + 1, name);
+  return buf;
+}
+
+static char*
+numname(char *buf, char *p, char *prefix, int i)
+{
+  char name[DIRSIZ+1];
+  int n;
+
+  strcpy(name, prefix);
+  n = strlen(name);
+  name[n++] = 'a' + i / 26 % 26;
+  name[n++] = 'a' + i % 26;
+  name[n] = 0;
+  return join(buf, p, name);
+}
+
+// Sequential and random I/O on one file, base/file.
+
+static void
+mkfile(char *base)
+{
+  char path[MAXPATH];
+  int fd, i;
+
+  if((fd = open(join(path, base, "file"), O_CREATE | O_WRONLY)) < 0)
+    fail("create", path);
+  for(i = 0; i < kb * 1024 / IOSIZE; i++)
+    if(write(fd, data, IOSIZE) != IOSIZE)
+      fail("write", path);
+  close(fd);
+}
+
+static void
+rmfile(char *base)
+{
+  char path[MAXPATH];
+
+  unlink(join(path, base, "file"));
+}
+
+static void
+seqwrite(char *base, struct result *r)
+{
+  mkfile(base);
+  r->ops = kb * 1024 / IOSIZE;
+  r->bytes = kb * 1024;
+}
+
+static void
+seqread(char *base, struct result *r)
+{
+  char path[MAXPATH];
+  int fd, n;
+
+  if((fd = open(join(path, base, "file"), O_RDONLY)) < 0)
+    fail("open", path);
+  while((n = read(fd, data, IOSIZE)) > 0){
+    r->ops++;
+    r->bytes += n;
+  }
+  close(fd);
+}
+
+static void
+randio(char *base, struct result *r, int wr)
+{
+  char path[MAXPATH];
+  int fd, i, off;
+
+  if((fd = open(join(path, base, "file"), O_RDWR)) < 0)
+    fail("open", path);
+  for(i = 0; i < NRAND; i++){
+    off = rnd() % (kb * 1024 / BSIZE) * BSIZE;
+    if((wr ? pwrite(fd, data, BSIZE, off) : pread(fd, data, BSIZE, off)) != BSIZE)
+      fail(wr ? "pwrite" : "pread", path);
+  }
+  close(fd);
+  r->ops = NRAND;
+  r->bytes = NRAND * BSIZE;
+}
+
+static void
+randwrite(char *base, struct result *r)
+{
+  randio(base, r, 1);
+}
+
+static void
+randread(char *base, struct result *r)
+{
+  randio(base, r, 0);
+}
+
+// Small files made and removed as fast as possible.
+
+static void
+create(char *base, struct result *r)
+{
+  char path[MAXPATH];
+  int fd, i;
+
+  for(i = 0; i < NCREATE; i++){
+    if((fd = open(numname(path, base, "c", i), O_CREATE | O_WRONLY)) < 0)
+      fail("create", path);
+    if(write(fd, data, 100) != 100)
+      fail("write", path);
+    close(fd);
+  }
+  for(i = 0; i < NCREATE; i++)
+    if(unlink(numname(path, base, "c", i)) < 0)
+      fail("unlink", path);
+  r->ops = 2 * NCREATE;
+}
+
+// Lookups of base/link/d/.../d/file, where link is a symbolic
+// link to d/d/d and the path goes DEPTH directories down.
+
+static void
+mktree(char *base)
+{
+  char path[MAXPATH];
+  int i, fd;
+
+  strcpy(path, base);
+  for(i = 0; i < DEPTH; i++){
+    join(path, path, "d");
+    if(mkdir(path) < 0)
+      fail("mkdir", path);
+  }
+  if((fd = open(join(path, path, "file"), O_CREATE | O_WRONLY)) < 0)
+    fail("create", path);
+  close(fd);
+  if(symlink("d/d/d", join(path, base, "link")) < 0)
+    fail("symlink", path);
+}
+
+static void
+rmtree(char *base)
+{
+  char path[MAXPATH];
+  int i, n;
+
+  unlink(join(path, base, "link"));
+  strcpy(path, base);
+  for(i = 0; i < DEPTH; i++)
+    join(path, path, "d");
+  unlink(join(path, path, "file"));
+  for(i = 0; i < DEPTH; i++){
+    n = strlen(path);
+    while(path[--n] != '/')
+      ;
+    path[n] = 0;
+    unlink(path);
+  }
+}
+
+static void
+lookup(char *base, struct result *r)
+{
+  char path[MAXPATH];
+  struct stat st;
+  int i;
+
+  join(path, base, "link");
+  for(i = 3; i < DEPTH; i++)
+    join(path, path, "d");
+  join(path, path, "file");
+  for(i = 0; i < NLOOKUP; i++)
+    if(stat(path, &st) < 0)
+      fail("stat", path);
+  r->ops = NLOOKUP;
+}
+
+// Reading a directory of NSCANF files, with getdents.
+
+static void
+mkscan(char *base)
+{
+  char path[MAXPATH];
+  int fd, i;
+
+  if(mkdir(join(path, base, "scan")) < 0)
+    fail("mkdir", path);
+  for(i = 0; i < NSCANF; i++){
+    join(path, base, "scan");
+    if((fd = open(numname(path, path, "s", i), O_CREATE | O_WRONLY)) < 0)
+      fail("create", path);
+    close(fd);
+  }
+}
+
+static void
+rmscan(char *base)
+{
+  char path[MAXPATH];
+  int i;
+
+  for(i = 0; i < NSCANF; i++){
+    join(path, base, "scan");
+    unlink(numname(path, path, "s", i));
+  }
+  unlink(join(path, base, "scan"));
+}
+
+static void
+scan(char *base, struct result *r)
+{
+  char path[MAXPATH];
+  struct dent d[16];
+  int fd, i, n;
+
+  join(path, base, "scan");
+  for(i = 0; i < NSCAN; i++){
+    if((fd = open(path, O_RDONLY)) < 0)
+      fail("open", path);
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+      r->ops += n;
+    close(fd);
+  }
+}
+
+struct bench benches[] = {
+  { "seqwrite",  0,      seqwrite,  rmfile },
+  { "seqread",   mkfile, seqread,   rmfile },
+  { "randwrite", mkfile, randwrite, rmfile },
+  { "randread",  mkfile, randread,  rmfile },
+  { "create",    0,      create,    0 },
+  { "lookup",    mktree, lookup,    rmtree },
+  { "scan",      mkscan, scan,      rmscan },
+};
+
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+static void
+runbench(struct bench *b, char *dir, int nproc)
+{
+  char base[MAXPATH];
+  struct result r, sum;
+  int i, p[2], t;
+
+  for(i = 0; i < nproc; i++)
+    if(b->setup)
+      b->setup(numname(base, dir, "fsb", i));
+  if(pipe(p) < 0)
+    fail("pipe", "");
+
+  t = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      close(p[0]);
+      seed = i + 1;
+      memset(&r, 0, sizeof(r));
+      b->run(numname(base, dir, "fsb", i), &r);
+      write(p[1], &r, sizeof(r));
+      exit();
+    }
+  }
+  close(p[1]);
+  memset(&sum, 0, sizeof(sum));
+  for(i = 0; i < nproc; i++){
+    if(read(p[0], &r, sizeof(r)) != sizeof(r))
+      fail(b->name, "run");
+    sum.ops += r.ops;
+    sum.bytes += r.bytes;
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t = uptime() - t;
+  close(p[0]);
+
+  for(i = 0; i < nproc; i++)
+    if(b->cleanup)
+      b->cleanup(numname(base, dir, "fsb", i));
+
+  printf(1, "%s: %d procs, %d ops in %d ticks", b->name, nproc, sum.ops, t);
+  if(t == 0)
+    t = 1;
+  printf(1, ", %d ops/s", sum.ops * HZ / t);
+  if(sum.bytes)
+    printf(1, ", %d KB/s", sum.bytes / 1024 * HZ / t);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  char base[MAXPATH], *dir;
+  int i, j, nproc;
+
+  nproc = 1;
+  dir = ".";
+  for(i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2){
+    if(strcmp(argv[i], "-p") == 0)
+      nproc = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-s") == 0)
+      kb = atoi(argv[i+1]);
+    else if(strcmp(argv[i], "-d") == 0)
+      dir = argv[i+1];
+    else
+      break;
+  }
+  if((i < argc && argv[i][0] == '-') || nproc < 1 || nproc > MAXPROC ||
+     kb < IOSIZE / 1024){
+    printf(2, "usage: fsbench [-p nproc] [-s kb] [-d dir] [bench ...]\n");
+    exit();
+  }
+
+  for(j = 0; j < nproc; j++)
+    if(mkdir(numname(base, dir, "fsb", j)) < 0)
+      fail("mkdir", base);
+  if(i == argc)
+    for(j = 0; j < NBENCH; j++)
+      runbench(&benches[j], dir, nproc);
+  for(; i < argc; i++){
+    for(j = 0; j < NBENCH; j++)
+      if(strcmp(argv[i], benches[j].name) == 0)
+        break;
+    if(j < NBENCH)
+      runbench(&benches[j], dir, nproc);
+    else
+      printf(2, "fsbench: no benchmark %s\n", argv[i]);
+  }
+  for(j = 0; j < nproc; j++)
+    unlink(numname(base, dir, "fsb", j));
+  exit();
+}
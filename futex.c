@@ -0,0 +1,60 @@
+// Futexes: sleeping and waking on a word of user memory.
+//
+// Threads keep their locks in ordinary memory and change them with
+// atomic instructions, and call futex() only to wait for a lock
+// that is taken or to wake a thread that waits for one; see
+// ukthread.c.  A word is named by its kernel address, which every
+// process that maps the same page agrees on, and that address is
+// the sleep channel.  ftx.lock makes checking the word and going
+// to sleep atomic with respect to a wake.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "futex.h"
+
+struct {
+  struct spinlock lock;
+} ftx;
+
+void
+futexinit(void)
+{
+  initlock(&ftx.lock, "futex");
+}
+
+// FUTEX_WAIT: if the word at user address addr holds val, sleep
+// until a FUTEX_WAKE on it; return 0 once woken, or -1 if the word
+// held something else or the process was killed.
+// FUTEX_WAKE: wake up to val threads waiting on addr, or all if
+// val < 0; return how many.
+int
+futex(uint addr, int op, int val)
+{
+  int *w, r;
+
+  if(addr % 4 != 0 || (w = (int*)ukey(addr)) == 0)
+    return -1;
+
+  acquire(&ftx.lock);
+  switch(op){
+  case FUTEX_WAIT:
+    if(*w != val || proc->killed){
+      r = -1;
+      break;
+    }
+    sleep(w, &ftx.lock);
+    r = proc->killed ? -1 : 0;
+    break;
+  case FUTEX_WAKE:
+    r = wakeupn(w, val);
+    break;
+  default:
+    r = -1;
+  }
+  release(&ftx.lock);
+  return r;
+}
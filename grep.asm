@@ -0,0 +1,3071 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <flush>:
+
+int match(char*, char*);
+
+static void
+flush(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  if(on > 0)
+       6:	a1 60 af 00 00       	mov    0xaf60,%eax
+       b:	85 c0                	test   %eax,%eax
+       d:	7e 18                	jle    27 <flush+0x27>
+    write(1, obuf, on);
+       f:	a1 60 af 00 00       	mov    0xaf60,%eax
+      14:	83 ec 04             	sub    $0x4,%esp
+      17:	50                   	push   %eax
+      18:	68 60 9f 00 00       	push   $0x9f60
+      1d:	6a 01                	push   $0x1
+      1f:	e8 1b 0e 00 00       	call   e3f <write>
+      24:	83 c4 10             	add    $0x10,%esp
+  on = 0;
+      27:	c7 05 60 af 00 00 00 	movl   $0x0,0xaf60
+      2e:	00 00 00 
+}
+      31:	90                   	nop
+      32:	c9                   	leave
+      33:	c3                   	ret
+
+00000034 <putline>:
+
+// Print the line from b up to e, its newline or the end of the
+// text, with a newline.
+static void
+putline(char *b, char *e)
+{
+      34:	55                   	push   %ebp
+      35:	89 e5                	mov    %esp,%ebp
+      37:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  n = e - b;
+      3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+      3d:	2b 45 08             	sub    0x8(%ebp),%eax
+      40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(on + n + 1 > sizeof(obuf)){
+      43:	8b 15 60 af 00 00    	mov    0xaf60,%edx
+      49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      4c:	01 d0                	add    %edx,%eax
+      4e:	83 c0 01             	add    $0x1,%eax
+      51:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      56:	76 3b                	jbe    93 <putline+0x5f>
+    flush();
+      58:	e8 a3 ff ff ff       	call   0 <flush>
+    if(n + 1 > sizeof(obuf)){
+      5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      60:	83 c0 01             	add    $0x1,%eax
+      63:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      68:	76 29                	jbe    93 <putline+0x5f>
+      write(1, b, n);
+      6a:	83 ec 04             	sub    $0x4,%esp
+      6d:	ff 75 f4             	push   -0xc(%ebp)
+      70:	ff 75 08             	push   0x8(%ebp)
+      73:	6a 01                	push   $0x1
+      75:	e8 c5 0d 00 00       	call   e3f <write>
+      7a:	83 c4 10             	add    $0x10,%esp
+      write(1, "\n", 1);
+      7d:	83 ec 04             	sub    $0x4,%esp
+      80:	6a 01                	push   $0x1
+      82:	68 50 19 00 00       	push   $0x1950
+      87:	6a 01                	push   $0x1
+      89:	e8 b1 0d 00 00       	call   e3f <write>
+      8e:	83 c4 10             	add    $0x10,%esp
+      return;
+      91:	eb 41                	jmp    d4 <putline+0xa0>
+    }
+  }
+  memmove(obuf + on, b, n);
+      93:	a1 60 af 00 00       	mov    0xaf60,%eax
+      98:	05 60 9f 00 00       	add    $0x9f60,%eax
+      9d:	83 ec 04             	sub    $0x4,%esp
+      a0:	ff 75 f4             	push   -0xc(%ebp)
+      a3:	ff 75 08             	push   0x8(%ebp)
+      a6:	50                   	push   %eax
+      a7:	e8 f2 0c 00 00       	call   d9e <memmove>
+      ac:	83 c4 10             	add    $0x10,%esp
+  on += n;
+      af:	8b 15 60 af 00 00    	mov    0xaf60,%edx
+      b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      b8:	01 d0                	add    %edx,%eax
+      ba:	a3 60 af 00 00       	mov    %eax,0xaf60
+  obuf[on++] = '\n';
+      bf:	a1 60 af 00 00       	mov    0xaf60,%eax
+      c4:	8d 50 01             	lea    0x1(%eax),%edx
+      c7:	89 15 60 af 00 00    	mov    %edx,0xaf60
+      cd:	c6 80 60 9f 00 00 0a 	movb   $0xa,0x9f60(%eax)
+}
+      d4:	c9                   	leave
+      d5:	c3                   	ret
+
+000000d6 <compile>:
+
+// Parse pattern re into items, the way matchhere reads it.
+// Return 0 if it has too many items for the DFA.
+static int
+compile(char *re)
+{
+      d6:	55                   	push   %ebp
+      d7:	89 e5                	mov    %esp,%ebp
+      d9:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  lit = re;
+      dc:	8b 45 08             	mov    0x8(%ebp),%eax
+      df:	a3 84 b0 00 00       	mov    %eax,0xb084
+  litlen = strlen(re);
+      e4:	83 ec 0c             	sub    $0xc,%esp
+      e7:	ff 75 08             	push   0x8(%ebp)
+      ea:	e8 32 0b 00 00       	call   c21 <strlen>
+      ef:	83 c4 10             	add    $0x10,%esp
+      f2:	a3 88 b0 00 00       	mov    %eax,0xb088
+  if(re[0] == '^'){
+      f7:	8b 45 08             	mov    0x8(%ebp),%eax
+      fa:	0f b6 00             	movzbl (%eax),%eax
+      fd:	3c 5e                	cmp    $0x5e,%al
+      ff:	75 0e                	jne    10f <compile+0x39>
+    bol = 1;
+     101:	c7 05 7c b0 00 00 01 	movl   $0x1,0xb07c
+     108:	00 00 00 
+    re++;
+     10b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  }
+  for(nitem = 0; *re; nitem++){
+     10f:	c7 05 78 b0 00 00 00 	movl   $0x0,0xb078
+     116:	00 00 00 
+     119:	e9 d4 00 00 00       	jmp    1f2 <compile+0x11c>
+    if(re[0] == '$' && re[1] == '\0'){
+     11e:	8b 45 08             	mov    0x8(%ebp),%eax
+     121:	0f b6 00             	movzbl (%eax),%eax
+     124:	3c 24                	cmp    $0x24,%al
+     126:	75 1c                	jne    144 <compile+0x6e>
+     128:	8b 45 08             	mov    0x8(%ebp),%eax
+     12b:	83 c0 01             	add    $0x1,%eax
+     12e:	0f b6 00             	movzbl (%eax),%eax
+     131:	84 c0                	test   %al,%al
+     133:	75 0f                	jne    144 <compile+0x6e>
+      eol = 1;
+     135:	c7 05 80 b0 00 00 01 	movl   $0x1,0xb080
+     13c:	00 00 00 
+      break;
+     13f:	e9 bc 00 00 00       	jmp    200 <compile+0x12a>
+    }
+    if(nitem == NITEM)
+     144:	a1 78 b0 00 00       	mov    0xb078,%eax
+     149:	83 f8 1f             	cmp    $0x1f,%eax
+     14c:	75 0a                	jne    158 <compile+0x82>
+      return 0;
+     14e:	b8 00 00 00 00       	mov    $0x0,%eax
+     153:	e9 3e 01 00 00       	jmp    296 <compile+0x1c0>
+    items[nitem].c = re[0] == '.' ? -1 : (uchar)re[0];
+     158:	8b 45 08             	mov    0x8(%ebp),%eax
+     15b:	0f b6 00             	movzbl (%eax),%eax
+     15e:	3c 2e                	cmp    $0x2e,%al
+     160:	74 0b                	je     16d <compile+0x97>
+     162:	8b 45 08             	mov    0x8(%ebp),%eax
+     165:	0f b6 00             	movzbl (%eax),%eax
+     168:	0f b6 c0             	movzbl %al,%eax
+     16b:	eb 05                	jmp    172 <compile+0x9c>
+     16d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     172:	8b 15 78 b0 00 00    	mov    0xb078,%edx
+     178:	89 04 d5 80 af 00 00 	mov    %eax,0xaf80(,%edx,8)
+    items[nitem].star = re[1] == '*';
+     17f:	8b 45 08             	mov    0x8(%ebp),%eax
+     182:	83 c0 01             	add    $0x1,%eax
+     185:	0f b6 00             	movzbl (%eax),%eax
+     188:	3c 2a                	cmp    $0x2a,%al
+     18a:	0f 94 c2             	sete   %dl
+     18d:	a1 78 b0 00 00       	mov    0xb078,%eax
+     192:	0f b6 d2             	movzbl %dl,%edx
+     195:	89 14 c5 84 af 00 00 	mov    %edx,0xaf84(,%eax,8)
+    if(items[nitem].c < 0 || items[nitem].star)
+     19c:	a1 78 b0 00 00       	mov    0xb078,%eax
+     1a1:	8b 04 c5 80 af 00 00 	mov    0xaf80(,%eax,8),%eax
+     1a8:	85 c0                	test   %eax,%eax
+     1aa:	78 10                	js     1bc <compile+0xe6>
+     1ac:	a1 78 b0 00 00       	mov    0xb078,%eax
+     1b1:	8b 04 c5 84 af 00 00 	mov    0xaf84(,%eax,8),%eax
+     1b8:	85 c0                	test   %eax,%eax
+     1ba:	74 0a                	je     1c6 <compile+0xf0>
+      lit = 0;
+     1bc:	c7 05 84 b0 00 00 00 	movl   $0x0,0xb084
+     1c3:	00 00 00 
+    re += items[nitem].star ? 2 : 1;
+     1c6:	a1 78 b0 00 00       	mov    0xb078,%eax
+     1cb:	8b 04 c5 84 af 00 00 	mov    0xaf84(,%eax,8),%eax
+     1d2:	85 c0                	test   %eax,%eax
+     1d4:	74 07                	je     1dd <compile+0x107>
+     1d6:	b8 02 00 00 00       	mov    $0x2,%eax
+     1db:	eb 05                	jmp    1e2 <compile+0x10c>
+     1dd:	b8 01 00 00 00       	mov    $0x1,%eax
+     1e2:	01 45 08             	add    %eax,0x8(%ebp)
+  for(nitem = 0; *re; nitem++){
+     1e5:	a1 78 b0 00 00       	mov    0xb078,%eax
+     1ea:	83 c0 01             	add    $0x1,%eax
+     1ed:	a3 78 b0 00 00       	mov    %eax,0xb078
+     1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f5:	0f b6 00             	movzbl (%eax),%eax
+     1f8:	84 c0                	test   %al,%al
+     1fa:	0f 85 1e ff ff ff    	jne    11e <compile+0x48>
+  }
+  if(bol || eol || litlen == 0)
+     200:	a1 7c b0 00 00       	mov    0xb07c,%eax
+     205:	85 c0                	test   %eax,%eax
+     207:	75 12                	jne    21b <compile+0x145>
+     209:	a1 80 b0 00 00       	mov    0xb080,%eax
+     20e:	85 c0                	test   %eax,%eax
+     210:	75 09                	jne    21b <compile+0x145>
+     212:	a1 88 b0 00 00       	mov    0xb088,%eax
+     217:	85 c0                	test   %eax,%eax
+     219:	75 0a                	jne    225 <compile+0x14f>
+    lit = 0;
+     21b:	c7 05 84 b0 00 00 00 	movl   $0x0,0xb084
+     222:	00 00 00 
+  if(lit){
+     225:	a1 84 b0 00 00       	mov    0xb084,%eax
+     22a:	85 c0                	test   %eax,%eax
+     22c:	74 63                	je     291 <compile+0x1bb>
+    for(i = 0; i < 256; i++)
+     22e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     235:	eb 14                	jmp    24b <compile+0x175>
+      skip[i] = litlen;
+     237:	8b 15 88 b0 00 00    	mov    0xb088,%edx
+     23d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     240:	89 14 85 a0 b0 00 00 	mov    %edx,0xb0a0(,%eax,4)
+    for(i = 0; i < 256; i++)
+     247:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     24b:	81 7d f4 ff 00 00 00 	cmpl   $0xff,-0xc(%ebp)
+     252:	7e e3                	jle    237 <compile+0x161>
+    for(i = 0; i < litlen - 1; i++)
+     254:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     25b:	eb 27                	jmp    284 <compile+0x1ae>
+      skip[(uchar)lit[i]] = litlen - 1 - i;
+     25d:	a1 88 b0 00 00       	mov    0xb088,%eax
+     262:	8d 50 ff             	lea    -0x1(%eax),%edx
+     265:	8b 0d 84 b0 00 00    	mov    0xb084,%ecx
+     26b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     26e:	01 c8                	add    %ecx,%eax
+     270:	0f b6 00             	movzbl (%eax),%eax
+     273:	0f b6 c0             	movzbl %al,%eax
+     276:	2b 55 f4             	sub    -0xc(%ebp),%edx
+     279:	89 14 85 a0 b0 00 00 	mov    %edx,0xb0a0(,%eax,4)
+    for(i = 0; i < litlen - 1; i++)
+     280:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     284:	a1 88 b0 00 00       	mov    0xb088,%eax
+     289:	83 e8 01             	sub    $0x1,%eax
+     28c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     28f:	7c cc                	jl     25d <compile+0x187>
+  }
+  return 1;
+     291:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     296:	c9                   	leave
+     297:	c3                   	ret
+
+00000298 <closure>:
+
+// Add the positions that starred items let m skip to.
+static uint
+closure(uint m)
+{
+     298:	55                   	push   %ebp
+     299:	89 e5                	mov    %esp,%ebp
+     29b:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < nitem; i++)
+     29e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     2a5:	eb 3b                	jmp    2e2 <closure+0x4a>
+    if((m & (1U << i)) && items[i].star)
+     2a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2aa:	ba 01 00 00 00       	mov    $0x1,%edx
+     2af:	89 c1                	mov    %eax,%ecx
+     2b1:	d3 e2                	shl    %cl,%edx
+     2b3:	89 d0                	mov    %edx,%eax
+     2b5:	23 45 08             	and    0x8(%ebp),%eax
+     2b8:	85 c0                	test   %eax,%eax
+     2ba:	74 22                	je     2de <closure+0x46>
+     2bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2bf:	8b 04 c5 84 af 00 00 	mov    0xaf84(,%eax,8),%eax
+     2c6:	85 c0                	test   %eax,%eax
+     2c8:	74 14                	je     2de <closure+0x46>
+      m |= 1U << (i+1);
+     2ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2cd:	83 c0 01             	add    $0x1,%eax
+     2d0:	ba 01 00 00 00       	mov    $0x1,%edx
+     2d5:	89 c1                	mov    %eax,%ecx
+     2d7:	d3 e2                	shl    %cl,%edx
+     2d9:	89 d0                	mov    %edx,%eax
+     2db:	09 45 08             	or     %eax,0x8(%ebp)
+  for(i = 0; i < nitem; i++)
+     2de:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2e2:	a1 78 b0 00 00       	mov    0xb078,%eax
+     2e7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     2ea:	7c bb                	jl     2a7 <closure+0xf>
+  return m;
+     2ec:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2ef:	c9                   	leave
+     2f0:	c3                   	ret
+
+000002f1 <addstate>:
+
+static int
+addstate(uint m)
+{
+     2f1:	55                   	push   %ebp
+     2f2:	89 e5                	mov    %esp,%ebp
+     2f4:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < nstate; i++)
+     2f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     2fe:	eb 18                	jmp    318 <addstate+0x27>
+    if(states[i] == m)
+     300:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     303:	8b 04 85 a0 b4 00 00 	mov    0xb4a0(,%eax,4),%eax
+     30a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     30d:	75 05                	jne    314 <addstate+0x23>
+      return i;
+     30f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     312:	eb 4e                	jmp    362 <addstate+0x71>
+  for(i = 0; i < nstate; i++)
+     314:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     318:	a1 a0 35 01 00       	mov    0x135a0,%eax
+     31d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     320:	7c de                	jl     300 <addstate+0xf>
+  states[nstate] = m;
+     322:	a1 a0 35 01 00       	mov    0x135a0,%eax
+     327:	8b 55 08             	mov    0x8(%ebp),%edx
+     32a:	89 14 85 a0 b4 00 00 	mov    %edx,0xb4a0(,%eax,4)
+  memset(next[nstate], 0xff, sizeof(next[nstate]));
+     331:	a1 a0 35 01 00       	mov    0x135a0,%eax
+     336:	c1 e0 09             	shl    $0x9,%eax
+     339:	05 a0 b5 00 00       	add    $0xb5a0,%eax
+     33e:	83 ec 04             	sub    $0x4,%esp
+     341:	68 00 02 00 00       	push   $0x200
+     346:	68 ff 00 00 00       	push   $0xff
+     34b:	50                   	push   %eax
+     34c:	e8 f7 08 00 00       	call   c48 <memset>
+     351:	83 c4 10             	add    $0x10,%esp
+  return nstate++;
+     354:	a1 a0 35 01 00       	mov    0x135a0,%eax
+     359:	8d 50 01             	lea    0x1(%eax),%edx
+     35c:	89 15 a0 35 01 00    	mov    %edx,0x135a0
+}
+     362:	c9                   	leave
+     363:	c3                   	ret
+
+00000364 <dfareset>:
+
+// Start over with just the start state.
+static void
+dfareset(void)
+{
+     364:	55                   	push   %ebp
+     365:	89 e5                	mov    %esp,%ebp
+     367:	83 ec 08             	sub    $0x8,%esp
+  nstate = 0;
+     36a:	c7 05 a0 35 01 00 00 	movl   $0x0,0x135a0
+     371:	00 00 00 
+  addstate(closure(1));
+     374:	6a 01                	push   $0x1
+     376:	e8 1d ff ff ff       	call   298 <closure>
+     37b:	83 c4 04             	add    $0x4,%esp
+     37e:	83 ec 0c             	sub    $0xc,%esp
+     381:	50                   	push   %eax
+     382:	e8 6a ff ff ff       	call   2f1 <addstate>
+     387:	83 c4 10             	add    $0x10,%esp
+}
+     38a:	90                   	nop
+     38b:	c9                   	leave
+     38c:	c3                   	ret
+
+0000038d <step>:
+
+// The state after byte c in state s.
+static int
+step(int s, int c)
+{
+     38d:	55                   	push   %ebp
+     38e:	89 e5                	mov    %esp,%ebp
+     390:	83 ec 18             	sub    $0x18,%esp
+  uint m, r;
+  int i, t;
+
+  if((t = next[s][c]) >= 0)
+     393:	8b 45 08             	mov    0x8(%ebp),%eax
+     396:	c1 e0 08             	shl    $0x8,%eax
+     399:	89 c2                	mov    %eax,%edx
+     39b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39e:	01 d0                	add    %edx,%eax
+     3a0:	0f b7 84 00 a0 b5 00 	movzwl 0xb5a0(%eax,%eax,1),%eax
+     3a7:	00 
+     3a8:	98                   	cwtl
+     3a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     3ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     3b0:	78 08                	js     3ba <step+0x2d>
+    return t;
+     3b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     3b5:	e9 f3 00 00 00       	jmp    4ad <step+0x120>
+  m = states[s];
+     3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+     3bd:	8b 04 85 a0 b4 00 00 	mov    0xb4a0(,%eax,4),%eax
+     3c4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  r = bol ? 0 : 1;  // a match can start anywhere
+     3c7:	a1 7c b0 00 00       	mov    0xb07c,%eax
+     3cc:	85 c0                	test   %eax,%eax
+     3ce:	0f 94 c0             	sete   %al
+     3d1:	0f b6 c0             	movzbl %al,%eax
+     3d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < nitem; i++)
+     3d7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     3de:	eb 68                	jmp    448 <step+0xbb>
+    if((m & (1U << i)) && (items[i].c < 0 || items[i].c == c))
+     3e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3e3:	ba 01 00 00 00       	mov    $0x1,%edx
+     3e8:	89 c1                	mov    %eax,%ecx
+     3ea:	d3 e2                	shl    %cl,%edx
+     3ec:	89 d0                	mov    %edx,%eax
+     3ee:	23 45 e8             	and    -0x18(%ebp),%eax
+     3f1:	85 c0                	test   %eax,%eax
+     3f3:	74 4f                	je     444 <step+0xb7>
+     3f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3f8:	8b 04 c5 80 af 00 00 	mov    0xaf80(,%eax,8),%eax
+     3ff:	85 c0                	test   %eax,%eax
+     401:	78 0f                	js     412 <step+0x85>
+     403:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     406:	8b 04 c5 80 af 00 00 	mov    0xaf80(,%eax,8),%eax
+     40d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     410:	75 32                	jne    444 <step+0xb7>
+      r |= items[i].star ? 1U << i : 1U << (i+1);
+     412:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     415:	8b 04 c5 84 af 00 00 	mov    0xaf84(,%eax,8),%eax
+     41c:	85 c0                	test   %eax,%eax
+     41e:	74 10                	je     430 <step+0xa3>
+     420:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     423:	ba 01 00 00 00       	mov    $0x1,%edx
+     428:	89 c1                	mov    %eax,%ecx
+     42a:	d3 e2                	shl    %cl,%edx
+     42c:	89 d0                	mov    %edx,%eax
+     42e:	eb 11                	jmp    441 <step+0xb4>
+     430:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     433:	83 c0 01             	add    $0x1,%eax
+     436:	ba 01 00 00 00       	mov    $0x1,%edx
+     43b:	89 c1                	mov    %eax,%ecx
+     43d:	d3 e2                	shl    %cl,%edx
+     43f:	89 d0                	mov    %edx,%eax
+     441:	09 45 f4             	or     %eax,-0xc(%ebp)
+  for(i = 0; i < nitem; i++)
+     444:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     448:	a1 78 b0 00 00       	mov    0xb078,%eax
+     44d:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     450:	7c 8e                	jl     3e0 <step+0x53>
+  r = closure(r);
+     452:	ff 75 f4             	push   -0xc(%ebp)
+     455:	e8 3e fe ff ff       	call   298 <closure>
+     45a:	83 c4 04             	add    $0x4,%esp
+     45d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(nstate == NSTATE){
+     460:	a1 a0 35 01 00       	mov    0x135a0,%eax
+     465:	83 f8 40             	cmp    $0x40,%eax
+     468:	75 15                	jne    47f <step+0xf2>
+    dfareset();
+     46a:	e8 f5 fe ff ff       	call   364 <dfareset>
+    return addstate(r);
+     46f:	83 ec 0c             	sub    $0xc,%esp
+     472:	ff 75 f4             	push   -0xc(%ebp)
+     475:	e8 77 fe ff ff       	call   2f1 <addstate>
+     47a:	83 c4 10             	add    $0x10,%esp
+     47d:	eb 2e                	jmp    4ad <step+0x120>
+  }
+  t = addstate(r);
+     47f:	83 ec 0c             	sub    $0xc,%esp
+     482:	ff 75 f4             	push   -0xc(%ebp)
+     485:	e8 67 fe ff ff       	call   2f1 <addstate>
+     48a:	83 c4 10             	add    $0x10,%esp
+     48d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  next[s][c] = t;
+     490:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     493:	89 c1                	mov    %eax,%ecx
+     495:	8b 45 08             	mov    0x8(%ebp),%eax
+     498:	c1 e0 08             	shl    $0x8,%eax
+     49b:	89 c2                	mov    %eax,%edx
+     49d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4a0:	01 d0                	add    %edx,%eax
+     4a2:	66 89 8c 00 a0 b5 00 	mov    %cx,0xb5a0(%eax,%eax,1)
+     4a9:	00 
+  return t;
+     4aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+     4ad:	c9                   	leave
+     4ae:	c3                   	ret
+
+000004af <horspool>:
+
+// Find the literal in the n bytes at s.
+static char*
+horspool(char *s, int n)
+{
+     4af:	55                   	push   %ebp
+     4b0:	89 e5                	mov    %esp,%ebp
+     4b2:	83 ec 10             	sub    $0x10,%esp
+  char *p, *end;
+  int i;
+
+  end = s + n - litlen;
+     4b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4b8:	8b 15 88 b0 00 00    	mov    0xb088,%edx
+     4be:	89 d1                	mov    %edx,%ecx
+     4c0:	29 c8                	sub    %ecx,%eax
+     4c2:	89 c2                	mov    %eax,%edx
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c7:	01 d0                	add    %edx,%eax
+     4c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(p = s; p <= end; p += skip[(uchar)p[litlen-1]]){
+     4cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     4cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     4d2:	eb 5c                	jmp    530 <horspool+0x81>
+    for(i = litlen - 1; i >= 0 && p[i] == lit[i]; i--)
+     4d4:	a1 88 b0 00 00       	mov    0xb088,%eax
+     4d9:	83 e8 01             	sub    $0x1,%eax
+     4dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4df:	eb 04                	jmp    4e5 <horspool+0x36>
+     4e1:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     4e5:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     4e9:	78 1d                	js     508 <horspool+0x59>
+     4eb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4f1:	01 d0                	add    %edx,%eax
+     4f3:	0f b6 10             	movzbl (%eax),%edx
+     4f6:	8b 0d 84 b0 00 00    	mov    0xb084,%ecx
+     4fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     4ff:	01 c8                	add    %ecx,%eax
+     501:	0f b6 00             	movzbl (%eax),%eax
+     504:	38 c2                	cmp    %al,%dl
+     506:	74 d9                	je     4e1 <horspool+0x32>
+      ;
+    if(i < 0)
+     508:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     50c:	79 05                	jns    513 <horspool+0x64>
+      return p;
+     50e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     511:	eb 2a                	jmp    53d <horspool+0x8e>
+  for(p = s; p <= end; p += skip[(uchar)p[litlen-1]]){
+     513:	a1 88 b0 00 00       	mov    0xb088,%eax
+     518:	8d 50 ff             	lea    -0x1(%eax),%edx
+     51b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     51e:	01 d0                	add    %edx,%eax
+     520:	0f b6 00             	movzbl (%eax),%eax
+     523:	0f b6 c0             	movzbl %al,%eax
+     526:	8b 04 85 a0 b0 00 00 	mov    0xb0a0(,%eax,4),%eax
+     52d:	01 45 fc             	add    %eax,-0x4(%ebp)
+     530:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     533:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     536:	73 9c                	jae    4d4 <horspool+0x25>
+  }
+  return 0;
+     538:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     53d:	c9                   	leave
+     53e:	c3                   	ret
+
+0000053f <scanlit>:
+
+static void
+scanlit(char *s, char *end)
+{
+     53f:	55                   	push   %ebp
+     540:	89 e5                	mov    %esp,%ebp
+     542:	83 ec 18             	sub    $0x18,%esp
+  char *b, *e, *q;
+
+  while(s < end && (q = horspool(s, end - s)) != 0){
+     545:	eb 62                	jmp    5a9 <scanlit+0x6a>
+    for(b = q; b > s && b[-1] != '\n'; b--)
+     547:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     54a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     54d:	eb 04                	jmp    553 <scanlit+0x14>
+     54f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     553:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     556:	39 45 08             	cmp    %eax,0x8(%ebp)
+     559:	73 0d                	jae    568 <scanlit+0x29>
+     55b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     55e:	83 e8 01             	sub    $0x1,%eax
+     561:	0f b6 00             	movzbl (%eax),%eax
+     564:	3c 0a                	cmp    $0xa,%al
+     566:	75 e7                	jne    54f <scanlit+0x10>
+      ;
+    for(e = q + litlen; e < end && *e != '\n'; e++)
+     568:	a1 88 b0 00 00       	mov    0xb088,%eax
+     56d:	89 c2                	mov    %eax,%edx
+     56f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     572:	01 d0                	add    %edx,%eax
+     574:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     577:	eb 04                	jmp    57d <scanlit+0x3e>
+     579:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     57d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     580:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     583:	73 0a                	jae    58f <scanlit+0x50>
+     585:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     588:	0f b6 00             	movzbl (%eax),%eax
+     58b:	3c 0a                	cmp    $0xa,%al
+     58d:	75 ea                	jne    579 <scanlit+0x3a>
+      ;
+    putline(b, e);
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	ff 75 f0             	push   -0x10(%ebp)
+     595:	ff 75 f4             	push   -0xc(%ebp)
+     598:	e8 97 fa ff ff       	call   34 <putline>
+     59d:	83 c4 10             	add    $0x10,%esp
+    s = e + 1;
+     5a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5a3:	83 c0 01             	add    $0x1,%eax
+     5a6:	89 45 08             	mov    %eax,0x8(%ebp)
+  while(s < end && (q = horspool(s, end - s)) != 0){
+     5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ac:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     5af:	73 22                	jae    5d3 <scanlit+0x94>
+     5b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5b4:	2b 45 08             	sub    0x8(%ebp),%eax
+     5b7:	83 ec 08             	sub    $0x8,%esp
+     5ba:	50                   	push   %eax
+     5bb:	ff 75 08             	push   0x8(%ebp)
+     5be:	e8 ec fe ff ff       	call   4af <horspool>
+     5c3:	83 c4 10             	add    $0x10,%esp
+     5c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     5c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     5cd:	0f 85 74 ff ff ff    	jne    547 <scanlit+0x8>
+  }
+}
+     5d3:	90                   	nop
+     5d4:	c9                   	leave
+     5d5:	c3                   	ret
+
+000005d6 <scandfa>:
+
+static void
+scandfa(char *s, char *end)
+{
+     5d6:	55                   	push   %ebp
+     5d7:	89 e5                	mov    %esp,%ebp
+     5d9:	83 ec 28             	sub    $0x28,%esp
+  uint done, m;
+  char *b, *p;
+  int st;
+
+  done = 1U << nitem;
+     5dc:	a1 78 b0 00 00       	mov    0xb078,%eax
+     5e1:	ba 01 00 00 00       	mov    $0x1,%edx
+     5e6:	89 c1                	mov    %eax,%ecx
+     5e8:	d3 e2                	shl    %cl,%edx
+     5ea:	89 d0                	mov    %edx,%eax
+     5ec:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(b = p = s; b < end; b = ++p){
+     5ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     5f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     5fb:	e9 ab 00 00 00       	jmp    6ab <scandfa+0xd5>
+    st = 0;
+     600:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(; p < end && *p != '\n'; p++){
+     607:	eb 47                	jmp    650 <scandfa+0x7a>
+      if((!eol && (states[st] & done)) || states[st] == 0)
+     609:	a1 80 b0 00 00       	mov    0xb080,%eax
+     60e:	85 c0                	test   %eax,%eax
+     610:	75 11                	jne    623 <scandfa+0x4d>
+     612:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     615:	8b 04 85 a0 b4 00 00 	mov    0xb4a0(,%eax,4),%eax
+     61c:	23 45 e8             	and    -0x18(%ebp),%eax
+     61f:	85 c0                	test   %eax,%eax
+     621:	75 3f                	jne    662 <scandfa+0x8c>
+     623:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     626:	8b 04 85 a0 b4 00 00 	mov    0xb4a0(,%eax,4),%eax
+     62d:	85 c0                	test   %eax,%eax
+     62f:	74 31                	je     662 <scandfa+0x8c>
+        break;  // matched, or cannot match
+      st = step(st, (uchar)*p);
+     631:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     634:	0f b6 00             	movzbl (%eax),%eax
+     637:	0f b6 c0             	movzbl %al,%eax
+     63a:	83 ec 08             	sub    $0x8,%esp
+     63d:	50                   	push   %eax
+     63e:	ff 75 ec             	push   -0x14(%ebp)
+     641:	e8 47 fd ff ff       	call   38d <step>
+     646:	83 c4 10             	add    $0x10,%esp
+     649:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for(; p < end && *p != '\n'; p++){
+     64c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     650:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     653:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     656:	73 0a                	jae    662 <scandfa+0x8c>
+     658:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     65b:	0f b6 00             	movzbl (%eax),%eax
+     65e:	3c 0a                	cmp    $0xa,%al
+     660:	75 a7                	jne    609 <scandfa+0x33>
+    }
+    m = states[st] & done;
+     662:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     665:	8b 04 85 a0 b4 00 00 	mov    0xb4a0(,%eax,4),%eax
+     66c:	23 45 e8             	and    -0x18(%ebp),%eax
+     66f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    while(p < end && *p != '\n')
+     672:	eb 04                	jmp    678 <scandfa+0xa2>
+      p++;
+     674:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(p < end && *p != '\n')
+     678:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     67b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     67e:	73 0a                	jae    68a <scandfa+0xb4>
+     680:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     683:	0f b6 00             	movzbl (%eax),%eax
+     686:	3c 0a                	cmp    $0xa,%al
+     688:	75 ea                	jne    674 <scandfa+0x9e>
+    if(m)
+     68a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     68e:	74 11                	je     6a1 <scandfa+0xcb>
+      putline(b, p);
+     690:	83 ec 08             	sub    $0x8,%esp
+     693:	ff 75 f0             	push   -0x10(%ebp)
+     696:	ff 75 f4             	push   -0xc(%ebp)
+     699:	e8 96 f9 ff ff       	call   34 <putline>
+     69e:	83 c4 10             	add    $0x10,%esp
+  for(b = p = s; b < end; b = ++p){
+     6a1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     6a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     6ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ae:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6b1:	0f 82 49 ff ff ff    	jb     600 <scandfa+0x2a>
+  }
+}
+     6b7:	90                   	nop
+     6b8:	90                   	nop
+     6b9:	c9                   	leave
+     6ba:	c3                   	ret
+
+000006bb <scanslow>:
+
+// The backtracking matcher, for patterns too long for the DFA.
+// Needs room for a 0 at end.
+static void
+scanslow(char *pattern, char *s, char *end)
+{
+     6bb:	55                   	push   %ebp
+     6bc:	89 e5                	mov    %esp,%ebp
+     6be:	83 ec 18             	sub    $0x18,%esp
+  char *q, save;
+
+  save = *end;
+     6c1:	8b 45 10             	mov    0x10(%ebp),%eax
+     6c4:	0f b6 00             	movzbl (%eax),%eax
+     6c7:	88 45 f3             	mov    %al,-0xd(%ebp)
+  *end = 0;
+     6ca:	8b 45 10             	mov    0x10(%ebp),%eax
+     6cd:	c6 00 00             	movb   $0x0,(%eax)
+  while(s < end){
+     6d0:	eb 62                	jmp    734 <scanslow+0x79>
+    if((q = strchr(s, '\n')) == 0)
+     6d2:	83 ec 08             	sub    $0x8,%esp
+     6d5:	6a 0a                	push   $0xa
+     6d7:	ff 75 0c             	push   0xc(%ebp)
+     6da:	e8 83 05 00 00       	call   c62 <strchr>
+     6df:	83 c4 10             	add    $0x10,%esp
+     6e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     6e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6e9:	75 06                	jne    6f1 <scanslow+0x36>
+      q = end;
+     6eb:	8b 45 10             	mov    0x10(%ebp),%eax
+     6ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    *q = 0;
+     6f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6f4:	c6 00 00             	movb   $0x0,(%eax)
+    if(match(pattern, s))
+     6f7:	83 ec 08             	sub    $0x8,%esp
+     6fa:	ff 75 0c             	push   0xc(%ebp)
+     6fd:	ff 75 08             	push   0x8(%ebp)
+     700:	e8 2b 03 00 00       	call   a30 <match>
+     705:	83 c4 10             	add    $0x10,%esp
+     708:	85 c0                	test   %eax,%eax
+     70a:	74 11                	je     71d <scanslow+0x62>
+      putline(s, q);
+     70c:	83 ec 08             	sub    $0x8,%esp
+     70f:	ff 75 f4             	push   -0xc(%ebp)
+     712:	ff 75 0c             	push   0xc(%ebp)
+     715:	e8 1a f9 ff ff       	call   34 <putline>
+     71a:	83 c4 10             	add    $0x10,%esp
+    if(q < end)
+     71d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     720:	3b 45 10             	cmp    0x10(%ebp),%eax
+     723:	73 06                	jae    72b <scanslow+0x70>
+      *q = '\n';
+     725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     728:	c6 00 0a             	movb   $0xa,(%eax)
+    s = q + 1;
+     72b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     72e:	83 c0 01             	add    $0x1,%eax
+     731:	89 45 0c             	mov    %eax,0xc(%ebp)
+  while(s < end){
+     734:	8b 45 0c             	mov    0xc(%ebp),%eax
+     737:	3b 45 10             	cmp    0x10(%ebp),%eax
+     73a:	72 96                	jb     6d2 <scanslow+0x17>
+  }
+  *end = save;
+     73c:	8b 45 10             	mov    0x10(%ebp),%eax
+     73f:	0f b6 55 f3          	movzbl -0xd(%ebp),%edx
+     743:	88 10                	mov    %dl,(%eax)
+}
+     745:	90                   	nop
+     746:	c9                   	leave
+     747:	c3                   	ret
+
+00000748 <scan>:
+
+// Print the lines that match among the n bytes at s, all of them
+// whole lines, the last perhaps without its newline.
+static void
+scan(char *pattern, char *s, int n, int slow)
+{
+     748:	55                   	push   %ebp
+     749:	89 e5                	mov    %esp,%ebp
+     74b:	83 ec 08             	sub    $0x8,%esp
+  if(slow)
+     74e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     752:	74 1c                	je     770 <scan+0x28>
+    scanslow(pattern, s, s + n);
+     754:	8b 55 10             	mov    0x10(%ebp),%edx
+     757:	8b 45 0c             	mov    0xc(%ebp),%eax
+     75a:	01 d0                	add    %edx,%eax
+     75c:	83 ec 04             	sub    $0x4,%esp
+     75f:	50                   	push   %eax
+     760:	ff 75 0c             	push   0xc(%ebp)
+     763:	ff 75 08             	push   0x8(%ebp)
+     766:	e8 50 ff ff ff       	call   6bb <scanslow>
+     76b:	83 c4 10             	add    $0x10,%esp
+  else if(lit)
+    scanlit(s, s + n);
+  else
+    scandfa(s, s + n);
+}
+     76e:	eb 39                	jmp    7a9 <scan+0x61>
+  else if(lit)
+     770:	a1 84 b0 00 00       	mov    0xb084,%eax
+     775:	85 c0                	test   %eax,%eax
+     777:	74 19                	je     792 <scan+0x4a>
+    scanlit(s, s + n);
+     779:	8b 55 10             	mov    0x10(%ebp),%edx
+     77c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77f:	01 d0                	add    %edx,%eax
+     781:	83 ec 08             	sub    $0x8,%esp
+     784:	50                   	push   %eax
+     785:	ff 75 0c             	push   0xc(%ebp)
+     788:	e8 b2 fd ff ff       	call   53f <scanlit>
+     78d:	83 c4 10             	add    $0x10,%esp
+}
+     790:	eb 17                	jmp    7a9 <scan+0x61>
+    scandfa(s, s + n);
+     792:	8b 55 10             	mov    0x10(%ebp),%edx
+     795:	8b 45 0c             	mov    0xc(%ebp),%eax
+     798:	01 d0                	add    %edx,%eax
+     79a:	83 ec 08             	sub    $0x8,%esp
+     79d:	50                   	push   %eax
+     79e:	ff 75 0c             	push   0xc(%ebp)
+     7a1:	e8 30 fe ff ff       	call   5d6 <scandfa>
+     7a6:	83 c4 10             	add    $0x10,%esp
+}
+     7a9:	90                   	nop
+     7aa:	c9                   	leave
+     7ab:	c3                   	ret
+
+000007ac <grep>:
+
+void
+grep(char *pattern, int fd, int slow)
+{
+     7ac:	55                   	push   %ebp
+     7ad:	89 e5                	mov    %esp,%ebp
+     7af:	83 ec 38             	sub    $0x38,%esp
+  struct stat st;
+  int n, m;
+  char *p, *q;
+
+  if(!slow && fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+     7b2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7b6:	75 76                	jne    82e <grep+0x82>
+     7b8:	83 ec 08             	sub    $0x8,%esp
+     7bb:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     7be:	50                   	push   %eax
+     7bf:	ff 75 0c             	push   0xc(%ebp)
+     7c2:	e8 b2 06 00 00       	call   e79 <fstat>
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	85 c0                	test   %eax,%eax
+     7cc:	75 60                	jne    82e <grep+0x82>
+     7ce:	0f b7 45 d4          	movzwl -0x2c(%ebp),%eax
+     7d2:	66 83 f8 02          	cmp    $0x2,%ax
+     7d6:	75 56                	jne    82e <grep+0x82>
+     7d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	74 4f                	je     82e <grep+0x82>
+     (p = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != (char*)-1){
+     7df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7e2:	83 ec 08             	sub    $0x8,%esp
+     7e5:	6a 00                	push   $0x0
+     7e7:	ff 75 0c             	push   0xc(%ebp)
+     7ea:	6a 01                	push   $0x1
+     7ec:	6a 01                	push   $0x1
+     7ee:	50                   	push   %eax
+     7ef:	6a 00                	push   $0x0
+     7f1:	e8 0f 07 00 00       	call   f05 <mmap>
+     7f6:	83 c4 20             	add    $0x20,%esp
+     7f9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(!slow && fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+     7fc:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%ebp)
+     800:	74 2c                	je     82e <grep+0x82>
+    scan(pattern, p, st.size, slow);
+     802:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     805:	ff 75 10             	push   0x10(%ebp)
+     808:	50                   	push   %eax
+     809:	ff 75 ec             	push   -0x14(%ebp)
+     80c:	ff 75 08             	push   0x8(%ebp)
+     80f:	e8 34 ff ff ff       	call   748 <scan>
+     814:	83 c4 10             	add    $0x10,%esp
+    munmap(p, st.size);
+     817:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     81a:	83 ec 08             	sub    $0x8,%esp
+     81d:	50                   	push   %eax
+     81e:	ff 75 ec             	push   -0x14(%ebp)
+     821:	e8 e9 06 00 00       	call   f0f <munmap>
+     826:	83 c4 10             	add    $0x10,%esp
+     829:	e9 de 00 00 00       	jmp    90c <grep+0x160>
+    return;
+  }
+
+  m = 0;
+     82e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, BUFSIZE-m)) > 0){
+     835:	e9 88 00 00 00       	jmp    8c2 <grep+0x116>
+    m += n;
+     83a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     83d:	01 45 f4             	add    %eax,-0xc(%ebp)
+    for(q = buf+m; q > buf && q[-1] != '\n'; q--)
+     840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     843:	05 40 1f 00 00       	add    $0x1f40,%eax
+     848:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     84b:	eb 04                	jmp    851 <grep+0xa5>
+     84d:	83 6d f0 01          	subl   $0x1,-0x10(%ebp)
+     851:	81 7d f0 40 1f 00 00 	cmpl   $0x1f40,-0x10(%ebp)
+     858:	76 0d                	jbe    867 <grep+0xbb>
+     85a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     85d:	83 e8 01             	sub    $0x1,%eax
+     860:	0f b6 00             	movzbl (%eax),%eax
+     863:	3c 0a                	cmp    $0xa,%al
+     865:	75 e6                	jne    84d <grep+0xa1>
+      ;
+    if(q == buf){
+     867:	81 7d f0 40 1f 00 00 	cmpl   $0x1f40,-0x10(%ebp)
+     86e:	75 12                	jne    882 <grep+0xd6>
+      if(m == BUFSIZE)
+     870:	81 7d f4 00 80 00 00 	cmpl   $0x8000,-0xc(%ebp)
+     877:	75 48                	jne    8c1 <grep+0x115>
+        m = 0;  // line too long
+     879:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      continue;
+     880:	eb 3f                	jmp    8c1 <grep+0x115>
+    }
+    scan(pattern, buf, q - buf, slow);
+     882:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     885:	2d 40 1f 00 00       	sub    $0x1f40,%eax
+     88a:	ff 75 10             	push   0x10(%ebp)
+     88d:	50                   	push   %eax
+     88e:	68 40 1f 00 00       	push   $0x1f40
+     893:	ff 75 08             	push   0x8(%ebp)
+     896:	e8 ad fe ff ff       	call   748 <scan>
+     89b:	83 c4 10             	add    $0x10,%esp
+    m -= q - buf;
+     89e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     8a1:	2d 40 1f 00 00       	sub    $0x1f40,%eax
+     8a6:	29 45 f4             	sub    %eax,-0xc(%ebp)
+    memmove(buf, q, m);
+     8a9:	83 ec 04             	sub    $0x4,%esp
+     8ac:	ff 75 f4             	push   -0xc(%ebp)
+     8af:	ff 75 f0             	push   -0x10(%ebp)
+     8b2:	68 40 1f 00 00       	push   $0x1f40
+     8b7:	e8 e2 04 00 00       	call   d9e <memmove>
+     8bc:	83 c4 10             	add    $0x10,%esp
+     8bf:	eb 01                	jmp    8c2 <grep+0x116>
+      continue;
+     8c1:	90                   	nop
+  while((n = read(fd, buf+m, BUFSIZE-m)) > 0){
+     8c2:	b8 00 80 00 00       	mov    $0x8000,%eax
+     8c7:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     8ca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     8cd:	81 c2 40 1f 00 00    	add    $0x1f40,%edx
+     8d3:	83 ec 04             	sub    $0x4,%esp
+     8d6:	50                   	push   %eax
+     8d7:	52                   	push   %edx
+     8d8:	ff 75 0c             	push   0xc(%ebp)
+     8db:	e8 58 05 00 00       	call   e38 <read>
+     8e0:	83 c4 10             	add    $0x10,%esp
+     8e3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     8e6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     8ea:	0f 8f 4a ff ff ff    	jg     83a <grep+0x8e>
+  }
+  if(m > 0)
+     8f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8f4:	7e 16                	jle    90c <grep+0x160>
+    scan(pattern, buf, m, slow);
+     8f6:	ff 75 10             	push   0x10(%ebp)
+     8f9:	ff 75 f4             	push   -0xc(%ebp)
+     8fc:	68 40 1f 00 00       	push   $0x1f40
+     901:	ff 75 08             	push   0x8(%ebp)
+     904:	e8 3f fe ff ff       	call   748 <scan>
+     909:	83 c4 10             	add    $0x10,%esp
+}
+     90c:	c9                   	leave
+     90d:	c3                   	ret
+
+0000090e <main>:
+
+int
+main(int argc, char *argv[])
+{
+     90e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     912:	83 e4 f0             	and    $0xfffffff0,%esp
+     915:	ff 71 fc             	push   -0x4(%ecx)
+     918:	55                   	push   %ebp
+     919:	89 e5                	mov    %esp,%ebp
+     91b:	53                   	push   %ebx
+     91c:	51                   	push   %ecx
+     91d:	83 ec 10             	sub    $0x10,%esp
+     920:	89 cb                	mov    %ecx,%ebx
+  int fd, i, slow;
+  char *pattern;
+
+  if(argc <= 1){
+     922:	83 3b 01             	cmpl   $0x1,(%ebx)
+     925:	7f 17                	jg     93e <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+     927:	83 ec 08             	sub    $0x8,%esp
+     92a:	68 54 19 00 00       	push   $0x1954
+     92f:	6a 02                	push   $0x2
+     931:	e8 7d 09 00 00       	call   12b3 <printf>
+     936:	83 c4 10             	add    $0x10,%esp
+    exit();
+     939:	e8 e5 04 00 00       	call   e23 <exit>
+  }
+  pattern = argv[1];
+     93e:	8b 43 04             	mov    0x4(%ebx),%eax
+     941:	8b 40 04             	mov    0x4(%eax),%eax
+     944:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  slow = !compile(pattern);
+     947:	83 ec 0c             	sub    $0xc,%esp
+     94a:	ff 75 f0             	push   -0x10(%ebp)
+     94d:	e8 84 f7 ff ff       	call   d6 <compile>
+     952:	83 c4 10             	add    $0x10,%esp
+     955:	85 c0                	test   %eax,%eax
+     957:	0f 94 c0             	sete   %al
+     95a:	0f b6 c0             	movzbl %al,%eax
+     95d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(!slow && !lit)
+     960:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     964:	75 0e                	jne    974 <main+0x66>
+     966:	a1 84 b0 00 00       	mov    0xb084,%eax
+     96b:	85 c0                	test   %eax,%eax
+     96d:	75 05                	jne    974 <main+0x66>
+    dfareset();
+     96f:	e8 f0 f9 ff ff       	call   364 <dfareset>
+
+  if(argc <= 2){
+     974:	83 3b 02             	cmpl   $0x2,(%ebx)
+     977:	7f 1d                	jg     996 <main+0x88>
+    grep(pattern, 0, slow);
+     979:	83 ec 04             	sub    $0x4,%esp
+     97c:	ff 75 ec             	push   -0x14(%ebp)
+     97f:	6a 00                	push   $0x0
+     981:	ff 75 f0             	push   -0x10(%ebp)
+     984:	e8 23 fe ff ff       	call   7ac <grep>
+     989:	83 c4 10             	add    $0x10,%esp
+    flush();
+     98c:	e8 6f f6 ff ff       	call   0 <flush>
+    exit();
+     991:	e8 8d 04 00 00       	call   e23 <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+     996:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+     99d:	eb 7c                	jmp    a1b <main+0x10d>
+    if((fd = open(argv[i], 0)) < 0){
+     99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9a2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     9a9:	8b 43 04             	mov    0x4(%ebx),%eax
+     9ac:	01 d0                	add    %edx,%eax
+     9ae:	8b 00                	mov    (%eax),%eax
+     9b0:	83 ec 08             	sub    $0x8,%esp
+     9b3:	6a 00                	push   $0x0
+     9b5:	50                   	push   %eax
+     9b6:	e8 a0 04 00 00       	call   e5b <open>
+     9bb:	83 c4 10             	add    $0x10,%esp
+     9be:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     9c1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     9c5:	79 2e                	jns    9f5 <main+0xe7>
+      flush();
+     9c7:	e8 34 f6 ff ff       	call   0 <flush>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     9cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9cf:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     9d6:	8b 43 04             	mov    0x4(%ebx),%eax
+     9d9:	01 d0                	add    %edx,%eax
+     9db:	8b 00                	mov    (%eax),%eax
+     9dd:	83 ec 04             	sub    $0x4,%esp
+     9e0:	50                   	push   %eax
+     9e1:	68 74 19 00 00       	push   $0x1974
+     9e6:	6a 01                	push   $0x1
+     9e8:	e8 c6 08 00 00       	call   12b3 <printf>
+     9ed:	83 c4 10             	add    $0x10,%esp
+      exit();
+     9f0:	e8 2e 04 00 00       	call   e23 <exit>
+    }
+    grep(pattern, fd, slow);
+     9f5:	83 ec 04             	sub    $0x4,%esp
+     9f8:	ff 75 ec             	push   -0x14(%ebp)
+     9fb:	ff 75 e8             	push   -0x18(%ebp)
+     9fe:	ff 75 f0             	push   -0x10(%ebp)
+     a01:	e8 a6 fd ff ff       	call   7ac <grep>
+     a06:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     a09:	83 ec 0c             	sub    $0xc,%esp
+     a0c:	ff 75 e8             	push   -0x18(%ebp)
+     a0f:	e8 32 04 00 00       	call   e46 <close>
+     a14:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+     a17:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a1e:	3b 03                	cmp    (%ebx),%eax
+     a20:	0f 8c 79 ff ff ff    	jl     99f <main+0x91>
+  }
+  flush();
+     a26:	e8 d5 f5 ff ff       	call   0 <flush>
+  exit();
+     a2b:	e8 f3 03 00 00       	call   e23 <exit>
+
+00000a30 <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+     a36:	8b 45 08             	mov    0x8(%ebp),%eax
+     a39:	0f b6 00             	movzbl (%eax),%eax
+     a3c:	3c 5e                	cmp    $0x5e,%al
+     a3e:	75 17                	jne    a57 <match+0x27>
+    return matchhere(re+1, text);
+     a40:	8b 45 08             	mov    0x8(%ebp),%eax
+     a43:	83 c0 01             	add    $0x1,%eax
+     a46:	83 ec 08             	sub    $0x8,%esp
+     a49:	ff 75 0c             	push   0xc(%ebp)
+     a4c:	50                   	push   %eax
+     a4d:	e8 38 00 00 00       	call   a8a <matchhere>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	eb 31                	jmp    a88 <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+     a57:	83 ec 08             	sub    $0x8,%esp
+     a5a:	ff 75 0c             	push   0xc(%ebp)
+     a5d:	ff 75 08             	push   0x8(%ebp)
+     a60:	e8 25 00 00 00       	call   a8a <matchhere>
+     a65:	83 c4 10             	add    $0x10,%esp
+     a68:	85 c0                	test   %eax,%eax
+     a6a:	74 07                	je     a73 <match+0x43>
+      return 1;
+     a6c:	b8 01 00 00 00       	mov    $0x1,%eax
+     a71:	eb 15                	jmp    a88 <match+0x58>
+  }while(*text++ != '\0');
+     a73:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a76:	8d 50 01             	lea    0x1(%eax),%edx
+     a79:	89 55 0c             	mov    %edx,0xc(%ebp)
+     a7c:	0f b6 00             	movzbl (%eax),%eax
+     a7f:	84 c0                	test   %al,%al
+     a81:	75 d4                	jne    a57 <match+0x27>
+  return 0;
+     a83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     a88:	c9                   	leave
+     a89:	c3                   	ret
+
+00000a8a <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+     a8a:	55                   	push   %ebp
+     a8b:	89 e5                	mov    %esp,%ebp
+     a8d:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+     a90:	8b 45 08             	mov    0x8(%ebp),%eax
+     a93:	0f b6 00             	movzbl (%eax),%eax
+     a96:	84 c0                	test   %al,%al
+     a98:	75 0a                	jne    aa4 <matchhere+0x1a>
+    return 1;
+     a9a:	b8 01 00 00 00       	mov    $0x1,%eax
+     a9f:	e9 99 00 00 00       	jmp    b3d <matchhere+0xb3>
+  if(re[1] == '*')
+     aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa7:	83 c0 01             	add    $0x1,%eax
+     aaa:	0f b6 00             	movzbl (%eax),%eax
+     aad:	3c 2a                	cmp    $0x2a,%al
+     aaf:	75 21                	jne    ad2 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+     ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab4:	8d 50 02             	lea    0x2(%eax),%edx
+     ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+     aba:	0f b6 00             	movzbl (%eax),%eax
+     abd:	0f be c0             	movsbl %al,%eax
+     ac0:	83 ec 04             	sub    $0x4,%esp
+     ac3:	ff 75 0c             	push   0xc(%ebp)
+     ac6:	52                   	push   %edx
+     ac7:	50                   	push   %eax
+     ac8:	e8 72 00 00 00       	call   b3f <matchstar>
+     acd:	83 c4 10             	add    $0x10,%esp
+     ad0:	eb 6b                	jmp    b3d <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+     ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad5:	0f b6 00             	movzbl (%eax),%eax
+     ad8:	3c 24                	cmp    $0x24,%al
+     ada:	75 1d                	jne    af9 <matchhere+0x6f>
+     adc:	8b 45 08             	mov    0x8(%ebp),%eax
+     adf:	83 c0 01             	add    $0x1,%eax
+     ae2:	0f b6 00             	movzbl (%eax),%eax
+     ae5:	84 c0                	test   %al,%al
+     ae7:	75 10                	jne    af9 <matchhere+0x6f>
+    return *text == '\0';
+     ae9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     aec:	0f b6 00             	movzbl (%eax),%eax
+     aef:	84 c0                	test   %al,%al
+     af1:	0f 94 c0             	sete   %al
+     af4:	0f b6 c0             	movzbl %al,%eax
+     af7:	eb 44                	jmp    b3d <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     af9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     afc:	0f b6 00             	movzbl (%eax),%eax
+     aff:	84 c0                	test   %al,%al
+     b01:	74 35                	je     b38 <matchhere+0xae>
+     b03:	8b 45 08             	mov    0x8(%ebp),%eax
+     b06:	0f b6 00             	movzbl (%eax),%eax
+     b09:	3c 2e                	cmp    $0x2e,%al
+     b0b:	74 10                	je     b1d <matchhere+0x93>
+     b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b10:	0f b6 10             	movzbl (%eax),%edx
+     b13:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b16:	0f b6 00             	movzbl (%eax),%eax
+     b19:	38 c2                	cmp    %al,%dl
+     b1b:	75 1b                	jne    b38 <matchhere+0xae>
+    return matchhere(re+1, text+1);
+     b1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b20:	8d 50 01             	lea    0x1(%eax),%edx
+     b23:	8b 45 08             	mov    0x8(%ebp),%eax
+     b26:	83 c0 01             	add    $0x1,%eax
+     b29:	83 ec 08             	sub    $0x8,%esp
+     b2c:	52                   	push   %edx
+     b2d:	50                   	push   %eax
+     b2e:	e8 57 ff ff ff       	call   a8a <matchhere>
+     b33:	83 c4 10             	add    $0x10,%esp
+     b36:	eb 05                	jmp    b3d <matchhere+0xb3>
+  return 0;
+     b38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b3d:	c9                   	leave
+     b3e:	c3                   	ret
+
+00000b3f <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+     b3f:	55                   	push   %ebp
+     b40:	89 e5                	mov    %esp,%ebp
+     b42:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     b45:	83 ec 08             	sub    $0x8,%esp
+     b48:	ff 75 10             	push   0x10(%ebp)
+     b4b:	ff 75 0c             	push   0xc(%ebp)
+     b4e:	e8 37 ff ff ff       	call   a8a <matchhere>
+     b53:	83 c4 10             	add    $0x10,%esp
+     b56:	85 c0                	test   %eax,%eax
+     b58:	74 07                	je     b61 <matchstar+0x22>
+      return 1;
+     b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+     b5f:	eb 29                	jmp    b8a <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     b61:	8b 45 10             	mov    0x10(%ebp),%eax
+     b64:	0f b6 00             	movzbl (%eax),%eax
+     b67:	84 c0                	test   %al,%al
+     b69:	74 1a                	je     b85 <matchstar+0x46>
+     b6b:	8b 45 10             	mov    0x10(%ebp),%eax
+     b6e:	8d 50 01             	lea    0x1(%eax),%edx
+     b71:	89 55 10             	mov    %edx,0x10(%ebp)
+     b74:	0f b6 00             	movzbl (%eax),%eax
+     b77:	0f be c0             	movsbl %al,%eax
+     b7a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     b7d:	74 c6                	je     b45 <matchstar+0x6>
+     b7f:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+     b83:	74 c0                	je     b45 <matchstar+0x6>
+  return 0;
+     b85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b8a:	c9                   	leave
+     b8b:	c3                   	ret
+
+00000b8c <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     b8c:	55                   	push   %ebp
+     b8d:	89 e5                	mov    %esp,%ebp
+     b8f:	57                   	push   %edi
+     b90:	53                   	push   %ebx
+    if(cc < 1)
+     b91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b94:	8b 55 10             	mov    0x10(%ebp),%edx
+     b97:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b9a:	89 cb                	mov    %ecx,%ebx
+     b9c:	89 df                	mov    %ebx,%edi
+     b9e:	89 d1                	mov    %edx,%ecx
+     ba0:	fc                   	cld
+     ba1:	f3 aa                	rep stos %al,%es:(%edi)
+     ba3:	89 ca                	mov    %ecx,%edx
+     ba5:	89 fb                	mov    %edi,%ebx
+     ba7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     baa:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     bad:	90                   	nop
+     bae:	5b                   	pop    %ebx
+     baf:	5f                   	pop    %edi
+     bb0:	5d                   	pop    %ebp
+     bb1:	c3                   	ret
+
+00000bb2 <strcpy>:
+{
+     bb2:	55                   	push   %ebp
+     bb3:	89 e5                	mov    %esp,%ebp
+     bb5:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     bbe:	90                   	nop
+     bbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bc2:	8d 42 01             	lea    0x1(%edx),%eax
+     bc5:	89 45 0c             	mov    %eax,0xc(%ebp)
+     bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bcb:	8d 48 01             	lea    0x1(%eax),%ecx
+     bce:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     bd1:	0f b6 12             	movzbl (%edx),%edx
+     bd4:	88 10                	mov    %dl,(%eax)
+     bd6:	0f b6 00             	movzbl (%eax),%eax
+     bd9:	84 c0                	test   %al,%al
+     bdb:	75 e2                	jne    bbf <strcpy+0xd>
+  return os;
+     bdd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     be0:	c9                   	leave
+     be1:	c3                   	ret
+
+00000be2 <strcmp>:
+{
+     be2:	55                   	push   %ebp
+     be3:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     be5:	eb 08                	jmp    bef <strcmp+0xd>
+    p++, q++;
+     be7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     beb:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     bef:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf2:	0f b6 00             	movzbl (%eax),%eax
+     bf5:	84 c0                	test   %al,%al
+     bf7:	74 10                	je     c09 <strcmp+0x27>
+     bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfc:	0f b6 10             	movzbl (%eax),%edx
+     bff:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c02:	0f b6 00             	movzbl (%eax),%eax
+     c05:	38 c2                	cmp    %al,%dl
+     c07:	74 de                	je     be7 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     c09:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0c:	0f b6 00             	movzbl (%eax),%eax
+     c0f:	0f b6 d0             	movzbl %al,%edx
+     c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c15:	0f b6 00             	movzbl (%eax),%eax
+     c18:	0f b6 c0             	movzbl %al,%eax
+     c1b:	29 c2                	sub    %eax,%edx
+     c1d:	89 d0                	mov    %edx,%eax
+}
+     c1f:	5d                   	pop    %ebp
+     c20:	c3                   	ret
+
+00000c21 <strlen>:
+{
+     c21:	55                   	push   %ebp
+     c22:	89 e5                	mov    %esp,%ebp
+     c24:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     c27:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c2e:	eb 04                	jmp    c34 <strlen+0x13>
+     c30:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     c34:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     c37:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3a:	01 d0                	add    %edx,%eax
+     c3c:	0f b6 00             	movzbl (%eax),%eax
+     c3f:	84 c0                	test   %al,%al
+     c41:	75 ed                	jne    c30 <strlen+0xf>
+  return n;
+     c43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     c46:	c9                   	leave
+     c47:	c3                   	ret
+
+00000c48 <memset>:
+{
+     c48:	55                   	push   %ebp
+     c49:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     c4b:	8b 45 10             	mov    0x10(%ebp),%eax
+     c4e:	50                   	push   %eax
+     c4f:	ff 75 0c             	push   0xc(%ebp)
+     c52:	ff 75 08             	push   0x8(%ebp)
+     c55:	e8 32 ff ff ff       	call   b8c <stosb>
+     c5a:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c60:	c9                   	leave
+     c61:	c3                   	ret
+
+00000c62 <strchr>:
+{
+     c62:	55                   	push   %ebp
+     c63:	89 e5                	mov    %esp,%ebp
+     c65:	83 ec 04             	sub    $0x4,%esp
+     c68:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c6b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     c6e:	eb 14                	jmp    c84 <strchr+0x22>
+    if(*s == c)
+     c70:	8b 45 08             	mov    0x8(%ebp),%eax
+     c73:	0f b6 00             	movzbl (%eax),%eax
+     c76:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     c79:	75 05                	jne    c80 <strchr+0x1e>
+      return (char*)s;
+     c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7e:	eb 13                	jmp    c93 <strchr+0x31>
+  for(; *s; s++)
+     c80:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     c84:	8b 45 08             	mov    0x8(%ebp),%eax
+     c87:	0f b6 00             	movzbl (%eax),%eax
+     c8a:	84 c0                	test   %al,%al
+     c8c:	75 e2                	jne    c70 <strchr+0xe>
+  return 0;
+     c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     c93:	c9                   	leave
+     c94:	c3                   	ret
+
+00000c95 <gets>:
+{
+     c95:	55                   	push   %ebp
+     c96:	89 e5                	mov    %esp,%ebp
+     c98:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     c9b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ca2:	eb 42                	jmp    ce6 <gets+0x51>
+    cc = read(0, &c, 1);
+     ca4:	83 ec 04             	sub    $0x4,%esp
+     ca7:	6a 01                	push   $0x1
+     ca9:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     cac:	50                   	push   %eax
+     cad:	6a 00                	push   $0x0
+     caf:	e8 84 01 00 00       	call   e38 <read>
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     cba:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cbe:	7e 33                	jle    cf3 <gets+0x5e>
+    buf[i++] = c;
+     cc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cc3:	8d 50 01             	lea    0x1(%eax),%edx
+     cc6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cc9:	89 c2                	mov    %eax,%edx
+     ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cce:	01 c2                	add    %eax,%edx
+     cd0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     cd4:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     cd6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     cda:	3c 0a                	cmp    $0xa,%al
+     cdc:	74 16                	je     cf4 <gets+0x5f>
+     cde:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     ce2:	3c 0d                	cmp    $0xd,%al
+     ce4:	74 0e                	je     cf4 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     ce6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ce9:	83 c0 01             	add    $0x1,%eax
+     cec:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     cef:	7f b3                	jg     ca4 <gets+0xf>
+     cf1:	eb 01                	jmp    cf4 <gets+0x5f>
+      break;
+     cf3:	90                   	nop
+  }
+  buf[i] = '\0';
+     cf4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     cf7:	8b 45 08             	mov    0x8(%ebp),%eax
+     cfa:	01 d0                	add    %edx,%eax
+     cfc:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     cff:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     d02:	c9                   	leave
+     d03:	c3                   	ret
+
+00000d04 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d04:	55                   	push   %ebp
+     d05:	89 e5                	mov    %esp,%ebp
+     d07:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d0a:	83 ec 08             	sub    $0x8,%esp
+     d0d:	6a 00                	push   $0x0
+     d0f:	ff 75 08             	push   0x8(%ebp)
+     d12:	e8 44 01 00 00       	call   e5b <open>
+     d17:	83 c4 10             	add    $0x10,%esp
+     d1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     d1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d21:	79 07                	jns    d2a <stat+0x26>
+    return -1;
+     d23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d28:	eb 25                	jmp    d4f <stat+0x4b>
+  r = fstat(fd, st);
+     d2a:	83 ec 08             	sub    $0x8,%esp
+     d2d:	ff 75 0c             	push   0xc(%ebp)
+     d30:	ff 75 f4             	push   -0xc(%ebp)
+     d33:	e8 41 01 00 00       	call   e79 <fstat>
+     d38:	83 c4 10             	add    $0x10,%esp
+     d3b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     d3e:	83 ec 0c             	sub    $0xc,%esp
+     d41:	ff 75 f4             	push   -0xc(%ebp)
+     d44:	e8 fd 00 00 00       	call   e46 <close>
+     d49:	83 c4 10             	add    $0x10,%esp
+  return r;
+     d4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     d4f:	c9                   	leave
+     d50:	c3                   	ret
+
+00000d51 <atoi>:
+
+int
+atoi(const char *s)
+{
+     d51:	55                   	push   %ebp
+     d52:	89 e5                	mov    %esp,%ebp
+     d54:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     d57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     d5e:	eb 25                	jmp    d85 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     d60:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     d63:	89 d0                	mov    %edx,%eax
+     d65:	c1 e0 02             	shl    $0x2,%eax
+     d68:	01 d0                	add    %edx,%eax
+     d6a:	01 c0                	add    %eax,%eax
+     d6c:	89 c1                	mov    %eax,%ecx
+     d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d71:	8d 50 01             	lea    0x1(%eax),%edx
+     d74:	89 55 08             	mov    %edx,0x8(%ebp)
+     d77:	0f b6 00             	movzbl (%eax),%eax
+     d7a:	0f be c0             	movsbl %al,%eax
+     d7d:	01 c8                	add    %ecx,%eax
+     d7f:	83 e8 30             	sub    $0x30,%eax
+     d82:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     d85:	8b 45 08             	mov    0x8(%ebp),%eax
+     d88:	0f b6 00             	movzbl (%eax),%eax
+     d8b:	3c 2f                	cmp    $0x2f,%al
+     d8d:	7e 0a                	jle    d99 <atoi+0x48>
+     d8f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d92:	0f b6 00             	movzbl (%eax),%eax
+     d95:	3c 39                	cmp    $0x39,%al
+     d97:	7e c7                	jle    d60 <atoi+0xf>
+  return n;
+     d99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d9c:	c9                   	leave
+     d9d:	c3                   	ret
+
+00000d9e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     d9e:	55                   	push   %ebp
+     d9f:	89 e5                	mov    %esp,%ebp
+     da1:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     da4:	8b 45 08             	mov    0x8(%ebp),%eax
+     da7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     daa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     dad:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     db0:	eb 17                	jmp    dc9 <memmove+0x2b>
+    *dst++ = *src++;
+     db2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     db5:	8d 42 01             	lea    0x1(%edx),%eax
+     db8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     dbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dbe:	8d 48 01             	lea    0x1(%eax),%ecx
+     dc1:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     dc4:	0f b6 12             	movzbl (%edx),%edx
+     dc7:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     dc9:	8b 45 10             	mov    0x10(%ebp),%eax
+     dcc:	8d 50 ff             	lea    -0x1(%eax),%edx
+     dcf:	89 55 10             	mov    %edx,0x10(%ebp)
+     dd2:	85 c0                	test   %eax,%eax
+     dd4:	7f dc                	jg     db2 <memmove+0x14>
+  return vdst;
+     dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     dd9:	c9                   	leave
+     dda:	c3                   	ret
+
+00000ddb <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     ddb:	83 3d 1c 1f 00 00 00 	cmpl   $0x0,0x1f1c
+  jg 2f
+     de2:	7f 2e                	jg     e12 <dosyscall+0x37>
+  jl 1f
+     de4:	7c 29                	jl     e0f <dosyscall+0x34>
+  pushl %eax
+     de6:	50                   	push   %eax
+  pushl %ebx
+     de7:	53                   	push   %ebx
+  movl $1, %eax
+     de8:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     ded:	0f a2                	cpuid
+  popl %ebx
+     def:	5b                   	pop    %ebx
+  popl %eax
+     df0:	58                   	pop    %eax
+  movl $-1, sysmode
+     df1:	c7 05 1c 1f 00 00 ff 	movl   $0xffffffff,0x1f1c
+     df8:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     dfb:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     e01:	74 0c                	je     e0f <dosyscall+0x34>
+  movl $1, sysmode
+     e03:	c7 05 1c 1f 00 00 01 	movl   $0x1,0x1f1c
+     e0a:	00 00 00 
+  jmp 2f
+     e0d:	eb 03                	jmp    e12 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     e0f:	cd 40                	int    $0x40
+  ret
+     e11:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     e12:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     e14:	ba 1b 0e 00 00       	mov    $0xe1b,%edx
+  sysenter
+     e19:	0f 34                	sysenter
+3:
+  ret
+     e1b:	c3                   	ret
+
+00000e1c <fork>:
+
+SYSCALL(fork)
+     e1c:	b8 01 00 00 00       	mov    $0x1,%eax
+     e21:	eb b8                	jmp    ddb <dosyscall>
+
+00000e23 <exit>:
+SYSCALL(exit)
+     e23:	b8 02 00 00 00       	mov    $0x2,%eax
+     e28:	eb b1                	jmp    ddb <dosyscall>
+
+00000e2a <wait>:
+SYSCALL(wait)
+     e2a:	b8 03 00 00 00       	mov    $0x3,%eax
+     e2f:	eb aa                	jmp    ddb <dosyscall>
+
+00000e31 <pipe>:
+SYSCALL(pipe)
+     e31:	b8 04 00 00 00       	mov    $0x4,%eax
+     e36:	eb a3                	jmp    ddb <dosyscall>
+
+00000e38 <read>:
+SYSCALL(read)
+     e38:	b8 05 00 00 00       	mov    $0x5,%eax
+     e3d:	eb 9c                	jmp    ddb <dosyscall>
+
+00000e3f <write>:
+SYSCALL(write)
+     e3f:	b8 10 00 00 00       	mov    $0x10,%eax
+     e44:	eb 95                	jmp    ddb <dosyscall>
+
+00000e46 <close>:
+SYSCALL(close)
+     e46:	b8 15 00 00 00       	mov    $0x15,%eax
+     e4b:	eb 8e                	jmp    ddb <dosyscall>
+
+00000e4d <kill>:
+SYSCALL(kill)
+     e4d:	b8 06 00 00 00       	mov    $0x6,%eax
+     e52:	eb 87                	jmp    ddb <dosyscall>
+
+00000e54 <exec>:
+SYSCALL(exec)
+     e54:	b8 07 00 00 00       	mov    $0x7,%eax
+     e59:	eb 80                	jmp    ddb <dosyscall>
+
+00000e5b <open>:
+SYSCALL(open)
+     e5b:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e60:	e9 76 ff ff ff       	jmp    ddb <dosyscall>
+
+00000e65 <mknod>:
+SYSCALL(mknod)
+     e65:	b8 11 00 00 00       	mov    $0x11,%eax
+     e6a:	e9 6c ff ff ff       	jmp    ddb <dosyscall>
+
+00000e6f <unlink>:
+SYSCALL(unlink)
+     e6f:	b8 12 00 00 00       	mov    $0x12,%eax
+     e74:	e9 62 ff ff ff       	jmp    ddb <dosyscall>
+
+00000e79 <fstat>:
+SYSCALL(fstat)
+     e79:	b8 08 00 00 00       	mov    $0x8,%eax
+     e7e:	e9 58 ff ff ff       	jmp    ddb <dosyscall>
+
+00000e83 <link>:
+SYSCALL(link)
+     e83:	b8 13 00 00 00       	mov    $0x13,%eax
+     e88:	e9 4e ff ff ff       	jmp    ddb <dosyscall>
+
+00000e8d <mkdir>:
+SYSCALL(mkdir)
+     e8d:	b8 14 00 00 00       	mov    $0x14,%eax
+     e92:	e9 44 ff ff ff       	jmp    ddb <dosyscall>
+
+00000e97 <chdir>:
+SYSCALL(chdir)
+     e97:	b8 09 00 00 00       	mov    $0x9,%eax
+     e9c:	e9 3a ff ff ff       	jmp    ddb <dosyscall>
+
+00000ea1 <dup>:
+SYSCALL(dup)
+     ea1:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ea6:	e9 30 ff ff ff       	jmp    ddb <dosyscall>
+
+00000eab <getpid>:
+SYSCALL(getpid)
+     eab:	b8 0b 00 00 00       	mov    $0xb,%eax
+     eb0:	e9 26 ff ff ff       	jmp    ddb <dosyscall>
+
+00000eb5 <sbrk>:
+SYSCALL(sbrk)
+     eb5:	b8 0c 00 00 00       	mov    $0xc,%eax
+     eba:	e9 1c ff ff ff       	jmp    ddb <dosyscall>
+
+00000ebf <sleep>:
+SYSCALL(sleep)
+     ebf:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ec4:	e9 12 ff ff ff       	jmp    ddb <dosyscall>
+
+00000ec9 <uptime>:
+SYSCALL(uptime)
+     ec9:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ece:	e9 08 ff ff ff       	jmp    ddb <dosyscall>
+
+00000ed3 <symlink>:
+SYSCALL(symlink)
+     ed3:	b8 16 00 00 00       	mov    $0x16,%eax
+     ed8:	e9 fe fe ff ff       	jmp    ddb <dosyscall>
+
+00000edd <readlink>:
+SYSCALL(readlink)
+     edd:	b8 17 00 00 00       	mov    $0x17,%eax
+     ee2:	e9 f4 fe ff ff       	jmp    ddb <dosyscall>
+
+00000ee7 <fprot>:
+SYSCALL(fprot)
+     ee7:	b8 18 00 00 00       	mov    $0x18,%eax
+     eec:	e9 ea fe ff ff       	jmp    ddb <dosyscall>
+
+00000ef1 <funprot>:
+SYSCALL(funprot)
+     ef1:	b8 19 00 00 00       	mov    $0x19,%eax
+     ef6:	e9 e0 fe ff ff       	jmp    ddb <dosyscall>
+
+00000efb <funlock>:
+SYSCALL(funlock)
+     efb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     f00:	e9 d6 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f05 <mmap>:
+SYSCALL(mmap)
+     f05:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     f0a:	e9 cc fe ff ff       	jmp    ddb <dosyscall>
+
+00000f0f <munmap>:
+SYSCALL(munmap)
+     f0f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f14:	e9 c2 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f19 <sendfile>:
+SYSCALL(sendfile)
+     f19:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f1e:	e9 b8 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f23 <readv>:
+SYSCALL(readv)
+     f23:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f28:	e9 ae fe ff ff       	jmp    ddb <dosyscall>
+
+00000f2d <writev>:
+SYSCALL(writev)
+     f2d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f32:	e9 a4 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f37 <pread>:
+SYSCALL(pread)
+     f37:	b8 20 00 00 00       	mov    $0x20,%eax
+     f3c:	e9 9a fe ff ff       	jmp    ddb <dosyscall>
+
+00000f41 <pwrite>:
+SYSCALL(pwrite)
+     f41:	b8 21 00 00 00       	mov    $0x21,%eax
+     f46:	e9 90 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f4b <lseek>:
+SYSCALL(lseek)
+     f4b:	b8 22 00 00 00       	mov    $0x22,%eax
+     f50:	e9 86 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f55 <spawn>:
+SYSCALL(spawn)
+     f55:	b8 23 00 00 00       	mov    $0x23,%eax
+     f5a:	e9 7c fe ff ff       	jmp    ddb <dosyscall>
+
+00000f5f <setpriority>:
+SYSCALL(setpriority)
+     f5f:	b8 24 00 00 00       	mov    $0x24,%eax
+     f64:	e9 72 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f69 <kthread_create>:
+SYSCALL(kthread_create)
+     f69:	b8 25 00 00 00       	mov    $0x25,%eax
+     f6e:	e9 68 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f73 <kthread_id>:
+SYSCALL(kthread_id)
+     f73:	b8 26 00 00 00       	mov    $0x26,%eax
+     f78:	e9 5e fe ff ff       	jmp    ddb <dosyscall>
+
+00000f7d <kthread_exit>:
+SYSCALL(kthread_exit)
+     f7d:	b8 27 00 00 00       	mov    $0x27,%eax
+     f82:	e9 54 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f87 <kthread_join>:
+SYSCALL(kthread_join)
+     f87:	b8 28 00 00 00       	mov    $0x28,%eax
+     f8c:	e9 4a fe ff ff       	jmp    ddb <dosyscall>
+
+00000f91 <futex>:
+SYSCALL(futex)
+     f91:	b8 29 00 00 00       	mov    $0x29,%eax
+     f96:	e9 40 fe ff ff       	jmp    ddb <dosyscall>
+
+00000f9b <signal>:
+SYSCALL(signal)
+     f9b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     fa0:	e9 36 fe ff ff       	jmp    ddb <dosyscall>
+
+00000fa5 <alarm>:
+SYSCALL(alarm)
+     fa5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     faa:	e9 2c fe ff ff       	jmp    ddb <dosyscall>
+
+00000faf <usleep>:
+SYSCALL(usleep)
+     faf:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     fb4:	e9 22 fe ff ff       	jmp    ddb <dosyscall>
+
+00000fb9 <ioring_setup>:
+SYSCALL(ioring_setup)
+     fb9:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     fbe:	e9 18 fe ff ff       	jmp    ddb <dosyscall>
+
+00000fc3 <ioring_enter>:
+SYSCALL(ioring_enter)
+     fc3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     fc8:	e9 0e fe ff ff       	jmp    ddb <dosyscall>
+
+00000fcd <getrusage>:
+SYSCALL(getrusage)
+     fcd:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     fd2:	e9 04 fe ff ff       	jmp    ddb <dosyscall>
+
+00000fd7 <mount>:
+SYSCALL(mount)
+     fd7:	b8 30 00 00 00       	mov    $0x30,%eax
+     fdc:	e9 fa fd ff ff       	jmp    ddb <dosyscall>
+
+00000fe1 <getdents>:
+SYSCALL(getdents)
+     fe1:	b8 31 00 00 00       	mov    $0x31,%eax
+     fe6:	e9 f0 fd ff ff       	jmp    ddb <dosyscall>
+
+00000feb <yield>:
+SYSCALL(yield)
+     feb:	b8 32 00 00 00       	mov    $0x32,%eax
+     ff0:	e9 e6 fd ff ff       	jmp    ddb <dosyscall>
+
+00000ff5 <ncpu>:
+SYSCALL(ncpu)
+     ff5:	b8 33 00 00 00       	mov    $0x33,%eax
+     ffa:	e9 dc fd ff ff       	jmp    ddb <dosyscall>
+
+00000fff <fallocate>:
+SYSCALL(fallocate)
+     fff:	b8 34 00 00 00       	mov    $0x34,%eax
+    1004:	e9 d2 fd ff ff       	jmp    ddb <dosyscall>
+
+00001009 <ftruncate>:
+SYSCALL(ftruncate)
+    1009:	b8 35 00 00 00       	mov    $0x35,%eax
+    100e:	e9 c8 fd ff ff       	jmp    ddb <dosyscall>
+
+00001013 <fsync>:
+SYSCALL(fsync)
+    1013:	b8 36 00 00 00       	mov    $0x36,%eax
+    1018:	e9 be fd ff ff       	jmp    ddb <dosyscall>
+
+0000101d <fdatasync>:
+SYSCALL(fdatasync)
+    101d:	b8 37 00 00 00       	mov    $0x37,%eax
+    1022:	e9 b4 fd ff ff       	jmp    ddb <dosyscall>
+
+00001027 <poll>:
+SYSCALL(poll)
+    1027:	b8 38 00 00 00       	mov    $0x38,%eax
+    102c:	e9 aa fd ff ff       	jmp    ddb <dosyscall>
+
+00001031 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+    1031:	55                   	push   %ebp
+    1032:	89 e5                	mov    %esp,%ebp
+    1034:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+    1037:	8b 45 08             	mov    0x8(%ebp),%eax
+    103a:	8b 40 04             	mov    0x4(%eax),%eax
+    103d:	85 c0                	test   %eax,%eax
+    103f:	7e 1f                	jle    1060 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+    1041:	8b 45 08             	mov    0x8(%ebp),%eax
+    1044:	8b 50 04             	mov    0x4(%eax),%edx
+    1047:	8b 45 08             	mov    0x8(%ebp),%eax
+    104a:	8d 48 08             	lea    0x8(%eax),%ecx
+    104d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1050:	8b 00                	mov    (%eax),%eax
+    1052:	83 ec 04             	sub    $0x4,%esp
+    1055:	52                   	push   %edx
+    1056:	51                   	push   %ecx
+    1057:	50                   	push   %eax
+    1058:	e8 d0 fe ff ff       	call   f2d <writev>
+    105d:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1060:	8b 45 08             	mov    0x8(%ebp),%eax
+    1063:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+    106a:	8b 45 08             	mov    0x8(%ebp),%eax
+    106d:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+    1074:	00 00 00 
+}
+    1077:	90                   	nop
+    1078:	c9                   	leave
+    1079:	c3                   	ret
+
+0000107a <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+    107a:	55                   	push   %ebp
+    107b:	89 e5                	mov    %esp,%ebp
+    107d:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+    1080:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    1084:	0f 84 94 00 00 00    	je     111e <put+0xa4>
+    return;
+  if(o->n > 0){
+    108a:	8b 45 08             	mov    0x8(%ebp),%eax
+    108d:	8b 40 04             	mov    0x4(%eax),%eax
+    1090:	85 c0                	test   %eax,%eax
+    1092:	7e 40                	jle    10d4 <put+0x5a>
+    v = &o->iov[o->n-1];
+    1094:	8b 45 08             	mov    0x8(%ebp),%eax
+    1097:	8b 40 04             	mov    0x4(%eax),%eax
+    109a:	83 e8 01             	sub    $0x1,%eax
+    109d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    10a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a7:	01 d0                	add    %edx,%eax
+    10a9:	83 c0 08             	add    $0x8,%eax
+    10ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+    10af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b2:	8b 10                	mov    (%eax),%edx
+    10b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b7:	8b 40 04             	mov    0x4(%eax),%eax
+    10ba:	01 d0                	add    %edx,%eax
+    10bc:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    10bf:	75 13                	jne    10d4 <put+0x5a>
+      v->iov_len += n;
+    10c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c4:	8b 50 04             	mov    0x4(%eax),%edx
+    10c7:	8b 45 10             	mov    0x10(%ebp),%eax
+    10ca:	01 c2                	add    %eax,%edx
+    10cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10cf:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+    10d2:	eb 4b                	jmp    111f <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+    10d4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d7:	8b 40 04             	mov    0x4(%eax),%eax
+    10da:	83 f8 10             	cmp    $0x10,%eax
+    10dd:	75 0e                	jne    10ed <put+0x73>
+    flush(o);
+    10df:	83 ec 0c             	sub    $0xc,%esp
+    10e2:	ff 75 08             	push   0x8(%ebp)
+    10e5:	e8 47 ff ff ff       	call   1031 <flush>
+    10ea:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+    10ed:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f0:	8b 50 04             	mov    0x4(%eax),%edx
+    10f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    10f9:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+    10fd:	8b 45 08             	mov    0x8(%ebp),%eax
+    1100:	8b 50 04             	mov    0x4(%eax),%edx
+    1103:	8b 45 08             	mov    0x8(%ebp),%eax
+    1106:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1109:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+    110d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1110:	8b 40 04             	mov    0x4(%eax),%eax
+    1113:	8d 50 01             	lea    0x1(%eax),%edx
+    1116:	8b 45 08             	mov    0x8(%ebp),%eax
+    1119:	89 50 04             	mov    %edx,0x4(%eax)
+    111c:	eb 01                	jmp    111f <put+0xa5>
+    return;
+    111e:	90                   	nop
+}
+    111f:	c9                   	leave
+    1120:	c3                   	ret
+
+00001121 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+    1121:	55                   	push   %ebp
+    1122:	89 e5                	mov    %esp,%ebp
+    1124:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+    1127:	8b 45 08             	mov    0x8(%ebp),%eax
+    112a:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    1130:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1133:	01 d0                	add    %edx,%eax
+    1135:	3d 80 00 00 00       	cmp    $0x80,%eax
+    113a:	77 0b                	ja     1147 <room+0x26>
+    113c:	8b 45 08             	mov    0x8(%ebp),%eax
+    113f:	8b 40 04             	mov    0x4(%eax),%eax
+    1142:	83 f8 10             	cmp    $0x10,%eax
+    1145:	75 0e                	jne    1155 <room+0x34>
+    flush(o);
+    1147:	83 ec 0c             	sub    $0xc,%esp
+    114a:	ff 75 08             	push   0x8(%ebp)
+    114d:	e8 df fe ff ff       	call   1031 <flush>
+    1152:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+    1155:	8b 45 08             	mov    0x8(%ebp),%eax
+    1158:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+    115e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1161:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    1167:	01 d0                	add    %edx,%eax
+}
+    1169:	c9                   	leave
+    116a:	c3                   	ret
+
+0000116b <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+    116b:	55                   	push   %ebp
+    116c:	89 e5                	mov    %esp,%ebp
+    116e:	83 ec 28             	sub    $0x28,%esp
+    1171:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1174:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+    1177:	83 ec 08             	sub    $0x8,%esp
+    117a:	6a 01                	push   $0x1
+    117c:	ff 75 08             	push   0x8(%ebp)
+    117f:	e8 9d ff ff ff       	call   1121 <room>
+    1184:	83 c4 10             	add    $0x10,%esp
+    1187:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+    118a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    118d:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+    1191:	88 10                	mov    %dl,(%eax)
+  o->used++;
+    1193:	8b 45 08             	mov    0x8(%ebp),%eax
+    1196:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+    119c:	8d 50 01             	lea    0x1(%eax),%edx
+    119f:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a2:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+    11a8:	83 ec 04             	sub    $0x4,%esp
+    11ab:	6a 01                	push   $0x1
+    11ad:	ff 75 f4             	push   -0xc(%ebp)
+    11b0:	ff 75 08             	push   0x8(%ebp)
+    11b3:	e8 c2 fe ff ff       	call   107a <put>
+    11b8:	83 c4 10             	add    $0x10,%esp
+}
+    11bb:	90                   	nop
+    11bc:	c9                   	leave
+    11bd:	c3                   	ret
+
+000011be <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    11be:	55                   	push   %ebp
+    11bf:	89 e5                	mov    %esp,%ebp
+    11c1:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+    11c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    11cb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    11cf:	74 17                	je     11e8 <printint+0x2a>
+    11d1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    11d5:	79 11                	jns    11e8 <printint+0x2a>
+    neg = 1;
+    11d7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    11de:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11e1:	f7 d8                	neg    %eax
+    11e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11e6:	eb 06                	jmp    11ee <printint+0x30>
+  } else {
+    x = xx;
+    11e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    11ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    11f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11fb:	ba 00 00 00 00       	mov    $0x0,%edx
+    1200:	f7 f1                	div    %ecx
+    1202:	89 d1                	mov    %edx,%ecx
+    1204:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1207:	8d 50 01             	lea    0x1(%eax),%edx
+    120a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    120d:	0f b6 91 20 1f 00 00 	movzbl 0x1f20(%ecx),%edx
+    1214:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1218:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    121b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    121e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1223:	f7 f1                	div    %ecx
+    1225:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1228:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    122c:	75 c7                	jne    11f5 <printint+0x37>
+  if(neg)
+    122e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1232:	74 0e                	je     1242 <printint+0x84>
+    buf[i++] = '-';
+    1234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1237:	8d 50 01             	lea    0x1(%eax),%edx
+    123a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    123d:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+    1242:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1245:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+    1248:	83 ec 08             	sub    $0x8,%esp
+    124b:	ff 75 e8             	push   -0x18(%ebp)
+    124e:	ff 75 08             	push   0x8(%ebp)
+    1251:	e8 cb fe ff ff       	call   1121 <room>
+    1256:	83 c4 10             	add    $0x10,%esp
+    1259:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+    125c:	eb 1d                	jmp    127b <printint+0xbd>
+    p[n-1-i] = buf[i];
+    125e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1261:	83 e8 01             	sub    $0x1,%eax
+    1264:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1267:	89 c2                	mov    %eax,%edx
+    1269:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    126c:	01 c2                	add    %eax,%edx
+    126e:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+    1271:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1274:	01 c8                	add    %ecx,%eax
+    1276:	0f b6 00             	movzbl (%eax),%eax
+    1279:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+    127b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    127f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1283:	79 d9                	jns    125e <printint+0xa0>
+  o->used += n;
+    1285:	8b 45 08             	mov    0x8(%ebp),%eax
+    1288:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+    128e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1291:	01 c2                	add    %eax,%edx
+    1293:	8b 45 08             	mov    0x8(%ebp),%eax
+    1296:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+    129c:	83 ec 04             	sub    $0x4,%esp
+    129f:	ff 75 e8             	push   -0x18(%ebp)
+    12a2:	ff 75 e4             	push   -0x1c(%ebp)
+    12a5:	ff 75 08             	push   0x8(%ebp)
+    12a8:	e8 cd fd ff ff       	call   107a <put>
+    12ad:	83 c4 10             	add    $0x10,%esp
+}
+    12b0:	90                   	nop
+    12b1:	c9                   	leave
+    12b2:	c3                   	ret
+
+000012b3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    12b3:	55                   	push   %ebp
+    12b4:	89 e5                	mov    %esp,%ebp
+    12b6:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+    12bc:	8b 45 08             	mov    0x8(%ebp),%eax
+    12bf:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+    12c5:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+    12cc:	00 00 00 
+  o.used = 0;
+    12cf:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+    12d6:	00 00 00 
+  state = 0;
+    12d9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    12e0:	8d 45 0c             	lea    0xc(%ebp),%eax
+    12e3:	83 c0 04             	add    $0x4,%eax
+    12e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+    12e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    12f0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    12f7:	e9 82 01 00 00       	jmp    147e <printf+0x1cb>
+    c = fmt[i] & 0xff;
+    12fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1302:	01 d0                	add    %edx,%eax
+    1304:	0f b6 00             	movzbl (%eax),%eax
+    1307:	0f be c0             	movsbl %al,%eax
+    130a:	25 ff 00 00 00       	and    $0xff,%eax
+    130f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+    1312:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1316:	75 38                	jne    1350 <printf+0x9d>
+      if(c == '%'){
+    1318:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    131c:	0f 85 58 01 00 00    	jne    147a <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+    1322:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1325:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    132b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    132e:	01 ca                	add    %ecx,%edx
+    1330:	83 ec 04             	sub    $0x4,%esp
+    1333:	50                   	push   %eax
+    1334:	52                   	push   %edx
+    1335:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    133b:	50                   	push   %eax
+    133c:	e8 39 fd ff ff       	call   107a <put>
+    1341:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+    1344:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+    134b:	e9 2a 01 00 00       	jmp    147a <printf+0x1c7>
+      }
+    } else if(state == '%'){
+    1350:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+    1354:	0f 85 20 01 00 00    	jne    147a <printf+0x1c7>
+      if(c == 'd'){
+    135a:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+    135e:	75 22                	jne    1382 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+    1360:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1363:	8b 00                	mov    (%eax),%eax
+    1365:	6a 01                	push   $0x1
+    1367:	6a 0a                	push   $0xa
+    1369:	50                   	push   %eax
+    136a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1370:	50                   	push   %eax
+    1371:	e8 48 fe ff ff       	call   11be <printint>
+    1376:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1379:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    137d:	e9 e8 00 00 00       	jmp    146a <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+    1382:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+    1386:	74 06                	je     138e <printf+0xdb>
+    1388:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+    138c:	75 22                	jne    13b0 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+    138e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1391:	8b 00                	mov    (%eax),%eax
+    1393:	6a 00                	push   $0x0
+    1395:	6a 10                	push   $0x10
+    1397:	50                   	push   %eax
+    1398:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    139e:	50                   	push   %eax
+    139f:	e8 1a fe ff ff       	call   11be <printint>
+    13a4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    13a7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    13ab:	e9 ba 00 00 00       	jmp    146a <printf+0x1b7>
+      } else if(c == 's'){
+    13b0:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+    13b4:	75 3f                	jne    13f5 <printf+0x142>
+        s = (char*)*ap;
+    13b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13b9:	8b 00                	mov    (%eax),%eax
+    13bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    13be:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+    13c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    13c6:	75 07                	jne    13cf <printf+0x11c>
+          s = "(null)";
+    13c8:	c7 45 f4 8a 19 00 00 	movl   $0x198a,-0xc(%ebp)
+        put(&o, s, strlen(s));
+    13cf:	83 ec 0c             	sub    $0xc,%esp
+    13d2:	ff 75 f4             	push   -0xc(%ebp)
+    13d5:	e8 47 f8 ff ff       	call   c21 <strlen>
+    13da:	83 c4 10             	add    $0x10,%esp
+    13dd:	83 ec 04             	sub    $0x4,%esp
+    13e0:	50                   	push   %eax
+    13e1:	ff 75 f4             	push   -0xc(%ebp)
+    13e4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    13ea:	50                   	push   %eax
+    13eb:	e8 8a fc ff ff       	call   107a <put>
+    13f0:	83 c4 10             	add    $0x10,%esp
+    13f3:	eb 75                	jmp    146a <printf+0x1b7>
+      } else if(c == 'c'){
+    13f5:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+    13f9:	75 21                	jne    141c <printf+0x169>
+        putc(&o, *ap);
+    13fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13fe:	8b 00                	mov    (%eax),%eax
+    1400:	0f be c0             	movsbl %al,%eax
+    1403:	83 ec 08             	sub    $0x8,%esp
+    1406:	50                   	push   %eax
+    1407:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    140d:	50                   	push   %eax
+    140e:	e8 58 fd ff ff       	call   116b <putc>
+    1413:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1416:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+    141a:	eb 4e                	jmp    146a <printf+0x1b7>
+      } else if(c == '%'){
+    141c:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+    1420:	75 1b                	jne    143d <printf+0x18a>
+        putc(&o, c);
+    1422:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1425:	0f be c0             	movsbl %al,%eax
+    1428:	83 ec 08             	sub    $0x8,%esp
+    142b:	50                   	push   %eax
+    142c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1432:	50                   	push   %eax
+    1433:	e8 33 fd ff ff       	call   116b <putc>
+    1438:	83 c4 10             	add    $0x10,%esp
+    143b:	eb 2d                	jmp    146a <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+    143d:	83 ec 08             	sub    $0x8,%esp
+    1440:	6a 25                	push   $0x25
+    1442:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1448:	50                   	push   %eax
+    1449:	e8 1d fd ff ff       	call   116b <putc>
+    144e:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+    1451:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1454:	0f be c0             	movsbl %al,%eax
+    1457:	83 ec 08             	sub    $0x8,%esp
+    145a:	50                   	push   %eax
+    145b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    1461:	50                   	push   %eax
+    1462:	e8 04 fd ff ff       	call   116b <putc>
+    1467:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    146a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+    1471:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1474:	83 c0 01             	add    $0x1,%eax
+    1477:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    147a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    147e:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1481:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1484:	01 d0                	add    %edx,%eax
+    1486:	0f b6 00             	movzbl (%eax),%eax
+    1489:	84 c0                	test   %al,%al
+    148b:	0f 85 6b fe ff ff    	jne    12fc <printf+0x49>
+    }
+  }
+  if(state == 0)
+    1491:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1495:	75 22                	jne    14b9 <printf+0x206>
+    put(&o, fmt + start, i - start);
+    1497:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    149a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    149d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    14a0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    14a3:	01 ca                	add    %ecx,%edx
+    14a5:	83 ec 04             	sub    $0x4,%esp
+    14a8:	50                   	push   %eax
+    14a9:	52                   	push   %edx
+    14aa:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    14b0:	50                   	push   %eax
+    14b1:	e8 c4 fb ff ff       	call   107a <put>
+    14b6:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+    14b9:	83 ec 0c             	sub    $0xc,%esp
+    14bc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+    14c2:	50                   	push   %eax
+    14c3:	e8 69 fb ff ff       	call   1031 <flush>
+    14c8:	83 c4 10             	add    $0x10,%esp
+}
+    14cb:	90                   	nop
+    14cc:	c9                   	leave
+    14cd:	c3                   	ret
+
+000014ce <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+    14ce:	55                   	push   %ebp
+    14cf:	89 e5                	mov    %esp,%ebp
+    14d1:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+    14d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    14d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    14dd:	f0 87 02             	lock xchg %eax,(%edx)
+    14e0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+    14e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+    14e6:	c9                   	leave
+    14e7:	c3                   	ret
+
+000014e8 <lock>:
+{
+    14e8:	55                   	push   %ebp
+    14e9:	89 e5                	mov    %esp,%ebp
+    14eb:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+    14ee:	a1 a4 35 01 00       	mov    0x135a4,%eax
+    14f3:	85 c0                	test   %eax,%eax
+    14f5:	74 09                	je     1500 <lock+0x18>
+    14f7:	a1 a4 35 01 00       	mov    0x135a4,%eax
+    14fc:	ff d0                	call   *%eax
+    14fe:	eb 05                	jmp    1505 <lock+0x1d>
+    1500:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1505:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+    1508:	90                   	nop
+    1509:	83 ec 08             	sub    $0x8,%esp
+    150c:	6a 01                	push   $0x1
+    150e:	68 dc 35 01 00       	push   $0x135dc
+    1513:	e8 b6 ff ff ff       	call   14ce <xchg>
+    1518:	83 c4 10             	add    $0x10,%esp
+    151b:	85 c0                	test   %eax,%eax
+    151d:	75 ea                	jne    1509 <lock+0x21>
+  return pin;
+    151f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1522:	c9                   	leave
+    1523:	c3                   	ret
+
+00001524 <unlock>:
+{
+    1524:	55                   	push   %ebp
+    1525:	89 e5                	mov    %esp,%ebp
+    1527:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+    152a:	6a 00                	push   $0x0
+    152c:	68 dc 35 01 00       	push   $0x135dc
+    1531:	e8 98 ff ff ff       	call   14ce <xchg>
+    1536:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+    1539:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    153d:	78 10                	js     154f <unlock+0x2b>
+    mallocunpin(pin);
+    153f:	a1 a8 35 01 00       	mov    0x135a8,%eax
+    1544:	83 ec 0c             	sub    $0xc,%esp
+    1547:	ff 75 08             	push   0x8(%ebp)
+    154a:	ff d0                	call   *%eax
+    154c:	83 c4 10             	add    $0x10,%esp
+}
+    154f:	90                   	nop
+    1550:	c9                   	leave
+    1551:	c3                   	ret
+
+00001552 <sizeclass>:
+{
+    1552:	55                   	push   %ebp
+    1553:	89 e5                	mov    %esp,%ebp
+    1555:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+    1558:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    155f:	eb 1c                	jmp    157d <sizeclass+0x2b>
+    if(nu <= (2 << c))
+    1561:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1564:	ba 02 00 00 00       	mov    $0x2,%edx
+    1569:	89 c1                	mov    %eax,%ecx
+    156b:	d3 e2                	shl    %cl,%edx
+    156d:	89 d0                	mov    %edx,%eax
+    156f:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1572:	72 05                	jb     1579 <sizeclass+0x27>
+      return c;
+    1574:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1577:	eb 0f                	jmp    1588 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+    1579:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    157d:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+    1581:	7e de                	jle    1561 <sizeclass+0xf>
+  return -1;
+    1583:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1588:	c9                   	leave
+    1589:	c3                   	ret
+
+0000158a <bigfree>:
+{
+    158a:	55                   	push   %ebp
+    158b:	89 e5                	mov    %esp,%ebp
+    158d:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1590:	a1 b4 35 01 00       	mov    0x135b4,%eax
+    1595:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1598:	eb 24                	jmp    15be <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    159a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    159d:	8b 00                	mov    (%eax),%eax
+    159f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    15a2:	72 12                	jb     15b6 <bigfree+0x2c>
+    15a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    15a7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    15aa:	72 24                	jb     15d0 <bigfree+0x46>
+    15ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15af:	8b 00                	mov    (%eax),%eax
+    15b1:	39 45 08             	cmp    %eax,0x8(%ebp)
+    15b4:	72 1a                	jb     15d0 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15b9:	8b 00                	mov    (%eax),%eax
+    15bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    15be:	8b 45 08             	mov    0x8(%ebp),%eax
+    15c1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    15c4:	73 d4                	jae    159a <bigfree+0x10>
+    15c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15c9:	8b 00                	mov    (%eax),%eax
+    15cb:	39 45 08             	cmp    %eax,0x8(%ebp)
+    15ce:	73 ca                	jae    159a <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+    15d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    15d3:	8b 40 04             	mov    0x4(%eax),%eax
+    15d6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    15dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    15e0:	01 c2                	add    %eax,%edx
+    15e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15e5:	8b 00                	mov    (%eax),%eax
+    15e7:	39 c2                	cmp    %eax,%edx
+    15e9:	75 24                	jne    160f <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+    15eb:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ee:	8b 50 04             	mov    0x4(%eax),%edx
+    15f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15f4:	8b 00                	mov    (%eax),%eax
+    15f6:	8b 40 04             	mov    0x4(%eax),%eax
+    15f9:	01 c2                	add    %eax,%edx
+    15fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    15fe:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1601:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1604:	8b 00                	mov    (%eax),%eax
+    1606:	8b 10                	mov    (%eax),%edx
+    1608:	8b 45 08             	mov    0x8(%ebp),%eax
+    160b:	89 10                	mov    %edx,(%eax)
+    160d:	eb 0a                	jmp    1619 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+    160f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1612:	8b 10                	mov    (%eax),%edx
+    1614:	8b 45 08             	mov    0x8(%ebp),%eax
+    1617:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    1619:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    161c:	8b 40 04             	mov    0x4(%eax),%eax
+    161f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1626:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1629:	01 d0                	add    %edx,%eax
+    162b:	39 45 08             	cmp    %eax,0x8(%ebp)
+    162e:	75 20                	jne    1650 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+    1630:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1633:	8b 50 04             	mov    0x4(%eax),%edx
+    1636:	8b 45 08             	mov    0x8(%ebp),%eax
+    1639:	8b 40 04             	mov    0x4(%eax),%eax
+    163c:	01 c2                	add    %eax,%edx
+    163e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1641:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1644:	8b 45 08             	mov    0x8(%ebp),%eax
+    1647:	8b 10                	mov    (%eax),%edx
+    1649:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    164c:	89 10                	mov    %edx,(%eax)
+    164e:	eb 08                	jmp    1658 <bigfree+0xce>
+    p->s.ptr = bp;
+    1650:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1653:	8b 55 08             	mov    0x8(%ebp),%edx
+    1656:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    1658:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    165b:	a3 b4 35 01 00       	mov    %eax,0x135b4
+}
+    1660:	90                   	nop
+    1661:	c9                   	leave
+    1662:	c3                   	ret
+
+00001663 <free>:
+{
+    1663:	55                   	push   %ebp
+    1664:	89 e5                	mov    %esp,%ebp
+    1666:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    1669:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    166d:	74 68                	je     16d7 <free+0x74>
+  bp = (Header*)ap - 1;
+    166f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1672:	83 e8 08             	sub    $0x8,%eax
+    1675:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    1678:	e8 6b fe ff ff       	call   14e8 <lock>
+    167d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    1680:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1683:	8b 40 04             	mov    0x4(%eax),%eax
+    1686:	83 ec 0c             	sub    $0xc,%esp
+    1689:	50                   	push   %eax
+    168a:	e8 c3 fe ff ff       	call   1552 <sizeclass>
+    168f:	83 c4 10             	add    $0x10,%esp
+    1692:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1695:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1699:	78 1e                	js     16b9 <free+0x56>
+    bp->s.ptr = classfree[c];
+    169b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    169e:	8b 14 85 b8 35 01 00 	mov    0x135b8(,%eax,4),%edx
+    16a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16a8:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    16aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    16ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    16b0:	89 14 85 b8 35 01 00 	mov    %edx,0x135b8(,%eax,4)
+    16b7:	eb 0e                	jmp    16c7 <free+0x64>
+    bigfree(bp);
+    16b9:	83 ec 0c             	sub    $0xc,%esp
+    16bc:	ff 75 f4             	push   -0xc(%ebp)
+    16bf:	e8 c6 fe ff ff       	call   158a <bigfree>
+    16c4:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    16c7:	83 ec 0c             	sub    $0xc,%esp
+    16ca:	ff 75 f0             	push   -0x10(%ebp)
+    16cd:	e8 52 fe ff ff       	call   1524 <unlock>
+    16d2:	83 c4 10             	add    $0x10,%esp
+    16d5:	eb 01                	jmp    16d8 <free+0x75>
+    return;
+    16d7:	90                   	nop
+}
+    16d8:	c9                   	leave
+    16d9:	c3                   	ret
+
+000016da <morecore>:
+{
+    16da:	55                   	push   %ebp
+    16db:	89 e5                	mov    %esp,%ebp
+    16dd:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    16e0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    16e7:	77 07                	ja     16f0 <morecore+0x16>
+    nu = 4096;
+    16e9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    16f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    16f3:	c1 e0 03             	shl    $0x3,%eax
+    16f6:	83 ec 0c             	sub    $0xc,%esp
+    16f9:	50                   	push   %eax
+    16fa:	e8 b6 f7 ff ff       	call   eb5 <sbrk>
+    16ff:	83 c4 10             	add    $0x10,%esp
+    1702:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    1705:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1709:	75 07                	jne    1712 <morecore+0x38>
+    return 0;
+    170b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1710:	eb 22                	jmp    1734 <morecore+0x5a>
+  hp = (Header*)p;
+    1712:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1715:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    1718:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    171b:	8b 55 08             	mov    0x8(%ebp),%edx
+    171e:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    1721:	83 ec 0c             	sub    $0xc,%esp
+    1724:	ff 75 f0             	push   -0x10(%ebp)
+    1727:	e8 5e fe ff ff       	call   158a <bigfree>
+    172c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    172f:	a1 b4 35 01 00       	mov    0x135b4,%eax
+}
+    1734:	c9                   	leave
+    1735:	c3                   	ret
+
+00001736 <bigalloc>:
+{
+    1736:	55                   	push   %ebp
+    1737:	89 e5                	mov    %esp,%ebp
+    1739:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    173c:	a1 b4 35 01 00       	mov    0x135b4,%eax
+    1741:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1744:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1748:	75 23                	jne    176d <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    174a:	c7 45 f0 ac 35 01 00 	movl   $0x135ac,-0x10(%ebp)
+    1751:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1754:	a3 b4 35 01 00       	mov    %eax,0x135b4
+    1759:	a1 b4 35 01 00       	mov    0x135b4,%eax
+    175e:	a3 ac 35 01 00       	mov    %eax,0x135ac
+    base.s.size = 0;
+    1763:	c7 05 b0 35 01 00 00 	movl   $0x0,0x135b0
+    176a:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    176d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1770:	8b 00                	mov    (%eax),%eax
+    1772:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1775:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1778:	8b 40 04             	mov    0x4(%eax),%eax
+    177b:	3b 45 08             	cmp    0x8(%ebp),%eax
+    177e:	72 4a                	jb     17ca <bigalloc+0x94>
+      if(p->s.size == nunits)
+    1780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1783:	8b 40 04             	mov    0x4(%eax),%eax
+    1786:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1789:	75 0c                	jne    1797 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    178b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    178e:	8b 10                	mov    (%eax),%edx
+    1790:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1793:	89 10                	mov    %edx,(%eax)
+    1795:	eb 26                	jmp    17bd <bigalloc+0x87>
+        p->s.size -= nunits;
+    1797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    179a:	8b 40 04             	mov    0x4(%eax),%eax
+    179d:	2b 45 08             	sub    0x8(%ebp),%eax
+    17a0:	89 c2                	mov    %eax,%edx
+    17a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17a5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    17a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17ab:	8b 40 04             	mov    0x4(%eax),%eax
+    17ae:	c1 e0 03             	shl    $0x3,%eax
+    17b1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    17b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17b7:	8b 55 08             	mov    0x8(%ebp),%edx
+    17ba:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    17bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17c0:	a3 b4 35 01 00       	mov    %eax,0x135b4
+      return p;
+    17c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17c8:	eb 3b                	jmp    1805 <bigalloc+0xcf>
+    if(p == freep)
+    17ca:	a1 b4 35 01 00       	mov    0x135b4,%eax
+    17cf:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    17d2:	75 1e                	jne    17f2 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    17d4:	83 ec 0c             	sub    $0xc,%esp
+    17d7:	ff 75 08             	push   0x8(%ebp)
+    17da:	e8 fb fe ff ff       	call   16da <morecore>
+    17df:	83 c4 10             	add    $0x10,%esp
+    17e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    17e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    17e9:	75 07                	jne    17f2 <bigalloc+0xbc>
+        return 0;
+    17eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    17f0:	eb 13                	jmp    1805 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17f5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    17f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17fb:	8b 00                	mov    (%eax),%eax
+    17fd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1800:	e9 70 ff ff ff       	jmp    1775 <bigalloc+0x3f>
+}
+    1805:	c9                   	leave
+    1806:	c3                   	ret
+
+00001807 <alloc>:
+alloc(uint nbytes)
+{
+    1807:	55                   	push   %ebp
+    1808:	89 e5                	mov    %esp,%ebp
+    180a:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    180d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1810:	83 c0 07             	add    $0x7,%eax
+    1813:	c1 e8 03             	shr    $0x3,%eax
+    1816:	83 c0 01             	add    $0x1,%eax
+    1819:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    181c:	ff 75 f4             	push   -0xc(%ebp)
+    181f:	e8 2e fd ff ff       	call   1552 <sizeclass>
+    1824:	83 c4 04             	add    $0x4,%esp
+    1827:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    182a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    182e:	79 2c                	jns    185c <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    1830:	83 ec 0c             	sub    $0xc,%esp
+    1833:	ff 75 f4             	push   -0xc(%ebp)
+    1836:	e8 fb fe ff ff       	call   1736 <bigalloc>
+    183b:	83 c4 10             	add    $0x10,%esp
+    183e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1841:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1845:	75 0a                	jne    1851 <alloc+0x4a>
+      return 0;
+    1847:	b8 00 00 00 00       	mov    $0x0,%eax
+    184c:	e9 c8 00 00 00       	jmp    1919 <alloc+0x112>
+    return (void*)(p + 1);
+    1851:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1854:	83 c0 08             	add    $0x8,%eax
+    1857:	e9 bd 00 00 00       	jmp    1919 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    185c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    185f:	8b 04 85 b8 35 01 00 	mov    0x135b8(,%eax,4),%eax
+    1866:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1869:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    186d:	74 1a                	je     1889 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    186f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1872:	8b 10                	mov    (%eax),%edx
+    1874:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1877:	89 14 85 b8 35 01 00 	mov    %edx,0x135b8(,%eax,4)
+    return (void*)(p + 1);
+    187e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1881:	83 c0 08             	add    $0x8,%eax
+    1884:	e9 90 00 00 00       	jmp    1919 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1889:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    188c:	ba 02 00 00 00       	mov    $0x2,%edx
+    1891:	89 c1                	mov    %eax,%ecx
+    1893:	d3 e2                	shl    %cl,%edx
+    1895:	89 d0                	mov    %edx,%eax
+    1897:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    189a:	a1 d4 35 01 00       	mov    0x135d4,%eax
+    189f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    18a2:	c1 e2 03             	shl    $0x3,%edx
+    18a5:	01 d0                	add    %edx,%eax
+    18a7:	8b 15 d8 35 01 00    	mov    0x135d8,%edx
+    18ad:	39 c2                	cmp    %eax,%edx
+    18af:	73 3f                	jae    18f0 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    18b1:	83 ec 0c             	sub    $0xc,%esp
+    18b4:	68 00 08 00 00       	push   $0x800
+    18b9:	e8 78 fe ff ff       	call   1736 <bigalloc>
+    18be:	83 c4 10             	add    $0x10,%esp
+    18c1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    18c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    18c8:	75 07                	jne    18d1 <alloc+0xca>
+      return 0;
+    18ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    18cf:	eb 48                	jmp    1919 <alloc+0x112>
+    bump = (char*)p;
+    18d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18d4:	a3 d4 35 01 00       	mov    %eax,0x135d4
+    bumpend = (char*)(p + p->s.size);
+    18d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18dc:	8b 40 04             	mov    0x4(%eax),%eax
+    18df:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    18e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18e9:	01 d0                	add    %edx,%eax
+    18eb:	a3 d8 35 01 00       	mov    %eax,0x135d8
+  }
+  p = (Header*)bump;
+    18f0:	a1 d4 35 01 00       	mov    0x135d4,%eax
+    18f5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    18f8:	a1 d4 35 01 00       	mov    0x135d4,%eax
+    18fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1900:	c1 e2 03             	shl    $0x3,%edx
+    1903:	01 d0                	add    %edx,%eax
+    1905:	a3 d4 35 01 00       	mov    %eax,0x135d4
+  p->s.size = nunits;
+    190a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    190d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1910:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1913:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1916:	83 c0 08             	add    $0x8,%eax
+}
+    1919:	c9                   	leave
+    191a:	c3                   	ret
+
+0000191b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    191b:	55                   	push   %ebp
+    191c:	89 e5                	mov    %esp,%ebp
+    191e:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1921:	e8 c2 fb ff ff       	call   14e8 <lock>
+    1926:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1929:	83 ec 0c             	sub    $0xc,%esp
+    192c:	ff 75 08             	push   0x8(%ebp)
+    192f:	e8 d3 fe ff ff       	call   1807 <alloc>
+    1934:	83 c4 10             	add    $0x10,%esp
+    1937:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    193a:	83 ec 0c             	sub    $0xc,%esp
+    193d:	ff 75 f4             	push   -0xc(%ebp)
+    1940:	e8 df fb ff ff       	call   1524 <unlock>
+    1945:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1948:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    194b:	c9                   	leave
+    194c:	c3                   	ret
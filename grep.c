@@ -1,64 +1,323 @@
 // Simple grep.  Only supports ^ . * $ operators.
+//
+// A pattern without operators is a literal, which Boyer-Moore-
+// Horspool search finds in a whole buffer of lines at once.  Other
+// patterns are compiled into a DFA, whose states are made as the
+// text needs them, so the text is looked at once, a byte at a
+// time, with no backtracking.  Regular files are mapped whole;
+// anything else is read in large chunks.
 
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "fcntl.h"
+
+#define BUFSIZE 32768
+#define NITEM   31       // most pattern items the DFA handles
+#define NSTATE  64       // DFA states kept at once
+
+char buf[BUFSIZE+1];
+char obuf[4096];
+int on;
+
+// The pattern, parsed.  An item is a character, or -1 for '.',
+// perhaps starred.
+struct item {
+  int c;
+  int star;
+} items[NITEM];
+int nitem;
+int bol, eol;            // anchored with ^ and $
+char *lit;               // the pattern, if it is a literal
+int litlen;
+int skip[256];           // Horspool shift for each last byte
+
+// DFA state i stands for the set states[i] of pattern positions
+// that the text so far can have reached; position nitem means the
+// whole pattern matched.  next[i][c] is the state after byte c,
+// or -1 if not made yet.  State 0 is the start.
+uint states[NSTATE];
+short next[NSTATE][256];
+int nstate;
 
-char buf[1024];
 int match(char*, char*);
 
+static void
+flush(void)
+{
+  if(on > 0)
+    write(1, obuf, on);
+  on = 0;
+}
+
+// Print the line from b up to e, its newline or the end of the
+// text, with a newline.
+static void
+putline(char *b, char *e)
+{
+  int n;
+
+  n = e - b;
+  if(on + n + 1 > sizeof(obuf)){
+    flush();
+    if(n + 1 > sizeof(obuf)){
+      write(1, b, n);
+      write(1, "\n", 1);
+      return;
+    }
+  }
+  memmove(obuf + on, b, n);
+  on += n;
+  obuf[on++] = '\n';
+}
+
+// Parse pattern re into items, the way matchhere reads it.
+// Return 0 if it has too many items for the DFA.
+static int
+compile(char *re)
+{
+  int i;
+
+  lit = re;
+  litlen = strlen(re);
+  if(re[0] == '^'){
+    bol = 1;
+    re++;
+  }
+  for(nitem = 0; *re; nitem++){
+    if(re[0] == '$' && re[1] == '\0'){
+      eol = 1;
+      break;
+    }
+    if(nitem == NITEM)
+      return 0;
+    items[nitem].c = re[0] == '.' ? -1 : (uchar)re[0];
+    items[nitem].star = re[1] == '*';
+    if(items[nitem].c < 0 || items[nitem].star)
+      lit = 0;
+    re += items[nitem].star ? 2 : 1;
+  }
+  if(bol || eol || litlen == 0)
+    lit = 0;
+  if(lit){
+    for(i = 0; i < 256; i++)
+      skip[i] = litlen;
+    for(i = 0; i < litlen - 1; i++)
+      skip[(uchar)lit[i]] = litlen - 1 - i;
+  }
+  return 1;
+}
+
+// Add the positions that starred items let m skip to.
+static uint
+closure(uint m)
+{
+  int i;
+
+  for(i = 0; i < nitem; i++)
+    if((m & (1U << i)) && items[i].star)
+      m |= 1U << (i+1);
+  return m;
+}
+
+static int
+addstate(uint m)
+{
+  int i;
+
+  for(i = 0; i < nstate; i++)
+    if(states[i] == m)
+      return i;
+  states[nstate] = m;
+  memset(next[nstate], 0xff, sizeof(next[nstate]));
+  return nstate++;
+}
+
+// Start over with just the start state.
+static void
+dfareset(void)
+{
+  nstate = 0;
+  addstate(closure(1));
+}
+
+// The state after byte c in state s.
+static int
+step(int s, int c)
+{
+  uint m, r;
+  int i, t;
+
+  if((t = next[s][c]) >= 0)
+    return t;
+  m = states[s];
+  r = bol ? 0 : 1;  // a match can start anywhere
+  for(i = 0; i < nitem; i++)
+    if((m & (1U << i)) && (items[i].c < 0 || items[i].c == c))
+      r |= items[i].star ? 1U << i : 1U << (i+1);
+  r = closure(r);
+  if(nstate == NSTATE){
+    dfareset();
+    return addstate(r);
+  }
+  t = addstate(r);
+  next[s][c] = t;
+  return t;
+}
+
+// Find the literal in the n bytes at s.
+static char*
+horspool(char *s, int n)
+{
+  char *p, *end;
+  int i;
+
+  end = s + n - litlen;
+  for(p = s; p <= end; p += skip[(uchar)p[litlen-1]]){
+    for(i = litlen - 1; i >= 0 && p[i] == lit[i]; i--)
+      ;
+    if(i < 0)
+      return p;
+  }
+  return 0;
+}
+
+static void
+scanlit(char *s, char *end)
+{
+  char *b, *e, *q;
+
+  while(s < end && (q = horspool(s, end - s)) != 0){
+    for(b = q; b > s && b[-1] != '\n'; b--)
+      ;
+    for(e = q + litlen; e < end && *e != '\n'; e++)
+      ;
+    putline(b, e);
+    s = e + 1;
+  }
+}
+
+static void
+scandfa(char *s, char *end)
+{
+  uint done, m;
+  char *b, *p;
+  int st;
+
+  done = 1U << nitem;
+  for(b = p = s; b < end; b = ++p){
+    st = 0;
+    for(; p < end && *p != '\n'; p++){
+      if((!eol && (states[st] & done)) || states[st] == 0)
+        break;  // matched, or cannot match
+      st = step(st, (uchar)*p);
+    }
+    m = states[st] & done;
+    while(p < end && *p != '\n')
+      p++;
+    if(m)
+      putline(b, p);
+  }
+}
+
+// The backtracking matcher, for patterns too long for the DFA.
+// Needs room for a 0 at end.
+static void
+scanslow(char *pattern, char *s, char *end)
+{
+  char *q, save;
+
+  save = *end;
+  *end = 0;
+  while(s < end){
+    if((q = strchr(s, '\n')) == 0)
+      q = end;
+    *q = 0;
+    if(match(pattern, s))
+      putline(s, q);
+    if(q < end)
+      *q = '\n';
+    s = q + 1;
+  }
+  *end = save;
+}
+
+// Print the lines that match among the n bytes at s, all of them
+// whole lines, the last perhaps without its newline.
+static void
+scan(char *pattern, char *s, int n, int slow)
+{
+  if(slow)
+    scanslow(pattern, s, s + n);
+  else if(lit)
+    scanlit(s, s + n);
+  else
+    scandfa(s, s + n);
+}
+
 void
-grep(char *pattern, int fd)
+grep(char *pattern, int fd, int slow)
 {
+  struct stat st;
   int n, m;
   char *p, *q;
-  
+
+  if(!slow && fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+     (p = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != (char*)-1){
+    scan(pattern, p, st.size, slow);
+    munmap(p, st.size);
+    return;
+  }
+
   m = 0;
-  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+  while((n = read(fd, buf+m, BUFSIZE-m)) > 0){
     m += n;
-    p = buf;
-    while((q = strchr(p, '\n')) != 0){
-      *q = 0;
-      if(match(pattern, p)){
-        *q = '\n';
-        write(1, p, q+1 - p);
-      }
-      p = q+1;
-    }
-    if(p == buf)
-      m = 0;
-    if(m > 0){
-      m -= p - buf;
-      memmove(buf, p, m);
+    for(q = buf+m; q > buf && q[-1] != '\n'; q--)
+      ;
+    if(q == buf){
+      if(m == BUFSIZE)
+        m = 0;  // line too long
+      continue;
     }
+    scan(pattern, buf, q - buf, slow);
+    m -= q - buf;
+    memmove(buf, q, m);
   }
+  if(m > 0)
+    scan(pattern, buf, m, slow);
 }
 
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int fd, i, slow;
   char *pattern;
-  
+
   if(argc <= 1){
     printf(2, "usage: grep pattern [file ...]\n");
     exit();
   }
   pattern = argv[1];
-  
+  slow = !compile(pattern);
+  if(!slow && !lit)
+    dfareset();
+
   if(argc <= 2){
-    grep(pattern, 0);
+    grep(pattern, 0, slow);
+    flush();
     exit();
   }
 
   for(i = 2; i < argc; i++){
     if((fd = open(argv[i], 0)) < 0){
+      flush();
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    grep(pattern, fd, slow);
     close(fd);
   }
+  flush();
   exit();
 }
 
@@ -103,4 +362,3 @@ int matchstar(int c, char *re, char *text)
   }while(*text!='\0' && (*text++==c || c=='.'));
   return 0;
 }
-
@@ -1,4 +1,17 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code: PCI bus-master DMA when the controller
+// and disk support it, programmed I/O otherwise.
+//
+// Disks 0 and 1 are the master and slave of the primary channel,
+// disks 2 and 3 those of the secondary channel.  A channel runs one
+// command at a time, so the two channels can work at once.
+//
+// Device numbers name disks, except that a file system that mkfs
+// built with -s is striped (RAID-0) over disks 1 and 2: its device
+// is ROOTDEV, and its blocks go to the two disks in turn, stripe
+// blocks at a time (see idestripe and idemap).
+//
+// A buf is a block of BSIZE bytes, SPB sectors of the disk; its
+// sector field numbers blocks, and lba the disk sector it starts at.
 
 #include "types.h"
 #include "defs.h"
@@ -9,6 +22,7 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "fs.h"
 #include "buf.h"
 
 #define IDE_BSY       0x80
@@ -18,138 +32,567 @@
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
+#define IDE_CMD_RDMUL 0xc4
+#define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_IDENT 0xec
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+#define IDE_MAXMULT   128  // most sectors we move per command
+#define SPB (BSIZE/512)    // sectors per block
+
+// Bus-master registers of a channel, from PCI BAR4 (the
+// secondary channel's are 8 bytes further on).
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+
+#define BM_START      0x01  // BM_CMD: start transfer
+#define BM_TOMEM      0x08  // BM_CMD: device to memory
+#define BM_ERR        0x02  // BM_STATUS: error, write 1 to clear
+#define BM_INTR       0x04  // BM_STATUS: interrupt, write 1 to clear
+
+// Physical region descriptor: one contiguous piece of a transfer.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor of the table
+
+// A channel's queue points to the buf now being read/written to
+// the disk.  queue->qnext points to the next buf to be processed.
+// The first nact bufs of the queue are in flight: idestart
+// merges requests for consecutive sectors on the same disk in
+// the same direction into one DMA or READ/WRITE MULTIPLE command.
 // You must hold idelock while manipulating queue.
+struct idechan {
+  ushort base;          // command block registers
+  ushort ctl;           // device control register
+  int irq;
+  uint bm;              // bus-master registers; 0 if no DMA
+  struct prd *prd;      // descriptor table, one page
+  struct buf *queue;
+  int nact;
+  int dmanow;           // active request uses DMA
+  uint pos;             // sector just past the last request started
+  int have[2];          // disk is present
+  int mult[2];          // sectors per MULTIPLE block; 0 if not supported
+  int dma[2];           // disk can do DMA
+};
 
 static struct spinlock idelock;
-static struct buf *idequeue;
+static struct idechan idechan[2] = {
+  { 0x1f0, 0x3f6, IRQ_IDE },
+  { 0x170, 0x376, IRQ_IDE+1 },
+};
+
+static int idesteer;    // interrupt the CPU that queued the request (boot idesteer=0: no)
+static uint stripe;     // blocks per stripe unit of ROOTDEV; 0: not striped
+static void idestart(struct idechan*, struct buf*);
 
-static int havedisk1;
-static void idestart(struct buf*);
+// Disk scheduling.  The bufs after the in-flight ones are
+// pending; a policy decides where iderw inserts a new one, and
+// may pick another one to go next.  Boot with idesched=N to
+// use policy N of idescheds.
+struct idesched {
+  char *name;
+  void (*insert)(struct buf**, struct buf*);
+  void (*pick)(struct buf**);
+};
+static struct idesched *idepolicy;
+static uint idepos;     // pos of the channel being scheduled
 
-// Wait for IDE disk to become ready.
+static struct {
+  uint nreq;
+  uint nseek;     // commands that did not start where the last ended
+  uint nlate;     // requests started ahead of order for their deadline
+  uint max;       // worst latency, in cycles
+  uint depth;     // requests queued or in flight
+  uint maxdepth;
+  uint hist[33];  // hist[i]: latency needs i bits, in cycles
+} idestat;
+
+// Wait for the selected disk of channel c to become ready.
 static int
-idewait(int checkerr)
+idewait(struct idechan *c, int checkerr)
 {
   int r;
 
-  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY) 
+  while(((r = inb(c->base+7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY) 
     ;
   if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
     return -1;
   return 0;
 }
 
+static void
+fifoinsert(struct buf **pp, struct buf *b)
+{
+  while(*pp)
+    pp = &(*pp)->qnext;
+  b->qnext = 0;
+  *pp = b;
+}
+
+// C-SCAN: keep pending bufs sorted by distance ahead of the
+// head, so the disk sweeps upward and then jumps back to the
+// lowest sector.  Unsigned subtraction wraps the distance.
+static void
+cscaninsert(struct buf **pp, struct buf *b)
+{
+  uint d;
+
+  d = b->lba - idepos;
+  while(*pp && (*pp)->lba - idepos <= d)
+    pp = &(*pp)->qnext;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Deadline: C-SCAN, except that the oldest request that has
+// waited more than IDEDEADLINE ticks goes next, and the sweep
+// restarts from there.
+static void
+deadlinepick(struct buf **pp)
+{
+  struct buf **qq, **old, *b, *rest;
+
+  old = 0;
+  for(qq = pp; *qq; qq = &(*qq)->qnext)
+    if(ticks - (*qq)->qtick > IDEDEADLINE &&
+       (old == 0 || (int)((*qq)->qtick - (*old)->qtick) < 0))
+      old = qq;
+  if(old == 0 || old == pp)
+    return;
+
+  b = *old;
+  *old = b->qnext;
+  rest = *pp;
+  b->qnext = 0;
+  *pp = b;
+  idepos = b->lba + SPB;
+  while(rest){
+    b = rest;
+    rest = rest->qnext;
+    cscaninsert(&(*pp)->qnext, b);
+  }
+  idestat.nlate++;
+}
+
+static struct idesched idescheds[] = {
+  { "fifo",     fifoinsert,  0 },
+  { "cscan",    cscaninsert, 0 },
+  { "deadline", cscaninsert, deadlinepick },
+};
+
+// Ask disk d of channel c what it can do.  Records whether it
+// does DMA, and enables READ/WRITE MULTIPLE with the largest
+// block it allows.
+static void
+ideidentify(struct idechan *c, int d)
+{
+  ushort id[256];
+  int n;
+
+  outb(c->base+6, 0xe0 | (d<<4));
+  outb(c->base+7, IDE_CMD_IDENT);
+  if(idewait(c, 1) < 0)
+    return;
+  insl(c->base, id, 512/4);
+
+  // Word 49 bit 8: DMA supported.
+  c->dma[d] = (id[49] & 0x100) != 0;
+
+  // Word 47: maximum sectors per interrupt on READ/WRITE MULTIPLE.
+  n = id[47] & 0xff;
+  if(n > IDE_MAXMULT)
+    n = IDE_MAXMULT;
+  if(n < 2)
+    return;
+  outb(c->base+6, 0xe0 | (d<<4));
+  outb(c->base+2, n);
+  outb(c->base+7, IDE_CMD_SETMUL);
+  if(idewait(c, 1) < 0)
+    return;
+  c->mult[d] = n;
+}
+
+// Is disk d of channel c there?  A channel with no disks at all
+// reads as all ones.
+static int
+ideprobe(struct idechan *c, int d)
+{
+  int i, r;
+
+  outb(c->base+6, 0xe0 | (d<<4));
+  for(i=0; i<1000; i++){
+    r = inb(c->base+7);
+    if(r == 0xff)
+      return 0;
+    if(r != 0)
+      return 1;
+  }
+  return 0;
+}
+
+// Find a PCI IDE controller that can be bus master.
+// Boot with idedma=0 to use programmed I/O only.
+static void
+idedmainit(void)
+{
+  struct idechan *c;
+  uint bdf, bm;
+
+  if(!bootarg("idedma", 1) || pcifind(0x01, 0x01, &bdf) < 0)
+    return;
+  // Programming interface bit 7: bus mastering supported.
+  if(!(pciread(bdf, 0x08) & 0x8000))
+    return;
+  pciwrite(bdf, 0x04, pciread(bdf, 0x04) | 0x5);  // I/O space, bus master
+  bm = pciread(bdf, 0x20) & 0xfffc;
+  for(c = idechan; c < idechan + NELEM(idechan); c++, bm += 8)
+    if((c->have[0] || c->have[1]) && (c->prd = (struct prd*)kalloc()) != 0)
+      c->bm = bm;
+}
+
 void
 ideinit(void)
 {
-  int i;
+  struct idechan *c;
+  int i, d;
 
   initlock(&idelock, "ide");
-  picenable(IRQ_IDE);
-  ioapicenable(IRQ_IDE, ncpu - 1);
-  idewait(0);
-  
-  // Check if disk 1 is present
-  outb(0x1f6, 0xe0 | (1<<4));
-  for(i=0; i<1000; i++){
-    if(inb(0x1f7) != 0){
-      havedisk1 = 1;
-      break;
+  idesteer = bootarg("idesteer", 1);
+
+  // Disk 0 is the one we booted from.
+  idechan[0].have[0] = 1;
+  idechan[0].have[1] = ideprobe(&idechan[0], 1);
+  idechan[1].have[0] = ideprobe(&idechan[1], 0);
+  idechan[1].have[1] = ideprobe(&idechan[1], 1);
+
+  for(c = idechan; c < idechan + NELEM(idechan); c++){
+    if(!c->have[0] && !c->have[1])
+      continue;
+    picenable(c->irq);
+    ioapicenable(c->irq, -1);
+    for(d = 0; d < 2; d++){
+      if(c->have[d]){
+        outb(c->base+6, 0xe0 | (d<<4));
+        idewait(c, 0);
+        ideidentify(c, d);
+      }
     }
+    // Switch back to the first disk.
+    outb(c->base+6, 0xe0 | ((c->have[0] ? 0 : 1)<<4));
   }
-  
-  // Switch back to disk 0.
-  outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+  for(c = idechan; c < idechan + NELEM(idechan); c++){
+    if(!c->bm)
+      c->dma[0] = c->dma[1] = 0;
+    // Without DMA a block must fit one MULTIPLE block, as
+    // idestart and ideintr move a request at one interrupt.
+    for(d = 0; d < 2; d++)
+      if(SPB > 1 && c->have[d] && !c->dma[d] && c->mult[d] < SPB)
+        panic("ideinit: disk cannot move a block at once");
+  }
+
+  i = bootarg("idesched", 2);
+  if(i < 0 || i >= NELEM(idescheds))
+    i = 2;
+  idepolicy = &idescheds[i];
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Can request q be moved by the same command as its predecessor p?
+static int
+idemerge(struct buf *p, struct buf *q)
+{
+  return q->disk == p->disk && q->lba == p->lba + SPB &&
+    (q->flags & B_DIRTY) == (p->flags & B_DIRTY);
+}
+
+// Start the request for b on channel c, together with the run of
+// queued requests for the sectors right after it.  Caller must hold
+// idelock.
 static void
-idestart(struct buf *b)
+idestart(struct idechan *c, struct buf *b)
 {
+  struct buf *q;
+  int i, n, max, d;
+
   if(b == 0)
     panic("idestart");
 
-  idewait(0);
-  outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, 1);  // number of sectors
-  outb(0x1f3, b->sector & 0xff);
-  outb(0x1f4, (b->sector >> 8) & 0xff);
-  outb(0x1f5, (b->sector >> 16) & 0xff);
-  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((b->sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, IDE_CMD_WRITE);
-    outsl(0x1f0, b->data, 512/4);
+  d = b->disk&1;
+  c->dmanow = c->dma[d];
+  max = (c->dmanow ? IDE_MAXMULT : c->mult[d]) / SPB;
+  n = 1;
+  for(q = b; n < max && q->qnext && idemerge(q, q->qnext); q = q->qnext)
+    n++;
+  c->nact = n;
+  if(idesteer)
+    ioapicroute(c->irq, b->qcpu);
+  if(b->lba != c->pos)
+    idestat.nseek++;
+  c->pos = b->lba + n*SPB;
+
+  idewait(c, 0);
+  if(c->dmanow){
+    // One descriptor per buffer: buffer data never
+    // crosses a page, so never a 64K boundary.
+    for(q = b, i = 0; i < n; q = q->qnext, i++){
+      c->prd[i].addr = v2p(q->data);
+      c->prd[i].len = BSIZE;
+      c->prd[i].flags = 0;
+    }
+    c->prd[n-1].flags = PRD_EOT;
+    outl(c->bm+BM_PRDT, v2p(c->prd));
+    outb(c->bm+BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_TOMEM);
+    outb(c->bm+BM_STATUS, inb(c->bm+BM_STATUS) | BM_ERR | BM_INTR);
+  }
+  outb(c->ctl, 0);  // generate interrupt
+  outb(c->base+2, n*SPB);  // number of sectors
+  outb(c->base+3, b->lba & 0xff);
+  outb(c->base+4, (b->lba >> 8) & 0xff);
+  outb(c->base+5, (b->lba >> 16) & 0xff);
+  outb(c->base+6, 0xe0 | (d<<4) | ((b->lba>>24)&0x0f));
+  if(c->dmanow){
+    outb(c->base+7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(c->bm+BM_CMD, inb(c->bm+BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
+    outb(c->base+7, max ? IDE_CMD_WRMUL : IDE_CMD_WRITE);
+    for(q = b; n-- > 0; q = q->qnext)
+      outsl(c->base, q->data, BSIZE/4);
   } else {
-    outb(0x1f7, IDE_CMD_READ);
+    outb(c->base+7, max ? IDE_CMD_RDMUL : IDE_CMD_READ);
   }
 }
 
-// Interrupt handler.
+// Start the next pending request of channel c, if any.
+// Caller must hold idelock; nothing may be in flight.
+static void
+idenext(struct idechan *c)
+{
+  if(c->queue == 0)
+    return;
+  idepos = c->pos;
+  if(idepolicy->pick)
+    idepolicy->pick(&c->queue);
+  idestart(c, c->queue);
+}
+
+// Account for the latency of a finished request.
+static void
+idedone(struct buf *b)
+{
+  uint t;
+  int i;
+
+  t = rdtsc() - b->qtsc;
+  for(i = 0; i < 32 && (t >> i) != 0; i++)
+    ;
+  idestat.hist[i]++;
+  if(t > idestat.max)
+    idestat.max = t;
+  idestat.nreq++;
+  idestat.depth--;
+}
+
+// Print disk statistics to the console; called on ^P.
+// No lock, to avoid wedging a stuck machine further.
+void
+idedump(void)
+{
+  int i;
+
+  if(idepolicy == 0)
+    return;
+  cprintf("ide: %s, %d requests, %d seeks, %d late, max %d cycles\n",
+    idepolicy->name, idestat.nreq, idestat.nseek, idestat.nlate, idestat.max);
+  cprintf("ide latency log2(cycles):");
+  for(i = 0; i < NELEM(idestat.hist); i++)
+    if(idestat.hist[i])
+      cprintf(" %d:%d", i, idestat.hist[i]);
+  cprintf("\n");
+}
+
+// Report on the disks for /stats/ide.
 void
-ideintr(void)
+idestats(struct report *r)
 {
+  acquire(&idelock);
+  report(r, "requests", idestat.nreq);
+  report(r, "seeks", idestat.nseek);
+  report(r, "late", idestat.nlate);
+  report(r, "queued", idestat.depth);
+  report(r, "maxqueued", idestat.maxdepth);
+  report(r, "maxcycles", idestat.max);
+  release(&idelock);
+}
+
+// Interrupt handler for channel chan.
+void
+ideintr(int chan)
+{
+  struct idechan *c;
   struct buf *b;
+  int n, ok;
+  uchar st;
 
-  // First queued buffer is the active request.
+  // First nact queued buffers are the active request.
+  c = &idechan[chan];
   acquire(&idelock);
-  if((b = idequeue) == 0){
+  if((b = c->queue) == 0){
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, 512/4);
-  
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
-  
+  // With DMA the data is already in memory; just stop the
+  // bus master and acknowledge it.
+  if(c->dmanow){
+    st = inb(c->bm+BM_STATUS);
+    outb(c->bm+BM_CMD, 0);
+    outb(c->bm+BM_STATUS, st | BM_ERR | BM_INTR);
+    idewait(c, 0);
+    ok = 0;
+  } else
+    ok = !(b->flags & B_DIRTY) && idewait(c, 1) >= 0;
+  for(n = c->nact; n > 0; n--){
+    b = c->queue;
+    c->queue = b->qnext;
+
+    // Read data if needed.
+    if(ok)
+      insl(c->base, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf, or release it
+    // if no one is waiting (read-ahead).
+    idedone(b);
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      brelse(b);
+    } else
+      wakeup(b);
+  }
+  c->nact = 0;
+
   // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  idenext(c);
 
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk. 
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Stripe device dev, which must be ROOTDEV, over disks 1 and 2
+// in units of n blocks, as its superblock says.  Block 1 is
+// the same either way, so the superblock can be read first.
 void
-iderw(struct buf *b)
+idestripe(uint dev, uint n)
 {
+  if(dev != ROOTDEV || n < 2)
+    panic("idestripe");
+  if(!idechan[0].have[1] || !idechan[1].have[0])
+    panic("idestripe: striped file system needs disks 1 and 2");
+  stripe = n;
+  cprintf("ide: striping over disks 1 and 2, %d blocks per unit\n", n);
+}
+
+// Set the disk and sector of that disk that b goes to.
+static void
+idemap(struct buf *b)
+{
+  uint unit;
+
+  if(stripe && b->dev == ROOTDEV){
+    unit = b->sector / stripe;
+    b->disk = 1 + unit % 2;
+    b->lba = (unit / 2 * stripe + b->sector % stripe) * SPB;
+  } else {
+    b->disk = b->dev;
+    b->lba = b->sector * SPB;
+  }
+}
+
+//PAGEBREAK!
+// Queue b on its channel, starting the disk if it is idle.
+// Caller must hold idelock.
+static void
+idequeue(struct buf *b)
+{
+  struct idechan *c;
   struct buf **pp;
+  int i;
 
   if(!(b->flags & B_BUSY))
     panic("iderw: buf not busy");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
     panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+  idemap(b);
+  if(b->disk >= 4 || !idechan[b->disk/2].have[b->disk&1])
+    panic("iderw: ide disk not present");
+  c = &idechan[b->disk/2];
 
-  acquire(&idelock);  //DOC: acquire-lock
+  if(proc){
+    if(b->flags & B_DIRTY)
+      proc->ru.nblkout++;
+    else
+      proc->ru.nblkin++;
+  }
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC: insert-queue
-    ;
-  *pp = b;
+  // Queue b behind the requests in flight, where the
+  // scheduling policy wants it.
+  b->qtick = ticks;
+  b->qtsc = rdtsc();
+  b->qcpu = cpu - cpus;
+  if(++idestat.depth > idestat.maxdepth)
+    idestat.maxdepth = idestat.depth;
+  pp = &c->queue;
+  for(i = 0; i < c->nact; i++)  //DOC: insert-queue
+    pp = &(*pp)->qnext;
+  idepos = c->pos;
+  idepolicy->insert(pp, b);
   
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(c->nact == 0)
+    idenext(c);
+}
+
+// Sync buf with disk. 
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, just queue the request; ideintr releases b.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC: acquire-lock
+  idequeue(b);
   
   // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+  while(!(b->flags & B_ASYNC) && (b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
   release(&idelock);
 }
+
+// Sync the n bufs at b with disk, as iderw does, but queue them
+// all before waiting, so that the scheduler sees them together
+// and neighbours go in one multi-sector command.  None may be
+// B_ASYNC.
+void
+iderwv(struct buf *b, int n)
+{
+  int i;
+
+  acquire(&idelock);
+  for(i = 0; i < n; i++)
+    idequeue(&b[i]);
+  for(i = 0; i < n; i++)
+    while((b[i].flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(&b[i], &idelock);
+  release(&idelock);
+}
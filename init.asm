@@ -0,0 +1,1925 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// The files under /stats, by minor number; see kstat.c.
+char *stats[] = { "bcache", "icache", "kmem", "log", "ide", "sched", "swap" };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 34             	sub    $0x34,%esp
+  char path[32];
+  int pid, wpid, i;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 af 0f 00 00       	push   $0xfaf
+  1b:	e8 74 04 00 00       	call   494 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 af 0f 00 00       	push   $0xfaf
+  33:	e8 66 04 00 00       	call   49e <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 af 0f 00 00       	push   $0xfaf
+  45:	e8 4a 04 00 00       	call   494 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 83 04 00 00       	call   4da <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 76 04 00 00       	call   4da <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+  mkdir("dev");
+  67:	83 ec 0c             	sub    $0xc,%esp
+  6a:	68 b7 0f 00 00       	push   $0xfb7
+  6f:	e8 52 04 00 00       	call   4c6 <mkdir>
+  74:	83 c4 10             	add    $0x10,%esp
+  mknod("dev/lockstat", 2, 0);  // fails harmlessly if it exists
+  77:	83 ec 04             	sub    $0x4,%esp
+  7a:	6a 00                	push   $0x0
+  7c:	6a 02                	push   $0x2
+  7e:	68 bb 0f 00 00       	push   $0xfbb
+  83:	e8 16 04 00 00       	call   49e <mknod>
+  88:	83 c4 10             	add    $0x10,%esp
+  mknod("dev/sysstat", 3, 0);
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	6a 00                	push   $0x0
+  90:	6a 03                	push   $0x3
+  92:	68 c8 0f 00 00       	push   $0xfc8
+  97:	e8 02 04 00 00       	call   49e <mknod>
+  9c:	83 c4 10             	add    $0x10,%esp
+  mknod("dev/procstat", 3, 1);
+  9f:	83 ec 04             	sub    $0x4,%esp
+  a2:	6a 01                	push   $0x1
+  a4:	6a 03                	push   $0x3
+  a6:	68 d4 0f 00 00       	push   $0xfd4
+  ab:	e8 ee 03 00 00       	call   49e <mknod>
+  b0:	83 c4 10             	add    $0x10,%esp
+  mknod("dev/prof", 4, 0);
+  b3:	83 ec 04             	sub    $0x4,%esp
+  b6:	6a 00                	push   $0x0
+  b8:	6a 04                	push   $0x4
+  ba:	68 e1 0f 00 00       	push   $0xfe1
+  bf:	e8 da 03 00 00       	call   49e <mknod>
+  c4:	83 c4 10             	add    $0x10,%esp
+  mkdir("stats");
+  c7:	83 ec 0c             	sub    $0xc,%esp
+  ca:	68 ea 0f 00 00       	push   $0xfea
+  cf:	e8 f2 03 00 00       	call   4c6 <mkdir>
+  d4:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(stats)/sizeof(stats[0]); i++){
+  d7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  de:	eb 4b                	jmp    12b <main+0x12b>
+    strcpy(path, "stats/");
+  e0:	83 ec 08             	sub    $0x8,%esp
+  e3:	68 f0 0f 00 00       	push   $0xff0
+  e8:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  eb:	50                   	push   %eax
+  ec:	e8 fa 00 00 00       	call   1eb <strcpy>
+  f1:	83 c4 10             	add    $0x10,%esp
+    strcpy(path + 6, stats[i]);
+  f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  f7:	8b 14 85 c4 13 00 00 	mov    0x13c4(,%eax,4),%edx
+  fe:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 101:	83 c0 06             	add    $0x6,%eax
+ 104:	83 ec 08             	sub    $0x8,%esp
+ 107:	52                   	push   %edx
+ 108:	50                   	push   %eax
+ 109:	e8 dd 00 00 00       	call   1eb <strcpy>
+ 10e:	83 c4 10             	add    $0x10,%esp
+    mknod(path, 5, i);
+ 111:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 114:	98                   	cwtl
+ 115:	83 ec 04             	sub    $0x4,%esp
+ 118:	50                   	push   %eax
+ 119:	6a 05                	push   $0x5
+ 11b:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 11e:	50                   	push   %eax
+ 11f:	e8 7a 03 00 00       	call   49e <mknod>
+ 124:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(stats)/sizeof(stats[0]); i++){
+ 127:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 12b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12e:	83 f8 06             	cmp    $0x6,%eax
+ 131:	76 ad                	jbe    e0 <main+0xe0>
+  }
+  mkdir("tmp");
+ 133:	83 ec 0c             	sub    $0xc,%esp
+ 136:	68 f7 0f 00 00       	push   $0xff7
+ 13b:	e8 86 03 00 00       	call   4c6 <mkdir>
+ 140:	83 c4 10             	add    $0x10,%esp
+  mount("tmp");  // scratch files stay in memory
+ 143:	83 ec 0c             	sub    $0xc,%esp
+ 146:	68 f7 0f 00 00       	push   $0xff7
+ 14b:	e8 c0 04 00 00       	call   610 <mount>
+ 150:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+ 153:	83 ec 08             	sub    $0x8,%esp
+ 156:	68 fb 0f 00 00       	push   $0xffb
+ 15b:	6a 01                	push   $0x1
+ 15d:	e8 8a 07 00 00       	call   8ec <printf>
+ 162:	83 c4 10             	add    $0x10,%esp
+    pid = spawn("sh", argv, 0, 0);
+ 165:	6a 00                	push   $0x0
+ 167:	6a 00                	push   $0x0
+ 169:	68 bc 13 00 00       	push   $0x13bc
+ 16e:	68 86 0f 00 00       	push   $0xf86
+ 173:	e8 16 04 00 00       	call   58e <spawn>
+ 178:	83 c4 10             	add    $0x10,%esp
+ 17b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+ 17e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 182:	79 29                	jns    1ad <main+0x1ad>
+      printf(1, "init: spawn sh failed\n");
+ 184:	83 ec 08             	sub    $0x8,%esp
+ 187:	68 0e 10 00 00       	push   $0x100e
+ 18c:	6a 01                	push   $0x1
+ 18e:	e8 59 07 00 00       	call   8ec <printf>
+ 193:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 196:	e8 c1 02 00 00       	call   45c <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+ 19b:	83 ec 08             	sub    $0x8,%esp
+ 19e:	68 25 10 00 00       	push   $0x1025
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	e8 42 07 00 00       	call   8ec <printf>
+ 1aa:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+ 1ad:	e8 b1 02 00 00       	call   463 <wait>
+ 1b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 1b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 1b9:	78 98                	js     153 <main+0x153>
+ 1bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1be:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 1c1:	75 d8                	jne    19b <main+0x19b>
+    printf(1, "init: starting sh\n");
+ 1c3:	eb 8e                	jmp    153 <main+0x153>
+
+000001c5 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1c5:	55                   	push   %ebp
+ 1c6:	89 e5                	mov    %esp,%ebp
+ 1c8:	57                   	push   %edi
+ 1c9:	53                   	push   %ebx
+    if(cc < 1)
+ 1ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1cd:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d3:	89 cb                	mov    %ecx,%ebx
+ 1d5:	89 df                	mov    %ebx,%edi
+ 1d7:	89 d1                	mov    %edx,%ecx
+ 1d9:	fc                   	cld
+ 1da:	f3 aa                	rep stos %al,%es:(%edi)
+ 1dc:	89 ca                	mov    %ecx,%edx
+ 1de:	89 fb                	mov    %edi,%ebx
+ 1e0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1e3:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 1e6:	90                   	nop
+ 1e7:	5b                   	pop    %ebx
+ 1e8:	5f                   	pop    %edi
+ 1e9:	5d                   	pop    %ebp
+ 1ea:	c3                   	ret
+
+000001eb <strcpy>:
+{
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1f7:	90                   	nop
+ 1f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1fb:	8d 42 01             	lea    0x1(%edx),%eax
+ 1fe:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 201:	8b 45 08             	mov    0x8(%ebp),%eax
+ 204:	8d 48 01             	lea    0x1(%eax),%ecx
+ 207:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 20a:	0f b6 12             	movzbl (%edx),%edx
+ 20d:	88 10                	mov    %dl,(%eax)
+ 20f:	0f b6 00             	movzbl (%eax),%eax
+ 212:	84 c0                	test   %al,%al
+ 214:	75 e2                	jne    1f8 <strcpy+0xd>
+  return os;
+ 216:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 219:	c9                   	leave
+ 21a:	c3                   	ret
+
+0000021b <strcmp>:
+{
+ 21b:	55                   	push   %ebp
+ 21c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 21e:	eb 08                	jmp    228 <strcmp+0xd>
+    p++, q++;
+ 220:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 224:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 228:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22b:	0f b6 00             	movzbl (%eax),%eax
+ 22e:	84 c0                	test   %al,%al
+ 230:	74 10                	je     242 <strcmp+0x27>
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+ 235:	0f b6 10             	movzbl (%eax),%edx
+ 238:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23b:	0f b6 00             	movzbl (%eax),%eax
+ 23e:	38 c2                	cmp    %al,%dl
+ 240:	74 de                	je     220 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 242:	8b 45 08             	mov    0x8(%ebp),%eax
+ 245:	0f b6 00             	movzbl (%eax),%eax
+ 248:	0f b6 d0             	movzbl %al,%edx
+ 24b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24e:	0f b6 00             	movzbl (%eax),%eax
+ 251:	0f b6 c0             	movzbl %al,%eax
+ 254:	29 c2                	sub    %eax,%edx
+ 256:	89 d0                	mov    %edx,%eax
+}
+ 258:	5d                   	pop    %ebp
+ 259:	c3                   	ret
+
+0000025a <strlen>:
+{
+ 25a:	55                   	push   %ebp
+ 25b:	89 e5                	mov    %esp,%ebp
+ 25d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 260:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 267:	eb 04                	jmp    26d <strlen+0x13>
+ 269:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 26d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 270:	8b 45 08             	mov    0x8(%ebp),%eax
+ 273:	01 d0                	add    %edx,%eax
+ 275:	0f b6 00             	movzbl (%eax),%eax
+ 278:	84 c0                	test   %al,%al
+ 27a:	75 ed                	jne    269 <strlen+0xf>
+  return n;
+ 27c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 27f:	c9                   	leave
+ 280:	c3                   	ret
+
+00000281 <memset>:
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 284:	8b 45 10             	mov    0x10(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	ff 75 0c             	push   0xc(%ebp)
+ 28b:	ff 75 08             	push   0x8(%ebp)
+ 28e:	e8 32 ff ff ff       	call   1c5 <stosb>
+ 293:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 296:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 299:	c9                   	leave
+ 29a:	c3                   	ret
+
+0000029b <strchr>:
+{
+ 29b:	55                   	push   %ebp
+ 29c:	89 e5                	mov    %esp,%ebp
+ 29e:	83 ec 04             	sub    $0x4,%esp
+ 2a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a4:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2a7:	eb 14                	jmp    2bd <strchr+0x22>
+    if(*s == c)
+ 2a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ac:	0f b6 00             	movzbl (%eax),%eax
+ 2af:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2b2:	75 05                	jne    2b9 <strchr+0x1e>
+      return (char*)s;
+ 2b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b7:	eb 13                	jmp    2cc <strchr+0x31>
+  for(; *s; s++)
+ 2b9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	0f b6 00             	movzbl (%eax),%eax
+ 2c3:	84 c0                	test   %al,%al
+ 2c5:	75 e2                	jne    2a9 <strchr+0xe>
+  return 0;
+ 2c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2cc:	c9                   	leave
+ 2cd:	c3                   	ret
+
+000002ce <gets>:
+{
+ 2ce:	55                   	push   %ebp
+ 2cf:	89 e5                	mov    %esp,%ebp
+ 2d1:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2d4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2db:	eb 42                	jmp    31f <gets+0x51>
+    cc = read(0, &c, 1);
+ 2dd:	83 ec 04             	sub    $0x4,%esp
+ 2e0:	6a 01                	push   $0x1
+ 2e2:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2e5:	50                   	push   %eax
+ 2e6:	6a 00                	push   $0x0
+ 2e8:	e8 84 01 00 00       	call   471 <read>
+ 2ed:	83 c4 10             	add    $0x10,%esp
+ 2f0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2f7:	7e 33                	jle    32c <gets+0x5e>
+    buf[i++] = c;
+ 2f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2fc:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ff:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 302:	89 c2                	mov    %eax,%edx
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	01 c2                	add    %eax,%edx
+ 309:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0a                	cmp    $0xa,%al
+ 315:	74 16                	je     32d <gets+0x5f>
+ 317:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 31b:	3c 0d                	cmp    $0xd,%al
+ 31d:	74 0e                	je     32d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 31f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 322:	83 c0 01             	add    $0x1,%eax
+ 325:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 328:	7f b3                	jg     2dd <gets+0xf>
+ 32a:	eb 01                	jmp    32d <gets+0x5f>
+      break;
+ 32c:	90                   	nop
+  }
+  buf[i] = '\0';
+ 32d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+ 333:	01 d0                	add    %edx,%eax
+ 335:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 338:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+
+0000033d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 33d:	55                   	push   %ebp
+ 33e:	89 e5                	mov    %esp,%ebp
+ 340:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 343:	83 ec 08             	sub    $0x8,%esp
+ 346:	6a 00                	push   $0x0
+ 348:	ff 75 08             	push   0x8(%ebp)
+ 34b:	e8 44 01 00 00       	call   494 <open>
+ 350:	83 c4 10             	add    $0x10,%esp
+ 353:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 356:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 35a:	79 07                	jns    363 <stat+0x26>
+    return -1;
+ 35c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 361:	eb 25                	jmp    388 <stat+0x4b>
+  r = fstat(fd, st);
+ 363:	83 ec 08             	sub    $0x8,%esp
+ 366:	ff 75 0c             	push   0xc(%ebp)
+ 369:	ff 75 f4             	push   -0xc(%ebp)
+ 36c:	e8 41 01 00 00       	call   4b2 <fstat>
+ 371:	83 c4 10             	add    $0x10,%esp
+ 374:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 377:	83 ec 0c             	sub    $0xc,%esp
+ 37a:	ff 75 f4             	push   -0xc(%ebp)
+ 37d:	e8 fd 00 00 00       	call   47f <close>
+ 382:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 385:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+
+0000038a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 38a:	55                   	push   %ebp
+ 38b:	89 e5                	mov    %esp,%ebp
+ 38d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 390:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 397:	eb 25                	jmp    3be <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 399:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 39c:	89 d0                	mov    %edx,%eax
+ 39e:	c1 e0 02             	shl    $0x2,%eax
+ 3a1:	01 d0                	add    %edx,%eax
+ 3a3:	01 c0                	add    %eax,%eax
+ 3a5:	89 c1                	mov    %eax,%ecx
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	8d 50 01             	lea    0x1(%eax),%edx
+ 3ad:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3b0:	0f b6 00             	movzbl (%eax),%eax
+ 3b3:	0f be c0             	movsbl %al,%eax
+ 3b6:	01 c8                	add    %ecx,%eax
+ 3b8:	83 e8 30             	sub    $0x30,%eax
+ 3bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c1:	0f b6 00             	movzbl (%eax),%eax
+ 3c4:	3c 2f                	cmp    $0x2f,%al
+ 3c6:	7e 0a                	jle    3d2 <atoi+0x48>
+ 3c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cb:	0f b6 00             	movzbl (%eax),%eax
+ 3ce:	3c 39                	cmp    $0x39,%al
+ 3d0:	7e c7                	jle    399 <atoi+0xf>
+  return n;
+ 3d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3d5:	c9                   	leave
+ 3d6:	c3                   	ret
+
+000003d7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3d7:	55                   	push   %ebp
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3e9:	eb 17                	jmp    402 <memmove+0x2b>
+    *dst++ = *src++;
+ 3eb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3ee:	8d 42 01             	lea    0x1(%edx),%eax
+ 3f1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3f7:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3fa:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3fd:	0f b6 12             	movzbl (%edx),%edx
+ 400:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 402:	8b 45 10             	mov    0x10(%ebp),%eax
+ 405:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 408:	89 55 10             	mov    %edx,0x10(%ebp)
+ 40b:	85 c0                	test   %eax,%eax
+ 40d:	7f dc                	jg     3eb <memmove+0x14>
+  return vdst;
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 412:	c9                   	leave
+ 413:	c3                   	ret
+
+00000414 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 414:	83 3d e0 13 00 00 00 	cmpl   $0x0,0x13e0
+  jg 2f
+ 41b:	7f 2e                	jg     44b <dosyscall+0x37>
+  jl 1f
+ 41d:	7c 29                	jl     448 <dosyscall+0x34>
+  pushl %eax
+ 41f:	50                   	push   %eax
+  pushl %ebx
+ 420:	53                   	push   %ebx
+  movl $1, %eax
+ 421:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 426:	0f a2                	cpuid
+  popl %ebx
+ 428:	5b                   	pop    %ebx
+  popl %eax
+ 429:	58                   	pop    %eax
+  movl $-1, sysmode
+ 42a:	c7 05 e0 13 00 00 ff 	movl   $0xffffffff,0x13e0
+ 431:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 434:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 43a:	74 0c                	je     448 <dosyscall+0x34>
+  movl $1, sysmode
+ 43c:	c7 05 e0 13 00 00 01 	movl   $0x1,0x13e0
+ 443:	00 00 00 
+  jmp 2f
+ 446:	eb 03                	jmp    44b <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 448:	cd 40                	int    $0x40
+  ret
+ 44a:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 44b:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 44d:	ba 54 04 00 00       	mov    $0x454,%edx
+  sysenter
+ 452:	0f 34                	sysenter
+3:
+  ret
+ 454:	c3                   	ret
+
+00000455 <fork>:
+
+SYSCALL(fork)
+ 455:	b8 01 00 00 00       	mov    $0x1,%eax
+ 45a:	eb b8                	jmp    414 <dosyscall>
+
+0000045c <exit>:
+SYSCALL(exit)
+ 45c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 461:	eb b1                	jmp    414 <dosyscall>
+
+00000463 <wait>:
+SYSCALL(wait)
+ 463:	b8 03 00 00 00       	mov    $0x3,%eax
+ 468:	eb aa                	jmp    414 <dosyscall>
+
+0000046a <pipe>:
+SYSCALL(pipe)
+ 46a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 46f:	eb a3                	jmp    414 <dosyscall>
+
+00000471 <read>:
+SYSCALL(read)
+ 471:	b8 05 00 00 00       	mov    $0x5,%eax
+ 476:	eb 9c                	jmp    414 <dosyscall>
+
+00000478 <write>:
+SYSCALL(write)
+ 478:	b8 10 00 00 00       	mov    $0x10,%eax
+ 47d:	eb 95                	jmp    414 <dosyscall>
+
+0000047f <close>:
+SYSCALL(close)
+ 47f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 484:	eb 8e                	jmp    414 <dosyscall>
+
+00000486 <kill>:
+SYSCALL(kill)
+ 486:	b8 06 00 00 00       	mov    $0x6,%eax
+ 48b:	eb 87                	jmp    414 <dosyscall>
+
+0000048d <exec>:
+SYSCALL(exec)
+ 48d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 492:	eb 80                	jmp    414 <dosyscall>
+
+00000494 <open>:
+SYSCALL(open)
+ 494:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 499:	e9 76 ff ff ff       	jmp    414 <dosyscall>
+
+0000049e <mknod>:
+SYSCALL(mknod)
+ 49e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a3:	e9 6c ff ff ff       	jmp    414 <dosyscall>
+
+000004a8 <unlink>:
+SYSCALL(unlink)
+ 4a8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ad:	e9 62 ff ff ff       	jmp    414 <dosyscall>
+
+000004b2 <fstat>:
+SYSCALL(fstat)
+ 4b2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b7:	e9 58 ff ff ff       	jmp    414 <dosyscall>
+
+000004bc <link>:
+SYSCALL(link)
+ 4bc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c1:	e9 4e ff ff ff       	jmp    414 <dosyscall>
+
+000004c6 <mkdir>:
+SYSCALL(mkdir)
+ 4c6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4cb:	e9 44 ff ff ff       	jmp    414 <dosyscall>
+
+000004d0 <chdir>:
+SYSCALL(chdir)
+ 4d0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d5:	e9 3a ff ff ff       	jmp    414 <dosyscall>
+
+000004da <dup>:
+SYSCALL(dup)
+ 4da:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4df:	e9 30 ff ff ff       	jmp    414 <dosyscall>
+
+000004e4 <getpid>:
+SYSCALL(getpid)
+ 4e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e9:	e9 26 ff ff ff       	jmp    414 <dosyscall>
+
+000004ee <sbrk>:
+SYSCALL(sbrk)
+ 4ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f3:	e9 1c ff ff ff       	jmp    414 <dosyscall>
+
+000004f8 <sleep>:
+SYSCALL(sleep)
+ 4f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4fd:	e9 12 ff ff ff       	jmp    414 <dosyscall>
+
+00000502 <uptime>:
+SYSCALL(uptime)
+ 502:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 507:	e9 08 ff ff ff       	jmp    414 <dosyscall>
+
+0000050c <symlink>:
+SYSCALL(symlink)
+ 50c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 511:	e9 fe fe ff ff       	jmp    414 <dosyscall>
+
+00000516 <readlink>:
+SYSCALL(readlink)
+ 516:	b8 17 00 00 00       	mov    $0x17,%eax
+ 51b:	e9 f4 fe ff ff       	jmp    414 <dosyscall>
+
+00000520 <fprot>:
+SYSCALL(fprot)
+ 520:	b8 18 00 00 00       	mov    $0x18,%eax
+ 525:	e9 ea fe ff ff       	jmp    414 <dosyscall>
+
+0000052a <funprot>:
+SYSCALL(funprot)
+ 52a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 52f:	e9 e0 fe ff ff       	jmp    414 <dosyscall>
+
+00000534 <funlock>:
+SYSCALL(funlock)
+ 534:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 539:	e9 d6 fe ff ff       	jmp    414 <dosyscall>
+
+0000053e <mmap>:
+SYSCALL(mmap)
+ 53e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 543:	e9 cc fe ff ff       	jmp    414 <dosyscall>
+
+00000548 <munmap>:
+SYSCALL(munmap)
+ 548:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 54d:	e9 c2 fe ff ff       	jmp    414 <dosyscall>
+
+00000552 <sendfile>:
+SYSCALL(sendfile)
+ 552:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 557:	e9 b8 fe ff ff       	jmp    414 <dosyscall>
+
+0000055c <readv>:
+SYSCALL(readv)
+ 55c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 561:	e9 ae fe ff ff       	jmp    414 <dosyscall>
+
+00000566 <writev>:
+SYSCALL(writev)
+ 566:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 56b:	e9 a4 fe ff ff       	jmp    414 <dosyscall>
+
+00000570 <pread>:
+SYSCALL(pread)
+ 570:	b8 20 00 00 00       	mov    $0x20,%eax
+ 575:	e9 9a fe ff ff       	jmp    414 <dosyscall>
+
+0000057a <pwrite>:
+SYSCALL(pwrite)
+ 57a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 57f:	e9 90 fe ff ff       	jmp    414 <dosyscall>
+
+00000584 <lseek>:
+SYSCALL(lseek)
+ 584:	b8 22 00 00 00       	mov    $0x22,%eax
+ 589:	e9 86 fe ff ff       	jmp    414 <dosyscall>
+
+0000058e <spawn>:
+SYSCALL(spawn)
+ 58e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 593:	e9 7c fe ff ff       	jmp    414 <dosyscall>
+
+00000598 <setpriority>:
+SYSCALL(setpriority)
+ 598:	b8 24 00 00 00       	mov    $0x24,%eax
+ 59d:	e9 72 fe ff ff       	jmp    414 <dosyscall>
+
+000005a2 <kthread_create>:
+SYSCALL(kthread_create)
+ 5a2:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5a7:	e9 68 fe ff ff       	jmp    414 <dosyscall>
+
+000005ac <kthread_id>:
+SYSCALL(kthread_id)
+ 5ac:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5b1:	e9 5e fe ff ff       	jmp    414 <dosyscall>
+
+000005b6 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 5b6:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5bb:	e9 54 fe ff ff       	jmp    414 <dosyscall>
+
+000005c0 <kthread_join>:
+SYSCALL(kthread_join)
+ 5c0:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5c5:	e9 4a fe ff ff       	jmp    414 <dosyscall>
+
+000005ca <futex>:
+SYSCALL(futex)
+ 5ca:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5cf:	e9 40 fe ff ff       	jmp    414 <dosyscall>
+
+000005d4 <signal>:
+SYSCALL(signal)
+ 5d4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5d9:	e9 36 fe ff ff       	jmp    414 <dosyscall>
+
+000005de <alarm>:
+SYSCALL(alarm)
+ 5de:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5e3:	e9 2c fe ff ff       	jmp    414 <dosyscall>
+
+000005e8 <usleep>:
+SYSCALL(usleep)
+ 5e8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5ed:	e9 22 fe ff ff       	jmp    414 <dosyscall>
+
+000005f2 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5f2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5f7:	e9 18 fe ff ff       	jmp    414 <dosyscall>
+
+000005fc <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5fc:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 601:	e9 0e fe ff ff       	jmp    414 <dosyscall>
+
+00000606 <getrusage>:
+SYSCALL(getrusage)
+ 606:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 60b:	e9 04 fe ff ff       	jmp    414 <dosyscall>
+
+00000610 <mount>:
+SYSCALL(mount)
+ 610:	b8 30 00 00 00       	mov    $0x30,%eax
+ 615:	e9 fa fd ff ff       	jmp    414 <dosyscall>
+
+0000061a <getdents>:
+SYSCALL(getdents)
+ 61a:	b8 31 00 00 00       	mov    $0x31,%eax
+ 61f:	e9 f0 fd ff ff       	jmp    414 <dosyscall>
+
+00000624 <yield>:
+SYSCALL(yield)
+ 624:	b8 32 00 00 00       	mov    $0x32,%eax
+ 629:	e9 e6 fd ff ff       	jmp    414 <dosyscall>
+
+0000062e <ncpu>:
+SYSCALL(ncpu)
+ 62e:	b8 33 00 00 00       	mov    $0x33,%eax
+ 633:	e9 dc fd ff ff       	jmp    414 <dosyscall>
+
+00000638 <fallocate>:
+SYSCALL(fallocate)
+ 638:	b8 34 00 00 00       	mov    $0x34,%eax
+ 63d:	e9 d2 fd ff ff       	jmp    414 <dosyscall>
+
+00000642 <ftruncate>:
+SYSCALL(ftruncate)
+ 642:	b8 35 00 00 00       	mov    $0x35,%eax
+ 647:	e9 c8 fd ff ff       	jmp    414 <dosyscall>
+
+0000064c <fsync>:
+SYSCALL(fsync)
+ 64c:	b8 36 00 00 00       	mov    $0x36,%eax
+ 651:	e9 be fd ff ff       	jmp    414 <dosyscall>
+
+00000656 <fdatasync>:
+SYSCALL(fdatasync)
+ 656:	b8 37 00 00 00       	mov    $0x37,%eax
+ 65b:	e9 b4 fd ff ff       	jmp    414 <dosyscall>
+
+00000660 <poll>:
+SYSCALL(poll)
+ 660:	b8 38 00 00 00       	mov    $0x38,%eax
+ 665:	e9 aa fd ff ff       	jmp    414 <dosyscall>
+
+0000066a <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 66a:	55                   	push   %ebp
+ 66b:	89 e5                	mov    %esp,%ebp
+ 66d:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 670:	8b 45 08             	mov    0x8(%ebp),%eax
+ 673:	8b 40 04             	mov    0x4(%eax),%eax
+ 676:	85 c0                	test   %eax,%eax
+ 678:	7e 1f                	jle    699 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	8b 50 04             	mov    0x4(%eax),%edx
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	8d 48 08             	lea    0x8(%eax),%ecx
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+ 689:	8b 00                	mov    (%eax),%eax
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	52                   	push   %edx
+ 68f:	51                   	push   %ecx
+ 690:	50                   	push   %eax
+ 691:	e8 d0 fe ff ff       	call   566 <writev>
+ 696:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 699:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 6ad:	00 00 00 
+}
+ 6b0:	90                   	nop
+ 6b1:	c9                   	leave
+ 6b2:	c3                   	ret
+
+000006b3 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 6b3:	55                   	push   %ebp
+ 6b4:	89 e5                	mov    %esp,%ebp
+ 6b6:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 6b9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 6bd:	0f 84 94 00 00 00    	je     757 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c9:	85 c0                	test   %eax,%eax
+ 6cb:	7e 40                	jle    70d <put+0x5a>
+    v = &o->iov[o->n-1];
+ 6cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6d3:	83 e8 01             	sub    $0x1,%eax
+ 6d6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e0:	01 d0                	add    %edx,%eax
+ 6e2:	83 c0 08             	add    $0x8,%eax
+ 6e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 6e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6eb:	8b 10                	mov    (%eax),%edx
+ 6ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6f3:	01 d0                	add    %edx,%eax
+ 6f5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 6f8:	75 13                	jne    70d <put+0x5a>
+      v->iov_len += n;
+ 6fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6fd:	8b 50 04             	mov    0x4(%eax),%edx
+ 700:	8b 45 10             	mov    0x10(%ebp),%eax
+ 703:	01 c2                	add    %eax,%edx
+ 705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 708:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 70b:	eb 4b                	jmp    758 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 70d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 710:	8b 40 04             	mov    0x4(%eax),%eax
+ 713:	83 f8 10             	cmp    $0x10,%eax
+ 716:	75 0e                	jne    726 <put+0x73>
+    flush(o);
+ 718:	83 ec 0c             	sub    $0xc,%esp
+ 71b:	ff 75 08             	push   0x8(%ebp)
+ 71e:	e8 47 ff ff ff       	call   66a <flush>
+ 723:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 726:	8b 45 08             	mov    0x8(%ebp),%eax
+ 729:	8b 50 04             	mov    0x4(%eax),%edx
+ 72c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 732:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 736:	8b 45 08             	mov    0x8(%ebp),%eax
+ 739:	8b 50 04             	mov    0x4(%eax),%edx
+ 73c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 742:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 746:	8b 45 08             	mov    0x8(%ebp),%eax
+ 749:	8b 40 04             	mov    0x4(%eax),%eax
+ 74c:	8d 50 01             	lea    0x1(%eax),%edx
+ 74f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 752:	89 50 04             	mov    %edx,0x4(%eax)
+ 755:	eb 01                	jmp    758 <put+0xa5>
+    return;
+ 757:	90                   	nop
+}
+ 758:	c9                   	leave
+ 759:	c3                   	ret
+
+0000075a <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 75a:	55                   	push   %ebp
+ 75b:	89 e5                	mov    %esp,%ebp
+ 75d:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 760:	8b 45 08             	mov    0x8(%ebp),%eax
+ 763:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 769:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 76c:	01 d0                	add    %edx,%eax
+ 76e:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 773:	77 0b                	ja     780 <room+0x26>
+ 775:	8b 45 08             	mov    0x8(%ebp),%eax
+ 778:	8b 40 04             	mov    0x4(%eax),%eax
+ 77b:	83 f8 10             	cmp    $0x10,%eax
+ 77e:	75 0e                	jne    78e <room+0x34>
+    flush(o);
+ 780:	83 ec 0c             	sub    $0xc,%esp
+ 783:	ff 75 08             	push   0x8(%ebp)
+ 786:	e8 df fe ff ff       	call   66a <flush>
+ 78b:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 78e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 791:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 797:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7a0:	01 d0                	add    %edx,%eax
+}
+ 7a2:	c9                   	leave
+ 7a3:	c3                   	ret
+
+000007a4 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 7a4:	55                   	push   %ebp
+ 7a5:	89 e5                	mov    %esp,%ebp
+ 7a7:	83 ec 28             	sub    $0x28,%esp
+ 7aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ad:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 7b0:	83 ec 08             	sub    $0x8,%esp
+ 7b3:	6a 01                	push   $0x1
+ 7b5:	ff 75 08             	push   0x8(%ebp)
+ 7b8:	e8 9d ff ff ff       	call   75a <room>
+ 7bd:	83 c4 10             	add    $0x10,%esp
+ 7c0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 7c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c6:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 7ca:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 7cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cf:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7d5:	8d 50 01             	lea    0x1(%eax),%edx
+ 7d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7db:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 7e1:	83 ec 04             	sub    $0x4,%esp
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	ff 75 f4             	push   -0xc(%ebp)
+ 7e9:	ff 75 08             	push   0x8(%ebp)
+ 7ec:	e8 c2 fe ff ff       	call   6b3 <put>
+ 7f1:	83 c4 10             	add    $0x10,%esp
+}
+ 7f4:	90                   	nop
+ 7f5:	c9                   	leave
+ 7f6:	c3                   	ret
+
+000007f7 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 7f7:	55                   	push   %ebp
+ 7f8:	89 e5                	mov    %esp,%ebp
+ 7fa:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 7fd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 804:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 808:	74 17                	je     821 <printint+0x2a>
+ 80a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 80e:	79 11                	jns    821 <printint+0x2a>
+    neg = 1;
+ 810:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 817:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 81a:	f7 d8                	neg    %eax
+ 81c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 81f:	eb 06                	jmp    827 <printint+0x30>
+  } else {
+    x = xx;
+ 821:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 824:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 827:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 82e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 831:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 834:	ba 00 00 00 00       	mov    $0x0,%edx
+ 839:	f7 f1                	div    %ecx
+ 83b:	89 d1                	mov    %edx,%ecx
+ 83d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 840:	8d 50 01             	lea    0x1(%eax),%edx
+ 843:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 846:	0f b6 91 e4 13 00 00 	movzbl 0x13e4(%ecx),%edx
+ 84d:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 851:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 854:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 857:	ba 00 00 00 00       	mov    $0x0,%edx
+ 85c:	f7 f1                	div    %ecx
+ 85e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 861:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 865:	75 c7                	jne    82e <printint+0x37>
+  if(neg)
+ 867:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 86b:	74 0e                	je     87b <printint+0x84>
+    buf[i++] = '-';
+ 86d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 870:	8d 50 01             	lea    0x1(%eax),%edx
+ 873:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 876:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 87b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 881:	83 ec 08             	sub    $0x8,%esp
+ 884:	ff 75 e8             	push   -0x18(%ebp)
+ 887:	ff 75 08             	push   0x8(%ebp)
+ 88a:	e8 cb fe ff ff       	call   75a <room>
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 895:	eb 1d                	jmp    8b4 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 897:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89a:	83 e8 01             	sub    $0x1,%eax
+ 89d:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8a0:	89 c2                	mov    %eax,%edx
+ 8a2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a5:	01 c2                	add    %eax,%edx
+ 8a7:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 8aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ad:	01 c8                	add    %ecx,%eax
+ 8af:	0f b6 00             	movzbl (%eax),%eax
+ 8b2:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 8b4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8bc:	79 d9                	jns    897 <printint+0xa0>
+  o->used += n;
+ 8be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c1:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 8c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ca:	01 c2                	add    %eax,%edx
+ 8cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cf:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 8d5:	83 ec 04             	sub    $0x4,%esp
+ 8d8:	ff 75 e8             	push   -0x18(%ebp)
+ 8db:	ff 75 e4             	push   -0x1c(%ebp)
+ 8de:	ff 75 08             	push   0x8(%ebp)
+ 8e1:	e8 cd fd ff ff       	call   6b3 <put>
+ 8e6:	83 c4 10             	add    $0x10,%esp
+}
+ 8e9:	90                   	nop
+ 8ea:	c9                   	leave
+ 8eb:	c3                   	ret
+
+000008ec <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8ec:	55                   	push   %ebp
+ 8ed:	89 e5                	mov    %esp,%ebp
+ 8ef:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 8f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f8:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 8fe:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 905:	00 00 00 
+  o.used = 0;
+ 908:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 90f:	00 00 00 
+  state = 0;
+ 912:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 919:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 91c:	83 c0 04             	add    $0x4,%eax
+ 91f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 922:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 929:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 930:	e9 82 01 00 00       	jmp    ab7 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 935:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 938:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93b:	01 d0                	add    %edx,%eax
+ 93d:	0f b6 00             	movzbl (%eax),%eax
+ 940:	0f be c0             	movsbl %al,%eax
+ 943:	25 ff 00 00 00       	and    $0xff,%eax
+ 948:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 94b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 94f:	75 38                	jne    989 <printf+0x9d>
+      if(c == '%'){
+ 951:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 955:	0f 85 58 01 00 00    	jne    ab3 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 95b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 961:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 964:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 967:	01 ca                	add    %ecx,%edx
+ 969:	83 ec 04             	sub    $0x4,%esp
+ 96c:	50                   	push   %eax
+ 96d:	52                   	push   %edx
+ 96e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 974:	50                   	push   %eax
+ 975:	e8 39 fd ff ff       	call   6b3 <put>
+ 97a:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 97d:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 984:	e9 2a 01 00 00       	jmp    ab3 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 989:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 98d:	0f 85 20 01 00 00    	jne    ab3 <printf+0x1c7>
+      if(c == 'd'){
+ 993:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 997:	75 22                	jne    9bb <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 999:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 99c:	8b 00                	mov    (%eax),%eax
+ 99e:	6a 01                	push   $0x1
+ 9a0:	6a 0a                	push   $0xa
+ 9a2:	50                   	push   %eax
+ 9a3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9a9:	50                   	push   %eax
+ 9aa:	e8 48 fe ff ff       	call   7f7 <printint>
+ 9af:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9b2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9b6:	e9 e8 00 00 00       	jmp    aa3 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 9bb:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 9bf:	74 06                	je     9c7 <printf+0xdb>
+ 9c1:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 9c5:	75 22                	jne    9e9 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 9c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ca:	8b 00                	mov    (%eax),%eax
+ 9cc:	6a 00                	push   $0x0
+ 9ce:	6a 10                	push   $0x10
+ 9d0:	50                   	push   %eax
+ 9d1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d7:	50                   	push   %eax
+ 9d8:	e8 1a fe ff ff       	call   7f7 <printint>
+ 9dd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9e0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9e4:	e9 ba 00 00 00       	jmp    aa3 <printf+0x1b7>
+      } else if(c == 's'){
+ 9e9:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 9ed:	75 3f                	jne    a2e <printf+0x142>
+        s = (char*)*ap;
+ 9ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f2:	8b 00                	mov    (%eax),%eax
+ 9f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9f7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 9fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9ff:	75 07                	jne    a08 <printf+0x11c>
+          s = "(null)";
+ a01:	c7 45 f4 2e 10 00 00 	movl   $0x102e,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a08:	83 ec 0c             	sub    $0xc,%esp
+ a0b:	ff 75 f4             	push   -0xc(%ebp)
+ a0e:	e8 47 f8 ff ff       	call   25a <strlen>
+ a13:	83 c4 10             	add    $0x10,%esp
+ a16:	83 ec 04             	sub    $0x4,%esp
+ a19:	50                   	push   %eax
+ a1a:	ff 75 f4             	push   -0xc(%ebp)
+ a1d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a23:	50                   	push   %eax
+ a24:	e8 8a fc ff ff       	call   6b3 <put>
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	eb 75                	jmp    aa3 <printf+0x1b7>
+      } else if(c == 'c'){
+ a2e:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a32:	75 21                	jne    a55 <printf+0x169>
+        putc(&o, *ap);
+ a34:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a37:	8b 00                	mov    (%eax),%eax
+ a39:	0f be c0             	movsbl %al,%eax
+ a3c:	83 ec 08             	sub    $0x8,%esp
+ a3f:	50                   	push   %eax
+ a40:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a46:	50                   	push   %eax
+ a47:	e8 58 fd ff ff       	call   7a4 <putc>
+ a4c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a4f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a53:	eb 4e                	jmp    aa3 <printf+0x1b7>
+      } else if(c == '%'){
+ a55:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a59:	75 1b                	jne    a76 <printf+0x18a>
+        putc(&o, c);
+ a5b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a5e:	0f be c0             	movsbl %al,%eax
+ a61:	83 ec 08             	sub    $0x8,%esp
+ a64:	50                   	push   %eax
+ a65:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a6b:	50                   	push   %eax
+ a6c:	e8 33 fd ff ff       	call   7a4 <putc>
+ a71:	83 c4 10             	add    $0x10,%esp
+ a74:	eb 2d                	jmp    aa3 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a76:	83 ec 08             	sub    $0x8,%esp
+ a79:	6a 25                	push   $0x25
+ a7b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a81:	50                   	push   %eax
+ a82:	e8 1d fd ff ff       	call   7a4 <putc>
+ a87:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ a8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a8d:	0f be c0             	movsbl %al,%eax
+ a90:	83 ec 08             	sub    $0x8,%esp
+ a93:	50                   	push   %eax
+ a94:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a9a:	50                   	push   %eax
+ a9b:	e8 04 fd ff ff       	call   7a4 <putc>
+ aa0:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ aa3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ aaa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aad:	83 c0 01             	add    $0x1,%eax
+ ab0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ab3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ab7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ aba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ abd:	01 d0                	add    %edx,%eax
+ abf:	0f b6 00             	movzbl (%eax),%eax
+ ac2:	84 c0                	test   %al,%al
+ ac4:	0f 85 6b fe ff ff    	jne    935 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ aca:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ ace:	75 22                	jne    af2 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ ad0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ad3:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ad6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ ad9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ adc:	01 ca                	add    %ecx,%edx
+ ade:	83 ec 04             	sub    $0x4,%esp
+ ae1:	50                   	push   %eax
+ ae2:	52                   	push   %edx
+ ae3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ae9:	50                   	push   %eax
+ aea:	e8 c4 fb ff ff       	call   6b3 <put>
+ aef:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ af2:	83 ec 0c             	sub    $0xc,%esp
+ af5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ afb:	50                   	push   %eax
+ afc:	e8 69 fb ff ff       	call   66a <flush>
+ b01:	83 c4 10             	add    $0x10,%esp
+}
+ b04:	90                   	nop
+ b05:	c9                   	leave
+ b06:	c3                   	ret
+
+00000b07 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b07:	55                   	push   %ebp
+ b08:	89 e5                	mov    %esp,%ebp
+ b0a:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b0d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b10:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b16:	f0 87 02             	lock xchg %eax,(%edx)
+ b19:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b1f:	c9                   	leave
+ b20:	c3                   	ret
+
+00000b21 <lock>:
+{
+ b21:	55                   	push   %ebp
+ b22:	89 e5                	mov    %esp,%ebp
+ b24:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b27:	a1 f8 13 00 00       	mov    0x13f8,%eax
+ b2c:	85 c0                	test   %eax,%eax
+ b2e:	74 09                	je     b39 <lock+0x18>
+ b30:	a1 f8 13 00 00       	mov    0x13f8,%eax
+ b35:	ff d0                	call   *%eax
+ b37:	eb 05                	jmp    b3e <lock+0x1d>
+ b39:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b3e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b41:	90                   	nop
+ b42:	83 ec 08             	sub    $0x8,%esp
+ b45:	6a 01                	push   $0x1
+ b47:	68 30 14 00 00       	push   $0x1430
+ b4c:	e8 b6 ff ff ff       	call   b07 <xchg>
+ b51:	83 c4 10             	add    $0x10,%esp
+ b54:	85 c0                	test   %eax,%eax
+ b56:	75 ea                	jne    b42 <lock+0x21>
+  return pin;
+ b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b5b:	c9                   	leave
+ b5c:	c3                   	ret
+
+00000b5d <unlock>:
+{
+ b5d:	55                   	push   %ebp
+ b5e:	89 e5                	mov    %esp,%ebp
+ b60:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b63:	6a 00                	push   $0x0
+ b65:	68 30 14 00 00       	push   $0x1430
+ b6a:	e8 98 ff ff ff       	call   b07 <xchg>
+ b6f:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b72:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b76:	78 10                	js     b88 <unlock+0x2b>
+    mallocunpin(pin);
+ b78:	a1 fc 13 00 00       	mov    0x13fc,%eax
+ b7d:	83 ec 0c             	sub    $0xc,%esp
+ b80:	ff 75 08             	push   0x8(%ebp)
+ b83:	ff d0                	call   *%eax
+ b85:	83 c4 10             	add    $0x10,%esp
+}
+ b88:	90                   	nop
+ b89:	c9                   	leave
+ b8a:	c3                   	ret
+
+00000b8b <sizeclass>:
+{
+ b8b:	55                   	push   %ebp
+ b8c:	89 e5                	mov    %esp,%ebp
+ b8e:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ b91:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ b98:	eb 1c                	jmp    bb6 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ b9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9d:	ba 02 00 00 00       	mov    $0x2,%edx
+ ba2:	89 c1                	mov    %eax,%ecx
+ ba4:	d3 e2                	shl    %cl,%edx
+ ba6:	89 d0                	mov    %edx,%eax
+ ba8:	3b 45 08             	cmp    0x8(%ebp),%eax
+ bab:	72 05                	jb     bb2 <sizeclass+0x27>
+      return c;
+ bad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb0:	eb 0f                	jmp    bc1 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ bb2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ bb6:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ bba:	7e de                	jle    b9a <sizeclass+0xf>
+  return -1;
+ bbc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ bc1:	c9                   	leave
+ bc2:	c3                   	ret
+
+00000bc3 <bigfree>:
+{
+ bc3:	55                   	push   %ebp
+ bc4:	89 e5                	mov    %esp,%ebp
+ bc6:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc9:	a1 08 14 00 00       	mov    0x1408,%eax
+ bce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bd1:	eb 24                	jmp    bf7 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bd3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd6:	8b 00                	mov    (%eax),%eax
+ bd8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bdb:	72 12                	jb     bef <bigfree+0x2c>
+ bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+ be0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ be3:	72 24                	jb     c09 <bigfree+0x46>
+ be5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be8:	8b 00                	mov    (%eax),%eax
+ bea:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bed:	72 1a                	jb     c09 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf2:	8b 00                	mov    (%eax),%eax
+ bf4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bfd:	73 d4                	jae    bd3 <bigfree+0x10>
+ bff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c02:	8b 00                	mov    (%eax),%eax
+ c04:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c07:	73 ca                	jae    bd3 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c09:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0c:	8b 40 04             	mov    0x4(%eax),%eax
+ c0f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c16:	8b 45 08             	mov    0x8(%ebp),%eax
+ c19:	01 c2                	add    %eax,%edx
+ c1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1e:	8b 00                	mov    (%eax),%eax
+ c20:	39 c2                	cmp    %eax,%edx
+ c22:	75 24                	jne    c48 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c24:	8b 45 08             	mov    0x8(%ebp),%eax
+ c27:	8b 50 04             	mov    0x4(%eax),%edx
+ c2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2d:	8b 00                	mov    (%eax),%eax
+ c2f:	8b 40 04             	mov    0x4(%eax),%eax
+ c32:	01 c2                	add    %eax,%edx
+ c34:	8b 45 08             	mov    0x8(%ebp),%eax
+ c37:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3d:	8b 00                	mov    (%eax),%eax
+ c3f:	8b 10                	mov    (%eax),%edx
+ c41:	8b 45 08             	mov    0x8(%ebp),%eax
+ c44:	89 10                	mov    %edx,(%eax)
+ c46:	eb 0a                	jmp    c52 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4b:	8b 10                	mov    (%eax),%edx
+ c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c50:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c55:	8b 40 04             	mov    0x4(%eax),%eax
+ c58:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c62:	01 d0                	add    %edx,%eax
+ c64:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c67:	75 20                	jne    c89 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ c69:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c6c:	8b 50 04             	mov    0x4(%eax),%edx
+ c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c72:	8b 40 04             	mov    0x4(%eax),%eax
+ c75:	01 c2                	add    %eax,%edx
+ c77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c80:	8b 10                	mov    (%eax),%edx
+ c82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c85:	89 10                	mov    %edx,(%eax)
+ c87:	eb 08                	jmp    c91 <bigfree+0xce>
+    p->s.ptr = bp;
+ c89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c8f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c94:	a3 08 14 00 00       	mov    %eax,0x1408
+}
+ c99:	90                   	nop
+ c9a:	c9                   	leave
+ c9b:	c3                   	ret
+
+00000c9c <free>:
+{
+ c9c:	55                   	push   %ebp
+ c9d:	89 e5                	mov    %esp,%ebp
+ c9f:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ ca2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ca6:	74 68                	je     d10 <free+0x74>
+  bp = (Header*)ap - 1;
+ ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cab:	83 e8 08             	sub    $0x8,%eax
+ cae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ cb1:	e8 6b fe ff ff       	call   b21 <lock>
+ cb6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ cb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbc:	8b 40 04             	mov    0x4(%eax),%eax
+ cbf:	83 ec 0c             	sub    $0xc,%esp
+ cc2:	50                   	push   %eax
+ cc3:	e8 c3 fe ff ff       	call   b8b <sizeclass>
+ cc8:	83 c4 10             	add    $0x10,%esp
+ ccb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ cce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ cd2:	78 1e                	js     cf2 <free+0x56>
+    bp->s.ptr = classfree[c];
+ cd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cd7:	8b 14 85 0c 14 00 00 	mov    0x140c(,%eax,4),%edx
+ cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce1:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ ce3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ce6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ce9:	89 14 85 0c 14 00 00 	mov    %edx,0x140c(,%eax,4)
+ cf0:	eb 0e                	jmp    d00 <free+0x64>
+    bigfree(bp);
+ cf2:	83 ec 0c             	sub    $0xc,%esp
+ cf5:	ff 75 f4             	push   -0xc(%ebp)
+ cf8:	e8 c6 fe ff ff       	call   bc3 <bigfree>
+ cfd:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d00:	83 ec 0c             	sub    $0xc,%esp
+ d03:	ff 75 f0             	push   -0x10(%ebp)
+ d06:	e8 52 fe ff ff       	call   b5d <unlock>
+ d0b:	83 c4 10             	add    $0x10,%esp
+ d0e:	eb 01                	jmp    d11 <free+0x75>
+    return;
+ d10:	90                   	nop
+}
+ d11:	c9                   	leave
+ d12:	c3                   	ret
+
+00000d13 <morecore>:
+{
+ d13:	55                   	push   %ebp
+ d14:	89 e5                	mov    %esp,%ebp
+ d16:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d19:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d20:	77 07                	ja     d29 <morecore+0x16>
+    nu = 4096;
+ d22:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d29:	8b 45 08             	mov    0x8(%ebp),%eax
+ d2c:	c1 e0 03             	shl    $0x3,%eax
+ d2f:	83 ec 0c             	sub    $0xc,%esp
+ d32:	50                   	push   %eax
+ d33:	e8 b6 f7 ff ff       	call   4ee <sbrk>
+ d38:	83 c4 10             	add    $0x10,%esp
+ d3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d3e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d42:	75 07                	jne    d4b <morecore+0x38>
+    return 0;
+ d44:	b8 00 00 00 00       	mov    $0x0,%eax
+ d49:	eb 22                	jmp    d6d <morecore+0x5a>
+  hp = (Header*)p;
+ d4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d54:	8b 55 08             	mov    0x8(%ebp),%edx
+ d57:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d5a:	83 ec 0c             	sub    $0xc,%esp
+ d5d:	ff 75 f0             	push   -0x10(%ebp)
+ d60:	e8 5e fe ff ff       	call   bc3 <bigfree>
+ d65:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d68:	a1 08 14 00 00       	mov    0x1408,%eax
+}
+ d6d:	c9                   	leave
+ d6e:	c3                   	ret
+
+00000d6f <bigalloc>:
+{
+ d6f:	55                   	push   %ebp
+ d70:	89 e5                	mov    %esp,%ebp
+ d72:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d75:	a1 08 14 00 00       	mov    0x1408,%eax
+ d7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d7d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d81:	75 23                	jne    da6 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ d83:	c7 45 f0 00 14 00 00 	movl   $0x1400,-0x10(%ebp)
+ d8a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d8d:	a3 08 14 00 00       	mov    %eax,0x1408
+ d92:	a1 08 14 00 00       	mov    0x1408,%eax
+ d97:	a3 00 14 00 00       	mov    %eax,0x1400
+    base.s.size = 0;
+ d9c:	c7 05 04 14 00 00 00 	movl   $0x0,0x1404
+ da3:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ da6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da9:	8b 00                	mov    (%eax),%eax
+ dab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db1:	8b 40 04             	mov    0x4(%eax),%eax
+ db4:	3b 45 08             	cmp    0x8(%ebp),%eax
+ db7:	72 4a                	jb     e03 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dbc:	8b 40 04             	mov    0x4(%eax),%eax
+ dbf:	39 45 08             	cmp    %eax,0x8(%ebp)
+ dc2:	75 0c                	jne    dd0 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ dc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dc7:	8b 10                	mov    (%eax),%edx
+ dc9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dcc:	89 10                	mov    %edx,(%eax)
+ dce:	eb 26                	jmp    df6 <bigalloc+0x87>
+        p->s.size -= nunits;
+ dd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dd3:	8b 40 04             	mov    0x4(%eax),%eax
+ dd6:	2b 45 08             	sub    0x8(%ebp),%eax
+ dd9:	89 c2                	mov    %eax,%edx
+ ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dde:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de4:	8b 40 04             	mov    0x4(%eax),%eax
+ de7:	c1 e0 03             	shl    $0x3,%eax
+ dea:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ded:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df0:	8b 55 08             	mov    0x8(%ebp),%edx
+ df3:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ df6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df9:	a3 08 14 00 00       	mov    %eax,0x1408
+      return p;
+ dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e01:	eb 3b                	jmp    e3e <bigalloc+0xcf>
+    if(p == freep)
+ e03:	a1 08 14 00 00       	mov    0x1408,%eax
+ e08:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e0b:	75 1e                	jne    e2b <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e0d:	83 ec 0c             	sub    $0xc,%esp
+ e10:	ff 75 08             	push   0x8(%ebp)
+ e13:	e8 fb fe ff ff       	call   d13 <morecore>
+ e18:	83 c4 10             	add    $0x10,%esp
+ e1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e1e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e22:	75 07                	jne    e2b <bigalloc+0xbc>
+        return 0;
+ e24:	b8 00 00 00 00       	mov    $0x0,%eax
+ e29:	eb 13                	jmp    e3e <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e34:	8b 00                	mov    (%eax),%eax
+ e36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e39:	e9 70 ff ff ff       	jmp    dae <bigalloc+0x3f>
+}
+ e3e:	c9                   	leave
+ e3f:	c3                   	ret
+
+00000e40 <alloc>:
+alloc(uint nbytes)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e46:	8b 45 08             	mov    0x8(%ebp),%eax
+ e49:	83 c0 07             	add    $0x7,%eax
+ e4c:	c1 e8 03             	shr    $0x3,%eax
+ e4f:	83 c0 01             	add    $0x1,%eax
+ e52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e55:	ff 75 f4             	push   -0xc(%ebp)
+ e58:	e8 2e fd ff ff       	call   b8b <sizeclass>
+ e5d:	83 c4 04             	add    $0x4,%esp
+ e60:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e63:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e67:	79 2c                	jns    e95 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ e69:	83 ec 0c             	sub    $0xc,%esp
+ e6c:	ff 75 f4             	push   -0xc(%ebp)
+ e6f:	e8 fb fe ff ff       	call   d6f <bigalloc>
+ e74:	83 c4 10             	add    $0x10,%esp
+ e77:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e7a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e7e:	75 0a                	jne    e8a <alloc+0x4a>
+      return 0;
+ e80:	b8 00 00 00 00       	mov    $0x0,%eax
+ e85:	e9 c8 00 00 00       	jmp    f52 <alloc+0x112>
+    return (void*)(p + 1);
+ e8a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e8d:	83 c0 08             	add    $0x8,%eax
+ e90:	e9 bd 00 00 00       	jmp    f52 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ e95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e98:	8b 04 85 0c 14 00 00 	mov    0x140c(,%eax,4),%eax
+ e9f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ea2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ea6:	74 1a                	je     ec2 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ ea8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eab:	8b 10                	mov    (%eax),%edx
+ ead:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eb0:	89 14 85 0c 14 00 00 	mov    %edx,0x140c(,%eax,4)
+    return (void*)(p + 1);
+ eb7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eba:	83 c0 08             	add    $0x8,%eax
+ ebd:	e9 90 00 00 00       	jmp    f52 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ ec2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ec5:	ba 02 00 00 00       	mov    $0x2,%edx
+ eca:	89 c1                	mov    %eax,%ecx
+ ecc:	d3 e2                	shl    %cl,%edx
+ ece:	89 d0                	mov    %edx,%eax
+ ed0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ed3:	a1 28 14 00 00       	mov    0x1428,%eax
+ ed8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ edb:	c1 e2 03             	shl    $0x3,%edx
+ ede:	01 d0                	add    %edx,%eax
+ ee0:	8b 15 2c 14 00 00    	mov    0x142c,%edx
+ ee6:	39 c2                	cmp    %eax,%edx
+ ee8:	73 3f                	jae    f29 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ eea:	83 ec 0c             	sub    $0xc,%esp
+ eed:	68 00 08 00 00       	push   $0x800
+ ef2:	e8 78 fe ff ff       	call   d6f <bigalloc>
+ ef7:	83 c4 10             	add    $0x10,%esp
+ efa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ efd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f01:	75 07                	jne    f0a <alloc+0xca>
+      return 0;
+ f03:	b8 00 00 00 00       	mov    $0x0,%eax
+ f08:	eb 48                	jmp    f52 <alloc+0x112>
+    bump = (char*)p;
+ f0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f0d:	a3 28 14 00 00       	mov    %eax,0x1428
+    bumpend = (char*)(p + p->s.size);
+ f12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f15:	8b 40 04             	mov    0x4(%eax),%eax
+ f18:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f1f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f22:	01 d0                	add    %edx,%eax
+ f24:	a3 2c 14 00 00       	mov    %eax,0x142c
+  }
+  p = (Header*)bump;
+ f29:	a1 28 14 00 00       	mov    0x1428,%eax
+ f2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f31:	a1 28 14 00 00       	mov    0x1428,%eax
+ f36:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f39:	c1 e2 03             	shl    $0x3,%edx
+ f3c:	01 d0                	add    %edx,%eax
+ f3e:	a3 28 14 00 00       	mov    %eax,0x1428
+  p->s.size = nunits;
+ f43:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f46:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f49:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f4c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f4f:	83 c0 08             	add    $0x8,%eax
+}
+ f52:	c9                   	leave
+ f53:	c3                   	ret
+
+00000f54 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f54:	55                   	push   %ebp
+ f55:	89 e5                	mov    %esp,%ebp
+ f57:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f5a:	e8 c2 fb ff ff       	call   b21 <lock>
+ f5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f62:	83 ec 0c             	sub    $0xc,%esp
+ f65:	ff 75 08             	push   0x8(%ebp)
+ f68:	e8 d3 fe ff ff       	call   e40 <alloc>
+ f6d:	83 c4 10             	add    $0x10,%esp
+ f70:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f73:	83 ec 0c             	sub    $0xc,%esp
+ f76:	ff 75 f4             	push   -0xc(%ebp)
+ f79:	e8 df fb ff ff       	call   b5d <unlock>
+ f7e:	83 c4 10             	add    $0x10,%esp
+  return p;
+ f81:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f84:	c9                   	leave
+ f85:	c3                   	ret
@@ -7,10 +7,14 @@
 
 char *argv[] = { "sh", 0 };
 
+// The files under /stats, by minor number; see kstat.c.
+char *stats[] = { "bcache", "icache", "kmem", "log", "ide", "sched", "swap" };
+
 int
 main(void)
 {
-  int pid, wpid;
+  char path[32];
+  int pid, wpid, i;
 
   if(open("console", O_RDWR) < 0){
     mknod("console", 1, 1);
@@ -18,17 +22,25 @@ main(void)
   }
   dup(0);  // stdout
   dup(0);  // stderr
+  mkdir("dev");
+  mknod("dev/lockstat", 2, 0);  // fails harmlessly if it exists
+  mknod("dev/sysstat", 3, 0);
+  mknod("dev/procstat", 3, 1);
+  mknod("dev/prof", 4, 0);
+  mkdir("stats");
+  for(i = 0; i < sizeof(stats)/sizeof(stats[0]); i++){
+    strcpy(path, "stats/");
+    strcpy(path + 6, stats[i]);
+    mknod(path, 5, i);
+  }
+  mkdir("tmp");
+  mount("tmp");  // scratch files stay in memory
 
   for(;;){
     printf(1, "init: starting sh\n");
-    pid = fork();
+    pid = spawn("sh", argv, 0, 0);
     if(pid < 0){
-      printf(1, "init: fork failed\n");
-      exit();
-    }
-    if(pid == 0){
-      exec("sh", argv);
-      printf(1, "init: exec sh failed\n");
+      printf(1, "init: spawn sh failed\n");
       exit();
     }
     while((wpid=wait()) >= 0 && wpid != pid)
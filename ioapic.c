@@ -4,6 +4,9 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "traps.h"
 
 #define IOAPIC  0xFEC00000   // Default physical address of IO APIC
@@ -24,6 +27,11 @@
 
 volatile struct ioapic *ioapic;
 
+#define NIRQ 24  // redirection table entries that ioapicinit clears
+
+static int irqcpu[NIRQ];  // CPU each enabled interrupt goes to
+static int nextcpu;       // for spreading interrupts over CPUs
+
 // IO APIC MMIO structure: write reg, then read or write data.
 struct ioapic {
   uint reg;
@@ -61,21 +69,51 @@ ioapicinit(void)
 
   // Mark all interrupts edge-triggered, active high, disabled,
   // and not routed to any CPUs.
+  if(maxintr >= NIRQ)
+    maxintr = NIRQ-1;
   for(i = 0; i <= maxintr; i++){
     ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
     ioapicwrite(REG_TABLE+2*i+1, 0);
   }
 }
 
+// Send interrupt irq to cpu, an index into cpus[].  Callers must
+// not race: ioapicenable runs during boot, and ide.c routes its
+// interrupt while holding idelock.
 void
-ioapicenable(int irq, int cpunum)
+ioapicroute(int irq, int cpu)
 {
-  if(!ismp)
+  if(!ismp || irq < 0 || irq >= NIRQ || cpu < 0 || cpu >= ncpu)
+    return;
+  if(irqcpu[irq] == cpu)
+    return;
+  irqcpu[irq] = cpu;
+  ioapicwrite(REG_TABLE+2*irq+1, cpus[cpu].id << 24);
+}
+
+// Enable interrupt irq and send it to cpu, or, if cpu is -1, to
+// the next CPU in turn other than CPU 0, which has the clock's
+// bookkeeping to do.  A boot option irqN=cpu overrides either.
+void
+ioapicenable(int irq, int cpu)
+{
+  char name[8];
+
+  if(!ismp || irq < 0 || irq >= NIRQ)
     return;
 
+  if(cpu < 0){
+    cpu = ncpu > 1 ? 1 + nextcpu % (ncpu - 1) : 0;
+    nextcpu++;
+  }
+  snprintf(name, sizeof(name), "irq%d", irq);
+  cpu = bootarg(name, cpu);
+  if(cpu >= ncpu)
+    cpu = 0;
+
   // Mark interrupt edge-triggered, active high,
-  // enabled, and routed to the given cpunum,
-  // which happens to be that cpu's APIC ID.
+  // enabled, and routed to the given cpu's APIC ID.
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
-  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+  ioapicwrite(REG_TABLE+2*irq+1, cpus[cpu].id << 24);
+  irqcpu[irq] = cpu;
 }
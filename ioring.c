@@ -0,0 +1,274 @@
+// Batched system calls through shared rings.
+//
+// A process registers one page of its heap as a struct ioring
+// (see ioring.h) with ioring_setup.  It queues requests in the
+// submission ring and calls ioring_enter, which takes them all in
+// one trap and hands them to the ring's workers, and can wait for
+// completions.  The workers are kernel threads of the process
+// (see kworker), so they share its address space and open files
+// and carry out each request as the system call would, posting
+// the result to the completion ring.  Meanwhile the process can
+// compute, or queue more.
+//
+// The kernel keeps its own copies of the indices it advances and
+// trusts nothing in the page but the requests, which it copies
+// before looking at them.  It takes no more requests than the
+// completion ring has room for, so completions never overflow.
+// The page is pinned (see upin) so that it stays the process's
+// even across fork.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "file.h"
+#include "ioring.h"
+
+#define NIOWORKER 4  // requests carried out at once
+
+struct ioreq {
+  struct ioring_sqe sqe;
+  struct file *f;           // for read, write and fsync
+  struct ioreq *next;
+};
+
+struct ioctx {
+  struct spinlock lock;
+  struct ioring *ring;      // the shared page
+  uint sqhead;              // next request to take
+  uint cqtail;              // next completion to fill
+  int inflight;             // requests taken but not completed
+  struct ioreq *queue;      // waiting for a worker, oldest first
+  struct ioreq **qtail;
+  struct ioreq *free;
+  struct ioreq req[IORING_NCQ];
+};
+
+// Post the completion of r, which returned res, and free r.
+// Caller holds c->lock.
+static void
+complete(struct ioctx *c, struct ioreq *r, int res)
+{
+  struct ioring_cqe *cqe;
+
+  cqe = &c->ring->cq[c->cqtail % IORING_NCQ];
+  cqe->data = r->sqe.data;
+  cqe->res = res;
+  c->cqtail++;
+  c->ring->cqtail = c->cqtail;
+  c->inflight--;
+  r->next = c->free;
+  c->free = r;
+  wakeup(c);
+}
+
+// Carry out request r in the current process.
+static int
+iodo(struct ioreq *r)
+{
+  struct ioring_sqe *s;
+  char *path;
+  int n;
+
+  s = &r->sqe;
+  switch(s->op){
+  case IORING_OP_READ:
+  case IORING_OP_WRITE:
+    if(s->len < 0 || checkptr(s->addr, s->len, s->op == IORING_OP_READ) < 0)
+      return -1;
+    if(s->off >= 0 && r->f->type != FD_INODE)
+      return -1;
+    if(s->op == IORING_OP_READ){
+      if(s->off < 0)
+        return fileread(r->f, (char*)s->addr, s->len);
+      return filereadat(r->f, (char*)s->addr, s->len, s->off);
+    }
+    if(s->off < 0)
+      return filewrite(r->f, (char*)s->addr, s->len);
+    return filewriteat(r->f, (char*)s->addr, s->len, s->off);
+  case IORING_OP_FSYNC:
+    if(r->f->type == FD_PIPE)
+      return 0;
+    return filesync(r->f, 0);
+  case IORING_OP_OPEN:
+    // Copied, as argstr does: the user may rewrite it meanwhile.
+    if((n = fetchstr(proc->group, s->addr, &path)) < 0 || n >= MAXSTRARG)
+      return -1;
+    memmove(proc->argstr[0], path, n);
+    proc->argstr[0][n] = 0;
+    return openfd(proc->argstr[0], s->flags);
+  case IORING_OP_CLOSE:
+    return closefd(s->fd);
+  }
+  return -1;
+}
+
+// A worker: carry out queued requests one at a time.
+static void
+ioworker(void)
+{
+  struct ioctx *c;
+  struct ioreq *r;
+  int res;
+
+  c = proc->group->ioctx;
+  for(;;){
+    acquire(&c->lock);
+    while(c->queue == 0 && !proc->killed)
+      sleep(&c->queue, &c->lock);
+    if(proc->killed){
+      // ioringfree drops what is still queued.
+      release(&c->lock);
+      kworkerexit();
+    }
+    r = c->queue;
+    if((c->queue = r->next) == 0)
+      c->qtail = &c->queue;
+    release(&c->lock);
+
+    res = iodo(r);
+    if(r->f)
+      fileclose(r->f);
+    acquire(&c->lock);
+    complete(c, r, res);
+    release(&c->lock);
+  }
+}
+
+// Register the page at user address va as the current process's
+// ring and start its workers.  Return 0, or -1.
+int
+ioringsetup(uint va)
+{
+  struct proc *g;
+  struct ioctx *c;
+  char *k;
+  int i, n;
+
+  g = proc->group;
+  if(sizeof(struct ioring) > PGSIZE || sizeof(struct ioctx) > PGSIZE)
+    panic("ioringsetup");
+  if(g->ioctx || (k = upin(va)) == 0)
+    return -1;
+  if((c = (struct ioctx*)kalloc()) == 0){
+    kfree(k);
+    return -1;
+  }
+  memset(c, 0, sizeof(*c));
+  initlock(&c->lock, "ioring");
+  c->ring = (struct ioring*)k;
+  c->qtail = &c->queue;
+  for(i = 0; i < IORING_NCQ; i++){
+    c->req[i].next = c->free;
+    c->free = &c->req[i];
+  }
+  c->sqhead = c->ring->sqhead = c->ring->sqtail;
+  c->cqtail = c->ring->cqhead = c->ring->cqtail;
+
+  lockgroup();
+  if(g->ioctx){
+    unlockgroup();
+    lockunregister(&c->lock);
+    kfree((char*)c);
+    kfree(k);
+    return -1;
+  }
+  g->ioctx = c;
+  unlockgroup();
+
+  for(n = 0; n < NIOWORKER; n++)
+    if(kworker("ioworker", ioworker) < 0)
+      break;
+  if(n == 0){
+    ioringfree(g);
+    return -1;
+  }
+  return 0;
+}
+
+// Take up to n requests from the current process's submission ring
+// and queue them for the workers, then wait until at least wait
+// completions are ready or none are to come.  Return the number of
+// requests taken, or -1.
+int
+ioringenter(int n, int wait)
+{
+  struct ioctx *c;
+  struct ioring *ring;
+  struct ioreq *r;
+  uint ready;
+  int done;
+
+  if((c = proc->group->ioctx) == 0)
+    return -1;
+  ring = c->ring;
+  for(done = 0; done < n; done++){
+    acquire(&c->lock);
+    ready = c->cqtail - ring->cqhead;
+    if(c->sqhead == ring->sqtail || c->free == 0 ||
+       ready >= IORING_NCQ || ready + c->inflight >= IORING_NCQ){
+      release(&c->lock);
+      break;
+    }
+    r = c->free;
+    c->free = r->next;
+    r->sqe = ring->sq[c->sqhead % IORING_NSQ];
+    c->sqhead++;
+    ring->sqhead = c->sqhead;
+    c->inflight++;
+    release(&c->lock);
+
+    r->f = 0;
+    r->next = 0;
+    switch(r->sqe.op){
+    case IORING_OP_READ:
+    case IORING_OP_WRITE:
+    case IORING_OP_FSYNC:
+      r->f = fdfile(r->sqe.fd);
+      if(r->f && r->f->type != FD_INODE && r->f->type != FD_PIPE){
+        fileclose(r->f);
+        r->f = 0;
+      }
+      if(r->f == 0){
+        acquire(&c->lock);
+        complete(c, r, -1);
+        release(&c->lock);
+        continue;
+      }
+      break;
+    }
+    acquire(&c->lock);
+    *c->qtail = r;
+    c->qtail = &r->next;
+    wakeone(&c->queue);
+    release(&c->lock);
+  }
+
+  acquire(&c->lock);
+  while((int)(c->cqtail - ring->cqhead) < wait && c->inflight > 0 && !proc->killed)
+    sleep(c, &c->lock);
+  release(&c->lock);
+  return done;
+}
+
+// Free the ring of p, a main thread whose other threads, the
+// workers included, have ended.
+void
+ioringfree(struct proc *p)
+{
+  struct ioctx *c;
+  struct ioreq *r;
+
+  if((c = p->ioctx) == 0)
+    return;
+  p->ioctx = 0;
+  for(r = c->queue; r; r = r->next)
+    if(r->f)
+      fileclose(r->f);
+  kfree((char*)c->ring);
+  lockunregister(&c->lock);
+  kfree((char*)c);
+}
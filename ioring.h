@@ -0,0 +1,43 @@
+// Submission and completion rings shared by a process and the
+// kernel, for batched system calls; see ioring.c.
+
+#define IORING_NSQ 32   // submission slots
+#define IORING_NCQ 64   // completion slots, and the most in flight
+
+// Request types
+#define IORING_OP_READ  1
+#define IORING_OP_WRITE 2
+#define IORING_OP_FSYNC 3
+#define IORING_OP_OPEN  4
+#define IORING_OP_CLOSE 5
+
+// A request, as the arguments of the system call it stands for.
+struct ioring_sqe {
+  int op;           // IORING_OP_*
+  int fd;           // for all but open
+  uint addr;        // buffer for read and write, path for open
+  int len;          // bytes to read or write
+  int off;          // file offset, or -1 for the descriptor's own
+  int flags;        // mode for open
+  uint data;        // returned in the completion
+  int pad;
+};
+
+// The outcome of a request.
+struct ioring_cqe {
+  uint data;        // the request's data
+  int res;          // what the system call would have returned
+};
+
+// The shared page.  The user fills sq[sqtail % IORING_NSQ] and
+// advances sqtail; the kernel takes requests from sqhead on.  The
+// kernel fills cq[cqtail % IORING_NCQ] and advances cqtail; the
+// user takes completions from cqhead on and advances it.
+struct ioring {
+  volatile uint sqhead;
+  volatile uint sqtail;
+  volatile uint cqhead;
+  volatile uint cqtail;
+  struct ioring_sqe sq[IORING_NSQ];
+  struct ioring_cqe cq[IORING_NCQ];
+};
@@ -1,6 +1,16 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and physically
+// contiguous blocks of 2^order pages for kallocn().
+//
+// Free memory is kept in a buddy system: a free block of 2^k
+// pages starts at a multiple of 2^k pages, and when it is freed
+// next to its free buddy the two merge into a block of 2^(k+1).
+
+// Each page has a reference count, so that a fork()ed child can
+// share its parent's pages copy-on-write.  kalloc() returns a
+// page with one reference, kdup() adds one, and kfree() drops
+// one, only freeing the page when none are left.
 
 #include "types.h"
 #include "defs.h"
@@ -8,18 +18,47 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "kstat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+#define KBATCH 32  // pages moved between a CPU's list and the global one
+#define KZERO  32  // zeroed pages an idle CPU keeps ready
+#define NPFN (PHYSTOP/PGSIZE)
+
 struct run {
   struct run *next;
+  struct run *prev;  // buddy lists only
+};
+
+// Each CPU keeps a list of free pages of its own, so that
+// kalloc() and kfree() rarely take the global lock: a CPU takes
+// KBATCH pages from the global list when its own is empty, and
+// hands KBATCH back once it holds more than twice that.  A CPU
+// that finds both empty takes a page from another CPU's list.
+// Pages on CPU lists are not free as far as the buddy system is
+// concerned, so they do not merge until handed back.
+//
+// A CPU also keeps up to KZERO pages that it zeroed while it had
+// nothing else to do, for kalloc_zeroed().
+struct kcpu {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+  struct run *zero;  // zeroed pages
+  int nzero;
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run free[KMAXORDER+1];  // free blocks of each order
+  int nfree;                     // pages in free blocks
+  uchar order[NPFN];             // order+1 at the start of a free block
+  struct kcpu cpu[NCPU];
+  ushort ref[NPFN];              // references to each page
 } kmem;
 
 // Initialization happens in two phases.
@@ -30,14 +69,27 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i <= KMAXORDER; i++)
+    kmem.free[i].next = kmem.free[i].prev = &kmem.free[i];
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cpu[i].lock, "kcpu");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
 
+// Boot with mem=N, or build with MEMMB=N, to use only the first N
+// megabytes, to try out paging with less memory.
 void
 kinit2(void *vstart, void *vend)
 {
+  uint n;
+
+  n = bootarg("mem", MEMMB);
+  if(n > 0 && n < v2p(vend) / (1024*1024))
+    vend = p2v(n * 1024*1024);
   freerange(vstart, vend);
   kmem.use_lock = 1;
 }
@@ -51,46 +103,382 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+static struct run*
+pfnrun(uint pfn)
+{
+  return (struct run*)p2v(pfn * PGSIZE);
+}
+
+static void
+bremove(uint pfn)
+{
+  struct run *r;
+
+  r = pfnrun(pfn);
+  r->prev->next = r->next;
+  r->next->prev = r->prev;
+  kmem.order[pfn] = 0;
+}
+
+static void
+binsert(uint pfn, int order)
+{
+  struct run *r, *h;
+
+  r = pfnrun(pfn);
+  h = &kmem.free[order];
+  r->next = h->next;
+  r->prev = h;
+  h->next->prev = r;
+  h->next = r;
+  kmem.order[pfn] = order + 1;
+}
+
+// Free the block of 2^order pages at v, merging it with its
+// buddy while that is free.  Caller holds kmem.lock if use_lock.
+static void
+bfree(char *v, int order)
+{
+  uint pfn, b;
+
+  pfn = v2p(v) / PGSIZE;
+  kmem.nfree += 1 << order;
+  for(; order < KMAXORDER; order++){
+    b = pfn ^ (1 << order);
+    if(b >= NPFN || kmem.order[b] != order + 1)
+      break;
+    bremove(b);
+    pfn &= ~(1 << order);
+  }
+  binsert(pfn, order);
+}
+
+// Allocate a block of 2^order pages, splitting a larger one if
+// need be.  Caller holds kmem.lock if use_lock.
+static char*
+balloc(int order)
+{
+  uint pfn;
+  int k;
+
+  for(k = order; k <= KMAXORDER; k++)
+    if(kmem.free[k].next != &kmem.free[k])
+      break;
+  if(k > KMAXORDER)
+    return 0;
+  pfn = v2p(kmem.free[k].next) / PGSIZE;
+  bremove(pfn);
+  while(k > order){
+    k--;
+    binsert(pfn + (1 << k), k);
+  }
+  kmem.nfree -= 1 << order;
+  return p2v(pfn * PGSIZE);
+}
+
+// Lock and return this CPU's list.
+static struct kcpu*
+kcpulock(void)
+{
+  struct kcpu *c;
+
+  pushcli();
+  c = &kmem.cpu[cpu->id];
+  acquire(&c->lock);
+  popcli();
+  return c;
+}
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
+// call to kalloc(), and free it if that was the last one.
+// (The exception is when initializing the allocator; see
+// kinit above.)
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcpu *c;
+  ushort *ref;
+  int n;
 
   if((uint)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
     panic("kfree");
 
+  // Only the holder of a page's last reference can see a count
+  // of 1, so a shared page is the only case that needs the lock.
+  ref = &kmem.ref[v2p(v) / PGSIZE];
+  if(*ref > 1){
+    acquire(&kmem.lock);
+    if(*ref > 1){
+      (*ref)--;
+      release(&kmem.lock);
+      return;
+    }
+    release(&kmem.lock);
+  }
+  *ref = 0;
+
+#ifdef DEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
+  if(!kmem.use_lock){
+    bfree(v, 0);
+    return;
+  }
+  kstatinc(KS_KFREE);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  c = kcpulock();
+  r->next = c->freelist;
+  c->freelist = r;
+  c->nfree++;
+  if(c->nfree > 2*KBATCH){
+    acquire(&kmem.lock);
+    for(n = 0; n < KBATCH; n++){
+      r = c->freelist;
+      c->freelist = r->next;
+      bfree((char*)r, 0);
+    }
+    c->nfree -= KBATCH;
+    release(&kmem.lock);
+  }
+  release(&c->lock);
+}
+
+// Take a page from another CPU's list, or failing that from
+// some CPU's zeroed pages.
+static struct run*
+ksteal(void)
+{
+  struct kcpu *c;
+  struct run *r;
+
+  r = 0;
+  for(c = kmem.cpu; c < kmem.cpu + NCPU && r == 0; c++){
+    if(c->freelist == 0)
+      continue;
+    acquire(&c->lock);
+    if((r = c->freelist) != 0){
+      c->freelist = r->next;
+      c->nfree--;
+    }
+    release(&c->lock);
+  }
+  for(c = kmem.cpu; c < kmem.cpu + NCPU && r == 0; c++){
+    if(c->zero == 0)
+      continue;
+    acquire(&c->lock);
+    if((r = c->zero) != 0){
+      c->zero = r->next;
+      c->nzero--;
+    }
+    release(&c->lock);
+  }
+  return r;
+}
+
+// Take a page from this CPU's list, refilling it from the
+// global list if it is empty, or from another CPU's.
+static struct run*
+kget(void)
+{
+  struct kcpu *c;
+  struct run *r;
+  int n;
+
+  c = kcpulock();
+  if(c->freelist == 0){
+    acquire(&kmem.lock);
+    for(n = 0; n < KBATCH && (r = (struct run*)balloc(0)) != 0; n++){
+      r->next = c->freelist;
+      c->freelist = r;
+    }
+    c->nfree += n;
     release(&kmem.lock);
+  }
+  if((r = c->freelist) != 0){
+    c->freelist = r->next;
+    c->nfree--;
+  }
+  release(&c->lock);
+  if(r == 0 && (r = ksteal()) != 0)
+    kstatinc(KS_KSTEAL);
+  return r;
 }
 
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When no CPU has a free page, try to take pages back
+// from the page cache and the buffer cache, and then to page
+// out process memory (see swapout), before giving up.
 char*
 kalloc(void)
 {
   struct run *r;
 
+  if(!kmem.use_lock){
+    if((r = (struct run*)balloc(0)) != 0)
+      kmem.ref[v2p(r) / PGSIZE] = 1;
+    return (char*)r;
+  }
+  for(;;){
+    if((r = kget()) != 0){
+      kmem.ref[v2p(r) / PGSIZE] = 1;
+      kstatinc(KS_KALLOC);
+      return (char*)r;
+    }
+    kstatinc(KS_KSHRINK);
+    if(pcshrink() == 0 && bshrink() == 0 && swapout() == 0)
+      return 0;
+  }
+}
+
+// Allocate a page of zeros, from this CPU's zeroed pages if it
+// has one.
+char*
+kalloc_zeroed(void)
+{
+  struct kcpu *c;
+  struct run *r;
+  char *v;
+
+  if(kmem.use_lock){
+    c = kcpulock();
+    if((r = c->zero) != 0){
+      c->zero = r->next;
+      c->nzero--;
+    }
+    release(&c->lock);
+    if(r){
+      kmem.ref[v2p(r) / PGSIZE] = 1;
+      kstatinc(KS_KALLOC);
+      r->next = 0;  // the only word not already zero
+      return (char*)r;
+    }
+  }
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero a free page for kalloc_zeroed() if this CPU is short of
+// them and memory is not.  The scheduler calls this when it finds
+// nothing to run, with interrupts enabled.
+void
+kidle(void)
+{
+  struct kcpu *c;
+  struct run *r;
+  int n;
+
+  c = kcpulock();
+  n = c->nzero;
+  release(&c->lock);
+  if(n >= KZERO || kfreepages() < KRESERVE)
+    return;
+  if((r = kget()) == 0)
+    return;
+  memset(r, 0, PGSIZE);
+  c = kcpulock();
+  r->next = c->zero;
+  c->zero = r;
+  c->nzero++;
+  release(&c->lock);
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size.  Returns 0 if there is no such block free.
+// Such blocks cannot be shared; free them with kfreen().
+char*
+kallocn(int order)
+{
+  char *v;
+
+  if(order == 0)
+    return kalloc();
+  if(order < 0 || order > KMAXORDER)
+    return 0;
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  v = balloc(order);
   if(kmem.use_lock)
     release(&kmem.lock);
-  return (char*)r;
+  return v;
 }
 
+// Free the 2^order pages at v, which kallocn(order) returned.
+void
+kfreen(char *v, int order)
+{
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if((uint)v % (PGSIZE << order) || v < end || v2p(v) >= PHYSTOP)
+    panic("kfreen");
+#ifdef DEBUG
+  memset(v, 1, PGSIZE << order);
+#endif
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  bfree(v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Add a reference to the page at v, which kalloc() returned.
+void
+kdup(char *v)
+{
+  acquire(&kmem.lock);
+  if(kmem.ref[v2p(v) / PGSIZE] < 1)
+    panic("kdup");
+  kmem.ref[v2p(v) / PGSIZE]++;
+  release(&kmem.lock);
+}
+
+// Number of references to the page at v.
+int
+krefs(char *v)
+{
+  return kmem.ref[v2p(v) / PGSIZE];
+}
+
+// Number of free pages, for sizing caches.
+// A snapshot; takes no locks.
+int
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.nfree;
+  for(i = 0; i < NCPU; i++)
+    n += kmem.cpu[i].nfree + kmem.cpu[i].nzero;
+  return n;
+}
+
+// Report on memory for /stats/kmem: page counts, and the free
+// pages in the buddy lists and on each CPU's lists.
+void
+kmemstats(struct report *r)
+{
+  char name[16];
+  int i;
+
+  report(r, "allocs", kstatsum(KS_KALLOC));
+  report(r, "frees", kstatsum(KS_KFREE));
+  report(r, "steals", kstatsum(KS_KSTEAL));
+  report(r, "shrinks", kstatsum(KS_KSHRINK));
+  report(r, "free", kfreepages());
+  report(r, "buddyfree", kmem.nfree);
+  for(i = 0; i < ncpu; i++){
+    snprintf(name, sizeof(name), "cpu%d.free", i);
+    report(r, name, kmem.cpu[i].nfree);
+    snprintf(name, sizeof(name), "cpu%d.zeroed", i);
+    report(r, name, kmem.cpu[i].nzero);
+  }
+}
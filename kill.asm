@@ -0,0 +1,1801 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 1){
+  14:	83 3b 00             	cmpl   $0x0,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 33 0e 00 00       	push   $0xe33
+  21:	6a 02                	push   $0x2
+  23:	e8 71 07 00 00       	call   799 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 d9 02 00 00       	call   309 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 d4 02 00 00       	call   333 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 97 02 00 00       	call   309 <exit>
+
+00000072 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+    if(cc < 1)
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 84 01 00 00       	call   31e <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 44 01 00 00       	call   341 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 41 01 00 00       	call   35f <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 fd 00 00 00       	call   32c <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 2c1:	83 3d d8 11 00 00 00 	cmpl   $0x0,0x11d8
+  jg 2f
+ 2c8:	7f 2e                	jg     2f8 <dosyscall+0x37>
+  jl 1f
+ 2ca:	7c 29                	jl     2f5 <dosyscall+0x34>
+  pushl %eax
+ 2cc:	50                   	push   %eax
+  pushl %ebx
+ 2cd:	53                   	push   %ebx
+  movl $1, %eax
+ 2ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 2d3:	0f a2                	cpuid
+  popl %ebx
+ 2d5:	5b                   	pop    %ebx
+  popl %eax
+ 2d6:	58                   	pop    %eax
+  movl $-1, sysmode
+ 2d7:	c7 05 d8 11 00 00 ff 	movl   $0xffffffff,0x11d8
+ 2de:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 2e1:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 2e7:	74 0c                	je     2f5 <dosyscall+0x34>
+  movl $1, sysmode
+ 2e9:	c7 05 d8 11 00 00 01 	movl   $0x1,0x11d8
+ 2f0:	00 00 00 
+  jmp 2f
+ 2f3:	eb 03                	jmp    2f8 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 2f5:	cd 40                	int    $0x40
+  ret
+ 2f7:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 2f8:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 2fa:	ba 01 03 00 00       	mov    $0x301,%edx
+  sysenter
+ 2ff:	0f 34                	sysenter
+3:
+  ret
+ 301:	c3                   	ret
+
+00000302 <fork>:
+
+SYSCALL(fork)
+ 302:	b8 01 00 00 00       	mov    $0x1,%eax
+ 307:	eb b8                	jmp    2c1 <dosyscall>
+
+00000309 <exit>:
+SYSCALL(exit)
+ 309:	b8 02 00 00 00       	mov    $0x2,%eax
+ 30e:	eb b1                	jmp    2c1 <dosyscall>
+
+00000310 <wait>:
+SYSCALL(wait)
+ 310:	b8 03 00 00 00       	mov    $0x3,%eax
+ 315:	eb aa                	jmp    2c1 <dosyscall>
+
+00000317 <pipe>:
+SYSCALL(pipe)
+ 317:	b8 04 00 00 00       	mov    $0x4,%eax
+ 31c:	eb a3                	jmp    2c1 <dosyscall>
+
+0000031e <read>:
+SYSCALL(read)
+ 31e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 323:	eb 9c                	jmp    2c1 <dosyscall>
+
+00000325 <write>:
+SYSCALL(write)
+ 325:	b8 10 00 00 00       	mov    $0x10,%eax
+ 32a:	eb 95                	jmp    2c1 <dosyscall>
+
+0000032c <close>:
+SYSCALL(close)
+ 32c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 331:	eb 8e                	jmp    2c1 <dosyscall>
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	eb 87                	jmp    2c1 <dosyscall>
+
+0000033a <exec>:
+SYSCALL(exec)
+ 33a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 33f:	eb 80                	jmp    2c1 <dosyscall>
+
+00000341 <open>:
+SYSCALL(open)
+ 341:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 346:	e9 76 ff ff ff       	jmp    2c1 <dosyscall>
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	e9 6c ff ff ff       	jmp    2c1 <dosyscall>
+
+00000355 <unlink>:
+SYSCALL(unlink)
+ 355:	b8 12 00 00 00       	mov    $0x12,%eax
+ 35a:	e9 62 ff ff ff       	jmp    2c1 <dosyscall>
+
+0000035f <fstat>:
+SYSCALL(fstat)
+ 35f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 364:	e9 58 ff ff ff       	jmp    2c1 <dosyscall>
+
+00000369 <link>:
+SYSCALL(link)
+ 369:	b8 13 00 00 00       	mov    $0x13,%eax
+ 36e:	e9 4e ff ff ff       	jmp    2c1 <dosyscall>
+
+00000373 <mkdir>:
+SYSCALL(mkdir)
+ 373:	b8 14 00 00 00       	mov    $0x14,%eax
+ 378:	e9 44 ff ff ff       	jmp    2c1 <dosyscall>
+
+0000037d <chdir>:
+SYSCALL(chdir)
+ 37d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 382:	e9 3a ff ff ff       	jmp    2c1 <dosyscall>
+
+00000387 <dup>:
+SYSCALL(dup)
+ 387:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 38c:	e9 30 ff ff ff       	jmp    2c1 <dosyscall>
+
+00000391 <getpid>:
+SYSCALL(getpid)
+ 391:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 396:	e9 26 ff ff ff       	jmp    2c1 <dosyscall>
+
+0000039b <sbrk>:
+SYSCALL(sbrk)
+ 39b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3a0:	e9 1c ff ff ff       	jmp    2c1 <dosyscall>
+
+000003a5 <sleep>:
+SYSCALL(sleep)
+ 3a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3aa:	e9 12 ff ff ff       	jmp    2c1 <dosyscall>
+
+000003af <uptime>:
+SYSCALL(uptime)
+ 3af:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3b4:	e9 08 ff ff ff       	jmp    2c1 <dosyscall>
+
+000003b9 <symlink>:
+SYSCALL(symlink)
+ 3b9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3be:	e9 fe fe ff ff       	jmp    2c1 <dosyscall>
+
+000003c3 <readlink>:
+SYSCALL(readlink)
+ 3c3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3c8:	e9 f4 fe ff ff       	jmp    2c1 <dosyscall>
+
+000003cd <fprot>:
+SYSCALL(fprot)
+ 3cd:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d2:	e9 ea fe ff ff       	jmp    2c1 <dosyscall>
+
+000003d7 <funprot>:
+SYSCALL(funprot)
+ 3d7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3dc:	e9 e0 fe ff ff       	jmp    2c1 <dosyscall>
+
+000003e1 <funlock>:
+SYSCALL(funlock)
+ 3e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e6:	e9 d6 fe ff ff       	jmp    2c1 <dosyscall>
+
+000003eb <mmap>:
+SYSCALL(mmap)
+ 3eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f0:	e9 cc fe ff ff       	jmp    2c1 <dosyscall>
+
+000003f5 <munmap>:
+SYSCALL(munmap)
+ 3f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3fa:	e9 c2 fe ff ff       	jmp    2c1 <dosyscall>
+
+000003ff <sendfile>:
+SYSCALL(sendfile)
+ 3ff:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 404:	e9 b8 fe ff ff       	jmp    2c1 <dosyscall>
+
+00000409 <readv>:
+SYSCALL(readv)
+ 409:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 40e:	e9 ae fe ff ff       	jmp    2c1 <dosyscall>
+
+00000413 <writev>:
+SYSCALL(writev)
+ 413:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 418:	e9 a4 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000041d <pread>:
+SYSCALL(pread)
+ 41d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 422:	e9 9a fe ff ff       	jmp    2c1 <dosyscall>
+
+00000427 <pwrite>:
+SYSCALL(pwrite)
+ 427:	b8 21 00 00 00       	mov    $0x21,%eax
+ 42c:	e9 90 fe ff ff       	jmp    2c1 <dosyscall>
+
+00000431 <lseek>:
+SYSCALL(lseek)
+ 431:	b8 22 00 00 00       	mov    $0x22,%eax
+ 436:	e9 86 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000043b <spawn>:
+SYSCALL(spawn)
+ 43b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 440:	e9 7c fe ff ff       	jmp    2c1 <dosyscall>
+
+00000445 <setpriority>:
+SYSCALL(setpriority)
+ 445:	b8 24 00 00 00       	mov    $0x24,%eax
+ 44a:	e9 72 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000044f <kthread_create>:
+SYSCALL(kthread_create)
+ 44f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 454:	e9 68 fe ff ff       	jmp    2c1 <dosyscall>
+
+00000459 <kthread_id>:
+SYSCALL(kthread_id)
+ 459:	b8 26 00 00 00       	mov    $0x26,%eax
+ 45e:	e9 5e fe ff ff       	jmp    2c1 <dosyscall>
+
+00000463 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 463:	b8 27 00 00 00       	mov    $0x27,%eax
+ 468:	e9 54 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000046d <kthread_join>:
+SYSCALL(kthread_join)
+ 46d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 472:	e9 4a fe ff ff       	jmp    2c1 <dosyscall>
+
+00000477 <futex>:
+SYSCALL(futex)
+ 477:	b8 29 00 00 00       	mov    $0x29,%eax
+ 47c:	e9 40 fe ff ff       	jmp    2c1 <dosyscall>
+
+00000481 <signal>:
+SYSCALL(signal)
+ 481:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 486:	e9 36 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000048b <alarm>:
+SYSCALL(alarm)
+ 48b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 490:	e9 2c fe ff ff       	jmp    2c1 <dosyscall>
+
+00000495 <usleep>:
+SYSCALL(usleep)
+ 495:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 49a:	e9 22 fe ff ff       	jmp    2c1 <dosyscall>
+
+0000049f <ioring_setup>:
+SYSCALL(ioring_setup)
+ 49f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4a4:	e9 18 fe ff ff       	jmp    2c1 <dosyscall>
+
+000004a9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4a9:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4ae:	e9 0e fe ff ff       	jmp    2c1 <dosyscall>
+
+000004b3 <getrusage>:
+SYSCALL(getrusage)
+ 4b3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4b8:	e9 04 fe ff ff       	jmp    2c1 <dosyscall>
+
+000004bd <mount>:
+SYSCALL(mount)
+ 4bd:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4c2:	e9 fa fd ff ff       	jmp    2c1 <dosyscall>
+
+000004c7 <getdents>:
+SYSCALL(getdents)
+ 4c7:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4cc:	e9 f0 fd ff ff       	jmp    2c1 <dosyscall>
+
+000004d1 <yield>:
+SYSCALL(yield)
+ 4d1:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4d6:	e9 e6 fd ff ff       	jmp    2c1 <dosyscall>
+
+000004db <ncpu>:
+SYSCALL(ncpu)
+ 4db:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4e0:	e9 dc fd ff ff       	jmp    2c1 <dosyscall>
+
+000004e5 <fallocate>:
+SYSCALL(fallocate)
+ 4e5:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4ea:	e9 d2 fd ff ff       	jmp    2c1 <dosyscall>
+
+000004ef <ftruncate>:
+SYSCALL(ftruncate)
+ 4ef:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4f4:	e9 c8 fd ff ff       	jmp    2c1 <dosyscall>
+
+000004f9 <fsync>:
+SYSCALL(fsync)
+ 4f9:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4fe:	e9 be fd ff ff       	jmp    2c1 <dosyscall>
+
+00000503 <fdatasync>:
+SYSCALL(fdatasync)
+ 503:	b8 37 00 00 00       	mov    $0x37,%eax
+ 508:	e9 b4 fd ff ff       	jmp    2c1 <dosyscall>
+
+0000050d <poll>:
+SYSCALL(poll)
+ 50d:	b8 38 00 00 00       	mov    $0x38,%eax
+ 512:	e9 aa fd ff ff       	jmp    2c1 <dosyscall>
+
+00000517 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 517:	55                   	push   %ebp
+ 518:	89 e5                	mov    %esp,%ebp
+ 51a:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 51d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 520:	8b 40 04             	mov    0x4(%eax),%eax
+ 523:	85 c0                	test   %eax,%eax
+ 525:	7e 1f                	jle    546 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 527:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52a:	8b 50 04             	mov    0x4(%eax),%edx
+ 52d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 530:	8d 48 08             	lea    0x8(%eax),%ecx
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	8b 00                	mov    (%eax),%eax
+ 538:	83 ec 04             	sub    $0x4,%esp
+ 53b:	52                   	push   %edx
+ 53c:	51                   	push   %ecx
+ 53d:	50                   	push   %eax
+ 53e:	e8 d0 fe ff ff       	call   413 <writev>
+ 543:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 546:	8b 45 08             	mov    0x8(%ebp),%eax
+ 549:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 550:	8b 45 08             	mov    0x8(%ebp),%eax
+ 553:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 55a:	00 00 00 
+}
+ 55d:	90                   	nop
+ 55e:	c9                   	leave
+ 55f:	c3                   	ret
+
+00000560 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 566:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 56a:	0f 84 94 00 00 00    	je     604 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 570:	8b 45 08             	mov    0x8(%ebp),%eax
+ 573:	8b 40 04             	mov    0x4(%eax),%eax
+ 576:	85 c0                	test   %eax,%eax
+ 578:	7e 40                	jle    5ba <put+0x5a>
+    v = &o->iov[o->n-1];
+ 57a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57d:	8b 40 04             	mov    0x4(%eax),%eax
+ 580:	83 e8 01             	sub    $0x1,%eax
+ 583:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	01 d0                	add    %edx,%eax
+ 58f:	83 c0 08             	add    $0x8,%eax
+ 592:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 598:	8b 10                	mov    (%eax),%edx
+ 59a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59d:	8b 40 04             	mov    0x4(%eax),%eax
+ 5a0:	01 d0                	add    %edx,%eax
+ 5a2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 5a5:	75 13                	jne    5ba <put+0x5a>
+      v->iov_len += n;
+ 5a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5aa:	8b 50 04             	mov    0x4(%eax),%edx
+ 5ad:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b0:	01 c2                	add    %eax,%edx
+ 5b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b5:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 5b8:	eb 4b                	jmp    605 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 5ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 5c0:	83 f8 10             	cmp    $0x10,%eax
+ 5c3:	75 0e                	jne    5d3 <put+0x73>
+    flush(o);
+ 5c5:	83 ec 0c             	sub    $0xc,%esp
+ 5c8:	ff 75 08             	push   0x8(%ebp)
+ 5cb:	e8 47 ff ff ff       	call   517 <flush>
+ 5d0:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	8b 50 04             	mov    0x4(%eax),%edx
+ 5d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 5df:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	8b 50 04             	mov    0x4(%eax),%edx
+ 5e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ef:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	8b 40 04             	mov    0x4(%eax),%eax
+ 5f9:	8d 50 01             	lea    0x1(%eax),%edx
+ 5fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ff:	89 50 04             	mov    %edx,0x4(%eax)
+ 602:	eb 01                	jmp    605 <put+0xa5>
+    return;
+ 604:	90                   	nop
+}
+ 605:	c9                   	leave
+ 606:	c3                   	ret
+
+00000607 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 607:	55                   	push   %ebp
+ 608:	89 e5                	mov    %esp,%ebp
+ 60a:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 60d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 610:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 616:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 619:	01 d0                	add    %edx,%eax
+ 61b:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 620:	77 0b                	ja     62d <room+0x26>
+ 622:	8b 45 08             	mov    0x8(%ebp),%eax
+ 625:	8b 40 04             	mov    0x4(%eax),%eax
+ 628:	83 f8 10             	cmp    $0x10,%eax
+ 62b:	75 0e                	jne    63b <room+0x34>
+    flush(o);
+ 62d:	83 ec 0c             	sub    $0xc,%esp
+ 630:	ff 75 08             	push   0x8(%ebp)
+ 633:	e8 df fe ff ff       	call   517 <flush>
+ 638:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 63b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63e:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 644:	8b 45 08             	mov    0x8(%ebp),%eax
+ 647:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 64d:	01 d0                	add    %edx,%eax
+}
+ 64f:	c9                   	leave
+ 650:	c3                   	ret
+
+00000651 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 651:	55                   	push   %ebp
+ 652:	89 e5                	mov    %esp,%ebp
+ 654:	83 ec 28             	sub    $0x28,%esp
+ 657:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 65a:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 65d:	83 ec 08             	sub    $0x8,%esp
+ 660:	6a 01                	push   $0x1
+ 662:	ff 75 08             	push   0x8(%ebp)
+ 665:	e8 9d ff ff ff       	call   607 <room>
+ 66a:	83 c4 10             	add    $0x10,%esp
+ 66d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 673:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 677:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 679:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 682:	8d 50 01             	lea    0x1(%eax),%edx
+ 685:	8b 45 08             	mov    0x8(%ebp),%eax
+ 688:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 68e:	83 ec 04             	sub    $0x4,%esp
+ 691:	6a 01                	push   $0x1
+ 693:	ff 75 f4             	push   -0xc(%ebp)
+ 696:	ff 75 08             	push   0x8(%ebp)
+ 699:	e8 c2 fe ff ff       	call   560 <put>
+ 69e:	83 c4 10             	add    $0x10,%esp
+}
+ 6a1:	90                   	nop
+ 6a2:	c9                   	leave
+ 6a3:	c3                   	ret
+
+000006a4 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 6a4:	55                   	push   %ebp
+ 6a5:	89 e5                	mov    %esp,%ebp
+ 6a7:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 6aa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6b1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6b5:	74 17                	je     6ce <printint+0x2a>
+ 6b7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6bb:	79 11                	jns    6ce <printint+0x2a>
+    neg = 1;
+ 6bd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c7:	f7 d8                	neg    %eax
+ 6c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6cc:	eb 06                	jmp    6d4 <printint+0x30>
+  } else {
+    x = xx;
+ 6ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6d4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6e1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6e6:	f7 f1                	div    %ecx
+ 6e8:	89 d1                	mov    %edx,%ecx
+ 6ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ed:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6f3:	0f b6 91 dc 11 00 00 	movzbl 0x11dc(%ecx),%edx
+ 6fa:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 701:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 704:	ba 00 00 00 00       	mov    $0x0,%edx
+ 709:	f7 f1                	div    %ecx
+ 70b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 70e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 712:	75 c7                	jne    6db <printint+0x37>
+  if(neg)
+ 714:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 718:	74 0e                	je     728 <printint+0x84>
+    buf[i++] = '-';
+ 71a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71d:	8d 50 01             	lea    0x1(%eax),%edx
+ 720:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 723:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 72e:	83 ec 08             	sub    $0x8,%esp
+ 731:	ff 75 e8             	push   -0x18(%ebp)
+ 734:	ff 75 08             	push   0x8(%ebp)
+ 737:	e8 cb fe ff ff       	call   607 <room>
+ 73c:	83 c4 10             	add    $0x10,%esp
+ 73f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 742:	eb 1d                	jmp    761 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 744:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 747:	83 e8 01             	sub    $0x1,%eax
+ 74a:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 74d:	89 c2                	mov    %eax,%edx
+ 74f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 752:	01 c2                	add    %eax,%edx
+ 754:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 757:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75a:	01 c8                	add    %ecx,%eax
+ 75c:	0f b6 00             	movzbl (%eax),%eax
+ 75f:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 761:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 765:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 769:	79 d9                	jns    744 <printint+0xa0>
+  o->used += n;
+ 76b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76e:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 774:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 777:	01 c2                	add    %eax,%edx
+ 779:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77c:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 782:	83 ec 04             	sub    $0x4,%esp
+ 785:	ff 75 e8             	push   -0x18(%ebp)
+ 788:	ff 75 e4             	push   -0x1c(%ebp)
+ 78b:	ff 75 08             	push   0x8(%ebp)
+ 78e:	e8 cd fd ff ff       	call   560 <put>
+ 793:	83 c4 10             	add    $0x10,%esp
+}
+ 796:	90                   	nop
+ 797:	c9                   	leave
+ 798:	c3                   	ret
+
+00000799 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 799:	55                   	push   %ebp
+ 79a:	89 e5                	mov    %esp,%ebp
+ 79c:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 7a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a5:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 7ab:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 7b2:	00 00 00 
+  o.used = 0;
+ 7b5:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 7bc:	00 00 00 
+  state = 0;
+ 7bf:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7c6:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7c9:	83 c0 04             	add    $0x4,%eax
+ 7cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 7cf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7d6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7dd:	e9 82 01 00 00       	jmp    964 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 7e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e8:	01 d0                	add    %edx,%eax
+ 7ea:	0f b6 00             	movzbl (%eax),%eax
+ 7ed:	0f be c0             	movsbl %al,%eax
+ 7f0:	25 ff 00 00 00       	and    $0xff,%eax
+ 7f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 7f8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 7fc:	75 38                	jne    836 <printf+0x9d>
+      if(c == '%'){
+ 7fe:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 802:	0f 85 58 01 00 00    	jne    960 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 808:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 80b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 80e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 811:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 814:	01 ca                	add    %ecx,%edx
+ 816:	83 ec 04             	sub    $0x4,%esp
+ 819:	50                   	push   %eax
+ 81a:	52                   	push   %edx
+ 81b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 821:	50                   	push   %eax
+ 822:	e8 39 fd ff ff       	call   560 <put>
+ 827:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 82a:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 831:	e9 2a 01 00 00       	jmp    960 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 836:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 83a:	0f 85 20 01 00 00    	jne    960 <printf+0x1c7>
+      if(c == 'd'){
+ 840:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 844:	75 22                	jne    868 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 846:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 849:	8b 00                	mov    (%eax),%eax
+ 84b:	6a 01                	push   $0x1
+ 84d:	6a 0a                	push   $0xa
+ 84f:	50                   	push   %eax
+ 850:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 856:	50                   	push   %eax
+ 857:	e8 48 fe ff ff       	call   6a4 <printint>
+ 85c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 85f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 863:	e9 e8 00 00 00       	jmp    950 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 868:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 86c:	74 06                	je     874 <printf+0xdb>
+ 86e:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 872:	75 22                	jne    896 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 874:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 877:	8b 00                	mov    (%eax),%eax
+ 879:	6a 00                	push   $0x0
+ 87b:	6a 10                	push   $0x10
+ 87d:	50                   	push   %eax
+ 87e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 884:	50                   	push   %eax
+ 885:	e8 1a fe ff ff       	call   6a4 <printint>
+ 88a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 88d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 891:	e9 ba 00 00 00       	jmp    950 <printf+0x1b7>
+      } else if(c == 's'){
+ 896:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 89a:	75 3f                	jne    8db <printf+0x142>
+        s = (char*)*ap;
+ 89c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 89f:	8b 00                	mov    (%eax),%eax
+ 8a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8a4:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 8a8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ac:	75 07                	jne    8b5 <printf+0x11c>
+          s = "(null)";
+ 8ae:	c7 45 f4 47 0e 00 00 	movl   $0xe47,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 8b5:	83 ec 0c             	sub    $0xc,%esp
+ 8b8:	ff 75 f4             	push   -0xc(%ebp)
+ 8bb:	e8 47 f8 ff ff       	call   107 <strlen>
+ 8c0:	83 c4 10             	add    $0x10,%esp
+ 8c3:	83 ec 04             	sub    $0x4,%esp
+ 8c6:	50                   	push   %eax
+ 8c7:	ff 75 f4             	push   -0xc(%ebp)
+ 8ca:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8d0:	50                   	push   %eax
+ 8d1:	e8 8a fc ff ff       	call   560 <put>
+ 8d6:	83 c4 10             	add    $0x10,%esp
+ 8d9:	eb 75                	jmp    950 <printf+0x1b7>
+      } else if(c == 'c'){
+ 8db:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 8df:	75 21                	jne    902 <printf+0x169>
+        putc(&o, *ap);
+ 8e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e4:	8b 00                	mov    (%eax),%eax
+ 8e6:	0f be c0             	movsbl %al,%eax
+ 8e9:	83 ec 08             	sub    $0x8,%esp
+ 8ec:	50                   	push   %eax
+ 8ed:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8f3:	50                   	push   %eax
+ 8f4:	e8 58 fd ff ff       	call   651 <putc>
+ 8f9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8fc:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 900:	eb 4e                	jmp    950 <printf+0x1b7>
+      } else if(c == '%'){
+ 902:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 906:	75 1b                	jne    923 <printf+0x18a>
+        putc(&o, c);
+ 908:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 90b:	0f be c0             	movsbl %al,%eax
+ 90e:	83 ec 08             	sub    $0x8,%esp
+ 911:	50                   	push   %eax
+ 912:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 918:	50                   	push   %eax
+ 919:	e8 33 fd ff ff       	call   651 <putc>
+ 91e:	83 c4 10             	add    $0x10,%esp
+ 921:	eb 2d                	jmp    950 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 923:	83 ec 08             	sub    $0x8,%esp
+ 926:	6a 25                	push   $0x25
+ 928:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 92e:	50                   	push   %eax
+ 92f:	e8 1d fd ff ff       	call   651 <putc>
+ 934:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 937:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 93a:	0f be c0             	movsbl %al,%eax
+ 93d:	83 ec 08             	sub    $0x8,%esp
+ 940:	50                   	push   %eax
+ 941:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 947:	50                   	push   %eax
+ 948:	e8 04 fd ff ff       	call   651 <putc>
+ 94d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 950:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 957:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95a:	83 c0 01             	add    $0x1,%eax
+ 95d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 960:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 964:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 967:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96a:	01 d0                	add    %edx,%eax
+ 96c:	0f b6 00             	movzbl (%eax),%eax
+ 96f:	84 c0                	test   %al,%al
+ 971:	0f 85 6b fe ff ff    	jne    7e2 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 977:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 97b:	75 22                	jne    99f <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 97d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 980:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 983:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 986:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 989:	01 ca                	add    %ecx,%edx
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	50                   	push   %eax
+ 98f:	52                   	push   %edx
+ 990:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 996:	50                   	push   %eax
+ 997:	e8 c4 fb ff ff       	call   560 <put>
+ 99c:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 99f:	83 ec 0c             	sub    $0xc,%esp
+ 9a2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9a8:	50                   	push   %eax
+ 9a9:	e8 69 fb ff ff       	call   517 <flush>
+ 9ae:	83 c4 10             	add    $0x10,%esp
+}
+ 9b1:	90                   	nop
+ 9b2:	c9                   	leave
+ 9b3:	c3                   	ret
+
+000009b4 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 9b4:	55                   	push   %ebp
+ 9b5:	89 e5                	mov    %esp,%ebp
+ 9b7:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 9ba:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 9c3:	f0 87 02             	lock xchg %eax,(%edx)
+ 9c6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ 9c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ 9cc:	c9                   	leave
+ 9cd:	c3                   	ret
+
+000009ce <lock>:
+{
+ 9ce:	55                   	push   %ebp
+ 9cf:	89 e5                	mov    %esp,%ebp
+ 9d1:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ 9d4:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ 9d9:	85 c0                	test   %eax,%eax
+ 9db:	74 09                	je     9e6 <lock+0x18>
+ 9dd:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ 9e2:	ff d0                	call   *%eax
+ 9e4:	eb 05                	jmp    9eb <lock+0x1d>
+ 9e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ 9ee:	90                   	nop
+ 9ef:	83 ec 08             	sub    $0x8,%esp
+ 9f2:	6a 01                	push   $0x1
+ 9f4:	68 28 12 00 00       	push   $0x1228
+ 9f9:	e8 b6 ff ff ff       	call   9b4 <xchg>
+ 9fe:	83 c4 10             	add    $0x10,%esp
+ a01:	85 c0                	test   %eax,%eax
+ a03:	75 ea                	jne    9ef <lock+0x21>
+  return pin;
+ a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a08:	c9                   	leave
+ a09:	c3                   	ret
+
+00000a0a <unlock>:
+{
+ a0a:	55                   	push   %ebp
+ a0b:	89 e5                	mov    %esp,%ebp
+ a0d:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a10:	6a 00                	push   $0x0
+ a12:	68 28 12 00 00       	push   $0x1228
+ a17:	e8 98 ff ff ff       	call   9b4 <xchg>
+ a1c:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a1f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a23:	78 10                	js     a35 <unlock+0x2b>
+    mallocunpin(pin);
+ a25:	a1 f4 11 00 00       	mov    0x11f4,%eax
+ a2a:	83 ec 0c             	sub    $0xc,%esp
+ a2d:	ff 75 08             	push   0x8(%ebp)
+ a30:	ff d0                	call   *%eax
+ a32:	83 c4 10             	add    $0x10,%esp
+}
+ a35:	90                   	nop
+ a36:	c9                   	leave
+ a37:	c3                   	ret
+
+00000a38 <sizeclass>:
+{
+ a38:	55                   	push   %ebp
+ a39:	89 e5                	mov    %esp,%ebp
+ a3b:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ a3e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ a45:	eb 1c                	jmp    a63 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4a:	ba 02 00 00 00       	mov    $0x2,%edx
+ a4f:	89 c1                	mov    %eax,%ecx
+ a51:	d3 e2                	shl    %cl,%edx
+ a53:	89 d0                	mov    %edx,%eax
+ a55:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a58:	72 05                	jb     a5f <sizeclass+0x27>
+      return c;
+ a5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5d:	eb 0f                	jmp    a6e <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a5f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a63:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ a67:	7e de                	jle    a47 <sizeclass+0xf>
+  return -1;
+ a69:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ a6e:	c9                   	leave
+ a6f:	c3                   	ret
+
+00000a70 <bigfree>:
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a76:	a1 00 12 00 00       	mov    0x1200,%eax
+ a7b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a7e:	eb 24                	jmp    aa4 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a83:	8b 00                	mov    (%eax),%eax
+ a85:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a88:	72 12                	jb     a9c <bigfree+0x2c>
+ a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a90:	72 24                	jb     ab6 <bigfree+0x46>
+ a92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a95:	8b 00                	mov    (%eax),%eax
+ a97:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a9a:	72 1a                	jb     ab6 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9f:	8b 00                	mov    (%eax),%eax
+ aa1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aaa:	73 d4                	jae    a80 <bigfree+0x10>
+ aac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aaf:	8b 00                	mov    (%eax),%eax
+ ab1:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ab4:	73 ca                	jae    a80 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab9:	8b 40 04             	mov    0x4(%eax),%eax
+ abc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac6:	01 c2                	add    %eax,%edx
+ ac8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acb:	8b 00                	mov    (%eax),%eax
+ acd:	39 c2                	cmp    %eax,%edx
+ acf:	75 24                	jne    af5 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad4:	8b 50 04             	mov    0x4(%eax),%edx
+ ad7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ada:	8b 00                	mov    (%eax),%eax
+ adc:	8b 40 04             	mov    0x4(%eax),%eax
+ adf:	01 c2                	add    %eax,%edx
+ ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae4:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aea:	8b 00                	mov    (%eax),%eax
+ aec:	8b 10                	mov    (%eax),%edx
+ aee:	8b 45 08             	mov    0x8(%ebp),%eax
+ af1:	89 10                	mov    %edx,(%eax)
+ af3:	eb 0a                	jmp    aff <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ af5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af8:	8b 10                	mov    (%eax),%edx
+ afa:	8b 45 08             	mov    0x8(%ebp),%eax
+ afd:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ aff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b02:	8b 40 04             	mov    0x4(%eax),%eax
+ b05:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0f:	01 d0                	add    %edx,%eax
+ b11:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b14:	75 20                	jne    b36 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b16:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b19:	8b 50 04             	mov    0x4(%eax),%edx
+ b1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1f:	8b 40 04             	mov    0x4(%eax),%eax
+ b22:	01 c2                	add    %eax,%edx
+ b24:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b27:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2d:	8b 10                	mov    (%eax),%edx
+ b2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b32:	89 10                	mov    %edx,(%eax)
+ b34:	eb 08                	jmp    b3e <bigfree+0xce>
+    p->s.ptr = bp;
+ b36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b39:	8b 55 08             	mov    0x8(%ebp),%edx
+ b3c:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b41:	a3 00 12 00 00       	mov    %eax,0x1200
+}
+ b46:	90                   	nop
+ b47:	c9                   	leave
+ b48:	c3                   	ret
+
+00000b49 <free>:
+{
+ b49:	55                   	push   %ebp
+ b4a:	89 e5                	mov    %esp,%ebp
+ b4c:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b4f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b53:	74 68                	je     bbd <free+0x74>
+  bp = (Header*)ap - 1;
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	83 e8 08             	sub    $0x8,%eax
+ b5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b5e:	e8 6b fe ff ff       	call   9ce <lock>
+ b63:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ b66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b69:	8b 40 04             	mov    0x4(%eax),%eax
+ b6c:	83 ec 0c             	sub    $0xc,%esp
+ b6f:	50                   	push   %eax
+ b70:	e8 c3 fe ff ff       	call   a38 <sizeclass>
+ b75:	83 c4 10             	add    $0x10,%esp
+ b78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b7b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b7f:	78 1e                	js     b9f <free+0x56>
+    bp->s.ptr = classfree[c];
+ b81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b84:	8b 14 85 04 12 00 00 	mov    0x1204(,%eax,4),%edx
+ b8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8e:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ b90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b96:	89 14 85 04 12 00 00 	mov    %edx,0x1204(,%eax,4)
+ b9d:	eb 0e                	jmp    bad <free+0x64>
+    bigfree(bp);
+ b9f:	83 ec 0c             	sub    $0xc,%esp
+ ba2:	ff 75 f4             	push   -0xc(%ebp)
+ ba5:	e8 c6 fe ff ff       	call   a70 <bigfree>
+ baa:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ bad:	83 ec 0c             	sub    $0xc,%esp
+ bb0:	ff 75 f0             	push   -0x10(%ebp)
+ bb3:	e8 52 fe ff ff       	call   a0a <unlock>
+ bb8:	83 c4 10             	add    $0x10,%esp
+ bbb:	eb 01                	jmp    bbe <free+0x75>
+    return;
+ bbd:	90                   	nop
+}
+ bbe:	c9                   	leave
+ bbf:	c3                   	ret
+
+00000bc0 <morecore>:
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ bc6:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bcd:	77 07                	ja     bd6 <morecore+0x16>
+    nu = 4096;
+ bcf:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd9:	c1 e0 03             	shl    $0x3,%eax
+ bdc:	83 ec 0c             	sub    $0xc,%esp
+ bdf:	50                   	push   %eax
+ be0:	e8 b6 f7 ff ff       	call   39b <sbrk>
+ be5:	83 c4 10             	add    $0x10,%esp
+ be8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ beb:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bef:	75 07                	jne    bf8 <morecore+0x38>
+    return 0;
+ bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf6:	eb 22                	jmp    c1a <morecore+0x5a>
+  hp = (Header*)p;
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ bfe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c01:	8b 55 08             	mov    0x8(%ebp),%edx
+ c04:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ c07:	83 ec 0c             	sub    $0xc,%esp
+ c0a:	ff 75 f0             	push   -0x10(%ebp)
+ c0d:	e8 5e fe ff ff       	call   a70 <bigfree>
+ c12:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c15:	a1 00 12 00 00       	mov    0x1200,%eax
+}
+ c1a:	c9                   	leave
+ c1b:	c3                   	ret
+
+00000c1c <bigalloc>:
+{
+ c1c:	55                   	push   %ebp
+ c1d:	89 e5                	mov    %esp,%ebp
+ c1f:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c22:	a1 00 12 00 00       	mov    0x1200,%eax
+ c27:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c2a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c2e:	75 23                	jne    c53 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c30:	c7 45 f0 f8 11 00 00 	movl   $0x11f8,-0x10(%ebp)
+ c37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c3a:	a3 00 12 00 00       	mov    %eax,0x1200
+ c3f:	a1 00 12 00 00       	mov    0x1200,%eax
+ c44:	a3 f8 11 00 00       	mov    %eax,0x11f8
+    base.s.size = 0;
+ c49:	c7 05 fc 11 00 00 00 	movl   $0x0,0x11fc
+ c50:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c56:	8b 00                	mov    (%eax),%eax
+ c58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5e:	8b 40 04             	mov    0x4(%eax),%eax
+ c61:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c64:	72 4a                	jb     cb0 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ c66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c69:	8b 40 04             	mov    0x4(%eax),%eax
+ c6c:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c6f:	75 0c                	jne    c7d <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ c71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c74:	8b 10                	mov    (%eax),%edx
+ c76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c79:	89 10                	mov    %edx,(%eax)
+ c7b:	eb 26                	jmp    ca3 <bigalloc+0x87>
+        p->s.size -= nunits;
+ c7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c80:	8b 40 04             	mov    0x4(%eax),%eax
+ c83:	2b 45 08             	sub    0x8(%ebp),%eax
+ c86:	89 c2                	mov    %eax,%edx
+ c88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c91:	8b 40 04             	mov    0x4(%eax),%eax
+ c94:	c1 e0 03             	shl    $0x3,%eax
+ c97:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+ ca0:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ ca3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca6:	a3 00 12 00 00       	mov    %eax,0x1200
+      return p;
+ cab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cae:	eb 3b                	jmp    ceb <bigalloc+0xcf>
+    if(p == freep)
+ cb0:	a1 00 12 00 00       	mov    0x1200,%eax
+ cb5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cb8:	75 1e                	jne    cd8 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ cba:	83 ec 0c             	sub    $0xc,%esp
+ cbd:	ff 75 08             	push   0x8(%ebp)
+ cc0:	e8 fb fe ff ff       	call   bc0 <morecore>
+ cc5:	83 c4 10             	add    $0x10,%esp
+ cc8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ccb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ccf:	75 07                	jne    cd8 <bigalloc+0xbc>
+        return 0;
+ cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+ cd6:	eb 13                	jmp    ceb <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce1:	8b 00                	mov    (%eax),%eax
+ ce3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ce6:	e9 70 ff ff ff       	jmp    c5b <bigalloc+0x3f>
+}
+ ceb:	c9                   	leave
+ cec:	c3                   	ret
+
+00000ced <alloc>:
+alloc(uint nbytes)
+{
+ ced:	55                   	push   %ebp
+ cee:	89 e5                	mov    %esp,%ebp
+ cf0:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf6:	83 c0 07             	add    $0x7,%eax
+ cf9:	c1 e8 03             	shr    $0x3,%eax
+ cfc:	83 c0 01             	add    $0x1,%eax
+ cff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d02:	ff 75 f4             	push   -0xc(%ebp)
+ d05:	e8 2e fd ff ff       	call   a38 <sizeclass>
+ d0a:	83 c4 04             	add    $0x4,%esp
+ d0d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d10:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d14:	79 2c                	jns    d42 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d16:	83 ec 0c             	sub    $0xc,%esp
+ d19:	ff 75 f4             	push   -0xc(%ebp)
+ d1c:	e8 fb fe ff ff       	call   c1c <bigalloc>
+ d21:	83 c4 10             	add    $0x10,%esp
+ d24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d27:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d2b:	75 0a                	jne    d37 <alloc+0x4a>
+      return 0;
+ d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+ d32:	e9 c8 00 00 00       	jmp    dff <alloc+0x112>
+    return (void*)(p + 1);
+ d37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d3a:	83 c0 08             	add    $0x8,%eax
+ d3d:	e9 bd 00 00 00       	jmp    dff <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ d42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d45:	8b 04 85 04 12 00 00 	mov    0x1204(,%eax,4),%eax
+ d4c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d4f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d53:	74 1a                	je     d6f <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d55:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d58:	8b 10                	mov    (%eax),%edx
+ d5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d5d:	89 14 85 04 12 00 00 	mov    %edx,0x1204(,%eax,4)
+    return (void*)(p + 1);
+ d64:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d67:	83 c0 08             	add    $0x8,%eax
+ d6a:	e9 90 00 00 00       	jmp    dff <alloc+0x112>
+  }
+  nunits = 2 << c;
+ d6f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d72:	ba 02 00 00 00       	mov    $0x2,%edx
+ d77:	89 c1                	mov    %eax,%ecx
+ d79:	d3 e2                	shl    %cl,%edx
+ d7b:	89 d0                	mov    %edx,%eax
+ d7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ d80:	a1 20 12 00 00       	mov    0x1220,%eax
+ d85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d88:	c1 e2 03             	shl    $0x3,%edx
+ d8b:	01 d0                	add    %edx,%eax
+ d8d:	8b 15 24 12 00 00    	mov    0x1224,%edx
+ d93:	39 c2                	cmp    %eax,%edx
+ d95:	73 3f                	jae    dd6 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ d97:	83 ec 0c             	sub    $0xc,%esp
+ d9a:	68 00 08 00 00       	push   $0x800
+ d9f:	e8 78 fe ff ff       	call   c1c <bigalloc>
+ da4:	83 c4 10             	add    $0x10,%esp
+ da7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ daa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dae:	75 07                	jne    db7 <alloc+0xca>
+      return 0;
+ db0:	b8 00 00 00 00       	mov    $0x0,%eax
+ db5:	eb 48                	jmp    dff <alloc+0x112>
+    bump = (char*)p;
+ db7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dba:	a3 20 12 00 00       	mov    %eax,0x1220
+    bumpend = (char*)(p + p->s.size);
+ dbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dc2:	8b 40 04             	mov    0x4(%eax),%eax
+ dc5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ dcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dcf:	01 d0                	add    %edx,%eax
+ dd1:	a3 24 12 00 00       	mov    %eax,0x1224
+  }
+  p = (Header*)bump;
+ dd6:	a1 20 12 00 00       	mov    0x1220,%eax
+ ddb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ dde:	a1 20 12 00 00       	mov    0x1220,%eax
+ de3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ de6:	c1 e2 03             	shl    $0x3,%edx
+ de9:	01 d0                	add    %edx,%eax
+ deb:	a3 20 12 00 00       	mov    %eax,0x1220
+  p->s.size = nunits;
+ df0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ df3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ df6:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ df9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dfc:	83 c0 08             	add    $0x8,%eax
+}
+ dff:	c9                   	leave
+ e00:	c3                   	ret
+
+00000e01 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e01:	55                   	push   %ebp
+ e02:	89 e5                	mov    %esp,%ebp
+ e04:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ e07:	e8 c2 fb ff ff       	call   9ce <lock>
+ e0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e0f:	83 ec 0c             	sub    $0xc,%esp
+ e12:	ff 75 08             	push   0x8(%ebp)
+ e15:	e8 d3 fe ff ff       	call   ced <alloc>
+ e1a:	83 c4 10             	add    $0x10,%esp
+ e1d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e20:	83 ec 0c             	sub    $0xc,%esp
+ e23:	ff 75 f4             	push   -0xc(%ebp)
+ e26:	e8 df fb ff ff       	call   a0a <unlock>
+ e2b:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e31:	c9                   	leave
+ e32:	c3                   	ret
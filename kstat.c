@@ -0,0 +1,116 @@
+// Kernel statistics.
+//
+// Hot paths count events with kstatinc(), into counters of their
+// own CPU, so that counting takes no lock and CPUs do not fight
+// over the counters.  Reading a file under /stats (major KSTAT, one
+// minor per file) sums them over the CPUs, with each subsystem's
+// current sizes and queue lengths, as lines of "name value".  The
+// sums are snapshots: counters keep moving while they are read.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "fs.h"
+#include "file.h"
+#include "kstat.h"
+
+// A CPU's counters, on lines of their own.
+static struct {
+  uint n[NKSTAT];
+} __attribute__((aligned(CACHELINE))) kstats[NCPU];
+
+static struct {
+  char *name;
+  void (*fn)(struct report*);
+} files[] = {
+  { "bcache", bstats },
+  { "icache", istats },
+  { "kmem",   kmemstats },
+  { "log",    logstats },
+  { "ide",    idestats },
+  { "sched",  schedstats },
+  { "swap",   swapstats },
+};
+
+// Count one event of kind k on this CPU.
+void
+kstatinc(int k)
+{
+  kstatadd(k, 1);
+}
+
+void
+kstatadd(int k, uint n)
+{
+  // Interrupts off, so that we stay on this CPU meanwhile.
+  pushcli();
+  kstats[cpu->id].n[k] += n;
+  popcli();
+}
+
+// The count of events of kind k on CPU c.
+uint
+kstatcpu(int c, int k)
+{
+  return kstats[c].n[k];
+}
+
+// The count of events of kind k on all CPUs.
+uint
+kstatsum(int k)
+{
+  uint n;
+  int c;
+
+  n = 0;
+  for(c = 0; c < ncpu; c++)
+    n += kstats[c].n[k];
+  return n;
+}
+
+// Add the line "name v" to report r.
+void
+report(struct report *r, char *name, uint v)
+{
+  char line[64];
+
+  snprintf(line, sizeof(line), "%-16s %u\n", name, v);
+  emitline(line, &r->pos, r->dst, r->off, r->n);
+}
+
+// Add the line "name p", p being a as a percentage of b.
+void
+reportpct(struct report *r, char *name, uint a, uint b)
+{
+  if(b == 0)
+    report(r, name, 0);
+  else if(a < 0xffffffff / 100)
+    report(r, name, a * 100 / b);
+  else
+    report(r, name, a / (b / 100));
+}
+
+int
+kstatread(struct inode *ip, char *dst, uint off, int n)
+{
+  struct report r;
+
+  if(ip->minor < 0 || ip->minor >= NELEM(files))
+    return -1;
+  r.pos = 0;
+  r.dst = dst;
+  r.off = off;
+  r.n = n;
+  files[ip->minor].fn(&r);
+  if(r.pos <= off)
+    return 0;
+  return (r.pos < off + n ? r.pos : off + n) - off;
+}
+
+void
+kstatinit(void)
+{
+  devsw[KSTAT].read = kstatread;
+}
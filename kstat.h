@@ -0,0 +1,33 @@
+// Event counters, for the files under /stats; see kstat.c.
+enum {
+  KS_BHIT,        // bget found the sector cached
+  KS_BMISS,       // bget had to recycle a buffer for it
+  KS_BWAIT,       // bget waited for another holder of a cached buffer
+  KS_BREADAHEAD,  // read-aheads started
+  KS_IHIT,        // iget found the inode cached
+  KS_IMISS,       // iget had to recycle an entry for it
+  KS_DHIT,        // directory lookups the name cache answered
+  KS_DMISS,       // ones it could not
+  KS_KALLOC,      // pages allocated
+  KS_KFREE,       // pages freed
+  KS_KSTEAL,      // allocations that took another CPU's page
+  KS_KSHRINK,     // times kalloc shrank the caches to find a page
+  KS_TRANS,       // system calls that joined a transaction
+  KS_TRANSWAIT,   // of those, ones that had to wait to join
+  KS_COMMIT,      // transactions committed
+  KS_COMMITBLK,   // blocks they logged
+  KS_SWITCH,      // switches from the scheduler to a process
+  KS_SCHEDSTEAL,  // of those, to a process from another CPU's queue
+  KS_SWAPOUT,     // pages written to swap
+  KS_SWAPIN,      // pages read back from it
+  KS_SWAPSCAN,    // page table entries the page-out clock looked at
+  NKSTAT
+};
+
+// What a /stats file has made of the bytes a read wants so far.
+struct report {
+  uint pos;
+  char *dst;
+  uint off;
+  int n;
+};
@@ -3,6 +3,7 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
 #include "memlayout.h"
 #include "traps.h"
 #include "mmu.h"
@@ -24,6 +25,7 @@
   #define DEASSERT   0x00000000
   #define LEVEL      0x00008000   // Level triggered
   #define BCAST      0x00080000   // Send to all APICs, including self.
+  #define OTHERS     0x000C0000   // Send to all APICs, excluding self.
   #define BUSY       0x00001000
   #define FIXED      0x00000000
 #define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
@@ -62,9 +64,10 @@ lapicinit(int c)
   // from lapic[TICR] and then issues an interrupt.  
   // If xv6 cared more about precise timekeeping,
   // TICR would be calibrated using an external time source.
+  // The profiler has it count down faster; see proftick.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000); 
+  lapictimer(PROFRATE);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -115,6 +118,16 @@ cpunum(void)
   return 0;
 }
 
+// Have the timer interrupt rate times per clock tick, or once
+// if rate is 0.
+void
+lapictimer(int rate)
+{
+  if(!lapic)
+    return;
+  lapicw(TICR, 10000000 / (rate > 0 ? rate : 1));
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
@@ -123,6 +136,16 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to every other CPU.
+void
+lapicipi(int vector)
+{
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, OTHERS | FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,1852 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(!(argc == 3 || (argc == 4 && strcmp(argv[1], "-s") == 0))){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 39                	je     4f <main+0x4f>
+  16:	83 3b 04             	cmpl   $0x4,(%ebx)
+  19:	75 1d                	jne    38 <main+0x38>
+  1b:	8b 43 04             	mov    0x4(%ebx),%eax
+  1e:	83 c0 04             	add    $0x4,%eax
+  21:	8b 00                	mov    (%eax),%eax
+  23:	83 ec 08             	sub    $0x8,%esp
+  26:	68 a0 0e 00 00       	push   $0xea0
+  2b:	50                   	push   %eax
+  2c:	e8 04 01 00 00       	call   135 <strcmp>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	85 c0                	test   %eax,%eax
+  36:	74 17                	je     4f <main+0x4f>
+    printf(2, "Usage: ln [-s] old new\n");
+  38:	83 ec 08             	sub    $0x8,%esp
+  3b:	68 a3 0e 00 00       	push   $0xea3
+  40:	6a 02                	push   $0x2
+  42:	e8 bf 07 00 00       	call   806 <printf>
+  47:	83 c4 10             	add    $0x10,%esp
+    exit();
+  4a:	e8 27 03 00 00       	call   376 <exit>
+  }
+
+  if(argc == 3) {
+  4f:	83 3b 03             	cmpl   $0x3,(%ebx)
+  52:	75 44                	jne    98 <main+0x98>
+    if(link(argv[1], argv[2]) < 0)
+  54:	8b 43 04             	mov    0x4(%ebx),%eax
+  57:	83 c0 08             	add    $0x8,%eax
+  5a:	8b 10                	mov    (%eax),%edx
+  5c:	8b 43 04             	mov    0x4(%ebx),%eax
+  5f:	83 c0 04             	add    $0x4,%eax
+  62:	8b 00                	mov    (%eax),%eax
+  64:	83 ec 08             	sub    $0x8,%esp
+  67:	52                   	push   %edx
+  68:	50                   	push   %eax
+  69:	e8 68 03 00 00       	call   3d6 <link>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	85 c0                	test   %eax,%eax
+  73:	79 65                	jns    da <main+0xda>
+      printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  75:	8b 43 04             	mov    0x4(%ebx),%eax
+  78:	83 c0 08             	add    $0x8,%eax
+  7b:	8b 10                	mov    (%eax),%edx
+  7d:	8b 43 04             	mov    0x4(%ebx),%eax
+  80:	83 c0 04             	add    $0x4,%eax
+  83:	8b 00                	mov    (%eax),%eax
+  85:	52                   	push   %edx
+  86:	50                   	push   %eax
+  87:	68 bb 0e 00 00       	push   $0xebb
+  8c:	6a 02                	push   $0x2
+  8e:	e8 73 07 00 00       	call   806 <printf>
+  93:	83 c4 10             	add    $0x10,%esp
+  96:	eb 42                	jmp    da <main+0xda>
+  }
+  else{
+    if(symlink(argv[2], argv[3]) < 0) {
+  98:	8b 43 04             	mov    0x4(%ebx),%eax
+  9b:	83 c0 0c             	add    $0xc,%eax
+  9e:	8b 10                	mov    (%eax),%edx
+  a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  a3:	83 c0 08             	add    $0x8,%eax
+  a6:	8b 00                	mov    (%eax),%eax
+  a8:	83 ec 08             	sub    $0x8,%esp
+  ab:	52                   	push   %edx
+  ac:	50                   	push   %eax
+  ad:	e8 74 03 00 00       	call   426 <symlink>
+  b2:	83 c4 10             	add    $0x10,%esp
+  b5:	85 c0                	test   %eax,%eax
+  b7:	79 21                	jns    da <main+0xda>
+      printf(2, "link -s %s %s: failed\n", argv[1], argv[2]);
+  b9:	8b 43 04             	mov    0x4(%ebx),%eax
+  bc:	83 c0 08             	add    $0x8,%eax
+  bf:	8b 10                	mov    (%eax),%edx
+  c1:	8b 43 04             	mov    0x4(%ebx),%eax
+  c4:	83 c0 04             	add    $0x4,%eax
+  c7:	8b 00                	mov    (%eax),%eax
+  c9:	52                   	push   %edx
+  ca:	50                   	push   %eax
+  cb:	68 cf 0e 00 00       	push   $0xecf
+  d0:	6a 02                	push   $0x2
+  d2:	e8 2f 07 00 00       	call   806 <printf>
+  d7:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  da:	e8 97 02 00 00       	call   376 <exit>
+
+000000df <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  df:	55                   	push   %ebp
+  e0:	89 e5                	mov    %esp,%ebp
+  e2:	57                   	push   %edi
+  e3:	53                   	push   %ebx
+    if(cc < 1)
+  e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e7:	8b 55 10             	mov    0x10(%ebp),%edx
+  ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ed:	89 cb                	mov    %ecx,%ebx
+  ef:	89 df                	mov    %ebx,%edi
+  f1:	89 d1                	mov    %edx,%ecx
+  f3:	fc                   	cld
+  f4:	f3 aa                	rep stos %al,%es:(%edi)
+  f6:	89 ca                	mov    %ecx,%edx
+  f8:	89 fb                	mov    %edi,%ebx
+  fa:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  fd:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 100:	90                   	nop
+ 101:	5b                   	pop    %ebx
+ 102:	5f                   	pop    %edi
+ 103:	5d                   	pop    %ebp
+ 104:	c3                   	ret
+
+00000105 <strcpy>:
+{
+ 105:	55                   	push   %ebp
+ 106:	89 e5                	mov    %esp,%ebp
+ 108:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 10b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 10e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 111:	90                   	nop
+ 112:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 115:	8d 42 01             	lea    0x1(%edx),%eax
+ 118:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 121:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 124:	0f b6 12             	movzbl (%edx),%edx
+ 127:	88 10                	mov    %dl,(%eax)
+ 129:	0f b6 00             	movzbl (%eax),%eax
+ 12c:	84 c0                	test   %al,%al
+ 12e:	75 e2                	jne    112 <strcpy+0xd>
+  return os;
+ 130:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <strcmp>:
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 138:	eb 08                	jmp    142 <strcmp+0xd>
+    p++, q++;
+ 13a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 13e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 142:	8b 45 08             	mov    0x8(%ebp),%eax
+ 145:	0f b6 00             	movzbl (%eax),%eax
+ 148:	84 c0                	test   %al,%al
+ 14a:	74 10                	je     15c <strcmp+0x27>
+ 14c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14f:	0f b6 10             	movzbl (%eax),%edx
+ 152:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 155:	0f b6 00             	movzbl (%eax),%eax
+ 158:	38 c2                	cmp    %al,%dl
+ 15a:	74 de                	je     13a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 15c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15f:	0f b6 00             	movzbl (%eax),%eax
+ 162:	0f b6 d0             	movzbl %al,%edx
+ 165:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 168:	0f b6 00             	movzbl (%eax),%eax
+ 16b:	0f b6 c0             	movzbl %al,%eax
+ 16e:	29 c2                	sub    %eax,%edx
+ 170:	89 d0                	mov    %edx,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+
+00000174 <strlen>:
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 17a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 181:	eb 04                	jmp    187 <strlen+0x13>
+ 183:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 187:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 18a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18d:	01 d0                	add    %edx,%eax
+ 18f:	0f b6 00             	movzbl (%eax),%eax
+ 192:	84 c0                	test   %al,%al
+ 194:	75 ed                	jne    183 <strlen+0xf>
+  return n;
+ 196:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 199:	c9                   	leave
+ 19a:	c3                   	ret
+
+0000019b <memset>:
+{
+ 19b:	55                   	push   %ebp
+ 19c:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 19e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1a1:	50                   	push   %eax
+ 1a2:	ff 75 0c             	push   0xc(%ebp)
+ 1a5:	ff 75 08             	push   0x8(%ebp)
+ 1a8:	e8 32 ff ff ff       	call   df <stosb>
+ 1ad:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1b0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1b3:	c9                   	leave
+ 1b4:	c3                   	ret
+
+000001b5 <strchr>:
+{
+ 1b5:	55                   	push   %ebp
+ 1b6:	89 e5                	mov    %esp,%ebp
+ 1b8:	83 ec 04             	sub    $0x4,%esp
+ 1bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1be:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1c1:	eb 14                	jmp    1d7 <strchr+0x22>
+    if(*s == c)
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 00             	movzbl (%eax),%eax
+ 1c9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1cc:	75 05                	jne    1d3 <strchr+0x1e>
+      return (char*)s;
+ 1ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d1:	eb 13                	jmp    1e6 <strchr+0x31>
+  for(; *s; s++)
+ 1d3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1da:	0f b6 00             	movzbl (%eax),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 e2                	jne    1c3 <strchr+0xe>
+  return 0;
+ 1e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1e6:	c9                   	leave
+ 1e7:	c3                   	ret
+
+000001e8 <gets>:
+{
+ 1e8:	55                   	push   %ebp
+ 1e9:	89 e5                	mov    %esp,%ebp
+ 1eb:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1f5:	eb 42                	jmp    239 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1f7:	83 ec 04             	sub    $0x4,%esp
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1ff:	50                   	push   %eax
+ 200:	6a 00                	push   $0x0
+ 202:	e8 84 01 00 00       	call   38b <read>
+ 207:	83 c4 10             	add    $0x10,%esp
+ 20a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 20d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 211:	7e 33                	jle    246 <gets+0x5e>
+    buf[i++] = c;
+ 213:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 216:	8d 50 01             	lea    0x1(%eax),%edx
+ 219:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 21c:	89 c2                	mov    %eax,%edx
+ 21e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 221:	01 c2                	add    %eax,%edx
+ 223:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 227:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 229:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 22d:	3c 0a                	cmp    $0xa,%al
+ 22f:	74 16                	je     247 <gets+0x5f>
+ 231:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 235:	3c 0d                	cmp    $0xd,%al
+ 237:	74 0e                	je     247 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 239:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 242:	7f b3                	jg     1f7 <gets+0xf>
+ 244:	eb 01                	jmp    247 <gets+0x5f>
+      break;
+ 246:	90                   	nop
+  }
+  buf[i] = '\0';
+ 247:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	01 d0                	add    %edx,%eax
+ 24f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 252:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 255:	c9                   	leave
+ 256:	c3                   	ret
+
+00000257 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 257:	55                   	push   %ebp
+ 258:	89 e5                	mov    %esp,%ebp
+ 25a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 25d:	83 ec 08             	sub    $0x8,%esp
+ 260:	6a 00                	push   $0x0
+ 262:	ff 75 08             	push   0x8(%ebp)
+ 265:	e8 44 01 00 00       	call   3ae <open>
+ 26a:	83 c4 10             	add    $0x10,%esp
+ 26d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 270:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 274:	79 07                	jns    27d <stat+0x26>
+    return -1;
+ 276:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 27b:	eb 25                	jmp    2a2 <stat+0x4b>
+  r = fstat(fd, st);
+ 27d:	83 ec 08             	sub    $0x8,%esp
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 f4             	push   -0xc(%ebp)
+ 286:	e8 41 01 00 00       	call   3cc <fstat>
+ 28b:	83 c4 10             	add    $0x10,%esp
+ 28e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 291:	83 ec 0c             	sub    $0xc,%esp
+ 294:	ff 75 f4             	push   -0xc(%ebp)
+ 297:	e8 fd 00 00 00       	call   399 <close>
+ 29c:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 29f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2a2:	c9                   	leave
+ 2a3:	c3                   	ret
+
+000002a4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2a4:	55                   	push   %ebp
+ 2a5:	89 e5                	mov    %esp,%ebp
+ 2a7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2b1:	eb 25                	jmp    2d8 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2b3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	c1 e0 02             	shl    $0x2,%eax
+ 2bb:	01 d0                	add    %edx,%eax
+ 2bd:	01 c0                	add    %eax,%eax
+ 2bf:	89 c1                	mov    %eax,%ecx
+ 2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2ca:	0f b6 00             	movzbl (%eax),%eax
+ 2cd:	0f be c0             	movsbl %al,%eax
+ 2d0:	01 c8                	add    %ecx,%eax
+ 2d2:	83 e8 30             	sub    $0x30,%eax
+ 2d5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2db:	0f b6 00             	movzbl (%eax),%eax
+ 2de:	3c 2f                	cmp    $0x2f,%al
+ 2e0:	7e 0a                	jle    2ec <atoi+0x48>
+ 2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e5:	0f b6 00             	movzbl (%eax),%eax
+ 2e8:	3c 39                	cmp    $0x39,%al
+ 2ea:	7e c7                	jle    2b3 <atoi+0xf>
+  return n;
+ 2ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ef:	c9                   	leave
+ 2f0:	c3                   	ret
+
+000002f1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2f1:	55                   	push   %ebp
+ 2f2:	89 e5                	mov    %esp,%ebp
+ 2f4:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 300:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 303:	eb 17                	jmp    31c <memmove+0x2b>
+    *dst++ = *src++;
+ 305:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 308:	8d 42 01             	lea    0x1(%edx),%eax
+ 30b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 311:	8d 48 01             	lea    0x1(%eax),%ecx
+ 314:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 317:	0f b6 12             	movzbl (%edx),%edx
+ 31a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 31c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 31f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 322:	89 55 10             	mov    %edx,0x10(%ebp)
+ 325:	85 c0                	test   %eax,%eax
+ 327:	7f dc                	jg     305 <memmove+0x14>
+  return vdst;
+ 329:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 32c:	c9                   	leave
+ 32d:	c3                   	ret
+
+0000032e <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 32e:	83 3d 78 12 00 00 00 	cmpl   $0x0,0x1278
+  jg 2f
+ 335:	7f 2e                	jg     365 <dosyscall+0x37>
+  jl 1f
+ 337:	7c 29                	jl     362 <dosyscall+0x34>
+  pushl %eax
+ 339:	50                   	push   %eax
+  pushl %ebx
+ 33a:	53                   	push   %ebx
+  movl $1, %eax
+ 33b:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 340:	0f a2                	cpuid
+  popl %ebx
+ 342:	5b                   	pop    %ebx
+  popl %eax
+ 343:	58                   	pop    %eax
+  movl $-1, sysmode
+ 344:	c7 05 78 12 00 00 ff 	movl   $0xffffffff,0x1278
+ 34b:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 34e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 354:	74 0c                	je     362 <dosyscall+0x34>
+  movl $1, sysmode
+ 356:	c7 05 78 12 00 00 01 	movl   $0x1,0x1278
+ 35d:	00 00 00 
+  jmp 2f
+ 360:	eb 03                	jmp    365 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 362:	cd 40                	int    $0x40
+  ret
+ 364:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 365:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 367:	ba 6e 03 00 00       	mov    $0x36e,%edx
+  sysenter
+ 36c:	0f 34                	sysenter
+3:
+  ret
+ 36e:	c3                   	ret
+
+0000036f <fork>:
+
+SYSCALL(fork)
+ 36f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 374:	eb b8                	jmp    32e <dosyscall>
+
+00000376 <exit>:
+SYSCALL(exit)
+ 376:	b8 02 00 00 00       	mov    $0x2,%eax
+ 37b:	eb b1                	jmp    32e <dosyscall>
+
+0000037d <wait>:
+SYSCALL(wait)
+ 37d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 382:	eb aa                	jmp    32e <dosyscall>
+
+00000384 <pipe>:
+SYSCALL(pipe)
+ 384:	b8 04 00 00 00       	mov    $0x4,%eax
+ 389:	eb a3                	jmp    32e <dosyscall>
+
+0000038b <read>:
+SYSCALL(read)
+ 38b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 390:	eb 9c                	jmp    32e <dosyscall>
+
+00000392 <write>:
+SYSCALL(write)
+ 392:	b8 10 00 00 00       	mov    $0x10,%eax
+ 397:	eb 95                	jmp    32e <dosyscall>
+
+00000399 <close>:
+SYSCALL(close)
+ 399:	b8 15 00 00 00       	mov    $0x15,%eax
+ 39e:	eb 8e                	jmp    32e <dosyscall>
+
+000003a0 <kill>:
+SYSCALL(kill)
+ 3a0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3a5:	eb 87                	jmp    32e <dosyscall>
+
+000003a7 <exec>:
+SYSCALL(exec)
+ 3a7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3ac:	eb 80                	jmp    32e <dosyscall>
+
+000003ae <open>:
+SYSCALL(open)
+ 3ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3b3:	e9 76 ff ff ff       	jmp    32e <dosyscall>
+
+000003b8 <mknod>:
+SYSCALL(mknod)
+ 3b8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3bd:	e9 6c ff ff ff       	jmp    32e <dosyscall>
+
+000003c2 <unlink>:
+SYSCALL(unlink)
+ 3c2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3c7:	e9 62 ff ff ff       	jmp    32e <dosyscall>
+
+000003cc <fstat>:
+SYSCALL(fstat)
+ 3cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d1:	e9 58 ff ff ff       	jmp    32e <dosyscall>
+
+000003d6 <link>:
+SYSCALL(link)
+ 3d6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3db:	e9 4e ff ff ff       	jmp    32e <dosyscall>
+
+000003e0 <mkdir>:
+SYSCALL(mkdir)
+ 3e0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e5:	e9 44 ff ff ff       	jmp    32e <dosyscall>
+
+000003ea <chdir>:
+SYSCALL(chdir)
+ 3ea:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3ef:	e9 3a ff ff ff       	jmp    32e <dosyscall>
+
+000003f4 <dup>:
+SYSCALL(dup)
+ 3f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f9:	e9 30 ff ff ff       	jmp    32e <dosyscall>
+
+000003fe <getpid>:
+SYSCALL(getpid)
+ 3fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 403:	e9 26 ff ff ff       	jmp    32e <dosyscall>
+
+00000408 <sbrk>:
+SYSCALL(sbrk)
+ 408:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 40d:	e9 1c ff ff ff       	jmp    32e <dosyscall>
+
+00000412 <sleep>:
+SYSCALL(sleep)
+ 412:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 417:	e9 12 ff ff ff       	jmp    32e <dosyscall>
+
+0000041c <uptime>:
+SYSCALL(uptime)
+ 41c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 421:	e9 08 ff ff ff       	jmp    32e <dosyscall>
+
+00000426 <symlink>:
+SYSCALL(symlink)
+ 426:	b8 16 00 00 00       	mov    $0x16,%eax
+ 42b:	e9 fe fe ff ff       	jmp    32e <dosyscall>
+
+00000430 <readlink>:
+SYSCALL(readlink)
+ 430:	b8 17 00 00 00       	mov    $0x17,%eax
+ 435:	e9 f4 fe ff ff       	jmp    32e <dosyscall>
+
+0000043a <fprot>:
+SYSCALL(fprot)
+ 43a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 43f:	e9 ea fe ff ff       	jmp    32e <dosyscall>
+
+00000444 <funprot>:
+SYSCALL(funprot)
+ 444:	b8 19 00 00 00       	mov    $0x19,%eax
+ 449:	e9 e0 fe ff ff       	jmp    32e <dosyscall>
+
+0000044e <funlock>:
+SYSCALL(funlock)
+ 44e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 453:	e9 d6 fe ff ff       	jmp    32e <dosyscall>
+
+00000458 <mmap>:
+SYSCALL(mmap)
+ 458:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 45d:	e9 cc fe ff ff       	jmp    32e <dosyscall>
+
+00000462 <munmap>:
+SYSCALL(munmap)
+ 462:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 467:	e9 c2 fe ff ff       	jmp    32e <dosyscall>
+
+0000046c <sendfile>:
+SYSCALL(sendfile)
+ 46c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 471:	e9 b8 fe ff ff       	jmp    32e <dosyscall>
+
+00000476 <readv>:
+SYSCALL(readv)
+ 476:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 47b:	e9 ae fe ff ff       	jmp    32e <dosyscall>
+
+00000480 <writev>:
+SYSCALL(writev)
+ 480:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 485:	e9 a4 fe ff ff       	jmp    32e <dosyscall>
+
+0000048a <pread>:
+SYSCALL(pread)
+ 48a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 48f:	e9 9a fe ff ff       	jmp    32e <dosyscall>
+
+00000494 <pwrite>:
+SYSCALL(pwrite)
+ 494:	b8 21 00 00 00       	mov    $0x21,%eax
+ 499:	e9 90 fe ff ff       	jmp    32e <dosyscall>
+
+0000049e <lseek>:
+SYSCALL(lseek)
+ 49e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a3:	e9 86 fe ff ff       	jmp    32e <dosyscall>
+
+000004a8 <spawn>:
+SYSCALL(spawn)
+ 4a8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4ad:	e9 7c fe ff ff       	jmp    32e <dosyscall>
+
+000004b2 <setpriority>:
+SYSCALL(setpriority)
+ 4b2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b7:	e9 72 fe ff ff       	jmp    32e <dosyscall>
+
+000004bc <kthread_create>:
+SYSCALL(kthread_create)
+ 4bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c1:	e9 68 fe ff ff       	jmp    32e <dosyscall>
+
+000004c6 <kthread_id>:
+SYSCALL(kthread_id)
+ 4c6:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4cb:	e9 5e fe ff ff       	jmp    32e <dosyscall>
+
+000004d0 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 4d0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d5:	e9 54 fe ff ff       	jmp    32e <dosyscall>
+
+000004da <kthread_join>:
+SYSCALL(kthread_join)
+ 4da:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4df:	e9 4a fe ff ff       	jmp    32e <dosyscall>
+
+000004e4 <futex>:
+SYSCALL(futex)
+ 4e4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4e9:	e9 40 fe ff ff       	jmp    32e <dosyscall>
+
+000004ee <signal>:
+SYSCALL(signal)
+ 4ee:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4f3:	e9 36 fe ff ff       	jmp    32e <dosyscall>
+
+000004f8 <alarm>:
+SYSCALL(alarm)
+ 4f8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4fd:	e9 2c fe ff ff       	jmp    32e <dosyscall>
+
+00000502 <usleep>:
+SYSCALL(usleep)
+ 502:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 507:	e9 22 fe ff ff       	jmp    32e <dosyscall>
+
+0000050c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 50c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 511:	e9 18 fe ff ff       	jmp    32e <dosyscall>
+
+00000516 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 516:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 51b:	e9 0e fe ff ff       	jmp    32e <dosyscall>
+
+00000520 <getrusage>:
+SYSCALL(getrusage)
+ 520:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 525:	e9 04 fe ff ff       	jmp    32e <dosyscall>
+
+0000052a <mount>:
+SYSCALL(mount)
+ 52a:	b8 30 00 00 00       	mov    $0x30,%eax
+ 52f:	e9 fa fd ff ff       	jmp    32e <dosyscall>
+
+00000534 <getdents>:
+SYSCALL(getdents)
+ 534:	b8 31 00 00 00       	mov    $0x31,%eax
+ 539:	e9 f0 fd ff ff       	jmp    32e <dosyscall>
+
+0000053e <yield>:
+SYSCALL(yield)
+ 53e:	b8 32 00 00 00       	mov    $0x32,%eax
+ 543:	e9 e6 fd ff ff       	jmp    32e <dosyscall>
+
+00000548 <ncpu>:
+SYSCALL(ncpu)
+ 548:	b8 33 00 00 00       	mov    $0x33,%eax
+ 54d:	e9 dc fd ff ff       	jmp    32e <dosyscall>
+
+00000552 <fallocate>:
+SYSCALL(fallocate)
+ 552:	b8 34 00 00 00       	mov    $0x34,%eax
+ 557:	e9 d2 fd ff ff       	jmp    32e <dosyscall>
+
+0000055c <ftruncate>:
+SYSCALL(ftruncate)
+ 55c:	b8 35 00 00 00       	mov    $0x35,%eax
+ 561:	e9 c8 fd ff ff       	jmp    32e <dosyscall>
+
+00000566 <fsync>:
+SYSCALL(fsync)
+ 566:	b8 36 00 00 00       	mov    $0x36,%eax
+ 56b:	e9 be fd ff ff       	jmp    32e <dosyscall>
+
+00000570 <fdatasync>:
+SYSCALL(fdatasync)
+ 570:	b8 37 00 00 00       	mov    $0x37,%eax
+ 575:	e9 b4 fd ff ff       	jmp    32e <dosyscall>
+
+0000057a <poll>:
+SYSCALL(poll)
+ 57a:	b8 38 00 00 00       	mov    $0x38,%eax
+ 57f:	e9 aa fd ff ff       	jmp    32e <dosyscall>
+
+00000584 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 584:	55                   	push   %ebp
+ 585:	89 e5                	mov    %esp,%ebp
+ 587:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	8b 40 04             	mov    0x4(%eax),%eax
+ 590:	85 c0                	test   %eax,%eax
+ 592:	7e 1f                	jle    5b3 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 594:	8b 45 08             	mov    0x8(%ebp),%eax
+ 597:	8b 50 04             	mov    0x4(%eax),%edx
+ 59a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59d:	8d 48 08             	lea    0x8(%eax),%ecx
+ 5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a3:	8b 00                	mov    (%eax),%eax
+ 5a5:	83 ec 04             	sub    $0x4,%esp
+ 5a8:	52                   	push   %edx
+ 5a9:	51                   	push   %ecx
+ 5aa:	50                   	push   %eax
+ 5ab:	e8 d0 fe ff ff       	call   480 <writev>
+ 5b0:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 5bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c0:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 5c7:	00 00 00 
+}
+ 5ca:	90                   	nop
+ 5cb:	c9                   	leave
+ 5cc:	c3                   	ret
+
+000005cd <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 5cd:	55                   	push   %ebp
+ 5ce:	89 e5                	mov    %esp,%ebp
+ 5d0:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 5d3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5d7:	0f 84 94 00 00 00    	je     671 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 5dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e0:	8b 40 04             	mov    0x4(%eax),%eax
+ 5e3:	85 c0                	test   %eax,%eax
+ 5e5:	7e 40                	jle    627 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 5e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ed:	83 e8 01             	sub    $0x1,%eax
+ 5f0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	01 d0                	add    %edx,%eax
+ 5fc:	83 c0 08             	add    $0x8,%eax
+ 5ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 602:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 605:	8b 10                	mov    (%eax),%edx
+ 607:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60a:	8b 40 04             	mov    0x4(%eax),%eax
+ 60d:	01 d0                	add    %edx,%eax
+ 60f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 612:	75 13                	jne    627 <put+0x5a>
+      v->iov_len += n;
+ 614:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 617:	8b 50 04             	mov    0x4(%eax),%edx
+ 61a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 61d:	01 c2                	add    %eax,%edx
+ 61f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 622:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 625:	eb 4b                	jmp    672 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 627:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62a:	8b 40 04             	mov    0x4(%eax),%eax
+ 62d:	83 f8 10             	cmp    $0x10,%eax
+ 630:	75 0e                	jne    640 <put+0x73>
+    flush(o);
+ 632:	83 ec 0c             	sub    $0xc,%esp
+ 635:	ff 75 08             	push   0x8(%ebp)
+ 638:	e8 47 ff ff ff       	call   584 <flush>
+ 63d:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 640:	8b 45 08             	mov    0x8(%ebp),%eax
+ 643:	8b 50 04             	mov    0x4(%eax),%edx
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+ 649:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 64c:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 650:	8b 45 08             	mov    0x8(%ebp),%eax
+ 653:	8b 50 04             	mov    0x4(%eax),%edx
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+ 659:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 65c:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 660:	8b 45 08             	mov    0x8(%ebp),%eax
+ 663:	8b 40 04             	mov    0x4(%eax),%eax
+ 666:	8d 50 01             	lea    0x1(%eax),%edx
+ 669:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66c:	89 50 04             	mov    %edx,0x4(%eax)
+ 66f:	eb 01                	jmp    672 <put+0xa5>
+    return;
+ 671:	90                   	nop
+}
+ 672:	c9                   	leave
+ 673:	c3                   	ret
+
+00000674 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 674:	55                   	push   %ebp
+ 675:	89 e5                	mov    %esp,%ebp
+ 677:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 683:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 686:	01 d0                	add    %edx,%eax
+ 688:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 68d:	77 0b                	ja     69a <room+0x26>
+ 68f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 692:	8b 40 04             	mov    0x4(%eax),%eax
+ 695:	83 f8 10             	cmp    $0x10,%eax
+ 698:	75 0e                	jne    6a8 <room+0x34>
+    flush(o);
+ 69a:	83 ec 0c             	sub    $0xc,%esp
+ 69d:	ff 75 08             	push   0x8(%ebp)
+ 6a0:	e8 df fe ff ff       	call   584 <flush>
+ 6a5:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 6a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ab:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 6b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6ba:	01 d0                	add    %edx,%eax
+}
+ 6bc:	c9                   	leave
+ 6bd:	c3                   	ret
+
+000006be <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 6be:	55                   	push   %ebp
+ 6bf:	89 e5                	mov    %esp,%ebp
+ 6c1:	83 ec 28             	sub    $0x28,%esp
+ 6c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c7:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 6ca:	83 ec 08             	sub    $0x8,%esp
+ 6cd:	6a 01                	push   $0x1
+ 6cf:	ff 75 08             	push   0x8(%ebp)
+ 6d2:	e8 9d ff ff ff       	call   674 <room>
+ 6d7:	83 c4 10             	add    $0x10,%esp
+ 6da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 6dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e0:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 6e4:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 6e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f5:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	6a 01                	push   $0x1
+ 700:	ff 75 f4             	push   -0xc(%ebp)
+ 703:	ff 75 08             	push   0x8(%ebp)
+ 706:	e8 c2 fe ff ff       	call   5cd <put>
+ 70b:	83 c4 10             	add    $0x10,%esp
+}
+ 70e:	90                   	nop
+ 70f:	c9                   	leave
+ 710:	c3                   	ret
+
+00000711 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 711:	55                   	push   %ebp
+ 712:	89 e5                	mov    %esp,%ebp
+ 714:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 717:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 71e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 722:	74 17                	je     73b <printint+0x2a>
+ 724:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 728:	79 11                	jns    73b <printint+0x2a>
+    neg = 1;
+ 72a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 731:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 734:	f7 d8                	neg    %eax
+ 736:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 739:	eb 06                	jmp    741 <printint+0x30>
+  } else {
+    x = xx;
+ 73b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 741:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 748:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 74b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 74e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 753:	f7 f1                	div    %ecx
+ 755:	89 d1                	mov    %edx,%ecx
+ 757:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75a:	8d 50 01             	lea    0x1(%eax),%edx
+ 75d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 760:	0f b6 91 7c 12 00 00 	movzbl 0x127c(%ecx),%edx
+ 767:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 76b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 76e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 771:	ba 00 00 00 00       	mov    $0x0,%edx
+ 776:	f7 f1                	div    %ecx
+ 778:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 77b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 77f:	75 c7                	jne    748 <printint+0x37>
+  if(neg)
+ 781:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 785:	74 0e                	je     795 <printint+0x84>
+    buf[i++] = '-';
+ 787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78a:	8d 50 01             	lea    0x1(%eax),%edx
+ 78d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 790:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 798:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 79b:	83 ec 08             	sub    $0x8,%esp
+ 79e:	ff 75 e8             	push   -0x18(%ebp)
+ 7a1:	ff 75 08             	push   0x8(%ebp)
+ 7a4:	e8 cb fe ff ff       	call   674 <room>
+ 7a9:	83 c4 10             	add    $0x10,%esp
+ 7ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 7af:	eb 1d                	jmp    7ce <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 7b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b4:	83 e8 01             	sub    $0x1,%eax
+ 7b7:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 7ba:	89 c2                	mov    %eax,%edx
+ 7bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7bf:	01 c2                	add    %eax,%edx
+ 7c1:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 7c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c7:	01 c8                	add    %ecx,%eax
+ 7c9:	0f b6 00             	movzbl (%eax),%eax
+ 7cc:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 7ce:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7d6:	79 d9                	jns    7b1 <printint+0xa0>
+  o->used += n;
+ 7d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7db:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e4:	01 c2                	add    %eax,%edx
+ 7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e9:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 7ef:	83 ec 04             	sub    $0x4,%esp
+ 7f2:	ff 75 e8             	push   -0x18(%ebp)
+ 7f5:	ff 75 e4             	push   -0x1c(%ebp)
+ 7f8:	ff 75 08             	push   0x8(%ebp)
+ 7fb:	e8 cd fd ff ff       	call   5cd <put>
+ 800:	83 c4 10             	add    $0x10,%esp
+}
+ 803:	90                   	nop
+ 804:	c9                   	leave
+ 805:	c3                   	ret
+
+00000806 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 806:	55                   	push   %ebp
+ 807:	89 e5                	mov    %esp,%ebp
+ 809:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 80f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 812:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 818:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 81f:	00 00 00 
+  o.used = 0;
+ 822:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 829:	00 00 00 
+  state = 0;
+ 82c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 833:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 836:	83 c0 04             	add    $0x4,%eax
+ 839:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 83c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 843:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 84a:	e9 82 01 00 00       	jmp    9d1 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 84f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 852:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 855:	01 d0                	add    %edx,%eax
+ 857:	0f b6 00             	movzbl (%eax),%eax
+ 85a:	0f be c0             	movsbl %al,%eax
+ 85d:	25 ff 00 00 00       	and    $0xff,%eax
+ 862:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 865:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 869:	75 38                	jne    8a3 <printf+0x9d>
+      if(c == '%'){
+ 86b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 86f:	0f 85 58 01 00 00    	jne    9cd <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 875:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 878:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 87b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 87e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 881:	01 ca                	add    %ecx,%edx
+ 883:	83 ec 04             	sub    $0x4,%esp
+ 886:	50                   	push   %eax
+ 887:	52                   	push   %edx
+ 888:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 88e:	50                   	push   %eax
+ 88f:	e8 39 fd ff ff       	call   5cd <put>
+ 894:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 897:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 89e:	e9 2a 01 00 00       	jmp    9cd <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 8a3:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 8a7:	0f 85 20 01 00 00    	jne    9cd <printf+0x1c7>
+      if(c == 'd'){
+ 8ad:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 8b1:	75 22                	jne    8d5 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 8b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b6:	8b 00                	mov    (%eax),%eax
+ 8b8:	6a 01                	push   $0x1
+ 8ba:	6a 0a                	push   $0xa
+ 8bc:	50                   	push   %eax
+ 8bd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8c3:	50                   	push   %eax
+ 8c4:	e8 48 fe ff ff       	call   711 <printint>
+ 8c9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8cc:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8d0:	e9 e8 00 00 00       	jmp    9bd <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 8d5:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 8d9:	74 06                	je     8e1 <printf+0xdb>
+ 8db:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 8df:	75 22                	jne    903 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 8e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e4:	8b 00                	mov    (%eax),%eax
+ 8e6:	6a 00                	push   $0x0
+ 8e8:	6a 10                	push   $0x10
+ 8ea:	50                   	push   %eax
+ 8eb:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8f1:	50                   	push   %eax
+ 8f2:	e8 1a fe ff ff       	call   711 <printint>
+ 8f7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8fa:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8fe:	e9 ba 00 00 00       	jmp    9bd <printf+0x1b7>
+      } else if(c == 's'){
+ 903:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 907:	75 3f                	jne    948 <printf+0x142>
+        s = (char*)*ap;
+ 909:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 90c:	8b 00                	mov    (%eax),%eax
+ 90e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 911:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 915:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 919:	75 07                	jne    922 <printf+0x11c>
+          s = "(null)";
+ 91b:	c7 45 f4 e6 0e 00 00 	movl   $0xee6,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 922:	83 ec 0c             	sub    $0xc,%esp
+ 925:	ff 75 f4             	push   -0xc(%ebp)
+ 928:	e8 47 f8 ff ff       	call   174 <strlen>
+ 92d:	83 c4 10             	add    $0x10,%esp
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	50                   	push   %eax
+ 934:	ff 75 f4             	push   -0xc(%ebp)
+ 937:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 93d:	50                   	push   %eax
+ 93e:	e8 8a fc ff ff       	call   5cd <put>
+ 943:	83 c4 10             	add    $0x10,%esp
+ 946:	eb 75                	jmp    9bd <printf+0x1b7>
+      } else if(c == 'c'){
+ 948:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 94c:	75 21                	jne    96f <printf+0x169>
+        putc(&o, *ap);
+ 94e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 951:	8b 00                	mov    (%eax),%eax
+ 953:	0f be c0             	movsbl %al,%eax
+ 956:	83 ec 08             	sub    $0x8,%esp
+ 959:	50                   	push   %eax
+ 95a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 960:	50                   	push   %eax
+ 961:	e8 58 fd ff ff       	call   6be <putc>
+ 966:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 969:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 96d:	eb 4e                	jmp    9bd <printf+0x1b7>
+      } else if(c == '%'){
+ 96f:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 973:	75 1b                	jne    990 <printf+0x18a>
+        putc(&o, c);
+ 975:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 978:	0f be c0             	movsbl %al,%eax
+ 97b:	83 ec 08             	sub    $0x8,%esp
+ 97e:	50                   	push   %eax
+ 97f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 985:	50                   	push   %eax
+ 986:	e8 33 fd ff ff       	call   6be <putc>
+ 98b:	83 c4 10             	add    $0x10,%esp
+ 98e:	eb 2d                	jmp    9bd <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 990:	83 ec 08             	sub    $0x8,%esp
+ 993:	6a 25                	push   $0x25
+ 995:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 99b:	50                   	push   %eax
+ 99c:	e8 1d fd ff ff       	call   6be <putc>
+ 9a1:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 9a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9a7:	0f be c0             	movsbl %al,%eax
+ 9aa:	83 ec 08             	sub    $0x8,%esp
+ 9ad:	50                   	push   %eax
+ 9ae:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9b4:	50                   	push   %eax
+ 9b5:	e8 04 fd ff ff       	call   6be <putc>
+ 9ba:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9bd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 9c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c7:	83 c0 01             	add    $0x1,%eax
+ 9ca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9cd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d7:	01 d0                	add    %edx,%eax
+ 9d9:	0f b6 00             	movzbl (%eax),%eax
+ 9dc:	84 c0                	test   %al,%al
+ 9de:	0f 85 6b fe ff ff    	jne    84f <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 9e4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 9e8:	75 22                	jne    a0c <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 9ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ed:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9f3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9f6:	01 ca                	add    %ecx,%edx
+ 9f8:	83 ec 04             	sub    $0x4,%esp
+ 9fb:	50                   	push   %eax
+ 9fc:	52                   	push   %edx
+ 9fd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a03:	50                   	push   %eax
+ a04:	e8 c4 fb ff ff       	call   5cd <put>
+ a09:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ a0c:	83 ec 0c             	sub    $0xc,%esp
+ a0f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a15:	50                   	push   %eax
+ a16:	e8 69 fb ff ff       	call   584 <flush>
+ a1b:	83 c4 10             	add    $0x10,%esp
+}
+ a1e:	90                   	nop
+ a1f:	c9                   	leave
+ a20:	c3                   	ret
+
+00000a21 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ a21:	55                   	push   %ebp
+ a22:	89 e5                	mov    %esp,%ebp
+ a24:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ a27:	8b 55 08             	mov    0x8(%ebp),%edx
+ a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ a30:	f0 87 02             	lock xchg %eax,(%edx)
+ a33:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a39:	c9                   	leave
+ a3a:	c3                   	ret
+
+00000a3b <lock>:
+{
+ a3b:	55                   	push   %ebp
+ a3c:	89 e5                	mov    %esp,%ebp
+ a3e:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a41:	a1 90 12 00 00       	mov    0x1290,%eax
+ a46:	85 c0                	test   %eax,%eax
+ a48:	74 09                	je     a53 <lock+0x18>
+ a4a:	a1 90 12 00 00       	mov    0x1290,%eax
+ a4f:	ff d0                	call   *%eax
+ a51:	eb 05                	jmp    a58 <lock+0x1d>
+ a53:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a5b:	90                   	nop
+ a5c:	83 ec 08             	sub    $0x8,%esp
+ a5f:	6a 01                	push   $0x1
+ a61:	68 c8 12 00 00       	push   $0x12c8
+ a66:	e8 b6 ff ff ff       	call   a21 <xchg>
+ a6b:	83 c4 10             	add    $0x10,%esp
+ a6e:	85 c0                	test   %eax,%eax
+ a70:	75 ea                	jne    a5c <lock+0x21>
+  return pin;
+ a72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a75:	c9                   	leave
+ a76:	c3                   	ret
+
+00000a77 <unlock>:
+{
+ a77:	55                   	push   %ebp
+ a78:	89 e5                	mov    %esp,%ebp
+ a7a:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a7d:	6a 00                	push   $0x0
+ a7f:	68 c8 12 00 00       	push   $0x12c8
+ a84:	e8 98 ff ff ff       	call   a21 <xchg>
+ a89:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a8c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a90:	78 10                	js     aa2 <unlock+0x2b>
+    mallocunpin(pin);
+ a92:	a1 94 12 00 00       	mov    0x1294,%eax
+ a97:	83 ec 0c             	sub    $0xc,%esp
+ a9a:	ff 75 08             	push   0x8(%ebp)
+ a9d:	ff d0                	call   *%eax
+ a9f:	83 c4 10             	add    $0x10,%esp
+}
+ aa2:	90                   	nop
+ aa3:	c9                   	leave
+ aa4:	c3                   	ret
+
+00000aa5 <sizeclass>:
+{
+ aa5:	55                   	push   %ebp
+ aa6:	89 e5                	mov    %esp,%ebp
+ aa8:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ aab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ ab2:	eb 1c                	jmp    ad0 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ ab4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab7:	ba 02 00 00 00       	mov    $0x2,%edx
+ abc:	89 c1                	mov    %eax,%ecx
+ abe:	d3 e2                	shl    %cl,%edx
+ ac0:	89 d0                	mov    %edx,%eax
+ ac2:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ac5:	72 05                	jb     acc <sizeclass+0x27>
+      return c;
+ ac7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aca:	eb 0f                	jmp    adb <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ acc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ ad0:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ ad4:	7e de                	jle    ab4 <sizeclass+0xf>
+  return -1;
+ ad6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ adb:	c9                   	leave
+ adc:	c3                   	ret
+
+00000add <bigfree>:
+{
+ add:	55                   	push   %ebp
+ ade:	89 e5                	mov    %esp,%ebp
+ ae0:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae3:	a1 a0 12 00 00       	mov    0x12a0,%eax
+ ae8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ aeb:	eb 24                	jmp    b11 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af0:	8b 00                	mov    (%eax),%eax
+ af2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ af5:	72 12                	jb     b09 <bigfree+0x2c>
+ af7:	8b 45 08             	mov    0x8(%ebp),%eax
+ afa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ afd:	72 24                	jb     b23 <bigfree+0x46>
+ aff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b02:	8b 00                	mov    (%eax),%eax
+ b04:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b07:	72 1a                	jb     b23 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0c:	8b 00                	mov    (%eax),%eax
+ b0e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b11:	8b 45 08             	mov    0x8(%ebp),%eax
+ b14:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b17:	73 d4                	jae    aed <bigfree+0x10>
+ b19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1c:	8b 00                	mov    (%eax),%eax
+ b1e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b21:	73 ca                	jae    aed <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ b23:	8b 45 08             	mov    0x8(%ebp),%eax
+ b26:	8b 40 04             	mov    0x4(%eax),%eax
+ b29:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b30:	8b 45 08             	mov    0x8(%ebp),%eax
+ b33:	01 c2                	add    %eax,%edx
+ b35:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	39 c2                	cmp    %eax,%edx
+ b3c:	75 24                	jne    b62 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b41:	8b 50 04             	mov    0x4(%eax),%edx
+ b44:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b47:	8b 00                	mov    (%eax),%eax
+ b49:	8b 40 04             	mov    0x4(%eax),%eax
+ b4c:	01 c2                	add    %eax,%edx
+ b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b51:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b57:	8b 00                	mov    (%eax),%eax
+ b59:	8b 10                	mov    (%eax),%edx
+ b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5e:	89 10                	mov    %edx,(%eax)
+ b60:	eb 0a                	jmp    b6c <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b65:	8b 10                	mov    (%eax),%edx
+ b67:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6f:	8b 40 04             	mov    0x4(%eax),%eax
+ b72:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b79:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7c:	01 d0                	add    %edx,%eax
+ b7e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b81:	75 20                	jne    ba3 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b86:	8b 50 04             	mov    0x4(%eax),%edx
+ b89:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8c:	8b 40 04             	mov    0x4(%eax),%eax
+ b8f:	01 c2                	add    %eax,%edx
+ b91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b94:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b97:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9a:	8b 10                	mov    (%eax),%edx
+ b9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9f:	89 10                	mov    %edx,(%eax)
+ ba1:	eb 08                	jmp    bab <bigfree+0xce>
+    p->s.ptr = bp;
+ ba3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+ ba9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ bab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bae:	a3 a0 12 00 00       	mov    %eax,0x12a0
+}
+ bb3:	90                   	nop
+ bb4:	c9                   	leave
+ bb5:	c3                   	ret
+
+00000bb6 <free>:
+{
+ bb6:	55                   	push   %ebp
+ bb7:	89 e5                	mov    %esp,%ebp
+ bb9:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ bbc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bc0:	74 68                	je     c2a <free+0x74>
+  bp = (Header*)ap - 1;
+ bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc5:	83 e8 08             	sub    $0x8,%eax
+ bc8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ bcb:	e8 6b fe ff ff       	call   a3b <lock>
+ bd0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ bd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd6:	8b 40 04             	mov    0x4(%eax),%eax
+ bd9:	83 ec 0c             	sub    $0xc,%esp
+ bdc:	50                   	push   %eax
+ bdd:	e8 c3 fe ff ff       	call   aa5 <sizeclass>
+ be2:	83 c4 10             	add    $0x10,%esp
+ be5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ be8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ bec:	78 1e                	js     c0c <free+0x56>
+    bp->s.ptr = classfree[c];
+ bee:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bf1:	8b 14 85 a4 12 00 00 	mov    0x12a4(,%eax,4),%edx
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ bfd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c00:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c03:	89 14 85 a4 12 00 00 	mov    %edx,0x12a4(,%eax,4)
+ c0a:	eb 0e                	jmp    c1a <free+0x64>
+    bigfree(bp);
+ c0c:	83 ec 0c             	sub    $0xc,%esp
+ c0f:	ff 75 f4             	push   -0xc(%ebp)
+ c12:	e8 c6 fe ff ff       	call   add <bigfree>
+ c17:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ c1a:	83 ec 0c             	sub    $0xc,%esp
+ c1d:	ff 75 f0             	push   -0x10(%ebp)
+ c20:	e8 52 fe ff ff       	call   a77 <unlock>
+ c25:	83 c4 10             	add    $0x10,%esp
+ c28:	eb 01                	jmp    c2b <free+0x75>
+    return;
+ c2a:	90                   	nop
+}
+ c2b:	c9                   	leave
+ c2c:	c3                   	ret
+
+00000c2d <morecore>:
+{
+ c2d:	55                   	push   %ebp
+ c2e:	89 e5                	mov    %esp,%ebp
+ c30:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c33:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c3a:	77 07                	ja     c43 <morecore+0x16>
+    nu = 4096;
+ c3c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c43:	8b 45 08             	mov    0x8(%ebp),%eax
+ c46:	c1 e0 03             	shl    $0x3,%eax
+ c49:	83 ec 0c             	sub    $0xc,%esp
+ c4c:	50                   	push   %eax
+ c4d:	e8 b6 f7 ff ff       	call   408 <sbrk>
+ c52:	83 c4 10             	add    $0x10,%esp
+ c55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c58:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c5c:	75 07                	jne    c65 <morecore+0x38>
+    return 0;
+ c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+ c63:	eb 22                	jmp    c87 <morecore+0x5a>
+  hp = (Header*)p;
+ c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6e:	8b 55 08             	mov    0x8(%ebp),%edx
+ c71:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ c74:	83 ec 0c             	sub    $0xc,%esp
+ c77:	ff 75 f0             	push   -0x10(%ebp)
+ c7a:	e8 5e fe ff ff       	call   add <bigfree>
+ c7f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c82:	a1 a0 12 00 00       	mov    0x12a0,%eax
+}
+ c87:	c9                   	leave
+ c88:	c3                   	ret
+
+00000c89 <bigalloc>:
+{
+ c89:	55                   	push   %ebp
+ c8a:	89 e5                	mov    %esp,%ebp
+ c8c:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c8f:	a1 a0 12 00 00       	mov    0x12a0,%eax
+ c94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c97:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c9b:	75 23                	jne    cc0 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c9d:	c7 45 f0 98 12 00 00 	movl   $0x1298,-0x10(%ebp)
+ ca4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca7:	a3 a0 12 00 00       	mov    %eax,0x12a0
+ cac:	a1 a0 12 00 00       	mov    0x12a0,%eax
+ cb1:	a3 98 12 00 00       	mov    %eax,0x1298
+    base.s.size = 0;
+ cb6:	c7 05 9c 12 00 00 00 	movl   $0x0,0x129c
+ cbd:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc3:	8b 00                	mov    (%eax),%eax
+ cc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ccb:	8b 40 04             	mov    0x4(%eax),%eax
+ cce:	3b 45 08             	cmp    0x8(%ebp),%eax
+ cd1:	72 4a                	jb     d1d <bigalloc+0x94>
+      if(p->s.size == nunits)
+ cd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd6:	8b 40 04             	mov    0x4(%eax),%eax
+ cd9:	39 45 08             	cmp    %eax,0x8(%ebp)
+ cdc:	75 0c                	jne    cea <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce1:	8b 10                	mov    (%eax),%edx
+ ce3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce6:	89 10                	mov    %edx,(%eax)
+ ce8:	eb 26                	jmp    d10 <bigalloc+0x87>
+        p->s.size -= nunits;
+ cea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ced:	8b 40 04             	mov    0x4(%eax),%eax
+ cf0:	2b 45 08             	sub    0x8(%ebp),%eax
+ cf3:	89 c2                	mov    %eax,%edx
+ cf5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf8:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ cfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfe:	8b 40 04             	mov    0x4(%eax),%eax
+ d01:	c1 e0 03             	shl    $0x3,%eax
+ d04:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0a:	8b 55 08             	mov    0x8(%ebp),%edx
+ d0d:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ d10:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d13:	a3 a0 12 00 00       	mov    %eax,0x12a0
+      return p;
+ d18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1b:	eb 3b                	jmp    d58 <bigalloc+0xcf>
+    if(p == freep)
+ d1d:	a1 a0 12 00 00       	mov    0x12a0,%eax
+ d22:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d25:	75 1e                	jne    d45 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ d27:	83 ec 0c             	sub    $0xc,%esp
+ d2a:	ff 75 08             	push   0x8(%ebp)
+ d2d:	e8 fb fe ff ff       	call   c2d <morecore>
+ d32:	83 c4 10             	add    $0x10,%esp
+ d35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d3c:	75 07                	jne    d45 <bigalloc+0xbc>
+        return 0;
+ d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+ d43:	eb 13                	jmp    d58 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4e:	8b 00                	mov    (%eax),%eax
+ d50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d53:	e9 70 ff ff ff       	jmp    cc8 <bigalloc+0x3f>
+}
+ d58:	c9                   	leave
+ d59:	c3                   	ret
+
+00000d5a <alloc>:
+alloc(uint nbytes)
+{
+ d5a:	55                   	push   %ebp
+ d5b:	89 e5                	mov    %esp,%ebp
+ d5d:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d60:	8b 45 08             	mov    0x8(%ebp),%eax
+ d63:	83 c0 07             	add    $0x7,%eax
+ d66:	c1 e8 03             	shr    $0x3,%eax
+ d69:	83 c0 01             	add    $0x1,%eax
+ d6c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d6f:	ff 75 f4             	push   -0xc(%ebp)
+ d72:	e8 2e fd ff ff       	call   aa5 <sizeclass>
+ d77:	83 c4 04             	add    $0x4,%esp
+ d7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d7d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d81:	79 2c                	jns    daf <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d83:	83 ec 0c             	sub    $0xc,%esp
+ d86:	ff 75 f4             	push   -0xc(%ebp)
+ d89:	e8 fb fe ff ff       	call   c89 <bigalloc>
+ d8e:	83 c4 10             	add    $0x10,%esp
+ d91:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d94:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d98:	75 0a                	jne    da4 <alloc+0x4a>
+      return 0;
+ d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+ d9f:	e9 c8 00 00 00       	jmp    e6c <alloc+0x112>
+    return (void*)(p + 1);
+ da4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ da7:	83 c0 08             	add    $0x8,%eax
+ daa:	e9 bd 00 00 00       	jmp    e6c <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ daf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db2:	8b 04 85 a4 12 00 00 	mov    0x12a4(,%eax,4),%eax
+ db9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ dbc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dc0:	74 1a                	je     ddc <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ dc2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dc5:	8b 10                	mov    (%eax),%edx
+ dc7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dca:	89 14 85 a4 12 00 00 	mov    %edx,0x12a4(,%eax,4)
+    return (void*)(p + 1);
+ dd1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dd4:	83 c0 08             	add    $0x8,%eax
+ dd7:	e9 90 00 00 00       	jmp    e6c <alloc+0x112>
+  }
+  nunits = 2 << c;
+ ddc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ddf:	ba 02 00 00 00       	mov    $0x2,%edx
+ de4:	89 c1                	mov    %eax,%ecx
+ de6:	d3 e2                	shl    %cl,%edx
+ de8:	89 d0                	mov    %edx,%eax
+ dea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ded:	a1 c0 12 00 00       	mov    0x12c0,%eax
+ df2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ df5:	c1 e2 03             	shl    $0x3,%edx
+ df8:	01 d0                	add    %edx,%eax
+ dfa:	8b 15 c4 12 00 00    	mov    0x12c4,%edx
+ e00:	39 c2                	cmp    %eax,%edx
+ e02:	73 3f                	jae    e43 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ e04:	83 ec 0c             	sub    $0xc,%esp
+ e07:	68 00 08 00 00       	push   $0x800
+ e0c:	e8 78 fe ff ff       	call   c89 <bigalloc>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e17:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e1b:	75 07                	jne    e24 <alloc+0xca>
+      return 0;
+ e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+ e22:	eb 48                	jmp    e6c <alloc+0x112>
+    bump = (char*)p;
+ e24:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e27:	a3 c0 12 00 00       	mov    %eax,0x12c0
+    bumpend = (char*)(p + p->s.size);
+ e2c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e2f:	8b 40 04             	mov    0x4(%eax),%eax
+ e32:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e39:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e3c:	01 d0                	add    %edx,%eax
+ e3e:	a3 c4 12 00 00       	mov    %eax,0x12c4
+  }
+  p = (Header*)bump;
+ e43:	a1 c0 12 00 00       	mov    0x12c0,%eax
+ e48:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ e4b:	a1 c0 12 00 00       	mov    0x12c0,%eax
+ e50:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e53:	c1 e2 03             	shl    $0x3,%edx
+ e56:	01 d0                	add    %edx,%eax
+ e58:	a3 c0 12 00 00       	mov    %eax,0x12c0
+  p->s.size = nunits;
+ e5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e60:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e63:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ e66:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e69:	83 c0 08             	add    $0x8,%eax
+}
+ e6c:	c9                   	leave
+ e6d:	c3                   	ret
+
+00000e6e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e6e:	55                   	push   %ebp
+ e6f:	89 e5                	mov    %esp,%ebp
+ e71:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ e74:	e8 c2 fb ff ff       	call   a3b <lock>
+ e79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e7c:	83 ec 0c             	sub    $0xc,%esp
+ e7f:	ff 75 08             	push   0x8(%ebp)
+ e82:	e8 d3 fe ff ff       	call   d5a <alloc>
+ e87:	83 c4 10             	add    $0x10,%esp
+ e8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e8d:	83 ec 0c             	sub    $0xc,%esp
+ e90:	ff 75 f4             	push   -0xc(%ebp)
+ e93:	e8 df fb ff ff       	call   a77 <unlock>
+ e98:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e9e:	c9                   	leave
+ e9f:	c3                   	ret
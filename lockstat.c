@@ -0,0 +1,150 @@
+// Lock statistics.
+//
+// initlock() puts every spinlock on a registry, and the lockstat
+// device (major LOCKSTAT, /dev/lockstat) reports each one's counts
+// as a line of text: acquisitions, how many had to wait, TSC cycles
+// spent waiting and held, and the callers that acquired it most.
+// Writing anything to the device resets the counts.
+//
+// The registry has its own guard, a bare flag taken with interrupts
+// off, rather than a spinlock: initlock() runs before seginit()
+// sets up the per-CPU data that acquire() needs, and a spinlock
+// would have to register itself.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "file.h"
+
+static struct {
+  uint busy;
+  struct spinlock *head;
+} reg;
+
+// Take the registry guard.  Return the caller's eflags for unlockreg.
+static uint
+lockreg(void)
+{
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&reg.busy, 1) != 0)
+    pause();
+  return eflags;
+}
+
+static void
+unlockreg(uint eflags)
+{
+  xchg(&reg.busy, 0);
+  if(eflags & FL_IF)
+    sti();
+}
+
+static void
+clearstats(struct spinlock *lk)
+{
+  int i;
+
+  lk->nacquire = 0;
+  lk->ncontend = 0;
+  lk->spincycles = 0;
+  lk->holdcycles = 0;
+  for(i = 0; i < NLOCKPC; i++){
+    lk->callers[i] = 0;
+    lk->ncaller[i] = 0;
+  }
+}
+
+// Add lk, just initialized, to the registry.
+void
+lockregister(struct spinlock *lk)
+{
+  uint eflags;
+
+  clearstats(lk);
+  eflags = lockreg();
+  lk->lprev = 0;
+  lk->lnext = reg.head;
+  if(reg.head)
+    reg.head->lprev = lk;
+  reg.head = lk;
+  unlockreg(eflags);
+}
+
+// Take lk off the registry before its memory is reused.
+void
+lockunregister(struct spinlock *lk)
+{
+  uint eflags;
+
+  eflags = lockreg();
+  if(lk->lprev)
+    lk->lprev->lnext = lk->lnext;
+  else
+    reg.head = lk->lnext;
+  if(lk->lnext)
+    lk->lnext->lprev = lk->lprev;
+  unlockreg(eflags);
+}
+
+// Format lk's line of the report into buf.
+static void
+fmtlock(struct spinlock *lk, char *buf, int n)
+{
+  int i, len;
+
+  len = snprintf(buf, n, "%-16s %10u %8u %12u %12u", lk->name,
+                 lk->nacquire, lk->ncontend, lk->spincycles, lk->holdcycles);
+  for(i = 0; i < NLOCKPC; i++)
+    if(lk->ncaller[i])
+      len += snprintf(buf+len, n-len, " %x:%u", lk->callers[i], lk->ncaller[i]);
+  snprintf(buf+len, n-len, "\n");
+}
+
+int
+lockstatread(struct inode *ip, char *dst, uint off, int n)
+{
+  char line[160];
+  struct spinlock *lk;
+  uint eflags, pos;
+
+  pos = 0;
+  snprintf(line, sizeof(line), "%-16s %10s %8s %12s %12s %s\n", "lock",
+           "acquire", "contend", "spincycles", "holdcycles", "callers");
+  emitline(line, &pos, dst, off, n);
+  eflags = lockreg();
+  for(lk = reg.head; lk && pos < off + n; lk = lk->lnext){
+    fmtlock(lk, line, sizeof(line));
+    emitline(line, &pos, dst, off, n);
+  }
+  unlockreg(eflags);
+  if(pos <= off)
+    return 0;
+  return (pos < off + n ? pos : off + n) - off;
+}
+
+int
+lockstatwrite(struct inode *ip, char *src, uint off, int n)
+{
+  struct spinlock *lk;
+  uint eflags;
+
+  eflags = lockreg();
+  for(lk = reg.head; lk; lk = lk->lnext)
+    clearstats(lk);
+  unlockreg(eflags);
+  return n;
+}
+
+void
+lockstatinit(void)
+{
+  devsw[LOCKSTAT].read = lockstatread;
+  devsw[LOCKSTAT].write = lockstatwrite;
+}
@@ -2,20 +2,34 @@
 #include "defs.h"
 #include "param.h"
 #include "spinlock.h"
+#include "mmu.h"
+#include "proc.h"
 #include "fs.h"
 #include "buf.h"
+#include "kstat.h"
 
 // Simple logging. Each system call that might write the file system
 // should be surrounded with begin_trans() and commit_trans() calls.
 //
-// The log holds at most one transaction at a time. Commit forces
-// the log (with commit record) to disk, then installs the affected
-// blocks to disk, then erases the log. begin_trans() ensures that
-// only one system call can be in a transaction; others must wait.
+// The log holds at most one transaction at a time, but several
+// system calls can share it.  Each declares to begin_trans() the
+// most blocks it may write, and waits until the open transaction
+// has room for that many.  When the last system call in the
+// transaction calls commit_trans(), it forces the log (with commit
+// record) to disk and returns.  The flusher process then installs
+// the affected blocks to disk and erases the log; new system calls
+// wait for that before they join the next transaction.
+//
+// log_write() only records the sector: the block stays in the
+// buffer cache as a delayed write, marked B_DIRTY, which keeps it
+// from being evicted.  Writing the same block again in the same
+// transaction costs nothing more.  Commit copies each block once
+// into the log, and after the commit the flusher writes the cached
+// copy home.  The log's size is set by mkfs in sb.nlog.
 // 
-// Allowing only one transaction at a time means that the file
-// system code doesn't have to worry about the possibility of
-// one transaction reading a block that another one has modified,
+// Committing only whole groups of system calls means that the
+// file system code doesn't have to worry about one transaction
+// reading a block that another, uncommitted one has modified,
 // for example an i-node block.
 //
 // Read-only system calls don't need to use transactions, though
@@ -29,7 +43,6 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged sector #s before commit.
@@ -42,13 +55,20 @@ struct log {
   struct spinlock lock;
   int start;
   int size;
-  int busy; // a transaction is active
+  int cap;         // most blocks a transaction may log
+  int outstanding; // system calls in the open transaction
+  int reserved;    // blocks they declared to begin_trans
+  int committing;  // commit_trans is writing the header
+  int installing;  // a committed transaction awaits the flusher
+  int ncommit;     // transactions committed since boot
+  int maxcommit;   // most blocks one of them logged
   int dev;
   struct logheader lh;
 };
 struct log log;
 
 static void recover_from_log(void);
+static void flusher(void);
 
 void
 initlog(void)
@@ -61,8 +81,12 @@ initlog(void)
   readsb(ROOTDEV, &sb);
   log.start = sb.size - sb.nlog;
   log.size = sb.nlog;
+  log.cap = log.size - 1 < LOGSIZE ? log.size - 1 : LOGSIZE;
+  if (log.cap < MAXOPBLOCKS + NDIRHASH)  // mkdir, indexed
+    panic("initlog: log too small");
   log.dev = ROOTDEV;
   recover_from_log();
+  kproc("flusher", flusher);
 }
 
 // Copy committed blocks from log to their home location
@@ -112,6 +136,49 @@ write_head(void)
   brelse(buf);
 }
 
+// Write the committed transaction's blocks home from the cache.
+// Start all the writes, in sector order so the disk can merge
+// and sweep them, then wait for each to finish.
+static void
+flush_trans(void)
+{
+  int sector[LOGSIZE];
+  int i, j, n, s;
+
+  n = log.lh.n;
+  for (i = 0; i < n; i++) {
+    s = log.lh.sector[i];
+    for (j = i; j > 0 && sector[j-1] > s; j--)
+      sector[j] = sector[j-1];
+    sector[j] = s;
+  }
+  for (i = 0; i < n; i++)
+    bawrite(bread(log.dev, sector[i]));
+  for (i = 0; i < n; i++)
+    brelse(bread(log.dev, sector[i]));  // waits for the write
+}
+
+// Background process that installs committed transactions.
+static void
+flusher(void)
+{
+  for (;;) {
+    acquire(&log.lock);
+    while (!log.installing)
+      sleep(&log.installing, &log.lock);
+    release(&log.lock);
+
+    flush_trans();
+    log.lh.n = 0;
+    write_head();    // Erase the transaction from the log
+
+    acquire(&log.lock);
+    log.installing = 0;
+    wakeup(&log);
+    release(&log.lock);
+  }
+}
+
 static void
 recover_from_log(void)
 {
@@ -121,36 +188,143 @@ recover_from_log(void)
   write_head(); // clear the log
 }
 
+// Copy the open transaction's blocks from the cache into the
+// log, starting all the writes before waiting for any.
+static void
+write_log(void)
+{
+  int tail;
+  struct buf *from, *to;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+    to = bread(log.dev, log.start+tail+1);  // log block
+    from = bread(log.dev, log.lh.sector[tail]); // cached block
+    memmove(to->data, from->data, BSIZE);
+    brelse(from);
+    bawrite(to);
+  }
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(bread(log.dev, log.start+tail+1));  // waits for the write
+}
+
+// Join the open transaction, for a system call that will
+// log_write() at most nblocks distinct blocks.
 void
-begin_trans(void)
+begin_trans(int nblocks)
 {
+  if (nblocks > log.cap)
+    panic("begin_trans: too many blocks");
+
+  kstatinc(KS_TRANS);
   acquire(&log.lock);
-  while (log.busy) {
+  // The blocks already logged may be counted twice, in lh.n
+  // and in the reservations of the calls that logged them.
+  if (log.committing || log.installing ||
+      log.lh.n + log.reserved + nblocks > log.cap)
+    kstatinc(KS_TRANSWAIT);
+  while (log.committing || log.installing ||
+         log.lh.n + log.reserved + nblocks > log.cap) {
     sleep(&log, &log.lock);
   }
-  log.busy = 1;
+  log.outstanding++;
+  log.reserved += nblocks;
+  proc->logres = nblocks;
   release(&log.lock);
 }
 
+// Leave the transaction.  The last system call out commits
+// everything the group logged.
 void
 commit_trans(void)
 {
-  if (log.lh.n > 0) {
+  int docommit;
+
+  acquire(&log.lock);
+  log.outstanding--;
+  log.reserved -= proc->logres;
+  proc->logres = 0;
+  docommit = log.outstanding == 0 && log.lh.n > 0;
+  if (docommit) {
+    log.committing = 1;
+    if (log.lh.n > log.maxcommit)
+      log.maxcommit = log.lh.n;
+    kstatinc(KS_COMMIT);
+    kstatadd(KS_COMMITBLK, log.lh.n);
+  } else
+    wakeup(&log);  // our reservation is free again
+  release(&log.lock);
+
+  if (docommit) {
+    write_log();     // Write modified blocks from cache to log
     write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0; 
-    write_head();    // Erase the transaction from the log
+
+    // Leave installing to the flusher.
+    acquire(&log.lock);
+    log.committing = 0;
+    log.installing = 1;
+    log.ncommit++;
+    wakeup(&log.installing);
+    wakeup(&log.ncommit);
+    release(&log.lock);
   }
-  
+}
+
+// Return the number of the open transaction, for a caller in it
+// to remember what it changed in.  Transactions are numbered from
+// 1 in the order they commit.
+int
+log_tid(void)
+{
+  int tid;
+
+  acquire(&log.lock);
+  tid = log.ncommit + 1;
+  release(&log.lock);
+  return tid;
+}
+
+// Wait until transaction tid has committed, so that what it did
+// survives a crash.  A system call's transaction commits when the
+// last one sharing it leaves, perhaps after the call has returned.
+void
+log_wait(int tid)
+{
   acquire(&log.lock);
-  log.busy = 0;
-  wakeup(&log);
+  while (log.ncommit < tid && (log.outstanding > 0 || log.committing))
+    sleep(&log.ncommit, &log.lock);
   release(&log.lock);
 }
 
+// Report on the log for /stats/log: system calls that joined
+// transactions and how many had to wait, and commit sizes.
+void
+logstats(struct report *r)
+{
+  uint ncommit;
+
+  ncommit = kstatsum(KS_COMMIT);
+  report(r, "transactions", kstatsum(KS_TRANS));
+  report(r, "waits", kstatsum(KS_TRANSWAIT));
+  report(r, "commits", ncommit);
+  report(r, "blocks", kstatsum(KS_COMMITBLK));
+  report(r, "blockspercommit", ncommit ? kstatsum(KS_COMMITBLK) / ncommit : 0);
+  report(r, "maxblocks", log.maxcommit);
+  report(r, "cap", log.cap);
+  report(r, "outstanding", log.outstanding);
+}
+
+// Most blocks one system call should declare to begin_trans(),
+// leaving room in the log for others; big writes are cut up
+// into pieces this size.
+int
+log_maxblocks(void)
+{
+  return log.cap/2 > MAXOPBLOCKS ? log.cap/2 : MAXOPBLOCKS;
+}
+
 // Caller has modified b->data and is done with the buffer.
-// Append the block to the log and record the block number, 
-// but don't write the log header (which would commit the write).
+// Record the block number and keep the block in the cache
+// until commit; a repeated write of it is absorbed.
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
 //   modify bp->data[]
@@ -161,23 +335,21 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
-  if (!log.busy)
+  acquire(&log.lock);
+  if (log.outstanding < 1)
     panic("write outside of trans");
-
   for (i = 0; i < log.lh.n; i++) {
     if (log.lh.sector[i] == b->sector)   // log absorbtion?
       break;
   }
-  log.lh.sector[i] = b->sector;
-  struct buf *lbuf = bread(b->dev, log.start+i+1);
-  memmove(lbuf->data, b->data, BSIZE);
-  bwrite(lbuf);
-  brelse(lbuf);
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    if (log.lh.n >= log.cap)
+      panic("too big a transaction");
+    log.lh.sector[i] = b->sector;
     log.lh.n++;
-  b->flags |= B_DIRTY; // XXX prevent eviction
+  }
+  b->flags |= B_DIRTY; // prevent eviction until installed
+  release(&log.lock);
 }
 
 //PAGEBREAK!
@@ -0,0 +1,2043 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "fcntl.h"
+#include "dent.h"
+
+char*
+fmtname(char *path)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+       7:	83 ec 0c             	sub    $0xc,%esp
+       a:	ff 75 08             	push   0x8(%ebp)
+       d:	e8 33 03 00 00       	call   345 <strlen>
+      12:	83 c4 10             	add    $0x10,%esp
+      15:	8b 55 08             	mov    0x8(%ebp),%edx
+      18:	01 d0                	add    %edx,%eax
+      1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      1d:	eb 04                	jmp    23 <fmtname+0x23>
+      1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+      23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      26:	3b 45 08             	cmp    0x8(%ebp),%eax
+      29:	72 0a                	jb     35 <fmtname+0x35>
+      2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      2e:	0f b6 00             	movzbl (%eax),%eax
+      31:	3c 2f                	cmp    $0x2f,%al
+      33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+      35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+      39:	83 ec 0c             	sub    $0xc,%esp
+      3c:	ff 75 f4             	push   -0xc(%ebp)
+      3f:	e8 01 03 00 00       	call   345 <strlen>
+      44:	83 c4 10             	add    $0x10,%esp
+      47:	83 f8 0d             	cmp    $0xd,%eax
+      4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+      4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	ff 75 f4             	push   -0xc(%ebp)
+      57:	e8 e9 02 00 00       	call   345 <strlen>
+      5c:	83 c4 10             	add    $0x10,%esp
+      5f:	83 ec 04             	sub    $0x4,%esp
+      62:	50                   	push   %eax
+      63:	ff 75 f4             	push   -0xc(%ebp)
+      66:	68 a4 14 00 00       	push   $0x14a4
+      6b:	e8 52 04 00 00       	call   4c2 <memmove>
+      70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      73:	83 ec 0c             	sub    $0xc,%esp
+      76:	ff 75 f4             	push   -0xc(%ebp)
+      79:	e8 c7 02 00 00       	call   345 <strlen>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	ba 0e 00 00 00       	mov    $0xe,%edx
+      86:	89 d3                	mov    %edx,%ebx
+      88:	29 c3                	sub    %eax,%ebx
+      8a:	83 ec 0c             	sub    $0xc,%esp
+      8d:	ff 75 f4             	push   -0xc(%ebp)
+      90:	e8 b0 02 00 00       	call   345 <strlen>
+      95:	83 c4 10             	add    $0x10,%esp
+      98:	05 a4 14 00 00       	add    $0x14a4,%eax
+      9d:	83 ec 04             	sub    $0x4,%esp
+      a0:	53                   	push   %ebx
+      a1:	6a 20                	push   $0x20
+      a3:	50                   	push   %eax
+      a4:	e8 c3 02 00 00       	call   36c <memset>
+      a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+      ac:	b8 a4 14 00 00       	mov    $0x14a4,%eax
+}
+      b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      b4:	c9                   	leave
+      b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+      b6:	55                   	push   %ebp
+      b7:	89 e5                	mov    %esp,%ebp
+      b9:	57                   	push   %edi
+      ba:	56                   	push   %esi
+      bb:	53                   	push   %ebx
+      bc:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+  int fd, i, n;
+  struct dent d[16];
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	6a 00                	push   $0x0
+      c7:	ff 75 08             	push   0x8(%ebp)
+      ca:	e8 b0 04 00 00       	call   57f <open>
+      cf:	83 c4 10             	add    $0x10,%esp
+      d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      d5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+      d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+      db:	83 ec 04             	sub    $0x4,%esp
+      de:	ff 75 08             	push   0x8(%ebp)
+      e1:	68 71 10 00 00       	push   $0x1071
+      e6:	6a 02                	push   $0x2
+      e8:	e8 ea 08 00 00       	call   9d7 <printf>
+      ed:	83 c4 10             	add    $0x10,%esp
+    return;
+      f0:	e9 4f 01 00 00       	jmp    244 <ls+0x18e>
+  }
+  
+  if(fstat(fd, &st) < 0){
+      f5:	83 ec 08             	sub    $0x8,%esp
+      f8:	8d 85 08 fe ff ff    	lea    -0x1f8(%ebp),%eax
+      fe:	50                   	push   %eax
+      ff:	ff 75 e0             	push   -0x20(%ebp)
+     102:	e8 96 04 00 00       	call   59d <fstat>
+     107:	83 c4 10             	add    $0x10,%esp
+     10a:	85 c0                	test   %eax,%eax
+     10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+     10e:	83 ec 04             	sub    $0x4,%esp
+     111:	ff 75 08             	push   0x8(%ebp)
+     114:	68 85 10 00 00       	push   $0x1085
+     119:	6a 02                	push   $0x2
+     11b:	e8 b7 08 00 00       	call   9d7 <printf>
+     120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     123:	83 ec 0c             	sub    $0xc,%esp
+     126:	ff 75 e0             	push   -0x20(%ebp)
+     129:	e8 3c 04 00 00       	call   56a <close>
+     12e:	83 c4 10             	add    $0x10,%esp
+    return;
+     131:	e9 0e 01 00 00       	jmp    244 <ls+0x18e>
+  }
+  
+  switch(st.type){
+     136:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%ebp),%eax
+     13d:	98                   	cwtl
+     13e:	83 f8 01             	cmp    $0x1,%eax
+     141:	0f 84 ca 00 00 00    	je     211 <ls+0x15b>
+     147:	83 f8 02             	cmp    $0x2,%eax
+     14a:	0f 85 e6 00 00 00    	jne    236 <ls+0x180>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     150:	8b bd 18 fe ff ff    	mov    -0x1e8(%ebp),%edi
+     156:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+     15c:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%ebp),%eax
+     163:	0f bf d8             	movswl %ax,%ebx
+     166:	83 ec 0c             	sub    $0xc,%esp
+     169:	ff 75 08             	push   0x8(%ebp)
+     16c:	e8 8f fe ff ff       	call   0 <fmtname>
+     171:	83 c4 10             	add    $0x10,%esp
+     174:	83 ec 08             	sub    $0x8,%esp
+     177:	57                   	push   %edi
+     178:	56                   	push   %esi
+     179:	53                   	push   %ebx
+     17a:	50                   	push   %eax
+     17b:	68 99 10 00 00       	push   $0x1099
+     180:	6a 01                	push   $0x1
+     182:	e8 50 08 00 00       	call   9d7 <printf>
+     187:	83 c4 20             	add    $0x20,%esp
+    break;
+     18a:	e9 a7 00 00 00       	jmp    236 <ls+0x180>
+  
+  case T_DIR:
+    // Each entry comes with its inode's type and size.
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+      for(i = 0; i < n; i++)
+     18f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     196:	eb 71                	jmp    209 <ls+0x153>
+        printf(1, "%s %d %d %d\n", fmtname(d[i].name), d[i].type, d[i].ino, d[i].size);
+     198:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     19b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     19e:	8d 40 e8             	lea    -0x18(%eax),%eax
+     1a1:	01 e8                	add    %ebp,%eax
+     1a3:	2d c4 01 00 00       	sub    $0x1c4,%eax
+     1a8:	8b 38                	mov    (%eax),%edi
+     1aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1ad:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     1b0:	8d 40 e8             	lea    -0x18(%eax),%eax
+     1b3:	01 e8                	add    %ebp,%eax
+     1b5:	2d cc 01 00 00       	sub    $0x1cc,%eax
+     1ba:	8b 30                	mov    (%eax),%esi
+     1bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1bf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     1c2:	8d 40 e8             	lea    -0x18(%eax),%eax
+     1c5:	01 e8                	add    %ebp,%eax
+     1c7:	2d c8 01 00 00       	sub    $0x1c8,%eax
+     1cc:	0f b7 00             	movzwl (%eax),%eax
+     1cf:	0f bf d8             	movswl %ax,%ebx
+     1d2:	8d 95 1c fe ff ff    	lea    -0x1e4(%ebp),%edx
+     1d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1db:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     1de:	01 d0                	add    %edx,%eax
+     1e0:	83 c0 0c             	add    $0xc,%eax
+     1e3:	83 ec 0c             	sub    $0xc,%esp
+     1e6:	50                   	push   %eax
+     1e7:	e8 14 fe ff ff       	call   0 <fmtname>
+     1ec:	83 c4 10             	add    $0x10,%esp
+     1ef:	83 ec 08             	sub    $0x8,%esp
+     1f2:	57                   	push   %edi
+     1f3:	56                   	push   %esi
+     1f4:	53                   	push   %ebx
+     1f5:	50                   	push   %eax
+     1f6:	68 99 10 00 00       	push   $0x1099
+     1fb:	6a 01                	push   $0x1
+     1fd:	e8 d5 07 00 00       	call   9d7 <printf>
+     202:	83 c4 20             	add    $0x20,%esp
+      for(i = 0; i < n; i++)
+     205:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     209:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     20c:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+     20f:	7c 87                	jl     198 <ls+0xe2>
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+     211:	83 ec 04             	sub    $0x4,%esp
+     214:	6a 10                	push   $0x10
+     216:	8d 85 1c fe ff ff    	lea    -0x1e4(%ebp),%eax
+     21c:	50                   	push   %eax
+     21d:	ff 75 e0             	push   -0x20(%ebp)
+     220:	e8 e0 04 00 00       	call   705 <getdents>
+     225:	83 c4 10             	add    $0x10,%esp
+     228:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     22b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+     22f:	0f 8f 5a ff ff ff    	jg     18f <ls+0xd9>
+    break;
+     235:	90                   	nop
+  }
+  close(fd);
+     236:	83 ec 0c             	sub    $0xc,%esp
+     239:	ff 75 e0             	push   -0x20(%ebp)
+     23c:	e8 29 03 00 00       	call   56a <close>
+     241:	83 c4 10             	add    $0x10,%esp
+}
+     244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     247:	5b                   	pop    %ebx
+     248:	5e                   	pop    %esi
+     249:	5f                   	pop    %edi
+     24a:	5d                   	pop    %ebp
+     24b:	c3                   	ret
+
+0000024c <main>:
+
+int
+main(int argc, char *argv[])
+{
+     24c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     250:	83 e4 f0             	and    $0xfffffff0,%esp
+     253:	ff 71 fc             	push   -0x4(%ecx)
+     256:	55                   	push   %ebp
+     257:	89 e5                	mov    %esp,%ebp
+     259:	53                   	push   %ebx
+     25a:	51                   	push   %ecx
+     25b:	83 ec 10             	sub    $0x10,%esp
+     25e:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+     260:	83 3b 01             	cmpl   $0x1,(%ebx)
+     263:	7f 15                	jg     27a <main+0x2e>
+    ls(".");
+     265:	83 ec 0c             	sub    $0xc,%esp
+     268:	68 a6 10 00 00       	push   $0x10a6
+     26d:	e8 44 fe ff ff       	call   b6 <ls>
+     272:	83 c4 10             	add    $0x10,%esp
+    exit();
+     275:	e8 cd 02 00 00       	call   547 <exit>
+  }
+  for(i=1; i<argc; i++)
+     27a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+     281:	eb 21                	jmp    2a4 <main+0x58>
+    ls(argv[i]);
+     283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     286:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     28d:	8b 43 04             	mov    0x4(%ebx),%eax
+     290:	01 d0                	add    %edx,%eax
+     292:	8b 00                	mov    (%eax),%eax
+     294:	83 ec 0c             	sub    $0xc,%esp
+     297:	50                   	push   %eax
+     298:	e8 19 fe ff ff       	call   b6 <ls>
+     29d:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+     2a0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     2a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2a7:	3b 03                	cmp    (%ebx),%eax
+     2a9:	7c d8                	jl     283 <main+0x37>
+  exit();
+     2ab:	e8 97 02 00 00       	call   547 <exit>
+
+000002b0 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	57                   	push   %edi
+     2b4:	53                   	push   %ebx
+    if(cc < 1)
+     2b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2b8:	8b 55 10             	mov    0x10(%ebp),%edx
+     2bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2be:	89 cb                	mov    %ecx,%ebx
+     2c0:	89 df                	mov    %ebx,%edi
+     2c2:	89 d1                	mov    %edx,%ecx
+     2c4:	fc                   	cld
+     2c5:	f3 aa                	rep stos %al,%es:(%edi)
+     2c7:	89 ca                	mov    %ecx,%edx
+     2c9:	89 fb                	mov    %edi,%ebx
+     2cb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2ce:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     2d1:	90                   	nop
+     2d2:	5b                   	pop    %ebx
+     2d3:	5f                   	pop    %edi
+     2d4:	5d                   	pop    %ebp
+     2d5:	c3                   	ret
+
+000002d6 <strcpy>:
+{
+     2d6:	55                   	push   %ebp
+     2d7:	89 e5                	mov    %esp,%ebp
+     2d9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2dc:	8b 45 08             	mov    0x8(%ebp),%eax
+     2df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2e2:	90                   	nop
+     2e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2e6:	8d 42 01             	lea    0x1(%edx),%eax
+     2e9:	89 45 0c             	mov    %eax,0xc(%ebp)
+     2ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ef:	8d 48 01             	lea    0x1(%eax),%ecx
+     2f2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     2f5:	0f b6 12             	movzbl (%edx),%edx
+     2f8:	88 10                	mov    %dl,(%eax)
+     2fa:	0f b6 00             	movzbl (%eax),%eax
+     2fd:	84 c0                	test   %al,%al
+     2ff:	75 e2                	jne    2e3 <strcpy+0xd>
+  return os;
+     301:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     304:	c9                   	leave
+     305:	c3                   	ret
+
+00000306 <strcmp>:
+{
+     306:	55                   	push   %ebp
+     307:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     309:	eb 08                	jmp    313 <strcmp+0xd>
+    p++, q++;
+     30b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     30f:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     313:	8b 45 08             	mov    0x8(%ebp),%eax
+     316:	0f b6 00             	movzbl (%eax),%eax
+     319:	84 c0                	test   %al,%al
+     31b:	74 10                	je     32d <strcmp+0x27>
+     31d:	8b 45 08             	mov    0x8(%ebp),%eax
+     320:	0f b6 10             	movzbl (%eax),%edx
+     323:	8b 45 0c             	mov    0xc(%ebp),%eax
+     326:	0f b6 00             	movzbl (%eax),%eax
+     329:	38 c2                	cmp    %al,%dl
+     32b:	74 de                	je     30b <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     32d:	8b 45 08             	mov    0x8(%ebp),%eax
+     330:	0f b6 00             	movzbl (%eax),%eax
+     333:	0f b6 d0             	movzbl %al,%edx
+     336:	8b 45 0c             	mov    0xc(%ebp),%eax
+     339:	0f b6 00             	movzbl (%eax),%eax
+     33c:	0f b6 c0             	movzbl %al,%eax
+     33f:	29 c2                	sub    %eax,%edx
+     341:	89 d0                	mov    %edx,%eax
+}
+     343:	5d                   	pop    %ebp
+     344:	c3                   	ret
+
+00000345 <strlen>:
+{
+     345:	55                   	push   %ebp
+     346:	89 e5                	mov    %esp,%ebp
+     348:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     34b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     352:	eb 04                	jmp    358 <strlen+0x13>
+     354:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     358:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     35b:	8b 45 08             	mov    0x8(%ebp),%eax
+     35e:	01 d0                	add    %edx,%eax
+     360:	0f b6 00             	movzbl (%eax),%eax
+     363:	84 c0                	test   %al,%al
+     365:	75 ed                	jne    354 <strlen+0xf>
+  return n;
+     367:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     36a:	c9                   	leave
+     36b:	c3                   	ret
+
+0000036c <memset>:
+{
+     36c:	55                   	push   %ebp
+     36d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     36f:	8b 45 10             	mov    0x10(%ebp),%eax
+     372:	50                   	push   %eax
+     373:	ff 75 0c             	push   0xc(%ebp)
+     376:	ff 75 08             	push   0x8(%ebp)
+     379:	e8 32 ff ff ff       	call   2b0 <stosb>
+     37e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     381:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     384:	c9                   	leave
+     385:	c3                   	ret
+
+00000386 <strchr>:
+{
+     386:	55                   	push   %ebp
+     387:	89 e5                	mov    %esp,%ebp
+     389:	83 ec 04             	sub    $0x4,%esp
+     38c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     38f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     392:	eb 14                	jmp    3a8 <strchr+0x22>
+    if(*s == c)
+     394:	8b 45 08             	mov    0x8(%ebp),%eax
+     397:	0f b6 00             	movzbl (%eax),%eax
+     39a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     39d:	75 05                	jne    3a4 <strchr+0x1e>
+      return (char*)s;
+     39f:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a2:	eb 13                	jmp    3b7 <strchr+0x31>
+  for(; *s; s++)
+     3a4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ab:	0f b6 00             	movzbl (%eax),%eax
+     3ae:	84 c0                	test   %al,%al
+     3b0:	75 e2                	jne    394 <strchr+0xe>
+  return 0;
+     3b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3b7:	c9                   	leave
+     3b8:	c3                   	ret
+
+000003b9 <gets>:
+{
+     3b9:	55                   	push   %ebp
+     3ba:	89 e5                	mov    %esp,%ebp
+     3bc:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     3bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3c6:	eb 42                	jmp    40a <gets+0x51>
+    cc = read(0, &c, 1);
+     3c8:	83 ec 04             	sub    $0x4,%esp
+     3cb:	6a 01                	push   $0x1
+     3cd:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     3d0:	50                   	push   %eax
+     3d1:	6a 00                	push   $0x0
+     3d3:	e8 84 01 00 00       	call   55c <read>
+     3d8:	83 c4 10             	add    $0x10,%esp
+     3db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     3de:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e2:	7e 33                	jle    417 <gets+0x5e>
+    buf[i++] = c;
+     3e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3e7:	8d 50 01             	lea    0x1(%eax),%edx
+     3ea:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     3ed:	89 c2                	mov    %eax,%edx
+     3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f2:	01 c2                	add    %eax,%edx
+     3f4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3f8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     3fa:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3fe:	3c 0a                	cmp    $0xa,%al
+     400:	74 16                	je     418 <gets+0x5f>
+     402:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     406:	3c 0d                	cmp    $0xd,%al
+     408:	74 0e                	je     418 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     40a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     40d:	83 c0 01             	add    $0x1,%eax
+     410:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     413:	7f b3                	jg     3c8 <gets+0xf>
+     415:	eb 01                	jmp    418 <gets+0x5f>
+      break;
+     417:	90                   	nop
+  }
+  buf[i] = '\0';
+     418:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     41b:	8b 45 08             	mov    0x8(%ebp),%eax
+     41e:	01 d0                	add    %edx,%eax
+     420:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     423:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     426:	c9                   	leave
+     427:	c3                   	ret
+
+00000428 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     428:	55                   	push   %ebp
+     429:	89 e5                	mov    %esp,%ebp
+     42b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     42e:	83 ec 08             	sub    $0x8,%esp
+     431:	6a 00                	push   $0x0
+     433:	ff 75 08             	push   0x8(%ebp)
+     436:	e8 44 01 00 00       	call   57f <open>
+     43b:	83 c4 10             	add    $0x10,%esp
+     43e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     441:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     445:	79 07                	jns    44e <stat+0x26>
+    return -1;
+     447:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     44c:	eb 25                	jmp    473 <stat+0x4b>
+  r = fstat(fd, st);
+     44e:	83 ec 08             	sub    $0x8,%esp
+     451:	ff 75 0c             	push   0xc(%ebp)
+     454:	ff 75 f4             	push   -0xc(%ebp)
+     457:	e8 41 01 00 00       	call   59d <fstat>
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     462:	83 ec 0c             	sub    $0xc,%esp
+     465:	ff 75 f4             	push   -0xc(%ebp)
+     468:	e8 fd 00 00 00       	call   56a <close>
+     46d:	83 c4 10             	add    $0x10,%esp
+  return r;
+     470:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     473:	c9                   	leave
+     474:	c3                   	ret
+
+00000475 <atoi>:
+
+int
+atoi(const char *s)
+{
+     475:	55                   	push   %ebp
+     476:	89 e5                	mov    %esp,%ebp
+     478:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     47b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     482:	eb 25                	jmp    4a9 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     484:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     487:	89 d0                	mov    %edx,%eax
+     489:	c1 e0 02             	shl    $0x2,%eax
+     48c:	01 d0                	add    %edx,%eax
+     48e:	01 c0                	add    %eax,%eax
+     490:	89 c1                	mov    %eax,%ecx
+     492:	8b 45 08             	mov    0x8(%ebp),%eax
+     495:	8d 50 01             	lea    0x1(%eax),%edx
+     498:	89 55 08             	mov    %edx,0x8(%ebp)
+     49b:	0f b6 00             	movzbl (%eax),%eax
+     49e:	0f be c0             	movsbl %al,%eax
+     4a1:	01 c8                	add    %ecx,%eax
+     4a3:	83 e8 30             	sub    $0x30,%eax
+     4a6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ac:	0f b6 00             	movzbl (%eax),%eax
+     4af:	3c 2f                	cmp    $0x2f,%al
+     4b1:	7e 0a                	jle    4bd <atoi+0x48>
+     4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b6:	0f b6 00             	movzbl (%eax),%eax
+     4b9:	3c 39                	cmp    $0x39,%al
+     4bb:	7e c7                	jle    484 <atoi+0xf>
+  return n;
+     4bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4c0:	c9                   	leave
+     4c1:	c3                   	ret
+
+000004c2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4c2:	55                   	push   %ebp
+     4c3:	89 e5                	mov    %esp,%ebp
+     4c5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4cb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     4ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4d1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     4d4:	eb 17                	jmp    4ed <memmove+0x2b>
+    *dst++ = *src++;
+     4d6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4d9:	8d 42 01             	lea    0x1(%edx),%eax
+     4dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4e2:	8d 48 01             	lea    0x1(%eax),%ecx
+     4e5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     4e8:	0f b6 12             	movzbl (%edx),%edx
+     4eb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     4ed:	8b 45 10             	mov    0x10(%ebp),%eax
+     4f0:	8d 50 ff             	lea    -0x1(%eax),%edx
+     4f3:	89 55 10             	mov    %edx,0x10(%ebp)
+     4f6:	85 c0                	test   %eax,%eax
+     4f8:	7f dc                	jg     4d6 <memmove+0x14>
+  return vdst;
+     4fa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4fd:	c9                   	leave
+     4fe:	c3                   	ret
+
+000004ff <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     4ff:	83 3d 8c 14 00 00 00 	cmpl   $0x0,0x148c
+  jg 2f
+     506:	7f 2e                	jg     536 <dosyscall+0x37>
+  jl 1f
+     508:	7c 29                	jl     533 <dosyscall+0x34>
+  pushl %eax
+     50a:	50                   	push   %eax
+  pushl %ebx
+     50b:	53                   	push   %ebx
+  movl $1, %eax
+     50c:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     511:	0f a2                	cpuid
+  popl %ebx
+     513:	5b                   	pop    %ebx
+  popl %eax
+     514:	58                   	pop    %eax
+  movl $-1, sysmode
+     515:	c7 05 8c 14 00 00 ff 	movl   $0xffffffff,0x148c
+     51c:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     51f:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     525:	74 0c                	je     533 <dosyscall+0x34>
+  movl $1, sysmode
+     527:	c7 05 8c 14 00 00 01 	movl   $0x1,0x148c
+     52e:	00 00 00 
+  jmp 2f
+     531:	eb 03                	jmp    536 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     533:	cd 40                	int    $0x40
+  ret
+     535:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     536:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     538:	ba 3f 05 00 00       	mov    $0x53f,%edx
+  sysenter
+     53d:	0f 34                	sysenter
+3:
+  ret
+     53f:	c3                   	ret
+
+00000540 <fork>:
+
+SYSCALL(fork)
+     540:	b8 01 00 00 00       	mov    $0x1,%eax
+     545:	eb b8                	jmp    4ff <dosyscall>
+
+00000547 <exit>:
+SYSCALL(exit)
+     547:	b8 02 00 00 00       	mov    $0x2,%eax
+     54c:	eb b1                	jmp    4ff <dosyscall>
+
+0000054e <wait>:
+SYSCALL(wait)
+     54e:	b8 03 00 00 00       	mov    $0x3,%eax
+     553:	eb aa                	jmp    4ff <dosyscall>
+
+00000555 <pipe>:
+SYSCALL(pipe)
+     555:	b8 04 00 00 00       	mov    $0x4,%eax
+     55a:	eb a3                	jmp    4ff <dosyscall>
+
+0000055c <read>:
+SYSCALL(read)
+     55c:	b8 05 00 00 00       	mov    $0x5,%eax
+     561:	eb 9c                	jmp    4ff <dosyscall>
+
+00000563 <write>:
+SYSCALL(write)
+     563:	b8 10 00 00 00       	mov    $0x10,%eax
+     568:	eb 95                	jmp    4ff <dosyscall>
+
+0000056a <close>:
+SYSCALL(close)
+     56a:	b8 15 00 00 00       	mov    $0x15,%eax
+     56f:	eb 8e                	jmp    4ff <dosyscall>
+
+00000571 <kill>:
+SYSCALL(kill)
+     571:	b8 06 00 00 00       	mov    $0x6,%eax
+     576:	eb 87                	jmp    4ff <dosyscall>
+
+00000578 <exec>:
+SYSCALL(exec)
+     578:	b8 07 00 00 00       	mov    $0x7,%eax
+     57d:	eb 80                	jmp    4ff <dosyscall>
+
+0000057f <open>:
+SYSCALL(open)
+     57f:	b8 0f 00 00 00       	mov    $0xf,%eax
+     584:	e9 76 ff ff ff       	jmp    4ff <dosyscall>
+
+00000589 <mknod>:
+SYSCALL(mknod)
+     589:	b8 11 00 00 00       	mov    $0x11,%eax
+     58e:	e9 6c ff ff ff       	jmp    4ff <dosyscall>
+
+00000593 <unlink>:
+SYSCALL(unlink)
+     593:	b8 12 00 00 00       	mov    $0x12,%eax
+     598:	e9 62 ff ff ff       	jmp    4ff <dosyscall>
+
+0000059d <fstat>:
+SYSCALL(fstat)
+     59d:	b8 08 00 00 00       	mov    $0x8,%eax
+     5a2:	e9 58 ff ff ff       	jmp    4ff <dosyscall>
+
+000005a7 <link>:
+SYSCALL(link)
+     5a7:	b8 13 00 00 00       	mov    $0x13,%eax
+     5ac:	e9 4e ff ff ff       	jmp    4ff <dosyscall>
+
+000005b1 <mkdir>:
+SYSCALL(mkdir)
+     5b1:	b8 14 00 00 00       	mov    $0x14,%eax
+     5b6:	e9 44 ff ff ff       	jmp    4ff <dosyscall>
+
+000005bb <chdir>:
+SYSCALL(chdir)
+     5bb:	b8 09 00 00 00       	mov    $0x9,%eax
+     5c0:	e9 3a ff ff ff       	jmp    4ff <dosyscall>
+
+000005c5 <dup>:
+SYSCALL(dup)
+     5c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5ca:	e9 30 ff ff ff       	jmp    4ff <dosyscall>
+
+000005cf <getpid>:
+SYSCALL(getpid)
+     5cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5d4:	e9 26 ff ff ff       	jmp    4ff <dosyscall>
+
+000005d9 <sbrk>:
+SYSCALL(sbrk)
+     5d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5de:	e9 1c ff ff ff       	jmp    4ff <dosyscall>
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+     5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5e8:	e9 12 ff ff ff       	jmp    4ff <dosyscall>
+
+000005ed <uptime>:
+SYSCALL(uptime)
+     5ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5f2:	e9 08 ff ff ff       	jmp    4ff <dosyscall>
+
+000005f7 <symlink>:
+SYSCALL(symlink)
+     5f7:	b8 16 00 00 00       	mov    $0x16,%eax
+     5fc:	e9 fe fe ff ff       	jmp    4ff <dosyscall>
+
+00000601 <readlink>:
+SYSCALL(readlink)
+     601:	b8 17 00 00 00       	mov    $0x17,%eax
+     606:	e9 f4 fe ff ff       	jmp    4ff <dosyscall>
+
+0000060b <fprot>:
+SYSCALL(fprot)
+     60b:	b8 18 00 00 00       	mov    $0x18,%eax
+     610:	e9 ea fe ff ff       	jmp    4ff <dosyscall>
+
+00000615 <funprot>:
+SYSCALL(funprot)
+     615:	b8 19 00 00 00       	mov    $0x19,%eax
+     61a:	e9 e0 fe ff ff       	jmp    4ff <dosyscall>
+
+0000061f <funlock>:
+SYSCALL(funlock)
+     61f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     624:	e9 d6 fe ff ff       	jmp    4ff <dosyscall>
+
+00000629 <mmap>:
+SYSCALL(mmap)
+     629:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     62e:	e9 cc fe ff ff       	jmp    4ff <dosyscall>
+
+00000633 <munmap>:
+SYSCALL(munmap)
+     633:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     638:	e9 c2 fe ff ff       	jmp    4ff <dosyscall>
+
+0000063d <sendfile>:
+SYSCALL(sendfile)
+     63d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     642:	e9 b8 fe ff ff       	jmp    4ff <dosyscall>
+
+00000647 <readv>:
+SYSCALL(readv)
+     647:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     64c:	e9 ae fe ff ff       	jmp    4ff <dosyscall>
+
+00000651 <writev>:
+SYSCALL(writev)
+     651:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     656:	e9 a4 fe ff ff       	jmp    4ff <dosyscall>
+
+0000065b <pread>:
+SYSCALL(pread)
+     65b:	b8 20 00 00 00       	mov    $0x20,%eax
+     660:	e9 9a fe ff ff       	jmp    4ff <dosyscall>
+
+00000665 <pwrite>:
+SYSCALL(pwrite)
+     665:	b8 21 00 00 00       	mov    $0x21,%eax
+     66a:	e9 90 fe ff ff       	jmp    4ff <dosyscall>
+
+0000066f <lseek>:
+SYSCALL(lseek)
+     66f:	b8 22 00 00 00       	mov    $0x22,%eax
+     674:	e9 86 fe ff ff       	jmp    4ff <dosyscall>
+
+00000679 <spawn>:
+SYSCALL(spawn)
+     679:	b8 23 00 00 00       	mov    $0x23,%eax
+     67e:	e9 7c fe ff ff       	jmp    4ff <dosyscall>
+
+00000683 <setpriority>:
+SYSCALL(setpriority)
+     683:	b8 24 00 00 00       	mov    $0x24,%eax
+     688:	e9 72 fe ff ff       	jmp    4ff <dosyscall>
+
+0000068d <kthread_create>:
+SYSCALL(kthread_create)
+     68d:	b8 25 00 00 00       	mov    $0x25,%eax
+     692:	e9 68 fe ff ff       	jmp    4ff <dosyscall>
+
+00000697 <kthread_id>:
+SYSCALL(kthread_id)
+     697:	b8 26 00 00 00       	mov    $0x26,%eax
+     69c:	e9 5e fe ff ff       	jmp    4ff <dosyscall>
+
+000006a1 <kthread_exit>:
+SYSCALL(kthread_exit)
+     6a1:	b8 27 00 00 00       	mov    $0x27,%eax
+     6a6:	e9 54 fe ff ff       	jmp    4ff <dosyscall>
+
+000006ab <kthread_join>:
+SYSCALL(kthread_join)
+     6ab:	b8 28 00 00 00       	mov    $0x28,%eax
+     6b0:	e9 4a fe ff ff       	jmp    4ff <dosyscall>
+
+000006b5 <futex>:
+SYSCALL(futex)
+     6b5:	b8 29 00 00 00       	mov    $0x29,%eax
+     6ba:	e9 40 fe ff ff       	jmp    4ff <dosyscall>
+
+000006bf <signal>:
+SYSCALL(signal)
+     6bf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     6c4:	e9 36 fe ff ff       	jmp    4ff <dosyscall>
+
+000006c9 <alarm>:
+SYSCALL(alarm)
+     6c9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6ce:	e9 2c fe ff ff       	jmp    4ff <dosyscall>
+
+000006d3 <usleep>:
+SYSCALL(usleep)
+     6d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6d8:	e9 22 fe ff ff       	jmp    4ff <dosyscall>
+
+000006dd <ioring_setup>:
+SYSCALL(ioring_setup)
+     6dd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6e2:	e9 18 fe ff ff       	jmp    4ff <dosyscall>
+
+000006e7 <ioring_enter>:
+SYSCALL(ioring_enter)
+     6e7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6ec:	e9 0e fe ff ff       	jmp    4ff <dosyscall>
+
+000006f1 <getrusage>:
+SYSCALL(getrusage)
+     6f1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6f6:	e9 04 fe ff ff       	jmp    4ff <dosyscall>
+
+000006fb <mount>:
+SYSCALL(mount)
+     6fb:	b8 30 00 00 00       	mov    $0x30,%eax
+     700:	e9 fa fd ff ff       	jmp    4ff <dosyscall>
+
+00000705 <getdents>:
+SYSCALL(getdents)
+     705:	b8 31 00 00 00       	mov    $0x31,%eax
+     70a:	e9 f0 fd ff ff       	jmp    4ff <dosyscall>
+
+0000070f <yield>:
+SYSCALL(yield)
+     70f:	b8 32 00 00 00       	mov    $0x32,%eax
+     714:	e9 e6 fd ff ff       	jmp    4ff <dosyscall>
+
+00000719 <ncpu>:
+SYSCALL(ncpu)
+     719:	b8 33 00 00 00       	mov    $0x33,%eax
+     71e:	e9 dc fd ff ff       	jmp    4ff <dosyscall>
+
+00000723 <fallocate>:
+SYSCALL(fallocate)
+     723:	b8 34 00 00 00       	mov    $0x34,%eax
+     728:	e9 d2 fd ff ff       	jmp    4ff <dosyscall>
+
+0000072d <ftruncate>:
+SYSCALL(ftruncate)
+     72d:	b8 35 00 00 00       	mov    $0x35,%eax
+     732:	e9 c8 fd ff ff       	jmp    4ff <dosyscall>
+
+00000737 <fsync>:
+SYSCALL(fsync)
+     737:	b8 36 00 00 00       	mov    $0x36,%eax
+     73c:	e9 be fd ff ff       	jmp    4ff <dosyscall>
+
+00000741 <fdatasync>:
+SYSCALL(fdatasync)
+     741:	b8 37 00 00 00       	mov    $0x37,%eax
+     746:	e9 b4 fd ff ff       	jmp    4ff <dosyscall>
+
+0000074b <poll>:
+SYSCALL(poll)
+     74b:	b8 38 00 00 00       	mov    $0x38,%eax
+     750:	e9 aa fd ff ff       	jmp    4ff <dosyscall>
+
+00000755 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     755:	55                   	push   %ebp
+     756:	89 e5                	mov    %esp,%ebp
+     758:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     75b:	8b 45 08             	mov    0x8(%ebp),%eax
+     75e:	8b 40 04             	mov    0x4(%eax),%eax
+     761:	85 c0                	test   %eax,%eax
+     763:	7e 1f                	jle    784 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     765:	8b 45 08             	mov    0x8(%ebp),%eax
+     768:	8b 50 04             	mov    0x4(%eax),%edx
+     76b:	8b 45 08             	mov    0x8(%ebp),%eax
+     76e:	8d 48 08             	lea    0x8(%eax),%ecx
+     771:	8b 45 08             	mov    0x8(%ebp),%eax
+     774:	8b 00                	mov    (%eax),%eax
+     776:	83 ec 04             	sub    $0x4,%esp
+     779:	52                   	push   %edx
+     77a:	51                   	push   %ecx
+     77b:	50                   	push   %eax
+     77c:	e8 d0 fe ff ff       	call   651 <writev>
+     781:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     784:	8b 45 08             	mov    0x8(%ebp),%eax
+     787:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     78e:	8b 45 08             	mov    0x8(%ebp),%eax
+     791:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     798:	00 00 00 
+}
+     79b:	90                   	nop
+     79c:	c9                   	leave
+     79d:	c3                   	ret
+
+0000079e <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     79e:	55                   	push   %ebp
+     79f:	89 e5                	mov    %esp,%ebp
+     7a1:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     7a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7a8:	0f 84 94 00 00 00    	je     842 <put+0xa4>
+    return;
+  if(o->n > 0){
+     7ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b1:	8b 40 04             	mov    0x4(%eax),%eax
+     7b4:	85 c0                	test   %eax,%eax
+     7b6:	7e 40                	jle    7f8 <put+0x5a>
+    v = &o->iov[o->n-1];
+     7b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     7bb:	8b 40 04             	mov    0x4(%eax),%eax
+     7be:	83 e8 01             	sub    $0x1,%eax
+     7c1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     7c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     7cb:	01 d0                	add    %edx,%eax
+     7cd:	83 c0 08             	add    $0x8,%eax
+     7d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     7d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d6:	8b 10                	mov    (%eax),%edx
+     7d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7db:	8b 40 04             	mov    0x4(%eax),%eax
+     7de:	01 d0                	add    %edx,%eax
+     7e0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     7e3:	75 13                	jne    7f8 <put+0x5a>
+      v->iov_len += n;
+     7e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7e8:	8b 50 04             	mov    0x4(%eax),%edx
+     7eb:	8b 45 10             	mov    0x10(%ebp),%eax
+     7ee:	01 c2                	add    %eax,%edx
+     7f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f3:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     7f6:	eb 4b                	jmp    843 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     7f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     7fb:	8b 40 04             	mov    0x4(%eax),%eax
+     7fe:	83 f8 10             	cmp    $0x10,%eax
+     801:	75 0e                	jne    811 <put+0x73>
+    flush(o);
+     803:	83 ec 0c             	sub    $0xc,%esp
+     806:	ff 75 08             	push   0x8(%ebp)
+     809:	e8 47 ff ff ff       	call   755 <flush>
+     80e:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     811:	8b 45 08             	mov    0x8(%ebp),%eax
+     814:	8b 50 04             	mov    0x4(%eax),%edx
+     817:	8b 45 08             	mov    0x8(%ebp),%eax
+     81a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     81d:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     821:	8b 45 08             	mov    0x8(%ebp),%eax
+     824:	8b 50 04             	mov    0x4(%eax),%edx
+     827:	8b 45 08             	mov    0x8(%ebp),%eax
+     82a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     82d:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     831:	8b 45 08             	mov    0x8(%ebp),%eax
+     834:	8b 40 04             	mov    0x4(%eax),%eax
+     837:	8d 50 01             	lea    0x1(%eax),%edx
+     83a:	8b 45 08             	mov    0x8(%ebp),%eax
+     83d:	89 50 04             	mov    %edx,0x4(%eax)
+     840:	eb 01                	jmp    843 <put+0xa5>
+    return;
+     842:	90                   	nop
+}
+     843:	c9                   	leave
+     844:	c3                   	ret
+
+00000845 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     845:	55                   	push   %ebp
+     846:	89 e5                	mov    %esp,%ebp
+     848:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     84b:	8b 45 08             	mov    0x8(%ebp),%eax
+     84e:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     854:	8b 45 0c             	mov    0xc(%ebp),%eax
+     857:	01 d0                	add    %edx,%eax
+     859:	3d 80 00 00 00       	cmp    $0x80,%eax
+     85e:	77 0b                	ja     86b <room+0x26>
+     860:	8b 45 08             	mov    0x8(%ebp),%eax
+     863:	8b 40 04             	mov    0x4(%eax),%eax
+     866:	83 f8 10             	cmp    $0x10,%eax
+     869:	75 0e                	jne    879 <room+0x34>
+    flush(o);
+     86b:	83 ec 0c             	sub    $0xc,%esp
+     86e:	ff 75 08             	push   0x8(%ebp)
+     871:	e8 df fe ff ff       	call   755 <flush>
+     876:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     879:	8b 45 08             	mov    0x8(%ebp),%eax
+     87c:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     882:	8b 45 08             	mov    0x8(%ebp),%eax
+     885:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     88b:	01 d0                	add    %edx,%eax
+}
+     88d:	c9                   	leave
+     88e:	c3                   	ret
+
+0000088f <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     88f:	55                   	push   %ebp
+     890:	89 e5                	mov    %esp,%ebp
+     892:	83 ec 28             	sub    $0x28,%esp
+     895:	8b 45 0c             	mov    0xc(%ebp),%eax
+     898:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     89b:	83 ec 08             	sub    $0x8,%esp
+     89e:	6a 01                	push   $0x1
+     8a0:	ff 75 08             	push   0x8(%ebp)
+     8a3:	e8 9d ff ff ff       	call   845 <room>
+     8a8:	83 c4 10             	add    $0x10,%esp
+     8ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     8ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8b1:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     8b5:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     8b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ba:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8c0:	8d 50 01             	lea    0x1(%eax),%edx
+     8c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8c6:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     8cc:	83 ec 04             	sub    $0x4,%esp
+     8cf:	6a 01                	push   $0x1
+     8d1:	ff 75 f4             	push   -0xc(%ebp)
+     8d4:	ff 75 08             	push   0x8(%ebp)
+     8d7:	e8 c2 fe ff ff       	call   79e <put>
+     8dc:	83 c4 10             	add    $0x10,%esp
+}
+     8df:	90                   	nop
+     8e0:	c9                   	leave
+     8e1:	c3                   	ret
+
+000008e2 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     8e2:	55                   	push   %ebp
+     8e3:	89 e5                	mov    %esp,%ebp
+     8e5:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     8e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8ef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8f3:	74 17                	je     90c <printint+0x2a>
+     8f5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8f9:	79 11                	jns    90c <printint+0x2a>
+    neg = 1;
+     8fb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     902:	8b 45 0c             	mov    0xc(%ebp),%eax
+     905:	f7 d8                	neg    %eax
+     907:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     90a:	eb 06                	jmp    912 <printint+0x30>
+  } else {
+    x = xx;
+     90c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     90f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     912:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     919:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     91c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     91f:	ba 00 00 00 00       	mov    $0x0,%edx
+     924:	f7 f1                	div    %ecx
+     926:	89 d1                	mov    %edx,%ecx
+     928:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     92b:	8d 50 01             	lea    0x1(%eax),%edx
+     92e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     931:	0f b6 91 90 14 00 00 	movzbl 0x1490(%ecx),%edx
+     938:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     93c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     93f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     942:	ba 00 00 00 00       	mov    $0x0,%edx
+     947:	f7 f1                	div    %ecx
+     949:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     94c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     950:	75 c7                	jne    919 <printint+0x37>
+  if(neg)
+     952:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     956:	74 0e                	je     966 <printint+0x84>
+    buf[i++] = '-';
+     958:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     95b:	8d 50 01             	lea    0x1(%eax),%edx
+     95e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     961:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     969:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     96c:	83 ec 08             	sub    $0x8,%esp
+     96f:	ff 75 e8             	push   -0x18(%ebp)
+     972:	ff 75 08             	push   0x8(%ebp)
+     975:	e8 cb fe ff ff       	call   845 <room>
+     97a:	83 c4 10             	add    $0x10,%esp
+     97d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     980:	eb 1d                	jmp    99f <printint+0xbd>
+    p[n-1-i] = buf[i];
+     982:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     985:	83 e8 01             	sub    $0x1,%eax
+     988:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     98b:	89 c2                	mov    %eax,%edx
+     98d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     990:	01 c2                	add    %eax,%edx
+     992:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     995:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     998:	01 c8                	add    %ecx,%eax
+     99a:	0f b6 00             	movzbl (%eax),%eax
+     99d:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     99f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     9a3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9a7:	79 d9                	jns    982 <printint+0xa0>
+  o->used += n;
+     9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ac:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     9b2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9b5:	01 c2                	add    %eax,%edx
+     9b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ba:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     9c0:	83 ec 04             	sub    $0x4,%esp
+     9c3:	ff 75 e8             	push   -0x18(%ebp)
+     9c6:	ff 75 e4             	push   -0x1c(%ebp)
+     9c9:	ff 75 08             	push   0x8(%ebp)
+     9cc:	e8 cd fd ff ff       	call   79e <put>
+     9d1:	83 c4 10             	add    $0x10,%esp
+}
+     9d4:	90                   	nop
+     9d5:	c9                   	leave
+     9d6:	c3                   	ret
+
+000009d7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9d7:	55                   	push   %ebp
+     9d8:	89 e5                	mov    %esp,%ebp
+     9da:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     9e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     9e9:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     9f0:	00 00 00 
+  o.used = 0;
+     9f3:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     9fa:	00 00 00 
+  state = 0;
+     9fd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a04:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a07:	83 c0 04             	add    $0x4,%eax
+     a0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     a0d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a14:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a1b:	e9 82 01 00 00       	jmp    ba2 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a20:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a26:	01 d0                	add    %edx,%eax
+     a28:	0f b6 00             	movzbl (%eax),%eax
+     a2b:	0f be c0             	movsbl %al,%eax
+     a2e:	25 ff 00 00 00       	and    $0xff,%eax
+     a33:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a36:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a3a:	75 38                	jne    a74 <printf+0x9d>
+      if(c == '%'){
+     a3c:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a40:	0f 85 58 01 00 00    	jne    b9e <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a49:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a4f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a52:	01 ca                	add    %ecx,%edx
+     a54:	83 ec 04             	sub    $0x4,%esp
+     a57:	50                   	push   %eax
+     a58:	52                   	push   %edx
+     a59:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a5f:	50                   	push   %eax
+     a60:	e8 39 fd ff ff       	call   79e <put>
+     a65:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a68:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a6f:	e9 2a 01 00 00       	jmp    b9e <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a74:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a78:	0f 85 20 01 00 00    	jne    b9e <printf+0x1c7>
+      if(c == 'd'){
+     a7e:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a82:	75 22                	jne    aa6 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a87:	8b 00                	mov    (%eax),%eax
+     a89:	6a 01                	push   $0x1
+     a8b:	6a 0a                	push   $0xa
+     a8d:	50                   	push   %eax
+     a8e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a94:	50                   	push   %eax
+     a95:	e8 48 fe ff ff       	call   8e2 <printint>
+     a9a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a9d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     aa1:	e9 e8 00 00 00       	jmp    b8e <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     aa6:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     aaa:	74 06                	je     ab2 <printf+0xdb>
+     aac:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     ab0:	75 22                	jne    ad4 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     ab2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ab5:	8b 00                	mov    (%eax),%eax
+     ab7:	6a 00                	push   $0x0
+     ab9:	6a 10                	push   $0x10
+     abb:	50                   	push   %eax
+     abc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ac2:	50                   	push   %eax
+     ac3:	e8 1a fe ff ff       	call   8e2 <printint>
+     ac8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     acb:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     acf:	e9 ba 00 00 00       	jmp    b8e <printf+0x1b7>
+      } else if(c == 's'){
+     ad4:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     ad8:	75 3f                	jne    b19 <printf+0x142>
+        s = (char*)*ap;
+     ada:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     add:	8b 00                	mov    (%eax),%eax
+     adf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     ae2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     ae6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     aea:	75 07                	jne    af3 <printf+0x11c>
+          s = "(null)";
+     aec:	c7 45 f4 a8 10 00 00 	movl   $0x10a8,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     af3:	83 ec 0c             	sub    $0xc,%esp
+     af6:	ff 75 f4             	push   -0xc(%ebp)
+     af9:	e8 47 f8 ff ff       	call   345 <strlen>
+     afe:	83 c4 10             	add    $0x10,%esp
+     b01:	83 ec 04             	sub    $0x4,%esp
+     b04:	50                   	push   %eax
+     b05:	ff 75 f4             	push   -0xc(%ebp)
+     b08:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b0e:	50                   	push   %eax
+     b0f:	e8 8a fc ff ff       	call   79e <put>
+     b14:	83 c4 10             	add    $0x10,%esp
+     b17:	eb 75                	jmp    b8e <printf+0x1b7>
+      } else if(c == 'c'){
+     b19:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b1d:	75 21                	jne    b40 <printf+0x169>
+        putc(&o, *ap);
+     b1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b22:	8b 00                	mov    (%eax),%eax
+     b24:	0f be c0             	movsbl %al,%eax
+     b27:	83 ec 08             	sub    $0x8,%esp
+     b2a:	50                   	push   %eax
+     b2b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b31:	50                   	push   %eax
+     b32:	e8 58 fd ff ff       	call   88f <putc>
+     b37:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b3a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b3e:	eb 4e                	jmp    b8e <printf+0x1b7>
+      } else if(c == '%'){
+     b40:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b44:	75 1b                	jne    b61 <printf+0x18a>
+        putc(&o, c);
+     b46:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b49:	0f be c0             	movsbl %al,%eax
+     b4c:	83 ec 08             	sub    $0x8,%esp
+     b4f:	50                   	push   %eax
+     b50:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b56:	50                   	push   %eax
+     b57:	e8 33 fd ff ff       	call   88f <putc>
+     b5c:	83 c4 10             	add    $0x10,%esp
+     b5f:	eb 2d                	jmp    b8e <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b61:	83 ec 08             	sub    $0x8,%esp
+     b64:	6a 25                	push   $0x25
+     b66:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b6c:	50                   	push   %eax
+     b6d:	e8 1d fd ff ff       	call   88f <putc>
+     b72:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b75:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b78:	0f be c0             	movsbl %al,%eax
+     b7b:	83 ec 08             	sub    $0x8,%esp
+     b7e:	50                   	push   %eax
+     b7f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b85:	50                   	push   %eax
+     b86:	e8 04 fd ff ff       	call   88f <putc>
+     b8b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b8e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     b95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b98:	83 c0 01             	add    $0x1,%eax
+     b9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b9e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     ba2:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ba5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ba8:	01 d0                	add    %edx,%eax
+     baa:	0f b6 00             	movzbl (%eax),%eax
+     bad:	84 c0                	test   %al,%al
+     baf:	0f 85 6b fe ff ff    	jne    a20 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     bb5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     bb9:	75 22                	jne    bdd <printf+0x206>
+    put(&o, fmt + start, i - start);
+     bbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bbe:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     bc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     bc4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     bc7:	01 ca                	add    %ecx,%edx
+     bc9:	83 ec 04             	sub    $0x4,%esp
+     bcc:	50                   	push   %eax
+     bcd:	52                   	push   %edx
+     bce:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bd4:	50                   	push   %eax
+     bd5:	e8 c4 fb ff ff       	call   79e <put>
+     bda:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     bdd:	83 ec 0c             	sub    $0xc,%esp
+     be0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     be6:	50                   	push   %eax
+     be7:	e8 69 fb ff ff       	call   755 <flush>
+     bec:	83 c4 10             	add    $0x10,%esp
+}
+     bef:	90                   	nop
+     bf0:	c9                   	leave
+     bf1:	c3                   	ret
+
+00000bf2 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     bf2:	55                   	push   %ebp
+     bf3:	89 e5                	mov    %esp,%ebp
+     bf5:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     bf8:	8b 55 08             	mov    0x8(%ebp),%edx
+     bfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bfe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c01:	f0 87 02             	lock xchg %eax,(%edx)
+     c04:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     c07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     c0a:	c9                   	leave
+     c0b:	c3                   	ret
+
+00000c0c <lock>:
+{
+     c0c:	55                   	push   %ebp
+     c0d:	89 e5                	mov    %esp,%ebp
+     c0f:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     c12:	a1 b4 14 00 00       	mov    0x14b4,%eax
+     c17:	85 c0                	test   %eax,%eax
+     c19:	74 09                	je     c24 <lock+0x18>
+     c1b:	a1 b4 14 00 00       	mov    0x14b4,%eax
+     c20:	ff d0                	call   *%eax
+     c22:	eb 05                	jmp    c29 <lock+0x1d>
+     c24:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c29:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c2c:	90                   	nop
+     c2d:	83 ec 08             	sub    $0x8,%esp
+     c30:	6a 01                	push   $0x1
+     c32:	68 ec 14 00 00       	push   $0x14ec
+     c37:	e8 b6 ff ff ff       	call   bf2 <xchg>
+     c3c:	83 c4 10             	add    $0x10,%esp
+     c3f:	85 c0                	test   %eax,%eax
+     c41:	75 ea                	jne    c2d <lock+0x21>
+  return pin;
+     c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c46:	c9                   	leave
+     c47:	c3                   	ret
+
+00000c48 <unlock>:
+{
+     c48:	55                   	push   %ebp
+     c49:	89 e5                	mov    %esp,%ebp
+     c4b:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c4e:	6a 00                	push   $0x0
+     c50:	68 ec 14 00 00       	push   $0x14ec
+     c55:	e8 98 ff ff ff       	call   bf2 <xchg>
+     c5a:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c5d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c61:	78 10                	js     c73 <unlock+0x2b>
+    mallocunpin(pin);
+     c63:	a1 b8 14 00 00       	mov    0x14b8,%eax
+     c68:	83 ec 0c             	sub    $0xc,%esp
+     c6b:	ff 75 08             	push   0x8(%ebp)
+     c6e:	ff d0                	call   *%eax
+     c70:	83 c4 10             	add    $0x10,%esp
+}
+     c73:	90                   	nop
+     c74:	c9                   	leave
+     c75:	c3                   	ret
+
+00000c76 <sizeclass>:
+{
+     c76:	55                   	push   %ebp
+     c77:	89 e5                	mov    %esp,%ebp
+     c79:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c83:	eb 1c                	jmp    ca1 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     c85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c88:	ba 02 00 00 00       	mov    $0x2,%edx
+     c8d:	89 c1                	mov    %eax,%ecx
+     c8f:	d3 e2                	shl    %cl,%edx
+     c91:	89 d0                	mov    %edx,%eax
+     c93:	3b 45 08             	cmp    0x8(%ebp),%eax
+     c96:	72 05                	jb     c9d <sizeclass+0x27>
+      return c;
+     c98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c9b:	eb 0f                	jmp    cac <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     c9d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     ca1:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     ca5:	7e de                	jle    c85 <sizeclass+0xf>
+  return -1;
+     ca7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     cac:	c9                   	leave
+     cad:	c3                   	ret
+
+00000cae <bigfree>:
+{
+     cae:	55                   	push   %ebp
+     caf:	89 e5                	mov    %esp,%ebp
+     cb1:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cb4:	a1 c4 14 00 00       	mov    0x14c4,%eax
+     cb9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cbc:	eb 24                	jmp    ce2 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cbe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cc1:	8b 00                	mov    (%eax),%eax
+     cc3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cc6:	72 12                	jb     cda <bigfree+0x2c>
+     cc8:	8b 45 08             	mov    0x8(%ebp),%eax
+     ccb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cce:	72 24                	jb     cf4 <bigfree+0x46>
+     cd0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cd3:	8b 00                	mov    (%eax),%eax
+     cd5:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cd8:	72 1a                	jb     cf4 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cda:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cdd:	8b 00                	mov    (%eax),%eax
+     cdf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ce8:	73 d4                	jae    cbe <bigfree+0x10>
+     cea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ced:	8b 00                	mov    (%eax),%eax
+     cef:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cf2:	73 ca                	jae    cbe <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf7:	8b 40 04             	mov    0x4(%eax),%eax
+     cfa:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d01:	8b 45 08             	mov    0x8(%ebp),%eax
+     d04:	01 c2                	add    %eax,%edx
+     d06:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d09:	8b 00                	mov    (%eax),%eax
+     d0b:	39 c2                	cmp    %eax,%edx
+     d0d:	75 24                	jne    d33 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d12:	8b 50 04             	mov    0x4(%eax),%edx
+     d15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d18:	8b 00                	mov    (%eax),%eax
+     d1a:	8b 40 04             	mov    0x4(%eax),%eax
+     d1d:	01 c2                	add    %eax,%edx
+     d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d22:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d28:	8b 00                	mov    (%eax),%eax
+     d2a:	8b 10                	mov    (%eax),%edx
+     d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2f:	89 10                	mov    %edx,(%eax)
+     d31:	eb 0a                	jmp    d3d <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d36:	8b 10                	mov    (%eax),%edx
+     d38:	8b 45 08             	mov    0x8(%ebp),%eax
+     d3b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d3d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d40:	8b 40 04             	mov    0x4(%eax),%eax
+     d43:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d4d:	01 d0                	add    %edx,%eax
+     d4f:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d52:	75 20                	jne    d74 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d57:	8b 50 04             	mov    0x4(%eax),%edx
+     d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5d:	8b 40 04             	mov    0x4(%eax),%eax
+     d60:	01 c2                	add    %eax,%edx
+     d62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d65:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d68:	8b 45 08             	mov    0x8(%ebp),%eax
+     d6b:	8b 10                	mov    (%eax),%edx
+     d6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d70:	89 10                	mov    %edx,(%eax)
+     d72:	eb 08                	jmp    d7c <bigfree+0xce>
+    p->s.ptr = bp;
+     d74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d77:	8b 55 08             	mov    0x8(%ebp),%edx
+     d7a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d7f:	a3 c4 14 00 00       	mov    %eax,0x14c4
+}
+     d84:	90                   	nop
+     d85:	c9                   	leave
+     d86:	c3                   	ret
+
+00000d87 <free>:
+{
+     d87:	55                   	push   %ebp
+     d88:	89 e5                	mov    %esp,%ebp
+     d8a:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     d8d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d91:	74 68                	je     dfb <free+0x74>
+  bp = (Header*)ap - 1;
+     d93:	8b 45 08             	mov    0x8(%ebp),%eax
+     d96:	83 e8 08             	sub    $0x8,%eax
+     d99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     d9c:	e8 6b fe ff ff       	call   c0c <lock>
+     da1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     da4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     da7:	8b 40 04             	mov    0x4(%eax),%eax
+     daa:	83 ec 0c             	sub    $0xc,%esp
+     dad:	50                   	push   %eax
+     dae:	e8 c3 fe ff ff       	call   c76 <sizeclass>
+     db3:	83 c4 10             	add    $0x10,%esp
+     db6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     db9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     dbd:	78 1e                	js     ddd <free+0x56>
+    bp->s.ptr = classfree[c];
+     dbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dc2:	8b 14 85 c8 14 00 00 	mov    0x14c8(,%eax,4),%edx
+     dc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dcc:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     dce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dd1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     dd4:	89 14 85 c8 14 00 00 	mov    %edx,0x14c8(,%eax,4)
+     ddb:	eb 0e                	jmp    deb <free+0x64>
+    bigfree(bp);
+     ddd:	83 ec 0c             	sub    $0xc,%esp
+     de0:	ff 75 f4             	push   -0xc(%ebp)
+     de3:	e8 c6 fe ff ff       	call   cae <bigfree>
+     de8:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     deb:	83 ec 0c             	sub    $0xc,%esp
+     dee:	ff 75 f0             	push   -0x10(%ebp)
+     df1:	e8 52 fe ff ff       	call   c48 <unlock>
+     df6:	83 c4 10             	add    $0x10,%esp
+     df9:	eb 01                	jmp    dfc <free+0x75>
+    return;
+     dfb:	90                   	nop
+}
+     dfc:	c9                   	leave
+     dfd:	c3                   	ret
+
+00000dfe <morecore>:
+{
+     dfe:	55                   	push   %ebp
+     dff:	89 e5                	mov    %esp,%ebp
+     e01:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     e04:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     e0b:	77 07                	ja     e14 <morecore+0x16>
+    nu = 4096;
+     e0d:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     e14:	8b 45 08             	mov    0x8(%ebp),%eax
+     e17:	c1 e0 03             	shl    $0x3,%eax
+     e1a:	83 ec 0c             	sub    $0xc,%esp
+     e1d:	50                   	push   %eax
+     e1e:	e8 b6 f7 ff ff       	call   5d9 <sbrk>
+     e23:	83 c4 10             	add    $0x10,%esp
+     e26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e29:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e2d:	75 07                	jne    e36 <morecore+0x38>
+    return 0;
+     e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e34:	eb 22                	jmp    e58 <morecore+0x5a>
+  hp = (Header*)p;
+     e36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+     e42:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e45:	83 ec 0c             	sub    $0xc,%esp
+     e48:	ff 75 f0             	push   -0x10(%ebp)
+     e4b:	e8 5e fe ff ff       	call   cae <bigfree>
+     e50:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e53:	a1 c4 14 00 00       	mov    0x14c4,%eax
+}
+     e58:	c9                   	leave
+     e59:	c3                   	ret
+
+00000e5a <bigalloc>:
+{
+     e5a:	55                   	push   %ebp
+     e5b:	89 e5                	mov    %esp,%ebp
+     e5d:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e60:	a1 c4 14 00 00       	mov    0x14c4,%eax
+     e65:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e68:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e6c:	75 23                	jne    e91 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e6e:	c7 45 f0 bc 14 00 00 	movl   $0x14bc,-0x10(%ebp)
+     e75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e78:	a3 c4 14 00 00       	mov    %eax,0x14c4
+     e7d:	a1 c4 14 00 00       	mov    0x14c4,%eax
+     e82:	a3 bc 14 00 00       	mov    %eax,0x14bc
+    base.s.size = 0;
+     e87:	c7 05 c0 14 00 00 00 	movl   $0x0,0x14c0
+     e8e:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e94:	8b 00                	mov    (%eax),%eax
+     e96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     e99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e9c:	8b 40 04             	mov    0x4(%eax),%eax
+     e9f:	3b 45 08             	cmp    0x8(%ebp),%eax
+     ea2:	72 4a                	jb     eee <bigalloc+0x94>
+      if(p->s.size == nunits)
+     ea4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea7:	8b 40 04             	mov    0x4(%eax),%eax
+     eaa:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ead:	75 0c                	jne    ebb <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     eaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb2:	8b 10                	mov    (%eax),%edx
+     eb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eb7:	89 10                	mov    %edx,(%eax)
+     eb9:	eb 26                	jmp    ee1 <bigalloc+0x87>
+        p->s.size -= nunits;
+     ebb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebe:	8b 40 04             	mov    0x4(%eax),%eax
+     ec1:	2b 45 08             	sub    0x8(%ebp),%eax
+     ec4:	89 c2                	mov    %eax,%edx
+     ec6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec9:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     ecc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ecf:	8b 40 04             	mov    0x4(%eax),%eax
+     ed2:	c1 e0 03             	shl    $0x3,%eax
+     ed5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     ed8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     edb:	8b 55 08             	mov    0x8(%ebp),%edx
+     ede:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     ee1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ee4:	a3 c4 14 00 00       	mov    %eax,0x14c4
+      return p;
+     ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eec:	eb 3b                	jmp    f29 <bigalloc+0xcf>
+    if(p == freep)
+     eee:	a1 c4 14 00 00       	mov    0x14c4,%eax
+     ef3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     ef6:	75 1e                	jne    f16 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+     efb:	ff 75 08             	push   0x8(%ebp)
+     efe:	e8 fb fe ff ff       	call   dfe <morecore>
+     f03:	83 c4 10             	add    $0x10,%esp
+     f06:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f09:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f0d:	75 07                	jne    f16 <bigalloc+0xbc>
+        return 0;
+     f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f14:	eb 13                	jmp    f29 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f19:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f1f:	8b 00                	mov    (%eax),%eax
+     f21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f24:	e9 70 ff ff ff       	jmp    e99 <bigalloc+0x3f>
+}
+     f29:	c9                   	leave
+     f2a:	c3                   	ret
+
+00000f2b <alloc>:
+alloc(uint nbytes)
+{
+     f2b:	55                   	push   %ebp
+     f2c:	89 e5                	mov    %esp,%ebp
+     f2e:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f31:	8b 45 08             	mov    0x8(%ebp),%eax
+     f34:	83 c0 07             	add    $0x7,%eax
+     f37:	c1 e8 03             	shr    $0x3,%eax
+     f3a:	83 c0 01             	add    $0x1,%eax
+     f3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f40:	ff 75 f4             	push   -0xc(%ebp)
+     f43:	e8 2e fd ff ff       	call   c76 <sizeclass>
+     f48:	83 c4 04             	add    $0x4,%esp
+     f4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f4e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f52:	79 2c                	jns    f80 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f54:	83 ec 0c             	sub    $0xc,%esp
+     f57:	ff 75 f4             	push   -0xc(%ebp)
+     f5a:	e8 fb fe ff ff       	call   e5a <bigalloc>
+     f5f:	83 c4 10             	add    $0x10,%esp
+     f62:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f65:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f69:	75 0a                	jne    f75 <alloc+0x4a>
+      return 0;
+     f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f70:	e9 c8 00 00 00       	jmp    103d <alloc+0x112>
+    return (void*)(p + 1);
+     f75:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f78:	83 c0 08             	add    $0x8,%eax
+     f7b:	e9 bd 00 00 00       	jmp    103d <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f83:	8b 04 85 c8 14 00 00 	mov    0x14c8(,%eax,4),%eax
+     f8a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f91:	74 1a                	je     fad <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     f93:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f96:	8b 10                	mov    (%eax),%edx
+     f98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f9b:	89 14 85 c8 14 00 00 	mov    %edx,0x14c8(,%eax,4)
+    return (void*)(p + 1);
+     fa2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fa5:	83 c0 08             	add    $0x8,%eax
+     fa8:	e9 90 00 00 00       	jmp    103d <alloc+0x112>
+  }
+  nunits = 2 << c;
+     fad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fb0:	ba 02 00 00 00       	mov    $0x2,%edx
+     fb5:	89 c1                	mov    %eax,%ecx
+     fb7:	d3 e2                	shl    %cl,%edx
+     fb9:	89 d0                	mov    %edx,%eax
+     fbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     fbe:	a1 e4 14 00 00       	mov    0x14e4,%eax
+     fc3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fc6:	c1 e2 03             	shl    $0x3,%edx
+     fc9:	01 d0                	add    %edx,%eax
+     fcb:	8b 15 e8 14 00 00    	mov    0x14e8,%edx
+     fd1:	39 c2                	cmp    %eax,%edx
+     fd3:	73 3f                	jae    1014 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     fd5:	83 ec 0c             	sub    $0xc,%esp
+     fd8:	68 00 08 00 00       	push   $0x800
+     fdd:	e8 78 fe ff ff       	call   e5a <bigalloc>
+     fe2:	83 c4 10             	add    $0x10,%esp
+     fe5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fe8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fec:	75 07                	jne    ff5 <alloc+0xca>
+      return 0;
+     fee:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff3:	eb 48                	jmp    103d <alloc+0x112>
+    bump = (char*)p;
+     ff5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff8:	a3 e4 14 00 00       	mov    %eax,0x14e4
+    bumpend = (char*)(p + p->s.size);
+     ffd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1000:	8b 40 04             	mov    0x4(%eax),%eax
+    1003:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    100a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    100d:	01 d0                	add    %edx,%eax
+    100f:	a3 e8 14 00 00       	mov    %eax,0x14e8
+  }
+  p = (Header*)bump;
+    1014:	a1 e4 14 00 00       	mov    0x14e4,%eax
+    1019:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    101c:	a1 e4 14 00 00       	mov    0x14e4,%eax
+    1021:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1024:	c1 e2 03             	shl    $0x3,%edx
+    1027:	01 d0                	add    %edx,%eax
+    1029:	a3 e4 14 00 00       	mov    %eax,0x14e4
+  p->s.size = nunits;
+    102e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1031:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1034:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1037:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    103a:	83 c0 08             	add    $0x8,%eax
+}
+    103d:	c9                   	leave
+    103e:	c3                   	ret
+
+0000103f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    103f:	55                   	push   %ebp
+    1040:	89 e5                	mov    %esp,%ebp
+    1042:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1045:	e8 c2 fb ff ff       	call   c0c <lock>
+    104a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    104d:	83 ec 0c             	sub    $0xc,%esp
+    1050:	ff 75 08             	push   0x8(%ebp)
+    1053:	e8 d3 fe ff ff       	call   f2b <alloc>
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    105e:	83 ec 0c             	sub    $0xc,%esp
+    1061:	ff 75 f4             	push   -0xc(%ebp)
+    1064:	e8 df fb ff ff       	call   c48 <unlock>
+    1069:	83 c4 10             	add    $0x10,%esp
+  return p;
+    106c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    106f:	c9                   	leave
+    1070:	c3                   	ret
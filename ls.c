@@ -3,6 +3,7 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "dent.h"
 
 char*
 fmtname(char *path)
@@ -23,29 +24,11 @@ fmtname(char *path)
   return buf;
 }
 
-
-/*vvv  TASK 1.2  vvv*/
-static int
-stat2(char *n, struct stat *st)
-{
-  int fd;
-  int r;
-
-  fd = open(n, O_RDONLY | O_IGNLINK);
-  if(fd < 0)
-    return -1;
-  r = fstat(fd, st);
-  close(fd);
-  return r;
-}
-/*^^^^^^^^^^^^^^^^^^*/
-
 void
 ls(char *path)
 {
-  char buf[512], *p;
-  int fd;
-  struct dirent de;
+  int fd, i, n;
+  struct dent d[16];
   struct stat st;
   
   if((fd = open(path, 0)) < 0){
@@ -65,26 +48,10 @@ ls(char *path)
     break;
   
   case T_DIR:
-    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
-      printf(1, "ls: path too long\n");
-      break;
-    }
-    strcpy(buf, path);
-    p = buf+strlen(buf);
-    *p++ = '/';
-    while(read(fd, &de, sizeof(de)) == sizeof(de)){
-      if(de.inum == 0)
-        continue;
-      memmove(p, de.name, DIRSIZ);
-      p[DIRSIZ] = 0;
-/*vvv  TASK 1.2  vvv*/
-      if(stat2(buf, &st) < 0){
-/*^^^^^^^^^^^^^^^^^^*/
-        printf(1, "ls: cannot stat %s\n", buf);
-        continue;
-      }
-      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
-    }
+    // Each entry comes with its inode's type and size.
+    while((n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0)
+      for(i = 0; i < n; i++)
+        printf(1, "%s %d %d %d\n", fmtname(d[i].name), d[i].type, d[i].ino, d[i].size);
     break;
   }
   close(fd);
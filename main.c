@@ -8,6 +8,7 @@
 
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
+static void savebootargs(void);
 extern pde_t *kpgdir;
 extern char end[]; // first address after kernel loaded from ELF file
 
@@ -17,6 +18,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  savebootargs();  // before kinit1 can reuse the loader's memory
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // collect info about this machine
@@ -26,17 +28,25 @@ main(void)
   picinit();       // interrupt controller
   ioapicinit();    // another interrupt controller
   consoleinit();   // I/O devices & their interrupts
+  lockstatinit();  // lock statistics device
+  sysstatinit();   // system call statistics devices
+  kstatinit();     // kernel statistics files
+  profinit();      // sampling profiler
   uartinit();      // serial port
   pinit();         // process table
+  futexinit();     // futexes
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
-  iinit();         // inode cache
+  pipeinit();      // pipe cache
   ideinit();       // disk
   if(!ismp)
     timerinit();   // uniprocessor timer
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized from free memory
+  iinit();         // inode cache, sized from free memory
+  pcinit();        // page cache, sized from free memory
+  tmpinit();       // in-memory file systems
   userinit();      // first user process
   // Finish setting up this processor in mpmain.
   mpmain();
@@ -64,14 +74,73 @@ mpmain(void)
 
 pde_t entrypgdir[];  // For entry.S
 
+// Multiboot state saved by entry.S.  A multiboot loader such
+// as GRUB leaves MULTIBOOT_MAGIC in %eax and the physical address
+// of its information structure in %ebx; the xv6 boot loader
+// leaves neither, so mbmagic does not match.
+#define MULTIBOOT_MAGIC   0x2BADB002
+#define MULTIBOOT_CMDLINE 0x4      // mbinfo.flags: cmdline is valid
+
+struct mbinfo {
+  uint flags;
+  uint mem_lower;
+  uint mem_upper;
+  uint boot_device;
+  uint cmdline;  // physical address of nul-terminated string
+};
+
+uint mbmagic;
+uint mbinfo;
+static char bootargs[128];
+
+// Copy the boot command line out of the loader's memory.
+// Only the low 4MB are mapped by entrypgdir at this point.
+static void
+savebootargs(void)
+{
+  struct mbinfo *mb;
+
+  if(mbmagic != MULTIBOOT_MAGIC || mbinfo + sizeof(*mb) > 4*1024*1024)
+    return;
+  mb = (struct mbinfo*)p2v(mbinfo);
+  if(!(mb->flags & MULTIBOOT_CMDLINE) || mb->cmdline >= 4*1024*1024)
+    return;
+  safestrcpy(bootargs, p2v(mb->cmdline), sizeof(bootargs));
+}
+
+// Return the value of a name=number option on the boot
+// command line, or def if the option is not there.
+int
+bootarg(char *name, int def)
+{
+  char *s;
+  int n, len;
+
+  len = strlen(name);
+  for(s = bootargs; *s; ){
+    while(*s == ' ')
+      s++;
+    if(strncmp(s, name, len) == 0 && s[len] == '='){
+      n = 0;
+      for(s += len+1; *s >= '0' && *s <= '9'; s++)
+        n = n*10 + *s - '0';
+      return n;
+    }
+    while(*s && *s != ' ')
+      s++;
+  }
+  return def;
+}
+
 // Start the non-boot (AP) processors.
 static void
 startothers(void)
 {
   extern uchar _binary_entryother_start[], _binary_entryother_size[];
+  static char *stacks[NCPU];
   uchar *code;
   struct cpu *c;
-  char *stack;
+  int n;
 
   // Write entry code to unused memory at 0x7000.
   // The linker has placed the image of entryother.S in
@@ -79,24 +148,25 @@ startothers(void)
   code = p2v(0x7000);
   memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
 
-  for(c = cpus; c < cpus+ncpu; c++){
-    if(c == cpus+cpunum())  // We've started already.
-      continue;
-
-    // Tell entryother.S what stack to use, where to enter, and what 
-    // pgdir to use. We cannot use kpgdir yet, because the AP processor
-    // is running in low  memory, so we use entrypgdir for the APs too.
-    stack = kalloc();
-    *(void**)(code-4) = stack + KSTACKSIZE;
-    *(void**)(code-8) = mpenter;
-    *(int**)(code-12) = (void *) v2p(entrypgdir);
+  // Tell entryother.S what stacks to use, where to enter, and what 
+  // pgdir to use. We cannot use kpgdir yet, because the AP processor
+  // is running in low  memory, so we use entrypgdir for the APs too.
+  n = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != cpus+cpunum())  // We've started already.
+      stacks[n++] = kalloc() + KSTACKSIZE;
+  *(void**)(code-4) = stacks;
+  *(void**)(code-8) = mpenter;
+  *(int**)(code-12) = (void *) v2p(entrypgdir);
+  *(int*)(code-16) = 0;
 
-    lapicstartap(c->id, v2p(code));
-
-    // wait for cpu to finish mpmain()
-    while(c->started == 0)
+  // Start them all, and then wait for each to finish mpmain().
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != cpus+cpunum())
+      lapicstartap(c->id, v2p(code));
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c != cpus+cpunum() && c->started == 0)
       ;
-  }
 }
 
 // Boot page table used in entry.S and entryother.S.
@@ -9,6 +9,7 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "fs.h"
 #include "buf.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
@@ -20,19 +21,27 @@ void
 ideinit(void)
 {
   memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/512;
+  disksize = (uint)_binary_fs_img_size/BSIZE;
 }
 
 // Interrupt handler.
 void
-ideintr(void)
+ideintr(int chan)
 {
   // no-op
 }
 
+// The memory disk is a single image.
+void
+idestripe(uint dev, uint n)
+{
+  panic("memide: striped file system");
+}
+
 // Sync buf with disk. 
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, release b when done.
 void
 iderw(struct buf *b)
 {
@@ -47,12 +56,43 @@ iderw(struct buf *b)
   if(b->sector >= disksize)
     panic("iderw: sector out of range");
 
-  p = memdisk + b->sector*512;
+  p = memdisk + b->sector*BSIZE;
+  if(proc){
+    if(b->flags & B_DIRTY)
+      proc->ru.nblkout++;
+    else
+      proc->ru.nblkin++;
+  }
   
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
-    memmove(p, b->data, 512);
+    memmove(p, b->data, BSIZE);
   } else
-    memmove(b->data, p, 512);
+    memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    brelse(b);
+  }
+}
+
+// No queue to gather requests in; just do them in turn.
+void
+iderwv(struct buf *b, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(&b[i]);
+}
+
+// No queue to report on.
+void
+idestats(struct report *r)
+{
+}
+
+void
+idedump(void)
+{
 }
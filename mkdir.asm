@@ -0,0 +1,1817 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 51 0e 00 00       	push   $0xe51
+  21:	6a 02                	push   $0x2
+  23:	e8 8f 07 00 00       	call   7b7 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 f7 02 00 00       	call   327 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 3e 03 00 00       	call   391 <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 68 0e 00 00       	push   $0xe68
+  74:	6a 02                	push   $0x2
+  76:	e8 3c 07 00 00       	call   7b7 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 97 02 00 00       	call   327 <exit>
+
+00000090 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+    if(cc < 1)
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 84 01 00 00       	call   33c <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 44 01 00 00       	call   35f <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 41 01 00 00       	call   37d <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 fd 00 00 00       	call   34a <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 2df:	83 3d 14 12 00 00 00 	cmpl   $0x0,0x1214
+  jg 2f
+ 2e6:	7f 2e                	jg     316 <dosyscall+0x37>
+  jl 1f
+ 2e8:	7c 29                	jl     313 <dosyscall+0x34>
+  pushl %eax
+ 2ea:	50                   	push   %eax
+  pushl %ebx
+ 2eb:	53                   	push   %ebx
+  movl $1, %eax
+ 2ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 2f1:	0f a2                	cpuid
+  popl %ebx
+ 2f3:	5b                   	pop    %ebx
+  popl %eax
+ 2f4:	58                   	pop    %eax
+  movl $-1, sysmode
+ 2f5:	c7 05 14 12 00 00 ff 	movl   $0xffffffff,0x1214
+ 2fc:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 2ff:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 305:	74 0c                	je     313 <dosyscall+0x34>
+  movl $1, sysmode
+ 307:	c7 05 14 12 00 00 01 	movl   $0x1,0x1214
+ 30e:	00 00 00 
+  jmp 2f
+ 311:	eb 03                	jmp    316 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 313:	cd 40                	int    $0x40
+  ret
+ 315:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 316:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 318:	ba 1f 03 00 00       	mov    $0x31f,%edx
+  sysenter
+ 31d:	0f 34                	sysenter
+3:
+  ret
+ 31f:	c3                   	ret
+
+00000320 <fork>:
+
+SYSCALL(fork)
+ 320:	b8 01 00 00 00       	mov    $0x1,%eax
+ 325:	eb b8                	jmp    2df <dosyscall>
+
+00000327 <exit>:
+SYSCALL(exit)
+ 327:	b8 02 00 00 00       	mov    $0x2,%eax
+ 32c:	eb b1                	jmp    2df <dosyscall>
+
+0000032e <wait>:
+SYSCALL(wait)
+ 32e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 333:	eb aa                	jmp    2df <dosyscall>
+
+00000335 <pipe>:
+SYSCALL(pipe)
+ 335:	b8 04 00 00 00       	mov    $0x4,%eax
+ 33a:	eb a3                	jmp    2df <dosyscall>
+
+0000033c <read>:
+SYSCALL(read)
+ 33c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 341:	eb 9c                	jmp    2df <dosyscall>
+
+00000343 <write>:
+SYSCALL(write)
+ 343:	b8 10 00 00 00       	mov    $0x10,%eax
+ 348:	eb 95                	jmp    2df <dosyscall>
+
+0000034a <close>:
+SYSCALL(close)
+ 34a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 34f:	eb 8e                	jmp    2df <dosyscall>
+
+00000351 <kill>:
+SYSCALL(kill)
+ 351:	b8 06 00 00 00       	mov    $0x6,%eax
+ 356:	eb 87                	jmp    2df <dosyscall>
+
+00000358 <exec>:
+SYSCALL(exec)
+ 358:	b8 07 00 00 00       	mov    $0x7,%eax
+ 35d:	eb 80                	jmp    2df <dosyscall>
+
+0000035f <open>:
+SYSCALL(open)
+ 35f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 364:	e9 76 ff ff ff       	jmp    2df <dosyscall>
+
+00000369 <mknod>:
+SYSCALL(mknod)
+ 369:	b8 11 00 00 00       	mov    $0x11,%eax
+ 36e:	e9 6c ff ff ff       	jmp    2df <dosyscall>
+
+00000373 <unlink>:
+SYSCALL(unlink)
+ 373:	b8 12 00 00 00       	mov    $0x12,%eax
+ 378:	e9 62 ff ff ff       	jmp    2df <dosyscall>
+
+0000037d <fstat>:
+SYSCALL(fstat)
+ 37d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 382:	e9 58 ff ff ff       	jmp    2df <dosyscall>
+
+00000387 <link>:
+SYSCALL(link)
+ 387:	b8 13 00 00 00       	mov    $0x13,%eax
+ 38c:	e9 4e ff ff ff       	jmp    2df <dosyscall>
+
+00000391 <mkdir>:
+SYSCALL(mkdir)
+ 391:	b8 14 00 00 00       	mov    $0x14,%eax
+ 396:	e9 44 ff ff ff       	jmp    2df <dosyscall>
+
+0000039b <chdir>:
+SYSCALL(chdir)
+ 39b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a0:	e9 3a ff ff ff       	jmp    2df <dosyscall>
+
+000003a5 <dup>:
+SYSCALL(dup)
+ 3a5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3aa:	e9 30 ff ff ff       	jmp    2df <dosyscall>
+
+000003af <getpid>:
+SYSCALL(getpid)
+ 3af:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b4:	e9 26 ff ff ff       	jmp    2df <dosyscall>
+
+000003b9 <sbrk>:
+SYSCALL(sbrk)
+ 3b9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3be:	e9 1c ff ff ff       	jmp    2df <dosyscall>
+
+000003c3 <sleep>:
+SYSCALL(sleep)
+ 3c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c8:	e9 12 ff ff ff       	jmp    2df <dosyscall>
+
+000003cd <uptime>:
+SYSCALL(uptime)
+ 3cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d2:	e9 08 ff ff ff       	jmp    2df <dosyscall>
+
+000003d7 <symlink>:
+SYSCALL(symlink)
+ 3d7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3dc:	e9 fe fe ff ff       	jmp    2df <dosyscall>
+
+000003e1 <readlink>:
+SYSCALL(readlink)
+ 3e1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e6:	e9 f4 fe ff ff       	jmp    2df <dosyscall>
+
+000003eb <fprot>:
+SYSCALL(fprot)
+ 3eb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3f0:	e9 ea fe ff ff       	jmp    2df <dosyscall>
+
+000003f5 <funprot>:
+SYSCALL(funprot)
+ 3f5:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3fa:	e9 e0 fe ff ff       	jmp    2df <dosyscall>
+
+000003ff <funlock>:
+SYSCALL(funlock)
+ 3ff:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 404:	e9 d6 fe ff ff       	jmp    2df <dosyscall>
+
+00000409 <mmap>:
+SYSCALL(mmap)
+ 409:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 40e:	e9 cc fe ff ff       	jmp    2df <dosyscall>
+
+00000413 <munmap>:
+SYSCALL(munmap)
+ 413:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 418:	e9 c2 fe ff ff       	jmp    2df <dosyscall>
+
+0000041d <sendfile>:
+SYSCALL(sendfile)
+ 41d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 422:	e9 b8 fe ff ff       	jmp    2df <dosyscall>
+
+00000427 <readv>:
+SYSCALL(readv)
+ 427:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 42c:	e9 ae fe ff ff       	jmp    2df <dosyscall>
+
+00000431 <writev>:
+SYSCALL(writev)
+ 431:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 436:	e9 a4 fe ff ff       	jmp    2df <dosyscall>
+
+0000043b <pread>:
+SYSCALL(pread)
+ 43b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 440:	e9 9a fe ff ff       	jmp    2df <dosyscall>
+
+00000445 <pwrite>:
+SYSCALL(pwrite)
+ 445:	b8 21 00 00 00       	mov    $0x21,%eax
+ 44a:	e9 90 fe ff ff       	jmp    2df <dosyscall>
+
+0000044f <lseek>:
+SYSCALL(lseek)
+ 44f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 454:	e9 86 fe ff ff       	jmp    2df <dosyscall>
+
+00000459 <spawn>:
+SYSCALL(spawn)
+ 459:	b8 23 00 00 00       	mov    $0x23,%eax
+ 45e:	e9 7c fe ff ff       	jmp    2df <dosyscall>
+
+00000463 <setpriority>:
+SYSCALL(setpriority)
+ 463:	b8 24 00 00 00       	mov    $0x24,%eax
+ 468:	e9 72 fe ff ff       	jmp    2df <dosyscall>
+
+0000046d <kthread_create>:
+SYSCALL(kthread_create)
+ 46d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 472:	e9 68 fe ff ff       	jmp    2df <dosyscall>
+
+00000477 <kthread_id>:
+SYSCALL(kthread_id)
+ 477:	b8 26 00 00 00       	mov    $0x26,%eax
+ 47c:	e9 5e fe ff ff       	jmp    2df <dosyscall>
+
+00000481 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 481:	b8 27 00 00 00       	mov    $0x27,%eax
+ 486:	e9 54 fe ff ff       	jmp    2df <dosyscall>
+
+0000048b <kthread_join>:
+SYSCALL(kthread_join)
+ 48b:	b8 28 00 00 00       	mov    $0x28,%eax
+ 490:	e9 4a fe ff ff       	jmp    2df <dosyscall>
+
+00000495 <futex>:
+SYSCALL(futex)
+ 495:	b8 29 00 00 00       	mov    $0x29,%eax
+ 49a:	e9 40 fe ff ff       	jmp    2df <dosyscall>
+
+0000049f <signal>:
+SYSCALL(signal)
+ 49f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a4:	e9 36 fe ff ff       	jmp    2df <dosyscall>
+
+000004a9 <alarm>:
+SYSCALL(alarm)
+ 4a9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4ae:	e9 2c fe ff ff       	jmp    2df <dosyscall>
+
+000004b3 <usleep>:
+SYSCALL(usleep)
+ 4b3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b8:	e9 22 fe ff ff       	jmp    2df <dosyscall>
+
+000004bd <ioring_setup>:
+SYSCALL(ioring_setup)
+ 4bd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4c2:	e9 18 fe ff ff       	jmp    2df <dosyscall>
+
+000004c7 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4c7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4cc:	e9 0e fe ff ff       	jmp    2df <dosyscall>
+
+000004d1 <getrusage>:
+SYSCALL(getrusage)
+ 4d1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4d6:	e9 04 fe ff ff       	jmp    2df <dosyscall>
+
+000004db <mount>:
+SYSCALL(mount)
+ 4db:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4e0:	e9 fa fd ff ff       	jmp    2df <dosyscall>
+
+000004e5 <getdents>:
+SYSCALL(getdents)
+ 4e5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4ea:	e9 f0 fd ff ff       	jmp    2df <dosyscall>
+
+000004ef <yield>:
+SYSCALL(yield)
+ 4ef:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4f4:	e9 e6 fd ff ff       	jmp    2df <dosyscall>
+
+000004f9 <ncpu>:
+SYSCALL(ncpu)
+ 4f9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4fe:	e9 dc fd ff ff       	jmp    2df <dosyscall>
+
+00000503 <fallocate>:
+SYSCALL(fallocate)
+ 503:	b8 34 00 00 00       	mov    $0x34,%eax
+ 508:	e9 d2 fd ff ff       	jmp    2df <dosyscall>
+
+0000050d <ftruncate>:
+SYSCALL(ftruncate)
+ 50d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 512:	e9 c8 fd ff ff       	jmp    2df <dosyscall>
+
+00000517 <fsync>:
+SYSCALL(fsync)
+ 517:	b8 36 00 00 00       	mov    $0x36,%eax
+ 51c:	e9 be fd ff ff       	jmp    2df <dosyscall>
+
+00000521 <fdatasync>:
+SYSCALL(fdatasync)
+ 521:	b8 37 00 00 00       	mov    $0x37,%eax
+ 526:	e9 b4 fd ff ff       	jmp    2df <dosyscall>
+
+0000052b <poll>:
+SYSCALL(poll)
+ 52b:	b8 38 00 00 00       	mov    $0x38,%eax
+ 530:	e9 aa fd ff ff       	jmp    2df <dosyscall>
+
+00000535 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 535:	55                   	push   %ebp
+ 536:	89 e5                	mov    %esp,%ebp
+ 538:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 53b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53e:	8b 40 04             	mov    0x4(%eax),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	7e 1f                	jle    564 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 545:	8b 45 08             	mov    0x8(%ebp),%eax
+ 548:	8b 50 04             	mov    0x4(%eax),%edx
+ 54b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54e:	8d 48 08             	lea    0x8(%eax),%ecx
+ 551:	8b 45 08             	mov    0x8(%ebp),%eax
+ 554:	8b 00                	mov    (%eax),%eax
+ 556:	83 ec 04             	sub    $0x4,%esp
+ 559:	52                   	push   %edx
+ 55a:	51                   	push   %ecx
+ 55b:	50                   	push   %eax
+ 55c:	e8 d0 fe ff ff       	call   431 <writev>
+ 561:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 564:	8b 45 08             	mov    0x8(%ebp),%eax
+ 567:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 56e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 571:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 578:	00 00 00 
+}
+ 57b:	90                   	nop
+ 57c:	c9                   	leave
+ 57d:	c3                   	ret
+
+0000057e <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 57e:	55                   	push   %ebp
+ 57f:	89 e5                	mov    %esp,%ebp
+ 581:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 584:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 588:	0f 84 94 00 00 00    	je     622 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 58e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 591:	8b 40 04             	mov    0x4(%eax),%eax
+ 594:	85 c0                	test   %eax,%eax
+ 596:	7e 40                	jle    5d8 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 598:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59b:	8b 40 04             	mov    0x4(%eax),%eax
+ 59e:	83 e8 01             	sub    $0x1,%eax
+ 5a1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 5a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ab:	01 d0                	add    %edx,%eax
+ 5ad:	83 c0 08             	add    $0x8,%eax
+ 5b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 5b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b6:	8b 10                	mov    (%eax),%edx
+ 5b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5bb:	8b 40 04             	mov    0x4(%eax),%eax
+ 5be:	01 d0                	add    %edx,%eax
+ 5c0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 5c3:	75 13                	jne    5d8 <put+0x5a>
+      v->iov_len += n;
+ 5c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c8:	8b 50 04             	mov    0x4(%eax),%edx
+ 5cb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5ce:	01 c2                	add    %eax,%edx
+ 5d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d3:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 5d6:	eb 4b                	jmp    623 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 5d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5db:	8b 40 04             	mov    0x4(%eax),%eax
+ 5de:	83 f8 10             	cmp    $0x10,%eax
+ 5e1:	75 0e                	jne    5f1 <put+0x73>
+    flush(o);
+ 5e3:	83 ec 0c             	sub    $0xc,%esp
+ 5e6:	ff 75 08             	push   0x8(%ebp)
+ 5e9:	e8 47 ff ff ff       	call   535 <flush>
+ 5ee:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 5f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f4:	8b 50 04             	mov    0x4(%eax),%edx
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 5fd:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 601:	8b 45 08             	mov    0x8(%ebp),%eax
+ 604:	8b 50 04             	mov    0x4(%eax),%edx
+ 607:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 60d:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 611:	8b 45 08             	mov    0x8(%ebp),%eax
+ 614:	8b 40 04             	mov    0x4(%eax),%eax
+ 617:	8d 50 01             	lea    0x1(%eax),%edx
+ 61a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61d:	89 50 04             	mov    %edx,0x4(%eax)
+ 620:	eb 01                	jmp    623 <put+0xa5>
+    return;
+ 622:	90                   	nop
+}
+ 623:	c9                   	leave
+ 624:	c3                   	ret
+
+00000625 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 625:	55                   	push   %ebp
+ 626:	89 e5                	mov    %esp,%ebp
+ 628:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 62b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62e:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 634:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 637:	01 d0                	add    %edx,%eax
+ 639:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 63e:	77 0b                	ja     64b <room+0x26>
+ 640:	8b 45 08             	mov    0x8(%ebp),%eax
+ 643:	8b 40 04             	mov    0x4(%eax),%eax
+ 646:	83 f8 10             	cmp    $0x10,%eax
+ 649:	75 0e                	jne    659 <room+0x34>
+    flush(o);
+ 64b:	83 ec 0c             	sub    $0xc,%esp
+ 64e:	ff 75 08             	push   0x8(%ebp)
+ 651:	e8 df fe ff ff       	call   535 <flush>
+ 656:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 659:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65c:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 662:	8b 45 08             	mov    0x8(%ebp),%eax
+ 665:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 66b:	01 d0                	add    %edx,%eax
+}
+ 66d:	c9                   	leave
+ 66e:	c3                   	ret
+
+0000066f <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 66f:	55                   	push   %ebp
+ 670:	89 e5                	mov    %esp,%ebp
+ 672:	83 ec 28             	sub    $0x28,%esp
+ 675:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 678:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 67b:	83 ec 08             	sub    $0x8,%esp
+ 67e:	6a 01                	push   $0x1
+ 680:	ff 75 08             	push   0x8(%ebp)
+ 683:	e8 9d ff ff ff       	call   625 <room>
+ 688:	83 c4 10             	add    $0x10,%esp
+ 68b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 68e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 691:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 695:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 697:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 6ac:	83 ec 04             	sub    $0x4,%esp
+ 6af:	6a 01                	push   $0x1
+ 6b1:	ff 75 f4             	push   -0xc(%ebp)
+ 6b4:	ff 75 08             	push   0x8(%ebp)
+ 6b7:	e8 c2 fe ff ff       	call   57e <put>
+ 6bc:	83 c4 10             	add    $0x10,%esp
+}
+ 6bf:	90                   	nop
+ 6c0:	c9                   	leave
+ 6c1:	c3                   	ret
+
+000006c2 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 6c2:	55                   	push   %ebp
+ 6c3:	89 e5                	mov    %esp,%ebp
+ 6c5:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 6c8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6cf:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6d3:	74 17                	je     6ec <printint+0x2a>
+ 6d5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6d9:	79 11                	jns    6ec <printint+0x2a>
+    neg = 1;
+ 6db:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6e5:	f7 d8                	neg    %eax
+ 6e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6ea:	eb 06                	jmp    6f2 <printint+0x30>
+  } else {
+    x = xx;
+ 6ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6ff:	ba 00 00 00 00       	mov    $0x0,%edx
+ 704:	f7 f1                	div    %ecx
+ 706:	89 d1                	mov    %edx,%ecx
+ 708:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70b:	8d 50 01             	lea    0x1(%eax),%edx
+ 70e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 711:	0f b6 91 18 12 00 00 	movzbl 0x1218(%ecx),%edx
+ 718:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 71c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 722:	ba 00 00 00 00       	mov    $0x0,%edx
+ 727:	f7 f1                	div    %ecx
+ 729:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 72c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 730:	75 c7                	jne    6f9 <printint+0x37>
+  if(neg)
+ 732:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 736:	74 0e                	je     746 <printint+0x84>
+    buf[i++] = '-';
+ 738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 73b:	8d 50 01             	lea    0x1(%eax),%edx
+ 73e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 741:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 749:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 74c:	83 ec 08             	sub    $0x8,%esp
+ 74f:	ff 75 e8             	push   -0x18(%ebp)
+ 752:	ff 75 08             	push   0x8(%ebp)
+ 755:	e8 cb fe ff ff       	call   625 <room>
+ 75a:	83 c4 10             	add    $0x10,%esp
+ 75d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 760:	eb 1d                	jmp    77f <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 762:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 765:	83 e8 01             	sub    $0x1,%eax
+ 768:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 76b:	89 c2                	mov    %eax,%edx
+ 76d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 770:	01 c2                	add    %eax,%edx
+ 772:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 775:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 778:	01 c8                	add    %ecx,%eax
+ 77a:	0f b6 00             	movzbl (%eax),%eax
+ 77d:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 77f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 783:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 787:	79 d9                	jns    762 <printint+0xa0>
+  o->used += n;
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+ 78c:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 792:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 795:	01 c2                	add    %eax,%edx
+ 797:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79a:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	ff 75 e8             	push   -0x18(%ebp)
+ 7a6:	ff 75 e4             	push   -0x1c(%ebp)
+ 7a9:	ff 75 08             	push   0x8(%ebp)
+ 7ac:	e8 cd fd ff ff       	call   57e <put>
+ 7b1:	83 c4 10             	add    $0x10,%esp
+}
+ 7b4:	90                   	nop
+ 7b5:	c9                   	leave
+ 7b6:	c3                   	ret
+
+000007b7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7b7:	55                   	push   %ebp
+ 7b8:	89 e5                	mov    %esp,%ebp
+ 7ba:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 7c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 7c9:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 7d0:	00 00 00 
+  o.used = 0;
+ 7d3:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 7da:	00 00 00 
+  state = 0;
+ 7dd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7e4:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7e7:	83 c0 04             	add    $0x4,%eax
+ 7ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 7ed:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7f4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7fb:	e9 82 01 00 00       	jmp    982 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 800:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 803:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 806:	01 d0                	add    %edx,%eax
+ 808:	0f b6 00             	movzbl (%eax),%eax
+ 80b:	0f be c0             	movsbl %al,%eax
+ 80e:	25 ff 00 00 00       	and    $0xff,%eax
+ 813:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 816:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 81a:	75 38                	jne    854 <printf+0x9d>
+      if(c == '%'){
+ 81c:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 820:	0f 85 58 01 00 00    	jne    97e <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 826:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 829:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 82c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 82f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 832:	01 ca                	add    %ecx,%edx
+ 834:	83 ec 04             	sub    $0x4,%esp
+ 837:	50                   	push   %eax
+ 838:	52                   	push   %edx
+ 839:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 83f:	50                   	push   %eax
+ 840:	e8 39 fd ff ff       	call   57e <put>
+ 845:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 848:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 84f:	e9 2a 01 00 00       	jmp    97e <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 854:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 858:	0f 85 20 01 00 00    	jne    97e <printf+0x1c7>
+      if(c == 'd'){
+ 85e:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 862:	75 22                	jne    886 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 864:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 867:	8b 00                	mov    (%eax),%eax
+ 869:	6a 01                	push   $0x1
+ 86b:	6a 0a                	push   $0xa
+ 86d:	50                   	push   %eax
+ 86e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 874:	50                   	push   %eax
+ 875:	e8 48 fe ff ff       	call   6c2 <printint>
+ 87a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 87d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 881:	e9 e8 00 00 00       	jmp    96e <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 886:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 88a:	74 06                	je     892 <printf+0xdb>
+ 88c:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 890:	75 22                	jne    8b4 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 892:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 895:	8b 00                	mov    (%eax),%eax
+ 897:	6a 00                	push   $0x0
+ 899:	6a 10                	push   $0x10
+ 89b:	50                   	push   %eax
+ 89c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8a2:	50                   	push   %eax
+ 8a3:	e8 1a fe ff ff       	call   6c2 <printint>
+ 8a8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8ab:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8af:	e9 ba 00 00 00       	jmp    96e <printf+0x1b7>
+      } else if(c == 's'){
+ 8b4:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 8b8:	75 3f                	jne    8f9 <printf+0x142>
+        s = (char*)*ap;
+ 8ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8bd:	8b 00                	mov    (%eax),%eax
+ 8bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8c2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 8c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ca:	75 07                	jne    8d3 <printf+0x11c>
+          s = "(null)";
+ 8cc:	c7 45 f4 84 0e 00 00 	movl   $0xe84,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	ff 75 f4             	push   -0xc(%ebp)
+ 8d9:	e8 47 f8 ff ff       	call   125 <strlen>
+ 8de:	83 c4 10             	add    $0x10,%esp
+ 8e1:	83 ec 04             	sub    $0x4,%esp
+ 8e4:	50                   	push   %eax
+ 8e5:	ff 75 f4             	push   -0xc(%ebp)
+ 8e8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8ee:	50                   	push   %eax
+ 8ef:	e8 8a fc ff ff       	call   57e <put>
+ 8f4:	83 c4 10             	add    $0x10,%esp
+ 8f7:	eb 75                	jmp    96e <printf+0x1b7>
+      } else if(c == 'c'){
+ 8f9:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 8fd:	75 21                	jne    920 <printf+0x169>
+        putc(&o, *ap);
+ 8ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 902:	8b 00                	mov    (%eax),%eax
+ 904:	0f be c0             	movsbl %al,%eax
+ 907:	83 ec 08             	sub    $0x8,%esp
+ 90a:	50                   	push   %eax
+ 90b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 911:	50                   	push   %eax
+ 912:	e8 58 fd ff ff       	call   66f <putc>
+ 917:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 91a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 91e:	eb 4e                	jmp    96e <printf+0x1b7>
+      } else if(c == '%'){
+ 920:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 924:	75 1b                	jne    941 <printf+0x18a>
+        putc(&o, c);
+ 926:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 929:	0f be c0             	movsbl %al,%eax
+ 92c:	83 ec 08             	sub    $0x8,%esp
+ 92f:	50                   	push   %eax
+ 930:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 936:	50                   	push   %eax
+ 937:	e8 33 fd ff ff       	call   66f <putc>
+ 93c:	83 c4 10             	add    $0x10,%esp
+ 93f:	eb 2d                	jmp    96e <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 941:	83 ec 08             	sub    $0x8,%esp
+ 944:	6a 25                	push   $0x25
+ 946:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 94c:	50                   	push   %eax
+ 94d:	e8 1d fd ff ff       	call   66f <putc>
+ 952:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 955:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 958:	0f be c0             	movsbl %al,%eax
+ 95b:	83 ec 08             	sub    $0x8,%esp
+ 95e:	50                   	push   %eax
+ 95f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 965:	50                   	push   %eax
+ 966:	e8 04 fd ff ff       	call   66f <putc>
+ 96b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 96e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 975:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 978:	83 c0 01             	add    $0x1,%eax
+ 97b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 97e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 982:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 985:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 988:	01 d0                	add    %edx,%eax
+ 98a:	0f b6 00             	movzbl (%eax),%eax
+ 98d:	84 c0                	test   %al,%al
+ 98f:	0f 85 6b fe ff ff    	jne    800 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 995:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 999:	75 22                	jne    9bd <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 99b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 99e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9a4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9a7:	01 ca                	add    %ecx,%edx
+ 9a9:	83 ec 04             	sub    $0x4,%esp
+ 9ac:	50                   	push   %eax
+ 9ad:	52                   	push   %edx
+ 9ae:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9b4:	50                   	push   %eax
+ 9b5:	e8 c4 fb ff ff       	call   57e <put>
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 9bd:	83 ec 0c             	sub    $0xc,%esp
+ 9c0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9c6:	50                   	push   %eax
+ 9c7:	e8 69 fb ff ff       	call   535 <flush>
+ 9cc:	83 c4 10             	add    $0x10,%esp
+}
+ 9cf:	90                   	nop
+ 9d0:	c9                   	leave
+ 9d1:	c3                   	ret
+
+000009d2 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 9d2:	55                   	push   %ebp
+ 9d3:	89 e5                	mov    %esp,%ebp
+ 9d5:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 9d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 9e1:	f0 87 02             	lock xchg %eax,(%edx)
+ 9e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ 9e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ 9ea:	c9                   	leave
+ 9eb:	c3                   	ret
+
+000009ec <lock>:
+{
+ 9ec:	55                   	push   %ebp
+ 9ed:	89 e5                	mov    %esp,%ebp
+ 9ef:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ 9f2:	a1 2c 12 00 00       	mov    0x122c,%eax
+ 9f7:	85 c0                	test   %eax,%eax
+ 9f9:	74 09                	je     a04 <lock+0x18>
+ 9fb:	a1 2c 12 00 00       	mov    0x122c,%eax
+ a00:	ff d0                	call   *%eax
+ a02:	eb 05                	jmp    a09 <lock+0x1d>
+ a04:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a09:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a0c:	90                   	nop
+ a0d:	83 ec 08             	sub    $0x8,%esp
+ a10:	6a 01                	push   $0x1
+ a12:	68 64 12 00 00       	push   $0x1264
+ a17:	e8 b6 ff ff ff       	call   9d2 <xchg>
+ a1c:	83 c4 10             	add    $0x10,%esp
+ a1f:	85 c0                	test   %eax,%eax
+ a21:	75 ea                	jne    a0d <lock+0x21>
+  return pin;
+ a23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a26:	c9                   	leave
+ a27:	c3                   	ret
+
+00000a28 <unlock>:
+{
+ a28:	55                   	push   %ebp
+ a29:	89 e5                	mov    %esp,%ebp
+ a2b:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a2e:	6a 00                	push   $0x0
+ a30:	68 64 12 00 00       	push   $0x1264
+ a35:	e8 98 ff ff ff       	call   9d2 <xchg>
+ a3a:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a3d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a41:	78 10                	js     a53 <unlock+0x2b>
+    mallocunpin(pin);
+ a43:	a1 30 12 00 00       	mov    0x1230,%eax
+ a48:	83 ec 0c             	sub    $0xc,%esp
+ a4b:	ff 75 08             	push   0x8(%ebp)
+ a4e:	ff d0                	call   *%eax
+ a50:	83 c4 10             	add    $0x10,%esp
+}
+ a53:	90                   	nop
+ a54:	c9                   	leave
+ a55:	c3                   	ret
+
+00000a56 <sizeclass>:
+{
+ a56:	55                   	push   %ebp
+ a57:	89 e5                	mov    %esp,%ebp
+ a59:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ a5c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ a63:	eb 1c                	jmp    a81 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a68:	ba 02 00 00 00       	mov    $0x2,%edx
+ a6d:	89 c1                	mov    %eax,%ecx
+ a6f:	d3 e2                	shl    %cl,%edx
+ a71:	89 d0                	mov    %edx,%eax
+ a73:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a76:	72 05                	jb     a7d <sizeclass+0x27>
+      return c;
+ a78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a7b:	eb 0f                	jmp    a8c <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a7d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a81:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ a85:	7e de                	jle    a65 <sizeclass+0xf>
+  return -1;
+ a87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ a8c:	c9                   	leave
+ a8d:	c3                   	ret
+
+00000a8e <bigfree>:
+{
+ a8e:	55                   	push   %ebp
+ a8f:	89 e5                	mov    %esp,%ebp
+ a91:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a94:	a1 3c 12 00 00       	mov    0x123c,%eax
+ a99:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a9c:	eb 24                	jmp    ac2 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa1:	8b 00                	mov    (%eax),%eax
+ aa3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aa6:	72 12                	jb     aba <bigfree+0x2c>
+ aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+ aab:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aae:	72 24                	jb     ad4 <bigfree+0x46>
+ ab0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab3:	8b 00                	mov    (%eax),%eax
+ ab5:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ab8:	72 1a                	jb     ad4 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abd:	8b 00                	mov    (%eax),%eax
+ abf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ac2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ac8:	73 d4                	jae    a9e <bigfree+0x10>
+ aca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acd:	8b 00                	mov    (%eax),%eax
+ acf:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ad2:	73 ca                	jae    a9e <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad7:	8b 40 04             	mov    0x4(%eax),%eax
+ ada:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae4:	01 c2                	add    %eax,%edx
+ ae6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae9:	8b 00                	mov    (%eax),%eax
+ aeb:	39 c2                	cmp    %eax,%edx
+ aed:	75 24                	jne    b13 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ aef:	8b 45 08             	mov    0x8(%ebp),%eax
+ af2:	8b 50 04             	mov    0x4(%eax),%edx
+ af5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af8:	8b 00                	mov    (%eax),%eax
+ afa:	8b 40 04             	mov    0x4(%eax),%eax
+ afd:	01 c2                	add    %eax,%edx
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b08:	8b 00                	mov    (%eax),%eax
+ b0a:	8b 10                	mov    (%eax),%edx
+ b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0f:	89 10                	mov    %edx,(%eax)
+ b11:	eb 0a                	jmp    b1d <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b16:	8b 10                	mov    (%eax),%edx
+ b18:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b1d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b20:	8b 40 04             	mov    0x4(%eax),%eax
+ b23:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2d:	01 d0                	add    %edx,%eax
+ b2f:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b32:	75 20                	jne    b54 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b34:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b37:	8b 50 04             	mov    0x4(%eax),%edx
+ b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3d:	8b 40 04             	mov    0x4(%eax),%eax
+ b40:	01 c2                	add    %eax,%edx
+ b42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b45:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b48:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4b:	8b 10                	mov    (%eax),%edx
+ b4d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b50:	89 10                	mov    %edx,(%eax)
+ b52:	eb 08                	jmp    b5c <bigfree+0xce>
+    p->s.ptr = bp;
+ b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b57:	8b 55 08             	mov    0x8(%ebp),%edx
+ b5a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b5c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b5f:	a3 3c 12 00 00       	mov    %eax,0x123c
+}
+ b64:	90                   	nop
+ b65:	c9                   	leave
+ b66:	c3                   	ret
+
+00000b67 <free>:
+{
+ b67:	55                   	push   %ebp
+ b68:	89 e5                	mov    %esp,%ebp
+ b6a:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b6d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b71:	74 68                	je     bdb <free+0x74>
+  bp = (Header*)ap - 1;
+ b73:	8b 45 08             	mov    0x8(%ebp),%eax
+ b76:	83 e8 08             	sub    $0x8,%eax
+ b79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b7c:	e8 6b fe ff ff       	call   9ec <lock>
+ b81:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ b84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b87:	8b 40 04             	mov    0x4(%eax),%eax
+ b8a:	83 ec 0c             	sub    $0xc,%esp
+ b8d:	50                   	push   %eax
+ b8e:	e8 c3 fe ff ff       	call   a56 <sizeclass>
+ b93:	83 c4 10             	add    $0x10,%esp
+ b96:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b99:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b9d:	78 1e                	js     bbd <free+0x56>
+    bp->s.ptr = classfree[c];
+ b9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ba2:	8b 14 85 40 12 00 00 	mov    0x1240(,%eax,4),%edx
+ ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bac:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ bae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bb1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ bb4:	89 14 85 40 12 00 00 	mov    %edx,0x1240(,%eax,4)
+ bbb:	eb 0e                	jmp    bcb <free+0x64>
+    bigfree(bp);
+ bbd:	83 ec 0c             	sub    $0xc,%esp
+ bc0:	ff 75 f4             	push   -0xc(%ebp)
+ bc3:	e8 c6 fe ff ff       	call   a8e <bigfree>
+ bc8:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ bcb:	83 ec 0c             	sub    $0xc,%esp
+ bce:	ff 75 f0             	push   -0x10(%ebp)
+ bd1:	e8 52 fe ff ff       	call   a28 <unlock>
+ bd6:	83 c4 10             	add    $0x10,%esp
+ bd9:	eb 01                	jmp    bdc <free+0x75>
+    return;
+ bdb:	90                   	nop
+}
+ bdc:	c9                   	leave
+ bdd:	c3                   	ret
+
+00000bde <morecore>:
+{
+ bde:	55                   	push   %ebp
+ bdf:	89 e5                	mov    %esp,%ebp
+ be1:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ be4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ beb:	77 07                	ja     bf4 <morecore+0x16>
+    nu = 4096;
+ bed:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf7:	c1 e0 03             	shl    $0x3,%eax
+ bfa:	83 ec 0c             	sub    $0xc,%esp
+ bfd:	50                   	push   %eax
+ bfe:	e8 b6 f7 ff ff       	call   3b9 <sbrk>
+ c03:	83 c4 10             	add    $0x10,%esp
+ c06:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c09:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c0d:	75 07                	jne    c16 <morecore+0x38>
+    return 0;
+ c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c14:	eb 22                	jmp    c38 <morecore+0x5a>
+  hp = (Header*)p;
+ c16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c19:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c22:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ c25:	83 ec 0c             	sub    $0xc,%esp
+ c28:	ff 75 f0             	push   -0x10(%ebp)
+ c2b:	e8 5e fe ff ff       	call   a8e <bigfree>
+ c30:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c33:	a1 3c 12 00 00       	mov    0x123c,%eax
+}
+ c38:	c9                   	leave
+ c39:	c3                   	ret
+
+00000c3a <bigalloc>:
+{
+ c3a:	55                   	push   %ebp
+ c3b:	89 e5                	mov    %esp,%ebp
+ c3d:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c40:	a1 3c 12 00 00       	mov    0x123c,%eax
+ c45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c48:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c4c:	75 23                	jne    c71 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c4e:	c7 45 f0 34 12 00 00 	movl   $0x1234,-0x10(%ebp)
+ c55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c58:	a3 3c 12 00 00       	mov    %eax,0x123c
+ c5d:	a1 3c 12 00 00       	mov    0x123c,%eax
+ c62:	a3 34 12 00 00       	mov    %eax,0x1234
+    base.s.size = 0;
+ c67:	c7 05 38 12 00 00 00 	movl   $0x0,0x1238
+ c6e:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c71:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c74:	8b 00                	mov    (%eax),%eax
+ c76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7c:	8b 40 04             	mov    0x4(%eax),%eax
+ c7f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c82:	72 4a                	jb     cce <bigalloc+0x94>
+      if(p->s.size == nunits)
+ c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c87:	8b 40 04             	mov    0x4(%eax),%eax
+ c8a:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c8d:	75 0c                	jne    c9b <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ c8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c92:	8b 10                	mov    (%eax),%edx
+ c94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c97:	89 10                	mov    %edx,(%eax)
+ c99:	eb 26                	jmp    cc1 <bigalloc+0x87>
+        p->s.size -= nunits;
+ c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9e:	8b 40 04             	mov    0x4(%eax),%eax
+ ca1:	2b 45 08             	sub    0x8(%ebp),%eax
+ ca4:	89 c2                	mov    %eax,%edx
+ ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca9:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ caf:	8b 40 04             	mov    0x4(%eax),%eax
+ cb2:	c1 e0 03             	shl    $0x3,%eax
+ cb5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+ cbe:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ cc1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc4:	a3 3c 12 00 00       	mov    %eax,0x123c
+      return p;
+ cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ccc:	eb 3b                	jmp    d09 <bigalloc+0xcf>
+    if(p == freep)
+ cce:	a1 3c 12 00 00       	mov    0x123c,%eax
+ cd3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cd6:	75 1e                	jne    cf6 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ cd8:	83 ec 0c             	sub    $0xc,%esp
+ cdb:	ff 75 08             	push   0x8(%ebp)
+ cde:	e8 fb fe ff ff       	call   bde <morecore>
+ ce3:	83 c4 10             	add    $0x10,%esp
+ ce6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ce9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ced:	75 07                	jne    cf6 <bigalloc+0xbc>
+        return 0;
+ cef:	b8 00 00 00 00       	mov    $0x0,%eax
+ cf4:	eb 13                	jmp    d09 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cff:	8b 00                	mov    (%eax),%eax
+ d01:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d04:	e9 70 ff ff ff       	jmp    c79 <bigalloc+0x3f>
+}
+ d09:	c9                   	leave
+ d0a:	c3                   	ret
+
+00000d0b <alloc>:
+alloc(uint nbytes)
+{
+ d0b:	55                   	push   %ebp
+ d0c:	89 e5                	mov    %esp,%ebp
+ d0e:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d11:	8b 45 08             	mov    0x8(%ebp),%eax
+ d14:	83 c0 07             	add    $0x7,%eax
+ d17:	c1 e8 03             	shr    $0x3,%eax
+ d1a:	83 c0 01             	add    $0x1,%eax
+ d1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d20:	ff 75 f4             	push   -0xc(%ebp)
+ d23:	e8 2e fd ff ff       	call   a56 <sizeclass>
+ d28:	83 c4 04             	add    $0x4,%esp
+ d2b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d2e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d32:	79 2c                	jns    d60 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d34:	83 ec 0c             	sub    $0xc,%esp
+ d37:	ff 75 f4             	push   -0xc(%ebp)
+ d3a:	e8 fb fe ff ff       	call   c3a <bigalloc>
+ d3f:	83 c4 10             	add    $0x10,%esp
+ d42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d45:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d49:	75 0a                	jne    d55 <alloc+0x4a>
+      return 0;
+ d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+ d50:	e9 c8 00 00 00       	jmp    e1d <alloc+0x112>
+    return (void*)(p + 1);
+ d55:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d58:	83 c0 08             	add    $0x8,%eax
+ d5b:	e9 bd 00 00 00       	jmp    e1d <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ d60:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d63:	8b 04 85 40 12 00 00 	mov    0x1240(,%eax,4),%eax
+ d6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d71:	74 1a                	je     d8d <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d76:	8b 10                	mov    (%eax),%edx
+ d78:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d7b:	89 14 85 40 12 00 00 	mov    %edx,0x1240(,%eax,4)
+    return (void*)(p + 1);
+ d82:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d85:	83 c0 08             	add    $0x8,%eax
+ d88:	e9 90 00 00 00       	jmp    e1d <alloc+0x112>
+  }
+  nunits = 2 << c;
+ d8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d90:	ba 02 00 00 00       	mov    $0x2,%edx
+ d95:	89 c1                	mov    %eax,%ecx
+ d97:	d3 e2                	shl    %cl,%edx
+ d99:	89 d0                	mov    %edx,%eax
+ d9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ d9e:	a1 5c 12 00 00       	mov    0x125c,%eax
+ da3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ da6:	c1 e2 03             	shl    $0x3,%edx
+ da9:	01 d0                	add    %edx,%eax
+ dab:	8b 15 60 12 00 00    	mov    0x1260,%edx
+ db1:	39 c2                	cmp    %eax,%edx
+ db3:	73 3f                	jae    df4 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ db5:	83 ec 0c             	sub    $0xc,%esp
+ db8:	68 00 08 00 00       	push   $0x800
+ dbd:	e8 78 fe ff ff       	call   c3a <bigalloc>
+ dc2:	83 c4 10             	add    $0x10,%esp
+ dc5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ dc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dcc:	75 07                	jne    dd5 <alloc+0xca>
+      return 0;
+ dce:	b8 00 00 00 00       	mov    $0x0,%eax
+ dd3:	eb 48                	jmp    e1d <alloc+0x112>
+    bump = (char*)p;
+ dd5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dd8:	a3 5c 12 00 00       	mov    %eax,0x125c
+    bumpend = (char*)(p + p->s.size);
+ ddd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ de0:	8b 40 04             	mov    0x4(%eax),%eax
+ de3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ dea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ded:	01 d0                	add    %edx,%eax
+ def:	a3 60 12 00 00       	mov    %eax,0x1260
+  }
+  p = (Header*)bump;
+ df4:	a1 5c 12 00 00       	mov    0x125c,%eax
+ df9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ dfc:	a1 5c 12 00 00       	mov    0x125c,%eax
+ e01:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e04:	c1 e2 03             	shl    $0x3,%edx
+ e07:	01 d0                	add    %edx,%eax
+ e09:	a3 5c 12 00 00       	mov    %eax,0x125c
+  p->s.size = nunits;
+ e0e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e11:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e14:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ e17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e1a:	83 c0 08             	add    $0x8,%eax
+}
+ e1d:	c9                   	leave
+ e1e:	c3                   	ret
+
+00000e1f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e1f:	55                   	push   %ebp
+ e20:	89 e5                	mov    %esp,%ebp
+ e22:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ e25:	e8 c2 fb ff ff       	call   9ec <lock>
+ e2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e2d:	83 ec 0c             	sub    $0xc,%esp
+ e30:	ff 75 08             	push   0x8(%ebp)
+ e33:	e8 d3 fe ff ff       	call   d0b <alloc>
+ e38:	83 c4 10             	add    $0x10,%esp
+ e3b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e3e:	83 ec 0c             	sub    $0xc,%esp
+ e41:	ff 75 f4             	push   -0xc(%ebp)
+ e44:	e8 df fb ff ff       	call   a28 <unlock>
+ e49:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e4f:	c9                   	leave
+ e50:	c3                   	ret
@@ -12,29 +12,37 @@
 #include "param.h"
 
 /*vvv  TASK 1.1  vvv*/
-int nblocks = 32768 - 62 - LOGSIZE;
+int nblocks;  // whatever size leaves after the rest
 /*^^^^^^^^^^^^^^^^^^*/
-int nlog = LOGSIZE;
+int nlog = LOGSIZE + 1;  // header and data sectors
+int features;
+int nhash;  // buckets of the root directory; 0 for a linear one
 int ninodes = 200;
 /*vvv  TASK 1.1  vvv*/
-int size = 32768;
+int size = 16*1024*1024 / BSIZE;
+int nswap;  // swap blocks after the file system
 /*^^^^^^^^^^^^^^^^^^*/
 
+uchar *img;  // the whole image, written out at the end
 int fsfd;
+int fsfd2;   // second image of a striped file system
+int stripe;  // blocks per stripe unit; 0 for one image
 struct superblock sb;
-char zeroes[512];
 uint freeblock;
 uint usedblocks;
 uint bitblocks;
 uint freeinode = 1;
 
 void balloc(int);
+void writeimg(void);
 void wsect(uint, void*);
 void winode(uint, struct dinode*);
 void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void *readfile(int fd, int *n);
+void dirinsert(uint inum, struct dirent *de);
 
 // convert to intel byte order
 ushort
@@ -62,19 +70,74 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
-  uint rootino, inum, off;
+  int i, n, fd;
+  uint rootino, off, inums[argc];
+  void *data;
   struct dirent de;
-  char buf[512];
+  char buf[BSIZE];
   struct dinode din;
 
+  for(; argc >= 2 && argv[1][0] == '-'; argc--, argv++){
+    if(strcmp(argv[1], "-e") == 0)
+      features |= FS_EXTENTS;
+    else if(strcmp(argv[1], "-f") == 0 && argc >= 3){
+      features |= strtoul(argv[2], 0, 0);
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-b") == 0 && argc >= 3){
+      size = atoi(argv[2]);
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-i") == 0 && argc >= 3){
+      ninodes = atoi(argv[2]);
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-l") == 0 && argc >= 3){
+      nlog = atoi(argv[2]);
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-h") == 0 && argc >= 3){
+      nhash = atoi(argv[2]);
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-w") == 0 && argc >= 3){
+      nswap = atoi(argv[2]) * 1024 / BSIZE;
+      argc--;
+      argv++;
+    } else if(strcmp(argv[1], "-s") == 0 && argc >= 4){
+      stripe = atoi(argv[2]);
+      fsfd2 = open(argv[3], O_RDWR|O_CREAT|O_TRUNC, 0666);
+      if(fsfd2 < 0){
+        perror(argv[3]);
+        exit(1);
+      }
+      argc -= 2;
+      argv += 2;
+    } else
+      argc = 0;
+  }
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-e] [-f features] [-b size] [-i ninodes] [-l nlog] "
+            "[-h nhash] [-w swapkb] [-s stripe fs1.img] fs.img files...\n");
+    exit(1);
+  }
+  if(fsfd2 && stripe < 2){
+    fprintf(stderr, "mkfs: stripe must be at least 2 blocks\n");
+    exit(1);
+  }
+  if(nlog < MAXOPBLOCKS + NDIRHASH + 1 || nlog > LOGSIZE + 1){
+    fprintf(stderr, "mkfs: nlog must be %d to %d\n",
+            MAXOPBLOCKS + NDIRHASH + 1, LOGSIZE + 1);
     exit(1);
   }
 
-  assert((512 % sizeof(struct dinode)) == 0);
-  assert((512 % sizeof(struct dirent)) == 0);
+  if(ninodes < argc || ninodes > 65535){
+    fprintf(stderr, "mkfs: ninodes must be %d to 65535\n", argc);
+    exit(1);
+  }
+
+  assert((BSIZE % sizeof(struct dinode)) == 0);
+  assert((BSIZE % sizeof(struct dirent)) == 0);
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
@@ -82,23 +145,33 @@ main(int argc, char *argv[])
     exit(1);
   }
 
+  bitblocks = size/BPB + 1;
+  usedblocks = ninodes / IPB + 3 + bitblocks;
+  freeblock = usedblocks;
+  nblocks = size - usedblocks - nlog;
+  if(nblocks <= 0){
+    fprintf(stderr, "mkfs: size %d leaves no data blocks\n", size);
+    exit(1);
+  }
+  if((img = calloc(size + nswap, BSIZE)) == 0){
+    perror("calloc");
+    exit(1);
+  }
+
   sb.size = xint(size);
   sb.nblocks = xint(nblocks); // so whole disk is size sectors
   sb.ninodes = xint(ninodes);
   sb.nlog = xint(nlog);
-
-  bitblocks = size/(512*8) + 1;
-  usedblocks = ninodes / IPB + 3 + bitblocks;
-  freeblock = usedblocks;
+  sb.features = xint(features);
+  sb.stripe = xint(stripe);
+  sb.bsize = xint(BSIZE);
+  sb.nswap = xint(nswap);
 
   printf("used %d (bit %d ninode %zu) free %u log %u total %d\n", usedblocks,
          bitblocks, ninodes/IPB + 1, freeblock, nlog, nblocks+usedblocks+nlog);
 
   assert(nblocks + usedblocks + nlog == size);
 
-  for(i = 0; i < nblocks + usedblocks + nlog; i++)
-    wsect(i, zeroes);
-
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
   wsect(1, buf);
@@ -106,67 +179,117 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
+  if(nhash > 0){
+    // Empty buckets first.
+    assert(nhash <= NDIRECT);
+    bzero(buf, sizeof(buf));
+    for(i = 0; i < nhash; i++)
+      iappend(rootino, buf, sizeof(buf));
+    rinode(rootino, &din);
+    din.nhash = xshort(nhash);
+    winode(rootino, &din);
+  }
+
   bzero(&de, sizeof(de));
   de.inum = xshort(rootino);
   strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
+  dirinsert(rootino, &de);
 
   bzero(&de, sizeof(de));
   de.inum = xshort(rootino);
   strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  dirinsert(rootino, &de);
 
+  // All the directory entries first, so that the root directory's
+  // blocks come together, then each file's data in one piece.
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
 
-    if((fd = open(argv[i], 0)) < 0){
-      perror(argv[i]);
-      exit(1);
-    }
-    
     // Skip leading _ in name when writing to file system.
     // The binaries are named _rm, _cat, etc. to keep the
     // build operating system from trying to execute them
     // in place of system binaries like rm and cat.
-    if(argv[i][0] == '_')
-      ++argv[i];
-
-    inum = ialloc(T_FILE);
-
+    inums[i] = ialloc(T_FILE);
     bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
-
-    while((cc = read(fd, buf, sizeof(buf))) > 0)
-      iappend(inum, buf, cc);
+    de.inum = xshort(inums[i]);
+    strncpy(de.name, argv[i] + (argv[i][0] == '_'), DIRSIZ);
+    dirinsert(rootino, &de);
+  }
 
+  for(i = 2; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      perror(argv[i]);
+      exit(1);
+    }
+    data = readfile(fd, &n);
+    iappend(inums[i], data, n);
+    free(data);
     close(fd);
   }
 
   // fix size of root inode dir
   rinode(rootino, &din);
   off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
+  off = ((off + BSIZE - 1)/BSIZE) * BSIZE;
   din.size = xint(off);
   winode(rootino, &din);
 
   balloc(usedblocks);
+  writeimg();
 
   exit(0);
 }
 
+// Write the image out in order, swap space and all.  Striped,
+// units of stripe blocks alternate between fs.img and the second
+// image, as the kernel's ide.c expects.
 void
-wsect(uint sec, void *buf)
+writeimg(void)
 {
-  if(lseek(fsfd, sec * 512L, 0) != sec * 512L){
-    perror("lseek");
-    exit(1);
+  uint sec, n, total;
+  int fd;
+
+  total = size + nswap;
+  n = stripe ? stripe : total;
+  for(sec = 0; sec < total; sec += n){
+    fd = stripe && sec / stripe % 2 ? fsfd2 : fsfd;
+    if(sec + n > total)
+      n = total - sec;
+    if(write(fd, img + sec*(long)BSIZE, n*(long)BSIZE) != n*(long)BSIZE){
+      perror("write");
+      exit(1);
+    }
+  }
+}
+
+// Read all of file fd into memory.
+void*
+readfile(int fd, int *np)
+{
+  char *p;
+  int n, cc, max;
+
+  max = 4096;
+  n = 0;
+  p = malloc(max);
+  while(p && (cc = read(fd, p + n, max - n)) > 0){
+    n += cc;
+    if(n == max)
+      p = realloc(p, max *= 2);
   }
-  if(write(fsfd, buf, 512) != 512){
-    perror("write");
+  if(p == 0 || cc < 0){
+    perror("read");
     exit(1);
   }
+  *np = n;
+  return p;
+}
+
+void
+wsect(uint sec, void *buf)
+{
+  assert(sec < size);
+  memmove(img + sec*(long)BSIZE, buf, BSIZE);
 }
 
 uint
@@ -178,7 +301,7 @@ i2b(uint inum)
 void
 winode(uint inum, struct dinode *ip)
 {
-  char buf[512];
+  char buf[BSIZE];
   uint bn;
   struct dinode *dip;
 
@@ -192,7 +315,7 @@ winode(uint inum, struct dinode *ip)
 void
 rinode(uint inum, struct dinode *ip)
 {
-  char buf[512];
+  char buf[BSIZE];
   uint bn;
   struct dinode *dip;
 
@@ -205,14 +328,8 @@ rinode(uint inum, struct dinode *ip)
 void
 rsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * 512L, 0) != sec * 512L){
-    perror("lseek");
-    exit(1);
-  }
-  if(read(fsfd, buf, 512) != 512){
-    perror("read");
-    exit(1);
-  }
+  assert(sec < size);
+  memmove(buf, img + sec*(long)BSIZE, BSIZE);
 }
 
 uint
@@ -232,62 +349,104 @@ ialloc(ushort type)
 void
 balloc(int used)
 {
-  uchar buf[512];
+  uint b0;
   int i;
 
+  b0 = ninodes / IPB + 3;
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < 512*8);
-  bzero(buf, 512);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
-  }
-  printf("balloc: write bitmap block at sector %zu\n", ninodes/IPB + 3);
-  wsect(ninodes / IPB + 3, buf);
+  assert(used <= bitblocks*BPB);
+  for(i = 0; i < used; i++)
+    img[(b0 + i/BPB)*(long)BSIZE + i%BPB/8] |= 0x1 << (i%8);
+  printf("balloc: write bitmap block at sector %u\n", b0);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the disk block holding file block fbn of an extent-mapped
+// inode, allocating it if it is the next one.  Files are written
+// one after another out of freeblock, so only directories ever
+// need more than one extent, and the in-inode ones are plenty.
+uint
+emap(struct dinode *din, uint fbn)
+{
+  struct extent *e;
+  uint lbn;
+  int i;
+
+  e = (struct extent*)din->addrs;
+  lbn = 0;
+  for(i = 0; i < NIEXTENT && xint(e[i].len) != 0; i++){
+    if(fbn < lbn + xint(e[i].len))
+      return xint(e[i].start) + fbn - lbn;
+    lbn += xint(e[i].len);
+  }
+  assert(fbn == lbn);
+  if(i > 0 && xint(e[i-1].start) + xint(e[i-1].len) == freeblock)
+    e[i-1].len = xint(xint(e[i-1].len) + 1);
+  else {
+    assert(i < NIEXTENT);
+    e[i].start = xint(freeblock);
+    e[i].len = xint(1);
+  }
+  usedblocks++;
+  return freeblock++;
+}
+
+// Return the zero block at freeblock, the next one free.
+uint
+newblock(void)
+{
+  assert(freeblock < size - nlog);
+  usedblocks++;
+  return freeblock++;
+}
+
+// Return entry i of the block of addresses at disk block *bp,
+// allocating the block and the entry as needed.
+uint
+indirect(uint *bp, uint i)
+{
+  uint *a;
+
+  if(xint(*bp) == 0)
+    *bp = xint(newblock());
+  a = (uint*)(img + xint(*bp)*(long)BSIZE);
+  if(xint(a[i]) == 0)
+    a[i] = xint(newblock());
+  return xint(a[i]);
+}
+
+// Append n bytes at xp to inode inum.  Blocks come out of freeblock
+// in file order, each indirect block just before the first data
+// block it maps, so a file appended in one call is contiguous.
 void
 iappend(uint inum, void *xp, int n)
 {
   char *p = (char*)xp;
-  uint fbn, off, n1;
+  uint fbn, off, n1, x, bn;
   struct dinode din;
-  char buf[512];
-  uint indirect[NINDIRECT];
-  uint x;
 
   rinode(inum, &din);
 
   off = xint(din.size);
   while(n > 0){
-    fbn = off / 512;
+    fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-        usedblocks++;
-      }
+    if(features & FS_EXTENTS){
+      x = emap(&din, fbn);
+    } else if(fbn < NDIRECT){
+      if(xint(din.addrs[fbn]) == 0)
+        din.addrs[fbn] = xint(newblock());
       x = xint(din.addrs[fbn]);
+    } else if((bn = fbn - NDIRECT) < NINDIRECT){
+      x = indirect(&din.addrs[NDIRECT], bn);
     } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        // printf("allocate indirect block\n");
-        din.addrs[NDIRECT] = xint(freeblock++);
-        usedblocks++;
-      }
-      // printf("read indirect block\n");
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        usedblocks++;
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
+      bn -= NINDIRECT;
+      x = xint(indirect(&din.indirect2, bn / NINDIRECT));
+      x = indirect(&x, bn % NINDIRECT);
     }
-    n1 = min(n, (fbn + 1) * 512 - off);
-    rsect(x, buf);
-    bcopy(p, buf + off - (fbn * 512), n1);
-    wsect(x, buf);
+    n1 = min(n, (fbn + 1) * BSIZE - off);
+    memmove(img + x*(long)BSIZE + off - fbn*BSIZE, p, n1);
     n -= n1;
     off += n1;
     p += n1;
@@ -295,3 +454,53 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Hash of a name, for indexed directories.  Must match fs.c.
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  if(strncmp(name, ".", DIRSIZ) == 0 || strncmp(name, "..", DIRSIZ) == 0)
+    return 0;
+  h = 2166136261U;  // FNV-1a
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+// Try to put de into an empty entry of directory block fbn,
+// among the entries before byte end of the directory.
+int
+dirslot(struct dinode *din, uint fbn, uint end, struct dirent *de)
+{
+  struct dirent b[BSIZE/sizeof(struct dirent)];
+  uint x;
+  int i;
+
+  x = (features & FS_EXTENTS) ? emap(din, fbn) : xint(din->addrs[fbn]);
+  rsect(x, b);
+  for(i = 0; i < BSIZE/sizeof(struct dirent) && fbn*BSIZE + i*sizeof(*de) < end; i++){
+    if(b[i].inum == 0){
+      b[i] = *de;
+      wsect(x, b);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Add de to directory inum: into its bucket if the directory is
+// indexed and that has room, else append it.
+void
+dirinsert(uint inum, struct dirent *de)
+{
+  struct dinode din;
+  uint n;
+
+  rinode(inum, &din);
+  if((n = xshort(din.nhash)) == 0 ||
+     !dirslot(&din, dirhash(de->name) % n, n*BSIZE, de))
+    iappend(inum, de, sizeof(*de));
+}
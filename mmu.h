@@ -38,12 +38,23 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
 
+// CPUID leaf 1 %edx feature flags
+#define CPUID_SEP       0x00000800      // sysenter and sysexit
+
+// Model-specific registers
+#define MSR_SYSENTER_CS  0x174          // sysenter code segment
+#define MSR_SYSENTER_ESP 0x175          // sysenter stack pointer
+#define MSR_SYSENTER_EIP 0x176          // sysenter entry point
+
+// sysenter and sysexit find the kernel and user segments at fixed
+// offsets from SEG_KCODE, so the four must stay in this order.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
-#define SEG_KCPU  3  // kernel per-cpu data
-#define SEG_UCODE 4  // user code
-#define SEG_UDATA 5  // user data+stack
+#define SEG_UCODE 3  // user code
+#define SEG_UDATA 4  // user data+stack
+#define SEG_KCPU  5  // kernel per-cpu data
 #define SEG_TSS   6  // this process's task state
 
 //PAGEBREAK!
@@ -121,6 +132,7 @@ struct segdesc {
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
 #define PGSIZE          4096    // bytes mapped by a page
+#define BIGPGSIZE       (NPTENTRIES*PGSIZE)  // bytes mapped by a 4MB page
 
 #define PGSHIFT         12      // log2(PGSIZE)
 #define PTXSHIFT        12      // offset of PTX in a linear address
@@ -138,10 +150,16 @@ struct segdesc {
 #define PTE_A           0x020   // Accessed
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: kept in the TLB across %cr3 loads
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_COW         0x200   // Copy-on-write (bit available to software)
+#define PTE_PIN         0x400   // Kernel uses the page; fork copies it
+#define PTE_SWAP        0x800   // Not present: paged out to swap slot PTE_SLOT
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
+#define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
+#define PTE_SLOT(pte)   ((uint)(pte) >> PTXSHIFT)
 
 #ifndef __ASSEMBLER__
 typedef uint pte_t;
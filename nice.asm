@@ -0,0 +1,1825 @@
+
+_nice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc < 3){
+  11:	83 3b 02             	cmpl   $0x2,(%ebx)
+  14:	7f 17                	jg     2d <main+0x2d>
+    printf(2, "usage: nice level cmd [arg...]\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 70 0e 00 00       	push   $0xe70
+  1e:	6a 02                	push   $0x2
+  20:	e8 b0 07 00 00       	call   7d5 <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 18 03 00 00       	call   345 <exit>
+  }
+  if(setpriority(0, atoi(argv[1])) < 0){
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 04             	add    $0x4,%eax
+  33:	8b 00                	mov    (%eax),%eax
+  35:	83 ec 0c             	sub    $0xc,%esp
+  38:	50                   	push   %eax
+  39:	e8 35 02 00 00       	call   273 <atoi>
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	83 ec 08             	sub    $0x8,%esp
+  44:	50                   	push   %eax
+  45:	6a 00                	push   $0x0
+  47:	e8 35 04 00 00       	call   481 <setpriority>
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	85 c0                	test   %eax,%eax
+  51:	79 20                	jns    73 <main+0x73>
+    printf(2, "nice: bad level %s\n", argv[1]);
+  53:	8b 43 04             	mov    0x4(%ebx),%eax
+  56:	83 c0 04             	add    $0x4,%eax
+  59:	8b 00                	mov    (%eax),%eax
+  5b:	83 ec 04             	sub    $0x4,%esp
+  5e:	50                   	push   %eax
+  5f:	68 90 0e 00 00       	push   $0xe90
+  64:	6a 02                	push   $0x2
+  66:	e8 6a 07 00 00       	call   7d5 <printf>
+  6b:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6e:	e8 d2 02 00 00       	call   345 <exit>
+  }
+  exec(argv[2], argv+2);
+  73:	8b 43 04             	mov    0x4(%ebx),%eax
+  76:	8d 50 08             	lea    0x8(%eax),%edx
+  79:	8b 43 04             	mov    0x4(%ebx),%eax
+  7c:	83 c0 08             	add    $0x8,%eax
+  7f:	8b 00                	mov    (%eax),%eax
+  81:	83 ec 08             	sub    $0x8,%esp
+  84:	52                   	push   %edx
+  85:	50                   	push   %eax
+  86:	e8 eb 02 00 00       	call   376 <exec>
+  8b:	83 c4 10             	add    $0x10,%esp
+  printf(2, "nice: exec %s failed\n", argv[2]);
+  8e:	8b 43 04             	mov    0x4(%ebx),%eax
+  91:	83 c0 08             	add    $0x8,%eax
+  94:	8b 00                	mov    (%eax),%eax
+  96:	83 ec 04             	sub    $0x4,%esp
+  99:	50                   	push   %eax
+  9a:	68 a4 0e 00 00       	push   $0xea4
+  9f:	6a 02                	push   $0x2
+  a1:	e8 2f 07 00 00       	call   7d5 <printf>
+  a6:	83 c4 10             	add    $0x10,%esp
+  exit();
+  a9:	e8 97 02 00 00       	call   345 <exit>
+
+000000ae <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  ae:	55                   	push   %ebp
+  af:	89 e5                	mov    %esp,%ebp
+  b1:	57                   	push   %edi
+  b2:	53                   	push   %ebx
+    if(cc < 1)
+  b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  b6:	8b 55 10             	mov    0x10(%ebp),%edx
+  b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  bc:	89 cb                	mov    %ecx,%ebx
+  be:	89 df                	mov    %ebx,%edi
+  c0:	89 d1                	mov    %edx,%ecx
+  c2:	fc                   	cld
+  c3:	f3 aa                	rep stos %al,%es:(%edi)
+  c5:	89 ca                	mov    %ecx,%edx
+  c7:	89 fb                	mov    %edi,%ebx
+  c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  cc:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  cf:	90                   	nop
+  d0:	5b                   	pop    %ebx
+  d1:	5f                   	pop    %edi
+  d2:	5d                   	pop    %ebp
+  d3:	c3                   	ret
+
+000000d4 <strcpy>:
+{
+  d4:	55                   	push   %ebp
+  d5:	89 e5                	mov    %esp,%ebp
+  d7:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  da:	8b 45 08             	mov    0x8(%ebp),%eax
+  dd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  e0:	90                   	nop
+  e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  e4:	8d 42 01             	lea    0x1(%edx),%eax
+  e7:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  ed:	8d 48 01             	lea    0x1(%eax),%ecx
+  f0:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  f3:	0f b6 12             	movzbl (%edx),%edx
+  f6:	88 10                	mov    %dl,(%eax)
+  f8:	0f b6 00             	movzbl (%eax),%eax
+  fb:	84 c0                	test   %al,%al
+  fd:	75 e2                	jne    e1 <strcpy+0xd>
+  return os;
+  ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 102:	c9                   	leave
+ 103:	c3                   	ret
+
+00000104 <strcmp>:
+{
+ 104:	55                   	push   %ebp
+ 105:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 107:	eb 08                	jmp    111 <strcmp+0xd>
+    p++, q++;
+ 109:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 10d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 111:	8b 45 08             	mov    0x8(%ebp),%eax
+ 114:	0f b6 00             	movzbl (%eax),%eax
+ 117:	84 c0                	test   %al,%al
+ 119:	74 10                	je     12b <strcmp+0x27>
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	0f b6 10             	movzbl (%eax),%edx
+ 121:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 124:	0f b6 00             	movzbl (%eax),%eax
+ 127:	38 c2                	cmp    %al,%dl
+ 129:	74 de                	je     109 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	0f b6 d0             	movzbl %al,%edx
+ 134:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 137:	0f b6 00             	movzbl (%eax),%eax
+ 13a:	0f b6 c0             	movzbl %al,%eax
+ 13d:	29 c2                	sub    %eax,%edx
+ 13f:	89 d0                	mov    %edx,%eax
+}
+ 141:	5d                   	pop    %ebp
+ 142:	c3                   	ret
+
+00000143 <strlen>:
+{
+ 143:	55                   	push   %ebp
+ 144:	89 e5                	mov    %esp,%ebp
+ 146:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 149:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 150:	eb 04                	jmp    156 <strlen+0x13>
+ 152:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 156:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 159:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15c:	01 d0                	add    %edx,%eax
+ 15e:	0f b6 00             	movzbl (%eax),%eax
+ 161:	84 c0                	test   %al,%al
+ 163:	75 ed                	jne    152 <strlen+0xf>
+  return n;
+ 165:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 168:	c9                   	leave
+ 169:	c3                   	ret
+
+0000016a <memset>:
+{
+ 16a:	55                   	push   %ebp
+ 16b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 16d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 170:	50                   	push   %eax
+ 171:	ff 75 0c             	push   0xc(%ebp)
+ 174:	ff 75 08             	push   0x8(%ebp)
+ 177:	e8 32 ff ff ff       	call   ae <stosb>
+ 17c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 182:	c9                   	leave
+ 183:	c3                   	ret
+
+00000184 <strchr>:
+{
+ 184:	55                   	push   %ebp
+ 185:	89 e5                	mov    %esp,%ebp
+ 187:	83 ec 04             	sub    $0x4,%esp
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 190:	eb 14                	jmp    1a6 <strchr+0x22>
+    if(*s == c)
+ 192:	8b 45 08             	mov    0x8(%ebp),%eax
+ 195:	0f b6 00             	movzbl (%eax),%eax
+ 198:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 19b:	75 05                	jne    1a2 <strchr+0x1e>
+      return (char*)s;
+ 19d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a0:	eb 13                	jmp    1b5 <strchr+0x31>
+  for(; *s; s++)
+ 1a2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a9:	0f b6 00             	movzbl (%eax),%eax
+ 1ac:	84 c0                	test   %al,%al
+ 1ae:	75 e2                	jne    192 <strchr+0xe>
+  return 0;
+ 1b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1b5:	c9                   	leave
+ 1b6:	c3                   	ret
+
+000001b7 <gets>:
+{
+ 1b7:	55                   	push   %ebp
+ 1b8:	89 e5                	mov    %esp,%ebp
+ 1ba:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1c4:	eb 42                	jmp    208 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1c6:	83 ec 04             	sub    $0x4,%esp
+ 1c9:	6a 01                	push   $0x1
+ 1cb:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1ce:	50                   	push   %eax
+ 1cf:	6a 00                	push   $0x0
+ 1d1:	e8 84 01 00 00       	call   35a <read>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+ 1d9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1dc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1e0:	7e 33                	jle    215 <gets+0x5e>
+    buf[i++] = c;
+ 1e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e5:	8d 50 01             	lea    0x1(%eax),%edx
+ 1e8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1eb:	89 c2                	mov    %eax,%edx
+ 1ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f0:	01 c2                	add    %eax,%edx
+ 1f2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1f6:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1f8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1fc:	3c 0a                	cmp    $0xa,%al
+ 1fe:	74 16                	je     216 <gets+0x5f>
+ 200:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 204:	3c 0d                	cmp    $0xd,%al
+ 206:	74 0e                	je     216 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 208:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 20b:	83 c0 01             	add    $0x1,%eax
+ 20e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 211:	7f b3                	jg     1c6 <gets+0xf>
+ 213:	eb 01                	jmp    216 <gets+0x5f>
+      break;
+ 215:	90                   	nop
+  }
+  buf[i] = '\0';
+ 216:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 219:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21c:	01 d0                	add    %edx,%eax
+ 21e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 221:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+
+00000226 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 226:	55                   	push   %ebp
+ 227:	89 e5                	mov    %esp,%ebp
+ 229:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 22c:	83 ec 08             	sub    $0x8,%esp
+ 22f:	6a 00                	push   $0x0
+ 231:	ff 75 08             	push   0x8(%ebp)
+ 234:	e8 44 01 00 00       	call   37d <open>
+ 239:	83 c4 10             	add    $0x10,%esp
+ 23c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 23f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 243:	79 07                	jns    24c <stat+0x26>
+    return -1;
+ 245:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 24a:	eb 25                	jmp    271 <stat+0x4b>
+  r = fstat(fd, st);
+ 24c:	83 ec 08             	sub    $0x8,%esp
+ 24f:	ff 75 0c             	push   0xc(%ebp)
+ 252:	ff 75 f4             	push   -0xc(%ebp)
+ 255:	e8 41 01 00 00       	call   39b <fstat>
+ 25a:	83 c4 10             	add    $0x10,%esp
+ 25d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 260:	83 ec 0c             	sub    $0xc,%esp
+ 263:	ff 75 f4             	push   -0xc(%ebp)
+ 266:	e8 fd 00 00 00       	call   368 <close>
+ 26b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 26e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 271:	c9                   	leave
+ 272:	c3                   	ret
+
+00000273 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 273:	55                   	push   %ebp
+ 274:	89 e5                	mov    %esp,%ebp
+ 276:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 279:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 280:	eb 25                	jmp    2a7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 282:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 285:	89 d0                	mov    %edx,%eax
+ 287:	c1 e0 02             	shl    $0x2,%eax
+ 28a:	01 d0                	add    %edx,%eax
+ 28c:	01 c0                	add    %eax,%eax
+ 28e:	89 c1                	mov    %eax,%ecx
+ 290:	8b 45 08             	mov    0x8(%ebp),%eax
+ 293:	8d 50 01             	lea    0x1(%eax),%edx
+ 296:	89 55 08             	mov    %edx,0x8(%ebp)
+ 299:	0f b6 00             	movzbl (%eax),%eax
+ 29c:	0f be c0             	movsbl %al,%eax
+ 29f:	01 c8                	add    %ecx,%eax
+ 2a1:	83 e8 30             	sub    $0x30,%eax
+ 2a4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2aa:	0f b6 00             	movzbl (%eax),%eax
+ 2ad:	3c 2f                	cmp    $0x2f,%al
+ 2af:	7e 0a                	jle    2bb <atoi+0x48>
+ 2b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b4:	0f b6 00             	movzbl (%eax),%eax
+ 2b7:	3c 39                	cmp    $0x39,%al
+ 2b9:	7e c7                	jle    282 <atoi+0xf>
+  return n;
+ 2bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2be:	c9                   	leave
+ 2bf:	c3                   	ret
+
+000002c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2d2:	eb 17                	jmp    2eb <memmove+0x2b>
+    *dst++ = *src++;
+ 2d4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2d7:	8d 42 01             	lea    0x1(%edx),%eax
+ 2da:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2e0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2e3:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2e6:	0f b6 12             	movzbl (%edx),%edx
+ 2e9:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2eb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ee:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2f1:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2f4:	85 c0                	test   %eax,%eax
+ 2f6:	7f dc                	jg     2d4 <memmove+0x14>
+  return vdst;
+ 2f8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+
+000002fd <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 2fd:	83 3d 4c 12 00 00 00 	cmpl   $0x0,0x124c
+  jg 2f
+ 304:	7f 2e                	jg     334 <dosyscall+0x37>
+  jl 1f
+ 306:	7c 29                	jl     331 <dosyscall+0x34>
+  pushl %eax
+ 308:	50                   	push   %eax
+  pushl %ebx
+ 309:	53                   	push   %ebx
+  movl $1, %eax
+ 30a:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 30f:	0f a2                	cpuid
+  popl %ebx
+ 311:	5b                   	pop    %ebx
+  popl %eax
+ 312:	58                   	pop    %eax
+  movl $-1, sysmode
+ 313:	c7 05 4c 12 00 00 ff 	movl   $0xffffffff,0x124c
+ 31a:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 31d:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 323:	74 0c                	je     331 <dosyscall+0x34>
+  movl $1, sysmode
+ 325:	c7 05 4c 12 00 00 01 	movl   $0x1,0x124c
+ 32c:	00 00 00 
+  jmp 2f
+ 32f:	eb 03                	jmp    334 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 331:	cd 40                	int    $0x40
+  ret
+ 333:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 334:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 336:	ba 3d 03 00 00       	mov    $0x33d,%edx
+  sysenter
+ 33b:	0f 34                	sysenter
+3:
+  ret
+ 33d:	c3                   	ret
+
+0000033e <fork>:
+
+SYSCALL(fork)
+ 33e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 343:	eb b8                	jmp    2fd <dosyscall>
+
+00000345 <exit>:
+SYSCALL(exit)
+ 345:	b8 02 00 00 00       	mov    $0x2,%eax
+ 34a:	eb b1                	jmp    2fd <dosyscall>
+
+0000034c <wait>:
+SYSCALL(wait)
+ 34c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 351:	eb aa                	jmp    2fd <dosyscall>
+
+00000353 <pipe>:
+SYSCALL(pipe)
+ 353:	b8 04 00 00 00       	mov    $0x4,%eax
+ 358:	eb a3                	jmp    2fd <dosyscall>
+
+0000035a <read>:
+SYSCALL(read)
+ 35a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 35f:	eb 9c                	jmp    2fd <dosyscall>
+
+00000361 <write>:
+SYSCALL(write)
+ 361:	b8 10 00 00 00       	mov    $0x10,%eax
+ 366:	eb 95                	jmp    2fd <dosyscall>
+
+00000368 <close>:
+SYSCALL(close)
+ 368:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36d:	eb 8e                	jmp    2fd <dosyscall>
+
+0000036f <kill>:
+SYSCALL(kill)
+ 36f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 374:	eb 87                	jmp    2fd <dosyscall>
+
+00000376 <exec>:
+SYSCALL(exec)
+ 376:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37b:	eb 80                	jmp    2fd <dosyscall>
+
+0000037d <open>:
+SYSCALL(open)
+ 37d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 382:	e9 76 ff ff ff       	jmp    2fd <dosyscall>
+
+00000387 <mknod>:
+SYSCALL(mknod)
+ 387:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38c:	e9 6c ff ff ff       	jmp    2fd <dosyscall>
+
+00000391 <unlink>:
+SYSCALL(unlink)
+ 391:	b8 12 00 00 00       	mov    $0x12,%eax
+ 396:	e9 62 ff ff ff       	jmp    2fd <dosyscall>
+
+0000039b <fstat>:
+SYSCALL(fstat)
+ 39b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3a0:	e9 58 ff ff ff       	jmp    2fd <dosyscall>
+
+000003a5 <link>:
+SYSCALL(link)
+ 3a5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3aa:	e9 4e ff ff ff       	jmp    2fd <dosyscall>
+
+000003af <mkdir>:
+SYSCALL(mkdir)
+ 3af:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3b4:	e9 44 ff ff ff       	jmp    2fd <dosyscall>
+
+000003b9 <chdir>:
+SYSCALL(chdir)
+ 3b9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3be:	e9 3a ff ff ff       	jmp    2fd <dosyscall>
+
+000003c3 <dup>:
+SYSCALL(dup)
+ 3c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3c8:	e9 30 ff ff ff       	jmp    2fd <dosyscall>
+
+000003cd <getpid>:
+SYSCALL(getpid)
+ 3cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d2:	e9 26 ff ff ff       	jmp    2fd <dosyscall>
+
+000003d7 <sbrk>:
+SYSCALL(sbrk)
+ 3d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3dc:	e9 1c ff ff ff       	jmp    2fd <dosyscall>
+
+000003e1 <sleep>:
+SYSCALL(sleep)
+ 3e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e6:	e9 12 ff ff ff       	jmp    2fd <dosyscall>
+
+000003eb <uptime>:
+SYSCALL(uptime)
+ 3eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f0:	e9 08 ff ff ff       	jmp    2fd <dosyscall>
+
+000003f5 <symlink>:
+SYSCALL(symlink)
+ 3f5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fa:	e9 fe fe ff ff       	jmp    2fd <dosyscall>
+
+000003ff <readlink>:
+SYSCALL(readlink)
+ 3ff:	b8 17 00 00 00       	mov    $0x17,%eax
+ 404:	e9 f4 fe ff ff       	jmp    2fd <dosyscall>
+
+00000409 <fprot>:
+SYSCALL(fprot)
+ 409:	b8 18 00 00 00       	mov    $0x18,%eax
+ 40e:	e9 ea fe ff ff       	jmp    2fd <dosyscall>
+
+00000413 <funprot>:
+SYSCALL(funprot)
+ 413:	b8 19 00 00 00       	mov    $0x19,%eax
+ 418:	e9 e0 fe ff ff       	jmp    2fd <dosyscall>
+
+0000041d <funlock>:
+SYSCALL(funlock)
+ 41d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 422:	e9 d6 fe ff ff       	jmp    2fd <dosyscall>
+
+00000427 <mmap>:
+SYSCALL(mmap)
+ 427:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 42c:	e9 cc fe ff ff       	jmp    2fd <dosyscall>
+
+00000431 <munmap>:
+SYSCALL(munmap)
+ 431:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 436:	e9 c2 fe ff ff       	jmp    2fd <dosyscall>
+
+0000043b <sendfile>:
+SYSCALL(sendfile)
+ 43b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 440:	e9 b8 fe ff ff       	jmp    2fd <dosyscall>
+
+00000445 <readv>:
+SYSCALL(readv)
+ 445:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 44a:	e9 ae fe ff ff       	jmp    2fd <dosyscall>
+
+0000044f <writev>:
+SYSCALL(writev)
+ 44f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 454:	e9 a4 fe ff ff       	jmp    2fd <dosyscall>
+
+00000459 <pread>:
+SYSCALL(pread)
+ 459:	b8 20 00 00 00       	mov    $0x20,%eax
+ 45e:	e9 9a fe ff ff       	jmp    2fd <dosyscall>
+
+00000463 <pwrite>:
+SYSCALL(pwrite)
+ 463:	b8 21 00 00 00       	mov    $0x21,%eax
+ 468:	e9 90 fe ff ff       	jmp    2fd <dosyscall>
+
+0000046d <lseek>:
+SYSCALL(lseek)
+ 46d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 472:	e9 86 fe ff ff       	jmp    2fd <dosyscall>
+
+00000477 <spawn>:
+SYSCALL(spawn)
+ 477:	b8 23 00 00 00       	mov    $0x23,%eax
+ 47c:	e9 7c fe ff ff       	jmp    2fd <dosyscall>
+
+00000481 <setpriority>:
+SYSCALL(setpriority)
+ 481:	b8 24 00 00 00       	mov    $0x24,%eax
+ 486:	e9 72 fe ff ff       	jmp    2fd <dosyscall>
+
+0000048b <kthread_create>:
+SYSCALL(kthread_create)
+ 48b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 490:	e9 68 fe ff ff       	jmp    2fd <dosyscall>
+
+00000495 <kthread_id>:
+SYSCALL(kthread_id)
+ 495:	b8 26 00 00 00       	mov    $0x26,%eax
+ 49a:	e9 5e fe ff ff       	jmp    2fd <dosyscall>
+
+0000049f <kthread_exit>:
+SYSCALL(kthread_exit)
+ 49f:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4a4:	e9 54 fe ff ff       	jmp    2fd <dosyscall>
+
+000004a9 <kthread_join>:
+SYSCALL(kthread_join)
+ 4a9:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4ae:	e9 4a fe ff ff       	jmp    2fd <dosyscall>
+
+000004b3 <futex>:
+SYSCALL(futex)
+ 4b3:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4b8:	e9 40 fe ff ff       	jmp    2fd <dosyscall>
+
+000004bd <signal>:
+SYSCALL(signal)
+ 4bd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4c2:	e9 36 fe ff ff       	jmp    2fd <dosyscall>
+
+000004c7 <alarm>:
+SYSCALL(alarm)
+ 4c7:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4cc:	e9 2c fe ff ff       	jmp    2fd <dosyscall>
+
+000004d1 <usleep>:
+SYSCALL(usleep)
+ 4d1:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4d6:	e9 22 fe ff ff       	jmp    2fd <dosyscall>
+
+000004db <ioring_setup>:
+SYSCALL(ioring_setup)
+ 4db:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4e0:	e9 18 fe ff ff       	jmp    2fd <dosyscall>
+
+000004e5 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4e5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4ea:	e9 0e fe ff ff       	jmp    2fd <dosyscall>
+
+000004ef <getrusage>:
+SYSCALL(getrusage)
+ 4ef:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4f4:	e9 04 fe ff ff       	jmp    2fd <dosyscall>
+
+000004f9 <mount>:
+SYSCALL(mount)
+ 4f9:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4fe:	e9 fa fd ff ff       	jmp    2fd <dosyscall>
+
+00000503 <getdents>:
+SYSCALL(getdents)
+ 503:	b8 31 00 00 00       	mov    $0x31,%eax
+ 508:	e9 f0 fd ff ff       	jmp    2fd <dosyscall>
+
+0000050d <yield>:
+SYSCALL(yield)
+ 50d:	b8 32 00 00 00       	mov    $0x32,%eax
+ 512:	e9 e6 fd ff ff       	jmp    2fd <dosyscall>
+
+00000517 <ncpu>:
+SYSCALL(ncpu)
+ 517:	b8 33 00 00 00       	mov    $0x33,%eax
+ 51c:	e9 dc fd ff ff       	jmp    2fd <dosyscall>
+
+00000521 <fallocate>:
+SYSCALL(fallocate)
+ 521:	b8 34 00 00 00       	mov    $0x34,%eax
+ 526:	e9 d2 fd ff ff       	jmp    2fd <dosyscall>
+
+0000052b <ftruncate>:
+SYSCALL(ftruncate)
+ 52b:	b8 35 00 00 00       	mov    $0x35,%eax
+ 530:	e9 c8 fd ff ff       	jmp    2fd <dosyscall>
+
+00000535 <fsync>:
+SYSCALL(fsync)
+ 535:	b8 36 00 00 00       	mov    $0x36,%eax
+ 53a:	e9 be fd ff ff       	jmp    2fd <dosyscall>
+
+0000053f <fdatasync>:
+SYSCALL(fdatasync)
+ 53f:	b8 37 00 00 00       	mov    $0x37,%eax
+ 544:	e9 b4 fd ff ff       	jmp    2fd <dosyscall>
+
+00000549 <poll>:
+SYSCALL(poll)
+ 549:	b8 38 00 00 00       	mov    $0x38,%eax
+ 54e:	e9 aa fd ff ff       	jmp    2fd <dosyscall>
+
+00000553 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 553:	55                   	push   %ebp
+ 554:	89 e5                	mov    %esp,%ebp
+ 556:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 559:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55c:	8b 40 04             	mov    0x4(%eax),%eax
+ 55f:	85 c0                	test   %eax,%eax
+ 561:	7e 1f                	jle    582 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	8b 50 04             	mov    0x4(%eax),%edx
+ 569:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56c:	8d 48 08             	lea    0x8(%eax),%ecx
+ 56f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 572:	8b 00                	mov    (%eax),%eax
+ 574:	83 ec 04             	sub    $0x4,%esp
+ 577:	52                   	push   %edx
+ 578:	51                   	push   %ecx
+ 579:	50                   	push   %eax
+ 57a:	e8 d0 fe ff ff       	call   44f <writev>
+ 57f:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 582:	8b 45 08             	mov    0x8(%ebp),%eax
+ 585:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 58c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58f:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 596:	00 00 00 
+}
+ 599:	90                   	nop
+ 59a:	c9                   	leave
+ 59b:	c3                   	ret
+
+0000059c <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 59c:	55                   	push   %ebp
+ 59d:	89 e5                	mov    %esp,%ebp
+ 59f:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 5a2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5a6:	0f 84 94 00 00 00    	je     640 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 5ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5af:	8b 40 04             	mov    0x4(%eax),%eax
+ 5b2:	85 c0                	test   %eax,%eax
+ 5b4:	7e 40                	jle    5f6 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b9:	8b 40 04             	mov    0x4(%eax),%eax
+ 5bc:	83 e8 01             	sub    $0x1,%eax
+ 5bf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c9:	01 d0                	add    %edx,%eax
+ 5cb:	83 c0 08             	add    $0x8,%eax
+ 5ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 5d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d4:	8b 10                	mov    (%eax),%edx
+ 5d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d9:	8b 40 04             	mov    0x4(%eax),%eax
+ 5dc:	01 d0                	add    %edx,%eax
+ 5de:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 5e1:	75 13                	jne    5f6 <put+0x5a>
+      v->iov_len += n;
+ 5e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e6:	8b 50 04             	mov    0x4(%eax),%edx
+ 5e9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5ec:	01 c2                	add    %eax,%edx
+ 5ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f1:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 5f4:	eb 4b                	jmp    641 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f9:	8b 40 04             	mov    0x4(%eax),%eax
+ 5fc:	83 f8 10             	cmp    $0x10,%eax
+ 5ff:	75 0e                	jne    60f <put+0x73>
+    flush(o);
+ 601:	83 ec 0c             	sub    $0xc,%esp
+ 604:	ff 75 08             	push   0x8(%ebp)
+ 607:	e8 47 ff ff ff       	call   553 <flush>
+ 60c:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 60f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 612:	8b 50 04             	mov    0x4(%eax),%edx
+ 615:	8b 45 08             	mov    0x8(%ebp),%eax
+ 618:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 61b:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 61f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 622:	8b 50 04             	mov    0x4(%eax),%edx
+ 625:	8b 45 08             	mov    0x8(%ebp),%eax
+ 628:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62b:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 62f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 632:	8b 40 04             	mov    0x4(%eax),%eax
+ 635:	8d 50 01             	lea    0x1(%eax),%edx
+ 638:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63b:	89 50 04             	mov    %edx,0x4(%eax)
+ 63e:	eb 01                	jmp    641 <put+0xa5>
+    return;
+ 640:	90                   	nop
+}
+ 641:	c9                   	leave
+ 642:	c3                   	ret
+
+00000643 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 643:	55                   	push   %ebp
+ 644:	89 e5                	mov    %esp,%ebp
+ 646:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 649:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64c:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 652:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 655:	01 d0                	add    %edx,%eax
+ 657:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 65c:	77 0b                	ja     669 <room+0x26>
+ 65e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 661:	8b 40 04             	mov    0x4(%eax),%eax
+ 664:	83 f8 10             	cmp    $0x10,%eax
+ 667:	75 0e                	jne    677 <room+0x34>
+    flush(o);
+ 669:	83 ec 0c             	sub    $0xc,%esp
+ 66c:	ff 75 08             	push   0x8(%ebp)
+ 66f:	e8 df fe ff ff       	call   553 <flush>
+ 674:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 677:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67a:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 689:	01 d0                	add    %edx,%eax
+}
+ 68b:	c9                   	leave
+ 68c:	c3                   	ret
+
+0000068d <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 68d:	55                   	push   %ebp
+ 68e:	89 e5                	mov    %esp,%ebp
+ 690:	83 ec 28             	sub    $0x28,%esp
+ 693:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 696:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 699:	83 ec 08             	sub    $0x8,%esp
+ 69c:	6a 01                	push   $0x1
+ 69e:	ff 75 08             	push   0x8(%ebp)
+ 6a1:	e8 9d ff ff ff       	call   643 <room>
+ 6a6:	83 c4 10             	add    $0x10,%esp
+ 6a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 6ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6af:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 6b3:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 6b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6be:	8d 50 01             	lea    0x1(%eax),%edx
+ 6c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c4:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 6ca:	83 ec 04             	sub    $0x4,%esp
+ 6cd:	6a 01                	push   $0x1
+ 6cf:	ff 75 f4             	push   -0xc(%ebp)
+ 6d2:	ff 75 08             	push   0x8(%ebp)
+ 6d5:	e8 c2 fe ff ff       	call   59c <put>
+ 6da:	83 c4 10             	add    $0x10,%esp
+}
+ 6dd:	90                   	nop
+ 6de:	c9                   	leave
+ 6df:	c3                   	ret
+
+000006e0 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 6e6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6ed:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6f1:	74 17                	je     70a <printint+0x2a>
+ 6f3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6f7:	79 11                	jns    70a <printint+0x2a>
+    neg = 1;
+ 6f9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 700:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 703:	f7 d8                	neg    %eax
+ 705:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 708:	eb 06                	jmp    710 <printint+0x30>
+  } else {
+    x = xx;
+ 70a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 70d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 710:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 717:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 71d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 722:	f7 f1                	div    %ecx
+ 724:	89 d1                	mov    %edx,%ecx
+ 726:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 729:	8d 50 01             	lea    0x1(%eax),%edx
+ 72c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 72f:	0f b6 91 50 12 00 00 	movzbl 0x1250(%ecx),%edx
+ 736:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 73a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 740:	ba 00 00 00 00       	mov    $0x0,%edx
+ 745:	f7 f1                	div    %ecx
+ 747:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 74a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 74e:	75 c7                	jne    717 <printint+0x37>
+  if(neg)
+ 750:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 754:	74 0e                	je     764 <printint+0x84>
+    buf[i++] = '-';
+ 756:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 759:	8d 50 01             	lea    0x1(%eax),%edx
+ 75c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 75f:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 764:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 767:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 76a:	83 ec 08             	sub    $0x8,%esp
+ 76d:	ff 75 e8             	push   -0x18(%ebp)
+ 770:	ff 75 08             	push   0x8(%ebp)
+ 773:	e8 cb fe ff ff       	call   643 <room>
+ 778:	83 c4 10             	add    $0x10,%esp
+ 77b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 77e:	eb 1d                	jmp    79d <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 780:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 783:	83 e8 01             	sub    $0x1,%eax
+ 786:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 789:	89 c2                	mov    %eax,%edx
+ 78b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 78e:	01 c2                	add    %eax,%edx
+ 790:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 793:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 796:	01 c8                	add    %ecx,%eax
+ 798:	0f b6 00             	movzbl (%eax),%eax
+ 79b:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 79d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7a5:	79 d9                	jns    780 <printint+0xa0>
+  o->used += n;
+ 7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7aa:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7b0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b3:	01 c2                	add    %eax,%edx
+ 7b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b8:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 7be:	83 ec 04             	sub    $0x4,%esp
+ 7c1:	ff 75 e8             	push   -0x18(%ebp)
+ 7c4:	ff 75 e4             	push   -0x1c(%ebp)
+ 7c7:	ff 75 08             	push   0x8(%ebp)
+ 7ca:	e8 cd fd ff ff       	call   59c <put>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+}
+ 7d2:	90                   	nop
+ 7d3:	c9                   	leave
+ 7d4:	c3                   	ret
+
+000007d5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7d5:	55                   	push   %ebp
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 7de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e1:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 7e7:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 7ee:	00 00 00 
+  o.used = 0;
+ 7f1:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 7f8:	00 00 00 
+  state = 0;
+ 7fb:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 802:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 80b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 812:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 819:	e9 82 01 00 00       	jmp    9a0 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 81e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 821:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 824:	01 d0                	add    %edx,%eax
+ 826:	0f b6 00             	movzbl (%eax),%eax
+ 829:	0f be c0             	movsbl %al,%eax
+ 82c:	25 ff 00 00 00       	and    $0xff,%eax
+ 831:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 834:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 838:	75 38                	jne    872 <printf+0x9d>
+      if(c == '%'){
+ 83a:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 83e:	0f 85 58 01 00 00    	jne    99c <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 844:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 847:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 84a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 84d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 850:	01 ca                	add    %ecx,%edx
+ 852:	83 ec 04             	sub    $0x4,%esp
+ 855:	50                   	push   %eax
+ 856:	52                   	push   %edx
+ 857:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 85d:	50                   	push   %eax
+ 85e:	e8 39 fd ff ff       	call   59c <put>
+ 863:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 866:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 86d:	e9 2a 01 00 00       	jmp    99c <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 872:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 876:	0f 85 20 01 00 00    	jne    99c <printf+0x1c7>
+      if(c == 'd'){
+ 87c:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 880:	75 22                	jne    8a4 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 882:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 885:	8b 00                	mov    (%eax),%eax
+ 887:	6a 01                	push   $0x1
+ 889:	6a 0a                	push   $0xa
+ 88b:	50                   	push   %eax
+ 88c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 892:	50                   	push   %eax
+ 893:	e8 48 fe ff ff       	call   6e0 <printint>
+ 898:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 89b:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 89f:	e9 e8 00 00 00       	jmp    98c <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 8a4:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 8a8:	74 06                	je     8b0 <printf+0xdb>
+ 8aa:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 8ae:	75 22                	jne    8d2 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 8b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b3:	8b 00                	mov    (%eax),%eax
+ 8b5:	6a 00                	push   $0x0
+ 8b7:	6a 10                	push   $0x10
+ 8b9:	50                   	push   %eax
+ 8ba:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8c0:	50                   	push   %eax
+ 8c1:	e8 1a fe ff ff       	call   6e0 <printint>
+ 8c6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8c9:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8cd:	e9 ba 00 00 00       	jmp    98c <printf+0x1b7>
+      } else if(c == 's'){
+ 8d2:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 8d6:	75 3f                	jne    917 <printf+0x142>
+        s = (char*)*ap;
+ 8d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8db:	8b 00                	mov    (%eax),%eax
+ 8dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8e0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 8e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8e8:	75 07                	jne    8f1 <printf+0x11c>
+          s = "(null)";
+ 8ea:	c7 45 f4 ba 0e 00 00 	movl   $0xeba,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 8f1:	83 ec 0c             	sub    $0xc,%esp
+ 8f4:	ff 75 f4             	push   -0xc(%ebp)
+ 8f7:	e8 47 f8 ff ff       	call   143 <strlen>
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	83 ec 04             	sub    $0x4,%esp
+ 902:	50                   	push   %eax
+ 903:	ff 75 f4             	push   -0xc(%ebp)
+ 906:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 90c:	50                   	push   %eax
+ 90d:	e8 8a fc ff ff       	call   59c <put>
+ 912:	83 c4 10             	add    $0x10,%esp
+ 915:	eb 75                	jmp    98c <printf+0x1b7>
+      } else if(c == 'c'){
+ 917:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 91b:	75 21                	jne    93e <printf+0x169>
+        putc(&o, *ap);
+ 91d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 920:	8b 00                	mov    (%eax),%eax
+ 922:	0f be c0             	movsbl %al,%eax
+ 925:	83 ec 08             	sub    $0x8,%esp
+ 928:	50                   	push   %eax
+ 929:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 92f:	50                   	push   %eax
+ 930:	e8 58 fd ff ff       	call   68d <putc>
+ 935:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 938:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 93c:	eb 4e                	jmp    98c <printf+0x1b7>
+      } else if(c == '%'){
+ 93e:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 942:	75 1b                	jne    95f <printf+0x18a>
+        putc(&o, c);
+ 944:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 947:	0f be c0             	movsbl %al,%eax
+ 94a:	83 ec 08             	sub    $0x8,%esp
+ 94d:	50                   	push   %eax
+ 94e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 954:	50                   	push   %eax
+ 955:	e8 33 fd ff ff       	call   68d <putc>
+ 95a:	83 c4 10             	add    $0x10,%esp
+ 95d:	eb 2d                	jmp    98c <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 95f:	83 ec 08             	sub    $0x8,%esp
+ 962:	6a 25                	push   $0x25
+ 964:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 96a:	50                   	push   %eax
+ 96b:	e8 1d fd ff ff       	call   68d <putc>
+ 970:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 973:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 976:	0f be c0             	movsbl %al,%eax
+ 979:	83 ec 08             	sub    $0x8,%esp
+ 97c:	50                   	push   %eax
+ 97d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 983:	50                   	push   %eax
+ 984:	e8 04 fd ff ff       	call   68d <putc>
+ 989:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 98c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 993:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 996:	83 c0 01             	add    $0x1,%eax
+ 999:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 99c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a6:	01 d0                	add    %edx,%eax
+ 9a8:	0f b6 00             	movzbl (%eax),%eax
+ 9ab:	84 c0                	test   %al,%al
+ 9ad:	0f 85 6b fe ff ff    	jne    81e <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 9b3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 9b7:	75 22                	jne    9db <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 9b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bc:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9c2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9c5:	01 ca                	add    %ecx,%edx
+ 9c7:	83 ec 04             	sub    $0x4,%esp
+ 9ca:	50                   	push   %eax
+ 9cb:	52                   	push   %edx
+ 9cc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d2:	50                   	push   %eax
+ 9d3:	e8 c4 fb ff ff       	call   59c <put>
+ 9d8:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 9db:	83 ec 0c             	sub    $0xc,%esp
+ 9de:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9e4:	50                   	push   %eax
+ 9e5:	e8 69 fb ff ff       	call   553 <flush>
+ 9ea:	83 c4 10             	add    $0x10,%esp
+}
+ 9ed:	90                   	nop
+ 9ee:	c9                   	leave
+ 9ef:	c3                   	ret
+
+000009f0 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 9f6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 9ff:	f0 87 02             	lock xchg %eax,(%edx)
+ a02:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a08:	c9                   	leave
+ a09:	c3                   	ret
+
+00000a0a <lock>:
+{
+ a0a:	55                   	push   %ebp
+ a0b:	89 e5                	mov    %esp,%ebp
+ a0d:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a10:	a1 64 12 00 00       	mov    0x1264,%eax
+ a15:	85 c0                	test   %eax,%eax
+ a17:	74 09                	je     a22 <lock+0x18>
+ a19:	a1 64 12 00 00       	mov    0x1264,%eax
+ a1e:	ff d0                	call   *%eax
+ a20:	eb 05                	jmp    a27 <lock+0x1d>
+ a22:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a2a:	90                   	nop
+ a2b:	83 ec 08             	sub    $0x8,%esp
+ a2e:	6a 01                	push   $0x1
+ a30:	68 9c 12 00 00       	push   $0x129c
+ a35:	e8 b6 ff ff ff       	call   9f0 <xchg>
+ a3a:	83 c4 10             	add    $0x10,%esp
+ a3d:	85 c0                	test   %eax,%eax
+ a3f:	75 ea                	jne    a2b <lock+0x21>
+  return pin;
+ a41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a44:	c9                   	leave
+ a45:	c3                   	ret
+
+00000a46 <unlock>:
+{
+ a46:	55                   	push   %ebp
+ a47:	89 e5                	mov    %esp,%ebp
+ a49:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a4c:	6a 00                	push   $0x0
+ a4e:	68 9c 12 00 00       	push   $0x129c
+ a53:	e8 98 ff ff ff       	call   9f0 <xchg>
+ a58:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a5b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a5f:	78 10                	js     a71 <unlock+0x2b>
+    mallocunpin(pin);
+ a61:	a1 68 12 00 00       	mov    0x1268,%eax
+ a66:	83 ec 0c             	sub    $0xc,%esp
+ a69:	ff 75 08             	push   0x8(%ebp)
+ a6c:	ff d0                	call   *%eax
+ a6e:	83 c4 10             	add    $0x10,%esp
+}
+ a71:	90                   	nop
+ a72:	c9                   	leave
+ a73:	c3                   	ret
+
+00000a74 <sizeclass>:
+{
+ a74:	55                   	push   %ebp
+ a75:	89 e5                	mov    %esp,%ebp
+ a77:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ a7a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ a81:	eb 1c                	jmp    a9f <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a86:	ba 02 00 00 00       	mov    $0x2,%edx
+ a8b:	89 c1                	mov    %eax,%ecx
+ a8d:	d3 e2                	shl    %cl,%edx
+ a8f:	89 d0                	mov    %edx,%eax
+ a91:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a94:	72 05                	jb     a9b <sizeclass+0x27>
+      return c;
+ a96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a99:	eb 0f                	jmp    aaa <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a9b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a9f:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ aa3:	7e de                	jle    a83 <sizeclass+0xf>
+  return -1;
+ aa5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ aaa:	c9                   	leave
+ aab:	c3                   	ret
+
+00000aac <bigfree>:
+{
+ aac:	55                   	push   %ebp
+ aad:	89 e5                	mov    %esp,%ebp
+ aaf:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab2:	a1 74 12 00 00       	mov    0x1274,%eax
+ ab7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ aba:	eb 24                	jmp    ae0 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ abc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abf:	8b 00                	mov    (%eax),%eax
+ ac1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ac4:	72 12                	jb     ad8 <bigfree+0x2c>
+ ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ acc:	72 24                	jb     af2 <bigfree+0x46>
+ ace:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad1:	8b 00                	mov    (%eax),%eax
+ ad3:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ad6:	72 1a                	jb     af2 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ adb:	8b 00                	mov    (%eax),%eax
+ add:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ae6:	73 d4                	jae    abc <bigfree+0x10>
+ ae8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aeb:	8b 00                	mov    (%eax),%eax
+ aed:	39 45 08             	cmp    %eax,0x8(%ebp)
+ af0:	73 ca                	jae    abc <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ af2:	8b 45 08             	mov    0x8(%ebp),%eax
+ af5:	8b 40 04             	mov    0x4(%eax),%eax
+ af8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	01 c2                	add    %eax,%edx
+ b04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b07:	8b 00                	mov    (%eax),%eax
+ b09:	39 c2                	cmp    %eax,%edx
+ b0b:	75 24                	jne    b31 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b10:	8b 50 04             	mov    0x4(%eax),%edx
+ b13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b16:	8b 00                	mov    (%eax),%eax
+ b18:	8b 40 04             	mov    0x4(%eax),%eax
+ b1b:	01 c2                	add    %eax,%edx
+ b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b20:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b26:	8b 00                	mov    (%eax),%eax
+ b28:	8b 10                	mov    (%eax),%edx
+ b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2d:	89 10                	mov    %edx,(%eax)
+ b2f:	eb 0a                	jmp    b3b <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b31:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b34:	8b 10                	mov    (%eax),%edx
+ b36:	8b 45 08             	mov    0x8(%ebp),%eax
+ b39:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3e:	8b 40 04             	mov    0x4(%eax),%eax
+ b41:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4b:	01 d0                	add    %edx,%eax
+ b4d:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b50:	75 20                	jne    b72 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b55:	8b 50 04             	mov    0x4(%eax),%edx
+ b58:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5b:	8b 40 04             	mov    0x4(%eax),%eax
+ b5e:	01 c2                	add    %eax,%edx
+ b60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b63:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b66:	8b 45 08             	mov    0x8(%ebp),%eax
+ b69:	8b 10                	mov    (%eax),%edx
+ b6b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6e:	89 10                	mov    %edx,(%eax)
+ b70:	eb 08                	jmp    b7a <bigfree+0xce>
+    p->s.ptr = bp;
+ b72:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b75:	8b 55 08             	mov    0x8(%ebp),%edx
+ b78:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7d:	a3 74 12 00 00       	mov    %eax,0x1274
+}
+ b82:	90                   	nop
+ b83:	c9                   	leave
+ b84:	c3                   	ret
+
+00000b85 <free>:
+{
+ b85:	55                   	push   %ebp
+ b86:	89 e5                	mov    %esp,%ebp
+ b88:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b8b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b8f:	74 68                	je     bf9 <free+0x74>
+  bp = (Header*)ap - 1;
+ b91:	8b 45 08             	mov    0x8(%ebp),%eax
+ b94:	83 e8 08             	sub    $0x8,%eax
+ b97:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b9a:	e8 6b fe ff ff       	call   a0a <lock>
+ b9f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ ba2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba5:	8b 40 04             	mov    0x4(%eax),%eax
+ ba8:	83 ec 0c             	sub    $0xc,%esp
+ bab:	50                   	push   %eax
+ bac:	e8 c3 fe ff ff       	call   a74 <sizeclass>
+ bb1:	83 c4 10             	add    $0x10,%esp
+ bb4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ bb7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ bbb:	78 1e                	js     bdb <free+0x56>
+    bp->s.ptr = classfree[c];
+ bbd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bc0:	8b 14 85 78 12 00 00 	mov    0x1278(,%eax,4),%edx
+ bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bca:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ bcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bcf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ bd2:	89 14 85 78 12 00 00 	mov    %edx,0x1278(,%eax,4)
+ bd9:	eb 0e                	jmp    be9 <free+0x64>
+    bigfree(bp);
+ bdb:	83 ec 0c             	sub    $0xc,%esp
+ bde:	ff 75 f4             	push   -0xc(%ebp)
+ be1:	e8 c6 fe ff ff       	call   aac <bigfree>
+ be6:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ be9:	83 ec 0c             	sub    $0xc,%esp
+ bec:	ff 75 f0             	push   -0x10(%ebp)
+ bef:	e8 52 fe ff ff       	call   a46 <unlock>
+ bf4:	83 c4 10             	add    $0x10,%esp
+ bf7:	eb 01                	jmp    bfa <free+0x75>
+    return;
+ bf9:	90                   	nop
+}
+ bfa:	c9                   	leave
+ bfb:	c3                   	ret
+
+00000bfc <morecore>:
+{
+ bfc:	55                   	push   %ebp
+ bfd:	89 e5                	mov    %esp,%ebp
+ bff:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c02:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c09:	77 07                	ja     c12 <morecore+0x16>
+    nu = 4096;
+ c0b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c12:	8b 45 08             	mov    0x8(%ebp),%eax
+ c15:	c1 e0 03             	shl    $0x3,%eax
+ c18:	83 ec 0c             	sub    $0xc,%esp
+ c1b:	50                   	push   %eax
+ c1c:	e8 b6 f7 ff ff       	call   3d7 <sbrk>
+ c21:	83 c4 10             	add    $0x10,%esp
+ c24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c27:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c2b:	75 07                	jne    c34 <morecore+0x38>
+    return 0;
+ c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+ c32:	eb 22                	jmp    c56 <morecore+0x5a>
+  hp = (Header*)p;
+ c34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c37:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c3a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+ c40:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ c43:	83 ec 0c             	sub    $0xc,%esp
+ c46:	ff 75 f0             	push   -0x10(%ebp)
+ c49:	e8 5e fe ff ff       	call   aac <bigfree>
+ c4e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c51:	a1 74 12 00 00       	mov    0x1274,%eax
+}
+ c56:	c9                   	leave
+ c57:	c3                   	ret
+
+00000c58 <bigalloc>:
+{
+ c58:	55                   	push   %ebp
+ c59:	89 e5                	mov    %esp,%ebp
+ c5b:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c5e:	a1 74 12 00 00       	mov    0x1274,%eax
+ c63:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c66:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c6a:	75 23                	jne    c8f <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c6c:	c7 45 f0 6c 12 00 00 	movl   $0x126c,-0x10(%ebp)
+ c73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c76:	a3 74 12 00 00       	mov    %eax,0x1274
+ c7b:	a1 74 12 00 00       	mov    0x1274,%eax
+ c80:	a3 6c 12 00 00       	mov    %eax,0x126c
+    base.s.size = 0;
+ c85:	c7 05 70 12 00 00 00 	movl   $0x0,0x1270
+ c8c:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c8f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c92:	8b 00                	mov    (%eax),%eax
+ c94:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9a:	8b 40 04             	mov    0x4(%eax),%eax
+ c9d:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ca0:	72 4a                	jb     cec <bigalloc+0x94>
+      if(p->s.size == nunits)
+ ca2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca5:	8b 40 04             	mov    0x4(%eax),%eax
+ ca8:	39 45 08             	cmp    %eax,0x8(%ebp)
+ cab:	75 0c                	jne    cb9 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb0:	8b 10                	mov    (%eax),%edx
+ cb2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cb5:	89 10                	mov    %edx,(%eax)
+ cb7:	eb 26                	jmp    cdf <bigalloc+0x87>
+        p->s.size -= nunits;
+ cb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbc:	8b 40 04             	mov    0x4(%eax),%eax
+ cbf:	2b 45 08             	sub    0x8(%ebp),%eax
+ cc2:	89 c2                	mov    %eax,%edx
+ cc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ cca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ccd:	8b 40 04             	mov    0x4(%eax),%eax
+ cd0:	c1 e0 03             	shl    $0x3,%eax
+ cd3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+ cdc:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ cdf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce2:	a3 74 12 00 00       	mov    %eax,0x1274
+      return p;
+ ce7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cea:	eb 3b                	jmp    d27 <bigalloc+0xcf>
+    if(p == freep)
+ cec:	a1 74 12 00 00       	mov    0x1274,%eax
+ cf1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cf4:	75 1e                	jne    d14 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ cf6:	83 ec 0c             	sub    $0xc,%esp
+ cf9:	ff 75 08             	push   0x8(%ebp)
+ cfc:	e8 fb fe ff ff       	call   bfc <morecore>
+ d01:	83 c4 10             	add    $0x10,%esp
+ d04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d07:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d0b:	75 07                	jne    d14 <bigalloc+0xbc>
+        return 0;
+ d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+ d12:	eb 13                	jmp    d27 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d17:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1d:	8b 00                	mov    (%eax),%eax
+ d1f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d22:	e9 70 ff ff ff       	jmp    c97 <bigalloc+0x3f>
+}
+ d27:	c9                   	leave
+ d28:	c3                   	ret
+
+00000d29 <alloc>:
+alloc(uint nbytes)
+{
+ d29:	55                   	push   %ebp
+ d2a:	89 e5                	mov    %esp,%ebp
+ d2c:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+ d32:	83 c0 07             	add    $0x7,%eax
+ d35:	c1 e8 03             	shr    $0x3,%eax
+ d38:	83 c0 01             	add    $0x1,%eax
+ d3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d3e:	ff 75 f4             	push   -0xc(%ebp)
+ d41:	e8 2e fd ff ff       	call   a74 <sizeclass>
+ d46:	83 c4 04             	add    $0x4,%esp
+ d49:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d4c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d50:	79 2c                	jns    d7e <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d52:	83 ec 0c             	sub    $0xc,%esp
+ d55:	ff 75 f4             	push   -0xc(%ebp)
+ d58:	e8 fb fe ff ff       	call   c58 <bigalloc>
+ d5d:	83 c4 10             	add    $0x10,%esp
+ d60:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d63:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d67:	75 0a                	jne    d73 <alloc+0x4a>
+      return 0;
+ d69:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6e:	e9 c8 00 00 00       	jmp    e3b <alloc+0x112>
+    return (void*)(p + 1);
+ d73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d76:	83 c0 08             	add    $0x8,%eax
+ d79:	e9 bd 00 00 00       	jmp    e3b <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ d7e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d81:	8b 04 85 78 12 00 00 	mov    0x1278(,%eax,4),%eax
+ d88:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d8b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d8f:	74 1a                	je     dab <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d91:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d94:	8b 10                	mov    (%eax),%edx
+ d96:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d99:	89 14 85 78 12 00 00 	mov    %edx,0x1278(,%eax,4)
+    return (void*)(p + 1);
+ da0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ da3:	83 c0 08             	add    $0x8,%eax
+ da6:	e9 90 00 00 00       	jmp    e3b <alloc+0x112>
+  }
+  nunits = 2 << c;
+ dab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dae:	ba 02 00 00 00       	mov    $0x2,%edx
+ db3:	89 c1                	mov    %eax,%ecx
+ db5:	d3 e2                	shl    %cl,%edx
+ db7:	89 d0                	mov    %edx,%eax
+ db9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ dbc:	a1 94 12 00 00       	mov    0x1294,%eax
+ dc1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ dc4:	c1 e2 03             	shl    $0x3,%edx
+ dc7:	01 d0                	add    %edx,%eax
+ dc9:	8b 15 98 12 00 00    	mov    0x1298,%edx
+ dcf:	39 c2                	cmp    %eax,%edx
+ dd1:	73 3f                	jae    e12 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ dd3:	83 ec 0c             	sub    $0xc,%esp
+ dd6:	68 00 08 00 00       	push   $0x800
+ ddb:	e8 78 fe ff ff       	call   c58 <bigalloc>
+ de0:	83 c4 10             	add    $0x10,%esp
+ de3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ de6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dea:	75 07                	jne    df3 <alloc+0xca>
+      return 0;
+ dec:	b8 00 00 00 00       	mov    $0x0,%eax
+ df1:	eb 48                	jmp    e3b <alloc+0x112>
+    bump = (char*)p;
+ df3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ df6:	a3 94 12 00 00       	mov    %eax,0x1294
+    bumpend = (char*)(p + p->s.size);
+ dfb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dfe:	8b 40 04             	mov    0x4(%eax),%eax
+ e01:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e0b:	01 d0                	add    %edx,%eax
+ e0d:	a3 98 12 00 00       	mov    %eax,0x1298
+  }
+  p = (Header*)bump;
+ e12:	a1 94 12 00 00       	mov    0x1294,%eax
+ e17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ e1a:	a1 94 12 00 00       	mov    0x1294,%eax
+ e1f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e22:	c1 e2 03             	shl    $0x3,%edx
+ e25:	01 d0                	add    %edx,%eax
+ e27:	a3 94 12 00 00       	mov    %eax,0x1294
+  p->s.size = nunits;
+ e2c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e2f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e32:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ e35:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e38:	83 c0 08             	add    $0x8,%eax
+}
+ e3b:	c9                   	leave
+ e3c:	c3                   	ret
+
+00000e3d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e3d:	55                   	push   %ebp
+ e3e:	89 e5                	mov    %esp,%ebp
+ e40:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ e43:	e8 c2 fb ff ff       	call   a0a <lock>
+ e48:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e4b:	83 ec 0c             	sub    $0xc,%esp
+ e4e:	ff 75 08             	push   0x8(%ebp)
+ e51:	e8 d3 fe ff ff       	call   d29 <alloc>
+ e56:	83 c4 10             	add    $0x10,%esp
+ e59:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e5c:	83 ec 0c             	sub    $0xc,%esp
+ e5f:	ff 75 f4             	push   -0xc(%ebp)
+ e62:	e8 df fb ff ff       	call   a46 <unlock>
+ e67:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e6d:	c9                   	leave
+ e6e:	c3                   	ret
@@ -0,0 +1,19 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+  if(argc < 3){
+    printf(2, "usage: nice level cmd [arg...]\n");
+    exit();
+  }
+  if(setpriority(0, atoi(argv[1])) < 0){
+    printf(2, "nice: bad level %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv+2);
+  printf(2, "nice: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -1,12 +1,42 @@
-#define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NBUF         10  // size of disk block cache
-#define NINODE       50  // maximum number of active i-nodes
+#define CACHELINE    64  // bytes per cache line; CPUs' data is kept this far apart
+#define KMAXORDER    10  // largest kallocn() block is 2^KMAXORDER pages
+#define NOFILE       16  // open files per process before its table grows
+#define NOFILEMAX  4096  // most open files per process
+#define NUNLOCK      16  // unlocked protected files per process
+#define NVMA         16  // memory-mapped file ranges per process
+#define NEXECSEG      4  // loadable ELF segments per program
+#define PIPEPAGES     4  // pages of pipe buffer (a power of two)
+#define NBUF          0  // size of disk block cache (0: size from memory)
+#define NBUFMIN      16  // minimum size of disk block cache
+#define BCACHEFRAC   16  // block cache gets 1/BCACHEFRAC of free memory
+#define KRESERVE     64  // free pages the block cache leaves alone
+#define NINODE        0  // size of i-node cache (0: size from memory)
+#define NINODEMIN    50  // minimum size of i-node cache
+#define ICACHEFRAC  256  // i-node cache gets 1/ICACHEFRAC of free memory
+#define NDENTRY     256  // size of directory name cache
+#define NPAGE         0  // most pages in page cache (0: size from memory)
+#define PCACHEFRAC    4  // page cache gets up to 1/PCACHEFRAC of free memory
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
+#define TMPDEV       16  // device number of the first tmpfs
+#define NMOUNT        4  // tmpfs mounts
+#define NTMPPAGE      0  // most pages of tmpfs data (0: size from memory)
+#define TMPFSFRAC     2  // tmpfs data gets up to 1/TMPFSFRAC of free memory
+#define NSWAP     16384  // most pages of swap space
+#ifndef MEMMB
+#define MEMMB     0      // megabytes of memory to use if not mem=; 0: all
+#endif
 #define MAXARG       32  // max exec arguments
-#define LOGSIZE      10  // max data sectors in on-disk log
+#define MAXSTRARG   256  // longest string argument, nul included
+#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
+#define LOGSIZE     126  // max data sectors in on-disk log (header limit)
+#define RAMIN         4  // initial sequential read-ahead window (blocks)
+#define RAMAX        64  // maximum read-ahead window (blocks)
+#define IDEDEADLINE  10  // ticks a queued disk request may wait
+#define NPRIO         4  // scheduling priority levels
+#define BOOSTTICKS  100  // ticks between lifting everyone to the top level
+#define TICKUS    10000  // microseconds per clock tick (nominal)
+#define PROFRATE      0  // profiler samples per clock tick at boot (0: off)
 
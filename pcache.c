@@ -0,0 +1,388 @@
+// Page cache.
+//
+// The page cache holds the data of regular files in page-sized
+// pieces, one kalloc() page each, indexed by (inode, page number
+// within the file).  readi and writei use it for T_FILE inodes;
+// directories, other metadata and the log stay in the buffer
+// cache.  Writes still go through the buffer cache and the log,
+// and writei copies them into any cached page as well, so a valid
+// page always matches the file.  Shared mmap()s map the cached
+// pages themselves.
+//
+// A page's ref counts the callers using it and the mappings of it.
+// Pages with ref 0 are recycled least recently used first once the
+// cache reaches its size, and kalloc() calls pcshrink() to take
+// them back when it runs out of memory.  A page belongs to an
+// in-memory inode: pcpurge() drops an inode's pages before the
+// inode is truncated or its icache entry is reused.  A tmpfs
+// page holds the only copy of its data, so it is pinned and never
+// recycled at all; it goes when its inode is truncated.
+//
+// Locking: pcache.lock protects the hash chains, the inode and
+// LRU lists and the ref fields.  A page's data and valid flag are
+// protected by the lock of its inode; a mapping can use the data
+// without it, since it holds a reference.  Holders of a shared
+// inode lock may all find a page missing at once, so one claims
+// it with pcfill() to read it in, under pcache.lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPHASH 1021
+
+struct pchunk {
+  struct pchunk *next;
+  struct page page[];
+};
+
+// Page headers per chunk page.
+#define PPCHUNK ((PGSIZE - sizeof(struct pchunk)) / sizeof(struct page))
+
+struct {
+  struct spinlock lock;
+  struct pchunk *chunks;
+  struct page *free;  // headers without data, through hnext
+  struct page lru;    // pages with data, least recent first
+  int npage;          // pages with data
+  int max;            // size chosen at boot
+  struct page *hash[NPHASH];
+} pcache;
+
+static struct page**
+pchash(struct inode *ip, uint pgno)
+{
+  return &pcache.hash[((uint)ip / sizeof(*ip) + pgno) % NPHASH];
+}
+
+static void
+lruremove(struct page *pg)
+{
+  pg->lprev->lnext = pg->lnext;
+  pg->lnext->lprev = pg->lprev;
+}
+
+static void
+lruappend(struct page *pg)
+{
+  pg->lnext = &pcache.lru;
+  pg->lprev = pcache.lru.lprev;
+  pcache.lru.lprev->lnext = pg;
+  pcache.lru.lprev = pg;
+}
+
+void
+pcinit(void)
+{
+  int n;
+
+  initlock(&pcache.lock, "pcache");
+  pcache.lru.lnext = pcache.lru.lprev = &pcache.lru;
+  n = bootarg("npage", NPAGE);
+  if(n <= 0)
+    n = kfreepages() / PCACHEFRAC;
+  pcache.max = n;
+  cprintf("pcache: up to %d pages\n", n);
+}
+
+// Remove pg from the hash chain, its inode's list and the LRU
+// list.  It keeps its data.
+static void
+pcunlink(struct page *pg)
+{
+  struct page **pp;
+
+  for(pp = pchash(pg->ip, pg->pgno); *pp != pg; pp = &(*pp)->hnext)
+    if(*pp == 0)
+      panic("pcunlink");
+  *pp = pg->hnext;
+  if(pg->iprev)
+    pg->iprev->inext = pg->inext;
+  else
+    pg->ip->pages = pg->inext;
+  if(pg->inext)
+    pg->inext->iprev = pg->iprev;
+  lruremove(pg);
+  pg->ip = 0;
+}
+
+// Free the data of unlinked page pg and put its header away.
+static void
+pcfree(struct page *pg)
+{
+  kfree(pg->data);
+  pg->data = 0;
+  pg->hnext = pcache.free;
+  pcache.free = pg;
+  pcache.npage--;
+}
+
+// Take the least recently used page nobody is using away from
+// its inode.  Returns it unlinked, with its data, or 0.
+static struct page*
+pcvictim(void)
+{
+  struct page *pg;
+
+  for(pg = pcache.lru.lnext; pg != &pcache.lru; pg = pg->lnext){
+    if(pg->ref == 0 && !pg->pinned){
+      pcunlink(pg);
+      return pg;
+    }
+  }
+  return 0;
+}
+
+// Allocate an unlinked page with fresh data, or return 0.
+// Called with pcache.lock held, and releases it while calling
+// kalloc(), which may take the buffer cache's lock; bget() holds
+// that one when it calls kalloc(), which may call pcshrink().
+static struct page*
+pcnew(void)
+{
+  struct pchunk *c;
+  struct page *pg;
+  char *data;
+  int i;
+
+  release(&pcache.lock);
+  data = kalloc();
+  c = 0;
+  if(data && pcache.free == 0)
+    c = (struct pchunk*)kalloc();
+  acquire(&pcache.lock);
+  if(c){
+    memset(c, 0, PGSIZE);
+    for(i = 0; i < PPCHUNK; i++){
+      c->page[i].hnext = pcache.free;
+      pcache.free = &c->page[i];
+    }
+    c->next = pcache.chunks;
+    pcache.chunks = c;
+  }
+  if(data == 0)
+    return 0;
+  if(pcache.free == 0){
+    kfree(data);
+    return 0;
+  }
+  pg = pcache.free;
+  pcache.free = pg->hnext;
+  pg->data = data;
+  pcache.npage++;
+  return pg;
+}
+
+// Find the cached page pgno of ip and take a reference to it.
+// Caller must hold pcache.lock.
+static struct page*
+pcfind(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+
+  for(pg = *pchash(ip, pgno); pg; pg = pg->hnext){
+    if(pg->ip == ip && pg->pgno == pgno){
+      pg->ref++;
+      lruremove(pg);
+      lruappend(pg);
+      return pg;
+    }
+  }
+  return 0;
+}
+
+// Return page pgno of ip with a reference held.  The page is
+// new, and not valid, if it was not cached.  Returns 0 if no page
+// can be had.  Caller must hold ip locked.
+struct page*
+pcget(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+  struct page **hp;
+
+  acquire(&pcache.lock);
+  if((pg = pcfind(ip, pgno)) != 0){
+    release(&pcache.lock);
+    return pg;
+  }
+
+  // Recycle an idle page once the cache is full; otherwise
+  // take a new one, or an idle one if memory is short.
+  pg = 0;
+  if(pcache.npage >= pcache.max)
+    pg = pcvictim();
+  if(pg == 0 && (pg = pcnew()) == 0 && (pg = pcvictim()) == 0){
+    release(&pcache.lock);
+    return 0;
+  }
+  pg->ip = ip;
+  pg->pgno = pgno;
+  pg->ref = 1;
+  pg->valid = 0;
+  pg->filling = 0;
+  pg->pinned = 0;
+  hp = pchash(ip, pgno);
+  pg->hnext = *hp;
+  *hp = pg;
+  pg->iprev = 0;
+  pg->inext = ip->pages;
+  if(ip->pages)
+    ip->pages->iprev = pg;
+  ip->pages = pg;
+  lruappend(pg);
+  release(&pcache.lock);
+  return pg;
+}
+
+// Claim page pg, which pcget() returned not valid, for reading
+// in.  Return 1 if the caller should read it and call pcfilled(),
+// or 0 if it became valid meanwhile.
+int
+pcfill(struct page *pg)
+{
+  acquire(&pcache.lock);
+  while(pg->filling)
+    sleep(pg, &pcache.lock);
+  if(pg->valid){
+    release(&pcache.lock);
+    return 0;
+  }
+  pg->filling = 1;
+  release(&pcache.lock);
+  return 1;
+}
+
+// Mark page pg, claimed with pcfill(), as read in.
+void
+pcfilled(struct page *pg)
+{
+  acquire(&pcache.lock);
+  pg->valid = 1;
+  pg->filling = 0;
+  wakeup(pg);
+  release(&pcache.lock);
+}
+
+// Mark page pg, claimed with pcfill(), as filled in and pinned, so
+// that it stays cached until its inode is truncated.
+void
+pcpin(struct page *pg)
+{
+  acquire(&pcache.lock);
+  pg->valid = 1;
+  pg->filling = 0;
+  pg->pinned = 1;
+  wakeup(pg);
+  release(&pcache.lock);
+}
+
+// Return page pgno of ip with a reference held, if it is cached.
+struct page*
+pclookup(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+  pg = pcfind(ip, pgno);
+  release(&pcache.lock);
+  return pg;
+}
+
+// Is page pgno of ip cached and valid?
+int
+pccached(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+  int valid;
+
+  acquire(&pcache.lock);
+  valid = 0;
+  for(pg = *pchash(ip, pgno); pg; pg = pg->hnext)
+    if(pg->ip == ip && pg->pgno == pgno)
+      valid = pg->valid;
+  release(&pcache.lock);
+  return valid;
+}
+
+// Drop a reference to pg.
+void
+pcput(struct page *pg)
+{
+  acquire(&pcache.lock);
+  if(pg->ref < 1)
+    panic("pcput");
+  pg->ref--;
+  release(&pcache.lock);
+}
+
+// Drop all of ip's pages from the cache, pinned ones too.
+// Return the number dropped.
+int
+pcpurge(struct inode *ip)
+{
+  struct page *pg;
+  int n;
+
+  if(ip->pages == 0)
+    return 0;
+  acquire(&pcache.lock);
+  for(n = 0; (pg = ip->pages) != 0; n++){
+    if(pg->ref != 0)
+      panic("pcpurge: page in use");
+    pcunlink(pg);
+    pcfree(pg);
+  }
+  release(&pcache.lock);
+  return n;
+}
+
+// Drop ip's pages past byte size, and zero the part past size of
+// the page it falls in.  Return the number dropped, or -1, with
+// none dropped, if some are in use.  Caller must hold ip locked.
+int
+pctrunc(struct inode *ip, uint size)
+{
+  struct page *pg, *next;
+  uint first;
+  int n;
+
+  first = (size + PGSIZE - 1) / PGSIZE;
+  acquire(&pcache.lock);
+  for(pg = ip->pages; pg; pg = pg->inext){
+    if(pg->pgno >= first && pg->ref != 0){
+      release(&pcache.lock);
+      return -1;
+    }
+  }
+  n = 0;
+  for(pg = ip->pages; pg; pg = next){
+    next = pg->inext;
+    if(pg->pgno >= first){
+      pcunlink(pg);
+      pcfree(pg);
+      n++;
+    } else if(pg->pgno == size / PGSIZE && pg->valid)
+      memset(pg->data + size % PGSIZE, 0, PGSIZE - size % PGSIZE);
+  }
+  release(&pcache.lock);
+  return n;
+}
+
+// Give an idle page back to the page allocator.  Called by
+// kalloc() when it runs out of memory.  Returns the number of
+// pages freed.
+int
+pcshrink(void)
+{
+  struct page *pg;
+
+  acquire(&pcache.lock);
+  if((pg = pcvictim()) != 0)
+    pcfree(pg);
+  release(&pcache.lock);
+  return pg != 0;
+}
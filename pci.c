@@ -0,0 +1,58 @@
+// PCI configuration space, through configuration mechanism #1:
+// write the address of a 32-bit register to CONFIG_ADDRESS, then
+// read or write it at CONFIG_DATA.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_CONFADDR  0xcf8
+#define PCI_CONFDATA  0xcfc
+
+// A device function is named by bdf = bus<<8 | dev<<3 | func.
+#define PCI_BDF(bus, dev, func)  ((bus)<<8 | (dev)<<3 | (func))
+
+uint
+pciread(uint bdf, int off)
+{
+  outl(PCI_CONFADDR, 0x80000000 | bdf<<8 | (off & 0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+void
+pciwrite(uint bdf, int off, uint v)
+{
+  outl(PCI_CONFADDR, 0x80000000 | bdf<<8 | (off & 0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Find the first function of the given class and subclass.
+// Stores its bdf in *bdfp and returns 0, or returns -1.
+int
+pcifind(int class, int subclass, uint *bdfp)
+{
+  uint bus, dev, func, bdf, id, cl;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      for(func = 0; func < 8; func++){
+        bdf = PCI_BDF(bus, dev, func);
+        id = pciread(bdf, 0x00);
+        if((id & 0xffff) == 0xffff){
+          if(func == 0)
+            break;
+          continue;
+        }
+        cl = pciread(bdf, 0x08);
+        if((cl >> 24) == class && ((cl >> 16) & 0xff) == subclass){
+          *bdfp = bdf;
+          return 0;
+        }
+        // Header type bit 7: device has more than one function.
+        if(func == 0 && !(pciread(bdf, 0x0c) & 0x00800000))
+          break;
+      }
+    }
+  }
+  return -1;
+}
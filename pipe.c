@@ -6,34 +6,80 @@
 #include "fs.h"
 #include "file.h"
 #include "spinlock.h"
+#include "uio.h"
+#include "slab.h"
+#include "poll.h"
 
-#define PIPESIZE 512
+// A pipe's ring buffer is PIPEPAGES whole pages, a power of two
+// so that the free-running nread and nwrite counters index it.
+#define PIPESIZE (PIPEPAGES*PGSIZE)
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *data[PIPEPAGES];  // ring buffer pages
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int rwait;      // a reader is sleeping
+  uint wneed;     // free space a sleeping writer waits for, or 0
 };
 
+static struct slabcache pipecache;
+
+static void
+pipector(void *v)
+{
+  initlock(&((struct pipe*)v)->lock, "pipe");
+}
+
+static void
+pipedtor(void *v)
+{
+  lockunregister(&((struct pipe*)v)->lock);
+}
+
+void
+pipeinit(void)
+{
+  slabinit(&pipecache, "pipecache", sizeof(struct pipe), pipector,
+           pipedtor);
+}
+
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++)
+    if(p->data[i])
+      kfree(p->data[i]);
+  slabfree(&pipecache, p);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
   struct pipe *p;
+  int i;
 
   p = 0;
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = slaballoc(&pipecache)) == 0)
     goto bad;
+  for(i = 0; i < PIPEPAGES; i++)
+    p->data[i] = 0;
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+      goto bad;
+  p->nread = 0;
+  p->nwrite = 0;
   p->readopen = 1;
   p->writeopen = 1;
-  p->nwrite = 0;
-  p->nread = 0;
-  initlock(&p->lock, "pipe");
+  p->rwait = 0;
+  p->wneed = 0;
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
@@ -47,7 +93,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    pipefree(p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -68,38 +114,90 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
-  } else
+    pipefree(p);
+  } else {
     release(&p->lock);
+    pollwake();
+  }
+}
+
+// Copy n bytes between addr and the ring at counter value pos,
+// in pieces that do not cross a page.  Caller holds p->lock.
+static void
+pipecopy(struct pipe *p, uint pos, char *addr, int n, int toring)
+{
+  char *d;
+  int m;
+
+  while(n > 0){
+    d = p->data[pos % PIPESIZE / PGSIZE] + pos % PGSIZE;
+    m = PGSIZE - pos % PGSIZE;
+    if(m > n)
+      m = n;
+    if(toring)
+      memmove(d, addr, m);
+    else
+      memmove(addr, d, m);
+    pos += m;
+    addr += m;
+    n -= m;
+  }
 }
 
 //PAGEBREAK: 40
+// Readers are woken when a write finishes or fills the ring;
+// a blocked writer only once there is room for what it still
+// has to write, up to half the ring, so that the two sides
+// alternate in large batches rather than byte by byte.
 int
-pipewrite(struct pipe *p, char *addr, int n)
+pipewrite(struct pipe *p, struct iovec *iov, int cnt)
 {
-  int i;
+  int i, m, v, n, done;
+  char *addr;
+
+  n = 0;
+  for(v = 0; v < cnt; v++)
+    n += iov[v].iov_len;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || proc->killed){
-        release(&p->lock);
-        return -1;
+  done = 0;
+  for(v = 0; v < cnt; v++){
+    addr = iov[v].iov_base;
+    for(i = 0; i < iov[v].iov_len; i += m){
+      while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+        if(p->readopen == 0 || proc->killed){
+          release(&p->lock);
+          return -1;
+        }
+        if(p->rwait){
+          p->rwait = 0;
+          wakeup(&p->nread);
+        }
+        pollwake();
+        p->wneed = n - done < PIPESIZE/2 ? n - done : PIPESIZE/2;
+        sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      m = PIPESIZE - (p->nwrite - p->nread);
+      if(m > iov[v].iov_len - i)
+        m = iov[v].iov_len - i;
+      pipecopy(p, p->nwrite, addr + i, m, 1);
+      p->nwrite += m;
+      done += m;
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  if(p->rwait){  //DOC: pipewrite-wakeup1
+    p->rwait = 0;
+    wakeup(&p->nread);
+  }
   release(&p->lock);
+  pollwake();
   return n;
 }
 
 int
-piperead(struct pipe *p, char *addr, int n)
+piperead(struct pipe *p, struct iovec *iov, int cnt)
 {
-  int i;
+  int m, v, n;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -107,14 +205,47 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    p->rwait = 1;
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  n = 0;
+  for(v = 0; v < cnt && p->nread != p->nwrite; v++){  //DOC: piperead-copy
+    m = p->nwrite - p->nread;
+    if(m > iov[v].iov_len)
+      m = iov[v].iov_len;
+    pipecopy(p, p->nread, iov[v].iov_base, m, 0);
+    p->nread += m;
+    n += m;
+  }
+  if(p->wneed && PIPESIZE - (p->nwrite - p->nread) >= p->wneed){  //DOC: piperead-wakeup
+    p->wneed = 0;
+    wakeup(&p->nwrite);
+  }
+  release(&p->lock);
+  pollwake();
+  return n;
+}
+
+// Return what the read end, or with writable the write end, of
+// p is ready for: POLLIN or POLLHUP, POLLOUT or POLLERR.
+int
+pipepoll(struct pipe *p, int writable)
+{
+  int r;
+
+  r = 0;
+  acquire(&p->lock);
+  if(writable){
+    if(p->nwrite != p->nread + PIPESIZE)
+      r |= POLLOUT;
+    if(!p->readopen)
+      r |= POLLERR;
+  } else {
+    if(p->nread != p->nwrite)
+      r |= POLLIN;
+    if(!p->writeopen)
+      r |= POLLHUP;
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
-  return i;
+  return r;
 }
@@ -0,0 +1,12 @@
+// Readiness multiplexing for poll.
+struct pollfd {
+  int fd;
+  short events;   // what to wait for
+  short revents;  // what is so; POLLERR, POLLHUP and POLLNVAL always count
+};
+
+#define POLLIN   0x01  // a read would not block
+#define POLLOUT  0x04  // a write would not block
+#define POLLERR  0x08  // write end of a pipe with no reader
+#define POLLHUP  0x10  // read end of a pipe with no writer
+#define POLLNVAL 0x20  // fd is not open
@@ -1,19 +1,78 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "uio.h"
+
+// Output of one printf call, gathered into iovecs and written
+// with a single writev.  Runs of the format and %s strings are
+// referenced where they are; numbers and characters are copied
+// into buf.
+struct out {
+  int fd;
+  int n;                        // iovecs in use
+  struct iovec iov[UIO_MAXIOV];
+  int used;                     // bytes of buf in use
+  char buf[128];
+};
 
 static void
-putc(int fd, char c)
+flush(struct out *o)
 {
-  write(fd, &c, 1);
+  if(o->n > 0)
+    writev(o->fd, o->iov, o->n);
+  o->n = 0;
+  o->used = 0;
 }
 
+// Add the n bytes at s to the output.
 static void
-printint(int fd, int xx, int base, int sgn)
+put(struct out *o, char *s, int n)
+{
+  struct iovec *v;
+
+  if(n == 0)
+    return;
+  if(o->n > 0){
+    v = &o->iov[o->n-1];
+    if((char*)v->iov_base + v->iov_len == s){
+      v->iov_len += n;
+      return;
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+    flush(o);
+  o->iov[o->n].iov_base = s;
+  o->iov[o->n].iov_len = n;
+  o->n++;
+}
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+    flush(o);
+  return o->buf + o->used;
+}
+
+static void
+putc(struct out *o, char c)
+{
+  char *p;
+
+  p = room(o, 1);
+  *p = c;
+  o->used++;
+  put(o, p, 1);
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
-  char buf[16];
-  int i, neg;
+  char buf[16], *p;
+  int i, n, neg;
   uint x;
 
   neg = 0;
@@ -31,55 +90,64 @@ printint(int fd, int xx, int base, int sgn)
   if(neg)
     buf[i++] = '-';
 
+  n = i;
+  p = room(o, n);
   while(--i >= 0)
-    putc(fd, buf[i]);
+    p[n-1-i] = buf[i];
+  o->used += n;
+  put(o, p, n);
 }
 
 // Print to the given fd. Only understands %d, %x, %p, %s.
 void
 printf(int fd, char *fmt, ...)
 {
+  struct out o;
   char *s;
-  int c, i, state;
+  int c, i, start, state;
   uint *ap;
 
+  o.fd = fd;
+  o.n = 0;
+  o.used = 0;
   state = 0;
   ap = (uint*)(void*)&fmt + 1;
+  start = 0;
   for(i = 0; fmt[i]; i++){
     c = fmt[i] & 0xff;
     if(state == 0){
       if(c == '%'){
+        put(&o, fmt + start, i - start);
         state = '%';
-      } else {
-        putc(fd, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(&o, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(&o, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
         ap++;
         if(s == 0)
           s = "(null)";
-        while(*s != 0){
-          putc(fd, *s);
-          s++;
-        }
+        put(&o, s, strlen(s));
       } else if(c == 'c'){
-        putc(fd, *ap);
+        putc(&o, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        putc(&o, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        putc(&o, '%');
+        putc(&o, c);
       }
       state = 0;
+      start = i + 1;
     }
   }
+  if(state == 0)
+    put(&o, fmt + start, i - start);
+  flush(&o);
 }
@@ -7,54 +7,262 @@
 #include "proc.h"
 #include "spinlock.h"
 #include "signal.h"
+#include "kstat.h"
 #include "fs.h"
 #include "file.h"
+#include "slab.h"
+
+// The process table.  Procs come from a slab cache, as many as
+// memory allows.  From allocproc until it is freed, a proc is on
+// the list ptable.all and on the chain in ptable.pid for its pid.
+#define NPIDHASH 64
 
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *all;
+  struct proc *pid[NPIDHASH];
 } ptable;
 
+static struct slabcache proccache;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static int wakeup1(void *chan, int n);
+static void killgroup(struct proc *g);
+static void threadexit(void);
+static void addusage(struct usage*, struct usage*);
+
+// Per-CPU run queues.  A RUNNABLE process is on exactly one of
+// them, normally that of the CPU it last ran on, and a CPU with
+// nothing of its own to run takes work from the longest other
+// queue.  ptable.lock still covers state changes and the switch
+// itself, so processes are queued with it held, but finding the
+// next process to run needs only the queue locks.
+//
+// Each queue has a list per priority level, and the scheduler
+// runs the highest level first (multi-level feedback).  A process
+// that uses up its time slice, QUANTUM(prio) ticks, drops a level;
+// one that wakes from sleep rises a level, so processes that
+// mostly wait for I/O stay near the top.  Every BOOSTTICKS ticks
+// everyone goes back to the top level so nothing starves.
+#define QUANTUM(prio) (1 << (prio))
+
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  int n;
+} runq[NCPU];
+
+// Sleeping processes, hashed by channel so that wakeup looks only
+// at processes that might be sleeping on its channel.  Each chain
+// is in the order its processes went to sleep.  Protected by
+// ptable.lock.
+#define NSLEEPQ 64
+
+static struct proc *sleepq[NSLEEPQ];
+
+static struct proc**
+sleepchain(void *chan)
+{
+  return &sleepq[((uint)chan * 2654435761U) >> 26];
+}
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  slabinit(&proccache, "proc", sizeof(struct proc), 0, 0);
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+}
+
+// Put p at the tail of its level's list in rq.
+// Caller must hold rq->lock.
+static void
+rqappend(struct runq *rq, struct proc *p)
+{
+  p->rqnext = 0;
+  if(rq->tail[p->prio])
+    rq->tail[p->prio]->rqnext = p;
+  else
+    rq->head[p->prio] = p;
+  rq->tail[p->prio] = p;
+}
+
+// Make p RUNNABLE and put it at the tail of its CPU's run queue.
+// Caller must hold ptable.lock.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq;
+
+  p->state = RUNNABLE;
+  rq = &runq[p->rqcpu];
+  acquire(&rq->lock);
+  rqappend(rq, p);
+  rq->n++;
+  release(&rq->lock);
+}
+
+// Take the first process of the highest non-empty level of rq,
+// if any.
+static struct proc*
+dequeue(struct runq *rq)
+{
+  struct proc *p;
+  int i;
+
+  p = 0;
+  acquire(&rq->lock);
+  for(i = 0; i < NPRIO; i++){
+    if((p = rq->head[i]) != 0){
+      rq->head[i] = p->rqnext;
+      if(rq->head[i] == 0)
+        rq->tail[i] = 0;
+      rq->n--;
+      break;
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Choose the next process for this CPU to run: the head of its own
+// run queue or, if that is empty, of the longest other one.
+static struct proc*
+pick(void)
+{
+  struct proc *p;
+  struct runq *rq, *mine, *victim;
+
+  mine = &runq[cpu->id];
+  if((p = dequeue(mine)) != 0)
+    return p;
+  victim = 0;
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+    if(rq != mine && rq->n > 0 && (victim == 0 || rq->n > victim->n))
+      victim = rq;
+  if(victim == 0 || (p = dequeue(victim)) == 0)
+    return 0;
+  kstatinc(KS_SCHEDSTEAL);
+  return p;
+}
+
+// Report on the scheduler for /stats/sched: switches, and each
+// CPU's share of them and run queue length.  The lengths are
+// read without the queues' locks.
+void
+schedstats(struct report *r)
+{
+  char name[16];
+  int i;
+
+  report(r, "switches", kstatsum(KS_SWITCH));
+  report(r, "steals", kstatsum(KS_SCHEDSTEAL));
+  for(i = 0; i < ncpu; i++){
+    snprintf(name, sizeof(name), "cpu%d.switches", i);
+    report(r, name, kstatcpu(i, KS_SWITCH));
+    snprintf(name, sizeof(name), "cpu%d.runq", i);
+    report(r, name, runq[i].n);
+  }
+}
+
+// Return the proc with the given pid, or 0.
+// The ptable lock must be held.
+static struct proc*
+pidlookup(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pid[(uint)pid % NPIDHASH]; p; p = p->pidnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Take p out of the table and free it, with its kernel stack.
+// The ptable lock must be held.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  if(p->kstack)
+    kfree(p->kstack);
+  for(pp = &ptable.pid[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->pidnext)
+    ;
+  *pp = p->pidnext;
+  *p->aprev = p->anext;
+  if(p->anext)
+    p->anext->aprev = p->aprev;
+  p->state = UNUSED;
+  slabfree(&proccache, p);
+}
+
+// A process is on one of its parent's two lists of children:
+// children while it runs, zombies once it has exited, so that
+// wait and exit look only at a process's own children.  Threads
+// are on neither.  The ptable lock must be held.
+static void
+addsibling(struct proc **head, struct proc *p)
+{
+  p->sibling = *head;
+  if(p->sibling)
+    p->sibling->psibling = &p->sibling;
+  p->psibling = head;
+  *head = p;
+}
+
+static void
+delsibling(struct proc *p)
+{
+  *p->psibling = p->sibling;
+  if(p->sibling)
+    p->sibling->psibling = p->psibling;
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
-// Otherwise return 0.
+// Allocate a proc, in state EMBRYO, and initialize the state
+// required to run in the kernel.  Return 0 if out of memory.
 static struct proc*
 allocproc(void)
 {
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-  release(&ptable.lock);
-  return 0;
+  if((p = slaballoc(&proccache)) == 0)
+    return 0;
+  memset(p, 0, sizeof(*p));
+  p->group = p;
+  p->nthreads = 1;
+  p->rqcpu = cpu->id;
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
 
-found:
+  acquire(&ptable.lock);
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->anext = ptable.all;
+  if(p->anext)
+    p->anext->aprev = &p->anext;
+  p->aprev = &ptable.all;
+  ptable.all = p;
+  p->pidnext = ptable.pid[p->pid % NPIDHASH];
+  ptable.pid[p->pid % NPIDHASH] = p;
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -102,7 +310,29 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  p->state = RUNNABLE;
+  acquire(&ptable.lock);
+  setrunnable(p);
+  release(&ptable.lock);
+}
+
+// Start a kernel process that runs fn, which must not return.
+// It has no user memory and never leaves the kernel.
+struct proc*
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kproc: no proc");
+  if((p->pgdir = setupkvm(kalloc)) == 0)
+    panic("kproc: out of memory");
+  // Make forkret return to fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+  acquire(&ptable.lock);
+  setrunnable(p);
+  release(&ptable.lock);
+  return p;
 }
 
 // Grow current process's memory by n bytes.
@@ -110,21 +340,88 @@ userinit(void)
 int
 growproc(int n)
 {
+  struct execseg *s;
+  struct proc *g;
   uint sz;
+  int i;
   
-  sz = proc->sz;
+  g = proc->group;
+  sz = g->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    // The new pages are allocated when first touched;
+    // see lazyfault.
+    if(sz + n >= KERNBASE || sz + n < sz || vmaoverlap(g, sz, sz + n))
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
+    // What was let go must come back zero, not from the program.
+    for(i = 0; i < g->nseg; i++){
+      s = &g->seg[i];
+      if(s->va + s->memsz > sz){
+        s->memsz = sz > s->va ? sz - s->va : 0;
+        g->xshare = 0;
+      }
+      if(s->filesz > s->memsz)
+        s->filesz = s->memsz;
+    }
+    uflush();
   }
-  proc->sz = sz;
-  switchuvm(proc);
+  g->sz = sz;
+  return 0;
+}
+
+// A process's open files start out in ofile0, NOFILE of them.
+// The table moves to pages of its own, doubling as needed, when
+// it would otherwise fill, up to NOFILEMAX entries.
+#define FDPAGE (PGSIZE/sizeof(struct file*))
+
+static int
+fdorder(int nofile)
+{
+  int order;
+
+  for(order = 0; (FDPAGE << order) < nofile; order++)
+    ;
+  return order;
+}
+
+// Make room in p's file table for descriptors below n.  Return 0,
+// or -1 if n is over NOFILEMAX or there is no memory.  Caller
+// holds lockgroup if p is the current process's main thread.
+int
+fdgrow(struct proc *p, int n)
+{
+  struct file **t;
+  int order;
+
+  if(n <= p->nofile)
+    return 0;
+  if(n > NOFILEMAX)
+    return -1;
+  order = fdorder(n);
+  if((t = (struct file**)kallocn(order)) == 0)
+    return -1;
+  memset(t, 0, PGSIZE << order);
+  memmove(t, p->ofile, p->nofile*sizeof(t[0]));
+  fdfree(p);
+  p->ofile = t;
+  p->nofile = FDPAGE << order;
   return 0;
 }
 
+// Give back p's file table if it has outgrown ofile0.  Its files
+// must be closed or moved first.
+void
+fdfree(struct proc *p)
+{
+  if(p->ofile != p->ofile0)
+    kfreen((char*)p->ofile, fdorder(p->nofile));
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -132,38 +429,122 @@ int
 fork(void)
 {
   int i, pid;
-  struct proc *np;
+  struct proc *np, *g;
 
   // Allocate process.
   if((np = allocproc()) == 0)
     return -1;
 
   // Copy process state from p.
-  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
-    return -1;
+  g = proc->group;
+  lockgroup();
+  if((np->pgdir = copyuvm(proc->pgdir, g->sz)) == 0)
+    goto bad;
+  if(mmapcopy(np) < 0 || fdgrow(np, g->nofile) < 0){
+    freevm(np->pgdir);
+    goto bad;
   }
-  np->sz = proc->sz;
-  np->parent = proc;
+  np->sz = g->sz;
+  if(g->exe)
+    np->exe = idup(g->exe);
+  memmove(np->seg, g->seg, sizeof(g->seg));
+  np->nseg = g->nseg;
+  np->xshare = g->xshare;
+  np->prio = np->nice = proc->nice;
+  np->sighandler = g->sighandler;
+  np->parent = g;
   *np->tf = *proc->tf;
 
 /*vvv  TASK 2    vvv*/
-  fork_pids(proc->pid, np->pid);
+  np->nunlocked = proc->nunlocked;
+  memmove(np->unlocked, proc->unlocked, proc->nunlocked*sizeof(proc->unlocked[0]));
 /*^^^^^^^^^^^^^^^^^^*/
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(proc->ofile[i])
-      np->ofile[i] = filedup(proc->ofile[i]);
-  np->cwd = idup(proc->cwd);
+  for(i = 0; i < g->nofile; i++)
+    if(g->ofile[i])
+      np->ofile[i] = filedup(g->ofile[i]);
+  unlockgroup();
+  np->cwd = idup(g->cwd);
  
   pid = np->pid;
-  np->state = RUNNABLE;
   safestrcpy(np->name, proc->name, sizeof(proc->name));
+  acquire(&ptable.lock);
+  addsibling(&g->children, np);
+  setrunnable(np);
+  release(&ptable.lock);
+  return pid;
+
+bad:
+  unlockgroup();
+  fdfree(np);
+  acquire(&ptable.lock);
+  freeproc(np);
+  release(&ptable.lock);
+  return -1;
+}
+
+// Start the program at path in a new child process, as fork
+// followed by exec would, but without copying the parent's memory
+// only to throw it away.  If fds is not 0, the child's descriptor
+// i is a dup of the parent's fds[i] for i < nfds, and closed if
+// fds[i] is -1 or i >= nfds; otherwise the child shares all the
+// parent's open files.  Return the child's pid, or -1.
+int
+spawn(char *path, char **argv, int *fds, int nfds)
+{
+  int i, fd, pid;
+  struct image img;
+  struct proc *np, *g;
+
+  g = proc->group;
+  if(fds)
+    for(i = 0; i < nfds; i++)
+      if(fds[i] != -1 && (fds[i] < 0 || fds[i] >= g->nofile || g->ofile[fds[i]] == 0))
+        return -1;
+  if(execload(path, argv, &img) < 0)
+    return -1;
+  if((np = allocproc()) == 0){
+    execfree(&img);
+    return -1;
+  }
+  if(fdgrow(np, fds ? nfds : g->nofile) < 0){
+    execfree(&img);
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+
+  memset(np->tf, 0, sizeof(*np->tf));
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  np->tf->es = np->tf->ds;
+  np->tf->ss = np->tf->ds;
+  np->tf->eflags = FL_IF;
+  execinstall(np, &img);
+  np->prio = np->nice = proc->nice;
+  np->parent = g;
+
+/*vvv  TASK 2    vvv*/
+  np->nunlocked = proc->nunlocked;
+  memmove(np->unlocked, proc->unlocked, proc->nunlocked*sizeof(proc->unlocked[0]));
+/*^^^^^^^^^^^^^^^^^^*/
+
+  for(i = 0; i < np->nofile; i++){
+    fd = fds == 0 ? i : i < nfds ? fds[i] : -1;
+    if(fd >= 0 && fd < g->nofile && g->ofile[fd])
+      np->ofile[i] = filedup(g->ofile[fd]);
+  }
+  np->cwd = idup(g->cwd);
+
+  pid = np->pid;
+  acquire(&ptable.lock);
+  addsibling(&g->children, np);
+  setrunnable(np);
+  release(&ptable.lock);
   return pid;
 }
 
@@ -179,33 +560,61 @@ exit(void)
   if(proc == initproc)
     panic("init exiting");
 
+  // A thread takes the whole process with it; the main thread
+  // waits for the others and then lets go of what they shared.
+  if(proc->group != proc){
+    acquire(&ptable.lock);
+    killgroup(proc->group);
+    threadexit();
+  }
+  endthreads();
+  ioringfree(proc);
+
+  munmapall(proc);
+
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < proc->nofile; fd++){
     if(proc->ofile[fd]){
       fileclose(proc->ofile[fd]);
       proc->ofile[fd] = 0;
     }
   }
+  fdfree(proc);
 
 /*vvv  TASK 2    vvv*/
-  free_inode_locks(proc->pid);
+  proc->nunlocked = 0;
 /*^^^^^^^^^^^^^^^^^^*/
 
   iput(proc->cwd);
   proc->cwd = 0;
+  if(proc->exe){
+    begin_trans(MAXOPBLOCKS);
+    iput(proc->exe);
+    commit_trans();
+    proc->exe = 0;
+  }
+  proc->nseg = 0;
 
   acquire(&ptable.lock);
 
-  // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  // Be a zombie child.  Parent might be sleeping in wait().
+  delsibling(proc);
+  addsibling(&proc->parent->zombies, proc);
+  wakeup1(proc->parent, -1);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == proc){
+  while((p = proc->children) != 0){
+    delsibling(p);
+    p->parent = initproc;
+    addsibling(&initproc->children, p);
+  }
+  if(proc->zombies){
+    while((p = proc->zombies) != 0){
+      delsibling(p);
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      addsibling(&initproc->zombies, p);
     }
+    wakeup1(initproc, -1);
   }
 
   // Jump into the scheduler, never to return.
@@ -214,66 +623,92 @@ exit(void)
   panic("zombie exit");
 }
 
+// Add the counts in b to a.
+static void
+addusage(struct usage *a, struct usage *b)
+{
+  a->utime += b->utime;
+  a->stime += b->stime;
+  a->nvcsw += b->nvcsw;
+  a->nivcsw += b->nivcsw;
+  a->nfault += b->nfault;
+  a->nblkin += b->nblkin;
+  a->nblkout += b->nblkout;
+}
+
+// Fill in *u with the usage of the current process's threads, or of
+// its children that it has waited for if children is set.
+void
+getusage(int children, struct usage *u)
+{
+  struct proc *p, *g;
+
+  g = proc->group;
+  memset(u, 0, sizeof(*u));
+  acquire(&ptable.lock);
+  if(children)
+    addusage(u, &g->cru);
+  else {
+    addusage(u, &g->tru);
+    for(p = ptable.all; p; p = p->anext)
+      if(p->group == g && p->state != ZOMBIE)
+        addusage(u, &p->ru);
+  }
+  release(&ptable.lock);
+}
+
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
 wait(void)
 {
-  struct proc *p;
-  int havekids, pid;
+  struct proc *p, *g;
+  int pid;
 
+  g = proc->group;
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for zombie children.
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != proc)
-        continue;
-      havekids = 1;
-      if(p->state == ZOMBIE){
-        // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        release(&ptable.lock);
-        return pid;
-      }
+    if((p = g->zombies) != 0){
+      delsibling(p);
+      pid = p->pid;
+      addusage(&g->cru, &p->ru);
+      addusage(&g->cru, &p->tru);
+      addusage(&g->cru, &p->cru);
+      freevm(p->pgdir);
+      freeproc(p);
+      release(&ptable.lock);
+      return pid;
     }
 
     // No point waiting if we don't have any children.
-    if(!havekids || proc->killed){
+    if(g->children == 0 || proc->killed){
       release(&ptable.lock);
       return -1;
     }
 
     // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-    sleep(proc, &ptable.lock);  //DOC: wait-sleep
+    sleep(g, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
-void
+// Have the current process, as it returns to user space, call the
+// handler at user address sighandler as if from where it was, by
+// pushing its %eip.  The handler must save any registers it uses.
+// Return -1 if the stack has no room.
+int
 register_handler(sighandler_t sighandler)
 {
-  char* addr = uva2ka(proc->pgdir, (char*)proc->tf->esp);
-  if ((proc->tf->esp & 0xFFF) == 0)
-    panic("esp_offset == 0");
-
-    /* open a new frame */
-  *(int*)(addr + ((proc->tf->esp - 4) & 0xFFF))
-          = proc->tf->eip;
-  proc->tf->esp -= 4;
+  uint sp, pc;
 
-    /* update eip */
+  sp = proc->tf->esp - 4;
+  pc = proc->tf->eip;
+  if(checkptr(sp, 4, 1) < 0 || copyout(proc->pgdir, sp, &pc, 4) < 0)
+    return -1;
+  proc->tf->esp = sp;
   proc->tf->eip = (uint)sighandler;
+  return 0;
 }
 
-
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -291,27 +726,32 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-      swtch(&cpu->scheduler, proc->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      proc = 0;
+    if((p = pick()) == 0){
+      // Nothing to run: get some pages ready for kalloc_zeroed.
+      kidle();
+      continue;
     }
-    release(&ptable.lock);
 
+    // Switch to chosen process.  It is the process's job
+    // to release ptable.lock and then reacquire it
+    // before jumping back to us.  If p has only just been
+    // queued by another CPU on its way into sched, that CPU
+    // holds ptable.lock until it is off p's stack.
+    acquire(&ptable.lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler");
+    p->rqcpu = cpu->id;
+    kstatinc(KS_SWITCH);
+    proc = p;
+    switchuvm(p);
+    p->state = RUNNING;
+    swtch(&cpu->scheduler, proc->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    proc = 0;
+    release(&ptable.lock);
   }
 }
 
@@ -340,11 +780,89 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  proc->ru.nivcsw++;
+  setrunnable(proc);
   sched();
   release(&ptable.lock);
 }
 
+// Charge the running process for a clock tick.  Return 1 if it
+// should give up the CPU: either it has used up its time slice,
+// dropping it a level, or a process at a higher level is waiting.
+int
+tick(void)
+{
+  struct runq *rq;
+  int i;
+
+  if(++proc->ticks >= QUANTUM(proc->prio)){
+    if(proc->prio < NPRIO-1)
+      proc->prio++;
+    proc->ticks = 0;
+    return 1;
+  }
+  rq = &runq[cpu->id];
+  for(i = 0; i < proc->prio; i++)
+    if(rq->head[i])
+      return 1;
+  return 0;
+}
+
+// Lift every process to the highest level its nice value allows.
+void
+boost(void)
+{
+  struct proc *p, *next, *q[NPRIO];
+  struct runq *rq;
+  int i;
+
+  acquire(&ptable.lock);
+  for(p = ptable.all; p; p = p->anext){
+    p->prio = p->nice;
+    p->ticks = 0;
+  }
+  for(rq = runq; rq < &runq[ncpu]; rq++){
+    acquire(&rq->lock);
+    memmove(q, rq->head, sizeof(q));
+    memset(rq->head, 0, sizeof(rq->head));
+    memset(rq->tail, 0, sizeof(rq->tail));
+    for(i = 0; i < NPRIO; i++){
+      for(p = q[i]; p; p = next){
+        next = p->rqnext;
+        rqappend(rq, p);
+      }
+    }
+    release(&rq->lock);
+  }
+  release(&ptable.lock);
+}
+
+// Set the nice value of process pid (0: the caller) to nice,
+// from 0 to NPRIO-1; a process never runs at a higher level than
+// its nice value.  Children inherit it.
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+
+  if(nice < 0 || nice >= NPRIO)
+    return -1;
+  if(pid == 0)
+    pid = proc->pid;
+  acquire(&ptable.lock);
+  if((p = pidlookup(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  p->nice = nice;
+  if(p->prio < nice){
+    p->prio = nice;
+    p->ticks = 0;
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
 // A fork child's very first scheduling by scheduler()
 // will swtch here.  "Return" to user space.
 void
@@ -359,6 +877,7 @@ forkret(void)
     // of a regular process (e.g., they call sleep), and thus cannot 
     // be run from main().
     first = 0;
+    fsinit(ROOTDEV);
     initlog();
   }
   
@@ -370,6 +889,8 @@ forkret(void)
 void
 sleep(void *chan, struct spinlock *lk)
 {
+  struct proc **pp;
+
   if(proc == 0)
     panic("sleep");
 
@@ -388,8 +909,13 @@ sleep(void *chan, struct spinlock *lk)
   }
 
   // Go to sleep.
+  proc->ru.nvcsw++;
   proc->chan = chan;
   proc->state = SLEEPING;
+  for(pp = sleepchain(chan); *pp; pp = &(*pp)->cnext)
+    ;
+  proc->cnext = 0;
+  *pp = proc;
   sched();
 
   // Tidy up.
@@ -403,16 +929,31 @@ sleep(void *chan, struct spinlock *lk)
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
+// Wake up to n of the processes sleeping on chan, those that have
+// slept longest first, or all of them if n < 0.  Return how many.
 // The ptable lock must be held.
-static void
-wakeup1(void *chan)
+static int
+wakeup1(void *chan, int n)
 {
-  struct proc *p;
+  struct proc **pp, *p;
+  int woken;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  woken = 0;
+  pp = sleepchain(chan);
+  while(woken != n && (p = *pp) != 0){
+    if(p->chan != chan){
+      pp = &p->cnext;
+      continue;
+    }
+    *pp = p->cnext;
+    if(p->prio > p->nice){
+      p->prio--;
+      p->ticks = 0;
+    }
+    setrunnable(p);
+    woken++;
+  }
+  return woken;
 }
 
 // Wake up all processes sleeping on chan.
@@ -420,10 +961,50 @@ void
 wakeup(void *chan)
 {
   acquire(&ptable.lock);
-  wakeup1(chan);
+  wakeup1(chan, -1);
   release(&ptable.lock);
 }
 
+// Wake up one process sleeping on chan, for a channel that
+// stands for a lock only one waiter can take.
+void
+wakeone(void *chan)
+{
+  acquire(&ptable.lock);
+  wakeup1(chan, 1);
+  release(&ptable.lock);
+}
+
+// Wake up to n processes sleeping on chan, or all if n < 0, and
+// return how many there were.
+int
+wakeupn(void *chan, int n)
+{
+  int woken;
+
+  acquire(&ptable.lock);
+  woken = wakeup1(chan, n);
+  release(&ptable.lock);
+  return woken;
+}
+
+// Mark p killed, waking it from sleep if necessary.
+// The ptable lock must be held.
+static void
+kill1(struct proc *p)
+{
+  struct proc **pp;
+
+  p->killed = 1;
+  if(p->state == SLEEPING){
+    pp = sleepchain(p->chan);
+    while(*pp != p)
+      pp = &(*pp)->cnext;
+    *pp = p->cnext;
+    setrunnable(p);
+  }
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -433,18 +1014,264 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+  if((p = pidlookup(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  kill1(p);
+  release(&ptable.lock);
+  return 0;
+}
+
+//PAGEBREAK!
+// Threads.
+//
+// A thread is a proc of its own, with its own kernel stack,
+// trap frame and context, scheduled like any other, whose group
+// is the process's main thread.  The main thread owns what the
+// threads share: the page table (which each thread also points
+// to), the size, segments and mappings of the address space, the
+// open files and the current directory, so code that needs them
+// goes through proc->group.  Threads that change the address
+// space or the file table take lockgroup() first.  The main
+// thread outlives the others: exit and exec kill and collect them
+// before letting go of anything.
+
+// Kill every live thread of g but the current one.
+// The ptable lock must be held.
+static void
+killgroup(struct proc *g)
+{
+  struct proc *p;
+
+  for(p = ptable.all; p; p = p->anext)
+    if(p->group == g && p != proc && p->state != ZOMBIE)
+      kill1(p);
+}
+
+// End the current thread, which is not its process's main thread.
+// The ptable lock must be held.  Does not return.
+static void
+threadexit(void)
+{
+  addusage(&proc->group->tru, &proc->ru);
+  proc->group->nthreads--;
+  wakeup1(proc, -1);         // kthreadjoin
+  wakeup1(proc->group, -1);  // endthreads
+  proc->state = ZOMBIE;
+  sched();
+  panic("zombie exit");
+}
+
+// Kill the other threads of the current process, which must be
+// its main thread, wait for them to end, and free them.
+void
+endthreads(void)
+{
+  struct proc *p, *next;
+
+  acquire(&ptable.lock);
+  killgroup(proc);
+  while(proc->nthreads > 1)
+    sleep(proc, &ptable.lock);
+  for(p = ptable.all; p; p = next){
+    next = p->anext;
+    if(p->group == proc && p != proc && p->state == ZOMBIE)
+      freeproc(p);
+  }
+  release(&ptable.lock);
+}
+
+// Serialize the threads of the current process over changes to
+// their shared address space and file table.  A process with one
+// thread has no one to exclude, and only it could add another.
+void
+lockgroup(void)
+{
+  struct proc *g;
+
+  g = proc->group;
+  if(g->nthreads == 1)
+    return;
+  acquire(&ptable.lock);
+  while(g->gbusy)
+    sleep(&g->gbusy, &ptable.lock);
+  g->gbusy = 1;
+  release(&ptable.lock);
+}
+
+void
+unlockgroup(void)
+{
+  struct proc *g;
+
+  g = proc->group;
+  if(g->gbusy == 0)
+    return;
+  acquire(&ptable.lock);
+  g->gbusy = 0;
+  wakeup1(&g->gbusy, 1);
+  release(&ptable.lock);
+}
+
+// Start a thread in the current process at user address start, on
+// the stack of size bytes at stack.  Return its id, or -1.  If
+// start returns, the thread faults and takes the process with it;
+// it should call kthread_exit.
+int
+kthreadcreate(uint start, uint stack, uint size)
+{
+  struct proc *np, *g;
+  uint sp, pc;
+
+  g = proc->group;
+  sp = stack + size;
+  if(sp < stack || size < 4 || checkptr(sp - 4, 4, 1) < 0)
+    return -1;
+  pc = 0xffffffff;  // fake return PC
+  if(copyout(proc->pgdir, sp - 4, &pc, 4) < 0)
+    return -1;
+  if((np = allocproc()) == 0)
+    return -1;
+
+  np->pgdir = proc->pgdir;
+  np->group = g;
+  np->parent = g;
+  *np->tf = *proc->tf;
+  np->tf->eip = start;
+  np->tf->esp = sp - 4;
+  np->tf->eax = 0;
+  np->prio = np->nice = proc->nice;
+  np->nunlocked = proc->nunlocked;
+  memmove(np->unlocked, proc->unlocked, proc->nunlocked*sizeof(proc->unlocked[0]));
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+
+  acquire(&ptable.lock);
+  g->nthreads++;
+  setrunnable(np);
+  release(&ptable.lock);
+  return np->pid;
+}
+
+// Start a kernel thread in the current process that runs fn, which
+// must not return, with the process's address space and open files.
+// It never enters user space; fn should call kworkerexit once it
+// has been killed.  Return 0, or -1.
+int
+kworker(char *name, void (*fn)(void))
+{
+  struct proc *np, *g;
+
+  g = proc->group;
+  if((np = allocproc()) == 0)
+    return -1;
+  np->pgdir = proc->pgdir;
+  np->group = g;
+  np->parent = g;
+  // Make forkret return to fn instead of trapret.
+  *(uint*)(np->context + 1) = (uint)fn;
+  np->prio = np->nice = proc->nice;
+  np->nunlocked = proc->nunlocked;
+  memmove(np->unlocked, proc->unlocked, proc->nunlocked*sizeof(proc->unlocked[0]));
+  safestrcpy(np->name, name, sizeof(np->name));
+
+  acquire(&ptable.lock);
+  g->nthreads++;
+  setrunnable(np);
+  release(&ptable.lock);
+  return 0;
+}
+
+// End the current kernel thread, which kworker started.
+void
+kworkerexit(void)
+{
+  acquire(&ptable.lock);
+  threadexit();
+}
+
+// End the current thread.  The last thread to end ends the
+// process; the main thread waits for the others first.
+void
+kthreadexit(void)
+{
+  struct proc *g;
+
+  g = proc->group;
+  acquire(&ptable.lock);
+  if(proc != g && g->nthreads > 1)
+    threadexit();
+  while(g->nthreads > 1 && !proc->killed)
+    sleep(g, &ptable.lock);
+  release(&ptable.lock);
+  exit();
+}
+
+// Wait for thread tid of the current process to end, and free it.
+// Return 0, or -1 if there is no such thread to wait for.
+int
+kthreadjoin(int tid)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  p = pidlookup(tid);
+  if(p == 0 || p->group != proc->group || p == proc || p == p->group){
+    release(&ptable.lock);
+    return -1;
+  }
+  while(p->state != ZOMBIE){
+    if(proc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(p, &ptable.lock);
+    if(pidlookup(tid) != p){
+      // Someone else joined it first.
       release(&ptable.lock);
-      return 0;
+      return -1;
     }
   }
+  freeproc(p);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Read /dev/procstat: a line for each thread with its pid, name
+// and system call counts (see fmtsysstat).
+int
+procstatread(char *dst, uint off, int n)
+{
+  char line[200];
+  struct proc *p;
+  uint pos;
+
+  pos = 0;
+  snprintf(line, sizeof(line), "%5s %-16s %10s %8s %s\n", "pid", "name",
+           "calls", "errors", "log2(cycles):calls");
+  emitline(line, &pos, dst, off, n);
+  acquire(&ptable.lock);
+  for(p = ptable.all; p && pos < off + n; p = p->anext){
+    fmtsysstat(&p->sstat, line, snprintf(line, sizeof(line), "%5d %-16s",
+               p->pid, p->name), sizeof(line));
+    emitline(line, &pos, dst, off, n);
+  }
+  release(&ptable.lock);
+  if(pos <= off)
+    return 0;
+  return (pos < off + n ? pos : off + n) - off;
+}
+
+// Reset every thread's system call counts.
+void
+procstatclear(void)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.all; p; p = p->anext)
+    memset(&p->sstat, 0, sizeof(p->sstat));
   release(&ptable.lock);
-  return -1;
 }
 
 //PAGEBREAK: 36
@@ -467,14 +1294,14 @@ procdump(void)
   char *state;
   uint pc[10];
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED)
-      continue;
+  for(p = ptable.all; p; p = p->anext){
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %d %s", p->pid, state, p->prio, p->name);
+    cprintf(" u%d s%d cs%d/%d flt%d io%d/%d", p->ru.utime, p->ru.stime,
+            p->ru.nvcsw, p->ru.nivcsw, p->ru.nfault, p->ru.nblkin, p->ru.nblkout);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -484,27 +1311,49 @@ procdump(void)
   }
 }
 
-/*vvv  TASK 2    vvv*/
-int
-is_inode_open(struct inode* ip)
+//PAGEBREAK!
+// Paging out.  swapout (see vm.c) takes pages only from a process
+// that is off every CPU, preempted in user mode: then nothing in
+// the kernel is using its memory, and no TLB holds translations
+// of its page table.  swaplock returns such a process with the
+// ptable lock held, which keeps it from running until swapunlock.
+
+static int
+swappable(struct proc *p)
 {
-  int i;
-  struct proc *p;
+  return p->state == RUNNABLE && p->upreempt && p->group == p &&
+    p->nthreads == 1 && p->sz > 0;
+}
+
+// Lock and return the process with the given pid if swapout may
+// take its pages, or with next, the first such process after it
+// in the table, around to it again.  Return 0 if there is none.
+struct proc*
+swaplock(int pid, int next)
+{
+  struct proc *p, *start;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != UNUSED){
-      for(i = 0; i < NOFILE; i++){
-        if(p->ofile[i]){
-          if(p->ofile[i]->type == FD_INODE && p->ofile[i]->ip->inum == ip->inum){
-            release(&ptable.lock);
-            return 1;
-          }
-        }
-      }
-    }
+  p = pidlookup(pid);
+  if(!next){
+    if(p && swappable(p))
+      return p;
+  } else {
+    start = p && p->anext ? p->anext : ptable.all;
+    p = start;
+    do {
+      if(swappable(p))
+        return p;
+      if((p = p->anext) == 0)
+        p = ptable.all;
+    } while(p != start);
   }
   release(&ptable.lock);
   return 0;
 }
-/*^^^^^^^^^^^^^^^^^^*/
+
+void
+swapunlock(void)
+{
+  release(&ptable.lock);
+}
@@ -14,7 +14,7 @@ struct cpu {
   // Cpu-local storage variables; see below
   struct cpu *cpu;
   struct proc *proc;           // The currently-running process.
-};
+} __attribute__((aligned(CACHELINE)));  // apart from the other CPUs'
 
 extern struct cpu cpus[NCPU];
 extern int ncpu;
@@ -51,6 +51,62 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// Segment of the program, read in from the executable a page at
+// a time as it is touched.
+struct execseg {
+  uint va;                     // page-aligned start
+  uint memsz;
+  uint off;                    // offset in the executable
+  uint filesz;
+};
+
+// A freshly loaded user image, built by execload and handed to
+// the process that will run it by exec or spawn.
+struct image {
+  pde_t *pgdir;
+  uint sz;
+  uint entry;                  // initial %eip
+  uint sp;                     // initial %esp, with argc and argv pushed
+  struct inode *exe;
+  struct execseg seg[NEXECSEG];
+  int nseg;
+  char name[16];
+};
+
+// Mapping of file f, from byte off on, at user addresses [start, end).
+struct vma {
+  uint start;                  // 0: slot unused
+  uint end;
+  struct file *f;
+  uint off;
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+};
+
+// Counts of system calls made (see sysaccount).  hist[b] counts
+// those that took from 2^(b+SYSHISTMIN) up to twice that many TSC
+// cycles; the first and last buckets also take what falls below
+// and above.
+#define NSYSHIST   16
+#define SYSHISTMIN 8
+
+struct sysstat {
+  uint ncall;
+  uint nerr;                   // calls that returned < 0
+  uint hist[NSYSHIST];
+};
+
+// Time and events charged to a thread; see struct rusage.
+struct usage {
+  uint utime;
+  uint stime;
+  uint nvcsw;
+  uint nivcsw;
+  uint nfault;
+  uint nblkin;
+  uint nblkout;
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -59,13 +115,54 @@ struct proc {
   enum procstate state;        // Process state
   volatile int pid;            // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // Live children, linked by sibling
+  struct proc *zombies;        // Exited children not yet waited for
+  struct proc *sibling;        // Next on the parent's list
+  struct proc **psibling;
+  struct proc *group;          // Main thread, which owns the shared state
+  int nthreads;                // Main thread: threads alive, itself included
+  int gbusy;                   // Main thread: held by lockgroup
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *cnext;          // Next sleeper in chan's hash chain
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  struct file **ofile;         // Open files: ofile0, or a bigger table
+  int nofile;                  // Size of ofile
+  int fdlow;                   // No free descriptor below this one
+  struct file *ofile0[NOFILE];
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  int logres;                  // Log blocks reserved by begin_trans
+  char argstr[2][MAXSTRARG];   // argstr's copies of string arguments
+  struct {                     // Protected files unlocked by funlock
+    uint dev;
+    uint inum;
+  } unlocked[NUNLOCK];
+  int nunlocked;
+  struct vma vma[NVMA];        // Memory-mapped files
+  struct inode *exe;           // Executable, if pages are still to come from it
+  struct execseg seg[NEXECSEG];
+  int nseg;
+  int xshare;                  // Segments intact: share pages with others
+  int prio;                    // Scheduling level, 0 (highest) to NPRIO-1
+  int nice;                    // Highest level prio may rise to
+  int ticks;                   // Clock ticks used at this level
+  int rqcpu;                   // CPU whose run queue takes this process
+  struct proc *rqnext;         // Next on that run queue
+  int upreempt;                // Preempted in user mode: swapout may take pages
+  struct proc *anext;          // Next in the process table
+  struct proc **aprev;
+  struct proc *pidnext;        // Next in pid's hash chain
+  uint sighandler;             // Main thread: SIGALRM handler, or 0
+  int alarm;                   // Raise SIGALRM every alarm ticks; 0: off
+  int alarmticks;              // Ticks since the last SIGALRM
+  int alarmdue;                // SIGALRM to deliver on return to user
+  struct ioctx *ioctx;         // Main thread: io ring, or 0
+  struct sysstat sstat;        // System calls made by this thread
+  struct usage ru;             // Charged to this thread
+  struct usage tru;            // Main thread: to its threads that ended
+  struct usage cru;            // Main thread: to children waited for
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -73,3 +170,5 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+// with memory-mapped files, if any, below KERNBASE.
+// Only the stack is present from the start; see lazyfault.
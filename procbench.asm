@@ -0,0 +1,2470 @@
+
+_procbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fail>:
+
+char *self;             // how to exec this program
+
+static void
+fail(char *what)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "procbench: %s failed\n", what);
+       6:	83 ec 04             	sub    $0x4,%esp
+       9:	ff 75 08             	push   0x8(%ebp)
+       c:	68 e4 13 00 00       	push   $0x13e4
+      11:	6a 02                	push   $0x2
+      13:	e8 30 0d 00 00       	call   d48 <printf>
+      18:	83 c4 10             	add    $0x10,%esp
+  exit();
+      1b:	e8 98 08 00 00       	call   8b8 <exit>
+
+00000020 <null>:
+}
+
+// A system call that does nothing.
+static void
+null(int n)
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+      23:	83 ec 08             	sub    $0x8,%esp
+  while(n-- > 0)
+      26:	eb 05                	jmp    2d <null+0xd>
+    getpid();
+      28:	e8 13 09 00 00       	call   940 <getpid>
+  while(n-- > 0)
+      2d:	8b 45 08             	mov    0x8(%ebp),%eax
+      30:	8d 50 ff             	lea    -0x1(%eax),%edx
+      33:	89 55 08             	mov    %edx,0x8(%ebp)
+      36:	85 c0                	test   %eax,%eax
+      38:	7f ee                	jg     28 <null+0x8>
+}
+      3a:	90                   	nop
+      3b:	90                   	nop
+      3c:	c9                   	leave
+      3d:	c3                   	ret
+
+0000003e <forkexit>:
+
+static void
+forkexit(int n)
+{
+      3e:	55                   	push   %ebp
+      3f:	89 e5                	mov    %esp,%ebp
+      41:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  while(n-- > 0){
+      44:	eb 2e                	jmp    74 <forkexit+0x36>
+    if((pid = fork()) < 0)
+      46:	e8 66 08 00 00       	call   8b1 <fork>
+      4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      52:	79 10                	jns    64 <forkexit+0x26>
+      fail("fork");
+      54:	83 ec 0c             	sub    $0xc,%esp
+      57:	68 fa 13 00 00       	push   $0x13fa
+      5c:	e8 9f ff ff ff       	call   0 <fail>
+      61:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+      64:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      68:	75 05                	jne    6f <forkexit+0x31>
+      exit();
+      6a:	e8 49 08 00 00       	call   8b8 <exit>
+    wait();
+      6f:	e8 4b 08 00 00       	call   8bf <wait>
+  while(n-- > 0){
+      74:	8b 45 08             	mov    0x8(%ebp),%eax
+      77:	8d 50 ff             	lea    -0x1(%eax),%edx
+      7a:	89 55 08             	mov    %edx,0x8(%ebp)
+      7d:	85 c0                	test   %eax,%eax
+      7f:	7f c5                	jg     46 <forkexit+0x8>
+  }
+}
+      81:	90                   	nop
+      82:	90                   	nop
+      83:	c9                   	leave
+      84:	c3                   	ret
+
+00000085 <forkexec>:
+
+static void
+forkexec(int n)
+{
+      85:	55                   	push   %ebp
+      86:	89 e5                	mov    %esp,%ebp
+      88:	83 ec 18             	sub    $0x18,%esp
+  char *argv[] = { self, "-x", 0 };
+      8b:	a1 c0 19 00 00       	mov    0x19c0,%eax
+      90:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      93:	c7 45 ec ff 13 00 00 	movl   $0x13ff,-0x14(%ebp)
+      9a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  int pid;
+
+  while(n-- > 0){
+      a1:	eb 4e                	jmp    f1 <forkexec+0x6c>
+    if((pid = fork()) < 0)
+      a3:	e8 09 08 00 00       	call   8b1 <fork>
+      a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      ab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      af:	79 10                	jns    c1 <forkexec+0x3c>
+      fail("fork");
+      b1:	83 ec 0c             	sub    $0xc,%esp
+      b4:	68 fa 13 00 00       	push   $0x13fa
+      b9:	e8 42 ff ff ff       	call   0 <fail>
+      be:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0){
+      c1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      c5:	75 25                	jne    ec <forkexec+0x67>
+      exec(self, argv);
+      c7:	a1 c0 19 00 00       	mov    0x19c0,%eax
+      cc:	83 ec 08             	sub    $0x8,%esp
+      cf:	8d 55 e8             	lea    -0x18(%ebp),%edx
+      d2:	52                   	push   %edx
+      d3:	50                   	push   %eax
+      d4:	e8 10 08 00 00       	call   8e9 <exec>
+      d9:	83 c4 10             	add    $0x10,%esp
+      fail("exec");
+      dc:	83 ec 0c             	sub    $0xc,%esp
+      df:	68 02 14 00 00       	push   $0x1402
+      e4:	e8 17 ff ff ff       	call   0 <fail>
+      e9:	83 c4 10             	add    $0x10,%esp
+    }
+    wait();
+      ec:	e8 ce 07 00 00       	call   8bf <wait>
+  while(n-- > 0){
+      f1:	8b 45 08             	mov    0x8(%ebp),%eax
+      f4:	8d 50 ff             	lea    -0x1(%eax),%edx
+      f7:	89 55 08             	mov    %edx,0x8(%ebp)
+      fa:	85 c0                	test   %eax,%eax
+      fc:	7f a5                	jg     a3 <forkexec+0x1e>
+  }
+}
+      fe:	90                   	nop
+      ff:	90                   	nop
+     100:	c9                   	leave
+     101:	c3                   	ret
+
+00000102 <pingpong>:
+
+// Round trips of a byte to a child and back, through two pipes.
+static void
+pingpong(int n)
+{
+     102:	55                   	push   %ebp
+     103:	89 e5                	mov    %esp,%ebp
+     105:	83 ec 28             	sub    $0x28,%esp
+  int p[2], q[2], pid, i;
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+     108:	83 ec 0c             	sub    $0xc,%esp
+     10b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     10e:	50                   	push   %eax
+     10f:	e8 b2 07 00 00       	call   8c6 <pipe>
+     114:	83 c4 10             	add    $0x10,%esp
+     117:	85 c0                	test   %eax,%eax
+     119:	78 13                	js     12e <pingpong+0x2c>
+     11b:	83 ec 0c             	sub    $0xc,%esp
+     11e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     121:	50                   	push   %eax
+     122:	e8 9f 07 00 00       	call   8c6 <pipe>
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	85 c0                	test   %eax,%eax
+     12c:	79 10                	jns    13e <pingpong+0x3c>
+    fail("pipe");
+     12e:	83 ec 0c             	sub    $0xc,%esp
+     131:	68 07 14 00 00       	push   $0x1407
+     136:	e8 c5 fe ff ff       	call   0 <fail>
+     13b:	83 c4 10             	add    $0x10,%esp
+  if((pid = fork()) < 0)
+     13e:	e8 6e 07 00 00       	call   8b1 <fork>
+     143:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     146:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     14a:	79 10                	jns    15c <pingpong+0x5a>
+    fail("fork");
+     14c:	83 ec 0c             	sub    $0xc,%esp
+     14f:	68 fa 13 00 00       	push   $0x13fa
+     154:	e8 a7 fe ff ff       	call   0 <fail>
+     159:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0){
+     15c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     160:	75 5e                	jne    1c0 <pingpong+0xbe>
+    for(i = 0; i < n; i++)
+     162:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     169:	eb 48                	jmp    1b3 <pingpong+0xb1>
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+     16b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     16e:	83 ec 04             	sub    $0x4,%esp
+     171:	6a 01                	push   $0x1
+     173:	8d 55 df             	lea    -0x21(%ebp),%edx
+     176:	52                   	push   %edx
+     177:	50                   	push   %eax
+     178:	e8 50 07 00 00       	call   8cd <read>
+     17d:	83 c4 10             	add    $0x10,%esp
+     180:	83 f8 01             	cmp    $0x1,%eax
+     183:	75 1a                	jne    19f <pingpong+0x9d>
+     185:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     188:	83 ec 04             	sub    $0x4,%esp
+     18b:	6a 01                	push   $0x1
+     18d:	8d 55 df             	lea    -0x21(%ebp),%edx
+     190:	52                   	push   %edx
+     191:	50                   	push   %eax
+     192:	e8 3d 07 00 00       	call   8d4 <write>
+     197:	83 c4 10             	add    $0x10,%esp
+     19a:	83 f8 01             	cmp    $0x1,%eax
+     19d:	74 10                	je     1af <pingpong+0xad>
+        fail("pipe read or write");
+     19f:	83 ec 0c             	sub    $0xc,%esp
+     1a2:	68 0c 14 00 00       	push   $0x140c
+     1a7:	e8 54 fe ff ff       	call   0 <fail>
+     1ac:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+     1af:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1b6:	3b 45 08             	cmp    0x8(%ebp),%eax
+     1b9:	7c b0                	jl     16b <pingpong+0x69>
+    exit();
+     1bb:	e8 f8 06 00 00       	call   8b8 <exit>
+  }
+  for(i = 0; i < n; i++)
+     1c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1c7:	eb 48                	jmp    211 <pingpong+0x10f>
+    if(write(p[1], &c, 1) != 1 || read(q[0], &c, 1) != 1)
+     1c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1cc:	83 ec 04             	sub    $0x4,%esp
+     1cf:	6a 01                	push   $0x1
+     1d1:	8d 55 df             	lea    -0x21(%ebp),%edx
+     1d4:	52                   	push   %edx
+     1d5:	50                   	push   %eax
+     1d6:	e8 f9 06 00 00       	call   8d4 <write>
+     1db:	83 c4 10             	add    $0x10,%esp
+     1de:	83 f8 01             	cmp    $0x1,%eax
+     1e1:	75 1a                	jne    1fd <pingpong+0xfb>
+     1e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1e6:	83 ec 04             	sub    $0x4,%esp
+     1e9:	6a 01                	push   $0x1
+     1eb:	8d 55 df             	lea    -0x21(%ebp),%edx
+     1ee:	52                   	push   %edx
+     1ef:	50                   	push   %eax
+     1f0:	e8 d8 06 00 00       	call   8cd <read>
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	83 f8 01             	cmp    $0x1,%eax
+     1fb:	74 10                	je     20d <pingpong+0x10b>
+      fail("pipe write or read");
+     1fd:	83 ec 0c             	sub    $0xc,%esp
+     200:	68 1f 14 00 00       	push   $0x141f
+     205:	e8 f6 fd ff ff       	call   0 <fail>
+     20a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+     20d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     214:	3b 45 08             	cmp    0x8(%ebp),%eax
+     217:	7c b0                	jl     1c9 <pingpong+0xc7>
+  wait();
+     219:	e8 a1 06 00 00       	call   8bf <wait>
+  close(p[0]);
+     21e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     221:	83 ec 0c             	sub    $0xc,%esp
+     224:	50                   	push   %eax
+     225:	e8 b1 06 00 00       	call   8db <close>
+     22a:	83 c4 10             	add    $0x10,%esp
+  close(p[1]);
+     22d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     230:	83 ec 0c             	sub    $0xc,%esp
+     233:	50                   	push   %eax
+     234:	e8 a2 06 00 00       	call   8db <close>
+     239:	83 c4 10             	add    $0x10,%esp
+  close(q[0]);
+     23c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     23f:	83 ec 0c             	sub    $0xc,%esp
+     242:	50                   	push   %eax
+     243:	e8 93 06 00 00       	call   8db <close>
+     248:	83 c4 10             	add    $0x10,%esp
+  close(q[1]);
+     24b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     24e:	83 ec 0c             	sub    $0xc,%esp
+     251:	50                   	push   %eax
+     252:	e8 84 06 00 00       	call   8db <close>
+     257:	83 c4 10             	add    $0x10,%esp
+}
+     25a:	90                   	nop
+     25b:	c9                   	leave
+     25c:	c3                   	ret
+
+0000025d <yields>:
+
+// Switches through the scheduler and back.
+static void
+yields(int n)
+{
+     25d:	55                   	push   %ebp
+     25e:	89 e5                	mov    %esp,%ebp
+     260:	83 ec 08             	sub    $0x8,%esp
+  while(n-- > 0)
+     263:	eb 05                	jmp    26a <yields+0xd>
+    yield();
+     265:	e8 16 08 00 00       	call   a80 <yield>
+  while(n-- > 0)
+     26a:	8b 45 08             	mov    0x8(%ebp),%eax
+     26d:	8d 50 ff             	lea    -0x1(%eax),%edx
+     270:	89 55 08             	mov    %edx,0x8(%ebp)
+     273:	85 c0                	test   %eax,%eax
+     275:	7f ee                	jg     265 <yields+0x8>
+}
+     277:	90                   	nop
+     278:	90                   	nop
+     279:	c9                   	leave
+     27a:	c3                   	ret
+
+0000027b <grow>:
+
+// Growing the heap a page at a time, and touching each page.
+static void
+grow(int n)
+{
+     27b:	55                   	push   %ebp
+     27c:	89 e5                	mov    %esp,%ebp
+     27e:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  int i;
+
+  for(i = 0; i < n; i++){
+     281:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     288:	eb 33                	jmp    2bd <grow+0x42>
+    if((p = sbrk(PGSIZE)) == (char*)-1)
+     28a:	83 ec 0c             	sub    $0xc,%esp
+     28d:	68 00 10 00 00       	push   $0x1000
+     292:	e8 b3 06 00 00       	call   94a <sbrk>
+     297:	83 c4 10             	add    $0x10,%esp
+     29a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     29d:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     2a1:	75 10                	jne    2b3 <grow+0x38>
+      fail("sbrk");
+     2a3:	83 ec 0c             	sub    $0xc,%esp
+     2a6:	68 32 14 00 00       	push   $0x1432
+     2ab:	e8 50 fd ff ff       	call   0 <fail>
+     2b0:	83 c4 10             	add    $0x10,%esp
+    *p = 1;
+     2b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2b6:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < n; i++){
+     2b9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     2bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2c0:	3b 45 08             	cmp    0x8(%ebp),%eax
+     2c3:	7c c5                	jl     28a <grow+0xf>
+  }
+  sbrk(-n * PGSIZE);
+     2c5:	8b 55 08             	mov    0x8(%ebp),%edx
+     2c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cd:	29 d0                	sub    %edx,%eax
+     2cf:	c1 e0 0c             	shl    $0xc,%eax
+     2d2:	83 ec 0c             	sub    $0xc,%esp
+     2d5:	50                   	push   %eax
+     2d6:	e8 6f 06 00 00       	call   94a <sbrk>
+     2db:	83 c4 10             	add    $0x10,%esp
+}
+     2de:	90                   	nop
+     2df:	c9                   	leave
+     2e0:	c3                   	ret
+
+000002e1 <runbench>:
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+// Run b in nproc processes, started together.
+static void
+runbench(struct bench *b, int nproc)
+{
+     2e1:	55                   	push   %ebp
+     2e2:	89 e5                	mov    %esp,%ebp
+     2e4:	53                   	push   %ebx
+     2e5:	83 ec 24             	sub    $0x24,%esp
+  int i, go[2], t, ops, us;
+  char c;
+
+  if(pipe(go) < 0)
+     2e8:	83 ec 0c             	sub    $0xc,%esp
+     2eb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2ee:	50                   	push   %eax
+     2ef:	e8 d2 05 00 00       	call   8c6 <pipe>
+     2f4:	83 c4 10             	add    $0x10,%esp
+     2f7:	85 c0                	test   %eax,%eax
+     2f9:	79 10                	jns    30b <runbench+0x2a>
+    fail("pipe");
+     2fb:	83 ec 0c             	sub    $0xc,%esp
+     2fe:	68 07 14 00 00       	push   $0x1407
+     303:	e8 f8 fc ff ff       	call   0 <fail>
+     308:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++){
+     30b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     312:	eb 60                	jmp    374 <runbench+0x93>
+    if(fork() == 0){
+     314:	e8 98 05 00 00       	call   8b1 <fork>
+     319:	85 c0                	test   %eax,%eax
+     31b:	75 53                	jne    370 <runbench+0x8f>
+      close(go[1]);
+     31d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     320:	83 ec 0c             	sub    $0xc,%esp
+     323:	50                   	push   %eax
+     324:	e8 b2 05 00 00       	call   8db <close>
+     329:	83 c4 10             	add    $0x10,%esp
+      if(read(go[0], &c, 1) != 1)
+     32c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     32f:	83 ec 04             	sub    $0x4,%esp
+     332:	6a 01                	push   $0x1
+     334:	8d 55 df             	lea    -0x21(%ebp),%edx
+     337:	52                   	push   %edx
+     338:	50                   	push   %eax
+     339:	e8 8f 05 00 00       	call   8cd <read>
+     33e:	83 c4 10             	add    $0x10,%esp
+     341:	83 f8 01             	cmp    $0x1,%eax
+     344:	74 10                	je     356 <runbench+0x75>
+        fail("start");
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	68 42 14 00 00       	push   $0x1442
+     34e:	e8 ad fc ff ff       	call   0 <fail>
+     353:	83 c4 10             	add    $0x10,%esp
+      b->run(b->n);
+     356:	8b 45 08             	mov    0x8(%ebp),%eax
+     359:	8b 40 08             	mov    0x8(%eax),%eax
+     35c:	8b 55 08             	mov    0x8(%ebp),%edx
+     35f:	8b 52 04             	mov    0x4(%edx),%edx
+     362:	83 ec 0c             	sub    $0xc,%esp
+     365:	52                   	push   %edx
+     366:	ff d0                	call   *%eax
+     368:	83 c4 10             	add    $0x10,%esp
+      exit();
+     36b:	e8 48 05 00 00       	call   8b8 <exit>
+  for(i = 0; i < nproc; i++){
+     370:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     374:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     377:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     37a:	7c 98                	jl     314 <runbench+0x33>
+    }
+  }
+  close(go[0]);
+     37c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     37f:	83 ec 0c             	sub    $0xc,%esp
+     382:	50                   	push   %eax
+     383:	e8 53 05 00 00       	call   8db <close>
+     388:	83 c4 10             	add    $0x10,%esp
+  t = uptime();
+     38b:	e8 ce 05 00 00       	call   95e <uptime>
+     390:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < nproc; i++)
+     393:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     39a:	eb 1a                	jmp    3b6 <runbench+0xd5>
+    write(go[1], "g", 1);
+     39c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     39f:	83 ec 04             	sub    $0x4,%esp
+     3a2:	6a 01                	push   $0x1
+     3a4:	68 48 14 00 00       	push   $0x1448
+     3a9:	50                   	push   %eax
+     3aa:	e8 25 05 00 00       	call   8d4 <write>
+     3af:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+     3b2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3b9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     3bc:	7c de                	jl     39c <runbench+0xbb>
+  for(i = 0; i < nproc; i++)
+     3be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3c5:	eb 09                	jmp    3d0 <runbench+0xef>
+    wait();
+     3c7:	e8 f3 04 00 00       	call   8bf <wait>
+  for(i = 0; i < nproc; i++)
+     3cc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3d3:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     3d6:	7c ef                	jl     3c7 <runbench+0xe6>
+  t = uptime() - t;
+     3d8:	e8 81 05 00 00       	call   95e <uptime>
+     3dd:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     3e0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(go[1]);
+     3e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     3e6:	83 ec 0c             	sub    $0xc,%esp
+     3e9:	50                   	push   %eax
+     3ea:	e8 ec 04 00 00       	call   8db <close>
+     3ef:	83 c4 10             	add    $0x10,%esp
+
+  ops = nproc * b->n;
+     3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f5:	8b 40 04             	mov    0x4(%eax),%eax
+     3f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3fb:	0f af c2             	imul   %edx,%eax
+     3fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  printf(1, "%s %d %d %d", b->name, nproc, ops, t);
+     401:	8b 45 08             	mov    0x8(%ebp),%eax
+     404:	8b 00                	mov    (%eax),%eax
+     406:	83 ec 08             	sub    $0x8,%esp
+     409:	ff 75 f0             	push   -0x10(%ebp)
+     40c:	ff 75 ec             	push   -0x14(%ebp)
+     40f:	ff 75 0c             	push   0xc(%ebp)
+     412:	50                   	push   %eax
+     413:	68 4a 14 00 00       	push   $0x144a
+     418:	6a 01                	push   $0x1
+     41a:	e8 29 09 00 00       	call   d48 <printf>
+     41f:	83 c4 20             	add    $0x20,%esp
+  if(t == 0)
+     422:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     426:	75 07                	jne    42f <runbench+0x14e>
+    t = 1;
+     428:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  us = t * (1000000 / HZ);
+     42f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     432:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+     438:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  printf(1, " %d %d\n", ops * HZ / t,
+         us / b->n * 1000 + us % b->n * 1000 / b->n);
+     43b:	8b 45 08             	mov    0x8(%ebp),%eax
+     43e:	8b 58 04             	mov    0x4(%eax),%ebx
+     441:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     444:	99                   	cltd
+     445:	f7 fb                	idiv   %ebx
+     447:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+     450:	8b 58 04             	mov    0x4(%eax),%ebx
+     453:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     456:	99                   	cltd
+     457:	f7 fb                	idiv   %ebx
+     459:	89 d0                	mov    %edx,%eax
+     45b:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+     461:	8b 55 08             	mov    0x8(%ebp),%edx
+     464:	8b 5a 04             	mov    0x4(%edx),%ebx
+     467:	99                   	cltd
+     468:	f7 fb                	idiv   %ebx
+  printf(1, " %d %d\n", ops * HZ / t,
+     46a:	01 c1                	add    %eax,%ecx
+     46c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     46f:	6b c0 64             	imul   $0x64,%eax,%eax
+     472:	99                   	cltd
+     473:	f7 7d f0             	idivl  -0x10(%ebp)
+     476:	51                   	push   %ecx
+     477:	50                   	push   %eax
+     478:	68 56 14 00 00       	push   $0x1456
+     47d:	6a 01                	push   $0x1
+     47f:	e8 c4 08 00 00       	call   d48 <printf>
+     484:	83 c4 10             	add    $0x10,%esp
+}
+     487:	90                   	nop
+     488:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     48b:	c9                   	leave
+     48c:	c3                   	ret
+
+0000048d <main>:
+
+int
+main(int argc, char *argv[])
+{
+     48d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     491:	83 e4 f0             	and    $0xfffffff0,%esp
+     494:	ff 71 fc             	push   -0x4(%ecx)
+     497:	55                   	push   %ebp
+     498:	89 e5                	mov    %esp,%ebp
+     49a:	53                   	push   %ebx
+     49b:	51                   	push   %ecx
+     49c:	83 ec 10             	sub    $0x10,%esp
+     49f:	89 cb                	mov    %ecx,%ebx
+  int i, j, k, maxcpu;
+
+  if(argc == 2 && strcmp(argv[1], "-x") == 0)
+     4a1:	83 3b 02             	cmpl   $0x2,(%ebx)
+     4a4:	75 22                	jne    4c8 <main+0x3b>
+     4a6:	8b 43 04             	mov    0x4(%ebx),%eax
+     4a9:	83 c0 04             	add    $0x4,%eax
+     4ac:	8b 00                	mov    (%eax),%eax
+     4ae:	83 ec 08             	sub    $0x8,%esp
+     4b1:	68 ff 13 00 00       	push   $0x13ff
+     4b6:	50                   	push   %eax
+     4b7:	e8 bb 01 00 00       	call   677 <strcmp>
+     4bc:	83 c4 10             	add    $0x10,%esp
+     4bf:	85 c0                	test   %eax,%eax
+     4c1:	75 05                	jne    4c8 <main+0x3b>
+    exit();  // forkexec's child
+     4c3:	e8 f0 03 00 00       	call   8b8 <exit>
+  self = argv[0];
+     4c8:	8b 43 04             	mov    0x4(%ebx),%eax
+     4cb:	8b 00                	mov    (%eax),%eax
+     4cd:	a3 c0 19 00 00       	mov    %eax,0x19c0
+  maxcpu = ncpu();
+     4d2:	e8 b3 05 00 00       	call   a8a <ncpu>
+     4d7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  i = 1;
+     4da:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  if(argc > 2 && strcmp(argv[1], "-c") == 0){
+     4e1:	83 3b 02             	cmpl   $0x2,(%ebx)
+     4e4:	7e 3b                	jle    521 <main+0x94>
+     4e6:	8b 43 04             	mov    0x4(%ebx),%eax
+     4e9:	83 c0 04             	add    $0x4,%eax
+     4ec:	8b 00                	mov    (%eax),%eax
+     4ee:	83 ec 08             	sub    $0x8,%esp
+     4f1:	68 5e 14 00 00       	push   $0x145e
+     4f6:	50                   	push   %eax
+     4f7:	e8 7b 01 00 00       	call   677 <strcmp>
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	85 c0                	test   %eax,%eax
+     501:	75 1e                	jne    521 <main+0x94>
+    maxcpu = atoi(argv[2]);
+     503:	8b 43 04             	mov    0x4(%ebx),%eax
+     506:	83 c0 08             	add    $0x8,%eax
+     509:	8b 00                	mov    (%eax),%eax
+     50b:	83 ec 0c             	sub    $0xc,%esp
+     50e:	50                   	push   %eax
+     50f:	e8 d2 02 00 00       	call   7e6 <atoi>
+     514:	83 c4 10             	add    $0x10,%esp
+     517:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    i = 3;
+     51a:	c7 45 f4 03 00 00 00 	movl   $0x3,-0xc(%ebp)
+  }
+  if(maxcpu < 1 || (i < argc && argv[i][0] == '-')){
+     521:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     525:	7e 1f                	jle    546 <main+0xb9>
+     527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     52a:	3b 03                	cmp    (%ebx),%eax
+     52c:	7d 2f                	jge    55d <main+0xd0>
+     52e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     531:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     538:	8b 43 04             	mov    0x4(%ebx),%eax
+     53b:	01 d0                	add    %edx,%eax
+     53d:	8b 00                	mov    (%eax),%eax
+     53f:	0f b6 00             	movzbl (%eax),%eax
+     542:	3c 2d                	cmp    $0x2d,%al
+     544:	75 17                	jne    55d <main+0xd0>
+    printf(2, "usage: procbench [-c maxcpu] [bench ...]\n");
+     546:	83 ec 08             	sub    $0x8,%esp
+     549:	68 64 14 00 00       	push   $0x1464
+     54e:	6a 02                	push   $0x2
+     550:	e8 f3 07 00 00       	call   d48 <printf>
+     555:	83 c4 10             	add    $0x10,%esp
+    exit();
+     558:	e8 5b 03 00 00       	call   8b8 <exit>
+  }
+
+  printf(1, "# bench nproc ops ticks ops/s ns/op\n");
+     55d:	83 ec 08             	sub    $0x8,%esp
+     560:	68 90 14 00 00       	push   $0x1490
+     565:	6a 01                	push   $0x1
+     567:	e8 dc 07 00 00       	call   d48 <printf>
+     56c:	83 c4 10             	add    $0x10,%esp
+  for(j = 0; j < NBENCH; j++){
+     56f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     576:	e9 95 00 00 00       	jmp    610 <main+0x183>
+    for(k = i; k < argc; k++)
+     57b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     57e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     581:	eb 39                	jmp    5bc <main+0x12f>
+      if(strcmp(argv[k], benches[j].name) == 0)
+     583:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     586:	89 d0                	mov    %edx,%eax
+     588:	01 c0                	add    %eax,%eax
+     58a:	01 d0                	add    %edx,%eax
+     58c:	c1 e0 02             	shl    $0x2,%eax
+     58f:	05 60 19 00 00       	add    $0x1960,%eax
+     594:	8b 10                	mov    (%eax),%edx
+     596:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     599:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+     5a0:	8b 43 04             	mov    0x4(%ebx),%eax
+     5a3:	01 c8                	add    %ecx,%eax
+     5a5:	8b 00                	mov    (%eax),%eax
+     5a7:	83 ec 08             	sub    $0x8,%esp
+     5aa:	52                   	push   %edx
+     5ab:	50                   	push   %eax
+     5ac:	e8 c6 00 00 00       	call   677 <strcmp>
+     5b1:	83 c4 10             	add    $0x10,%esp
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	74 0d                	je     5c5 <main+0x138>
+    for(k = i; k < argc; k++)
+     5b8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     5bc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     5bf:	3b 03                	cmp    (%ebx),%eax
+     5c1:	7c c0                	jl     583 <main+0xf6>
+     5c3:	eb 01                	jmp    5c6 <main+0x139>
+        break;
+     5c5:	90                   	nop
+    if(i < argc && k == argc)
+     5c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5c9:	3b 03                	cmp    (%ebx),%eax
+     5cb:	7d 07                	jge    5d4 <main+0x147>
+     5cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     5d0:	3b 03                	cmp    (%ebx),%eax
+     5d2:	74 37                	je     60b <main+0x17e>
+      continue;
+    for(k = 1; k <= maxcpu; k++)
+     5d4:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+     5db:	eb 24                	jmp    601 <main+0x174>
+      runbench(&benches[j], k);
+     5dd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     5e0:	89 d0                	mov    %edx,%eax
+     5e2:	01 c0                	add    %eax,%eax
+     5e4:	01 d0                	add    %edx,%eax
+     5e6:	c1 e0 02             	shl    $0x2,%eax
+     5e9:	05 60 19 00 00       	add    $0x1960,%eax
+     5ee:	83 ec 08             	sub    $0x8,%esp
+     5f1:	ff 75 ec             	push   -0x14(%ebp)
+     5f4:	50                   	push   %eax
+     5f5:	e8 e7 fc ff ff       	call   2e1 <runbench>
+     5fa:	83 c4 10             	add    $0x10,%esp
+    for(k = 1; k <= maxcpu; k++)
+     5fd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     601:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     604:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     607:	7e d4                	jle    5dd <main+0x150>
+     609:	eb 01                	jmp    60c <main+0x17f>
+      continue;
+     60b:	90                   	nop
+  for(j = 0; j < NBENCH; j++){
+     60c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     610:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     613:	83 f8 05             	cmp    $0x5,%eax
+     616:	0f 86 5f ff ff ff    	jbe    57b <main+0xee>
+  }
+  exit();
+     61c:	e8 97 02 00 00       	call   8b8 <exit>
+
+00000621 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     621:	55                   	push   %ebp
+     622:	89 e5                	mov    %esp,%ebp
+     624:	57                   	push   %edi
+     625:	53                   	push   %ebx
+    if(cc < 1)
+     626:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     629:	8b 55 10             	mov    0x10(%ebp),%edx
+     62c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     62f:	89 cb                	mov    %ecx,%ebx
+     631:	89 df                	mov    %ebx,%edi
+     633:	89 d1                	mov    %edx,%ecx
+     635:	fc                   	cld
+     636:	f3 aa                	rep stos %al,%es:(%edi)
+     638:	89 ca                	mov    %ecx,%edx
+     63a:	89 fb                	mov    %edi,%ebx
+     63c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     63f:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     642:	90                   	nop
+     643:	5b                   	pop    %ebx
+     644:	5f                   	pop    %edi
+     645:	5d                   	pop    %ebp
+     646:	c3                   	ret
+
+00000647 <strcpy>:
+{
+     647:	55                   	push   %ebp
+     648:	89 e5                	mov    %esp,%ebp
+     64a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     64d:	8b 45 08             	mov    0x8(%ebp),%eax
+     650:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     653:	90                   	nop
+     654:	8b 55 0c             	mov    0xc(%ebp),%edx
+     657:	8d 42 01             	lea    0x1(%edx),%eax
+     65a:	89 45 0c             	mov    %eax,0xc(%ebp)
+     65d:	8b 45 08             	mov    0x8(%ebp),%eax
+     660:	8d 48 01             	lea    0x1(%eax),%ecx
+     663:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     666:	0f b6 12             	movzbl (%edx),%edx
+     669:	88 10                	mov    %dl,(%eax)
+     66b:	0f b6 00             	movzbl (%eax),%eax
+     66e:	84 c0                	test   %al,%al
+     670:	75 e2                	jne    654 <strcpy+0xd>
+  return os;
+     672:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     675:	c9                   	leave
+     676:	c3                   	ret
+
+00000677 <strcmp>:
+{
+     677:	55                   	push   %ebp
+     678:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     67a:	eb 08                	jmp    684 <strcmp+0xd>
+    p++, q++;
+     67c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     680:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     684:	8b 45 08             	mov    0x8(%ebp),%eax
+     687:	0f b6 00             	movzbl (%eax),%eax
+     68a:	84 c0                	test   %al,%al
+     68c:	74 10                	je     69e <strcmp+0x27>
+     68e:	8b 45 08             	mov    0x8(%ebp),%eax
+     691:	0f b6 10             	movzbl (%eax),%edx
+     694:	8b 45 0c             	mov    0xc(%ebp),%eax
+     697:	0f b6 00             	movzbl (%eax),%eax
+     69a:	38 c2                	cmp    %al,%dl
+     69c:	74 de                	je     67c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     69e:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a1:	0f b6 00             	movzbl (%eax),%eax
+     6a4:	0f b6 d0             	movzbl %al,%edx
+     6a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6aa:	0f b6 00             	movzbl (%eax),%eax
+     6ad:	0f b6 c0             	movzbl %al,%eax
+     6b0:	29 c2                	sub    %eax,%edx
+     6b2:	89 d0                	mov    %edx,%eax
+}
+     6b4:	5d                   	pop    %ebp
+     6b5:	c3                   	ret
+
+000006b6 <strlen>:
+{
+     6b6:	55                   	push   %ebp
+     6b7:	89 e5                	mov    %esp,%ebp
+     6b9:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     6bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     6c3:	eb 04                	jmp    6c9 <strlen+0x13>
+     6c5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     6c9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     6cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     6cf:	01 d0                	add    %edx,%eax
+     6d1:	0f b6 00             	movzbl (%eax),%eax
+     6d4:	84 c0                	test   %al,%al
+     6d6:	75 ed                	jne    6c5 <strlen+0xf>
+  return n;
+     6d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     6db:	c9                   	leave
+     6dc:	c3                   	ret
+
+000006dd <memset>:
+{
+     6dd:	55                   	push   %ebp
+     6de:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     6e0:	8b 45 10             	mov    0x10(%ebp),%eax
+     6e3:	50                   	push   %eax
+     6e4:	ff 75 0c             	push   0xc(%ebp)
+     6e7:	ff 75 08             	push   0x8(%ebp)
+     6ea:	e8 32 ff ff ff       	call   621 <stosb>
+     6ef:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6f5:	c9                   	leave
+     6f6:	c3                   	ret
+
+000006f7 <strchr>:
+{
+     6f7:	55                   	push   %ebp
+     6f8:	89 e5                	mov    %esp,%ebp
+     6fa:	83 ec 04             	sub    $0x4,%esp
+     6fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     700:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     703:	eb 14                	jmp    719 <strchr+0x22>
+    if(*s == c)
+     705:	8b 45 08             	mov    0x8(%ebp),%eax
+     708:	0f b6 00             	movzbl (%eax),%eax
+     70b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     70e:	75 05                	jne    715 <strchr+0x1e>
+      return (char*)s;
+     710:	8b 45 08             	mov    0x8(%ebp),%eax
+     713:	eb 13                	jmp    728 <strchr+0x31>
+  for(; *s; s++)
+     715:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     719:	8b 45 08             	mov    0x8(%ebp),%eax
+     71c:	0f b6 00             	movzbl (%eax),%eax
+     71f:	84 c0                	test   %al,%al
+     721:	75 e2                	jne    705 <strchr+0xe>
+  return 0;
+     723:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     728:	c9                   	leave
+     729:	c3                   	ret
+
+0000072a <gets>:
+{
+     72a:	55                   	push   %ebp
+     72b:	89 e5                	mov    %esp,%ebp
+     72d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     730:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     737:	eb 42                	jmp    77b <gets+0x51>
+    cc = read(0, &c, 1);
+     739:	83 ec 04             	sub    $0x4,%esp
+     73c:	6a 01                	push   $0x1
+     73e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     741:	50                   	push   %eax
+     742:	6a 00                	push   $0x0
+     744:	e8 84 01 00 00       	call   8cd <read>
+     749:	83 c4 10             	add    $0x10,%esp
+     74c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     74f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     753:	7e 33                	jle    788 <gets+0x5e>
+    buf[i++] = c;
+     755:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     758:	8d 50 01             	lea    0x1(%eax),%edx
+     75b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     75e:	89 c2                	mov    %eax,%edx
+     760:	8b 45 08             	mov    0x8(%ebp),%eax
+     763:	01 c2                	add    %eax,%edx
+     765:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     769:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     76b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     76f:	3c 0a                	cmp    $0xa,%al
+     771:	74 16                	je     789 <gets+0x5f>
+     773:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     777:	3c 0d                	cmp    $0xd,%al
+     779:	74 0e                	je     789 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     77b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     77e:	83 c0 01             	add    $0x1,%eax
+     781:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     784:	7f b3                	jg     739 <gets+0xf>
+     786:	eb 01                	jmp    789 <gets+0x5f>
+      break;
+     788:	90                   	nop
+  }
+  buf[i] = '\0';
+     789:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     78c:	8b 45 08             	mov    0x8(%ebp),%eax
+     78f:	01 d0                	add    %edx,%eax
+     791:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     794:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     797:	c9                   	leave
+     798:	c3                   	ret
+
+00000799 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     799:	55                   	push   %ebp
+     79a:	89 e5                	mov    %esp,%ebp
+     79c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     79f:	83 ec 08             	sub    $0x8,%esp
+     7a2:	6a 00                	push   $0x0
+     7a4:	ff 75 08             	push   0x8(%ebp)
+     7a7:	e8 44 01 00 00       	call   8f0 <open>
+     7ac:	83 c4 10             	add    $0x10,%esp
+     7af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     7b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     7b6:	79 07                	jns    7bf <stat+0x26>
+    return -1;
+     7b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7bd:	eb 25                	jmp    7e4 <stat+0x4b>
+  r = fstat(fd, st);
+     7bf:	83 ec 08             	sub    $0x8,%esp
+     7c2:	ff 75 0c             	push   0xc(%ebp)
+     7c5:	ff 75 f4             	push   -0xc(%ebp)
+     7c8:	e8 41 01 00 00       	call   90e <fstat>
+     7cd:	83 c4 10             	add    $0x10,%esp
+     7d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     7d3:	83 ec 0c             	sub    $0xc,%esp
+     7d6:	ff 75 f4             	push   -0xc(%ebp)
+     7d9:	e8 fd 00 00 00       	call   8db <close>
+     7de:	83 c4 10             	add    $0x10,%esp
+  return r;
+     7e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     7e4:	c9                   	leave
+     7e5:	c3                   	ret
+
+000007e6 <atoi>:
+
+int
+atoi(const char *s)
+{
+     7e6:	55                   	push   %ebp
+     7e7:	89 e5                	mov    %esp,%ebp
+     7e9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     7ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     7f3:	eb 25                	jmp    81a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     7f5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     7f8:	89 d0                	mov    %edx,%eax
+     7fa:	c1 e0 02             	shl    $0x2,%eax
+     7fd:	01 d0                	add    %edx,%eax
+     7ff:	01 c0                	add    %eax,%eax
+     801:	89 c1                	mov    %eax,%ecx
+     803:	8b 45 08             	mov    0x8(%ebp),%eax
+     806:	8d 50 01             	lea    0x1(%eax),%edx
+     809:	89 55 08             	mov    %edx,0x8(%ebp)
+     80c:	0f b6 00             	movzbl (%eax),%eax
+     80f:	0f be c0             	movsbl %al,%eax
+     812:	01 c8                	add    %ecx,%eax
+     814:	83 e8 30             	sub    $0x30,%eax
+     817:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     81a:	8b 45 08             	mov    0x8(%ebp),%eax
+     81d:	0f b6 00             	movzbl (%eax),%eax
+     820:	3c 2f                	cmp    $0x2f,%al
+     822:	7e 0a                	jle    82e <atoi+0x48>
+     824:	8b 45 08             	mov    0x8(%ebp),%eax
+     827:	0f b6 00             	movzbl (%eax),%eax
+     82a:	3c 39                	cmp    $0x39,%al
+     82c:	7e c7                	jle    7f5 <atoi+0xf>
+  return n;
+     82e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     831:	c9                   	leave
+     832:	c3                   	ret
+
+00000833 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     833:	55                   	push   %ebp
+     834:	89 e5                	mov    %esp,%ebp
+     836:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     839:	8b 45 08             	mov    0x8(%ebp),%eax
+     83c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     83f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     842:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     845:	eb 17                	jmp    85e <memmove+0x2b>
+    *dst++ = *src++;
+     847:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     84a:	8d 42 01             	lea    0x1(%edx),%eax
+     84d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     850:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     853:	8d 48 01             	lea    0x1(%eax),%ecx
+     856:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     859:	0f b6 12             	movzbl (%edx),%edx
+     85c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     85e:	8b 45 10             	mov    0x10(%ebp),%eax
+     861:	8d 50 ff             	lea    -0x1(%eax),%edx
+     864:	89 55 10             	mov    %edx,0x10(%ebp)
+     867:	85 c0                	test   %eax,%eax
+     869:	7f dc                	jg     847 <memmove+0x14>
+  return vdst;
+     86b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     86e:	c9                   	leave
+     86f:	c3                   	ret
+
+00000870 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     870:	83 3d a8 19 00 00 00 	cmpl   $0x0,0x19a8
+  jg 2f
+     877:	7f 2e                	jg     8a7 <dosyscall+0x37>
+  jl 1f
+     879:	7c 29                	jl     8a4 <dosyscall+0x34>
+  pushl %eax
+     87b:	50                   	push   %eax
+  pushl %ebx
+     87c:	53                   	push   %ebx
+  movl $1, %eax
+     87d:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     882:	0f a2                	cpuid
+  popl %ebx
+     884:	5b                   	pop    %ebx
+  popl %eax
+     885:	58                   	pop    %eax
+  movl $-1, sysmode
+     886:	c7 05 a8 19 00 00 ff 	movl   $0xffffffff,0x19a8
+     88d:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     890:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     896:	74 0c                	je     8a4 <dosyscall+0x34>
+  movl $1, sysmode
+     898:	c7 05 a8 19 00 00 01 	movl   $0x1,0x19a8
+     89f:	00 00 00 
+  jmp 2f
+     8a2:	eb 03                	jmp    8a7 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     8a4:	cd 40                	int    $0x40
+  ret
+     8a6:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     8a7:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     8a9:	ba b0 08 00 00       	mov    $0x8b0,%edx
+  sysenter
+     8ae:	0f 34                	sysenter
+3:
+  ret
+     8b0:	c3                   	ret
+
+000008b1 <fork>:
+
+SYSCALL(fork)
+     8b1:	b8 01 00 00 00       	mov    $0x1,%eax
+     8b6:	eb b8                	jmp    870 <dosyscall>
+
+000008b8 <exit>:
+SYSCALL(exit)
+     8b8:	b8 02 00 00 00       	mov    $0x2,%eax
+     8bd:	eb b1                	jmp    870 <dosyscall>
+
+000008bf <wait>:
+SYSCALL(wait)
+     8bf:	b8 03 00 00 00       	mov    $0x3,%eax
+     8c4:	eb aa                	jmp    870 <dosyscall>
+
+000008c6 <pipe>:
+SYSCALL(pipe)
+     8c6:	b8 04 00 00 00       	mov    $0x4,%eax
+     8cb:	eb a3                	jmp    870 <dosyscall>
+
+000008cd <read>:
+SYSCALL(read)
+     8cd:	b8 05 00 00 00       	mov    $0x5,%eax
+     8d2:	eb 9c                	jmp    870 <dosyscall>
+
+000008d4 <write>:
+SYSCALL(write)
+     8d4:	b8 10 00 00 00       	mov    $0x10,%eax
+     8d9:	eb 95                	jmp    870 <dosyscall>
+
+000008db <close>:
+SYSCALL(close)
+     8db:	b8 15 00 00 00       	mov    $0x15,%eax
+     8e0:	eb 8e                	jmp    870 <dosyscall>
+
+000008e2 <kill>:
+SYSCALL(kill)
+     8e2:	b8 06 00 00 00       	mov    $0x6,%eax
+     8e7:	eb 87                	jmp    870 <dosyscall>
+
+000008e9 <exec>:
+SYSCALL(exec)
+     8e9:	b8 07 00 00 00       	mov    $0x7,%eax
+     8ee:	eb 80                	jmp    870 <dosyscall>
+
+000008f0 <open>:
+SYSCALL(open)
+     8f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8f5:	e9 76 ff ff ff       	jmp    870 <dosyscall>
+
+000008fa <mknod>:
+SYSCALL(mknod)
+     8fa:	b8 11 00 00 00       	mov    $0x11,%eax
+     8ff:	e9 6c ff ff ff       	jmp    870 <dosyscall>
+
+00000904 <unlink>:
+SYSCALL(unlink)
+     904:	b8 12 00 00 00       	mov    $0x12,%eax
+     909:	e9 62 ff ff ff       	jmp    870 <dosyscall>
+
+0000090e <fstat>:
+SYSCALL(fstat)
+     90e:	b8 08 00 00 00       	mov    $0x8,%eax
+     913:	e9 58 ff ff ff       	jmp    870 <dosyscall>
+
+00000918 <link>:
+SYSCALL(link)
+     918:	b8 13 00 00 00       	mov    $0x13,%eax
+     91d:	e9 4e ff ff ff       	jmp    870 <dosyscall>
+
+00000922 <mkdir>:
+SYSCALL(mkdir)
+     922:	b8 14 00 00 00       	mov    $0x14,%eax
+     927:	e9 44 ff ff ff       	jmp    870 <dosyscall>
+
+0000092c <chdir>:
+SYSCALL(chdir)
+     92c:	b8 09 00 00 00       	mov    $0x9,%eax
+     931:	e9 3a ff ff ff       	jmp    870 <dosyscall>
+
+00000936 <dup>:
+SYSCALL(dup)
+     936:	b8 0a 00 00 00       	mov    $0xa,%eax
+     93b:	e9 30 ff ff ff       	jmp    870 <dosyscall>
+
+00000940 <getpid>:
+SYSCALL(getpid)
+     940:	b8 0b 00 00 00       	mov    $0xb,%eax
+     945:	e9 26 ff ff ff       	jmp    870 <dosyscall>
+
+0000094a <sbrk>:
+SYSCALL(sbrk)
+     94a:	b8 0c 00 00 00       	mov    $0xc,%eax
+     94f:	e9 1c ff ff ff       	jmp    870 <dosyscall>
+
+00000954 <sleep>:
+SYSCALL(sleep)
+     954:	b8 0d 00 00 00       	mov    $0xd,%eax
+     959:	e9 12 ff ff ff       	jmp    870 <dosyscall>
+
+0000095e <uptime>:
+SYSCALL(uptime)
+     95e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     963:	e9 08 ff ff ff       	jmp    870 <dosyscall>
+
+00000968 <symlink>:
+SYSCALL(symlink)
+     968:	b8 16 00 00 00       	mov    $0x16,%eax
+     96d:	e9 fe fe ff ff       	jmp    870 <dosyscall>
+
+00000972 <readlink>:
+SYSCALL(readlink)
+     972:	b8 17 00 00 00       	mov    $0x17,%eax
+     977:	e9 f4 fe ff ff       	jmp    870 <dosyscall>
+
+0000097c <fprot>:
+SYSCALL(fprot)
+     97c:	b8 18 00 00 00       	mov    $0x18,%eax
+     981:	e9 ea fe ff ff       	jmp    870 <dosyscall>
+
+00000986 <funprot>:
+SYSCALL(funprot)
+     986:	b8 19 00 00 00       	mov    $0x19,%eax
+     98b:	e9 e0 fe ff ff       	jmp    870 <dosyscall>
+
+00000990 <funlock>:
+SYSCALL(funlock)
+     990:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     995:	e9 d6 fe ff ff       	jmp    870 <dosyscall>
+
+0000099a <mmap>:
+SYSCALL(mmap)
+     99a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     99f:	e9 cc fe ff ff       	jmp    870 <dosyscall>
+
+000009a4 <munmap>:
+SYSCALL(munmap)
+     9a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9a9:	e9 c2 fe ff ff       	jmp    870 <dosyscall>
+
+000009ae <sendfile>:
+SYSCALL(sendfile)
+     9ae:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9b3:	e9 b8 fe ff ff       	jmp    870 <dosyscall>
+
+000009b8 <readv>:
+SYSCALL(readv)
+     9b8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9bd:	e9 ae fe ff ff       	jmp    870 <dosyscall>
+
+000009c2 <writev>:
+SYSCALL(writev)
+     9c2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9c7:	e9 a4 fe ff ff       	jmp    870 <dosyscall>
+
+000009cc <pread>:
+SYSCALL(pread)
+     9cc:	b8 20 00 00 00       	mov    $0x20,%eax
+     9d1:	e9 9a fe ff ff       	jmp    870 <dosyscall>
+
+000009d6 <pwrite>:
+SYSCALL(pwrite)
+     9d6:	b8 21 00 00 00       	mov    $0x21,%eax
+     9db:	e9 90 fe ff ff       	jmp    870 <dosyscall>
+
+000009e0 <lseek>:
+SYSCALL(lseek)
+     9e0:	b8 22 00 00 00       	mov    $0x22,%eax
+     9e5:	e9 86 fe ff ff       	jmp    870 <dosyscall>
+
+000009ea <spawn>:
+SYSCALL(spawn)
+     9ea:	b8 23 00 00 00       	mov    $0x23,%eax
+     9ef:	e9 7c fe ff ff       	jmp    870 <dosyscall>
+
+000009f4 <setpriority>:
+SYSCALL(setpriority)
+     9f4:	b8 24 00 00 00       	mov    $0x24,%eax
+     9f9:	e9 72 fe ff ff       	jmp    870 <dosyscall>
+
+000009fe <kthread_create>:
+SYSCALL(kthread_create)
+     9fe:	b8 25 00 00 00       	mov    $0x25,%eax
+     a03:	e9 68 fe ff ff       	jmp    870 <dosyscall>
+
+00000a08 <kthread_id>:
+SYSCALL(kthread_id)
+     a08:	b8 26 00 00 00       	mov    $0x26,%eax
+     a0d:	e9 5e fe ff ff       	jmp    870 <dosyscall>
+
+00000a12 <kthread_exit>:
+SYSCALL(kthread_exit)
+     a12:	b8 27 00 00 00       	mov    $0x27,%eax
+     a17:	e9 54 fe ff ff       	jmp    870 <dosyscall>
+
+00000a1c <kthread_join>:
+SYSCALL(kthread_join)
+     a1c:	b8 28 00 00 00       	mov    $0x28,%eax
+     a21:	e9 4a fe ff ff       	jmp    870 <dosyscall>
+
+00000a26 <futex>:
+SYSCALL(futex)
+     a26:	b8 29 00 00 00       	mov    $0x29,%eax
+     a2b:	e9 40 fe ff ff       	jmp    870 <dosyscall>
+
+00000a30 <signal>:
+SYSCALL(signal)
+     a30:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a35:	e9 36 fe ff ff       	jmp    870 <dosyscall>
+
+00000a3a <alarm>:
+SYSCALL(alarm)
+     a3a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a3f:	e9 2c fe ff ff       	jmp    870 <dosyscall>
+
+00000a44 <usleep>:
+SYSCALL(usleep)
+     a44:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a49:	e9 22 fe ff ff       	jmp    870 <dosyscall>
+
+00000a4e <ioring_setup>:
+SYSCALL(ioring_setup)
+     a4e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a53:	e9 18 fe ff ff       	jmp    870 <dosyscall>
+
+00000a58 <ioring_enter>:
+SYSCALL(ioring_enter)
+     a58:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a5d:	e9 0e fe ff ff       	jmp    870 <dosyscall>
+
+00000a62 <getrusage>:
+SYSCALL(getrusage)
+     a62:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a67:	e9 04 fe ff ff       	jmp    870 <dosyscall>
+
+00000a6c <mount>:
+SYSCALL(mount)
+     a6c:	b8 30 00 00 00       	mov    $0x30,%eax
+     a71:	e9 fa fd ff ff       	jmp    870 <dosyscall>
+
+00000a76 <getdents>:
+SYSCALL(getdents)
+     a76:	b8 31 00 00 00       	mov    $0x31,%eax
+     a7b:	e9 f0 fd ff ff       	jmp    870 <dosyscall>
+
+00000a80 <yield>:
+SYSCALL(yield)
+     a80:	b8 32 00 00 00       	mov    $0x32,%eax
+     a85:	e9 e6 fd ff ff       	jmp    870 <dosyscall>
+
+00000a8a <ncpu>:
+SYSCALL(ncpu)
+     a8a:	b8 33 00 00 00       	mov    $0x33,%eax
+     a8f:	e9 dc fd ff ff       	jmp    870 <dosyscall>
+
+00000a94 <fallocate>:
+SYSCALL(fallocate)
+     a94:	b8 34 00 00 00       	mov    $0x34,%eax
+     a99:	e9 d2 fd ff ff       	jmp    870 <dosyscall>
+
+00000a9e <ftruncate>:
+SYSCALL(ftruncate)
+     a9e:	b8 35 00 00 00       	mov    $0x35,%eax
+     aa3:	e9 c8 fd ff ff       	jmp    870 <dosyscall>
+
+00000aa8 <fsync>:
+SYSCALL(fsync)
+     aa8:	b8 36 00 00 00       	mov    $0x36,%eax
+     aad:	e9 be fd ff ff       	jmp    870 <dosyscall>
+
+00000ab2 <fdatasync>:
+SYSCALL(fdatasync)
+     ab2:	b8 37 00 00 00       	mov    $0x37,%eax
+     ab7:	e9 b4 fd ff ff       	jmp    870 <dosyscall>
+
+00000abc <poll>:
+SYSCALL(poll)
+     abc:	b8 38 00 00 00       	mov    $0x38,%eax
+     ac1:	e9 aa fd ff ff       	jmp    870 <dosyscall>
+
+00000ac6 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     ac6:	55                   	push   %ebp
+     ac7:	89 e5                	mov    %esp,%ebp
+     ac9:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     acc:	8b 45 08             	mov    0x8(%ebp),%eax
+     acf:	8b 40 04             	mov    0x4(%eax),%eax
+     ad2:	85 c0                	test   %eax,%eax
+     ad4:	7e 1f                	jle    af5 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad9:	8b 50 04             	mov    0x4(%eax),%edx
+     adc:	8b 45 08             	mov    0x8(%ebp),%eax
+     adf:	8d 48 08             	lea    0x8(%eax),%ecx
+     ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae5:	8b 00                	mov    (%eax),%eax
+     ae7:	83 ec 04             	sub    $0x4,%esp
+     aea:	52                   	push   %edx
+     aeb:	51                   	push   %ecx
+     aec:	50                   	push   %eax
+     aed:	e8 d0 fe ff ff       	call   9c2 <writev>
+     af2:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     af5:	8b 45 08             	mov    0x8(%ebp),%eax
+     af8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     aff:	8b 45 08             	mov    0x8(%ebp),%eax
+     b02:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     b09:	00 00 00 
+}
+     b0c:	90                   	nop
+     b0d:	c9                   	leave
+     b0e:	c3                   	ret
+
+00000b0f <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     b0f:	55                   	push   %ebp
+     b10:	89 e5                	mov    %esp,%ebp
+     b12:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     b15:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     b19:	0f 84 94 00 00 00    	je     bb3 <put+0xa4>
+    return;
+  if(o->n > 0){
+     b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b22:	8b 40 04             	mov    0x4(%eax),%eax
+     b25:	85 c0                	test   %eax,%eax
+     b27:	7e 40                	jle    b69 <put+0x5a>
+    v = &o->iov[o->n-1];
+     b29:	8b 45 08             	mov    0x8(%ebp),%eax
+     b2c:	8b 40 04             	mov    0x4(%eax),%eax
+     b2f:	83 e8 01             	sub    $0x1,%eax
+     b32:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     b39:	8b 45 08             	mov    0x8(%ebp),%eax
+     b3c:	01 d0                	add    %edx,%eax
+     b3e:	83 c0 08             	add    $0x8,%eax
+     b41:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b47:	8b 10                	mov    (%eax),%edx
+     b49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b4c:	8b 40 04             	mov    0x4(%eax),%eax
+     b4f:	01 d0                	add    %edx,%eax
+     b51:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     b54:	75 13                	jne    b69 <put+0x5a>
+      v->iov_len += n;
+     b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b59:	8b 50 04             	mov    0x4(%eax),%edx
+     b5c:	8b 45 10             	mov    0x10(%ebp),%eax
+     b5f:	01 c2                	add    %eax,%edx
+     b61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b64:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     b67:	eb 4b                	jmp    bb4 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     b69:	8b 45 08             	mov    0x8(%ebp),%eax
+     b6c:	8b 40 04             	mov    0x4(%eax),%eax
+     b6f:	83 f8 10             	cmp    $0x10,%eax
+     b72:	75 0e                	jne    b82 <put+0x73>
+    flush(o);
+     b74:	83 ec 0c             	sub    $0xc,%esp
+     b77:	ff 75 08             	push   0x8(%ebp)
+     b7a:	e8 47 ff ff ff       	call   ac6 <flush>
+     b7f:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     b82:	8b 45 08             	mov    0x8(%ebp),%eax
+     b85:	8b 50 04             	mov    0x4(%eax),%edx
+     b88:	8b 45 08             	mov    0x8(%ebp),%eax
+     b8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     b8e:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     b92:	8b 45 08             	mov    0x8(%ebp),%eax
+     b95:	8b 50 04             	mov    0x4(%eax),%edx
+     b98:	8b 45 08             	mov    0x8(%ebp),%eax
+     b9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b9e:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba5:	8b 40 04             	mov    0x4(%eax),%eax
+     ba8:	8d 50 01             	lea    0x1(%eax),%edx
+     bab:	8b 45 08             	mov    0x8(%ebp),%eax
+     bae:	89 50 04             	mov    %edx,0x4(%eax)
+     bb1:	eb 01                	jmp    bb4 <put+0xa5>
+    return;
+     bb3:	90                   	nop
+}
+     bb4:	c9                   	leave
+     bb5:	c3                   	ret
+
+00000bb6 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     bb6:	55                   	push   %ebp
+     bb7:	89 e5                	mov    %esp,%ebp
+     bb9:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbf:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     bc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bc8:	01 d0                	add    %edx,%eax
+     bca:	3d 80 00 00 00       	cmp    $0x80,%eax
+     bcf:	77 0b                	ja     bdc <room+0x26>
+     bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd4:	8b 40 04             	mov    0x4(%eax),%eax
+     bd7:	83 f8 10             	cmp    $0x10,%eax
+     bda:	75 0e                	jne    bea <room+0x34>
+    flush(o);
+     bdc:	83 ec 0c             	sub    $0xc,%esp
+     bdf:	ff 75 08             	push   0x8(%ebp)
+     be2:	e8 df fe ff ff       	call   ac6 <flush>
+     be7:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     bea:	8b 45 08             	mov    0x8(%ebp),%eax
+     bed:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf6:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     bfc:	01 d0                	add    %edx,%eax
+}
+     bfe:	c9                   	leave
+     bff:	c3                   	ret
+
+00000c00 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	83 ec 28             	sub    $0x28,%esp
+     c06:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c09:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     c0c:	83 ec 08             	sub    $0x8,%esp
+     c0f:	6a 01                	push   $0x1
+     c11:	ff 75 08             	push   0x8(%ebp)
+     c14:	e8 9d ff ff ff       	call   bb6 <room>
+     c19:	83 c4 10             	add    $0x10,%esp
+     c1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     c1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c22:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     c26:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     c28:	8b 45 08             	mov    0x8(%ebp),%eax
+     c2b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     c31:	8d 50 01             	lea    0x1(%eax),%edx
+     c34:	8b 45 08             	mov    0x8(%ebp),%eax
+     c37:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     c3d:	83 ec 04             	sub    $0x4,%esp
+     c40:	6a 01                	push   $0x1
+     c42:	ff 75 f4             	push   -0xc(%ebp)
+     c45:	ff 75 08             	push   0x8(%ebp)
+     c48:	e8 c2 fe ff ff       	call   b0f <put>
+     c4d:	83 c4 10             	add    $0x10,%esp
+}
+     c50:	90                   	nop
+     c51:	c9                   	leave
+     c52:	c3                   	ret
+
+00000c53 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c53:	55                   	push   %ebp
+     c54:	89 e5                	mov    %esp,%ebp
+     c56:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     c59:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     c60:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     c64:	74 17                	je     c7d <printint+0x2a>
+     c66:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c6a:	79 11                	jns    c7d <printint+0x2a>
+    neg = 1;
+     c6c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     c73:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c76:	f7 d8                	neg    %eax
+     c78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c7b:	eb 06                	jmp    c83 <printint+0x30>
+  } else {
+    x = xx;
+     c7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     c83:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     c8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c8d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c90:	ba 00 00 00 00       	mov    $0x0,%edx
+     c95:	f7 f1                	div    %ecx
+     c97:	89 d1                	mov    %edx,%ecx
+     c99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c9c:	8d 50 01             	lea    0x1(%eax),%edx
+     c9f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ca2:	0f b6 91 ac 19 00 00 	movzbl 0x19ac(%ecx),%edx
+     ca9:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     cad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     cb0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+     cb8:	f7 f1                	div    %ecx
+     cba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     cbd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     cc1:	75 c7                	jne    c8a <printint+0x37>
+  if(neg)
+     cc3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cc7:	74 0e                	je     cd7 <printint+0x84>
+    buf[i++] = '-';
+     cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ccc:	8d 50 01             	lea    0x1(%eax),%edx
+     ccf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cd2:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     cd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cda:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     cdd:	83 ec 08             	sub    $0x8,%esp
+     ce0:	ff 75 e8             	push   -0x18(%ebp)
+     ce3:	ff 75 08             	push   0x8(%ebp)
+     ce6:	e8 cb fe ff ff       	call   bb6 <room>
+     ceb:	83 c4 10             	add    $0x10,%esp
+     cee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     cf1:	eb 1d                	jmp    d10 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     cf3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cf6:	83 e8 01             	sub    $0x1,%eax
+     cf9:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     cfc:	89 c2                	mov    %eax,%edx
+     cfe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d01:	01 c2                	add    %eax,%edx
+     d03:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d09:	01 c8                	add    %ecx,%eax
+     d0b:	0f b6 00             	movzbl (%eax),%eax
+     d0e:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     d10:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     d14:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d18:	79 d9                	jns    cf3 <printint+0xa0>
+  o->used += n;
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1d:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     d23:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d26:	01 c2                	add    %eax,%edx
+     d28:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2b:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     d31:	83 ec 04             	sub    $0x4,%esp
+     d34:	ff 75 e8             	push   -0x18(%ebp)
+     d37:	ff 75 e4             	push   -0x1c(%ebp)
+     d3a:	ff 75 08             	push   0x8(%ebp)
+     d3d:	e8 cd fd ff ff       	call   b0f <put>
+     d42:	83 c4 10             	add    $0x10,%esp
+}
+     d45:	90                   	nop
+     d46:	c9                   	leave
+     d47:	c3                   	ret
+
+00000d48 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     d48:	55                   	push   %ebp
+     d49:	89 e5                	mov    %esp,%ebp
+     d4b:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     d51:	8b 45 08             	mov    0x8(%ebp),%eax
+     d54:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     d5a:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     d61:	00 00 00 
+  o.used = 0;
+     d64:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     d6b:	00 00 00 
+  state = 0;
+     d6e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     d75:	8d 45 0c             	lea    0xc(%ebp),%eax
+     d78:	83 c0 04             	add    $0x4,%eax
+     d7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     d7e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d85:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     d8c:	e9 82 01 00 00       	jmp    f13 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     d91:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d97:	01 d0                	add    %edx,%eax
+     d99:	0f b6 00             	movzbl (%eax),%eax
+     d9c:	0f be c0             	movsbl %al,%eax
+     d9f:	25 ff 00 00 00       	and    $0xff,%eax
+     da4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     da7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     dab:	75 38                	jne    de5 <printf+0x9d>
+      if(c == '%'){
+     dad:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     db1:	0f 85 58 01 00 00    	jne    f0f <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     db7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dba:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     dc0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     dc3:	01 ca                	add    %ecx,%edx
+     dc5:	83 ec 04             	sub    $0x4,%esp
+     dc8:	50                   	push   %eax
+     dc9:	52                   	push   %edx
+     dca:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     dd0:	50                   	push   %eax
+     dd1:	e8 39 fd ff ff       	call   b0f <put>
+     dd6:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     dd9:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     de0:	e9 2a 01 00 00       	jmp    f0f <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     de5:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     de9:	0f 85 20 01 00 00    	jne    f0f <printf+0x1c7>
+      if(c == 'd'){
+     def:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     df3:	75 22                	jne    e17 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     df5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     df8:	8b 00                	mov    (%eax),%eax
+     dfa:	6a 01                	push   $0x1
+     dfc:	6a 0a                	push   $0xa
+     dfe:	50                   	push   %eax
+     dff:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e05:	50                   	push   %eax
+     e06:	e8 48 fe ff ff       	call   c53 <printint>
+     e0b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e0e:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     e12:	e9 e8 00 00 00       	jmp    eff <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     e17:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     e1b:	74 06                	je     e23 <printf+0xdb>
+     e1d:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     e21:	75 22                	jne    e45 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     e23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e26:	8b 00                	mov    (%eax),%eax
+     e28:	6a 00                	push   $0x0
+     e2a:	6a 10                	push   $0x10
+     e2c:	50                   	push   %eax
+     e2d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e33:	50                   	push   %eax
+     e34:	e8 1a fe ff ff       	call   c53 <printint>
+     e39:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e3c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     e40:	e9 ba 00 00 00       	jmp    eff <printf+0x1b7>
+      } else if(c == 's'){
+     e45:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     e49:	75 3f                	jne    e8a <printf+0x142>
+        s = (char*)*ap;
+     e4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e4e:	8b 00                	mov    (%eax),%eax
+     e50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     e53:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     e57:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e5b:	75 07                	jne    e64 <printf+0x11c>
+          s = "(null)";
+     e5d:	c7 45 f4 b5 14 00 00 	movl   $0x14b5,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     e64:	83 ec 0c             	sub    $0xc,%esp
+     e67:	ff 75 f4             	push   -0xc(%ebp)
+     e6a:	e8 47 f8 ff ff       	call   6b6 <strlen>
+     e6f:	83 c4 10             	add    $0x10,%esp
+     e72:	83 ec 04             	sub    $0x4,%esp
+     e75:	50                   	push   %eax
+     e76:	ff 75 f4             	push   -0xc(%ebp)
+     e79:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e7f:	50                   	push   %eax
+     e80:	e8 8a fc ff ff       	call   b0f <put>
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	eb 75                	jmp    eff <printf+0x1b7>
+      } else if(c == 'c'){
+     e8a:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     e8e:	75 21                	jne    eb1 <printf+0x169>
+        putc(&o, *ap);
+     e90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e93:	8b 00                	mov    (%eax),%eax
+     e95:	0f be c0             	movsbl %al,%eax
+     e98:	83 ec 08             	sub    $0x8,%esp
+     e9b:	50                   	push   %eax
+     e9c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ea2:	50                   	push   %eax
+     ea3:	e8 58 fd ff ff       	call   c00 <putc>
+     ea8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     eab:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     eaf:	eb 4e                	jmp    eff <printf+0x1b7>
+      } else if(c == '%'){
+     eb1:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     eb5:	75 1b                	jne    ed2 <printf+0x18a>
+        putc(&o, c);
+     eb7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     eba:	0f be c0             	movsbl %al,%eax
+     ebd:	83 ec 08             	sub    $0x8,%esp
+     ec0:	50                   	push   %eax
+     ec1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ec7:	50                   	push   %eax
+     ec8:	e8 33 fd ff ff       	call   c00 <putc>
+     ecd:	83 c4 10             	add    $0x10,%esp
+     ed0:	eb 2d                	jmp    eff <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     ed2:	83 ec 08             	sub    $0x8,%esp
+     ed5:	6a 25                	push   $0x25
+     ed7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     edd:	50                   	push   %eax
+     ede:	e8 1d fd ff ff       	call   c00 <putc>
+     ee3:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     ee6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ee9:	0f be c0             	movsbl %al,%eax
+     eec:	83 ec 08             	sub    $0x8,%esp
+     eef:	50                   	push   %eax
+     ef0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ef6:	50                   	push   %eax
+     ef7:	e8 04 fd ff ff       	call   c00 <putc>
+     efc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     eff:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     f06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f09:	83 c0 01             	add    $0x1,%eax
+     f0c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     f0f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     f13:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f19:	01 d0                	add    %edx,%eax
+     f1b:	0f b6 00             	movzbl (%eax),%eax
+     f1e:	84 c0                	test   %al,%al
+     f20:	0f 85 6b fe ff ff    	jne    d91 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     f26:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     f2a:	75 22                	jne    f4e <printf+0x206>
+    put(&o, fmt + start, i - start);
+     f2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f2f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     f35:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f38:	01 ca                	add    %ecx,%edx
+     f3a:	83 ec 04             	sub    $0x4,%esp
+     f3d:	50                   	push   %eax
+     f3e:	52                   	push   %edx
+     f3f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     f45:	50                   	push   %eax
+     f46:	e8 c4 fb ff ff       	call   b0f <put>
+     f4b:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     f4e:	83 ec 0c             	sub    $0xc,%esp
+     f51:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     f57:	50                   	push   %eax
+     f58:	e8 69 fb ff ff       	call   ac6 <flush>
+     f5d:	83 c4 10             	add    $0x10,%esp
+}
+     f60:	90                   	nop
+     f61:	c9                   	leave
+     f62:	c3                   	ret
+
+00000f63 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     f63:	55                   	push   %ebp
+     f64:	89 e5                	mov    %esp,%ebp
+     f66:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     f69:	8b 55 08             	mov    0x8(%ebp),%edx
+     f6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f72:	f0 87 02             	lock xchg %eax,(%edx)
+     f75:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     f78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     f7b:	c9                   	leave
+     f7c:	c3                   	ret
+
+00000f7d <lock>:
+{
+     f7d:	55                   	push   %ebp
+     f7e:	89 e5                	mov    %esp,%ebp
+     f80:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     f83:	a1 c4 19 00 00       	mov    0x19c4,%eax
+     f88:	85 c0                	test   %eax,%eax
+     f8a:	74 09                	je     f95 <lock+0x18>
+     f8c:	a1 c4 19 00 00       	mov    0x19c4,%eax
+     f91:	ff d0                	call   *%eax
+     f93:	eb 05                	jmp    f9a <lock+0x1d>
+     f95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f9a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     f9d:	90                   	nop
+     f9e:	83 ec 08             	sub    $0x8,%esp
+     fa1:	6a 01                	push   $0x1
+     fa3:	68 fc 19 00 00       	push   $0x19fc
+     fa8:	e8 b6 ff ff ff       	call   f63 <xchg>
+     fad:	83 c4 10             	add    $0x10,%esp
+     fb0:	85 c0                	test   %eax,%eax
+     fb2:	75 ea                	jne    f9e <lock+0x21>
+  return pin;
+     fb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     fb7:	c9                   	leave
+     fb8:	c3                   	ret
+
+00000fb9 <unlock>:
+{
+     fb9:	55                   	push   %ebp
+     fba:	89 e5                	mov    %esp,%ebp
+     fbc:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     fbf:	6a 00                	push   $0x0
+     fc1:	68 fc 19 00 00       	push   $0x19fc
+     fc6:	e8 98 ff ff ff       	call   f63 <xchg>
+     fcb:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     fce:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fd2:	78 10                	js     fe4 <unlock+0x2b>
+    mallocunpin(pin);
+     fd4:	a1 c8 19 00 00       	mov    0x19c8,%eax
+     fd9:	83 ec 0c             	sub    $0xc,%esp
+     fdc:	ff 75 08             	push   0x8(%ebp)
+     fdf:	ff d0                	call   *%eax
+     fe1:	83 c4 10             	add    $0x10,%esp
+}
+     fe4:	90                   	nop
+     fe5:	c9                   	leave
+     fe6:	c3                   	ret
+
+00000fe7 <sizeclass>:
+{
+     fe7:	55                   	push   %ebp
+     fe8:	89 e5                	mov    %esp,%ebp
+     fea:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     fed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     ff4:	eb 1c                	jmp    1012 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     ff6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ff9:	ba 02 00 00 00       	mov    $0x2,%edx
+     ffe:	89 c1                	mov    %eax,%ecx
+    1000:	d3 e2                	shl    %cl,%edx
+    1002:	89 d0                	mov    %edx,%eax
+    1004:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1007:	72 05                	jb     100e <sizeclass+0x27>
+      return c;
+    1009:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    100c:	eb 0f                	jmp    101d <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+    100e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1012:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+    1016:	7e de                	jle    ff6 <sizeclass+0xf>
+  return -1;
+    1018:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    101d:	c9                   	leave
+    101e:	c3                   	ret
+
+0000101f <bigfree>:
+{
+    101f:	55                   	push   %ebp
+    1020:	89 e5                	mov    %esp,%ebp
+    1022:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1025:	a1 d4 19 00 00       	mov    0x19d4,%eax
+    102a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    102d:	eb 24                	jmp    1053 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    102f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1032:	8b 00                	mov    (%eax),%eax
+    1034:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1037:	72 12                	jb     104b <bigfree+0x2c>
+    1039:	8b 45 08             	mov    0x8(%ebp),%eax
+    103c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    103f:	72 24                	jb     1065 <bigfree+0x46>
+    1041:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1044:	8b 00                	mov    (%eax),%eax
+    1046:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1049:	72 1a                	jb     1065 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    104b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    104e:	8b 00                	mov    (%eax),%eax
+    1050:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1053:	8b 45 08             	mov    0x8(%ebp),%eax
+    1056:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1059:	73 d4                	jae    102f <bigfree+0x10>
+    105b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    105e:	8b 00                	mov    (%eax),%eax
+    1060:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1063:	73 ca                	jae    102f <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+    1065:	8b 45 08             	mov    0x8(%ebp),%eax
+    1068:	8b 40 04             	mov    0x4(%eax),%eax
+    106b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1072:	8b 45 08             	mov    0x8(%ebp),%eax
+    1075:	01 c2                	add    %eax,%edx
+    1077:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    107a:	8b 00                	mov    (%eax),%eax
+    107c:	39 c2                	cmp    %eax,%edx
+    107e:	75 24                	jne    10a4 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+    1080:	8b 45 08             	mov    0x8(%ebp),%eax
+    1083:	8b 50 04             	mov    0x4(%eax),%edx
+    1086:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1089:	8b 00                	mov    (%eax),%eax
+    108b:	8b 40 04             	mov    0x4(%eax),%eax
+    108e:	01 c2                	add    %eax,%edx
+    1090:	8b 45 08             	mov    0x8(%ebp),%eax
+    1093:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1096:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1099:	8b 00                	mov    (%eax),%eax
+    109b:	8b 10                	mov    (%eax),%edx
+    109d:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a0:	89 10                	mov    %edx,(%eax)
+    10a2:	eb 0a                	jmp    10ae <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+    10a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10a7:	8b 10                	mov    (%eax),%edx
+    10a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ac:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    10ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10b1:	8b 40 04             	mov    0x4(%eax),%eax
+    10b4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    10bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10be:	01 d0                	add    %edx,%eax
+    10c0:	39 45 08             	cmp    %eax,0x8(%ebp)
+    10c3:	75 20                	jne    10e5 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+    10c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10c8:	8b 50 04             	mov    0x4(%eax),%edx
+    10cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ce:	8b 40 04             	mov    0x4(%eax),%eax
+    10d1:	01 c2                	add    %eax,%edx
+    10d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10d6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    10d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dc:	8b 10                	mov    (%eax),%edx
+    10de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10e1:	89 10                	mov    %edx,(%eax)
+    10e3:	eb 08                	jmp    10ed <bigfree+0xce>
+    p->s.ptr = bp;
+    10e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    10eb:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    10ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10f0:	a3 d4 19 00 00       	mov    %eax,0x19d4
+}
+    10f5:	90                   	nop
+    10f6:	c9                   	leave
+    10f7:	c3                   	ret
+
+000010f8 <free>:
+{
+    10f8:	55                   	push   %ebp
+    10f9:	89 e5                	mov    %esp,%ebp
+    10fb:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    10fe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1102:	74 68                	je     116c <free+0x74>
+  bp = (Header*)ap - 1;
+    1104:	8b 45 08             	mov    0x8(%ebp),%eax
+    1107:	83 e8 08             	sub    $0x8,%eax
+    110a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    110d:	e8 6b fe ff ff       	call   f7d <lock>
+    1112:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    1115:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1118:	8b 40 04             	mov    0x4(%eax),%eax
+    111b:	83 ec 0c             	sub    $0xc,%esp
+    111e:	50                   	push   %eax
+    111f:	e8 c3 fe ff ff       	call   fe7 <sizeclass>
+    1124:	83 c4 10             	add    $0x10,%esp
+    1127:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    112a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    112e:	78 1e                	js     114e <free+0x56>
+    bp->s.ptr = classfree[c];
+    1130:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1133:	8b 14 85 d8 19 00 00 	mov    0x19d8(,%eax,4),%edx
+    113a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    113d:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    113f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1142:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1145:	89 14 85 d8 19 00 00 	mov    %edx,0x19d8(,%eax,4)
+    114c:	eb 0e                	jmp    115c <free+0x64>
+    bigfree(bp);
+    114e:	83 ec 0c             	sub    $0xc,%esp
+    1151:	ff 75 f4             	push   -0xc(%ebp)
+    1154:	e8 c6 fe ff ff       	call   101f <bigfree>
+    1159:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    115c:	83 ec 0c             	sub    $0xc,%esp
+    115f:	ff 75 f0             	push   -0x10(%ebp)
+    1162:	e8 52 fe ff ff       	call   fb9 <unlock>
+    1167:	83 c4 10             	add    $0x10,%esp
+    116a:	eb 01                	jmp    116d <free+0x75>
+    return;
+    116c:	90                   	nop
+}
+    116d:	c9                   	leave
+    116e:	c3                   	ret
+
+0000116f <morecore>:
+{
+    116f:	55                   	push   %ebp
+    1170:	89 e5                	mov    %esp,%ebp
+    1172:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    1175:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    117c:	77 07                	ja     1185 <morecore+0x16>
+    nu = 4096;
+    117e:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    1185:	8b 45 08             	mov    0x8(%ebp),%eax
+    1188:	c1 e0 03             	shl    $0x3,%eax
+    118b:	83 ec 0c             	sub    $0xc,%esp
+    118e:	50                   	push   %eax
+    118f:	e8 b6 f7 ff ff       	call   94a <sbrk>
+    1194:	83 c4 10             	add    $0x10,%esp
+    1197:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    119a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    119e:	75 07                	jne    11a7 <morecore+0x38>
+    return 0;
+    11a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a5:	eb 22                	jmp    11c9 <morecore+0x5a>
+  hp = (Header*)p;
+    11a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    11ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11b0:	8b 55 08             	mov    0x8(%ebp),%edx
+    11b3:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    11b6:	83 ec 0c             	sub    $0xc,%esp
+    11b9:	ff 75 f0             	push   -0x10(%ebp)
+    11bc:	e8 5e fe ff ff       	call   101f <bigfree>
+    11c1:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    11c4:	a1 d4 19 00 00       	mov    0x19d4,%eax
+}
+    11c9:	c9                   	leave
+    11ca:	c3                   	ret
+
+000011cb <bigalloc>:
+{
+    11cb:	55                   	push   %ebp
+    11cc:	89 e5                	mov    %esp,%ebp
+    11ce:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    11d1:	a1 d4 19 00 00       	mov    0x19d4,%eax
+    11d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11dd:	75 23                	jne    1202 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    11df:	c7 45 f0 cc 19 00 00 	movl   $0x19cc,-0x10(%ebp)
+    11e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11e9:	a3 d4 19 00 00       	mov    %eax,0x19d4
+    11ee:	a1 d4 19 00 00       	mov    0x19d4,%eax
+    11f3:	a3 cc 19 00 00       	mov    %eax,0x19cc
+    base.s.size = 0;
+    11f8:	c7 05 d0 19 00 00 00 	movl   $0x0,0x19d0
+    11ff:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1202:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1205:	8b 00                	mov    (%eax),%eax
+    1207:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    120a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    120d:	8b 40 04             	mov    0x4(%eax),%eax
+    1210:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1213:	72 4a                	jb     125f <bigalloc+0x94>
+      if(p->s.size == nunits)
+    1215:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1218:	8b 40 04             	mov    0x4(%eax),%eax
+    121b:	39 45 08             	cmp    %eax,0x8(%ebp)
+    121e:	75 0c                	jne    122c <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1223:	8b 10                	mov    (%eax),%edx
+    1225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1228:	89 10                	mov    %edx,(%eax)
+    122a:	eb 26                	jmp    1252 <bigalloc+0x87>
+        p->s.size -= nunits;
+    122c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122f:	8b 40 04             	mov    0x4(%eax),%eax
+    1232:	2b 45 08             	sub    0x8(%ebp),%eax
+    1235:	89 c2                	mov    %eax,%edx
+    1237:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    123d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1240:	8b 40 04             	mov    0x4(%eax),%eax
+    1243:	c1 e0 03             	shl    $0x3,%eax
+    1246:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1249:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    124c:	8b 55 08             	mov    0x8(%ebp),%edx
+    124f:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1252:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1255:	a3 d4 19 00 00       	mov    %eax,0x19d4
+      return p;
+    125a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    125d:	eb 3b                	jmp    129a <bigalloc+0xcf>
+    if(p == freep)
+    125f:	a1 d4 19 00 00       	mov    0x19d4,%eax
+    1264:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1267:	75 1e                	jne    1287 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1269:	83 ec 0c             	sub    $0xc,%esp
+    126c:	ff 75 08             	push   0x8(%ebp)
+    126f:	e8 fb fe ff ff       	call   116f <morecore>
+    1274:	83 c4 10             	add    $0x10,%esp
+    1277:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    127a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    127e:	75 07                	jne    1287 <bigalloc+0xbc>
+        return 0;
+    1280:	b8 00 00 00 00       	mov    $0x0,%eax
+    1285:	eb 13                	jmp    129a <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1287:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    128a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    128d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1290:	8b 00                	mov    (%eax),%eax
+    1292:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1295:	e9 70 ff ff ff       	jmp    120a <bigalloc+0x3f>
+}
+    129a:	c9                   	leave
+    129b:	c3                   	ret
+
+0000129c <alloc>:
+alloc(uint nbytes)
+{
+    129c:	55                   	push   %ebp
+    129d:	89 e5                	mov    %esp,%ebp
+    129f:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    12a2:	8b 45 08             	mov    0x8(%ebp),%eax
+    12a5:	83 c0 07             	add    $0x7,%eax
+    12a8:	c1 e8 03             	shr    $0x3,%eax
+    12ab:	83 c0 01             	add    $0x1,%eax
+    12ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    12b1:	ff 75 f4             	push   -0xc(%ebp)
+    12b4:	e8 2e fd ff ff       	call   fe7 <sizeclass>
+    12b9:	83 c4 04             	add    $0x4,%esp
+    12bc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12bf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12c3:	79 2c                	jns    12f1 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    12c5:	83 ec 0c             	sub    $0xc,%esp
+    12c8:	ff 75 f4             	push   -0xc(%ebp)
+    12cb:	e8 fb fe ff ff       	call   11cb <bigalloc>
+    12d0:	83 c4 10             	add    $0x10,%esp
+    12d3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    12d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    12da:	75 0a                	jne    12e6 <alloc+0x4a>
+      return 0;
+    12dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e1:	e9 c8 00 00 00       	jmp    13ae <alloc+0x112>
+    return (void*)(p + 1);
+    12e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12e9:	83 c0 08             	add    $0x8,%eax
+    12ec:	e9 bd 00 00 00       	jmp    13ae <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    12f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12f4:	8b 04 85 d8 19 00 00 	mov    0x19d8(,%eax,4),%eax
+    12fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    12fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1302:	74 1a                	je     131e <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1304:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1307:	8b 10                	mov    (%eax),%edx
+    1309:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    130c:	89 14 85 d8 19 00 00 	mov    %edx,0x19d8(,%eax,4)
+    return (void*)(p + 1);
+    1313:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1316:	83 c0 08             	add    $0x8,%eax
+    1319:	e9 90 00 00 00       	jmp    13ae <alloc+0x112>
+  }
+  nunits = 2 << c;
+    131e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1321:	ba 02 00 00 00       	mov    $0x2,%edx
+    1326:	89 c1                	mov    %eax,%ecx
+    1328:	d3 e2                	shl    %cl,%edx
+    132a:	89 d0                	mov    %edx,%eax
+    132c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    132f:	a1 f4 19 00 00       	mov    0x19f4,%eax
+    1334:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1337:	c1 e2 03             	shl    $0x3,%edx
+    133a:	01 d0                	add    %edx,%eax
+    133c:	8b 15 f8 19 00 00    	mov    0x19f8,%edx
+    1342:	39 c2                	cmp    %eax,%edx
+    1344:	73 3f                	jae    1385 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1346:	83 ec 0c             	sub    $0xc,%esp
+    1349:	68 00 08 00 00       	push   $0x800
+    134e:	e8 78 fe ff ff       	call   11cb <bigalloc>
+    1353:	83 c4 10             	add    $0x10,%esp
+    1356:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1359:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    135d:	75 07                	jne    1366 <alloc+0xca>
+      return 0;
+    135f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1364:	eb 48                	jmp    13ae <alloc+0x112>
+    bump = (char*)p;
+    1366:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1369:	a3 f4 19 00 00       	mov    %eax,0x19f4
+    bumpend = (char*)(p + p->s.size);
+    136e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1371:	8b 40 04             	mov    0x4(%eax),%eax
+    1374:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    137b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    137e:	01 d0                	add    %edx,%eax
+    1380:	a3 f8 19 00 00       	mov    %eax,0x19f8
+  }
+  p = (Header*)bump;
+    1385:	a1 f4 19 00 00       	mov    0x19f4,%eax
+    138a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    138d:	a1 f4 19 00 00       	mov    0x19f4,%eax
+    1392:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1395:	c1 e2 03             	shl    $0x3,%edx
+    1398:	01 d0                	add    %edx,%eax
+    139a:	a3 f4 19 00 00       	mov    %eax,0x19f4
+  p->s.size = nunits;
+    139f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13a5:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    13a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13ab:	83 c0 08             	add    $0x8,%eax
+}
+    13ae:	c9                   	leave
+    13af:	c3                   	ret
+
+000013b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    13b6:	e8 c2 fb ff ff       	call   f7d <lock>
+    13bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    13be:	83 ec 0c             	sub    $0xc,%esp
+    13c1:	ff 75 08             	push   0x8(%ebp)
+    13c4:	e8 d3 fe ff ff       	call   129c <alloc>
+    13c9:	83 c4 10             	add    $0x10,%esp
+    13cc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    13cf:	83 ec 0c             	sub    $0xc,%esp
+    13d2:	ff 75 f4             	push   -0xc(%ebp)
+    13d5:	e8 df fb ff ff       	call   fb9 <unlock>
+    13da:	83 c4 10             	add    $0x10,%esp
+  return p;
+    13dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    13e0:	c9                   	leave
+    13e1:	c3                   	ret
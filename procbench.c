@@ -0,0 +1,203 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Process, IPC and context switch benchmarks, after lmbench.
+//
+//   procbench [-c maxcpu] [bench ...]
+//
+// Runs each named benchmark, or all of them, in 1, 2, ... up to
+// maxcpu processes at once (by default as many as there are CPUs),
+// each doing the same number of operations.  Prints one line per
+// run, for scripts to read:
+//
+//   bench nproc ops ticks ops/s ns/op
+//
+// where ns/op is the time one process took per operation.  Times
+// come from uptime(), so each run should take many ticks.
+
+#define HZ     100      // clock ticks per second
+#define PGSIZE 4096
+
+struct bench {
+  char *name;
+  int n;                // operations per process
+  void (*run)(int);
+};
+
+char *self;             // how to exec this program
+
+static void
+fail(char *what)
+{
+  printf(2, "procbench: %s failed\n", what);
+  exit();
+}
+
+// A system call that does nothing.
+static void
+null(int n)
+{
+  while(n-- > 0)
+    getpid();
+}
+
+static void
+forkexit(int n)
+{
+  int pid;
+
+  while(n-- > 0){
+    if((pid = fork()) < 0)
+      fail("fork");
+    if(pid == 0)
+      exit();
+    wait();
+  }
+}
+
+static void
+forkexec(int n)
+{
+  char *argv[] = { self, "-x", 0 };
+  int pid;
+
+  while(n-- > 0){
+    if((pid = fork()) < 0)
+      fail("fork");
+    if(pid == 0){
+      exec(self, argv);
+      fail("exec");
+    }
+    wait();
+  }
+}
+
+// Round trips of a byte to a child and back, through two pipes.
+static void
+pingpong(int n)
+{
+  int p[2], q[2], pid, i;
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+    fail("pipe");
+  if((pid = fork()) < 0)
+    fail("fork");
+  if(pid == 0){
+    for(i = 0; i < n; i++)
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+        fail("pipe read or write");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    if(write(p[1], &c, 1) != 1 || read(q[0], &c, 1) != 1)
+      fail("pipe write or read");
+  wait();
+  close(p[0]);
+  close(p[1]);
+  close(q[0]);
+  close(q[1]);
+}
+
+// Switches through the scheduler and back.
+static void
+yields(int n)
+{
+  while(n-- > 0)
+    yield();
+}
+
+// Growing the heap a page at a time, and touching each page.
+static void
+grow(int n)
+{
+  char *p;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if((p = sbrk(PGSIZE)) == (char*)-1)
+      fail("sbrk");
+    *p = 1;
+  }
+  sbrk(-n * PGSIZE);
+}
+
+struct bench benches[] = {
+  { "null",     100000, null },
+  { "fork",     200,    forkexit },
+  { "exec",     100,    forkexec },
+  { "pipe",     2000,   pingpong },
+  { "yield",    20000,  yields },
+  { "sbrk",     1000,   grow },
+};
+
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+// Run b in nproc processes, started together.
+static void
+runbench(struct bench *b, int nproc)
+{
+  int i, go[2], t, ops, us;
+  char c;
+
+  if(pipe(go) < 0)
+    fail("pipe");
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      close(go[1]);
+      if(read(go[0], &c, 1) != 1)
+        fail("start");
+      b->run(b->n);
+      exit();
+    }
+  }
+  close(go[0]);
+  t = uptime();
+  for(i = 0; i < nproc; i++)
+    write(go[1], "g", 1);
+  for(i = 0; i < nproc; i++)
+    wait();
+  t = uptime() - t;
+  close(go[1]);
+
+  ops = nproc * b->n;
+  printf(1, "%s %d %d %d", b->name, nproc, ops, t);
+  if(t == 0)
+    t = 1;
+  us = t * (1000000 / HZ);
+  printf(1, " %d %d\n", ops * HZ / t,
+         us / b->n * 1000 + us % b->n * 1000 / b->n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, k, maxcpu;
+
+  if(argc == 2 && strcmp(argv[1], "-x") == 0)
+    exit();  // forkexec's child
+  self = argv[0];
+  maxcpu = ncpu();
+  i = 1;
+  if(argc > 2 && strcmp(argv[1], "-c") == 0){
+    maxcpu = atoi(argv[2]);
+    i = 3;
+  }
+  if(maxcpu < 1 || (i < argc && argv[i][0] == '-')){
+    printf(2, "usage: procbench [-c maxcpu] [bench ...]\n");
+    exit();
+  }
+
+  printf(1, "# bench nproc ops ticks ops/s ns/op\n");
+  for(j = 0; j < NBENCH; j++){
+    for(k = i; k < argc; k++)
+      if(strcmp(argv[k], benches[j].name) == 0)
+        break;
+    if(i < argc && k == argc)
+      continue;
+    for(k = 1; k <= maxcpu; k++)
+      runbench(&benches[j], k);
+  }
+  exit();
+}
@@ -0,0 +1,200 @@
+// Sampling profiler.
+//
+// While it is on, each CPU's LAPIC timer interrupts rate times per
+// clock tick, and every interrupt records where the CPU was: the
+// program counter and the frame-pointer chain of callers above it,
+// the CPU, the pid and name of the process, and whether it was in
+// user or kernel mode.  Only every rate'th interrupt is a clock
+// tick; the others just take the sample (see proftick).
+//
+// Samples go into a ring per CPU, filled by that CPU's interrupts
+// and emptied by readers of the prof device (major PROF, /dev/prof),
+// each sample as a line of text:
+//
+//   S cpu pid name k|u pc pc ...
+//
+// A sample that finds its ring full is dropped, and counted in a
+// "D cpu n" line.  Writing a number to the device sets rate, 0 to
+// turn sampling off; PROFRATE is its value at boot.
+// profsym.pl turns the lines into stacks of symbols.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPROFPC    8    // program counters per sample
+#define NPROFSAMP  256  // samples per CPU (a power of two)
+#define MAXPROFRATE 64  // most samples per clock tick
+
+struct sample {
+  uint pc[NPROFPC];     // where it was, then its callers; 0 ends
+  int pid;              // 0 if no process
+  char name[16];
+  uchar cpu;
+  uchar user;           // 1 if in user mode
+};
+
+// One CPU's ring.  Its interrupts advance head and readers advance
+// tail, so neither needs a lock against the other.
+struct profcpu {
+  struct sample ring[NPROFSAMP];
+  volatile uint head;
+  volatile uint tail;
+  uint dropped;
+  int rate;             // rate its timer runs at
+  int n;                // interrupts since its last tick
+};
+
+static struct {
+  struct spinlock lock; // one reader at a time
+  int rate;
+  struct profcpu cpu[NCPU];
+} prof;
+
+// Fill pcs with the kernel call chain from frame pointer ebp, which
+// must stay on the stack page that also holds tf, since the code
+// that was interrupted may not have made its frame yet.
+static void
+kcallerpcs(struct trapframe *tf, uint ebp, uint *pcs, int n)
+{
+  uint lo, *fp;
+  int i;
+
+  lo = PGROUNDDOWN((uint)tf);
+  for(i = 0; i < n; i++){
+    if(ebp < lo || ebp + 8 > lo + PGSIZE || ebp % 4 != 0)
+      break;
+    fp = (uint*)ebp;
+    pcs[i] = fp[1];
+    ebp = fp[0];
+  }
+  for(; i < n; i++)
+    pcs[i] = 0;
+}
+
+// Record a sample of tf in this CPU's ring.
+static void
+record(struct profcpu *c, struct trapframe *tf)
+{
+  struct sample *s;
+
+  if(c->head - c->tail == NPROFSAMP){
+    c->dropped++;
+    return;
+  }
+  s = &c->ring[c->head % NPROFSAMP];
+  s->pc[0] = tf->eip;
+  s->cpu = cpu->id;
+  s->user = (tf->cs&3) == DPL_USER;
+  if(s->user)
+    ucallerpcs(tf->ebp, s->pc+1, NPROFPC-1);
+  else
+    kcallerpcs(tf, tf->ebp, s->pc+1, NPROFPC-1);
+  if(proc){
+    s->pid = proc->pid;
+    memmove(s->name, proc->name, sizeof(s->name));
+  } else {
+    s->pid = 0;
+    safestrcpy(s->name, "-", sizeof(s->name));
+  }
+  __sync_synchronize();  // the sample before the head that shows it
+  c->head++;
+}
+
+// Take a sample at the timer interrupt with trap frame tf, if the
+// profiler is on.  Return 1 if the interrupt is also a clock tick.
+int
+proftick(struct trapframe *tf)
+{
+  struct profcpu *c;
+  int rate;
+
+  c = &prof.cpu[cpu - cpus];
+  rate = prof.rate;
+  if(c->rate != rate){
+    c->rate = rate;
+    c->n = 0;
+    lapictimer(rate);
+  }
+  if(rate == 0)
+    return 1;
+  record(c, tf);
+  if(++c->n < rate)
+    return 0;
+  c->n = 0;
+  return 1;
+}
+
+// Take samples out of the rings, oldest first per CPU, as whole
+// lines, until no more fit in the n bytes at dst.  Return the
+// number of bytes.
+int
+profread(struct inode *ip, char *dst, uint off, int n)
+{
+  char line[32 + NPROFPC*9];
+  struct profcpu *c;
+  struct sample *s;
+  int i, len, tot;
+
+  acquire(&prof.lock);
+  tot = 0;
+  for(c = prof.cpu; c < prof.cpu + ncpu; c++){
+    if(c->dropped){
+      len = snprintf(line, sizeof(line), "D %d %u\n", (int)(c - prof.cpu), c->dropped);
+      if(tot + len > n)
+        break;
+      memmove(dst + tot, line, len);
+      tot += len;
+      c->dropped = 0;
+    }
+    while(c->tail != c->head){
+      __sync_synchronize();  // the head before the sample it shows
+      s = &c->ring[c->tail % NPROFSAMP];
+      len = snprintf(line, sizeof(line), "S %d %d %s %s", s->cpu, s->pid,
+                     s->name, s->user ? "u" : "k");
+      for(i = 0; i < NPROFPC && s->pc[i]; i++)
+        len += snprintf(line+len, sizeof(line)-len, " %x", s->pc[i]);
+      len += snprintf(line+len, sizeof(line)-len, "\n");
+      if(tot + len > n)
+        goto out;
+      memmove(dst + tot, line, len);
+      tot += len;
+      __sync_synchronize();  // done with the sample before freeing it
+      c->tail++;
+    }
+  }
+ out:
+  release(&prof.lock);
+  return tot;
+}
+
+// Set the sampling rate to the decimal number written.
+int
+profwrite(struct inode *ip, char *src, uint off, int n)
+{
+  int i, rate;
+
+  rate = 0;
+  for(i = 0; i < n && src[i] >= '0' && src[i] <= '9' && rate <= MAXPROFRATE; i++)
+    rate = rate*10 + src[i] - '0';
+  if(i == 0 || rate > MAXPROFRATE)
+    return -1;
+  prof.rate = rate;
+  return n;
+}
+
+void
+profinit(void)
+{
+  initlock(&prof.lock, "prof");
+  prof.rate = PROFRATE;
+  devsw[PROF].read = profread;
+  devsw[PROF].write = profwrite;
+}
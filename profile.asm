@@ -0,0 +1,1962 @@
+
+_profile:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <drain>:
+char buf[2048];
+
+// Copy the samples waiting in /dev/prof to standard output.
+void
+drain(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+   6:	eb 15                	jmp    1d <drain+0x1d>
+    write(1, buf, n);
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 00 14 00 00       	push   $0x1400
+  13:	6a 01                	push   $0x1
+  15:	e8 83 04 00 00       	call   49d <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	68 00 08 00 00       	push   $0x800
+  25:	68 00 14 00 00       	push   $0x1400
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	e8 64 04 00 00       	call   496 <read>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3c:	7f ca                	jg     8 <drain+0x8>
+}
+  3e:	90                   	nop
+  3f:	90                   	nop
+  40:	c9                   	leave
+  41:	c3                   	ret
+
+00000042 <main>:
+
+int
+main(int argc, char **argv)
+{
+  42:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  46:	83 e4 f0             	and    $0xfffffff0,%esp
+  49:	ff 71 fc             	push   -0x4(%ecx)
+  4c:	55                   	push   %ebp
+  4d:	89 e5                	mov    %esp,%ebp
+  4f:	53                   	push   %ebx
+  50:	51                   	push   %ecx
+  51:	83 ec 10             	sub    $0x10,%esp
+  54:	89 cb                	mov    %ecx,%ebx
+  int fd, pid, reader, w;
+
+  if(argc < 3){
+  56:	83 3b 02             	cmpl   $0x2,(%ebx)
+  59:	7f 17                	jg     72 <main+0x30>
+    printf(2, "usage: profile rate cmd [arg...]\n");
+  5b:	83 ec 08             	sub    $0x8,%esp
+  5e:	68 ac 0f 00 00       	push   $0xfac
+  63:	6a 02                	push   $0x2
+  65:	e8 a7 08 00 00       	call   911 <printf>
+  6a:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6d:	e8 0f 04 00 00       	call   481 <exit>
+  }
+  if((fd = open("/dev/prof", O_RDWR)) < 0){
+  72:	83 ec 08             	sub    $0x8,%esp
+  75:	6a 02                	push   $0x2
+  77:	68 ce 0f 00 00       	push   $0xfce
+  7c:	e8 38 04 00 00       	call   4b9 <open>
+  81:	83 c4 10             	add    $0x10,%esp
+  84:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  87:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  8b:	79 17                	jns    a4 <main+0x62>
+    printf(2, "profile: cannot open /dev/prof\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 d8 0f 00 00       	push   $0xfd8
+  95:	6a 02                	push   $0x2
+  97:	e8 75 08 00 00       	call   911 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  9f:	e8 dd 03 00 00       	call   481 <exit>
+  }
+  drain(fd);  // samples from before
+  a4:	83 ec 0c             	sub    $0xc,%esp
+  a7:	ff 75 f4             	push   -0xc(%ebp)
+  aa:	e8 51 ff ff ff       	call   0 <drain>
+  af:	83 c4 10             	add    $0x10,%esp
+  if(write(fd, argv[1], strlen(argv[1])) < 0){
+  b2:	8b 43 04             	mov    0x4(%ebx),%eax
+  b5:	83 c0 04             	add    $0x4,%eax
+  b8:	8b 00                	mov    (%eax),%eax
+  ba:	83 ec 0c             	sub    $0xc,%esp
+  bd:	50                   	push   %eax
+  be:	e8 bc 01 00 00       	call   27f <strlen>
+  c3:	83 c4 10             	add    $0x10,%esp
+  c6:	89 c2                	mov    %eax,%edx
+  c8:	8b 43 04             	mov    0x4(%ebx),%eax
+  cb:	83 c0 04             	add    $0x4,%eax
+  ce:	8b 00                	mov    (%eax),%eax
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	52                   	push   %edx
+  d4:	50                   	push   %eax
+  d5:	ff 75 f4             	push   -0xc(%ebp)
+  d8:	e8 c0 03 00 00       	call   49d <write>
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	85 c0                	test   %eax,%eax
+  e2:	79 20                	jns    104 <main+0xc2>
+    printf(2, "profile: bad rate %s\n", argv[1]);
+  e4:	8b 43 04             	mov    0x4(%ebx),%eax
+  e7:	83 c0 04             	add    $0x4,%eax
+  ea:	8b 00                	mov    (%eax),%eax
+  ec:	83 ec 04             	sub    $0x4,%esp
+  ef:	50                   	push   %eax
+  f0:	68 f8 0f 00 00       	push   $0xff8
+  f5:	6a 02                	push   $0x2
+  f7:	e8 15 08 00 00       	call   911 <printf>
+  fc:	83 c4 10             	add    $0x10,%esp
+    exit();
+  ff:	e8 7d 03 00 00       	call   481 <exit>
+  }
+
+  if((pid = spawn(argv[2], argv+2, 0, 0)) < 0){
+ 104:	8b 43 04             	mov    0x4(%ebx),%eax
+ 107:	8d 50 08             	lea    0x8(%eax),%edx
+ 10a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 10d:	83 c0 08             	add    $0x8,%eax
+ 110:	8b 00                	mov    (%eax),%eax
+ 112:	6a 00                	push   $0x0
+ 114:	6a 00                	push   $0x0
+ 116:	52                   	push   %edx
+ 117:	50                   	push   %eax
+ 118:	e8 96 04 00 00       	call   5b3 <spawn>
+ 11d:	83 c4 10             	add    $0x10,%esp
+ 120:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 123:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 127:	79 35                	jns    15e <main+0x11c>
+    printf(2, "profile: spawn %s failed\n", argv[2]);
+ 129:	8b 43 04             	mov    0x4(%ebx),%eax
+ 12c:	83 c0 08             	add    $0x8,%eax
+ 12f:	8b 00                	mov    (%eax),%eax
+ 131:	83 ec 04             	sub    $0x4,%esp
+ 134:	50                   	push   %eax
+ 135:	68 0e 10 00 00       	push   $0x100e
+ 13a:	6a 02                	push   $0x2
+ 13c:	e8 d0 07 00 00       	call   911 <printf>
+ 141:	83 c4 10             	add    $0x10,%esp
+    write(fd, "0", 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	68 28 10 00 00       	push   $0x1028
+ 14e:	ff 75 f4             	push   -0xc(%ebp)
+ 151:	e8 47 03 00 00       	call   49d <write>
+ 156:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 159:	e8 23 03 00 00       	call   481 <exit>
+  }
+  // A reader keeps the rings from filling up while the command runs.
+  if((reader = fork()) == 0){
+ 15e:	e8 17 03 00 00       	call   47a <fork>
+ 163:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 166:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 16a:	75 1e                	jne    18a <main+0x148>
+    for(;;){
+      drain(fd);
+ 16c:	83 ec 0c             	sub    $0xc,%esp
+ 16f:	ff 75 f4             	push   -0xc(%ebp)
+ 172:	e8 89 fe ff ff       	call   0 <drain>
+ 177:	83 c4 10             	add    $0x10,%esp
+      sleep(1);
+ 17a:	83 ec 0c             	sub    $0xc,%esp
+ 17d:	6a 01                	push   $0x1
+ 17f:	e8 99 03 00 00       	call   51d <sleep>
+ 184:	83 c4 10             	add    $0x10,%esp
+      drain(fd);
+ 187:	90                   	nop
+ 188:	eb e2                	jmp    16c <main+0x12a>
+    }
+  }
+  while((w = wait()) >= 0 && w != pid)
+ 18a:	90                   	nop
+ 18b:	e8 f8 02 00 00       	call   488 <wait>
+ 190:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 193:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 197:	78 08                	js     1a1 <main+0x15f>
+ 199:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 19c:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 19f:	75 ea                	jne    18b <main+0x149>
+    ;
+  write(fd, "0", 1);
+ 1a1:	83 ec 04             	sub    $0x4,%esp
+ 1a4:	6a 01                	push   $0x1
+ 1a6:	68 28 10 00 00       	push   $0x1028
+ 1ab:	ff 75 f4             	push   -0xc(%ebp)
+ 1ae:	e8 ea 02 00 00       	call   49d <write>
+ 1b3:	83 c4 10             	add    $0x10,%esp
+  kill(reader);
+ 1b6:	83 ec 0c             	sub    $0xc,%esp
+ 1b9:	ff 75 ec             	push   -0x14(%ebp)
+ 1bc:	e8 ea 02 00 00       	call   4ab <kill>
+ 1c1:	83 c4 10             	add    $0x10,%esp
+  wait();
+ 1c4:	e8 bf 02 00 00       	call   488 <wait>
+  drain(fd);
+ 1c9:	83 ec 0c             	sub    $0xc,%esp
+ 1cc:	ff 75 f4             	push   -0xc(%ebp)
+ 1cf:	e8 2c fe ff ff       	call   0 <drain>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+ 1d7:	83 ec 0c             	sub    $0xc,%esp
+ 1da:	ff 75 f4             	push   -0xc(%ebp)
+ 1dd:	e8 c2 02 00 00       	call   4a4 <close>
+ 1e2:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 1e5:	e8 97 02 00 00       	call   481 <exit>
+
+000001ea <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	57                   	push   %edi
+ 1ee:	53                   	push   %ebx
+    if(cc < 1)
+ 1ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f2:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f8:	89 cb                	mov    %ecx,%ebx
+ 1fa:	89 df                	mov    %ebx,%edi
+ 1fc:	89 d1                	mov    %edx,%ecx
+ 1fe:	fc                   	cld
+ 1ff:	f3 aa                	rep stos %al,%es:(%edi)
+ 201:	89 ca                	mov    %ecx,%edx
+ 203:	89 fb                	mov    %edi,%ebx
+ 205:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 208:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 20b:	90                   	nop
+ 20c:	5b                   	pop    %ebx
+ 20d:	5f                   	pop    %edi
+ 20e:	5d                   	pop    %ebp
+ 20f:	c3                   	ret
+
+00000210 <strcpy>:
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 216:	8b 45 08             	mov    0x8(%ebp),%eax
+ 219:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 21c:	90                   	nop
+ 21d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 220:	8d 42 01             	lea    0x1(%edx),%eax
+ 223:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 226:	8b 45 08             	mov    0x8(%ebp),%eax
+ 229:	8d 48 01             	lea    0x1(%eax),%ecx
+ 22c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 22f:	0f b6 12             	movzbl (%edx),%edx
+ 232:	88 10                	mov    %dl,(%eax)
+ 234:	0f b6 00             	movzbl (%eax),%eax
+ 237:	84 c0                	test   %al,%al
+ 239:	75 e2                	jne    21d <strcpy+0xd>
+  return os;
+ 23b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23e:	c9                   	leave
+ 23f:	c3                   	ret
+
+00000240 <strcmp>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 243:	eb 08                	jmp    24d <strcmp+0xd>
+    p++, q++;
+ 245:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 249:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 24d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	84 c0                	test   %al,%al
+ 255:	74 10                	je     267 <strcmp+0x27>
+ 257:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 260:	0f b6 00             	movzbl (%eax),%eax
+ 263:	38 c2                	cmp    %al,%dl
+ 265:	74 de                	je     245 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26a:	0f b6 00             	movzbl (%eax),%eax
+ 26d:	0f b6 d0             	movzbl %al,%edx
+ 270:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 273:	0f b6 00             	movzbl (%eax),%eax
+ 276:	0f b6 c0             	movzbl %al,%eax
+ 279:	29 c2                	sub    %eax,%edx
+ 27b:	89 d0                	mov    %edx,%eax
+}
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+
+0000027f <strlen>:
+{
+ 27f:	55                   	push   %ebp
+ 280:	89 e5                	mov    %esp,%ebp
+ 282:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 285:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 28c:	eb 04                	jmp    292 <strlen+0x13>
+ 28e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 292:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 295:	8b 45 08             	mov    0x8(%ebp),%eax
+ 298:	01 d0                	add    %edx,%eax
+ 29a:	0f b6 00             	movzbl (%eax),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 ed                	jne    28e <strlen+0xf>
+  return n;
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a4:	c9                   	leave
+ 2a5:	c3                   	ret
+
+000002a6 <memset>:
+{
+ 2a6:	55                   	push   %ebp
+ 2a7:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2a9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	ff 75 0c             	push   0xc(%ebp)
+ 2b0:	ff 75 08             	push   0x8(%ebp)
+ 2b3:	e8 32 ff ff ff       	call   1ea <stosb>
+ 2b8:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2be:	c9                   	leave
+ 2bf:	c3                   	ret
+
+000002c0 <strchr>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 04             	sub    $0x4,%esp
+ 2c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c9:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2cc:	eb 14                	jmp    2e2 <strchr+0x22>
+    if(*s == c)
+ 2ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d1:	0f b6 00             	movzbl (%eax),%eax
+ 2d4:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2d7:	75 05                	jne    2de <strchr+0x1e>
+      return (char*)s;
+ 2d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2dc:	eb 13                	jmp    2f1 <strchr+0x31>
+  for(; *s; s++)
+ 2de:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e5:	0f b6 00             	movzbl (%eax),%eax
+ 2e8:	84 c0                	test   %al,%al
+ 2ea:	75 e2                	jne    2ce <strchr+0xe>
+  return 0;
+ 2ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2f1:	c9                   	leave
+ 2f2:	c3                   	ret
+
+000002f3 <gets>:
+{
+ 2f3:	55                   	push   %ebp
+ 2f4:	89 e5                	mov    %esp,%ebp
+ 2f6:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 300:	eb 42                	jmp    344 <gets+0x51>
+    cc = read(0, &c, 1);
+ 302:	83 ec 04             	sub    $0x4,%esp
+ 305:	6a 01                	push   $0x1
+ 307:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 30a:	50                   	push   %eax
+ 30b:	6a 00                	push   $0x0
+ 30d:	e8 84 01 00 00       	call   496 <read>
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 318:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 31c:	7e 33                	jle    351 <gets+0x5e>
+    buf[i++] = c;
+ 31e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 321:	8d 50 01             	lea    0x1(%eax),%edx
+ 324:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 327:	89 c2                	mov    %eax,%edx
+ 329:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32c:	01 c2                	add    %eax,%edx
+ 32e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 332:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 334:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 338:	3c 0a                	cmp    $0xa,%al
+ 33a:	74 16                	je     352 <gets+0x5f>
+ 33c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 340:	3c 0d                	cmp    $0xd,%al
+ 342:	74 0e                	je     352 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 344:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 347:	83 c0 01             	add    $0x1,%eax
+ 34a:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 34d:	7f b3                	jg     302 <gets+0xf>
+ 34f:	eb 01                	jmp    352 <gets+0x5f>
+      break;
+ 351:	90                   	nop
+  }
+  buf[i] = '\0';
+ 352:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	01 d0                	add    %edx,%eax
+ 35a:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 360:	c9                   	leave
+ 361:	c3                   	ret
+
+00000362 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 362:	55                   	push   %ebp
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 368:	83 ec 08             	sub    $0x8,%esp
+ 36b:	6a 00                	push   $0x0
+ 36d:	ff 75 08             	push   0x8(%ebp)
+ 370:	e8 44 01 00 00       	call   4b9 <open>
+ 375:	83 c4 10             	add    $0x10,%esp
+ 378:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 37b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 37f:	79 07                	jns    388 <stat+0x26>
+    return -1;
+ 381:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 386:	eb 25                	jmp    3ad <stat+0x4b>
+  r = fstat(fd, st);
+ 388:	83 ec 08             	sub    $0x8,%esp
+ 38b:	ff 75 0c             	push   0xc(%ebp)
+ 38e:	ff 75 f4             	push   -0xc(%ebp)
+ 391:	e8 41 01 00 00       	call   4d7 <fstat>
+ 396:	83 c4 10             	add    $0x10,%esp
+ 399:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 39c:	83 ec 0c             	sub    $0xc,%esp
+ 39f:	ff 75 f4             	push   -0xc(%ebp)
+ 3a2:	e8 fd 00 00 00       	call   4a4 <close>
+ 3a7:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3ad:	c9                   	leave
+ 3ae:	c3                   	ret
+
+000003af <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3af:	55                   	push   %ebp
+ 3b0:	89 e5                	mov    %esp,%ebp
+ 3b2:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3bc:	eb 25                	jmp    3e3 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3be:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3c1:	89 d0                	mov    %edx,%eax
+ 3c3:	c1 e0 02             	shl    $0x2,%eax
+ 3c6:	01 d0                	add    %edx,%eax
+ 3c8:	01 c0                	add    %eax,%eax
+ 3ca:	89 c1                	mov    %eax,%ecx
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	8d 50 01             	lea    0x1(%eax),%edx
+ 3d2:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3d5:	0f b6 00             	movzbl (%eax),%eax
+ 3d8:	0f be c0             	movsbl %al,%eax
+ 3db:	01 c8                	add    %ecx,%eax
+ 3dd:	83 e8 30             	sub    $0x30,%eax
+ 3e0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 00             	movzbl (%eax),%eax
+ 3e9:	3c 2f                	cmp    $0x2f,%al
+ 3eb:	7e 0a                	jle    3f7 <atoi+0x48>
+ 3ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f0:	0f b6 00             	movzbl (%eax),%eax
+ 3f3:	3c 39                	cmp    $0x39,%al
+ 3f5:	7e c7                	jle    3be <atoi+0xf>
+  return n;
+ 3f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+
+000003fc <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3fc:	55                   	push   %ebp
+ 3fd:	89 e5                	mov    %esp,%ebp
+ 3ff:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 402:	8b 45 08             	mov    0x8(%ebp),%eax
+ 405:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 408:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 40e:	eb 17                	jmp    427 <memmove+0x2b>
+    *dst++ = *src++;
+ 410:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 413:	8d 42 01             	lea    0x1(%edx),%eax
+ 416:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 419:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 41c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 41f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 422:	0f b6 12             	movzbl (%edx),%edx
+ 425:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 427:	8b 45 10             	mov    0x10(%ebp),%eax
+ 42a:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 42d:	89 55 10             	mov    %edx,0x10(%ebp)
+ 430:	85 c0                	test   %eax,%eax
+ 432:	7f dc                	jg     410 <memmove+0x14>
+  return vdst;
+ 434:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 437:	c9                   	leave
+ 438:	c3                   	ret
+
+00000439 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 439:	83 3d dc 13 00 00 00 	cmpl   $0x0,0x13dc
+  jg 2f
+ 440:	7f 2e                	jg     470 <dosyscall+0x37>
+  jl 1f
+ 442:	7c 29                	jl     46d <dosyscall+0x34>
+  pushl %eax
+ 444:	50                   	push   %eax
+  pushl %ebx
+ 445:	53                   	push   %ebx
+  movl $1, %eax
+ 446:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 44b:	0f a2                	cpuid
+  popl %ebx
+ 44d:	5b                   	pop    %ebx
+  popl %eax
+ 44e:	58                   	pop    %eax
+  movl $-1, sysmode
+ 44f:	c7 05 dc 13 00 00 ff 	movl   $0xffffffff,0x13dc
+ 456:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 459:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 45f:	74 0c                	je     46d <dosyscall+0x34>
+  movl $1, sysmode
+ 461:	c7 05 dc 13 00 00 01 	movl   $0x1,0x13dc
+ 468:	00 00 00 
+  jmp 2f
+ 46b:	eb 03                	jmp    470 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 46d:	cd 40                	int    $0x40
+  ret
+ 46f:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 470:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 472:	ba 79 04 00 00       	mov    $0x479,%edx
+  sysenter
+ 477:	0f 34                	sysenter
+3:
+  ret
+ 479:	c3                   	ret
+
+0000047a <fork>:
+
+SYSCALL(fork)
+ 47a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47f:	eb b8                	jmp    439 <dosyscall>
+
+00000481 <exit>:
+SYSCALL(exit)
+ 481:	b8 02 00 00 00       	mov    $0x2,%eax
+ 486:	eb b1                	jmp    439 <dosyscall>
+
+00000488 <wait>:
+SYSCALL(wait)
+ 488:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48d:	eb aa                	jmp    439 <dosyscall>
+
+0000048f <pipe>:
+SYSCALL(pipe)
+ 48f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 494:	eb a3                	jmp    439 <dosyscall>
+
+00000496 <read>:
+SYSCALL(read)
+ 496:	b8 05 00 00 00       	mov    $0x5,%eax
+ 49b:	eb 9c                	jmp    439 <dosyscall>
+
+0000049d <write>:
+SYSCALL(write)
+ 49d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a2:	eb 95                	jmp    439 <dosyscall>
+
+000004a4 <close>:
+SYSCALL(close)
+ 4a4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a9:	eb 8e                	jmp    439 <dosyscall>
+
+000004ab <kill>:
+SYSCALL(kill)
+ 4ab:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b0:	eb 87                	jmp    439 <dosyscall>
+
+000004b2 <exec>:
+SYSCALL(exec)
+ 4b2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b7:	eb 80                	jmp    439 <dosyscall>
+
+000004b9 <open>:
+SYSCALL(open)
+ 4b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4be:	e9 76 ff ff ff       	jmp    439 <dosyscall>
+
+000004c3 <mknod>:
+SYSCALL(mknod)
+ 4c3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c8:	e9 6c ff ff ff       	jmp    439 <dosyscall>
+
+000004cd <unlink>:
+SYSCALL(unlink)
+ 4cd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d2:	e9 62 ff ff ff       	jmp    439 <dosyscall>
+
+000004d7 <fstat>:
+SYSCALL(fstat)
+ 4d7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4dc:	e9 58 ff ff ff       	jmp    439 <dosyscall>
+
+000004e1 <link>:
+SYSCALL(link)
+ 4e1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e6:	e9 4e ff ff ff       	jmp    439 <dosyscall>
+
+000004eb <mkdir>:
+SYSCALL(mkdir)
+ 4eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f0:	e9 44 ff ff ff       	jmp    439 <dosyscall>
+
+000004f5 <chdir>:
+SYSCALL(chdir)
+ 4f5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4fa:	e9 3a ff ff ff       	jmp    439 <dosyscall>
+
+000004ff <dup>:
+SYSCALL(dup)
+ 4ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 504:	e9 30 ff ff ff       	jmp    439 <dosyscall>
+
+00000509 <getpid>:
+SYSCALL(getpid)
+ 509:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 50e:	e9 26 ff ff ff       	jmp    439 <dosyscall>
+
+00000513 <sbrk>:
+SYSCALL(sbrk)
+ 513:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 518:	e9 1c ff ff ff       	jmp    439 <dosyscall>
+
+0000051d <sleep>:
+SYSCALL(sleep)
+ 51d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 522:	e9 12 ff ff ff       	jmp    439 <dosyscall>
+
+00000527 <uptime>:
+SYSCALL(uptime)
+ 527:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 52c:	e9 08 ff ff ff       	jmp    439 <dosyscall>
+
+00000531 <symlink>:
+SYSCALL(symlink)
+ 531:	b8 16 00 00 00       	mov    $0x16,%eax
+ 536:	e9 fe fe ff ff       	jmp    439 <dosyscall>
+
+0000053b <readlink>:
+SYSCALL(readlink)
+ 53b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 540:	e9 f4 fe ff ff       	jmp    439 <dosyscall>
+
+00000545 <fprot>:
+SYSCALL(fprot)
+ 545:	b8 18 00 00 00       	mov    $0x18,%eax
+ 54a:	e9 ea fe ff ff       	jmp    439 <dosyscall>
+
+0000054f <funprot>:
+SYSCALL(funprot)
+ 54f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 554:	e9 e0 fe ff ff       	jmp    439 <dosyscall>
+
+00000559 <funlock>:
+SYSCALL(funlock)
+ 559:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 55e:	e9 d6 fe ff ff       	jmp    439 <dosyscall>
+
+00000563 <mmap>:
+SYSCALL(mmap)
+ 563:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 568:	e9 cc fe ff ff       	jmp    439 <dosyscall>
+
+0000056d <munmap>:
+SYSCALL(munmap)
+ 56d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 572:	e9 c2 fe ff ff       	jmp    439 <dosyscall>
+
+00000577 <sendfile>:
+SYSCALL(sendfile)
+ 577:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 57c:	e9 b8 fe ff ff       	jmp    439 <dosyscall>
+
+00000581 <readv>:
+SYSCALL(readv)
+ 581:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 586:	e9 ae fe ff ff       	jmp    439 <dosyscall>
+
+0000058b <writev>:
+SYSCALL(writev)
+ 58b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 590:	e9 a4 fe ff ff       	jmp    439 <dosyscall>
+
+00000595 <pread>:
+SYSCALL(pread)
+ 595:	b8 20 00 00 00       	mov    $0x20,%eax
+ 59a:	e9 9a fe ff ff       	jmp    439 <dosyscall>
+
+0000059f <pwrite>:
+SYSCALL(pwrite)
+ 59f:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a4:	e9 90 fe ff ff       	jmp    439 <dosyscall>
+
+000005a9 <lseek>:
+SYSCALL(lseek)
+ 5a9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5ae:	e9 86 fe ff ff       	jmp    439 <dosyscall>
+
+000005b3 <spawn>:
+SYSCALL(spawn)
+ 5b3:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b8:	e9 7c fe ff ff       	jmp    439 <dosyscall>
+
+000005bd <setpriority>:
+SYSCALL(setpriority)
+ 5bd:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c2:	e9 72 fe ff ff       	jmp    439 <dosyscall>
+
+000005c7 <kthread_create>:
+SYSCALL(kthread_create)
+ 5c7:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5cc:	e9 68 fe ff ff       	jmp    439 <dosyscall>
+
+000005d1 <kthread_id>:
+SYSCALL(kthread_id)
+ 5d1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5d6:	e9 5e fe ff ff       	jmp    439 <dosyscall>
+
+000005db <kthread_exit>:
+SYSCALL(kthread_exit)
+ 5db:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e0:	e9 54 fe ff ff       	jmp    439 <dosyscall>
+
+000005e5 <kthread_join>:
+SYSCALL(kthread_join)
+ 5e5:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5ea:	e9 4a fe ff ff       	jmp    439 <dosyscall>
+
+000005ef <futex>:
+SYSCALL(futex)
+ 5ef:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5f4:	e9 40 fe ff ff       	jmp    439 <dosyscall>
+
+000005f9 <signal>:
+SYSCALL(signal)
+ 5f9:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5fe:	e9 36 fe ff ff       	jmp    439 <dosyscall>
+
+00000603 <alarm>:
+SYSCALL(alarm)
+ 603:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 608:	e9 2c fe ff ff       	jmp    439 <dosyscall>
+
+0000060d <usleep>:
+SYSCALL(usleep)
+ 60d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 612:	e9 22 fe ff ff       	jmp    439 <dosyscall>
+
+00000617 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 617:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 61c:	e9 18 fe ff ff       	jmp    439 <dosyscall>
+
+00000621 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 621:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 626:	e9 0e fe ff ff       	jmp    439 <dosyscall>
+
+0000062b <getrusage>:
+SYSCALL(getrusage)
+ 62b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 630:	e9 04 fe ff ff       	jmp    439 <dosyscall>
+
+00000635 <mount>:
+SYSCALL(mount)
+ 635:	b8 30 00 00 00       	mov    $0x30,%eax
+ 63a:	e9 fa fd ff ff       	jmp    439 <dosyscall>
+
+0000063f <getdents>:
+SYSCALL(getdents)
+ 63f:	b8 31 00 00 00       	mov    $0x31,%eax
+ 644:	e9 f0 fd ff ff       	jmp    439 <dosyscall>
+
+00000649 <yield>:
+SYSCALL(yield)
+ 649:	b8 32 00 00 00       	mov    $0x32,%eax
+ 64e:	e9 e6 fd ff ff       	jmp    439 <dosyscall>
+
+00000653 <ncpu>:
+SYSCALL(ncpu)
+ 653:	b8 33 00 00 00       	mov    $0x33,%eax
+ 658:	e9 dc fd ff ff       	jmp    439 <dosyscall>
+
+0000065d <fallocate>:
+SYSCALL(fallocate)
+ 65d:	b8 34 00 00 00       	mov    $0x34,%eax
+ 662:	e9 d2 fd ff ff       	jmp    439 <dosyscall>
+
+00000667 <ftruncate>:
+SYSCALL(ftruncate)
+ 667:	b8 35 00 00 00       	mov    $0x35,%eax
+ 66c:	e9 c8 fd ff ff       	jmp    439 <dosyscall>
+
+00000671 <fsync>:
+SYSCALL(fsync)
+ 671:	b8 36 00 00 00       	mov    $0x36,%eax
+ 676:	e9 be fd ff ff       	jmp    439 <dosyscall>
+
+0000067b <fdatasync>:
+SYSCALL(fdatasync)
+ 67b:	b8 37 00 00 00       	mov    $0x37,%eax
+ 680:	e9 b4 fd ff ff       	jmp    439 <dosyscall>
+
+00000685 <poll>:
+SYSCALL(poll)
+ 685:	b8 38 00 00 00       	mov    $0x38,%eax
+ 68a:	e9 aa fd ff ff       	jmp    439 <dosyscall>
+
+0000068f <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 68f:	55                   	push   %ebp
+ 690:	89 e5                	mov    %esp,%ebp
+ 692:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 695:	8b 45 08             	mov    0x8(%ebp),%eax
+ 698:	8b 40 04             	mov    0x4(%eax),%eax
+ 69b:	85 c0                	test   %eax,%eax
+ 69d:	7e 1f                	jle    6be <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 69f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a2:	8b 50 04             	mov    0x4(%eax),%edx
+ 6a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a8:	8d 48 08             	lea    0x8(%eax),%ecx
+ 6ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ae:	8b 00                	mov    (%eax),%eax
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	52                   	push   %edx
+ 6b4:	51                   	push   %ecx
+ 6b5:	50                   	push   %eax
+ 6b6:	e8 d0 fe ff ff       	call   58b <writev>
+ 6bb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 6be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 6d2:	00 00 00 
+}
+ 6d5:	90                   	nop
+ 6d6:	c9                   	leave
+ 6d7:	c3                   	ret
+
+000006d8 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 6d8:	55                   	push   %ebp
+ 6d9:	89 e5                	mov    %esp,%ebp
+ 6db:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 6de:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 6e2:	0f 84 94 00 00 00    	je     77c <put+0xa4>
+    return;
+  if(o->n > 0){
+ 6e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6eb:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ee:	85 c0                	test   %eax,%eax
+ 6f0:	7e 40                	jle    732 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 6f8:	83 e8 01             	sub    $0x1,%eax
+ 6fb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 702:	8b 45 08             	mov    0x8(%ebp),%eax
+ 705:	01 d0                	add    %edx,%eax
+ 707:	83 c0 08             	add    $0x8,%eax
+ 70a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 70d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 710:	8b 10                	mov    (%eax),%edx
+ 712:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 715:	8b 40 04             	mov    0x4(%eax),%eax
+ 718:	01 d0                	add    %edx,%eax
+ 71a:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 71d:	75 13                	jne    732 <put+0x5a>
+      v->iov_len += n;
+ 71f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 722:	8b 50 04             	mov    0x4(%eax),%edx
+ 725:	8b 45 10             	mov    0x10(%ebp),%eax
+ 728:	01 c2                	add    %eax,%edx
+ 72a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72d:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 730:	eb 4b                	jmp    77d <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 732:	8b 45 08             	mov    0x8(%ebp),%eax
+ 735:	8b 40 04             	mov    0x4(%eax),%eax
+ 738:	83 f8 10             	cmp    $0x10,%eax
+ 73b:	75 0e                	jne    74b <put+0x73>
+    flush(o);
+ 73d:	83 ec 0c             	sub    $0xc,%esp
+ 740:	ff 75 08             	push   0x8(%ebp)
+ 743:	e8 47 ff ff ff       	call   68f <flush>
+ 748:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 74b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74e:	8b 50 04             	mov    0x4(%eax),%edx
+ 751:	8b 45 08             	mov    0x8(%ebp),%eax
+ 754:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 757:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 75b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75e:	8b 50 04             	mov    0x4(%eax),%edx
+ 761:	8b 45 08             	mov    0x8(%ebp),%eax
+ 764:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 767:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 76b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76e:	8b 40 04             	mov    0x4(%eax),%eax
+ 771:	8d 50 01             	lea    0x1(%eax),%edx
+ 774:	8b 45 08             	mov    0x8(%ebp),%eax
+ 777:	89 50 04             	mov    %edx,0x4(%eax)
+ 77a:	eb 01                	jmp    77d <put+0xa5>
+    return;
+ 77c:	90                   	nop
+}
+ 77d:	c9                   	leave
+ 77e:	c3                   	ret
+
+0000077f <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 77f:	55                   	push   %ebp
+ 780:	89 e5                	mov    %esp,%ebp
+ 782:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 785:	8b 45 08             	mov    0x8(%ebp),%eax
+ 788:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 78e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 791:	01 d0                	add    %edx,%eax
+ 793:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 798:	77 0b                	ja     7a5 <room+0x26>
+ 79a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79d:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a0:	83 f8 10             	cmp    $0x10,%eax
+ 7a3:	75 0e                	jne    7b3 <room+0x34>
+    flush(o);
+ 7a5:	83 ec 0c             	sub    $0xc,%esp
+ 7a8:	ff 75 08             	push   0x8(%ebp)
+ 7ab:	e8 df fe ff ff       	call   68f <flush>
+ 7b0:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b6:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 7bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bf:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7c5:	01 d0                	add    %edx,%eax
+}
+ 7c7:	c9                   	leave
+ 7c8:	c3                   	ret
+
+000007c9 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 7c9:	55                   	push   %ebp
+ 7ca:	89 e5                	mov    %esp,%ebp
+ 7cc:	83 ec 28             	sub    $0x28,%esp
+ 7cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d2:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 7d5:	83 ec 08             	sub    $0x8,%esp
+ 7d8:	6a 01                	push   $0x1
+ 7da:	ff 75 08             	push   0x8(%ebp)
+ 7dd:	e8 9d ff ff ff       	call   77f <room>
+ 7e2:	83 c4 10             	add    $0x10,%esp
+ 7e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 7e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7eb:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 7ef:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 7f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7fa:	8d 50 01             	lea    0x1(%eax),%edx
+ 7fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 800:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 806:	83 ec 04             	sub    $0x4,%esp
+ 809:	6a 01                	push   $0x1
+ 80b:	ff 75 f4             	push   -0xc(%ebp)
+ 80e:	ff 75 08             	push   0x8(%ebp)
+ 811:	e8 c2 fe ff ff       	call   6d8 <put>
+ 816:	83 c4 10             	add    $0x10,%esp
+}
+ 819:	90                   	nop
+ 81a:	c9                   	leave
+ 81b:	c3                   	ret
+
+0000081c <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 81c:	55                   	push   %ebp
+ 81d:	89 e5                	mov    %esp,%ebp
+ 81f:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 822:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 829:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 82d:	74 17                	je     846 <printint+0x2a>
+ 82f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 833:	79 11                	jns    846 <printint+0x2a>
+    neg = 1;
+ 835:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 83c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 83f:	f7 d8                	neg    %eax
+ 841:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 844:	eb 06                	jmp    84c <printint+0x30>
+  } else {
+    x = xx;
+ 846:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 849:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 84c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 853:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 856:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 859:	ba 00 00 00 00       	mov    $0x0,%edx
+ 85e:	f7 f1                	div    %ecx
+ 860:	89 d1                	mov    %edx,%ecx
+ 862:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 865:	8d 50 01             	lea    0x1(%eax),%edx
+ 868:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 86b:	0f b6 91 e0 13 00 00 	movzbl 0x13e0(%ecx),%edx
+ 872:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 876:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 879:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 87c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 881:	f7 f1                	div    %ecx
+ 883:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 886:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 88a:	75 c7                	jne    853 <printint+0x37>
+  if(neg)
+ 88c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 890:	74 0e                	je     8a0 <printint+0x84>
+    buf[i++] = '-';
+ 892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 895:	8d 50 01             	lea    0x1(%eax),%edx
+ 898:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 89b:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 8a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 8a6:	83 ec 08             	sub    $0x8,%esp
+ 8a9:	ff 75 e8             	push   -0x18(%ebp)
+ 8ac:	ff 75 08             	push   0x8(%ebp)
+ 8af:	e8 cb fe ff ff       	call   77f <room>
+ 8b4:	83 c4 10             	add    $0x10,%esp
+ 8b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 8ba:	eb 1d                	jmp    8d9 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 8bc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8bf:	83 e8 01             	sub    $0x1,%eax
+ 8c2:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8c5:	89 c2                	mov    %eax,%edx
+ 8c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ca:	01 c2                	add    %eax,%edx
+ 8cc:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 8cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d2:	01 c8                	add    %ecx,%eax
+ 8d4:	0f b6 00             	movzbl (%eax),%eax
+ 8d7:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 8d9:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8e1:	79 d9                	jns    8bc <printint+0xa0>
+  o->used += n;
+ 8e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e6:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 8ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ef:	01 c2                	add    %eax,%edx
+ 8f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f4:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 8fa:	83 ec 04             	sub    $0x4,%esp
+ 8fd:	ff 75 e8             	push   -0x18(%ebp)
+ 900:	ff 75 e4             	push   -0x1c(%ebp)
+ 903:	ff 75 08             	push   0x8(%ebp)
+ 906:	e8 cd fd ff ff       	call   6d8 <put>
+ 90b:	83 c4 10             	add    $0x10,%esp
+}
+ 90e:	90                   	nop
+ 90f:	c9                   	leave
+ 910:	c3                   	ret
+
+00000911 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 911:	55                   	push   %ebp
+ 912:	89 e5                	mov    %esp,%ebp
+ 914:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 91a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 923:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 92a:	00 00 00 
+  o.used = 0;
+ 92d:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 934:	00 00 00 
+  state = 0;
+ 937:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 93e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 941:	83 c0 04             	add    $0x4,%eax
+ 944:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 947:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 94e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 955:	e9 82 01 00 00       	jmp    adc <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 95a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 960:	01 d0                	add    %edx,%eax
+ 962:	0f b6 00             	movzbl (%eax),%eax
+ 965:	0f be c0             	movsbl %al,%eax
+ 968:	25 ff 00 00 00       	and    $0xff,%eax
+ 96d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 970:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 974:	75 38                	jne    9ae <printf+0x9d>
+      if(c == '%'){
+ 976:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 97a:	0f 85 58 01 00 00    	jne    ad8 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 980:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 983:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 986:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 989:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 98c:	01 ca                	add    %ecx,%edx
+ 98e:	83 ec 04             	sub    $0x4,%esp
+ 991:	50                   	push   %eax
+ 992:	52                   	push   %edx
+ 993:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 999:	50                   	push   %eax
+ 99a:	e8 39 fd ff ff       	call   6d8 <put>
+ 99f:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 9a2:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 9a9:	e9 2a 01 00 00       	jmp    ad8 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 9ae:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 9b2:	0f 85 20 01 00 00    	jne    ad8 <printf+0x1c7>
+      if(c == 'd'){
+ 9b8:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 9bc:	75 22                	jne    9e0 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 9be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c1:	8b 00                	mov    (%eax),%eax
+ 9c3:	6a 01                	push   $0x1
+ 9c5:	6a 0a                	push   $0xa
+ 9c7:	50                   	push   %eax
+ 9c8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9ce:	50                   	push   %eax
+ 9cf:	e8 48 fe ff ff       	call   81c <printint>
+ 9d4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9d7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9db:	e9 e8 00 00 00       	jmp    ac8 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 9e0:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 9e4:	74 06                	je     9ec <printf+0xdb>
+ 9e6:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 9ea:	75 22                	jne    a0e <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 9ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ef:	8b 00                	mov    (%eax),%eax
+ 9f1:	6a 00                	push   $0x0
+ 9f3:	6a 10                	push   $0x10
+ 9f5:	50                   	push   %eax
+ 9f6:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9fc:	50                   	push   %eax
+ 9fd:	e8 1a fe ff ff       	call   81c <printint>
+ a02:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a05:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a09:	e9 ba 00 00 00       	jmp    ac8 <printf+0x1b7>
+      } else if(c == 's'){
+ a0e:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ a12:	75 3f                	jne    a53 <printf+0x142>
+        s = (char*)*ap;
+ a14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a17:	8b 00                	mov    (%eax),%eax
+ a19:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a1c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ a20:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a24:	75 07                	jne    a2d <printf+0x11c>
+          s = "(null)";
+ a26:	c7 45 f4 2a 10 00 00 	movl   $0x102a,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a2d:	83 ec 0c             	sub    $0xc,%esp
+ a30:	ff 75 f4             	push   -0xc(%ebp)
+ a33:	e8 47 f8 ff ff       	call   27f <strlen>
+ a38:	83 c4 10             	add    $0x10,%esp
+ a3b:	83 ec 04             	sub    $0x4,%esp
+ a3e:	50                   	push   %eax
+ a3f:	ff 75 f4             	push   -0xc(%ebp)
+ a42:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a48:	50                   	push   %eax
+ a49:	e8 8a fc ff ff       	call   6d8 <put>
+ a4e:	83 c4 10             	add    $0x10,%esp
+ a51:	eb 75                	jmp    ac8 <printf+0x1b7>
+      } else if(c == 'c'){
+ a53:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a57:	75 21                	jne    a7a <printf+0x169>
+        putc(&o, *ap);
+ a59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a5c:	8b 00                	mov    (%eax),%eax
+ a5e:	0f be c0             	movsbl %al,%eax
+ a61:	83 ec 08             	sub    $0x8,%esp
+ a64:	50                   	push   %eax
+ a65:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a6b:	50                   	push   %eax
+ a6c:	e8 58 fd ff ff       	call   7c9 <putc>
+ a71:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a74:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a78:	eb 4e                	jmp    ac8 <printf+0x1b7>
+      } else if(c == '%'){
+ a7a:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a7e:	75 1b                	jne    a9b <printf+0x18a>
+        putc(&o, c);
+ a80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a83:	0f be c0             	movsbl %al,%eax
+ a86:	83 ec 08             	sub    $0x8,%esp
+ a89:	50                   	push   %eax
+ a8a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a90:	50                   	push   %eax
+ a91:	e8 33 fd ff ff       	call   7c9 <putc>
+ a96:	83 c4 10             	add    $0x10,%esp
+ a99:	eb 2d                	jmp    ac8 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a9b:	83 ec 08             	sub    $0x8,%esp
+ a9e:	6a 25                	push   $0x25
+ aa0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ aa6:	50                   	push   %eax
+ aa7:	e8 1d fd ff ff       	call   7c9 <putc>
+ aac:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ aaf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ab2:	0f be c0             	movsbl %al,%eax
+ ab5:	83 ec 08             	sub    $0x8,%esp
+ ab8:	50                   	push   %eax
+ ab9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ abf:	50                   	push   %eax
+ ac0:	e8 04 fd ff ff       	call   7c9 <putc>
+ ac5:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ ac8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ acf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ad2:	83 c0 01             	add    $0x1,%eax
+ ad5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ad8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ adc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ adf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae2:	01 d0                	add    %edx,%eax
+ ae4:	0f b6 00             	movzbl (%eax),%eax
+ ae7:	84 c0                	test   %al,%al
+ ae9:	0f 85 6b fe ff ff    	jne    95a <printf+0x49>
+    }
+  }
+  if(state == 0)
+ aef:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ af3:	75 22                	jne    b17 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ af5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ afb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ afe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b01:	01 ca                	add    %ecx,%edx
+ b03:	83 ec 04             	sub    $0x4,%esp
+ b06:	50                   	push   %eax
+ b07:	52                   	push   %edx
+ b08:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b0e:	50                   	push   %eax
+ b0f:	e8 c4 fb ff ff       	call   6d8 <put>
+ b14:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b20:	50                   	push   %eax
+ b21:	e8 69 fb ff ff       	call   68f <flush>
+ b26:	83 c4 10             	add    $0x10,%esp
+}
+ b29:	90                   	nop
+ b2a:	c9                   	leave
+ b2b:	c3                   	ret
+
+00000b2c <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b2c:	55                   	push   %ebp
+ b2d:	89 e5                	mov    %esp,%ebp
+ b2f:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b32:	8b 55 08             	mov    0x8(%ebp),%edx
+ b35:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b3b:	f0 87 02             	lock xchg %eax,(%edx)
+ b3e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b44:	c9                   	leave
+ b45:	c3                   	ret
+
+00000b46 <lock>:
+{
+ b46:	55                   	push   %ebp
+ b47:	89 e5                	mov    %esp,%ebp
+ b49:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b4c:	a1 00 1c 00 00       	mov    0x1c00,%eax
+ b51:	85 c0                	test   %eax,%eax
+ b53:	74 09                	je     b5e <lock+0x18>
+ b55:	a1 00 1c 00 00       	mov    0x1c00,%eax
+ b5a:	ff d0                	call   *%eax
+ b5c:	eb 05                	jmp    b63 <lock+0x1d>
+ b5e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b63:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b66:	90                   	nop
+ b67:	83 ec 08             	sub    $0x8,%esp
+ b6a:	6a 01                	push   $0x1
+ b6c:	68 38 1c 00 00       	push   $0x1c38
+ b71:	e8 b6 ff ff ff       	call   b2c <xchg>
+ b76:	83 c4 10             	add    $0x10,%esp
+ b79:	85 c0                	test   %eax,%eax
+ b7b:	75 ea                	jne    b67 <lock+0x21>
+  return pin;
+ b7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b80:	c9                   	leave
+ b81:	c3                   	ret
+
+00000b82 <unlock>:
+{
+ b82:	55                   	push   %ebp
+ b83:	89 e5                	mov    %esp,%ebp
+ b85:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b88:	6a 00                	push   $0x0
+ b8a:	68 38 1c 00 00       	push   $0x1c38
+ b8f:	e8 98 ff ff ff       	call   b2c <xchg>
+ b94:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b97:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b9b:	78 10                	js     bad <unlock+0x2b>
+    mallocunpin(pin);
+ b9d:	a1 04 1c 00 00       	mov    0x1c04,%eax
+ ba2:	83 ec 0c             	sub    $0xc,%esp
+ ba5:	ff 75 08             	push   0x8(%ebp)
+ ba8:	ff d0                	call   *%eax
+ baa:	83 c4 10             	add    $0x10,%esp
+}
+ bad:	90                   	nop
+ bae:	c9                   	leave
+ baf:	c3                   	ret
+
+00000bb0 <sizeclass>:
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ bb6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ bbd:	eb 1c                	jmp    bdb <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ bbf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc2:	ba 02 00 00 00       	mov    $0x2,%edx
+ bc7:	89 c1                	mov    %eax,%ecx
+ bc9:	d3 e2                	shl    %cl,%edx
+ bcb:	89 d0                	mov    %edx,%eax
+ bcd:	3b 45 08             	cmp    0x8(%ebp),%eax
+ bd0:	72 05                	jb     bd7 <sizeclass+0x27>
+      return c;
+ bd2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd5:	eb 0f                	jmp    be6 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ bd7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ bdb:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ bdf:	7e de                	jle    bbf <sizeclass+0xf>
+  return -1;
+ be1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ be6:	c9                   	leave
+ be7:	c3                   	ret
+
+00000be8 <bigfree>:
+{
+ be8:	55                   	push   %ebp
+ be9:	89 e5                	mov    %esp,%ebp
+ beb:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bee:	a1 10 1c 00 00       	mov    0x1c10,%eax
+ bf3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bf6:	eb 24                	jmp    c1c <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfb:	8b 00                	mov    (%eax),%eax
+ bfd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c00:	72 12                	jb     c14 <bigfree+0x2c>
+ c02:	8b 45 08             	mov    0x8(%ebp),%eax
+ c05:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c08:	72 24                	jb     c2e <bigfree+0x46>
+ c0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0d:	8b 00                	mov    (%eax),%eax
+ c0f:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c12:	72 1a                	jb     c2e <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c17:	8b 00                	mov    (%eax),%eax
+ c19:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c22:	73 d4                	jae    bf8 <bigfree+0x10>
+ c24:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c27:	8b 00                	mov    (%eax),%eax
+ c29:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c2c:	73 ca                	jae    bf8 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c31:	8b 40 04             	mov    0x4(%eax),%eax
+ c34:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3e:	01 c2                	add    %eax,%edx
+ c40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c43:	8b 00                	mov    (%eax),%eax
+ c45:	39 c2                	cmp    %eax,%edx
+ c47:	75 24                	jne    c6d <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c49:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4c:	8b 50 04             	mov    0x4(%eax),%edx
+ c4f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c52:	8b 00                	mov    (%eax),%eax
+ c54:	8b 40 04             	mov    0x4(%eax),%eax
+ c57:	01 c2                	add    %eax,%edx
+ c59:	8b 45 08             	mov    0x8(%ebp),%eax
+ c5c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c62:	8b 00                	mov    (%eax),%eax
+ c64:	8b 10                	mov    (%eax),%edx
+ c66:	8b 45 08             	mov    0x8(%ebp),%eax
+ c69:	89 10                	mov    %edx,(%eax)
+ c6b:	eb 0a                	jmp    c77 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c70:	8b 10                	mov    (%eax),%edx
+ c72:	8b 45 08             	mov    0x8(%ebp),%eax
+ c75:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7a:	8b 40 04             	mov    0x4(%eax),%eax
+ c7d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c84:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c87:	01 d0                	add    %edx,%eax
+ c89:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c8c:	75 20                	jne    cae <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ c8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c91:	8b 50 04             	mov    0x4(%eax),%edx
+ c94:	8b 45 08             	mov    0x8(%ebp),%eax
+ c97:	8b 40 04             	mov    0x4(%eax),%eax
+ c9a:	01 c2                	add    %eax,%edx
+ c9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c9f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca5:	8b 10                	mov    (%eax),%edx
+ ca7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ caa:	89 10                	mov    %edx,(%eax)
+ cac:	eb 08                	jmp    cb6 <bigfree+0xce>
+    p->s.ptr = bp;
+ cae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb1:	8b 55 08             	mov    0x8(%ebp),%edx
+ cb4:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ cb6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb9:	a3 10 1c 00 00       	mov    %eax,0x1c10
+}
+ cbe:	90                   	nop
+ cbf:	c9                   	leave
+ cc0:	c3                   	ret
+
+00000cc1 <free>:
+{
+ cc1:	55                   	push   %ebp
+ cc2:	89 e5                	mov    %esp,%ebp
+ cc4:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ cc7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ccb:	74 68                	je     d35 <free+0x74>
+  bp = (Header*)ap - 1;
+ ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd0:	83 e8 08             	sub    $0x8,%eax
+ cd3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ cd6:	e8 6b fe ff ff       	call   b46 <lock>
+ cdb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce1:	8b 40 04             	mov    0x4(%eax),%eax
+ ce4:	83 ec 0c             	sub    $0xc,%esp
+ ce7:	50                   	push   %eax
+ ce8:	e8 c3 fe ff ff       	call   bb0 <sizeclass>
+ ced:	83 c4 10             	add    $0x10,%esp
+ cf0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ cf3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ cf7:	78 1e                	js     d17 <free+0x56>
+    bp->s.ptr = classfree[c];
+ cf9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cfc:	8b 14 85 14 1c 00 00 	mov    0x1c14(,%eax,4),%edx
+ d03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d06:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ d08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d0b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d0e:	89 14 85 14 1c 00 00 	mov    %edx,0x1c14(,%eax,4)
+ d15:	eb 0e                	jmp    d25 <free+0x64>
+    bigfree(bp);
+ d17:	83 ec 0c             	sub    $0xc,%esp
+ d1a:	ff 75 f4             	push   -0xc(%ebp)
+ d1d:	e8 c6 fe ff ff       	call   be8 <bigfree>
+ d22:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d25:	83 ec 0c             	sub    $0xc,%esp
+ d28:	ff 75 f0             	push   -0x10(%ebp)
+ d2b:	e8 52 fe ff ff       	call   b82 <unlock>
+ d30:	83 c4 10             	add    $0x10,%esp
+ d33:	eb 01                	jmp    d36 <free+0x75>
+    return;
+ d35:	90                   	nop
+}
+ d36:	c9                   	leave
+ d37:	c3                   	ret
+
+00000d38 <morecore>:
+{
+ d38:	55                   	push   %ebp
+ d39:	89 e5                	mov    %esp,%ebp
+ d3b:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d3e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d45:	77 07                	ja     d4e <morecore+0x16>
+    nu = 4096;
+ d47:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d51:	c1 e0 03             	shl    $0x3,%eax
+ d54:	83 ec 0c             	sub    $0xc,%esp
+ d57:	50                   	push   %eax
+ d58:	e8 b6 f7 ff ff       	call   513 <sbrk>
+ d5d:	83 c4 10             	add    $0x10,%esp
+ d60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d63:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d67:	75 07                	jne    d70 <morecore+0x38>
+    return 0;
+ d69:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6e:	eb 22                	jmp    d92 <morecore+0x5a>
+  hp = (Header*)p;
+ d70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d73:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d79:	8b 55 08             	mov    0x8(%ebp),%edx
+ d7c:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d7f:	83 ec 0c             	sub    $0xc,%esp
+ d82:	ff 75 f0             	push   -0x10(%ebp)
+ d85:	e8 5e fe ff ff       	call   be8 <bigfree>
+ d8a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d8d:	a1 10 1c 00 00       	mov    0x1c10,%eax
+}
+ d92:	c9                   	leave
+ d93:	c3                   	ret
+
+00000d94 <bigalloc>:
+{
+ d94:	55                   	push   %ebp
+ d95:	89 e5                	mov    %esp,%ebp
+ d97:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d9a:	a1 10 1c 00 00       	mov    0x1c10,%eax
+ d9f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ da2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ da6:	75 23                	jne    dcb <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ da8:	c7 45 f0 08 1c 00 00 	movl   $0x1c08,-0x10(%ebp)
+ daf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db2:	a3 10 1c 00 00       	mov    %eax,0x1c10
+ db7:	a1 10 1c 00 00       	mov    0x1c10,%eax
+ dbc:	a3 08 1c 00 00       	mov    %eax,0x1c08
+    base.s.size = 0;
+ dc1:	c7 05 0c 1c 00 00 00 	movl   $0x0,0x1c0c
+ dc8:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dcb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dce:	8b 00                	mov    (%eax),%eax
+ dd0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ dd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dd6:	8b 40 04             	mov    0x4(%eax),%eax
+ dd9:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ddc:	72 4a                	jb     e28 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ dde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de1:	8b 40 04             	mov    0x4(%eax),%eax
+ de4:	39 45 08             	cmp    %eax,0x8(%ebp)
+ de7:	75 0c                	jne    df5 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ de9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dec:	8b 10                	mov    (%eax),%edx
+ dee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df1:	89 10                	mov    %edx,(%eax)
+ df3:	eb 26                	jmp    e1b <bigalloc+0x87>
+        p->s.size -= nunits;
+ df5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df8:	8b 40 04             	mov    0x4(%eax),%eax
+ dfb:	2b 45 08             	sub    0x8(%ebp),%eax
+ dfe:	89 c2                	mov    %eax,%edx
+ e00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e03:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e09:	8b 40 04             	mov    0x4(%eax),%eax
+ e0c:	c1 e0 03             	shl    $0x3,%eax
+ e0f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e15:	8b 55 08             	mov    0x8(%ebp),%edx
+ e18:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ e1b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e1e:	a3 10 1c 00 00       	mov    %eax,0x1c10
+      return p;
+ e23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e26:	eb 3b                	jmp    e63 <bigalloc+0xcf>
+    if(p == freep)
+ e28:	a1 10 1c 00 00       	mov    0x1c10,%eax
+ e2d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e30:	75 1e                	jne    e50 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e32:	83 ec 0c             	sub    $0xc,%esp
+ e35:	ff 75 08             	push   0x8(%ebp)
+ e38:	e8 fb fe ff ff       	call   d38 <morecore>
+ e3d:	83 c4 10             	add    $0x10,%esp
+ e40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e43:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e47:	75 07                	jne    e50 <bigalloc+0xbc>
+        return 0;
+ e49:	b8 00 00 00 00       	mov    $0x0,%eax
+ e4e:	eb 13                	jmp    e63 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e53:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e59:	8b 00                	mov    (%eax),%eax
+ e5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e5e:	e9 70 ff ff ff       	jmp    dd3 <bigalloc+0x3f>
+}
+ e63:	c9                   	leave
+ e64:	c3                   	ret
+
+00000e65 <alloc>:
+alloc(uint nbytes)
+{
+ e65:	55                   	push   %ebp
+ e66:	89 e5                	mov    %esp,%ebp
+ e68:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e6b:	8b 45 08             	mov    0x8(%ebp),%eax
+ e6e:	83 c0 07             	add    $0x7,%eax
+ e71:	c1 e8 03             	shr    $0x3,%eax
+ e74:	83 c0 01             	add    $0x1,%eax
+ e77:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e7a:	ff 75 f4             	push   -0xc(%ebp)
+ e7d:	e8 2e fd ff ff       	call   bb0 <sizeclass>
+ e82:	83 c4 04             	add    $0x4,%esp
+ e85:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e88:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e8c:	79 2c                	jns    eba <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ e8e:	83 ec 0c             	sub    $0xc,%esp
+ e91:	ff 75 f4             	push   -0xc(%ebp)
+ e94:	e8 fb fe ff ff       	call   d94 <bigalloc>
+ e99:	83 c4 10             	add    $0x10,%esp
+ e9c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e9f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ea3:	75 0a                	jne    eaf <alloc+0x4a>
+      return 0;
+ ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+ eaa:	e9 c8 00 00 00       	jmp    f77 <alloc+0x112>
+    return (void*)(p + 1);
+ eaf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eb2:	83 c0 08             	add    $0x8,%eax
+ eb5:	e9 bd 00 00 00       	jmp    f77 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ eba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ebd:	8b 04 85 14 1c 00 00 	mov    0x1c14(,%eax,4),%eax
+ ec4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ec7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ecb:	74 1a                	je     ee7 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ ecd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ed0:	8b 10                	mov    (%eax),%edx
+ ed2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ed5:	89 14 85 14 1c 00 00 	mov    %edx,0x1c14(,%eax,4)
+    return (void*)(p + 1);
+ edc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ edf:	83 c0 08             	add    $0x8,%eax
+ ee2:	e9 90 00 00 00       	jmp    f77 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ ee7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eea:	ba 02 00 00 00       	mov    $0x2,%edx
+ eef:	89 c1                	mov    %eax,%ecx
+ ef1:	d3 e2                	shl    %cl,%edx
+ ef3:	89 d0                	mov    %edx,%eax
+ ef5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ef8:	a1 30 1c 00 00       	mov    0x1c30,%eax
+ efd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f00:	c1 e2 03             	shl    $0x3,%edx
+ f03:	01 d0                	add    %edx,%eax
+ f05:	8b 15 34 1c 00 00    	mov    0x1c34,%edx
+ f0b:	39 c2                	cmp    %eax,%edx
+ f0d:	73 3f                	jae    f4e <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ f0f:	83 ec 0c             	sub    $0xc,%esp
+ f12:	68 00 08 00 00       	push   $0x800
+ f17:	e8 78 fe ff ff       	call   d94 <bigalloc>
+ f1c:	83 c4 10             	add    $0x10,%esp
+ f1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ f22:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f26:	75 07                	jne    f2f <alloc+0xca>
+      return 0;
+ f28:	b8 00 00 00 00       	mov    $0x0,%eax
+ f2d:	eb 48                	jmp    f77 <alloc+0x112>
+    bump = (char*)p;
+ f2f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f32:	a3 30 1c 00 00       	mov    %eax,0x1c30
+    bumpend = (char*)(p + p->s.size);
+ f37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f3a:	8b 40 04             	mov    0x4(%eax),%eax
+ f3d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f47:	01 d0                	add    %edx,%eax
+ f49:	a3 34 1c 00 00       	mov    %eax,0x1c34
+  }
+  p = (Header*)bump;
+ f4e:	a1 30 1c 00 00       	mov    0x1c30,%eax
+ f53:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f56:	a1 30 1c 00 00       	mov    0x1c30,%eax
+ f5b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f5e:	c1 e2 03             	shl    $0x3,%edx
+ f61:	01 d0                	add    %edx,%eax
+ f63:	a3 30 1c 00 00       	mov    %eax,0x1c30
+  p->s.size = nunits;
+ f68:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f6b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f6e:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f74:	83 c0 08             	add    $0x8,%eax
+}
+ f77:	c9                   	leave
+ f78:	c3                   	ret
+
+00000f79 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f79:	55                   	push   %ebp
+ f7a:	89 e5                	mov    %esp,%ebp
+ f7c:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f7f:	e8 c2 fb ff ff       	call   b46 <lock>
+ f84:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f87:	83 ec 0c             	sub    $0xc,%esp
+ f8a:	ff 75 08             	push   0x8(%ebp)
+ f8d:	e8 d3 fe ff ff       	call   e65 <alloc>
+ f92:	83 c4 10             	add    $0x10,%esp
+ f95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f98:	83 ec 0c             	sub    $0xc,%esp
+ f9b:	ff 75 f4             	push   -0xc(%ebp)
+ f9e:	e8 df fb ff ff       	call   b82 <unlock>
+ fa3:	83 c4 10             	add    $0x10,%esp
+  return p;
+ fa6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fa9:	c9                   	leave
+ faa:	c3                   	ret
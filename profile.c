@@ -0,0 +1,60 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Run a command with the sampling profiler on, and print the
+// samples it takes, while it runs, for profsym.pl.
+
+char buf[2048];
+
+// Copy the samples waiting in /dev/prof to standard output.
+void
+drain(int fd)
+{
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    write(1, buf, n);
+}
+
+int
+main(int argc, char **argv)
+{
+  int fd, pid, reader, w;
+
+  if(argc < 3){
+    printf(2, "usage: profile rate cmd [arg...]\n");
+    exit();
+  }
+  if((fd = open("/dev/prof", O_RDWR)) < 0){
+    printf(2, "profile: cannot open /dev/prof\n");
+    exit();
+  }
+  drain(fd);  // samples from before
+  if(write(fd, argv[1], strlen(argv[1])) < 0){
+    printf(2, "profile: bad rate %s\n", argv[1]);
+    exit();
+  }
+
+  if((pid = spawn(argv[2], argv+2, 0, 0)) < 0){
+    printf(2, "profile: spawn %s failed\n", argv[2]);
+    write(fd, "0", 1);
+    exit();
+  }
+  // A reader keeps the rings from filling up while the command runs.
+  if((reader = fork()) == 0){
+    for(;;){
+      drain(fd);
+      sleep(1);
+    }
+  }
+  while((w = wait()) >= 0 && w != pid)
+    ;
+  write(fd, "0", 1);
+  kill(reader);
+  wait();
+  drain(fd);
+  close(fd);
+  exit();
+}
@@ -0,0 +1,77 @@
+#!/usr/bin/perl
+
+# Turn the samples that the profile program prints into the folded
+# stacks that flame graph tools read, one line per distinct stack:
+#
+#   process;outer;...;inner count
+#
+# Kernel frames are named from kernel.sym and user frames from
+# prog.sym, for a process named prog, both as the Makefile leaves
+# them in the build directory (-d, default .).  Lines of the input
+# other than samples are ignored, so it can be a console log.
+
+$dir = ".";
+if(@ARGV >= 2 && $ARGV[0] eq "-d"){
+	shift @ARGV;
+	$dir = shift @ARGV;
+}
+
+# Read the symbol table in file, sorted by address.
+sub loadsyms {
+	my($file) = @_;
+	my(@syms);
+
+	open(SYM, "<", $file) || return [];
+	while(<SYM>){
+		push @syms, [hex($1), $2] if /^([0-9a-f]+) (\S+)$/;
+	}
+	close(SYM);
+	@syms = sort { $a->[0] <=> $b->[0] } @syms;
+	return \@syms;
+}
+
+# Name the function holding pc in syms.
+sub lookup {
+	my($syms, $pc) = @_;
+	my($lo, $hi, $mid);
+
+	$lo = 0;
+	$hi = @$syms;
+	while($lo < $hi){
+		$mid = int(($lo + $hi) / 2);
+		if($syms->[$mid][0] <= $pc){
+			$lo = $mid + 1;
+		}else{
+			$hi = $mid;
+		}
+	}
+	return sprintf("0x%x", $pc) if $lo == 0;
+	return $syms->[$lo-1][1];
+}
+
+$ksyms = loadsyms("$dir/kernel.sym");
+while(<>){
+	if(/^D (\d+) (\d+)/){
+		$dropped += $2;
+		next;
+	}
+	next unless /^S (\d+) (\d+) (\S+) ([ku])((?: [0-9a-f]+)+)\s*$/;
+	($name, $mode, @pcs) = ($3, $4, split(' ', $5));
+	if($mode eq "k"){
+		$syms = $ksyms;
+	}else{
+		$usyms{$name} = loadsyms("$dir/$name.sym") unless exists $usyms{$name};
+		$syms = $usyms{$name};
+	}
+	@frames = ();
+	for($i = 0; $i < @pcs; $i++){
+		# Callers' pcs are return addresses, just past the call.
+		unshift @frames, lookup($syms, hex($pcs[$i]) - ($i > 0));
+	}
+	unshift @frames, "[kernel]" if $mode eq "k";
+	$count{join(";", $name, @frames)}++;
+}
+foreach $stack (sort keys %count){
+	print "$stack $count{$stack}\n";
+}
+print STDERR "profsym: $dropped samples dropped\n" if $dropped;
@@ -0,0 +1,2030 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rm>:
+#include "dent.h"
+
+// Remove path, and with recurse everything under it first.
+static int
+rm(char *path, int recurse)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	81 ec a8 01 00 00    	sub    $0x1a8,%esp
+  char buf[MAXPATH], *p;
+  struct dent d[4];
+  struct stat st;
+  int fd, i, n, r;
+
+  if(!recurse || (fd = open(path, O_IGNLINK)) < 0)
+       9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+       d:	74 1c                	je     2b <rm+0x2b>
+       f:	83 ec 08             	sub    $0x8,%esp
+      12:	68 00 10 00 00       	push   $0x1000
+      17:	ff 75 08             	push   0x8(%ebp)
+      1a:	e8 7b 05 00 00       	call   59a <open>
+      1f:	83 c4 10             	add    $0x10,%esp
+      22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      25:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+      29:	79 13                	jns    3e <rm+0x3e>
+    return unlink(path);
+      2b:	83 ec 0c             	sub    $0xc,%esp
+      2e:	ff 75 08             	push   0x8(%ebp)
+      31:	e8 78 05 00 00       	call   5ae <unlink>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	e9 c0 01 00 00       	jmp    1fe <rm+0x1fe>
+  if(fstat(fd, &st) < 0 || st.type != T_DIR ||
+      3e:	83 ec 08             	sub    $0x8,%esp
+      41:	8d 85 60 fe ff ff    	lea    -0x1a0(%ebp),%eax
+      47:	50                   	push   %eax
+      48:	ff 75 ec             	push   -0x14(%ebp)
+      4b:	e8 68 05 00 00       	call   5b8 <fstat>
+      50:	83 c4 10             	add    $0x10,%esp
+      53:	85 c0                	test   %eax,%eax
+      55:	78 25                	js     7c <rm+0x7c>
+      57:	0f b7 85 60 fe ff ff 	movzwl -0x1a0(%ebp),%eax
+      5e:	66 83 f8 01          	cmp    $0x1,%ax
+      62:	75 18                	jne    7c <rm+0x7c>
+     strlen(path) + 1 + DIRSIZ + 1 > sizeof(buf)){
+      64:	83 ec 0c             	sub    $0xc,%esp
+      67:	ff 75 08             	push   0x8(%ebp)
+      6a:	e8 f1 02 00 00       	call   360 <strlen>
+      6f:	83 c4 10             	add    $0x10,%esp
+      72:	83 c0 10             	add    $0x10,%eax
+  if(fstat(fd, &st) < 0 || st.type != T_DIR ||
+      75:	3d 00 01 00 00       	cmp    $0x100,%eax
+      7a:	76 21                	jbe    9d <rm+0x9d>
+    close(fd);
+      7c:	83 ec 0c             	sub    $0xc,%esp
+      7f:	ff 75 ec             	push   -0x14(%ebp)
+      82:	e8 fe 04 00 00       	call   585 <close>
+      87:	83 c4 10             	add    $0x10,%esp
+    return unlink(path);
+      8a:	83 ec 0c             	sub    $0xc,%esp
+      8d:	ff 75 08             	push   0x8(%ebp)
+      90:	e8 19 05 00 00       	call   5ae <unlink>
+      95:	83 c4 10             	add    $0x10,%esp
+      98:	e9 61 01 00 00       	jmp    1fe <rm+0x1fe>
+  }
+  strcpy(buf, path);
+      9d:	83 ec 08             	sub    $0x8,%esp
+      a0:	ff 75 08             	push   0x8(%ebp)
+      a3:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+      a9:	50                   	push   %eax
+      aa:	e8 42 02 00 00       	call   2f1 <strcpy>
+      af:	83 c4 10             	add    $0x10,%esp
+  p = buf + strlen(buf);
+      b2:	83 ec 0c             	sub    $0xc,%esp
+      b5:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+      bb:	50                   	push   %eax
+      bc:	e8 9f 02 00 00       	call   360 <strlen>
+      c1:	83 c4 10             	add    $0x10,%esp
+      c4:	8d 95 e4 fe ff ff    	lea    -0x11c(%ebp),%edx
+      ca:	01 d0                	add    %edx,%eax
+      cc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  *p++ = '/';
+      cf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      d2:	8d 50 01             	lea    0x1(%eax),%edx
+      d5:	89 55 e8             	mov    %edx,-0x18(%ebp)
+      d8:	c6 00 2f             	movb   $0x2f,(%eax)
+  r = 0;
+      db:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(r == 0 && (n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+      e2:	e9 c4 00 00 00       	jmp    1ab <rm+0x1ab>
+    for(i = 0; i < n && r == 0; i++){
+      e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      ee:	e9 a6 00 00 00       	jmp    199 <rm+0x199>
+      if(strcmp(d[i].name, ".") == 0 || strcmp(d[i].name, "..") == 0)
+      f3:	8d 95 74 fe ff ff    	lea    -0x18c(%ebp),%edx
+      f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      fc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+      ff:	01 d0                	add    %edx,%eax
+     101:	83 c0 0c             	add    $0xc,%eax
+     104:	83 ec 08             	sub    $0x8,%esp
+     107:	68 8c 10 00 00       	push   $0x108c
+     10c:	50                   	push   %eax
+     10d:	e8 0f 02 00 00       	call   321 <strcmp>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	74 7b                	je     194 <rm+0x194>
+     119:	8d 95 74 fe ff ff    	lea    -0x18c(%ebp),%edx
+     11f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     122:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     125:	01 d0                	add    %edx,%eax
+     127:	83 c0 0c             	add    $0xc,%eax
+     12a:	83 ec 08             	sub    $0x8,%esp
+     12d:	68 8e 10 00 00       	push   $0x108e
+     132:	50                   	push   %eax
+     133:	e8 e9 01 00 00       	call   321 <strcmp>
+     138:	83 c4 10             	add    $0x10,%esp
+     13b:	85 c0                	test   %eax,%eax
+     13d:	74 55                	je     194 <rm+0x194>
+        continue;
+      strcpy(p, d[i].name);
+     13f:	8d 95 74 fe ff ff    	lea    -0x18c(%ebp),%edx
+     145:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     148:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     14b:	01 d0                	add    %edx,%eax
+     14d:	83 c0 0c             	add    $0xc,%eax
+     150:	83 ec 08             	sub    $0x8,%esp
+     153:	50                   	push   %eax
+     154:	ff 75 e8             	push   -0x18(%ebp)
+     157:	e8 95 01 00 00       	call   2f1 <strcpy>
+     15c:	83 c4 10             	add    $0x10,%esp
+      // Only directories need looking into.
+      r = rm(buf, d[i].type == T_DIR);
+     15f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     162:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     165:	8d 40 f8             	lea    -0x8(%eax),%eax
+     168:	01 e8                	add    %ebp,%eax
+     16a:	2d 80 01 00 00       	sub    $0x180,%eax
+     16f:	0f b7 00             	movzwl (%eax),%eax
+     172:	66 83 f8 01          	cmp    $0x1,%ax
+     176:	0f 94 c0             	sete   %al
+     179:	0f b6 c0             	movzbl %al,%eax
+     17c:	83 ec 08             	sub    $0x8,%esp
+     17f:	50                   	push   %eax
+     180:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+     186:	50                   	push   %eax
+     187:	e8 74 fe ff ff       	call   0 <rm>
+     18c:	83 c4 10             	add    $0x10,%esp
+     18f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     192:	eb 01                	jmp    195 <rm+0x195>
+        continue;
+     194:	90                   	nop
+    for(i = 0; i < n && r == 0; i++){
+     195:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     19c:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     19f:	7d 0a                	jge    1ab <rm+0x1ab>
+     1a1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1a5:	0f 84 48 ff ff ff    	je     f3 <rm+0xf3>
+  while(r == 0 && (n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+     1ab:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1af:	75 24                	jne    1d5 <rm+0x1d5>
+     1b1:	83 ec 04             	sub    $0x4,%esp
+     1b4:	6a 04                	push   $0x4
+     1b6:	8d 85 74 fe ff ff    	lea    -0x18c(%ebp),%eax
+     1bc:	50                   	push   %eax
+     1bd:	ff 75 ec             	push   -0x14(%ebp)
+     1c0:	e8 5b 05 00 00       	call   720 <getdents>
+     1c5:	83 c4 10             	add    $0x10,%esp
+     1c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     1cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     1cf:	0f 8f 12 ff ff ff    	jg     e7 <rm+0xe7>
+    }
+  }
+  close(fd);
+     1d5:	83 ec 0c             	sub    $0xc,%esp
+     1d8:	ff 75 ec             	push   -0x14(%ebp)
+     1db:	e8 a5 03 00 00       	call   585 <close>
+     1e0:	83 c4 10             	add    $0x10,%esp
+  if(r < 0)
+     1e3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1e7:	79 07                	jns    1f0 <rm+0x1f0>
+    return -1;
+     1e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     1ee:	eb 0e                	jmp    1fe <rm+0x1fe>
+  return unlink(path);
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	ff 75 08             	push   0x8(%ebp)
+     1f6:	e8 b3 03 00 00       	call   5ae <unlink>
+     1fb:	83 c4 10             	add    $0x10,%esp
+}
+     1fe:	c9                   	leave
+     1ff:	c3                   	ret
+
+00000200 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     200:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     204:	83 e4 f0             	and    $0xfffffff0,%esp
+     207:	ff 71 fc             	push   -0x4(%ecx)
+     20a:	55                   	push   %ebp
+     20b:	89 e5                	mov    %esp,%ebp
+     20d:	53                   	push   %ebx
+     20e:	51                   	push   %ecx
+     20f:	83 ec 10             	sub    $0x10,%esp
+     212:	89 cb                	mov    %ecx,%ebx
+  int i, recurse;
+
+  recurse = argc > 1 && strcmp(argv[1], "-r") == 0;
+     214:	83 3b 01             	cmpl   $0x1,(%ebx)
+     217:	7e 24                	jle    23d <main+0x3d>
+     219:	8b 43 04             	mov    0x4(%ebx),%eax
+     21c:	83 c0 04             	add    $0x4,%eax
+     21f:	8b 00                	mov    (%eax),%eax
+     221:	83 ec 08             	sub    $0x8,%esp
+     224:	68 91 10 00 00       	push   $0x1091
+     229:	50                   	push   %eax
+     22a:	e8 f2 00 00 00       	call   321 <strcmp>
+     22f:	83 c4 10             	add    $0x10,%esp
+     232:	85 c0                	test   %eax,%eax
+     234:	75 07                	jne    23d <main+0x3d>
+     236:	b8 01 00 00 00       	mov    $0x1,%eax
+     23b:	eb 05                	jmp    242 <main+0x42>
+     23d:	b8 00 00 00 00       	mov    $0x0,%eax
+     242:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(argc < 2 + recurse){
+     245:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     248:	83 c0 01             	add    $0x1,%eax
+     24b:	39 03                	cmp    %eax,(%ebx)
+     24d:	7f 17                	jg     266 <main+0x66>
+    printf(2, "Usage: rm [-r] files...\n");
+     24f:	83 ec 08             	sub    $0x8,%esp
+     252:	68 94 10 00 00       	push   $0x1094
+     257:	6a 02                	push   $0x2
+     259:	e8 94 07 00 00       	call   9f2 <printf>
+     25e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     261:	e8 fc 02 00 00       	call   562 <exit>
+  }
+
+  for(i = 1 + recurse; i < argc; i++){
+     266:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     269:	83 c0 01             	add    $0x1,%eax
+     26c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     26f:	eb 4e                	jmp    2bf <main+0xbf>
+    if(rm(argv[i], recurse) < 0){
+     271:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     274:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     27b:	8b 43 04             	mov    0x4(%ebx),%eax
+     27e:	01 d0                	add    %edx,%eax
+     280:	8b 00                	mov    (%eax),%eax
+     282:	83 ec 08             	sub    $0x8,%esp
+     285:	ff 75 f0             	push   -0x10(%ebp)
+     288:	50                   	push   %eax
+     289:	e8 72 fd ff ff       	call   0 <rm>
+     28e:	83 c4 10             	add    $0x10,%esp
+     291:	85 c0                	test   %eax,%eax
+     293:	79 26                	jns    2bb <main+0xbb>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+     295:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     298:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     29f:	8b 43 04             	mov    0x4(%ebx),%eax
+     2a2:	01 d0                	add    %edx,%eax
+     2a4:	8b 00                	mov    (%eax),%eax
+     2a6:	83 ec 04             	sub    $0x4,%esp
+     2a9:	50                   	push   %eax
+     2aa:	68 ad 10 00 00       	push   $0x10ad
+     2af:	6a 02                	push   $0x2
+     2b1:	e8 3c 07 00 00       	call   9f2 <printf>
+     2b6:	83 c4 10             	add    $0x10,%esp
+      break;
+     2b9:	eb 0b                	jmp    2c6 <main+0xc6>
+  for(i = 1 + recurse; i < argc; i++){
+     2bb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     2bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2c2:	3b 03                	cmp    (%ebx),%eax
+     2c4:	7c ab                	jl     271 <main+0x71>
+    }
+  }
+
+  exit();
+     2c6:	e8 97 02 00 00       	call   562 <exit>
+
+000002cb <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     2cb:	55                   	push   %ebp
+     2cc:	89 e5                	mov    %esp,%ebp
+     2ce:	57                   	push   %edi
+     2cf:	53                   	push   %ebx
+    if(cc < 1)
+     2d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2d3:	8b 55 10             	mov    0x10(%ebp),%edx
+     2d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2d9:	89 cb                	mov    %ecx,%ebx
+     2db:	89 df                	mov    %ebx,%edi
+     2dd:	89 d1                	mov    %edx,%ecx
+     2df:	fc                   	cld
+     2e0:	f3 aa                	rep stos %al,%es:(%edi)
+     2e2:	89 ca                	mov    %ecx,%edx
+     2e4:	89 fb                	mov    %edi,%ebx
+     2e6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2e9:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     2ec:	90                   	nop
+     2ed:	5b                   	pop    %ebx
+     2ee:	5f                   	pop    %edi
+     2ef:	5d                   	pop    %ebp
+     2f0:	c3                   	ret
+
+000002f1 <strcpy>:
+{
+     2f1:	55                   	push   %ebp
+     2f2:	89 e5                	mov    %esp,%ebp
+     2f4:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2f7:	8b 45 08             	mov    0x8(%ebp),%eax
+     2fa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2fd:	90                   	nop
+     2fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+     301:	8d 42 01             	lea    0x1(%edx),%eax
+     304:	89 45 0c             	mov    %eax,0xc(%ebp)
+     307:	8b 45 08             	mov    0x8(%ebp),%eax
+     30a:	8d 48 01             	lea    0x1(%eax),%ecx
+     30d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     310:	0f b6 12             	movzbl (%edx),%edx
+     313:	88 10                	mov    %dl,(%eax)
+     315:	0f b6 00             	movzbl (%eax),%eax
+     318:	84 c0                	test   %al,%al
+     31a:	75 e2                	jne    2fe <strcpy+0xd>
+  return os;
+     31c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     31f:	c9                   	leave
+     320:	c3                   	ret
+
+00000321 <strcmp>:
+{
+     321:	55                   	push   %ebp
+     322:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     324:	eb 08                	jmp    32e <strcmp+0xd>
+    p++, q++;
+     326:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     32a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     32e:	8b 45 08             	mov    0x8(%ebp),%eax
+     331:	0f b6 00             	movzbl (%eax),%eax
+     334:	84 c0                	test   %al,%al
+     336:	74 10                	je     348 <strcmp+0x27>
+     338:	8b 45 08             	mov    0x8(%ebp),%eax
+     33b:	0f b6 10             	movzbl (%eax),%edx
+     33e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     341:	0f b6 00             	movzbl (%eax),%eax
+     344:	38 c2                	cmp    %al,%dl
+     346:	74 de                	je     326 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     348:	8b 45 08             	mov    0x8(%ebp),%eax
+     34b:	0f b6 00             	movzbl (%eax),%eax
+     34e:	0f b6 d0             	movzbl %al,%edx
+     351:	8b 45 0c             	mov    0xc(%ebp),%eax
+     354:	0f b6 00             	movzbl (%eax),%eax
+     357:	0f b6 c0             	movzbl %al,%eax
+     35a:	29 c2                	sub    %eax,%edx
+     35c:	89 d0                	mov    %edx,%eax
+}
+     35e:	5d                   	pop    %ebp
+     35f:	c3                   	ret
+
+00000360 <strlen>:
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     366:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     36d:	eb 04                	jmp    373 <strlen+0x13>
+     36f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     373:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     376:	8b 45 08             	mov    0x8(%ebp),%eax
+     379:	01 d0                	add    %edx,%eax
+     37b:	0f b6 00             	movzbl (%eax),%eax
+     37e:	84 c0                	test   %al,%al
+     380:	75 ed                	jne    36f <strlen+0xf>
+  return n;
+     382:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     385:	c9                   	leave
+     386:	c3                   	ret
+
+00000387 <memset>:
+{
+     387:	55                   	push   %ebp
+     388:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     38a:	8b 45 10             	mov    0x10(%ebp),%eax
+     38d:	50                   	push   %eax
+     38e:	ff 75 0c             	push   0xc(%ebp)
+     391:	ff 75 08             	push   0x8(%ebp)
+     394:	e8 32 ff ff ff       	call   2cb <stosb>
+     399:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     39f:	c9                   	leave
+     3a0:	c3                   	ret
+
+000003a1 <strchr>:
+{
+     3a1:	55                   	push   %ebp
+     3a2:	89 e5                	mov    %esp,%ebp
+     3a4:	83 ec 04             	sub    $0x4,%esp
+     3a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3aa:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     3ad:	eb 14                	jmp    3c3 <strchr+0x22>
+    if(*s == c)
+     3af:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b2:	0f b6 00             	movzbl (%eax),%eax
+     3b5:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     3b8:	75 05                	jne    3bf <strchr+0x1e>
+      return (char*)s;
+     3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+     3bd:	eb 13                	jmp    3d2 <strchr+0x31>
+  for(; *s; s++)
+     3bf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c6:	0f b6 00             	movzbl (%eax),%eax
+     3c9:	84 c0                	test   %al,%al
+     3cb:	75 e2                	jne    3af <strchr+0xe>
+  return 0;
+     3cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3d2:	c9                   	leave
+     3d3:	c3                   	ret
+
+000003d4 <gets>:
+{
+     3d4:	55                   	push   %ebp
+     3d5:	89 e5                	mov    %esp,%ebp
+     3d7:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     3da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3e1:	eb 42                	jmp    425 <gets+0x51>
+    cc = read(0, &c, 1);
+     3e3:	83 ec 04             	sub    $0x4,%esp
+     3e6:	6a 01                	push   $0x1
+     3e8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     3eb:	50                   	push   %eax
+     3ec:	6a 00                	push   $0x0
+     3ee:	e8 84 01 00 00       	call   577 <read>
+     3f3:	83 c4 10             	add    $0x10,%esp
+     3f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     3f9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3fd:	7e 33                	jle    432 <gets+0x5e>
+    buf[i++] = c;
+     3ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     402:	8d 50 01             	lea    0x1(%eax),%edx
+     405:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     408:	89 c2                	mov    %eax,%edx
+     40a:	8b 45 08             	mov    0x8(%ebp),%eax
+     40d:	01 c2                	add    %eax,%edx
+     40f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     413:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     415:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     419:	3c 0a                	cmp    $0xa,%al
+     41b:	74 16                	je     433 <gets+0x5f>
+     41d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     421:	3c 0d                	cmp    $0xd,%al
+     423:	74 0e                	je     433 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     428:	83 c0 01             	add    $0x1,%eax
+     42b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     42e:	7f b3                	jg     3e3 <gets+0xf>
+     430:	eb 01                	jmp    433 <gets+0x5f>
+      break;
+     432:	90                   	nop
+  }
+  buf[i] = '\0';
+     433:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     436:	8b 45 08             	mov    0x8(%ebp),%eax
+     439:	01 d0                	add    %edx,%eax
+     43b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     43e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     441:	c9                   	leave
+     442:	c3                   	ret
+
+00000443 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     443:	55                   	push   %ebp
+     444:	89 e5                	mov    %esp,%ebp
+     446:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	6a 00                	push   $0x0
+     44e:	ff 75 08             	push   0x8(%ebp)
+     451:	e8 44 01 00 00       	call   59a <open>
+     456:	83 c4 10             	add    $0x10,%esp
+     459:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     45c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     460:	79 07                	jns    469 <stat+0x26>
+    return -1;
+     462:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     467:	eb 25                	jmp    48e <stat+0x4b>
+  r = fstat(fd, st);
+     469:	83 ec 08             	sub    $0x8,%esp
+     46c:	ff 75 0c             	push   0xc(%ebp)
+     46f:	ff 75 f4             	push   -0xc(%ebp)
+     472:	e8 41 01 00 00       	call   5b8 <fstat>
+     477:	83 c4 10             	add    $0x10,%esp
+     47a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     47d:	83 ec 0c             	sub    $0xc,%esp
+     480:	ff 75 f4             	push   -0xc(%ebp)
+     483:	e8 fd 00 00 00       	call   585 <close>
+     488:	83 c4 10             	add    $0x10,%esp
+  return r;
+     48b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     48e:	c9                   	leave
+     48f:	c3                   	ret
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     496:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     49d:	eb 25                	jmp    4c4 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     49f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4a2:	89 d0                	mov    %edx,%eax
+     4a4:	c1 e0 02             	shl    $0x2,%eax
+     4a7:	01 d0                	add    %edx,%eax
+     4a9:	01 c0                	add    %eax,%eax
+     4ab:	89 c1                	mov    %eax,%ecx
+     4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b0:	8d 50 01             	lea    0x1(%eax),%edx
+     4b3:	89 55 08             	mov    %edx,0x8(%ebp)
+     4b6:	0f b6 00             	movzbl (%eax),%eax
+     4b9:	0f be c0             	movsbl %al,%eax
+     4bc:	01 c8                	add    %ecx,%eax
+     4be:	83 e8 30             	sub    $0x30,%eax
+     4c1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c7:	0f b6 00             	movzbl (%eax),%eax
+     4ca:	3c 2f                	cmp    $0x2f,%al
+     4cc:	7e 0a                	jle    4d8 <atoi+0x48>
+     4ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d1:	0f b6 00             	movzbl (%eax),%eax
+     4d4:	3c 39                	cmp    $0x39,%al
+     4d6:	7e c7                	jle    49f <atoi+0xf>
+  return n;
+     4d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4db:	c9                   	leave
+     4dc:	c3                   	ret
+
+000004dd <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4dd:	55                   	push   %ebp
+     4de:	89 e5                	mov    %esp,%ebp
+     4e0:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     4e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4ec:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     4ef:	eb 17                	jmp    508 <memmove+0x2b>
+    *dst++ = *src++;
+     4f1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4f4:	8d 42 01             	lea    0x1(%edx),%eax
+     4f7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4fd:	8d 48 01             	lea    0x1(%eax),%ecx
+     500:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     503:	0f b6 12             	movzbl (%edx),%edx
+     506:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     508:	8b 45 10             	mov    0x10(%ebp),%eax
+     50b:	8d 50 ff             	lea    -0x1(%eax),%edx
+     50e:	89 55 10             	mov    %edx,0x10(%ebp)
+     511:	85 c0                	test   %eax,%eax
+     513:	7f dc                	jg     4f1 <memmove+0x14>
+  return vdst;
+     515:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     518:	c9                   	leave
+     519:	c3                   	ret
+
+0000051a <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     51a:	83 3d 78 14 00 00 00 	cmpl   $0x0,0x1478
+  jg 2f
+     521:	7f 2e                	jg     551 <dosyscall+0x37>
+  jl 1f
+     523:	7c 29                	jl     54e <dosyscall+0x34>
+  pushl %eax
+     525:	50                   	push   %eax
+  pushl %ebx
+     526:	53                   	push   %ebx
+  movl $1, %eax
+     527:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     52c:	0f a2                	cpuid
+  popl %ebx
+     52e:	5b                   	pop    %ebx
+  popl %eax
+     52f:	58                   	pop    %eax
+  movl $-1, sysmode
+     530:	c7 05 78 14 00 00 ff 	movl   $0xffffffff,0x1478
+     537:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     53a:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     540:	74 0c                	je     54e <dosyscall+0x34>
+  movl $1, sysmode
+     542:	c7 05 78 14 00 00 01 	movl   $0x1,0x1478
+     549:	00 00 00 
+  jmp 2f
+     54c:	eb 03                	jmp    551 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     54e:	cd 40                	int    $0x40
+  ret
+     550:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     551:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     553:	ba 5a 05 00 00       	mov    $0x55a,%edx
+  sysenter
+     558:	0f 34                	sysenter
+3:
+  ret
+     55a:	c3                   	ret
+
+0000055b <fork>:
+
+SYSCALL(fork)
+     55b:	b8 01 00 00 00       	mov    $0x1,%eax
+     560:	eb b8                	jmp    51a <dosyscall>
+
+00000562 <exit>:
+SYSCALL(exit)
+     562:	b8 02 00 00 00       	mov    $0x2,%eax
+     567:	eb b1                	jmp    51a <dosyscall>
+
+00000569 <wait>:
+SYSCALL(wait)
+     569:	b8 03 00 00 00       	mov    $0x3,%eax
+     56e:	eb aa                	jmp    51a <dosyscall>
+
+00000570 <pipe>:
+SYSCALL(pipe)
+     570:	b8 04 00 00 00       	mov    $0x4,%eax
+     575:	eb a3                	jmp    51a <dosyscall>
+
+00000577 <read>:
+SYSCALL(read)
+     577:	b8 05 00 00 00       	mov    $0x5,%eax
+     57c:	eb 9c                	jmp    51a <dosyscall>
+
+0000057e <write>:
+SYSCALL(write)
+     57e:	b8 10 00 00 00       	mov    $0x10,%eax
+     583:	eb 95                	jmp    51a <dosyscall>
+
+00000585 <close>:
+SYSCALL(close)
+     585:	b8 15 00 00 00       	mov    $0x15,%eax
+     58a:	eb 8e                	jmp    51a <dosyscall>
+
+0000058c <kill>:
+SYSCALL(kill)
+     58c:	b8 06 00 00 00       	mov    $0x6,%eax
+     591:	eb 87                	jmp    51a <dosyscall>
+
+00000593 <exec>:
+SYSCALL(exec)
+     593:	b8 07 00 00 00       	mov    $0x7,%eax
+     598:	eb 80                	jmp    51a <dosyscall>
+
+0000059a <open>:
+SYSCALL(open)
+     59a:	b8 0f 00 00 00       	mov    $0xf,%eax
+     59f:	e9 76 ff ff ff       	jmp    51a <dosyscall>
+
+000005a4 <mknod>:
+SYSCALL(mknod)
+     5a4:	b8 11 00 00 00       	mov    $0x11,%eax
+     5a9:	e9 6c ff ff ff       	jmp    51a <dosyscall>
+
+000005ae <unlink>:
+SYSCALL(unlink)
+     5ae:	b8 12 00 00 00       	mov    $0x12,%eax
+     5b3:	e9 62 ff ff ff       	jmp    51a <dosyscall>
+
+000005b8 <fstat>:
+SYSCALL(fstat)
+     5b8:	b8 08 00 00 00       	mov    $0x8,%eax
+     5bd:	e9 58 ff ff ff       	jmp    51a <dosyscall>
+
+000005c2 <link>:
+SYSCALL(link)
+     5c2:	b8 13 00 00 00       	mov    $0x13,%eax
+     5c7:	e9 4e ff ff ff       	jmp    51a <dosyscall>
+
+000005cc <mkdir>:
+SYSCALL(mkdir)
+     5cc:	b8 14 00 00 00       	mov    $0x14,%eax
+     5d1:	e9 44 ff ff ff       	jmp    51a <dosyscall>
+
+000005d6 <chdir>:
+SYSCALL(chdir)
+     5d6:	b8 09 00 00 00       	mov    $0x9,%eax
+     5db:	e9 3a ff ff ff       	jmp    51a <dosyscall>
+
+000005e0 <dup>:
+SYSCALL(dup)
+     5e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5e5:	e9 30 ff ff ff       	jmp    51a <dosyscall>
+
+000005ea <getpid>:
+SYSCALL(getpid)
+     5ea:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5ef:	e9 26 ff ff ff       	jmp    51a <dosyscall>
+
+000005f4 <sbrk>:
+SYSCALL(sbrk)
+     5f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5f9:	e9 1c ff ff ff       	jmp    51a <dosyscall>
+
+000005fe <sleep>:
+SYSCALL(sleep)
+     5fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+     603:	e9 12 ff ff ff       	jmp    51a <dosyscall>
+
+00000608 <uptime>:
+SYSCALL(uptime)
+     608:	b8 0e 00 00 00       	mov    $0xe,%eax
+     60d:	e9 08 ff ff ff       	jmp    51a <dosyscall>
+
+00000612 <symlink>:
+SYSCALL(symlink)
+     612:	b8 16 00 00 00       	mov    $0x16,%eax
+     617:	e9 fe fe ff ff       	jmp    51a <dosyscall>
+
+0000061c <readlink>:
+SYSCALL(readlink)
+     61c:	b8 17 00 00 00       	mov    $0x17,%eax
+     621:	e9 f4 fe ff ff       	jmp    51a <dosyscall>
+
+00000626 <fprot>:
+SYSCALL(fprot)
+     626:	b8 18 00 00 00       	mov    $0x18,%eax
+     62b:	e9 ea fe ff ff       	jmp    51a <dosyscall>
+
+00000630 <funprot>:
+SYSCALL(funprot)
+     630:	b8 19 00 00 00       	mov    $0x19,%eax
+     635:	e9 e0 fe ff ff       	jmp    51a <dosyscall>
+
+0000063a <funlock>:
+SYSCALL(funlock)
+     63a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     63f:	e9 d6 fe ff ff       	jmp    51a <dosyscall>
+
+00000644 <mmap>:
+SYSCALL(mmap)
+     644:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     649:	e9 cc fe ff ff       	jmp    51a <dosyscall>
+
+0000064e <munmap>:
+SYSCALL(munmap)
+     64e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     653:	e9 c2 fe ff ff       	jmp    51a <dosyscall>
+
+00000658 <sendfile>:
+SYSCALL(sendfile)
+     658:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     65d:	e9 b8 fe ff ff       	jmp    51a <dosyscall>
+
+00000662 <readv>:
+SYSCALL(readv)
+     662:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     667:	e9 ae fe ff ff       	jmp    51a <dosyscall>
+
+0000066c <writev>:
+SYSCALL(writev)
+     66c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     671:	e9 a4 fe ff ff       	jmp    51a <dosyscall>
+
+00000676 <pread>:
+SYSCALL(pread)
+     676:	b8 20 00 00 00       	mov    $0x20,%eax
+     67b:	e9 9a fe ff ff       	jmp    51a <dosyscall>
+
+00000680 <pwrite>:
+SYSCALL(pwrite)
+     680:	b8 21 00 00 00       	mov    $0x21,%eax
+     685:	e9 90 fe ff ff       	jmp    51a <dosyscall>
+
+0000068a <lseek>:
+SYSCALL(lseek)
+     68a:	b8 22 00 00 00       	mov    $0x22,%eax
+     68f:	e9 86 fe ff ff       	jmp    51a <dosyscall>
+
+00000694 <spawn>:
+SYSCALL(spawn)
+     694:	b8 23 00 00 00       	mov    $0x23,%eax
+     699:	e9 7c fe ff ff       	jmp    51a <dosyscall>
+
+0000069e <setpriority>:
+SYSCALL(setpriority)
+     69e:	b8 24 00 00 00       	mov    $0x24,%eax
+     6a3:	e9 72 fe ff ff       	jmp    51a <dosyscall>
+
+000006a8 <kthread_create>:
+SYSCALL(kthread_create)
+     6a8:	b8 25 00 00 00       	mov    $0x25,%eax
+     6ad:	e9 68 fe ff ff       	jmp    51a <dosyscall>
+
+000006b2 <kthread_id>:
+SYSCALL(kthread_id)
+     6b2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6b7:	e9 5e fe ff ff       	jmp    51a <dosyscall>
+
+000006bc <kthread_exit>:
+SYSCALL(kthread_exit)
+     6bc:	b8 27 00 00 00       	mov    $0x27,%eax
+     6c1:	e9 54 fe ff ff       	jmp    51a <dosyscall>
+
+000006c6 <kthread_join>:
+SYSCALL(kthread_join)
+     6c6:	b8 28 00 00 00       	mov    $0x28,%eax
+     6cb:	e9 4a fe ff ff       	jmp    51a <dosyscall>
+
+000006d0 <futex>:
+SYSCALL(futex)
+     6d0:	b8 29 00 00 00       	mov    $0x29,%eax
+     6d5:	e9 40 fe ff ff       	jmp    51a <dosyscall>
+
+000006da <signal>:
+SYSCALL(signal)
+     6da:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     6df:	e9 36 fe ff ff       	jmp    51a <dosyscall>
+
+000006e4 <alarm>:
+SYSCALL(alarm)
+     6e4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6e9:	e9 2c fe ff ff       	jmp    51a <dosyscall>
+
+000006ee <usleep>:
+SYSCALL(usleep)
+     6ee:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6f3:	e9 22 fe ff ff       	jmp    51a <dosyscall>
+
+000006f8 <ioring_setup>:
+SYSCALL(ioring_setup)
+     6f8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6fd:	e9 18 fe ff ff       	jmp    51a <dosyscall>
+
+00000702 <ioring_enter>:
+SYSCALL(ioring_enter)
+     702:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     707:	e9 0e fe ff ff       	jmp    51a <dosyscall>
+
+0000070c <getrusage>:
+SYSCALL(getrusage)
+     70c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     711:	e9 04 fe ff ff       	jmp    51a <dosyscall>
+
+00000716 <mount>:
+SYSCALL(mount)
+     716:	b8 30 00 00 00       	mov    $0x30,%eax
+     71b:	e9 fa fd ff ff       	jmp    51a <dosyscall>
+
+00000720 <getdents>:
+SYSCALL(getdents)
+     720:	b8 31 00 00 00       	mov    $0x31,%eax
+     725:	e9 f0 fd ff ff       	jmp    51a <dosyscall>
+
+0000072a <yield>:
+SYSCALL(yield)
+     72a:	b8 32 00 00 00       	mov    $0x32,%eax
+     72f:	e9 e6 fd ff ff       	jmp    51a <dosyscall>
+
+00000734 <ncpu>:
+SYSCALL(ncpu)
+     734:	b8 33 00 00 00       	mov    $0x33,%eax
+     739:	e9 dc fd ff ff       	jmp    51a <dosyscall>
+
+0000073e <fallocate>:
+SYSCALL(fallocate)
+     73e:	b8 34 00 00 00       	mov    $0x34,%eax
+     743:	e9 d2 fd ff ff       	jmp    51a <dosyscall>
+
+00000748 <ftruncate>:
+SYSCALL(ftruncate)
+     748:	b8 35 00 00 00       	mov    $0x35,%eax
+     74d:	e9 c8 fd ff ff       	jmp    51a <dosyscall>
+
+00000752 <fsync>:
+SYSCALL(fsync)
+     752:	b8 36 00 00 00       	mov    $0x36,%eax
+     757:	e9 be fd ff ff       	jmp    51a <dosyscall>
+
+0000075c <fdatasync>:
+SYSCALL(fdatasync)
+     75c:	b8 37 00 00 00       	mov    $0x37,%eax
+     761:	e9 b4 fd ff ff       	jmp    51a <dosyscall>
+
+00000766 <poll>:
+SYSCALL(poll)
+     766:	b8 38 00 00 00       	mov    $0x38,%eax
+     76b:	e9 aa fd ff ff       	jmp    51a <dosyscall>
+
+00000770 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     776:	8b 45 08             	mov    0x8(%ebp),%eax
+     779:	8b 40 04             	mov    0x4(%eax),%eax
+     77c:	85 c0                	test   %eax,%eax
+     77e:	7e 1f                	jle    79f <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     780:	8b 45 08             	mov    0x8(%ebp),%eax
+     783:	8b 50 04             	mov    0x4(%eax),%edx
+     786:	8b 45 08             	mov    0x8(%ebp),%eax
+     789:	8d 48 08             	lea    0x8(%eax),%ecx
+     78c:	8b 45 08             	mov    0x8(%ebp),%eax
+     78f:	8b 00                	mov    (%eax),%eax
+     791:	83 ec 04             	sub    $0x4,%esp
+     794:	52                   	push   %edx
+     795:	51                   	push   %ecx
+     796:	50                   	push   %eax
+     797:	e8 d0 fe ff ff       	call   66c <writev>
+     79c:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     79f:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ac:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     7b3:	00 00 00 
+}
+     7b6:	90                   	nop
+     7b7:	c9                   	leave
+     7b8:	c3                   	ret
+
+000007b9 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     7b9:	55                   	push   %ebp
+     7ba:	89 e5                	mov    %esp,%ebp
+     7bc:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     7bf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7c3:	0f 84 94 00 00 00    	je     85d <put+0xa4>
+    return;
+  if(o->n > 0){
+     7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+     7cc:	8b 40 04             	mov    0x4(%eax),%eax
+     7cf:	85 c0                	test   %eax,%eax
+     7d1:	7e 40                	jle    813 <put+0x5a>
+    v = &o->iov[o->n-1];
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	8b 40 04             	mov    0x4(%eax),%eax
+     7d9:	83 e8 01             	sub    $0x1,%eax
+     7dc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     7e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e6:	01 d0                	add    %edx,%eax
+     7e8:	83 c0 08             	add    $0x8,%eax
+     7eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     7ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f1:	8b 10                	mov    (%eax),%edx
+     7f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f6:	8b 40 04             	mov    0x4(%eax),%eax
+     7f9:	01 d0                	add    %edx,%eax
+     7fb:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     7fe:	75 13                	jne    813 <put+0x5a>
+      v->iov_len += n;
+     800:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     803:	8b 50 04             	mov    0x4(%eax),%edx
+     806:	8b 45 10             	mov    0x10(%ebp),%eax
+     809:	01 c2                	add    %eax,%edx
+     80b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     80e:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     811:	eb 4b                	jmp    85e <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     813:	8b 45 08             	mov    0x8(%ebp),%eax
+     816:	8b 40 04             	mov    0x4(%eax),%eax
+     819:	83 f8 10             	cmp    $0x10,%eax
+     81c:	75 0e                	jne    82c <put+0x73>
+    flush(o);
+     81e:	83 ec 0c             	sub    $0xc,%esp
+     821:	ff 75 08             	push   0x8(%ebp)
+     824:	e8 47 ff ff ff       	call   770 <flush>
+     829:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     82c:	8b 45 08             	mov    0x8(%ebp),%eax
+     82f:	8b 50 04             	mov    0x4(%eax),%edx
+     832:	8b 45 08             	mov    0x8(%ebp),%eax
+     835:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     838:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     83c:	8b 45 08             	mov    0x8(%ebp),%eax
+     83f:	8b 50 04             	mov    0x4(%eax),%edx
+     842:	8b 45 08             	mov    0x8(%ebp),%eax
+     845:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     848:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     84c:	8b 45 08             	mov    0x8(%ebp),%eax
+     84f:	8b 40 04             	mov    0x4(%eax),%eax
+     852:	8d 50 01             	lea    0x1(%eax),%edx
+     855:	8b 45 08             	mov    0x8(%ebp),%eax
+     858:	89 50 04             	mov    %edx,0x4(%eax)
+     85b:	eb 01                	jmp    85e <put+0xa5>
+    return;
+     85d:	90                   	nop
+}
+     85e:	c9                   	leave
+     85f:	c3                   	ret
+
+00000860 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     866:	8b 45 08             	mov    0x8(%ebp),%eax
+     869:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     86f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     872:	01 d0                	add    %edx,%eax
+     874:	3d 80 00 00 00       	cmp    $0x80,%eax
+     879:	77 0b                	ja     886 <room+0x26>
+     87b:	8b 45 08             	mov    0x8(%ebp),%eax
+     87e:	8b 40 04             	mov    0x4(%eax),%eax
+     881:	83 f8 10             	cmp    $0x10,%eax
+     884:	75 0e                	jne    894 <room+0x34>
+    flush(o);
+     886:	83 ec 0c             	sub    $0xc,%esp
+     889:	ff 75 08             	push   0x8(%ebp)
+     88c:	e8 df fe ff ff       	call   770 <flush>
+     891:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     894:	8b 45 08             	mov    0x8(%ebp),%eax
+     897:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     89d:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8a6:	01 d0                	add    %edx,%eax
+}
+     8a8:	c9                   	leave
+     8a9:	c3                   	ret
+
+000008aa <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     8aa:	55                   	push   %ebp
+     8ab:	89 e5                	mov    %esp,%ebp
+     8ad:	83 ec 28             	sub    $0x28,%esp
+     8b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8b3:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     8b6:	83 ec 08             	sub    $0x8,%esp
+     8b9:	6a 01                	push   $0x1
+     8bb:	ff 75 08             	push   0x8(%ebp)
+     8be:	e8 9d ff ff ff       	call   860 <room>
+     8c3:	83 c4 10             	add    $0x10,%esp
+     8c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     8c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8cc:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     8d0:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     8d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     8d5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8db:	8d 50 01             	lea    0x1(%eax),%edx
+     8de:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e1:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     8e7:	83 ec 04             	sub    $0x4,%esp
+     8ea:	6a 01                	push   $0x1
+     8ec:	ff 75 f4             	push   -0xc(%ebp)
+     8ef:	ff 75 08             	push   0x8(%ebp)
+     8f2:	e8 c2 fe ff ff       	call   7b9 <put>
+     8f7:	83 c4 10             	add    $0x10,%esp
+}
+     8fa:	90                   	nop
+     8fb:	c9                   	leave
+     8fc:	c3                   	ret
+
+000008fd <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     8fd:	55                   	push   %ebp
+     8fe:	89 e5                	mov    %esp,%ebp
+     900:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     903:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     90a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     90e:	74 17                	je     927 <printint+0x2a>
+     910:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     914:	79 11                	jns    927 <printint+0x2a>
+    neg = 1;
+     916:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     91d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     920:	f7 d8                	neg    %eax
+     922:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     925:	eb 06                	jmp    92d <printint+0x30>
+  } else {
+    x = xx;
+     927:	8b 45 0c             	mov    0xc(%ebp),%eax
+     92a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     92d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     934:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     937:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     93a:	ba 00 00 00 00       	mov    $0x0,%edx
+     93f:	f7 f1                	div    %ecx
+     941:	89 d1                	mov    %edx,%ecx
+     943:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     946:	8d 50 01             	lea    0x1(%eax),%edx
+     949:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     94c:	0f b6 91 7c 14 00 00 	movzbl 0x147c(%ecx),%edx
+     953:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     957:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     95a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     95d:	ba 00 00 00 00       	mov    $0x0,%edx
+     962:	f7 f1                	div    %ecx
+     964:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     967:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     96b:	75 c7                	jne    934 <printint+0x37>
+  if(neg)
+     96d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     971:	74 0e                	je     981 <printint+0x84>
+    buf[i++] = '-';
+     973:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     976:	8d 50 01             	lea    0x1(%eax),%edx
+     979:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     97c:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     981:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     984:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     987:	83 ec 08             	sub    $0x8,%esp
+     98a:	ff 75 e8             	push   -0x18(%ebp)
+     98d:	ff 75 08             	push   0x8(%ebp)
+     990:	e8 cb fe ff ff       	call   860 <room>
+     995:	83 c4 10             	add    $0x10,%esp
+     998:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     99b:	eb 1d                	jmp    9ba <printint+0xbd>
+    p[n-1-i] = buf[i];
+     99d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a0:	83 e8 01             	sub    $0x1,%eax
+     9a3:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     9a6:	89 c2                	mov    %eax,%edx
+     9a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9ab:	01 c2                	add    %eax,%edx
+     9ad:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     9b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9b3:	01 c8                	add    %ecx,%eax
+     9b5:	0f b6 00             	movzbl (%eax),%eax
+     9b8:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     9ba:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     9be:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9c2:	79 d9                	jns    99d <printint+0xa0>
+  o->used += n;
+     9c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c7:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     9cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9d0:	01 c2                	add    %eax,%edx
+     9d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d5:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     9db:	83 ec 04             	sub    $0x4,%esp
+     9de:	ff 75 e8             	push   -0x18(%ebp)
+     9e1:	ff 75 e4             	push   -0x1c(%ebp)
+     9e4:	ff 75 08             	push   0x8(%ebp)
+     9e7:	e8 cd fd ff ff       	call   7b9 <put>
+     9ec:	83 c4 10             	add    $0x10,%esp
+}
+     9ef:	90                   	nop
+     9f0:	c9                   	leave
+     9f1:	c3                   	ret
+
+000009f2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9f2:	55                   	push   %ebp
+     9f3:	89 e5                	mov    %esp,%ebp
+     9f5:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     9fb:	8b 45 08             	mov    0x8(%ebp),%eax
+     9fe:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     a04:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     a0b:	00 00 00 
+  o.used = 0;
+     a0e:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     a15:	00 00 00 
+  state = 0;
+     a18:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a1f:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a22:	83 c0 04             	add    $0x4,%eax
+     a25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     a28:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a2f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a36:	e9 82 01 00 00       	jmp    bbd <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a41:	01 d0                	add    %edx,%eax
+     a43:	0f b6 00             	movzbl (%eax),%eax
+     a46:	0f be c0             	movsbl %al,%eax
+     a49:	25 ff 00 00 00       	and    $0xff,%eax
+     a4e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a51:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a55:	75 38                	jne    a8f <printf+0x9d>
+      if(c == '%'){
+     a57:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a5b:	0f 85 58 01 00 00    	jne    bb9 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a61:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a64:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a6a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a6d:	01 ca                	add    %ecx,%edx
+     a6f:	83 ec 04             	sub    $0x4,%esp
+     a72:	50                   	push   %eax
+     a73:	52                   	push   %edx
+     a74:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a7a:	50                   	push   %eax
+     a7b:	e8 39 fd ff ff       	call   7b9 <put>
+     a80:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a83:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a8a:	e9 2a 01 00 00       	jmp    bb9 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a8f:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a93:	0f 85 20 01 00 00    	jne    bb9 <printf+0x1c7>
+      if(c == 'd'){
+     a99:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a9d:	75 22                	jne    ac1 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aa2:	8b 00                	mov    (%eax),%eax
+     aa4:	6a 01                	push   $0x1
+     aa6:	6a 0a                	push   $0xa
+     aa8:	50                   	push   %eax
+     aa9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     aaf:	50                   	push   %eax
+     ab0:	e8 48 fe ff ff       	call   8fd <printint>
+     ab5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ab8:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     abc:	e9 e8 00 00 00       	jmp    ba9 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     ac1:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     ac5:	74 06                	je     acd <printf+0xdb>
+     ac7:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     acb:	75 22                	jne    aef <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     acd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ad0:	8b 00                	mov    (%eax),%eax
+     ad2:	6a 00                	push   $0x0
+     ad4:	6a 10                	push   $0x10
+     ad6:	50                   	push   %eax
+     ad7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     add:	50                   	push   %eax
+     ade:	e8 1a fe ff ff       	call   8fd <printint>
+     ae3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ae6:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     aea:	e9 ba 00 00 00       	jmp    ba9 <printf+0x1b7>
+      } else if(c == 's'){
+     aef:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     af3:	75 3f                	jne    b34 <printf+0x142>
+        s = (char*)*ap;
+     af5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     af8:	8b 00                	mov    (%eax),%eax
+     afa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     afd:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     b01:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b05:	75 07                	jne    b0e <printf+0x11c>
+          s = "(null)";
+     b07:	c7 45 f4 c6 10 00 00 	movl   $0x10c6,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     b0e:	83 ec 0c             	sub    $0xc,%esp
+     b11:	ff 75 f4             	push   -0xc(%ebp)
+     b14:	e8 47 f8 ff ff       	call   360 <strlen>
+     b19:	83 c4 10             	add    $0x10,%esp
+     b1c:	83 ec 04             	sub    $0x4,%esp
+     b1f:	50                   	push   %eax
+     b20:	ff 75 f4             	push   -0xc(%ebp)
+     b23:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b29:	50                   	push   %eax
+     b2a:	e8 8a fc ff ff       	call   7b9 <put>
+     b2f:	83 c4 10             	add    $0x10,%esp
+     b32:	eb 75                	jmp    ba9 <printf+0x1b7>
+      } else if(c == 'c'){
+     b34:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b38:	75 21                	jne    b5b <printf+0x169>
+        putc(&o, *ap);
+     b3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b3d:	8b 00                	mov    (%eax),%eax
+     b3f:	0f be c0             	movsbl %al,%eax
+     b42:	83 ec 08             	sub    $0x8,%esp
+     b45:	50                   	push   %eax
+     b46:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b4c:	50                   	push   %eax
+     b4d:	e8 58 fd ff ff       	call   8aa <putc>
+     b52:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b55:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b59:	eb 4e                	jmp    ba9 <printf+0x1b7>
+      } else if(c == '%'){
+     b5b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b5f:	75 1b                	jne    b7c <printf+0x18a>
+        putc(&o, c);
+     b61:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b64:	0f be c0             	movsbl %al,%eax
+     b67:	83 ec 08             	sub    $0x8,%esp
+     b6a:	50                   	push   %eax
+     b6b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b71:	50                   	push   %eax
+     b72:	e8 33 fd ff ff       	call   8aa <putc>
+     b77:	83 c4 10             	add    $0x10,%esp
+     b7a:	eb 2d                	jmp    ba9 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b7c:	83 ec 08             	sub    $0x8,%esp
+     b7f:	6a 25                	push   $0x25
+     b81:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b87:	50                   	push   %eax
+     b88:	e8 1d fd ff ff       	call   8aa <putc>
+     b8d:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b93:	0f be c0             	movsbl %al,%eax
+     b96:	83 ec 08             	sub    $0x8,%esp
+     b99:	50                   	push   %eax
+     b9a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ba0:	50                   	push   %eax
+     ba1:	e8 04 fd ff ff       	call   8aa <putc>
+     ba6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ba9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     bb0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb3:	83 c0 01             	add    $0x1,%eax
+     bb6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bb9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     bbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bc3:	01 d0                	add    %edx,%eax
+     bc5:	0f b6 00             	movzbl (%eax),%eax
+     bc8:	84 c0                	test   %al,%al
+     bca:	0f 85 6b fe ff ff    	jne    a3b <printf+0x49>
+    }
+  }
+  if(state == 0)
+     bd0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     bd4:	75 22                	jne    bf8 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     bd6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bd9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     bdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     bdf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     be2:	01 ca                	add    %ecx,%edx
+     be4:	83 ec 04             	sub    $0x4,%esp
+     be7:	50                   	push   %eax
+     be8:	52                   	push   %edx
+     be9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bef:	50                   	push   %eax
+     bf0:	e8 c4 fb ff ff       	call   7b9 <put>
+     bf5:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     bf8:	83 ec 0c             	sub    $0xc,%esp
+     bfb:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c01:	50                   	push   %eax
+     c02:	e8 69 fb ff ff       	call   770 <flush>
+     c07:	83 c4 10             	add    $0x10,%esp
+}
+     c0a:	90                   	nop
+     c0b:	c9                   	leave
+     c0c:	c3                   	ret
+
+00000c0d <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     c0d:	55                   	push   %ebp
+     c0e:	89 e5                	mov    %esp,%ebp
+     c10:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     c13:	8b 55 08             	mov    0x8(%ebp),%edx
+     c16:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c1c:	f0 87 02             	lock xchg %eax,(%edx)
+     c1f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     c22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     c25:	c9                   	leave
+     c26:	c3                   	ret
+
+00000c27 <lock>:
+{
+     c27:	55                   	push   %ebp
+     c28:	89 e5                	mov    %esp,%ebp
+     c2a:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     c2d:	a1 90 14 00 00       	mov    0x1490,%eax
+     c32:	85 c0                	test   %eax,%eax
+     c34:	74 09                	je     c3f <lock+0x18>
+     c36:	a1 90 14 00 00       	mov    0x1490,%eax
+     c3b:	ff d0                	call   *%eax
+     c3d:	eb 05                	jmp    c44 <lock+0x1d>
+     c3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c44:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c47:	90                   	nop
+     c48:	83 ec 08             	sub    $0x8,%esp
+     c4b:	6a 01                	push   $0x1
+     c4d:	68 c8 14 00 00       	push   $0x14c8
+     c52:	e8 b6 ff ff ff       	call   c0d <xchg>
+     c57:	83 c4 10             	add    $0x10,%esp
+     c5a:	85 c0                	test   %eax,%eax
+     c5c:	75 ea                	jne    c48 <lock+0x21>
+  return pin;
+     c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c61:	c9                   	leave
+     c62:	c3                   	ret
+
+00000c63 <unlock>:
+{
+     c63:	55                   	push   %ebp
+     c64:	89 e5                	mov    %esp,%ebp
+     c66:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c69:	6a 00                	push   $0x0
+     c6b:	68 c8 14 00 00       	push   $0x14c8
+     c70:	e8 98 ff ff ff       	call   c0d <xchg>
+     c75:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c78:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c7c:	78 10                	js     c8e <unlock+0x2b>
+    mallocunpin(pin);
+     c7e:	a1 94 14 00 00       	mov    0x1494,%eax
+     c83:	83 ec 0c             	sub    $0xc,%esp
+     c86:	ff 75 08             	push   0x8(%ebp)
+     c89:	ff d0                	call   *%eax
+     c8b:	83 c4 10             	add    $0x10,%esp
+}
+     c8e:	90                   	nop
+     c8f:	c9                   	leave
+     c90:	c3                   	ret
+
+00000c91 <sizeclass>:
+{
+     c91:	55                   	push   %ebp
+     c92:	89 e5                	mov    %esp,%ebp
+     c94:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c97:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c9e:	eb 1c                	jmp    cbc <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     ca0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ca3:	ba 02 00 00 00       	mov    $0x2,%edx
+     ca8:	89 c1                	mov    %eax,%ecx
+     caa:	d3 e2                	shl    %cl,%edx
+     cac:	89 d0                	mov    %edx,%eax
+     cae:	3b 45 08             	cmp    0x8(%ebp),%eax
+     cb1:	72 05                	jb     cb8 <sizeclass+0x27>
+      return c;
+     cb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cb6:	eb 0f                	jmp    cc7 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     cb8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     cbc:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     cc0:	7e de                	jle    ca0 <sizeclass+0xf>
+  return -1;
+     cc2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     cc7:	c9                   	leave
+     cc8:	c3                   	ret
+
+00000cc9 <bigfree>:
+{
+     cc9:	55                   	push   %ebp
+     cca:	89 e5                	mov    %esp,%ebp
+     ccc:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ccf:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     cd4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cd7:	eb 24                	jmp    cfd <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cd9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cdc:	8b 00                	mov    (%eax),%eax
+     cde:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ce1:	72 12                	jb     cf5 <bigfree+0x2c>
+     ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ce9:	72 24                	jb     d0f <bigfree+0x46>
+     ceb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cee:	8b 00                	mov    (%eax),%eax
+     cf0:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cf3:	72 1a                	jb     d0f <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cf5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cf8:	8b 00                	mov    (%eax),%eax
+     cfa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+     d00:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d03:	73 d4                	jae    cd9 <bigfree+0x10>
+     d05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d08:	8b 00                	mov    (%eax),%eax
+     d0a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d0d:	73 ca                	jae    cd9 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d12:	8b 40 04             	mov    0x4(%eax),%eax
+     d15:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1f:	01 c2                	add    %eax,%edx
+     d21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d24:	8b 00                	mov    (%eax),%eax
+     d26:	39 c2                	cmp    %eax,%edx
+     d28:	75 24                	jne    d4e <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2d:	8b 50 04             	mov    0x4(%eax),%edx
+     d30:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d33:	8b 00                	mov    (%eax),%eax
+     d35:	8b 40 04             	mov    0x4(%eax),%eax
+     d38:	01 c2                	add    %eax,%edx
+     d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d3d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d43:	8b 00                	mov    (%eax),%eax
+     d45:	8b 10                	mov    (%eax),%edx
+     d47:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4a:	89 10                	mov    %edx,(%eax)
+     d4c:	eb 0a                	jmp    d58 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d51:	8b 10                	mov    (%eax),%edx
+     d53:	8b 45 08             	mov    0x8(%ebp),%eax
+     d56:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d5b:	8b 40 04             	mov    0x4(%eax),%eax
+     d5e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d68:	01 d0                	add    %edx,%eax
+     d6a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d6d:	75 20                	jne    d8f <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d72:	8b 50 04             	mov    0x4(%eax),%edx
+     d75:	8b 45 08             	mov    0x8(%ebp),%eax
+     d78:	8b 40 04             	mov    0x4(%eax),%eax
+     d7b:	01 c2                	add    %eax,%edx
+     d7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d80:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d83:	8b 45 08             	mov    0x8(%ebp),%eax
+     d86:	8b 10                	mov    (%eax),%edx
+     d88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d8b:	89 10                	mov    %edx,(%eax)
+     d8d:	eb 08                	jmp    d97 <bigfree+0xce>
+    p->s.ptr = bp;
+     d8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d92:	8b 55 08             	mov    0x8(%ebp),%edx
+     d95:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d9a:	a3 a0 14 00 00       	mov    %eax,0x14a0
+}
+     d9f:	90                   	nop
+     da0:	c9                   	leave
+     da1:	c3                   	ret
+
+00000da2 <free>:
+{
+     da2:	55                   	push   %ebp
+     da3:	89 e5                	mov    %esp,%ebp
+     da5:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     da8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     dac:	74 68                	je     e16 <free+0x74>
+  bp = (Header*)ap - 1;
+     dae:	8b 45 08             	mov    0x8(%ebp),%eax
+     db1:	83 e8 08             	sub    $0x8,%eax
+     db4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     db7:	e8 6b fe ff ff       	call   c27 <lock>
+     dbc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     dbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dc2:	8b 40 04             	mov    0x4(%eax),%eax
+     dc5:	83 ec 0c             	sub    $0xc,%esp
+     dc8:	50                   	push   %eax
+     dc9:	e8 c3 fe ff ff       	call   c91 <sizeclass>
+     dce:	83 c4 10             	add    $0x10,%esp
+     dd1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     dd4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     dd8:	78 1e                	js     df8 <free+0x56>
+    bp->s.ptr = classfree[c];
+     dda:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ddd:	8b 14 85 a4 14 00 00 	mov    0x14a4(,%eax,4),%edx
+     de4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de7:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     de9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dec:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     def:	89 14 85 a4 14 00 00 	mov    %edx,0x14a4(,%eax,4)
+     df6:	eb 0e                	jmp    e06 <free+0x64>
+    bigfree(bp);
+     df8:	83 ec 0c             	sub    $0xc,%esp
+     dfb:	ff 75 f4             	push   -0xc(%ebp)
+     dfe:	e8 c6 fe ff ff       	call   cc9 <bigfree>
+     e03:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     e06:	83 ec 0c             	sub    $0xc,%esp
+     e09:	ff 75 f0             	push   -0x10(%ebp)
+     e0c:	e8 52 fe ff ff       	call   c63 <unlock>
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	eb 01                	jmp    e17 <free+0x75>
+    return;
+     e16:	90                   	nop
+}
+     e17:	c9                   	leave
+     e18:	c3                   	ret
+
+00000e19 <morecore>:
+{
+     e19:	55                   	push   %ebp
+     e1a:	89 e5                	mov    %esp,%ebp
+     e1c:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     e1f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     e26:	77 07                	ja     e2f <morecore+0x16>
+    nu = 4096;
+     e28:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+     e32:	c1 e0 03             	shl    $0x3,%eax
+     e35:	83 ec 0c             	sub    $0xc,%esp
+     e38:	50                   	push   %eax
+     e39:	e8 b6 f7 ff ff       	call   5f4 <sbrk>
+     e3e:	83 c4 10             	add    $0x10,%esp
+     e41:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e44:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e48:	75 07                	jne    e51 <morecore+0x38>
+    return 0;
+     e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4f:	eb 22                	jmp    e73 <morecore+0x5a>
+  hp = (Header*)p;
+     e51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e54:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+     e5d:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e60:	83 ec 0c             	sub    $0xc,%esp
+     e63:	ff 75 f0             	push   -0x10(%ebp)
+     e66:	e8 5e fe ff ff       	call   cc9 <bigfree>
+     e6b:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e6e:	a1 a0 14 00 00       	mov    0x14a0,%eax
+}
+     e73:	c9                   	leave
+     e74:	c3                   	ret
+
+00000e75 <bigalloc>:
+{
+     e75:	55                   	push   %ebp
+     e76:	89 e5                	mov    %esp,%ebp
+     e78:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e7b:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     e80:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e83:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e87:	75 23                	jne    eac <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e89:	c7 45 f0 98 14 00 00 	movl   $0x1498,-0x10(%ebp)
+     e90:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e93:	a3 a0 14 00 00       	mov    %eax,0x14a0
+     e98:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     e9d:	a3 98 14 00 00       	mov    %eax,0x1498
+    base.s.size = 0;
+     ea2:	c7 05 9c 14 00 00 00 	movl   $0x0,0x149c
+     ea9:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eaf:	8b 00                	mov    (%eax),%eax
+     eb1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb7:	8b 40 04             	mov    0x4(%eax),%eax
+     eba:	3b 45 08             	cmp    0x8(%ebp),%eax
+     ebd:	72 4a                	jb     f09 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec2:	8b 40 04             	mov    0x4(%eax),%eax
+     ec5:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ec8:	75 0c                	jne    ed6 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     eca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ecd:	8b 10                	mov    (%eax),%edx
+     ecf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed2:	89 10                	mov    %edx,(%eax)
+     ed4:	eb 26                	jmp    efc <bigalloc+0x87>
+        p->s.size -= nunits;
+     ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed9:	8b 40 04             	mov    0x4(%eax),%eax
+     edc:	2b 45 08             	sub    0x8(%ebp),%eax
+     edf:	89 c2                	mov    %eax,%edx
+     ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     ee7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eea:	8b 40 04             	mov    0x4(%eax),%eax
+     eed:	c1 e0 03             	shl    $0x3,%eax
+     ef0:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     ef3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+     ef9:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     efc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eff:	a3 a0 14 00 00       	mov    %eax,0x14a0
+      return p;
+     f04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f07:	eb 3b                	jmp    f44 <bigalloc+0xcf>
+    if(p == freep)
+     f09:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     f0e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     f11:	75 1e                	jne    f31 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     f13:	83 ec 0c             	sub    $0xc,%esp
+     f16:	ff 75 08             	push   0x8(%ebp)
+     f19:	e8 fb fe ff ff       	call   e19 <morecore>
+     f1e:	83 c4 10             	add    $0x10,%esp
+     f21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f24:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f28:	75 07                	jne    f31 <bigalloc+0xbc>
+        return 0;
+     f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2f:	eb 13                	jmp    f44 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f3a:	8b 00                	mov    (%eax),%eax
+     f3c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f3f:	e9 70 ff ff ff       	jmp    eb4 <bigalloc+0x3f>
+}
+     f44:	c9                   	leave
+     f45:	c3                   	ret
+
+00000f46 <alloc>:
+alloc(uint nbytes)
+{
+     f46:	55                   	push   %ebp
+     f47:	89 e5                	mov    %esp,%ebp
+     f49:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f4f:	83 c0 07             	add    $0x7,%eax
+     f52:	c1 e8 03             	shr    $0x3,%eax
+     f55:	83 c0 01             	add    $0x1,%eax
+     f58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f5b:	ff 75 f4             	push   -0xc(%ebp)
+     f5e:	e8 2e fd ff ff       	call   c91 <sizeclass>
+     f63:	83 c4 04             	add    $0x4,%esp
+     f66:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f69:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f6d:	79 2c                	jns    f9b <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f6f:	83 ec 0c             	sub    $0xc,%esp
+     f72:	ff 75 f4             	push   -0xc(%ebp)
+     f75:	e8 fb fe ff ff       	call   e75 <bigalloc>
+     f7a:	83 c4 10             	add    $0x10,%esp
+     f7d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f80:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f84:	75 0a                	jne    f90 <alloc+0x4a>
+      return 0;
+     f86:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8b:	e9 c8 00 00 00       	jmp    1058 <alloc+0x112>
+    return (void*)(p + 1);
+     f90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f93:	83 c0 08             	add    $0x8,%eax
+     f96:	e9 bd 00 00 00       	jmp    1058 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f9e:	8b 04 85 a4 14 00 00 	mov    0x14a4(,%eax,4),%eax
+     fa5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fa8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fac:	74 1a                	je     fc8 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     fae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fb1:	8b 10                	mov    (%eax),%edx
+     fb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fb6:	89 14 85 a4 14 00 00 	mov    %edx,0x14a4(,%eax,4)
+    return (void*)(p + 1);
+     fbd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc0:	83 c0 08             	add    $0x8,%eax
+     fc3:	e9 90 00 00 00       	jmp    1058 <alloc+0x112>
+  }
+  nunits = 2 << c;
+     fc8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fcb:	ba 02 00 00 00       	mov    $0x2,%edx
+     fd0:	89 c1                	mov    %eax,%ecx
+     fd2:	d3 e2                	shl    %cl,%edx
+     fd4:	89 d0                	mov    %edx,%eax
+     fd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     fd9:	a1 c0 14 00 00       	mov    0x14c0,%eax
+     fde:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fe1:	c1 e2 03             	shl    $0x3,%edx
+     fe4:	01 d0                	add    %edx,%eax
+     fe6:	8b 15 c4 14 00 00    	mov    0x14c4,%edx
+     fec:	39 c2                	cmp    %eax,%edx
+     fee:	73 3f                	jae    102f <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	68 00 08 00 00       	push   $0x800
+     ff8:	e8 78 fe ff ff       	call   e75 <bigalloc>
+     ffd:	83 c4 10             	add    $0x10,%esp
+    1000:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1003:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1007:	75 07                	jne    1010 <alloc+0xca>
+      return 0;
+    1009:	b8 00 00 00 00       	mov    $0x0,%eax
+    100e:	eb 48                	jmp    1058 <alloc+0x112>
+    bump = (char*)p;
+    1010:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1013:	a3 c0 14 00 00       	mov    %eax,0x14c0
+    bumpend = (char*)(p + p->s.size);
+    1018:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101b:	8b 40 04             	mov    0x4(%eax),%eax
+    101e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1025:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1028:	01 d0                	add    %edx,%eax
+    102a:	a3 c4 14 00 00       	mov    %eax,0x14c4
+  }
+  p = (Header*)bump;
+    102f:	a1 c0 14 00 00       	mov    0x14c0,%eax
+    1034:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1037:	a1 c0 14 00 00       	mov    0x14c0,%eax
+    103c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    103f:	c1 e2 03             	shl    $0x3,%edx
+    1042:	01 d0                	add    %edx,%eax
+    1044:	a3 c0 14 00 00       	mov    %eax,0x14c0
+  p->s.size = nunits;
+    1049:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    104c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    104f:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1052:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1055:	83 c0 08             	add    $0x8,%eax
+}
+    1058:	c9                   	leave
+    1059:	c3                   	ret
+
+0000105a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    105a:	55                   	push   %ebp
+    105b:	89 e5                	mov    %esp,%ebp
+    105d:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1060:	e8 c2 fb ff ff       	call   c27 <lock>
+    1065:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    106b:	ff 75 08             	push   0x8(%ebp)
+    106e:	e8 d3 fe ff ff       	call   f46 <alloc>
+    1073:	83 c4 10             	add    $0x10,%esp
+    1076:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1079:	83 ec 0c             	sub    $0xc,%esp
+    107c:	ff 75 f4             	push   -0xc(%ebp)
+    107f:	e8 df fb ff ff       	call   c63 <unlock>
+    1084:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1087:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    108a:	c9                   	leave
+    108b:	c3                   	ret
@@ -1,19 +1,58 @@
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+#include "dent.h"
+
+// Remove path, and with recurse everything under it first.
+static int
+rm(char *path, int recurse)
+{
+  char buf[MAXPATH], *p;
+  struct dent d[4];
+  struct stat st;
+  int fd, i, n, r;
+
+  if(!recurse || (fd = open(path, O_IGNLINK)) < 0)
+    return unlink(path);
+  if(fstat(fd, &st) < 0 || st.type != T_DIR ||
+     strlen(path) + 1 + DIRSIZ + 1 > sizeof(buf)){
+    close(fd);
+    return unlink(path);
+  }
+  strcpy(buf, path);
+  p = buf + strlen(buf);
+  *p++ = '/';
+  r = 0;
+  while(r == 0 && (n = getdents(fd, d, sizeof(d)/sizeof(d[0]))) > 0){
+    for(i = 0; i < n && r == 0; i++){
+      if(strcmp(d[i].name, ".") == 0 || strcmp(d[i].name, "..") == 0)
+        continue;
+      strcpy(p, d[i].name);
+      // Only directories need looking into.
+      r = rm(buf, d[i].type == T_DIR);
+    }
+  }
+  close(fd);
+  if(r < 0)
+    return -1;
+  return unlink(path);
+}
 
 int
 main(int argc, char *argv[])
 {
-  int i;
+  int i, recurse;
 
-  if(argc < 2){
-    printf(2, "Usage: rm files...\n");
+  recurse = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(argc < 2 + recurse){
+    printf(2, "Usage: rm [-r] files...\n");
     exit();
   }
 
-  for(i = 1; i < argc; i++){
-    if(unlink(argv[i]) < 0){
+  for(i = 1 + recurse; i < argc; i++){
+    if(rm(argv[i], recurse) < 0){
       printf(2, "rm: %s failed to delete\n", argv[i]);
       break;
     }
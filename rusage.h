@@ -0,0 +1,13 @@
+// Resource usage, as getrusage reports it.
+struct rusage {
+  uint utime;    // clock ticks running in user mode
+  uint stime;    // clock ticks running in the kernel
+  uint nvcsw;    // times it slept
+  uint nivcsw;   // times it was preempted
+  uint nfault;   // page faults handled
+  uint nblkin;   // disk blocks read
+  uint nblkout;  // disk blocks written
+};
+
+#define RUSAGE_SELF      0   // all threads of the calling process
+#define RUSAGE_CHILDREN  -1  // children it has waited for, and theirs
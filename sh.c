@@ -52,6 +52,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int gettoken(char**, char*, char**, char**);
 
 // Execute cmd.  Never returns.
 void
@@ -130,6 +131,66 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+// Run buf with spawn if it is a simple command -- just words and
+// at most one < and one > or >> -- which saves forking a copy of
+// the shell only to have it exec.  Return -1, leaving buf alone,
+// if it is anything else; runcmd handles that.
+int
+runsimple(char *buf)
+{
+  char *s, *es, *q, *eq, *argv[MAXARGS], *eargv[MAXARGS];
+  char *file[2], *efile[2];
+  int tok, argc, i, fd, pid, fds[3];
+
+  s = buf;
+  es = s + strlen(s);
+  argc = 0;
+  file[0] = file[1] = 0;
+  while((tok = gettoken(&s, es, &q, &eq)) != 0){
+    if(tok == 'a'){
+      if(argc >= MAXARGS-1)
+        return -1;
+      argv[argc] = q;
+      eargv[argc++] = eq;
+      continue;
+    }
+    if(tok != '<' && tok != '>' && tok != '+')
+      return -1;
+    fd = tok == '<' ? 0 : 1;
+    if(file[fd] || gettoken(&s, es, &q, &eq) != 'a')
+      return -1;
+    file[fd] = q;
+    efile[fd] = eq;
+  }
+  if(argc == 0)
+    return -1;
+  argv[argc] = 0;
+  for(i = 0; i < argc; i++)
+    *eargv[i] = 0;
+  for(i = 0; i < 2; i++)
+    if(file[i])
+      *efile[i] = 0;
+
+  for(i = 0; i < 3; i++)
+    fds[i] = i;
+  for(i = 0; i < 2; i++){
+    if(file[i] && (fds[i] = open(file[i], i == 0 ? O_RDONLY : O_WRONLY|O_CREATE)) < 0){
+      printf(2, "open %s failed\n", file[i]);
+      goto out;
+    }
+  }
+  if((pid = spawn(argv[0], argv, fds, 3)) < 0)
+    printf(2, "exec %s failed\n", argv[0]);
+  else
+    while((i = wait()) >= 0 && i != pid)
+      ;
+ out:
+  for(i = 0; i < 2; i++)
+    if(file[i] && fds[i] >= 0)
+      close(fds[i]);
+  return 0;
+}
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -165,6 +226,8 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
+    if(runsimple(buf) == 0)
+      continue;
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
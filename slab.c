@@ -0,0 +1,248 @@
+// Slab allocator for small kernel objects.
+//
+// A slabcache hands out objects of one size.  It takes kalloc()
+// pages, the slabs, and divides each into a header followed by
+// as many objects as fit.  A slab's header keeps the indices of
+// its free objects in a list, so that a free object can keep the
+// state the constructor gave it: ctor runs once per object, when
+// its slab is created, and an object goes back to the cache in
+// that constructed state.  dtor, if any, undoes ctor when the
+// slab is returned to kalloc().  slabfree() finds an object's slab
+// from its address, since a slab is one page.
+//
+// Each CPU keeps a magazine of up to SLABMAG objects it freed,
+// and slaballoc() takes from it without locking; only when it is
+// empty or full does the CPU go to the slabs, under the cache
+// lock, moving half a magazine at a time.
+//
+// Slabs with no objects in use go back to kalloc(), apart from
+// one kept as a spare.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "slab.h"
+
+#define NOFREE 0xffff  // end of a slab's free list
+
+struct slab {
+  struct slab *next;        // on the cache's partial list
+  struct slab *prev;
+  struct slabcache *cache;
+  int inuse;                // objects allocated
+  ushort free;              // first free object
+  ushort link[];            // next free object after each
+};
+
+// Set up c to hand out objects of size bytes, calling ctor on
+// each as it is created and dtor as it is destroyed.  Objects of
+// a cache line or more start on a line, so that two CPUs using
+// neighbouring ones do not share one.
+void
+slabinit(struct slabcache *c, char *name, uint size,
+         void (*ctor)(void*), void (*dtor)(void*))
+{
+  uint align;
+
+  initlock(&c->lock, name);
+  c->name = name;
+  align = size >= CACHELINE ? CACHELINE : 8;
+  c->size = (size + align-1) & ~(align-1);
+  c->perslab = (PGSIZE - sizeof(struct slab)) / (c->size + sizeof(ushort));
+  for(;;){
+    if(c->perslab < 1 || c->perslab >= NOFREE)
+      panic("slabinit");
+    c->off = (sizeof(struct slab) + c->perslab*sizeof(ushort) + align-1) & ~(align-1);
+    if(c->off + c->perslab*c->size <= PGSIZE)
+      break;
+    c->perslab--;
+  }
+  c->ctor = ctor;
+  c->dtor = dtor;
+}
+
+static char*
+slabobj(struct slabcache *c, struct slab *s, int i)
+{
+  return (char*)s + c->off + i*c->size;
+}
+
+static void
+unlinkslab(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+static void
+linkslab(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Make a new slab of constructed objects.  Called without c->lock,
+// since kalloc() may take other caches' locks.
+static struct slab*
+newslab(struct slabcache *c)
+{
+  struct slab *s;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  for(i = 0; i < c->perslab; i++){
+    s->link[i] = i + 1 < c->perslab ? i + 1 : NOFREE;
+    if(c->ctor)
+      c->ctor(slabobj(c, s, i));
+  }
+  s->free = 0;
+  return s;
+}
+
+// Destroy the objects of slab s, none in use, and free it.
+static void
+freeslab(struct slabcache *c, struct slab *s)
+{
+  int i;
+
+  if(c->dtor)
+    for(i = 0; i < c->perslab; i++)
+      c->dtor(slabobj(c, s, i));
+  kfree((char*)s);
+}
+
+// Take a free object from the slabs, or return 0 if no slab has
+// one.  Caller holds c->lock.
+static void*
+take(struct slabcache *c)
+{
+  struct slab *s;
+  int i;
+
+  if(c->partial == 0 && c->empty){
+    linkslab(c, c->empty);
+    c->empty = 0;
+  }
+  if((s = c->partial) == 0)
+    return 0;
+  i = s->free;
+  s->free = s->link[i];
+  s->inuse++;
+  if(s->free == NOFREE)
+    unlinkslab(c, s);
+  return slabobj(c, s, i);
+}
+
+// Return object o to its slab.  Return the slab if it has become
+// surplus to requirements and the caller should kfree it.
+// Caller holds c->lock.
+static struct slab*
+put(struct slabcache *c, void *o)
+{
+  struct slab *s;
+  int i;
+
+  s = (struct slab*)PGROUNDDOWN((uint)o);
+  if(s->cache != c)
+    panic("slabfree");
+  i = ((char*)o - (char*)s - c->off) / c->size;
+  if(s->free == NOFREE)
+    linkslab(c, s);
+  s->link[i] = s->free;
+  s->free = i;
+  if(--s->inuse > 0)
+    return 0;
+  unlinkslab(c, s);
+  if(c->empty == 0){
+    c->empty = s;
+    return 0;
+  }
+  c->nslab--;
+  return s;
+}
+
+// Allocate an object from c.  Returns 0 if out of memory.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct slabmag *m;
+  struct slab *s;
+  void *o;
+
+  pushcli();
+  m = &c->mag[cpu->id];
+  if(m->n > 0){
+    o = m->obj[--m->n];
+    popcli();
+    return o;
+  }
+  popcli();
+
+  acquire(&c->lock);
+  if((o = take(c)) == 0){
+    release(&c->lock);
+    if((s = newslab(c)) == 0)
+      return 0;
+    acquire(&c->lock);
+    c->nslab++;
+    linkslab(c, s);
+    o = take(c);
+  }
+  // Refill this CPU's magazine while the lock keeps us on it.
+  m = &c->mag[cpu->id];
+  while(m->n < SLABMAG/2 && c->partial)
+    m->obj[m->n++] = take(c);
+  release(&c->lock);
+  return o;
+}
+
+// Return object o, which slaballoc(c) returned, to c.
+void
+slabfree(struct slabcache *c, void *o)
+{
+  struct slabmag *m;
+  struct slab *s, *dead;
+
+  pushcli();
+  m = &c->mag[cpu->id];
+  if(m->n < SLABMAG){
+    m->obj[m->n++] = o;
+    popcli();
+    return;
+  }
+  popcli();
+
+  // Move half the magazine back to the slabs.
+  dead = 0;
+  acquire(&c->lock);
+  if((s = put(c, o)) != 0){
+    s->next = dead;
+    dead = s;
+  }
+  m = &c->mag[cpu->id];
+  while(m->n > SLABMAG/2){
+    o = m->obj[--m->n];
+    if((s = put(c, o)) != 0){
+      s->next = dead;
+      dead = s;
+    }
+  }
+  release(&c->lock);
+  while((s = dead) != 0){
+    dead = s->next;
+    freeslab(c, s);
+  }
+}
@@ -0,0 +1,26 @@
+// Object cache: a pool of equal-sized kernel objects carved
+// out of kalloc() pages.  See slab.c.
+
+#define SLABMAG 16  // objects in a per-CPU magazine
+
+struct slab;
+
+// Objects freed recently by one CPU, on lines of its own.
+struct slabmag {
+  int n;
+  void *obj[SLABMAG];
+} __attribute__((aligned(CACHELINE)));
+
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;                // object size, rounded up
+  uint off;                 // offset of the first object in a slab
+  int perslab;              // objects per slab
+  void (*ctor)(void*);      // constructor, or 0
+  void (*dtor)(void*);      // destructor, or 0
+  struct slab *partial;     // slabs with objects free
+  struct slab *empty;       // one spare slab with none in use
+  int nslab;                // slabs allocated
+  struct slabmag mag[NCPU];
+};
@@ -13,8 +13,32 @@ void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lockregister(lk);
+}
+
+// Count an acquisition of lk from pc.  callers[] keeps the NLOCKPC
+// most frequent callers: a new one takes the place of the least
+// frequent and inherits its count, so counts are upper bounds.
+static void
+countcaller(struct spinlock *lk, uint pc)
+{
+  int i, min;
+
+  min = 0;
+  for(i = 0; i < NLOCKPC; i++){
+    if(lk->callers[i] == pc)
+      break;
+    if(lk->ncaller[i] < lk->ncaller[min])
+      min = i;
+  }
+  if(i == NLOCKPC){
+    i = min;
+    lk->callers[i] = pc;
+  }
+  lk->ncaller[i]++;
 }
 
 // Acquire the lock.
@@ -24,19 +48,35 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket, t0, spun;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
+  // The xadd is atomic.
   // It also serializes, so that reads after acquire are not
-  // reordered before it. 
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // reordered before it.  Waiters only read owner, so the
+  // lock's cache line is written once per hand-off.
+  ticket = xadd(&lk->next, 1);
+  spun = 0;
+  if(*(volatile uint*)&lk->owner != ticket){
+    t0 = rdtsc();
+    while(*(volatile uint*)&lk->owner != ticket)
+      pause();
+    spun = rdtsc() - t0;
+  }
 
   // Record info about lock acquisition for debugging.
   lk->cpu = cpu;
   getcallerpcs(&lk, lk->pcs);
+  lk->nacquire++;
+  if(spun){
+    lk->ncontend++;
+    lk->spincycles += spun;
+  }
+  countcaller(lk, lk->pcs[0]);
+  lk->t0 = rdtsc();
 }
 
 // Release the lock.
@@ -46,6 +86,7 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
+  lk->holdcycles += rdtsc() - lk->t0;
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -55,10 +96,10 @@ release(struct spinlock *lk)
   // any order, which implies we need to serialize here.
   // But the 2007 Intel 64 Architecture Memory Ordering White
   // Paper says that Intel 64 and IA-32 will not move a load
-  // after a store. So lock->locked = 0 would work here.
+  // after a store. So lock->owner++ would work here.
   // The xchg being asm volatile ensures gcc emits it after
   // the above assignments (and after the critical section).
-  xchg(&lk->locked, 0);
+  xchg(&lk->owner, lk->owner + 1);
 
   popcli();
 }
@@ -85,7 +126,7 @@ getcallerpcs(void *v, uint pcs[])
 int
 holding(struct spinlock *lock)
 {
-  return lock->locked && lock->cpu == cpu;
+  return lock->next != lock->owner && lock->cpu == cpu;
 }
 
 
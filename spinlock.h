@@ -1,11 +1,32 @@
+#define NLOCKPC 4   // callers tracked per lock
+
 // Mutual exclusion lock.
+// A ticket lock: each acquirer takes the next ticket and waits
+// until owner reaches it, so CPUs get the lock in arrival order.
+// The tickets have a cache line to themselves, apart from what
+// the holder writes, so that waiters spinning on owner are not
+// disturbed until the hand-off.  So a lock, and anything holding
+// one, is cache-line aligned.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out
+  uint owner;        // Ticket now holding the lock
   
   // For debugging:
-  char *name;        // Name of lock.
+  char *name __attribute__((aligned(CACHELINE)));  // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
-};
 
+  // Statistics, updated by the holder:
+  uint nacquire;     // Times acquired
+  uint ncontend;     // Times an acquirer had to wait
+  uint spincycles;   // TSC cycles spent waiting (wraps)
+  uint holdcycles;   // TSC cycles spent held (wraps)
+  uint t0;           // TSC when the holder got it
+  uint callers[NLOCKPC];  // Callers that acquired it most often,
+  uint ncaller[NLOCKPC];  //   approximately, and their counts
+
+  // On the lockstat registry; see lockstat.c.
+  struct spinlock *lnext;
+  struct spinlock *lprev;
+};
@@ -103,3 +103,104 @@ strlen(const char *s)
   return n;
 }
 
+
+static void
+sputc(char *buf, int n, int *len, int c)
+{
+  if(*len < n - 1)
+    buf[*len] = c;
+  (*len)++;
+}
+
+// Format like cprintf into buf, which holds n bytes, and
+// nul-terminate it.  Understands %d, %u, %x, %p and %s, with an
+// optional field width, left-justified after a '-'.  Return the
+// length of the result, which is cut short if buf is too small.
+int
+snprintf(char *buf, int n, char *fmt, ...)
+{
+  char tmp[16], *s;
+  uint *argp, x, base;
+  int i, c, len, w, left, neg;
+
+  argp = (uint*)(void*)(&fmt + 1);
+  len = 0;
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+    if(c != '%'){
+      sputc(buf, n, &len, c);
+      continue;
+    }
+    left = 0;
+    if(fmt[i+1] == '-'){
+      left = 1;
+      i++;
+    }
+    for(w = 0; fmt[i+1] >= '0' && fmt[i+1] <= '9'; i++)
+      w = w*10 + fmt[i+1] - '0';
+    c = fmt[++i] & 0xff;
+    if(c == 0)
+      break;
+    switch(c){
+    case 'd':
+    case 'u':
+    case 'x':
+    case 'p':
+      x = *argp++;
+      neg = c == 'd' && (int)x < 0;
+      if(neg)
+        x = -x;
+      base = c == 'x' || c == 'p' ? 16 : 10;
+      s = tmp + sizeof(tmp);
+      *--s = 0;
+      do
+        *--s = "0123456789abcdef"[x % base];
+      while((x /= base) != 0);
+      if(neg)
+        *--s = '-';
+      break;
+    case 's':
+      if((s = (char*)*argp++) == 0)
+        s = "(null)";
+      break;
+    case '%':
+      s = "%";
+      break;
+    default:
+      // Print unknown % sequence to draw attention.
+      tmp[0] = '%';
+      tmp[1] = c;
+      tmp[2] = 0;
+      s = tmp;
+      break;
+    }
+    w -= strlen(s);
+    for(; !left && w > 0; w--)
+      sputc(buf, n, &len, ' ');
+    while(*s)
+      sputc(buf, n, &len, *s++);
+    for(; w > 0; w--)
+      sputc(buf, n, &len, ' ');
+  }
+  if(n <= 0)
+    return 0;
+  if(len > n - 1)
+    len = n - 1;
+  buf[len] = 0;
+  return len;
+}
+
+// Copy the bytes of line, which sits at *pos in a report that a
+// device makes up as it is read, that fall in [off, off+n) to dst,
+// and advance *pos past it.
+void
+emitline(char *line, uint *pos, char *dst, uint off, int n)
+{
+  uint start, end, len;
+
+  len = strlen(line);
+  start = *pos > off ? *pos : off;
+  end = *pos + len < off + n ? *pos + len : off + n;
+  if(start < end)
+    memmove(dst + (start - off), line + (start - *pos), end - start);
+  *pos += len;
+}
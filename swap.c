@@ -0,0 +1,157 @@
+// Swap space: slots of disk that hold pages of process memory
+// paged out by swapout (see vm.c).
+//
+// mkfs -w reserves sb.nswap blocks after the file system's
+// sb.size, and fsinit hands them over with swapinit.  The area is
+// a row of slots of a page each.  A page table entry of a
+// paged-out page holds its slot (see PTE_SWAP in mmu.h); fork's
+// copy of the page table names the same slot, so each slot counts
+// the entries that name it, and is free when none do.
+//
+// One page moves at a time, through bufs of swap's own.  The
+// area lies past every block the file system uses, so the block
+// cache never holds its blocks.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "fs.h"
+#include "buf.h"
+#include "kstat.h"
+
+#define SPP (PGSIZE / BSIZE)  // blocks per slot
+
+struct {
+  struct spinlock lock;      // the slots; taken last, even after ptable's
+  struct spinlock iolock;    // busy
+  uint dev;
+  uint start;                // first block of the area
+  int nslot;                 // 0: no swap
+  int nfree;
+  int hint;                  // search for a free slot from here
+  ushort ref[NSWAP];         // page table entries naming each slot
+  int busy;                  // buf in use
+  struct buf buf[SPP];
+} swap;
+
+// Use the n blocks of dev from block start on as swap space.
+void
+swapinit(uint dev, uint start, uint n)
+{
+  initlock(&swap.lock, "swap");
+  initlock(&swap.iolock, "swapio");
+  swap.dev = dev;
+  swap.start = start;
+  swap.nslot = n / SPP;
+  if(swap.nslot > NSWAP)
+    swap.nslot = NSWAP;
+  swap.nfree = swap.nslot;
+  cprintf("swap: %d pages\n", swap.nslot);
+}
+
+// May the caller page out memory to make room?  Only with swap
+// space, and only a process holding no spin locks, which may
+// sleep waiting for the disk.  (Page faults come in with
+// interrupts off, but sleep all the same.)
+int
+swapready(void)
+{
+  int ok;
+
+  if(swap.nfree == 0 || proc == 0)
+    return 0;
+  pushcli();
+  ok = cpu->ncli == 1;
+  popcli();
+  return ok;
+}
+
+// Allocate a slot with one reference.  Returns -1 if swap is full.
+int
+swapalloc(void)
+{
+  int i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    s = (swap.hint + i) % swap.nslot;
+    if(swap.ref[s] == 0){
+      swap.ref[s] = 1;
+      swap.nfree--;
+      swap.hint = s + 1;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Add a reference to slot s, for a copied page table.
+void
+swapdup(uint s)
+{
+  acquire(&swap.lock);
+  if(s >= swap.nslot || swap.ref[s] == 0)
+    panic("swapdup");
+  swap.ref[s]++;
+  release(&swap.lock);
+}
+
+// Drop a reference to slot s, freeing it if that was the last.
+void
+swapfree(uint s)
+{
+  acquire(&swap.lock);
+  if(s >= swap.nslot || swap.ref[s] == 0)
+    panic("swapfree");
+  if(--swap.ref[s] == 0){
+    swap.nfree++;
+    if(s < swap.hint)
+      swap.hint = s;
+  }
+  release(&swap.lock);
+}
+
+// Write page mem to slot s, or read it from there.
+void
+swapio(uint s, char *mem, int write)
+{
+  struct buf *b;
+  int i;
+
+  acquire(&swap.iolock);
+  while(swap.busy)
+    sleep(&swap.busy, &swap.iolock);
+  swap.busy = 1;
+  release(&swap.iolock);
+
+  for(i = 0; i < SPP; i++){
+    b = &swap.buf[i];
+    b->flags = B_BUSY | (write ? B_DIRTY : 0);
+    b->dev = swap.dev;
+    b->sector = swap.start + s*SPP + i;
+    b->data = (uchar*)mem + i*BSIZE;
+  }
+  iderwv(swap.buf, SPP);
+  kstatinc(write ? KS_SWAPOUT : KS_SWAPIN);
+
+  acquire(&swap.iolock);
+  swap.busy = 0;
+  wakeup(&swap.busy);
+  release(&swap.iolock);
+}
+
+// Report on swap space for /stats/swap.
+void
+swapstats(struct report *r)
+{
+  report(r, "pages", swap.nslot);
+  report(r, "free", swap.nfree);
+  report(r, "pageouts", kstatsum(KS_SWAPOUT));
+  report(r, "pageins", kstatsum(KS_SWAPIN));
+  report(r, "scanned", kstatsum(KS_SWAPSCAN));
+}
@@ -6,8 +6,11 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "fs.h"
+#include "file.h"
 
-// User code makes a system call with INT T_SYSCALL.
+// User code makes a system call with INT T_SYSCALL, or with
+// sysenter, which sysentry turns into the same trap frame.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
@@ -17,7 +20,7 @@
 int
 fetchint(struct proc *p, uint addr, int *ip)
 {
-  if(addr >= p->sz || addr+4 > p->sz)
+  if(addr >= p->sz || addr+4 > p->sz || checkptr(addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -25,7 +28,8 @@ fetchint(struct proc *p, uint addr, int *ip)
 
 // Fetch the nul-terminated string at addr from process p.
 // Doesn't actually copy the string - just sets *pp to point at it.
-// Returns length of string, not including nul.
+// Returns length of string, not including nul.  Each page is made
+// present before it is read, as checkptr does.
 int
 fetchstr(struct proc *p, uint addr, char **pp)
 {
@@ -35,9 +39,12 @@ fetchstr(struct proc *p, uint addr, char **pp)
     return -1;
   *pp = (char*)addr;
   ep = (char*)p->sz;
-  for(s = *pp; s < ep; s++)
+  for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && checkptr((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
+  }
   return -1;
 }
 
@@ -45,36 +52,65 @@ fetchstr(struct proc *p, uint addr, char **pp)
 int
 argint(int n, int *ip)
 {
-  return fetchint(proc, proc->tf->esp + 4 + 4*n, ip);
+  return fetchint(proc->group, proc->tf->esp + 4 + 4*n, ip);
+}
+
+// Check that the size bytes at addr lie within the process
+// address space, and that the kernel may write them if write.
+int
+checkptr(uint addr, int size, int write)
+{
+  int r;
+
+  // Heap and memory-mapped file pages must be present before
+  // the kernel touches them, and copy-on-write pages copied before
+  // it writes them, since it may be holding locks, and a fault in
+  // the kernel that cannot be satisfied is a panic.
+  lockgroup();
+  if(addr >= proc->group->sz || addr+size > proc->group->sz)
+    r = mmaptouch(addr, size, write);
+  else
+    r = lazytouch(addr, size, write);
+  unlockgroup();
+  return r;
 }
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size n bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space, and can be written if
+// the kernel will write there.
 int
-argptr(int n, char **pp, int size)
+argptr(int n, char **pp, int size, int write)
 {
   int i;
   
-  if(argint(n, &i) < 0)
-    return -1;
-  if((uint)i >= proc->sz || (uint)i+size > proc->sz)
+  if(argint(n, &i) < 0 || checkptr(i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
 // Fetch the nth word-sized system call argument as a string pointer.
-// Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// Check that the pointer is valid and the string is nul-terminated,
+// and point *pp at a copy in the calling thread's proc.  Another
+// thread of the process could rewrite the string in user memory
+// while the kernel is still using it.  Returns the length, or -1
+// if the string is longer than MAXSTRARG-1.
 int
 argstr(int n, char **pp)
 {
-  int addr;
-  if(argint(n, &addr) < 0)
+  int addr, len;
+  char *s;
+
+  if(n >= NELEM(proc->argstr))
+    panic("argstr");
+  if(argint(n, &addr) < 0 || (len = fetchstr(proc->group, addr, &s)) < 0 ||
+     len >= MAXSTRARG)
     return -1;
-  return fetchstr(proc, addr, pp);
+  memmove(proc->argstr[n], s, len);
+  proc->argstr[n][len] = 0;
+  *pp = proc->argstr[n];
+  return len;
 }
 
 extern int sys_chdir(void);
@@ -103,6 +139,36 @@ extern int sys_readlink(void);
 extern int sys_fprot(void);
 extern int sys_funprot(void);
 extern int sys_funlock(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_sendfile(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_lseek(void);
+extern int sys_spawn(void);
+extern int sys_setpriority(void);
+extern int sys_kthread_create(void);
+extern int sys_kthread_id(void);
+extern int sys_kthread_exit(void);
+extern int sys_kthread_join(void);
+extern int sys_futex(void);
+extern int sys_signal(void);
+extern int sys_alarm(void);
+extern int sys_usleep(void);
+extern int sys_ioring_setup(void);
+extern int sys_ioring_enter(void);
+extern int sys_getrusage(void);
+extern int sys_mount(void);
+extern int sys_getdents(void);
+extern int sys_yield(void);
+extern int sys_ncpu(void);
+extern int sys_fallocate(void);
+extern int sys_ftruncate(void);
+extern int sys_fsync(void);
+extern int sys_fdatasync(void);
+extern int sys_poll(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -131,21 +197,218 @@ static int (*syscalls[])(void) = {
 [SYS_fprot]   sys_fprot,
 [SYS_funprot] sys_funprot,
 [SYS_funlock] sys_funlock,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_sendfile] sys_sendfile,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_lseek]   sys_lseek,
+[SYS_spawn]   sys_spawn,
+[SYS_setpriority] sys_setpriority,
+[SYS_kthread_create] sys_kthread_create,
+[SYS_kthread_id] sys_kthread_id,
+[SYS_kthread_exit] sys_kthread_exit,
+[SYS_kthread_join] sys_kthread_join,
+[SYS_futex]   sys_futex,
+[SYS_signal]  sys_signal,
+[SYS_alarm]   sys_alarm,
+[SYS_usleep]  sys_usleep,
+[SYS_ioring_setup] sys_ioring_setup,
+[SYS_ioring_enter] sys_ioring_enter,
+[SYS_getrusage] sys_getrusage,
+[SYS_mount]   sys_mount,
+[SYS_getdents] sys_getdents,
+[SYS_yield]   sys_yield,
+[SYS_ncpu]    sys_ncpu,
+[SYS_fallocate] sys_fallocate,
+[SYS_ftruncate] sys_ftruncate,
+[SYS_fsync]   sys_fsync,
+[SYS_fdatasync] sys_fdatasync,
+[SYS_poll]    sys_poll,
+};
+
+static char *sysnames[] = {
+[SYS_fork]    "fork",
+[SYS_exit]    "exit",
+[SYS_wait]    "wait",
+[SYS_pipe]    "pipe",
+[SYS_read]    "read",
+[SYS_kill]    "kill",
+[SYS_exec]    "exec",
+[SYS_fstat]   "fstat",
+[SYS_chdir]   "chdir",
+[SYS_dup]     "dup",
+[SYS_getpid]  "getpid",
+[SYS_sbrk]    "sbrk",
+[SYS_sleep]   "sleep",
+[SYS_uptime]  "uptime",
+[SYS_open]    "open",
+[SYS_write]   "write",
+[SYS_mknod]   "mknod",
+[SYS_unlink]  "unlink",
+[SYS_link]    "link",
+[SYS_mkdir]   "mkdir",
+[SYS_close]   "close",
+[SYS_symlink] "symlink",
+[SYS_readlink] "readlink",
+[SYS_fprot]   "fprot",
+[SYS_funprot] "funprot",
+[SYS_funlock] "funlock",
+[SYS_mmap]    "mmap",
+[SYS_munmap]  "munmap",
+[SYS_sendfile] "sendfile",
+[SYS_readv]   "readv",
+[SYS_writev]  "writev",
+[SYS_pread]   "pread",
+[SYS_pwrite]  "pwrite",
+[SYS_lseek]   "lseek",
+[SYS_spawn]   "spawn",
+[SYS_setpriority] "setpriority",
+[SYS_kthread_create] "kthread_create",
+[SYS_kthread_id] "kthread_id",
+[SYS_kthread_exit] "kthread_exit",
+[SYS_kthread_join] "kthread_join",
+[SYS_futex]   "futex",
+[SYS_signal]  "signal",
+[SYS_alarm]   "alarm",
+[SYS_usleep]  "usleep",
+[SYS_ioring_setup] "ioring_setup",
+[SYS_ioring_enter] "ioring_enter",
+[SYS_getrusage] "getrusage",
+[SYS_mount]   "mount",
+[SYS_getdents] "getdents",
+[SYS_yield]   "yield",
+[SYS_ncpu]    "ncpu",
+[SYS_fallocate] "fallocate",
+[SYS_ftruncate] "ftruncate",
+[SYS_fsync]   "fsync",
+[SYS_fdatasync] "fdatasync",
+[SYS_poll]    "poll",
 };
 
+// Counts and latencies of the system calls made on each CPU, kept
+// apart so that CPUs do not fight over them.  Each process keeps
+// its own totals in p->sstat.  /dev/sysstat reports the sums, by
+// system call; /dev/procstat reports the processes' (procstatread).
+static struct {
+  struct sysstat s[NELEM(syscalls)];
+} __attribute__((aligned(CACHELINE))) sysstats[NCPU];
+
+// Count system call num, which returned r after t cycles, for
+// the current CPU and process.
+static void
+sysaccount(int num, int r, uint t)
+{
+  struct sysstat *s;
+  int b;
+
+  b = t ? (int)bsr(t) - SYSHISTMIN : 0;
+  if(b < 0)
+    b = 0;
+  if(b >= NSYSHIST)
+    b = NSYSHIST-1;
+
+  s = &proc->sstat;
+  s->ncall++;
+  if(r < 0)
+    s->nerr++;
+  s->hist[b]++;
+
+  // Interrupts off, so the process stays on this CPU meanwhile.
+  pushcli();
+  s = &sysstats[cpu - cpus].s[num];
+  s->ncall++;
+  if(r < 0)
+    s->nerr++;
+  s->hist[b]++;
+  popcli();
+}
+
 void
 syscall(void)
 {
-  int num;
+  int num, r;
+  uint t0;
 
   num = proc->tf->eax;
-  if(num >= 0 && num < SYS_open && syscalls[num]) {
-    proc->tf->eax = syscalls[num]();
-  } else if (num >= SYS_open && num < NELEM(syscalls) && syscalls[num]) {
-    proc->tf->eax = syscalls[num]();
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    t0 = rdtsc();
+    r = syscalls[num]();
+    proc->tf->eax = r;
+    sysaccount(num, r, rdtsc() - t0);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             proc->pid, proc->name, num);
     proc->tf->eax = -1;
   }
 }
+
+// Format counts s into buf, after the len bytes already there, as
+// calls, errors and the nonzero histogram buckets, each as the log2
+// of its cycles and its count.  End the line.
+void
+fmtsysstat(struct sysstat *s, char *buf, int len, int n)
+{
+  int b;
+
+  len += snprintf(buf+len, n-len, " %10u %8u", s->ncall, s->nerr);
+  for(b = 0; b < NSYSHIST; b++)
+    if(s->hist[b])
+      len += snprintf(buf+len, n-len, " %d:%u", b + SYSHISTMIN, s->hist[b]);
+  snprintf(buf+len, n-len, "\n");
+}
+
+// Read /dev/sysstat (minor 0), the system calls made on all CPUs
+// since boot or the last write, or /dev/procstat (minor 1).
+int
+sysstatread(struct inode *ip, char *dst, uint off, int n)
+{
+  char line[200];
+  struct sysstat sum;
+  uint pos;
+  int num, c, b;
+
+  if(ip->minor == 1)
+    return procstatread(dst, off, n);
+  pos = 0;
+  snprintf(line, sizeof(line), "%-14s %10s %8s %s\n", "syscall",
+           "calls", "errors", "log2(cycles):calls");
+  emitline(line, &pos, dst, off, n);
+  for(num = 1; num < NELEM(syscalls) && pos < off + n; num++){
+    if(syscalls[num] == 0)
+      continue;
+    memset(&sum, 0, sizeof(sum));
+    for(c = 0; c < ncpu; c++){
+      sum.ncall += sysstats[c].s[num].ncall;
+      sum.nerr += sysstats[c].s[num].nerr;
+      for(b = 0; b < NSYSHIST; b++)
+        sum.hist[b] += sysstats[c].s[num].hist[b];
+    }
+    fmtsysstat(&sum, line, snprintf(line, sizeof(line), "%-14s", sysnames[num]),
+               sizeof(line));
+    emitline(line, &pos, dst, off, n);
+  }
+  if(pos <= off)
+    return 0;
+  return (pos < off + n ? pos : off + n) - off;
+}
+
+// Writing anything resets the counts that the file reports.
+int
+sysstatwrite(struct inode *ip, char *src, uint off, int n)
+{
+  if(ip->minor == 1)
+    procstatclear();
+  else
+    memset(sysstats, 0, sizeof(sysstats));
+  return n;
+}
+
+void
+sysstatinit(void)
+{
+  devsw[SYSSTAT].read = sysstatread;
+  devsw[SYSSTAT].write = sysstatwrite;
+}
@@ -26,3 +26,33 @@
 #define SYS_fprot  24
 #define SYS_funprot 25
 #define SYS_funlock 26
+#define SYS_mmap   27
+#define SYS_munmap 28
+#define SYS_sendfile 29
+#define SYS_readv  30
+#define SYS_writev 31
+#define SYS_pread  32
+#define SYS_pwrite 33
+#define SYS_lseek  34
+#define SYS_spawn  35
+#define SYS_setpriority 36
+#define SYS_kthread_create 37
+#define SYS_kthread_id 38
+#define SYS_kthread_exit 39
+#define SYS_kthread_join 40
+#define SYS_futex  41
+#define SYS_signal 42
+#define SYS_alarm  43
+#define SYS_usleep 44
+#define SYS_ioring_setup 45
+#define SYS_ioring_enter 46
+#define SYS_getrusage 47
+#define SYS_mount  48
+#define SYS_getdents 49
+#define SYS_yield  50
+#define SYS_ncpu   51
+#define SYS_fallocate 52
+#define SYS_ftruncate 53
+#define SYS_fsync  54
+#define SYS_fdatasync 55
+#define SYS_poll   56
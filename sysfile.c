@@ -12,7 +12,23 @@
 #include "proc.h"
 #include "fs.h"
 #include "file.h"
+#include "dent.h"
 #include "fcntl.h"
+#include "poll.h"
+#include "uio.h"
+
+// The open file of the current process for descriptor fd, or 0.
+// Caller holds lockgroup, since another thread may move the table.
+static struct file*
+fdget(int fd)
+{
+  struct proc *g;
+
+  g = proc->group;
+  if(fd < 0 || fd >= g->nofile)
+    return 0;
+  return g->ofile[fd];
+}
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -24,7 +40,10 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+  lockgroup();
+  f = fdget(fd);
+  unlockgroup();
+  if(f == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -38,15 +57,22 @@ argfd(int n, int *pfd, struct file **pf)
 static int
 fdalloc(struct file *f)
 {
+  struct proc *g;
   int fd;
 
-  for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd] == 0){
-      proc->ofile[fd] = f;
-      return fd;
-    }
+  g = proc->group;
+  lockgroup();
+  for(fd = g->fdlow; fd < g->nofile; fd++)
+    if(g->ofile[fd] == 0)
+      break;
+  if(fd == g->nofile && fdgrow(g, fd + 1) < 0){
+    unlockgroup();
+    return -1;
   }
-  return -1;
+  g->ofile[fd] = f;
+  g->fdlow = fd + 1;
+  unlockgroup();
+  return fd;
 }
 
 int
@@ -70,11 +96,216 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n, 1) < 0)
     return -1;
   return fileread(f, p, n);
 }
 
+// Fetch the iovec array in argument n, with the count in argument
+// n+1, into iov, and check each buffer it describes, for the
+// kernel to write if write.
+static int
+argiov(int n, struct iovec *iov, int *cnt, int write)
+{
+  char *p;
+  int i, c;
+
+  if(argint(n+1, &c) < 0 || c < 0 || c > UIO_MAXIOV)
+    return -1;
+  if(argptr(n, &p, c*sizeof(struct iovec), 0) < 0)
+    return -1;
+  memmove(iov, p, c*sizeof(struct iovec));
+  for(i = 0; i < c; i++)
+    if(iov[i].iov_len < 0 || checkptr((uint)iov[i].iov_base, iov[i].iov_len, write) < 0)
+      return -1;
+  *cnt = c;
+  return 0;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[UIO_MAXIOV];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argiov(1, iov, &cnt, 1) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[UIO_MAXIOV];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argiov(1, iov, &cnt, 0) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n, 1) < 0 || argint(3, &off) < 0)
+    return -1;
+  if(off < 0)
+    return -1;
+  return filereadat(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n, 0) < 0 || argint(3, &off) < 0)
+    return -1;
+  if(off < 0)
+    return -1;
+  return filewriteat(f, p, n, off);
+}
+
+int
+sys_lseek(void)
+{
+  struct file *f;
+  int off, whence;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &whence) < 0)
+    return -1;
+  return fileseek(f, off, whence);
+}
+
+// Reserve disk blocks for bytes [off, off+len) of a file.
+int
+sys_fallocate(void)
+{
+  struct file *f;
+  int off, len;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0)
+    return -1;
+  if(off < 0 || len <= 0)
+    return -1;
+  return filefalloc(f, off, len);
+}
+
+int
+sys_ftruncate(void)
+{
+  struct file *f;
+  int len;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &len) < 0 || len < 0)
+    return -1;
+  return filetrunc(f, len);
+}
+
+// Wait until a file's writes are on disk.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  return filesync(f, 0);
+}
+
+// Like fsync, but the inode only as far as reading the data needs.
+int
+sys_fdatasync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  return filesync(f, 1);
+}
+
+// Wait until one of nfds descriptors is ready, or timeout
+// milliseconds pass if timeout >= 0.  The files are held for the
+// duration, in a page.
+int
+sys_poll(void)
+{
+  struct file **f;
+  struct pollfd *fds;
+  int i, n, ms, r;
+
+  if(argint(1, &n) < 0 || n < 0 || n > PGSIZE/sizeof(*f) || argint(2, &ms) < 0 ||
+     argptr(0, (char**)&fds, n*sizeof(*fds), 1) < 0)
+    return -1;
+  if((f = (struct file**)kalloc()) == 0)
+    return -1;
+  for(i = 0; i < n; i++)
+    f[i] = fds[i].fd >= 0 ? fdfile(fds[i].fd) : 0;
+  r = filepollv(f, fds, n, ms);
+  for(i = 0; i < n; i++)
+    if(f[i])
+      fileclose(f[i]);
+  kfree((char*)f);
+  return r;
+}
+
+int
+sys_sendfile(void)
+{
+  struct file *out, *in;
+  int n;
+
+  if(argfd(0, 0, &out) < 0 || argfd(1, 0, &in) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filesend(out, in, n);
+}
+
+int
+sys_ioring_setup(void)
+{
+  int va;
+
+  if(argint(0, &va) < 0)
+    return -1;
+  return ioringsetup(va);
+}
+
+int
+sys_ioring_enter(void)
+{
+  int n, wait;
+
+  if(argint(0, &n) < 0 || argint(1, &wait) < 0)
+    return -1;
+  return ioringenter(n, wait);
+}
+
+int
+sys_mmap(void)
+{
+  struct file *f;
+  int n, prot, flags, off, r;
+
+  // The address hint (argument 0) is ignored.
+  if(argint(1, &n) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+     argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(n <= 0 || off < 0)
+    return -1;
+  lockgroup();
+  r = mmap(f, off, n, prot, flags);
+  unlockgroup();
+  return r;
+}
+
 int
 sys_write(void)
 {
@@ -82,20 +313,50 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n, 0) < 0)
     return -1;
   return filewrite(f, p, n);
 }
 
+// Return the open file for descriptor fd of the current process
+// with a reference of the caller's own, or 0.
+struct file*
+fdfile(int fd)
+{
+  struct file *f;
+
+  lockgroup();
+  if((f = fdget(fd)) != 0)
+    filedup(f);
+  unlockgroup();
+  return f;
+}
+
 int
 sys_close(void)
 {
   int fd;
+
+  if(argint(0, &fd) < 0)
+    return -1;
+  return closefd(fd);
+}
+
+// Close descriptor fd of the current process.
+int
+closefd(int fd)
+{
   struct file *f;
-  
-  if(argfd(0, &fd, &f) < 0)
+
+  lockgroup();
+  if((f = fdget(fd)) == 0){
+    unlockgroup();
     return -1;
-  proc->ofile[fd] = 0;
+  }
+  proc->group->ofile[fd] = 0;
+  if(fd < proc->group->fdlow)
+    proc->group->fdlow = fd;
+  unlockgroup();
   fileclose(f);
   return 0;
 }
@@ -106,11 +367,24 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
   
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st), 1) < 0)
     return -1;
   return filestat(f, st);
 }
 
+int
+sys_getdents(void)
+{
+  struct file *f;
+  struct dent *d;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || n < 0 ||
+     argptr(1, (void*)&d, n*sizeof(*d), 1) < 0)
+    return -1;
+  return filegetdents(f, d, n);
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -120,10 +394,10 @@ sys_link(void)
 
   if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
     return -1;
-  if((ip = namei(old)) == 0)
+  if((ip = nameilink(old)) == 0)
     return -1;
 
-  begin_trans();
+  begin_trans(MAXOPBLOCKS);
 
   ilock(ip);
   if(ip->type == T_DIR){
@@ -189,7 +463,7 @@ sys_unlink(void)
   if((dp = nameiparent(path, name)) == 0)
     return -1;
 
-  begin_trans();
+  begin_trans(MAXOPBLOCKS);
 
   ilock(dp);
 
@@ -203,7 +477,7 @@ sys_unlink(void)
 
   if(ip->nlink < 1)
     panic("unlink: nlink < 1");
-  if(ip->type == T_DIR && !isdirempty(ip)){
+  if(ip->type == T_DIR && (!isdirempty(ip) || ismount(ip))){
     iunlockput(ip);
     goto bad;
   }
@@ -211,6 +485,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcset(dp, name, 0, 0);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -251,7 +526,9 @@ create(char *path, short type, short major, short minor)
       return 0;
     }
 /*^^^^^^^^^^^^^^^^^^*/
-    if(type == T_FILE && ip->type == T_FILE)
+    // Creating a file that exists opens it, and so does creating
+    // one over a device, so that "echo > dev/lockstat" works.
+    if(type == T_FILE && (ip->type == T_FILE || ip->type == T_DEV))
       return ip;
     iunlockput(ip);
     return 0;
@@ -269,6 +546,9 @@ create(char *path, short type, short major, short minor)
   if(type == T_DIR){  // Create . and .. entries.
     dp->nlink++;  // for ".."
     iupdate(dp);
+    // Subdirectories of indexed directories are indexed too.
+    if(dp->nhash)
+      dirindex(ip, dp->nhash < NDIRHASH ? dp->nhash : NDIRHASH);
     // No ip->nlink++ for ".": avoid cyclic ref count.
     if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
       panic("create dots");
@@ -286,41 +566,36 @@ int
 sys_open(void)
 {
   char *path;
-  int fd, omode;
-  struct file *f;
-  struct inode *ip;
-
-  char final_path[MAXPATH];
+  int omode;
 
   if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
     return -1;
+  return openfd(path, omode);
+}
+
+// Open path with mode omode in the current process and return the
+// new descriptor, or -1.
+int
+openfd(char *path, int omode)
+{
+  int fd;
+  struct file *f;
+  struct inode *ip;
 
   if(omode & O_CREATE){
-/*vvv  TASK 1.2  vvv*/
-    if(filereadlinki(path, final_path, MAXPATH) < 0){
-      return -1;
-    }
-/*^^^^^^^^^^^^^^^^^^*/
-    begin_trans();
-/*vvv  TASK 1.2  vvv*/
-    ip = create(final_path, T_FILE, 0, 0);
-/*^^^^^^^^^^^^^^^^^^*/
+    begin_trans(MAXOPBLOCKS);
+    ip = create(path, T_FILE, 0, 0);
     commit_trans();
     if(ip == 0)
       return -1;
   } else {
 /*vvv  TASK 1.2  vvv*/
-    if (omode & O_IGNLINK) {
-      if(filereadlinki(path, final_path, MAXPATH) < 0){
-        return -1;
-      }
-    } else {
-      if(filereadlink(path, final_path, MAXPATH) < 0){
-        return -1;
-      }
-    }
+    if(omode & O_IGNLINK)
+      ip = nameilink(path);
+    else
+      ip = namei(path);
 /*^^^^^^^^^^^^^^^^^^*/
-    if((ip = namei(final_path)) == 0)
+    if(ip == 0)
       return -1;
     ilock(ip);
 /*vvv  TASK 2    vvv*/
@@ -343,11 +618,16 @@ sys_open(void)
     iunlockput(ip);
     return -1;
   }
+  ip->nopen++;
   iunlock(ip);
 
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
+  f->ranext = 0;
+  f->raend = 0;
+  f->rawin = 0;
+  f->flags = omode & (O_SYNC | O_DIRECT);
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
   return fd;
@@ -359,7 +639,7 @@ sys_mkdir(void)
   char *path;
   struct inode *ip;
 
-  begin_trans();
+  begin_trans(MAXOPBLOCKS + NDIRHASH);  // + empty buckets
   if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
     commit_trans();
     return -1;
@@ -377,7 +657,7 @@ sys_mknod(void)
   int len;
   int major, minor;
   
-  begin_trans();
+  begin_trans(MAXOPBLOCKS);
   if((len=argstr(0, &path)) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
@@ -396,56 +676,110 @@ sys_chdir(void)
   char *path;
   struct inode *ip;
 
-  char final_path[MAXPATH];
-
   if(argstr(0, &path) < 0)
     return -1;
-
-/*vvv  TASK 1.2  vvv*/
-  if(filereadlink(path, final_path, MAXPATH) < 0){
+  if((ip = namei(path)) == 0)
     return -1;
-  }
 
-  if((ip = namei(final_path)) == 0){
+  ilock(ip);
+  if(ip->type != T_DIR){
+    iunlockput(ip);
     return -1;
   }
-/*^^^^^^^^^^^^^^^^^^*/
+  iunlock(ip);
+  iput(proc->group->cwd);
+  proc->group->cwd = ip;
+  return 0;
+}
 
+// Mount a new, empty tmpfs on the directory at path.
+int
+sys_mount(void)
+{
+  char *path;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0)
+    return -1;
   ilock(ip);
-  if(ip->type != T_DIR){
+  if(ip->type != T_DIR || (ip->dev == ROOTDEV && ip->inum == ROOTINO) ||
+     tmpmount(ip) < 0){
     iunlockput(ip);
     return -1;
   }
   iunlock(ip);
-  iput(proc->cwd);
-  proc->cwd = ip;
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the nth word-sized system call argument as a user argv
+// array of at most MAXARG strings, copy the strings into the
+// page buf, and point argv at the copies.
+static int
+argargv(int n, char **argv, char *buf)
 {
-  char *path, *argv[MAXARG];
-  int i;
+  int i, len, off;
   uint uargv, uarg;
+  char *s;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argint(n, (int*)&uargv) < 0)
     return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
+  off = 0;
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
-    if(fetchint(proc, uargv+4*i, (int*)&uarg) < 0)
+    if(fetchint(proc->group, uargv+4*i, (int*)&uarg) < 0)
       return -1;
     if(uarg == 0){
       argv[i] = 0;
       break;
     }
-    if(fetchstr(proc, uarg, &argv[i]) < 0)
+    if((len = fetchstr(proc->group, uarg, &s)) < 0 || off + len + 1 > PGSIZE)
       return -1;
+    argv[i] = buf + off;
+    memmove(argv[i], s, len);
+    argv[i][len] = 0;
+    off += len + 1;
   }
-  return exec(path, argv);
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG], *buf;
+  int r;
+
+  if(argstr(0, &path) < 0 || (buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(argargv(1, argv, buf) == 0)
+    r = exec(path, argv);
+  kfree(buf);
+  return r;
+}
+
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG], *buf;
+  int *fds, nfds, r;
+
+  if(argstr(0, &path) < 0 || argint(3, &nfds) < 0)
+    return -1;
+  if(nfds < 0 || nfds > NOFILEMAX)
+    return -1;
+  if(argint(2, (int*)&fds) < 0)
+    return -1;
+  if(fds && argptr(2, (void*)&fds, nfds*sizeof(fds[0]), 0) < 0)
+    return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(argargv(1, argv, buf) == 0)
+    r = spawn(path, argv, fds, nfds);
+  kfree(buf);
+  return r;
 }
 
 int
@@ -455,14 +789,16 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0]), 1) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
-    if(fd0 >= 0)
-      proc->ofile[fd0] = 0;
+    if(fd0 >= 0){
+      proc->group->ofile[fd0] = 0;
+      proc->group->fdlow = fd0;
+    }
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -496,7 +832,8 @@ sys_readlink(void)
   char *buf;
   int bufsiz;
 
-  if(argstr(0, &pathname) < 0 || argstr(1, &buf) < 0 || argint(2, &bufsiz) < 0){
+  if(argstr(0, &pathname) < 0 || argint(2, &bufsiz) < 0 || bufsiz < 0 ||
+     argptr(1, &buf, bufsiz, 1) < 0){
     return -1;
   }
 
@@ -509,19 +846,13 @@ filesymlink(const char *oldpath, const char *newpath)
   struct inode *ip;
   int len;
 
-  char final_path[MAXPATH];
-
   // Verify that the target is not an empty filename:
   if(oldpath[0] == '\0'){
     return -1;
   }
 
-  if(filereadlinki(newpath, final_path, MAXPATH) < 0){
-    return -1;
-  }
-
-  begin_trans();
-  ip = create(final_path, T_SYMLINK, 0, 0);
+  begin_trans(MAXOPBLOCKS);
+  ip = create((char*)newpath, T_SYMLINK, 0, 0);
   if(ip == 0) {
     commit_trans();
     return -1;
@@ -530,7 +861,7 @@ filesymlink(const char *oldpath, const char *newpath)
   if(writei(ip, (char*)oldpath, 0, len) != len){
     panic("filesymlink: writei");
   }
-  iunlock(ip);
+  iunlockput(ip);
   commit_trans();
 
   return 0;
@@ -5,6 +5,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "signal.h"
+#include "rusage.h"
 
 int
 sys_fork(void)
@@ -41,6 +43,102 @@ sys_getpid(void)
   return proc->pid;
 }
 
+// Give up the CPU to anything else that can run.
+int
+sys_yield(void)
+{
+  yield();
+  return 0;
+}
+
+// Return how many CPUs are running.
+int
+sys_ncpu(void)
+{
+  return ncpu;
+}
+
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
+int
+sys_kthread_create(void)
+{
+  int start, stack, size;
+
+  if(argint(0, &start) < 0 || argint(1, &stack) < 0 || argint(2, &size) < 0)
+    return -1;
+  return kthreadcreate(start, stack, size);
+}
+
+int
+sys_kthread_id(void)
+{
+  return proc->pid;
+}
+
+int
+sys_kthread_exit(void)
+{
+  kthreadexit();
+  return 0;  // not reached
+}
+
+int
+sys_kthread_join(void)
+{
+  int tid;
+
+  if(argint(0, &tid) < 0)
+    return -1;
+  return kthreadjoin(tid);
+}
+
+int
+sys_signal(void)
+{
+  int signum, handler;
+
+  if(argint(0, &signum) < 0 || argint(1, &handler) < 0)
+    return -1;
+  if(signum != SIGALRM)
+    return -1;
+  proc->group->sighandler = handler;
+  return 0;
+}
+
+// Raise SIGALRM in the calling thread every n clock ticks it runs
+// for, or stop if n is 0.
+int
+sys_alarm(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0 || n < 0)
+    return -1;
+  proc->alarm = n;
+  proc->alarmticks = 0;
+  proc->alarmdue = 0;
+  return 0;
+}
+
+int
+sys_futex(void)
+{
+  int addr, op, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  return futex(addr, op, val);
+}
+
 int
 sys_sbrk(void)
 {
@@ -49,30 +147,67 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = proc->sz;
+  lockgroup();
+  addr = proc->group->sz;
   if(growproc(n) < 0)
-    return -1;
+    addr = -1;
+  unlockgroup();
   return addr;
 }
 
+int
+sys_munmap(void)
+{
+  int addr, n, r;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  lockgroup();
+  r = munmap(addr, n);
+  unlockgroup();
+  return r;
+}
+
 int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
-  
-  if(argint(0, &n) < 0)
+
+  if(argint(0, &n) < 0 || n < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(proc->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
+  return tsleep(n);
+}
+
+// Sleep for n microseconds, rounded up to whole clock ticks.
+int
+sys_usleep(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0 || n < 0)
+    return -1;
+  return tsleep((n + TICKUS-1) / TICKUS);
+}
+
+int
+sys_getrusage(void)
+{
+  int who;
+  struct rusage *ru;
+  struct usage u;
+
+  if(argint(0, &who) < 0 || argptr(1, (char**)&ru, sizeof(*ru), 1) < 0)
+    return -1;
+  if(who != RUSAGE_SELF && who != RUSAGE_CHILDREN)
+    return -1;
+  getusage(who == RUSAGE_CHILDREN, &u);
+  ru->utime = u.utime;
+  ru->stime = u.stime;
+  ru->nvcsw = u.nvcsw;
+  ru->nivcsw = u.nivcsw;
+  ru->nfault = u.nfault;
+  ru->nblkin = u.nblkin;
+  ru->nblkout = u.nblkout;
   return 0;
 }
 
@@ -0,0 +1,1882 @@
+
+_sysstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+// Print system call statistics: by system call, or with -p by
+// thread.  With -z, reset them instead.
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  15:	89 cb                	mov    %ecx,%ebx
+  char buf[512], *path;
+  int i, fd, n, zero;
+
+  path = "/dev/sysstat";
+  17:	c7 45 f4 15 0f 00 00 	movl   $0xf15,-0xc(%ebp)
+  zero = 0;
+  1e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 1; i < argc; i++){
+  25:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  2c:	eb 79                	jmp    a7 <main+0xa7>
+    if(strcmp(argv[i], "-p") == 0)
+  2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  31:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  38:	8b 43 04             	mov    0x4(%ebx),%eax
+  3b:	01 d0                	add    %edx,%eax
+  3d:	8b 00                	mov    (%eax),%eax
+  3f:	83 ec 08             	sub    $0x8,%esp
+  42:	68 22 0f 00 00       	push   $0xf22
+  47:	50                   	push   %eax
+  48:	e8 5d 01 00 00       	call   1aa <strcmp>
+  4d:	83 c4 10             	add    $0x10,%esp
+  50:	85 c0                	test   %eax,%eax
+  52:	75 09                	jne    5d <main+0x5d>
+      path = "/dev/procstat";
+  54:	c7 45 f4 25 0f 00 00 	movl   $0xf25,-0xc(%ebp)
+  5b:	eb 46                	jmp    a3 <main+0xa3>
+    else if(strcmp(argv[i], "-z") == 0)
+  5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  60:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  67:	8b 43 04             	mov    0x4(%ebx),%eax
+  6a:	01 d0                	add    %edx,%eax
+  6c:	8b 00                	mov    (%eax),%eax
+  6e:	83 ec 08             	sub    $0x8,%esp
+  71:	68 33 0f 00 00       	push   $0xf33
+  76:	50                   	push   %eax
+  77:	e8 2e 01 00 00       	call   1aa <strcmp>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	85 c0                	test   %eax,%eax
+  81:	75 09                	jne    8c <main+0x8c>
+      zero = 1;
+  83:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  8a:	eb 17                	jmp    a3 <main+0xa3>
+    else {
+      printf(2, "usage: sysstat [-p] [-z]\n");
+  8c:	83 ec 08             	sub    $0x8,%esp
+  8f:	68 36 0f 00 00       	push   $0xf36
+  94:	6a 02                	push   $0x2
+  96:	e8 e0 07 00 00       	call   87b <printf>
+  9b:	83 c4 10             	add    $0x10,%esp
+      exit();
+  9e:	e8 48 03 00 00       	call   3eb <exit>
+  for(i = 1; i < argc; i++){
+  a3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  aa:	3b 03                	cmp    (%ebx),%eax
+  ac:	7c 80                	jl     2e <main+0x2e>
+    }
+  }
+  if((fd = open(path, zero ? O_WRONLY : O_RDONLY)) < 0){
+  ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  b2:	0f 95 c0             	setne  %al
+  b5:	0f b6 c0             	movzbl %al,%eax
+  b8:	83 ec 08             	sub    $0x8,%esp
+  bb:	50                   	push   %eax
+  bc:	ff 75 f4             	push   -0xc(%ebp)
+  bf:	e8 5f 03 00 00       	call   423 <open>
+  c4:	83 c4 10             	add    $0x10,%esp
+  c7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  ca:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  ce:	79 1a                	jns    ea <main+0xea>
+    printf(2, "sysstat: cannot open %s\n", path);
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	ff 75 f4             	push   -0xc(%ebp)
+  d6:	68 50 0f 00 00       	push   $0xf50
+  db:	6a 02                	push   $0x2
+  dd:	e8 99 07 00 00       	call   87b <printf>
+  e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+  e5:	e8 01 03 00 00       	call   3eb <exit>
+  }
+  if(zero)
+  ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  ee:	74 2e                	je     11e <main+0x11e>
+    write(fd, "0", 1);
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	6a 01                	push   $0x1
+  f5:	68 69 0f 00 00       	push   $0xf69
+  fa:	ff 75 e8             	push   -0x18(%ebp)
+  fd:	e8 05 03 00 00       	call   407 <write>
+ 102:	83 c4 10             	add    $0x10,%esp
+ 105:	eb 3a                	jmp    141 <main+0x141>
+  else
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      write(1, buf, n);
+ 107:	83 ec 04             	sub    $0x4,%esp
+ 10a:	ff 75 e4             	push   -0x1c(%ebp)
+ 10d:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+ 113:	50                   	push   %eax
+ 114:	6a 01                	push   $0x1
+ 116:	e8 ec 02 00 00       	call   407 <write>
+ 11b:	83 c4 10             	add    $0x10,%esp
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+ 11e:	83 ec 04             	sub    $0x4,%esp
+ 121:	68 00 02 00 00       	push   $0x200
+ 126:	8d 85 e4 fd ff ff    	lea    -0x21c(%ebp),%eax
+ 12c:	50                   	push   %eax
+ 12d:	ff 75 e8             	push   -0x18(%ebp)
+ 130:	e8 cb 02 00 00       	call   400 <read>
+ 135:	83 c4 10             	add    $0x10,%esp
+ 138:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 13b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 13f:	7f c6                	jg     107 <main+0x107>
+  close(fd);
+ 141:	83 ec 0c             	sub    $0xc,%esp
+ 144:	ff 75 e8             	push   -0x18(%ebp)
+ 147:	e8 c2 02 00 00       	call   40e <close>
+ 14c:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 14f:	e8 97 02 00 00       	call   3eb <exit>
+
+00000154 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 154:	55                   	push   %ebp
+ 155:	89 e5                	mov    %esp,%ebp
+ 157:	57                   	push   %edi
+ 158:	53                   	push   %ebx
+    if(cc < 1)
+ 159:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 162:	89 cb                	mov    %ecx,%ebx
+ 164:	89 df                	mov    %ebx,%edi
+ 166:	89 d1                	mov    %edx,%ecx
+ 168:	fc                   	cld
+ 169:	f3 aa                	rep stos %al,%es:(%edi)
+ 16b:	89 ca                	mov    %ecx,%edx
+ 16d:	89 fb                	mov    %edi,%ebx
+ 16f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 172:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 175:	90                   	nop
+ 176:	5b                   	pop    %ebx
+ 177:	5f                   	pop    %edi
+ 178:	5d                   	pop    %ebp
+ 179:	c3                   	ret
+
+0000017a <strcpy>:
+{
+ 17a:	55                   	push   %ebp
+ 17b:	89 e5                	mov    %esp,%ebp
+ 17d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 180:	8b 45 08             	mov    0x8(%ebp),%eax
+ 183:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 186:	90                   	nop
+ 187:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 18a:	8d 42 01             	lea    0x1(%edx),%eax
+ 18d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	8d 48 01             	lea    0x1(%eax),%ecx
+ 196:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 199:	0f b6 12             	movzbl (%edx),%edx
+ 19c:	88 10                	mov    %dl,(%eax)
+ 19e:	0f b6 00             	movzbl (%eax),%eax
+ 1a1:	84 c0                	test   %al,%al
+ 1a3:	75 e2                	jne    187 <strcpy+0xd>
+  return os;
+ 1a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a8:	c9                   	leave
+ 1a9:	c3                   	ret
+
+000001aa <strcmp>:
+{
+ 1aa:	55                   	push   %ebp
+ 1ab:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ad:	eb 08                	jmp    1b7 <strcmp+0xd>
+    p++, q++;
+ 1af:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ba:	0f b6 00             	movzbl (%eax),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	74 10                	je     1d1 <strcmp+0x27>
+ 1c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c4:	0f b6 10             	movzbl (%eax),%edx
+ 1c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ca:	0f b6 00             	movzbl (%eax),%eax
+ 1cd:	38 c2                	cmp    %al,%dl
+ 1cf:	74 de                	je     1af <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d4:	0f b6 00             	movzbl (%eax),%eax
+ 1d7:	0f b6 d0             	movzbl %al,%edx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	0f b6 00             	movzbl (%eax),%eax
+ 1e0:	0f b6 c0             	movzbl %al,%eax
+ 1e3:	29 c2                	sub    %eax,%edx
+ 1e5:	89 d0                	mov    %edx,%eax
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+
+000001e9 <strlen>:
+{
+ 1e9:	55                   	push   %ebp
+ 1ea:	89 e5                	mov    %esp,%ebp
+ 1ec:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ef:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f6:	eb 04                	jmp    1fc <strlen+0x13>
+ 1f8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 202:	01 d0                	add    %edx,%eax
+ 204:	0f b6 00             	movzbl (%eax),%eax
+ 207:	84 c0                	test   %al,%al
+ 209:	75 ed                	jne    1f8 <strlen+0xf>
+  return n;
+ 20b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20e:	c9                   	leave
+ 20f:	c3                   	ret
+
+00000210 <memset>:
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 213:	8b 45 10             	mov    0x10(%ebp),%eax
+ 216:	50                   	push   %eax
+ 217:	ff 75 0c             	push   0xc(%ebp)
+ 21a:	ff 75 08             	push   0x8(%ebp)
+ 21d:	e8 32 ff ff ff       	call   154 <stosb>
+ 222:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <strchr>:
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 04             	sub    $0x4,%esp
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 236:	eb 14                	jmp    24c <strchr+0x22>
+    if(*s == c)
+ 238:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23b:	0f b6 00             	movzbl (%eax),%eax
+ 23e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 241:	75 05                	jne    248 <strchr+0x1e>
+      return (char*)s;
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	eb 13                	jmp    25b <strchr+0x31>
+  for(; *s; s++)
+ 248:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24f:	0f b6 00             	movzbl (%eax),%eax
+ 252:	84 c0                	test   %al,%al
+ 254:	75 e2                	jne    238 <strchr+0xe>
+  return 0;
+ 256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+
+0000025d <gets>:
+{
+ 25d:	55                   	push   %ebp
+ 25e:	89 e5                	mov    %esp,%ebp
+ 260:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 263:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 26a:	eb 42                	jmp    2ae <gets+0x51>
+    cc = read(0, &c, 1);
+ 26c:	83 ec 04             	sub    $0x4,%esp
+ 26f:	6a 01                	push   $0x1
+ 271:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 274:	50                   	push   %eax
+ 275:	6a 00                	push   $0x0
+ 277:	e8 84 01 00 00       	call   400 <read>
+ 27c:	83 c4 10             	add    $0x10,%esp
+ 27f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 282:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 286:	7e 33                	jle    2bb <gets+0x5e>
+    buf[i++] = c;
+ 288:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 28b:	8d 50 01             	lea    0x1(%eax),%edx
+ 28e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 291:	89 c2                	mov    %eax,%edx
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	01 c2                	add    %eax,%edx
+ 298:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a2:	3c 0a                	cmp    $0xa,%al
+ 2a4:	74 16                	je     2bc <gets+0x5f>
+ 2a6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2aa:	3c 0d                	cmp    $0xd,%al
+ 2ac:	74 0e                	je     2bc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b1:	83 c0 01             	add    $0x1,%eax
+ 2b4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b7:	7f b3                	jg     26c <gets+0xf>
+ 2b9:	eb 01                	jmp    2bc <gets+0x5f>
+      break;
+ 2bb:	90                   	nop
+  }
+  buf[i] = '\0';
+ 2bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c2:	01 d0                	add    %edx,%eax
+ 2c4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+
+000002cc <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2cc:	55                   	push   %ebp
+ 2cd:	89 e5                	mov    %esp,%ebp
+ 2cf:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d2:	83 ec 08             	sub    $0x8,%esp
+ 2d5:	6a 00                	push   $0x0
+ 2d7:	ff 75 08             	push   0x8(%ebp)
+ 2da:	e8 44 01 00 00       	call   423 <open>
+ 2df:	83 c4 10             	add    $0x10,%esp
+ 2e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e9:	79 07                	jns    2f2 <stat+0x26>
+    return -1;
+ 2eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2f0:	eb 25                	jmp    317 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f2:	83 ec 08             	sub    $0x8,%esp
+ 2f5:	ff 75 0c             	push   0xc(%ebp)
+ 2f8:	ff 75 f4             	push   -0xc(%ebp)
+ 2fb:	e8 41 01 00 00       	call   441 <fstat>
+ 300:	83 c4 10             	add    $0x10,%esp
+ 303:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 306:	83 ec 0c             	sub    $0xc,%esp
+ 309:	ff 75 f4             	push   -0xc(%ebp)
+ 30c:	e8 fd 00 00 00       	call   40e <close>
+ 311:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 314:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+
+00000319 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 326:	eb 25                	jmp    34d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 328:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 32b:	89 d0                	mov    %edx,%eax
+ 32d:	c1 e0 02             	shl    $0x2,%eax
+ 330:	01 d0                	add    %edx,%eax
+ 332:	01 c0                	add    %eax,%eax
+ 334:	89 c1                	mov    %eax,%ecx
+ 336:	8b 45 08             	mov    0x8(%ebp),%eax
+ 339:	8d 50 01             	lea    0x1(%eax),%edx
+ 33c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33f:	0f b6 00             	movzbl (%eax),%eax
+ 342:	0f be c0             	movsbl %al,%eax
+ 345:	01 c8                	add    %ecx,%eax
+ 347:	83 e8 30             	sub    $0x30,%eax
+ 34a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	0f b6 00             	movzbl (%eax),%eax
+ 353:	3c 2f                	cmp    $0x2f,%al
+ 355:	7e 0a                	jle    361 <atoi+0x48>
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	0f b6 00             	movzbl (%eax),%eax
+ 35d:	3c 39                	cmp    $0x39,%al
+ 35f:	7e c7                	jle    328 <atoi+0xf>
+  return n;
+ 361:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+
+00000366 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 366:	55                   	push   %ebp
+ 367:	89 e5                	mov    %esp,%ebp
+ 369:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 36c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 372:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 375:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 378:	eb 17                	jmp    391 <memmove+0x2b>
+    *dst++ = *src++;
+ 37a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37d:	8d 42 01             	lea    0x1(%edx),%eax
+ 380:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 383:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 386:	8d 48 01             	lea    0x1(%eax),%ecx
+ 389:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38c:	0f b6 12             	movzbl (%edx),%edx
+ 38f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 391:	8b 45 10             	mov    0x10(%ebp),%eax
+ 394:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 397:	89 55 10             	mov    %edx,0x10(%ebp)
+ 39a:	85 c0                	test   %eax,%eax
+ 39c:	7f dc                	jg     37a <memmove+0x14>
+  return vdst;
+ 39e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a1:	c9                   	leave
+ 3a2:	c3                   	ret
+
+000003a3 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 3a3:	83 3d fc 12 00 00 00 	cmpl   $0x0,0x12fc
+  jg 2f
+ 3aa:	7f 2e                	jg     3da <dosyscall+0x37>
+  jl 1f
+ 3ac:	7c 29                	jl     3d7 <dosyscall+0x34>
+  pushl %eax
+ 3ae:	50                   	push   %eax
+  pushl %ebx
+ 3af:	53                   	push   %ebx
+  movl $1, %eax
+ 3b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 3b5:	0f a2                	cpuid
+  popl %ebx
+ 3b7:	5b                   	pop    %ebx
+  popl %eax
+ 3b8:	58                   	pop    %eax
+  movl $-1, sysmode
+ 3b9:	c7 05 fc 12 00 00 ff 	movl   $0xffffffff,0x12fc
+ 3c0:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 3c3:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 3c9:	74 0c                	je     3d7 <dosyscall+0x34>
+  movl $1, sysmode
+ 3cb:	c7 05 fc 12 00 00 01 	movl   $0x1,0x12fc
+ 3d2:	00 00 00 
+  jmp 2f
+ 3d5:	eb 03                	jmp    3da <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 3d7:	cd 40                	int    $0x40
+  ret
+ 3d9:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 3da:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 3dc:	ba e3 03 00 00       	mov    $0x3e3,%edx
+  sysenter
+ 3e1:	0f 34                	sysenter
+3:
+  ret
+ 3e3:	c3                   	ret
+
+000003e4 <fork>:
+
+SYSCALL(fork)
+ 3e4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e9:	eb b8                	jmp    3a3 <dosyscall>
+
+000003eb <exit>:
+SYSCALL(exit)
+ 3eb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f0:	eb b1                	jmp    3a3 <dosyscall>
+
+000003f2 <wait>:
+SYSCALL(wait)
+ 3f2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f7:	eb aa                	jmp    3a3 <dosyscall>
+
+000003f9 <pipe>:
+SYSCALL(pipe)
+ 3f9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3fe:	eb a3                	jmp    3a3 <dosyscall>
+
+00000400 <read>:
+SYSCALL(read)
+ 400:	b8 05 00 00 00       	mov    $0x5,%eax
+ 405:	eb 9c                	jmp    3a3 <dosyscall>
+
+00000407 <write>:
+SYSCALL(write)
+ 407:	b8 10 00 00 00       	mov    $0x10,%eax
+ 40c:	eb 95                	jmp    3a3 <dosyscall>
+
+0000040e <close>:
+SYSCALL(close)
+ 40e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 413:	eb 8e                	jmp    3a3 <dosyscall>
+
+00000415 <kill>:
+SYSCALL(kill)
+ 415:	b8 06 00 00 00       	mov    $0x6,%eax
+ 41a:	eb 87                	jmp    3a3 <dosyscall>
+
+0000041c <exec>:
+SYSCALL(exec)
+ 41c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 421:	eb 80                	jmp    3a3 <dosyscall>
+
+00000423 <open>:
+SYSCALL(open)
+ 423:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 428:	e9 76 ff ff ff       	jmp    3a3 <dosyscall>
+
+0000042d <mknod>:
+SYSCALL(mknod)
+ 42d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 432:	e9 6c ff ff ff       	jmp    3a3 <dosyscall>
+
+00000437 <unlink>:
+SYSCALL(unlink)
+ 437:	b8 12 00 00 00       	mov    $0x12,%eax
+ 43c:	e9 62 ff ff ff       	jmp    3a3 <dosyscall>
+
+00000441 <fstat>:
+SYSCALL(fstat)
+ 441:	b8 08 00 00 00       	mov    $0x8,%eax
+ 446:	e9 58 ff ff ff       	jmp    3a3 <dosyscall>
+
+0000044b <link>:
+SYSCALL(link)
+ 44b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 450:	e9 4e ff ff ff       	jmp    3a3 <dosyscall>
+
+00000455 <mkdir>:
+SYSCALL(mkdir)
+ 455:	b8 14 00 00 00       	mov    $0x14,%eax
+ 45a:	e9 44 ff ff ff       	jmp    3a3 <dosyscall>
+
+0000045f <chdir>:
+SYSCALL(chdir)
+ 45f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 464:	e9 3a ff ff ff       	jmp    3a3 <dosyscall>
+
+00000469 <dup>:
+SYSCALL(dup)
+ 469:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 46e:	e9 30 ff ff ff       	jmp    3a3 <dosyscall>
+
+00000473 <getpid>:
+SYSCALL(getpid)
+ 473:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 478:	e9 26 ff ff ff       	jmp    3a3 <dosyscall>
+
+0000047d <sbrk>:
+SYSCALL(sbrk)
+ 47d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 482:	e9 1c ff ff ff       	jmp    3a3 <dosyscall>
+
+00000487 <sleep>:
+SYSCALL(sleep)
+ 487:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 48c:	e9 12 ff ff ff       	jmp    3a3 <dosyscall>
+
+00000491 <uptime>:
+SYSCALL(uptime)
+ 491:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 496:	e9 08 ff ff ff       	jmp    3a3 <dosyscall>
+
+0000049b <symlink>:
+SYSCALL(symlink)
+ 49b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4a0:	e9 fe fe ff ff       	jmp    3a3 <dosyscall>
+
+000004a5 <readlink>:
+SYSCALL(readlink)
+ 4a5:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4aa:	e9 f4 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004af <fprot>:
+SYSCALL(fprot)
+ 4af:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4b4:	e9 ea fe ff ff       	jmp    3a3 <dosyscall>
+
+000004b9 <funprot>:
+SYSCALL(funprot)
+ 4b9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4be:	e9 e0 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004c3 <funlock>:
+SYSCALL(funlock)
+ 4c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c8:	e9 d6 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004cd <mmap>:
+SYSCALL(mmap)
+ 4cd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d2:	e9 cc fe ff ff       	jmp    3a3 <dosyscall>
+
+000004d7 <munmap>:
+SYSCALL(munmap)
+ 4d7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4dc:	e9 c2 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004e1 <sendfile>:
+SYSCALL(sendfile)
+ 4e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e6:	e9 b8 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004eb <readv>:
+SYSCALL(readv)
+ 4eb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f0:	e9 ae fe ff ff       	jmp    3a3 <dosyscall>
+
+000004f5 <writev>:
+SYSCALL(writev)
+ 4f5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4fa:	e9 a4 fe ff ff       	jmp    3a3 <dosyscall>
+
+000004ff <pread>:
+SYSCALL(pread)
+ 4ff:	b8 20 00 00 00       	mov    $0x20,%eax
+ 504:	e9 9a fe ff ff       	jmp    3a3 <dosyscall>
+
+00000509 <pwrite>:
+SYSCALL(pwrite)
+ 509:	b8 21 00 00 00       	mov    $0x21,%eax
+ 50e:	e9 90 fe ff ff       	jmp    3a3 <dosyscall>
+
+00000513 <lseek>:
+SYSCALL(lseek)
+ 513:	b8 22 00 00 00       	mov    $0x22,%eax
+ 518:	e9 86 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000051d <spawn>:
+SYSCALL(spawn)
+ 51d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 522:	e9 7c fe ff ff       	jmp    3a3 <dosyscall>
+
+00000527 <setpriority>:
+SYSCALL(setpriority)
+ 527:	b8 24 00 00 00       	mov    $0x24,%eax
+ 52c:	e9 72 fe ff ff       	jmp    3a3 <dosyscall>
+
+00000531 <kthread_create>:
+SYSCALL(kthread_create)
+ 531:	b8 25 00 00 00       	mov    $0x25,%eax
+ 536:	e9 68 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000053b <kthread_id>:
+SYSCALL(kthread_id)
+ 53b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 540:	e9 5e fe ff ff       	jmp    3a3 <dosyscall>
+
+00000545 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 545:	b8 27 00 00 00       	mov    $0x27,%eax
+ 54a:	e9 54 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000054f <kthread_join>:
+SYSCALL(kthread_join)
+ 54f:	b8 28 00 00 00       	mov    $0x28,%eax
+ 554:	e9 4a fe ff ff       	jmp    3a3 <dosyscall>
+
+00000559 <futex>:
+SYSCALL(futex)
+ 559:	b8 29 00 00 00       	mov    $0x29,%eax
+ 55e:	e9 40 fe ff ff       	jmp    3a3 <dosyscall>
+
+00000563 <signal>:
+SYSCALL(signal)
+ 563:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 568:	e9 36 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000056d <alarm>:
+SYSCALL(alarm)
+ 56d:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 572:	e9 2c fe ff ff       	jmp    3a3 <dosyscall>
+
+00000577 <usleep>:
+SYSCALL(usleep)
+ 577:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 57c:	e9 22 fe ff ff       	jmp    3a3 <dosyscall>
+
+00000581 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 581:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 586:	e9 18 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000058b <ioring_enter>:
+SYSCALL(ioring_enter)
+ 58b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 590:	e9 0e fe ff ff       	jmp    3a3 <dosyscall>
+
+00000595 <getrusage>:
+SYSCALL(getrusage)
+ 595:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 59a:	e9 04 fe ff ff       	jmp    3a3 <dosyscall>
+
+0000059f <mount>:
+SYSCALL(mount)
+ 59f:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5a4:	e9 fa fd ff ff       	jmp    3a3 <dosyscall>
+
+000005a9 <getdents>:
+SYSCALL(getdents)
+ 5a9:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5ae:	e9 f0 fd ff ff       	jmp    3a3 <dosyscall>
+
+000005b3 <yield>:
+SYSCALL(yield)
+ 5b3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5b8:	e9 e6 fd ff ff       	jmp    3a3 <dosyscall>
+
+000005bd <ncpu>:
+SYSCALL(ncpu)
+ 5bd:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5c2:	e9 dc fd ff ff       	jmp    3a3 <dosyscall>
+
+000005c7 <fallocate>:
+SYSCALL(fallocate)
+ 5c7:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5cc:	e9 d2 fd ff ff       	jmp    3a3 <dosyscall>
+
+000005d1 <ftruncate>:
+SYSCALL(ftruncate)
+ 5d1:	b8 35 00 00 00       	mov    $0x35,%eax
+ 5d6:	e9 c8 fd ff ff       	jmp    3a3 <dosyscall>
+
+000005db <fsync>:
+SYSCALL(fsync)
+ 5db:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5e0:	e9 be fd ff ff       	jmp    3a3 <dosyscall>
+
+000005e5 <fdatasync>:
+SYSCALL(fdatasync)
+ 5e5:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5ea:	e9 b4 fd ff ff       	jmp    3a3 <dosyscall>
+
+000005ef <poll>:
+SYSCALL(poll)
+ 5ef:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5f4:	e9 aa fd ff ff       	jmp    3a3 <dosyscall>
+
+000005f9 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 5f9:	55                   	push   %ebp
+ 5fa:	89 e5                	mov    %esp,%ebp
+ 5fc:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 5ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 602:	8b 40 04             	mov    0x4(%eax),%eax
+ 605:	85 c0                	test   %eax,%eax
+ 607:	7e 1f                	jle    628 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 609:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60c:	8b 50 04             	mov    0x4(%eax),%edx
+ 60f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 612:	8d 48 08             	lea    0x8(%eax),%ecx
+ 615:	8b 45 08             	mov    0x8(%ebp),%eax
+ 618:	8b 00                	mov    (%eax),%eax
+ 61a:	83 ec 04             	sub    $0x4,%esp
+ 61d:	52                   	push   %edx
+ 61e:	51                   	push   %ecx
+ 61f:	50                   	push   %eax
+ 620:	e8 d0 fe ff ff       	call   4f5 <writev>
+ 625:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 628:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 632:	8b 45 08             	mov    0x8(%ebp),%eax
+ 635:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 63c:	00 00 00 
+}
+ 63f:	90                   	nop
+ 640:	c9                   	leave
+ 641:	c3                   	ret
+
+00000642 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 642:	55                   	push   %ebp
+ 643:	89 e5                	mov    %esp,%ebp
+ 645:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 648:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 64c:	0f 84 94 00 00 00    	je     6e6 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 652:	8b 45 08             	mov    0x8(%ebp),%eax
+ 655:	8b 40 04             	mov    0x4(%eax),%eax
+ 658:	85 c0                	test   %eax,%eax
+ 65a:	7e 40                	jle    69c <put+0x5a>
+    v = &o->iov[o->n-1];
+ 65c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65f:	8b 40 04             	mov    0x4(%eax),%eax
+ 662:	83 e8 01             	sub    $0x1,%eax
+ 665:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 66c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66f:	01 d0                	add    %edx,%eax
+ 671:	83 c0 08             	add    $0x8,%eax
+ 674:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 677:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 67a:	8b 10                	mov    (%eax),%edx
+ 67c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 67f:	8b 40 04             	mov    0x4(%eax),%eax
+ 682:	01 d0                	add    %edx,%eax
+ 684:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 687:	75 13                	jne    69c <put+0x5a>
+      v->iov_len += n;
+ 689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 68c:	8b 50 04             	mov    0x4(%eax),%edx
+ 68f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 692:	01 c2                	add    %eax,%edx
+ 694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 697:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 69a:	eb 4b                	jmp    6e7 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 69c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69f:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a2:	83 f8 10             	cmp    $0x10,%eax
+ 6a5:	75 0e                	jne    6b5 <put+0x73>
+    flush(o);
+ 6a7:	83 ec 0c             	sub    $0xc,%esp
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 47 ff ff ff       	call   5f9 <flush>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 6b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b8:	8b 50 04             	mov    0x4(%eax),%edx
+ 6bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 6c1:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 6c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c8:	8b 50 04             	mov    0x4(%eax),%edx
+ 6cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6d1:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 6d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6db:	8d 50 01             	lea    0x1(%eax),%edx
+ 6de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e1:	89 50 04             	mov    %edx,0x4(%eax)
+ 6e4:	eb 01                	jmp    6e7 <put+0xa5>
+    return;
+ 6e6:	90                   	nop
+}
+ 6e7:	c9                   	leave
+ 6e8:	c3                   	ret
+
+000006e9 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 6ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f2:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 6f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fb:	01 d0                	add    %edx,%eax
+ 6fd:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 702:	77 0b                	ja     70f <room+0x26>
+ 704:	8b 45 08             	mov    0x8(%ebp),%eax
+ 707:	8b 40 04             	mov    0x4(%eax),%eax
+ 70a:	83 f8 10             	cmp    $0x10,%eax
+ 70d:	75 0e                	jne    71d <room+0x34>
+    flush(o);
+ 70f:	83 ec 0c             	sub    $0xc,%esp
+ 712:	ff 75 08             	push   0x8(%ebp)
+ 715:	e8 df fe ff ff       	call   5f9 <flush>
+ 71a:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 71d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 720:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 726:	8b 45 08             	mov    0x8(%ebp),%eax
+ 729:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 72f:	01 d0                	add    %edx,%eax
+}
+ 731:	c9                   	leave
+ 732:	c3                   	ret
+
+00000733 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 733:	55                   	push   %ebp
+ 734:	89 e5                	mov    %esp,%ebp
+ 736:	83 ec 28             	sub    $0x28,%esp
+ 739:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73c:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 73f:	83 ec 08             	sub    $0x8,%esp
+ 742:	6a 01                	push   $0x1
+ 744:	ff 75 08             	push   0x8(%ebp)
+ 747:	e8 9d ff ff ff       	call   6e9 <room>
+ 74c:	83 c4 10             	add    $0x10,%esp
+ 74f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 752:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 755:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 759:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 75b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 764:	8d 50 01             	lea    0x1(%eax),%edx
+ 767:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76a:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	6a 01                	push   $0x1
+ 775:	ff 75 f4             	push   -0xc(%ebp)
+ 778:	ff 75 08             	push   0x8(%ebp)
+ 77b:	e8 c2 fe ff ff       	call   642 <put>
+ 780:	83 c4 10             	add    $0x10,%esp
+}
+ 783:	90                   	nop
+ 784:	c9                   	leave
+ 785:	c3                   	ret
+
+00000786 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 786:	55                   	push   %ebp
+ 787:	89 e5                	mov    %esp,%ebp
+ 789:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 78c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 793:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 797:	74 17                	je     7b0 <printint+0x2a>
+ 799:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 79d:	79 11                	jns    7b0 <printint+0x2a>
+    neg = 1;
+ 79f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7a9:	f7 d8                	neg    %eax
+ 7ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7ae:	eb 06                	jmp    7b6 <printint+0x30>
+  } else {
+    x = xx;
+ 7b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7b3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7bd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7c0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7c3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7c8:	f7 f1                	div    %ecx
+ 7ca:	89 d1                	mov    %edx,%ecx
+ 7cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cf:	8d 50 01             	lea    0x1(%eax),%edx
+ 7d2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7d5:	0f b6 91 00 13 00 00 	movzbl 0x1300(%ecx),%edx
+ 7dc:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7eb:	f7 f1                	div    %ecx
+ 7ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7f4:	75 c7                	jne    7bd <printint+0x37>
+  if(neg)
+ 7f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7fa:	74 0e                	je     80a <printint+0x84>
+    buf[i++] = '-';
+ 7fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ff:	8d 50 01             	lea    0x1(%eax),%edx
+ 802:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 805:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 80a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 810:	83 ec 08             	sub    $0x8,%esp
+ 813:	ff 75 e8             	push   -0x18(%ebp)
+ 816:	ff 75 08             	push   0x8(%ebp)
+ 819:	e8 cb fe ff ff       	call   6e9 <room>
+ 81e:	83 c4 10             	add    $0x10,%esp
+ 821:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 824:	eb 1d                	jmp    843 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 826:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 829:	83 e8 01             	sub    $0x1,%eax
+ 82c:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 82f:	89 c2                	mov    %eax,%edx
+ 831:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 834:	01 c2                	add    %eax,%edx
+ 836:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 839:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83c:	01 c8                	add    %ecx,%eax
+ 83e:	0f b6 00             	movzbl (%eax),%eax
+ 841:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 843:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 847:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 84b:	79 d9                	jns    826 <printint+0xa0>
+  o->used += n;
+ 84d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 850:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 856:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 859:	01 c2                	add    %eax,%edx
+ 85b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 864:	83 ec 04             	sub    $0x4,%esp
+ 867:	ff 75 e8             	push   -0x18(%ebp)
+ 86a:	ff 75 e4             	push   -0x1c(%ebp)
+ 86d:	ff 75 08             	push   0x8(%ebp)
+ 870:	e8 cd fd ff ff       	call   642 <put>
+ 875:	83 c4 10             	add    $0x10,%esp
+}
+ 878:	90                   	nop
+ 879:	c9                   	leave
+ 87a:	c3                   	ret
+
+0000087b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 87b:	55                   	push   %ebp
+ 87c:	89 e5                	mov    %esp,%ebp
+ 87e:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 884:	8b 45 08             	mov    0x8(%ebp),%eax
+ 887:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 88d:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 894:	00 00 00 
+  o.used = 0;
+ 897:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 89e:	00 00 00 
+  state = 0;
+ 8a1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8a8:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8ab:	83 c0 04             	add    $0x4,%eax
+ 8ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 8b1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8bf:	e9 82 01 00 00       	jmp    a46 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 8c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ca:	01 d0                	add    %edx,%eax
+ 8cc:	0f b6 00             	movzbl (%eax),%eax
+ 8cf:	0f be c0             	movsbl %al,%eax
+ 8d2:	25 ff 00 00 00       	and    $0xff,%eax
+ 8d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 8da:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 8de:	75 38                	jne    918 <printf+0x9d>
+      if(c == '%'){
+ 8e0:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 8e4:	0f 85 58 01 00 00    	jne    a42 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 8ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ed:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 8f3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8f6:	01 ca                	add    %ecx,%edx
+ 8f8:	83 ec 04             	sub    $0x4,%esp
+ 8fb:	50                   	push   %eax
+ 8fc:	52                   	push   %edx
+ 8fd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 903:	50                   	push   %eax
+ 904:	e8 39 fd ff ff       	call   642 <put>
+ 909:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 90c:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 913:	e9 2a 01 00 00       	jmp    a42 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 918:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 91c:	0f 85 20 01 00 00    	jne    a42 <printf+0x1c7>
+      if(c == 'd'){
+ 922:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 926:	75 22                	jne    94a <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 928:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 92b:	8b 00                	mov    (%eax),%eax
+ 92d:	6a 01                	push   $0x1
+ 92f:	6a 0a                	push   $0xa
+ 931:	50                   	push   %eax
+ 932:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 938:	50                   	push   %eax
+ 939:	e8 48 fe ff ff       	call   786 <printint>
+ 93e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 941:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 945:	e9 e8 00 00 00       	jmp    a32 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 94a:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 94e:	74 06                	je     956 <printf+0xdb>
+ 950:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 954:	75 22                	jne    978 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 956:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 959:	8b 00                	mov    (%eax),%eax
+ 95b:	6a 00                	push   $0x0
+ 95d:	6a 10                	push   $0x10
+ 95f:	50                   	push   %eax
+ 960:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 966:	50                   	push   %eax
+ 967:	e8 1a fe ff ff       	call   786 <printint>
+ 96c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 96f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 973:	e9 ba 00 00 00       	jmp    a32 <printf+0x1b7>
+      } else if(c == 's'){
+ 978:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 97c:	75 3f                	jne    9bd <printf+0x142>
+        s = (char*)*ap;
+ 97e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 981:	8b 00                	mov    (%eax),%eax
+ 983:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 986:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 98a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 98e:	75 07                	jne    997 <printf+0x11c>
+          s = "(null)";
+ 990:	c7 45 f4 6b 0f 00 00 	movl   $0xf6b,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 997:	83 ec 0c             	sub    $0xc,%esp
+ 99a:	ff 75 f4             	push   -0xc(%ebp)
+ 99d:	e8 47 f8 ff ff       	call   1e9 <strlen>
+ 9a2:	83 c4 10             	add    $0x10,%esp
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	50                   	push   %eax
+ 9a9:	ff 75 f4             	push   -0xc(%ebp)
+ 9ac:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9b2:	50                   	push   %eax
+ 9b3:	e8 8a fc ff ff       	call   642 <put>
+ 9b8:	83 c4 10             	add    $0x10,%esp
+ 9bb:	eb 75                	jmp    a32 <printf+0x1b7>
+      } else if(c == 'c'){
+ 9bd:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 9c1:	75 21                	jne    9e4 <printf+0x169>
+        putc(&o, *ap);
+ 9c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c6:	8b 00                	mov    (%eax),%eax
+ 9c8:	0f be c0             	movsbl %al,%eax
+ 9cb:	83 ec 08             	sub    $0x8,%esp
+ 9ce:	50                   	push   %eax
+ 9cf:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d5:	50                   	push   %eax
+ 9d6:	e8 58 fd ff ff       	call   733 <putc>
+ 9db:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9de:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9e2:	eb 4e                	jmp    a32 <printf+0x1b7>
+      } else if(c == '%'){
+ 9e4:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9e8:	75 1b                	jne    a05 <printf+0x18a>
+        putc(&o, c);
+ 9ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9ed:	0f be c0             	movsbl %al,%eax
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	50                   	push   %eax
+ 9f4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9fa:	50                   	push   %eax
+ 9fb:	e8 33 fd ff ff       	call   733 <putc>
+ a00:	83 c4 10             	add    $0x10,%esp
+ a03:	eb 2d                	jmp    a32 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a05:	83 ec 08             	sub    $0x8,%esp
+ a08:	6a 25                	push   $0x25
+ a0a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a10:	50                   	push   %eax
+ a11:	e8 1d fd ff ff       	call   733 <putc>
+ a16:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ a19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a1c:	0f be c0             	movsbl %al,%eax
+ a1f:	83 ec 08             	sub    $0x8,%esp
+ a22:	50                   	push   %eax
+ a23:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a29:	50                   	push   %eax
+ a2a:	e8 04 fd ff ff       	call   733 <putc>
+ a2f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a32:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ a39:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3c:	83 c0 01             	add    $0x1,%eax
+ a3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a42:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a46:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a4c:	01 d0                	add    %edx,%eax
+ a4e:	0f b6 00             	movzbl (%eax),%eax
+ a51:	84 c0                	test   %al,%al
+ a53:	0f 85 6b fe ff ff    	jne    8c4 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ a59:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ a5d:	75 22                	jne    a81 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ a5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a62:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a68:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a6b:	01 ca                	add    %ecx,%edx
+ a6d:	83 ec 04             	sub    $0x4,%esp
+ a70:	50                   	push   %eax
+ a71:	52                   	push   %edx
+ a72:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a78:	50                   	push   %eax
+ a79:	e8 c4 fb ff ff       	call   642 <put>
+ a7e:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ a81:	83 ec 0c             	sub    $0xc,%esp
+ a84:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a8a:	50                   	push   %eax
+ a8b:	e8 69 fb ff ff       	call   5f9 <flush>
+ a90:	83 c4 10             	add    $0x10,%esp
+}
+ a93:	90                   	nop
+ a94:	c9                   	leave
+ a95:	c3                   	ret
+
+00000a96 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ a96:	55                   	push   %ebp
+ a97:	89 e5                	mov    %esp,%ebp
+ a99:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ a9c:	8b 55 08             	mov    0x8(%ebp),%edx
+ a9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aa2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ aa5:	f0 87 02             	lock xchg %eax,(%edx)
+ aa8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ aab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ aae:	c9                   	leave
+ aaf:	c3                   	ret
+
+00000ab0 <lock>:
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ ab6:	a1 14 13 00 00       	mov    0x1314,%eax
+ abb:	85 c0                	test   %eax,%eax
+ abd:	74 09                	je     ac8 <lock+0x18>
+ abf:	a1 14 13 00 00       	mov    0x1314,%eax
+ ac4:	ff d0                	call   *%eax
+ ac6:	eb 05                	jmp    acd <lock+0x1d>
+ ac8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ acd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ ad0:	90                   	nop
+ ad1:	83 ec 08             	sub    $0x8,%esp
+ ad4:	6a 01                	push   $0x1
+ ad6:	68 4c 13 00 00       	push   $0x134c
+ adb:	e8 b6 ff ff ff       	call   a96 <xchg>
+ ae0:	83 c4 10             	add    $0x10,%esp
+ ae3:	85 c0                	test   %eax,%eax
+ ae5:	75 ea                	jne    ad1 <lock+0x21>
+  return pin;
+ ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ aea:	c9                   	leave
+ aeb:	c3                   	ret
+
+00000aec <unlock>:
+{
+ aec:	55                   	push   %ebp
+ aed:	89 e5                	mov    %esp,%ebp
+ aef:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ af2:	6a 00                	push   $0x0
+ af4:	68 4c 13 00 00       	push   $0x134c
+ af9:	e8 98 ff ff ff       	call   a96 <xchg>
+ afe:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b01:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b05:	78 10                	js     b17 <unlock+0x2b>
+    mallocunpin(pin);
+ b07:	a1 18 13 00 00       	mov    0x1318,%eax
+ b0c:	83 ec 0c             	sub    $0xc,%esp
+ b0f:	ff 75 08             	push   0x8(%ebp)
+ b12:	ff d0                	call   *%eax
+ b14:	83 c4 10             	add    $0x10,%esp
+}
+ b17:	90                   	nop
+ b18:	c9                   	leave
+ b19:	c3                   	ret
+
+00000b1a <sizeclass>:
+{
+ b1a:	55                   	push   %ebp
+ b1b:	89 e5                	mov    %esp,%ebp
+ b1d:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ b20:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ b27:	eb 1c                	jmp    b45 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ b29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2c:	ba 02 00 00 00       	mov    $0x2,%edx
+ b31:	89 c1                	mov    %eax,%ecx
+ b33:	d3 e2                	shl    %cl,%edx
+ b35:	89 d0                	mov    %edx,%eax
+ b37:	3b 45 08             	cmp    0x8(%ebp),%eax
+ b3a:	72 05                	jb     b41 <sizeclass+0x27>
+      return c;
+ b3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3f:	eb 0f                	jmp    b50 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ b41:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ b45:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ b49:	7e de                	jle    b29 <sizeclass+0xf>
+  return -1;
+ b4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b50:	c9                   	leave
+ b51:	c3                   	ret
+
+00000b52 <bigfree>:
+{
+ b52:	55                   	push   %ebp
+ b53:	89 e5                	mov    %esp,%ebp
+ b55:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b58:	a1 24 13 00 00       	mov    0x1324,%eax
+ b5d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b60:	eb 24                	jmp    b86 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b65:	8b 00                	mov    (%eax),%eax
+ b67:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b6a:	72 12                	jb     b7e <bigfree+0x2c>
+ b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b72:	72 24                	jb     b98 <bigfree+0x46>
+ b74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b77:	8b 00                	mov    (%eax),%eax
+ b79:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b7c:	72 1a                	jb     b98 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b81:	8b 00                	mov    (%eax),%eax
+ b83:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b86:	8b 45 08             	mov    0x8(%ebp),%eax
+ b89:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b8c:	73 d4                	jae    b62 <bigfree+0x10>
+ b8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b91:	8b 00                	mov    (%eax),%eax
+ b93:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b96:	73 ca                	jae    b62 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ b98:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9b:	8b 40 04             	mov    0x4(%eax),%eax
+ b9e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba8:	01 c2                	add    %eax,%edx
+ baa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bad:	8b 00                	mov    (%eax),%eax
+ baf:	39 c2                	cmp    %eax,%edx
+ bb1:	75 24                	jne    bd7 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb6:	8b 50 04             	mov    0x4(%eax),%edx
+ bb9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbc:	8b 00                	mov    (%eax),%eax
+ bbe:	8b 40 04             	mov    0x4(%eax),%eax
+ bc1:	01 c2                	add    %eax,%edx
+ bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc6:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bc9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bcc:	8b 00                	mov    (%eax),%eax
+ bce:	8b 10                	mov    (%eax),%edx
+ bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd3:	89 10                	mov    %edx,(%eax)
+ bd5:	eb 0a                	jmp    be1 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ bd7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bda:	8b 10                	mov    (%eax),%edx
+ bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdf:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ be1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be4:	8b 40 04             	mov    0x4(%eax),%eax
+ be7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf1:	01 d0                	add    %edx,%eax
+ bf3:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bf6:	75 20                	jne    c18 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ bf8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfb:	8b 50 04             	mov    0x4(%eax),%edx
+ bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+ c01:	8b 40 04             	mov    0x4(%eax),%eax
+ c04:	01 c2                	add    %eax,%edx
+ c06:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c09:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0f:	8b 10                	mov    (%eax),%edx
+ c11:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c14:	89 10                	mov    %edx,(%eax)
+ c16:	eb 08                	jmp    c20 <bigfree+0xce>
+    p->s.ptr = bp;
+ c18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1b:	8b 55 08             	mov    0x8(%ebp),%edx
+ c1e:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c23:	a3 24 13 00 00       	mov    %eax,0x1324
+}
+ c28:	90                   	nop
+ c29:	c9                   	leave
+ c2a:	c3                   	ret
+
+00000c2b <free>:
+{
+ c2b:	55                   	push   %ebp
+ c2c:	89 e5                	mov    %esp,%ebp
+ c2e:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ c31:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ c35:	74 68                	je     c9f <free+0x74>
+  bp = (Header*)ap - 1;
+ c37:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3a:	83 e8 08             	sub    $0x8,%eax
+ c3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ c40:	e8 6b fe ff ff       	call   ab0 <lock>
+ c45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ c48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4b:	8b 40 04             	mov    0x4(%eax),%eax
+ c4e:	83 ec 0c             	sub    $0xc,%esp
+ c51:	50                   	push   %eax
+ c52:	e8 c3 fe ff ff       	call   b1a <sizeclass>
+ c57:	83 c4 10             	add    $0x10,%esp
+ c5a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ c5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ c61:	78 1e                	js     c81 <free+0x56>
+    bp->s.ptr = classfree[c];
+ c63:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c66:	8b 14 85 28 13 00 00 	mov    0x1328(,%eax,4),%edx
+ c6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c70:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ c72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c78:	89 14 85 28 13 00 00 	mov    %edx,0x1328(,%eax,4)
+ c7f:	eb 0e                	jmp    c8f <free+0x64>
+    bigfree(bp);
+ c81:	83 ec 0c             	sub    $0xc,%esp
+ c84:	ff 75 f4             	push   -0xc(%ebp)
+ c87:	e8 c6 fe ff ff       	call   b52 <bigfree>
+ c8c:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ c8f:	83 ec 0c             	sub    $0xc,%esp
+ c92:	ff 75 f0             	push   -0x10(%ebp)
+ c95:	e8 52 fe ff ff       	call   aec <unlock>
+ c9a:	83 c4 10             	add    $0x10,%esp
+ c9d:	eb 01                	jmp    ca0 <free+0x75>
+    return;
+ c9f:	90                   	nop
+}
+ ca0:	c9                   	leave
+ ca1:	c3                   	ret
+
+00000ca2 <morecore>:
+{
+ ca2:	55                   	push   %ebp
+ ca3:	89 e5                	mov    %esp,%ebp
+ ca5:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ ca8:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ caf:	77 07                	ja     cb8 <morecore+0x16>
+    nu = 4096;
+ cb1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbb:	c1 e0 03             	shl    $0x3,%eax
+ cbe:	83 ec 0c             	sub    $0xc,%esp
+ cc1:	50                   	push   %eax
+ cc2:	e8 b6 f7 ff ff       	call   47d <sbrk>
+ cc7:	83 c4 10             	add    $0x10,%esp
+ cca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ ccd:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ cd1:	75 07                	jne    cda <morecore+0x38>
+    return 0;
+ cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+ cd8:	eb 22                	jmp    cfc <morecore+0x5a>
+  hp = (Header*)p;
+ cda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ ce0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+ ce6:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ ce9:	83 ec 0c             	sub    $0xc,%esp
+ cec:	ff 75 f0             	push   -0x10(%ebp)
+ cef:	e8 5e fe ff ff       	call   b52 <bigfree>
+ cf4:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cf7:	a1 24 13 00 00       	mov    0x1324,%eax
+}
+ cfc:	c9                   	leave
+ cfd:	c3                   	ret
+
+00000cfe <bigalloc>:
+{
+ cfe:	55                   	push   %ebp
+ cff:	89 e5                	mov    %esp,%ebp
+ d01:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d04:	a1 24 13 00 00       	mov    0x1324,%eax
+ d09:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d0c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d10:	75 23                	jne    d35 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ d12:	c7 45 f0 1c 13 00 00 	movl   $0x131c,-0x10(%ebp)
+ d19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d1c:	a3 24 13 00 00       	mov    %eax,0x1324
+ d21:	a1 24 13 00 00       	mov    0x1324,%eax
+ d26:	a3 1c 13 00 00       	mov    %eax,0x131c
+    base.s.size = 0;
+ d2b:	c7 05 20 13 00 00 00 	movl   $0x0,0x1320
+ d32:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d38:	8b 00                	mov    (%eax),%eax
+ d3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d40:	8b 40 04             	mov    0x4(%eax),%eax
+ d43:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d46:	72 4a                	jb     d92 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ d48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4b:	8b 40 04             	mov    0x4(%eax),%eax
+ d4e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ d51:	75 0c                	jne    d5f <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ d53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d56:	8b 10                	mov    (%eax),%edx
+ d58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d5b:	89 10                	mov    %edx,(%eax)
+ d5d:	eb 26                	jmp    d85 <bigalloc+0x87>
+        p->s.size -= nunits;
+ d5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d62:	8b 40 04             	mov    0x4(%eax),%eax
+ d65:	2b 45 08             	sub    0x8(%ebp),%eax
+ d68:	89 c2                	mov    %eax,%edx
+ d6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d73:	8b 40 04             	mov    0x4(%eax),%eax
+ d76:	c1 e0 03             	shl    $0x3,%eax
+ d79:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+ d82:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ d85:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d88:	a3 24 13 00 00       	mov    %eax,0x1324
+      return p;
+ d8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d90:	eb 3b                	jmp    dcd <bigalloc+0xcf>
+    if(p == freep)
+ d92:	a1 24 13 00 00       	mov    0x1324,%eax
+ d97:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d9a:	75 1e                	jne    dba <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ d9c:	83 ec 0c             	sub    $0xc,%esp
+ d9f:	ff 75 08             	push   0x8(%ebp)
+ da2:	e8 fb fe ff ff       	call   ca2 <morecore>
+ da7:	83 c4 10             	add    $0x10,%esp
+ daa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ db1:	75 07                	jne    dba <bigalloc+0xbc>
+        return 0;
+ db3:	b8 00 00 00 00       	mov    $0x0,%eax
+ db8:	eb 13                	jmp    dcd <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dbd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dc3:	8b 00                	mov    (%eax),%eax
+ dc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ dc8:	e9 70 ff ff ff       	jmp    d3d <bigalloc+0x3f>
+}
+ dcd:	c9                   	leave
+ dce:	c3                   	ret
+
+00000dcf <alloc>:
+alloc(uint nbytes)
+{
+ dcf:	55                   	push   %ebp
+ dd0:	89 e5                	mov    %esp,%ebp
+ dd2:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd8:	83 c0 07             	add    $0x7,%eax
+ ddb:	c1 e8 03             	shr    $0x3,%eax
+ dde:	83 c0 01             	add    $0x1,%eax
+ de1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ de4:	ff 75 f4             	push   -0xc(%ebp)
+ de7:	e8 2e fd ff ff       	call   b1a <sizeclass>
+ dec:	83 c4 04             	add    $0x4,%esp
+ def:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ df2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ df6:	79 2c                	jns    e24 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ df8:	83 ec 0c             	sub    $0xc,%esp
+ dfb:	ff 75 f4             	push   -0xc(%ebp)
+ dfe:	e8 fb fe ff ff       	call   cfe <bigalloc>
+ e03:	83 c4 10             	add    $0x10,%esp
+ e06:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e09:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e0d:	75 0a                	jne    e19 <alloc+0x4a>
+      return 0;
+ e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+ e14:	e9 c8 00 00 00       	jmp    ee1 <alloc+0x112>
+    return (void*)(p + 1);
+ e19:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e1c:	83 c0 08             	add    $0x8,%eax
+ e1f:	e9 bd 00 00 00       	jmp    ee1 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ e24:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e27:	8b 04 85 28 13 00 00 	mov    0x1328(,%eax,4),%eax
+ e2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e31:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e35:	74 1a                	je     e51 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ e37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e3a:	8b 10                	mov    (%eax),%edx
+ e3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e3f:	89 14 85 28 13 00 00 	mov    %edx,0x1328(,%eax,4)
+    return (void*)(p + 1);
+ e46:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e49:	83 c0 08             	add    $0x8,%eax
+ e4c:	e9 90 00 00 00       	jmp    ee1 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ e51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e54:	ba 02 00 00 00       	mov    $0x2,%edx
+ e59:	89 c1                	mov    %eax,%ecx
+ e5b:	d3 e2                	shl    %cl,%edx
+ e5d:	89 d0                	mov    %edx,%eax
+ e5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ e62:	a1 44 13 00 00       	mov    0x1344,%eax
+ e67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e6a:	c1 e2 03             	shl    $0x3,%edx
+ e6d:	01 d0                	add    %edx,%eax
+ e6f:	8b 15 48 13 00 00    	mov    0x1348,%edx
+ e75:	39 c2                	cmp    %eax,%edx
+ e77:	73 3f                	jae    eb8 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ e79:	83 ec 0c             	sub    $0xc,%esp
+ e7c:	68 00 08 00 00       	push   $0x800
+ e81:	e8 78 fe ff ff       	call   cfe <bigalloc>
+ e86:	83 c4 10             	add    $0x10,%esp
+ e89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e8c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e90:	75 07                	jne    e99 <alloc+0xca>
+      return 0;
+ e92:	b8 00 00 00 00       	mov    $0x0,%eax
+ e97:	eb 48                	jmp    ee1 <alloc+0x112>
+    bump = (char*)p;
+ e99:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e9c:	a3 44 13 00 00       	mov    %eax,0x1344
+    bumpend = (char*)(p + p->s.size);
+ ea1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ea4:	8b 40 04             	mov    0x4(%eax),%eax
+ ea7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ eae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eb1:	01 d0                	add    %edx,%eax
+ eb3:	a3 48 13 00 00       	mov    %eax,0x1348
+  }
+  p = (Header*)bump;
+ eb8:	a1 44 13 00 00       	mov    0x1344,%eax
+ ebd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ ec0:	a1 44 13 00 00       	mov    0x1344,%eax
+ ec5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ec8:	c1 e2 03             	shl    $0x3,%edx
+ ecb:	01 d0                	add    %edx,%eax
+ ecd:	a3 44 13 00 00       	mov    %eax,0x1344
+  p->s.size = nunits;
+ ed2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ed5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ed8:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ edb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ede:	83 c0 08             	add    $0x8,%eax
+}
+ ee1:	c9                   	leave
+ ee2:	c3                   	ret
+
+00000ee3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ee3:	55                   	push   %ebp
+ ee4:	89 e5                	mov    %esp,%ebp
+ ee6:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ ee9:	e8 c2 fb ff ff       	call   ab0 <lock>
+ eee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ ef1:	83 ec 0c             	sub    $0xc,%esp
+ ef4:	ff 75 08             	push   0x8(%ebp)
+ ef7:	e8 d3 fe ff ff       	call   dcf <alloc>
+ efc:	83 c4 10             	add    $0x10,%esp
+ eff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f02:	83 ec 0c             	sub    $0xc,%esp
+ f05:	ff 75 f4             	push   -0xc(%ebp)
+ f08:	e8 df fb ff ff       	call   aec <unlock>
+ f0d:	83 c4 10             	add    $0x10,%esp
+  return p;
+ f10:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f13:	c9                   	leave
+ f14:	c3                   	ret
@@ -0,0 +1,37 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Print system call statistics: by system call, or with -p by
+// thread.  With -z, reset them instead.
+int
+main(int argc, char **argv)
+{
+  char buf[512], *path;
+  int i, fd, n, zero;
+
+  path = "/dev/sysstat";
+  zero = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-p") == 0)
+      path = "/dev/procstat";
+    else if(strcmp(argv[i], "-z") == 0)
+      zero = 1;
+    else {
+      printf(2, "usage: sysstat [-p] [-z]\n");
+      exit();
+    }
+  }
+  if((fd = open(path, zero ? O_WRONLY : O_RDONLY)) < 0){
+    printf(2, "sysstat: cannot open %s\n", path);
+    exit();
+  }
+  if(zero)
+    write(fd, "0", 1);
+  else
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      write(1, buf, n);
+  close(fd);
+  exit();
+}
@@ -0,0 +1,2167 @@
+
+_test_falloc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <check>:
+
+static char buf[SIZE], buf2[SIZE];
+
+static int
+check(int fd, int off, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  if(pread(fd, buf2, n, off) != n)
+       6:	ff 75 0c             	push   0xc(%ebp)
+       9:	ff 75 10             	push   0x10(%ebp)
+       c:	68 20 17 01 00       	push   $0x11720
+      11:	ff 75 08             	push   0x8(%ebp)
+      14:	e8 ba 07 00 00       	call   7d3 <pread>
+      19:	83 c4 10             	add    $0x10,%esp
+      1c:	39 45 10             	cmp    %eax,0x10(%ebp)
+      1f:	74 07                	je     28 <check+0x28>
+    return 0;
+      21:	b8 00 00 00 00       	mov    $0x0,%eax
+      26:	eb 3f                	jmp    67 <check+0x67>
+  for(i = 0; i < n; i++)
+      28:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      2f:	eb 29                	jmp    5a <check+0x5a>
+    if(buf2[i] != buf[off+i])
+      31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      34:	05 20 17 01 00       	add    $0x11720,%eax
+      39:	0f b6 10             	movzbl (%eax),%edx
+      3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+      3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      42:	01 c8                	add    %ecx,%eax
+      44:	0f b6 80 20 17 00 00 	movzbl 0x1720(%eax),%eax
+      4b:	38 c2                	cmp    %al,%dl
+      4d:	74 07                	je     56 <check+0x56>
+      return 0;
+      4f:	b8 00 00 00 00       	mov    $0x0,%eax
+      54:	eb 11                	jmp    67 <check+0x67>
+  for(i = 0; i < n; i++)
+      56:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+      60:	7c cf                	jl     31 <check+0x31>
+  return 1;
+      62:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      67:	c9                   	leave
+      68:	c3                   	ret
+
+00000069 <size>:
+
+static int
+size(int fd)
+{
+      69:	55                   	push   %ebp
+      6a:	89 e5                	mov    %esp,%ebp
+      6c:	83 ec 28             	sub    $0x28,%esp
+  struct stat st;
+
+  if(fstat(fd, &st) < 0)
+      6f:	83 ec 08             	sub    $0x8,%esp
+      72:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+      75:	50                   	push   %eax
+      76:	ff 75 08             	push   0x8(%ebp)
+      79:	e8 97 06 00 00       	call   715 <fstat>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	85 c0                	test   %eax,%eax
+      83:	79 07                	jns    8c <size+0x23>
+    return -1;
+      85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      8a:	eb 03                	jmp    8f <size+0x26>
+  return st.size;
+      8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+      8f:	c9                   	leave
+      90:	c3                   	ret
+
+00000091 <test>:
+
+static void
+test(char *path)
+{
+      91:	55                   	push   %ebp
+      92:	89 e5                	mov    %esp,%ebp
+      94:	83 ec 18             	sub    $0x18,%esp
+  int fd, i;
+
+  for(i = 0; i < SIZE; i++)
+      97:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      9e:	eb 33                	jmp    d3 <test+0x42>
+    buf[i] = 'a' + i % 23;
+      a0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      a3:	ba c9 42 16 b2       	mov    $0xb21642c9,%edx
+      a8:	89 c8                	mov    %ecx,%eax
+      aa:	f7 ea                	imul   %edx
+      ac:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+      af:	c1 f8 04             	sar    $0x4,%eax
+      b2:	89 ca                	mov    %ecx,%edx
+      b4:	c1 fa 1f             	sar    $0x1f,%edx
+      b7:	29 d0                	sub    %edx,%eax
+      b9:	6b d0 17             	imul   $0x17,%eax,%edx
+      bc:	89 c8                	mov    %ecx,%eax
+      be:	29 d0                	sub    %edx,%eax
+      c0:	83 c0 61             	add    $0x61,%eax
+      c3:	89 c2                	mov    %eax,%edx
+      c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      c8:	05 20 17 00 00       	add    $0x1720,%eax
+      cd:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+      cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      d3:	81 7d f4 ff ff 00 00 	cmpl   $0xffff,-0xc(%ebp)
+      da:	7e c4                	jle    a0 <test+0xf>
+  unlink(path);
+      dc:	83 ec 0c             	sub    $0xc,%esp
+      df:	ff 75 08             	push   0x8(%ebp)
+      e2:	e8 24 06 00 00       	call   70b <unlink>
+      e7:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+      ea:	83 ec 08             	sub    $0x8,%esp
+      ed:	68 02 02 00 00       	push   $0x202
+      f2:	ff 75 08             	push   0x8(%ebp)
+      f5:	e8 fd 05 00 00       	call   6f7 <open>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     100:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     104:	79 1a                	jns    120 <test+0x8f>
+    printf(1, "error: create %s\n", path);
+     106:	83 ec 04             	sub    $0x4,%esp
+     109:	ff 75 08             	push   0x8(%ebp)
+     10c:	68 ec 11 00 00       	push   $0x11ec
+     111:	6a 01                	push   $0x1
+     113:	e8 37 0a 00 00       	call   b4f <printf>
+     118:	83 c4 10             	add    $0x10,%esp
+    exit();
+     11b:	e8 9f 05 00 00       	call   6bf <exit>
+  }
+
+  // Reserved blocks do not change the size or the data.
+  if(write(fd, buf, 1000) != 1000 || fallocate(fd, 0, SIZE) < 0 ||
+     120:	83 ec 04             	sub    $0x4,%esp
+     123:	68 e8 03 00 00       	push   $0x3e8
+     128:	68 20 17 00 00       	push   $0x1720
+     12d:	ff 75 f0             	push   -0x10(%ebp)
+     130:	e8 a6 05 00 00       	call   6db <write>
+     135:	83 c4 10             	add    $0x10,%esp
+     138:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     13d:	75 62                	jne    1a1 <test+0x110>
+     13f:	83 ec 04             	sub    $0x4,%esp
+     142:	68 00 00 01 00       	push   $0x10000
+     147:	6a 00                	push   $0x0
+     149:	ff 75 f0             	push   -0x10(%ebp)
+     14c:	e8 4a 07 00 00       	call   89b <fallocate>
+     151:	83 c4 10             	add    $0x10,%esp
+     154:	85 c0                	test   %eax,%eax
+     156:	78 49                	js     1a1 <test+0x110>
+     size(fd) != 1000 || !check(fd, 0, 1000) || pread(fd, buf2, 1, 1000) != 0){
+     158:	83 ec 0c             	sub    $0xc,%esp
+     15b:	ff 75 f0             	push   -0x10(%ebp)
+     15e:	e8 06 ff ff ff       	call   69 <size>
+     163:	83 c4 10             	add    $0x10,%esp
+  if(write(fd, buf, 1000) != 1000 || fallocate(fd, 0, SIZE) < 0 ||
+     166:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     16b:	75 34                	jne    1a1 <test+0x110>
+     size(fd) != 1000 || !check(fd, 0, 1000) || pread(fd, buf2, 1, 1000) != 0){
+     16d:	83 ec 04             	sub    $0x4,%esp
+     170:	68 e8 03 00 00       	push   $0x3e8
+     175:	6a 00                	push   $0x0
+     177:	ff 75 f0             	push   -0x10(%ebp)
+     17a:	e8 81 fe ff ff       	call   0 <check>
+     17f:	83 c4 10             	add    $0x10,%esp
+     182:	85 c0                	test   %eax,%eax
+     184:	74 1b                	je     1a1 <test+0x110>
+     186:	68 e8 03 00 00       	push   $0x3e8
+     18b:	6a 01                	push   $0x1
+     18d:	68 20 17 01 00       	push   $0x11720
+     192:	ff 75 f0             	push   -0x10(%ebp)
+     195:	e8 39 06 00 00       	call   7d3 <pread>
+     19a:	83 c4 10             	add    $0x10,%esp
+     19d:	85 c0                	test   %eax,%eax
+     19f:	74 1a                	je     1bb <test+0x12a>
+    printf(1, "error: fallocate %s\n", path);
+     1a1:	83 ec 04             	sub    $0x4,%esp
+     1a4:	ff 75 08             	push   0x8(%ebp)
+     1a7:	68 fe 11 00 00       	push   $0x11fe
+     1ac:	6a 01                	push   $0x1
+     1ae:	e8 9c 09 00 00       	call   b4f <printf>
+     1b3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1b6:	e8 04 05 00 00       	call   6bf <exit>
+  }
+  if(write(fd, buf + 1000, SIZE - 1000) != SIZE - 1000 || size(fd) != SIZE ||
+     1bb:	b8 08 1b 00 00       	mov    $0x1b08,%eax
+     1c0:	83 ec 04             	sub    $0x4,%esp
+     1c3:	68 18 fc 00 00       	push   $0xfc18
+     1c8:	50                   	push   %eax
+     1c9:	ff 75 f0             	push   -0x10(%ebp)
+     1cc:	e8 0a 05 00 00       	call   6db <write>
+     1d1:	83 c4 10             	add    $0x10,%esp
+     1d4:	3d 18 fc 00 00       	cmp    $0xfc18,%eax
+     1d9:	75 2e                	jne    209 <test+0x178>
+     1db:	83 ec 0c             	sub    $0xc,%esp
+     1de:	ff 75 f0             	push   -0x10(%ebp)
+     1e1:	e8 83 fe ff ff       	call   69 <size>
+     1e6:	83 c4 10             	add    $0x10,%esp
+     1e9:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     1ee:	75 19                	jne    209 <test+0x178>
+     !check(fd, 0, SIZE)){
+     1f0:	83 ec 04             	sub    $0x4,%esp
+     1f3:	68 00 00 01 00       	push   $0x10000
+     1f8:	6a 00                	push   $0x0
+     1fa:	ff 75 f0             	push   -0x10(%ebp)
+     1fd:	e8 fe fd ff ff       	call   0 <check>
+     202:	83 c4 10             	add    $0x10,%esp
+  if(write(fd, buf + 1000, SIZE - 1000) != SIZE - 1000 || size(fd) != SIZE ||
+     205:	85 c0                	test   %eax,%eax
+     207:	75 1a                	jne    223 <test+0x192>
+    printf(1, "error: write into reserved blocks of %s\n", path);
+     209:	83 ec 04             	sub    $0x4,%esp
+     20c:	ff 75 08             	push   0x8(%ebp)
+     20f:	68 14 12 00 00       	push   $0x1214
+     214:	6a 01                	push   $0x1
+     216:	e8 34 09 00 00       	call   b4f <printf>
+     21b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     21e:	e8 9c 04 00 00       	call   6bf <exit>
+  }
+
+  // Truncating keeps the head; what is written after it is new.
+  if(ftruncate(fd, 5000) < 0 || size(fd) != 5000 || !check(fd, 0, 5000) ||
+     223:	83 ec 08             	sub    $0x8,%esp
+     226:	68 88 13 00 00       	push   $0x1388
+     22b:	ff 75 f0             	push   -0x10(%ebp)
+     22e:	e8 72 06 00 00       	call   8a5 <ftruncate>
+     233:	83 c4 10             	add    $0x10,%esp
+     236:	85 c0                	test   %eax,%eax
+     238:	78 4a                	js     284 <test+0x1f3>
+     23a:	83 ec 0c             	sub    $0xc,%esp
+     23d:	ff 75 f0             	push   -0x10(%ebp)
+     240:	e8 24 fe ff ff       	call   69 <size>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     24d:	75 35                	jne    284 <test+0x1f3>
+     24f:	83 ec 04             	sub    $0x4,%esp
+     252:	68 88 13 00 00       	push   $0x1388
+     257:	6a 00                	push   $0x0
+     259:	ff 75 f0             	push   -0x10(%ebp)
+     25c:	e8 9f fd ff ff       	call   0 <check>
+     261:	83 c4 10             	add    $0x10,%esp
+     264:	85 c0                	test   %eax,%eax
+     266:	74 1c                	je     284 <test+0x1f3>
+     pread(fd, buf2, 100, 4990) != 10){
+     268:	68 7e 13 00 00       	push   $0x137e
+     26d:	6a 64                	push   $0x64
+     26f:	68 20 17 01 00       	push   $0x11720
+     274:	ff 75 f0             	push   -0x10(%ebp)
+     277:	e8 57 05 00 00       	call   7d3 <pread>
+     27c:	83 c4 10             	add    $0x10,%esp
+  if(ftruncate(fd, 5000) < 0 || size(fd) != 5000 || !check(fd, 0, 5000) ||
+     27f:	83 f8 0a             	cmp    $0xa,%eax
+     282:	74 1a                	je     29e <test+0x20d>
+    printf(1, "error: ftruncate %s\n", path);
+     284:	83 ec 04             	sub    $0x4,%esp
+     287:	ff 75 08             	push   0x8(%ebp)
+     28a:	68 3d 12 00 00       	push   $0x123d
+     28f:	6a 01                	push   $0x1
+     291:	e8 b9 08 00 00       	call   b4f <printf>
+     296:	83 c4 10             	add    $0x10,%esp
+    exit();
+     299:	e8 21 04 00 00       	call   6bf <exit>
+  }
+  if(ftruncate(fd, 6000) >= 0){
+     29e:	83 ec 08             	sub    $0x8,%esp
+     2a1:	68 70 17 00 00       	push   $0x1770
+     2a6:	ff 75 f0             	push   -0x10(%ebp)
+     2a9:	e8 f7 05 00 00       	call   8a5 <ftruncate>
+     2ae:	83 c4 10             	add    $0x10,%esp
+     2b1:	85 c0                	test   %eax,%eax
+     2b3:	78 1a                	js     2cf <test+0x23e>
+    printf(1, "error: ftruncate %s grew it\n", path);
+     2b5:	83 ec 04             	sub    $0x4,%esp
+     2b8:	ff 75 08             	push   0x8(%ebp)
+     2bb:	68 52 12 00 00       	push   $0x1252
+     2c0:	6a 01                	push   $0x1
+     2c2:	e8 88 08 00 00       	call   b4f <printf>
+     2c7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2ca:	e8 f0 03 00 00       	call   6bf <exit>
+  }
+  buf[5000] = 'X';
+     2cf:	c6 05 a8 2a 00 00 58 	movb   $0x58,0x2aa8
+  if(fallocate(fd, 4000, 20000) < 0 || pwrite(fd, buf + 5000, 1, 5000) != 1 ||
+     2d6:	83 ec 04             	sub    $0x4,%esp
+     2d9:	68 20 4e 00 00       	push   $0x4e20
+     2de:	68 a0 0f 00 00       	push   $0xfa0
+     2e3:	ff 75 f0             	push   -0x10(%ebp)
+     2e6:	e8 b0 05 00 00       	call   89b <fallocate>
+     2eb:	83 c4 10             	add    $0x10,%esp
+     2ee:	85 c0                	test   %eax,%eax
+     2f0:	78 4b                	js     33d <test+0x2ac>
+     2f2:	b8 a8 2a 00 00       	mov    $0x2aa8,%eax
+     2f7:	68 88 13 00 00       	push   $0x1388
+     2fc:	6a 01                	push   $0x1
+     2fe:	50                   	push   %eax
+     2ff:	ff 75 f0             	push   -0x10(%ebp)
+     302:	e8 d6 04 00 00       	call   7dd <pwrite>
+     307:	83 c4 10             	add    $0x10,%esp
+     30a:	83 f8 01             	cmp    $0x1,%eax
+     30d:	75 2e                	jne    33d <test+0x2ac>
+     size(fd) != 5001 || !check(fd, 0, 5001)){
+     30f:	83 ec 0c             	sub    $0xc,%esp
+     312:	ff 75 f0             	push   -0x10(%ebp)
+     315:	e8 4f fd ff ff       	call   69 <size>
+     31a:	83 c4 10             	add    $0x10,%esp
+  if(fallocate(fd, 4000, 20000) < 0 || pwrite(fd, buf + 5000, 1, 5000) != 1 ||
+     31d:	3d 89 13 00 00       	cmp    $0x1389,%eax
+     322:	75 19                	jne    33d <test+0x2ac>
+     size(fd) != 5001 || !check(fd, 0, 5001)){
+     324:	83 ec 04             	sub    $0x4,%esp
+     327:	68 89 13 00 00       	push   $0x1389
+     32c:	6a 00                	push   $0x0
+     32e:	ff 75 f0             	push   -0x10(%ebp)
+     331:	e8 ca fc ff ff       	call   0 <check>
+     336:	83 c4 10             	add    $0x10,%esp
+     339:	85 c0                	test   %eax,%eax
+     33b:	75 1a                	jne    357 <test+0x2c6>
+    printf(1, "error: write after ftruncate %s\n", path);
+     33d:	83 ec 04             	sub    $0x4,%esp
+     340:	ff 75 08             	push   0x8(%ebp)
+     343:	68 70 12 00 00       	push   $0x1270
+     348:	6a 01                	push   $0x1
+     34a:	e8 00 08 00 00       	call   b4f <printf>
+     34f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     352:	e8 68 03 00 00       	call   6bf <exit>
+  }
+  if(ftruncate(fd, 0) < 0 || size(fd) != 0 || pread(fd, buf2, 1, 0) != 0){
+     357:	83 ec 08             	sub    $0x8,%esp
+     35a:	6a 00                	push   $0x0
+     35c:	ff 75 f0             	push   -0x10(%ebp)
+     35f:	e8 41 05 00 00       	call   8a5 <ftruncate>
+     364:	83 c4 10             	add    $0x10,%esp
+     367:	85 c0                	test   %eax,%eax
+     369:	78 2a                	js     395 <test+0x304>
+     36b:	83 ec 0c             	sub    $0xc,%esp
+     36e:	ff 75 f0             	push   -0x10(%ebp)
+     371:	e8 f3 fc ff ff       	call   69 <size>
+     376:	83 c4 10             	add    $0x10,%esp
+     379:	85 c0                	test   %eax,%eax
+     37b:	75 18                	jne    395 <test+0x304>
+     37d:	6a 00                	push   $0x0
+     37f:	6a 01                	push   $0x1
+     381:	68 20 17 01 00       	push   $0x11720
+     386:	ff 75 f0             	push   -0x10(%ebp)
+     389:	e8 45 04 00 00       	call   7d3 <pread>
+     38e:	83 c4 10             	add    $0x10,%esp
+     391:	85 c0                	test   %eax,%eax
+     393:	74 1a                	je     3af <test+0x31e>
+    printf(1, "error: ftruncate %s to 0\n", path);
+     395:	83 ec 04             	sub    $0x4,%esp
+     398:	ff 75 08             	push   0x8(%ebp)
+     39b:	68 91 12 00 00       	push   $0x1291
+     3a0:	6a 01                	push   $0x1
+     3a2:	e8 a8 07 00 00       	call   b4f <printf>
+     3a7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3aa:	e8 10 03 00 00       	call   6bf <exit>
+  }
+  close(fd);
+     3af:	83 ec 0c             	sub    $0xc,%esp
+     3b2:	ff 75 f0             	push   -0x10(%ebp)
+     3b5:	e8 28 03 00 00       	call   6e2 <close>
+     3ba:	83 c4 10             	add    $0x10,%esp
+  unlink(path);
+     3bd:	83 ec 0c             	sub    $0xc,%esp
+     3c0:	ff 75 08             	push   0x8(%ebp)
+     3c3:	e8 43 03 00 00       	call   70b <unlink>
+     3c8:	83 c4 10             	add    $0x10,%esp
+}
+     3cb:	90                   	nop
+     3cc:	c9                   	leave
+     3cd:	c3                   	ret
+
+000003ce <main>:
+
+int
+main(int argc, char *argv[])
+{
+     3ce:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     3d2:	83 e4 f0             	and    $0xfffffff0,%esp
+     3d5:	ff 71 fc             	push   -0x4(%ecx)
+     3d8:	55                   	push   %ebp
+     3d9:	89 e5                	mov    %esp,%ebp
+     3db:	51                   	push   %ecx
+     3dc:	83 ec 04             	sub    $0x4,%esp
+  test("/falloc");
+     3df:	83 ec 0c             	sub    $0xc,%esp
+     3e2:	68 ab 12 00 00       	push   $0x12ab
+     3e7:	e8 a5 fc ff ff       	call   91 <test>
+     3ec:	83 c4 10             	add    $0x10,%esp
+  printf(1, "fallocate and ftruncate ok\n");
+     3ef:	83 ec 08             	sub    $0x8,%esp
+     3f2:	68 b3 12 00 00       	push   $0x12b3
+     3f7:	6a 01                	push   $0x1
+     3f9:	e8 51 07 00 00       	call   b4f <printf>
+     3fe:	83 c4 10             	add    $0x10,%esp
+  test("/tmp/falloc");
+     401:	83 ec 0c             	sub    $0xc,%esp
+     404:	68 cf 12 00 00       	push   $0x12cf
+     409:	e8 83 fc ff ff       	call   91 <test>
+     40e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "tmpfs fallocate and ftruncate ok\n");
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	68 dc 12 00 00       	push   $0x12dc
+     419:	6a 01                	push   $0x1
+     41b:	e8 2f 07 00 00       	call   b4f <printf>
+     420:	83 c4 10             	add    $0x10,%esp
+  exit();
+     423:	e8 97 02 00 00       	call   6bf <exit>
+
+00000428 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     428:	55                   	push   %ebp
+     429:	89 e5                	mov    %esp,%ebp
+     42b:	57                   	push   %edi
+     42c:	53                   	push   %ebx
+    if(cc < 1)
+     42d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     430:	8b 55 10             	mov    0x10(%ebp),%edx
+     433:	8b 45 0c             	mov    0xc(%ebp),%eax
+     436:	89 cb                	mov    %ecx,%ebx
+     438:	89 df                	mov    %ebx,%edi
+     43a:	89 d1                	mov    %edx,%ecx
+     43c:	fc                   	cld
+     43d:	f3 aa                	rep stos %al,%es:(%edi)
+     43f:	89 ca                	mov    %ecx,%edx
+     441:	89 fb                	mov    %edi,%ebx
+     443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     446:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     449:	90                   	nop
+     44a:	5b                   	pop    %ebx
+     44b:	5f                   	pop    %edi
+     44c:	5d                   	pop    %ebp
+     44d:	c3                   	ret
+
+0000044e <strcpy>:
+{
+     44e:	55                   	push   %ebp
+     44f:	89 e5                	mov    %esp,%ebp
+     451:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     454:	8b 45 08             	mov    0x8(%ebp),%eax
+     457:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     45a:	90                   	nop
+     45b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     45e:	8d 42 01             	lea    0x1(%edx),%eax
+     461:	89 45 0c             	mov    %eax,0xc(%ebp)
+     464:	8b 45 08             	mov    0x8(%ebp),%eax
+     467:	8d 48 01             	lea    0x1(%eax),%ecx
+     46a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     46d:	0f b6 12             	movzbl (%edx),%edx
+     470:	88 10                	mov    %dl,(%eax)
+     472:	0f b6 00             	movzbl (%eax),%eax
+     475:	84 c0                	test   %al,%al
+     477:	75 e2                	jne    45b <strcpy+0xd>
+  return os;
+     479:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     47c:	c9                   	leave
+     47d:	c3                   	ret
+
+0000047e <strcmp>:
+{
+     47e:	55                   	push   %ebp
+     47f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     481:	eb 08                	jmp    48b <strcmp+0xd>
+    p++, q++;
+     483:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     487:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     48b:	8b 45 08             	mov    0x8(%ebp),%eax
+     48e:	0f b6 00             	movzbl (%eax),%eax
+     491:	84 c0                	test   %al,%al
+     493:	74 10                	je     4a5 <strcmp+0x27>
+     495:	8b 45 08             	mov    0x8(%ebp),%eax
+     498:	0f b6 10             	movzbl (%eax),%edx
+     49b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     49e:	0f b6 00             	movzbl (%eax),%eax
+     4a1:	38 c2                	cmp    %al,%dl
+     4a3:	74 de                	je     483 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     4a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a8:	0f b6 00             	movzbl (%eax),%eax
+     4ab:	0f b6 d0             	movzbl %al,%edx
+     4ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4b1:	0f b6 00             	movzbl (%eax),%eax
+     4b4:	0f b6 c0             	movzbl %al,%eax
+     4b7:	29 c2                	sub    %eax,%edx
+     4b9:	89 d0                	mov    %edx,%eax
+}
+     4bb:	5d                   	pop    %ebp
+     4bc:	c3                   	ret
+
+000004bd <strlen>:
+{
+     4bd:	55                   	push   %ebp
+     4be:	89 e5                	mov    %esp,%ebp
+     4c0:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     4c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     4ca:	eb 04                	jmp    4d0 <strlen+0x13>
+     4cc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     4d0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d6:	01 d0                	add    %edx,%eax
+     4d8:	0f b6 00             	movzbl (%eax),%eax
+     4db:	84 c0                	test   %al,%al
+     4dd:	75 ed                	jne    4cc <strlen+0xf>
+  return n;
+     4df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4e2:	c9                   	leave
+     4e3:	c3                   	ret
+
+000004e4 <memset>:
+{
+     4e4:	55                   	push   %ebp
+     4e5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     4e7:	8b 45 10             	mov    0x10(%ebp),%eax
+     4ea:	50                   	push   %eax
+     4eb:	ff 75 0c             	push   0xc(%ebp)
+     4ee:	ff 75 08             	push   0x8(%ebp)
+     4f1:	e8 32 ff ff ff       	call   428 <stosb>
+     4f6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     4f9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4fc:	c9                   	leave
+     4fd:	c3                   	ret
+
+000004fe <strchr>:
+{
+     4fe:	55                   	push   %ebp
+     4ff:	89 e5                	mov    %esp,%ebp
+     501:	83 ec 04             	sub    $0x4,%esp
+     504:	8b 45 0c             	mov    0xc(%ebp),%eax
+     507:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     50a:	eb 14                	jmp    520 <strchr+0x22>
+    if(*s == c)
+     50c:	8b 45 08             	mov    0x8(%ebp),%eax
+     50f:	0f b6 00             	movzbl (%eax),%eax
+     512:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     515:	75 05                	jne    51c <strchr+0x1e>
+      return (char*)s;
+     517:	8b 45 08             	mov    0x8(%ebp),%eax
+     51a:	eb 13                	jmp    52f <strchr+0x31>
+  for(; *s; s++)
+     51c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     520:	8b 45 08             	mov    0x8(%ebp),%eax
+     523:	0f b6 00             	movzbl (%eax),%eax
+     526:	84 c0                	test   %al,%al
+     528:	75 e2                	jne    50c <strchr+0xe>
+  return 0;
+     52a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     52f:	c9                   	leave
+     530:	c3                   	ret
+
+00000531 <gets>:
+{
+     531:	55                   	push   %ebp
+     532:	89 e5                	mov    %esp,%ebp
+     534:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     537:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     53e:	eb 42                	jmp    582 <gets+0x51>
+    cc = read(0, &c, 1);
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	6a 01                	push   $0x1
+     545:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     548:	50                   	push   %eax
+     549:	6a 00                	push   $0x0
+     54b:	e8 84 01 00 00       	call   6d4 <read>
+     550:	83 c4 10             	add    $0x10,%esp
+     553:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     556:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     55a:	7e 33                	jle    58f <gets+0x5e>
+    buf[i++] = c;
+     55c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     55f:	8d 50 01             	lea    0x1(%eax),%edx
+     562:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     565:	89 c2                	mov    %eax,%edx
+     567:	8b 45 08             	mov    0x8(%ebp),%eax
+     56a:	01 c2                	add    %eax,%edx
+     56c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     570:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     572:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     576:	3c 0a                	cmp    $0xa,%al
+     578:	74 16                	je     590 <gets+0x5f>
+     57a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     57e:	3c 0d                	cmp    $0xd,%al
+     580:	74 0e                	je     590 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     582:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     585:	83 c0 01             	add    $0x1,%eax
+     588:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     58b:	7f b3                	jg     540 <gets+0xf>
+     58d:	eb 01                	jmp    590 <gets+0x5f>
+      break;
+     58f:	90                   	nop
+  }
+  buf[i] = '\0';
+     590:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     593:	8b 45 08             	mov    0x8(%ebp),%eax
+     596:	01 d0                	add    %edx,%eax
+     598:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     59b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     59e:	c9                   	leave
+     59f:	c3                   	ret
+
+000005a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     5a6:	83 ec 08             	sub    $0x8,%esp
+     5a9:	6a 00                	push   $0x0
+     5ab:	ff 75 08             	push   0x8(%ebp)
+     5ae:	e8 44 01 00 00       	call   6f7 <open>
+     5b3:	83 c4 10             	add    $0x10,%esp
+     5b6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     5b9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5bd:	79 07                	jns    5c6 <stat+0x26>
+    return -1;
+     5bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5c4:	eb 25                	jmp    5eb <stat+0x4b>
+  r = fstat(fd, st);
+     5c6:	83 ec 08             	sub    $0x8,%esp
+     5c9:	ff 75 0c             	push   0xc(%ebp)
+     5cc:	ff 75 f4             	push   -0xc(%ebp)
+     5cf:	e8 41 01 00 00       	call   715 <fstat>
+     5d4:	83 c4 10             	add    $0x10,%esp
+     5d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     5da:	83 ec 0c             	sub    $0xc,%esp
+     5dd:	ff 75 f4             	push   -0xc(%ebp)
+     5e0:	e8 fd 00 00 00       	call   6e2 <close>
+     5e5:	83 c4 10             	add    $0x10,%esp
+  return r;
+     5e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     5eb:	c9                   	leave
+     5ec:	c3                   	ret
+
+000005ed <atoi>:
+
+int
+atoi(const char *s)
+{
+     5ed:	55                   	push   %ebp
+     5ee:	89 e5                	mov    %esp,%ebp
+     5f0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     5f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5fa:	eb 25                	jmp    621 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     5fc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5ff:	89 d0                	mov    %edx,%eax
+     601:	c1 e0 02             	shl    $0x2,%eax
+     604:	01 d0                	add    %edx,%eax
+     606:	01 c0                	add    %eax,%eax
+     608:	89 c1                	mov    %eax,%ecx
+     60a:	8b 45 08             	mov    0x8(%ebp),%eax
+     60d:	8d 50 01             	lea    0x1(%eax),%edx
+     610:	89 55 08             	mov    %edx,0x8(%ebp)
+     613:	0f b6 00             	movzbl (%eax),%eax
+     616:	0f be c0             	movsbl %al,%eax
+     619:	01 c8                	add    %ecx,%eax
+     61b:	83 e8 30             	sub    $0x30,%eax
+     61e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     621:	8b 45 08             	mov    0x8(%ebp),%eax
+     624:	0f b6 00             	movzbl (%eax),%eax
+     627:	3c 2f                	cmp    $0x2f,%al
+     629:	7e 0a                	jle    635 <atoi+0x48>
+     62b:	8b 45 08             	mov    0x8(%ebp),%eax
+     62e:	0f b6 00             	movzbl (%eax),%eax
+     631:	3c 39                	cmp    $0x39,%al
+     633:	7e c7                	jle    5fc <atoi+0xf>
+  return n;
+     635:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     638:	c9                   	leave
+     639:	c3                   	ret
+
+0000063a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     63a:	55                   	push   %ebp
+     63b:	89 e5                	mov    %esp,%ebp
+     63d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     640:	8b 45 08             	mov    0x8(%ebp),%eax
+     643:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     646:	8b 45 0c             	mov    0xc(%ebp),%eax
+     649:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     64c:	eb 17                	jmp    665 <memmove+0x2b>
+    *dst++ = *src++;
+     64e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     651:	8d 42 01             	lea    0x1(%edx),%eax
+     654:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     657:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     65a:	8d 48 01             	lea    0x1(%eax),%ecx
+     65d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     660:	0f b6 12             	movzbl (%edx),%edx
+     663:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     665:	8b 45 10             	mov    0x10(%ebp),%eax
+     668:	8d 50 ff             	lea    -0x1(%eax),%edx
+     66b:	89 55 10             	mov    %edx,0x10(%ebp)
+     66e:	85 c0                	test   %eax,%eax
+     670:	7f dc                	jg     64e <memmove+0x14>
+  return vdst;
+     672:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     675:	c9                   	leave
+     676:	c3                   	ret
+
+00000677 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     677:	83 3d ec 16 00 00 00 	cmpl   $0x0,0x16ec
+  jg 2f
+     67e:	7f 2e                	jg     6ae <dosyscall+0x37>
+  jl 1f
+     680:	7c 29                	jl     6ab <dosyscall+0x34>
+  pushl %eax
+     682:	50                   	push   %eax
+  pushl %ebx
+     683:	53                   	push   %ebx
+  movl $1, %eax
+     684:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     689:	0f a2                	cpuid
+  popl %ebx
+     68b:	5b                   	pop    %ebx
+  popl %eax
+     68c:	58                   	pop    %eax
+  movl $-1, sysmode
+     68d:	c7 05 ec 16 00 00 ff 	movl   $0xffffffff,0x16ec
+     694:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     697:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     69d:	74 0c                	je     6ab <dosyscall+0x34>
+  movl $1, sysmode
+     69f:	c7 05 ec 16 00 00 01 	movl   $0x1,0x16ec
+     6a6:	00 00 00 
+  jmp 2f
+     6a9:	eb 03                	jmp    6ae <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     6ab:	cd 40                	int    $0x40
+  ret
+     6ad:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     6ae:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     6b0:	ba b7 06 00 00       	mov    $0x6b7,%edx
+  sysenter
+     6b5:	0f 34                	sysenter
+3:
+  ret
+     6b7:	c3                   	ret
+
+000006b8 <fork>:
+
+SYSCALL(fork)
+     6b8:	b8 01 00 00 00       	mov    $0x1,%eax
+     6bd:	eb b8                	jmp    677 <dosyscall>
+
+000006bf <exit>:
+SYSCALL(exit)
+     6bf:	b8 02 00 00 00       	mov    $0x2,%eax
+     6c4:	eb b1                	jmp    677 <dosyscall>
+
+000006c6 <wait>:
+SYSCALL(wait)
+     6c6:	b8 03 00 00 00       	mov    $0x3,%eax
+     6cb:	eb aa                	jmp    677 <dosyscall>
+
+000006cd <pipe>:
+SYSCALL(pipe)
+     6cd:	b8 04 00 00 00       	mov    $0x4,%eax
+     6d2:	eb a3                	jmp    677 <dosyscall>
+
+000006d4 <read>:
+SYSCALL(read)
+     6d4:	b8 05 00 00 00       	mov    $0x5,%eax
+     6d9:	eb 9c                	jmp    677 <dosyscall>
+
+000006db <write>:
+SYSCALL(write)
+     6db:	b8 10 00 00 00       	mov    $0x10,%eax
+     6e0:	eb 95                	jmp    677 <dosyscall>
+
+000006e2 <close>:
+SYSCALL(close)
+     6e2:	b8 15 00 00 00       	mov    $0x15,%eax
+     6e7:	eb 8e                	jmp    677 <dosyscall>
+
+000006e9 <kill>:
+SYSCALL(kill)
+     6e9:	b8 06 00 00 00       	mov    $0x6,%eax
+     6ee:	eb 87                	jmp    677 <dosyscall>
+
+000006f0 <exec>:
+SYSCALL(exec)
+     6f0:	b8 07 00 00 00       	mov    $0x7,%eax
+     6f5:	eb 80                	jmp    677 <dosyscall>
+
+000006f7 <open>:
+SYSCALL(open)
+     6f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6fc:	e9 76 ff ff ff       	jmp    677 <dosyscall>
+
+00000701 <mknod>:
+SYSCALL(mknod)
+     701:	b8 11 00 00 00       	mov    $0x11,%eax
+     706:	e9 6c ff ff ff       	jmp    677 <dosyscall>
+
+0000070b <unlink>:
+SYSCALL(unlink)
+     70b:	b8 12 00 00 00       	mov    $0x12,%eax
+     710:	e9 62 ff ff ff       	jmp    677 <dosyscall>
+
+00000715 <fstat>:
+SYSCALL(fstat)
+     715:	b8 08 00 00 00       	mov    $0x8,%eax
+     71a:	e9 58 ff ff ff       	jmp    677 <dosyscall>
+
+0000071f <link>:
+SYSCALL(link)
+     71f:	b8 13 00 00 00       	mov    $0x13,%eax
+     724:	e9 4e ff ff ff       	jmp    677 <dosyscall>
+
+00000729 <mkdir>:
+SYSCALL(mkdir)
+     729:	b8 14 00 00 00       	mov    $0x14,%eax
+     72e:	e9 44 ff ff ff       	jmp    677 <dosyscall>
+
+00000733 <chdir>:
+SYSCALL(chdir)
+     733:	b8 09 00 00 00       	mov    $0x9,%eax
+     738:	e9 3a ff ff ff       	jmp    677 <dosyscall>
+
+0000073d <dup>:
+SYSCALL(dup)
+     73d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     742:	e9 30 ff ff ff       	jmp    677 <dosyscall>
+
+00000747 <getpid>:
+SYSCALL(getpid)
+     747:	b8 0b 00 00 00       	mov    $0xb,%eax
+     74c:	e9 26 ff ff ff       	jmp    677 <dosyscall>
+
+00000751 <sbrk>:
+SYSCALL(sbrk)
+     751:	b8 0c 00 00 00       	mov    $0xc,%eax
+     756:	e9 1c ff ff ff       	jmp    677 <dosyscall>
+
+0000075b <sleep>:
+SYSCALL(sleep)
+     75b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     760:	e9 12 ff ff ff       	jmp    677 <dosyscall>
+
+00000765 <uptime>:
+SYSCALL(uptime)
+     765:	b8 0e 00 00 00       	mov    $0xe,%eax
+     76a:	e9 08 ff ff ff       	jmp    677 <dosyscall>
+
+0000076f <symlink>:
+SYSCALL(symlink)
+     76f:	b8 16 00 00 00       	mov    $0x16,%eax
+     774:	e9 fe fe ff ff       	jmp    677 <dosyscall>
+
+00000779 <readlink>:
+SYSCALL(readlink)
+     779:	b8 17 00 00 00       	mov    $0x17,%eax
+     77e:	e9 f4 fe ff ff       	jmp    677 <dosyscall>
+
+00000783 <fprot>:
+SYSCALL(fprot)
+     783:	b8 18 00 00 00       	mov    $0x18,%eax
+     788:	e9 ea fe ff ff       	jmp    677 <dosyscall>
+
+0000078d <funprot>:
+SYSCALL(funprot)
+     78d:	b8 19 00 00 00       	mov    $0x19,%eax
+     792:	e9 e0 fe ff ff       	jmp    677 <dosyscall>
+
+00000797 <funlock>:
+SYSCALL(funlock)
+     797:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     79c:	e9 d6 fe ff ff       	jmp    677 <dosyscall>
+
+000007a1 <mmap>:
+SYSCALL(mmap)
+     7a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7a6:	e9 cc fe ff ff       	jmp    677 <dosyscall>
+
+000007ab <munmap>:
+SYSCALL(munmap)
+     7ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7b0:	e9 c2 fe ff ff       	jmp    677 <dosyscall>
+
+000007b5 <sendfile>:
+SYSCALL(sendfile)
+     7b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7ba:	e9 b8 fe ff ff       	jmp    677 <dosyscall>
+
+000007bf <readv>:
+SYSCALL(readv)
+     7bf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7c4:	e9 ae fe ff ff       	jmp    677 <dosyscall>
+
+000007c9 <writev>:
+SYSCALL(writev)
+     7c9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7ce:	e9 a4 fe ff ff       	jmp    677 <dosyscall>
+
+000007d3 <pread>:
+SYSCALL(pread)
+     7d3:	b8 20 00 00 00       	mov    $0x20,%eax
+     7d8:	e9 9a fe ff ff       	jmp    677 <dosyscall>
+
+000007dd <pwrite>:
+SYSCALL(pwrite)
+     7dd:	b8 21 00 00 00       	mov    $0x21,%eax
+     7e2:	e9 90 fe ff ff       	jmp    677 <dosyscall>
+
+000007e7 <lseek>:
+SYSCALL(lseek)
+     7e7:	b8 22 00 00 00       	mov    $0x22,%eax
+     7ec:	e9 86 fe ff ff       	jmp    677 <dosyscall>
+
+000007f1 <spawn>:
+SYSCALL(spawn)
+     7f1:	b8 23 00 00 00       	mov    $0x23,%eax
+     7f6:	e9 7c fe ff ff       	jmp    677 <dosyscall>
+
+000007fb <setpriority>:
+SYSCALL(setpriority)
+     7fb:	b8 24 00 00 00       	mov    $0x24,%eax
+     800:	e9 72 fe ff ff       	jmp    677 <dosyscall>
+
+00000805 <kthread_create>:
+SYSCALL(kthread_create)
+     805:	b8 25 00 00 00       	mov    $0x25,%eax
+     80a:	e9 68 fe ff ff       	jmp    677 <dosyscall>
+
+0000080f <kthread_id>:
+SYSCALL(kthread_id)
+     80f:	b8 26 00 00 00       	mov    $0x26,%eax
+     814:	e9 5e fe ff ff       	jmp    677 <dosyscall>
+
+00000819 <kthread_exit>:
+SYSCALL(kthread_exit)
+     819:	b8 27 00 00 00       	mov    $0x27,%eax
+     81e:	e9 54 fe ff ff       	jmp    677 <dosyscall>
+
+00000823 <kthread_join>:
+SYSCALL(kthread_join)
+     823:	b8 28 00 00 00       	mov    $0x28,%eax
+     828:	e9 4a fe ff ff       	jmp    677 <dosyscall>
+
+0000082d <futex>:
+SYSCALL(futex)
+     82d:	b8 29 00 00 00       	mov    $0x29,%eax
+     832:	e9 40 fe ff ff       	jmp    677 <dosyscall>
+
+00000837 <signal>:
+SYSCALL(signal)
+     837:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     83c:	e9 36 fe ff ff       	jmp    677 <dosyscall>
+
+00000841 <alarm>:
+SYSCALL(alarm)
+     841:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     846:	e9 2c fe ff ff       	jmp    677 <dosyscall>
+
+0000084b <usleep>:
+SYSCALL(usleep)
+     84b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     850:	e9 22 fe ff ff       	jmp    677 <dosyscall>
+
+00000855 <ioring_setup>:
+SYSCALL(ioring_setup)
+     855:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     85a:	e9 18 fe ff ff       	jmp    677 <dosyscall>
+
+0000085f <ioring_enter>:
+SYSCALL(ioring_enter)
+     85f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     864:	e9 0e fe ff ff       	jmp    677 <dosyscall>
+
+00000869 <getrusage>:
+SYSCALL(getrusage)
+     869:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     86e:	e9 04 fe ff ff       	jmp    677 <dosyscall>
+
+00000873 <mount>:
+SYSCALL(mount)
+     873:	b8 30 00 00 00       	mov    $0x30,%eax
+     878:	e9 fa fd ff ff       	jmp    677 <dosyscall>
+
+0000087d <getdents>:
+SYSCALL(getdents)
+     87d:	b8 31 00 00 00       	mov    $0x31,%eax
+     882:	e9 f0 fd ff ff       	jmp    677 <dosyscall>
+
+00000887 <yield>:
+SYSCALL(yield)
+     887:	b8 32 00 00 00       	mov    $0x32,%eax
+     88c:	e9 e6 fd ff ff       	jmp    677 <dosyscall>
+
+00000891 <ncpu>:
+SYSCALL(ncpu)
+     891:	b8 33 00 00 00       	mov    $0x33,%eax
+     896:	e9 dc fd ff ff       	jmp    677 <dosyscall>
+
+0000089b <fallocate>:
+SYSCALL(fallocate)
+     89b:	b8 34 00 00 00       	mov    $0x34,%eax
+     8a0:	e9 d2 fd ff ff       	jmp    677 <dosyscall>
+
+000008a5 <ftruncate>:
+SYSCALL(ftruncate)
+     8a5:	b8 35 00 00 00       	mov    $0x35,%eax
+     8aa:	e9 c8 fd ff ff       	jmp    677 <dosyscall>
+
+000008af <fsync>:
+SYSCALL(fsync)
+     8af:	b8 36 00 00 00       	mov    $0x36,%eax
+     8b4:	e9 be fd ff ff       	jmp    677 <dosyscall>
+
+000008b9 <fdatasync>:
+SYSCALL(fdatasync)
+     8b9:	b8 37 00 00 00       	mov    $0x37,%eax
+     8be:	e9 b4 fd ff ff       	jmp    677 <dosyscall>
+
+000008c3 <poll>:
+SYSCALL(poll)
+     8c3:	b8 38 00 00 00       	mov    $0x38,%eax
+     8c8:	e9 aa fd ff ff       	jmp    677 <dosyscall>
+
+000008cd <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     8cd:	55                   	push   %ebp
+     8ce:	89 e5                	mov    %esp,%ebp
+     8d0:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     8d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8d6:	8b 40 04             	mov    0x4(%eax),%eax
+     8d9:	85 c0                	test   %eax,%eax
+     8db:	7e 1f                	jle    8fc <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     8dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e0:	8b 50 04             	mov    0x4(%eax),%edx
+     8e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e6:	8d 48 08             	lea    0x8(%eax),%ecx
+     8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ec:	8b 00                	mov    (%eax),%eax
+     8ee:	83 ec 04             	sub    $0x4,%esp
+     8f1:	52                   	push   %edx
+     8f2:	51                   	push   %ecx
+     8f3:	50                   	push   %eax
+     8f4:	e8 d0 fe ff ff       	call   7c9 <writev>
+     8f9:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     8fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ff:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     906:	8b 45 08             	mov    0x8(%ebp),%eax
+     909:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     910:	00 00 00 
+}
+     913:	90                   	nop
+     914:	c9                   	leave
+     915:	c3                   	ret
+
+00000916 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     916:	55                   	push   %ebp
+     917:	89 e5                	mov    %esp,%ebp
+     919:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     91c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     920:	0f 84 94 00 00 00    	je     9ba <put+0xa4>
+    return;
+  if(o->n > 0){
+     926:	8b 45 08             	mov    0x8(%ebp),%eax
+     929:	8b 40 04             	mov    0x4(%eax),%eax
+     92c:	85 c0                	test   %eax,%eax
+     92e:	7e 40                	jle    970 <put+0x5a>
+    v = &o->iov[o->n-1];
+     930:	8b 45 08             	mov    0x8(%ebp),%eax
+     933:	8b 40 04             	mov    0x4(%eax),%eax
+     936:	83 e8 01             	sub    $0x1,%eax
+     939:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     940:	8b 45 08             	mov    0x8(%ebp),%eax
+     943:	01 d0                	add    %edx,%eax
+     945:	83 c0 08             	add    $0x8,%eax
+     948:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     94b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     94e:	8b 10                	mov    (%eax),%edx
+     950:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     953:	8b 40 04             	mov    0x4(%eax),%eax
+     956:	01 d0                	add    %edx,%eax
+     958:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     95b:	75 13                	jne    970 <put+0x5a>
+      v->iov_len += n;
+     95d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     960:	8b 50 04             	mov    0x4(%eax),%edx
+     963:	8b 45 10             	mov    0x10(%ebp),%eax
+     966:	01 c2                	add    %eax,%edx
+     968:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     96b:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     96e:	eb 4b                	jmp    9bb <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     970:	8b 45 08             	mov    0x8(%ebp),%eax
+     973:	8b 40 04             	mov    0x4(%eax),%eax
+     976:	83 f8 10             	cmp    $0x10,%eax
+     979:	75 0e                	jne    989 <put+0x73>
+    flush(o);
+     97b:	83 ec 0c             	sub    $0xc,%esp
+     97e:	ff 75 08             	push   0x8(%ebp)
+     981:	e8 47 ff ff ff       	call   8cd <flush>
+     986:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     989:	8b 45 08             	mov    0x8(%ebp),%eax
+     98c:	8b 50 04             	mov    0x4(%eax),%edx
+     98f:	8b 45 08             	mov    0x8(%ebp),%eax
+     992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     995:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     999:	8b 45 08             	mov    0x8(%ebp),%eax
+     99c:	8b 50 04             	mov    0x4(%eax),%edx
+     99f:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9a5:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ac:	8b 40 04             	mov    0x4(%eax),%eax
+     9af:	8d 50 01             	lea    0x1(%eax),%edx
+     9b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9b5:	89 50 04             	mov    %edx,0x4(%eax)
+     9b8:	eb 01                	jmp    9bb <put+0xa5>
+    return;
+     9ba:	90                   	nop
+}
+     9bb:	c9                   	leave
+     9bc:	c3                   	ret
+
+000009bd <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     9bd:	55                   	push   %ebp
+     9be:	89 e5                	mov    %esp,%ebp
+     9c0:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c6:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     9cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9cf:	01 d0                	add    %edx,%eax
+     9d1:	3d 80 00 00 00       	cmp    $0x80,%eax
+     9d6:	77 0b                	ja     9e3 <room+0x26>
+     9d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9db:	8b 40 04             	mov    0x4(%eax),%eax
+     9de:	83 f8 10             	cmp    $0x10,%eax
+     9e1:	75 0e                	jne    9f1 <room+0x34>
+    flush(o);
+     9e3:	83 ec 0c             	sub    $0xc,%esp
+     9e6:	ff 75 08             	push   0x8(%ebp)
+     9e9:	e8 df fe ff ff       	call   8cd <flush>
+     9ee:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     9f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f4:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     9fa:	8b 45 08             	mov    0x8(%ebp),%eax
+     9fd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     a03:	01 d0                	add    %edx,%eax
+}
+     a05:	c9                   	leave
+     a06:	c3                   	ret
+
+00000a07 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     a07:	55                   	push   %ebp
+     a08:	89 e5                	mov    %esp,%ebp
+     a0a:	83 ec 28             	sub    $0x28,%esp
+     a0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a10:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     a13:	83 ec 08             	sub    $0x8,%esp
+     a16:	6a 01                	push   $0x1
+     a18:	ff 75 08             	push   0x8(%ebp)
+     a1b:	e8 9d ff ff ff       	call   9bd <room>
+     a20:	83 c4 10             	add    $0x10,%esp
+     a23:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     a26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a29:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     a2d:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+     a32:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     a38:	8d 50 01             	lea    0x1(%eax),%edx
+     a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     a44:	83 ec 04             	sub    $0x4,%esp
+     a47:	6a 01                	push   $0x1
+     a49:	ff 75 f4             	push   -0xc(%ebp)
+     a4c:	ff 75 08             	push   0x8(%ebp)
+     a4f:	e8 c2 fe ff ff       	call   916 <put>
+     a54:	83 c4 10             	add    $0x10,%esp
+}
+     a57:	90                   	nop
+     a58:	c9                   	leave
+     a59:	c3                   	ret
+
+00000a5a <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     a5a:	55                   	push   %ebp
+     a5b:	89 e5                	mov    %esp,%ebp
+     a5d:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     a60:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     a67:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     a6b:	74 17                	je     a84 <printint+0x2a>
+     a6d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     a71:	79 11                	jns    a84 <printint+0x2a>
+    neg = 1;
+     a73:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     a7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a7d:	f7 d8                	neg    %eax
+     a7f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a82:	eb 06                	jmp    a8a <printint+0x30>
+  } else {
+    x = xx;
+     a84:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a87:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     a8a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a94:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a97:	ba 00 00 00 00       	mov    $0x0,%edx
+     a9c:	f7 f1                	div    %ecx
+     a9e:	89 d1                	mov    %edx,%ecx
+     aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     aa3:	8d 50 01             	lea    0x1(%eax),%edx
+     aa6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     aa9:	0f b6 91 f0 16 00 00 	movzbl 0x16f0(%ecx),%edx
+     ab0:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     ab4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ab7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     aba:	ba 00 00 00 00       	mov    $0x0,%edx
+     abf:	f7 f1                	div    %ecx
+     ac1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     ac4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     ac8:	75 c7                	jne    a91 <printint+0x37>
+  if(neg)
+     aca:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ace:	74 0e                	je     ade <printint+0x84>
+    buf[i++] = '-';
+     ad0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad3:	8d 50 01             	lea    0x1(%eax),%edx
+     ad6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ad9:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ae1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     ae4:	83 ec 08             	sub    $0x8,%esp
+     ae7:	ff 75 e8             	push   -0x18(%ebp)
+     aea:	ff 75 08             	push   0x8(%ebp)
+     aed:	e8 cb fe ff ff       	call   9bd <room>
+     af2:	83 c4 10             	add    $0x10,%esp
+     af5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     af8:	eb 1d                	jmp    b17 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     afa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     afd:	83 e8 01             	sub    $0x1,%eax
+     b00:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     b03:	89 c2                	mov    %eax,%edx
+     b05:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b08:	01 c2                	add    %eax,%edx
+     b0a:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b10:	01 c8                	add    %ecx,%eax
+     b12:	0f b6 00             	movzbl (%eax),%eax
+     b15:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     b17:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     b1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b1f:	79 d9                	jns    afa <printint+0xa0>
+  o->used += n;
+     b21:	8b 45 08             	mov    0x8(%ebp),%eax
+     b24:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     b2a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b2d:	01 c2                	add    %eax,%edx
+     b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b32:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     b38:	83 ec 04             	sub    $0x4,%esp
+     b3b:	ff 75 e8             	push   -0x18(%ebp)
+     b3e:	ff 75 e4             	push   -0x1c(%ebp)
+     b41:	ff 75 08             	push   0x8(%ebp)
+     b44:	e8 cd fd ff ff       	call   916 <put>
+     b49:	83 c4 10             	add    $0x10,%esp
+}
+     b4c:	90                   	nop
+     b4d:	c9                   	leave
+     b4e:	c3                   	ret
+
+00000b4f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b4f:	55                   	push   %ebp
+     b50:	89 e5                	mov    %esp,%ebp
+     b52:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     b58:	8b 45 08             	mov    0x8(%ebp),%eax
+     b5b:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     b61:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     b68:	00 00 00 
+  o.used = 0;
+     b6b:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     b72:	00 00 00 
+  state = 0;
+     b75:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     b7c:	8d 45 0c             	lea    0xc(%ebp),%eax
+     b7f:	83 c0 04             	add    $0x4,%eax
+     b82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     b85:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b8c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     b93:	e9 82 01 00 00       	jmp    d1a <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     b98:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b9e:	01 d0                	add    %edx,%eax
+     ba0:	0f b6 00             	movzbl (%eax),%eax
+     ba3:	0f be c0             	movsbl %al,%eax
+     ba6:	25 ff 00 00 00       	and    $0xff,%eax
+     bab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     bae:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     bb2:	75 38                	jne    bec <printf+0x9d>
+      if(c == '%'){
+     bb4:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     bb8:	0f 85 58 01 00 00    	jne    d16 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     bbe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bc1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     bc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     bc7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     bca:	01 ca                	add    %ecx,%edx
+     bcc:	83 ec 04             	sub    $0x4,%esp
+     bcf:	50                   	push   %eax
+     bd0:	52                   	push   %edx
+     bd1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bd7:	50                   	push   %eax
+     bd8:	e8 39 fd ff ff       	call   916 <put>
+     bdd:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     be0:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     be7:	e9 2a 01 00 00       	jmp    d16 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     bec:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     bf0:	0f 85 20 01 00 00    	jne    d16 <printf+0x1c7>
+      if(c == 'd'){
+     bf6:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     bfa:	75 22                	jne    c1e <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     bfc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bff:	8b 00                	mov    (%eax),%eax
+     c01:	6a 01                	push   $0x1
+     c03:	6a 0a                	push   $0xa
+     c05:	50                   	push   %eax
+     c06:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c0c:	50                   	push   %eax
+     c0d:	e8 48 fe ff ff       	call   a5a <printint>
+     c12:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c15:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c19:	e9 e8 00 00 00       	jmp    d06 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     c1e:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     c22:	74 06                	je     c2a <printf+0xdb>
+     c24:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     c28:	75 22                	jne    c4c <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     c2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c2d:	8b 00                	mov    (%eax),%eax
+     c2f:	6a 00                	push   $0x0
+     c31:	6a 10                	push   $0x10
+     c33:	50                   	push   %eax
+     c34:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c3a:	50                   	push   %eax
+     c3b:	e8 1a fe ff ff       	call   a5a <printint>
+     c40:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c43:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c47:	e9 ba 00 00 00       	jmp    d06 <printf+0x1b7>
+      } else if(c == 's'){
+     c4c:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     c50:	75 3f                	jne    c91 <printf+0x142>
+        s = (char*)*ap;
+     c52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c55:	8b 00                	mov    (%eax),%eax
+     c57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c5a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     c5e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c62:	75 07                	jne    c6b <printf+0x11c>
+          s = "(null)";
+     c64:	c7 45 f4 fe 12 00 00 	movl   $0x12fe,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     c6b:	83 ec 0c             	sub    $0xc,%esp
+     c6e:	ff 75 f4             	push   -0xc(%ebp)
+     c71:	e8 47 f8 ff ff       	call   4bd <strlen>
+     c76:	83 c4 10             	add    $0x10,%esp
+     c79:	83 ec 04             	sub    $0x4,%esp
+     c7c:	50                   	push   %eax
+     c7d:	ff 75 f4             	push   -0xc(%ebp)
+     c80:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c86:	50                   	push   %eax
+     c87:	e8 8a fc ff ff       	call   916 <put>
+     c8c:	83 c4 10             	add    $0x10,%esp
+     c8f:	eb 75                	jmp    d06 <printf+0x1b7>
+      } else if(c == 'c'){
+     c91:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     c95:	75 21                	jne    cb8 <printf+0x169>
+        putc(&o, *ap);
+     c97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c9a:	8b 00                	mov    (%eax),%eax
+     c9c:	0f be c0             	movsbl %al,%eax
+     c9f:	83 ec 08             	sub    $0x8,%esp
+     ca2:	50                   	push   %eax
+     ca3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ca9:	50                   	push   %eax
+     caa:	e8 58 fd ff ff       	call   a07 <putc>
+     caf:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cb2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     cb6:	eb 4e                	jmp    d06 <printf+0x1b7>
+      } else if(c == '%'){
+     cb8:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     cbc:	75 1b                	jne    cd9 <printf+0x18a>
+        putc(&o, c);
+     cbe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     cc1:	0f be c0             	movsbl %al,%eax
+     cc4:	83 ec 08             	sub    $0x8,%esp
+     cc7:	50                   	push   %eax
+     cc8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cce:	50                   	push   %eax
+     ccf:	e8 33 fd ff ff       	call   a07 <putc>
+     cd4:	83 c4 10             	add    $0x10,%esp
+     cd7:	eb 2d                	jmp    d06 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     cd9:	83 ec 08             	sub    $0x8,%esp
+     cdc:	6a 25                	push   $0x25
+     cde:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ce4:	50                   	push   %eax
+     ce5:	e8 1d fd ff ff       	call   a07 <putc>
+     cea:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     ced:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     cf0:	0f be c0             	movsbl %al,%eax
+     cf3:	83 ec 08             	sub    $0x8,%esp
+     cf6:	50                   	push   %eax
+     cf7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cfd:	50                   	push   %eax
+     cfe:	e8 04 fd ff ff       	call   a07 <putc>
+     d03:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     d06:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     d0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d10:	83 c0 01             	add    $0x1,%eax
+     d13:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d16:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d20:	01 d0                	add    %edx,%eax
+     d22:	0f b6 00             	movzbl (%eax),%eax
+     d25:	84 c0                	test   %al,%al
+     d27:	0f 85 6b fe ff ff    	jne    b98 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     d2d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     d31:	75 22                	jne    d55 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     d33:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d36:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     d39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     d3c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     d3f:	01 ca                	add    %ecx,%edx
+     d41:	83 ec 04             	sub    $0x4,%esp
+     d44:	50                   	push   %eax
+     d45:	52                   	push   %edx
+     d46:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d4c:	50                   	push   %eax
+     d4d:	e8 c4 fb ff ff       	call   916 <put>
+     d52:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     d55:	83 ec 0c             	sub    $0xc,%esp
+     d58:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d5e:	50                   	push   %eax
+     d5f:	e8 69 fb ff ff       	call   8cd <flush>
+     d64:	83 c4 10             	add    $0x10,%esp
+}
+     d67:	90                   	nop
+     d68:	c9                   	leave
+     d69:	c3                   	ret
+
+00000d6a <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     d6a:	55                   	push   %ebp
+     d6b:	89 e5                	mov    %esp,%ebp
+     d6d:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     d70:	8b 55 08             	mov    0x8(%ebp),%edx
+     d73:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     d79:	f0 87 02             	lock xchg %eax,(%edx)
+     d7c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     d7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     d82:	c9                   	leave
+     d83:	c3                   	ret
+
+00000d84 <lock>:
+{
+     d84:	55                   	push   %ebp
+     d85:	89 e5                	mov    %esp,%ebp
+     d87:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     d8a:	a1 20 17 02 00       	mov    0x21720,%eax
+     d8f:	85 c0                	test   %eax,%eax
+     d91:	74 09                	je     d9c <lock+0x18>
+     d93:	a1 20 17 02 00       	mov    0x21720,%eax
+     d98:	ff d0                	call   *%eax
+     d9a:	eb 05                	jmp    da1 <lock+0x1d>
+     d9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     da1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     da4:	90                   	nop
+     da5:	83 ec 08             	sub    $0x8,%esp
+     da8:	6a 01                	push   $0x1
+     daa:	68 58 17 02 00       	push   $0x21758
+     daf:	e8 b6 ff ff ff       	call   d6a <xchg>
+     db4:	83 c4 10             	add    $0x10,%esp
+     db7:	85 c0                	test   %eax,%eax
+     db9:	75 ea                	jne    da5 <lock+0x21>
+  return pin;
+     dbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     dbe:	c9                   	leave
+     dbf:	c3                   	ret
+
+00000dc0 <unlock>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     dc6:	6a 00                	push   $0x0
+     dc8:	68 58 17 02 00       	push   $0x21758
+     dcd:	e8 98 ff ff ff       	call   d6a <xchg>
+     dd2:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     dd5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     dd9:	78 10                	js     deb <unlock+0x2b>
+    mallocunpin(pin);
+     ddb:	a1 24 17 02 00       	mov    0x21724,%eax
+     de0:	83 ec 0c             	sub    $0xc,%esp
+     de3:	ff 75 08             	push   0x8(%ebp)
+     de6:	ff d0                	call   *%eax
+     de8:	83 c4 10             	add    $0x10,%esp
+}
+     deb:	90                   	nop
+     dec:	c9                   	leave
+     ded:	c3                   	ret
+
+00000dee <sizeclass>:
+{
+     dee:	55                   	push   %ebp
+     def:	89 e5                	mov    %esp,%ebp
+     df1:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     df4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     dfb:	eb 1c                	jmp    e19 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     dfd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e00:	ba 02 00 00 00       	mov    $0x2,%edx
+     e05:	89 c1                	mov    %eax,%ecx
+     e07:	d3 e2                	shl    %cl,%edx
+     e09:	89 d0                	mov    %edx,%eax
+     e0b:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e0e:	72 05                	jb     e15 <sizeclass+0x27>
+      return c;
+     e10:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e13:	eb 0f                	jmp    e24 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     e15:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     e19:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     e1d:	7e de                	jle    dfd <sizeclass+0xf>
+  return -1;
+     e1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     e24:	c9                   	leave
+     e25:	c3                   	ret
+
+00000e26 <bigfree>:
+{
+     e26:	55                   	push   %ebp
+     e27:	89 e5                	mov    %esp,%ebp
+     e29:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e2c:	a1 30 17 02 00       	mov    0x21730,%eax
+     e31:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e34:	eb 24                	jmp    e5a <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e39:	8b 00                	mov    (%eax),%eax
+     e3b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e3e:	72 12                	jb     e52 <bigfree+0x2c>
+     e40:	8b 45 08             	mov    0x8(%ebp),%eax
+     e43:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e46:	72 24                	jb     e6c <bigfree+0x46>
+     e48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e4b:	8b 00                	mov    (%eax),%eax
+     e4d:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e50:	72 1a                	jb     e6c <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e55:	8b 00                	mov    (%eax),%eax
+     e57:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e5d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e60:	73 d4                	jae    e36 <bigfree+0x10>
+     e62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e65:	8b 00                	mov    (%eax),%eax
+     e67:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e6a:	73 ca                	jae    e36 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e6f:	8b 40 04             	mov    0x4(%eax),%eax
+     e72:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+     e7c:	01 c2                	add    %eax,%edx
+     e7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e81:	8b 00                	mov    (%eax),%eax
+     e83:	39 c2                	cmp    %eax,%edx
+     e85:	75 24                	jne    eab <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     e87:	8b 45 08             	mov    0x8(%ebp),%eax
+     e8a:	8b 50 04             	mov    0x4(%eax),%edx
+     e8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e90:	8b 00                	mov    (%eax),%eax
+     e92:	8b 40 04             	mov    0x4(%eax),%eax
+     e95:	01 c2                	add    %eax,%edx
+     e97:	8b 45 08             	mov    0x8(%ebp),%eax
+     e9a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e9d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ea0:	8b 00                	mov    (%eax),%eax
+     ea2:	8b 10                	mov    (%eax),%edx
+     ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea7:	89 10                	mov    %edx,(%eax)
+     ea9:	eb 0a                	jmp    eb5 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     eab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eae:	8b 10                	mov    (%eax),%edx
+     eb0:	8b 45 08             	mov    0x8(%ebp),%eax
+     eb3:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     eb5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eb8:	8b 40 04             	mov    0x4(%eax),%eax
+     ebb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     ec2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ec5:	01 d0                	add    %edx,%eax
+     ec7:	39 45 08             	cmp    %eax,0x8(%ebp)
+     eca:	75 20                	jne    eec <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     ecc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ecf:	8b 50 04             	mov    0x4(%eax),%edx
+     ed2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed5:	8b 40 04             	mov    0x4(%eax),%eax
+     ed8:	01 c2                	add    %eax,%edx
+     eda:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     edd:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee3:	8b 10                	mov    (%eax),%edx
+     ee5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee8:	89 10                	mov    %edx,(%eax)
+     eea:	eb 08                	jmp    ef4 <bigfree+0xce>
+    p->s.ptr = bp;
+     eec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eef:	8b 55 08             	mov    0x8(%ebp),%edx
+     ef2:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     ef4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef7:	a3 30 17 02 00       	mov    %eax,0x21730
+}
+     efc:	90                   	nop
+     efd:	c9                   	leave
+     efe:	c3                   	ret
+
+00000eff <free>:
+{
+     eff:	55                   	push   %ebp
+     f00:	89 e5                	mov    %esp,%ebp
+     f02:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     f05:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f09:	74 68                	je     f73 <free+0x74>
+  bp = (Header*)ap - 1;
+     f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0e:	83 e8 08             	sub    $0x8,%eax
+     f11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     f14:	e8 6b fe ff ff       	call   d84 <lock>
+     f19:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f1f:	8b 40 04             	mov    0x4(%eax),%eax
+     f22:	83 ec 0c             	sub    $0xc,%esp
+     f25:	50                   	push   %eax
+     f26:	e8 c3 fe ff ff       	call   dee <sizeclass>
+     f2b:	83 c4 10             	add    $0x10,%esp
+     f2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f31:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f35:	78 1e                	js     f55 <free+0x56>
+    bp->s.ptr = classfree[c];
+     f37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f3a:	8b 14 85 34 17 02 00 	mov    0x21734(,%eax,4),%edx
+     f41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f44:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     f46:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f49:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f4c:	89 14 85 34 17 02 00 	mov    %edx,0x21734(,%eax,4)
+     f53:	eb 0e                	jmp    f63 <free+0x64>
+    bigfree(bp);
+     f55:	83 ec 0c             	sub    $0xc,%esp
+     f58:	ff 75 f4             	push   -0xc(%ebp)
+     f5b:	e8 c6 fe ff ff       	call   e26 <bigfree>
+     f60:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     f63:	83 ec 0c             	sub    $0xc,%esp
+     f66:	ff 75 f0             	push   -0x10(%ebp)
+     f69:	e8 52 fe ff ff       	call   dc0 <unlock>
+     f6e:	83 c4 10             	add    $0x10,%esp
+     f71:	eb 01                	jmp    f74 <free+0x75>
+    return;
+     f73:	90                   	nop
+}
+     f74:	c9                   	leave
+     f75:	c3                   	ret
+
+00000f76 <morecore>:
+{
+     f76:	55                   	push   %ebp
+     f77:	89 e5                	mov    %esp,%ebp
+     f79:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     f7c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     f83:	77 07                	ja     f8c <morecore+0x16>
+    nu = 4096;
+     f85:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8f:	c1 e0 03             	shl    $0x3,%eax
+     f92:	83 ec 0c             	sub    $0xc,%esp
+     f95:	50                   	push   %eax
+     f96:	e8 b6 f7 ff ff       	call   751 <sbrk>
+     f9b:	83 c4 10             	add    $0x10,%esp
+     f9e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     fa1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     fa5:	75 07                	jne    fae <morecore+0x38>
+    return 0;
+     fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+     fac:	eb 22                	jmp    fd0 <morecore+0x5a>
+  hp = (Header*)p;
+     fae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     fb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+     fba:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     fbd:	83 ec 0c             	sub    $0xc,%esp
+     fc0:	ff 75 f0             	push   -0x10(%ebp)
+     fc3:	e8 5e fe ff ff       	call   e26 <bigfree>
+     fc8:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     fcb:	a1 30 17 02 00       	mov    0x21730,%eax
+}
+     fd0:	c9                   	leave
+     fd1:	c3                   	ret
+
+00000fd2 <bigalloc>:
+{
+     fd2:	55                   	push   %ebp
+     fd3:	89 e5                	mov    %esp,%ebp
+     fd5:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     fd8:	a1 30 17 02 00       	mov    0x21730,%eax
+     fdd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fe0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     fe4:	75 23                	jne    1009 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     fe6:	c7 45 f0 28 17 02 00 	movl   $0x21728,-0x10(%ebp)
+     fed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff0:	a3 30 17 02 00       	mov    %eax,0x21730
+     ff5:	a1 30 17 02 00       	mov    0x21730,%eax
+     ffa:	a3 28 17 02 00       	mov    %eax,0x21728
+    base.s.size = 0;
+     fff:	c7 05 2c 17 02 00 00 	movl   $0x0,0x2172c
+    1006:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1009:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    100c:	8b 00                	mov    (%eax),%eax
+    100e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1014:	8b 40 04             	mov    0x4(%eax),%eax
+    1017:	3b 45 08             	cmp    0x8(%ebp),%eax
+    101a:	72 4a                	jb     1066 <bigalloc+0x94>
+      if(p->s.size == nunits)
+    101c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101f:	8b 40 04             	mov    0x4(%eax),%eax
+    1022:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1025:	75 0c                	jne    1033 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1027:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102a:	8b 10                	mov    (%eax),%edx
+    102c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    102f:	89 10                	mov    %edx,(%eax)
+    1031:	eb 26                	jmp    1059 <bigalloc+0x87>
+        p->s.size -= nunits;
+    1033:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1036:	8b 40 04             	mov    0x4(%eax),%eax
+    1039:	2b 45 08             	sub    0x8(%ebp),%eax
+    103c:	89 c2                	mov    %eax,%edx
+    103e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1041:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1044:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1047:	8b 40 04             	mov    0x4(%eax),%eax
+    104a:	c1 e0 03             	shl    $0x3,%eax
+    104d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1050:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1053:	8b 55 08             	mov    0x8(%ebp),%edx
+    1056:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1059:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    105c:	a3 30 17 02 00       	mov    %eax,0x21730
+      return p;
+    1061:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1064:	eb 3b                	jmp    10a1 <bigalloc+0xcf>
+    if(p == freep)
+    1066:	a1 30 17 02 00       	mov    0x21730,%eax
+    106b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    106e:	75 1e                	jne    108e <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	ff 75 08             	push   0x8(%ebp)
+    1076:	e8 fb fe ff ff       	call   f76 <morecore>
+    107b:	83 c4 10             	add    $0x10,%esp
+    107e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1081:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1085:	75 07                	jne    108e <bigalloc+0xbc>
+        return 0;
+    1087:	b8 00 00 00 00       	mov    $0x0,%eax
+    108c:	eb 13                	jmp    10a1 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    108e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1091:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1097:	8b 00                	mov    (%eax),%eax
+    1099:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    109c:	e9 70 ff ff ff       	jmp    1011 <bigalloc+0x3f>
+}
+    10a1:	c9                   	leave
+    10a2:	c3                   	ret
+
+000010a3 <alloc>:
+alloc(uint nbytes)
+{
+    10a3:	55                   	push   %ebp
+    10a4:	89 e5                	mov    %esp,%ebp
+    10a6:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ac:	83 c0 07             	add    $0x7,%eax
+    10af:	c1 e8 03             	shr    $0x3,%eax
+    10b2:	83 c0 01             	add    $0x1,%eax
+    10b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    10b8:	ff 75 f4             	push   -0xc(%ebp)
+    10bb:	e8 2e fd ff ff       	call   dee <sizeclass>
+    10c0:	83 c4 04             	add    $0x4,%esp
+    10c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10c6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10ca:	79 2c                	jns    10f8 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    10cc:	83 ec 0c             	sub    $0xc,%esp
+    10cf:	ff 75 f4             	push   -0xc(%ebp)
+    10d2:	e8 fb fe ff ff       	call   fd2 <bigalloc>
+    10d7:	83 c4 10             	add    $0x10,%esp
+    10da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10e1:	75 0a                	jne    10ed <alloc+0x4a>
+      return 0;
+    10e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e8:	e9 c8 00 00 00       	jmp    11b5 <alloc+0x112>
+    return (void*)(p + 1);
+    10ed:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10f0:	83 c0 08             	add    $0x8,%eax
+    10f3:	e9 bd 00 00 00       	jmp    11b5 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    10f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10fb:	8b 04 85 34 17 02 00 	mov    0x21734(,%eax,4),%eax
+    1102:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1105:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1109:	74 1a                	je     1125 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    110b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    110e:	8b 10                	mov    (%eax),%edx
+    1110:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1113:	89 14 85 34 17 02 00 	mov    %edx,0x21734(,%eax,4)
+    return (void*)(p + 1);
+    111a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    111d:	83 c0 08             	add    $0x8,%eax
+    1120:	e9 90 00 00 00       	jmp    11b5 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1125:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1128:	ba 02 00 00 00       	mov    $0x2,%edx
+    112d:	89 c1                	mov    %eax,%ecx
+    112f:	d3 e2                	shl    %cl,%edx
+    1131:	89 d0                	mov    %edx,%eax
+    1133:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    1136:	a1 50 17 02 00       	mov    0x21750,%eax
+    113b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    113e:	c1 e2 03             	shl    $0x3,%edx
+    1141:	01 d0                	add    %edx,%eax
+    1143:	8b 15 54 17 02 00    	mov    0x21754,%edx
+    1149:	39 c2                	cmp    %eax,%edx
+    114b:	73 3f                	jae    118c <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    114d:	83 ec 0c             	sub    $0xc,%esp
+    1150:	68 00 08 00 00       	push   $0x800
+    1155:	e8 78 fe ff ff       	call   fd2 <bigalloc>
+    115a:	83 c4 10             	add    $0x10,%esp
+    115d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1160:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1164:	75 07                	jne    116d <alloc+0xca>
+      return 0;
+    1166:	b8 00 00 00 00       	mov    $0x0,%eax
+    116b:	eb 48                	jmp    11b5 <alloc+0x112>
+    bump = (char*)p;
+    116d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1170:	a3 50 17 02 00       	mov    %eax,0x21750
+    bumpend = (char*)(p + p->s.size);
+    1175:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1178:	8b 40 04             	mov    0x4(%eax),%eax
+    117b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1182:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1185:	01 d0                	add    %edx,%eax
+    1187:	a3 54 17 02 00       	mov    %eax,0x21754
+  }
+  p = (Header*)bump;
+    118c:	a1 50 17 02 00       	mov    0x21750,%eax
+    1191:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1194:	a1 50 17 02 00       	mov    0x21750,%eax
+    1199:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    119c:	c1 e2 03             	shl    $0x3,%edx
+    119f:	01 d0                	add    %edx,%eax
+    11a1:	a3 50 17 02 00       	mov    %eax,0x21750
+  p->s.size = nunits;
+    11a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11ac:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    11af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11b2:	83 c0 08             	add    $0x8,%eax
+}
+    11b5:	c9                   	leave
+    11b6:	c3                   	ret
+
+000011b7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    11b7:	55                   	push   %ebp
+    11b8:	89 e5                	mov    %esp,%ebp
+    11ba:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    11bd:	e8 c2 fb ff ff       	call   d84 <lock>
+    11c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    11c5:	83 ec 0c             	sub    $0xc,%esp
+    11c8:	ff 75 08             	push   0x8(%ebp)
+    11cb:	e8 d3 fe ff ff       	call   10a3 <alloc>
+    11d0:	83 c4 10             	add    $0x10,%esp
+    11d3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    11d6:	83 ec 0c             	sub    $0xc,%esp
+    11d9:	ff 75 f4             	push   -0xc(%ebp)
+    11dc:	e8 df fb ff ff       	call   dc0 <unlock>
+    11e1:	83 c4 10             	add    $0x10,%esp
+  return p;
+    11e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    11e7:	c9                   	leave
+    11e8:	c3                   	ret
@@ -0,0 +1,90 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define SIZE (64*1024)
+
+static char buf[SIZE], buf2[SIZE];
+
+static int
+check(int fd, int off, int n)
+{
+  int i;
+
+  if(pread(fd, buf2, n, off) != n)
+    return 0;
+  for(i = 0; i < n; i++)
+    if(buf2[i] != buf[off+i])
+      return 0;
+  return 1;
+}
+
+static int
+size(int fd)
+{
+  struct stat st;
+
+  if(fstat(fd, &st) < 0)
+    return -1;
+  return st.size;
+}
+
+static void
+test(char *path)
+{
+  int fd, i;
+
+  for(i = 0; i < SIZE; i++)
+    buf[i] = 'a' + i % 23;
+  unlink(path);
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0){
+    printf(1, "error: create %s\n", path);
+    exit();
+  }
+
+  // Reserved blocks do not change the size or the data.
+  if(write(fd, buf, 1000) != 1000 || fallocate(fd, 0, SIZE) < 0 ||
+     size(fd) != 1000 || !check(fd, 0, 1000) || pread(fd, buf2, 1, 1000) != 0){
+    printf(1, "error: fallocate %s\n", path);
+    exit();
+  }
+  if(write(fd, buf + 1000, SIZE - 1000) != SIZE - 1000 || size(fd) != SIZE ||
+     !check(fd, 0, SIZE)){
+    printf(1, "error: write into reserved blocks of %s\n", path);
+    exit();
+  }
+
+  // Truncating keeps the head; what is written after it is new.
+  if(ftruncate(fd, 5000) < 0 || size(fd) != 5000 || !check(fd, 0, 5000) ||
+     pread(fd, buf2, 100, 4990) != 10){
+    printf(1, "error: ftruncate %s\n", path);
+    exit();
+  }
+  if(ftruncate(fd, 6000) >= 0){
+    printf(1, "error: ftruncate %s grew it\n", path);
+    exit();
+  }
+  buf[5000] = 'X';
+  if(fallocate(fd, 4000, 20000) < 0 || pwrite(fd, buf + 5000, 1, 5000) != 1 ||
+     size(fd) != 5001 || !check(fd, 0, 5001)){
+    printf(1, "error: write after ftruncate %s\n", path);
+    exit();
+  }
+  if(ftruncate(fd, 0) < 0 || size(fd) != 0 || pread(fd, buf2, 1, 0) != 0){
+    printf(1, "error: ftruncate %s to 0\n", path);
+    exit();
+  }
+  close(fd);
+  unlink(path);
+}
+
+int
+main(int argc, char *argv[])
+{
+  test("/falloc");
+  printf(1, "fallocate and ftruncate ok\n");
+  test("/tmp/falloc");
+  printf(1, "tmpfs fallocate and ftruncate ok\n");
+  exit();
+}
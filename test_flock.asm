@@ -0,0 +1,1971 @@
+
+_test_flock:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 14 04 00 00    	sub    $0x414,%esp
+  14:	89 c8                	mov    %ecx,%eax
+  int fd;
+  char *password = argv[1];
+  16:	8b 50 04             	mov    0x4(%eax),%edx
+  19:	8b 52 04             	mov    0x4(%edx),%edx
+  1c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  char *path = argv[2];
+  1f:	8b 50 04             	mov    0x4(%eax),%edx
+  22:	8b 52 08             	mov    0x8(%edx),%edx
+  25:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  char buf[1024];
+
+  if(argc != 3){
+  28:	83 38 03             	cmpl   $0x3,(%eax)
+  2b:	74 17                	je     44 <main+0x44>
+    printf(1, "usage: test_flock password path\n");
+  2d:	83 ec 08             	sub    $0x8,%esp
+  30:	68 e0 0f 00 00       	push   $0xfe0
+  35:	6a 01                	push   $0x1
+  37:	e8 08 09 00 00       	call   944 <printf>
+  3c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  3f:	e8 70 04 00 00       	call   4b4 <exit>
+  }
+
+  fprot(path, password);
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	ff 75 f4             	push   -0xc(%ebp)
+  4a:	ff 75 f0             	push   -0x10(%ebp)
+  4d:	e8 26 05 00 00       	call   578 <fprot>
+  52:	83 c4 10             	add    $0x10,%esp
+
+  if(fork() == 0){
+  55:	e8 53 04 00 00       	call   4ad <fork>
+  5a:	85 c0                	test   %eax,%eax
+  5c:	0f 85 c5 00 00 00    	jne    127 <main+0x127>
+    // Child
+
+    funlock(path, password);
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	ff 75 f4             	push   -0xc(%ebp)
+  68:	ff 75 f0             	push   -0x10(%ebp)
+  6b:	e8 1c 05 00 00       	call   58c <funlock>
+  70:	83 c4 10             	add    $0x10,%esp
+    fd = open(path, 0);
+  73:	83 ec 08             	sub    $0x8,%esp
+  76:	6a 00                	push   $0x0
+  78:	ff 75 f0             	push   -0x10(%ebp)
+  7b:	e8 6c 04 00 00       	call   4ec <open>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+  86:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  8a:	79 1a                	jns    a6 <main+0xa6>
+      printf(1, "child error opening file: %s\n", path);
+  8c:	83 ec 04             	sub    $0x4,%esp
+  8f:	ff 75 f0             	push   -0x10(%ebp)
+  92:	68 01 10 00 00       	push   $0x1001
+  97:	6a 01                	push   $0x1
+  99:	e8 a6 08 00 00       	call   944 <printf>
+  9e:	83 c4 10             	add    $0x10,%esp
+      exit();
+  a1:	e8 0e 04 00 00       	call   4b4 <exit>
+    }
+    if(read(fd, buf, 1024) < 0){
+  a6:	83 ec 04             	sub    $0x4,%esp
+  a9:	68 00 04 00 00       	push   $0x400
+  ae:	8d 85 ec fb ff ff    	lea    -0x414(%ebp),%eax
+  b4:	50                   	push   %eax
+  b5:	ff 75 ec             	push   -0x14(%ebp)
+  b8:	e8 0c 04 00 00       	call   4c9 <read>
+  bd:	83 c4 10             	add    $0x10,%esp
+  c0:	85 c0                	test   %eax,%eax
+  c2:	79 1a                	jns    de <main+0xde>
+      printf(1, "child error reading file: %s\n", path);
+  c4:	83 ec 04             	sub    $0x4,%esp
+  c7:	ff 75 f0             	push   -0x10(%ebp)
+  ca:	68 1f 10 00 00       	push   $0x101f
+  cf:	6a 01                	push   $0x1
+  d1:	e8 6e 08 00 00       	call   944 <printf>
+  d6:	83 c4 10             	add    $0x10,%esp
+      exit();
+  d9:	e8 d6 03 00 00       	call   4b4 <exit>
+    }
+    printf(1, "%s\n", buf);
+  de:	83 ec 04             	sub    $0x4,%esp
+  e1:	8d 85 ec fb ff ff    	lea    -0x414(%ebp),%eax
+  e7:	50                   	push   %eax
+  e8:	68 3d 10 00 00       	push   $0x103d
+  ed:	6a 01                	push   $0x1
+  ef:	e8 50 08 00 00       	call   944 <printf>
+  f4:	83 c4 10             	add    $0x10,%esp
+    if(close(fd) < 0){
+  f7:	83 ec 0c             	sub    $0xc,%esp
+  fa:	ff 75 ec             	push   -0x14(%ebp)
+  fd:	e8 d5 03 00 00       	call   4d7 <close>
+ 102:	83 c4 10             	add    $0x10,%esp
+ 105:	85 c0                	test   %eax,%eax
+ 107:	0f 89 0b 01 00 00    	jns    218 <main+0x218>
+      printf(1, "child error closing file: %s\n", path);
+ 10d:	83 ec 04             	sub    $0x4,%esp
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	68 41 10 00 00       	push   $0x1041
+ 118:	6a 01                	push   $0x1
+ 11a:	e8 25 08 00 00       	call   944 <printf>
+ 11f:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 122:	e8 8d 03 00 00       	call   4b4 <exit>
+    }
+  } else {
+    // Parent
+    wait();
+ 127:	e8 8f 03 00 00       	call   4bb <wait>
+
+    printf(1, "parent opening file...\n");
+ 12c:	83 ec 08             	sub    $0x8,%esp
+ 12f:	68 5f 10 00 00       	push   $0x105f
+ 134:	6a 01                	push   $0x1
+ 136:	e8 09 08 00 00       	call   944 <printf>
+ 13b:	83 c4 10             	add    $0x10,%esp
+
+    fd = open(path, 0);
+ 13e:	83 ec 08             	sub    $0x8,%esp
+ 141:	6a 00                	push   $0x0
+ 143:	ff 75 f0             	push   -0x10(%ebp)
+ 146:	e8 a1 03 00 00       	call   4ec <open>
+ 14b:	83 c4 10             	add    $0x10,%esp
+ 14e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+ 151:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 155:	79 17                	jns    16e <main+0x16e>
+      printf(1, "parent error opening file: %s\n", path);
+ 157:	83 ec 04             	sub    $0x4,%esp
+ 15a:	ff 75 f0             	push   -0x10(%ebp)
+ 15d:	68 78 10 00 00       	push   $0x1078
+ 162:	6a 01                	push   $0x1
+ 164:	e8 db 07 00 00       	call   944 <printf>
+ 169:	83 c4 10             	add    $0x10,%esp
+ 16c:	eb 0e                	jmp    17c <main+0x17c>
+    } else {
+      close(fd);
+ 16e:	83 ec 0c             	sub    $0xc,%esp
+ 171:	ff 75 ec             	push   -0x14(%ebp)
+ 174:	e8 5e 03 00 00       	call   4d7 <close>
+ 179:	83 c4 10             	add    $0x10,%esp
+    }
+
+    printf(1, "parent trying to unprotect with wrong password...\n");
+ 17c:	83 ec 08             	sub    $0x8,%esp
+ 17f:	68 98 10 00 00       	push   $0x1098
+ 184:	6a 01                	push   $0x1
+ 186:	e8 b9 07 00 00       	call   944 <printf>
+ 18b:	83 c4 10             	add    $0x10,%esp
+    if(funprot(path, "wrong") == 0) {
+ 18e:	83 ec 08             	sub    $0x8,%esp
+ 191:	68 cb 10 00 00       	push   $0x10cb
+ 196:	ff 75 f0             	push   -0x10(%ebp)
+ 199:	e8 e4 03 00 00       	call   582 <funprot>
+ 19e:	83 c4 10             	add    $0x10,%esp
+ 1a1:	85 c0                	test   %eax,%eax
+ 1a3:	75 14                	jne    1b9 <main+0x1b9>
+      printf(1, "ok\n");
+ 1a5:	83 ec 08             	sub    $0x8,%esp
+ 1a8:	68 d1 10 00 00       	push   $0x10d1
+ 1ad:	6a 01                	push   $0x1
+ 1af:	e8 90 07 00 00       	call   944 <printf>
+ 1b4:	83 c4 10             	add    $0x10,%esp
+ 1b7:	eb 12                	jmp    1cb <main+0x1cb>
+    } else {
+      printf(1, "failed\n");
+ 1b9:	83 ec 08             	sub    $0x8,%esp
+ 1bc:	68 d5 10 00 00       	push   $0x10d5
+ 1c1:	6a 01                	push   $0x1
+ 1c3:	e8 7c 07 00 00       	call   944 <printf>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+    }
+
+    printf(1, "parent trying to unprotect with correct password...\n");
+ 1cb:	83 ec 08             	sub    $0x8,%esp
+ 1ce:	68 e0 10 00 00       	push   $0x10e0
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	e8 6a 07 00 00       	call   944 <printf>
+ 1da:	83 c4 10             	add    $0x10,%esp
+    if(funprot(path, password) == 0) {
+ 1dd:	83 ec 08             	sub    $0x8,%esp
+ 1e0:	ff 75 f4             	push   -0xc(%ebp)
+ 1e3:	ff 75 f0             	push   -0x10(%ebp)
+ 1e6:	e8 97 03 00 00       	call   582 <funprot>
+ 1eb:	83 c4 10             	add    $0x10,%esp
+ 1ee:	85 c0                	test   %eax,%eax
+ 1f0:	75 14                	jne    206 <main+0x206>
+      printf(1, "ok\n");
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	68 d1 10 00 00       	push   $0x10d1
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	e8 43 07 00 00       	call   944 <printf>
+ 201:	83 c4 10             	add    $0x10,%esp
+ 204:	eb 12                	jmp    218 <main+0x218>
+    } else {
+      printf(1, "failed\n");
+ 206:	83 ec 08             	sub    $0x8,%esp
+ 209:	68 d5 10 00 00       	push   $0x10d5
+ 20e:	6a 01                	push   $0x1
+ 210:	e8 2f 07 00 00       	call   944 <printf>
+ 215:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+ 218:	e8 97 02 00 00       	call   4b4 <exit>
+
+0000021d <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 21d:	55                   	push   %ebp
+ 21e:	89 e5                	mov    %esp,%ebp
+ 220:	57                   	push   %edi
+ 221:	53                   	push   %ebx
+    if(cc < 1)
+ 222:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 225:	8b 55 10             	mov    0x10(%ebp),%edx
+ 228:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22b:	89 cb                	mov    %ecx,%ebx
+ 22d:	89 df                	mov    %ebx,%edi
+ 22f:	89 d1                	mov    %edx,%ecx
+ 231:	fc                   	cld
+ 232:	f3 aa                	rep stos %al,%es:(%edi)
+ 234:	89 ca                	mov    %ecx,%edx
+ 236:	89 fb                	mov    %edi,%ebx
+ 238:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 23b:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 23e:	90                   	nop
+ 23f:	5b                   	pop    %ebx
+ 240:	5f                   	pop    %edi
+ 241:	5d                   	pop    %ebp
+ 242:	c3                   	ret
+
+00000243 <strcpy>:
+{
+ 243:	55                   	push   %ebp
+ 244:	89 e5                	mov    %esp,%ebp
+ 246:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 249:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 24f:	90                   	nop
+ 250:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 253:	8d 42 01             	lea    0x1(%edx),%eax
+ 256:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 25f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 262:	0f b6 12             	movzbl (%edx),%edx
+ 265:	88 10                	mov    %dl,(%eax)
+ 267:	0f b6 00             	movzbl (%eax),%eax
+ 26a:	84 c0                	test   %al,%al
+ 26c:	75 e2                	jne    250 <strcpy+0xd>
+  return os;
+ 26e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 271:	c9                   	leave
+ 272:	c3                   	ret
+
+00000273 <strcmp>:
+{
+ 273:	55                   	push   %ebp
+ 274:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 276:	eb 08                	jmp    280 <strcmp+0xd>
+    p++, q++;
+ 278:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 27c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 280:	8b 45 08             	mov    0x8(%ebp),%eax
+ 283:	0f b6 00             	movzbl (%eax),%eax
+ 286:	84 c0                	test   %al,%al
+ 288:	74 10                	je     29a <strcmp+0x27>
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	0f b6 10             	movzbl (%eax),%edx
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	0f b6 00             	movzbl (%eax),%eax
+ 296:	38 c2                	cmp    %al,%dl
+ 298:	74 de                	je     278 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 29a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29d:	0f b6 00             	movzbl (%eax),%eax
+ 2a0:	0f b6 d0             	movzbl %al,%edx
+ 2a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a6:	0f b6 00             	movzbl (%eax),%eax
+ 2a9:	0f b6 c0             	movzbl %al,%eax
+ 2ac:	29 c2                	sub    %eax,%edx
+ 2ae:	89 d0                	mov    %edx,%eax
+}
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+
+000002b2 <strlen>:
+{
+ 2b2:	55                   	push   %ebp
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 2b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2bf:	eb 04                	jmp    2c5 <strlen+0x13>
+ 2c1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2c5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cb:	01 d0                	add    %edx,%eax
+ 2cd:	0f b6 00             	movzbl (%eax),%eax
+ 2d0:	84 c0                	test   %al,%al
+ 2d2:	75 ed                	jne    2c1 <strlen+0xf>
+  return n;
+ 2d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+
+000002d9 <memset>:
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2dc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2df:	50                   	push   %eax
+ 2e0:	ff 75 0c             	push   0xc(%ebp)
+ 2e3:	ff 75 08             	push   0x8(%ebp)
+ 2e6:	e8 32 ff ff ff       	call   21d <stosb>
+ 2eb:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2ee:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2f1:	c9                   	leave
+ 2f2:	c3                   	ret
+
+000002f3 <strchr>:
+{
+ 2f3:	55                   	push   %ebp
+ 2f4:	89 e5                	mov    %esp,%ebp
+ 2f6:	83 ec 04             	sub    $0x4,%esp
+ 2f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fc:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2ff:	eb 14                	jmp    315 <strchr+0x22>
+    if(*s == c)
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	0f b6 00             	movzbl (%eax),%eax
+ 307:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 30a:	75 05                	jne    311 <strchr+0x1e>
+      return (char*)s;
+ 30c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30f:	eb 13                	jmp    324 <strchr+0x31>
+  for(; *s; s++)
+ 311:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 315:	8b 45 08             	mov    0x8(%ebp),%eax
+ 318:	0f b6 00             	movzbl (%eax),%eax
+ 31b:	84 c0                	test   %al,%al
+ 31d:	75 e2                	jne    301 <strchr+0xe>
+  return 0;
+ 31f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+
+00000326 <gets>:
+{
+ 326:	55                   	push   %ebp
+ 327:	89 e5                	mov    %esp,%ebp
+ 329:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 32c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 333:	eb 42                	jmp    377 <gets+0x51>
+    cc = read(0, &c, 1);
+ 335:	83 ec 04             	sub    $0x4,%esp
+ 338:	6a 01                	push   $0x1
+ 33a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 33d:	50                   	push   %eax
+ 33e:	6a 00                	push   $0x0
+ 340:	e8 84 01 00 00       	call   4c9 <read>
+ 345:	83 c4 10             	add    $0x10,%esp
+ 348:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 34b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 34f:	7e 33                	jle    384 <gets+0x5e>
+    buf[i++] = c;
+ 351:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 354:	8d 50 01             	lea    0x1(%eax),%edx
+ 357:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 35a:	89 c2                	mov    %eax,%edx
+ 35c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35f:	01 c2                	add    %eax,%edx
+ 361:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 365:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 367:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 36b:	3c 0a                	cmp    $0xa,%al
+ 36d:	74 16                	je     385 <gets+0x5f>
+ 36f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 373:	3c 0d                	cmp    $0xd,%al
+ 375:	74 0e                	je     385 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 377:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 37a:	83 c0 01             	add    $0x1,%eax
+ 37d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 380:	7f b3                	jg     335 <gets+0xf>
+ 382:	eb 01                	jmp    385 <gets+0x5f>
+      break;
+ 384:	90                   	nop
+  }
+  buf[i] = '\0';
+ 385:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 388:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38b:	01 d0                	add    %edx,%eax
+ 38d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+
+00000395 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 395:	55                   	push   %ebp
+ 396:	89 e5                	mov    %esp,%ebp
+ 398:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39b:	83 ec 08             	sub    $0x8,%esp
+ 39e:	6a 00                	push   $0x0
+ 3a0:	ff 75 08             	push   0x8(%ebp)
+ 3a3:	e8 44 01 00 00       	call   4ec <open>
+ 3a8:	83 c4 10             	add    $0x10,%esp
+ 3ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3ae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3b2:	79 07                	jns    3bb <stat+0x26>
+    return -1;
+ 3b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3b9:	eb 25                	jmp    3e0 <stat+0x4b>
+  r = fstat(fd, st);
+ 3bb:	83 ec 08             	sub    $0x8,%esp
+ 3be:	ff 75 0c             	push   0xc(%ebp)
+ 3c1:	ff 75 f4             	push   -0xc(%ebp)
+ 3c4:	e8 41 01 00 00       	call   50a <fstat>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+ 3cc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3cf:	83 ec 0c             	sub    $0xc,%esp
+ 3d2:	ff 75 f4             	push   -0xc(%ebp)
+ 3d5:	e8 fd 00 00 00       	call   4d7 <close>
+ 3da:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3e0:	c9                   	leave
+ 3e1:	c3                   	ret
+
+000003e2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e2:	55                   	push   %ebp
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3ef:	eb 25                	jmp    416 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3f1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3f4:	89 d0                	mov    %edx,%eax
+ 3f6:	c1 e0 02             	shl    $0x2,%eax
+ 3f9:	01 d0                	add    %edx,%eax
+ 3fb:	01 c0                	add    %eax,%eax
+ 3fd:	89 c1                	mov    %eax,%ecx
+ 3ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 402:	8d 50 01             	lea    0x1(%eax),%edx
+ 405:	89 55 08             	mov    %edx,0x8(%ebp)
+ 408:	0f b6 00             	movzbl (%eax),%eax
+ 40b:	0f be c0             	movsbl %al,%eax
+ 40e:	01 c8                	add    %ecx,%eax
+ 410:	83 e8 30             	sub    $0x30,%eax
+ 413:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 416:	8b 45 08             	mov    0x8(%ebp),%eax
+ 419:	0f b6 00             	movzbl (%eax),%eax
+ 41c:	3c 2f                	cmp    $0x2f,%al
+ 41e:	7e 0a                	jle    42a <atoi+0x48>
+ 420:	8b 45 08             	mov    0x8(%ebp),%eax
+ 423:	0f b6 00             	movzbl (%eax),%eax
+ 426:	3c 39                	cmp    $0x39,%al
+ 428:	7e c7                	jle    3f1 <atoi+0xf>
+  return n;
+ 42a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 42d:	c9                   	leave
+ 42e:	c3                   	ret
+
+0000042f <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 42f:	55                   	push   %ebp
+ 430:	89 e5                	mov    %esp,%ebp
+ 432:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 435:	8b 45 08             	mov    0x8(%ebp),%eax
+ 438:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 43b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 441:	eb 17                	jmp    45a <memmove+0x2b>
+    *dst++ = *src++;
+ 443:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 446:	8d 42 01             	lea    0x1(%edx),%eax
+ 449:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 44c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 44f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 452:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 455:	0f b6 12             	movzbl (%edx),%edx
+ 458:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 45a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 45d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 460:	89 55 10             	mov    %edx,0x10(%ebp)
+ 463:	85 c0                	test   %eax,%eax
+ 465:	7f dc                	jg     443 <memmove+0x14>
+  return vdst;
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+
+0000046c <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 46c:	83 3d a0 14 00 00 00 	cmpl   $0x0,0x14a0
+  jg 2f
+ 473:	7f 2e                	jg     4a3 <dosyscall+0x37>
+  jl 1f
+ 475:	7c 29                	jl     4a0 <dosyscall+0x34>
+  pushl %eax
+ 477:	50                   	push   %eax
+  pushl %ebx
+ 478:	53                   	push   %ebx
+  movl $1, %eax
+ 479:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 47e:	0f a2                	cpuid
+  popl %ebx
+ 480:	5b                   	pop    %ebx
+  popl %eax
+ 481:	58                   	pop    %eax
+  movl $-1, sysmode
+ 482:	c7 05 a0 14 00 00 ff 	movl   $0xffffffff,0x14a0
+ 489:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 48c:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 492:	74 0c                	je     4a0 <dosyscall+0x34>
+  movl $1, sysmode
+ 494:	c7 05 a0 14 00 00 01 	movl   $0x1,0x14a0
+ 49b:	00 00 00 
+  jmp 2f
+ 49e:	eb 03                	jmp    4a3 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 4a0:	cd 40                	int    $0x40
+  ret
+ 4a2:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 4a3:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 4a5:	ba ac 04 00 00       	mov    $0x4ac,%edx
+  sysenter
+ 4aa:	0f 34                	sysenter
+3:
+  ret
+ 4ac:	c3                   	ret
+
+000004ad <fork>:
+
+SYSCALL(fork)
+ 4ad:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b2:	eb b8                	jmp    46c <dosyscall>
+
+000004b4 <exit>:
+SYSCALL(exit)
+ 4b4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b9:	eb b1                	jmp    46c <dosyscall>
+
+000004bb <wait>:
+SYSCALL(wait)
+ 4bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c0:	eb aa                	jmp    46c <dosyscall>
+
+000004c2 <pipe>:
+SYSCALL(pipe)
+ 4c2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c7:	eb a3                	jmp    46c <dosyscall>
+
+000004c9 <read>:
+SYSCALL(read)
+ 4c9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4ce:	eb 9c                	jmp    46c <dosyscall>
+
+000004d0 <write>:
+SYSCALL(write)
+ 4d0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d5:	eb 95                	jmp    46c <dosyscall>
+
+000004d7 <close>:
+SYSCALL(close)
+ 4d7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4dc:	eb 8e                	jmp    46c <dosyscall>
+
+000004de <kill>:
+SYSCALL(kill)
+ 4de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e3:	eb 87                	jmp    46c <dosyscall>
+
+000004e5 <exec>:
+SYSCALL(exec)
+ 4e5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ea:	eb 80                	jmp    46c <dosyscall>
+
+000004ec <open>:
+SYSCALL(open)
+ 4ec:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f1:	e9 76 ff ff ff       	jmp    46c <dosyscall>
+
+000004f6 <mknod>:
+SYSCALL(mknod)
+ 4f6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4fb:	e9 6c ff ff ff       	jmp    46c <dosyscall>
+
+00000500 <unlink>:
+SYSCALL(unlink)
+ 500:	b8 12 00 00 00       	mov    $0x12,%eax
+ 505:	e9 62 ff ff ff       	jmp    46c <dosyscall>
+
+0000050a <fstat>:
+SYSCALL(fstat)
+ 50a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 50f:	e9 58 ff ff ff       	jmp    46c <dosyscall>
+
+00000514 <link>:
+SYSCALL(link)
+ 514:	b8 13 00 00 00       	mov    $0x13,%eax
+ 519:	e9 4e ff ff ff       	jmp    46c <dosyscall>
+
+0000051e <mkdir>:
+SYSCALL(mkdir)
+ 51e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 523:	e9 44 ff ff ff       	jmp    46c <dosyscall>
+
+00000528 <chdir>:
+SYSCALL(chdir)
+ 528:	b8 09 00 00 00       	mov    $0x9,%eax
+ 52d:	e9 3a ff ff ff       	jmp    46c <dosyscall>
+
+00000532 <dup>:
+SYSCALL(dup)
+ 532:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 537:	e9 30 ff ff ff       	jmp    46c <dosyscall>
+
+0000053c <getpid>:
+SYSCALL(getpid)
+ 53c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 541:	e9 26 ff ff ff       	jmp    46c <dosyscall>
+
+00000546 <sbrk>:
+SYSCALL(sbrk)
+ 546:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 54b:	e9 1c ff ff ff       	jmp    46c <dosyscall>
+
+00000550 <sleep>:
+SYSCALL(sleep)
+ 550:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 555:	e9 12 ff ff ff       	jmp    46c <dosyscall>
+
+0000055a <uptime>:
+SYSCALL(uptime)
+ 55a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 55f:	e9 08 ff ff ff       	jmp    46c <dosyscall>
+
+00000564 <symlink>:
+SYSCALL(symlink)
+ 564:	b8 16 00 00 00       	mov    $0x16,%eax
+ 569:	e9 fe fe ff ff       	jmp    46c <dosyscall>
+
+0000056e <readlink>:
+SYSCALL(readlink)
+ 56e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 573:	e9 f4 fe ff ff       	jmp    46c <dosyscall>
+
+00000578 <fprot>:
+SYSCALL(fprot)
+ 578:	b8 18 00 00 00       	mov    $0x18,%eax
+ 57d:	e9 ea fe ff ff       	jmp    46c <dosyscall>
+
+00000582 <funprot>:
+SYSCALL(funprot)
+ 582:	b8 19 00 00 00       	mov    $0x19,%eax
+ 587:	e9 e0 fe ff ff       	jmp    46c <dosyscall>
+
+0000058c <funlock>:
+SYSCALL(funlock)
+ 58c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 591:	e9 d6 fe ff ff       	jmp    46c <dosyscall>
+
+00000596 <mmap>:
+SYSCALL(mmap)
+ 596:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 59b:	e9 cc fe ff ff       	jmp    46c <dosyscall>
+
+000005a0 <munmap>:
+SYSCALL(munmap)
+ 5a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5a5:	e9 c2 fe ff ff       	jmp    46c <dosyscall>
+
+000005aa <sendfile>:
+SYSCALL(sendfile)
+ 5aa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5af:	e9 b8 fe ff ff       	jmp    46c <dosyscall>
+
+000005b4 <readv>:
+SYSCALL(readv)
+ 5b4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5b9:	e9 ae fe ff ff       	jmp    46c <dosyscall>
+
+000005be <writev>:
+SYSCALL(writev)
+ 5be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5c3:	e9 a4 fe ff ff       	jmp    46c <dosyscall>
+
+000005c8 <pread>:
+SYSCALL(pread)
+ 5c8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5cd:	e9 9a fe ff ff       	jmp    46c <dosyscall>
+
+000005d2 <pwrite>:
+SYSCALL(pwrite)
+ 5d2:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5d7:	e9 90 fe ff ff       	jmp    46c <dosyscall>
+
+000005dc <lseek>:
+SYSCALL(lseek)
+ 5dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e1:	e9 86 fe ff ff       	jmp    46c <dosyscall>
+
+000005e6 <spawn>:
+SYSCALL(spawn)
+ 5e6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5eb:	e9 7c fe ff ff       	jmp    46c <dosyscall>
+
+000005f0 <setpriority>:
+SYSCALL(setpriority)
+ 5f0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5f5:	e9 72 fe ff ff       	jmp    46c <dosyscall>
+
+000005fa <kthread_create>:
+SYSCALL(kthread_create)
+ 5fa:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5ff:	e9 68 fe ff ff       	jmp    46c <dosyscall>
+
+00000604 <kthread_id>:
+SYSCALL(kthread_id)
+ 604:	b8 26 00 00 00       	mov    $0x26,%eax
+ 609:	e9 5e fe ff ff       	jmp    46c <dosyscall>
+
+0000060e <kthread_exit>:
+SYSCALL(kthread_exit)
+ 60e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 613:	e9 54 fe ff ff       	jmp    46c <dosyscall>
+
+00000618 <kthread_join>:
+SYSCALL(kthread_join)
+ 618:	b8 28 00 00 00       	mov    $0x28,%eax
+ 61d:	e9 4a fe ff ff       	jmp    46c <dosyscall>
+
+00000622 <futex>:
+SYSCALL(futex)
+ 622:	b8 29 00 00 00       	mov    $0x29,%eax
+ 627:	e9 40 fe ff ff       	jmp    46c <dosyscall>
+
+0000062c <signal>:
+SYSCALL(signal)
+ 62c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 631:	e9 36 fe ff ff       	jmp    46c <dosyscall>
+
+00000636 <alarm>:
+SYSCALL(alarm)
+ 636:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 63b:	e9 2c fe ff ff       	jmp    46c <dosyscall>
+
+00000640 <usleep>:
+SYSCALL(usleep)
+ 640:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 645:	e9 22 fe ff ff       	jmp    46c <dosyscall>
+
+0000064a <ioring_setup>:
+SYSCALL(ioring_setup)
+ 64a:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 64f:	e9 18 fe ff ff       	jmp    46c <dosyscall>
+
+00000654 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 654:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 659:	e9 0e fe ff ff       	jmp    46c <dosyscall>
+
+0000065e <getrusage>:
+SYSCALL(getrusage)
+ 65e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 663:	e9 04 fe ff ff       	jmp    46c <dosyscall>
+
+00000668 <mount>:
+SYSCALL(mount)
+ 668:	b8 30 00 00 00       	mov    $0x30,%eax
+ 66d:	e9 fa fd ff ff       	jmp    46c <dosyscall>
+
+00000672 <getdents>:
+SYSCALL(getdents)
+ 672:	b8 31 00 00 00       	mov    $0x31,%eax
+ 677:	e9 f0 fd ff ff       	jmp    46c <dosyscall>
+
+0000067c <yield>:
+SYSCALL(yield)
+ 67c:	b8 32 00 00 00       	mov    $0x32,%eax
+ 681:	e9 e6 fd ff ff       	jmp    46c <dosyscall>
+
+00000686 <ncpu>:
+SYSCALL(ncpu)
+ 686:	b8 33 00 00 00       	mov    $0x33,%eax
+ 68b:	e9 dc fd ff ff       	jmp    46c <dosyscall>
+
+00000690 <fallocate>:
+SYSCALL(fallocate)
+ 690:	b8 34 00 00 00       	mov    $0x34,%eax
+ 695:	e9 d2 fd ff ff       	jmp    46c <dosyscall>
+
+0000069a <ftruncate>:
+SYSCALL(ftruncate)
+ 69a:	b8 35 00 00 00       	mov    $0x35,%eax
+ 69f:	e9 c8 fd ff ff       	jmp    46c <dosyscall>
+
+000006a4 <fsync>:
+SYSCALL(fsync)
+ 6a4:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6a9:	e9 be fd ff ff       	jmp    46c <dosyscall>
+
+000006ae <fdatasync>:
+SYSCALL(fdatasync)
+ 6ae:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6b3:	e9 b4 fd ff ff       	jmp    46c <dosyscall>
+
+000006b8 <poll>:
+SYSCALL(poll)
+ 6b8:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6bd:	e9 aa fd ff ff       	jmp    46c <dosyscall>
+
+000006c2 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 6c2:	55                   	push   %ebp
+ 6c3:	89 e5                	mov    %esp,%ebp
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ce:	85 c0                	test   %eax,%eax
+ 6d0:	7e 1f                	jle    6f1 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 6d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d5:	8b 50 04             	mov    0x4(%eax),%edx
+ 6d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6db:	8d 48 08             	lea    0x8(%eax),%ecx
+ 6de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e1:	8b 00                	mov    (%eax),%eax
+ 6e3:	83 ec 04             	sub    $0x4,%esp
+ 6e6:	52                   	push   %edx
+ 6e7:	51                   	push   %ecx
+ 6e8:	50                   	push   %eax
+ 6e9:	e8 d0 fe ff ff       	call   5be <writev>
+ 6ee:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 6f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fe:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 705:	00 00 00 
+}
+ 708:	90                   	nop
+ 709:	c9                   	leave
+ 70a:	c3                   	ret
+
+0000070b <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 70b:	55                   	push   %ebp
+ 70c:	89 e5                	mov    %esp,%ebp
+ 70e:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 711:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 715:	0f 84 94 00 00 00    	je     7af <put+0xa4>
+    return;
+  if(o->n > 0){
+ 71b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71e:	8b 40 04             	mov    0x4(%eax),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	7e 40                	jle    765 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 725:	8b 45 08             	mov    0x8(%ebp),%eax
+ 728:	8b 40 04             	mov    0x4(%eax),%eax
+ 72b:	83 e8 01             	sub    $0x1,%eax
+ 72e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 735:	8b 45 08             	mov    0x8(%ebp),%eax
+ 738:	01 d0                	add    %edx,%eax
+ 73a:	83 c0 08             	add    $0x8,%eax
+ 73d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 743:	8b 10                	mov    (%eax),%edx
+ 745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 748:	8b 40 04             	mov    0x4(%eax),%eax
+ 74b:	01 d0                	add    %edx,%eax
+ 74d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 750:	75 13                	jne    765 <put+0x5a>
+      v->iov_len += n;
+ 752:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 755:	8b 50 04             	mov    0x4(%eax),%edx
+ 758:	8b 45 10             	mov    0x10(%ebp),%eax
+ 75b:	01 c2                	add    %eax,%edx
+ 75d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 760:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 763:	eb 4b                	jmp    7b0 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 765:	8b 45 08             	mov    0x8(%ebp),%eax
+ 768:	8b 40 04             	mov    0x4(%eax),%eax
+ 76b:	83 f8 10             	cmp    $0x10,%eax
+ 76e:	75 0e                	jne    77e <put+0x73>
+    flush(o);
+ 770:	83 ec 0c             	sub    $0xc,%esp
+ 773:	ff 75 08             	push   0x8(%ebp)
+ 776:	e8 47 ff ff ff       	call   6c2 <flush>
+ 77b:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 77e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 781:	8b 50 04             	mov    0x4(%eax),%edx
+ 784:	8b 45 08             	mov    0x8(%ebp),%eax
+ 787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 78a:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 78e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 791:	8b 50 04             	mov    0x4(%eax),%edx
+ 794:	8b 45 08             	mov    0x8(%ebp),%eax
+ 797:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 79a:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 79e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a1:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a4:	8d 50 01             	lea    0x1(%eax),%edx
+ 7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7aa:	89 50 04             	mov    %edx,0x4(%eax)
+ 7ad:	eb 01                	jmp    7b0 <put+0xa5>
+    return;
+ 7af:	90                   	nop
+}
+ 7b0:	c9                   	leave
+ 7b1:	c3                   	ret
+
+000007b2 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 7b2:	55                   	push   %ebp
+ 7b3:	89 e5                	mov    %esp,%ebp
+ 7b5:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 7b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bb:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c4:	01 d0                	add    %edx,%eax
+ 7c6:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 7cb:	77 0b                	ja     7d8 <room+0x26>
+ 7cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d3:	83 f8 10             	cmp    $0x10,%eax
+ 7d6:	75 0e                	jne    7e6 <room+0x34>
+    flush(o);
+ 7d8:	83 ec 0c             	sub    $0xc,%esp
+ 7db:	ff 75 08             	push   0x8(%ebp)
+ 7de:	e8 df fe ff ff       	call   6c2 <flush>
+ 7e3:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e9:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 7ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7f8:	01 d0                	add    %edx,%eax
+}
+ 7fa:	c9                   	leave
+ 7fb:	c3                   	ret
+
+000007fc <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 7fc:	55                   	push   %ebp
+ 7fd:	89 e5                	mov    %esp,%ebp
+ 7ff:	83 ec 28             	sub    $0x28,%esp
+ 802:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 805:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 808:	83 ec 08             	sub    $0x8,%esp
+ 80b:	6a 01                	push   $0x1
+ 80d:	ff 75 08             	push   0x8(%ebp)
+ 810:	e8 9d ff ff ff       	call   7b2 <room>
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 81b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81e:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 822:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 824:	8b 45 08             	mov    0x8(%ebp),%eax
+ 827:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 82d:	8d 50 01             	lea    0x1(%eax),%edx
+ 830:	8b 45 08             	mov    0x8(%ebp),%eax
+ 833:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 839:	83 ec 04             	sub    $0x4,%esp
+ 83c:	6a 01                	push   $0x1
+ 83e:	ff 75 f4             	push   -0xc(%ebp)
+ 841:	ff 75 08             	push   0x8(%ebp)
+ 844:	e8 c2 fe ff ff       	call   70b <put>
+ 849:	83 c4 10             	add    $0x10,%esp
+}
+ 84c:	90                   	nop
+ 84d:	c9                   	leave
+ 84e:	c3                   	ret
+
+0000084f <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 84f:	55                   	push   %ebp
+ 850:	89 e5                	mov    %esp,%ebp
+ 852:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 855:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 85c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 860:	74 17                	je     879 <printint+0x2a>
+ 862:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 866:	79 11                	jns    879 <printint+0x2a>
+    neg = 1;
+ 868:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 86f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 872:	f7 d8                	neg    %eax
+ 874:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 877:	eb 06                	jmp    87f <printint+0x30>
+  } else {
+    x = xx;
+ 879:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 87c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 87f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 886:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 889:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 88c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 891:	f7 f1                	div    %ecx
+ 893:	89 d1                	mov    %edx,%ecx
+ 895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 898:	8d 50 01             	lea    0x1(%eax),%edx
+ 89b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 89e:	0f b6 91 a4 14 00 00 	movzbl 0x14a4(%ecx),%edx
+ 8a5:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8af:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8b4:	f7 f1                	div    %ecx
+ 8b6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8bd:	75 c7                	jne    886 <printint+0x37>
+  if(neg)
+ 8bf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8c3:	74 0e                	je     8d3 <printint+0x84>
+    buf[i++] = '-';
+ 8c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c8:	8d 50 01             	lea    0x1(%eax),%edx
+ 8cb:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8ce:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 8d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 8d9:	83 ec 08             	sub    $0x8,%esp
+ 8dc:	ff 75 e8             	push   -0x18(%ebp)
+ 8df:	ff 75 08             	push   0x8(%ebp)
+ 8e2:	e8 cb fe ff ff       	call   7b2 <room>
+ 8e7:	83 c4 10             	add    $0x10,%esp
+ 8ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 8ed:	eb 1d                	jmp    90c <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 8ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f2:	83 e8 01             	sub    $0x1,%eax
+ 8f5:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8f8:	89 c2                	mov    %eax,%edx
+ 8fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8fd:	01 c2                	add    %eax,%edx
+ 8ff:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 902:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 905:	01 c8                	add    %ecx,%eax
+ 907:	0f b6 00             	movzbl (%eax),%eax
+ 90a:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 90c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 910:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 914:	79 d9                	jns    8ef <printint+0xa0>
+  o->used += n;
+ 916:	8b 45 08             	mov    0x8(%ebp),%eax
+ 919:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 91f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 922:	01 c2                	add    %eax,%edx
+ 924:	8b 45 08             	mov    0x8(%ebp),%eax
+ 927:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 92d:	83 ec 04             	sub    $0x4,%esp
+ 930:	ff 75 e8             	push   -0x18(%ebp)
+ 933:	ff 75 e4             	push   -0x1c(%ebp)
+ 936:	ff 75 08             	push   0x8(%ebp)
+ 939:	e8 cd fd ff ff       	call   70b <put>
+ 93e:	83 c4 10             	add    $0x10,%esp
+}
+ 941:	90                   	nop
+ 942:	c9                   	leave
+ 943:	c3                   	ret
+
+00000944 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 944:	55                   	push   %ebp
+ 945:	89 e5                	mov    %esp,%ebp
+ 947:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 94d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 950:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 956:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 95d:	00 00 00 
+  o.used = 0;
+ 960:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 967:	00 00 00 
+  state = 0;
+ 96a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 971:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 974:	83 c0 04             	add    $0x4,%eax
+ 977:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 97a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 981:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 988:	e9 82 01 00 00       	jmp    b0f <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 98d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 990:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 993:	01 d0                	add    %edx,%eax
+ 995:	0f b6 00             	movzbl (%eax),%eax
+ 998:	0f be c0             	movsbl %al,%eax
+ 99b:	25 ff 00 00 00       	and    $0xff,%eax
+ 9a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 9a3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 9a7:	75 38                	jne    9e1 <printf+0x9d>
+      if(c == '%'){
+ 9a9:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9ad:	0f 85 58 01 00 00    	jne    b0b <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 9b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b6:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9bc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9bf:	01 ca                	add    %ecx,%edx
+ 9c1:	83 ec 04             	sub    $0x4,%esp
+ 9c4:	50                   	push   %eax
+ 9c5:	52                   	push   %edx
+ 9c6:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9cc:	50                   	push   %eax
+ 9cd:	e8 39 fd ff ff       	call   70b <put>
+ 9d2:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 9d5:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 9dc:	e9 2a 01 00 00       	jmp    b0b <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 9e1:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 9e5:	0f 85 20 01 00 00    	jne    b0b <printf+0x1c7>
+      if(c == 'd'){
+ 9eb:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 9ef:	75 22                	jne    a13 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 9f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f4:	8b 00                	mov    (%eax),%eax
+ 9f6:	6a 01                	push   $0x1
+ 9f8:	6a 0a                	push   $0xa
+ 9fa:	50                   	push   %eax
+ 9fb:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a01:	50                   	push   %eax
+ a02:	e8 48 fe ff ff       	call   84f <printint>
+ a07:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a0a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a0e:	e9 e8 00 00 00       	jmp    afb <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ a13:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ a17:	74 06                	je     a1f <printf+0xdb>
+ a19:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ a1d:	75 22                	jne    a41 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ a1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a22:	8b 00                	mov    (%eax),%eax
+ a24:	6a 00                	push   $0x0
+ a26:	6a 10                	push   $0x10
+ a28:	50                   	push   %eax
+ a29:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a2f:	50                   	push   %eax
+ a30:	e8 1a fe ff ff       	call   84f <printint>
+ a35:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a38:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a3c:	e9 ba 00 00 00       	jmp    afb <printf+0x1b7>
+      } else if(c == 's'){
+ a41:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ a45:	75 3f                	jne    a86 <printf+0x142>
+        s = (char*)*ap;
+ a47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a4a:	8b 00                	mov    (%eax),%eax
+ a4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a4f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ a53:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a57:	75 07                	jne    a60 <printf+0x11c>
+          s = "(null)";
+ a59:	c7 45 f4 15 11 00 00 	movl   $0x1115,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a60:	83 ec 0c             	sub    $0xc,%esp
+ a63:	ff 75 f4             	push   -0xc(%ebp)
+ a66:	e8 47 f8 ff ff       	call   2b2 <strlen>
+ a6b:	83 c4 10             	add    $0x10,%esp
+ a6e:	83 ec 04             	sub    $0x4,%esp
+ a71:	50                   	push   %eax
+ a72:	ff 75 f4             	push   -0xc(%ebp)
+ a75:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a7b:	50                   	push   %eax
+ a7c:	e8 8a fc ff ff       	call   70b <put>
+ a81:	83 c4 10             	add    $0x10,%esp
+ a84:	eb 75                	jmp    afb <printf+0x1b7>
+      } else if(c == 'c'){
+ a86:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a8a:	75 21                	jne    aad <printf+0x169>
+        putc(&o, *ap);
+ a8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a8f:	8b 00                	mov    (%eax),%eax
+ a91:	0f be c0             	movsbl %al,%eax
+ a94:	83 ec 08             	sub    $0x8,%esp
+ a97:	50                   	push   %eax
+ a98:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a9e:	50                   	push   %eax
+ a9f:	e8 58 fd ff ff       	call   7fc <putc>
+ aa4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ aa7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ aab:	eb 4e                	jmp    afb <printf+0x1b7>
+      } else if(c == '%'){
+ aad:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ ab1:	75 1b                	jne    ace <printf+0x18a>
+        putc(&o, c);
+ ab3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ab6:	0f be c0             	movsbl %al,%eax
+ ab9:	83 ec 08             	sub    $0x8,%esp
+ abc:	50                   	push   %eax
+ abd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ac3:	50                   	push   %eax
+ ac4:	e8 33 fd ff ff       	call   7fc <putc>
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	eb 2d                	jmp    afb <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ ace:	83 ec 08             	sub    $0x8,%esp
+ ad1:	6a 25                	push   $0x25
+ ad3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ad9:	50                   	push   %eax
+ ada:	e8 1d fd ff ff       	call   7fc <putc>
+ adf:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ ae2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ae5:	0f be c0             	movsbl %al,%eax
+ ae8:	83 ec 08             	sub    $0x8,%esp
+ aeb:	50                   	push   %eax
+ aec:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ af2:	50                   	push   %eax
+ af3:	e8 04 fd ff ff       	call   7fc <putc>
+ af8:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ afb:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ b02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b05:	83 c0 01             	add    $0x1,%eax
+ b08:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b0b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b15:	01 d0                	add    %edx,%eax
+ b17:	0f b6 00             	movzbl (%eax),%eax
+ b1a:	84 c0                	test   %al,%al
+ b1c:	0f 85 6b fe ff ff    	jne    98d <printf+0x49>
+    }
+  }
+  if(state == 0)
+ b22:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ b26:	75 22                	jne    b4a <printf+0x206>
+    put(&o, fmt + start, i - start);
+ b28:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b2b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b31:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b34:	01 ca                	add    %ecx,%edx
+ b36:	83 ec 04             	sub    $0x4,%esp
+ b39:	50                   	push   %eax
+ b3a:	52                   	push   %edx
+ b3b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b41:	50                   	push   %eax
+ b42:	e8 c4 fb ff ff       	call   70b <put>
+ b47:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ b4a:	83 ec 0c             	sub    $0xc,%esp
+ b4d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b53:	50                   	push   %eax
+ b54:	e8 69 fb ff ff       	call   6c2 <flush>
+ b59:	83 c4 10             	add    $0x10,%esp
+}
+ b5c:	90                   	nop
+ b5d:	c9                   	leave
+ b5e:	c3                   	ret
+
+00000b5f <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b5f:	55                   	push   %ebp
+ b60:	89 e5                	mov    %esp,%ebp
+ b62:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b65:	8b 55 08             	mov    0x8(%ebp),%edx
+ b68:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b6b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b6e:	f0 87 02             	lock xchg %eax,(%edx)
+ b71:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b77:	c9                   	leave
+ b78:	c3                   	ret
+
+00000b79 <lock>:
+{
+ b79:	55                   	push   %ebp
+ b7a:	89 e5                	mov    %esp,%ebp
+ b7c:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b7f:	a1 b8 14 00 00       	mov    0x14b8,%eax
+ b84:	85 c0                	test   %eax,%eax
+ b86:	74 09                	je     b91 <lock+0x18>
+ b88:	a1 b8 14 00 00       	mov    0x14b8,%eax
+ b8d:	ff d0                	call   *%eax
+ b8f:	eb 05                	jmp    b96 <lock+0x1d>
+ b91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b99:	90                   	nop
+ b9a:	83 ec 08             	sub    $0x8,%esp
+ b9d:	6a 01                	push   $0x1
+ b9f:	68 f0 14 00 00       	push   $0x14f0
+ ba4:	e8 b6 ff ff ff       	call   b5f <xchg>
+ ba9:	83 c4 10             	add    $0x10,%esp
+ bac:	85 c0                	test   %eax,%eax
+ bae:	75 ea                	jne    b9a <lock+0x21>
+  return pin;
+ bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ bb3:	c9                   	leave
+ bb4:	c3                   	ret
+
+00000bb5 <unlock>:
+{
+ bb5:	55                   	push   %ebp
+ bb6:	89 e5                	mov    %esp,%ebp
+ bb8:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ bbb:	6a 00                	push   $0x0
+ bbd:	68 f0 14 00 00       	push   $0x14f0
+ bc2:	e8 98 ff ff ff       	call   b5f <xchg>
+ bc7:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ bca:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bce:	78 10                	js     be0 <unlock+0x2b>
+    mallocunpin(pin);
+ bd0:	a1 bc 14 00 00       	mov    0x14bc,%eax
+ bd5:	83 ec 0c             	sub    $0xc,%esp
+ bd8:	ff 75 08             	push   0x8(%ebp)
+ bdb:	ff d0                	call   *%eax
+ bdd:	83 c4 10             	add    $0x10,%esp
+}
+ be0:	90                   	nop
+ be1:	c9                   	leave
+ be2:	c3                   	ret
+
+00000be3 <sizeclass>:
+{
+ be3:	55                   	push   %ebp
+ be4:	89 e5                	mov    %esp,%ebp
+ be6:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ be9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ bf0:	eb 1c                	jmp    c0e <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ bf2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf5:	ba 02 00 00 00       	mov    $0x2,%edx
+ bfa:	89 c1                	mov    %eax,%ecx
+ bfc:	d3 e2                	shl    %cl,%edx
+ bfe:	89 d0                	mov    %edx,%eax
+ c00:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c03:	72 05                	jb     c0a <sizeclass+0x27>
+      return c;
+ c05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c08:	eb 0f                	jmp    c19 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ c0a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ c0e:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ c12:	7e de                	jle    bf2 <sizeclass+0xf>
+  return -1;
+ c14:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ c19:	c9                   	leave
+ c1a:	c3                   	ret
+
+00000c1b <bigfree>:
+{
+ c1b:	55                   	push   %ebp
+ c1c:	89 e5                	mov    %esp,%ebp
+ c1e:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c21:	a1 c8 14 00 00       	mov    0x14c8,%eax
+ c26:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c29:	eb 24                	jmp    c4f <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2e:	8b 00                	mov    (%eax),%eax
+ c30:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c33:	72 12                	jb     c47 <bigfree+0x2c>
+ c35:	8b 45 08             	mov    0x8(%ebp),%eax
+ c38:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c3b:	72 24                	jb     c61 <bigfree+0x46>
+ c3d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c40:	8b 00                	mov    (%eax),%eax
+ c42:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c45:	72 1a                	jb     c61 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4a:	8b 00                	mov    (%eax),%eax
+ c4c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c52:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c55:	73 d4                	jae    c2b <bigfree+0x10>
+ c57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5a:	8b 00                	mov    (%eax),%eax
+ c5c:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c5f:	73 ca                	jae    c2b <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c61:	8b 45 08             	mov    0x8(%ebp),%eax
+ c64:	8b 40 04             	mov    0x4(%eax),%eax
+ c67:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c71:	01 c2                	add    %eax,%edx
+ c73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c76:	8b 00                	mov    (%eax),%eax
+ c78:	39 c2                	cmp    %eax,%edx
+ c7a:	75 24                	jne    ca0 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7f:	8b 50 04             	mov    0x4(%eax),%edx
+ c82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c85:	8b 00                	mov    (%eax),%eax
+ c87:	8b 40 04             	mov    0x4(%eax),%eax
+ c8a:	01 c2                	add    %eax,%edx
+ c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8f:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c95:	8b 00                	mov    (%eax),%eax
+ c97:	8b 10                	mov    (%eax),%edx
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9c:	89 10                	mov    %edx,(%eax)
+ c9e:	eb 0a                	jmp    caa <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ ca0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca3:	8b 10                	mov    (%eax),%edx
+ ca5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca8:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ caa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cad:	8b 40 04             	mov    0x4(%eax),%eax
+ cb0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ cb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cba:	01 d0                	add    %edx,%eax
+ cbc:	39 45 08             	cmp    %eax,0x8(%ebp)
+ cbf:	75 20                	jne    ce1 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ cc1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc4:	8b 50 04             	mov    0x4(%eax),%edx
+ cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+ cca:	8b 40 04             	mov    0x4(%eax),%eax
+ ccd:	01 c2                	add    %eax,%edx
+ ccf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cd2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd8:	8b 10                	mov    (%eax),%edx
+ cda:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cdd:	89 10                	mov    %edx,(%eax)
+ cdf:	eb 08                	jmp    ce9 <bigfree+0xce>
+    p->s.ptr = bp;
+ ce1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+ ce7:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ce9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cec:	a3 c8 14 00 00       	mov    %eax,0x14c8
+}
+ cf1:	90                   	nop
+ cf2:	c9                   	leave
+ cf3:	c3                   	ret
+
+00000cf4 <free>:
+{
+ cf4:	55                   	push   %ebp
+ cf5:	89 e5                	mov    %esp,%ebp
+ cf7:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ cfa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ cfe:	74 68                	je     d68 <free+0x74>
+  bp = (Header*)ap - 1;
+ d00:	8b 45 08             	mov    0x8(%ebp),%eax
+ d03:	83 e8 08             	sub    $0x8,%eax
+ d06:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ d09:	e8 6b fe ff ff       	call   b79 <lock>
+ d0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d14:	8b 40 04             	mov    0x4(%eax),%eax
+ d17:	83 ec 0c             	sub    $0xc,%esp
+ d1a:	50                   	push   %eax
+ d1b:	e8 c3 fe ff ff       	call   be3 <sizeclass>
+ d20:	83 c4 10             	add    $0x10,%esp
+ d23:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d26:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d2a:	78 1e                	js     d4a <free+0x56>
+    bp->s.ptr = classfree[c];
+ d2c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d2f:	8b 14 85 cc 14 00 00 	mov    0x14cc(,%eax,4),%edx
+ d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d39:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ d3b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d3e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d41:	89 14 85 cc 14 00 00 	mov    %edx,0x14cc(,%eax,4)
+ d48:	eb 0e                	jmp    d58 <free+0x64>
+    bigfree(bp);
+ d4a:	83 ec 0c             	sub    $0xc,%esp
+ d4d:	ff 75 f4             	push   -0xc(%ebp)
+ d50:	e8 c6 fe ff ff       	call   c1b <bigfree>
+ d55:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d58:	83 ec 0c             	sub    $0xc,%esp
+ d5b:	ff 75 f0             	push   -0x10(%ebp)
+ d5e:	e8 52 fe ff ff       	call   bb5 <unlock>
+ d63:	83 c4 10             	add    $0x10,%esp
+ d66:	eb 01                	jmp    d69 <free+0x75>
+    return;
+ d68:	90                   	nop
+}
+ d69:	c9                   	leave
+ d6a:	c3                   	ret
+
+00000d6b <morecore>:
+{
+ d6b:	55                   	push   %ebp
+ d6c:	89 e5                	mov    %esp,%ebp
+ d6e:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d71:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d78:	77 07                	ja     d81 <morecore+0x16>
+    nu = 4096;
+ d7a:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d81:	8b 45 08             	mov    0x8(%ebp),%eax
+ d84:	c1 e0 03             	shl    $0x3,%eax
+ d87:	83 ec 0c             	sub    $0xc,%esp
+ d8a:	50                   	push   %eax
+ d8b:	e8 b6 f7 ff ff       	call   546 <sbrk>
+ d90:	83 c4 10             	add    $0x10,%esp
+ d93:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d96:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d9a:	75 07                	jne    da3 <morecore+0x38>
+    return 0;
+ d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+ da1:	eb 22                	jmp    dc5 <morecore+0x5a>
+  hp = (Header*)p;
+ da3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ da9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dac:	8b 55 08             	mov    0x8(%ebp),%edx
+ daf:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ db2:	83 ec 0c             	sub    $0xc,%esp
+ db5:	ff 75 f0             	push   -0x10(%ebp)
+ db8:	e8 5e fe ff ff       	call   c1b <bigfree>
+ dbd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ dc0:	a1 c8 14 00 00       	mov    0x14c8,%eax
+}
+ dc5:	c9                   	leave
+ dc6:	c3                   	ret
+
+00000dc7 <bigalloc>:
+{
+ dc7:	55                   	push   %ebp
+ dc8:	89 e5                	mov    %esp,%ebp
+ dca:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ dcd:	a1 c8 14 00 00       	mov    0x14c8,%eax
+ dd2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dd5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ dd9:	75 23                	jne    dfe <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ ddb:	c7 45 f0 c0 14 00 00 	movl   $0x14c0,-0x10(%ebp)
+ de2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ de5:	a3 c8 14 00 00       	mov    %eax,0x14c8
+ dea:	a1 c8 14 00 00       	mov    0x14c8,%eax
+ def:	a3 c0 14 00 00       	mov    %eax,0x14c0
+    base.s.size = 0;
+ df4:	c7 05 c4 14 00 00 00 	movl   $0x0,0x14c4
+ dfb:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dfe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e01:	8b 00                	mov    (%eax),%eax
+ e03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e09:	8b 40 04             	mov    0x4(%eax),%eax
+ e0c:	3b 45 08             	cmp    0x8(%ebp),%eax
+ e0f:	72 4a                	jb     e5b <bigalloc+0x94>
+      if(p->s.size == nunits)
+ e11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e14:	8b 40 04             	mov    0x4(%eax),%eax
+ e17:	39 45 08             	cmp    %eax,0x8(%ebp)
+ e1a:	75 0c                	jne    e28 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1f:	8b 10                	mov    (%eax),%edx
+ e21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e24:	89 10                	mov    %edx,(%eax)
+ e26:	eb 26                	jmp    e4e <bigalloc+0x87>
+        p->s.size -= nunits;
+ e28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2b:	8b 40 04             	mov    0x4(%eax),%eax
+ e2e:	2b 45 08             	sub    0x8(%ebp),%eax
+ e31:	89 c2                	mov    %eax,%edx
+ e33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e36:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3c:	8b 40 04             	mov    0x4(%eax),%eax
+ e3f:	c1 e0 03             	shl    $0x3,%eax
+ e42:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e48:	8b 55 08             	mov    0x8(%ebp),%edx
+ e4b:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ e4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e51:	a3 c8 14 00 00       	mov    %eax,0x14c8
+      return p;
+ e56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e59:	eb 3b                	jmp    e96 <bigalloc+0xcf>
+    if(p == freep)
+ e5b:	a1 c8 14 00 00       	mov    0x14c8,%eax
+ e60:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e63:	75 1e                	jne    e83 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e65:	83 ec 0c             	sub    $0xc,%esp
+ e68:	ff 75 08             	push   0x8(%ebp)
+ e6b:	e8 fb fe ff ff       	call   d6b <morecore>
+ e70:	83 c4 10             	add    $0x10,%esp
+ e73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e76:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e7a:	75 07                	jne    e83 <bigalloc+0xbc>
+        return 0;
+ e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+ e81:	eb 13                	jmp    e96 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e86:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8c:	8b 00                	mov    (%eax),%eax
+ e8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e91:	e9 70 ff ff ff       	jmp    e06 <bigalloc+0x3f>
+}
+ e96:	c9                   	leave
+ e97:	c3                   	ret
+
+00000e98 <alloc>:
+alloc(uint nbytes)
+{
+ e98:	55                   	push   %ebp
+ e99:	89 e5                	mov    %esp,%ebp
+ e9b:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+ ea1:	83 c0 07             	add    $0x7,%eax
+ ea4:	c1 e8 03             	shr    $0x3,%eax
+ ea7:	83 c0 01             	add    $0x1,%eax
+ eaa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ ead:	ff 75 f4             	push   -0xc(%ebp)
+ eb0:	e8 2e fd ff ff       	call   be3 <sizeclass>
+ eb5:	83 c4 04             	add    $0x4,%esp
+ eb8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ebb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ebf:	79 2c                	jns    eed <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ ec1:	83 ec 0c             	sub    $0xc,%esp
+ ec4:	ff 75 f4             	push   -0xc(%ebp)
+ ec7:	e8 fb fe ff ff       	call   dc7 <bigalloc>
+ ecc:	83 c4 10             	add    $0x10,%esp
+ ecf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ed2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ed6:	75 0a                	jne    ee2 <alloc+0x4a>
+      return 0;
+ ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+ edd:	e9 c8 00 00 00       	jmp    faa <alloc+0x112>
+    return (void*)(p + 1);
+ ee2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ee5:	83 c0 08             	add    $0x8,%eax
+ ee8:	e9 bd 00 00 00       	jmp    faa <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ eed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ef0:	8b 04 85 cc 14 00 00 	mov    0x14cc(,%eax,4),%eax
+ ef7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ efa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ efe:	74 1a                	je     f1a <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ f00:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f03:	8b 10                	mov    (%eax),%edx
+ f05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f08:	89 14 85 cc 14 00 00 	mov    %edx,0x14cc(,%eax,4)
+    return (void*)(p + 1);
+ f0f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f12:	83 c0 08             	add    $0x8,%eax
+ f15:	e9 90 00 00 00       	jmp    faa <alloc+0x112>
+  }
+  nunits = 2 << c;
+ f1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f1d:	ba 02 00 00 00       	mov    $0x2,%edx
+ f22:	89 c1                	mov    %eax,%ecx
+ f24:	d3 e2                	shl    %cl,%edx
+ f26:	89 d0                	mov    %edx,%eax
+ f28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ f2b:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ f30:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f33:	c1 e2 03             	shl    $0x3,%edx
+ f36:	01 d0                	add    %edx,%eax
+ f38:	8b 15 ec 14 00 00    	mov    0x14ec,%edx
+ f3e:	39 c2                	cmp    %eax,%edx
+ f40:	73 3f                	jae    f81 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ f42:	83 ec 0c             	sub    $0xc,%esp
+ f45:	68 00 08 00 00       	push   $0x800
+ f4a:	e8 78 fe ff ff       	call   dc7 <bigalloc>
+ f4f:	83 c4 10             	add    $0x10,%esp
+ f52:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ f55:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f59:	75 07                	jne    f62 <alloc+0xca>
+      return 0;
+ f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+ f60:	eb 48                	jmp    faa <alloc+0x112>
+    bump = (char*)p;
+ f62:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f65:	a3 e8 14 00 00       	mov    %eax,0x14e8
+    bumpend = (char*)(p + p->s.size);
+ f6a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f6d:	8b 40 04             	mov    0x4(%eax),%eax
+ f70:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f7a:	01 d0                	add    %edx,%eax
+ f7c:	a3 ec 14 00 00       	mov    %eax,0x14ec
+  }
+  p = (Header*)bump;
+ f81:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ f86:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f89:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ f8e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f91:	c1 e2 03             	shl    $0x3,%edx
+ f94:	01 d0                	add    %edx,%eax
+ f96:	a3 e8 14 00 00       	mov    %eax,0x14e8
+  p->s.size = nunits;
+ f9b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f9e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ fa1:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ fa4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ fa7:	83 c0 08             	add    $0x8,%eax
+}
+ faa:	c9                   	leave
+ fab:	c3                   	ret
+
+00000fac <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ fac:	55                   	push   %ebp
+ fad:	89 e5                	mov    %esp,%ebp
+ faf:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ fb2:	e8 c2 fb ff ff       	call   b79 <lock>
+ fb7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ fba:	83 ec 0c             	sub    $0xc,%esp
+ fbd:	ff 75 08             	push   0x8(%ebp)
+ fc0:	e8 d3 fe ff ff       	call   e98 <alloc>
+ fc5:	83 c4 10             	add    $0x10,%esp
+ fc8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ fcb:	83 ec 0c             	sub    $0xc,%esp
+ fce:	ff 75 f4             	push   -0xc(%ebp)
+ fd1:	e8 df fb ff ff       	call   bb5 <unlock>
+ fd6:	83 c4 10             	add    $0x10,%esp
+  return p;
+ fd9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fdc:	c9                   	leave
+ fdd:	c3                   	ret
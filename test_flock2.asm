@@ -0,0 +1,1948 @@
+
+_test_flock2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 14 04 00 00    	sub    $0x414,%esp
+  14:	89 c8                	mov    %ecx,%eax
+  int fd;
+  char *password = argv[1];
+  16:	8b 50 04             	mov    0x4(%eax),%edx
+  19:	8b 52 04             	mov    0x4(%edx),%edx
+  1c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  char *path = argv[2];
+  1f:	8b 50 04             	mov    0x4(%eax),%edx
+  22:	8b 52 08             	mov    0x8(%edx),%edx
+  25:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  char buf[1024];
+
+  if(argc != 3){
+  28:	83 38 03             	cmpl   $0x3,(%eax)
+  2b:	74 17                	je     44 <main+0x44>
+    printf(1, "usage: test_flock2 password path\n");
+  2d:	83 ec 08             	sub    $0x8,%esp
+  30:	68 a4 0f 00 00       	push   $0xfa4
+  35:	6a 01                	push   $0x1
+  37:	e8 cd 08 00 00       	call   909 <printf>
+  3c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  3f:	e8 35 04 00 00       	call   479 <exit>
+  }
+
+  fprot(path, password);
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	ff 75 f4             	push   -0xc(%ebp)
+  4a:	ff 75 f0             	push   -0x10(%ebp)
+  4d:	e8 eb 04 00 00       	call   53d <fprot>
+  52:	83 c4 10             	add    $0x10,%esp
+
+  if(fork() == 0){
+  55:	e8 18 04 00 00       	call   472 <fork>
+  5a:	85 c0                	test   %eax,%eax
+  5c:	0f 85 c5 00 00 00    	jne    127 <main+0x127>
+    // Child
+
+    funlock(path, password);
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	ff 75 f4             	push   -0xc(%ebp)
+  68:	ff 75 f0             	push   -0x10(%ebp)
+  6b:	e8 e1 04 00 00       	call   551 <funlock>
+  70:	83 c4 10             	add    $0x10,%esp
+    fd = open(path, 0);
+  73:	83 ec 08             	sub    $0x8,%esp
+  76:	6a 00                	push   $0x0
+  78:	ff 75 f0             	push   -0x10(%ebp)
+  7b:	e8 31 04 00 00       	call   4b1 <open>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+  86:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  8a:	79 1a                	jns    a6 <main+0xa6>
+      printf(1, "child error opening file: %s\n", path);
+  8c:	83 ec 04             	sub    $0x4,%esp
+  8f:	ff 75 f0             	push   -0x10(%ebp)
+  92:	68 c6 0f 00 00       	push   $0xfc6
+  97:	6a 01                	push   $0x1
+  99:	e8 6b 08 00 00       	call   909 <printf>
+  9e:	83 c4 10             	add    $0x10,%esp
+      exit();
+  a1:	e8 d3 03 00 00       	call   479 <exit>
+    }
+    if(read(fd, buf, 1024) < 0){
+  a6:	83 ec 04             	sub    $0x4,%esp
+  a9:	68 00 04 00 00       	push   $0x400
+  ae:	8d 85 ec fb ff ff    	lea    -0x414(%ebp),%eax
+  b4:	50                   	push   %eax
+  b5:	ff 75 ec             	push   -0x14(%ebp)
+  b8:	e8 d1 03 00 00       	call   48e <read>
+  bd:	83 c4 10             	add    $0x10,%esp
+  c0:	85 c0                	test   %eax,%eax
+  c2:	79 1a                	jns    de <main+0xde>
+      printf(1, "child error reading file: %s\n", path);
+  c4:	83 ec 04             	sub    $0x4,%esp
+  c7:	ff 75 f0             	push   -0x10(%ebp)
+  ca:	68 e4 0f 00 00       	push   $0xfe4
+  cf:	6a 01                	push   $0x1
+  d1:	e8 33 08 00 00       	call   909 <printf>
+  d6:	83 c4 10             	add    $0x10,%esp
+      exit();
+  d9:	e8 9b 03 00 00       	call   479 <exit>
+    }
+    printf(1, "%s\n", buf);
+  de:	83 ec 04             	sub    $0x4,%esp
+  e1:	8d 85 ec fb ff ff    	lea    -0x414(%ebp),%eax
+  e7:	50                   	push   %eax
+  e8:	68 02 10 00 00       	push   $0x1002
+  ed:	6a 01                	push   $0x1
+  ef:	e8 15 08 00 00       	call   909 <printf>
+  f4:	83 c4 10             	add    $0x10,%esp
+    if(close(fd) < 0){
+  f7:	83 ec 0c             	sub    $0xc,%esp
+  fa:	ff 75 ec             	push   -0x14(%ebp)
+  fd:	e8 9a 03 00 00       	call   49c <close>
+ 102:	83 c4 10             	add    $0x10,%esp
+ 105:	85 c0                	test   %eax,%eax
+ 107:	0f 89 d0 00 00 00    	jns    1dd <main+0x1dd>
+      printf(1, "child error closing file: %s\n", path);
+ 10d:	83 ec 04             	sub    $0x4,%esp
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	68 06 10 00 00       	push   $0x1006
+ 118:	6a 01                	push   $0x1
+ 11a:	e8 ea 07 00 00       	call   909 <printf>
+ 11f:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 122:	e8 52 03 00 00       	call   479 <exit>
+    }
+  } else {
+    // Parent
+    wait();
+ 127:	e8 54 03 00 00       	call   480 <wait>
+
+    printf(1, "parent opening file...\n");
+ 12c:	83 ec 08             	sub    $0x8,%esp
+ 12f:	68 24 10 00 00       	push   $0x1024
+ 134:	6a 01                	push   $0x1
+ 136:	e8 ce 07 00 00       	call   909 <printf>
+ 13b:	83 c4 10             	add    $0x10,%esp
+
+    fd = open(path, 0);
+ 13e:	83 ec 08             	sub    $0x8,%esp
+ 141:	6a 00                	push   $0x0
+ 143:	ff 75 f0             	push   -0x10(%ebp)
+ 146:	e8 66 03 00 00       	call   4b1 <open>
+ 14b:	83 c4 10             	add    $0x10,%esp
+ 14e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+ 151:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 155:	79 17                	jns    16e <main+0x16e>
+      printf(1, "parent error opening file: %s\n", path);
+ 157:	83 ec 04             	sub    $0x4,%esp
+ 15a:	ff 75 f0             	push   -0x10(%ebp)
+ 15d:	68 3c 10 00 00       	push   $0x103c
+ 162:	6a 01                	push   $0x1
+ 164:	e8 a0 07 00 00       	call   909 <printf>
+ 169:	83 c4 10             	add    $0x10,%esp
+ 16c:	eb 0e                	jmp    17c <main+0x17c>
+    } else {
+      close(fd);
+ 16e:	83 ec 0c             	sub    $0xc,%esp
+ 171:	ff 75 ec             	push   -0x14(%ebp)
+ 174:	e8 23 03 00 00       	call   49c <close>
+ 179:	83 c4 10             	add    $0x10,%esp
+    }
+
+    printf(1, "parent trying to unprotect with wrong password...\n");
+ 17c:	83 ec 08             	sub    $0x8,%esp
+ 17f:	68 5c 10 00 00       	push   $0x105c
+ 184:	6a 01                	push   $0x1
+ 186:	e8 7e 07 00 00       	call   909 <printf>
+ 18b:	83 c4 10             	add    $0x10,%esp
+    if(funprot(path, "wrong") == 0) {
+ 18e:	83 ec 08             	sub    $0x8,%esp
+ 191:	68 8f 10 00 00       	push   $0x108f
+ 196:	ff 75 f0             	push   -0x10(%ebp)
+ 199:	e8 a9 03 00 00       	call   547 <funprot>
+ 19e:	83 c4 10             	add    $0x10,%esp
+ 1a1:	85 c0                	test   %eax,%eax
+ 1a3:	75 14                	jne    1b9 <main+0x1b9>
+      printf(1, "ok\n");
+ 1a5:	83 ec 08             	sub    $0x8,%esp
+ 1a8:	68 95 10 00 00       	push   $0x1095
+ 1ad:	6a 01                	push   $0x1
+ 1af:	e8 55 07 00 00       	call   909 <printf>
+ 1b4:	83 c4 10             	add    $0x10,%esp
+ 1b7:	eb 12                	jmp    1cb <main+0x1cb>
+    } else {
+      printf(1, "failed\n");
+ 1b9:	83 ec 08             	sub    $0x8,%esp
+ 1bc:	68 99 10 00 00       	push   $0x1099
+ 1c1:	6a 01                	push   $0x1
+ 1c3:	e8 41 07 00 00       	call   909 <printf>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+    }
+
+    printf(1, "parent leaving file unprotected\n");
+ 1cb:	83 ec 08             	sub    $0x8,%esp
+ 1ce:	68 a4 10 00 00       	push   $0x10a4
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	e8 2f 07 00 00       	call   909 <printf>
+ 1da:	83 c4 10             	add    $0x10,%esp
+  }
+
+  exit();
+ 1dd:	e8 97 02 00 00       	call   479 <exit>
+
+000001e2 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e2:	55                   	push   %ebp
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	57                   	push   %edi
+ 1e6:	53                   	push   %ebx
+    if(cc < 1)
+ 1e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1ea:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f0:	89 cb                	mov    %ecx,%ebx
+ 1f2:	89 df                	mov    %ebx,%edi
+ 1f4:	89 d1                	mov    %edx,%ecx
+ 1f6:	fc                   	cld
+ 1f7:	f3 aa                	rep stos %al,%es:(%edi)
+ 1f9:	89 ca                	mov    %ecx,%edx
+ 1fb:	89 fb                	mov    %edi,%ebx
+ 1fd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 200:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 203:	90                   	nop
+ 204:	5b                   	pop    %ebx
+ 205:	5f                   	pop    %edi
+ 206:	5d                   	pop    %ebp
+ 207:	c3                   	ret
+
+00000208 <strcpy>:
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 214:	90                   	nop
+ 215:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 218:	8d 42 01             	lea    0x1(%edx),%eax
+ 21b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 21e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 221:	8d 48 01             	lea    0x1(%eax),%ecx
+ 224:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 227:	0f b6 12             	movzbl (%edx),%edx
+ 22a:	88 10                	mov    %dl,(%eax)
+ 22c:	0f b6 00             	movzbl (%eax),%eax
+ 22f:	84 c0                	test   %al,%al
+ 231:	75 e2                	jne    215 <strcpy+0xd>
+  return os;
+ 233:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 236:	c9                   	leave
+ 237:	c3                   	ret
+
+00000238 <strcmp>:
+{
+ 238:	55                   	push   %ebp
+ 239:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 23b:	eb 08                	jmp    245 <strcmp+0xd>
+    p++, q++;
+ 23d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 241:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 245:	8b 45 08             	mov    0x8(%ebp),%eax
+ 248:	0f b6 00             	movzbl (%eax),%eax
+ 24b:	84 c0                	test   %al,%al
+ 24d:	74 10                	je     25f <strcmp+0x27>
+ 24f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 252:	0f b6 10             	movzbl (%eax),%edx
+ 255:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 258:	0f b6 00             	movzbl (%eax),%eax
+ 25b:	38 c2                	cmp    %al,%dl
+ 25d:	74 de                	je     23d <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 25f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 262:	0f b6 00             	movzbl (%eax),%eax
+ 265:	0f b6 d0             	movzbl %al,%edx
+ 268:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	0f b6 c0             	movzbl %al,%eax
+ 271:	29 c2                	sub    %eax,%edx
+ 273:	89 d0                	mov    %edx,%eax
+}
+ 275:	5d                   	pop    %ebp
+ 276:	c3                   	ret
+
+00000277 <strlen>:
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 27d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 284:	eb 04                	jmp    28a <strlen+0x13>
+ 286:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 28a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 28d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 290:	01 d0                	add    %edx,%eax
+ 292:	0f b6 00             	movzbl (%eax),%eax
+ 295:	84 c0                	test   %al,%al
+ 297:	75 ed                	jne    286 <strlen+0xf>
+  return n;
+ 299:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 29c:	c9                   	leave
+ 29d:	c3                   	ret
+
+0000029e <memset>:
+{
+ 29e:	55                   	push   %ebp
+ 29f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2a1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a4:	50                   	push   %eax
+ 2a5:	ff 75 0c             	push   0xc(%ebp)
+ 2a8:	ff 75 08             	push   0x8(%ebp)
+ 2ab:	e8 32 ff ff ff       	call   1e2 <stosb>
+ 2b0:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b6:	c9                   	leave
+ 2b7:	c3                   	ret
+
+000002b8 <strchr>:
+{
+ 2b8:	55                   	push   %ebp
+ 2b9:	89 e5                	mov    %esp,%ebp
+ 2bb:	83 ec 04             	sub    $0x4,%esp
+ 2be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c1:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2c4:	eb 14                	jmp    2da <strchr+0x22>
+    if(*s == c)
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c9:	0f b6 00             	movzbl (%eax),%eax
+ 2cc:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2cf:	75 05                	jne    2d6 <strchr+0x1e>
+      return (char*)s;
+ 2d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d4:	eb 13                	jmp    2e9 <strchr+0x31>
+  for(; *s; s++)
+ 2d6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2dd:	0f b6 00             	movzbl (%eax),%eax
+ 2e0:	84 c0                	test   %al,%al
+ 2e2:	75 e2                	jne    2c6 <strchr+0xe>
+  return 0;
+ 2e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2e9:	c9                   	leave
+ 2ea:	c3                   	ret
+
+000002eb <gets>:
+{
+ 2eb:	55                   	push   %ebp
+ 2ec:	89 e5                	mov    %esp,%ebp
+ 2ee:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2f8:	eb 42                	jmp    33c <gets+0x51>
+    cc = read(0, &c, 1);
+ 2fa:	83 ec 04             	sub    $0x4,%esp
+ 2fd:	6a 01                	push   $0x1
+ 2ff:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 302:	50                   	push   %eax
+ 303:	6a 00                	push   $0x0
+ 305:	e8 84 01 00 00       	call   48e <read>
+ 30a:	83 c4 10             	add    $0x10,%esp
+ 30d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 310:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 314:	7e 33                	jle    349 <gets+0x5e>
+    buf[i++] = c;
+ 316:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 319:	8d 50 01             	lea    0x1(%eax),%edx
+ 31c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 31f:	89 c2                	mov    %eax,%edx
+ 321:	8b 45 08             	mov    0x8(%ebp),%eax
+ 324:	01 c2                	add    %eax,%edx
+ 326:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 32a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 32c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 330:	3c 0a                	cmp    $0xa,%al
+ 332:	74 16                	je     34a <gets+0x5f>
+ 334:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 338:	3c 0d                	cmp    $0xd,%al
+ 33a:	74 0e                	je     34a <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 33c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33f:	83 c0 01             	add    $0x1,%eax
+ 342:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 345:	7f b3                	jg     2fa <gets+0xf>
+ 347:	eb 01                	jmp    34a <gets+0x5f>
+      break;
+ 349:	90                   	nop
+  }
+  buf[i] = '\0';
+ 34a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	01 d0                	add    %edx,%eax
+ 352:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 358:	c9                   	leave
+ 359:	c3                   	ret
+
+0000035a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 35a:	55                   	push   %ebp
+ 35b:	89 e5                	mov    %esp,%ebp
+ 35d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 360:	83 ec 08             	sub    $0x8,%esp
+ 363:	6a 00                	push   $0x0
+ 365:	ff 75 08             	push   0x8(%ebp)
+ 368:	e8 44 01 00 00       	call   4b1 <open>
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 373:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 377:	79 07                	jns    380 <stat+0x26>
+    return -1;
+ 379:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 37e:	eb 25                	jmp    3a5 <stat+0x4b>
+  r = fstat(fd, st);
+ 380:	83 ec 08             	sub    $0x8,%esp
+ 383:	ff 75 0c             	push   0xc(%ebp)
+ 386:	ff 75 f4             	push   -0xc(%ebp)
+ 389:	e8 41 01 00 00       	call   4cf <fstat>
+ 38e:	83 c4 10             	add    $0x10,%esp
+ 391:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 394:	83 ec 0c             	sub    $0xc,%esp
+ 397:	ff 75 f4             	push   -0xc(%ebp)
+ 39a:	e8 fd 00 00 00       	call   49c <close>
+ 39f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3a5:	c9                   	leave
+ 3a6:	c3                   	ret
+
+000003a7 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a7:	55                   	push   %ebp
+ 3a8:	89 e5                	mov    %esp,%ebp
+ 3aa:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b4:	eb 25                	jmp    3db <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3b6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3b9:	89 d0                	mov    %edx,%eax
+ 3bb:	c1 e0 02             	shl    $0x2,%eax
+ 3be:	01 d0                	add    %edx,%eax
+ 3c0:	01 c0                	add    %eax,%eax
+ 3c2:	89 c1                	mov    %eax,%ecx
+ 3c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 3ca:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3cd:	0f b6 00             	movzbl (%eax),%eax
+ 3d0:	0f be c0             	movsbl %al,%eax
+ 3d3:	01 c8                	add    %ecx,%eax
+ 3d5:	83 e8 30             	sub    $0x30,%eax
+ 3d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3de:	0f b6 00             	movzbl (%eax),%eax
+ 3e1:	3c 2f                	cmp    $0x2f,%al
+ 3e3:	7e 0a                	jle    3ef <atoi+0x48>
+ 3e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e8:	0f b6 00             	movzbl (%eax),%eax
+ 3eb:	3c 39                	cmp    $0x39,%al
+ 3ed:	7e c7                	jle    3b6 <atoi+0xf>
+  return n;
+ 3ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3f2:	c9                   	leave
+ 3f3:	c3                   	ret
+
+000003f4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3f4:	55                   	push   %ebp
+ 3f5:	89 e5                	mov    %esp,%ebp
+ 3f7:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 400:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 403:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 406:	eb 17                	jmp    41f <memmove+0x2b>
+    *dst++ = *src++;
+ 408:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 40b:	8d 42 01             	lea    0x1(%edx),%eax
+ 40e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 411:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 414:	8d 48 01             	lea    0x1(%eax),%ecx
+ 417:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 41a:	0f b6 12             	movzbl (%edx),%edx
+ 41d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 41f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 422:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 425:	89 55 10             	mov    %edx,0x10(%ebp)
+ 428:	85 c0                	test   %eax,%eax
+ 42a:	7f dc                	jg     408 <memmove+0x14>
+  return vdst;
+ 42c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 42f:	c9                   	leave
+ 430:	c3                   	ret
+
+00000431 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 431:	83 3d 50 14 00 00 00 	cmpl   $0x0,0x1450
+  jg 2f
+ 438:	7f 2e                	jg     468 <dosyscall+0x37>
+  jl 1f
+ 43a:	7c 29                	jl     465 <dosyscall+0x34>
+  pushl %eax
+ 43c:	50                   	push   %eax
+  pushl %ebx
+ 43d:	53                   	push   %ebx
+  movl $1, %eax
+ 43e:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 443:	0f a2                	cpuid
+  popl %ebx
+ 445:	5b                   	pop    %ebx
+  popl %eax
+ 446:	58                   	pop    %eax
+  movl $-1, sysmode
+ 447:	c7 05 50 14 00 00 ff 	movl   $0xffffffff,0x1450
+ 44e:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 451:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 457:	74 0c                	je     465 <dosyscall+0x34>
+  movl $1, sysmode
+ 459:	c7 05 50 14 00 00 01 	movl   $0x1,0x1450
+ 460:	00 00 00 
+  jmp 2f
+ 463:	eb 03                	jmp    468 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 465:	cd 40                	int    $0x40
+  ret
+ 467:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 468:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 46a:	ba 71 04 00 00       	mov    $0x471,%edx
+  sysenter
+ 46f:	0f 34                	sysenter
+3:
+  ret
+ 471:	c3                   	ret
+
+00000472 <fork>:
+
+SYSCALL(fork)
+ 472:	b8 01 00 00 00       	mov    $0x1,%eax
+ 477:	eb b8                	jmp    431 <dosyscall>
+
+00000479 <exit>:
+SYSCALL(exit)
+ 479:	b8 02 00 00 00       	mov    $0x2,%eax
+ 47e:	eb b1                	jmp    431 <dosyscall>
+
+00000480 <wait>:
+SYSCALL(wait)
+ 480:	b8 03 00 00 00       	mov    $0x3,%eax
+ 485:	eb aa                	jmp    431 <dosyscall>
+
+00000487 <pipe>:
+SYSCALL(pipe)
+ 487:	b8 04 00 00 00       	mov    $0x4,%eax
+ 48c:	eb a3                	jmp    431 <dosyscall>
+
+0000048e <read>:
+SYSCALL(read)
+ 48e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 493:	eb 9c                	jmp    431 <dosyscall>
+
+00000495 <write>:
+SYSCALL(write)
+ 495:	b8 10 00 00 00       	mov    $0x10,%eax
+ 49a:	eb 95                	jmp    431 <dosyscall>
+
+0000049c <close>:
+SYSCALL(close)
+ 49c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a1:	eb 8e                	jmp    431 <dosyscall>
+
+000004a3 <kill>:
+SYSCALL(kill)
+ 4a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a8:	eb 87                	jmp    431 <dosyscall>
+
+000004aa <exec>:
+SYSCALL(exec)
+ 4aa:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4af:	eb 80                	jmp    431 <dosyscall>
+
+000004b1 <open>:
+SYSCALL(open)
+ 4b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b6:	e9 76 ff ff ff       	jmp    431 <dosyscall>
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	e9 6c ff ff ff       	jmp    431 <dosyscall>
+
+000004c5 <unlink>:
+SYSCALL(unlink)
+ 4c5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ca:	e9 62 ff ff ff       	jmp    431 <dosyscall>
+
+000004cf <fstat>:
+SYSCALL(fstat)
+ 4cf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d4:	e9 58 ff ff ff       	jmp    431 <dosyscall>
+
+000004d9 <link>:
+SYSCALL(link)
+ 4d9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4de:	e9 4e ff ff ff       	jmp    431 <dosyscall>
+
+000004e3 <mkdir>:
+SYSCALL(mkdir)
+ 4e3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e8:	e9 44 ff ff ff       	jmp    431 <dosyscall>
+
+000004ed <chdir>:
+SYSCALL(chdir)
+ 4ed:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f2:	e9 3a ff ff ff       	jmp    431 <dosyscall>
+
+000004f7 <dup>:
+SYSCALL(dup)
+ 4f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fc:	e9 30 ff ff ff       	jmp    431 <dosyscall>
+
+00000501 <getpid>:
+SYSCALL(getpid)
+ 501:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 506:	e9 26 ff ff ff       	jmp    431 <dosyscall>
+
+0000050b <sbrk>:
+SYSCALL(sbrk)
+ 50b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 510:	e9 1c ff ff ff       	jmp    431 <dosyscall>
+
+00000515 <sleep>:
+SYSCALL(sleep)
+ 515:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 51a:	e9 12 ff ff ff       	jmp    431 <dosyscall>
+
+0000051f <uptime>:
+SYSCALL(uptime)
+ 51f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 524:	e9 08 ff ff ff       	jmp    431 <dosyscall>
+
+00000529 <symlink>:
+SYSCALL(symlink)
+ 529:	b8 16 00 00 00       	mov    $0x16,%eax
+ 52e:	e9 fe fe ff ff       	jmp    431 <dosyscall>
+
+00000533 <readlink>:
+SYSCALL(readlink)
+ 533:	b8 17 00 00 00       	mov    $0x17,%eax
+ 538:	e9 f4 fe ff ff       	jmp    431 <dosyscall>
+
+0000053d <fprot>:
+SYSCALL(fprot)
+ 53d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 542:	e9 ea fe ff ff       	jmp    431 <dosyscall>
+
+00000547 <funprot>:
+SYSCALL(funprot)
+ 547:	b8 19 00 00 00       	mov    $0x19,%eax
+ 54c:	e9 e0 fe ff ff       	jmp    431 <dosyscall>
+
+00000551 <funlock>:
+SYSCALL(funlock)
+ 551:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 556:	e9 d6 fe ff ff       	jmp    431 <dosyscall>
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 560:	e9 cc fe ff ff       	jmp    431 <dosyscall>
+
+00000565 <munmap>:
+SYSCALL(munmap)
+ 565:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 56a:	e9 c2 fe ff ff       	jmp    431 <dosyscall>
+
+0000056f <sendfile>:
+SYSCALL(sendfile)
+ 56f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 574:	e9 b8 fe ff ff       	jmp    431 <dosyscall>
+
+00000579 <readv>:
+SYSCALL(readv)
+ 579:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 57e:	e9 ae fe ff ff       	jmp    431 <dosyscall>
+
+00000583 <writev>:
+SYSCALL(writev)
+ 583:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 588:	e9 a4 fe ff ff       	jmp    431 <dosyscall>
+
+0000058d <pread>:
+SYSCALL(pread)
+ 58d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 592:	e9 9a fe ff ff       	jmp    431 <dosyscall>
+
+00000597 <pwrite>:
+SYSCALL(pwrite)
+ 597:	b8 21 00 00 00       	mov    $0x21,%eax
+ 59c:	e9 90 fe ff ff       	jmp    431 <dosyscall>
+
+000005a1 <lseek>:
+SYSCALL(lseek)
+ 5a1:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5a6:	e9 86 fe ff ff       	jmp    431 <dosyscall>
+
+000005ab <spawn>:
+SYSCALL(spawn)
+ 5ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b0:	e9 7c fe ff ff       	jmp    431 <dosyscall>
+
+000005b5 <setpriority>:
+SYSCALL(setpriority)
+ 5b5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5ba:	e9 72 fe ff ff       	jmp    431 <dosyscall>
+
+000005bf <kthread_create>:
+SYSCALL(kthread_create)
+ 5bf:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c4:	e9 68 fe ff ff       	jmp    431 <dosyscall>
+
+000005c9 <kthread_id>:
+SYSCALL(kthread_id)
+ 5c9:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5ce:	e9 5e fe ff ff       	jmp    431 <dosyscall>
+
+000005d3 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 5d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5d8:	e9 54 fe ff ff       	jmp    431 <dosyscall>
+
+000005dd <kthread_join>:
+SYSCALL(kthread_join)
+ 5dd:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5e2:	e9 4a fe ff ff       	jmp    431 <dosyscall>
+
+000005e7 <futex>:
+SYSCALL(futex)
+ 5e7:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5ec:	e9 40 fe ff ff       	jmp    431 <dosyscall>
+
+000005f1 <signal>:
+SYSCALL(signal)
+ 5f1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5f6:	e9 36 fe ff ff       	jmp    431 <dosyscall>
+
+000005fb <alarm>:
+SYSCALL(alarm)
+ 5fb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 600:	e9 2c fe ff ff       	jmp    431 <dosyscall>
+
+00000605 <usleep>:
+SYSCALL(usleep)
+ 605:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 60a:	e9 22 fe ff ff       	jmp    431 <dosyscall>
+
+0000060f <ioring_setup>:
+SYSCALL(ioring_setup)
+ 60f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 614:	e9 18 fe ff ff       	jmp    431 <dosyscall>
+
+00000619 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 619:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 61e:	e9 0e fe ff ff       	jmp    431 <dosyscall>
+
+00000623 <getrusage>:
+SYSCALL(getrusage)
+ 623:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 628:	e9 04 fe ff ff       	jmp    431 <dosyscall>
+
+0000062d <mount>:
+SYSCALL(mount)
+ 62d:	b8 30 00 00 00       	mov    $0x30,%eax
+ 632:	e9 fa fd ff ff       	jmp    431 <dosyscall>
+
+00000637 <getdents>:
+SYSCALL(getdents)
+ 637:	b8 31 00 00 00       	mov    $0x31,%eax
+ 63c:	e9 f0 fd ff ff       	jmp    431 <dosyscall>
+
+00000641 <yield>:
+SYSCALL(yield)
+ 641:	b8 32 00 00 00       	mov    $0x32,%eax
+ 646:	e9 e6 fd ff ff       	jmp    431 <dosyscall>
+
+0000064b <ncpu>:
+SYSCALL(ncpu)
+ 64b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 650:	e9 dc fd ff ff       	jmp    431 <dosyscall>
+
+00000655 <fallocate>:
+SYSCALL(fallocate)
+ 655:	b8 34 00 00 00       	mov    $0x34,%eax
+ 65a:	e9 d2 fd ff ff       	jmp    431 <dosyscall>
+
+0000065f <ftruncate>:
+SYSCALL(ftruncate)
+ 65f:	b8 35 00 00 00       	mov    $0x35,%eax
+ 664:	e9 c8 fd ff ff       	jmp    431 <dosyscall>
+
+00000669 <fsync>:
+SYSCALL(fsync)
+ 669:	b8 36 00 00 00       	mov    $0x36,%eax
+ 66e:	e9 be fd ff ff       	jmp    431 <dosyscall>
+
+00000673 <fdatasync>:
+SYSCALL(fdatasync)
+ 673:	b8 37 00 00 00       	mov    $0x37,%eax
+ 678:	e9 b4 fd ff ff       	jmp    431 <dosyscall>
+
+0000067d <poll>:
+SYSCALL(poll)
+ 67d:	b8 38 00 00 00       	mov    $0x38,%eax
+ 682:	e9 aa fd ff ff       	jmp    431 <dosyscall>
+
+00000687 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 687:	55                   	push   %ebp
+ 688:	89 e5                	mov    %esp,%ebp
+ 68a:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	8b 40 04             	mov    0x4(%eax),%eax
+ 693:	85 c0                	test   %eax,%eax
+ 695:	7e 1f                	jle    6b6 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 697:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69a:	8b 50 04             	mov    0x4(%eax),%edx
+ 69d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a0:	8d 48 08             	lea    0x8(%eax),%ecx
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	8b 00                	mov    (%eax),%eax
+ 6a8:	83 ec 04             	sub    $0x4,%esp
+ 6ab:	52                   	push   %edx
+ 6ac:	51                   	push   %ecx
+ 6ad:	50                   	push   %eax
+ 6ae:	e8 d0 fe ff ff       	call   583 <writev>
+ 6b3:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 6b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c3:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 6ca:	00 00 00 
+}
+ 6cd:	90                   	nop
+ 6ce:	c9                   	leave
+ 6cf:	c3                   	ret
+
+000006d0 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 6d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 6da:	0f 84 94 00 00 00    	je     774 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 6e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6e6:	85 c0                	test   %eax,%eax
+ 6e8:	7e 40                	jle    72a <put+0x5a>
+    v = &o->iov[o->n-1];
+ 6ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ed:	8b 40 04             	mov    0x4(%eax),%eax
+ 6f0:	83 e8 01             	sub    $0x1,%eax
+ 6f3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fd:	01 d0                	add    %edx,%eax
+ 6ff:	83 c0 08             	add    $0x8,%eax
+ 702:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 708:	8b 10                	mov    (%eax),%edx
+ 70a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70d:	8b 40 04             	mov    0x4(%eax),%eax
+ 710:	01 d0                	add    %edx,%eax
+ 712:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 715:	75 13                	jne    72a <put+0x5a>
+      v->iov_len += n;
+ 717:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71a:	8b 50 04             	mov    0x4(%eax),%edx
+ 71d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 720:	01 c2                	add    %eax,%edx
+ 722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 725:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 728:	eb 4b                	jmp    775 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 72a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72d:	8b 40 04             	mov    0x4(%eax),%eax
+ 730:	83 f8 10             	cmp    $0x10,%eax
+ 733:	75 0e                	jne    743 <put+0x73>
+    flush(o);
+ 735:	83 ec 0c             	sub    $0xc,%esp
+ 738:	ff 75 08             	push   0x8(%ebp)
+ 73b:	e8 47 ff ff ff       	call   687 <flush>
+ 740:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 743:	8b 45 08             	mov    0x8(%ebp),%eax
+ 746:	8b 50 04             	mov    0x4(%eax),%edx
+ 749:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 74f:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 753:	8b 45 08             	mov    0x8(%ebp),%eax
+ 756:	8b 50 04             	mov    0x4(%eax),%edx
+ 759:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 75f:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 763:	8b 45 08             	mov    0x8(%ebp),%eax
+ 766:	8b 40 04             	mov    0x4(%eax),%eax
+ 769:	8d 50 01             	lea    0x1(%eax),%edx
+ 76c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76f:	89 50 04             	mov    %edx,0x4(%eax)
+ 772:	eb 01                	jmp    775 <put+0xa5>
+    return;
+ 774:	90                   	nop
+}
+ 775:	c9                   	leave
+ 776:	c3                   	ret
+
+00000777 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 777:	55                   	push   %ebp
+ 778:	89 e5                	mov    %esp,%ebp
+ 77a:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 77d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 780:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 786:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 789:	01 d0                	add    %edx,%eax
+ 78b:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 790:	77 0b                	ja     79d <room+0x26>
+ 792:	8b 45 08             	mov    0x8(%ebp),%eax
+ 795:	8b 40 04             	mov    0x4(%eax),%eax
+ 798:	83 f8 10             	cmp    $0x10,%eax
+ 79b:	75 0e                	jne    7ab <room+0x34>
+    flush(o);
+ 79d:	83 ec 0c             	sub    $0xc,%esp
+ 7a0:	ff 75 08             	push   0x8(%ebp)
+ 7a3:	e8 df fe ff ff       	call   687 <flush>
+ 7a8:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ae:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 7b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7bd:	01 d0                	add    %edx,%eax
+}
+ 7bf:	c9                   	leave
+ 7c0:	c3                   	ret
+
+000007c1 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 7c1:	55                   	push   %ebp
+ 7c2:	89 e5                	mov    %esp,%ebp
+ 7c4:	83 ec 28             	sub    $0x28,%esp
+ 7c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ca:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 7cd:	83 ec 08             	sub    $0x8,%esp
+ 7d0:	6a 01                	push   $0x1
+ 7d2:	ff 75 08             	push   0x8(%ebp)
+ 7d5:	e8 9d ff ff ff       	call   777 <room>
+ 7da:	83 c4 10             	add    $0x10,%esp
+ 7dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 7e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e3:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 7e7:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 7e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ec:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7f2:	8d 50 01             	lea    0x1(%eax),%edx
+ 7f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f8:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 7fe:	83 ec 04             	sub    $0x4,%esp
+ 801:	6a 01                	push   $0x1
+ 803:	ff 75 f4             	push   -0xc(%ebp)
+ 806:	ff 75 08             	push   0x8(%ebp)
+ 809:	e8 c2 fe ff ff       	call   6d0 <put>
+ 80e:	83 c4 10             	add    $0x10,%esp
+}
+ 811:	90                   	nop
+ 812:	c9                   	leave
+ 813:	c3                   	ret
+
+00000814 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 814:	55                   	push   %ebp
+ 815:	89 e5                	mov    %esp,%ebp
+ 817:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 81a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 821:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 825:	74 17                	je     83e <printint+0x2a>
+ 827:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 82b:	79 11                	jns    83e <printint+0x2a>
+    neg = 1;
+ 82d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 834:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 837:	f7 d8                	neg    %eax
+ 839:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 83c:	eb 06                	jmp    844 <printint+0x30>
+  } else {
+    x = xx;
+ 83e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 841:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 844:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 84b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 84e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 851:	ba 00 00 00 00       	mov    $0x0,%edx
+ 856:	f7 f1                	div    %ecx
+ 858:	89 d1                	mov    %edx,%ecx
+ 85a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85d:	8d 50 01             	lea    0x1(%eax),%edx
+ 860:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 863:	0f b6 91 54 14 00 00 	movzbl 0x1454(%ecx),%edx
+ 86a:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 86e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 871:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 874:	ba 00 00 00 00       	mov    $0x0,%edx
+ 879:	f7 f1                	div    %ecx
+ 87b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 87e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 882:	75 c7                	jne    84b <printint+0x37>
+  if(neg)
+ 884:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 888:	74 0e                	je     898 <printint+0x84>
+    buf[i++] = '-';
+ 88a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88d:	8d 50 01             	lea    0x1(%eax),%edx
+ 890:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 893:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 89e:	83 ec 08             	sub    $0x8,%esp
+ 8a1:	ff 75 e8             	push   -0x18(%ebp)
+ 8a4:	ff 75 08             	push   0x8(%ebp)
+ 8a7:	e8 cb fe ff ff       	call   777 <room>
+ 8ac:	83 c4 10             	add    $0x10,%esp
+ 8af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 8b2:	eb 1d                	jmp    8d1 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 8b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8b7:	83 e8 01             	sub    $0x1,%eax
+ 8ba:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8bd:	89 c2                	mov    %eax,%edx
+ 8bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c2:	01 c2                	add    %eax,%edx
+ 8c4:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 8c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ca:	01 c8                	add    %ecx,%eax
+ 8cc:	0f b6 00             	movzbl (%eax),%eax
+ 8cf:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 8d1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8d9:	79 d9                	jns    8b4 <printint+0xa0>
+  o->used += n;
+ 8db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8de:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 8e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e7:	01 c2                	add    %eax,%edx
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ec:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 8f2:	83 ec 04             	sub    $0x4,%esp
+ 8f5:	ff 75 e8             	push   -0x18(%ebp)
+ 8f8:	ff 75 e4             	push   -0x1c(%ebp)
+ 8fb:	ff 75 08             	push   0x8(%ebp)
+ 8fe:	e8 cd fd ff ff       	call   6d0 <put>
+ 903:	83 c4 10             	add    $0x10,%esp
+}
+ 906:	90                   	nop
+ 907:	c9                   	leave
+ 908:	c3                   	ret
+
+00000909 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 909:	55                   	push   %ebp
+ 90a:	89 e5                	mov    %esp,%ebp
+ 90c:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 912:	8b 45 08             	mov    0x8(%ebp),%eax
+ 915:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 91b:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 922:	00 00 00 
+  o.used = 0;
+ 925:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 92c:	00 00 00 
+  state = 0;
+ 92f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 936:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 939:	83 c0 04             	add    $0x4,%eax
+ 93c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 93f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 946:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 94d:	e9 82 01 00 00       	jmp    ad4 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 952:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 955:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 958:	01 d0                	add    %edx,%eax
+ 95a:	0f b6 00             	movzbl (%eax),%eax
+ 95d:	0f be c0             	movsbl %al,%eax
+ 960:	25 ff 00 00 00       	and    $0xff,%eax
+ 965:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 968:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 96c:	75 38                	jne    9a6 <printf+0x9d>
+      if(c == '%'){
+ 96e:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 972:	0f 85 58 01 00 00    	jne    ad0 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 978:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 97e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 981:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 984:	01 ca                	add    %ecx,%edx
+ 986:	83 ec 04             	sub    $0x4,%esp
+ 989:	50                   	push   %eax
+ 98a:	52                   	push   %edx
+ 98b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 991:	50                   	push   %eax
+ 992:	e8 39 fd ff ff       	call   6d0 <put>
+ 997:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 99a:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 9a1:	e9 2a 01 00 00       	jmp    ad0 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 9a6:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 9aa:	0f 85 20 01 00 00    	jne    ad0 <printf+0x1c7>
+      if(c == 'd'){
+ 9b0:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 9b4:	75 22                	jne    9d8 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 9b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9b9:	8b 00                	mov    (%eax),%eax
+ 9bb:	6a 01                	push   $0x1
+ 9bd:	6a 0a                	push   $0xa
+ 9bf:	50                   	push   %eax
+ 9c0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9c6:	50                   	push   %eax
+ 9c7:	e8 48 fe ff ff       	call   814 <printint>
+ 9cc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9cf:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9d3:	e9 e8 00 00 00       	jmp    ac0 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 9d8:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 9dc:	74 06                	je     9e4 <printf+0xdb>
+ 9de:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 9e2:	75 22                	jne    a06 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 9e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9e7:	8b 00                	mov    (%eax),%eax
+ 9e9:	6a 00                	push   $0x0
+ 9eb:	6a 10                	push   $0x10
+ 9ed:	50                   	push   %eax
+ 9ee:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9f4:	50                   	push   %eax
+ 9f5:	e8 1a fe ff ff       	call   814 <printint>
+ 9fa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9fd:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a01:	e9 ba 00 00 00       	jmp    ac0 <printf+0x1b7>
+      } else if(c == 's'){
+ a06:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ a0a:	75 3f                	jne    a4b <printf+0x142>
+        s = (char*)*ap;
+ a0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a0f:	8b 00                	mov    (%eax),%eax
+ a11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a14:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ a18:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a1c:	75 07                	jne    a25 <printf+0x11c>
+          s = "(null)";
+ a1e:	c7 45 f4 c5 10 00 00 	movl   $0x10c5,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a25:	83 ec 0c             	sub    $0xc,%esp
+ a28:	ff 75 f4             	push   -0xc(%ebp)
+ a2b:	e8 47 f8 ff ff       	call   277 <strlen>
+ a30:	83 c4 10             	add    $0x10,%esp
+ a33:	83 ec 04             	sub    $0x4,%esp
+ a36:	50                   	push   %eax
+ a37:	ff 75 f4             	push   -0xc(%ebp)
+ a3a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a40:	50                   	push   %eax
+ a41:	e8 8a fc ff ff       	call   6d0 <put>
+ a46:	83 c4 10             	add    $0x10,%esp
+ a49:	eb 75                	jmp    ac0 <printf+0x1b7>
+      } else if(c == 'c'){
+ a4b:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a4f:	75 21                	jne    a72 <printf+0x169>
+        putc(&o, *ap);
+ a51:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a54:	8b 00                	mov    (%eax),%eax
+ a56:	0f be c0             	movsbl %al,%eax
+ a59:	83 ec 08             	sub    $0x8,%esp
+ a5c:	50                   	push   %eax
+ a5d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a63:	50                   	push   %eax
+ a64:	e8 58 fd ff ff       	call   7c1 <putc>
+ a69:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a6c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a70:	eb 4e                	jmp    ac0 <printf+0x1b7>
+      } else if(c == '%'){
+ a72:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a76:	75 1b                	jne    a93 <printf+0x18a>
+        putc(&o, c);
+ a78:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a7b:	0f be c0             	movsbl %al,%eax
+ a7e:	83 ec 08             	sub    $0x8,%esp
+ a81:	50                   	push   %eax
+ a82:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a88:	50                   	push   %eax
+ a89:	e8 33 fd ff ff       	call   7c1 <putc>
+ a8e:	83 c4 10             	add    $0x10,%esp
+ a91:	eb 2d                	jmp    ac0 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a93:	83 ec 08             	sub    $0x8,%esp
+ a96:	6a 25                	push   $0x25
+ a98:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a9e:	50                   	push   %eax
+ a9f:	e8 1d fd ff ff       	call   7c1 <putc>
+ aa4:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ aa7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ aaa:	0f be c0             	movsbl %al,%eax
+ aad:	83 ec 08             	sub    $0x8,%esp
+ ab0:	50                   	push   %eax
+ ab1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ab7:	50                   	push   %eax
+ ab8:	e8 04 fd ff ff       	call   7c1 <putc>
+ abd:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ ac0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ ac7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aca:	83 c0 01             	add    $0x1,%eax
+ acd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ad0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ad7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ada:	01 d0                	add    %edx,%eax
+ adc:	0f b6 00             	movzbl (%eax),%eax
+ adf:	84 c0                	test   %al,%al
+ ae1:	0f 85 6b fe ff ff    	jne    952 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ ae7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ aeb:	75 22                	jne    b0f <printf+0x206>
+    put(&o, fmt + start, i - start);
+ aed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af0:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ af3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ af6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ af9:	01 ca                	add    %ecx,%edx
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	50                   	push   %eax
+ aff:	52                   	push   %edx
+ b00:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b06:	50                   	push   %eax
+ b07:	e8 c4 fb ff ff       	call   6d0 <put>
+ b0c:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ b0f:	83 ec 0c             	sub    $0xc,%esp
+ b12:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b18:	50                   	push   %eax
+ b19:	e8 69 fb ff ff       	call   687 <flush>
+ b1e:	83 c4 10             	add    $0x10,%esp
+}
+ b21:	90                   	nop
+ b22:	c9                   	leave
+ b23:	c3                   	ret
+
+00000b24 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b24:	55                   	push   %ebp
+ b25:	89 e5                	mov    %esp,%ebp
+ b27:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b2a:	8b 55 08             	mov    0x8(%ebp),%edx
+ b2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b33:	f0 87 02             	lock xchg %eax,(%edx)
+ b36:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b3c:	c9                   	leave
+ b3d:	c3                   	ret
+
+00000b3e <lock>:
+{
+ b3e:	55                   	push   %ebp
+ b3f:	89 e5                	mov    %esp,%ebp
+ b41:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b44:	a1 68 14 00 00       	mov    0x1468,%eax
+ b49:	85 c0                	test   %eax,%eax
+ b4b:	74 09                	je     b56 <lock+0x18>
+ b4d:	a1 68 14 00 00       	mov    0x1468,%eax
+ b52:	ff d0                	call   *%eax
+ b54:	eb 05                	jmp    b5b <lock+0x1d>
+ b56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b5e:	90                   	nop
+ b5f:	83 ec 08             	sub    $0x8,%esp
+ b62:	6a 01                	push   $0x1
+ b64:	68 a0 14 00 00       	push   $0x14a0
+ b69:	e8 b6 ff ff ff       	call   b24 <xchg>
+ b6e:	83 c4 10             	add    $0x10,%esp
+ b71:	85 c0                	test   %eax,%eax
+ b73:	75 ea                	jne    b5f <lock+0x21>
+  return pin;
+ b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b78:	c9                   	leave
+ b79:	c3                   	ret
+
+00000b7a <unlock>:
+{
+ b7a:	55                   	push   %ebp
+ b7b:	89 e5                	mov    %esp,%ebp
+ b7d:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b80:	6a 00                	push   $0x0
+ b82:	68 a0 14 00 00       	push   $0x14a0
+ b87:	e8 98 ff ff ff       	call   b24 <xchg>
+ b8c:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b8f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b93:	78 10                	js     ba5 <unlock+0x2b>
+    mallocunpin(pin);
+ b95:	a1 6c 14 00 00       	mov    0x146c,%eax
+ b9a:	83 ec 0c             	sub    $0xc,%esp
+ b9d:	ff 75 08             	push   0x8(%ebp)
+ ba0:	ff d0                	call   *%eax
+ ba2:	83 c4 10             	add    $0x10,%esp
+}
+ ba5:	90                   	nop
+ ba6:	c9                   	leave
+ ba7:	c3                   	ret
+
+00000ba8 <sizeclass>:
+{
+ ba8:	55                   	push   %ebp
+ ba9:	89 e5                	mov    %esp,%ebp
+ bab:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ bae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ bb5:	eb 1c                	jmp    bd3 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ bb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bba:	ba 02 00 00 00       	mov    $0x2,%edx
+ bbf:	89 c1                	mov    %eax,%ecx
+ bc1:	d3 e2                	shl    %cl,%edx
+ bc3:	89 d0                	mov    %edx,%eax
+ bc5:	3b 45 08             	cmp    0x8(%ebp),%eax
+ bc8:	72 05                	jb     bcf <sizeclass+0x27>
+      return c;
+ bca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bcd:	eb 0f                	jmp    bde <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ bcf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ bd3:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ bd7:	7e de                	jle    bb7 <sizeclass+0xf>
+  return -1;
+ bd9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ bde:	c9                   	leave
+ bdf:	c3                   	ret
+
+00000be0 <bigfree>:
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be6:	a1 78 14 00 00       	mov    0x1478,%eax
+ beb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bee:	eb 24                	jmp    c14 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf3:	8b 00                	mov    (%eax),%eax
+ bf5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bf8:	72 12                	jb     c0c <bigfree+0x2c>
+ bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c00:	72 24                	jb     c26 <bigfree+0x46>
+ c02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c05:	8b 00                	mov    (%eax),%eax
+ c07:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c0a:	72 1a                	jb     c26 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0f:	8b 00                	mov    (%eax),%eax
+ c11:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c14:	8b 45 08             	mov    0x8(%ebp),%eax
+ c17:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c1a:	73 d4                	jae    bf0 <bigfree+0x10>
+ c1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1f:	8b 00                	mov    (%eax),%eax
+ c21:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c24:	73 ca                	jae    bf0 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c26:	8b 45 08             	mov    0x8(%ebp),%eax
+ c29:	8b 40 04             	mov    0x4(%eax),%eax
+ c2c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c33:	8b 45 08             	mov    0x8(%ebp),%eax
+ c36:	01 c2                	add    %eax,%edx
+ c38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3b:	8b 00                	mov    (%eax),%eax
+ c3d:	39 c2                	cmp    %eax,%edx
+ c3f:	75 24                	jne    c65 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c41:	8b 45 08             	mov    0x8(%ebp),%eax
+ c44:	8b 50 04             	mov    0x4(%eax),%edx
+ c47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4a:	8b 00                	mov    (%eax),%eax
+ c4c:	8b 40 04             	mov    0x4(%eax),%eax
+ c4f:	01 c2                	add    %eax,%edx
+ c51:	8b 45 08             	mov    0x8(%ebp),%eax
+ c54:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5a:	8b 00                	mov    (%eax),%eax
+ c5c:	8b 10                	mov    (%eax),%edx
+ c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c61:	89 10                	mov    %edx,(%eax)
+ c63:	eb 0a                	jmp    c6f <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c68:	8b 10                	mov    (%eax),%edx
+ c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c72:	8b 40 04             	mov    0x4(%eax),%eax
+ c75:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7f:	01 d0                	add    %edx,%eax
+ c81:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c84:	75 20                	jne    ca6 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ c86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c89:	8b 50 04             	mov    0x4(%eax),%edx
+ c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8f:	8b 40 04             	mov    0x4(%eax),%eax
+ c92:	01 c2                	add    %eax,%edx
+ c94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c97:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9d:	8b 10                	mov    (%eax),%edx
+ c9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca2:	89 10                	mov    %edx,(%eax)
+ ca4:	eb 08                	jmp    cae <bigfree+0xce>
+    p->s.ptr = bp;
+ ca6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca9:	8b 55 08             	mov    0x8(%ebp),%edx
+ cac:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ cae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb1:	a3 78 14 00 00       	mov    %eax,0x1478
+}
+ cb6:	90                   	nop
+ cb7:	c9                   	leave
+ cb8:	c3                   	ret
+
+00000cb9 <free>:
+{
+ cb9:	55                   	push   %ebp
+ cba:	89 e5                	mov    %esp,%ebp
+ cbc:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ cbf:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ cc3:	74 68                	je     d2d <free+0x74>
+  bp = (Header*)ap - 1;
+ cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc8:	83 e8 08             	sub    $0x8,%eax
+ ccb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ cce:	e8 6b fe ff ff       	call   b3e <lock>
+ cd3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ cd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd9:	8b 40 04             	mov    0x4(%eax),%eax
+ cdc:	83 ec 0c             	sub    $0xc,%esp
+ cdf:	50                   	push   %eax
+ ce0:	e8 c3 fe ff ff       	call   ba8 <sizeclass>
+ ce5:	83 c4 10             	add    $0x10,%esp
+ ce8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ceb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ cef:	78 1e                	js     d0f <free+0x56>
+    bp->s.ptr = classfree[c];
+ cf1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cf4:	8b 14 85 7c 14 00 00 	mov    0x147c(,%eax,4),%edx
+ cfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfe:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ d00:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d06:	89 14 85 7c 14 00 00 	mov    %edx,0x147c(,%eax,4)
+ d0d:	eb 0e                	jmp    d1d <free+0x64>
+    bigfree(bp);
+ d0f:	83 ec 0c             	sub    $0xc,%esp
+ d12:	ff 75 f4             	push   -0xc(%ebp)
+ d15:	e8 c6 fe ff ff       	call   be0 <bigfree>
+ d1a:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d1d:	83 ec 0c             	sub    $0xc,%esp
+ d20:	ff 75 f0             	push   -0x10(%ebp)
+ d23:	e8 52 fe ff ff       	call   b7a <unlock>
+ d28:	83 c4 10             	add    $0x10,%esp
+ d2b:	eb 01                	jmp    d2e <free+0x75>
+    return;
+ d2d:	90                   	nop
+}
+ d2e:	c9                   	leave
+ d2f:	c3                   	ret
+
+00000d30 <morecore>:
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d36:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d3d:	77 07                	ja     d46 <morecore+0x16>
+    nu = 4096;
+ d3f:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d46:	8b 45 08             	mov    0x8(%ebp),%eax
+ d49:	c1 e0 03             	shl    $0x3,%eax
+ d4c:	83 ec 0c             	sub    $0xc,%esp
+ d4f:	50                   	push   %eax
+ d50:	e8 b6 f7 ff ff       	call   50b <sbrk>
+ d55:	83 c4 10             	add    $0x10,%esp
+ d58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d5b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d5f:	75 07                	jne    d68 <morecore+0x38>
+    return 0;
+ d61:	b8 00 00 00 00       	mov    $0x0,%eax
+ d66:	eb 22                	jmp    d8a <morecore+0x5a>
+  hp = (Header*)p;
+ d68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d6e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d71:	8b 55 08             	mov    0x8(%ebp),%edx
+ d74:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	ff 75 f0             	push   -0x10(%ebp)
+ d7d:	e8 5e fe ff ff       	call   be0 <bigfree>
+ d82:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d85:	a1 78 14 00 00       	mov    0x1478,%eax
+}
+ d8a:	c9                   	leave
+ d8b:	c3                   	ret
+
+00000d8c <bigalloc>:
+{
+ d8c:	55                   	push   %ebp
+ d8d:	89 e5                	mov    %esp,%ebp
+ d8f:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d92:	a1 78 14 00 00       	mov    0x1478,%eax
+ d97:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d9a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d9e:	75 23                	jne    dc3 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ da0:	c7 45 f0 70 14 00 00 	movl   $0x1470,-0x10(%ebp)
+ da7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ daa:	a3 78 14 00 00       	mov    %eax,0x1478
+ daf:	a1 78 14 00 00       	mov    0x1478,%eax
+ db4:	a3 70 14 00 00       	mov    %eax,0x1470
+    base.s.size = 0;
+ db9:	c7 05 74 14 00 00 00 	movl   $0x0,0x1474
+ dc0:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dc6:	8b 00                	mov    (%eax),%eax
+ dc8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ dcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dce:	8b 40 04             	mov    0x4(%eax),%eax
+ dd1:	3b 45 08             	cmp    0x8(%ebp),%eax
+ dd4:	72 4a                	jb     e20 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ dd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dd9:	8b 40 04             	mov    0x4(%eax),%eax
+ ddc:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ddf:	75 0c                	jne    ded <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de4:	8b 10                	mov    (%eax),%edx
+ de6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ de9:	89 10                	mov    %edx,(%eax)
+ deb:	eb 26                	jmp    e13 <bigalloc+0x87>
+        p->s.size -= nunits;
+ ded:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df0:	8b 40 04             	mov    0x4(%eax),%eax
+ df3:	2b 45 08             	sub    0x8(%ebp),%eax
+ df6:	89 c2                	mov    %eax,%edx
+ df8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dfb:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e01:	8b 40 04             	mov    0x4(%eax),%eax
+ e04:	c1 e0 03             	shl    $0x3,%eax
+ e07:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+ e10:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ e13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e16:	a3 78 14 00 00       	mov    %eax,0x1478
+      return p;
+ e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1e:	eb 3b                	jmp    e5b <bigalloc+0xcf>
+    if(p == freep)
+ e20:	a1 78 14 00 00       	mov    0x1478,%eax
+ e25:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e28:	75 1e                	jne    e48 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e2a:	83 ec 0c             	sub    $0xc,%esp
+ e2d:	ff 75 08             	push   0x8(%ebp)
+ e30:	e8 fb fe ff ff       	call   d30 <morecore>
+ e35:	83 c4 10             	add    $0x10,%esp
+ e38:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e3b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e3f:	75 07                	jne    e48 <bigalloc+0xbc>
+        return 0;
+ e41:	b8 00 00 00 00       	mov    $0x0,%eax
+ e46:	eb 13                	jmp    e5b <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e51:	8b 00                	mov    (%eax),%eax
+ e53:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e56:	e9 70 ff ff ff       	jmp    dcb <bigalloc+0x3f>
+}
+ e5b:	c9                   	leave
+ e5c:	c3                   	ret
+
+00000e5d <alloc>:
+alloc(uint nbytes)
+{
+ e5d:	55                   	push   %ebp
+ e5e:	89 e5                	mov    %esp,%ebp
+ e60:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e63:	8b 45 08             	mov    0x8(%ebp),%eax
+ e66:	83 c0 07             	add    $0x7,%eax
+ e69:	c1 e8 03             	shr    $0x3,%eax
+ e6c:	83 c0 01             	add    $0x1,%eax
+ e6f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e72:	ff 75 f4             	push   -0xc(%ebp)
+ e75:	e8 2e fd ff ff       	call   ba8 <sizeclass>
+ e7a:	83 c4 04             	add    $0x4,%esp
+ e7d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e80:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e84:	79 2c                	jns    eb2 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ e86:	83 ec 0c             	sub    $0xc,%esp
+ e89:	ff 75 f4             	push   -0xc(%ebp)
+ e8c:	e8 fb fe ff ff       	call   d8c <bigalloc>
+ e91:	83 c4 10             	add    $0x10,%esp
+ e94:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e97:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e9b:	75 0a                	jne    ea7 <alloc+0x4a>
+      return 0;
+ e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+ ea2:	e9 c8 00 00 00       	jmp    f6f <alloc+0x112>
+    return (void*)(p + 1);
+ ea7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eaa:	83 c0 08             	add    $0x8,%eax
+ ead:	e9 bd 00 00 00       	jmp    f6f <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ eb2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eb5:	8b 04 85 7c 14 00 00 	mov    0x147c(,%eax,4),%eax
+ ebc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ebf:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ec3:	74 1a                	je     edf <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ ec5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ec8:	8b 10                	mov    (%eax),%edx
+ eca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ecd:	89 14 85 7c 14 00 00 	mov    %edx,0x147c(,%eax,4)
+    return (void*)(p + 1);
+ ed4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ed7:	83 c0 08             	add    $0x8,%eax
+ eda:	e9 90 00 00 00       	jmp    f6f <alloc+0x112>
+  }
+  nunits = 2 << c;
+ edf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ee2:	ba 02 00 00 00       	mov    $0x2,%edx
+ ee7:	89 c1                	mov    %eax,%ecx
+ ee9:	d3 e2                	shl    %cl,%edx
+ eeb:	89 d0                	mov    %edx,%eax
+ eed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ef0:	a1 98 14 00 00       	mov    0x1498,%eax
+ ef5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ef8:	c1 e2 03             	shl    $0x3,%edx
+ efb:	01 d0                	add    %edx,%eax
+ efd:	8b 15 9c 14 00 00    	mov    0x149c,%edx
+ f03:	39 c2                	cmp    %eax,%edx
+ f05:	73 3f                	jae    f46 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ f07:	83 ec 0c             	sub    $0xc,%esp
+ f0a:	68 00 08 00 00       	push   $0x800
+ f0f:	e8 78 fe ff ff       	call   d8c <bigalloc>
+ f14:	83 c4 10             	add    $0x10,%esp
+ f17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ f1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f1e:	75 07                	jne    f27 <alloc+0xca>
+      return 0;
+ f20:	b8 00 00 00 00       	mov    $0x0,%eax
+ f25:	eb 48                	jmp    f6f <alloc+0x112>
+    bump = (char*)p;
+ f27:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f2a:	a3 98 14 00 00       	mov    %eax,0x1498
+    bumpend = (char*)(p + p->s.size);
+ f2f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f32:	8b 40 04             	mov    0x4(%eax),%eax
+ f35:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f3c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f3f:	01 d0                	add    %edx,%eax
+ f41:	a3 9c 14 00 00       	mov    %eax,0x149c
+  }
+  p = (Header*)bump;
+ f46:	a1 98 14 00 00       	mov    0x1498,%eax
+ f4b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f4e:	a1 98 14 00 00       	mov    0x1498,%eax
+ f53:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f56:	c1 e2 03             	shl    $0x3,%edx
+ f59:	01 d0                	add    %edx,%eax
+ f5b:	a3 98 14 00 00       	mov    %eax,0x1498
+  p->s.size = nunits;
+ f60:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f63:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f66:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f69:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f6c:	83 c0 08             	add    $0x8,%eax
+}
+ f6f:	c9                   	leave
+ f70:	c3                   	ret
+
+00000f71 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f71:	55                   	push   %ebp
+ f72:	89 e5                	mov    %esp,%ebp
+ f74:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f77:	e8 c2 fb ff ff       	call   b3e <lock>
+ f7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f7f:	83 ec 0c             	sub    $0xc,%esp
+ f82:	ff 75 08             	push   0x8(%ebp)
+ f85:	e8 d3 fe ff ff       	call   e5d <alloc>
+ f8a:	83 c4 10             	add    $0x10,%esp
+ f8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f90:	83 ec 0c             	sub    $0xc,%esp
+ f93:	ff 75 f4             	push   -0xc(%ebp)
+ f96:	e8 df fb ff ff       	call   b7a <unlock>
+ f9b:	83 c4 10             	add    $0x10,%esp
+  return p;
+ f9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fa1:	c9                   	leave
+ fa2:	c3                   	ret
@@ -0,0 +1,2272 @@
+
+_test_fsync:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fail>:
+// O_DIRECT buffers must be block-aligned, so they come from sbrk.
+char *buf, *buf2;
+
+static void
+fail(char *what)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "error: %s\n", what);
+       6:	83 ec 04             	sub    $0x4,%esp
+       9:	ff 75 08             	push   0x8(%ebp)
+       c:	68 fc 12 00 00       	push   $0x12fc
+      11:	6a 01                	push   $0x1
+      13:	e8 48 0c 00 00       	call   c60 <printf>
+      18:	83 c4 10             	add    $0x10,%esp
+  exit();
+      1b:	e8 b0 07 00 00       	call   7d0 <exit>
+
+00000020 <fill>:
+}
+
+static void
+fill(int seed)
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+      23:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < SIZE; i++)
+      26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+      2d:	eb 3c                	jmp    6b <fill+0x4b>
+    buf[i] = 'a' + (i + seed) % 23;
+      2f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+      32:	8b 45 08             	mov    0x8(%ebp),%eax
+      35:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+      38:	ba c9 42 16 b2       	mov    $0xb21642c9,%edx
+      3d:	89 c8                	mov    %ecx,%eax
+      3f:	f7 ea                	imul   %edx
+      41:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+      44:	c1 f8 04             	sar    $0x4,%eax
+      47:	89 ca                	mov    %ecx,%edx
+      49:	c1 fa 1f             	sar    $0x1f,%edx
+      4c:	29 d0                	sub    %edx,%eax
+      4e:	6b d0 17             	imul   $0x17,%eax,%edx
+      51:	89 c8                	mov    %ecx,%eax
+      53:	29 d0                	sub    %edx,%eax
+      55:	8d 48 61             	lea    0x61(%eax),%ecx
+      58:	8b 15 dc 18 00 00    	mov    0x18dc,%edx
+      5e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      61:	01 d0                	add    %edx,%eax
+      63:	89 ca                	mov    %ecx,%edx
+      65:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+      67:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+      6b:	81 7d fc ff 7f 00 00 	cmpl   $0x7fff,-0x4(%ebp)
+      72:	7e bb                	jle    2f <fill+0xf>
+}
+      74:	90                   	nop
+      75:	90                   	nop
+      76:	c9                   	leave
+      77:	c3                   	ret
+
+00000078 <same>:
+
+static int
+same(int off, int n)
+{
+      78:	55                   	push   %ebp
+      79:	89 e5                	mov    %esp,%ebp
+      7b:	53                   	push   %ebx
+      7c:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < n; i++)
+      7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+      86:	eb 33                	jmp    bb <same+0x43>
+    if(buf2[off+i] != buf[off+i])
+      88:	a1 e0 18 00 00       	mov    0x18e0,%eax
+      8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      90:	8b 55 f8             	mov    -0x8(%ebp),%edx
+      93:	01 ca                	add    %ecx,%edx
+      95:	01 d0                	add    %edx,%eax
+      97:	0f b6 10             	movzbl (%eax),%edx
+      9a:	a1 dc 18 00 00       	mov    0x18dc,%eax
+      9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      a2:	8b 4d f8             	mov    -0x8(%ebp),%ecx
+      a5:	01 d9                	add    %ebx,%ecx
+      a7:	01 c8                	add    %ecx,%eax
+      a9:	0f b6 00             	movzbl (%eax),%eax
+      ac:	38 c2                	cmp    %al,%dl
+      ae:	74 07                	je     b7 <same+0x3f>
+      return 0;
+      b0:	b8 00 00 00 00       	mov    $0x0,%eax
+      b5:	eb 11                	jmp    c8 <same+0x50>
+  for(i = 0; i < n; i++)
+      b7:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+      bb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+      be:	3b 45 0c             	cmp    0xc(%ebp),%eax
+      c1:	7c c5                	jl     88 <same+0x10>
+  return 1;
+      c3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      cb:	c9                   	leave
+      cc:	c3                   	ret
+
+000000cd <testsync>:
+
+static void
+testsync(char *path)
+{
+      cd:	55                   	push   %ebp
+      ce:	89 e5                	mov    %esp,%ebp
+      d0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  fill(0);
+      d3:	6a 00                	push   $0x0
+      d5:	e8 46 ff ff ff       	call   20 <fill>
+      da:	83 c4 04             	add    $0x4,%esp
+  unlink(path);
+      dd:	83 ec 0c             	sub    $0xc,%esp
+      e0:	ff 75 08             	push   0x8(%ebp)
+      e3:	e8 34 07 00 00       	call   81c <unlink>
+      e8:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_CREATE | O_RDWR | O_SYNC)) < 0)
+      eb:	83 ec 08             	sub    $0x8,%esp
+      ee:	68 02 22 00 00       	push   $0x2202
+      f3:	ff 75 08             	push   0x8(%ebp)
+      f6:	e8 0d 07 00 00       	call   808 <open>
+      fb:	83 c4 10             	add    $0x10,%esp
+      fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     101:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     105:	79 10                	jns    117 <testsync+0x4a>
+    fail("create O_SYNC");
+     107:	83 ec 0c             	sub    $0xc,%esp
+     10a:	68 07 13 00 00       	push   $0x1307
+     10f:	e8 ec fe ff ff       	call   0 <fail>
+     114:	83 c4 10             	add    $0x10,%esp
+  if(write(fd, buf, 3000) != 3000 || fsync(fd) < 0 || fdatasync(fd) < 0)
+     117:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     11c:	83 ec 04             	sub    $0x4,%esp
+     11f:	68 b8 0b 00 00       	push   $0xbb8
+     124:	50                   	push   %eax
+     125:	ff 75 f4             	push   -0xc(%ebp)
+     128:	e8 bf 06 00 00       	call   7ec <write>
+     12d:	83 c4 10             	add    $0x10,%esp
+     130:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     135:	75 24                	jne    15b <testsync+0x8e>
+     137:	83 ec 0c             	sub    $0xc,%esp
+     13a:	ff 75 f4             	push   -0xc(%ebp)
+     13d:	e8 7e 08 00 00       	call   9c0 <fsync>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	78 12                	js     15b <testsync+0x8e>
+     149:	83 ec 0c             	sub    $0xc,%esp
+     14c:	ff 75 f4             	push   -0xc(%ebp)
+     14f:	e8 76 08 00 00       	call   9ca <fdatasync>
+     154:	83 c4 10             	add    $0x10,%esp
+     157:	85 c0                	test   %eax,%eax
+     159:	79 10                	jns    16b <testsync+0x9e>
+    fail("O_SYNC write or fsync");
+     15b:	83 ec 0c             	sub    $0xc,%esp
+     15e:	68 15 13 00 00       	push   $0x1315
+     163:	e8 98 fe ff ff       	call   0 <fail>
+     168:	83 c4 10             	add    $0x10,%esp
+  if(pread(fd, buf2, 3000, 0) != 3000 || !same(0, 3000))
+     16b:	a1 e0 18 00 00       	mov    0x18e0,%eax
+     170:	6a 00                	push   $0x0
+     172:	68 b8 0b 00 00       	push   $0xbb8
+     177:	50                   	push   %eax
+     178:	ff 75 f4             	push   -0xc(%ebp)
+     17b:	e8 64 07 00 00       	call   8e4 <pread>
+     180:	83 c4 10             	add    $0x10,%esp
+     183:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     188:	75 16                	jne    1a0 <testsync+0xd3>
+     18a:	83 ec 08             	sub    $0x8,%esp
+     18d:	68 b8 0b 00 00       	push   $0xbb8
+     192:	6a 00                	push   $0x0
+     194:	e8 df fe ff ff       	call   78 <same>
+     199:	83 c4 10             	add    $0x10,%esp
+     19c:	85 c0                	test   %eax,%eax
+     19e:	75 10                	jne    1b0 <testsync+0xe3>
+    fail("read back O_SYNC write");
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	68 2b 13 00 00       	push   $0x132b
+     1a8:	e8 53 fe ff ff       	call   0 <fail>
+     1ad:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	ff 75 f4             	push   -0xc(%ebp)
+     1b6:	e8 38 06 00 00       	call   7f3 <close>
+     1bb:	83 c4 10             	add    $0x10,%esp
+  unlink(path);
+     1be:	83 ec 0c             	sub    $0xc,%esp
+     1c1:	ff 75 08             	push   0x8(%ebp)
+     1c4:	e8 53 06 00 00       	call   81c <unlink>
+     1c9:	83 c4 10             	add    $0x10,%esp
+}
+     1cc:	90                   	nop
+     1cd:	c9                   	leave
+     1ce:	c3                   	ret
+
+000001cf <testdirect>:
+
+static void
+testdirect(char *path)
+{
+     1cf:	55                   	push   %ebp
+     1d0:	89 e5                	mov    %esp,%ebp
+     1d2:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd2;
+
+  fill(1);
+     1d5:	6a 01                	push   $0x1
+     1d7:	e8 44 fe ff ff       	call   20 <fill>
+     1dc:	83 c4 04             	add    $0x4,%esp
+  unlink(path);
+     1df:	83 ec 0c             	sub    $0xc,%esp
+     1e2:	ff 75 08             	push   0x8(%ebp)
+     1e5:	e8 32 06 00 00       	call   81c <unlink>
+     1ea:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_CREATE | O_RDWR | O_DIRECT)) < 0)
+     1ed:	83 ec 08             	sub    $0x8,%esp
+     1f0:	68 02 42 00 00       	push   $0x4202
+     1f5:	ff 75 08             	push   0x8(%ebp)
+     1f8:	e8 0b 06 00 00       	call   808 <open>
+     1fd:	83 c4 10             	add    $0x10,%esp
+     200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     207:	79 10                	jns    219 <testdirect+0x4a>
+    fail("create O_DIRECT");
+     209:	83 ec 0c             	sub    $0xc,%esp
+     20c:	68 42 13 00 00       	push   $0x1342
+     211:	e8 ea fd ff ff       	call   0 <fail>
+     216:	83 c4 10             	add    $0x10,%esp
+  if((fd2 = open(path, O_RDWR)) < 0)
+     219:	83 ec 08             	sub    $0x8,%esp
+     21c:	6a 02                	push   $0x2
+     21e:	ff 75 08             	push   0x8(%ebp)
+     221:	e8 e2 05 00 00       	call   808 <open>
+     226:	83 c4 10             	add    $0x10,%esp
+     229:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     22c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     230:	79 10                	jns    242 <testdirect+0x73>
+    fail("open buffered");
+     232:	83 ec 0c             	sub    $0xc,%esp
+     235:	68 52 13 00 00       	push   $0x1352
+     23a:	e8 c1 fd ff ff       	call   0 <fail>
+     23f:	83 c4 10             	add    $0x10,%esp
+
+  // Misaligned offsets, lengths and buffers are refused, except
+  // on a tmpfs, where O_DIRECT means nothing.
+  if(path[1] != 't' && (write(fd, buf, 100) >= 0 ||
+     242:	8b 45 08             	mov    0x8(%ebp),%eax
+     245:	83 c0 01             	add    $0x1,%eax
+     248:	0f b6 00             	movzbl (%eax),%eax
+     24b:	3c 74                	cmp    $0x74,%al
+     24d:	74 49                	je     298 <testdirect+0xc9>
+     24f:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     254:	83 ec 04             	sub    $0x4,%esp
+     257:	6a 64                	push   $0x64
+     259:	50                   	push   %eax
+     25a:	ff 75 f4             	push   -0xc(%ebp)
+     25d:	e8 8a 05 00 00       	call   7ec <write>
+     262:	83 c4 10             	add    $0x10,%esp
+     265:	85 c0                	test   %eax,%eax
+     267:	79 1f                	jns    288 <testdirect+0xb9>
+     pwrite(fd, buf + 1, BSIZE, 0) >= 0))
+     269:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     26e:	83 c0 01             	add    $0x1,%eax
+     271:	6a 00                	push   $0x0
+     273:	68 00 02 00 00       	push   $0x200
+     278:	50                   	push   %eax
+     279:	ff 75 f4             	push   -0xc(%ebp)
+     27c:	e8 6d 06 00 00       	call   8ee <pwrite>
+     281:	83 c4 10             	add    $0x10,%esp
+  if(path[1] != 't' && (write(fd, buf, 100) >= 0 ||
+     284:	85 c0                	test   %eax,%eax
+     286:	78 10                	js     298 <testdirect+0xc9>
+    fail("misaligned O_DIRECT write");
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	68 60 13 00 00       	push   $0x1360
+     290:	e8 6b fd ff ff       	call   0 <fail>
+     295:	83 c4 10             	add    $0x10,%esp
+
+  // Written around the caches, read back through them.
+  if(write(fd, buf, SIZE) != SIZE || fsync(fd) < 0)
+     298:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     29d:	83 ec 04             	sub    $0x4,%esp
+     2a0:	68 00 80 00 00       	push   $0x8000
+     2a5:	50                   	push   %eax
+     2a6:	ff 75 f4             	push   -0xc(%ebp)
+     2a9:	e8 3e 05 00 00       	call   7ec <write>
+     2ae:	83 c4 10             	add    $0x10,%esp
+     2b1:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     2b6:	75 12                	jne    2ca <testdirect+0xfb>
+     2b8:	83 ec 0c             	sub    $0xc,%esp
+     2bb:	ff 75 f4             	push   -0xc(%ebp)
+     2be:	e8 fd 06 00 00       	call   9c0 <fsync>
+     2c3:	83 c4 10             	add    $0x10,%esp
+     2c6:	85 c0                	test   %eax,%eax
+     2c8:	79 10                	jns    2da <testdirect+0x10b>
+    fail("O_DIRECT write");
+     2ca:	83 ec 0c             	sub    $0xc,%esp
+     2cd:	68 7a 13 00 00       	push   $0x137a
+     2d2:	e8 29 fd ff ff       	call   0 <fail>
+     2d7:	83 c4 10             	add    $0x10,%esp
+  if(pread(fd2, buf2, SIZE, 0) != SIZE || !same(0, SIZE))
+     2da:	a1 e0 18 00 00       	mov    0x18e0,%eax
+     2df:	6a 00                	push   $0x0
+     2e1:	68 00 80 00 00       	push   $0x8000
+     2e6:	50                   	push   %eax
+     2e7:	ff 75 f0             	push   -0x10(%ebp)
+     2ea:	e8 f5 05 00 00       	call   8e4 <pread>
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     2f7:	75 16                	jne    30f <testdirect+0x140>
+     2f9:	83 ec 08             	sub    $0x8,%esp
+     2fc:	68 00 80 00 00       	push   $0x8000
+     301:	6a 00                	push   $0x0
+     303:	e8 70 fd ff ff       	call   78 <same>
+     308:	83 c4 10             	add    $0x10,%esp
+     30b:	85 c0                	test   %eax,%eax
+     30d:	75 10                	jne    31f <testdirect+0x150>
+    fail("buffered read of O_DIRECT write");
+     30f:	83 ec 0c             	sub    $0xc,%esp
+     312:	68 8c 13 00 00       	push   $0x138c
+     317:	e8 e4 fc ff ff       	call   0 <fail>
+     31c:	83 c4 10             	add    $0x10,%esp
+
+  // Written through the caches, read back around them.
+  fill(2);
+     31f:	83 ec 0c             	sub    $0xc,%esp
+     322:	6a 02                	push   $0x2
+     324:	e8 f7 fc ff ff       	call   20 <fill>
+     329:	83 c4 10             	add    $0x10,%esp
+  if(pwrite(fd2, buf + 2*BSIZE, 3*BSIZE, 2*BSIZE) != 3*BSIZE)
+     32c:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     331:	05 00 04 00 00       	add    $0x400,%eax
+     336:	68 00 04 00 00       	push   $0x400
+     33b:	68 00 06 00 00       	push   $0x600
+     340:	50                   	push   %eax
+     341:	ff 75 f0             	push   -0x10(%ebp)
+     344:	e8 a5 05 00 00       	call   8ee <pwrite>
+     349:	83 c4 10             	add    $0x10,%esp
+     34c:	3d 00 06 00 00       	cmp    $0x600,%eax
+     351:	74 10                	je     363 <testdirect+0x194>
+    fail("buffered write");
+     353:	83 ec 0c             	sub    $0xc,%esp
+     356:	68 ac 13 00 00       	push   $0x13ac
+     35b:	e8 a0 fc ff ff       	call   0 <fail>
+     360:	83 c4 10             	add    $0x10,%esp
+  if(pread(fd, buf2, SIZE, 0) != SIZE)
+     363:	a1 e0 18 00 00       	mov    0x18e0,%eax
+     368:	6a 00                	push   $0x0
+     36a:	68 00 80 00 00       	push   $0x8000
+     36f:	50                   	push   %eax
+     370:	ff 75 f4             	push   -0xc(%ebp)
+     373:	e8 6c 05 00 00       	call   8e4 <pread>
+     378:	83 c4 10             	add    $0x10,%esp
+     37b:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     380:	74 10                	je     392 <testdirect+0x1c3>
+    fail("O_DIRECT read");
+     382:	83 ec 0c             	sub    $0xc,%esp
+     385:	68 bb 13 00 00       	push   $0x13bb
+     38a:	e8 71 fc ff ff       	call   0 <fail>
+     38f:	83 c4 10             	add    $0x10,%esp
+  fill(1);
+     392:	83 ec 0c             	sub    $0xc,%esp
+     395:	6a 01                	push   $0x1
+     397:	e8 84 fc ff ff       	call   20 <fill>
+     39c:	83 c4 10             	add    $0x10,%esp
+  if(!same(0, 2*BSIZE) || !same(5*BSIZE, SIZE - 5*BSIZE))
+     39f:	83 ec 08             	sub    $0x8,%esp
+     3a2:	68 00 04 00 00       	push   $0x400
+     3a7:	6a 00                	push   $0x0
+     3a9:	e8 ca fc ff ff       	call   78 <same>
+     3ae:	83 c4 10             	add    $0x10,%esp
+     3b1:	85 c0                	test   %eax,%eax
+     3b3:	74 19                	je     3ce <testdirect+0x1ff>
+     3b5:	83 ec 08             	sub    $0x8,%esp
+     3b8:	68 00 76 00 00       	push   $0x7600
+     3bd:	68 00 0a 00 00       	push   $0xa00
+     3c2:	e8 b1 fc ff ff       	call   78 <same>
+     3c7:	83 c4 10             	add    $0x10,%esp
+     3ca:	85 c0                	test   %eax,%eax
+     3cc:	75 10                	jne    3de <testdirect+0x20f>
+    fail("O_DIRECT read of untouched blocks");
+     3ce:	83 ec 0c             	sub    $0xc,%esp
+     3d1:	68 cc 13 00 00       	push   $0x13cc
+     3d6:	e8 25 fc ff ff       	call   0 <fail>
+     3db:	83 c4 10             	add    $0x10,%esp
+  fill(2);
+     3de:	83 ec 0c             	sub    $0xc,%esp
+     3e1:	6a 02                	push   $0x2
+     3e3:	e8 38 fc ff ff       	call   20 <fill>
+     3e8:	83 c4 10             	add    $0x10,%esp
+  if(!same(2*BSIZE, 3*BSIZE))
+     3eb:	83 ec 08             	sub    $0x8,%esp
+     3ee:	68 00 06 00 00       	push   $0x600
+     3f3:	68 00 04 00 00       	push   $0x400
+     3f8:	e8 7b fc ff ff       	call   78 <same>
+     3fd:	83 c4 10             	add    $0x10,%esp
+     400:	85 c0                	test   %eax,%eax
+     402:	75 10                	jne    414 <testdirect+0x245>
+    fail("O_DIRECT read of buffered write");
+     404:	83 ec 0c             	sub    $0xc,%esp
+     407:	68 f0 13 00 00       	push   $0x13f0
+     40c:	e8 ef fb ff ff       	call   0 <fail>
+     411:	83 c4 10             	add    $0x10,%esp
+
+  // A short file reads short.
+  if(ftruncate(fd2, 1000) < 0 || pread(fd, buf2, 2*BSIZE, 0) != 1000)
+     414:	83 ec 08             	sub    $0x8,%esp
+     417:	68 e8 03 00 00       	push   $0x3e8
+     41c:	ff 75 f0             	push   -0x10(%ebp)
+     41f:	e8 92 05 00 00       	call   9b6 <ftruncate>
+     424:	83 c4 10             	add    $0x10,%esp
+     427:	85 c0                	test   %eax,%eax
+     429:	78 1f                	js     44a <testdirect+0x27b>
+     42b:	a1 e0 18 00 00       	mov    0x18e0,%eax
+     430:	6a 00                	push   $0x0
+     432:	68 00 04 00 00       	push   $0x400
+     437:	50                   	push   %eax
+     438:	ff 75 f4             	push   -0xc(%ebp)
+     43b:	e8 a4 04 00 00       	call   8e4 <pread>
+     440:	83 c4 10             	add    $0x10,%esp
+     443:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     448:	74 10                	je     45a <testdirect+0x28b>
+    fail("O_DIRECT read past the end");
+     44a:	83 ec 0c             	sub    $0xc,%esp
+     44d:	68 10 14 00 00       	push   $0x1410
+     452:	e8 a9 fb ff ff       	call   0 <fail>
+     457:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     45a:	83 ec 0c             	sub    $0xc,%esp
+     45d:	ff 75 f4             	push   -0xc(%ebp)
+     460:	e8 8e 03 00 00       	call   7f3 <close>
+     465:	83 c4 10             	add    $0x10,%esp
+  close(fd2);
+     468:	83 ec 0c             	sub    $0xc,%esp
+     46b:	ff 75 f0             	push   -0x10(%ebp)
+     46e:	e8 80 03 00 00       	call   7f3 <close>
+     473:	83 c4 10             	add    $0x10,%esp
+  unlink(path);
+     476:	83 ec 0c             	sub    $0xc,%esp
+     479:	ff 75 08             	push   0x8(%ebp)
+     47c:	e8 9b 03 00 00       	call   81c <unlink>
+     481:	83 c4 10             	add    $0x10,%esp
+}
+     484:	90                   	nop
+     485:	c9                   	leave
+     486:	c3                   	ret
+
+00000487 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     487:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     48b:	83 e4 f0             	and    $0xfffffff0,%esp
+     48e:	ff 71 fc             	push   -0x4(%ecx)
+     491:	55                   	push   %ebp
+     492:	89 e5                	mov    %esp,%ebp
+     494:	51                   	push   %ecx
+     495:	83 ec 14             	sub    $0x14,%esp
+  char *p;
+
+  p = sbrk(2*SIZE + BSIZE);
+     498:	83 ec 0c             	sub    $0xc,%esp
+     49b:	68 00 02 01 00       	push   $0x10200
+     4a0:	e8 bd 03 00 00       	call   862 <sbrk>
+     4a5:	83 c4 10             	add    $0x10,%esp
+     4a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  buf = p + (BSIZE - (uint)p % BSIZE) % BSIZE;
+     4ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ae:	f7 d8                	neg    %eax
+     4b0:	25 ff 01 00 00       	and    $0x1ff,%eax
+     4b5:	89 c2                	mov    %eax,%edx
+     4b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ba:	01 d0                	add    %edx,%eax
+     4bc:	a3 dc 18 00 00       	mov    %eax,0x18dc
+  buf2 = buf + SIZE;
+     4c1:	a1 dc 18 00 00       	mov    0x18dc,%eax
+     4c6:	05 00 80 00 00       	add    $0x8000,%eax
+     4cb:	a3 e0 18 00 00       	mov    %eax,0x18e0
+
+  testsync("/fsync");
+     4d0:	83 ec 0c             	sub    $0xc,%esp
+     4d3:	68 2b 14 00 00       	push   $0x142b
+     4d8:	e8 f0 fb ff ff       	call   cd <testsync>
+     4dd:	83 c4 10             	add    $0x10,%esp
+  testdirect("/direct");
+     4e0:	83 ec 0c             	sub    $0xc,%esp
+     4e3:	68 32 14 00 00       	push   $0x1432
+     4e8:	e8 e2 fc ff ff       	call   1cf <testdirect>
+     4ed:	83 c4 10             	add    $0x10,%esp
+  printf(1, "fsync, O_SYNC and O_DIRECT ok\n");
+     4f0:	83 ec 08             	sub    $0x8,%esp
+     4f3:	68 3c 14 00 00       	push   $0x143c
+     4f8:	6a 01                	push   $0x1
+     4fa:	e8 61 07 00 00       	call   c60 <printf>
+     4ff:	83 c4 10             	add    $0x10,%esp
+  testsync("/tmp/fsync");
+     502:	83 ec 0c             	sub    $0xc,%esp
+     505:	68 5b 14 00 00       	push   $0x145b
+     50a:	e8 be fb ff ff       	call   cd <testsync>
+     50f:	83 c4 10             	add    $0x10,%esp
+  testdirect("/tmp/direct");
+     512:	83 ec 0c             	sub    $0xc,%esp
+     515:	68 66 14 00 00       	push   $0x1466
+     51a:	e8 b0 fc ff ff       	call   1cf <testdirect>
+     51f:	83 c4 10             	add    $0x10,%esp
+  printf(1, "tmpfs fsync, O_SYNC and O_DIRECT ok\n");
+     522:	83 ec 08             	sub    $0x8,%esp
+     525:	68 74 14 00 00       	push   $0x1474
+     52a:	6a 01                	push   $0x1
+     52c:	e8 2f 07 00 00       	call   c60 <printf>
+     531:	83 c4 10             	add    $0x10,%esp
+  exit();
+     534:	e8 97 02 00 00       	call   7d0 <exit>
+
+00000539 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     539:	55                   	push   %ebp
+     53a:	89 e5                	mov    %esp,%ebp
+     53c:	57                   	push   %edi
+     53d:	53                   	push   %ebx
+    if(cc < 1)
+     53e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     541:	8b 55 10             	mov    0x10(%ebp),%edx
+     544:	8b 45 0c             	mov    0xc(%ebp),%eax
+     547:	89 cb                	mov    %ecx,%ebx
+     549:	89 df                	mov    %ebx,%edi
+     54b:	89 d1                	mov    %edx,%ecx
+     54d:	fc                   	cld
+     54e:	f3 aa                	rep stos %al,%es:(%edi)
+     550:	89 ca                	mov    %ecx,%edx
+     552:	89 fb                	mov    %edi,%ebx
+     554:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     557:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     55a:	90                   	nop
+     55b:	5b                   	pop    %ebx
+     55c:	5f                   	pop    %edi
+     55d:	5d                   	pop    %ebp
+     55e:	c3                   	ret
+
+0000055f <strcpy>:
+{
+     55f:	55                   	push   %ebp
+     560:	89 e5                	mov    %esp,%ebp
+     562:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     565:	8b 45 08             	mov    0x8(%ebp),%eax
+     568:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     56b:	90                   	nop
+     56c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     56f:	8d 42 01             	lea    0x1(%edx),%eax
+     572:	89 45 0c             	mov    %eax,0xc(%ebp)
+     575:	8b 45 08             	mov    0x8(%ebp),%eax
+     578:	8d 48 01             	lea    0x1(%eax),%ecx
+     57b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     57e:	0f b6 12             	movzbl (%edx),%edx
+     581:	88 10                	mov    %dl,(%eax)
+     583:	0f b6 00             	movzbl (%eax),%eax
+     586:	84 c0                	test   %al,%al
+     588:	75 e2                	jne    56c <strcpy+0xd>
+  return os;
+     58a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     58d:	c9                   	leave
+     58e:	c3                   	ret
+
+0000058f <strcmp>:
+{
+     58f:	55                   	push   %ebp
+     590:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     592:	eb 08                	jmp    59c <strcmp+0xd>
+    p++, q++;
+     594:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     598:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     59c:	8b 45 08             	mov    0x8(%ebp),%eax
+     59f:	0f b6 00             	movzbl (%eax),%eax
+     5a2:	84 c0                	test   %al,%al
+     5a4:	74 10                	je     5b6 <strcmp+0x27>
+     5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a9:	0f b6 10             	movzbl (%eax),%edx
+     5ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5af:	0f b6 00             	movzbl (%eax),%eax
+     5b2:	38 c2                	cmp    %al,%dl
+     5b4:	74 de                	je     594 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b9:	0f b6 00             	movzbl (%eax),%eax
+     5bc:	0f b6 d0             	movzbl %al,%edx
+     5bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5c2:	0f b6 00             	movzbl (%eax),%eax
+     5c5:	0f b6 c0             	movzbl %al,%eax
+     5c8:	29 c2                	sub    %eax,%edx
+     5ca:	89 d0                	mov    %edx,%eax
+}
+     5cc:	5d                   	pop    %ebp
+     5cd:	c3                   	ret
+
+000005ce <strlen>:
+{
+     5ce:	55                   	push   %ebp
+     5cf:	89 e5                	mov    %esp,%ebp
+     5d1:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     5d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     5db:	eb 04                	jmp    5e1 <strlen+0x13>
+     5dd:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     5e1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5e4:	8b 45 08             	mov    0x8(%ebp),%eax
+     5e7:	01 d0                	add    %edx,%eax
+     5e9:	0f b6 00             	movzbl (%eax),%eax
+     5ec:	84 c0                	test   %al,%al
+     5ee:	75 ed                	jne    5dd <strlen+0xf>
+  return n;
+     5f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5f3:	c9                   	leave
+     5f4:	c3                   	ret
+
+000005f5 <memset>:
+{
+     5f5:	55                   	push   %ebp
+     5f6:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     5f8:	8b 45 10             	mov    0x10(%ebp),%eax
+     5fb:	50                   	push   %eax
+     5fc:	ff 75 0c             	push   0xc(%ebp)
+     5ff:	ff 75 08             	push   0x8(%ebp)
+     602:	e8 32 ff ff ff       	call   539 <stosb>
+     607:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     60a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     60d:	c9                   	leave
+     60e:	c3                   	ret
+
+0000060f <strchr>:
+{
+     60f:	55                   	push   %ebp
+     610:	89 e5                	mov    %esp,%ebp
+     612:	83 ec 04             	sub    $0x4,%esp
+     615:	8b 45 0c             	mov    0xc(%ebp),%eax
+     618:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     61b:	eb 14                	jmp    631 <strchr+0x22>
+    if(*s == c)
+     61d:	8b 45 08             	mov    0x8(%ebp),%eax
+     620:	0f b6 00             	movzbl (%eax),%eax
+     623:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     626:	75 05                	jne    62d <strchr+0x1e>
+      return (char*)s;
+     628:	8b 45 08             	mov    0x8(%ebp),%eax
+     62b:	eb 13                	jmp    640 <strchr+0x31>
+  for(; *s; s++)
+     62d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     631:	8b 45 08             	mov    0x8(%ebp),%eax
+     634:	0f b6 00             	movzbl (%eax),%eax
+     637:	84 c0                	test   %al,%al
+     639:	75 e2                	jne    61d <strchr+0xe>
+  return 0;
+     63b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     640:	c9                   	leave
+     641:	c3                   	ret
+
+00000642 <gets>:
+{
+     642:	55                   	push   %ebp
+     643:	89 e5                	mov    %esp,%ebp
+     645:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     648:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     64f:	eb 42                	jmp    693 <gets+0x51>
+    cc = read(0, &c, 1);
+     651:	83 ec 04             	sub    $0x4,%esp
+     654:	6a 01                	push   $0x1
+     656:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     659:	50                   	push   %eax
+     65a:	6a 00                	push   $0x0
+     65c:	e8 84 01 00 00       	call   7e5 <read>
+     661:	83 c4 10             	add    $0x10,%esp
+     664:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     667:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     66b:	7e 33                	jle    6a0 <gets+0x5e>
+    buf[i++] = c;
+     66d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     670:	8d 50 01             	lea    0x1(%eax),%edx
+     673:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     676:	89 c2                	mov    %eax,%edx
+     678:	8b 45 08             	mov    0x8(%ebp),%eax
+     67b:	01 c2                	add    %eax,%edx
+     67d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     681:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     683:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     687:	3c 0a                	cmp    $0xa,%al
+     689:	74 16                	je     6a1 <gets+0x5f>
+     68b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     68f:	3c 0d                	cmp    $0xd,%al
+     691:	74 0e                	je     6a1 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     693:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     696:	83 c0 01             	add    $0x1,%eax
+     699:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     69c:	7f b3                	jg     651 <gets+0xf>
+     69e:	eb 01                	jmp    6a1 <gets+0x5f>
+      break;
+     6a0:	90                   	nop
+  }
+  buf[i] = '\0';
+     6a1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6a4:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a7:	01 d0                	add    %edx,%eax
+     6a9:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     6ac:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6af:	c9                   	leave
+     6b0:	c3                   	ret
+
+000006b1 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     6b1:	55                   	push   %ebp
+     6b2:	89 e5                	mov    %esp,%ebp
+     6b4:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     6b7:	83 ec 08             	sub    $0x8,%esp
+     6ba:	6a 00                	push   $0x0
+     6bc:	ff 75 08             	push   0x8(%ebp)
+     6bf:	e8 44 01 00 00       	call   808 <open>
+     6c4:	83 c4 10             	add    $0x10,%esp
+     6c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     6ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6ce:	79 07                	jns    6d7 <stat+0x26>
+    return -1;
+     6d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6d5:	eb 25                	jmp    6fc <stat+0x4b>
+  r = fstat(fd, st);
+     6d7:	83 ec 08             	sub    $0x8,%esp
+     6da:	ff 75 0c             	push   0xc(%ebp)
+     6dd:	ff 75 f4             	push   -0xc(%ebp)
+     6e0:	e8 41 01 00 00       	call   826 <fstat>
+     6e5:	83 c4 10             	add    $0x10,%esp
+     6e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     6eb:	83 ec 0c             	sub    $0xc,%esp
+     6ee:	ff 75 f4             	push   -0xc(%ebp)
+     6f1:	e8 fd 00 00 00       	call   7f3 <close>
+     6f6:	83 c4 10             	add    $0x10,%esp
+  return r;
+     6f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     6fc:	c9                   	leave
+     6fd:	c3                   	ret
+
+000006fe <atoi>:
+
+int
+atoi(const char *s)
+{
+     6fe:	55                   	push   %ebp
+     6ff:	89 e5                	mov    %esp,%ebp
+     701:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     704:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     70b:	eb 25                	jmp    732 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     70d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     710:	89 d0                	mov    %edx,%eax
+     712:	c1 e0 02             	shl    $0x2,%eax
+     715:	01 d0                	add    %edx,%eax
+     717:	01 c0                	add    %eax,%eax
+     719:	89 c1                	mov    %eax,%ecx
+     71b:	8b 45 08             	mov    0x8(%ebp),%eax
+     71e:	8d 50 01             	lea    0x1(%eax),%edx
+     721:	89 55 08             	mov    %edx,0x8(%ebp)
+     724:	0f b6 00             	movzbl (%eax),%eax
+     727:	0f be c0             	movsbl %al,%eax
+     72a:	01 c8                	add    %ecx,%eax
+     72c:	83 e8 30             	sub    $0x30,%eax
+     72f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     732:	8b 45 08             	mov    0x8(%ebp),%eax
+     735:	0f b6 00             	movzbl (%eax),%eax
+     738:	3c 2f                	cmp    $0x2f,%al
+     73a:	7e 0a                	jle    746 <atoi+0x48>
+     73c:	8b 45 08             	mov    0x8(%ebp),%eax
+     73f:	0f b6 00             	movzbl (%eax),%eax
+     742:	3c 39                	cmp    $0x39,%al
+     744:	7e c7                	jle    70d <atoi+0xf>
+  return n;
+     746:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     749:	c9                   	leave
+     74a:	c3                   	ret
+
+0000074b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     74b:	55                   	push   %ebp
+     74c:	89 e5                	mov    %esp,%ebp
+     74e:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     751:	8b 45 08             	mov    0x8(%ebp),%eax
+     754:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     757:	8b 45 0c             	mov    0xc(%ebp),%eax
+     75a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     75d:	eb 17                	jmp    776 <memmove+0x2b>
+    *dst++ = *src++;
+     75f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     762:	8d 42 01             	lea    0x1(%edx),%eax
+     765:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     768:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     76b:	8d 48 01             	lea    0x1(%eax),%ecx
+     76e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     771:	0f b6 12             	movzbl (%edx),%edx
+     774:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     776:	8b 45 10             	mov    0x10(%ebp),%eax
+     779:	8d 50 ff             	lea    -0x1(%eax),%edx
+     77c:	89 55 10             	mov    %edx,0x10(%ebp)
+     77f:	85 c0                	test   %eax,%eax
+     781:	7f dc                	jg     75f <memmove+0x14>
+  return vdst;
+     783:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     786:	c9                   	leave
+     787:	c3                   	ret
+
+00000788 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     788:	83 3d c4 18 00 00 00 	cmpl   $0x0,0x18c4
+  jg 2f
+     78f:	7f 2e                	jg     7bf <dosyscall+0x37>
+  jl 1f
+     791:	7c 29                	jl     7bc <dosyscall+0x34>
+  pushl %eax
+     793:	50                   	push   %eax
+  pushl %ebx
+     794:	53                   	push   %ebx
+  movl $1, %eax
+     795:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     79a:	0f a2                	cpuid
+  popl %ebx
+     79c:	5b                   	pop    %ebx
+  popl %eax
+     79d:	58                   	pop    %eax
+  movl $-1, sysmode
+     79e:	c7 05 c4 18 00 00 ff 	movl   $0xffffffff,0x18c4
+     7a5:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     7a8:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     7ae:	74 0c                	je     7bc <dosyscall+0x34>
+  movl $1, sysmode
+     7b0:	c7 05 c4 18 00 00 01 	movl   $0x1,0x18c4
+     7b7:	00 00 00 
+  jmp 2f
+     7ba:	eb 03                	jmp    7bf <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     7bc:	cd 40                	int    $0x40
+  ret
+     7be:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     7bf:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     7c1:	ba c8 07 00 00       	mov    $0x7c8,%edx
+  sysenter
+     7c6:	0f 34                	sysenter
+3:
+  ret
+     7c8:	c3                   	ret
+
+000007c9 <fork>:
+
+SYSCALL(fork)
+     7c9:	b8 01 00 00 00       	mov    $0x1,%eax
+     7ce:	eb b8                	jmp    788 <dosyscall>
+
+000007d0 <exit>:
+SYSCALL(exit)
+     7d0:	b8 02 00 00 00       	mov    $0x2,%eax
+     7d5:	eb b1                	jmp    788 <dosyscall>
+
+000007d7 <wait>:
+SYSCALL(wait)
+     7d7:	b8 03 00 00 00       	mov    $0x3,%eax
+     7dc:	eb aa                	jmp    788 <dosyscall>
+
+000007de <pipe>:
+SYSCALL(pipe)
+     7de:	b8 04 00 00 00       	mov    $0x4,%eax
+     7e3:	eb a3                	jmp    788 <dosyscall>
+
+000007e5 <read>:
+SYSCALL(read)
+     7e5:	b8 05 00 00 00       	mov    $0x5,%eax
+     7ea:	eb 9c                	jmp    788 <dosyscall>
+
+000007ec <write>:
+SYSCALL(write)
+     7ec:	b8 10 00 00 00       	mov    $0x10,%eax
+     7f1:	eb 95                	jmp    788 <dosyscall>
+
+000007f3 <close>:
+SYSCALL(close)
+     7f3:	b8 15 00 00 00       	mov    $0x15,%eax
+     7f8:	eb 8e                	jmp    788 <dosyscall>
+
+000007fa <kill>:
+SYSCALL(kill)
+     7fa:	b8 06 00 00 00       	mov    $0x6,%eax
+     7ff:	eb 87                	jmp    788 <dosyscall>
+
+00000801 <exec>:
+SYSCALL(exec)
+     801:	b8 07 00 00 00       	mov    $0x7,%eax
+     806:	eb 80                	jmp    788 <dosyscall>
+
+00000808 <open>:
+SYSCALL(open)
+     808:	b8 0f 00 00 00       	mov    $0xf,%eax
+     80d:	e9 76 ff ff ff       	jmp    788 <dosyscall>
+
+00000812 <mknod>:
+SYSCALL(mknod)
+     812:	b8 11 00 00 00       	mov    $0x11,%eax
+     817:	e9 6c ff ff ff       	jmp    788 <dosyscall>
+
+0000081c <unlink>:
+SYSCALL(unlink)
+     81c:	b8 12 00 00 00       	mov    $0x12,%eax
+     821:	e9 62 ff ff ff       	jmp    788 <dosyscall>
+
+00000826 <fstat>:
+SYSCALL(fstat)
+     826:	b8 08 00 00 00       	mov    $0x8,%eax
+     82b:	e9 58 ff ff ff       	jmp    788 <dosyscall>
+
+00000830 <link>:
+SYSCALL(link)
+     830:	b8 13 00 00 00       	mov    $0x13,%eax
+     835:	e9 4e ff ff ff       	jmp    788 <dosyscall>
+
+0000083a <mkdir>:
+SYSCALL(mkdir)
+     83a:	b8 14 00 00 00       	mov    $0x14,%eax
+     83f:	e9 44 ff ff ff       	jmp    788 <dosyscall>
+
+00000844 <chdir>:
+SYSCALL(chdir)
+     844:	b8 09 00 00 00       	mov    $0x9,%eax
+     849:	e9 3a ff ff ff       	jmp    788 <dosyscall>
+
+0000084e <dup>:
+SYSCALL(dup)
+     84e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     853:	e9 30 ff ff ff       	jmp    788 <dosyscall>
+
+00000858 <getpid>:
+SYSCALL(getpid)
+     858:	b8 0b 00 00 00       	mov    $0xb,%eax
+     85d:	e9 26 ff ff ff       	jmp    788 <dosyscall>
+
+00000862 <sbrk>:
+SYSCALL(sbrk)
+     862:	b8 0c 00 00 00       	mov    $0xc,%eax
+     867:	e9 1c ff ff ff       	jmp    788 <dosyscall>
+
+0000086c <sleep>:
+SYSCALL(sleep)
+     86c:	b8 0d 00 00 00       	mov    $0xd,%eax
+     871:	e9 12 ff ff ff       	jmp    788 <dosyscall>
+
+00000876 <uptime>:
+SYSCALL(uptime)
+     876:	b8 0e 00 00 00       	mov    $0xe,%eax
+     87b:	e9 08 ff ff ff       	jmp    788 <dosyscall>
+
+00000880 <symlink>:
+SYSCALL(symlink)
+     880:	b8 16 00 00 00       	mov    $0x16,%eax
+     885:	e9 fe fe ff ff       	jmp    788 <dosyscall>
+
+0000088a <readlink>:
+SYSCALL(readlink)
+     88a:	b8 17 00 00 00       	mov    $0x17,%eax
+     88f:	e9 f4 fe ff ff       	jmp    788 <dosyscall>
+
+00000894 <fprot>:
+SYSCALL(fprot)
+     894:	b8 18 00 00 00       	mov    $0x18,%eax
+     899:	e9 ea fe ff ff       	jmp    788 <dosyscall>
+
+0000089e <funprot>:
+SYSCALL(funprot)
+     89e:	b8 19 00 00 00       	mov    $0x19,%eax
+     8a3:	e9 e0 fe ff ff       	jmp    788 <dosyscall>
+
+000008a8 <funlock>:
+SYSCALL(funlock)
+     8a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8ad:	e9 d6 fe ff ff       	jmp    788 <dosyscall>
+
+000008b2 <mmap>:
+SYSCALL(mmap)
+     8b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8b7:	e9 cc fe ff ff       	jmp    788 <dosyscall>
+
+000008bc <munmap>:
+SYSCALL(munmap)
+     8bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8c1:	e9 c2 fe ff ff       	jmp    788 <dosyscall>
+
+000008c6 <sendfile>:
+SYSCALL(sendfile)
+     8c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8cb:	e9 b8 fe ff ff       	jmp    788 <dosyscall>
+
+000008d0 <readv>:
+SYSCALL(readv)
+     8d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8d5:	e9 ae fe ff ff       	jmp    788 <dosyscall>
+
+000008da <writev>:
+SYSCALL(writev)
+     8da:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8df:	e9 a4 fe ff ff       	jmp    788 <dosyscall>
+
+000008e4 <pread>:
+SYSCALL(pread)
+     8e4:	b8 20 00 00 00       	mov    $0x20,%eax
+     8e9:	e9 9a fe ff ff       	jmp    788 <dosyscall>
+
+000008ee <pwrite>:
+SYSCALL(pwrite)
+     8ee:	b8 21 00 00 00       	mov    $0x21,%eax
+     8f3:	e9 90 fe ff ff       	jmp    788 <dosyscall>
+
+000008f8 <lseek>:
+SYSCALL(lseek)
+     8f8:	b8 22 00 00 00       	mov    $0x22,%eax
+     8fd:	e9 86 fe ff ff       	jmp    788 <dosyscall>
+
+00000902 <spawn>:
+SYSCALL(spawn)
+     902:	b8 23 00 00 00       	mov    $0x23,%eax
+     907:	e9 7c fe ff ff       	jmp    788 <dosyscall>
+
+0000090c <setpriority>:
+SYSCALL(setpriority)
+     90c:	b8 24 00 00 00       	mov    $0x24,%eax
+     911:	e9 72 fe ff ff       	jmp    788 <dosyscall>
+
+00000916 <kthread_create>:
+SYSCALL(kthread_create)
+     916:	b8 25 00 00 00       	mov    $0x25,%eax
+     91b:	e9 68 fe ff ff       	jmp    788 <dosyscall>
+
+00000920 <kthread_id>:
+SYSCALL(kthread_id)
+     920:	b8 26 00 00 00       	mov    $0x26,%eax
+     925:	e9 5e fe ff ff       	jmp    788 <dosyscall>
+
+0000092a <kthread_exit>:
+SYSCALL(kthread_exit)
+     92a:	b8 27 00 00 00       	mov    $0x27,%eax
+     92f:	e9 54 fe ff ff       	jmp    788 <dosyscall>
+
+00000934 <kthread_join>:
+SYSCALL(kthread_join)
+     934:	b8 28 00 00 00       	mov    $0x28,%eax
+     939:	e9 4a fe ff ff       	jmp    788 <dosyscall>
+
+0000093e <futex>:
+SYSCALL(futex)
+     93e:	b8 29 00 00 00       	mov    $0x29,%eax
+     943:	e9 40 fe ff ff       	jmp    788 <dosyscall>
+
+00000948 <signal>:
+SYSCALL(signal)
+     948:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     94d:	e9 36 fe ff ff       	jmp    788 <dosyscall>
+
+00000952 <alarm>:
+SYSCALL(alarm)
+     952:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     957:	e9 2c fe ff ff       	jmp    788 <dosyscall>
+
+0000095c <usleep>:
+SYSCALL(usleep)
+     95c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     961:	e9 22 fe ff ff       	jmp    788 <dosyscall>
+
+00000966 <ioring_setup>:
+SYSCALL(ioring_setup)
+     966:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     96b:	e9 18 fe ff ff       	jmp    788 <dosyscall>
+
+00000970 <ioring_enter>:
+SYSCALL(ioring_enter)
+     970:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     975:	e9 0e fe ff ff       	jmp    788 <dosyscall>
+
+0000097a <getrusage>:
+SYSCALL(getrusage)
+     97a:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     97f:	e9 04 fe ff ff       	jmp    788 <dosyscall>
+
+00000984 <mount>:
+SYSCALL(mount)
+     984:	b8 30 00 00 00       	mov    $0x30,%eax
+     989:	e9 fa fd ff ff       	jmp    788 <dosyscall>
+
+0000098e <getdents>:
+SYSCALL(getdents)
+     98e:	b8 31 00 00 00       	mov    $0x31,%eax
+     993:	e9 f0 fd ff ff       	jmp    788 <dosyscall>
+
+00000998 <yield>:
+SYSCALL(yield)
+     998:	b8 32 00 00 00       	mov    $0x32,%eax
+     99d:	e9 e6 fd ff ff       	jmp    788 <dosyscall>
+
+000009a2 <ncpu>:
+SYSCALL(ncpu)
+     9a2:	b8 33 00 00 00       	mov    $0x33,%eax
+     9a7:	e9 dc fd ff ff       	jmp    788 <dosyscall>
+
+000009ac <fallocate>:
+SYSCALL(fallocate)
+     9ac:	b8 34 00 00 00       	mov    $0x34,%eax
+     9b1:	e9 d2 fd ff ff       	jmp    788 <dosyscall>
+
+000009b6 <ftruncate>:
+SYSCALL(ftruncate)
+     9b6:	b8 35 00 00 00       	mov    $0x35,%eax
+     9bb:	e9 c8 fd ff ff       	jmp    788 <dosyscall>
+
+000009c0 <fsync>:
+SYSCALL(fsync)
+     9c0:	b8 36 00 00 00       	mov    $0x36,%eax
+     9c5:	e9 be fd ff ff       	jmp    788 <dosyscall>
+
+000009ca <fdatasync>:
+SYSCALL(fdatasync)
+     9ca:	b8 37 00 00 00       	mov    $0x37,%eax
+     9cf:	e9 b4 fd ff ff       	jmp    788 <dosyscall>
+
+000009d4 <poll>:
+SYSCALL(poll)
+     9d4:	b8 38 00 00 00       	mov    $0x38,%eax
+     9d9:	e9 aa fd ff ff       	jmp    788 <dosyscall>
+
+000009de <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     9de:	55                   	push   %ebp
+     9df:	89 e5                	mov    %esp,%ebp
+     9e1:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     9e4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e7:	8b 40 04             	mov    0x4(%eax),%eax
+     9ea:	85 c0                	test   %eax,%eax
+     9ec:	7e 1f                	jle    a0d <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     9ee:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f1:	8b 50 04             	mov    0x4(%eax),%edx
+     9f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f7:	8d 48 08             	lea    0x8(%eax),%ecx
+     9fa:	8b 45 08             	mov    0x8(%ebp),%eax
+     9fd:	8b 00                	mov    (%eax),%eax
+     9ff:	83 ec 04             	sub    $0x4,%esp
+     a02:	52                   	push   %edx
+     a03:	51                   	push   %ecx
+     a04:	50                   	push   %eax
+     a05:	e8 d0 fe ff ff       	call   8da <writev>
+     a0a:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+     a10:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     a17:	8b 45 08             	mov    0x8(%ebp),%eax
+     a1a:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     a21:	00 00 00 
+}
+     a24:	90                   	nop
+     a25:	c9                   	leave
+     a26:	c3                   	ret
+
+00000a27 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     a27:	55                   	push   %ebp
+     a28:	89 e5                	mov    %esp,%ebp
+     a2a:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     a2d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     a31:	0f 84 94 00 00 00    	je     acb <put+0xa4>
+    return;
+  if(o->n > 0){
+     a37:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3a:	8b 40 04             	mov    0x4(%eax),%eax
+     a3d:	85 c0                	test   %eax,%eax
+     a3f:	7e 40                	jle    a81 <put+0x5a>
+    v = &o->iov[o->n-1];
+     a41:	8b 45 08             	mov    0x8(%ebp),%eax
+     a44:	8b 40 04             	mov    0x4(%eax),%eax
+     a47:	83 e8 01             	sub    $0x1,%eax
+     a4a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     a51:	8b 45 08             	mov    0x8(%ebp),%eax
+     a54:	01 d0                	add    %edx,%eax
+     a56:	83 c0 08             	add    $0x8,%eax
+     a59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a5f:	8b 10                	mov    (%eax),%edx
+     a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a64:	8b 40 04             	mov    0x4(%eax),%eax
+     a67:	01 d0                	add    %edx,%eax
+     a69:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     a6c:	75 13                	jne    a81 <put+0x5a>
+      v->iov_len += n;
+     a6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a71:	8b 50 04             	mov    0x4(%eax),%edx
+     a74:	8b 45 10             	mov    0x10(%ebp),%eax
+     a77:	01 c2                	add    %eax,%edx
+     a79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a7c:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     a7f:	eb 4b                	jmp    acc <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     a81:	8b 45 08             	mov    0x8(%ebp),%eax
+     a84:	8b 40 04             	mov    0x4(%eax),%eax
+     a87:	83 f8 10             	cmp    $0x10,%eax
+     a8a:	75 0e                	jne    a9a <put+0x73>
+    flush(o);
+     a8c:	83 ec 0c             	sub    $0xc,%esp
+     a8f:	ff 75 08             	push   0x8(%ebp)
+     a92:	e8 47 ff ff ff       	call   9de <flush>
+     a97:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+     a9d:	8b 50 04             	mov    0x4(%eax),%edx
+     aa0:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     aa6:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+     aad:	8b 50 04             	mov    0x4(%eax),%edx
+     ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ab6:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     aba:	8b 45 08             	mov    0x8(%ebp),%eax
+     abd:	8b 40 04             	mov    0x4(%eax),%eax
+     ac0:	8d 50 01             	lea    0x1(%eax),%edx
+     ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac6:	89 50 04             	mov    %edx,0x4(%eax)
+     ac9:	eb 01                	jmp    acc <put+0xa5>
+    return;
+     acb:	90                   	nop
+}
+     acc:	c9                   	leave
+     acd:	c3                   	ret
+
+00000ace <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     ace:	55                   	push   %ebp
+     acf:	89 e5                	mov    %esp,%ebp
+     ad1:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad7:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     add:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ae0:	01 d0                	add    %edx,%eax
+     ae2:	3d 80 00 00 00       	cmp    $0x80,%eax
+     ae7:	77 0b                	ja     af4 <room+0x26>
+     ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+     aec:	8b 40 04             	mov    0x4(%eax),%eax
+     aef:	83 f8 10             	cmp    $0x10,%eax
+     af2:	75 0e                	jne    b02 <room+0x34>
+    flush(o);
+     af4:	83 ec 0c             	sub    $0xc,%esp
+     af7:	ff 75 08             	push   0x8(%ebp)
+     afa:	e8 df fe ff ff       	call   9de <flush>
+     aff:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     b02:	8b 45 08             	mov    0x8(%ebp),%eax
+     b05:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+     b0e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     b14:	01 d0                	add    %edx,%eax
+}
+     b16:	c9                   	leave
+     b17:	c3                   	ret
+
+00000b18 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     b18:	55                   	push   %ebp
+     b19:	89 e5                	mov    %esp,%ebp
+     b1b:	83 ec 28             	sub    $0x28,%esp
+     b1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b21:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     b24:	83 ec 08             	sub    $0x8,%esp
+     b27:	6a 01                	push   $0x1
+     b29:	ff 75 08             	push   0x8(%ebp)
+     b2c:	e8 9d ff ff ff       	call   ace <room>
+     b31:	83 c4 10             	add    $0x10,%esp
+     b34:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b3a:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     b3e:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     b40:	8b 45 08             	mov    0x8(%ebp),%eax
+     b43:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     b49:	8d 50 01             	lea    0x1(%eax),%edx
+     b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b4f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     b55:	83 ec 04             	sub    $0x4,%esp
+     b58:	6a 01                	push   $0x1
+     b5a:	ff 75 f4             	push   -0xc(%ebp)
+     b5d:	ff 75 08             	push   0x8(%ebp)
+     b60:	e8 c2 fe ff ff       	call   a27 <put>
+     b65:	83 c4 10             	add    $0x10,%esp
+}
+     b68:	90                   	nop
+     b69:	c9                   	leave
+     b6a:	c3                   	ret
+
+00000b6b <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b6b:	55                   	push   %ebp
+     b6c:	89 e5                	mov    %esp,%ebp
+     b6e:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     b71:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     b78:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     b7c:	74 17                	je     b95 <printint+0x2a>
+     b7e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     b82:	79 11                	jns    b95 <printint+0x2a>
+    neg = 1;
+     b84:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     b8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b8e:	f7 d8                	neg    %eax
+     b90:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b93:	eb 06                	jmp    b9b <printint+0x30>
+  } else {
+    x = xx;
+     b95:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b98:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b9b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     ba2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ba5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+     bad:	f7 f1                	div    %ecx
+     baf:	89 d1                	mov    %edx,%ecx
+     bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bb4:	8d 50 01             	lea    0x1(%eax),%edx
+     bb7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     bba:	0f b6 91 c8 18 00 00 	movzbl 0x18c8(%ecx),%edx
+     bc1:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     bc5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     bc8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bcb:	ba 00 00 00 00       	mov    $0x0,%edx
+     bd0:	f7 f1                	div    %ecx
+     bd2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     bd5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bd9:	75 c7                	jne    ba2 <printint+0x37>
+  if(neg)
+     bdb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     bdf:	74 0e                	je     bef <printint+0x84>
+    buf[i++] = '-';
+     be1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     be4:	8d 50 01             	lea    0x1(%eax),%edx
+     be7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     bea:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     bef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bf2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     bf5:	83 ec 08             	sub    $0x8,%esp
+     bf8:	ff 75 e8             	push   -0x18(%ebp)
+     bfb:	ff 75 08             	push   0x8(%ebp)
+     bfe:	e8 cb fe ff ff       	call   ace <room>
+     c03:	83 c4 10             	add    $0x10,%esp
+     c06:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     c09:	eb 1d                	jmp    c28 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     c0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c0e:	83 e8 01             	sub    $0x1,%eax
+     c11:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     c14:	89 c2                	mov    %eax,%edx
+     c16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c19:	01 c2                	add    %eax,%edx
+     c1b:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     c1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c21:	01 c8                	add    %ecx,%eax
+     c23:	0f b6 00             	movzbl (%eax),%eax
+     c26:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     c28:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     c2c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c30:	79 d9                	jns    c0b <printint+0xa0>
+  o->used += n;
+     c32:	8b 45 08             	mov    0x8(%ebp),%eax
+     c35:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     c3b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c3e:	01 c2                	add    %eax,%edx
+     c40:	8b 45 08             	mov    0x8(%ebp),%eax
+     c43:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     c49:	83 ec 04             	sub    $0x4,%esp
+     c4c:	ff 75 e8             	push   -0x18(%ebp)
+     c4f:	ff 75 e4             	push   -0x1c(%ebp)
+     c52:	ff 75 08             	push   0x8(%ebp)
+     c55:	e8 cd fd ff ff       	call   a27 <put>
+     c5a:	83 c4 10             	add    $0x10,%esp
+}
+     c5d:	90                   	nop
+     c5e:	c9                   	leave
+     c5f:	c3                   	ret
+
+00000c60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     c69:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6c:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     c72:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     c79:	00 00 00 
+  o.used = 0;
+     c7c:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     c83:	00 00 00 
+  state = 0;
+     c86:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     c8d:	8d 45 0c             	lea    0xc(%ebp),%eax
+     c90:	83 c0 04             	add    $0x4,%eax
+     c93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     c96:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c9d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ca4:	e9 82 01 00 00       	jmp    e2b <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     ca9:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     caf:	01 d0                	add    %edx,%eax
+     cb1:	0f b6 00             	movzbl (%eax),%eax
+     cb4:	0f be c0             	movsbl %al,%eax
+     cb7:	25 ff 00 00 00       	and    $0xff,%eax
+     cbc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     cbf:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     cc3:	75 38                	jne    cfd <printf+0x9d>
+      if(c == '%'){
+     cc5:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     cc9:	0f 85 58 01 00 00    	jne    e27 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     ccf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cd2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     cd8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     cdb:	01 ca                	add    %ecx,%edx
+     cdd:	83 ec 04             	sub    $0x4,%esp
+     ce0:	50                   	push   %eax
+     ce1:	52                   	push   %edx
+     ce2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ce8:	50                   	push   %eax
+     ce9:	e8 39 fd ff ff       	call   a27 <put>
+     cee:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     cf1:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     cf8:	e9 2a 01 00 00       	jmp    e27 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     cfd:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     d01:	0f 85 20 01 00 00    	jne    e27 <printf+0x1c7>
+      if(c == 'd'){
+     d07:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     d0b:	75 22                	jne    d2f <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     d0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d10:	8b 00                	mov    (%eax),%eax
+     d12:	6a 01                	push   $0x1
+     d14:	6a 0a                	push   $0xa
+     d16:	50                   	push   %eax
+     d17:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d1d:	50                   	push   %eax
+     d1e:	e8 48 fe ff ff       	call   b6b <printint>
+     d23:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d26:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     d2a:	e9 e8 00 00 00       	jmp    e17 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     d2f:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     d33:	74 06                	je     d3b <printf+0xdb>
+     d35:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     d39:	75 22                	jne    d5d <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     d3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d3e:	8b 00                	mov    (%eax),%eax
+     d40:	6a 00                	push   $0x0
+     d42:	6a 10                	push   $0x10
+     d44:	50                   	push   %eax
+     d45:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d4b:	50                   	push   %eax
+     d4c:	e8 1a fe ff ff       	call   b6b <printint>
+     d51:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d54:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     d58:	e9 ba 00 00 00       	jmp    e17 <printf+0x1b7>
+      } else if(c == 's'){
+     d5d:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     d61:	75 3f                	jne    da2 <printf+0x142>
+        s = (char*)*ap;
+     d63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d66:	8b 00                	mov    (%eax),%eax
+     d68:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     d6b:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     d6f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d73:	75 07                	jne    d7c <printf+0x11c>
+          s = "(null)";
+     d75:	c7 45 f4 99 14 00 00 	movl   $0x1499,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     d7c:	83 ec 0c             	sub    $0xc,%esp
+     d7f:	ff 75 f4             	push   -0xc(%ebp)
+     d82:	e8 47 f8 ff ff       	call   5ce <strlen>
+     d87:	83 c4 10             	add    $0x10,%esp
+     d8a:	83 ec 04             	sub    $0x4,%esp
+     d8d:	50                   	push   %eax
+     d8e:	ff 75 f4             	push   -0xc(%ebp)
+     d91:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d97:	50                   	push   %eax
+     d98:	e8 8a fc ff ff       	call   a27 <put>
+     d9d:	83 c4 10             	add    $0x10,%esp
+     da0:	eb 75                	jmp    e17 <printf+0x1b7>
+      } else if(c == 'c'){
+     da2:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     da6:	75 21                	jne    dc9 <printf+0x169>
+        putc(&o, *ap);
+     da8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     dab:	8b 00                	mov    (%eax),%eax
+     dad:	0f be c0             	movsbl %al,%eax
+     db0:	83 ec 08             	sub    $0x8,%esp
+     db3:	50                   	push   %eax
+     db4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     dba:	50                   	push   %eax
+     dbb:	e8 58 fd ff ff       	call   b18 <putc>
+     dc0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     dc3:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     dc7:	eb 4e                	jmp    e17 <printf+0x1b7>
+      } else if(c == '%'){
+     dc9:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     dcd:	75 1b                	jne    dea <printf+0x18a>
+        putc(&o, c);
+     dcf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     dd2:	0f be c0             	movsbl %al,%eax
+     dd5:	83 ec 08             	sub    $0x8,%esp
+     dd8:	50                   	push   %eax
+     dd9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ddf:	50                   	push   %eax
+     de0:	e8 33 fd ff ff       	call   b18 <putc>
+     de5:	83 c4 10             	add    $0x10,%esp
+     de8:	eb 2d                	jmp    e17 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     dea:	83 ec 08             	sub    $0x8,%esp
+     ded:	6a 25                	push   $0x25
+     def:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     df5:	50                   	push   %eax
+     df6:	e8 1d fd ff ff       	call   b18 <putc>
+     dfb:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     dfe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     e01:	0f be c0             	movsbl %al,%eax
+     e04:	83 ec 08             	sub    $0x8,%esp
+     e07:	50                   	push   %eax
+     e08:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e0e:	50                   	push   %eax
+     e0f:	e8 04 fd ff ff       	call   b18 <putc>
+     e14:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     e17:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     e1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e21:	83 c0 01             	add    $0x1,%eax
+     e24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     e27:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     e2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     e2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e31:	01 d0                	add    %edx,%eax
+     e33:	0f b6 00             	movzbl (%eax),%eax
+     e36:	84 c0                	test   %al,%al
+     e38:	0f 85 6b fe ff ff    	jne    ca9 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     e3e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     e42:	75 22                	jne    e66 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     e44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e47:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     e4d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     e50:	01 ca                	add    %ecx,%edx
+     e52:	83 ec 04             	sub    $0x4,%esp
+     e55:	50                   	push   %eax
+     e56:	52                   	push   %edx
+     e57:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e5d:	50                   	push   %eax
+     e5e:	e8 c4 fb ff ff       	call   a27 <put>
+     e63:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     e66:	83 ec 0c             	sub    $0xc,%esp
+     e69:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e6f:	50                   	push   %eax
+     e70:	e8 69 fb ff ff       	call   9de <flush>
+     e75:	83 c4 10             	add    $0x10,%esp
+}
+     e78:	90                   	nop
+     e79:	c9                   	leave
+     e7a:	c3                   	ret
+
+00000e7b <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     e7b:	55                   	push   %ebp
+     e7c:	89 e5                	mov    %esp,%ebp
+     e7e:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     e81:	8b 55 08             	mov    0x8(%ebp),%edx
+     e84:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e87:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e8a:	f0 87 02             	lock xchg %eax,(%edx)
+     e8d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     e90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     e93:	c9                   	leave
+     e94:	c3                   	ret
+
+00000e95 <lock>:
+{
+     e95:	55                   	push   %ebp
+     e96:	89 e5                	mov    %esp,%ebp
+     e98:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     e9b:	a1 e4 18 00 00       	mov    0x18e4,%eax
+     ea0:	85 c0                	test   %eax,%eax
+     ea2:	74 09                	je     ead <lock+0x18>
+     ea4:	a1 e4 18 00 00       	mov    0x18e4,%eax
+     ea9:	ff d0                	call   *%eax
+     eab:	eb 05                	jmp    eb2 <lock+0x1d>
+     ead:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     eb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     eb5:	90                   	nop
+     eb6:	83 ec 08             	sub    $0x8,%esp
+     eb9:	6a 01                	push   $0x1
+     ebb:	68 1c 19 00 00       	push   $0x191c
+     ec0:	e8 b6 ff ff ff       	call   e7b <xchg>
+     ec5:	83 c4 10             	add    $0x10,%esp
+     ec8:	85 c0                	test   %eax,%eax
+     eca:	75 ea                	jne    eb6 <lock+0x21>
+  return pin;
+     ecc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     ecf:	c9                   	leave
+     ed0:	c3                   	ret
+
+00000ed1 <unlock>:
+{
+     ed1:	55                   	push   %ebp
+     ed2:	89 e5                	mov    %esp,%ebp
+     ed4:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     ed7:	6a 00                	push   $0x0
+     ed9:	68 1c 19 00 00       	push   $0x191c
+     ede:	e8 98 ff ff ff       	call   e7b <xchg>
+     ee3:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     ee6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     eea:	78 10                	js     efc <unlock+0x2b>
+    mallocunpin(pin);
+     eec:	a1 e8 18 00 00       	mov    0x18e8,%eax
+     ef1:	83 ec 0c             	sub    $0xc,%esp
+     ef4:	ff 75 08             	push   0x8(%ebp)
+     ef7:	ff d0                	call   *%eax
+     ef9:	83 c4 10             	add    $0x10,%esp
+}
+     efc:	90                   	nop
+     efd:	c9                   	leave
+     efe:	c3                   	ret
+
+00000eff <sizeclass>:
+{
+     eff:	55                   	push   %ebp
+     f00:	89 e5                	mov    %esp,%ebp
+     f02:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     f05:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     f0c:	eb 1c                	jmp    f2a <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     f0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f11:	ba 02 00 00 00       	mov    $0x2,%edx
+     f16:	89 c1                	mov    %eax,%ecx
+     f18:	d3 e2                	shl    %cl,%edx
+     f1a:	89 d0                	mov    %edx,%eax
+     f1c:	3b 45 08             	cmp    0x8(%ebp),%eax
+     f1f:	72 05                	jb     f26 <sizeclass+0x27>
+      return c;
+     f21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f24:	eb 0f                	jmp    f35 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     f26:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     f2a:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     f2e:	7e de                	jle    f0e <sizeclass+0xf>
+  return -1;
+     f30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     f35:	c9                   	leave
+     f36:	c3                   	ret
+
+00000f37 <bigfree>:
+{
+     f37:	55                   	push   %ebp
+     f38:	89 e5                	mov    %esp,%ebp
+     f3a:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f3d:	a1 f4 18 00 00       	mov    0x18f4,%eax
+     f42:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     f45:	eb 24                	jmp    f6b <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f4a:	8b 00                	mov    (%eax),%eax
+     f4c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     f4f:	72 12                	jb     f63 <bigfree+0x2c>
+     f51:	8b 45 08             	mov    0x8(%ebp),%eax
+     f54:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     f57:	72 24                	jb     f7d <bigfree+0x46>
+     f59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f5c:	8b 00                	mov    (%eax),%eax
+     f5e:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f61:	72 1a                	jb     f7d <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f66:	8b 00                	mov    (%eax),%eax
+     f68:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     f6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f6e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     f71:	73 d4                	jae    f47 <bigfree+0x10>
+     f73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f76:	8b 00                	mov    (%eax),%eax
+     f78:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f7b:	73 ca                	jae    f47 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+     f80:	8b 40 04             	mov    0x4(%eax),%eax
+     f83:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8d:	01 c2                	add    %eax,%edx
+     f8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f92:	8b 00                	mov    (%eax),%eax
+     f94:	39 c2                	cmp    %eax,%edx
+     f96:	75 24                	jne    fbc <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     f98:	8b 45 08             	mov    0x8(%ebp),%eax
+     f9b:	8b 50 04             	mov    0x4(%eax),%edx
+     f9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fa1:	8b 00                	mov    (%eax),%eax
+     fa3:	8b 40 04             	mov    0x4(%eax),%eax
+     fa6:	01 c2                	add    %eax,%edx
+     fa8:	8b 45 08             	mov    0x8(%ebp),%eax
+     fab:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fb1:	8b 00                	mov    (%eax),%eax
+     fb3:	8b 10                	mov    (%eax),%edx
+     fb5:	8b 45 08             	mov    0x8(%ebp),%eax
+     fb8:	89 10                	mov    %edx,(%eax)
+     fba:	eb 0a                	jmp    fc6 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     fbc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fbf:	8b 10                	mov    (%eax),%edx
+     fc1:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc4:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     fc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fc9:	8b 40 04             	mov    0x4(%eax),%eax
+     fcc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     fd3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fd6:	01 d0                	add    %edx,%eax
+     fd8:	39 45 08             	cmp    %eax,0x8(%ebp)
+     fdb:	75 20                	jne    ffd <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     fdd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fe0:	8b 50 04             	mov    0x4(%eax),%edx
+     fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fe6:	8b 40 04             	mov    0x4(%eax),%eax
+     fe9:	01 c2                	add    %eax,%edx
+     feb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fee:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ff4:	8b 10                	mov    (%eax),%edx
+     ff6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ff9:	89 10                	mov    %edx,(%eax)
+     ffb:	eb 08                	jmp    1005 <bigfree+0xce>
+    p->s.ptr = bp;
+     ffd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1000:	8b 55 08             	mov    0x8(%ebp),%edx
+    1003:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    1005:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1008:	a3 f4 18 00 00       	mov    %eax,0x18f4
+}
+    100d:	90                   	nop
+    100e:	c9                   	leave
+    100f:	c3                   	ret
+
+00001010 <free>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    1016:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    101a:	74 68                	je     1084 <free+0x74>
+  bp = (Header*)ap - 1;
+    101c:	8b 45 08             	mov    0x8(%ebp),%eax
+    101f:	83 e8 08             	sub    $0x8,%eax
+    1022:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    1025:	e8 6b fe ff ff       	call   e95 <lock>
+    102a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    102d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1030:	8b 40 04             	mov    0x4(%eax),%eax
+    1033:	83 ec 0c             	sub    $0xc,%esp
+    1036:	50                   	push   %eax
+    1037:	e8 c3 fe ff ff       	call   eff <sizeclass>
+    103c:	83 c4 10             	add    $0x10,%esp
+    103f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1042:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1046:	78 1e                	js     1066 <free+0x56>
+    bp->s.ptr = classfree[c];
+    1048:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    104b:	8b 14 85 f8 18 00 00 	mov    0x18f8(,%eax,4),%edx
+    1052:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1055:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    1057:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    105a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    105d:	89 14 85 f8 18 00 00 	mov    %edx,0x18f8(,%eax,4)
+    1064:	eb 0e                	jmp    1074 <free+0x64>
+    bigfree(bp);
+    1066:	83 ec 0c             	sub    $0xc,%esp
+    1069:	ff 75 f4             	push   -0xc(%ebp)
+    106c:	e8 c6 fe ff ff       	call   f37 <bigfree>
+    1071:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    1074:	83 ec 0c             	sub    $0xc,%esp
+    1077:	ff 75 f0             	push   -0x10(%ebp)
+    107a:	e8 52 fe ff ff       	call   ed1 <unlock>
+    107f:	83 c4 10             	add    $0x10,%esp
+    1082:	eb 01                	jmp    1085 <free+0x75>
+    return;
+    1084:	90                   	nop
+}
+    1085:	c9                   	leave
+    1086:	c3                   	ret
+
+00001087 <morecore>:
+{
+    1087:	55                   	push   %ebp
+    1088:	89 e5                	mov    %esp,%ebp
+    108a:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    108d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1094:	77 07                	ja     109d <morecore+0x16>
+    nu = 4096;
+    1096:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    109d:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a0:	c1 e0 03             	shl    $0x3,%eax
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	50                   	push   %eax
+    10a7:	e8 b6 f7 ff ff       	call   862 <sbrk>
+    10ac:	83 c4 10             	add    $0x10,%esp
+    10af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    10b2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    10b6:	75 07                	jne    10bf <morecore+0x38>
+    return 0;
+    10b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bd:	eb 22                	jmp    10e1 <morecore+0x5a>
+  hp = (Header*)p;
+    10bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    10c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    10cb:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    10ce:	83 ec 0c             	sub    $0xc,%esp
+    10d1:	ff 75 f0             	push   -0x10(%ebp)
+    10d4:	e8 5e fe ff ff       	call   f37 <bigfree>
+    10d9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    10dc:	a1 f4 18 00 00       	mov    0x18f4,%eax
+}
+    10e1:	c9                   	leave
+    10e2:	c3                   	ret
+
+000010e3 <bigalloc>:
+{
+    10e3:	55                   	push   %ebp
+    10e4:	89 e5                	mov    %esp,%ebp
+    10e6:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    10e9:	a1 f4 18 00 00       	mov    0x18f4,%eax
+    10ee:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10f1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10f5:	75 23                	jne    111a <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    10f7:	c7 45 f0 ec 18 00 00 	movl   $0x18ec,-0x10(%ebp)
+    10fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1101:	a3 f4 18 00 00       	mov    %eax,0x18f4
+    1106:	a1 f4 18 00 00       	mov    0x18f4,%eax
+    110b:	a3 ec 18 00 00       	mov    %eax,0x18ec
+    base.s.size = 0;
+    1110:	c7 05 f0 18 00 00 00 	movl   $0x0,0x18f0
+    1117:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    111a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    111d:	8b 00                	mov    (%eax),%eax
+    111f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1125:	8b 40 04             	mov    0x4(%eax),%eax
+    1128:	3b 45 08             	cmp    0x8(%ebp),%eax
+    112b:	72 4a                	jb     1177 <bigalloc+0x94>
+      if(p->s.size == nunits)
+    112d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1130:	8b 40 04             	mov    0x4(%eax),%eax
+    1133:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1136:	75 0c                	jne    1144 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1138:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    113b:	8b 10                	mov    (%eax),%edx
+    113d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1140:	89 10                	mov    %edx,(%eax)
+    1142:	eb 26                	jmp    116a <bigalloc+0x87>
+        p->s.size -= nunits;
+    1144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1147:	8b 40 04             	mov    0x4(%eax),%eax
+    114a:	2b 45 08             	sub    0x8(%ebp),%eax
+    114d:	89 c2                	mov    %eax,%edx
+    114f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1152:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1155:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1158:	8b 40 04             	mov    0x4(%eax),%eax
+    115b:	c1 e0 03             	shl    $0x3,%eax
+    115e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1161:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1164:	8b 55 08             	mov    0x8(%ebp),%edx
+    1167:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    116a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    116d:	a3 f4 18 00 00       	mov    %eax,0x18f4
+      return p;
+    1172:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1175:	eb 3b                	jmp    11b2 <bigalloc+0xcf>
+    if(p == freep)
+    1177:	a1 f4 18 00 00       	mov    0x18f4,%eax
+    117c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    117f:	75 1e                	jne    119f <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1181:	83 ec 0c             	sub    $0xc,%esp
+    1184:	ff 75 08             	push   0x8(%ebp)
+    1187:	e8 fb fe ff ff       	call   1087 <morecore>
+    118c:	83 c4 10             	add    $0x10,%esp
+    118f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1192:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1196:	75 07                	jne    119f <bigalloc+0xbc>
+        return 0;
+    1198:	b8 00 00 00 00       	mov    $0x0,%eax
+    119d:	eb 13                	jmp    11b2 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    119f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11a8:	8b 00                	mov    (%eax),%eax
+    11aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    11ad:	e9 70 ff ff ff       	jmp    1122 <bigalloc+0x3f>
+}
+    11b2:	c9                   	leave
+    11b3:	c3                   	ret
+
+000011b4 <alloc>:
+alloc(uint nbytes)
+{
+    11b4:	55                   	push   %ebp
+    11b5:	89 e5                	mov    %esp,%ebp
+    11b7:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    11ba:	8b 45 08             	mov    0x8(%ebp),%eax
+    11bd:	83 c0 07             	add    $0x7,%eax
+    11c0:	c1 e8 03             	shr    $0x3,%eax
+    11c3:	83 c0 01             	add    $0x1,%eax
+    11c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    11c9:	ff 75 f4             	push   -0xc(%ebp)
+    11cc:	e8 2e fd ff ff       	call   eff <sizeclass>
+    11d1:	83 c4 04             	add    $0x4,%esp
+    11d4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11d7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11db:	79 2c                	jns    1209 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    11dd:	83 ec 0c             	sub    $0xc,%esp
+    11e0:	ff 75 f4             	push   -0xc(%ebp)
+    11e3:	e8 fb fe ff ff       	call   10e3 <bigalloc>
+    11e8:	83 c4 10             	add    $0x10,%esp
+    11eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11f2:	75 0a                	jne    11fe <alloc+0x4a>
+      return 0;
+    11f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    11f9:	e9 c8 00 00 00       	jmp    12c6 <alloc+0x112>
+    return (void*)(p + 1);
+    11fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1201:	83 c0 08             	add    $0x8,%eax
+    1204:	e9 bd 00 00 00       	jmp    12c6 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1209:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    120c:	8b 04 85 f8 18 00 00 	mov    0x18f8(,%eax,4),%eax
+    1213:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1216:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    121a:	74 1a                	je     1236 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    121c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    121f:	8b 10                	mov    (%eax),%edx
+    1221:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1224:	89 14 85 f8 18 00 00 	mov    %edx,0x18f8(,%eax,4)
+    return (void*)(p + 1);
+    122b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    122e:	83 c0 08             	add    $0x8,%eax
+    1231:	e9 90 00 00 00       	jmp    12c6 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1236:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1239:	ba 02 00 00 00       	mov    $0x2,%edx
+    123e:	89 c1                	mov    %eax,%ecx
+    1240:	d3 e2                	shl    %cl,%edx
+    1242:	89 d0                	mov    %edx,%eax
+    1244:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    1247:	a1 14 19 00 00       	mov    0x1914,%eax
+    124c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    124f:	c1 e2 03             	shl    $0x3,%edx
+    1252:	01 d0                	add    %edx,%eax
+    1254:	8b 15 18 19 00 00    	mov    0x1918,%edx
+    125a:	39 c2                	cmp    %eax,%edx
+    125c:	73 3f                	jae    129d <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    125e:	83 ec 0c             	sub    $0xc,%esp
+    1261:	68 00 08 00 00       	push   $0x800
+    1266:	e8 78 fe ff ff       	call   10e3 <bigalloc>
+    126b:	83 c4 10             	add    $0x10,%esp
+    126e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1271:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1275:	75 07                	jne    127e <alloc+0xca>
+      return 0;
+    1277:	b8 00 00 00 00       	mov    $0x0,%eax
+    127c:	eb 48                	jmp    12c6 <alloc+0x112>
+    bump = (char*)p;
+    127e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1281:	a3 14 19 00 00       	mov    %eax,0x1914
+    bumpend = (char*)(p + p->s.size);
+    1286:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1289:	8b 40 04             	mov    0x4(%eax),%eax
+    128c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1293:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1296:	01 d0                	add    %edx,%eax
+    1298:	a3 18 19 00 00       	mov    %eax,0x1918
+  }
+  p = (Header*)bump;
+    129d:	a1 14 19 00 00       	mov    0x1914,%eax
+    12a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    12a5:	a1 14 19 00 00       	mov    0x1914,%eax
+    12aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12ad:	c1 e2 03             	shl    $0x3,%edx
+    12b0:	01 d0                	add    %edx,%eax
+    12b2:	a3 14 19 00 00       	mov    %eax,0x1914
+  p->s.size = nunits;
+    12b7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12bd:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    12c0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12c3:	83 c0 08             	add    $0x8,%eax
+}
+    12c6:	c9                   	leave
+    12c7:	c3                   	ret
+
+000012c8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12c8:	55                   	push   %ebp
+    12c9:	89 e5                	mov    %esp,%ebp
+    12cb:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    12ce:	e8 c2 fb ff ff       	call   e95 <lock>
+    12d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    12d6:	83 ec 0c             	sub    $0xc,%esp
+    12d9:	ff 75 08             	push   0x8(%ebp)
+    12dc:	e8 d3 fe ff ff       	call   11b4 <alloc>
+    12e1:	83 c4 10             	add    $0x10,%esp
+    12e4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    12e7:	83 ec 0c             	sub    $0xc,%esp
+    12ea:	ff 75 f4             	push   -0xc(%ebp)
+    12ed:	e8 df fb ff ff       	call   ed1 <unlock>
+    12f2:	83 c4 10             	add    $0x10,%esp
+  return p;
+    12f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    12f8:	c9                   	leave
+    12f9:	c3                   	ret
@@ -0,0 +1,117 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+#define SIZE  (32*1024)
+
+// O_DIRECT buffers must be block-aligned, so they come from sbrk.
+char *buf, *buf2;
+
+static void
+fail(char *what)
+{
+  printf(1, "error: %s\n", what);
+  exit();
+}
+
+static void
+fill(int seed)
+{
+  int i;
+
+  for(i = 0; i < SIZE; i++)
+    buf[i] = 'a' + (i + seed) % 23;
+}
+
+static int
+same(int off, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(buf2[off+i] != buf[off+i])
+      return 0;
+  return 1;
+}
+
+static void
+testsync(char *path)
+{
+  int fd;
+
+  fill(0);
+  unlink(path);
+  if((fd = open(path, O_CREATE | O_RDWR | O_SYNC)) < 0)
+    fail("create O_SYNC");
+  if(write(fd, buf, 3000) != 3000 || fsync(fd) < 0 || fdatasync(fd) < 0)
+    fail("O_SYNC write or fsync");
+  if(pread(fd, buf2, 3000, 0) != 3000 || !same(0, 3000))
+    fail("read back O_SYNC write");
+  close(fd);
+  unlink(path);
+}
+
+static void
+testdirect(char *path)
+{
+  int fd, fd2;
+
+  fill(1);
+  unlink(path);
+  if((fd = open(path, O_CREATE | O_RDWR | O_DIRECT)) < 0)
+    fail("create O_DIRECT");
+  if((fd2 = open(path, O_RDWR)) < 0)
+    fail("open buffered");
+
+  // Misaligned offsets, lengths and buffers are refused, except
+  // on a tmpfs, where O_DIRECT means nothing.
+  if(path[1] != 't' && (write(fd, buf, 100) >= 0 ||
+     pwrite(fd, buf + 1, BSIZE, 0) >= 0))
+    fail("misaligned O_DIRECT write");
+
+  // Written around the caches, read back through them.
+  if(write(fd, buf, SIZE) != SIZE || fsync(fd) < 0)
+    fail("O_DIRECT write");
+  if(pread(fd2, buf2, SIZE, 0) != SIZE || !same(0, SIZE))
+    fail("buffered read of O_DIRECT write");
+
+  // Written through the caches, read back around them.
+  fill(2);
+  if(pwrite(fd2, buf + 2*BSIZE, 3*BSIZE, 2*BSIZE) != 3*BSIZE)
+    fail("buffered write");
+  if(pread(fd, buf2, SIZE, 0) != SIZE)
+    fail("O_DIRECT read");
+  fill(1);
+  if(!same(0, 2*BSIZE) || !same(5*BSIZE, SIZE - 5*BSIZE))
+    fail("O_DIRECT read of untouched blocks");
+  fill(2);
+  if(!same(2*BSIZE, 3*BSIZE))
+    fail("O_DIRECT read of buffered write");
+
+  // A short file reads short.
+  if(ftruncate(fd2, 1000) < 0 || pread(fd, buf2, 2*BSIZE, 0) != 1000)
+    fail("O_DIRECT read past the end");
+  close(fd);
+  close(fd2);
+  unlink(path);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *p;
+
+  p = sbrk(2*SIZE + BSIZE);
+  buf = p + (BSIZE - (uint)p % BSIZE) % BSIZE;
+  buf2 = buf + SIZE;
+
+  testsync("/fsync");
+  testdirect("/direct");
+  printf(1, "fsync, O_SYNC and O_DIRECT ok\n");
+  testsync("/tmp/fsync");
+  testdirect("/tmp/direct");
+  printf(1, "tmpfs fsync, O_SYNC and O_DIRECT ok\n");
+  exit();
+}
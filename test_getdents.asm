@@ -0,0 +1,2165 @@
+
+_test_getdents:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define DIR "/getdents_dir"
+#define NFILE 20
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	81 ec f4 00 00 00    	sub    $0xf4,%esp
+  char path[32];
+  struct dent d[6];
+  struct stat st;
+  int fd, i, n, seen, dirs;
+
+  if(mkdir(DIR) < 0 || mkdir(DIR "/sub") < 0){
+      14:	83 ec 0c             	sub    $0xc,%esp
+      17:	68 24 12 00 00       	push   $0x1224
+      1c:	e8 41 07 00 00       	call   762 <mkdir>
+      21:	83 c4 10             	add    $0x10,%esp
+      24:	85 c0                	test   %eax,%eax
+      26:	78 14                	js     3c <main+0x3c>
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	68 32 12 00 00       	push   $0x1232
+      30:	e8 2d 07 00 00       	call   762 <mkdir>
+      35:	83 c4 10             	add    $0x10,%esp
+      38:	85 c0                	test   %eax,%eax
+      3a:	79 1c                	jns    58 <main+0x58>
+    printf(1, "error: mkdir %s\n", DIR);
+      3c:	83 ec 04             	sub    $0x4,%esp
+      3f:	68 24 12 00 00       	push   $0x1224
+      44:	68 44 12 00 00       	push   $0x1244
+      49:	6a 01                	push   $0x1
+      4b:	e8 38 0b 00 00       	call   b88 <printf>
+      50:	83 c4 10             	add    $0x10,%esp
+    exit();
+      53:	e8 a0 06 00 00       	call   6f8 <exit>
+  }
+  strcpy(path, DIR "/f00");
+      58:	83 ec 08             	sub    $0x8,%esp
+      5b:	68 55 12 00 00       	push   $0x1255
+      60:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+      63:	50                   	push   %eax
+      64:	e8 1e 04 00 00       	call   487 <strcpy>
+      69:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFILE; i++){
+      6c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      73:	e9 ad 00 00 00       	jmp    125 <main+0x125>
+    path[sizeof(DIR)+1] = '0' + i / 10;
+      78:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      7b:	ba 67 66 66 66       	mov    $0x66666667,%edx
+      80:	89 c8                	mov    %ecx,%eax
+      82:	f7 ea                	imul   %edx
+      84:	c1 fa 02             	sar    $0x2,%edx
+      87:	89 c8                	mov    %ecx,%eax
+      89:	c1 f8 1f             	sar    $0x1f,%eax
+      8c:	29 c2                	sub    %eax,%edx
+      8e:	89 d0                	mov    %edx,%eax
+      90:	83 c0 30             	add    $0x30,%eax
+      93:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    path[sizeof(DIR)+2] = '0' + i % 10;
+      96:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      99:	ba 67 66 66 66       	mov    $0x66666667,%edx
+      9e:	89 c8                	mov    %ecx,%eax
+      a0:	f7 ea                	imul   %edx
+      a2:	c1 fa 02             	sar    $0x2,%edx
+      a5:	89 c8                	mov    %ecx,%eax
+      a7:	c1 f8 1f             	sar    $0x1f,%eax
+      aa:	29 c2                	sub    %eax,%edx
+      ac:	89 d0                	mov    %edx,%eax
+      ae:	c1 e0 02             	shl    $0x2,%eax
+      b1:	01 d0                	add    %edx,%eax
+      b3:	01 c0                	add    %eax,%eax
+      b5:	29 c1                	sub    %eax,%ecx
+      b7:	89 ca                	mov    %ecx,%edx
+      b9:	89 d0                	mov    %edx,%eax
+      bb:	83 c0 30             	add    $0x30,%eax
+      be:	88 45 d4             	mov    %al,-0x2c(%ebp)
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0 || write(fd, path, i) != i){
+      c1:	83 ec 08             	sub    $0x8,%esp
+      c4:	68 02 02 00 00       	push   $0x202
+      c9:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+      cc:	50                   	push   %eax
+      cd:	e8 5e 06 00 00       	call   730 <open>
+      d2:	83 c4 10             	add    $0x10,%esp
+      d5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      d8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+      dc:	78 1a                	js     f8 <main+0xf8>
+      de:	83 ec 04             	sub    $0x4,%esp
+      e1:	ff 75 f4             	push   -0xc(%ebp)
+      e4:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+      e7:	50                   	push   %eax
+      e8:	ff 75 e8             	push   -0x18(%ebp)
+      eb:	e8 24 06 00 00       	call   714 <write>
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+      f6:	74 1b                	je     113 <main+0x113>
+      printf(1, "error: creating %s\n", path);
+      f8:	83 ec 04             	sub    $0x4,%esp
+      fb:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+      fe:	50                   	push   %eax
+      ff:	68 67 12 00 00       	push   $0x1267
+     104:	6a 01                	push   $0x1
+     106:	e8 7d 0a 00 00       	call   b88 <printf>
+     10b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     10e:	e8 e5 05 00 00       	call   6f8 <exit>
+    }
+    close(fd);
+     113:	83 ec 0c             	sub    $0xc,%esp
+     116:	ff 75 e8             	push   -0x18(%ebp)
+     119:	e8 fd 05 00 00       	call   71b <close>
+     11e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFILE; i++){
+     121:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     125:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     129:	0f 8e 49 ff ff ff    	jle    78 <main+0x78>
+  }
+  unlink(DIR "/f05");  // leaves a hole
+     12f:	83 ec 0c             	sub    $0xc,%esp
+     132:	68 7b 12 00 00       	push   $0x127b
+     137:	e8 08 06 00 00       	call   744 <unlink>
+     13c:	83 c4 10             	add    $0x10,%esp
+
+  // Entries come in batches, each with its type and size.
+  if((fd = open(DIR, O_RDONLY)) < 0){
+     13f:	83 ec 08             	sub    $0x8,%esp
+     142:	6a 00                	push   $0x0
+     144:	68 24 12 00 00       	push   $0x1224
+     149:	e8 e2 05 00 00       	call   730 <open>
+     14e:	83 c4 10             	add    $0x10,%esp
+     151:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     154:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     158:	79 1c                	jns    176 <main+0x176>
+    printf(1, "error: open %s\n", DIR);
+     15a:	83 ec 04             	sub    $0x4,%esp
+     15d:	68 24 12 00 00       	push   $0x1224
+     162:	68 8d 12 00 00       	push   $0x128d
+     167:	6a 01                	push   $0x1
+     169:	e8 1a 0a 00 00       	call   b88 <printf>
+     16e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     171:	e8 82 05 00 00       	call   6f8 <exit>
+  }
+  seen = dirs = 0;
+     176:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     17d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     180:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = getdents(fd, d, 6)) > 0){
+     183:	e9 94 01 00 00       	jmp    31c <main+0x31c>
+    for(i = 0; i < n; i++){
+     188:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     18f:	e9 7c 01 00 00       	jmp    310 <main+0x310>
+      if(d[i].name[0] == 'f'){
+     194:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     197:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     19a:	8d 40 f8             	lea    -0x8(%eax),%eax
+     19d:	01 e8                	add    %ebp,%eax
+     19f:	2d d0 00 00 00       	sub    $0xd0,%eax
+     1a4:	0f b6 00             	movzbl (%eax),%eax
+     1a7:	3c 66                	cmp    $0x66,%al
+     1a9:	0f 85 40 01 00 00    	jne    2ef <main+0x2ef>
+        strcpy(path, DIR "/");
+     1af:	83 ec 08             	sub    $0x8,%esp
+     1b2:	68 9d 12 00 00       	push   $0x129d
+     1b7:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     1ba:	50                   	push   %eax
+     1bb:	e8 c7 02 00 00       	call   487 <strcpy>
+     1c0:	83 c4 10             	add    $0x10,%esp
+        strcpy(path + sizeof(DIR), d[i].name);
+     1c3:	8d 95 1c ff ff ff    	lea    -0xe4(%ebp),%edx
+     1c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1cc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     1cf:	01 d0                	add    %edx,%eax
+     1d1:	8d 50 0c             	lea    0xc(%eax),%edx
+     1d4:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     1d7:	83 c0 0e             	add    $0xe,%eax
+     1da:	83 ec 08             	sub    $0x8,%esp
+     1dd:	52                   	push   %edx
+     1de:	50                   	push   %eax
+     1df:	e8 a3 02 00 00       	call   487 <strcpy>
+     1e4:	83 c4 10             	add    $0x10,%esp
+        if(stat(path, &st) < 0 || st.ino != d[i].ino || st.type != T_FILE ||
+     1e7:	83 ec 08             	sub    $0x8,%esp
+     1ea:	8d 85 08 ff ff ff    	lea    -0xf8(%ebp),%eax
+     1f0:	50                   	push   %eax
+     1f1:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     1f4:	50                   	push   %eax
+     1f5:	e8 df 03 00 00       	call   5d9 <stat>
+     1fa:	83 c4 10             	add    $0x10,%esp
+     1fd:	85 c0                	test   %eax,%eax
+     1ff:	0f 88 bb 00 00 00    	js     2c0 <main+0x2c0>
+     205:	8b 95 10 ff ff ff    	mov    -0xf0(%ebp),%edx
+     20b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     20e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     211:	8d 40 f8             	lea    -0x8(%eax),%eax
+     214:	01 e8                	add    %ebp,%eax
+     216:	2d dc 00 00 00       	sub    $0xdc,%eax
+     21b:	8b 00                	mov    (%eax),%eax
+     21d:	39 c2                	cmp    %eax,%edx
+     21f:	0f 85 9b 00 00 00    	jne    2c0 <main+0x2c0>
+     225:	0f b7 85 08 ff ff ff 	movzwl -0xf8(%ebp),%eax
+     22c:	66 83 f8 02          	cmp    $0x2,%ax
+     230:	0f 85 8a 00 00 00    	jne    2c0 <main+0x2c0>
+           d[i].type != T_FILE || d[i].size != st.size ||
+     236:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     239:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     23c:	8d 40 f8             	lea    -0x8(%eax),%eax
+     23f:	01 e8                	add    %ebp,%eax
+     241:	2d d8 00 00 00       	sub    $0xd8,%eax
+     246:	0f b7 00             	movzwl (%eax),%eax
+        if(stat(path, &st) < 0 || st.ino != d[i].ino || st.type != T_FILE ||
+     249:	66 83 f8 02          	cmp    $0x2,%ax
+     24d:	75 71                	jne    2c0 <main+0x2c0>
+           d[i].type != T_FILE || d[i].size != st.size ||
+     24f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     252:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     255:	8d 40 f8             	lea    -0x8(%eax),%eax
+     258:	01 e8                	add    %ebp,%eax
+     25a:	2d d4 00 00 00       	sub    $0xd4,%eax
+     25f:	8b 10                	mov    (%eax),%edx
+     261:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+     267:	39 c2                	cmp    %eax,%edx
+     269:	75 55                	jne    2c0 <main+0x2c0>
+           d[i].size != (d[i].name[1]-'0')*10 + d[i].name[2]-'0'){
+     26b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     26e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     271:	8d 40 f8             	lea    -0x8(%eax),%eax
+     274:	01 e8                	add    %ebp,%eax
+     276:	2d d4 00 00 00       	sub    $0xd4,%eax
+     27b:	8b 08                	mov    (%eax),%ecx
+     27d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     280:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     283:	8d 40 f8             	lea    -0x8(%eax),%eax
+     286:	01 e8                	add    %ebp,%eax
+     288:	2d cf 00 00 00       	sub    $0xcf,%eax
+     28d:	0f b6 00             	movzbl (%eax),%eax
+     290:	0f be c0             	movsbl %al,%eax
+     293:	8d 50 d0             	lea    -0x30(%eax),%edx
+     296:	89 d0                	mov    %edx,%eax
+     298:	c1 e0 02             	shl    $0x2,%eax
+     29b:	01 d0                	add    %edx,%eax
+     29d:	01 c0                	add    %eax,%eax
+     29f:	89 c2                	mov    %eax,%edx
+     2a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2a4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     2a7:	8d 40 f8             	lea    -0x8(%eax),%eax
+     2aa:	01 e8                	add    %ebp,%eax
+     2ac:	2d ce 00 00 00       	sub    $0xce,%eax
+     2b1:	0f b6 00             	movzbl (%eax),%eax
+     2b4:	0f be c0             	movsbl %al,%eax
+     2b7:	01 d0                	add    %edx,%eax
+     2b9:	83 e8 30             	sub    $0x30,%eax
+           d[i].type != T_FILE || d[i].size != st.size ||
+     2bc:	39 c1                	cmp    %eax,%ecx
+     2be:	74 29                	je     2e9 <main+0x2e9>
+          printf(1, "error: entry %s\n", d[i].name);
+     2c0:	8d 95 1c ff ff ff    	lea    -0xe4(%ebp),%edx
+     2c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2c9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     2cc:	01 d0                	add    %edx,%eax
+     2ce:	83 c0 0c             	add    $0xc,%eax
+     2d1:	83 ec 04             	sub    $0x4,%esp
+     2d4:	50                   	push   %eax
+     2d5:	68 ac 12 00 00       	push   $0x12ac
+     2da:	6a 01                	push   $0x1
+     2dc:	e8 a7 08 00 00       	call   b88 <printf>
+     2e1:	83 c4 10             	add    $0x10,%esp
+          exit();
+     2e4:	e8 0f 04 00 00       	call   6f8 <exit>
+        }
+        seen++;
+     2e9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     2ed:	eb 1d                	jmp    30c <main+0x30c>
+      } else if(d[i].type == T_DIR)
+     2ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2f2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+     2f5:	8d 40 f8             	lea    -0x8(%eax),%eax
+     2f8:	01 e8                	add    %ebp,%eax
+     2fa:	2d d8 00 00 00       	sub    $0xd8,%eax
+     2ff:	0f b7 00             	movzwl (%eax),%eax
+     302:	66 83 f8 01          	cmp    $0x1,%ax
+     306:	75 04                	jne    30c <main+0x30c>
+        dirs++;
+     308:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < n; i++){
+     30c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     310:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     313:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     316:	0f 8c 78 fe ff ff    	jl     194 <main+0x194>
+  while((n = getdents(fd, d, 6)) > 0){
+     31c:	83 ec 04             	sub    $0x4,%esp
+     31f:	6a 06                	push   $0x6
+     321:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+     327:	50                   	push   %eax
+     328:	ff 75 e8             	push   -0x18(%ebp)
+     32b:	e8 86 05 00 00       	call   8b6 <getdents>
+     330:	83 c4 10             	add    $0x10,%esp
+     333:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     336:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     33a:	0f 8f 48 fe ff ff    	jg     188 <main+0x188>
+    }
+  }
+  if(n < 0 || seen != NFILE - 1 || dirs != 3){
+     340:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     344:	78 0c                	js     352 <main+0x352>
+     346:	83 7d f0 13          	cmpl   $0x13,-0x10(%ebp)
+     34a:	75 06                	jne    352 <main+0x352>
+     34c:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+     350:	74 1a                	je     36c <main+0x36c>
+    printf(1, "error: %d files, %d directories\n", seen, dirs);
+     352:	ff 75 ec             	push   -0x14(%ebp)
+     355:	ff 75 f0             	push   -0x10(%ebp)
+     358:	68 c0 12 00 00       	push   $0x12c0
+     35d:	6a 01                	push   $0x1
+     35f:	e8 24 08 00 00       	call   b88 <printf>
+     364:	83 c4 10             	add    $0x10,%esp
+    exit();
+     367:	e8 8c 03 00 00       	call   6f8 <exit>
+  }
+  close(fd);
+     36c:	83 ec 0c             	sub    $0xc,%esp
+     36f:	ff 75 e8             	push   -0x18(%ebp)
+     372:	e8 a4 03 00 00       	call   71b <close>
+     377:	83 c4 10             	add    $0x10,%esp
+  if(getdents(0, d, 6) >= 0){
+     37a:	83 ec 04             	sub    $0x4,%esp
+     37d:	6a 06                	push   $0x6
+     37f:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+     385:	50                   	push   %eax
+     386:	6a 00                	push   $0x0
+     388:	e8 29 05 00 00       	call   8b6 <getdents>
+     38d:	83 c4 10             	add    $0x10,%esp
+     390:	85 c0                	test   %eax,%eax
+     392:	78 17                	js     3ab <main+0x3ab>
+    printf(1, "error: getdents on a non-directory\n");
+     394:	83 ec 08             	sub    $0x8,%esp
+     397:	68 e4 12 00 00       	push   $0x12e4
+     39c:	6a 01                	push   $0x1
+     39e:	e8 e5 07 00 00       	call   b88 <printf>
+     3a3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3a6:	e8 4d 03 00 00       	call   6f8 <exit>
+  }
+  printf(1, "getdents ok\n");
+     3ab:	83 ec 08             	sub    $0x8,%esp
+     3ae:	68 08 13 00 00       	push   $0x1308
+     3b3:	6a 01                	push   $0x1
+     3b5:	e8 ce 07 00 00       	call   b88 <printf>
+     3ba:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NFILE; i++){
+     3bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3c4:	eb 70                	jmp    436 <main+0x436>
+    strcpy(path, DIR "/f00");
+     3c6:	83 ec 08             	sub    $0x8,%esp
+     3c9:	68 55 12 00 00       	push   $0x1255
+     3ce:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     3d1:	50                   	push   %eax
+     3d2:	e8 b0 00 00 00       	call   487 <strcpy>
+     3d7:	83 c4 10             	add    $0x10,%esp
+    path[sizeof(DIR)+1] = '0' + i / 10;
+     3da:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     3dd:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     3e2:	89 c8                	mov    %ecx,%eax
+     3e4:	f7 ea                	imul   %edx
+     3e6:	c1 fa 02             	sar    $0x2,%edx
+     3e9:	89 c8                	mov    %ecx,%eax
+     3eb:	c1 f8 1f             	sar    $0x1f,%eax
+     3ee:	29 c2                	sub    %eax,%edx
+     3f0:	89 d0                	mov    %edx,%eax
+     3f2:	83 c0 30             	add    $0x30,%eax
+     3f5:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    path[sizeof(DIR)+2] = '0' + i % 10;
+     3f8:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     3fb:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     400:	89 c8                	mov    %ecx,%eax
+     402:	f7 ea                	imul   %edx
+     404:	c1 fa 02             	sar    $0x2,%edx
+     407:	89 c8                	mov    %ecx,%eax
+     409:	c1 f8 1f             	sar    $0x1f,%eax
+     40c:	29 c2                	sub    %eax,%edx
+     40e:	89 d0                	mov    %edx,%eax
+     410:	c1 e0 02             	shl    $0x2,%eax
+     413:	01 d0                	add    %edx,%eax
+     415:	01 c0                	add    %eax,%eax
+     417:	29 c1                	sub    %eax,%ecx
+     419:	89 ca                	mov    %ecx,%edx
+     41b:	89 d0                	mov    %edx,%eax
+     41d:	83 c0 30             	add    $0x30,%eax
+     420:	88 45 d4             	mov    %al,-0x2c(%ebp)
+    unlink(path);
+     423:	83 ec 0c             	sub    $0xc,%esp
+     426:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     429:	50                   	push   %eax
+     42a:	e8 15 03 00 00       	call   744 <unlink>
+     42f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFILE; i++){
+     432:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     436:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     43a:	7e 8a                	jle    3c6 <main+0x3c6>
+  }
+  unlink(DIR "/sub");
+     43c:	83 ec 0c             	sub    $0xc,%esp
+     43f:	68 32 12 00 00       	push   $0x1232
+     444:	e8 fb 02 00 00       	call   744 <unlink>
+     449:	83 c4 10             	add    $0x10,%esp
+  unlink(DIR);
+     44c:	83 ec 0c             	sub    $0xc,%esp
+     44f:	68 24 12 00 00       	push   $0x1224
+     454:	e8 eb 02 00 00       	call   744 <unlink>
+     459:	83 c4 10             	add    $0x10,%esp
+  exit();
+     45c:	e8 97 02 00 00       	call   6f8 <exit>
+
+00000461 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     461:	55                   	push   %ebp
+     462:	89 e5                	mov    %esp,%ebp
+     464:	57                   	push   %edi
+     465:	53                   	push   %ebx
+    if(cc < 1)
+     466:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     469:	8b 55 10             	mov    0x10(%ebp),%edx
+     46c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46f:	89 cb                	mov    %ecx,%ebx
+     471:	89 df                	mov    %ebx,%edi
+     473:	89 d1                	mov    %edx,%ecx
+     475:	fc                   	cld
+     476:	f3 aa                	rep stos %al,%es:(%edi)
+     478:	89 ca                	mov    %ecx,%edx
+     47a:	89 fb                	mov    %edi,%ebx
+     47c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     47f:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     482:	90                   	nop
+     483:	5b                   	pop    %ebx
+     484:	5f                   	pop    %edi
+     485:	5d                   	pop    %ebp
+     486:	c3                   	ret
+
+00000487 <strcpy>:
+{
+     487:	55                   	push   %ebp
+     488:	89 e5                	mov    %esp,%ebp
+     48a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     48d:	8b 45 08             	mov    0x8(%ebp),%eax
+     490:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     493:	90                   	nop
+     494:	8b 55 0c             	mov    0xc(%ebp),%edx
+     497:	8d 42 01             	lea    0x1(%edx),%eax
+     49a:	89 45 0c             	mov    %eax,0xc(%ebp)
+     49d:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a0:	8d 48 01             	lea    0x1(%eax),%ecx
+     4a3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     4a6:	0f b6 12             	movzbl (%edx),%edx
+     4a9:	88 10                	mov    %dl,(%eax)
+     4ab:	0f b6 00             	movzbl (%eax),%eax
+     4ae:	84 c0                	test   %al,%al
+     4b0:	75 e2                	jne    494 <strcpy+0xd>
+  return os;
+     4b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4b5:	c9                   	leave
+     4b6:	c3                   	ret
+
+000004b7 <strcmp>:
+{
+     4b7:	55                   	push   %ebp
+     4b8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     4ba:	eb 08                	jmp    4c4 <strcmp+0xd>
+    p++, q++;
+     4bc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4c0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c7:	0f b6 00             	movzbl (%eax),%eax
+     4ca:	84 c0                	test   %al,%al
+     4cc:	74 10                	je     4de <strcmp+0x27>
+     4ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d1:	0f b6 10             	movzbl (%eax),%edx
+     4d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4d7:	0f b6 00             	movzbl (%eax),%eax
+     4da:	38 c2                	cmp    %al,%dl
+     4dc:	74 de                	je     4bc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     4de:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e1:	0f b6 00             	movzbl (%eax),%eax
+     4e4:	0f b6 d0             	movzbl %al,%edx
+     4e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4ea:	0f b6 00             	movzbl (%eax),%eax
+     4ed:	0f b6 c0             	movzbl %al,%eax
+     4f0:	29 c2                	sub    %eax,%edx
+     4f2:	89 d0                	mov    %edx,%eax
+}
+     4f4:	5d                   	pop    %ebp
+     4f5:	c3                   	ret
+
+000004f6 <strlen>:
+{
+     4f6:	55                   	push   %ebp
+     4f7:	89 e5                	mov    %esp,%ebp
+     4f9:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     4fc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     503:	eb 04                	jmp    509 <strlen+0x13>
+     505:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     509:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     50c:	8b 45 08             	mov    0x8(%ebp),%eax
+     50f:	01 d0                	add    %edx,%eax
+     511:	0f b6 00             	movzbl (%eax),%eax
+     514:	84 c0                	test   %al,%al
+     516:	75 ed                	jne    505 <strlen+0xf>
+  return n;
+     518:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     51b:	c9                   	leave
+     51c:	c3                   	ret
+
+0000051d <memset>:
+{
+     51d:	55                   	push   %ebp
+     51e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     520:	8b 45 10             	mov    0x10(%ebp),%eax
+     523:	50                   	push   %eax
+     524:	ff 75 0c             	push   0xc(%ebp)
+     527:	ff 75 08             	push   0x8(%ebp)
+     52a:	e8 32 ff ff ff       	call   461 <stosb>
+     52f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     532:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     535:	c9                   	leave
+     536:	c3                   	ret
+
+00000537 <strchr>:
+{
+     537:	55                   	push   %ebp
+     538:	89 e5                	mov    %esp,%ebp
+     53a:	83 ec 04             	sub    $0x4,%esp
+     53d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     540:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     543:	eb 14                	jmp    559 <strchr+0x22>
+    if(*s == c)
+     545:	8b 45 08             	mov    0x8(%ebp),%eax
+     548:	0f b6 00             	movzbl (%eax),%eax
+     54b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     54e:	75 05                	jne    555 <strchr+0x1e>
+      return (char*)s;
+     550:	8b 45 08             	mov    0x8(%ebp),%eax
+     553:	eb 13                	jmp    568 <strchr+0x31>
+  for(; *s; s++)
+     555:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     559:	8b 45 08             	mov    0x8(%ebp),%eax
+     55c:	0f b6 00             	movzbl (%eax),%eax
+     55f:	84 c0                	test   %al,%al
+     561:	75 e2                	jne    545 <strchr+0xe>
+  return 0;
+     563:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     568:	c9                   	leave
+     569:	c3                   	ret
+
+0000056a <gets>:
+{
+     56a:	55                   	push   %ebp
+     56b:	89 e5                	mov    %esp,%ebp
+     56d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     570:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     577:	eb 42                	jmp    5bb <gets+0x51>
+    cc = read(0, &c, 1);
+     579:	83 ec 04             	sub    $0x4,%esp
+     57c:	6a 01                	push   $0x1
+     57e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     581:	50                   	push   %eax
+     582:	6a 00                	push   $0x0
+     584:	e8 84 01 00 00       	call   70d <read>
+     589:	83 c4 10             	add    $0x10,%esp
+     58c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     58f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     593:	7e 33                	jle    5c8 <gets+0x5e>
+    buf[i++] = c;
+     595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     598:	8d 50 01             	lea    0x1(%eax),%edx
+     59b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     59e:	89 c2                	mov    %eax,%edx
+     5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a3:	01 c2                	add    %eax,%edx
+     5a5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     5a9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     5ab:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     5af:	3c 0a                	cmp    $0xa,%al
+     5b1:	74 16                	je     5c9 <gets+0x5f>
+     5b3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     5b7:	3c 0d                	cmp    $0xd,%al
+     5b9:	74 0e                	je     5c9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     5bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5be:	83 c0 01             	add    $0x1,%eax
+     5c1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     5c4:	7f b3                	jg     579 <gets+0xf>
+     5c6:	eb 01                	jmp    5c9 <gets+0x5f>
+      break;
+     5c8:	90                   	nop
+  }
+  buf[i] = '\0';
+     5c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     5cf:	01 d0                	add    %edx,%eax
+     5d1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     5d4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5d7:	c9                   	leave
+     5d8:	c3                   	ret
+
+000005d9 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     5d9:	55                   	push   %ebp
+     5da:	89 e5                	mov    %esp,%ebp
+     5dc:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     5df:	83 ec 08             	sub    $0x8,%esp
+     5e2:	6a 00                	push   $0x0
+     5e4:	ff 75 08             	push   0x8(%ebp)
+     5e7:	e8 44 01 00 00       	call   730 <open>
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     5f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5f6:	79 07                	jns    5ff <stat+0x26>
+    return -1;
+     5f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5fd:	eb 25                	jmp    624 <stat+0x4b>
+  r = fstat(fd, st);
+     5ff:	83 ec 08             	sub    $0x8,%esp
+     602:	ff 75 0c             	push   0xc(%ebp)
+     605:	ff 75 f4             	push   -0xc(%ebp)
+     608:	e8 41 01 00 00       	call   74e <fstat>
+     60d:	83 c4 10             	add    $0x10,%esp
+     610:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     613:	83 ec 0c             	sub    $0xc,%esp
+     616:	ff 75 f4             	push   -0xc(%ebp)
+     619:	e8 fd 00 00 00       	call   71b <close>
+     61e:	83 c4 10             	add    $0x10,%esp
+  return r;
+     621:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     624:	c9                   	leave
+     625:	c3                   	ret
+
+00000626 <atoi>:
+
+int
+atoi(const char *s)
+{
+     626:	55                   	push   %ebp
+     627:	89 e5                	mov    %esp,%ebp
+     629:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     62c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     633:	eb 25                	jmp    65a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     635:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     638:	89 d0                	mov    %edx,%eax
+     63a:	c1 e0 02             	shl    $0x2,%eax
+     63d:	01 d0                	add    %edx,%eax
+     63f:	01 c0                	add    %eax,%eax
+     641:	89 c1                	mov    %eax,%ecx
+     643:	8b 45 08             	mov    0x8(%ebp),%eax
+     646:	8d 50 01             	lea    0x1(%eax),%edx
+     649:	89 55 08             	mov    %edx,0x8(%ebp)
+     64c:	0f b6 00             	movzbl (%eax),%eax
+     64f:	0f be c0             	movsbl %al,%eax
+     652:	01 c8                	add    %ecx,%eax
+     654:	83 e8 30             	sub    $0x30,%eax
+     657:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     65a:	8b 45 08             	mov    0x8(%ebp),%eax
+     65d:	0f b6 00             	movzbl (%eax),%eax
+     660:	3c 2f                	cmp    $0x2f,%al
+     662:	7e 0a                	jle    66e <atoi+0x48>
+     664:	8b 45 08             	mov    0x8(%ebp),%eax
+     667:	0f b6 00             	movzbl (%eax),%eax
+     66a:	3c 39                	cmp    $0x39,%al
+     66c:	7e c7                	jle    635 <atoi+0xf>
+  return n;
+     66e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     671:	c9                   	leave
+     672:	c3                   	ret
+
+00000673 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     673:	55                   	push   %ebp
+     674:	89 e5                	mov    %esp,%ebp
+     676:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     679:	8b 45 08             	mov    0x8(%ebp),%eax
+     67c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     67f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     682:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     685:	eb 17                	jmp    69e <memmove+0x2b>
+    *dst++ = *src++;
+     687:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     68a:	8d 42 01             	lea    0x1(%edx),%eax
+     68d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     690:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     693:	8d 48 01             	lea    0x1(%eax),%ecx
+     696:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     699:	0f b6 12             	movzbl (%edx),%edx
+     69c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     69e:	8b 45 10             	mov    0x10(%ebp),%eax
+     6a1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     6a4:	89 55 10             	mov    %edx,0x10(%ebp)
+     6a7:	85 c0                	test   %eax,%eax
+     6a9:	7f dc                	jg     687 <memmove+0x14>
+  return vdst;
+     6ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6ae:	c9                   	leave
+     6af:	c3                   	ret
+
+000006b0 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     6b0:	83 3d a0 16 00 00 00 	cmpl   $0x0,0x16a0
+  jg 2f
+     6b7:	7f 2e                	jg     6e7 <dosyscall+0x37>
+  jl 1f
+     6b9:	7c 29                	jl     6e4 <dosyscall+0x34>
+  pushl %eax
+     6bb:	50                   	push   %eax
+  pushl %ebx
+     6bc:	53                   	push   %ebx
+  movl $1, %eax
+     6bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     6c2:	0f a2                	cpuid
+  popl %ebx
+     6c4:	5b                   	pop    %ebx
+  popl %eax
+     6c5:	58                   	pop    %eax
+  movl $-1, sysmode
+     6c6:	c7 05 a0 16 00 00 ff 	movl   $0xffffffff,0x16a0
+     6cd:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     6d0:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     6d6:	74 0c                	je     6e4 <dosyscall+0x34>
+  movl $1, sysmode
+     6d8:	c7 05 a0 16 00 00 01 	movl   $0x1,0x16a0
+     6df:	00 00 00 
+  jmp 2f
+     6e2:	eb 03                	jmp    6e7 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     6e4:	cd 40                	int    $0x40
+  ret
+     6e6:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     6e7:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     6e9:	ba f0 06 00 00       	mov    $0x6f0,%edx
+  sysenter
+     6ee:	0f 34                	sysenter
+3:
+  ret
+     6f0:	c3                   	ret
+
+000006f1 <fork>:
+
+SYSCALL(fork)
+     6f1:	b8 01 00 00 00       	mov    $0x1,%eax
+     6f6:	eb b8                	jmp    6b0 <dosyscall>
+
+000006f8 <exit>:
+SYSCALL(exit)
+     6f8:	b8 02 00 00 00       	mov    $0x2,%eax
+     6fd:	eb b1                	jmp    6b0 <dosyscall>
+
+000006ff <wait>:
+SYSCALL(wait)
+     6ff:	b8 03 00 00 00       	mov    $0x3,%eax
+     704:	eb aa                	jmp    6b0 <dosyscall>
+
+00000706 <pipe>:
+SYSCALL(pipe)
+     706:	b8 04 00 00 00       	mov    $0x4,%eax
+     70b:	eb a3                	jmp    6b0 <dosyscall>
+
+0000070d <read>:
+SYSCALL(read)
+     70d:	b8 05 00 00 00       	mov    $0x5,%eax
+     712:	eb 9c                	jmp    6b0 <dosyscall>
+
+00000714 <write>:
+SYSCALL(write)
+     714:	b8 10 00 00 00       	mov    $0x10,%eax
+     719:	eb 95                	jmp    6b0 <dosyscall>
+
+0000071b <close>:
+SYSCALL(close)
+     71b:	b8 15 00 00 00       	mov    $0x15,%eax
+     720:	eb 8e                	jmp    6b0 <dosyscall>
+
+00000722 <kill>:
+SYSCALL(kill)
+     722:	b8 06 00 00 00       	mov    $0x6,%eax
+     727:	eb 87                	jmp    6b0 <dosyscall>
+
+00000729 <exec>:
+SYSCALL(exec)
+     729:	b8 07 00 00 00       	mov    $0x7,%eax
+     72e:	eb 80                	jmp    6b0 <dosyscall>
+
+00000730 <open>:
+SYSCALL(open)
+     730:	b8 0f 00 00 00       	mov    $0xf,%eax
+     735:	e9 76 ff ff ff       	jmp    6b0 <dosyscall>
+
+0000073a <mknod>:
+SYSCALL(mknod)
+     73a:	b8 11 00 00 00       	mov    $0x11,%eax
+     73f:	e9 6c ff ff ff       	jmp    6b0 <dosyscall>
+
+00000744 <unlink>:
+SYSCALL(unlink)
+     744:	b8 12 00 00 00       	mov    $0x12,%eax
+     749:	e9 62 ff ff ff       	jmp    6b0 <dosyscall>
+
+0000074e <fstat>:
+SYSCALL(fstat)
+     74e:	b8 08 00 00 00       	mov    $0x8,%eax
+     753:	e9 58 ff ff ff       	jmp    6b0 <dosyscall>
+
+00000758 <link>:
+SYSCALL(link)
+     758:	b8 13 00 00 00       	mov    $0x13,%eax
+     75d:	e9 4e ff ff ff       	jmp    6b0 <dosyscall>
+
+00000762 <mkdir>:
+SYSCALL(mkdir)
+     762:	b8 14 00 00 00       	mov    $0x14,%eax
+     767:	e9 44 ff ff ff       	jmp    6b0 <dosyscall>
+
+0000076c <chdir>:
+SYSCALL(chdir)
+     76c:	b8 09 00 00 00       	mov    $0x9,%eax
+     771:	e9 3a ff ff ff       	jmp    6b0 <dosyscall>
+
+00000776 <dup>:
+SYSCALL(dup)
+     776:	b8 0a 00 00 00       	mov    $0xa,%eax
+     77b:	e9 30 ff ff ff       	jmp    6b0 <dosyscall>
+
+00000780 <getpid>:
+SYSCALL(getpid)
+     780:	b8 0b 00 00 00       	mov    $0xb,%eax
+     785:	e9 26 ff ff ff       	jmp    6b0 <dosyscall>
+
+0000078a <sbrk>:
+SYSCALL(sbrk)
+     78a:	b8 0c 00 00 00       	mov    $0xc,%eax
+     78f:	e9 1c ff ff ff       	jmp    6b0 <dosyscall>
+
+00000794 <sleep>:
+SYSCALL(sleep)
+     794:	b8 0d 00 00 00       	mov    $0xd,%eax
+     799:	e9 12 ff ff ff       	jmp    6b0 <dosyscall>
+
+0000079e <uptime>:
+SYSCALL(uptime)
+     79e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7a3:	e9 08 ff ff ff       	jmp    6b0 <dosyscall>
+
+000007a8 <symlink>:
+SYSCALL(symlink)
+     7a8:	b8 16 00 00 00       	mov    $0x16,%eax
+     7ad:	e9 fe fe ff ff       	jmp    6b0 <dosyscall>
+
+000007b2 <readlink>:
+SYSCALL(readlink)
+     7b2:	b8 17 00 00 00       	mov    $0x17,%eax
+     7b7:	e9 f4 fe ff ff       	jmp    6b0 <dosyscall>
+
+000007bc <fprot>:
+SYSCALL(fprot)
+     7bc:	b8 18 00 00 00       	mov    $0x18,%eax
+     7c1:	e9 ea fe ff ff       	jmp    6b0 <dosyscall>
+
+000007c6 <funprot>:
+SYSCALL(funprot)
+     7c6:	b8 19 00 00 00       	mov    $0x19,%eax
+     7cb:	e9 e0 fe ff ff       	jmp    6b0 <dosyscall>
+
+000007d0 <funlock>:
+SYSCALL(funlock)
+     7d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7d5:	e9 d6 fe ff ff       	jmp    6b0 <dosyscall>
+
+000007da <mmap>:
+SYSCALL(mmap)
+     7da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7df:	e9 cc fe ff ff       	jmp    6b0 <dosyscall>
+
+000007e4 <munmap>:
+SYSCALL(munmap)
+     7e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7e9:	e9 c2 fe ff ff       	jmp    6b0 <dosyscall>
+
+000007ee <sendfile>:
+SYSCALL(sendfile)
+     7ee:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7f3:	e9 b8 fe ff ff       	jmp    6b0 <dosyscall>
+
+000007f8 <readv>:
+SYSCALL(readv)
+     7f8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7fd:	e9 ae fe ff ff       	jmp    6b0 <dosyscall>
+
+00000802 <writev>:
+SYSCALL(writev)
+     802:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     807:	e9 a4 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000080c <pread>:
+SYSCALL(pread)
+     80c:	b8 20 00 00 00       	mov    $0x20,%eax
+     811:	e9 9a fe ff ff       	jmp    6b0 <dosyscall>
+
+00000816 <pwrite>:
+SYSCALL(pwrite)
+     816:	b8 21 00 00 00       	mov    $0x21,%eax
+     81b:	e9 90 fe ff ff       	jmp    6b0 <dosyscall>
+
+00000820 <lseek>:
+SYSCALL(lseek)
+     820:	b8 22 00 00 00       	mov    $0x22,%eax
+     825:	e9 86 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000082a <spawn>:
+SYSCALL(spawn)
+     82a:	b8 23 00 00 00       	mov    $0x23,%eax
+     82f:	e9 7c fe ff ff       	jmp    6b0 <dosyscall>
+
+00000834 <setpriority>:
+SYSCALL(setpriority)
+     834:	b8 24 00 00 00       	mov    $0x24,%eax
+     839:	e9 72 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000083e <kthread_create>:
+SYSCALL(kthread_create)
+     83e:	b8 25 00 00 00       	mov    $0x25,%eax
+     843:	e9 68 fe ff ff       	jmp    6b0 <dosyscall>
+
+00000848 <kthread_id>:
+SYSCALL(kthread_id)
+     848:	b8 26 00 00 00       	mov    $0x26,%eax
+     84d:	e9 5e fe ff ff       	jmp    6b0 <dosyscall>
+
+00000852 <kthread_exit>:
+SYSCALL(kthread_exit)
+     852:	b8 27 00 00 00       	mov    $0x27,%eax
+     857:	e9 54 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000085c <kthread_join>:
+SYSCALL(kthread_join)
+     85c:	b8 28 00 00 00       	mov    $0x28,%eax
+     861:	e9 4a fe ff ff       	jmp    6b0 <dosyscall>
+
+00000866 <futex>:
+SYSCALL(futex)
+     866:	b8 29 00 00 00       	mov    $0x29,%eax
+     86b:	e9 40 fe ff ff       	jmp    6b0 <dosyscall>
+
+00000870 <signal>:
+SYSCALL(signal)
+     870:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     875:	e9 36 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000087a <alarm>:
+SYSCALL(alarm)
+     87a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     87f:	e9 2c fe ff ff       	jmp    6b0 <dosyscall>
+
+00000884 <usleep>:
+SYSCALL(usleep)
+     884:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     889:	e9 22 fe ff ff       	jmp    6b0 <dosyscall>
+
+0000088e <ioring_setup>:
+SYSCALL(ioring_setup)
+     88e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     893:	e9 18 fe ff ff       	jmp    6b0 <dosyscall>
+
+00000898 <ioring_enter>:
+SYSCALL(ioring_enter)
+     898:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     89d:	e9 0e fe ff ff       	jmp    6b0 <dosyscall>
+
+000008a2 <getrusage>:
+SYSCALL(getrusage)
+     8a2:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     8a7:	e9 04 fe ff ff       	jmp    6b0 <dosyscall>
+
+000008ac <mount>:
+SYSCALL(mount)
+     8ac:	b8 30 00 00 00       	mov    $0x30,%eax
+     8b1:	e9 fa fd ff ff       	jmp    6b0 <dosyscall>
+
+000008b6 <getdents>:
+SYSCALL(getdents)
+     8b6:	b8 31 00 00 00       	mov    $0x31,%eax
+     8bb:	e9 f0 fd ff ff       	jmp    6b0 <dosyscall>
+
+000008c0 <yield>:
+SYSCALL(yield)
+     8c0:	b8 32 00 00 00       	mov    $0x32,%eax
+     8c5:	e9 e6 fd ff ff       	jmp    6b0 <dosyscall>
+
+000008ca <ncpu>:
+SYSCALL(ncpu)
+     8ca:	b8 33 00 00 00       	mov    $0x33,%eax
+     8cf:	e9 dc fd ff ff       	jmp    6b0 <dosyscall>
+
+000008d4 <fallocate>:
+SYSCALL(fallocate)
+     8d4:	b8 34 00 00 00       	mov    $0x34,%eax
+     8d9:	e9 d2 fd ff ff       	jmp    6b0 <dosyscall>
+
+000008de <ftruncate>:
+SYSCALL(ftruncate)
+     8de:	b8 35 00 00 00       	mov    $0x35,%eax
+     8e3:	e9 c8 fd ff ff       	jmp    6b0 <dosyscall>
+
+000008e8 <fsync>:
+SYSCALL(fsync)
+     8e8:	b8 36 00 00 00       	mov    $0x36,%eax
+     8ed:	e9 be fd ff ff       	jmp    6b0 <dosyscall>
+
+000008f2 <fdatasync>:
+SYSCALL(fdatasync)
+     8f2:	b8 37 00 00 00       	mov    $0x37,%eax
+     8f7:	e9 b4 fd ff ff       	jmp    6b0 <dosyscall>
+
+000008fc <poll>:
+SYSCALL(poll)
+     8fc:	b8 38 00 00 00       	mov    $0x38,%eax
+     901:	e9 aa fd ff ff       	jmp    6b0 <dosyscall>
+
+00000906 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     906:	55                   	push   %ebp
+     907:	89 e5                	mov    %esp,%ebp
+     909:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     90c:	8b 45 08             	mov    0x8(%ebp),%eax
+     90f:	8b 40 04             	mov    0x4(%eax),%eax
+     912:	85 c0                	test   %eax,%eax
+     914:	7e 1f                	jle    935 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     916:	8b 45 08             	mov    0x8(%ebp),%eax
+     919:	8b 50 04             	mov    0x4(%eax),%edx
+     91c:	8b 45 08             	mov    0x8(%ebp),%eax
+     91f:	8d 48 08             	lea    0x8(%eax),%ecx
+     922:	8b 45 08             	mov    0x8(%ebp),%eax
+     925:	8b 00                	mov    (%eax),%eax
+     927:	83 ec 04             	sub    $0x4,%esp
+     92a:	52                   	push   %edx
+     92b:	51                   	push   %ecx
+     92c:	50                   	push   %eax
+     92d:	e8 d0 fe ff ff       	call   802 <writev>
+     932:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     935:	8b 45 08             	mov    0x8(%ebp),%eax
+     938:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     93f:	8b 45 08             	mov    0x8(%ebp),%eax
+     942:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     949:	00 00 00 
+}
+     94c:	90                   	nop
+     94d:	c9                   	leave
+     94e:	c3                   	ret
+
+0000094f <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     94f:	55                   	push   %ebp
+     950:	89 e5                	mov    %esp,%ebp
+     952:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     955:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     959:	0f 84 94 00 00 00    	je     9f3 <put+0xa4>
+    return;
+  if(o->n > 0){
+     95f:	8b 45 08             	mov    0x8(%ebp),%eax
+     962:	8b 40 04             	mov    0x4(%eax),%eax
+     965:	85 c0                	test   %eax,%eax
+     967:	7e 40                	jle    9a9 <put+0x5a>
+    v = &o->iov[o->n-1];
+     969:	8b 45 08             	mov    0x8(%ebp),%eax
+     96c:	8b 40 04             	mov    0x4(%eax),%eax
+     96f:	83 e8 01             	sub    $0x1,%eax
+     972:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     979:	8b 45 08             	mov    0x8(%ebp),%eax
+     97c:	01 d0                	add    %edx,%eax
+     97e:	83 c0 08             	add    $0x8,%eax
+     981:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     984:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     987:	8b 10                	mov    (%eax),%edx
+     989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     98c:	8b 40 04             	mov    0x4(%eax),%eax
+     98f:	01 d0                	add    %edx,%eax
+     991:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     994:	75 13                	jne    9a9 <put+0x5a>
+      v->iov_len += n;
+     996:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     999:	8b 50 04             	mov    0x4(%eax),%edx
+     99c:	8b 45 10             	mov    0x10(%ebp),%eax
+     99f:	01 c2                	add    %eax,%edx
+     9a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9a4:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     9a7:	eb 4b                	jmp    9f4 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ac:	8b 40 04             	mov    0x4(%eax),%eax
+     9af:	83 f8 10             	cmp    $0x10,%eax
+     9b2:	75 0e                	jne    9c2 <put+0x73>
+    flush(o);
+     9b4:	83 ec 0c             	sub    $0xc,%esp
+     9b7:	ff 75 08             	push   0x8(%ebp)
+     9ba:	e8 47 ff ff ff       	call   906 <flush>
+     9bf:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     9c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c5:	8b 50 04             	mov    0x4(%eax),%edx
+     9c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     9ce:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     9d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d5:	8b 50 04             	mov    0x4(%eax),%edx
+     9d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9de:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     9e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e5:	8b 40 04             	mov    0x4(%eax),%eax
+     9e8:	8d 50 01             	lea    0x1(%eax),%edx
+     9eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ee:	89 50 04             	mov    %edx,0x4(%eax)
+     9f1:	eb 01                	jmp    9f4 <put+0xa5>
+    return;
+     9f3:	90                   	nop
+}
+     9f4:	c9                   	leave
+     9f5:	c3                   	ret
+
+000009f6 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     9f6:	55                   	push   %ebp
+     9f7:	89 e5                	mov    %esp,%ebp
+     9f9:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     9fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ff:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     a05:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a08:	01 d0                	add    %edx,%eax
+     a0a:	3d 80 00 00 00       	cmp    $0x80,%eax
+     a0f:	77 0b                	ja     a1c <room+0x26>
+     a11:	8b 45 08             	mov    0x8(%ebp),%eax
+     a14:	8b 40 04             	mov    0x4(%eax),%eax
+     a17:	83 f8 10             	cmp    $0x10,%eax
+     a1a:	75 0e                	jne    a2a <room+0x34>
+    flush(o);
+     a1c:	83 ec 0c             	sub    $0xc,%esp
+     a1f:	ff 75 08             	push   0x8(%ebp)
+     a22:	e8 df fe ff ff       	call   906 <flush>
+     a27:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     a2d:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     a33:	8b 45 08             	mov    0x8(%ebp),%eax
+     a36:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     a3c:	01 d0                	add    %edx,%eax
+}
+     a3e:	c9                   	leave
+     a3f:	c3                   	ret
+
+00000a40 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	83 ec 28             	sub    $0x28,%esp
+     a46:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a49:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     a4c:	83 ec 08             	sub    $0x8,%esp
+     a4f:	6a 01                	push   $0x1
+     a51:	ff 75 08             	push   0x8(%ebp)
+     a54:	e8 9d ff ff ff       	call   9f6 <room>
+     a59:	83 c4 10             	add    $0x10,%esp
+     a5c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a62:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     a66:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     a68:	8b 45 08             	mov    0x8(%ebp),%eax
+     a6b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     a71:	8d 50 01             	lea    0x1(%eax),%edx
+     a74:	8b 45 08             	mov    0x8(%ebp),%eax
+     a77:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     a7d:	83 ec 04             	sub    $0x4,%esp
+     a80:	6a 01                	push   $0x1
+     a82:	ff 75 f4             	push   -0xc(%ebp)
+     a85:	ff 75 08             	push   0x8(%ebp)
+     a88:	e8 c2 fe ff ff       	call   94f <put>
+     a8d:	83 c4 10             	add    $0x10,%esp
+}
+     a90:	90                   	nop
+     a91:	c9                   	leave
+     a92:	c3                   	ret
+
+00000a93 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     a93:	55                   	push   %ebp
+     a94:	89 e5                	mov    %esp,%ebp
+     a96:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     a99:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     aa0:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     aa4:	74 17                	je     abd <printint+0x2a>
+     aa6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     aaa:	79 11                	jns    abd <printint+0x2a>
+    neg = 1;
+     aac:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     ab3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ab6:	f7 d8                	neg    %eax
+     ab8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     abb:	eb 06                	jmp    ac3 <printint+0x30>
+  } else {
+    x = xx;
+     abd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ac0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     ac3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     aca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     acd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+     ad5:	f7 f1                	div    %ecx
+     ad7:	89 d1                	mov    %edx,%ecx
+     ad9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     adc:	8d 50 01             	lea    0x1(%eax),%edx
+     adf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ae2:	0f b6 91 a4 16 00 00 	movzbl 0x16a4(%ecx),%edx
+     ae9:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     aed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     af0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     af3:	ba 00 00 00 00       	mov    $0x0,%edx
+     af8:	f7 f1                	div    %ecx
+     afa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     afd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b01:	75 c7                	jne    aca <printint+0x37>
+  if(neg)
+     b03:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b07:	74 0e                	je     b17 <printint+0x84>
+    buf[i++] = '-';
+     b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b0c:	8d 50 01             	lea    0x1(%eax),%edx
+     b0f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b12:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b1a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     b1d:	83 ec 08             	sub    $0x8,%esp
+     b20:	ff 75 e8             	push   -0x18(%ebp)
+     b23:	ff 75 08             	push   0x8(%ebp)
+     b26:	e8 cb fe ff ff       	call   9f6 <room>
+     b2b:	83 c4 10             	add    $0x10,%esp
+     b2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     b31:	eb 1d                	jmp    b50 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     b33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b36:	83 e8 01             	sub    $0x1,%eax
+     b39:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     b3c:	89 c2                	mov    %eax,%edx
+     b3e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b41:	01 c2                	add    %eax,%edx
+     b43:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b49:	01 c8                	add    %ecx,%eax
+     b4b:	0f b6 00             	movzbl (%eax),%eax
+     b4e:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     b50:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     b54:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b58:	79 d9                	jns    b33 <printint+0xa0>
+  o->used += n;
+     b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b5d:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     b63:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b66:	01 c2                	add    %eax,%edx
+     b68:	8b 45 08             	mov    0x8(%ebp),%eax
+     b6b:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     b71:	83 ec 04             	sub    $0x4,%esp
+     b74:	ff 75 e8             	push   -0x18(%ebp)
+     b77:	ff 75 e4             	push   -0x1c(%ebp)
+     b7a:	ff 75 08             	push   0x8(%ebp)
+     b7d:	e8 cd fd ff ff       	call   94f <put>
+     b82:	83 c4 10             	add    $0x10,%esp
+}
+     b85:	90                   	nop
+     b86:	c9                   	leave
+     b87:	c3                   	ret
+
+00000b88 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b88:	55                   	push   %ebp
+     b89:	89 e5                	mov    %esp,%ebp
+     b8b:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     b91:	8b 45 08             	mov    0x8(%ebp),%eax
+     b94:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     b9a:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     ba1:	00 00 00 
+  o.used = 0;
+     ba4:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     bab:	00 00 00 
+  state = 0;
+     bae:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     bb5:	8d 45 0c             	lea    0xc(%ebp),%eax
+     bb8:	83 c0 04             	add    $0x4,%eax
+     bbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     bbe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bc5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     bcc:	e9 82 01 00 00       	jmp    d53 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     bd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bd4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bd7:	01 d0                	add    %edx,%eax
+     bd9:	0f b6 00             	movzbl (%eax),%eax
+     bdc:	0f be c0             	movsbl %al,%eax
+     bdf:	25 ff 00 00 00       	and    $0xff,%eax
+     be4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     be7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     beb:	75 38                	jne    c25 <printf+0x9d>
+      if(c == '%'){
+     bed:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     bf1:	0f 85 58 01 00 00    	jne    d4f <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     bf7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bfa:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c00:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     c03:	01 ca                	add    %ecx,%edx
+     c05:	83 ec 04             	sub    $0x4,%esp
+     c08:	50                   	push   %eax
+     c09:	52                   	push   %edx
+     c0a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c10:	50                   	push   %eax
+     c11:	e8 39 fd ff ff       	call   94f <put>
+     c16:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     c19:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     c20:	e9 2a 01 00 00       	jmp    d4f <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     c25:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     c29:	0f 85 20 01 00 00    	jne    d4f <printf+0x1c7>
+      if(c == 'd'){
+     c2f:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     c33:	75 22                	jne    c57 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     c35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c38:	8b 00                	mov    (%eax),%eax
+     c3a:	6a 01                	push   $0x1
+     c3c:	6a 0a                	push   $0xa
+     c3e:	50                   	push   %eax
+     c3f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c45:	50                   	push   %eax
+     c46:	e8 48 fe ff ff       	call   a93 <printint>
+     c4b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c4e:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c52:	e9 e8 00 00 00       	jmp    d3f <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     c57:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     c5b:	74 06                	je     c63 <printf+0xdb>
+     c5d:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     c61:	75 22                	jne    c85 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     c63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c66:	8b 00                	mov    (%eax),%eax
+     c68:	6a 00                	push   $0x0
+     c6a:	6a 10                	push   $0x10
+     c6c:	50                   	push   %eax
+     c6d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c73:	50                   	push   %eax
+     c74:	e8 1a fe ff ff       	call   a93 <printint>
+     c79:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c7c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c80:	e9 ba 00 00 00       	jmp    d3f <printf+0x1b7>
+      } else if(c == 's'){
+     c85:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     c89:	75 3f                	jne    cca <printf+0x142>
+        s = (char*)*ap;
+     c8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c8e:	8b 00                	mov    (%eax),%eax
+     c90:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c93:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     c97:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c9b:	75 07                	jne    ca4 <printf+0x11c>
+          s = "(null)";
+     c9d:	c7 45 f4 15 13 00 00 	movl   $0x1315,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     ca4:	83 ec 0c             	sub    $0xc,%esp
+     ca7:	ff 75 f4             	push   -0xc(%ebp)
+     caa:	e8 47 f8 ff ff       	call   4f6 <strlen>
+     caf:	83 c4 10             	add    $0x10,%esp
+     cb2:	83 ec 04             	sub    $0x4,%esp
+     cb5:	50                   	push   %eax
+     cb6:	ff 75 f4             	push   -0xc(%ebp)
+     cb9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cbf:	50                   	push   %eax
+     cc0:	e8 8a fc ff ff       	call   94f <put>
+     cc5:	83 c4 10             	add    $0x10,%esp
+     cc8:	eb 75                	jmp    d3f <printf+0x1b7>
+      } else if(c == 'c'){
+     cca:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     cce:	75 21                	jne    cf1 <printf+0x169>
+        putc(&o, *ap);
+     cd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     cd3:	8b 00                	mov    (%eax),%eax
+     cd5:	0f be c0             	movsbl %al,%eax
+     cd8:	83 ec 08             	sub    $0x8,%esp
+     cdb:	50                   	push   %eax
+     cdc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ce2:	50                   	push   %eax
+     ce3:	e8 58 fd ff ff       	call   a40 <putc>
+     ce8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ceb:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     cef:	eb 4e                	jmp    d3f <printf+0x1b7>
+      } else if(c == '%'){
+     cf1:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     cf5:	75 1b                	jne    d12 <printf+0x18a>
+        putc(&o, c);
+     cf7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     cfa:	0f be c0             	movsbl %al,%eax
+     cfd:	83 ec 08             	sub    $0x8,%esp
+     d00:	50                   	push   %eax
+     d01:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d07:	50                   	push   %eax
+     d08:	e8 33 fd ff ff       	call   a40 <putc>
+     d0d:	83 c4 10             	add    $0x10,%esp
+     d10:	eb 2d                	jmp    d3f <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     d12:	83 ec 08             	sub    $0x8,%esp
+     d15:	6a 25                	push   $0x25
+     d17:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d1d:	50                   	push   %eax
+     d1e:	e8 1d fd ff ff       	call   a40 <putc>
+     d23:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     d26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d29:	0f be c0             	movsbl %al,%eax
+     d2c:	83 ec 08             	sub    $0x8,%esp
+     d2f:	50                   	push   %eax
+     d30:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d36:	50                   	push   %eax
+     d37:	e8 04 fd ff ff       	call   a40 <putc>
+     d3c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     d3f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     d46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d49:	83 c0 01             	add    $0x1,%eax
+     d4c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d4f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d53:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d59:	01 d0                	add    %edx,%eax
+     d5b:	0f b6 00             	movzbl (%eax),%eax
+     d5e:	84 c0                	test   %al,%al
+     d60:	0f 85 6b fe ff ff    	jne    bd1 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     d66:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     d6a:	75 22                	jne    d8e <printf+0x206>
+    put(&o, fmt + start, i - start);
+     d6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d6f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     d75:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     d78:	01 ca                	add    %ecx,%edx
+     d7a:	83 ec 04             	sub    $0x4,%esp
+     d7d:	50                   	push   %eax
+     d7e:	52                   	push   %edx
+     d7f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d85:	50                   	push   %eax
+     d86:	e8 c4 fb ff ff       	call   94f <put>
+     d8b:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     d8e:	83 ec 0c             	sub    $0xc,%esp
+     d91:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d97:	50                   	push   %eax
+     d98:	e8 69 fb ff ff       	call   906 <flush>
+     d9d:	83 c4 10             	add    $0x10,%esp
+}
+     da0:	90                   	nop
+     da1:	c9                   	leave
+     da2:	c3                   	ret
+
+00000da3 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     da3:	55                   	push   %ebp
+     da4:	89 e5                	mov    %esp,%ebp
+     da6:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     da9:	8b 55 08             	mov    0x8(%ebp),%edx
+     dac:	8b 45 0c             	mov    0xc(%ebp),%eax
+     daf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     db2:	f0 87 02             	lock xchg %eax,(%edx)
+     db5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     db8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     dbb:	c9                   	leave
+     dbc:	c3                   	ret
+
+00000dbd <lock>:
+{
+     dbd:	55                   	push   %ebp
+     dbe:	89 e5                	mov    %esp,%ebp
+     dc0:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     dc3:	a1 b8 16 00 00       	mov    0x16b8,%eax
+     dc8:	85 c0                	test   %eax,%eax
+     dca:	74 09                	je     dd5 <lock+0x18>
+     dcc:	a1 b8 16 00 00       	mov    0x16b8,%eax
+     dd1:	ff d0                	call   *%eax
+     dd3:	eb 05                	jmp    dda <lock+0x1d>
+     dd5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     dda:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     ddd:	90                   	nop
+     dde:	83 ec 08             	sub    $0x8,%esp
+     de1:	6a 01                	push   $0x1
+     de3:	68 f0 16 00 00       	push   $0x16f0
+     de8:	e8 b6 ff ff ff       	call   da3 <xchg>
+     ded:	83 c4 10             	add    $0x10,%esp
+     df0:	85 c0                	test   %eax,%eax
+     df2:	75 ea                	jne    dde <lock+0x21>
+  return pin;
+     df4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     df7:	c9                   	leave
+     df8:	c3                   	ret
+
+00000df9 <unlock>:
+{
+     df9:	55                   	push   %ebp
+     dfa:	89 e5                	mov    %esp,%ebp
+     dfc:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     dff:	6a 00                	push   $0x0
+     e01:	68 f0 16 00 00       	push   $0x16f0
+     e06:	e8 98 ff ff ff       	call   da3 <xchg>
+     e0b:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     e0e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     e12:	78 10                	js     e24 <unlock+0x2b>
+    mallocunpin(pin);
+     e14:	a1 bc 16 00 00       	mov    0x16bc,%eax
+     e19:	83 ec 0c             	sub    $0xc,%esp
+     e1c:	ff 75 08             	push   0x8(%ebp)
+     e1f:	ff d0                	call   *%eax
+     e21:	83 c4 10             	add    $0x10,%esp
+}
+     e24:	90                   	nop
+     e25:	c9                   	leave
+     e26:	c3                   	ret
+
+00000e27 <sizeclass>:
+{
+     e27:	55                   	push   %ebp
+     e28:	89 e5                	mov    %esp,%ebp
+     e2a:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     e2d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     e34:	eb 1c                	jmp    e52 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     e36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e39:	ba 02 00 00 00       	mov    $0x2,%edx
+     e3e:	89 c1                	mov    %eax,%ecx
+     e40:	d3 e2                	shl    %cl,%edx
+     e42:	89 d0                	mov    %edx,%eax
+     e44:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e47:	72 05                	jb     e4e <sizeclass+0x27>
+      return c;
+     e49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e4c:	eb 0f                	jmp    e5d <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     e4e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     e52:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     e56:	7e de                	jle    e36 <sizeclass+0xf>
+  return -1;
+     e58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     e5d:	c9                   	leave
+     e5e:	c3                   	ret
+
+00000e5f <bigfree>:
+{
+     e5f:	55                   	push   %ebp
+     e60:	89 e5                	mov    %esp,%ebp
+     e62:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e65:	a1 c8 16 00 00       	mov    0x16c8,%eax
+     e6a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e6d:	eb 24                	jmp    e93 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e72:	8b 00                	mov    (%eax),%eax
+     e74:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e77:	72 12                	jb     e8b <bigfree+0x2c>
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+     e7c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e7f:	72 24                	jb     ea5 <bigfree+0x46>
+     e81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e84:	8b 00                	mov    (%eax),%eax
+     e86:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e89:	72 1a                	jb     ea5 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e8e:	8b 00                	mov    (%eax),%eax
+     e90:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e93:	8b 45 08             	mov    0x8(%ebp),%eax
+     e96:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e99:	73 d4                	jae    e6f <bigfree+0x10>
+     e9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e9e:	8b 00                	mov    (%eax),%eax
+     ea0:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ea3:	73 ca                	jae    e6f <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea8:	8b 40 04             	mov    0x4(%eax),%eax
+     eab:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+     eb5:	01 c2                	add    %eax,%edx
+     eb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eba:	8b 00                	mov    (%eax),%eax
+     ebc:	39 c2                	cmp    %eax,%edx
+     ebe:	75 24                	jne    ee4 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec3:	8b 50 04             	mov    0x4(%eax),%edx
+     ec6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ec9:	8b 00                	mov    (%eax),%eax
+     ecb:	8b 40 04             	mov    0x4(%eax),%eax
+     ece:	01 c2                	add    %eax,%edx
+     ed0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed3:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ed6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ed9:	8b 00                	mov    (%eax),%eax
+     edb:	8b 10                	mov    (%eax),%edx
+     edd:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee0:	89 10                	mov    %edx,(%eax)
+     ee2:	eb 0a                	jmp    eee <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     ee4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee7:	8b 10                	mov    (%eax),%edx
+     ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+     eec:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     eee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef1:	8b 40 04             	mov    0x4(%eax),%eax
+     ef4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     efb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     efe:	01 d0                	add    %edx,%eax
+     f00:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f03:	75 20                	jne    f25 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     f05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f08:	8b 50 04             	mov    0x4(%eax),%edx
+     f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0e:	8b 40 04             	mov    0x4(%eax),%eax
+     f11:	01 c2                	add    %eax,%edx
+     f13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f16:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     f19:	8b 45 08             	mov    0x8(%ebp),%eax
+     f1c:	8b 10                	mov    (%eax),%edx
+     f1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f21:	89 10                	mov    %edx,(%eax)
+     f23:	eb 08                	jmp    f2d <bigfree+0xce>
+    p->s.ptr = bp;
+     f25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f28:	8b 55 08             	mov    0x8(%ebp),%edx
+     f2b:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     f2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f30:	a3 c8 16 00 00       	mov    %eax,0x16c8
+}
+     f35:	90                   	nop
+     f36:	c9                   	leave
+     f37:	c3                   	ret
+
+00000f38 <free>:
+{
+     f38:	55                   	push   %ebp
+     f39:	89 e5                	mov    %esp,%ebp
+     f3b:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     f3e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f42:	74 68                	je     fac <free+0x74>
+  bp = (Header*)ap - 1;
+     f44:	8b 45 08             	mov    0x8(%ebp),%eax
+     f47:	83 e8 08             	sub    $0x8,%eax
+     f4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     f4d:	e8 6b fe ff ff       	call   dbd <lock>
+     f52:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     f55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f58:	8b 40 04             	mov    0x4(%eax),%eax
+     f5b:	83 ec 0c             	sub    $0xc,%esp
+     f5e:	50                   	push   %eax
+     f5f:	e8 c3 fe ff ff       	call   e27 <sizeclass>
+     f64:	83 c4 10             	add    $0x10,%esp
+     f67:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f6e:	78 1e                	js     f8e <free+0x56>
+    bp->s.ptr = classfree[c];
+     f70:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f73:	8b 14 85 cc 16 00 00 	mov    0x16cc(,%eax,4),%edx
+     f7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7d:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     f7f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f82:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f85:	89 14 85 cc 16 00 00 	mov    %edx,0x16cc(,%eax,4)
+     f8c:	eb 0e                	jmp    f9c <free+0x64>
+    bigfree(bp);
+     f8e:	83 ec 0c             	sub    $0xc,%esp
+     f91:	ff 75 f4             	push   -0xc(%ebp)
+     f94:	e8 c6 fe ff ff       	call   e5f <bigfree>
+     f99:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     f9c:	83 ec 0c             	sub    $0xc,%esp
+     f9f:	ff 75 f0             	push   -0x10(%ebp)
+     fa2:	e8 52 fe ff ff       	call   df9 <unlock>
+     fa7:	83 c4 10             	add    $0x10,%esp
+     faa:	eb 01                	jmp    fad <free+0x75>
+    return;
+     fac:	90                   	nop
+}
+     fad:	c9                   	leave
+     fae:	c3                   	ret
+
+00000faf <morecore>:
+{
+     faf:	55                   	push   %ebp
+     fb0:	89 e5                	mov    %esp,%ebp
+     fb2:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     fb5:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     fbc:	77 07                	ja     fc5 <morecore+0x16>
+    nu = 4096;
+     fbe:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     fc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc8:	c1 e0 03             	shl    $0x3,%eax
+     fcb:	83 ec 0c             	sub    $0xc,%esp
+     fce:	50                   	push   %eax
+     fcf:	e8 b6 f7 ff ff       	call   78a <sbrk>
+     fd4:	83 c4 10             	add    $0x10,%esp
+     fd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     fda:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     fde:	75 07                	jne    fe7 <morecore+0x38>
+    return 0;
+     fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe5:	eb 22                	jmp    1009 <morecore+0x5a>
+  hp = (Header*)p;
+     fe7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     fed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+     ff3:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     ff6:	83 ec 0c             	sub    $0xc,%esp
+     ff9:	ff 75 f0             	push   -0x10(%ebp)
+     ffc:	e8 5e fe ff ff       	call   e5f <bigfree>
+    1001:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1004:	a1 c8 16 00 00       	mov    0x16c8,%eax
+}
+    1009:	c9                   	leave
+    100a:	c3                   	ret
+
+0000100b <bigalloc>:
+{
+    100b:	55                   	push   %ebp
+    100c:	89 e5                	mov    %esp,%ebp
+    100e:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    1011:	a1 c8 16 00 00       	mov    0x16c8,%eax
+    1016:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1019:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    101d:	75 23                	jne    1042 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    101f:	c7 45 f0 c0 16 00 00 	movl   $0x16c0,-0x10(%ebp)
+    1026:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1029:	a3 c8 16 00 00       	mov    %eax,0x16c8
+    102e:	a1 c8 16 00 00       	mov    0x16c8,%eax
+    1033:	a3 c0 16 00 00       	mov    %eax,0x16c0
+    base.s.size = 0;
+    1038:	c7 05 c4 16 00 00 00 	movl   $0x0,0x16c4
+    103f:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1042:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1045:	8b 00                	mov    (%eax),%eax
+    1047:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    104a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    104d:	8b 40 04             	mov    0x4(%eax),%eax
+    1050:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1053:	72 4a                	jb     109f <bigalloc+0x94>
+      if(p->s.size == nunits)
+    1055:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1058:	8b 40 04             	mov    0x4(%eax),%eax
+    105b:	39 45 08             	cmp    %eax,0x8(%ebp)
+    105e:	75 0c                	jne    106c <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1060:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1063:	8b 10                	mov    (%eax),%edx
+    1065:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1068:	89 10                	mov    %edx,(%eax)
+    106a:	eb 26                	jmp    1092 <bigalloc+0x87>
+        p->s.size -= nunits;
+    106c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    106f:	8b 40 04             	mov    0x4(%eax),%eax
+    1072:	2b 45 08             	sub    0x8(%ebp),%eax
+    1075:	89 c2                	mov    %eax,%edx
+    1077:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    107d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1080:	8b 40 04             	mov    0x4(%eax),%eax
+    1083:	c1 e0 03             	shl    $0x3,%eax
+    1086:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1089:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108c:	8b 55 08             	mov    0x8(%ebp),%edx
+    108f:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1092:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1095:	a3 c8 16 00 00       	mov    %eax,0x16c8
+      return p;
+    109a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109d:	eb 3b                	jmp    10da <bigalloc+0xcf>
+    if(p == freep)
+    109f:	a1 c8 16 00 00       	mov    0x16c8,%eax
+    10a4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    10a7:	75 1e                	jne    10c7 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    10a9:	83 ec 0c             	sub    $0xc,%esp
+    10ac:	ff 75 08             	push   0x8(%ebp)
+    10af:	e8 fb fe ff ff       	call   faf <morecore>
+    10b4:	83 c4 10             	add    $0x10,%esp
+    10b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10be:	75 07                	jne    10c7 <bigalloc+0xbc>
+        return 0;
+    10c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c5:	eb 13                	jmp    10da <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d0:	8b 00                	mov    (%eax),%eax
+    10d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    10d5:	e9 70 ff ff ff       	jmp    104a <bigalloc+0x3f>
+}
+    10da:	c9                   	leave
+    10db:	c3                   	ret
+
+000010dc <alloc>:
+alloc(uint nbytes)
+{
+    10dc:	55                   	push   %ebp
+    10dd:	89 e5                	mov    %esp,%ebp
+    10df:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e5:	83 c0 07             	add    $0x7,%eax
+    10e8:	c1 e8 03             	shr    $0x3,%eax
+    10eb:	83 c0 01             	add    $0x1,%eax
+    10ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    10f1:	ff 75 f4             	push   -0xc(%ebp)
+    10f4:	e8 2e fd ff ff       	call   e27 <sizeclass>
+    10f9:	83 c4 04             	add    $0x4,%esp
+    10fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10ff:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1103:	79 2c                	jns    1131 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    1105:	83 ec 0c             	sub    $0xc,%esp
+    1108:	ff 75 f4             	push   -0xc(%ebp)
+    110b:	e8 fb fe ff ff       	call   100b <bigalloc>
+    1110:	83 c4 10             	add    $0x10,%esp
+    1113:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1116:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    111a:	75 0a                	jne    1126 <alloc+0x4a>
+      return 0;
+    111c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1121:	e9 c8 00 00 00       	jmp    11ee <alloc+0x112>
+    return (void*)(p + 1);
+    1126:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1129:	83 c0 08             	add    $0x8,%eax
+    112c:	e9 bd 00 00 00       	jmp    11ee <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1131:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1134:	8b 04 85 cc 16 00 00 	mov    0x16cc(,%eax,4),%eax
+    113b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    113e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1142:	74 1a                	je     115e <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1144:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1147:	8b 10                	mov    (%eax),%edx
+    1149:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    114c:	89 14 85 cc 16 00 00 	mov    %edx,0x16cc(,%eax,4)
+    return (void*)(p + 1);
+    1153:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1156:	83 c0 08             	add    $0x8,%eax
+    1159:	e9 90 00 00 00       	jmp    11ee <alloc+0x112>
+  }
+  nunits = 2 << c;
+    115e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1161:	ba 02 00 00 00       	mov    $0x2,%edx
+    1166:	89 c1                	mov    %eax,%ecx
+    1168:	d3 e2                	shl    %cl,%edx
+    116a:	89 d0                	mov    %edx,%eax
+    116c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    116f:	a1 e8 16 00 00       	mov    0x16e8,%eax
+    1174:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1177:	c1 e2 03             	shl    $0x3,%edx
+    117a:	01 d0                	add    %edx,%eax
+    117c:	8b 15 ec 16 00 00    	mov    0x16ec,%edx
+    1182:	39 c2                	cmp    %eax,%edx
+    1184:	73 3f                	jae    11c5 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1186:	83 ec 0c             	sub    $0xc,%esp
+    1189:	68 00 08 00 00       	push   $0x800
+    118e:	e8 78 fe ff ff       	call   100b <bigalloc>
+    1193:	83 c4 10             	add    $0x10,%esp
+    1196:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1199:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    119d:	75 07                	jne    11a6 <alloc+0xca>
+      return 0;
+    119f:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a4:	eb 48                	jmp    11ee <alloc+0x112>
+    bump = (char*)p;
+    11a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11a9:	a3 e8 16 00 00       	mov    %eax,0x16e8
+    bumpend = (char*)(p + p->s.size);
+    11ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11b1:	8b 40 04             	mov    0x4(%eax),%eax
+    11b4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    11bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11be:	01 d0                	add    %edx,%eax
+    11c0:	a3 ec 16 00 00       	mov    %eax,0x16ec
+  }
+  p = (Header*)bump;
+    11c5:	a1 e8 16 00 00       	mov    0x16e8,%eax
+    11ca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    11cd:	a1 e8 16 00 00       	mov    0x16e8,%eax
+    11d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11d5:	c1 e2 03             	shl    $0x3,%edx
+    11d8:	01 d0                	add    %edx,%eax
+    11da:	a3 e8 16 00 00       	mov    %eax,0x16e8
+  p->s.size = nunits;
+    11df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11e5:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    11e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11eb:	83 c0 08             	add    $0x8,%eax
+}
+    11ee:	c9                   	leave
+    11ef:	c3                   	ret
+
+000011f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    11f6:	e8 c2 fb ff ff       	call   dbd <lock>
+    11fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    11fe:	83 ec 0c             	sub    $0xc,%esp
+    1201:	ff 75 08             	push   0x8(%ebp)
+    1204:	e8 d3 fe ff ff       	call   10dc <alloc>
+    1209:	83 c4 10             	add    $0x10,%esp
+    120c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    120f:	83 ec 0c             	sub    $0xc,%esp
+    1212:	ff 75 f4             	push   -0xc(%ebp)
+    1215:	e8 df fb ff ff       	call   df9 <unlock>
+    121a:	83 c4 10             	add    $0x10,%esp
+  return p;
+    121d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1220:	c9                   	leave
+    1221:	c3                   	ret
@@ -0,0 +1,76 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "dent.h"
+
+#define DIR "/getdents_dir"
+#define NFILE 20
+
+int
+main(int argc, char *argv[])
+{
+  char path[32];
+  struct dent d[6];
+  struct stat st;
+  int fd, i, n, seen, dirs;
+
+  if(mkdir(DIR) < 0 || mkdir(DIR "/sub") < 0){
+    printf(1, "error: mkdir %s\n", DIR);
+    exit();
+  }
+  strcpy(path, DIR "/f00");
+  for(i = 0; i < NFILE; i++){
+    path[sizeof(DIR)+1] = '0' + i / 10;
+    path[sizeof(DIR)+2] = '0' + i % 10;
+    if((fd = open(path, O_CREATE | O_RDWR)) < 0 || write(fd, path, i) != i){
+      printf(1, "error: creating %s\n", path);
+      exit();
+    }
+    close(fd);
+  }
+  unlink(DIR "/f05");  // leaves a hole
+
+  // Entries come in batches, each with its type and size.
+  if((fd = open(DIR, O_RDONLY)) < 0){
+    printf(1, "error: open %s\n", DIR);
+    exit();
+  }
+  seen = dirs = 0;
+  while((n = getdents(fd, d, 6)) > 0){
+    for(i = 0; i < n; i++){
+      if(d[i].name[0] == 'f'){
+        strcpy(path, DIR "/");
+        strcpy(path + sizeof(DIR), d[i].name);
+        if(stat(path, &st) < 0 || st.ino != d[i].ino || st.type != T_FILE ||
+           d[i].type != T_FILE || d[i].size != st.size ||
+           d[i].size != (d[i].name[1]-'0')*10 + d[i].name[2]-'0'){
+          printf(1, "error: entry %s\n", d[i].name);
+          exit();
+        }
+        seen++;
+      } else if(d[i].type == T_DIR)
+        dirs++;
+    }
+  }
+  if(n < 0 || seen != NFILE - 1 || dirs != 3){
+    printf(1, "error: %d files, %d directories\n", seen, dirs);
+    exit();
+  }
+  close(fd);
+  if(getdents(0, d, 6) >= 0){
+    printf(1, "error: getdents on a non-directory\n");
+    exit();
+  }
+  printf(1, "getdents ok\n");
+
+  for(i = 0; i < NFILE; i++){
+    strcpy(path, DIR "/f00");
+    path[sizeof(DIR)+1] = '0' + i / 10;
+    path[sizeof(DIR)+2] = '0' + i % 10;
+    unlink(path);
+  }
+  unlink(DIR "/sub");
+  unlink(DIR);
+  exit();
+}
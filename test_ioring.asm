@@ -0,0 +1,2395 @@
+
+_test_ioring:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <queue>:
+static char wbuf[NBLK][BLK];
+static char rbuf[NBLK][BLK];
+
+static void
+queue(int op, int fd, void *addr, int len, int off, int flags, uint data)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  struct ioring_sqe *s;
+
+  s = &ring->sq[ring->sqtail % IORING_NSQ];
+       6:	8b 15 40 19 00 00    	mov    0x1940,%edx
+       c:	a1 40 19 00 00       	mov    0x1940,%eax
+      11:	8b 40 04             	mov    0x4(%eax),%eax
+      14:	83 e0 1f             	and    $0x1f,%eax
+      17:	c1 e0 05             	shl    $0x5,%eax
+      1a:	83 c0 10             	add    $0x10,%eax
+      1d:	01 d0                	add    %edx,%eax
+      1f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s->op = op;
+      22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      25:	8b 55 08             	mov    0x8(%ebp),%edx
+      28:	89 10                	mov    %edx,(%eax)
+  s->fd = fd;
+      2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+      30:	89 50 04             	mov    %edx,0x4(%eax)
+  s->addr = (uint)addr;
+      33:	8b 55 10             	mov    0x10(%ebp),%edx
+      36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      39:	89 50 08             	mov    %edx,0x8(%eax)
+  s->len = len;
+      3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      3f:	8b 55 14             	mov    0x14(%ebp),%edx
+      42:	89 50 0c             	mov    %edx,0xc(%eax)
+  s->off = off;
+      45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      48:	8b 55 18             	mov    0x18(%ebp),%edx
+      4b:	89 50 10             	mov    %edx,0x10(%eax)
+  s->flags = flags;
+      4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      51:	8b 55 1c             	mov    0x1c(%ebp),%edx
+      54:	89 50 14             	mov    %edx,0x14(%eax)
+  s->data = data;
+      57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      5a:	8b 55 20             	mov    0x20(%ebp),%edx
+      5d:	89 50 18             	mov    %edx,0x18(%eax)
+  ring->sqtail++;
+      60:	a1 40 19 00 00       	mov    0x1940,%eax
+      65:	8b 50 04             	mov    0x4(%eax),%edx
+      68:	83 c2 01             	add    $0x1,%edx
+      6b:	89 50 04             	mov    %edx,0x4(%eax)
+}
+      6e:	90                   	nop
+      6f:	c9                   	leave
+      70:	c3                   	ret
+
+00000071 <run>:
+
+// Submit what is queued, wait for n completions and return the
+// result of the one with data, or -2 if it is not among them.
+static int
+run(int n, uint data)
+{
+      71:	55                   	push   %ebp
+      72:	89 e5                	mov    %esp,%ebp
+      74:	83 ec 18             	sub    $0x18,%esp
+  struct ioring_cqe *c;
+  int res;
+
+  if(ioring_enter(IORING_NSQ, n) < 0){
+      77:	83 ec 08             	sub    $0x8,%esp
+      7a:	ff 75 08             	push   0x8(%ebp)
+      7d:	6a 20                	push   $0x20
+      7f:	e8 eb 09 00 00       	call   a6f <ioring_enter>
+      84:	83 c4 10             	add    $0x10,%esp
+      87:	85 c0                	test   %eax,%eax
+      89:	79 17                	jns    a2 <run+0x31>
+    printf(1, "error: ioring_enter\n");
+      8b:	83 ec 08             	sub    $0x8,%esp
+      8e:	68 fc 13 00 00       	push   $0x13fc
+      93:	6a 01                	push   $0x1
+      95:	e8 c5 0c 00 00       	call   d5f <printf>
+      9a:	83 c4 10             	add    $0x10,%esp
+    exit();
+      9d:	e8 2d 08 00 00       	call   8cf <exit>
+  }
+  res = -2;
+      a2:	c7 45 f4 fe ff ff ff 	movl   $0xfffffffe,-0xc(%ebp)
+  while(n-- > 0 && ring->cqhead != ring->cqtail){
+      a9:	eb 3f                	jmp    ea <run+0x79>
+    c = &ring->cq[ring->cqhead % IORING_NCQ];
+      ab:	8b 15 40 19 00 00    	mov    0x1940,%edx
+      b1:	a1 40 19 00 00       	mov    0x1940,%eax
+      b6:	8b 40 08             	mov    0x8(%eax),%eax
+      b9:	83 e0 3f             	and    $0x3f,%eax
+      bc:	05 82 00 00 00       	add    $0x82,%eax
+      c1:	c1 e0 03             	shl    $0x3,%eax
+      c4:	01 d0                	add    %edx,%eax
+      c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c->data == data)
+      c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      cc:	8b 00                	mov    (%eax),%eax
+      ce:	39 45 0c             	cmp    %eax,0xc(%ebp)
+      d1:	75 09                	jne    dc <run+0x6b>
+      res = c->res;
+      d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      d6:	8b 40 04             	mov    0x4(%eax),%eax
+      d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    ring->cqhead++;
+      dc:	a1 40 19 00 00       	mov    0x1940,%eax
+      e1:	8b 50 08             	mov    0x8(%eax),%edx
+      e4:	83 c2 01             	add    $0x1,%edx
+      e7:	89 50 08             	mov    %edx,0x8(%eax)
+  while(n-- > 0 && ring->cqhead != ring->cqtail){
+      ea:	8b 45 08             	mov    0x8(%ebp),%eax
+      ed:	8d 50 ff             	lea    -0x1(%eax),%edx
+      f0:	89 55 08             	mov    %edx,0x8(%ebp)
+      f3:	85 c0                	test   %eax,%eax
+      f5:	7e 14                	jle    10b <run+0x9a>
+      f7:	a1 40 19 00 00       	mov    0x1940,%eax
+      fc:	8b 50 08             	mov    0x8(%eax),%edx
+      ff:	a1 40 19 00 00       	mov    0x1940,%eax
+     104:	8b 40 0c             	mov    0xc(%eax),%eax
+     107:	39 c2                	cmp    %eax,%edx
+     109:	75 a0                	jne    ab <run+0x3a>
+  }
+  return res;
+     10b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     10e:	c9                   	leave
+     10f:	c3                   	ret
+
+00000110 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     110:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     114:	83 e4 f0             	and    $0xfffffff0,%esp
+     117:	ff 71 fc             	push   -0x4(%ecx)
+     11a:	55                   	push   %ebp
+     11b:	89 e5                	mov    %esp,%ebp
+     11d:	53                   	push   %ebx
+     11e:	51                   	push   %ecx
+     11f:	83 ec 20             	sub    $0x20,%esp
+  struct ioring_cqe *cqe;
+  int fd, i, j, p[2];
+  char *m, c;
+
+  m = sbrk(2*4096);
+     122:	83 ec 0c             	sub    $0xc,%esp
+     125:	68 00 20 00 00       	push   $0x2000
+     12a:	e8 32 08 00 00       	call   961 <sbrk>
+     12f:	83 c4 10             	add    $0x10,%esp
+     132:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  ring = (struct ioring*)(((uint)m + 4095) & ~4095);
+     135:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     138:	05 ff 0f 00 00       	add    $0xfff,%eax
+     13d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+     142:	a3 40 19 00 00       	mov    %eax,0x1940
+  memset(ring, 0, sizeof(*ring));
+     147:	a1 40 19 00 00       	mov    0x1940,%eax
+     14c:	83 ec 04             	sub    $0x4,%esp
+     14f:	68 10 06 00 00       	push   $0x610
+     154:	6a 00                	push   $0x0
+     156:	50                   	push   %eax
+     157:	e8 98 05 00 00       	call   6f4 <memset>
+     15c:	83 c4 10             	add    $0x10,%esp
+  if(ioring_setup(ring) < 0 || ioring_setup(ring) == 0){
+     15f:	a1 40 19 00 00       	mov    0x1940,%eax
+     164:	83 ec 0c             	sub    $0xc,%esp
+     167:	50                   	push   %eax
+     168:	e8 f8 08 00 00       	call   a65 <ioring_setup>
+     16d:	83 c4 10             	add    $0x10,%esp
+     170:	85 c0                	test   %eax,%eax
+     172:	78 15                	js     189 <main+0x79>
+     174:	a1 40 19 00 00       	mov    0x1940,%eax
+     179:	83 ec 0c             	sub    $0xc,%esp
+     17c:	50                   	push   %eax
+     17d:	e8 e3 08 00 00       	call   a65 <ioring_setup>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	75 17                	jne    1a0 <main+0x90>
+    printf(1, "error: ioring_setup\n");
+     189:	83 ec 08             	sub    $0x8,%esp
+     18c:	68 11 14 00 00       	push   $0x1411
+     191:	6a 01                	push   $0x1
+     193:	e8 c7 0b 00 00       	call   d5f <printf>
+     198:	83 c4 10             	add    $0x10,%esp
+    exit();
+     19b:	e8 2f 07 00 00       	call   8cf <exit>
+  }
+
+  queue(IORING_OP_OPEN, 0, TEST_FILE, 0, 0, O_CREATE|O_RDWR, 1);
+     1a0:	83 ec 04             	sub    $0x4,%esp
+     1a3:	6a 01                	push   $0x1
+     1a5:	68 02 02 00 00       	push   $0x202
+     1aa:	6a 00                	push   $0x0
+     1ac:	6a 00                	push   $0x0
+     1ae:	68 26 14 00 00       	push   $0x1426
+     1b3:	6a 00                	push   $0x0
+     1b5:	6a 04                	push   $0x4
+     1b7:	e8 44 fe ff ff       	call   0 <queue>
+     1bc:	83 c4 20             	add    $0x20,%esp
+  if((fd = run(1, 1)) < 0){
+     1bf:	83 ec 08             	sub    $0x8,%esp
+     1c2:	6a 01                	push   $0x1
+     1c4:	6a 01                	push   $0x1
+     1c6:	e8 a6 fe ff ff       	call   71 <run>
+     1cb:	83 c4 10             	add    $0x10,%esp
+     1ce:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     1d1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     1d5:	79 17                	jns    1ee <main+0xde>
+    printf(1, "error: open\n");
+     1d7:	83 ec 08             	sub    $0x8,%esp
+     1da:	68 33 14 00 00       	push   $0x1433
+     1df:	6a 01                	push   $0x1
+     1e1:	e8 79 0b 00 00       	call   d5f <printf>
+     1e6:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1e9:	e8 e1 06 00 00       	call   8cf <exit>
+  }
+
+  // Many writes in flight at once, then reads of what they wrote.
+  for(i = 0; i < NBLK; i++){
+     1ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1f5:	eb 5c                	jmp    253 <main+0x143>
+    memset(wbuf[i], 'a' + i, BLK);
+     1f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1fa:	8d 50 61             	lea    0x61(%eax),%edx
+     1fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     200:	c1 e0 09             	shl    $0x9,%eax
+     203:	05 60 19 00 00       	add    $0x1960,%eax
+     208:	83 ec 04             	sub    $0x4,%esp
+     20b:	68 00 02 00 00       	push   $0x200
+     210:	52                   	push   %edx
+     211:	50                   	push   %eax
+     212:	e8 dd 04 00 00       	call   6f4 <memset>
+     217:	83 c4 10             	add    $0x10,%esp
+    queue(IORING_OP_WRITE, fd, wbuf[i], BLK, i*BLK, 0, 100 + i);
+     21a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     21d:	83 c0 64             	add    $0x64,%eax
+     220:	89 c1                	mov    %eax,%ecx
+     222:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     225:	c1 e0 09             	shl    $0x9,%eax
+     228:	89 c2                	mov    %eax,%edx
+     22a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     22d:	c1 e0 09             	shl    $0x9,%eax
+     230:	05 60 19 00 00       	add    $0x1960,%eax
+     235:	83 ec 04             	sub    $0x4,%esp
+     238:	51                   	push   %ecx
+     239:	6a 00                	push   $0x0
+     23b:	52                   	push   %edx
+     23c:	68 00 02 00 00       	push   $0x200
+     241:	50                   	push   %eax
+     242:	ff 75 e8             	push   -0x18(%ebp)
+     245:	6a 02                	push   $0x2
+     247:	e8 b4 fd ff ff       	call   0 <queue>
+     24c:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < NBLK; i++){
+     24f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     253:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     257:	7e 9e                	jle    1f7 <main+0xe7>
+  }
+  queue(IORING_OP_FSYNC, fd, 0, 0, 0, 0, 200);
+     259:	83 ec 04             	sub    $0x4,%esp
+     25c:	68 c8 00 00 00       	push   $0xc8
+     261:	6a 00                	push   $0x0
+     263:	6a 00                	push   $0x0
+     265:	6a 00                	push   $0x0
+     267:	6a 00                	push   $0x0
+     269:	ff 75 e8             	push   -0x18(%ebp)
+     26c:	6a 03                	push   $0x3
+     26e:	e8 8d fd ff ff       	call   0 <queue>
+     273:	83 c4 20             	add    $0x20,%esp
+  if(ioring_enter(IORING_NSQ, NBLK + 1) != NBLK + 1){
+     276:	83 ec 08             	sub    $0x8,%esp
+     279:	6a 09                	push   $0x9
+     27b:	6a 20                	push   $0x20
+     27d:	e8 ed 07 00 00       	call   a6f <ioring_enter>
+     282:	83 c4 10             	add    $0x10,%esp
+     285:	83 f8 09             	cmp    $0x9,%eax
+     288:	74 17                	je     2a1 <main+0x191>
+    printf(1, "error: submit\n");
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 40 14 00 00       	push   $0x1440
+     292:	6a 01                	push   $0x1
+     294:	e8 c6 0a 00 00       	call   d5f <printf>
+     299:	83 c4 10             	add    $0x10,%esp
+    exit();
+     29c:	e8 2e 06 00 00       	call   8cf <exit>
+  }
+  for(i = 0; i < NBLK + 1; i++){
+     2a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     2a8:	e9 99 00 00 00       	jmp    346 <main+0x236>
+    if(ring->cqhead == ring->cqtail){
+     2ad:	a1 40 19 00 00       	mov    0x1940,%eax
+     2b2:	8b 50 08             	mov    0x8(%eax),%edx
+     2b5:	a1 40 19 00 00       	mov    0x1940,%eax
+     2ba:	8b 40 0c             	mov    0xc(%eax),%eax
+     2bd:	39 c2                	cmp    %eax,%edx
+     2bf:	75 17                	jne    2d8 <main+0x1c8>
+      printf(1, "error: missing completion\n");
+     2c1:	83 ec 08             	sub    $0x8,%esp
+     2c4:	68 4f 14 00 00       	push   $0x144f
+     2c9:	6a 01                	push   $0x1
+     2cb:	e8 8f 0a 00 00       	call   d5f <printf>
+     2d0:	83 c4 10             	add    $0x10,%esp
+      exit();
+     2d3:	e8 f7 05 00 00       	call   8cf <exit>
+    }
+    cqe = &ring->cq[ring->cqhead++ % IORING_NCQ];
+     2d8:	8b 1d 40 19 00 00    	mov    0x1940,%ebx
+     2de:	a1 40 19 00 00       	mov    0x1940,%eax
+     2e3:	8b 50 08             	mov    0x8(%eax),%edx
+     2e6:	8d 4a 01             	lea    0x1(%edx),%ecx
+     2e9:	89 48 08             	mov    %ecx,0x8(%eax)
+     2ec:	89 d0                	mov    %edx,%eax
+     2ee:	83 e0 3f             	and    $0x3f,%eax
+     2f1:	05 82 00 00 00       	add    $0x82,%eax
+     2f6:	c1 e0 03             	shl    $0x3,%eax
+     2f9:	01 d8                	add    %ebx,%eax
+     2fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(cqe->res != (cqe->data == 200 ? 0 : BLK)){
+     2fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     301:	8b 40 04             	mov    0x4(%eax),%eax
+     304:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     307:	8b 12                	mov    (%edx),%edx
+     309:	81 fa c8 00 00 00    	cmp    $0xc8,%edx
+     30f:	75 07                	jne    318 <main+0x208>
+     311:	ba 00 00 00 00       	mov    $0x0,%edx
+     316:	eb 05                	jmp    31d <main+0x20d>
+     318:	ba 00 02 00 00       	mov    $0x200,%edx
+     31d:	39 c2                	cmp    %eax,%edx
+     31f:	74 21                	je     342 <main+0x232>
+      printf(1, "error: request %d returned %d\n", cqe->data, cqe->res);
+     321:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     324:	8b 50 04             	mov    0x4(%eax),%edx
+     327:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     32a:	8b 00                	mov    (%eax),%eax
+     32c:	52                   	push   %edx
+     32d:	50                   	push   %eax
+     32e:	68 6c 14 00 00       	push   $0x146c
+     333:	6a 01                	push   $0x1
+     335:	e8 25 0a 00 00       	call   d5f <printf>
+     33a:	83 c4 10             	add    $0x10,%esp
+      exit();
+     33d:	e8 8d 05 00 00       	call   8cf <exit>
+  for(i = 0; i < NBLK + 1; i++){
+     342:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     346:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+     34a:	0f 8e 5d ff ff ff    	jle    2ad <main+0x19d>
+    }
+  }
+  for(i = 0; i < NBLK; i++)
+     350:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     357:	eb 3b                	jmp    394 <main+0x284>
+    queue(IORING_OP_READ, fd, rbuf[i], BLK, i*BLK, 0, 300 + i);
+     359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     35c:	05 2c 01 00 00       	add    $0x12c,%eax
+     361:	89 c1                	mov    %eax,%ecx
+     363:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     366:	c1 e0 09             	shl    $0x9,%eax
+     369:	89 c2                	mov    %eax,%edx
+     36b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     36e:	c1 e0 09             	shl    $0x9,%eax
+     371:	05 60 29 00 00       	add    $0x2960,%eax
+     376:	83 ec 04             	sub    $0x4,%esp
+     379:	51                   	push   %ecx
+     37a:	6a 00                	push   $0x0
+     37c:	52                   	push   %edx
+     37d:	68 00 02 00 00       	push   $0x200
+     382:	50                   	push   %eax
+     383:	ff 75 e8             	push   -0x18(%ebp)
+     386:	6a 01                	push   $0x1
+     388:	e8 73 fc ff ff       	call   0 <queue>
+     38d:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < NBLK; i++)
+     390:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     394:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     398:	7e bf                	jle    359 <main+0x249>
+  if(ioring_enter(IORING_NSQ, NBLK) != NBLK ||
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	6a 08                	push   $0x8
+     39f:	6a 20                	push   $0x20
+     3a1:	e8 c9 06 00 00       	call   a6f <ioring_enter>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	83 f8 08             	cmp    $0x8,%eax
+     3ac:	75 17                	jne    3c5 <main+0x2b5>
+     (int)(ring->cqtail - ring->cqhead) != NBLK){
+     3ae:	a1 40 19 00 00       	mov    0x1940,%eax
+     3b3:	8b 50 0c             	mov    0xc(%eax),%edx
+     3b6:	a1 40 19 00 00       	mov    0x1940,%eax
+     3bb:	8b 40 08             	mov    0x8(%eax),%eax
+     3be:	29 c2                	sub    %eax,%edx
+  if(ioring_enter(IORING_NSQ, NBLK) != NBLK ||
+     3c0:	83 fa 08             	cmp    $0x8,%edx
+     3c3:	74 17                	je     3dc <main+0x2cc>
+    printf(1, "error: reads\n");
+     3c5:	83 ec 08             	sub    $0x8,%esp
+     3c8:	68 8b 14 00 00       	push   $0x148b
+     3cd:	6a 01                	push   $0x1
+     3cf:	e8 8b 09 00 00       	call   d5f <printf>
+     3d4:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3d7:	e8 f3 04 00 00       	call   8cf <exit>
+  }
+  ring->cqhead = ring->cqtail;
+     3dc:	8b 15 40 19 00 00    	mov    0x1940,%edx
+     3e2:	a1 40 19 00 00       	mov    0x1940,%eax
+     3e7:	8b 52 0c             	mov    0xc(%edx),%edx
+     3ea:	89 50 08             	mov    %edx,0x8(%eax)
+  for(i = 0; i < NBLK; i++)
+     3ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3f4:	eb 56                	jmp    44c <main+0x33c>
+    for(j = 0; j < BLK; j++)
+     3f6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     3fd:	eb 40                	jmp    43f <main+0x32f>
+      if(rbuf[i][j] != 'a' + i){
+     3ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     402:	c1 e0 09             	shl    $0x9,%eax
+     405:	89 c2                	mov    %eax,%edx
+     407:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     40a:	01 d0                	add    %edx,%eax
+     40c:	05 60 29 00 00       	add    $0x2960,%eax
+     411:	0f b6 00             	movzbl (%eax),%eax
+     414:	0f be d0             	movsbl %al,%edx
+     417:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     41a:	83 c0 61             	add    $0x61,%eax
+     41d:	39 c2                	cmp    %eax,%edx
+     41f:	74 1a                	je     43b <main+0x32b>
+        printf(1, "error: block %d byte %d\n", i, j);
+     421:	ff 75 f0             	push   -0x10(%ebp)
+     424:	ff 75 f4             	push   -0xc(%ebp)
+     427:	68 99 14 00 00       	push   $0x1499
+     42c:	6a 01                	push   $0x1
+     42e:	e8 2c 09 00 00       	call   d5f <printf>
+     433:	83 c4 10             	add    $0x10,%esp
+        exit();
+     436:	e8 94 04 00 00       	call   8cf <exit>
+    for(j = 0; j < BLK; j++)
+     43b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     43f:	81 7d f0 ff 01 00 00 	cmpl   $0x1ff,-0x10(%ebp)
+     446:	7e b7                	jle    3ff <main+0x2ef>
+  for(i = 0; i < NBLK; i++)
+     448:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     44c:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+     450:	7e a4                	jle    3f6 <main+0x2e6>
+      }
+  queue(IORING_OP_CLOSE, fd, 0, 0, 0, 0, 2);
+     452:	83 ec 04             	sub    $0x4,%esp
+     455:	6a 02                	push   $0x2
+     457:	6a 00                	push   $0x0
+     459:	6a 00                	push   $0x0
+     45b:	6a 00                	push   $0x0
+     45d:	6a 00                	push   $0x0
+     45f:	ff 75 e8             	push   -0x18(%ebp)
+     462:	6a 05                	push   $0x5
+     464:	e8 97 fb ff ff       	call   0 <queue>
+     469:	83 c4 20             	add    $0x20,%esp
+  if(run(1, 2) != 0 || close(fd) == 0){
+     46c:	83 ec 08             	sub    $0x8,%esp
+     46f:	6a 02                	push   $0x2
+     471:	6a 01                	push   $0x1
+     473:	e8 f9 fb ff ff       	call   71 <run>
+     478:	83 c4 10             	add    $0x10,%esp
+     47b:	85 c0                	test   %eax,%eax
+     47d:	75 12                	jne    491 <main+0x381>
+     47f:	83 ec 0c             	sub    $0xc,%esp
+     482:	ff 75 e8             	push   -0x18(%ebp)
+     485:	e8 68 04 00 00       	call   8f2 <close>
+     48a:	83 c4 10             	add    $0x10,%esp
+     48d:	85 c0                	test   %eax,%eax
+     48f:	75 17                	jne    4a8 <main+0x398>
+    printf(1, "error: close\n");
+     491:	83 ec 08             	sub    $0x8,%esp
+     494:	68 b2 14 00 00       	push   $0x14b2
+     499:	6a 01                	push   $0x1
+     49b:	e8 bf 08 00 00       	call   d5f <printf>
+     4a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     4a3:	e8 27 04 00 00       	call   8cf <exit>
+  }
+  printf(1, "ioring files ok\n");
+     4a8:	83 ec 08             	sub    $0x8,%esp
+     4ab:	68 c0 14 00 00       	push   $0x14c0
+     4b0:	6a 01                	push   $0x1
+     4b2:	e8 a8 08 00 00       	call   d5f <printf>
+     4b7:	83 c4 10             	add    $0x10,%esp
+
+  // A pipe, with the read queued before the write that feeds it.
+  if(pipe(p) < 0){
+     4ba:	83 ec 0c             	sub    $0xc,%esp
+     4bd:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     4c0:	50                   	push   %eax
+     4c1:	e8 17 04 00 00       	call   8dd <pipe>
+     4c6:	83 c4 10             	add    $0x10,%esp
+     4c9:	85 c0                	test   %eax,%eax
+     4cb:	79 17                	jns    4e4 <main+0x3d4>
+    printf(1, "error: pipe\n");
+     4cd:	83 ec 08             	sub    $0x8,%esp
+     4d0:	68 d1 14 00 00       	push   $0x14d1
+     4d5:	6a 01                	push   $0x1
+     4d7:	e8 83 08 00 00       	call   d5f <printf>
+     4dc:	83 c4 10             	add    $0x10,%esp
+    exit();
+     4df:	e8 eb 03 00 00       	call   8cf <exit>
+  }
+  queue(IORING_OP_READ, p[0], &c, 1, -1, 0, 3);
+     4e4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     4e7:	83 ec 04             	sub    $0x4,%esp
+     4ea:	6a 03                	push   $0x3
+     4ec:	6a 00                	push   $0x0
+     4ee:	6a ff                	push   $0xffffffff
+     4f0:	6a 01                	push   $0x1
+     4f2:	8d 55 db             	lea    -0x25(%ebp),%edx
+     4f5:	52                   	push   %edx
+     4f6:	50                   	push   %eax
+     4f7:	6a 01                	push   $0x1
+     4f9:	e8 02 fb ff ff       	call   0 <queue>
+     4fe:	83 c4 20             	add    $0x20,%esp
+  if(ioring_enter(1, 0) != 1){
+     501:	83 ec 08             	sub    $0x8,%esp
+     504:	6a 00                	push   $0x0
+     506:	6a 01                	push   $0x1
+     508:	e8 62 05 00 00       	call   a6f <ioring_enter>
+     50d:	83 c4 10             	add    $0x10,%esp
+     510:	83 f8 01             	cmp    $0x1,%eax
+     513:	74 17                	je     52c <main+0x41c>
+    printf(1, "error: submit\n");
+     515:	83 ec 08             	sub    $0x8,%esp
+     518:	68 40 14 00 00       	push   $0x1440
+     51d:	6a 01                	push   $0x1
+     51f:	e8 3b 08 00 00       	call   d5f <printf>
+     524:	83 c4 10             	add    $0x10,%esp
+    exit();
+     527:	e8 a3 03 00 00       	call   8cf <exit>
+  }
+  write(p[1], "x", 1);
+     52c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     52f:	83 ec 04             	sub    $0x4,%esp
+     532:	6a 01                	push   $0x1
+     534:	68 de 14 00 00       	push   $0x14de
+     539:	50                   	push   %eax
+     53a:	e8 ac 03 00 00       	call   8eb <write>
+     53f:	83 c4 10             	add    $0x10,%esp
+  if(run(1, 3) != 1 || c != 'x'){
+     542:	83 ec 08             	sub    $0x8,%esp
+     545:	6a 03                	push   $0x3
+     547:	6a 01                	push   $0x1
+     549:	e8 23 fb ff ff       	call   71 <run>
+     54e:	83 c4 10             	add    $0x10,%esp
+     551:	83 f8 01             	cmp    $0x1,%eax
+     554:	75 08                	jne    55e <main+0x44e>
+     556:	0f b6 45 db          	movzbl -0x25(%ebp),%eax
+     55a:	3c 78                	cmp    $0x78,%al
+     55c:	74 17                	je     575 <main+0x465>
+    printf(1, "error: pipe read\n");
+     55e:	83 ec 08             	sub    $0x8,%esp
+     561:	68 e0 14 00 00       	push   $0x14e0
+     566:	6a 01                	push   $0x1
+     568:	e8 f2 07 00 00       	call   d5f <printf>
+     56d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     570:	e8 5a 03 00 00       	call   8cf <exit>
+  }
+  queue(IORING_OP_WRITE, 99, &c, 1, -1, 0, 4);
+     575:	83 ec 04             	sub    $0x4,%esp
+     578:	6a 04                	push   $0x4
+     57a:	6a 00                	push   $0x0
+     57c:	6a ff                	push   $0xffffffff
+     57e:	6a 01                	push   $0x1
+     580:	8d 45 db             	lea    -0x25(%ebp),%eax
+     583:	50                   	push   %eax
+     584:	6a 63                	push   $0x63
+     586:	6a 02                	push   $0x2
+     588:	e8 73 fa ff ff       	call   0 <queue>
+     58d:	83 c4 20             	add    $0x20,%esp
+  if(run(1, 4) != -1){
+     590:	83 ec 08             	sub    $0x8,%esp
+     593:	6a 04                	push   $0x4
+     595:	6a 01                	push   $0x1
+     597:	e8 d5 fa ff ff       	call   71 <run>
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5a2:	74 17                	je     5bb <main+0x4ab>
+    printf(1, "error: bad descriptor accepted\n");
+     5a4:	83 ec 08             	sub    $0x8,%esp
+     5a7:	68 f4 14 00 00       	push   $0x14f4
+     5ac:	6a 01                	push   $0x1
+     5ae:	e8 ac 07 00 00       	call   d5f <printf>
+     5b3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5b6:	e8 14 03 00 00       	call   8cf <exit>
+  }
+  close(p[0]);
+     5bb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     5be:	83 ec 0c             	sub    $0xc,%esp
+     5c1:	50                   	push   %eax
+     5c2:	e8 2b 03 00 00       	call   8f2 <close>
+     5c7:	83 c4 10             	add    $0x10,%esp
+  close(p[1]);
+     5ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     5cd:	83 ec 0c             	sub    $0xc,%esp
+     5d0:	50                   	push   %eax
+     5d1:	e8 1c 03 00 00       	call   8f2 <close>
+     5d6:	83 c4 10             	add    $0x10,%esp
+
+  // The child gets a copy of the ring page, not the ring.
+  if(fork() == 0){
+     5d9:	e8 ea 02 00 00       	call   8c8 <fork>
+     5de:	85 c0                	test   %eax,%eax
+     5e0:	75 2a                	jne    60c <main+0x4fc>
+    if(ioring_enter(1, 0) >= 0)
+     5e2:	83 ec 08             	sub    $0x8,%esp
+     5e5:	6a 00                	push   $0x0
+     5e7:	6a 01                	push   $0x1
+     5e9:	e8 81 04 00 00       	call   a6f <ioring_enter>
+     5ee:	83 c4 10             	add    $0x10,%esp
+     5f1:	85 c0                	test   %eax,%eax
+     5f3:	78 12                	js     607 <main+0x4f7>
+      printf(1, "error: child has the ring\n");
+     5f5:	83 ec 08             	sub    $0x8,%esp
+     5f8:	68 14 15 00 00       	push   $0x1514
+     5fd:	6a 01                	push   $0x1
+     5ff:	e8 5b 07 00 00       	call   d5f <printf>
+     604:	83 c4 10             	add    $0x10,%esp
+    exit();
+     607:	e8 c3 02 00 00       	call   8cf <exit>
+  }
+  wait();
+     60c:	e8 c5 02 00 00       	call   8d6 <wait>
+  unlink(TEST_FILE);
+     611:	83 ec 0c             	sub    $0xc,%esp
+     614:	68 26 14 00 00       	push   $0x1426
+     619:	e8 fd 02 00 00       	call   91b <unlink>
+     61e:	83 c4 10             	add    $0x10,%esp
+  printf(1, "ioring pipes ok\n");
+     621:	83 ec 08             	sub    $0x8,%esp
+     624:	68 2f 15 00 00       	push   $0x152f
+     629:	6a 01                	push   $0x1
+     62b:	e8 2f 07 00 00       	call   d5f <printf>
+     630:	83 c4 10             	add    $0x10,%esp
+  exit();
+     633:	e8 97 02 00 00       	call   8cf <exit>
+
+00000638 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     638:	55                   	push   %ebp
+     639:	89 e5                	mov    %esp,%ebp
+     63b:	57                   	push   %edi
+     63c:	53                   	push   %ebx
+    if(cc < 1)
+     63d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     640:	8b 55 10             	mov    0x10(%ebp),%edx
+     643:	8b 45 0c             	mov    0xc(%ebp),%eax
+     646:	89 cb                	mov    %ecx,%ebx
+     648:	89 df                	mov    %ebx,%edi
+     64a:	89 d1                	mov    %edx,%ecx
+     64c:	fc                   	cld
+     64d:	f3 aa                	rep stos %al,%es:(%edi)
+     64f:	89 ca                	mov    %ecx,%edx
+     651:	89 fb                	mov    %edi,%ebx
+     653:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     656:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     659:	90                   	nop
+     65a:	5b                   	pop    %ebx
+     65b:	5f                   	pop    %edi
+     65c:	5d                   	pop    %ebp
+     65d:	c3                   	ret
+
+0000065e <strcpy>:
+{
+     65e:	55                   	push   %ebp
+     65f:	89 e5                	mov    %esp,%ebp
+     661:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     664:	8b 45 08             	mov    0x8(%ebp),%eax
+     667:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     66a:	90                   	nop
+     66b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     66e:	8d 42 01             	lea    0x1(%edx),%eax
+     671:	89 45 0c             	mov    %eax,0xc(%ebp)
+     674:	8b 45 08             	mov    0x8(%ebp),%eax
+     677:	8d 48 01             	lea    0x1(%eax),%ecx
+     67a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     67d:	0f b6 12             	movzbl (%edx),%edx
+     680:	88 10                	mov    %dl,(%eax)
+     682:	0f b6 00             	movzbl (%eax),%eax
+     685:	84 c0                	test   %al,%al
+     687:	75 e2                	jne    66b <strcpy+0xd>
+  return os;
+     689:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     68c:	c9                   	leave
+     68d:	c3                   	ret
+
+0000068e <strcmp>:
+{
+     68e:	55                   	push   %ebp
+     68f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     691:	eb 08                	jmp    69b <strcmp+0xd>
+    p++, q++;
+     693:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     697:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     69b:	8b 45 08             	mov    0x8(%ebp),%eax
+     69e:	0f b6 00             	movzbl (%eax),%eax
+     6a1:	84 c0                	test   %al,%al
+     6a3:	74 10                	je     6b5 <strcmp+0x27>
+     6a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a8:	0f b6 10             	movzbl (%eax),%edx
+     6ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6ae:	0f b6 00             	movzbl (%eax),%eax
+     6b1:	38 c2                	cmp    %al,%dl
+     6b3:	74 de                	je     693 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     6b5:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b8:	0f b6 00             	movzbl (%eax),%eax
+     6bb:	0f b6 d0             	movzbl %al,%edx
+     6be:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6c1:	0f b6 00             	movzbl (%eax),%eax
+     6c4:	0f b6 c0             	movzbl %al,%eax
+     6c7:	29 c2                	sub    %eax,%edx
+     6c9:	89 d0                	mov    %edx,%eax
+}
+     6cb:	5d                   	pop    %ebp
+     6cc:	c3                   	ret
+
+000006cd <strlen>:
+{
+     6cd:	55                   	push   %ebp
+     6ce:	89 e5                	mov    %esp,%ebp
+     6d0:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     6d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     6da:	eb 04                	jmp    6e0 <strlen+0x13>
+     6dc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     6e0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e6:	01 d0                	add    %edx,%eax
+     6e8:	0f b6 00             	movzbl (%eax),%eax
+     6eb:	84 c0                	test   %al,%al
+     6ed:	75 ed                	jne    6dc <strlen+0xf>
+  return n;
+     6ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     6f2:	c9                   	leave
+     6f3:	c3                   	ret
+
+000006f4 <memset>:
+{
+     6f4:	55                   	push   %ebp
+     6f5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     6f7:	8b 45 10             	mov    0x10(%ebp),%eax
+     6fa:	50                   	push   %eax
+     6fb:	ff 75 0c             	push   0xc(%ebp)
+     6fe:	ff 75 08             	push   0x8(%ebp)
+     701:	e8 32 ff ff ff       	call   638 <stosb>
+     706:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     709:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     70c:	c9                   	leave
+     70d:	c3                   	ret
+
+0000070e <strchr>:
+{
+     70e:	55                   	push   %ebp
+     70f:	89 e5                	mov    %esp,%ebp
+     711:	83 ec 04             	sub    $0x4,%esp
+     714:	8b 45 0c             	mov    0xc(%ebp),%eax
+     717:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     71a:	eb 14                	jmp    730 <strchr+0x22>
+    if(*s == c)
+     71c:	8b 45 08             	mov    0x8(%ebp),%eax
+     71f:	0f b6 00             	movzbl (%eax),%eax
+     722:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     725:	75 05                	jne    72c <strchr+0x1e>
+      return (char*)s;
+     727:	8b 45 08             	mov    0x8(%ebp),%eax
+     72a:	eb 13                	jmp    73f <strchr+0x31>
+  for(; *s; s++)
+     72c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     730:	8b 45 08             	mov    0x8(%ebp),%eax
+     733:	0f b6 00             	movzbl (%eax),%eax
+     736:	84 c0                	test   %al,%al
+     738:	75 e2                	jne    71c <strchr+0xe>
+  return 0;
+     73a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     73f:	c9                   	leave
+     740:	c3                   	ret
+
+00000741 <gets>:
+{
+     741:	55                   	push   %ebp
+     742:	89 e5                	mov    %esp,%ebp
+     744:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     747:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     74e:	eb 42                	jmp    792 <gets+0x51>
+    cc = read(0, &c, 1);
+     750:	83 ec 04             	sub    $0x4,%esp
+     753:	6a 01                	push   $0x1
+     755:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     758:	50                   	push   %eax
+     759:	6a 00                	push   $0x0
+     75b:	e8 84 01 00 00       	call   8e4 <read>
+     760:	83 c4 10             	add    $0x10,%esp
+     763:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     766:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     76a:	7e 33                	jle    79f <gets+0x5e>
+    buf[i++] = c;
+     76c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     76f:	8d 50 01             	lea    0x1(%eax),%edx
+     772:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     775:	89 c2                	mov    %eax,%edx
+     777:	8b 45 08             	mov    0x8(%ebp),%eax
+     77a:	01 c2                	add    %eax,%edx
+     77c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     780:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     782:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     786:	3c 0a                	cmp    $0xa,%al
+     788:	74 16                	je     7a0 <gets+0x5f>
+     78a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     78e:	3c 0d                	cmp    $0xd,%al
+     790:	74 0e                	je     7a0 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     792:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     795:	83 c0 01             	add    $0x1,%eax
+     798:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     79b:	7f b3                	jg     750 <gets+0xf>
+     79d:	eb 01                	jmp    7a0 <gets+0x5f>
+      break;
+     79f:	90                   	nop
+  }
+  buf[i] = '\0';
+     7a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     7a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a6:	01 d0                	add    %edx,%eax
+     7a8:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     7ae:	c9                   	leave
+     7af:	c3                   	ret
+
+000007b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     7b6:	83 ec 08             	sub    $0x8,%esp
+     7b9:	6a 00                	push   $0x0
+     7bb:	ff 75 08             	push   0x8(%ebp)
+     7be:	e8 44 01 00 00       	call   907 <open>
+     7c3:	83 c4 10             	add    $0x10,%esp
+     7c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     7c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     7cd:	79 07                	jns    7d6 <stat+0x26>
+    return -1;
+     7cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7d4:	eb 25                	jmp    7fb <stat+0x4b>
+  r = fstat(fd, st);
+     7d6:	83 ec 08             	sub    $0x8,%esp
+     7d9:	ff 75 0c             	push   0xc(%ebp)
+     7dc:	ff 75 f4             	push   -0xc(%ebp)
+     7df:	e8 41 01 00 00       	call   925 <fstat>
+     7e4:	83 c4 10             	add    $0x10,%esp
+     7e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     7ea:	83 ec 0c             	sub    $0xc,%esp
+     7ed:	ff 75 f4             	push   -0xc(%ebp)
+     7f0:	e8 fd 00 00 00       	call   8f2 <close>
+     7f5:	83 c4 10             	add    $0x10,%esp
+  return r;
+     7f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     7fb:	c9                   	leave
+     7fc:	c3                   	ret
+
+000007fd <atoi>:
+
+int
+atoi(const char *s)
+{
+     7fd:	55                   	push   %ebp
+     7fe:	89 e5                	mov    %esp,%ebp
+     800:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     803:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     80a:	eb 25                	jmp    831 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     80c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     80f:	89 d0                	mov    %edx,%eax
+     811:	c1 e0 02             	shl    $0x2,%eax
+     814:	01 d0                	add    %edx,%eax
+     816:	01 c0                	add    %eax,%eax
+     818:	89 c1                	mov    %eax,%ecx
+     81a:	8b 45 08             	mov    0x8(%ebp),%eax
+     81d:	8d 50 01             	lea    0x1(%eax),%edx
+     820:	89 55 08             	mov    %edx,0x8(%ebp)
+     823:	0f b6 00             	movzbl (%eax),%eax
+     826:	0f be c0             	movsbl %al,%eax
+     829:	01 c8                	add    %ecx,%eax
+     82b:	83 e8 30             	sub    $0x30,%eax
+     82e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     831:	8b 45 08             	mov    0x8(%ebp),%eax
+     834:	0f b6 00             	movzbl (%eax),%eax
+     837:	3c 2f                	cmp    $0x2f,%al
+     839:	7e 0a                	jle    845 <atoi+0x48>
+     83b:	8b 45 08             	mov    0x8(%ebp),%eax
+     83e:	0f b6 00             	movzbl (%eax),%eax
+     841:	3c 39                	cmp    $0x39,%al
+     843:	7e c7                	jle    80c <atoi+0xf>
+  return n;
+     845:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     848:	c9                   	leave
+     849:	c3                   	ret
+
+0000084a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     84a:	55                   	push   %ebp
+     84b:	89 e5                	mov    %esp,%ebp
+     84d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     850:	8b 45 08             	mov    0x8(%ebp),%eax
+     853:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     856:	8b 45 0c             	mov    0xc(%ebp),%eax
+     859:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     85c:	eb 17                	jmp    875 <memmove+0x2b>
+    *dst++ = *src++;
+     85e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     861:	8d 42 01             	lea    0x1(%edx),%eax
+     864:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     867:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     86a:	8d 48 01             	lea    0x1(%eax),%ecx
+     86d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     870:	0f b6 12             	movzbl (%edx),%edx
+     873:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     875:	8b 45 10             	mov    0x10(%ebp),%eax
+     878:	8d 50 ff             	lea    -0x1(%eax),%edx
+     87b:	89 55 10             	mov    %edx,0x10(%ebp)
+     87e:	85 c0                	test   %eax,%eax
+     880:	7f dc                	jg     85e <memmove+0x14>
+  return vdst;
+     882:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     885:	c9                   	leave
+     886:	c3                   	ret
+
+00000887 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     887:	83 3d 10 19 00 00 00 	cmpl   $0x0,0x1910
+  jg 2f
+     88e:	7f 2e                	jg     8be <dosyscall+0x37>
+  jl 1f
+     890:	7c 29                	jl     8bb <dosyscall+0x34>
+  pushl %eax
+     892:	50                   	push   %eax
+  pushl %ebx
+     893:	53                   	push   %ebx
+  movl $1, %eax
+     894:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     899:	0f a2                	cpuid
+  popl %ebx
+     89b:	5b                   	pop    %ebx
+  popl %eax
+     89c:	58                   	pop    %eax
+  movl $-1, sysmode
+     89d:	c7 05 10 19 00 00 ff 	movl   $0xffffffff,0x1910
+     8a4:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     8a7:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     8ad:	74 0c                	je     8bb <dosyscall+0x34>
+  movl $1, sysmode
+     8af:	c7 05 10 19 00 00 01 	movl   $0x1,0x1910
+     8b6:	00 00 00 
+  jmp 2f
+     8b9:	eb 03                	jmp    8be <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     8bb:	cd 40                	int    $0x40
+  ret
+     8bd:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     8be:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     8c0:	ba c7 08 00 00       	mov    $0x8c7,%edx
+  sysenter
+     8c5:	0f 34                	sysenter
+3:
+  ret
+     8c7:	c3                   	ret
+
+000008c8 <fork>:
+
+SYSCALL(fork)
+     8c8:	b8 01 00 00 00       	mov    $0x1,%eax
+     8cd:	eb b8                	jmp    887 <dosyscall>
+
+000008cf <exit>:
+SYSCALL(exit)
+     8cf:	b8 02 00 00 00       	mov    $0x2,%eax
+     8d4:	eb b1                	jmp    887 <dosyscall>
+
+000008d6 <wait>:
+SYSCALL(wait)
+     8d6:	b8 03 00 00 00       	mov    $0x3,%eax
+     8db:	eb aa                	jmp    887 <dosyscall>
+
+000008dd <pipe>:
+SYSCALL(pipe)
+     8dd:	b8 04 00 00 00       	mov    $0x4,%eax
+     8e2:	eb a3                	jmp    887 <dosyscall>
+
+000008e4 <read>:
+SYSCALL(read)
+     8e4:	b8 05 00 00 00       	mov    $0x5,%eax
+     8e9:	eb 9c                	jmp    887 <dosyscall>
+
+000008eb <write>:
+SYSCALL(write)
+     8eb:	b8 10 00 00 00       	mov    $0x10,%eax
+     8f0:	eb 95                	jmp    887 <dosyscall>
+
+000008f2 <close>:
+SYSCALL(close)
+     8f2:	b8 15 00 00 00       	mov    $0x15,%eax
+     8f7:	eb 8e                	jmp    887 <dosyscall>
+
+000008f9 <kill>:
+SYSCALL(kill)
+     8f9:	b8 06 00 00 00       	mov    $0x6,%eax
+     8fe:	eb 87                	jmp    887 <dosyscall>
+
+00000900 <exec>:
+SYSCALL(exec)
+     900:	b8 07 00 00 00       	mov    $0x7,%eax
+     905:	eb 80                	jmp    887 <dosyscall>
+
+00000907 <open>:
+SYSCALL(open)
+     907:	b8 0f 00 00 00       	mov    $0xf,%eax
+     90c:	e9 76 ff ff ff       	jmp    887 <dosyscall>
+
+00000911 <mknod>:
+SYSCALL(mknod)
+     911:	b8 11 00 00 00       	mov    $0x11,%eax
+     916:	e9 6c ff ff ff       	jmp    887 <dosyscall>
+
+0000091b <unlink>:
+SYSCALL(unlink)
+     91b:	b8 12 00 00 00       	mov    $0x12,%eax
+     920:	e9 62 ff ff ff       	jmp    887 <dosyscall>
+
+00000925 <fstat>:
+SYSCALL(fstat)
+     925:	b8 08 00 00 00       	mov    $0x8,%eax
+     92a:	e9 58 ff ff ff       	jmp    887 <dosyscall>
+
+0000092f <link>:
+SYSCALL(link)
+     92f:	b8 13 00 00 00       	mov    $0x13,%eax
+     934:	e9 4e ff ff ff       	jmp    887 <dosyscall>
+
+00000939 <mkdir>:
+SYSCALL(mkdir)
+     939:	b8 14 00 00 00       	mov    $0x14,%eax
+     93e:	e9 44 ff ff ff       	jmp    887 <dosyscall>
+
+00000943 <chdir>:
+SYSCALL(chdir)
+     943:	b8 09 00 00 00       	mov    $0x9,%eax
+     948:	e9 3a ff ff ff       	jmp    887 <dosyscall>
+
+0000094d <dup>:
+SYSCALL(dup)
+     94d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     952:	e9 30 ff ff ff       	jmp    887 <dosyscall>
+
+00000957 <getpid>:
+SYSCALL(getpid)
+     957:	b8 0b 00 00 00       	mov    $0xb,%eax
+     95c:	e9 26 ff ff ff       	jmp    887 <dosyscall>
+
+00000961 <sbrk>:
+SYSCALL(sbrk)
+     961:	b8 0c 00 00 00       	mov    $0xc,%eax
+     966:	e9 1c ff ff ff       	jmp    887 <dosyscall>
+
+0000096b <sleep>:
+SYSCALL(sleep)
+     96b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     970:	e9 12 ff ff ff       	jmp    887 <dosyscall>
+
+00000975 <uptime>:
+SYSCALL(uptime)
+     975:	b8 0e 00 00 00       	mov    $0xe,%eax
+     97a:	e9 08 ff ff ff       	jmp    887 <dosyscall>
+
+0000097f <symlink>:
+SYSCALL(symlink)
+     97f:	b8 16 00 00 00       	mov    $0x16,%eax
+     984:	e9 fe fe ff ff       	jmp    887 <dosyscall>
+
+00000989 <readlink>:
+SYSCALL(readlink)
+     989:	b8 17 00 00 00       	mov    $0x17,%eax
+     98e:	e9 f4 fe ff ff       	jmp    887 <dosyscall>
+
+00000993 <fprot>:
+SYSCALL(fprot)
+     993:	b8 18 00 00 00       	mov    $0x18,%eax
+     998:	e9 ea fe ff ff       	jmp    887 <dosyscall>
+
+0000099d <funprot>:
+SYSCALL(funprot)
+     99d:	b8 19 00 00 00       	mov    $0x19,%eax
+     9a2:	e9 e0 fe ff ff       	jmp    887 <dosyscall>
+
+000009a7 <funlock>:
+SYSCALL(funlock)
+     9a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9ac:	e9 d6 fe ff ff       	jmp    887 <dosyscall>
+
+000009b1 <mmap>:
+SYSCALL(mmap)
+     9b1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9b6:	e9 cc fe ff ff       	jmp    887 <dosyscall>
+
+000009bb <munmap>:
+SYSCALL(munmap)
+     9bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9c0:	e9 c2 fe ff ff       	jmp    887 <dosyscall>
+
+000009c5 <sendfile>:
+SYSCALL(sendfile)
+     9c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9ca:	e9 b8 fe ff ff       	jmp    887 <dosyscall>
+
+000009cf <readv>:
+SYSCALL(readv)
+     9cf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9d4:	e9 ae fe ff ff       	jmp    887 <dosyscall>
+
+000009d9 <writev>:
+SYSCALL(writev)
+     9d9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9de:	e9 a4 fe ff ff       	jmp    887 <dosyscall>
+
+000009e3 <pread>:
+SYSCALL(pread)
+     9e3:	b8 20 00 00 00       	mov    $0x20,%eax
+     9e8:	e9 9a fe ff ff       	jmp    887 <dosyscall>
+
+000009ed <pwrite>:
+SYSCALL(pwrite)
+     9ed:	b8 21 00 00 00       	mov    $0x21,%eax
+     9f2:	e9 90 fe ff ff       	jmp    887 <dosyscall>
+
+000009f7 <lseek>:
+SYSCALL(lseek)
+     9f7:	b8 22 00 00 00       	mov    $0x22,%eax
+     9fc:	e9 86 fe ff ff       	jmp    887 <dosyscall>
+
+00000a01 <spawn>:
+SYSCALL(spawn)
+     a01:	b8 23 00 00 00       	mov    $0x23,%eax
+     a06:	e9 7c fe ff ff       	jmp    887 <dosyscall>
+
+00000a0b <setpriority>:
+SYSCALL(setpriority)
+     a0b:	b8 24 00 00 00       	mov    $0x24,%eax
+     a10:	e9 72 fe ff ff       	jmp    887 <dosyscall>
+
+00000a15 <kthread_create>:
+SYSCALL(kthread_create)
+     a15:	b8 25 00 00 00       	mov    $0x25,%eax
+     a1a:	e9 68 fe ff ff       	jmp    887 <dosyscall>
+
+00000a1f <kthread_id>:
+SYSCALL(kthread_id)
+     a1f:	b8 26 00 00 00       	mov    $0x26,%eax
+     a24:	e9 5e fe ff ff       	jmp    887 <dosyscall>
+
+00000a29 <kthread_exit>:
+SYSCALL(kthread_exit)
+     a29:	b8 27 00 00 00       	mov    $0x27,%eax
+     a2e:	e9 54 fe ff ff       	jmp    887 <dosyscall>
+
+00000a33 <kthread_join>:
+SYSCALL(kthread_join)
+     a33:	b8 28 00 00 00       	mov    $0x28,%eax
+     a38:	e9 4a fe ff ff       	jmp    887 <dosyscall>
+
+00000a3d <futex>:
+SYSCALL(futex)
+     a3d:	b8 29 00 00 00       	mov    $0x29,%eax
+     a42:	e9 40 fe ff ff       	jmp    887 <dosyscall>
+
+00000a47 <signal>:
+SYSCALL(signal)
+     a47:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a4c:	e9 36 fe ff ff       	jmp    887 <dosyscall>
+
+00000a51 <alarm>:
+SYSCALL(alarm)
+     a51:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a56:	e9 2c fe ff ff       	jmp    887 <dosyscall>
+
+00000a5b <usleep>:
+SYSCALL(usleep)
+     a5b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a60:	e9 22 fe ff ff       	jmp    887 <dosyscall>
+
+00000a65 <ioring_setup>:
+SYSCALL(ioring_setup)
+     a65:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a6a:	e9 18 fe ff ff       	jmp    887 <dosyscall>
+
+00000a6f <ioring_enter>:
+SYSCALL(ioring_enter)
+     a6f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a74:	e9 0e fe ff ff       	jmp    887 <dosyscall>
+
+00000a79 <getrusage>:
+SYSCALL(getrusage)
+     a79:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a7e:	e9 04 fe ff ff       	jmp    887 <dosyscall>
+
+00000a83 <mount>:
+SYSCALL(mount)
+     a83:	b8 30 00 00 00       	mov    $0x30,%eax
+     a88:	e9 fa fd ff ff       	jmp    887 <dosyscall>
+
+00000a8d <getdents>:
+SYSCALL(getdents)
+     a8d:	b8 31 00 00 00       	mov    $0x31,%eax
+     a92:	e9 f0 fd ff ff       	jmp    887 <dosyscall>
+
+00000a97 <yield>:
+SYSCALL(yield)
+     a97:	b8 32 00 00 00       	mov    $0x32,%eax
+     a9c:	e9 e6 fd ff ff       	jmp    887 <dosyscall>
+
+00000aa1 <ncpu>:
+SYSCALL(ncpu)
+     aa1:	b8 33 00 00 00       	mov    $0x33,%eax
+     aa6:	e9 dc fd ff ff       	jmp    887 <dosyscall>
+
+00000aab <fallocate>:
+SYSCALL(fallocate)
+     aab:	b8 34 00 00 00       	mov    $0x34,%eax
+     ab0:	e9 d2 fd ff ff       	jmp    887 <dosyscall>
+
+00000ab5 <ftruncate>:
+SYSCALL(ftruncate)
+     ab5:	b8 35 00 00 00       	mov    $0x35,%eax
+     aba:	e9 c8 fd ff ff       	jmp    887 <dosyscall>
+
+00000abf <fsync>:
+SYSCALL(fsync)
+     abf:	b8 36 00 00 00       	mov    $0x36,%eax
+     ac4:	e9 be fd ff ff       	jmp    887 <dosyscall>
+
+00000ac9 <fdatasync>:
+SYSCALL(fdatasync)
+     ac9:	b8 37 00 00 00       	mov    $0x37,%eax
+     ace:	e9 b4 fd ff ff       	jmp    887 <dosyscall>
+
+00000ad3 <poll>:
+SYSCALL(poll)
+     ad3:	b8 38 00 00 00       	mov    $0x38,%eax
+     ad8:	e9 aa fd ff ff       	jmp    887 <dosyscall>
+
+00000add <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     add:	55                   	push   %ebp
+     ade:	89 e5                	mov    %esp,%ebp
+     ae0:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae6:	8b 40 04             	mov    0x4(%eax),%eax
+     ae9:	85 c0                	test   %eax,%eax
+     aeb:	7e 1f                	jle    b0c <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     aed:	8b 45 08             	mov    0x8(%ebp),%eax
+     af0:	8b 50 04             	mov    0x4(%eax),%edx
+     af3:	8b 45 08             	mov    0x8(%ebp),%eax
+     af6:	8d 48 08             	lea    0x8(%eax),%ecx
+     af9:	8b 45 08             	mov    0x8(%ebp),%eax
+     afc:	8b 00                	mov    (%eax),%eax
+     afe:	83 ec 04             	sub    $0x4,%esp
+     b01:	52                   	push   %edx
+     b02:	51                   	push   %ecx
+     b03:	50                   	push   %eax
+     b04:	e8 d0 fe ff ff       	call   9d9 <writev>
+     b09:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b0f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     b16:	8b 45 08             	mov    0x8(%ebp),%eax
+     b19:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     b20:	00 00 00 
+}
+     b23:	90                   	nop
+     b24:	c9                   	leave
+     b25:	c3                   	ret
+
+00000b26 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     b26:	55                   	push   %ebp
+     b27:	89 e5                	mov    %esp,%ebp
+     b29:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     b2c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     b30:	0f 84 94 00 00 00    	je     bca <put+0xa4>
+    return;
+  if(o->n > 0){
+     b36:	8b 45 08             	mov    0x8(%ebp),%eax
+     b39:	8b 40 04             	mov    0x4(%eax),%eax
+     b3c:	85 c0                	test   %eax,%eax
+     b3e:	7e 40                	jle    b80 <put+0x5a>
+    v = &o->iov[o->n-1];
+     b40:	8b 45 08             	mov    0x8(%ebp),%eax
+     b43:	8b 40 04             	mov    0x4(%eax),%eax
+     b46:	83 e8 01             	sub    $0x1,%eax
+     b49:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     b50:	8b 45 08             	mov    0x8(%ebp),%eax
+     b53:	01 d0                	add    %edx,%eax
+     b55:	83 c0 08             	add    $0x8,%eax
+     b58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     b5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b5e:	8b 10                	mov    (%eax),%edx
+     b60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b63:	8b 40 04             	mov    0x4(%eax),%eax
+     b66:	01 d0                	add    %edx,%eax
+     b68:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     b6b:	75 13                	jne    b80 <put+0x5a>
+      v->iov_len += n;
+     b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b70:	8b 50 04             	mov    0x4(%eax),%edx
+     b73:	8b 45 10             	mov    0x10(%ebp),%eax
+     b76:	01 c2                	add    %eax,%edx
+     b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b7b:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     b7e:	eb 4b                	jmp    bcb <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     b80:	8b 45 08             	mov    0x8(%ebp),%eax
+     b83:	8b 40 04             	mov    0x4(%eax),%eax
+     b86:	83 f8 10             	cmp    $0x10,%eax
+     b89:	75 0e                	jne    b99 <put+0x73>
+    flush(o);
+     b8b:	83 ec 0c             	sub    $0xc,%esp
+     b8e:	ff 75 08             	push   0x8(%ebp)
+     b91:	e8 47 ff ff ff       	call   add <flush>
+     b96:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     b99:	8b 45 08             	mov    0x8(%ebp),%eax
+     b9c:	8b 50 04             	mov    0x4(%eax),%edx
+     b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ba5:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bac:	8b 50 04             	mov    0x4(%eax),%edx
+     baf:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     bb5:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbc:	8b 40 04             	mov    0x4(%eax),%eax
+     bbf:	8d 50 01             	lea    0x1(%eax),%edx
+     bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc5:	89 50 04             	mov    %edx,0x4(%eax)
+     bc8:	eb 01                	jmp    bcb <put+0xa5>
+    return;
+     bca:	90                   	nop
+}
+     bcb:	c9                   	leave
+     bcc:	c3                   	ret
+
+00000bcd <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     bcd:	55                   	push   %ebp
+     bce:	89 e5                	mov    %esp,%ebp
+     bd0:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd6:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bdf:	01 d0                	add    %edx,%eax
+     be1:	3d 80 00 00 00       	cmp    $0x80,%eax
+     be6:	77 0b                	ja     bf3 <room+0x26>
+     be8:	8b 45 08             	mov    0x8(%ebp),%eax
+     beb:	8b 40 04             	mov    0x4(%eax),%eax
+     bee:	83 f8 10             	cmp    $0x10,%eax
+     bf1:	75 0e                	jne    c01 <room+0x34>
+    flush(o);
+     bf3:	83 ec 0c             	sub    $0xc,%esp
+     bf6:	ff 75 08             	push   0x8(%ebp)
+     bf9:	e8 df fe ff ff       	call   add <flush>
+     bfe:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     c01:	8b 45 08             	mov    0x8(%ebp),%eax
+     c04:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     c13:	01 d0                	add    %edx,%eax
+}
+     c15:	c9                   	leave
+     c16:	c3                   	ret
+
+00000c17 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     c17:	55                   	push   %ebp
+     c18:	89 e5                	mov    %esp,%ebp
+     c1a:	83 ec 28             	sub    $0x28,%esp
+     c1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c20:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     c23:	83 ec 08             	sub    $0x8,%esp
+     c26:	6a 01                	push   $0x1
+     c28:	ff 75 08             	push   0x8(%ebp)
+     c2b:	e8 9d ff ff ff       	call   bcd <room>
+     c30:	83 c4 10             	add    $0x10,%esp
+     c33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c39:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     c3d:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c42:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     c48:	8d 50 01             	lea    0x1(%eax),%edx
+     c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c4e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     c54:	83 ec 04             	sub    $0x4,%esp
+     c57:	6a 01                	push   $0x1
+     c59:	ff 75 f4             	push   -0xc(%ebp)
+     c5c:	ff 75 08             	push   0x8(%ebp)
+     c5f:	e8 c2 fe ff ff       	call   b26 <put>
+     c64:	83 c4 10             	add    $0x10,%esp
+}
+     c67:	90                   	nop
+     c68:	c9                   	leave
+     c69:	c3                   	ret
+
+00000c6a <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c6a:	55                   	push   %ebp
+     c6b:	89 e5                	mov    %esp,%ebp
+     c6d:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     c70:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     c77:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     c7b:	74 17                	je     c94 <printint+0x2a>
+     c7d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c81:	79 11                	jns    c94 <printint+0x2a>
+    neg = 1;
+     c83:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c8d:	f7 d8                	neg    %eax
+     c8f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c92:	eb 06                	jmp    c9a <printint+0x30>
+  } else {
+    x = xx;
+     c94:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     c9a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     ca1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ca4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ca7:	ba 00 00 00 00       	mov    $0x0,%edx
+     cac:	f7 f1                	div    %ecx
+     cae:	89 d1                	mov    %edx,%ecx
+     cb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cb3:	8d 50 01             	lea    0x1(%eax),%edx
+     cb6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cb9:	0f b6 91 14 19 00 00 	movzbl 0x1914(%ecx),%edx
+     cc0:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     cc4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     cc7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cca:	ba 00 00 00 00       	mov    $0x0,%edx
+     ccf:	f7 f1                	div    %ecx
+     cd1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     cd4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     cd8:	75 c7                	jne    ca1 <printint+0x37>
+  if(neg)
+     cda:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cde:	74 0e                	je     cee <printint+0x84>
+    buf[i++] = '-';
+     ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ce3:	8d 50 01             	lea    0x1(%eax),%edx
+     ce6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ce9:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     cee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cf1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     cf4:	83 ec 08             	sub    $0x8,%esp
+     cf7:	ff 75 e8             	push   -0x18(%ebp)
+     cfa:	ff 75 08             	push   0x8(%ebp)
+     cfd:	e8 cb fe ff ff       	call   bcd <room>
+     d02:	83 c4 10             	add    $0x10,%esp
+     d05:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     d08:	eb 1d                	jmp    d27 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     d0a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d0d:	83 e8 01             	sub    $0x1,%eax
+     d10:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     d13:	89 c2                	mov    %eax,%edx
+     d15:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d18:	01 c2                	add    %eax,%edx
+     d1a:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d20:	01 c8                	add    %ecx,%eax
+     d22:	0f b6 00             	movzbl (%eax),%eax
+     d25:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     d27:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     d2b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d2f:	79 d9                	jns    d0a <printint+0xa0>
+  o->used += n;
+     d31:	8b 45 08             	mov    0x8(%ebp),%eax
+     d34:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     d3a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d3d:	01 c2                	add    %eax,%edx
+     d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d42:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     d48:	83 ec 04             	sub    $0x4,%esp
+     d4b:	ff 75 e8             	push   -0x18(%ebp)
+     d4e:	ff 75 e4             	push   -0x1c(%ebp)
+     d51:	ff 75 08             	push   0x8(%ebp)
+     d54:	e8 cd fd ff ff       	call   b26 <put>
+     d59:	83 c4 10             	add    $0x10,%esp
+}
+     d5c:	90                   	nop
+     d5d:	c9                   	leave
+     d5e:	c3                   	ret
+
+00000d5f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     d5f:	55                   	push   %ebp
+     d60:	89 e5                	mov    %esp,%ebp
+     d62:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     d68:	8b 45 08             	mov    0x8(%ebp),%eax
+     d6b:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     d71:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     d78:	00 00 00 
+  o.used = 0;
+     d7b:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     d82:	00 00 00 
+  state = 0;
+     d85:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     d8c:	8d 45 0c             	lea    0xc(%ebp),%eax
+     d8f:	83 c0 04             	add    $0x4,%eax
+     d92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     d95:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d9c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     da3:	e9 82 01 00 00       	jmp    f2a <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     da8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     dab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dae:	01 d0                	add    %edx,%eax
+     db0:	0f b6 00             	movzbl (%eax),%eax
+     db3:	0f be c0             	movsbl %al,%eax
+     db6:	25 ff 00 00 00       	and    $0xff,%eax
+     dbb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     dbe:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     dc2:	75 38                	jne    dfc <printf+0x9d>
+      if(c == '%'){
+     dc4:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     dc8:	0f 85 58 01 00 00    	jne    f26 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     dce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dd1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     dd7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     dda:	01 ca                	add    %ecx,%edx
+     ddc:	83 ec 04             	sub    $0x4,%esp
+     ddf:	50                   	push   %eax
+     de0:	52                   	push   %edx
+     de1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     de7:	50                   	push   %eax
+     de8:	e8 39 fd ff ff       	call   b26 <put>
+     ded:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     df0:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     df7:	e9 2a 01 00 00       	jmp    f26 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     dfc:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     e00:	0f 85 20 01 00 00    	jne    f26 <printf+0x1c7>
+      if(c == 'd'){
+     e06:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     e0a:	75 22                	jne    e2e <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     e0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e0f:	8b 00                	mov    (%eax),%eax
+     e11:	6a 01                	push   $0x1
+     e13:	6a 0a                	push   $0xa
+     e15:	50                   	push   %eax
+     e16:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e1c:	50                   	push   %eax
+     e1d:	e8 48 fe ff ff       	call   c6a <printint>
+     e22:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e25:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     e29:	e9 e8 00 00 00       	jmp    f16 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     e2e:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     e32:	74 06                	je     e3a <printf+0xdb>
+     e34:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     e38:	75 22                	jne    e5c <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     e3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e3d:	8b 00                	mov    (%eax),%eax
+     e3f:	6a 00                	push   $0x0
+     e41:	6a 10                	push   $0x10
+     e43:	50                   	push   %eax
+     e44:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e4a:	50                   	push   %eax
+     e4b:	e8 1a fe ff ff       	call   c6a <printint>
+     e50:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e53:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     e57:	e9 ba 00 00 00       	jmp    f16 <printf+0x1b7>
+      } else if(c == 's'){
+     e5c:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     e60:	75 3f                	jne    ea1 <printf+0x142>
+        s = (char*)*ap;
+     e62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e65:	8b 00                	mov    (%eax),%eax
+     e67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     e6a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     e6e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e72:	75 07                	jne    e7b <printf+0x11c>
+          s = "(null)";
+     e74:	c7 45 f4 40 15 00 00 	movl   $0x1540,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     e7b:	83 ec 0c             	sub    $0xc,%esp
+     e7e:	ff 75 f4             	push   -0xc(%ebp)
+     e81:	e8 47 f8 ff ff       	call   6cd <strlen>
+     e86:	83 c4 10             	add    $0x10,%esp
+     e89:	83 ec 04             	sub    $0x4,%esp
+     e8c:	50                   	push   %eax
+     e8d:	ff 75 f4             	push   -0xc(%ebp)
+     e90:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     e96:	50                   	push   %eax
+     e97:	e8 8a fc ff ff       	call   b26 <put>
+     e9c:	83 c4 10             	add    $0x10,%esp
+     e9f:	eb 75                	jmp    f16 <printf+0x1b7>
+      } else if(c == 'c'){
+     ea1:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     ea5:	75 21                	jne    ec8 <printf+0x169>
+        putc(&o, *ap);
+     ea7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     eaa:	8b 00                	mov    (%eax),%eax
+     eac:	0f be c0             	movsbl %al,%eax
+     eaf:	83 ec 08             	sub    $0x8,%esp
+     eb2:	50                   	push   %eax
+     eb3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     eb9:	50                   	push   %eax
+     eba:	e8 58 fd ff ff       	call   c17 <putc>
+     ebf:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ec2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     ec6:	eb 4e                	jmp    f16 <printf+0x1b7>
+      } else if(c == '%'){
+     ec8:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     ecc:	75 1b                	jne    ee9 <printf+0x18a>
+        putc(&o, c);
+     ece:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ed1:	0f be c0             	movsbl %al,%eax
+     ed4:	83 ec 08             	sub    $0x8,%esp
+     ed7:	50                   	push   %eax
+     ed8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ede:	50                   	push   %eax
+     edf:	e8 33 fd ff ff       	call   c17 <putc>
+     ee4:	83 c4 10             	add    $0x10,%esp
+     ee7:	eb 2d                	jmp    f16 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     ee9:	83 ec 08             	sub    $0x8,%esp
+     eec:	6a 25                	push   $0x25
+     eee:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ef4:	50                   	push   %eax
+     ef5:	e8 1d fd ff ff       	call   c17 <putc>
+     efa:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     efd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     f00:	0f be c0             	movsbl %al,%eax
+     f03:	83 ec 08             	sub    $0x8,%esp
+     f06:	50                   	push   %eax
+     f07:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     f0d:	50                   	push   %eax
+     f0e:	e8 04 fd ff ff       	call   c17 <putc>
+     f13:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     f16:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     f1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f20:	83 c0 01             	add    $0x1,%eax
+     f23:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     f26:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     f2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f2d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f30:	01 d0                	add    %edx,%eax
+     f32:	0f b6 00             	movzbl (%eax),%eax
+     f35:	84 c0                	test   %al,%al
+     f37:	0f 85 6b fe ff ff    	jne    da8 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     f3d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     f41:	75 22                	jne    f65 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     f43:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f46:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     f4c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f4f:	01 ca                	add    %ecx,%edx
+     f51:	83 ec 04             	sub    $0x4,%esp
+     f54:	50                   	push   %eax
+     f55:	52                   	push   %edx
+     f56:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     f5c:	50                   	push   %eax
+     f5d:	e8 c4 fb ff ff       	call   b26 <put>
+     f62:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     f65:	83 ec 0c             	sub    $0xc,%esp
+     f68:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     f6e:	50                   	push   %eax
+     f6f:	e8 69 fb ff ff       	call   add <flush>
+     f74:	83 c4 10             	add    $0x10,%esp
+}
+     f77:	90                   	nop
+     f78:	c9                   	leave
+     f79:	c3                   	ret
+
+00000f7a <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     f7a:	55                   	push   %ebp
+     f7b:	89 e5                	mov    %esp,%ebp
+     f7d:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     f80:	8b 55 08             	mov    0x8(%ebp),%edx
+     f83:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f89:	f0 87 02             	lock xchg %eax,(%edx)
+     f8c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     f8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     f92:	c9                   	leave
+     f93:	c3                   	ret
+
+00000f94 <lock>:
+{
+     f94:	55                   	push   %ebp
+     f95:	89 e5                	mov    %esp,%ebp
+     f97:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     f9a:	a1 60 39 00 00       	mov    0x3960,%eax
+     f9f:	85 c0                	test   %eax,%eax
+     fa1:	74 09                	je     fac <lock+0x18>
+     fa3:	a1 60 39 00 00       	mov    0x3960,%eax
+     fa8:	ff d0                	call   *%eax
+     faa:	eb 05                	jmp    fb1 <lock+0x1d>
+     fac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fb1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     fb4:	90                   	nop
+     fb5:	83 ec 08             	sub    $0x8,%esp
+     fb8:	6a 01                	push   $0x1
+     fba:	68 98 39 00 00       	push   $0x3998
+     fbf:	e8 b6 ff ff ff       	call   f7a <xchg>
+     fc4:	83 c4 10             	add    $0x10,%esp
+     fc7:	85 c0                	test   %eax,%eax
+     fc9:	75 ea                	jne    fb5 <lock+0x21>
+  return pin;
+     fcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     fce:	c9                   	leave
+     fcf:	c3                   	ret
+
+00000fd0 <unlock>:
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     fd6:	6a 00                	push   $0x0
+     fd8:	68 98 39 00 00       	push   $0x3998
+     fdd:	e8 98 ff ff ff       	call   f7a <xchg>
+     fe2:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     fe5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fe9:	78 10                	js     ffb <unlock+0x2b>
+    mallocunpin(pin);
+     feb:	a1 64 39 00 00       	mov    0x3964,%eax
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	ff 75 08             	push   0x8(%ebp)
+     ff6:	ff d0                	call   *%eax
+     ff8:	83 c4 10             	add    $0x10,%esp
+}
+     ffb:	90                   	nop
+     ffc:	c9                   	leave
+     ffd:	c3                   	ret
+
+00000ffe <sizeclass>:
+{
+     ffe:	55                   	push   %ebp
+     fff:	89 e5                	mov    %esp,%ebp
+    1001:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+    1004:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    100b:	eb 1c                	jmp    1029 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+    100d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1010:	ba 02 00 00 00       	mov    $0x2,%edx
+    1015:	89 c1                	mov    %eax,%ecx
+    1017:	d3 e2                	shl    %cl,%edx
+    1019:	89 d0                	mov    %edx,%eax
+    101b:	3b 45 08             	cmp    0x8(%ebp),%eax
+    101e:	72 05                	jb     1025 <sizeclass+0x27>
+      return c;
+    1020:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1023:	eb 0f                	jmp    1034 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+    1025:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1029:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+    102d:	7e de                	jle    100d <sizeclass+0xf>
+  return -1;
+    102f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1034:	c9                   	leave
+    1035:	c3                   	ret
+
+00001036 <bigfree>:
+{
+    1036:	55                   	push   %ebp
+    1037:	89 e5                	mov    %esp,%ebp
+    1039:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    103c:	a1 70 39 00 00       	mov    0x3970,%eax
+    1041:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1044:	eb 24                	jmp    106a <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1046:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1049:	8b 00                	mov    (%eax),%eax
+    104b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    104e:	72 12                	jb     1062 <bigfree+0x2c>
+    1050:	8b 45 08             	mov    0x8(%ebp),%eax
+    1053:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1056:	72 24                	jb     107c <bigfree+0x46>
+    1058:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    105b:	8b 00                	mov    (%eax),%eax
+    105d:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1060:	72 1a                	jb     107c <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1062:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1065:	8b 00                	mov    (%eax),%eax
+    1067:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    106a:	8b 45 08             	mov    0x8(%ebp),%eax
+    106d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1070:	73 d4                	jae    1046 <bigfree+0x10>
+    1072:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1075:	8b 00                	mov    (%eax),%eax
+    1077:	39 45 08             	cmp    %eax,0x8(%ebp)
+    107a:	73 ca                	jae    1046 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+    107c:	8b 45 08             	mov    0x8(%ebp),%eax
+    107f:	8b 40 04             	mov    0x4(%eax),%eax
+    1082:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1089:	8b 45 08             	mov    0x8(%ebp),%eax
+    108c:	01 c2                	add    %eax,%edx
+    108e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1091:	8b 00                	mov    (%eax),%eax
+    1093:	39 c2                	cmp    %eax,%edx
+    1095:	75 24                	jne    10bb <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+    1097:	8b 45 08             	mov    0x8(%ebp),%eax
+    109a:	8b 50 04             	mov    0x4(%eax),%edx
+    109d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10a0:	8b 00                	mov    (%eax),%eax
+    10a2:	8b 40 04             	mov    0x4(%eax),%eax
+    10a5:	01 c2                	add    %eax,%edx
+    10a7:	8b 45 08             	mov    0x8(%ebp),%eax
+    10aa:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10b0:	8b 00                	mov    (%eax),%eax
+    10b2:	8b 10                	mov    (%eax),%edx
+    10b4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10b7:	89 10                	mov    %edx,(%eax)
+    10b9:	eb 0a                	jmp    10c5 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+    10bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10be:	8b 10                	mov    (%eax),%edx
+    10c0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c3:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    10c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10c8:	8b 40 04             	mov    0x4(%eax),%eax
+    10cb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    10d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10d5:	01 d0                	add    %edx,%eax
+    10d7:	39 45 08             	cmp    %eax,0x8(%ebp)
+    10da:	75 20                	jne    10fc <bigfree+0xc6>
+    p->s.size += bp->s.size;
+    10dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10df:	8b 50 04             	mov    0x4(%eax),%edx
+    10e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e5:	8b 40 04             	mov    0x4(%eax),%eax
+    10e8:	01 c2                	add    %eax,%edx
+    10ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10ed:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    10f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f3:	8b 10                	mov    (%eax),%edx
+    10f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10f8:	89 10                	mov    %edx,(%eax)
+    10fa:	eb 08                	jmp    1104 <bigfree+0xce>
+    p->s.ptr = bp;
+    10fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10ff:	8b 55 08             	mov    0x8(%ebp),%edx
+    1102:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    1104:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1107:	a3 70 39 00 00       	mov    %eax,0x3970
+}
+    110c:	90                   	nop
+    110d:	c9                   	leave
+    110e:	c3                   	ret
+
+0000110f <free>:
+{
+    110f:	55                   	push   %ebp
+    1110:	89 e5                	mov    %esp,%ebp
+    1112:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+    1115:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1119:	74 68                	je     1183 <free+0x74>
+  bp = (Header*)ap - 1;
+    111b:	8b 45 08             	mov    0x8(%ebp),%eax
+    111e:	83 e8 08             	sub    $0x8,%eax
+    1121:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+    1124:	e8 6b fe ff ff       	call   f94 <lock>
+    1129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+    112c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    112f:	8b 40 04             	mov    0x4(%eax),%eax
+    1132:	83 ec 0c             	sub    $0xc,%esp
+    1135:	50                   	push   %eax
+    1136:	e8 c3 fe ff ff       	call   ffe <sizeclass>
+    113b:	83 c4 10             	add    $0x10,%esp
+    113e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1141:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1145:	78 1e                	js     1165 <free+0x56>
+    bp->s.ptr = classfree[c];
+    1147:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    114a:	8b 14 85 74 39 00 00 	mov    0x3974(,%eax,4),%edx
+    1151:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1154:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+    1156:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1159:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    115c:	89 14 85 74 39 00 00 	mov    %edx,0x3974(,%eax,4)
+    1163:	eb 0e                	jmp    1173 <free+0x64>
+    bigfree(bp);
+    1165:	83 ec 0c             	sub    $0xc,%esp
+    1168:	ff 75 f4             	push   -0xc(%ebp)
+    116b:	e8 c6 fe ff ff       	call   1036 <bigfree>
+    1170:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+    1173:	83 ec 0c             	sub    $0xc,%esp
+    1176:	ff 75 f0             	push   -0x10(%ebp)
+    1179:	e8 52 fe ff ff       	call   fd0 <unlock>
+    117e:	83 c4 10             	add    $0x10,%esp
+    1181:	eb 01                	jmp    1184 <free+0x75>
+    return;
+    1183:	90                   	nop
+}
+    1184:	c9                   	leave
+    1185:	c3                   	ret
+
+00001186 <morecore>:
+{
+    1186:	55                   	push   %ebp
+    1187:	89 e5                	mov    %esp,%ebp
+    1189:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    118c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1193:	77 07                	ja     119c <morecore+0x16>
+    nu = 4096;
+    1195:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    119c:	8b 45 08             	mov    0x8(%ebp),%eax
+    119f:	c1 e0 03             	shl    $0x3,%eax
+    11a2:	83 ec 0c             	sub    $0xc,%esp
+    11a5:	50                   	push   %eax
+    11a6:	e8 b6 f7 ff ff       	call   961 <sbrk>
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    11b1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    11b5:	75 07                	jne    11be <morecore+0x38>
+    return 0;
+    11b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11bc:	eb 22                	jmp    11e0 <morecore+0x5a>
+  hp = (Header*)p;
+    11be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    11c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11c7:	8b 55 08             	mov    0x8(%ebp),%edx
+    11ca:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    11cd:	83 ec 0c             	sub    $0xc,%esp
+    11d0:	ff 75 f0             	push   -0x10(%ebp)
+    11d3:	e8 5e fe ff ff       	call   1036 <bigfree>
+    11d8:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    11db:	a1 70 39 00 00       	mov    0x3970,%eax
+}
+    11e0:	c9                   	leave
+    11e1:	c3                   	ret
+
+000011e2 <bigalloc>:
+{
+    11e2:	55                   	push   %ebp
+    11e3:	89 e5                	mov    %esp,%ebp
+    11e5:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    11e8:	a1 70 39 00 00       	mov    0x3970,%eax
+    11ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11f0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11f4:	75 23                	jne    1219 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    11f6:	c7 45 f0 68 39 00 00 	movl   $0x3968,-0x10(%ebp)
+    11fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1200:	a3 70 39 00 00       	mov    %eax,0x3970
+    1205:	a1 70 39 00 00       	mov    0x3970,%eax
+    120a:	a3 68 39 00 00       	mov    %eax,0x3968
+    base.s.size = 0;
+    120f:	c7 05 6c 39 00 00 00 	movl   $0x0,0x396c
+    1216:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1219:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    121c:	8b 00                	mov    (%eax),%eax
+    121e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1224:	8b 40 04             	mov    0x4(%eax),%eax
+    1227:	3b 45 08             	cmp    0x8(%ebp),%eax
+    122a:	72 4a                	jb     1276 <bigalloc+0x94>
+      if(p->s.size == nunits)
+    122c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122f:	8b 40 04             	mov    0x4(%eax),%eax
+    1232:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1235:	75 0c                	jne    1243 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    1237:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123a:	8b 10                	mov    (%eax),%edx
+    123c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    123f:	89 10                	mov    %edx,(%eax)
+    1241:	eb 26                	jmp    1269 <bigalloc+0x87>
+        p->s.size -= nunits;
+    1243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1246:	8b 40 04             	mov    0x4(%eax),%eax
+    1249:	2b 45 08             	sub    0x8(%ebp),%eax
+    124c:	89 c2                	mov    %eax,%edx
+    124e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1251:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1257:	8b 40 04             	mov    0x4(%eax),%eax
+    125a:	c1 e0 03             	shl    $0x3,%eax
+    125d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1260:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1263:	8b 55 08             	mov    0x8(%ebp),%edx
+    1266:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    1269:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    126c:	a3 70 39 00 00       	mov    %eax,0x3970
+      return p;
+    1271:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1274:	eb 3b                	jmp    12b1 <bigalloc+0xcf>
+    if(p == freep)
+    1276:	a1 70 39 00 00       	mov    0x3970,%eax
+    127b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    127e:	75 1e                	jne    129e <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	ff 75 08             	push   0x8(%ebp)
+    1286:	e8 fb fe ff ff       	call   1186 <morecore>
+    128b:	83 c4 10             	add    $0x10,%esp
+    128e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1291:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1295:	75 07                	jne    129e <bigalloc+0xbc>
+        return 0;
+    1297:	b8 00 00 00 00       	mov    $0x0,%eax
+    129c:	eb 13                	jmp    12b1 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    129e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12a1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12a7:	8b 00                	mov    (%eax),%eax
+    12a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    12ac:	e9 70 ff ff ff       	jmp    1221 <bigalloc+0x3f>
+}
+    12b1:	c9                   	leave
+    12b2:	c3                   	ret
+
+000012b3 <alloc>:
+alloc(uint nbytes)
+{
+    12b3:	55                   	push   %ebp
+    12b4:	89 e5                	mov    %esp,%ebp
+    12b6:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    12b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    12bc:	83 c0 07             	add    $0x7,%eax
+    12bf:	c1 e8 03             	shr    $0x3,%eax
+    12c2:	83 c0 01             	add    $0x1,%eax
+    12c5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    12c8:	ff 75 f4             	push   -0xc(%ebp)
+    12cb:	e8 2e fd ff ff       	call   ffe <sizeclass>
+    12d0:	83 c4 04             	add    $0x4,%esp
+    12d3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12d6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12da:	79 2c                	jns    1308 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    12dc:	83 ec 0c             	sub    $0xc,%esp
+    12df:	ff 75 f4             	push   -0xc(%ebp)
+    12e2:	e8 fb fe ff ff       	call   11e2 <bigalloc>
+    12e7:	83 c4 10             	add    $0x10,%esp
+    12ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    12ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    12f1:	75 0a                	jne    12fd <alloc+0x4a>
+      return 0;
+    12f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f8:	e9 c8 00 00 00       	jmp    13c5 <alloc+0x112>
+    return (void*)(p + 1);
+    12fd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1300:	83 c0 08             	add    $0x8,%eax
+    1303:	e9 bd 00 00 00       	jmp    13c5 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1308:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    130b:	8b 04 85 74 39 00 00 	mov    0x3974(,%eax,4),%eax
+    1312:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1315:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1319:	74 1a                	je     1335 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    131b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    131e:	8b 10                	mov    (%eax),%edx
+    1320:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1323:	89 14 85 74 39 00 00 	mov    %edx,0x3974(,%eax,4)
+    return (void*)(p + 1);
+    132a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    132d:	83 c0 08             	add    $0x8,%eax
+    1330:	e9 90 00 00 00       	jmp    13c5 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1335:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1338:	ba 02 00 00 00       	mov    $0x2,%edx
+    133d:	89 c1                	mov    %eax,%ecx
+    133f:	d3 e2                	shl    %cl,%edx
+    1341:	89 d0                	mov    %edx,%eax
+    1343:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    1346:	a1 90 39 00 00       	mov    0x3990,%eax
+    134b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    134e:	c1 e2 03             	shl    $0x3,%edx
+    1351:	01 d0                	add    %edx,%eax
+    1353:	8b 15 94 39 00 00    	mov    0x3994,%edx
+    1359:	39 c2                	cmp    %eax,%edx
+    135b:	73 3f                	jae    139c <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    135d:	83 ec 0c             	sub    $0xc,%esp
+    1360:	68 00 08 00 00       	push   $0x800
+    1365:	e8 78 fe ff ff       	call   11e2 <bigalloc>
+    136a:	83 c4 10             	add    $0x10,%esp
+    136d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1370:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1374:	75 07                	jne    137d <alloc+0xca>
+      return 0;
+    1376:	b8 00 00 00 00       	mov    $0x0,%eax
+    137b:	eb 48                	jmp    13c5 <alloc+0x112>
+    bump = (char*)p;
+    137d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1380:	a3 90 39 00 00       	mov    %eax,0x3990
+    bumpend = (char*)(p + p->s.size);
+    1385:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1388:	8b 40 04             	mov    0x4(%eax),%eax
+    138b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1392:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1395:	01 d0                	add    %edx,%eax
+    1397:	a3 94 39 00 00       	mov    %eax,0x3994
+  }
+  p = (Header*)bump;
+    139c:	a1 90 39 00 00       	mov    0x3990,%eax
+    13a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    13a4:	a1 90 39 00 00       	mov    0x3990,%eax
+    13a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13ac:	c1 e2 03             	shl    $0x3,%edx
+    13af:	01 d0                	add    %edx,%eax
+    13b1:	a3 90 39 00 00       	mov    %eax,0x3990
+  p->s.size = nunits;
+    13b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13bc:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    13bf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13c2:	83 c0 08             	add    $0x8,%eax
+}
+    13c5:	c9                   	leave
+    13c6:	c3                   	ret
+
+000013c7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    13c7:	55                   	push   %ebp
+    13c8:	89 e5                	mov    %esp,%ebp
+    13ca:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    13cd:	e8 c2 fb ff ff       	call   f94 <lock>
+    13d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    13d5:	83 ec 0c             	sub    $0xc,%esp
+    13d8:	ff 75 08             	push   0x8(%ebp)
+    13db:	e8 d3 fe ff ff       	call   12b3 <alloc>
+    13e0:	83 c4 10             	add    $0x10,%esp
+    13e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    13e6:	83 ec 0c             	sub    $0xc,%esp
+    13e9:	ff 75 f4             	push   -0xc(%ebp)
+    13ec:	e8 df fb ff ff       	call   fd0 <unlock>
+    13f1:	83 c4 10             	add    $0x10,%esp
+  return p;
+    13f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    13f7:	c9                   	leave
+    13f8:	c3                   	ret
@@ -0,0 +1,149 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "ioring.h"
+
+#define TEST_FILE "/ioring_file"
+#define NBLK 8
+#define BLK 512
+
+static struct ioring *ring;
+static char wbuf[NBLK][BLK];
+static char rbuf[NBLK][BLK];
+
+static void
+queue(int op, int fd, void *addr, int len, int off, int flags, uint data)
+{
+  struct ioring_sqe *s;
+
+  s = &ring->sq[ring->sqtail % IORING_NSQ];
+  s->op = op;
+  s->fd = fd;
+  s->addr = (uint)addr;
+  s->len = len;
+  s->off = off;
+  s->flags = flags;
+  s->data = data;
+  ring->sqtail++;
+}
+
+// Submit what is queued, wait for n completions and return the
+// result of the one with data, or -2 if it is not among them.
+static int
+run(int n, uint data)
+{
+  struct ioring_cqe *c;
+  int res;
+
+  if(ioring_enter(IORING_NSQ, n) < 0){
+    printf(1, "error: ioring_enter\n");
+    exit();
+  }
+  res = -2;
+  while(n-- > 0 && ring->cqhead != ring->cqtail){
+    c = &ring->cq[ring->cqhead % IORING_NCQ];
+    if(c->data == data)
+      res = c->res;
+    ring->cqhead++;
+  }
+  return res;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct ioring_cqe *cqe;
+  int fd, i, j, p[2];
+  char *m, c;
+
+  m = sbrk(2*4096);
+  ring = (struct ioring*)(((uint)m + 4095) & ~4095);
+  memset(ring, 0, sizeof(*ring));
+  if(ioring_setup(ring) < 0 || ioring_setup(ring) == 0){
+    printf(1, "error: ioring_setup\n");
+    exit();
+  }
+
+  queue(IORING_OP_OPEN, 0, TEST_FILE, 0, 0, O_CREATE|O_RDWR, 1);
+  if((fd = run(1, 1)) < 0){
+    printf(1, "error: open\n");
+    exit();
+  }
+
+  // Many writes in flight at once, then reads of what they wrote.
+  for(i = 0; i < NBLK; i++){
+    memset(wbuf[i], 'a' + i, BLK);
+    queue(IORING_OP_WRITE, fd, wbuf[i], BLK, i*BLK, 0, 100 + i);
+  }
+  queue(IORING_OP_FSYNC, fd, 0, 0, 0, 0, 200);
+  if(ioring_enter(IORING_NSQ, NBLK + 1) != NBLK + 1){
+    printf(1, "error: submit\n");
+    exit();
+  }
+  for(i = 0; i < NBLK + 1; i++){
+    if(ring->cqhead == ring->cqtail){
+      printf(1, "error: missing completion\n");
+      exit();
+    }
+    cqe = &ring->cq[ring->cqhead++ % IORING_NCQ];
+    if(cqe->res != (cqe->data == 200 ? 0 : BLK)){
+      printf(1, "error: request %d returned %d\n", cqe->data, cqe->res);
+      exit();
+    }
+  }
+  for(i = 0; i < NBLK; i++)
+    queue(IORING_OP_READ, fd, rbuf[i], BLK, i*BLK, 0, 300 + i);
+  if(ioring_enter(IORING_NSQ, NBLK) != NBLK ||
+     (int)(ring->cqtail - ring->cqhead) != NBLK){
+    printf(1, "error: reads\n");
+    exit();
+  }
+  ring->cqhead = ring->cqtail;
+  for(i = 0; i < NBLK; i++)
+    for(j = 0; j < BLK; j++)
+      if(rbuf[i][j] != 'a' + i){
+        printf(1, "error: block %d byte %d\n", i, j);
+        exit();
+      }
+  queue(IORING_OP_CLOSE, fd, 0, 0, 0, 0, 2);
+  if(run(1, 2) != 0 || close(fd) == 0){
+    printf(1, "error: close\n");
+    exit();
+  }
+  printf(1, "ioring files ok\n");
+
+  // A pipe, with the read queued before the write that feeds it.
+  if(pipe(p) < 0){
+    printf(1, "error: pipe\n");
+    exit();
+  }
+  queue(IORING_OP_READ, p[0], &c, 1, -1, 0, 3);
+  if(ioring_enter(1, 0) != 1){
+    printf(1, "error: submit\n");
+    exit();
+  }
+  write(p[1], "x", 1);
+  if(run(1, 3) != 1 || c != 'x'){
+    printf(1, "error: pipe read\n");
+    exit();
+  }
+  queue(IORING_OP_WRITE, 99, &c, 1, -1, 0, 4);
+  if(run(1, 4) != -1){
+    printf(1, "error: bad descriptor accepted\n");
+    exit();
+  }
+  close(p[0]);
+  close(p[1]);
+
+  // The child gets a copy of the ring page, not the ring.
+  if(fork() == 0){
+    if(ioring_enter(1, 0) >= 0)
+      printf(1, "error: child has the ring\n");
+    exit();
+  }
+  wait();
+  unlink(TEST_FILE);
+  printf(1, "ioring pipes ok\n");
+  exit();
+}
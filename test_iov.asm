@@ -0,0 +1,1992 @@
+
+_test_iov:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <same>:
+
+#define TEST_FILE "/iov_file"
+
+static int
+same(char *p, char *q, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+  while(n-- > 0)
+       3:	eb 23                	jmp    28 <same+0x28>
+    if(*p++ != *q++)
+       5:	8b 45 08             	mov    0x8(%ebp),%eax
+       8:	8d 50 01             	lea    0x1(%eax),%edx
+       b:	89 55 08             	mov    %edx,0x8(%ebp)
+       e:	0f b6 08             	movzbl (%eax),%ecx
+      11:	8b 45 0c             	mov    0xc(%ebp),%eax
+      14:	8d 50 01             	lea    0x1(%eax),%edx
+      17:	89 55 0c             	mov    %edx,0xc(%ebp)
+      1a:	0f b6 00             	movzbl (%eax),%eax
+      1d:	38 c1                	cmp    %al,%cl
+      1f:	74 07                	je     28 <same+0x28>
+      return 0;
+      21:	b8 00 00 00 00       	mov    $0x0,%eax
+      26:	eb 12                	jmp    3a <same+0x3a>
+  while(n-- > 0)
+      28:	8b 45 10             	mov    0x10(%ebp),%eax
+      2b:	8d 50 ff             	lea    -0x1(%eax),%edx
+      2e:	89 55 10             	mov    %edx,0x10(%ebp)
+      31:	85 c0                	test   %eax,%eax
+      33:	7f d0                	jg     5 <same+0x5>
+  return 1;
+      35:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      3a:	5d                   	pop    %ebp
+      3b:	c3                   	ret
+
+0000003c <main>:
+
+int
+main(int argc, char *argv[])
+{
+      3c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      40:	83 e4 f0             	and    $0xfffffff0,%esp
+      43:	ff 71 fc             	push   -0x4(%ecx)
+      46:	55                   	push   %ebp
+      47:	89 e5                	mov    %esp,%ebp
+      49:	51                   	push   %ecx
+      4a:	81 ec 94 02 00 00    	sub    $0x294,%esp
+  struct iovec iov[3];
+  char a[4], b[600], c[8];
+  int fd, i;
+
+  iov[0].iov_base = "abc";
+      50:	c7 45 d8 36 10 00 00 	movl   $0x1036,-0x28(%ebp)
+  iov[0].iov_len = 3;
+      57:	c7 45 dc 03 00 00 00 	movl   $0x3,-0x24(%ebp)
+  memset(b, 'x', sizeof(b));
+      5e:	83 ec 04             	sub    $0x4,%esp
+      61:	68 58 02 00 00       	push   $0x258
+      66:	6a 78                	push   $0x78
+      68:	8d 85 7c fd ff ff    	lea    -0x284(%ebp),%eax
+      6e:	50                   	push   %eax
+      6f:	e8 bd 02 00 00       	call   331 <memset>
+      74:	83 c4 10             	add    $0x10,%esp
+  iov[1].iov_base = b;
+      77:	8d 85 7c fd ff ff    	lea    -0x284(%ebp),%eax
+      7d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  iov[1].iov_len = sizeof(b);
+      80:	c7 45 e4 58 02 00 00 	movl   $0x258,-0x1c(%ebp)
+  iov[2].iov_base = "defgh";
+      87:	c7 45 e8 3a 10 00 00 	movl   $0x103a,-0x18(%ebp)
+  iov[2].iov_len = 5;
+      8e:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%ebp)
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || writev(fd, iov, 3) != 608){
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 02 02 00 00       	push   $0x202
+      9d:	68 40 10 00 00       	push   $0x1040
+      a2:	e8 9d 04 00 00       	call   544 <open>
+      a7:	83 c4 10             	add    $0x10,%esp
+      aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      ad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      b1:	78 1b                	js     ce <main+0x92>
+      b3:	83 ec 04             	sub    $0x4,%esp
+      b6:	6a 03                	push   $0x3
+      b8:	8d 45 d8             	lea    -0x28(%ebp),%eax
+      bb:	50                   	push   %eax
+      bc:	ff 75 f0             	push   -0x10(%ebp)
+      bf:	e8 52 05 00 00       	call   616 <writev>
+      c4:	83 c4 10             	add    $0x10,%esp
+      c7:	3d 60 02 00 00       	cmp    $0x260,%eax
+      cc:	74 17                	je     e5 <main+0xa9>
+    printf(1, "error: writev\n");
+      ce:	83 ec 08             	sub    $0x8,%esp
+      d1:	68 4a 10 00 00       	push   $0x104a
+      d6:	6a 01                	push   $0x1
+      d8:	e8 bf 08 00 00       	call   99c <printf>
+      dd:	83 c4 10             	add    $0x10,%esp
+    exit();
+      e0:	e8 27 04 00 00       	call   50c <exit>
+  }
+  close(fd);
+      e5:	83 ec 0c             	sub    $0xc,%esp
+      e8:	ff 75 f0             	push   -0x10(%ebp)
+      eb:	e8 3f 04 00 00       	call   52f <close>
+      f0:	83 c4 10             	add    $0x10,%esp
+
+  memset(b, 0, sizeof(b));
+      f3:	83 ec 04             	sub    $0x4,%esp
+      f6:	68 58 02 00 00       	push   $0x258
+      fb:	6a 00                	push   $0x0
+      fd:	8d 85 7c fd ff ff    	lea    -0x284(%ebp),%eax
+     103:	50                   	push   %eax
+     104:	e8 28 02 00 00       	call   331 <memset>
+     109:	83 c4 10             	add    $0x10,%esp
+  iov[0].iov_base = a;
+     10c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     10f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  iov[0].iov_len = 3;
+     112:	c7 45 dc 03 00 00 00 	movl   $0x3,-0x24(%ebp)
+  iov[2].iov_base = c;
+     119:	8d 85 74 fd ff ff    	lea    -0x28c(%ebp),%eax
+     11f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  iov[2].iov_len = sizeof(c);
+     122:	c7 45 ec 08 00 00 00 	movl   $0x8,-0x14(%ebp)
+  fd = open(TEST_FILE, O_RDONLY);
+     129:	83 ec 08             	sub    $0x8,%esp
+     12c:	6a 00                	push   $0x0
+     12e:	68 40 10 00 00       	push   $0x1040
+     133:	e8 0c 04 00 00       	call   544 <open>
+     138:	83 c4 10             	add    $0x10,%esp
+     13b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(readv(fd, iov, 3) != 608 || !same(a, "abc", 3) || !same(c, "defgh", 5)){
+     13e:	83 ec 04             	sub    $0x4,%esp
+     141:	6a 03                	push   $0x3
+     143:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     146:	50                   	push   %eax
+     147:	ff 75 f0             	push   -0x10(%ebp)
+     14a:	e8 bd 04 00 00       	call   60c <readv>
+     14f:	83 c4 10             	add    $0x10,%esp
+     152:	3d 60 02 00 00       	cmp    $0x260,%eax
+     157:	75 37                	jne    190 <main+0x154>
+     159:	83 ec 04             	sub    $0x4,%esp
+     15c:	6a 03                	push   $0x3
+     15e:	68 36 10 00 00       	push   $0x1036
+     163:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     166:	50                   	push   %eax
+     167:	e8 94 fe ff ff       	call   0 <same>
+     16c:	83 c4 10             	add    $0x10,%esp
+     16f:	85 c0                	test   %eax,%eax
+     171:	74 1d                	je     190 <main+0x154>
+     173:	83 ec 04             	sub    $0x4,%esp
+     176:	6a 05                	push   $0x5
+     178:	68 3a 10 00 00       	push   $0x103a
+     17d:	8d 85 74 fd ff ff    	lea    -0x28c(%ebp),%eax
+     183:	50                   	push   %eax
+     184:	e8 77 fe ff ff       	call   0 <same>
+     189:	83 c4 10             	add    $0x10,%esp
+     18c:	85 c0                	test   %eax,%eax
+     18e:	75 17                	jne    1a7 <main+0x16b>
+    printf(1, "error: readv\n");
+     190:	83 ec 08             	sub    $0x8,%esp
+     193:	68 59 10 00 00       	push   $0x1059
+     198:	6a 01                	push   $0x1
+     19a:	e8 fd 07 00 00       	call   99c <printf>
+     19f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1a2:	e8 65 03 00 00       	call   50c <exit>
+  }
+  for(i = 0; i < sizeof(b); i++){
+     1a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1ae:	eb 30                	jmp    1e0 <main+0x1a4>
+    if(b[i] != 'x'){
+     1b0:	8d 95 7c fd ff ff    	lea    -0x284(%ebp),%edx
+     1b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1b9:	01 d0                	add    %edx,%eax
+     1bb:	0f b6 00             	movzbl (%eax),%eax
+     1be:	3c 78                	cmp    $0x78,%al
+     1c0:	74 1a                	je     1dc <main+0x1a0>
+      printf(1, "wrong data at %d\n", i);
+     1c2:	83 ec 04             	sub    $0x4,%esp
+     1c5:	ff 75 f4             	push   -0xc(%ebp)
+     1c8:	68 67 10 00 00       	push   $0x1067
+     1cd:	6a 01                	push   $0x1
+     1cf:	e8 c8 07 00 00       	call   99c <printf>
+     1d4:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1d7:	e8 30 03 00 00       	call   50c <exit>
+  for(i = 0; i < sizeof(b); i++){
+     1dc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1e3:	3d 57 02 00 00       	cmp    $0x257,%eax
+     1e8:	76 c6                	jbe    1b0 <main+0x174>
+    }
+  }
+  close(fd);
+     1ea:	83 ec 0c             	sub    $0xc,%esp
+     1ed:	ff 75 f0             	push   -0x10(%ebp)
+     1f0:	e8 3a 03 00 00       	call   52f <close>
+     1f5:	83 c4 10             	add    $0x10,%esp
+  unlink(TEST_FILE);
+     1f8:	83 ec 0c             	sub    $0xc,%esp
+     1fb:	68 40 10 00 00       	push   $0x1040
+     200:	e8 53 03 00 00       	call   558 <unlink>
+     205:	83 c4 10             	add    $0x10,%esp
+
+  iov[0].iov_base = (void*)0x7fffffff;
+     208:	c7 45 d8 ff ff ff 7f 	movl   $0x7fffffff,-0x28(%ebp)
+  if(readv(0, iov, 1) != -1){
+     20f:	83 ec 04             	sub    $0x4,%esp
+     212:	6a 01                	push   $0x1
+     214:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     217:	50                   	push   %eax
+     218:	6a 00                	push   $0x0
+     21a:	e8 ed 03 00 00       	call   60c <readv>
+     21f:	83 c4 10             	add    $0x10,%esp
+     222:	83 f8 ff             	cmp    $0xffffffff,%eax
+     225:	74 17                	je     23e <main+0x202>
+    printf(1, "error: bad iovec accepted\n");
+     227:	83 ec 08             	sub    $0x8,%esp
+     22a:	68 79 10 00 00       	push   $0x1079
+     22f:	6a 01                	push   $0x1
+     231:	e8 66 07 00 00       	call   99c <printf>
+     236:	83 c4 10             	add    $0x10,%esp
+    exit();
+     239:	e8 ce 02 00 00       	call   50c <exit>
+  }
+  printf(1, "%s %d %x%c\n", "iov", 123, 0xabc, '!');
+     23e:	83 ec 08             	sub    $0x8,%esp
+     241:	6a 21                	push   $0x21
+     243:	68 bc 0a 00 00       	push   $0xabc
+     248:	6a 7b                	push   $0x7b
+     24a:	68 94 10 00 00       	push   $0x1094
+     24f:	68 98 10 00 00       	push   $0x1098
+     254:	6a 01                	push   $0x1
+     256:	e8 41 07 00 00       	call   99c <printf>
+     25b:	83 c4 20             	add    $0x20,%esp
+  printf(1, "iov ok\n");
+     25e:	83 ec 08             	sub    $0x8,%esp
+     261:	68 a4 10 00 00       	push   $0x10a4
+     266:	6a 01                	push   $0x1
+     268:	e8 2f 07 00 00       	call   99c <printf>
+     26d:	83 c4 10             	add    $0x10,%esp
+  exit();
+     270:	e8 97 02 00 00       	call   50c <exit>
+
+00000275 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     275:	55                   	push   %ebp
+     276:	89 e5                	mov    %esp,%ebp
+     278:	57                   	push   %edi
+     279:	53                   	push   %ebx
+    if(cc < 1)
+     27a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     27d:	8b 55 10             	mov    0x10(%ebp),%edx
+     280:	8b 45 0c             	mov    0xc(%ebp),%eax
+     283:	89 cb                	mov    %ecx,%ebx
+     285:	89 df                	mov    %ebx,%edi
+     287:	89 d1                	mov    %edx,%ecx
+     289:	fc                   	cld
+     28a:	f3 aa                	rep stos %al,%es:(%edi)
+     28c:	89 ca                	mov    %ecx,%edx
+     28e:	89 fb                	mov    %edi,%ebx
+     290:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     293:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     296:	90                   	nop
+     297:	5b                   	pop    %ebx
+     298:	5f                   	pop    %edi
+     299:	5d                   	pop    %ebp
+     29a:	c3                   	ret
+
+0000029b <strcpy>:
+{
+     29b:	55                   	push   %ebp
+     29c:	89 e5                	mov    %esp,%ebp
+     29e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2a7:	90                   	nop
+     2a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2ab:	8d 42 01             	lea    0x1(%edx),%eax
+     2ae:	89 45 0c             	mov    %eax,0xc(%ebp)
+     2b1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2b4:	8d 48 01             	lea    0x1(%eax),%ecx
+     2b7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     2ba:	0f b6 12             	movzbl (%edx),%edx
+     2bd:	88 10                	mov    %dl,(%eax)
+     2bf:	0f b6 00             	movzbl (%eax),%eax
+     2c2:	84 c0                	test   %al,%al
+     2c4:	75 e2                	jne    2a8 <strcpy+0xd>
+  return os;
+     2c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2c9:	c9                   	leave
+     2ca:	c3                   	ret
+
+000002cb <strcmp>:
+{
+     2cb:	55                   	push   %ebp
+     2cc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     2ce:	eb 08                	jmp    2d8 <strcmp+0xd>
+    p++, q++;
+     2d0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     2d4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     2d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     2db:	0f b6 00             	movzbl (%eax),%eax
+     2de:	84 c0                	test   %al,%al
+     2e0:	74 10                	je     2f2 <strcmp+0x27>
+     2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e5:	0f b6 10             	movzbl (%eax),%edx
+     2e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2eb:	0f b6 00             	movzbl (%eax),%eax
+     2ee:	38 c2                	cmp    %al,%dl
+     2f0:	74 de                	je     2d0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f5:	0f b6 00             	movzbl (%eax),%eax
+     2f8:	0f b6 d0             	movzbl %al,%edx
+     2fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fe:	0f b6 00             	movzbl (%eax),%eax
+     301:	0f b6 c0             	movzbl %al,%eax
+     304:	29 c2                	sub    %eax,%edx
+     306:	89 d0                	mov    %edx,%eax
+}
+     308:	5d                   	pop    %ebp
+     309:	c3                   	ret
+
+0000030a <strlen>:
+{
+     30a:	55                   	push   %ebp
+     30b:	89 e5                	mov    %esp,%ebp
+     30d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     310:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     317:	eb 04                	jmp    31d <strlen+0x13>
+     319:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     31d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     320:	8b 45 08             	mov    0x8(%ebp),%eax
+     323:	01 d0                	add    %edx,%eax
+     325:	0f b6 00             	movzbl (%eax),%eax
+     328:	84 c0                	test   %al,%al
+     32a:	75 ed                	jne    319 <strlen+0xf>
+  return n;
+     32c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     32f:	c9                   	leave
+     330:	c3                   	ret
+
+00000331 <memset>:
+{
+     331:	55                   	push   %ebp
+     332:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     334:	8b 45 10             	mov    0x10(%ebp),%eax
+     337:	50                   	push   %eax
+     338:	ff 75 0c             	push   0xc(%ebp)
+     33b:	ff 75 08             	push   0x8(%ebp)
+     33e:	e8 32 ff ff ff       	call   275 <stosb>
+     343:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     346:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     349:	c9                   	leave
+     34a:	c3                   	ret
+
+0000034b <strchr>:
+{
+     34b:	55                   	push   %ebp
+     34c:	89 e5                	mov    %esp,%ebp
+     34e:	83 ec 04             	sub    $0x4,%esp
+     351:	8b 45 0c             	mov    0xc(%ebp),%eax
+     354:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     357:	eb 14                	jmp    36d <strchr+0x22>
+    if(*s == c)
+     359:	8b 45 08             	mov    0x8(%ebp),%eax
+     35c:	0f b6 00             	movzbl (%eax),%eax
+     35f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     362:	75 05                	jne    369 <strchr+0x1e>
+      return (char*)s;
+     364:	8b 45 08             	mov    0x8(%ebp),%eax
+     367:	eb 13                	jmp    37c <strchr+0x31>
+  for(; *s; s++)
+     369:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     36d:	8b 45 08             	mov    0x8(%ebp),%eax
+     370:	0f b6 00             	movzbl (%eax),%eax
+     373:	84 c0                	test   %al,%al
+     375:	75 e2                	jne    359 <strchr+0xe>
+  return 0;
+     377:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     37c:	c9                   	leave
+     37d:	c3                   	ret
+
+0000037e <gets>:
+{
+     37e:	55                   	push   %ebp
+     37f:	89 e5                	mov    %esp,%ebp
+     381:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     384:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     38b:	eb 42                	jmp    3cf <gets+0x51>
+    cc = read(0, &c, 1);
+     38d:	83 ec 04             	sub    $0x4,%esp
+     390:	6a 01                	push   $0x1
+     392:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     395:	50                   	push   %eax
+     396:	6a 00                	push   $0x0
+     398:	e8 84 01 00 00       	call   521 <read>
+     39d:	83 c4 10             	add    $0x10,%esp
+     3a0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     3a3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3a7:	7e 33                	jle    3dc <gets+0x5e>
+    buf[i++] = c;
+     3a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3ac:	8d 50 01             	lea    0x1(%eax),%edx
+     3af:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     3b2:	89 c2                	mov    %eax,%edx
+     3b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b7:	01 c2                	add    %eax,%edx
+     3b9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3bd:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     3bf:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3c3:	3c 0a                	cmp    $0xa,%al
+     3c5:	74 16                	je     3dd <gets+0x5f>
+     3c7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3cb:	3c 0d                	cmp    $0xd,%al
+     3cd:	74 0e                	je     3dd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     3cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3d2:	83 c0 01             	add    $0x1,%eax
+     3d5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     3d8:	7f b3                	jg     38d <gets+0xf>
+     3da:	eb 01                	jmp    3dd <gets+0x5f>
+      break;
+     3dc:	90                   	nop
+  }
+  buf[i] = '\0';
+     3dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e3:	01 d0                	add    %edx,%eax
+     3e5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     3e8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     3eb:	c9                   	leave
+     3ec:	c3                   	ret
+
+000003ed <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     3ed:	55                   	push   %ebp
+     3ee:	89 e5                	mov    %esp,%ebp
+     3f0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     3f3:	83 ec 08             	sub    $0x8,%esp
+     3f6:	6a 00                	push   $0x0
+     3f8:	ff 75 08             	push   0x8(%ebp)
+     3fb:	e8 44 01 00 00       	call   544 <open>
+     400:	83 c4 10             	add    $0x10,%esp
+     403:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     406:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     40a:	79 07                	jns    413 <stat+0x26>
+    return -1;
+     40c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     411:	eb 25                	jmp    438 <stat+0x4b>
+  r = fstat(fd, st);
+     413:	83 ec 08             	sub    $0x8,%esp
+     416:	ff 75 0c             	push   0xc(%ebp)
+     419:	ff 75 f4             	push   -0xc(%ebp)
+     41c:	e8 41 01 00 00       	call   562 <fstat>
+     421:	83 c4 10             	add    $0x10,%esp
+     424:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     427:	83 ec 0c             	sub    $0xc,%esp
+     42a:	ff 75 f4             	push   -0xc(%ebp)
+     42d:	e8 fd 00 00 00       	call   52f <close>
+     432:	83 c4 10             	add    $0x10,%esp
+  return r;
+     435:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     438:	c9                   	leave
+     439:	c3                   	ret
+
+0000043a <atoi>:
+
+int
+atoi(const char *s)
+{
+     43a:	55                   	push   %ebp
+     43b:	89 e5                	mov    %esp,%ebp
+     43d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     440:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     447:	eb 25                	jmp    46e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     449:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     44c:	89 d0                	mov    %edx,%eax
+     44e:	c1 e0 02             	shl    $0x2,%eax
+     451:	01 d0                	add    %edx,%eax
+     453:	01 c0                	add    %eax,%eax
+     455:	89 c1                	mov    %eax,%ecx
+     457:	8b 45 08             	mov    0x8(%ebp),%eax
+     45a:	8d 50 01             	lea    0x1(%eax),%edx
+     45d:	89 55 08             	mov    %edx,0x8(%ebp)
+     460:	0f b6 00             	movzbl (%eax),%eax
+     463:	0f be c0             	movsbl %al,%eax
+     466:	01 c8                	add    %ecx,%eax
+     468:	83 e8 30             	sub    $0x30,%eax
+     46b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     46e:	8b 45 08             	mov    0x8(%ebp),%eax
+     471:	0f b6 00             	movzbl (%eax),%eax
+     474:	3c 2f                	cmp    $0x2f,%al
+     476:	7e 0a                	jle    482 <atoi+0x48>
+     478:	8b 45 08             	mov    0x8(%ebp),%eax
+     47b:	0f b6 00             	movzbl (%eax),%eax
+     47e:	3c 39                	cmp    $0x39,%al
+     480:	7e c7                	jle    449 <atoi+0xf>
+  return n;
+     482:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     485:	c9                   	leave
+     486:	c3                   	ret
+
+00000487 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     487:	55                   	push   %ebp
+     488:	89 e5                	mov    %esp,%ebp
+     48a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     48d:	8b 45 08             	mov    0x8(%ebp),%eax
+     490:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     493:	8b 45 0c             	mov    0xc(%ebp),%eax
+     496:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     499:	eb 17                	jmp    4b2 <memmove+0x2b>
+    *dst++ = *src++;
+     49b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     49e:	8d 42 01             	lea    0x1(%edx),%eax
+     4a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4a7:	8d 48 01             	lea    0x1(%eax),%ecx
+     4aa:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     4ad:	0f b6 12             	movzbl (%edx),%edx
+     4b0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     4b2:	8b 45 10             	mov    0x10(%ebp),%eax
+     4b5:	8d 50 ff             	lea    -0x1(%eax),%edx
+     4b8:	89 55 10             	mov    %edx,0x10(%ebp)
+     4bb:	85 c0                	test   %eax,%eax
+     4bd:	7f dc                	jg     49b <memmove+0x14>
+  return vdst;
+     4bf:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4c2:	c9                   	leave
+     4c3:	c3                   	ret
+
+000004c4 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     4c4:	83 3d 58 14 00 00 00 	cmpl   $0x0,0x1458
+  jg 2f
+     4cb:	7f 2e                	jg     4fb <dosyscall+0x37>
+  jl 1f
+     4cd:	7c 29                	jl     4f8 <dosyscall+0x34>
+  pushl %eax
+     4cf:	50                   	push   %eax
+  pushl %ebx
+     4d0:	53                   	push   %ebx
+  movl $1, %eax
+     4d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     4d6:	0f a2                	cpuid
+  popl %ebx
+     4d8:	5b                   	pop    %ebx
+  popl %eax
+     4d9:	58                   	pop    %eax
+  movl $-1, sysmode
+     4da:	c7 05 58 14 00 00 ff 	movl   $0xffffffff,0x1458
+     4e1:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     4e4:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     4ea:	74 0c                	je     4f8 <dosyscall+0x34>
+  movl $1, sysmode
+     4ec:	c7 05 58 14 00 00 01 	movl   $0x1,0x1458
+     4f3:	00 00 00 
+  jmp 2f
+     4f6:	eb 03                	jmp    4fb <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     4f8:	cd 40                	int    $0x40
+  ret
+     4fa:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     4fb:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     4fd:	ba 04 05 00 00       	mov    $0x504,%edx
+  sysenter
+     502:	0f 34                	sysenter
+3:
+  ret
+     504:	c3                   	ret
+
+00000505 <fork>:
+
+SYSCALL(fork)
+     505:	b8 01 00 00 00       	mov    $0x1,%eax
+     50a:	eb b8                	jmp    4c4 <dosyscall>
+
+0000050c <exit>:
+SYSCALL(exit)
+     50c:	b8 02 00 00 00       	mov    $0x2,%eax
+     511:	eb b1                	jmp    4c4 <dosyscall>
+
+00000513 <wait>:
+SYSCALL(wait)
+     513:	b8 03 00 00 00       	mov    $0x3,%eax
+     518:	eb aa                	jmp    4c4 <dosyscall>
+
+0000051a <pipe>:
+SYSCALL(pipe)
+     51a:	b8 04 00 00 00       	mov    $0x4,%eax
+     51f:	eb a3                	jmp    4c4 <dosyscall>
+
+00000521 <read>:
+SYSCALL(read)
+     521:	b8 05 00 00 00       	mov    $0x5,%eax
+     526:	eb 9c                	jmp    4c4 <dosyscall>
+
+00000528 <write>:
+SYSCALL(write)
+     528:	b8 10 00 00 00       	mov    $0x10,%eax
+     52d:	eb 95                	jmp    4c4 <dosyscall>
+
+0000052f <close>:
+SYSCALL(close)
+     52f:	b8 15 00 00 00       	mov    $0x15,%eax
+     534:	eb 8e                	jmp    4c4 <dosyscall>
+
+00000536 <kill>:
+SYSCALL(kill)
+     536:	b8 06 00 00 00       	mov    $0x6,%eax
+     53b:	eb 87                	jmp    4c4 <dosyscall>
+
+0000053d <exec>:
+SYSCALL(exec)
+     53d:	b8 07 00 00 00       	mov    $0x7,%eax
+     542:	eb 80                	jmp    4c4 <dosyscall>
+
+00000544 <open>:
+SYSCALL(open)
+     544:	b8 0f 00 00 00       	mov    $0xf,%eax
+     549:	e9 76 ff ff ff       	jmp    4c4 <dosyscall>
+
+0000054e <mknod>:
+SYSCALL(mknod)
+     54e:	b8 11 00 00 00       	mov    $0x11,%eax
+     553:	e9 6c ff ff ff       	jmp    4c4 <dosyscall>
+
+00000558 <unlink>:
+SYSCALL(unlink)
+     558:	b8 12 00 00 00       	mov    $0x12,%eax
+     55d:	e9 62 ff ff ff       	jmp    4c4 <dosyscall>
+
+00000562 <fstat>:
+SYSCALL(fstat)
+     562:	b8 08 00 00 00       	mov    $0x8,%eax
+     567:	e9 58 ff ff ff       	jmp    4c4 <dosyscall>
+
+0000056c <link>:
+SYSCALL(link)
+     56c:	b8 13 00 00 00       	mov    $0x13,%eax
+     571:	e9 4e ff ff ff       	jmp    4c4 <dosyscall>
+
+00000576 <mkdir>:
+SYSCALL(mkdir)
+     576:	b8 14 00 00 00       	mov    $0x14,%eax
+     57b:	e9 44 ff ff ff       	jmp    4c4 <dosyscall>
+
+00000580 <chdir>:
+SYSCALL(chdir)
+     580:	b8 09 00 00 00       	mov    $0x9,%eax
+     585:	e9 3a ff ff ff       	jmp    4c4 <dosyscall>
+
+0000058a <dup>:
+SYSCALL(dup)
+     58a:	b8 0a 00 00 00       	mov    $0xa,%eax
+     58f:	e9 30 ff ff ff       	jmp    4c4 <dosyscall>
+
+00000594 <getpid>:
+SYSCALL(getpid)
+     594:	b8 0b 00 00 00       	mov    $0xb,%eax
+     599:	e9 26 ff ff ff       	jmp    4c4 <dosyscall>
+
+0000059e <sbrk>:
+SYSCALL(sbrk)
+     59e:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5a3:	e9 1c ff ff ff       	jmp    4c4 <dosyscall>
+
+000005a8 <sleep>:
+SYSCALL(sleep)
+     5a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5ad:	e9 12 ff ff ff       	jmp    4c4 <dosyscall>
+
+000005b2 <uptime>:
+SYSCALL(uptime)
+     5b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5b7:	e9 08 ff ff ff       	jmp    4c4 <dosyscall>
+
+000005bc <symlink>:
+SYSCALL(symlink)
+     5bc:	b8 16 00 00 00       	mov    $0x16,%eax
+     5c1:	e9 fe fe ff ff       	jmp    4c4 <dosyscall>
+
+000005c6 <readlink>:
+SYSCALL(readlink)
+     5c6:	b8 17 00 00 00       	mov    $0x17,%eax
+     5cb:	e9 f4 fe ff ff       	jmp    4c4 <dosyscall>
+
+000005d0 <fprot>:
+SYSCALL(fprot)
+     5d0:	b8 18 00 00 00       	mov    $0x18,%eax
+     5d5:	e9 ea fe ff ff       	jmp    4c4 <dosyscall>
+
+000005da <funprot>:
+SYSCALL(funprot)
+     5da:	b8 19 00 00 00       	mov    $0x19,%eax
+     5df:	e9 e0 fe ff ff       	jmp    4c4 <dosyscall>
+
+000005e4 <funlock>:
+SYSCALL(funlock)
+     5e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5e9:	e9 d6 fe ff ff       	jmp    4c4 <dosyscall>
+
+000005ee <mmap>:
+SYSCALL(mmap)
+     5ee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5f3:	e9 cc fe ff ff       	jmp    4c4 <dosyscall>
+
+000005f8 <munmap>:
+SYSCALL(munmap)
+     5f8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5fd:	e9 c2 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000602 <sendfile>:
+SYSCALL(sendfile)
+     602:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     607:	e9 b8 fe ff ff       	jmp    4c4 <dosyscall>
+
+0000060c <readv>:
+SYSCALL(readv)
+     60c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     611:	e9 ae fe ff ff       	jmp    4c4 <dosyscall>
+
+00000616 <writev>:
+SYSCALL(writev)
+     616:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     61b:	e9 a4 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000620 <pread>:
+SYSCALL(pread)
+     620:	b8 20 00 00 00       	mov    $0x20,%eax
+     625:	e9 9a fe ff ff       	jmp    4c4 <dosyscall>
+
+0000062a <pwrite>:
+SYSCALL(pwrite)
+     62a:	b8 21 00 00 00       	mov    $0x21,%eax
+     62f:	e9 90 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000634 <lseek>:
+SYSCALL(lseek)
+     634:	b8 22 00 00 00       	mov    $0x22,%eax
+     639:	e9 86 fe ff ff       	jmp    4c4 <dosyscall>
+
+0000063e <spawn>:
+SYSCALL(spawn)
+     63e:	b8 23 00 00 00       	mov    $0x23,%eax
+     643:	e9 7c fe ff ff       	jmp    4c4 <dosyscall>
+
+00000648 <setpriority>:
+SYSCALL(setpriority)
+     648:	b8 24 00 00 00       	mov    $0x24,%eax
+     64d:	e9 72 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000652 <kthread_create>:
+SYSCALL(kthread_create)
+     652:	b8 25 00 00 00       	mov    $0x25,%eax
+     657:	e9 68 fe ff ff       	jmp    4c4 <dosyscall>
+
+0000065c <kthread_id>:
+SYSCALL(kthread_id)
+     65c:	b8 26 00 00 00       	mov    $0x26,%eax
+     661:	e9 5e fe ff ff       	jmp    4c4 <dosyscall>
+
+00000666 <kthread_exit>:
+SYSCALL(kthread_exit)
+     666:	b8 27 00 00 00       	mov    $0x27,%eax
+     66b:	e9 54 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000670 <kthread_join>:
+SYSCALL(kthread_join)
+     670:	b8 28 00 00 00       	mov    $0x28,%eax
+     675:	e9 4a fe ff ff       	jmp    4c4 <dosyscall>
+
+0000067a <futex>:
+SYSCALL(futex)
+     67a:	b8 29 00 00 00       	mov    $0x29,%eax
+     67f:	e9 40 fe ff ff       	jmp    4c4 <dosyscall>
+
+00000684 <signal>:
+SYSCALL(signal)
+     684:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     689:	e9 36 fe ff ff       	jmp    4c4 <dosyscall>
+
+0000068e <alarm>:
+SYSCALL(alarm)
+     68e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     693:	e9 2c fe ff ff       	jmp    4c4 <dosyscall>
+
+00000698 <usleep>:
+SYSCALL(usleep)
+     698:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     69d:	e9 22 fe ff ff       	jmp    4c4 <dosyscall>
+
+000006a2 <ioring_setup>:
+SYSCALL(ioring_setup)
+     6a2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6a7:	e9 18 fe ff ff       	jmp    4c4 <dosyscall>
+
+000006ac <ioring_enter>:
+SYSCALL(ioring_enter)
+     6ac:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6b1:	e9 0e fe ff ff       	jmp    4c4 <dosyscall>
+
+000006b6 <getrusage>:
+SYSCALL(getrusage)
+     6b6:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6bb:	e9 04 fe ff ff       	jmp    4c4 <dosyscall>
+
+000006c0 <mount>:
+SYSCALL(mount)
+     6c0:	b8 30 00 00 00       	mov    $0x30,%eax
+     6c5:	e9 fa fd ff ff       	jmp    4c4 <dosyscall>
+
+000006ca <getdents>:
+SYSCALL(getdents)
+     6ca:	b8 31 00 00 00       	mov    $0x31,%eax
+     6cf:	e9 f0 fd ff ff       	jmp    4c4 <dosyscall>
+
+000006d4 <yield>:
+SYSCALL(yield)
+     6d4:	b8 32 00 00 00       	mov    $0x32,%eax
+     6d9:	e9 e6 fd ff ff       	jmp    4c4 <dosyscall>
+
+000006de <ncpu>:
+SYSCALL(ncpu)
+     6de:	b8 33 00 00 00       	mov    $0x33,%eax
+     6e3:	e9 dc fd ff ff       	jmp    4c4 <dosyscall>
+
+000006e8 <fallocate>:
+SYSCALL(fallocate)
+     6e8:	b8 34 00 00 00       	mov    $0x34,%eax
+     6ed:	e9 d2 fd ff ff       	jmp    4c4 <dosyscall>
+
+000006f2 <ftruncate>:
+SYSCALL(ftruncate)
+     6f2:	b8 35 00 00 00       	mov    $0x35,%eax
+     6f7:	e9 c8 fd ff ff       	jmp    4c4 <dosyscall>
+
+000006fc <fsync>:
+SYSCALL(fsync)
+     6fc:	b8 36 00 00 00       	mov    $0x36,%eax
+     701:	e9 be fd ff ff       	jmp    4c4 <dosyscall>
+
+00000706 <fdatasync>:
+SYSCALL(fdatasync)
+     706:	b8 37 00 00 00       	mov    $0x37,%eax
+     70b:	e9 b4 fd ff ff       	jmp    4c4 <dosyscall>
+
+00000710 <poll>:
+SYSCALL(poll)
+     710:	b8 38 00 00 00       	mov    $0x38,%eax
+     715:	e9 aa fd ff ff       	jmp    4c4 <dosyscall>
+
+0000071a <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     71a:	55                   	push   %ebp
+     71b:	89 e5                	mov    %esp,%ebp
+     71d:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     720:	8b 45 08             	mov    0x8(%ebp),%eax
+     723:	8b 40 04             	mov    0x4(%eax),%eax
+     726:	85 c0                	test   %eax,%eax
+     728:	7e 1f                	jle    749 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     72a:	8b 45 08             	mov    0x8(%ebp),%eax
+     72d:	8b 50 04             	mov    0x4(%eax),%edx
+     730:	8b 45 08             	mov    0x8(%ebp),%eax
+     733:	8d 48 08             	lea    0x8(%eax),%ecx
+     736:	8b 45 08             	mov    0x8(%ebp),%eax
+     739:	8b 00                	mov    (%eax),%eax
+     73b:	83 ec 04             	sub    $0x4,%esp
+     73e:	52                   	push   %edx
+     73f:	51                   	push   %ecx
+     740:	50                   	push   %eax
+     741:	e8 d0 fe ff ff       	call   616 <writev>
+     746:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     749:	8b 45 08             	mov    0x8(%ebp),%eax
+     74c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     753:	8b 45 08             	mov    0x8(%ebp),%eax
+     756:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     75d:	00 00 00 
+}
+     760:	90                   	nop
+     761:	c9                   	leave
+     762:	c3                   	ret
+
+00000763 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     763:	55                   	push   %ebp
+     764:	89 e5                	mov    %esp,%ebp
+     766:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     769:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     76d:	0f 84 94 00 00 00    	je     807 <put+0xa4>
+    return;
+  if(o->n > 0){
+     773:	8b 45 08             	mov    0x8(%ebp),%eax
+     776:	8b 40 04             	mov    0x4(%eax),%eax
+     779:	85 c0                	test   %eax,%eax
+     77b:	7e 40                	jle    7bd <put+0x5a>
+    v = &o->iov[o->n-1];
+     77d:	8b 45 08             	mov    0x8(%ebp),%eax
+     780:	8b 40 04             	mov    0x4(%eax),%eax
+     783:	83 e8 01             	sub    $0x1,%eax
+     786:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     78d:	8b 45 08             	mov    0x8(%ebp),%eax
+     790:	01 d0                	add    %edx,%eax
+     792:	83 c0 08             	add    $0x8,%eax
+     795:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     79b:	8b 10                	mov    (%eax),%edx
+     79d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7a0:	8b 40 04             	mov    0x4(%eax),%eax
+     7a3:	01 d0                	add    %edx,%eax
+     7a5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     7a8:	75 13                	jne    7bd <put+0x5a>
+      v->iov_len += n;
+     7aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7ad:	8b 50 04             	mov    0x4(%eax),%edx
+     7b0:	8b 45 10             	mov    0x10(%ebp),%eax
+     7b3:	01 c2                	add    %eax,%edx
+     7b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7b8:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     7bb:	eb 4b                	jmp    808 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     7bd:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c0:	8b 40 04             	mov    0x4(%eax),%eax
+     7c3:	83 f8 10             	cmp    $0x10,%eax
+     7c6:	75 0e                	jne    7d6 <put+0x73>
+    flush(o);
+     7c8:	83 ec 0c             	sub    $0xc,%esp
+     7cb:	ff 75 08             	push   0x8(%ebp)
+     7ce:	e8 47 ff ff ff       	call   71a <flush>
+     7d3:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     7d6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d9:	8b 50 04             	mov    0x4(%eax),%edx
+     7dc:	8b 45 08             	mov    0x8(%ebp),%eax
+     7df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     7e2:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e9:	8b 50 04             	mov    0x4(%eax),%edx
+     7ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7f2:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     7f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f9:	8b 40 04             	mov    0x4(%eax),%eax
+     7fc:	8d 50 01             	lea    0x1(%eax),%edx
+     7ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     802:	89 50 04             	mov    %edx,0x4(%eax)
+     805:	eb 01                	jmp    808 <put+0xa5>
+    return;
+     807:	90                   	nop
+}
+     808:	c9                   	leave
+     809:	c3                   	ret
+
+0000080a <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     80a:	55                   	push   %ebp
+     80b:	89 e5                	mov    %esp,%ebp
+     80d:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     810:	8b 45 08             	mov    0x8(%ebp),%eax
+     813:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     819:	8b 45 0c             	mov    0xc(%ebp),%eax
+     81c:	01 d0                	add    %edx,%eax
+     81e:	3d 80 00 00 00       	cmp    $0x80,%eax
+     823:	77 0b                	ja     830 <room+0x26>
+     825:	8b 45 08             	mov    0x8(%ebp),%eax
+     828:	8b 40 04             	mov    0x4(%eax),%eax
+     82b:	83 f8 10             	cmp    $0x10,%eax
+     82e:	75 0e                	jne    83e <room+0x34>
+    flush(o);
+     830:	83 ec 0c             	sub    $0xc,%esp
+     833:	ff 75 08             	push   0x8(%ebp)
+     836:	e8 df fe ff ff       	call   71a <flush>
+     83b:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     83e:	8b 45 08             	mov    0x8(%ebp),%eax
+     841:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     847:	8b 45 08             	mov    0x8(%ebp),%eax
+     84a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     850:	01 d0                	add    %edx,%eax
+}
+     852:	c9                   	leave
+     853:	c3                   	ret
+
+00000854 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     854:	55                   	push   %ebp
+     855:	89 e5                	mov    %esp,%ebp
+     857:	83 ec 28             	sub    $0x28,%esp
+     85a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     85d:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     860:	83 ec 08             	sub    $0x8,%esp
+     863:	6a 01                	push   $0x1
+     865:	ff 75 08             	push   0x8(%ebp)
+     868:	e8 9d ff ff ff       	call   80a <room>
+     86d:	83 c4 10             	add    $0x10,%esp
+     870:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     876:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     87a:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     87c:	8b 45 08             	mov    0x8(%ebp),%eax
+     87f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     885:	8d 50 01             	lea    0x1(%eax),%edx
+     888:	8b 45 08             	mov    0x8(%ebp),%eax
+     88b:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     891:	83 ec 04             	sub    $0x4,%esp
+     894:	6a 01                	push   $0x1
+     896:	ff 75 f4             	push   -0xc(%ebp)
+     899:	ff 75 08             	push   0x8(%ebp)
+     89c:	e8 c2 fe ff ff       	call   763 <put>
+     8a1:	83 c4 10             	add    $0x10,%esp
+}
+     8a4:	90                   	nop
+     8a5:	c9                   	leave
+     8a6:	c3                   	ret
+
+000008a7 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     8a7:	55                   	push   %ebp
+     8a8:	89 e5                	mov    %esp,%ebp
+     8aa:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     8ad:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8b4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8b8:	74 17                	je     8d1 <printint+0x2a>
+     8ba:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8be:	79 11                	jns    8d1 <printint+0x2a>
+    neg = 1;
+     8c0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     8c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8ca:	f7 d8                	neg    %eax
+     8cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8cf:	eb 06                	jmp    8d7 <printint+0x30>
+  } else {
+    x = xx;
+     8d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8d4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     8d7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8de:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8e4:	ba 00 00 00 00       	mov    $0x0,%edx
+     8e9:	f7 f1                	div    %ecx
+     8eb:	89 d1                	mov    %edx,%ecx
+     8ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8f0:	8d 50 01             	lea    0x1(%eax),%edx
+     8f3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8f6:	0f b6 91 5c 14 00 00 	movzbl 0x145c(%ecx),%edx
+     8fd:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     901:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     904:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     907:	ba 00 00 00 00       	mov    $0x0,%edx
+     90c:	f7 f1                	div    %ecx
+     90e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     911:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     915:	75 c7                	jne    8de <printint+0x37>
+  if(neg)
+     917:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     91b:	74 0e                	je     92b <printint+0x84>
+    buf[i++] = '-';
+     91d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     920:	8d 50 01             	lea    0x1(%eax),%edx
+     923:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     926:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     92b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     92e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     931:	83 ec 08             	sub    $0x8,%esp
+     934:	ff 75 e8             	push   -0x18(%ebp)
+     937:	ff 75 08             	push   0x8(%ebp)
+     93a:	e8 cb fe ff ff       	call   80a <room>
+     93f:	83 c4 10             	add    $0x10,%esp
+     942:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     945:	eb 1d                	jmp    964 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     947:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     94a:	83 e8 01             	sub    $0x1,%eax
+     94d:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     950:	89 c2                	mov    %eax,%edx
+     952:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     955:	01 c2                	add    %eax,%edx
+     957:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     95a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     95d:	01 c8                	add    %ecx,%eax
+     95f:	0f b6 00             	movzbl (%eax),%eax
+     962:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     964:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     968:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     96c:	79 d9                	jns    947 <printint+0xa0>
+  o->used += n;
+     96e:	8b 45 08             	mov    0x8(%ebp),%eax
+     971:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     977:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     97a:	01 c2                	add    %eax,%edx
+     97c:	8b 45 08             	mov    0x8(%ebp),%eax
+     97f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     985:	83 ec 04             	sub    $0x4,%esp
+     988:	ff 75 e8             	push   -0x18(%ebp)
+     98b:	ff 75 e4             	push   -0x1c(%ebp)
+     98e:	ff 75 08             	push   0x8(%ebp)
+     991:	e8 cd fd ff ff       	call   763 <put>
+     996:	83 c4 10             	add    $0x10,%esp
+}
+     999:	90                   	nop
+     99a:	c9                   	leave
+     99b:	c3                   	ret
+
+0000099c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     99c:	55                   	push   %ebp
+     99d:	89 e5                	mov    %esp,%ebp
+     99f:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     9a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a8:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     9ae:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     9b5:	00 00 00 
+  o.used = 0;
+     9b8:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     9bf:	00 00 00 
+  state = 0;
+     9c2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     9c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+     9cc:	83 c0 04             	add    $0x4,%eax
+     9cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     9d2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     9d9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     9e0:	e9 82 01 00 00       	jmp    b67 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     9e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9eb:	01 d0                	add    %edx,%eax
+     9ed:	0f b6 00             	movzbl (%eax),%eax
+     9f0:	0f be c0             	movsbl %al,%eax
+     9f3:	25 ff 00 00 00       	and    $0xff,%eax
+     9f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     9fb:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     9ff:	75 38                	jne    a39 <printf+0x9d>
+      if(c == '%'){
+     a01:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a05:	0f 85 58 01 00 00    	jne    b63 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a0b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a0e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a14:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a17:	01 ca                	add    %ecx,%edx
+     a19:	83 ec 04             	sub    $0x4,%esp
+     a1c:	50                   	push   %eax
+     a1d:	52                   	push   %edx
+     a1e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a24:	50                   	push   %eax
+     a25:	e8 39 fd ff ff       	call   763 <put>
+     a2a:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a2d:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a34:	e9 2a 01 00 00       	jmp    b63 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a39:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a3d:	0f 85 20 01 00 00    	jne    b63 <printf+0x1c7>
+      if(c == 'd'){
+     a43:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a47:	75 22                	jne    a6b <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a4c:	8b 00                	mov    (%eax),%eax
+     a4e:	6a 01                	push   $0x1
+     a50:	6a 0a                	push   $0xa
+     a52:	50                   	push   %eax
+     a53:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a59:	50                   	push   %eax
+     a5a:	e8 48 fe ff ff       	call   8a7 <printint>
+     a5f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a62:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a66:	e9 e8 00 00 00       	jmp    b53 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     a6b:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     a6f:	74 06                	je     a77 <printf+0xdb>
+     a71:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     a75:	75 22                	jne    a99 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     a77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a7a:	8b 00                	mov    (%eax),%eax
+     a7c:	6a 00                	push   $0x0
+     a7e:	6a 10                	push   $0x10
+     a80:	50                   	push   %eax
+     a81:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a87:	50                   	push   %eax
+     a88:	e8 1a fe ff ff       	call   8a7 <printint>
+     a8d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a90:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a94:	e9 ba 00 00 00       	jmp    b53 <printf+0x1b7>
+      } else if(c == 's'){
+     a99:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     a9d:	75 3f                	jne    ade <printf+0x142>
+        s = (char*)*ap;
+     a9f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aa2:	8b 00                	mov    (%eax),%eax
+     aa4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     aa7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     aab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     aaf:	75 07                	jne    ab8 <printf+0x11c>
+          s = "(null)";
+     ab1:	c7 45 f4 ac 10 00 00 	movl   $0x10ac,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     ab8:	83 ec 0c             	sub    $0xc,%esp
+     abb:	ff 75 f4             	push   -0xc(%ebp)
+     abe:	e8 47 f8 ff ff       	call   30a <strlen>
+     ac3:	83 c4 10             	add    $0x10,%esp
+     ac6:	83 ec 04             	sub    $0x4,%esp
+     ac9:	50                   	push   %eax
+     aca:	ff 75 f4             	push   -0xc(%ebp)
+     acd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ad3:	50                   	push   %eax
+     ad4:	e8 8a fc ff ff       	call   763 <put>
+     ad9:	83 c4 10             	add    $0x10,%esp
+     adc:	eb 75                	jmp    b53 <printf+0x1b7>
+      } else if(c == 'c'){
+     ade:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     ae2:	75 21                	jne    b05 <printf+0x169>
+        putc(&o, *ap);
+     ae4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ae7:	8b 00                	mov    (%eax),%eax
+     ae9:	0f be c0             	movsbl %al,%eax
+     aec:	83 ec 08             	sub    $0x8,%esp
+     aef:	50                   	push   %eax
+     af0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     af6:	50                   	push   %eax
+     af7:	e8 58 fd ff ff       	call   854 <putc>
+     afc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     aff:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b03:	eb 4e                	jmp    b53 <printf+0x1b7>
+      } else if(c == '%'){
+     b05:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b09:	75 1b                	jne    b26 <printf+0x18a>
+        putc(&o, c);
+     b0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b0e:	0f be c0             	movsbl %al,%eax
+     b11:	83 ec 08             	sub    $0x8,%esp
+     b14:	50                   	push   %eax
+     b15:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b1b:	50                   	push   %eax
+     b1c:	e8 33 fd ff ff       	call   854 <putc>
+     b21:	83 c4 10             	add    $0x10,%esp
+     b24:	eb 2d                	jmp    b53 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b26:	83 ec 08             	sub    $0x8,%esp
+     b29:	6a 25                	push   $0x25
+     b2b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b31:	50                   	push   %eax
+     b32:	e8 1d fd ff ff       	call   854 <putc>
+     b37:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b3a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b3d:	0f be c0             	movsbl %al,%eax
+     b40:	83 ec 08             	sub    $0x8,%esp
+     b43:	50                   	push   %eax
+     b44:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b4a:	50                   	push   %eax
+     b4b:	e8 04 fd ff ff       	call   854 <putc>
+     b50:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b53:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     b5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b5d:	83 c0 01             	add    $0x1,%eax
+     b60:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b63:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b67:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b6d:	01 d0                	add    %edx,%eax
+     b6f:	0f b6 00             	movzbl (%eax),%eax
+     b72:	84 c0                	test   %al,%al
+     b74:	0f 85 6b fe ff ff    	jne    9e5 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     b7a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b7e:	75 22                	jne    ba2 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     b80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b83:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     b86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     b89:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     b8c:	01 ca                	add    %ecx,%edx
+     b8e:	83 ec 04             	sub    $0x4,%esp
+     b91:	50                   	push   %eax
+     b92:	52                   	push   %edx
+     b93:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b99:	50                   	push   %eax
+     b9a:	e8 c4 fb ff ff       	call   763 <put>
+     b9f:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     ba2:	83 ec 0c             	sub    $0xc,%esp
+     ba5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bab:	50                   	push   %eax
+     bac:	e8 69 fb ff ff       	call   71a <flush>
+     bb1:	83 c4 10             	add    $0x10,%esp
+}
+     bb4:	90                   	nop
+     bb5:	c9                   	leave
+     bb6:	c3                   	ret
+
+00000bb7 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     bb7:	55                   	push   %ebp
+     bb8:	89 e5                	mov    %esp,%ebp
+     bba:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     bbd:	8b 55 08             	mov    0x8(%ebp),%edx
+     bc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bc3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     bc6:	f0 87 02             	lock xchg %eax,(%edx)
+     bc9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     bcc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     bcf:	c9                   	leave
+     bd0:	c3                   	ret
+
+00000bd1 <lock>:
+{
+     bd1:	55                   	push   %ebp
+     bd2:	89 e5                	mov    %esp,%ebp
+     bd4:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     bd7:	a1 70 14 00 00       	mov    0x1470,%eax
+     bdc:	85 c0                	test   %eax,%eax
+     bde:	74 09                	je     be9 <lock+0x18>
+     be0:	a1 70 14 00 00       	mov    0x1470,%eax
+     be5:	ff d0                	call   *%eax
+     be7:	eb 05                	jmp    bee <lock+0x1d>
+     be9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     bf1:	90                   	nop
+     bf2:	83 ec 08             	sub    $0x8,%esp
+     bf5:	6a 01                	push   $0x1
+     bf7:	68 a8 14 00 00       	push   $0x14a8
+     bfc:	e8 b6 ff ff ff       	call   bb7 <xchg>
+     c01:	83 c4 10             	add    $0x10,%esp
+     c04:	85 c0                	test   %eax,%eax
+     c06:	75 ea                	jne    bf2 <lock+0x21>
+  return pin;
+     c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c0b:	c9                   	leave
+     c0c:	c3                   	ret
+
+00000c0d <unlock>:
+{
+     c0d:	55                   	push   %ebp
+     c0e:	89 e5                	mov    %esp,%ebp
+     c10:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c13:	6a 00                	push   $0x0
+     c15:	68 a8 14 00 00       	push   $0x14a8
+     c1a:	e8 98 ff ff ff       	call   bb7 <xchg>
+     c1f:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c22:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c26:	78 10                	js     c38 <unlock+0x2b>
+    mallocunpin(pin);
+     c28:	a1 74 14 00 00       	mov    0x1474,%eax
+     c2d:	83 ec 0c             	sub    $0xc,%esp
+     c30:	ff 75 08             	push   0x8(%ebp)
+     c33:	ff d0                	call   *%eax
+     c35:	83 c4 10             	add    $0x10,%esp
+}
+     c38:	90                   	nop
+     c39:	c9                   	leave
+     c3a:	c3                   	ret
+
+00000c3b <sizeclass>:
+{
+     c3b:	55                   	push   %ebp
+     c3c:	89 e5                	mov    %esp,%ebp
+     c3e:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c48:	eb 1c                	jmp    c66 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     c4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c4d:	ba 02 00 00 00       	mov    $0x2,%edx
+     c52:	89 c1                	mov    %eax,%ecx
+     c54:	d3 e2                	shl    %cl,%edx
+     c56:	89 d0                	mov    %edx,%eax
+     c58:	3b 45 08             	cmp    0x8(%ebp),%eax
+     c5b:	72 05                	jb     c62 <sizeclass+0x27>
+      return c;
+     c5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c60:	eb 0f                	jmp    c71 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     c62:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     c66:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     c6a:	7e de                	jle    c4a <sizeclass+0xf>
+  return -1;
+     c6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     c71:	c9                   	leave
+     c72:	c3                   	ret
+
+00000c73 <bigfree>:
+{
+     c73:	55                   	push   %ebp
+     c74:	89 e5                	mov    %esp,%ebp
+     c76:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c79:	a1 80 14 00 00       	mov    0x1480,%eax
+     c7e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     c81:	eb 24                	jmp    ca7 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c86:	8b 00                	mov    (%eax),%eax
+     c88:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     c8b:	72 12                	jb     c9f <bigfree+0x2c>
+     c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c90:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     c93:	72 24                	jb     cb9 <bigfree+0x46>
+     c95:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c98:	8b 00                	mov    (%eax),%eax
+     c9a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     c9d:	72 1a                	jb     cb9 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ca2:	8b 00                	mov    (%eax),%eax
+     ca4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+     caa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cad:	73 d4                	jae    c83 <bigfree+0x10>
+     caf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cb2:	8b 00                	mov    (%eax),%eax
+     cb4:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cb7:	73 ca                	jae    c83 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+     cbc:	8b 40 04             	mov    0x4(%eax),%eax
+     cbf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc9:	01 c2                	add    %eax,%edx
+     ccb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cce:	8b 00                	mov    (%eax),%eax
+     cd0:	39 c2                	cmp    %eax,%edx
+     cd2:	75 24                	jne    cf8 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd7:	8b 50 04             	mov    0x4(%eax),%edx
+     cda:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cdd:	8b 00                	mov    (%eax),%eax
+     cdf:	8b 40 04             	mov    0x4(%eax),%eax
+     ce2:	01 c2                	add    %eax,%edx
+     ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     cea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ced:	8b 00                	mov    (%eax),%eax
+     cef:	8b 10                	mov    (%eax),%edx
+     cf1:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf4:	89 10                	mov    %edx,(%eax)
+     cf6:	eb 0a                	jmp    d02 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     cf8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cfb:	8b 10                	mov    (%eax),%edx
+     cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+     d00:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d05:	8b 40 04             	mov    0x4(%eax),%eax
+     d08:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d12:	01 d0                	add    %edx,%eax
+     d14:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d17:	75 20                	jne    d39 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d1c:	8b 50 04             	mov    0x4(%eax),%edx
+     d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d22:	8b 40 04             	mov    0x4(%eax),%eax
+     d25:	01 c2                	add    %eax,%edx
+     d27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d2a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d2d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d30:	8b 10                	mov    (%eax),%edx
+     d32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d35:	89 10                	mov    %edx,(%eax)
+     d37:	eb 08                	jmp    d41 <bigfree+0xce>
+    p->s.ptr = bp;
+     d39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d3c:	8b 55 08             	mov    0x8(%ebp),%edx
+     d3f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d44:	a3 80 14 00 00       	mov    %eax,0x1480
+}
+     d49:	90                   	nop
+     d4a:	c9                   	leave
+     d4b:	c3                   	ret
+
+00000d4c <free>:
+{
+     d4c:	55                   	push   %ebp
+     d4d:	89 e5                	mov    %esp,%ebp
+     d4f:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     d52:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d56:	74 68                	je     dc0 <free+0x74>
+  bp = (Header*)ap - 1;
+     d58:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5b:	83 e8 08             	sub    $0x8,%eax
+     d5e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     d61:	e8 6b fe ff ff       	call   bd1 <lock>
+     d66:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     d69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d6c:	8b 40 04             	mov    0x4(%eax),%eax
+     d6f:	83 ec 0c             	sub    $0xc,%esp
+     d72:	50                   	push   %eax
+     d73:	e8 c3 fe ff ff       	call   c3b <sizeclass>
+     d78:	83 c4 10             	add    $0x10,%esp
+     d7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     d7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d82:	78 1e                	js     da2 <free+0x56>
+    bp->s.ptr = classfree[c];
+     d84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d87:	8b 14 85 84 14 00 00 	mov    0x1484(,%eax,4),%edx
+     d8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d91:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     d93:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     d99:	89 14 85 84 14 00 00 	mov    %edx,0x1484(,%eax,4)
+     da0:	eb 0e                	jmp    db0 <free+0x64>
+    bigfree(bp);
+     da2:	83 ec 0c             	sub    $0xc,%esp
+     da5:	ff 75 f4             	push   -0xc(%ebp)
+     da8:	e8 c6 fe ff ff       	call   c73 <bigfree>
+     dad:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     db0:	83 ec 0c             	sub    $0xc,%esp
+     db3:	ff 75 f0             	push   -0x10(%ebp)
+     db6:	e8 52 fe ff ff       	call   c0d <unlock>
+     dbb:	83 c4 10             	add    $0x10,%esp
+     dbe:	eb 01                	jmp    dc1 <free+0x75>
+    return;
+     dc0:	90                   	nop
+}
+     dc1:	c9                   	leave
+     dc2:	c3                   	ret
+
+00000dc3 <morecore>:
+{
+     dc3:	55                   	push   %ebp
+     dc4:	89 e5                	mov    %esp,%ebp
+     dc6:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     dc9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     dd0:	77 07                	ja     dd9 <morecore+0x16>
+    nu = 4096;
+     dd2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddc:	c1 e0 03             	shl    $0x3,%eax
+     ddf:	83 ec 0c             	sub    $0xc,%esp
+     de2:	50                   	push   %eax
+     de3:	e8 b6 f7 ff ff       	call   59e <sbrk>
+     de8:	83 c4 10             	add    $0x10,%esp
+     deb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     dee:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     df2:	75 07                	jne    dfb <morecore+0x38>
+    return 0;
+     df4:	b8 00 00 00 00       	mov    $0x0,%eax
+     df9:	eb 22                	jmp    e1d <morecore+0x5a>
+  hp = (Header*)p;
+     dfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dfe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e04:	8b 55 08             	mov    0x8(%ebp),%edx
+     e07:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e0a:	83 ec 0c             	sub    $0xc,%esp
+     e0d:	ff 75 f0             	push   -0x10(%ebp)
+     e10:	e8 5e fe ff ff       	call   c73 <bigfree>
+     e15:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e18:	a1 80 14 00 00       	mov    0x1480,%eax
+}
+     e1d:	c9                   	leave
+     e1e:	c3                   	ret
+
+00000e1f <bigalloc>:
+{
+     e1f:	55                   	push   %ebp
+     e20:	89 e5                	mov    %esp,%ebp
+     e22:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e25:	a1 80 14 00 00       	mov    0x1480,%eax
+     e2a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e2d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e31:	75 23                	jne    e56 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e33:	c7 45 f0 78 14 00 00 	movl   $0x1478,-0x10(%ebp)
+     e3a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e3d:	a3 80 14 00 00       	mov    %eax,0x1480
+     e42:	a1 80 14 00 00       	mov    0x1480,%eax
+     e47:	a3 78 14 00 00       	mov    %eax,0x1478
+    base.s.size = 0;
+     e4c:	c7 05 7c 14 00 00 00 	movl   $0x0,0x147c
+     e53:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e59:	8b 00                	mov    (%eax),%eax
+     e5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     e5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e61:	8b 40 04             	mov    0x4(%eax),%eax
+     e64:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e67:	72 4a                	jb     eb3 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6c:	8b 40 04             	mov    0x4(%eax),%eax
+     e6f:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e72:	75 0c                	jne    e80 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     e74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e77:	8b 10                	mov    (%eax),%edx
+     e79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e7c:	89 10                	mov    %edx,(%eax)
+     e7e:	eb 26                	jmp    ea6 <bigalloc+0x87>
+        p->s.size -= nunits;
+     e80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e83:	8b 40 04             	mov    0x4(%eax),%eax
+     e86:	2b 45 08             	sub    0x8(%ebp),%eax
+     e89:	89 c2                	mov    %eax,%edx
+     e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     e91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e94:	8b 40 04             	mov    0x4(%eax),%eax
+     e97:	c1 e0 03             	shl    $0x3,%eax
+     e9a:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+     ea3:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     ea6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ea9:	a3 80 14 00 00       	mov    %eax,0x1480
+      return p;
+     eae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb1:	eb 3b                	jmp    eee <bigalloc+0xcf>
+    if(p == freep)
+     eb3:	a1 80 14 00 00       	mov    0x1480,%eax
+     eb8:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     ebb:	75 1e                	jne    edb <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     ebd:	83 ec 0c             	sub    $0xc,%esp
+     ec0:	ff 75 08             	push   0x8(%ebp)
+     ec3:	e8 fb fe ff ff       	call   dc3 <morecore>
+     ec8:	83 c4 10             	add    $0x10,%esp
+     ecb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ece:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ed2:	75 07                	jne    edb <bigalloc+0xbc>
+        return 0;
+     ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed9:	eb 13                	jmp    eee <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     edb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ede:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee4:	8b 00                	mov    (%eax),%eax
+     ee6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     ee9:	e9 70 ff ff ff       	jmp    e5e <bigalloc+0x3f>
+}
+     eee:	c9                   	leave
+     eef:	c3                   	ret
+
+00000ef0 <alloc>:
+alloc(uint nbytes)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef9:	83 c0 07             	add    $0x7,%eax
+     efc:	c1 e8 03             	shr    $0x3,%eax
+     eff:	83 c0 01             	add    $0x1,%eax
+     f02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f05:	ff 75 f4             	push   -0xc(%ebp)
+     f08:	e8 2e fd ff ff       	call   c3b <sizeclass>
+     f0d:	83 c4 04             	add    $0x4,%esp
+     f10:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f13:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f17:	79 2c                	jns    f45 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f19:	83 ec 0c             	sub    $0xc,%esp
+     f1c:	ff 75 f4             	push   -0xc(%ebp)
+     f1f:	e8 fb fe ff ff       	call   e1f <bigalloc>
+     f24:	83 c4 10             	add    $0x10,%esp
+     f27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f2e:	75 0a                	jne    f3a <alloc+0x4a>
+      return 0;
+     f30:	b8 00 00 00 00       	mov    $0x0,%eax
+     f35:	e9 c8 00 00 00       	jmp    1002 <alloc+0x112>
+    return (void*)(p + 1);
+     f3a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f3d:	83 c0 08             	add    $0x8,%eax
+     f40:	e9 bd 00 00 00       	jmp    1002 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f48:	8b 04 85 84 14 00 00 	mov    0x1484(,%eax,4),%eax
+     f4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f52:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f56:	74 1a                	je     f72 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     f58:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f5b:	8b 10                	mov    (%eax),%edx
+     f5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f60:	89 14 85 84 14 00 00 	mov    %edx,0x1484(,%eax,4)
+    return (void*)(p + 1);
+     f67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f6a:	83 c0 08             	add    $0x8,%eax
+     f6d:	e9 90 00 00 00       	jmp    1002 <alloc+0x112>
+  }
+  nunits = 2 << c;
+     f72:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f75:	ba 02 00 00 00       	mov    $0x2,%edx
+     f7a:	89 c1                	mov    %eax,%ecx
+     f7c:	d3 e2                	shl    %cl,%edx
+     f7e:	89 d0                	mov    %edx,%eax
+     f80:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     f83:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     f88:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f8b:	c1 e2 03             	shl    $0x3,%edx
+     f8e:	01 d0                	add    %edx,%eax
+     f90:	8b 15 a4 14 00 00    	mov    0x14a4,%edx
+     f96:	39 c2                	cmp    %eax,%edx
+     f98:	73 3f                	jae    fd9 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     f9a:	83 ec 0c             	sub    $0xc,%esp
+     f9d:	68 00 08 00 00       	push   $0x800
+     fa2:	e8 78 fe ff ff       	call   e1f <bigalloc>
+     fa7:	83 c4 10             	add    $0x10,%esp
+     faa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fb1:	75 07                	jne    fba <alloc+0xca>
+      return 0;
+     fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+     fb8:	eb 48                	jmp    1002 <alloc+0x112>
+    bump = (char*)p;
+     fba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fbd:	a3 a0 14 00 00       	mov    %eax,0x14a0
+    bumpend = (char*)(p + p->s.size);
+     fc2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc5:	8b 40 04             	mov    0x4(%eax),%eax
+     fc8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     fcf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fd2:	01 d0                	add    %edx,%eax
+     fd4:	a3 a4 14 00 00       	mov    %eax,0x14a4
+  }
+  p = (Header*)bump;
+     fd9:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     fde:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+     fe1:	a1 a0 14 00 00       	mov    0x14a0,%eax
+     fe6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fe9:	c1 e2 03             	shl    $0x3,%edx
+     fec:	01 d0                	add    %edx,%eax
+     fee:	a3 a0 14 00 00       	mov    %eax,0x14a0
+  p->s.size = nunits;
+     ff3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ff9:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+     ffc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fff:	83 c0 08             	add    $0x8,%eax
+}
+    1002:	c9                   	leave
+    1003:	c3                   	ret
+
+00001004 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1004:	55                   	push   %ebp
+    1005:	89 e5                	mov    %esp,%ebp
+    1007:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    100a:	e8 c2 fb ff ff       	call   bd1 <lock>
+    100f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1012:	83 ec 0c             	sub    $0xc,%esp
+    1015:	ff 75 08             	push   0x8(%ebp)
+    1018:	e8 d3 fe ff ff       	call   ef0 <alloc>
+    101d:	83 c4 10             	add    $0x10,%esp
+    1020:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1023:	83 ec 0c             	sub    $0xc,%esp
+    1026:	ff 75 f4             	push   -0xc(%ebp)
+    1029:	e8 df fb ff ff       	call   c0d <unlock>
+    102e:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1031:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1034:	c9                   	leave
+    1035:	c3                   	ret
@@ -0,0 +1,65 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "uio.h"
+
+#define TEST_FILE "/iov_file"
+
+static int
+same(char *p, char *q, int n)
+{
+  while(n-- > 0)
+    if(*p++ != *q++)
+      return 0;
+  return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iovec iov[3];
+  char a[4], b[600], c[8];
+  int fd, i;
+
+  iov[0].iov_base = "abc";
+  iov[0].iov_len = 3;
+  memset(b, 'x', sizeof(b));
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  iov[2].iov_base = "defgh";
+  iov[2].iov_len = 5;
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || writev(fd, iov, 3) != 608){
+    printf(1, "error: writev\n");
+    exit();
+  }
+  close(fd);
+
+  memset(b, 0, sizeof(b));
+  iov[0].iov_base = a;
+  iov[0].iov_len = 3;
+  iov[2].iov_base = c;
+  iov[2].iov_len = sizeof(c);
+  fd = open(TEST_FILE, O_RDONLY);
+  if(readv(fd, iov, 3) != 608 || !same(a, "abc", 3) || !same(c, "defgh", 5)){
+    printf(1, "error: readv\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(b); i++){
+    if(b[i] != 'x'){
+      printf(1, "wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink(TEST_FILE);
+
+  iov[0].iov_base = (void*)0x7fffffff;
+  if(readv(0, iov, 1) != -1){
+    printf(1, "error: bad iovec accepted\n");
+    exit();
+  }
+  printf(1, "%s %d %x%c\n", "iov", 123, 0xabc, '!');
+  printf(1, "iov ok\n");
+  exit();
+}
@@ -0,0 +1,2686 @@
+
+_test_kthread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <adder>:
+int mutex, cond;
+volatile int counter, ready;
+
+void*
+adder()
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < ROUNDS; i++){
+       6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+       d:	eb 33                	jmp    42 <adder+0x42>
+    kthread_mutex_lock(mutex);
+       f:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+      14:	83 ec 0c             	sub    $0xc,%esp
+      17:	50                   	push   %eax
+      18:	e8 db 12 00 00       	call   12f8 <kthread_mutex_lock>
+      1d:	83 c4 10             	add    $0x10,%esp
+    counter++;
+      20:	a1 e8 1b 00 00       	mov    0x1be8,%eax
+      25:	83 c0 01             	add    $0x1,%eax
+      28:	a3 e8 1b 00 00       	mov    %eax,0x1be8
+    kthread_mutex_unlock(mutex);
+      2d:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+      32:	83 ec 0c             	sub    $0xc,%esp
+      35:	50                   	push   %eax
+      36:	e8 0e 13 00 00       	call   1349 <kthread_mutex_unlock>
+      3b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < ROUNDS; i++){
+      3e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      42:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+      49:	7e c4                	jle    f <adder+0xf>
+  }
+  kthread_exit();
+      4b:	e8 35 07 00 00       	call   785 <kthread_exit>
+  return 0;
+      50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      55:	c9                   	leave
+      56:	c3                   	ret
+
+00000057 <waiter>:
+
+void*
+waiter()
+{
+      57:	55                   	push   %ebp
+      58:	89 e5                	mov    %esp,%ebp
+      5a:	83 ec 08             	sub    $0x8,%esp
+  kthread_mutex_lock(mutex);
+      5d:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+      62:	83 ec 0c             	sub    $0xc,%esp
+      65:	50                   	push   %eax
+      66:	e8 8d 12 00 00       	call   12f8 <kthread_mutex_lock>
+      6b:	83 c4 10             	add    $0x10,%esp
+  while(!ready)
+      6e:	eb 18                	jmp    88 <waiter+0x31>
+    kthread_cond_wait(cond, mutex);
+      70:	8b 15 e0 1b 00 00    	mov    0x1be0,%edx
+      76:	a1 e4 1b 00 00       	mov    0x1be4,%eax
+      7b:	83 ec 08             	sub    $0x8,%esp
+      7e:	52                   	push   %edx
+      7f:	50                   	push   %eax
+      80:	e8 c9 13 00 00       	call   144e <kthread_cond_wait>
+      85:	83 c4 10             	add    $0x10,%esp
+  while(!ready)
+      88:	a1 ec 1b 00 00       	mov    0x1bec,%eax
+      8d:	85 c0                	test   %eax,%eax
+      8f:	74 df                	je     70 <waiter+0x19>
+  kthread_mutex_unlock(mutex);
+      91:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+      96:	83 ec 0c             	sub    $0xc,%esp
+      99:	50                   	push   %eax
+      9a:	e8 aa 12 00 00       	call   1349 <kthread_mutex_unlock>
+      9f:	83 c4 10             	add    $0x10,%esp
+  kthread_exit();
+      a2:	e8 de 06 00 00       	call   785 <kthread_exit>
+  return 0;
+      a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      ac:	c9                   	leave
+      ad:	c3                   	ret
+
+000000ae <main>:
+
+int
+main(int argc, char *argv[])
+{
+      ae:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      b2:	83 e4 f0             	and    $0xfffffff0,%esp
+      b5:	ff 71 fc             	push   -0x4(%ecx)
+      b8:	55                   	push   %ebp
+      b9:	89 e5                	mov    %esp,%ebp
+      bb:	51                   	push   %ecx
+      bc:	83 ec 24             	sub    $0x24,%esp
+  int i, tid[NTHREAD];
+
+  if((mutex = kthread_mutex_alloc()) < 0 || (cond = kthread_cond_alloc()) < 0){
+      bf:	e8 a0 11 00 00       	call   1264 <kthread_mutex_alloc>
+      c4:	a3 e0 1b 00 00       	mov    %eax,0x1be0
+      c9:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+      ce:	85 c0                	test   %eax,%eax
+      d0:	78 13                	js     e5 <main+0x37>
+      d2:	e8 c8 12 00 00       	call   139f <kthread_cond_alloc>
+      d7:	a3 e4 1b 00 00       	mov    %eax,0x1be4
+      dc:	a1 e4 1b 00 00       	mov    0x1be4,%eax
+      e1:	85 c0                	test   %eax,%eax
+      e3:	79 17                	jns    fc <main+0x4e>
+    printf(1, "error: alloc\n");
+      e5:	83 ec 08             	sub    $0x8,%esp
+      e8:	68 68 15 00 00       	push   $0x1568
+      ed:	6a 01                	push   $0x1
+      ef:	e8 c7 09 00 00       	call   abb <printf>
+      f4:	83 c4 10             	add    $0x10,%esp
+    exit();
+      f7:	e8 2f 05 00 00       	call   62b <exit>
+  }
+
+  // Threads share memory: the counter sees every increment.
+  for(i = 0; i < NTHREAD; i++){
+      fc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     103:	eb 53                	jmp    158 <main+0xaa>
+    if((tid[i] = kthread_create(adder, malloc(MAX_STACK_SIZE), MAX_STACK_SIZE)) < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 a0 0f 00 00       	push   $0xfa0
+     10d:	e8 11 10 00 00       	call   1123 <malloc>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	83 ec 04             	sub    $0x4,%esp
+     118:	68 a0 0f 00 00       	push   $0xfa0
+     11d:	50                   	push   %eax
+     11e:	68 00 00 00 00       	push   $0x0
+     123:	e8 49 06 00 00       	call   771 <kthread_create>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     12e:	89 44 95 e4          	mov    %eax,-0x1c(%ebp,%edx,4)
+     132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     135:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+     139:	85 c0                	test   %eax,%eax
+     13b:	79 17                	jns    154 <main+0xa6>
+      printf(1, "error: kthread_create\n");
+     13d:	83 ec 08             	sub    $0x8,%esp
+     140:	68 76 15 00 00       	push   $0x1576
+     145:	6a 01                	push   $0x1
+     147:	e8 6f 09 00 00       	call   abb <printf>
+     14c:	83 c4 10             	add    $0x10,%esp
+      exit();
+     14f:	e8 d7 04 00 00       	call   62b <exit>
+  for(i = 0; i < NTHREAD; i++){
+     154:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     158:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     15c:	7e a7                	jle    105 <main+0x57>
+    }
+  }
+  for(i = 0; i < NTHREAD; i++){
+     15e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     165:	eb 32                	jmp    199 <main+0xeb>
+    if(kthread_join(tid[i]) < 0){
+     167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     16a:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+     16e:	83 ec 0c             	sub    $0xc,%esp
+     171:	50                   	push   %eax
+     172:	e8 18 06 00 00       	call   78f <kthread_join>
+     177:	83 c4 10             	add    $0x10,%esp
+     17a:	85 c0                	test   %eax,%eax
+     17c:	79 17                	jns    195 <main+0xe7>
+      printf(1, "error: kthread_join\n");
+     17e:	83 ec 08             	sub    $0x8,%esp
+     181:	68 8d 15 00 00       	push   $0x158d
+     186:	6a 01                	push   $0x1
+     188:	e8 2e 09 00 00       	call   abb <printf>
+     18d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     190:	e8 96 04 00 00       	call   62b <exit>
+  for(i = 0; i < NTHREAD; i++){
+     195:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     199:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     19d:	7e c8                	jle    167 <main+0xb9>
+    }
+  }
+  if(counter != NTHREAD*ROUNDS){
+     19f:	a1 e8 1b 00 00       	mov    0x1be8,%eax
+     1a4:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+     1a9:	74 1f                	je     1ca <main+0x11c>
+    printf(1, "error: counter %d, not %d\n", counter, NTHREAD*ROUNDS);
+     1ab:	a1 e8 1b 00 00       	mov    0x1be8,%eax
+     1b0:	68 a0 0f 00 00       	push   $0xfa0
+     1b5:	50                   	push   %eax
+     1b6:	68 a2 15 00 00       	push   $0x15a2
+     1bb:	6a 01                	push   $0x1
+     1bd:	e8 f9 08 00 00       	call   abb <printf>
+     1c2:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1c5:	e8 61 04 00 00       	call   62b <exit>
+  }
+  if(kthread_join(tid[0]) != -1 || kthread_join(kthread_id()) != -1){
+     1ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1cd:	83 ec 0c             	sub    $0xc,%esp
+     1d0:	50                   	push   %eax
+     1d1:	e8 b9 05 00 00       	call   78f <kthread_join>
+     1d6:	83 c4 10             	add    $0x10,%esp
+     1d9:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1dc:	75 16                	jne    1f4 <main+0x146>
+     1de:	e8 98 05 00 00       	call   77b <kthread_id>
+     1e3:	83 ec 0c             	sub    $0xc,%esp
+     1e6:	50                   	push   %eax
+     1e7:	e8 a3 05 00 00       	call   78f <kthread_join>
+     1ec:	83 c4 10             	add    $0x10,%esp
+     1ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1f2:	74 17                	je     20b <main+0x15d>
+    printf(1, "error: bad join accepted\n");
+     1f4:	83 ec 08             	sub    $0x8,%esp
+     1f7:	68 bd 15 00 00       	push   $0x15bd
+     1fc:	6a 01                	push   $0x1
+     1fe:	e8 b8 08 00 00       	call   abb <printf>
+     203:	83 c4 10             	add    $0x10,%esp
+    exit();
+     206:	e8 20 04 00 00       	call   62b <exit>
+  }
+  printf(1, "mutex ok\n");
+     20b:	83 ec 08             	sub    $0x8,%esp
+     20e:	68 d7 15 00 00       	push   $0x15d7
+     213:	6a 01                	push   $0x1
+     215:	e8 a1 08 00 00       	call   abb <printf>
+     21a:	83 c4 10             	add    $0x10,%esp
+
+  if((tid[0] = kthread_create(waiter, malloc(MAX_STACK_SIZE), MAX_STACK_SIZE)) < 0){
+     21d:	83 ec 0c             	sub    $0xc,%esp
+     220:	68 a0 0f 00 00       	push   $0xfa0
+     225:	e8 f9 0e 00 00       	call   1123 <malloc>
+     22a:	83 c4 10             	add    $0x10,%esp
+     22d:	83 ec 04             	sub    $0x4,%esp
+     230:	68 a0 0f 00 00       	push   $0xfa0
+     235:	50                   	push   %eax
+     236:	68 57 00 00 00       	push   $0x57
+     23b:	e8 31 05 00 00       	call   771 <kthread_create>
+     240:	83 c4 10             	add    $0x10,%esp
+     243:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     246:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     249:	85 c0                	test   %eax,%eax
+     24b:	79 17                	jns    264 <main+0x1b6>
+    printf(1, "error: kthread_create\n");
+     24d:	83 ec 08             	sub    $0x8,%esp
+     250:	68 76 15 00 00       	push   $0x1576
+     255:	6a 01                	push   $0x1
+     257:	e8 5f 08 00 00       	call   abb <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 c7 03 00 00       	call   62b <exit>
+  }
+  sleep(10);
+     264:	83 ec 0c             	sub    $0xc,%esp
+     267:	6a 0a                	push   $0xa
+     269:	e8 59 04 00 00       	call   6c7 <sleep>
+     26e:	83 c4 10             	add    $0x10,%esp
+  kthread_mutex_lock(mutex);
+     271:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+     276:	83 ec 0c             	sub    $0xc,%esp
+     279:	50                   	push   %eax
+     27a:	e8 79 10 00 00       	call   12f8 <kthread_mutex_lock>
+     27f:	83 c4 10             	add    $0x10,%esp
+  ready = 1;
+     282:	c7 05 ec 1b 00 00 01 	movl   $0x1,0x1bec
+     289:	00 00 00 
+  kthread_cond_signal(cond);
+     28c:	a1 e4 1b 00 00       	mov    0x1be4,%eax
+     291:	83 ec 0c             	sub    $0xc,%esp
+     294:	50                   	push   %eax
+     295:	e8 75 12 00 00       	call   150f <kthread_cond_signal>
+     29a:	83 c4 10             	add    $0x10,%esp
+  kthread_mutex_unlock(mutex);
+     29d:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+     2a2:	83 ec 0c             	sub    $0xc,%esp
+     2a5:	50                   	push   %eax
+     2a6:	e8 9e 10 00 00       	call   1349 <kthread_mutex_unlock>
+     2ab:	83 c4 10             	add    $0x10,%esp
+  if(kthread_join(tid[0]) < 0){
+     2ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2b1:	83 ec 0c             	sub    $0xc,%esp
+     2b4:	50                   	push   %eax
+     2b5:	e8 d5 04 00 00       	call   78f <kthread_join>
+     2ba:	83 c4 10             	add    $0x10,%esp
+     2bd:	85 c0                	test   %eax,%eax
+     2bf:	79 17                	jns    2d8 <main+0x22a>
+    printf(1, "error: cond join\n");
+     2c1:	83 ec 08             	sub    $0x8,%esp
+     2c4:	68 e1 15 00 00       	push   $0x15e1
+     2c9:	6a 01                	push   $0x1
+     2cb:	e8 eb 07 00 00       	call   abb <printf>
+     2d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2d3:	e8 53 03 00 00       	call   62b <exit>
+  }
+  if(kthread_mutex_dealloc(mutex) < 0 || kthread_cond_dealloc(cond) < 0){
+     2d8:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+     2dd:	83 ec 0c             	sub    $0xc,%esp
+     2e0:	50                   	push   %eax
+     2e1:	e8 cb 0f 00 00       	call   12b1 <kthread_mutex_dealloc>
+     2e6:	83 c4 10             	add    $0x10,%esp
+     2e9:	85 c0                	test   %eax,%eax
+     2eb:	78 15                	js     302 <main+0x254>
+     2ed:	a1 e4 1b 00 00       	mov    0x1be4,%eax
+     2f2:	83 ec 0c             	sub    $0xc,%esp
+     2f5:	50                   	push   %eax
+     2f6:	e8 17 11 00 00       	call   1412 <kthread_cond_dealloc>
+     2fb:	83 c4 10             	add    $0x10,%esp
+     2fe:	85 c0                	test   %eax,%eax
+     300:	79 17                	jns    319 <main+0x26b>
+    printf(1, "error: dealloc\n");
+     302:	83 ec 08             	sub    $0x8,%esp
+     305:	68 f3 15 00 00       	push   $0x15f3
+     30a:	6a 01                	push   $0x1
+     30c:	e8 aa 07 00 00       	call   abb <printf>
+     311:	83 c4 10             	add    $0x10,%esp
+    exit();
+     314:	e8 12 03 00 00       	call   62b <exit>
+  }
+  printf(1, "cond ok\n");
+     319:	83 ec 08             	sub    $0x8,%esp
+     31c:	68 03 16 00 00       	push   $0x1603
+     321:	6a 01                	push   $0x1
+     323:	e8 93 07 00 00       	call   abb <printf>
+     328:	83 c4 10             	add    $0x10,%esp
+
+  // A futex wait returns at once if the word has moved on.
+  counter = 0;
+     32b:	c7 05 e8 1b 00 00 00 	movl   $0x0,0x1be8
+     332:	00 00 00 
+  if(futex((int*)&counter, FUTEX_WAIT, 1) != -1 || futex((int*)&counter, FUTEX_WAKE, 1) != 0){
+     335:	83 ec 04             	sub    $0x4,%esp
+     338:	6a 01                	push   $0x1
+     33a:	6a 00                	push   $0x0
+     33c:	68 e8 1b 00 00       	push   $0x1be8
+     341:	e8 53 04 00 00       	call   799 <futex>
+     346:	83 c4 10             	add    $0x10,%esp
+     349:	83 f8 ff             	cmp    $0xffffffff,%eax
+     34c:	75 18                	jne    366 <main+0x2b8>
+     34e:	83 ec 04             	sub    $0x4,%esp
+     351:	6a 01                	push   $0x1
+     353:	6a 01                	push   $0x1
+     355:	68 e8 1b 00 00       	push   $0x1be8
+     35a:	e8 3a 04 00 00       	call   799 <futex>
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	85 c0                	test   %eax,%eax
+     364:	74 17                	je     37d <main+0x2cf>
+    printf(1, "error: futex\n");
+     366:	83 ec 08             	sub    $0x8,%esp
+     369:	68 0c 16 00 00       	push   $0x160c
+     36e:	6a 01                	push   $0x1
+     370:	e8 46 07 00 00       	call   abb <printf>
+     375:	83 c4 10             	add    $0x10,%esp
+    exit();
+     378:	e8 ae 02 00 00       	call   62b <exit>
+  }
+  printf(1, "futex ok\n");
+     37d:	83 ec 08             	sub    $0x8,%esp
+     380:	68 1a 16 00 00       	push   $0x161a
+     385:	6a 01                	push   $0x1
+     387:	e8 2f 07 00 00       	call   abb <printf>
+     38c:	83 c4 10             	add    $0x10,%esp
+  exit();
+     38f:	e8 97 02 00 00       	call   62b <exit>
+
+00000394 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     394:	55                   	push   %ebp
+     395:	89 e5                	mov    %esp,%ebp
+     397:	57                   	push   %edi
+     398:	53                   	push   %ebx
+    if(cc < 1)
+     399:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     39c:	8b 55 10             	mov    0x10(%ebp),%edx
+     39f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3a2:	89 cb                	mov    %ecx,%ebx
+     3a4:	89 df                	mov    %ebx,%edi
+     3a6:	89 d1                	mov    %edx,%ecx
+     3a8:	fc                   	cld
+     3a9:	f3 aa                	rep stos %al,%es:(%edi)
+     3ab:	89 ca                	mov    %ecx,%edx
+     3ad:	89 fb                	mov    %edi,%ebx
+     3af:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3b2:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     3b5:	90                   	nop
+     3b6:	5b                   	pop    %ebx
+     3b7:	5f                   	pop    %edi
+     3b8:	5d                   	pop    %ebp
+     3b9:	c3                   	ret
+
+000003ba <strcpy>:
+{
+     3ba:	55                   	push   %ebp
+     3bb:	89 e5                	mov    %esp,%ebp
+     3bd:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     3c6:	90                   	nop
+     3c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3ca:	8d 42 01             	lea    0x1(%edx),%eax
+     3cd:	89 45 0c             	mov    %eax,0xc(%ebp)
+     3d0:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d3:	8d 48 01             	lea    0x1(%eax),%ecx
+     3d6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     3d9:	0f b6 12             	movzbl (%edx),%edx
+     3dc:	88 10                	mov    %dl,(%eax)
+     3de:	0f b6 00             	movzbl (%eax),%eax
+     3e1:	84 c0                	test   %al,%al
+     3e3:	75 e2                	jne    3c7 <strcpy+0xd>
+  return os;
+     3e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     3e8:	c9                   	leave
+     3e9:	c3                   	ret
+
+000003ea <strcmp>:
+{
+     3ea:	55                   	push   %ebp
+     3eb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     3ed:	eb 08                	jmp    3f7 <strcmp+0xd>
+    p++, q++;
+     3ef:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     3f3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     3f7:	8b 45 08             	mov    0x8(%ebp),%eax
+     3fa:	0f b6 00             	movzbl (%eax),%eax
+     3fd:	84 c0                	test   %al,%al
+     3ff:	74 10                	je     411 <strcmp+0x27>
+     401:	8b 45 08             	mov    0x8(%ebp),%eax
+     404:	0f b6 10             	movzbl (%eax),%edx
+     407:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40a:	0f b6 00             	movzbl (%eax),%eax
+     40d:	38 c2                	cmp    %al,%dl
+     40f:	74 de                	je     3ef <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     411:	8b 45 08             	mov    0x8(%ebp),%eax
+     414:	0f b6 00             	movzbl (%eax),%eax
+     417:	0f b6 d0             	movzbl %al,%edx
+     41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41d:	0f b6 00             	movzbl (%eax),%eax
+     420:	0f b6 c0             	movzbl %al,%eax
+     423:	29 c2                	sub    %eax,%edx
+     425:	89 d0                	mov    %edx,%eax
+}
+     427:	5d                   	pop    %ebp
+     428:	c3                   	ret
+
+00000429 <strlen>:
+{
+     429:	55                   	push   %ebp
+     42a:	89 e5                	mov    %esp,%ebp
+     42c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     42f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     436:	eb 04                	jmp    43c <strlen+0x13>
+     438:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     43c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     43f:	8b 45 08             	mov    0x8(%ebp),%eax
+     442:	01 d0                	add    %edx,%eax
+     444:	0f b6 00             	movzbl (%eax),%eax
+     447:	84 c0                	test   %al,%al
+     449:	75 ed                	jne    438 <strlen+0xf>
+  return n;
+     44b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     44e:	c9                   	leave
+     44f:	c3                   	ret
+
+00000450 <memset>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     453:	8b 45 10             	mov    0x10(%ebp),%eax
+     456:	50                   	push   %eax
+     457:	ff 75 0c             	push   0xc(%ebp)
+     45a:	ff 75 08             	push   0x8(%ebp)
+     45d:	e8 32 ff ff ff       	call   394 <stosb>
+     462:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     465:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     468:	c9                   	leave
+     469:	c3                   	ret
+
+0000046a <strchr>:
+{
+     46a:	55                   	push   %ebp
+     46b:	89 e5                	mov    %esp,%ebp
+     46d:	83 ec 04             	sub    $0x4,%esp
+     470:	8b 45 0c             	mov    0xc(%ebp),%eax
+     473:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     476:	eb 14                	jmp    48c <strchr+0x22>
+    if(*s == c)
+     478:	8b 45 08             	mov    0x8(%ebp),%eax
+     47b:	0f b6 00             	movzbl (%eax),%eax
+     47e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     481:	75 05                	jne    488 <strchr+0x1e>
+      return (char*)s;
+     483:	8b 45 08             	mov    0x8(%ebp),%eax
+     486:	eb 13                	jmp    49b <strchr+0x31>
+  for(; *s; s++)
+     488:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     48c:	8b 45 08             	mov    0x8(%ebp),%eax
+     48f:	0f b6 00             	movzbl (%eax),%eax
+     492:	84 c0                	test   %al,%al
+     494:	75 e2                	jne    478 <strchr+0xe>
+  return 0;
+     496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     49b:	c9                   	leave
+     49c:	c3                   	ret
+
+0000049d <gets>:
+{
+     49d:	55                   	push   %ebp
+     49e:	89 e5                	mov    %esp,%ebp
+     4a0:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     4a3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4aa:	eb 42                	jmp    4ee <gets+0x51>
+    cc = read(0, &c, 1);
+     4ac:	83 ec 04             	sub    $0x4,%esp
+     4af:	6a 01                	push   $0x1
+     4b1:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     4b4:	50                   	push   %eax
+     4b5:	6a 00                	push   $0x0
+     4b7:	e8 84 01 00 00       	call   640 <read>
+     4bc:	83 c4 10             	add    $0x10,%esp
+     4bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     4c2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4c6:	7e 33                	jle    4fb <gets+0x5e>
+    buf[i++] = c;
+     4c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4cb:	8d 50 01             	lea    0x1(%eax),%edx
+     4ce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     4d1:	89 c2                	mov    %eax,%edx
+     4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d6:	01 c2                	add    %eax,%edx
+     4d8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     4dc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     4de:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     4e2:	3c 0a                	cmp    $0xa,%al
+     4e4:	74 16                	je     4fc <gets+0x5f>
+     4e6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     4ea:	3c 0d                	cmp    $0xd,%al
+     4ec:	74 0e                	je     4fc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     4ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f1:	83 c0 01             	add    $0x1,%eax
+     4f4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     4f7:	7f b3                	jg     4ac <gets+0xf>
+     4f9:	eb 01                	jmp    4fc <gets+0x5f>
+      break;
+     4fb:	90                   	nop
+  }
+  buf[i] = '\0';
+     4fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     502:	01 d0                	add    %edx,%eax
+     504:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     507:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+
+0000050c <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     50c:	55                   	push   %ebp
+     50d:	89 e5                	mov    %esp,%ebp
+     50f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     512:	83 ec 08             	sub    $0x8,%esp
+     515:	6a 00                	push   $0x0
+     517:	ff 75 08             	push   0x8(%ebp)
+     51a:	e8 44 01 00 00       	call   663 <open>
+     51f:	83 c4 10             	add    $0x10,%esp
+     522:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     525:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     529:	79 07                	jns    532 <stat+0x26>
+    return -1;
+     52b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     530:	eb 25                	jmp    557 <stat+0x4b>
+  r = fstat(fd, st);
+     532:	83 ec 08             	sub    $0x8,%esp
+     535:	ff 75 0c             	push   0xc(%ebp)
+     538:	ff 75 f4             	push   -0xc(%ebp)
+     53b:	e8 41 01 00 00       	call   681 <fstat>
+     540:	83 c4 10             	add    $0x10,%esp
+     543:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     546:	83 ec 0c             	sub    $0xc,%esp
+     549:	ff 75 f4             	push   -0xc(%ebp)
+     54c:	e8 fd 00 00 00       	call   64e <close>
+     551:	83 c4 10             	add    $0x10,%esp
+  return r;
+     554:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     557:	c9                   	leave
+     558:	c3                   	ret
+
+00000559 <atoi>:
+
+int
+atoi(const char *s)
+{
+     559:	55                   	push   %ebp
+     55a:	89 e5                	mov    %esp,%ebp
+     55c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     55f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     566:	eb 25                	jmp    58d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     568:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     56b:	89 d0                	mov    %edx,%eax
+     56d:	c1 e0 02             	shl    $0x2,%eax
+     570:	01 d0                	add    %edx,%eax
+     572:	01 c0                	add    %eax,%eax
+     574:	89 c1                	mov    %eax,%ecx
+     576:	8b 45 08             	mov    0x8(%ebp),%eax
+     579:	8d 50 01             	lea    0x1(%eax),%edx
+     57c:	89 55 08             	mov    %edx,0x8(%ebp)
+     57f:	0f b6 00             	movzbl (%eax),%eax
+     582:	0f be c0             	movsbl %al,%eax
+     585:	01 c8                	add    %ecx,%eax
+     587:	83 e8 30             	sub    $0x30,%eax
+     58a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     58d:	8b 45 08             	mov    0x8(%ebp),%eax
+     590:	0f b6 00             	movzbl (%eax),%eax
+     593:	3c 2f                	cmp    $0x2f,%al
+     595:	7e 0a                	jle    5a1 <atoi+0x48>
+     597:	8b 45 08             	mov    0x8(%ebp),%eax
+     59a:	0f b6 00             	movzbl (%eax),%eax
+     59d:	3c 39                	cmp    $0x39,%al
+     59f:	7e c7                	jle    568 <atoi+0xf>
+  return n;
+     5a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5a4:	c9                   	leave
+     5a5:	c3                   	ret
+
+000005a6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     5a6:	55                   	push   %ebp
+     5a7:	89 e5                	mov    %esp,%ebp
+     5a9:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     5ac:	8b 45 08             	mov    0x8(%ebp),%eax
+     5af:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     5b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5b5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     5b8:	eb 17                	jmp    5d1 <memmove+0x2b>
+    *dst++ = *src++;
+     5ba:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     5bd:	8d 42 01             	lea    0x1(%edx),%eax
+     5c0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     5c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5c6:	8d 48 01             	lea    0x1(%eax),%ecx
+     5c9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     5cc:	0f b6 12             	movzbl (%edx),%edx
+     5cf:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     5d1:	8b 45 10             	mov    0x10(%ebp),%eax
+     5d4:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5d7:	89 55 10             	mov    %edx,0x10(%ebp)
+     5da:	85 c0                	test   %eax,%eax
+     5dc:	7f dc                	jg     5ba <memmove+0x14>
+  return vdst;
+     5de:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5e1:	c9                   	leave
+     5e2:	c3                   	ret
+
+000005e3 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     5e3:	83 3d b4 1b 00 00 00 	cmpl   $0x0,0x1bb4
+  jg 2f
+     5ea:	7f 2e                	jg     61a <dosyscall+0x37>
+  jl 1f
+     5ec:	7c 29                	jl     617 <dosyscall+0x34>
+  pushl %eax
+     5ee:	50                   	push   %eax
+  pushl %ebx
+     5ef:	53                   	push   %ebx
+  movl $1, %eax
+     5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     5f5:	0f a2                	cpuid
+  popl %ebx
+     5f7:	5b                   	pop    %ebx
+  popl %eax
+     5f8:	58                   	pop    %eax
+  movl $-1, sysmode
+     5f9:	c7 05 b4 1b 00 00 ff 	movl   $0xffffffff,0x1bb4
+     600:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     603:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     609:	74 0c                	je     617 <dosyscall+0x34>
+  movl $1, sysmode
+     60b:	c7 05 b4 1b 00 00 01 	movl   $0x1,0x1bb4
+     612:	00 00 00 
+  jmp 2f
+     615:	eb 03                	jmp    61a <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     617:	cd 40                	int    $0x40
+  ret
+     619:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     61a:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     61c:	ba 23 06 00 00       	mov    $0x623,%edx
+  sysenter
+     621:	0f 34                	sysenter
+3:
+  ret
+     623:	c3                   	ret
+
+00000624 <fork>:
+
+SYSCALL(fork)
+     624:	b8 01 00 00 00       	mov    $0x1,%eax
+     629:	eb b8                	jmp    5e3 <dosyscall>
+
+0000062b <exit>:
+SYSCALL(exit)
+     62b:	b8 02 00 00 00       	mov    $0x2,%eax
+     630:	eb b1                	jmp    5e3 <dosyscall>
+
+00000632 <wait>:
+SYSCALL(wait)
+     632:	b8 03 00 00 00       	mov    $0x3,%eax
+     637:	eb aa                	jmp    5e3 <dosyscall>
+
+00000639 <pipe>:
+SYSCALL(pipe)
+     639:	b8 04 00 00 00       	mov    $0x4,%eax
+     63e:	eb a3                	jmp    5e3 <dosyscall>
+
+00000640 <read>:
+SYSCALL(read)
+     640:	b8 05 00 00 00       	mov    $0x5,%eax
+     645:	eb 9c                	jmp    5e3 <dosyscall>
+
+00000647 <write>:
+SYSCALL(write)
+     647:	b8 10 00 00 00       	mov    $0x10,%eax
+     64c:	eb 95                	jmp    5e3 <dosyscall>
+
+0000064e <close>:
+SYSCALL(close)
+     64e:	b8 15 00 00 00       	mov    $0x15,%eax
+     653:	eb 8e                	jmp    5e3 <dosyscall>
+
+00000655 <kill>:
+SYSCALL(kill)
+     655:	b8 06 00 00 00       	mov    $0x6,%eax
+     65a:	eb 87                	jmp    5e3 <dosyscall>
+
+0000065c <exec>:
+SYSCALL(exec)
+     65c:	b8 07 00 00 00       	mov    $0x7,%eax
+     661:	eb 80                	jmp    5e3 <dosyscall>
+
+00000663 <open>:
+SYSCALL(open)
+     663:	b8 0f 00 00 00       	mov    $0xf,%eax
+     668:	e9 76 ff ff ff       	jmp    5e3 <dosyscall>
+
+0000066d <mknod>:
+SYSCALL(mknod)
+     66d:	b8 11 00 00 00       	mov    $0x11,%eax
+     672:	e9 6c ff ff ff       	jmp    5e3 <dosyscall>
+
+00000677 <unlink>:
+SYSCALL(unlink)
+     677:	b8 12 00 00 00       	mov    $0x12,%eax
+     67c:	e9 62 ff ff ff       	jmp    5e3 <dosyscall>
+
+00000681 <fstat>:
+SYSCALL(fstat)
+     681:	b8 08 00 00 00       	mov    $0x8,%eax
+     686:	e9 58 ff ff ff       	jmp    5e3 <dosyscall>
+
+0000068b <link>:
+SYSCALL(link)
+     68b:	b8 13 00 00 00       	mov    $0x13,%eax
+     690:	e9 4e ff ff ff       	jmp    5e3 <dosyscall>
+
+00000695 <mkdir>:
+SYSCALL(mkdir)
+     695:	b8 14 00 00 00       	mov    $0x14,%eax
+     69a:	e9 44 ff ff ff       	jmp    5e3 <dosyscall>
+
+0000069f <chdir>:
+SYSCALL(chdir)
+     69f:	b8 09 00 00 00       	mov    $0x9,%eax
+     6a4:	e9 3a ff ff ff       	jmp    5e3 <dosyscall>
+
+000006a9 <dup>:
+SYSCALL(dup)
+     6a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6ae:	e9 30 ff ff ff       	jmp    5e3 <dosyscall>
+
+000006b3 <getpid>:
+SYSCALL(getpid)
+     6b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     6b8:	e9 26 ff ff ff       	jmp    5e3 <dosyscall>
+
+000006bd <sbrk>:
+SYSCALL(sbrk)
+     6bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+     6c2:	e9 1c ff ff ff       	jmp    5e3 <dosyscall>
+
+000006c7 <sleep>:
+SYSCALL(sleep)
+     6c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+     6cc:	e9 12 ff ff ff       	jmp    5e3 <dosyscall>
+
+000006d1 <uptime>:
+SYSCALL(uptime)
+     6d1:	b8 0e 00 00 00       	mov    $0xe,%eax
+     6d6:	e9 08 ff ff ff       	jmp    5e3 <dosyscall>
+
+000006db <symlink>:
+SYSCALL(symlink)
+     6db:	b8 16 00 00 00       	mov    $0x16,%eax
+     6e0:	e9 fe fe ff ff       	jmp    5e3 <dosyscall>
+
+000006e5 <readlink>:
+SYSCALL(readlink)
+     6e5:	b8 17 00 00 00       	mov    $0x17,%eax
+     6ea:	e9 f4 fe ff ff       	jmp    5e3 <dosyscall>
+
+000006ef <fprot>:
+SYSCALL(fprot)
+     6ef:	b8 18 00 00 00       	mov    $0x18,%eax
+     6f4:	e9 ea fe ff ff       	jmp    5e3 <dosyscall>
+
+000006f9 <funprot>:
+SYSCALL(funprot)
+     6f9:	b8 19 00 00 00       	mov    $0x19,%eax
+     6fe:	e9 e0 fe ff ff       	jmp    5e3 <dosyscall>
+
+00000703 <funlock>:
+SYSCALL(funlock)
+     703:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     708:	e9 d6 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000070d <mmap>:
+SYSCALL(mmap)
+     70d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     712:	e9 cc fe ff ff       	jmp    5e3 <dosyscall>
+
+00000717 <munmap>:
+SYSCALL(munmap)
+     717:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     71c:	e9 c2 fe ff ff       	jmp    5e3 <dosyscall>
+
+00000721 <sendfile>:
+SYSCALL(sendfile)
+     721:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     726:	e9 b8 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000072b <readv>:
+SYSCALL(readv)
+     72b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     730:	e9 ae fe ff ff       	jmp    5e3 <dosyscall>
+
+00000735 <writev>:
+SYSCALL(writev)
+     735:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     73a:	e9 a4 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000073f <pread>:
+SYSCALL(pread)
+     73f:	b8 20 00 00 00       	mov    $0x20,%eax
+     744:	e9 9a fe ff ff       	jmp    5e3 <dosyscall>
+
+00000749 <pwrite>:
+SYSCALL(pwrite)
+     749:	b8 21 00 00 00       	mov    $0x21,%eax
+     74e:	e9 90 fe ff ff       	jmp    5e3 <dosyscall>
+
+00000753 <lseek>:
+SYSCALL(lseek)
+     753:	b8 22 00 00 00       	mov    $0x22,%eax
+     758:	e9 86 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000075d <spawn>:
+SYSCALL(spawn)
+     75d:	b8 23 00 00 00       	mov    $0x23,%eax
+     762:	e9 7c fe ff ff       	jmp    5e3 <dosyscall>
+
+00000767 <setpriority>:
+SYSCALL(setpriority)
+     767:	b8 24 00 00 00       	mov    $0x24,%eax
+     76c:	e9 72 fe ff ff       	jmp    5e3 <dosyscall>
+
+00000771 <kthread_create>:
+SYSCALL(kthread_create)
+     771:	b8 25 00 00 00       	mov    $0x25,%eax
+     776:	e9 68 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000077b <kthread_id>:
+SYSCALL(kthread_id)
+     77b:	b8 26 00 00 00       	mov    $0x26,%eax
+     780:	e9 5e fe ff ff       	jmp    5e3 <dosyscall>
+
+00000785 <kthread_exit>:
+SYSCALL(kthread_exit)
+     785:	b8 27 00 00 00       	mov    $0x27,%eax
+     78a:	e9 54 fe ff ff       	jmp    5e3 <dosyscall>
+
+0000078f <kthread_join>:
+SYSCALL(kthread_join)
+     78f:	b8 28 00 00 00       	mov    $0x28,%eax
+     794:	e9 4a fe ff ff       	jmp    5e3 <dosyscall>
+
+00000799 <futex>:
+SYSCALL(futex)
+     799:	b8 29 00 00 00       	mov    $0x29,%eax
+     79e:	e9 40 fe ff ff       	jmp    5e3 <dosyscall>
+
+000007a3 <signal>:
+SYSCALL(signal)
+     7a3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     7a8:	e9 36 fe ff ff       	jmp    5e3 <dosyscall>
+
+000007ad <alarm>:
+SYSCALL(alarm)
+     7ad:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     7b2:	e9 2c fe ff ff       	jmp    5e3 <dosyscall>
+
+000007b7 <usleep>:
+SYSCALL(usleep)
+     7b7:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     7bc:	e9 22 fe ff ff       	jmp    5e3 <dosyscall>
+
+000007c1 <ioring_setup>:
+SYSCALL(ioring_setup)
+     7c1:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     7c6:	e9 18 fe ff ff       	jmp    5e3 <dosyscall>
+
+000007cb <ioring_enter>:
+SYSCALL(ioring_enter)
+     7cb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     7d0:	e9 0e fe ff ff       	jmp    5e3 <dosyscall>
+
+000007d5 <getrusage>:
+SYSCALL(getrusage)
+     7d5:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     7da:	e9 04 fe ff ff       	jmp    5e3 <dosyscall>
+
+000007df <mount>:
+SYSCALL(mount)
+     7df:	b8 30 00 00 00       	mov    $0x30,%eax
+     7e4:	e9 fa fd ff ff       	jmp    5e3 <dosyscall>
+
+000007e9 <getdents>:
+SYSCALL(getdents)
+     7e9:	b8 31 00 00 00       	mov    $0x31,%eax
+     7ee:	e9 f0 fd ff ff       	jmp    5e3 <dosyscall>
+
+000007f3 <yield>:
+SYSCALL(yield)
+     7f3:	b8 32 00 00 00       	mov    $0x32,%eax
+     7f8:	e9 e6 fd ff ff       	jmp    5e3 <dosyscall>
+
+000007fd <ncpu>:
+SYSCALL(ncpu)
+     7fd:	b8 33 00 00 00       	mov    $0x33,%eax
+     802:	e9 dc fd ff ff       	jmp    5e3 <dosyscall>
+
+00000807 <fallocate>:
+SYSCALL(fallocate)
+     807:	b8 34 00 00 00       	mov    $0x34,%eax
+     80c:	e9 d2 fd ff ff       	jmp    5e3 <dosyscall>
+
+00000811 <ftruncate>:
+SYSCALL(ftruncate)
+     811:	b8 35 00 00 00       	mov    $0x35,%eax
+     816:	e9 c8 fd ff ff       	jmp    5e3 <dosyscall>
+
+0000081b <fsync>:
+SYSCALL(fsync)
+     81b:	b8 36 00 00 00       	mov    $0x36,%eax
+     820:	e9 be fd ff ff       	jmp    5e3 <dosyscall>
+
+00000825 <fdatasync>:
+SYSCALL(fdatasync)
+     825:	b8 37 00 00 00       	mov    $0x37,%eax
+     82a:	e9 b4 fd ff ff       	jmp    5e3 <dosyscall>
+
+0000082f <poll>:
+SYSCALL(poll)
+     82f:	b8 38 00 00 00       	mov    $0x38,%eax
+     834:	e9 aa fd ff ff       	jmp    5e3 <dosyscall>
+
+00000839 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     839:	55                   	push   %ebp
+     83a:	89 e5                	mov    %esp,%ebp
+     83c:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     83f:	8b 45 08             	mov    0x8(%ebp),%eax
+     842:	8b 40 04             	mov    0x4(%eax),%eax
+     845:	85 c0                	test   %eax,%eax
+     847:	7e 1f                	jle    868 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     849:	8b 45 08             	mov    0x8(%ebp),%eax
+     84c:	8b 50 04             	mov    0x4(%eax),%edx
+     84f:	8b 45 08             	mov    0x8(%ebp),%eax
+     852:	8d 48 08             	lea    0x8(%eax),%ecx
+     855:	8b 45 08             	mov    0x8(%ebp),%eax
+     858:	8b 00                	mov    (%eax),%eax
+     85a:	83 ec 04             	sub    $0x4,%esp
+     85d:	52                   	push   %edx
+     85e:	51                   	push   %ecx
+     85f:	50                   	push   %eax
+     860:	e8 d0 fe ff ff       	call   735 <writev>
+     865:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     868:	8b 45 08             	mov    0x8(%ebp),%eax
+     86b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     872:	8b 45 08             	mov    0x8(%ebp),%eax
+     875:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     87c:	00 00 00 
+}
+     87f:	90                   	nop
+     880:	c9                   	leave
+     881:	c3                   	ret
+
+00000882 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     882:	55                   	push   %ebp
+     883:	89 e5                	mov    %esp,%ebp
+     885:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     888:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     88c:	0f 84 94 00 00 00    	je     926 <put+0xa4>
+    return;
+  if(o->n > 0){
+     892:	8b 45 08             	mov    0x8(%ebp),%eax
+     895:	8b 40 04             	mov    0x4(%eax),%eax
+     898:	85 c0                	test   %eax,%eax
+     89a:	7e 40                	jle    8dc <put+0x5a>
+    v = &o->iov[o->n-1];
+     89c:	8b 45 08             	mov    0x8(%ebp),%eax
+     89f:	8b 40 04             	mov    0x4(%eax),%eax
+     8a2:	83 e8 01             	sub    $0x1,%eax
+     8a5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     8ac:	8b 45 08             	mov    0x8(%ebp),%eax
+     8af:	01 d0                	add    %edx,%eax
+     8b1:	83 c0 08             	add    $0x8,%eax
+     8b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     8b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8ba:	8b 10                	mov    (%eax),%edx
+     8bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8bf:	8b 40 04             	mov    0x4(%eax),%eax
+     8c2:	01 d0                	add    %edx,%eax
+     8c4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     8c7:	75 13                	jne    8dc <put+0x5a>
+      v->iov_len += n;
+     8c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8cc:	8b 50 04             	mov    0x4(%eax),%edx
+     8cf:	8b 45 10             	mov    0x10(%ebp),%eax
+     8d2:	01 c2                	add    %eax,%edx
+     8d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d7:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     8da:	eb 4b                	jmp    927 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     8dc:	8b 45 08             	mov    0x8(%ebp),%eax
+     8df:	8b 40 04             	mov    0x4(%eax),%eax
+     8e2:	83 f8 10             	cmp    $0x10,%eax
+     8e5:	75 0e                	jne    8f5 <put+0x73>
+    flush(o);
+     8e7:	83 ec 0c             	sub    $0xc,%esp
+     8ea:	ff 75 08             	push   0x8(%ebp)
+     8ed:	e8 47 ff ff ff       	call   839 <flush>
+     8f2:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     8f5:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f8:	8b 50 04             	mov    0x4(%eax),%edx
+     8fb:	8b 45 08             	mov    0x8(%ebp),%eax
+     8fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     901:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     905:	8b 45 08             	mov    0x8(%ebp),%eax
+     908:	8b 50 04             	mov    0x4(%eax),%edx
+     90b:	8b 45 08             	mov    0x8(%ebp),%eax
+     90e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     911:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     915:	8b 45 08             	mov    0x8(%ebp),%eax
+     918:	8b 40 04             	mov    0x4(%eax),%eax
+     91b:	8d 50 01             	lea    0x1(%eax),%edx
+     91e:	8b 45 08             	mov    0x8(%ebp),%eax
+     921:	89 50 04             	mov    %edx,0x4(%eax)
+     924:	eb 01                	jmp    927 <put+0xa5>
+    return;
+     926:	90                   	nop
+}
+     927:	c9                   	leave
+     928:	c3                   	ret
+
+00000929 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     929:	55                   	push   %ebp
+     92a:	89 e5                	mov    %esp,%ebp
+     92c:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     92f:	8b 45 08             	mov    0x8(%ebp),%eax
+     932:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     938:	8b 45 0c             	mov    0xc(%ebp),%eax
+     93b:	01 d0                	add    %edx,%eax
+     93d:	3d 80 00 00 00       	cmp    $0x80,%eax
+     942:	77 0b                	ja     94f <room+0x26>
+     944:	8b 45 08             	mov    0x8(%ebp),%eax
+     947:	8b 40 04             	mov    0x4(%eax),%eax
+     94a:	83 f8 10             	cmp    $0x10,%eax
+     94d:	75 0e                	jne    95d <room+0x34>
+    flush(o);
+     94f:	83 ec 0c             	sub    $0xc,%esp
+     952:	ff 75 08             	push   0x8(%ebp)
+     955:	e8 df fe ff ff       	call   839 <flush>
+     95a:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     95d:	8b 45 08             	mov    0x8(%ebp),%eax
+     960:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     966:	8b 45 08             	mov    0x8(%ebp),%eax
+     969:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     96f:	01 d0                	add    %edx,%eax
+}
+     971:	c9                   	leave
+     972:	c3                   	ret
+
+00000973 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     973:	55                   	push   %ebp
+     974:	89 e5                	mov    %esp,%ebp
+     976:	83 ec 28             	sub    $0x28,%esp
+     979:	8b 45 0c             	mov    0xc(%ebp),%eax
+     97c:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     97f:	83 ec 08             	sub    $0x8,%esp
+     982:	6a 01                	push   $0x1
+     984:	ff 75 08             	push   0x8(%ebp)
+     987:	e8 9d ff ff ff       	call   929 <room>
+     98c:	83 c4 10             	add    $0x10,%esp
+     98f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     992:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     995:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     999:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     99b:	8b 45 08             	mov    0x8(%ebp),%eax
+     99e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     9a4:	8d 50 01             	lea    0x1(%eax),%edx
+     9a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     9aa:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     9b0:	83 ec 04             	sub    $0x4,%esp
+     9b3:	6a 01                	push   $0x1
+     9b5:	ff 75 f4             	push   -0xc(%ebp)
+     9b8:	ff 75 08             	push   0x8(%ebp)
+     9bb:	e8 c2 fe ff ff       	call   882 <put>
+     9c0:	83 c4 10             	add    $0x10,%esp
+}
+     9c3:	90                   	nop
+     9c4:	c9                   	leave
+     9c5:	c3                   	ret
+
+000009c6 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     9c6:	55                   	push   %ebp
+     9c7:	89 e5                	mov    %esp,%ebp
+     9c9:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     9cc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     9d3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     9d7:	74 17                	je     9f0 <printint+0x2a>
+     9d9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     9dd:	79 11                	jns    9f0 <printint+0x2a>
+    neg = 1;
+     9df:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     9e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9e9:	f7 d8                	neg    %eax
+     9eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9ee:	eb 06                	jmp    9f6 <printint+0x30>
+  } else {
+    x = xx;
+     9f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     9f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     9fd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a00:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a03:	ba 00 00 00 00       	mov    $0x0,%edx
+     a08:	f7 f1                	div    %ecx
+     a0a:	89 d1                	mov    %edx,%ecx
+     a0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a0f:	8d 50 01             	lea    0x1(%eax),%edx
+     a12:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a15:	0f b6 91 b8 1b 00 00 	movzbl 0x1bb8(%ecx),%edx
+     a1c:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     a20:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a23:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a26:	ba 00 00 00 00       	mov    $0x0,%edx
+     a2b:	f7 f1                	div    %ecx
+     a2d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a30:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a34:	75 c7                	jne    9fd <printint+0x37>
+  if(neg)
+     a36:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a3a:	74 0e                	je     a4a <printint+0x84>
+    buf[i++] = '-';
+     a3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a3f:	8d 50 01             	lea    0x1(%eax),%edx
+     a42:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a45:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     a4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a4d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     a50:	83 ec 08             	sub    $0x8,%esp
+     a53:	ff 75 e8             	push   -0x18(%ebp)
+     a56:	ff 75 08             	push   0x8(%ebp)
+     a59:	e8 cb fe ff ff       	call   929 <room>
+     a5e:	83 c4 10             	add    $0x10,%esp
+     a61:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     a64:	eb 1d                	jmp    a83 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     a66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a69:	83 e8 01             	sub    $0x1,%eax
+     a6c:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     a6f:	89 c2                	mov    %eax,%edx
+     a71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a74:	01 c2                	add    %eax,%edx
+     a76:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     a79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a7c:	01 c8                	add    %ecx,%eax
+     a7e:	0f b6 00             	movzbl (%eax),%eax
+     a81:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     a83:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     a87:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a8b:	79 d9                	jns    a66 <printint+0xa0>
+  o->used += n;
+     a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+     a90:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     a96:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a99:	01 c2                	add    %eax,%edx
+     a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a9e:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     aa4:	83 ec 04             	sub    $0x4,%esp
+     aa7:	ff 75 e8             	push   -0x18(%ebp)
+     aaa:	ff 75 e4             	push   -0x1c(%ebp)
+     aad:	ff 75 08             	push   0x8(%ebp)
+     ab0:	e8 cd fd ff ff       	call   882 <put>
+     ab5:	83 c4 10             	add    $0x10,%esp
+}
+     ab8:	90                   	nop
+     ab9:	c9                   	leave
+     aba:	c3                   	ret
+
+00000abb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     abb:	55                   	push   %ebp
+     abc:	89 e5                	mov    %esp,%ebp
+     abe:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac7:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     acd:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     ad4:	00 00 00 
+  o.used = 0;
+     ad7:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     ade:	00 00 00 
+  state = 0;
+     ae1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     ae8:	8d 45 0c             	lea    0xc(%ebp),%eax
+     aeb:	83 c0 04             	add    $0x4,%eax
+     aee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     af1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     af8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     aff:	e9 82 01 00 00       	jmp    c86 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     b04:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b0a:	01 d0                	add    %edx,%eax
+     b0c:	0f b6 00             	movzbl (%eax),%eax
+     b0f:	0f be c0             	movsbl %al,%eax
+     b12:	25 ff 00 00 00       	and    $0xff,%eax
+     b17:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     b1a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b1e:	75 38                	jne    b58 <printf+0x9d>
+      if(c == '%'){
+     b20:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b24:	0f 85 58 01 00 00    	jne    c82 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     b2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b2d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     b30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     b33:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     b36:	01 ca                	add    %ecx,%edx
+     b38:	83 ec 04             	sub    $0x4,%esp
+     b3b:	50                   	push   %eax
+     b3c:	52                   	push   %edx
+     b3d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b43:	50                   	push   %eax
+     b44:	e8 39 fd ff ff       	call   882 <put>
+     b49:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     b4c:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     b53:	e9 2a 01 00 00       	jmp    c82 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     b58:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     b5c:	0f 85 20 01 00 00    	jne    c82 <printf+0x1c7>
+      if(c == 'd'){
+     b62:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     b66:	75 22                	jne    b8a <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     b68:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b6b:	8b 00                	mov    (%eax),%eax
+     b6d:	6a 01                	push   $0x1
+     b6f:	6a 0a                	push   $0xa
+     b71:	50                   	push   %eax
+     b72:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b78:	50                   	push   %eax
+     b79:	e8 48 fe ff ff       	call   9c6 <printint>
+     b7e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b81:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b85:	e9 e8 00 00 00       	jmp    c72 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     b8a:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     b8e:	74 06                	je     b96 <printf+0xdb>
+     b90:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     b94:	75 22                	jne    bb8 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     b96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b99:	8b 00                	mov    (%eax),%eax
+     b9b:	6a 00                	push   $0x0
+     b9d:	6a 10                	push   $0x10
+     b9f:	50                   	push   %eax
+     ba0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ba6:	50                   	push   %eax
+     ba7:	e8 1a fe ff ff       	call   9c6 <printint>
+     bac:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     baf:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     bb3:	e9 ba 00 00 00       	jmp    c72 <printf+0x1b7>
+      } else if(c == 's'){
+     bb8:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     bbc:	75 3f                	jne    bfd <printf+0x142>
+        s = (char*)*ap;
+     bbe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bc1:	8b 00                	mov    (%eax),%eax
+     bc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     bc6:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     bca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bce:	75 07                	jne    bd7 <printf+0x11c>
+          s = "(null)";
+     bd0:	c7 45 f4 24 16 00 00 	movl   $0x1624,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     bd7:	83 ec 0c             	sub    $0xc,%esp
+     bda:	ff 75 f4             	push   -0xc(%ebp)
+     bdd:	e8 47 f8 ff ff       	call   429 <strlen>
+     be2:	83 c4 10             	add    $0x10,%esp
+     be5:	83 ec 04             	sub    $0x4,%esp
+     be8:	50                   	push   %eax
+     be9:	ff 75 f4             	push   -0xc(%ebp)
+     bec:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bf2:	50                   	push   %eax
+     bf3:	e8 8a fc ff ff       	call   882 <put>
+     bf8:	83 c4 10             	add    $0x10,%esp
+     bfb:	eb 75                	jmp    c72 <printf+0x1b7>
+      } else if(c == 'c'){
+     bfd:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     c01:	75 21                	jne    c24 <printf+0x169>
+        putc(&o, *ap);
+     c03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c06:	8b 00                	mov    (%eax),%eax
+     c08:	0f be c0             	movsbl %al,%eax
+     c0b:	83 ec 08             	sub    $0x8,%esp
+     c0e:	50                   	push   %eax
+     c0f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c15:	50                   	push   %eax
+     c16:	e8 58 fd ff ff       	call   973 <putc>
+     c1b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c1e:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c22:	eb 4e                	jmp    c72 <printf+0x1b7>
+      } else if(c == '%'){
+     c24:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     c28:	75 1b                	jne    c45 <printf+0x18a>
+        putc(&o, c);
+     c2a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c2d:	0f be c0             	movsbl %al,%eax
+     c30:	83 ec 08             	sub    $0x8,%esp
+     c33:	50                   	push   %eax
+     c34:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c3a:	50                   	push   %eax
+     c3b:	e8 33 fd ff ff       	call   973 <putc>
+     c40:	83 c4 10             	add    $0x10,%esp
+     c43:	eb 2d                	jmp    c72 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     c45:	83 ec 08             	sub    $0x8,%esp
+     c48:	6a 25                	push   $0x25
+     c4a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c50:	50                   	push   %eax
+     c51:	e8 1d fd ff ff       	call   973 <putc>
+     c56:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     c59:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c5c:	0f be c0             	movsbl %al,%eax
+     c5f:	83 ec 08             	sub    $0x8,%esp
+     c62:	50                   	push   %eax
+     c63:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c69:	50                   	push   %eax
+     c6a:	e8 04 fd ff ff       	call   973 <putc>
+     c6f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     c72:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     c79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c7c:	83 c0 01             	add    $0x1,%eax
+     c7f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c82:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     c86:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c8c:	01 d0                	add    %edx,%eax
+     c8e:	0f b6 00             	movzbl (%eax),%eax
+     c91:	84 c0                	test   %al,%al
+     c93:	0f 85 6b fe ff ff    	jne    b04 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     c99:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     c9d:	75 22                	jne    cc1 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     c9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ca2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     ca5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ca8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     cab:	01 ca                	add    %ecx,%edx
+     cad:	83 ec 04             	sub    $0x4,%esp
+     cb0:	50                   	push   %eax
+     cb1:	52                   	push   %edx
+     cb2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cb8:	50                   	push   %eax
+     cb9:	e8 c4 fb ff ff       	call   882 <put>
+     cbe:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     cc1:	83 ec 0c             	sub    $0xc,%esp
+     cc4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cca:	50                   	push   %eax
+     ccb:	e8 69 fb ff ff       	call   839 <flush>
+     cd0:	83 c4 10             	add    $0x10,%esp
+}
+     cd3:	90                   	nop
+     cd4:	c9                   	leave
+     cd5:	c3                   	ret
+
+00000cd6 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     cd6:	55                   	push   %ebp
+     cd7:	89 e5                	mov    %esp,%ebp
+     cd9:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     cdc:	8b 55 08             	mov    0x8(%ebp),%edx
+     cdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ce2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ce5:	f0 87 02             	lock xchg %eax,(%edx)
+     ce8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     ceb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     cee:	c9                   	leave
+     cef:	c3                   	ret
+
+00000cf0 <lock>:
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     cf6:	a1 f0 1b 00 00       	mov    0x1bf0,%eax
+     cfb:	85 c0                	test   %eax,%eax
+     cfd:	74 09                	je     d08 <lock+0x18>
+     cff:	a1 f0 1b 00 00       	mov    0x1bf0,%eax
+     d04:	ff d0                	call   *%eax
+     d06:	eb 05                	jmp    d0d <lock+0x1d>
+     d08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d0d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     d10:	90                   	nop
+     d11:	83 ec 08             	sub    $0x8,%esp
+     d14:	6a 01                	push   $0x1
+     d16:	68 28 1c 00 00       	push   $0x1c28
+     d1b:	e8 b6 ff ff ff       	call   cd6 <xchg>
+     d20:	83 c4 10             	add    $0x10,%esp
+     d23:	85 c0                	test   %eax,%eax
+     d25:	75 ea                	jne    d11 <lock+0x21>
+  return pin;
+     d27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     d2a:	c9                   	leave
+     d2b:	c3                   	ret
+
+00000d2c <unlock>:
+{
+     d2c:	55                   	push   %ebp
+     d2d:	89 e5                	mov    %esp,%ebp
+     d2f:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     d32:	6a 00                	push   $0x0
+     d34:	68 28 1c 00 00       	push   $0x1c28
+     d39:	e8 98 ff ff ff       	call   cd6 <xchg>
+     d3e:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     d41:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d45:	78 10                	js     d57 <unlock+0x2b>
+    mallocunpin(pin);
+     d47:	a1 f4 1b 00 00       	mov    0x1bf4,%eax
+     d4c:	83 ec 0c             	sub    $0xc,%esp
+     d4f:	ff 75 08             	push   0x8(%ebp)
+     d52:	ff d0                	call   *%eax
+     d54:	83 c4 10             	add    $0x10,%esp
+}
+     d57:	90                   	nop
+     d58:	c9                   	leave
+     d59:	c3                   	ret
+
+00000d5a <sizeclass>:
+{
+     d5a:	55                   	push   %ebp
+     d5b:	89 e5                	mov    %esp,%ebp
+     d5d:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     d60:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     d67:	eb 1c                	jmp    d85 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     d69:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d6c:	ba 02 00 00 00       	mov    $0x2,%edx
+     d71:	89 c1                	mov    %eax,%ecx
+     d73:	d3 e2                	shl    %cl,%edx
+     d75:	89 d0                	mov    %edx,%eax
+     d77:	3b 45 08             	cmp    0x8(%ebp),%eax
+     d7a:	72 05                	jb     d81 <sizeclass+0x27>
+      return c;
+     d7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d7f:	eb 0f                	jmp    d90 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     d81:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     d85:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     d89:	7e de                	jle    d69 <sizeclass+0xf>
+  return -1;
+     d8b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     d90:	c9                   	leave
+     d91:	c3                   	ret
+
+00000d92 <bigfree>:
+{
+     d92:	55                   	push   %ebp
+     d93:	89 e5                	mov    %esp,%ebp
+     d95:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d98:	a1 00 1c 00 00       	mov    0x1c00,%eax
+     d9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     da0:	eb 24                	jmp    dc6 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     da2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     da5:	8b 00                	mov    (%eax),%eax
+     da7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     daa:	72 12                	jb     dbe <bigfree+0x2c>
+     dac:	8b 45 08             	mov    0x8(%ebp),%eax
+     daf:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     db2:	72 24                	jb     dd8 <bigfree+0x46>
+     db4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     db7:	8b 00                	mov    (%eax),%eax
+     db9:	39 45 08             	cmp    %eax,0x8(%ebp)
+     dbc:	72 1a                	jb     dd8 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dbe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dc1:	8b 00                	mov    (%eax),%eax
+     dc3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     dcc:	73 d4                	jae    da2 <bigfree+0x10>
+     dce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dd1:	8b 00                	mov    (%eax),%eax
+     dd3:	39 45 08             	cmp    %eax,0x8(%ebp)
+     dd6:	73 ca                	jae    da2 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddb:	8b 40 04             	mov    0x4(%eax),%eax
+     dde:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     de5:	8b 45 08             	mov    0x8(%ebp),%eax
+     de8:	01 c2                	add    %eax,%edx
+     dea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ded:	8b 00                	mov    (%eax),%eax
+     def:	39 c2                	cmp    %eax,%edx
+     df1:	75 24                	jne    e17 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     df3:	8b 45 08             	mov    0x8(%ebp),%eax
+     df6:	8b 50 04             	mov    0x4(%eax),%edx
+     df9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dfc:	8b 00                	mov    (%eax),%eax
+     dfe:	8b 40 04             	mov    0x4(%eax),%eax
+     e01:	01 c2                	add    %eax,%edx
+     e03:	8b 45 08             	mov    0x8(%ebp),%eax
+     e06:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e0c:	8b 00                	mov    (%eax),%eax
+     e0e:	8b 10                	mov    (%eax),%edx
+     e10:	8b 45 08             	mov    0x8(%ebp),%eax
+     e13:	89 10                	mov    %edx,(%eax)
+     e15:	eb 0a                	jmp    e21 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     e17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e1a:	8b 10                	mov    (%eax),%edx
+     e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1f:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     e21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e24:	8b 40 04             	mov    0x4(%eax),%eax
+     e27:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e31:	01 d0                	add    %edx,%eax
+     e33:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e36:	75 20                	jne    e58 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     e38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e3b:	8b 50 04             	mov    0x4(%eax),%edx
+     e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+     e41:	8b 40 04             	mov    0x4(%eax),%eax
+     e44:	01 c2                	add    %eax,%edx
+     e46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e49:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4f:	8b 10                	mov    (%eax),%edx
+     e51:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e54:	89 10                	mov    %edx,(%eax)
+     e56:	eb 08                	jmp    e60 <bigfree+0xce>
+    p->s.ptr = bp;
+     e58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+     e5e:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     e60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e63:	a3 00 1c 00 00       	mov    %eax,0x1c00
+}
+     e68:	90                   	nop
+     e69:	c9                   	leave
+     e6a:	c3                   	ret
+
+00000e6b <free>:
+{
+     e6b:	55                   	push   %ebp
+     e6c:	89 e5                	mov    %esp,%ebp
+     e6e:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     e71:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     e75:	74 68                	je     edf <free+0x74>
+  bp = (Header*)ap - 1;
+     e77:	8b 45 08             	mov    0x8(%ebp),%eax
+     e7a:	83 e8 08             	sub    $0x8,%eax
+     e7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     e80:	e8 6b fe ff ff       	call   cf0 <lock>
+     e85:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     e88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8b:	8b 40 04             	mov    0x4(%eax),%eax
+     e8e:	83 ec 0c             	sub    $0xc,%esp
+     e91:	50                   	push   %eax
+     e92:	e8 c3 fe ff ff       	call   d5a <sizeclass>
+     e97:	83 c4 10             	add    $0x10,%esp
+     e9a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     ea1:	78 1e                	js     ec1 <free+0x56>
+    bp->s.ptr = classfree[c];
+     ea3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ea6:	8b 14 85 04 1c 00 00 	mov    0x1c04(,%eax,4),%edx
+     ead:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb0:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     eb2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     eb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     eb8:	89 14 85 04 1c 00 00 	mov    %edx,0x1c04(,%eax,4)
+     ebf:	eb 0e                	jmp    ecf <free+0x64>
+    bigfree(bp);
+     ec1:	83 ec 0c             	sub    $0xc,%esp
+     ec4:	ff 75 f4             	push   -0xc(%ebp)
+     ec7:	e8 c6 fe ff ff       	call   d92 <bigfree>
+     ecc:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     ecf:	83 ec 0c             	sub    $0xc,%esp
+     ed2:	ff 75 f0             	push   -0x10(%ebp)
+     ed5:	e8 52 fe ff ff       	call   d2c <unlock>
+     eda:	83 c4 10             	add    $0x10,%esp
+     edd:	eb 01                	jmp    ee0 <free+0x75>
+    return;
+     edf:	90                   	nop
+}
+     ee0:	c9                   	leave
+     ee1:	c3                   	ret
+
+00000ee2 <morecore>:
+{
+     ee2:	55                   	push   %ebp
+     ee3:	89 e5                	mov    %esp,%ebp
+     ee5:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     ee8:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     eef:	77 07                	ja     ef8 <morecore+0x16>
+    nu = 4096;
+     ef1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+     efb:	c1 e0 03             	shl    $0x3,%eax
+     efe:	83 ec 0c             	sub    $0xc,%esp
+     f01:	50                   	push   %eax
+     f02:	e8 b6 f7 ff ff       	call   6bd <sbrk>
+     f07:	83 c4 10             	add    $0x10,%esp
+     f0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     f0d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     f11:	75 07                	jne    f1a <morecore+0x38>
+    return 0;
+     f13:	b8 00 00 00 00       	mov    $0x0,%eax
+     f18:	eb 22                	jmp    f3c <morecore+0x5a>
+  hp = (Header*)p;
+     f1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f1d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     f20:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f23:	8b 55 08             	mov    0x8(%ebp),%edx
+     f26:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     f29:	83 ec 0c             	sub    $0xc,%esp
+     f2c:	ff 75 f0             	push   -0x10(%ebp)
+     f2f:	e8 5e fe ff ff       	call   d92 <bigfree>
+     f34:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     f37:	a1 00 1c 00 00       	mov    0x1c00,%eax
+}
+     f3c:	c9                   	leave
+     f3d:	c3                   	ret
+
+00000f3e <bigalloc>:
+{
+     f3e:	55                   	push   %ebp
+     f3f:	89 e5                	mov    %esp,%ebp
+     f41:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     f44:	a1 00 1c 00 00       	mov    0x1c00,%eax
+     f49:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f4c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f50:	75 23                	jne    f75 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     f52:	c7 45 f0 f8 1b 00 00 	movl   $0x1bf8,-0x10(%ebp)
+     f59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f5c:	a3 00 1c 00 00       	mov    %eax,0x1c00
+     f61:	a1 00 1c 00 00       	mov    0x1c00,%eax
+     f66:	a3 f8 1b 00 00       	mov    %eax,0x1bf8
+    base.s.size = 0;
+     f6b:	c7 05 fc 1b 00 00 00 	movl   $0x0,0x1bfc
+     f72:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f78:	8b 00                	mov    (%eax),%eax
+     f7a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f80:	8b 40 04             	mov    0x4(%eax),%eax
+     f83:	3b 45 08             	cmp    0x8(%ebp),%eax
+     f86:	72 4a                	jb     fd2 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     f88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f8b:	8b 40 04             	mov    0x4(%eax),%eax
+     f8e:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f91:	75 0c                	jne    f9f <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     f93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f96:	8b 10                	mov    (%eax),%edx
+     f98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f9b:	89 10                	mov    %edx,(%eax)
+     f9d:	eb 26                	jmp    fc5 <bigalloc+0x87>
+        p->s.size -= nunits;
+     f9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa2:	8b 40 04             	mov    0x4(%eax),%eax
+     fa5:	2b 45 08             	sub    0x8(%ebp),%eax
+     fa8:	89 c2                	mov    %eax,%edx
+     faa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fad:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     fb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb3:	8b 40 04             	mov    0x4(%eax),%eax
+     fb6:	c1 e0 03             	shl    $0x3,%eax
+     fb9:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     fbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+     fc2:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     fc5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fc8:	a3 00 1c 00 00       	mov    %eax,0x1c00
+      return p;
+     fcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd0:	eb 3b                	jmp    100d <bigalloc+0xcf>
+    if(p == freep)
+     fd2:	a1 00 1c 00 00       	mov    0x1c00,%eax
+     fd7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     fda:	75 1e                	jne    ffa <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     fdc:	83 ec 0c             	sub    $0xc,%esp
+     fdf:	ff 75 08             	push   0x8(%ebp)
+     fe2:	e8 fb fe ff ff       	call   ee2 <morecore>
+     fe7:	83 c4 10             	add    $0x10,%esp
+     fea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fed:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ff1:	75 07                	jne    ffa <bigalloc+0xbc>
+        return 0;
+     ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff8:	eb 13                	jmp    100d <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ffa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ffd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1003:	8b 00                	mov    (%eax),%eax
+    1005:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1008:	e9 70 ff ff ff       	jmp    f7d <bigalloc+0x3f>
+}
+    100d:	c9                   	leave
+    100e:	c3                   	ret
+
+0000100f <alloc>:
+alloc(uint nbytes)
+{
+    100f:	55                   	push   %ebp
+    1010:	89 e5                	mov    %esp,%ebp
+    1012:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1015:	8b 45 08             	mov    0x8(%ebp),%eax
+    1018:	83 c0 07             	add    $0x7,%eax
+    101b:	c1 e8 03             	shr    $0x3,%eax
+    101e:	83 c0 01             	add    $0x1,%eax
+    1021:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    1024:	ff 75 f4             	push   -0xc(%ebp)
+    1027:	e8 2e fd ff ff       	call   d5a <sizeclass>
+    102c:	83 c4 04             	add    $0x4,%esp
+    102f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1032:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1036:	79 2c                	jns    1064 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    1038:	83 ec 0c             	sub    $0xc,%esp
+    103b:	ff 75 f4             	push   -0xc(%ebp)
+    103e:	e8 fb fe ff ff       	call   f3e <bigalloc>
+    1043:	83 c4 10             	add    $0x10,%esp
+    1046:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1049:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    104d:	75 0a                	jne    1059 <alloc+0x4a>
+      return 0;
+    104f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1054:	e9 c8 00 00 00       	jmp    1121 <alloc+0x112>
+    return (void*)(p + 1);
+    1059:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    105c:	83 c0 08             	add    $0x8,%eax
+    105f:	e9 bd 00 00 00       	jmp    1121 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1064:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1067:	8b 04 85 04 1c 00 00 	mov    0x1c04(,%eax,4),%eax
+    106e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1071:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1075:	74 1a                	je     1091 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1077:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    107a:	8b 10                	mov    (%eax),%edx
+    107c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    107f:	89 14 85 04 1c 00 00 	mov    %edx,0x1c04(,%eax,4)
+    return (void*)(p + 1);
+    1086:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1089:	83 c0 08             	add    $0x8,%eax
+    108c:	e9 90 00 00 00       	jmp    1121 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1091:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1094:	ba 02 00 00 00       	mov    $0x2,%edx
+    1099:	89 c1                	mov    %eax,%ecx
+    109b:	d3 e2                	shl    %cl,%edx
+    109d:	89 d0                	mov    %edx,%eax
+    109f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    10a2:	a1 20 1c 00 00       	mov    0x1c20,%eax
+    10a7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10aa:	c1 e2 03             	shl    $0x3,%edx
+    10ad:	01 d0                	add    %edx,%eax
+    10af:	8b 15 24 1c 00 00    	mov    0x1c24,%edx
+    10b5:	39 c2                	cmp    %eax,%edx
+    10b7:	73 3f                	jae    10f8 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    10b9:	83 ec 0c             	sub    $0xc,%esp
+    10bc:	68 00 08 00 00       	push   $0x800
+    10c1:	e8 78 fe ff ff       	call   f3e <bigalloc>
+    10c6:	83 c4 10             	add    $0x10,%esp
+    10c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10d0:	75 07                	jne    10d9 <alloc+0xca>
+      return 0;
+    10d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d7:	eb 48                	jmp    1121 <alloc+0x112>
+    bump = (char*)p;
+    10d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10dc:	a3 20 1c 00 00       	mov    %eax,0x1c20
+    bumpend = (char*)(p + p->s.size);
+    10e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10e4:	8b 40 04             	mov    0x4(%eax),%eax
+    10e7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    10ee:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10f1:	01 d0                	add    %edx,%eax
+    10f3:	a3 24 1c 00 00       	mov    %eax,0x1c24
+  }
+  p = (Header*)bump;
+    10f8:	a1 20 1c 00 00       	mov    0x1c20,%eax
+    10fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1100:	a1 20 1c 00 00       	mov    0x1c20,%eax
+    1105:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1108:	c1 e2 03             	shl    $0x3,%edx
+    110b:	01 d0                	add    %edx,%eax
+    110d:	a3 20 1c 00 00       	mov    %eax,0x1c20
+  p->s.size = nunits;
+    1112:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1115:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1118:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    111b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    111e:	83 c0 08             	add    $0x8,%eax
+}
+    1121:	c9                   	leave
+    1122:	c3                   	ret
+
+00001123 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1123:	55                   	push   %ebp
+    1124:	89 e5                	mov    %esp,%ebp
+    1126:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1129:	e8 c2 fb ff ff       	call   cf0 <lock>
+    112e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1131:	83 ec 0c             	sub    $0xc,%esp
+    1134:	ff 75 08             	push   0x8(%ebp)
+    1137:	e8 d3 fe ff ff       	call   100f <alloc>
+    113c:	83 c4 10             	add    $0x10,%esp
+    113f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1142:	83 ec 0c             	sub    $0xc,%esp
+    1145:	ff 75 f4             	push   -0xc(%ebp)
+    1148:	e8 df fb ff ff       	call   d2c <unlock>
+    114d:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1150:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1153:	c9                   	leave
+    1154:	c3                   	ret
+
+00001155 <xchg>:
+static struct mutex mutex[MAX_MUTEXES];
+static struct cond cond[MAX_CONDS];
+
+static inline int
+xchg(volatile int *addr, int newval)
+{
+    1155:	55                   	push   %ebp
+    1156:	89 e5                	mov    %esp,%ebp
+    1158:	83 ec 10             	sub    $0x10,%esp
+  int result;
+
+  asm volatile("lock; xchgl %0, %1" :
+    115b:	8b 55 08             	mov    0x8(%ebp),%edx
+    115e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1161:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1164:	f0 87 02             	lock xchg %eax,(%edx)
+    1167:	89 45 fc             	mov    %eax,-0x4(%ebp)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    116a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    116d:	c9                   	leave
+    116e:	c3                   	ret
+
+0000116f <cmpxchg>:
+
+static inline int
+cmpxchg(volatile int *addr, int old, int newval)
+{
+    116f:	55                   	push   %ebp
+    1170:	89 e5                	mov    %esp,%ebp
+    1172:	53                   	push   %ebx
+    1173:	83 ec 10             	sub    $0x10,%esp
+  int prev;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+    1176:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1179:	8b 55 10             	mov    0x10(%ebp),%edx
+    117c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    117f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1182:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    1186:	89 45 f8             	mov    %eax,-0x8(%ebp)
+               "=a" (prev), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "cc", "memory");
+  return prev;
+    1189:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+    118c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    118f:	c9                   	leave
+    1190:	c3                   	ret
+
+00001191 <atomicadd>:
+
+static inline void
+atomicadd(volatile int *addr, int n)
+{
+    1191:	55                   	push   %ebp
+    1192:	89 e5                	mov    %esp,%ebp
+  asm volatile("lock; addl %1, %0" : "+m" (*addr) : "r" (n) : "cc", "memory");
+    1194:	8b 45 08             	mov    0x8(%ebp),%eax
+    1197:	8b 55 0c             	mov    0xc(%ebp),%edx
+    119a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    119d:	f0 01 10             	lock add %edx,(%eax)
+}
+    11a0:	90                   	nop
+    11a1:	5d                   	pop    %ebp
+    11a2:	c3                   	ret
+
+000011a3 <getmutex>:
+
+static volatile int*
+getmutex(int id)
+{
+    11a3:	55                   	push   %ebp
+    11a4:	89 e5                	mov    %esp,%ebp
+  if(id < 0 || id >= MAX_MUTEXES || !mutex[id].used)
+    11a6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11aa:	78 14                	js     11c0 <getmutex+0x1d>
+    11ac:	83 7d 08 3f          	cmpl   $0x3f,0x8(%ebp)
+    11b0:	7f 0e                	jg     11c0 <getmutex+0x1d>
+    11b2:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b5:	8b 04 c5 40 1c 00 00 	mov    0x1c40(,%eax,8),%eax
+    11bc:	85 c0                	test   %eax,%eax
+    11be:	75 07                	jne    11c7 <getmutex+0x24>
+    return 0;
+    11c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c5:	eb 0e                	jmp    11d5 <getmutex+0x32>
+  return &mutex[id].val;
+    11c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ca:	c1 e0 03             	shl    $0x3,%eax
+    11cd:	05 40 1c 00 00       	add    $0x1c40,%eax
+    11d2:	83 c0 04             	add    $0x4,%eax
+}
+    11d5:	5d                   	pop    %ebp
+    11d6:	c3                   	ret
+
+000011d7 <getcond>:
+
+static struct cond*
+getcond(int id)
+{
+    11d7:	55                   	push   %ebp
+    11d8:	89 e5                	mov    %esp,%ebp
+  if(id < 0 || id >= MAX_CONDS || !cond[id].used)
+    11da:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11de:	78 1d                	js     11fd <getcond+0x26>
+    11e0:	83 7d 08 3f          	cmpl   $0x3f,0x8(%ebp)
+    11e4:	7f 17                	jg     11fd <getcond+0x26>
+    11e6:	8b 55 08             	mov    0x8(%ebp),%edx
+    11e9:	89 d0                	mov    %edx,%eax
+    11eb:	01 c0                	add    %eax,%eax
+    11ed:	01 d0                	add    %edx,%eax
+    11ef:	c1 e0 02             	shl    $0x2,%eax
+    11f2:	05 40 1e 00 00       	add    $0x1e40,%eax
+    11f7:	8b 00                	mov    (%eax),%eax
+    11f9:	85 c0                	test   %eax,%eax
+    11fb:	75 07                	jne    1204 <getcond+0x2d>
+    return 0;
+    11fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1202:	eb 11                	jmp    1215 <getcond+0x3e>
+  return &cond[id];
+    1204:	8b 55 08             	mov    0x8(%ebp),%edx
+    1207:	89 d0                	mov    %edx,%eax
+    1209:	01 c0                	add    %eax,%eax
+    120b:	01 d0                	add    %edx,%eax
+    120d:	c1 e0 02             	shl    $0x2,%eax
+    1210:	05 40 1e 00 00       	add    $0x1e40,%eax
+}
+    1215:	5d                   	pop    %ebp
+    1216:	c3                   	ret
+
+00001217 <lockword>:
+
+// Take mutex word m, which was c when last looked at, marking it
+// waited for whenever it has to sleep.
+static void
+lockword(volatile int *m, int c)
+{
+    1217:	55                   	push   %ebp
+    1218:	89 e5                	mov    %esp,%ebp
+    121a:	83 ec 08             	sub    $0x8,%esp
+  if(c != 2)
+    121d:	83 7d 0c 02          	cmpl   $0x2,0xc(%ebp)
+    1221:	74 37                	je     125a <lockword+0x43>
+    c = xchg(m, 2);
+    1223:	6a 02                	push   $0x2
+    1225:	ff 75 08             	push   0x8(%ebp)
+    1228:	e8 28 ff ff ff       	call   1155 <xchg>
+    122d:	83 c4 08             	add    $0x8,%esp
+    1230:	89 45 0c             	mov    %eax,0xc(%ebp)
+  while(c != 0){
+    1233:	eb 25                	jmp    125a <lockword+0x43>
+    futex((int*)m, FUTEX_WAIT, 2);
+    1235:	83 ec 04             	sub    $0x4,%esp
+    1238:	6a 02                	push   $0x2
+    123a:	6a 00                	push   $0x0
+    123c:	ff 75 08             	push   0x8(%ebp)
+    123f:	e8 55 f5 ff ff       	call   799 <futex>
+    1244:	83 c4 10             	add    $0x10,%esp
+    c = xchg(m, 2);
+    1247:	83 ec 08             	sub    $0x8,%esp
+    124a:	6a 02                	push   $0x2
+    124c:	ff 75 08             	push   0x8(%ebp)
+    124f:	e8 01 ff ff ff       	call   1155 <xchg>
+    1254:	83 c4 10             	add    $0x10,%esp
+    1257:	89 45 0c             	mov    %eax,0xc(%ebp)
+  while(c != 0){
+    125a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    125e:	75 d5                	jne    1235 <lockword+0x1e>
+  }
+}
+    1260:	90                   	nop
+    1261:	90                   	nop
+    1262:	c9                   	leave
+    1263:	c3                   	ret
+
+00001264 <kthread_mutex_alloc>:
+
+int
+kthread_mutex_alloc()
+{
+    1264:	55                   	push   %ebp
+    1265:	89 e5                	mov    %esp,%ebp
+    1267:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < MAX_MUTEXES; i++){
+    126a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    1271:	eb 31                	jmp    12a4 <kthread_mutex_alloc+0x40>
+    if(xchg(&mutex[i].used, 1) == 0){
+    1273:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1276:	c1 e0 03             	shl    $0x3,%eax
+    1279:	05 40 1c 00 00       	add    $0x1c40,%eax
+    127e:	6a 01                	push   $0x1
+    1280:	50                   	push   %eax
+    1281:	e8 cf fe ff ff       	call   1155 <xchg>
+    1286:	83 c4 08             	add    $0x8,%esp
+    1289:	85 c0                	test   %eax,%eax
+    128b:	75 13                	jne    12a0 <kthread_mutex_alloc+0x3c>
+      mutex[i].val = 0;
+    128d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1290:	c7 04 c5 44 1c 00 00 	movl   $0x0,0x1c44(,%eax,8)
+    1297:	00 00 00 00 
+      return i;
+    129b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    129e:	eb 0f                	jmp    12af <kthread_mutex_alloc+0x4b>
+  for(i = 0; i < MAX_MUTEXES; i++){
+    12a0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    12a4:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%ebp)
+    12a8:	7e c9                	jle    1273 <kthread_mutex_alloc+0xf>
+    }
+  }
+  return -1;
+    12aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12af:	c9                   	leave
+    12b0:	c3                   	ret
+
+000012b1 <kthread_mutex_dealloc>:
+
+// Free mutex_id, which must not be held.
+int
+kthread_mutex_dealloc(int mutex_id)
+{
+    12b1:	55                   	push   %ebp
+    12b2:	89 e5                	mov    %esp,%ebp
+    12b4:	83 ec 10             	sub    $0x10,%esp
+  volatile int *m;
+
+  if((m = getmutex(mutex_id)) == 0 || *m != 0)
+    12b7:	ff 75 08             	push   0x8(%ebp)
+    12ba:	e8 e4 fe ff ff       	call   11a3 <getmutex>
+    12bf:	83 c4 04             	add    $0x4,%esp
+    12c2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    12c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    12c9:	74 09                	je     12d4 <kthread_mutex_dealloc+0x23>
+    12cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12ce:	8b 00                	mov    (%eax),%eax
+    12d0:	85 c0                	test   %eax,%eax
+    12d2:	74 07                	je     12db <kthread_mutex_dealloc+0x2a>
+    return -1;
+    12d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d9:	eb 1b                	jmp    12f6 <kthread_mutex_dealloc+0x45>
+  xchg(&mutex[mutex_id].used, 0);
+    12db:	8b 45 08             	mov    0x8(%ebp),%eax
+    12de:	c1 e0 03             	shl    $0x3,%eax
+    12e1:	05 40 1c 00 00       	add    $0x1c40,%eax
+    12e6:	6a 00                	push   $0x0
+    12e8:	50                   	push   %eax
+    12e9:	e8 67 fe ff ff       	call   1155 <xchg>
+    12ee:	83 c4 08             	add    $0x8,%esp
+  return 0;
+    12f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12f6:	c9                   	leave
+    12f7:	c3                   	ret
+
+000012f8 <kthread_mutex_lock>:
+
+int
+kthread_mutex_lock(int mutex_id)
+{
+    12f8:	55                   	push   %ebp
+    12f9:	89 e5                	mov    %esp,%ebp
+    12fb:	83 ec 18             	sub    $0x18,%esp
+  volatile int *m;
+  int c;
+
+  if((m = getmutex(mutex_id)) == 0)
+    12fe:	ff 75 08             	push   0x8(%ebp)
+    1301:	e8 9d fe ff ff       	call   11a3 <getmutex>
+    1306:	83 c4 04             	add    $0x4,%esp
+    1309:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    130c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1310:	75 07                	jne    1319 <kthread_mutex_lock+0x21>
+    return -1;
+    1312:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1317:	eb 2e                	jmp    1347 <kthread_mutex_lock+0x4f>
+  if((c = cmpxchg(m, 0, 1)) != 0)
+    1319:	6a 01                	push   $0x1
+    131b:	6a 00                	push   $0x0
+    131d:	ff 75 f4             	push   -0xc(%ebp)
+    1320:	e8 4a fe ff ff       	call   116f <cmpxchg>
+    1325:	83 c4 0c             	add    $0xc,%esp
+    1328:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    132b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    132f:	74 11                	je     1342 <kthread_mutex_lock+0x4a>
+    lockword(m, c);
+    1331:	83 ec 08             	sub    $0x8,%esp
+    1334:	ff 75 f0             	push   -0x10(%ebp)
+    1337:	ff 75 f4             	push   -0xc(%ebp)
+    133a:	e8 d8 fe ff ff       	call   1217 <lockword>
+    133f:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1342:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1347:	c9                   	leave
+    1348:	c3                   	ret
+
+00001349 <kthread_mutex_unlock>:
+
+// Release mutex_id, which must be held.
+int
+kthread_mutex_unlock(int mutex_id)
+{
+    1349:	55                   	push   %ebp
+    134a:	89 e5                	mov    %esp,%ebp
+    134c:	83 ec 18             	sub    $0x18,%esp
+  volatile int *m;
+  int c;
+
+  if((m = getmutex(mutex_id)) == 0 || (c = xchg(m, 0)) == 0)
+    134f:	ff 75 08             	push   0x8(%ebp)
+    1352:	e8 4c fe ff ff       	call   11a3 <getmutex>
+    1357:	83 c4 04             	add    $0x4,%esp
+    135a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    135d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1361:	74 16                	je     1379 <kthread_mutex_unlock+0x30>
+    1363:	6a 00                	push   $0x0
+    1365:	ff 75 f4             	push   -0xc(%ebp)
+    1368:	e8 e8 fd ff ff       	call   1155 <xchg>
+    136d:	83 c4 08             	add    $0x8,%esp
+    1370:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1373:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1377:	75 07                	jne    1380 <kthread_mutex_unlock+0x37>
+    return -1;
+    1379:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    137e:	eb 1d                	jmp    139d <kthread_mutex_unlock+0x54>
+  if(c == 2)
+    1380:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    1384:	75 12                	jne    1398 <kthread_mutex_unlock+0x4f>
+    futex((int*)m, FUTEX_WAKE, 1);
+    1386:	83 ec 04             	sub    $0x4,%esp
+    1389:	6a 01                	push   $0x1
+    138b:	6a 01                	push   $0x1
+    138d:	ff 75 f4             	push   -0xc(%ebp)
+    1390:	e8 04 f4 ff ff       	call   799 <futex>
+    1395:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    139d:	c9                   	leave
+    139e:	c3                   	ret
+
+0000139f <kthread_cond_alloc>:
+
+int
+kthread_cond_alloc()
+{
+    139f:	55                   	push   %ebp
+    13a0:	89 e5                	mov    %esp,%ebp
+    13a2:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < MAX_CONDS; i++){
+    13a5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    13ac:	eb 57                	jmp    1405 <kthread_cond_alloc+0x66>
+    if(xchg(&cond[i].used, 1) == 0){
+    13ae:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    13b1:	89 d0                	mov    %edx,%eax
+    13b3:	01 c0                	add    %eax,%eax
+    13b5:	01 d0                	add    %edx,%eax
+    13b7:	c1 e0 02             	shl    $0x2,%eax
+    13ba:	05 40 1e 00 00       	add    $0x1e40,%eax
+    13bf:	6a 01                	push   $0x1
+    13c1:	50                   	push   %eax
+    13c2:	e8 8e fd ff ff       	call   1155 <xchg>
+    13c7:	83 c4 08             	add    $0x8,%esp
+    13ca:	85 c0                	test   %eax,%eax
+    13cc:	75 33                	jne    1401 <kthread_cond_alloc+0x62>
+      cond[i].seq = 0;
+    13ce:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    13d1:	89 d0                	mov    %edx,%eax
+    13d3:	01 c0                	add    %eax,%eax
+    13d5:	01 d0                	add    %edx,%eax
+    13d7:	c1 e0 02             	shl    $0x2,%eax
+    13da:	05 44 1e 00 00       	add    $0x1e44,%eax
+    13df:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+      cond[i].waiters = 0;
+    13e5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    13e8:	89 d0                	mov    %edx,%eax
+    13ea:	01 c0                	add    %eax,%eax
+    13ec:	01 d0                	add    %edx,%eax
+    13ee:	c1 e0 02             	shl    $0x2,%eax
+    13f1:	05 48 1e 00 00       	add    $0x1e48,%eax
+    13f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+      return i;
+    13fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13ff:	eb 0f                	jmp    1410 <kthread_cond_alloc+0x71>
+  for(i = 0; i < MAX_CONDS; i++){
+    1401:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1405:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%ebp)
+    1409:	7e a3                	jle    13ae <kthread_cond_alloc+0xf>
+    }
+  }
+  return -1;
+    140b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1410:	c9                   	leave
+    1411:	c3                   	ret
+
+00001412 <kthread_cond_dealloc>:
+
+int
+kthread_cond_dealloc(int cond_id)
+{
+    1412:	55                   	push   %ebp
+    1413:	89 e5                	mov    %esp,%ebp
+  if(getcond(cond_id) == 0)
+    1415:	ff 75 08             	push   0x8(%ebp)
+    1418:	e8 ba fd ff ff       	call   11d7 <getcond>
+    141d:	83 c4 04             	add    $0x4,%esp
+    1420:	85 c0                	test   %eax,%eax
+    1422:	75 07                	jne    142b <kthread_cond_dealloc+0x19>
+    return -1;
+    1424:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1429:	eb 21                	jmp    144c <kthread_cond_dealloc+0x3a>
+  xchg(&cond[cond_id].used, 0);
+    142b:	8b 55 08             	mov    0x8(%ebp),%edx
+    142e:	89 d0                	mov    %edx,%eax
+    1430:	01 c0                	add    %eax,%eax
+    1432:	01 d0                	add    %edx,%eax
+    1434:	c1 e0 02             	shl    $0x2,%eax
+    1437:	05 40 1e 00 00       	add    $0x1e40,%eax
+    143c:	6a 00                	push   $0x0
+    143e:	50                   	push   %eax
+    143f:	e8 11 fd ff ff       	call   1155 <xchg>
+    1444:	83 c4 08             	add    $0x8,%esp
+  return 0;
+    1447:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    144c:	c9                   	leave
+    144d:	c3                   	ret
+
+0000144e <kthread_cond_wait>:
+// Release mutex_id, which must be held, wait for cond_id to be
+// signalled, and take the mutex again.  A signal between the
+// release and the sleep changes seq, so the sleep does not happen.
+int
+kthread_cond_wait(int cond_id, int mutex_id)
+{
+    144e:	55                   	push   %ebp
+    144f:	89 e5                	mov    %esp,%ebp
+    1451:	83 ec 18             	sub    $0x18,%esp
+  struct cond *c;
+  volatile int *m;
+  int seq;
+
+  if((c = getcond(cond_id)) == 0 || (m = getmutex(mutex_id)) == 0)
+    1454:	ff 75 08             	push   0x8(%ebp)
+    1457:	e8 7b fd ff ff       	call   11d7 <getcond>
+    145c:	83 c4 04             	add    $0x4,%esp
+    145f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1462:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1466:	74 14                	je     147c <kthread_cond_wait+0x2e>
+    1468:	ff 75 0c             	push   0xc(%ebp)
+    146b:	e8 33 fd ff ff       	call   11a3 <getmutex>
+    1470:	83 c4 04             	add    $0x4,%esp
+    1473:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1476:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    147a:	75 0a                	jne    1486 <kthread_cond_wait+0x38>
+    return -1;
+    147c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1481:	e9 87 00 00 00       	jmp    150d <kthread_cond_wait+0xbf>
+  seq = c->seq;
+    1486:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1489:	8b 40 04             	mov    0x4(%eax),%eax
+    148c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  atomicadd(&c->waiters, 1);
+    148f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1492:	83 c0 08             	add    $0x8,%eax
+    1495:	6a 01                	push   $0x1
+    1497:	50                   	push   %eax
+    1498:	e8 f4 fc ff ff       	call   1191 <atomicadd>
+    149d:	83 c4 08             	add    $0x8,%esp
+  if(kthread_mutex_unlock(mutex_id) < 0){
+    14a0:	83 ec 0c             	sub    $0xc,%esp
+    14a3:	ff 75 0c             	push   0xc(%ebp)
+    14a6:	e8 9e fe ff ff       	call   1349 <kthread_mutex_unlock>
+    14ab:	83 c4 10             	add    $0x10,%esp
+    14ae:	85 c0                	test   %eax,%eax
+    14b0:	79 1b                	jns    14cd <kthread_cond_wait+0x7f>
+    atomicadd(&c->waiters, -1);
+    14b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14b5:	83 c0 08             	add    $0x8,%eax
+    14b8:	83 ec 08             	sub    $0x8,%esp
+    14bb:	6a ff                	push   $0xffffffff
+    14bd:	50                   	push   %eax
+    14be:	e8 ce fc ff ff       	call   1191 <atomicadd>
+    14c3:	83 c4 10             	add    $0x10,%esp
+    return -1;
+    14c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14cb:	eb 40                	jmp    150d <kthread_cond_wait+0xbf>
+  }
+  futex((int*)&c->seq, FUTEX_WAIT, seq);
+    14cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14d0:	83 c0 04             	add    $0x4,%eax
+    14d3:	83 ec 04             	sub    $0x4,%esp
+    14d6:	ff 75 ec             	push   -0x14(%ebp)
+    14d9:	6a 00                	push   $0x0
+    14db:	50                   	push   %eax
+    14dc:	e8 b8 f2 ff ff       	call   799 <futex>
+    14e1:	83 c4 10             	add    $0x10,%esp
+  atomicadd(&c->waiters, -1);
+    14e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e7:	83 c0 08             	add    $0x8,%eax
+    14ea:	83 ec 08             	sub    $0x8,%esp
+    14ed:	6a ff                	push   $0xffffffff
+    14ef:	50                   	push   %eax
+    14f0:	e8 9c fc ff ff       	call   1191 <atomicadd>
+    14f5:	83 c4 10             	add    $0x10,%esp
+  lockword(m, 1);
+    14f8:	83 ec 08             	sub    $0x8,%esp
+    14fb:	6a 01                	push   $0x1
+    14fd:	ff 75 f0             	push   -0x10(%ebp)
+    1500:	e8 12 fd ff ff       	call   1217 <lockword>
+    1505:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1508:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    150d:	c9                   	leave
+    150e:	c3                   	ret
+
+0000150f <kthread_cond_signal>:
+
+// Wake one thread waiting on cond_id, if there is one.
+int
+kthread_cond_signal(int cond_id)
+{
+    150f:	55                   	push   %ebp
+    1510:	89 e5                	mov    %esp,%ebp
+    1512:	83 ec 18             	sub    $0x18,%esp
+  struct cond *c;
+
+  if((c = getcond(cond_id)) == 0)
+    1515:	ff 75 08             	push   0x8(%ebp)
+    1518:	e8 ba fc ff ff       	call   11d7 <getcond>
+    151d:	83 c4 04             	add    $0x4,%esp
+    1520:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1523:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1527:	75 07                	jne    1530 <kthread_cond_signal+0x21>
+    return -1;
+    1529:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    152e:	eb 36                	jmp    1566 <kthread_cond_signal+0x57>
+  atomicadd(&c->seq, 1);
+    1530:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1533:	83 c0 04             	add    $0x4,%eax
+    1536:	6a 01                	push   $0x1
+    1538:	50                   	push   %eax
+    1539:	e8 53 fc ff ff       	call   1191 <atomicadd>
+    153e:	83 c4 08             	add    $0x8,%esp
+  if(c->waiters > 0)
+    1541:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1544:	8b 40 08             	mov    0x8(%eax),%eax
+    1547:	85 c0                	test   %eax,%eax
+    1549:	7e 16                	jle    1561 <kthread_cond_signal+0x52>
+    futex((int*)&c->seq, FUTEX_WAKE, 1);
+    154b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    154e:	83 c0 04             	add    $0x4,%eax
+    1551:	83 ec 04             	sub    $0x4,%esp
+    1554:	6a 01                	push   $0x1
+    1556:	6a 01                	push   $0x1
+    1558:	50                   	push   %eax
+    1559:	e8 3b f2 ff ff       	call   799 <futex>
+    155e:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1561:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1566:	c9                   	leave
+    1567:	c3                   	ret
@@ -0,0 +1,98 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kthread.h"
+#include "futex.h"
+
+#define NTHREAD 4
+#define ROUNDS 1000
+
+int mutex, cond;
+volatile int counter, ready;
+
+void*
+adder()
+{
+  int i;
+
+  for(i = 0; i < ROUNDS; i++){
+    kthread_mutex_lock(mutex);
+    counter++;
+    kthread_mutex_unlock(mutex);
+  }
+  kthread_exit();
+  return 0;
+}
+
+void*
+waiter()
+{
+  kthread_mutex_lock(mutex);
+  while(!ready)
+    kthread_cond_wait(cond, mutex);
+  kthread_mutex_unlock(mutex);
+  kthread_exit();
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, tid[NTHREAD];
+
+  if((mutex = kthread_mutex_alloc()) < 0 || (cond = kthread_cond_alloc()) < 0){
+    printf(1, "error: alloc\n");
+    exit();
+  }
+
+  // Threads share memory: the counter sees every increment.
+  for(i = 0; i < NTHREAD; i++){
+    if((tid[i] = kthread_create(adder, malloc(MAX_STACK_SIZE), MAX_STACK_SIZE)) < 0){
+      printf(1, "error: kthread_create\n");
+      exit();
+    }
+  }
+  for(i = 0; i < NTHREAD; i++){
+    if(kthread_join(tid[i]) < 0){
+      printf(1, "error: kthread_join\n");
+      exit();
+    }
+  }
+  if(counter != NTHREAD*ROUNDS){
+    printf(1, "error: counter %d, not %d\n", counter, NTHREAD*ROUNDS);
+    exit();
+  }
+  if(kthread_join(tid[0]) != -1 || kthread_join(kthread_id()) != -1){
+    printf(1, "error: bad join accepted\n");
+    exit();
+  }
+  printf(1, "mutex ok\n");
+
+  if((tid[0] = kthread_create(waiter, malloc(MAX_STACK_SIZE), MAX_STACK_SIZE)) < 0){
+    printf(1, "error: kthread_create\n");
+    exit();
+  }
+  sleep(10);
+  kthread_mutex_lock(mutex);
+  ready = 1;
+  kthread_cond_signal(cond);
+  kthread_mutex_unlock(mutex);
+  if(kthread_join(tid[0]) < 0){
+    printf(1, "error: cond join\n");
+    exit();
+  }
+  if(kthread_mutex_dealloc(mutex) < 0 || kthread_cond_dealloc(cond) < 0){
+    printf(1, "error: dealloc\n");
+    exit();
+  }
+  printf(1, "cond ok\n");
+
+  // A futex wait returns at once if the word has moved on.
+  counter = 0;
+  if(futex((int*)&counter, FUTEX_WAIT, 1) != -1 || futex((int*)&counter, FUTEX_WAKE, 1) != 0){
+    printf(1, "error: futex\n");
+    exit();
+  }
+  printf(1, "futex ok\n");
+  exit();
+}
@@ -0,0 +1,1868 @@
+
+_test_large:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// One kilobyte of data:
+static char data[1024];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  11:	89 c8                	mov    %ecx,%eax
+  int fd, i;
+  char *fname;
+
+  if(argc == 2){
+  13:	83 38 02             	cmpl   $0x2,(%eax)
+  16:	75 0b                	jne    23 <main+0x23>
+    fname = argv[1];
+  18:	8b 40 04             	mov    0x4(%eax),%eax
+  1b:	8b 40 04             	mov    0x4(%eax),%eax
+  1e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  21:	eb 07                	jmp    2a <main+0x2a>
+  }
+  else{
+    fname = TEST_FILE;
+  23:	c7 45 f0 da 0e 00 00 	movl   $0xeda,-0x10(%ebp)
+  }
+
+  if((fd = open(fname, O_CREATE | O_WRONLY)) < 0){
+  2a:	83 ec 08             	sub    $0x8,%esp
+  2d:	68 01 02 00 00       	push   $0x201
+  32:	ff 75 f0             	push   -0x10(%ebp)
+  35:	e8 ae 03 00 00       	call   3e8 <open>
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  40:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  44:	79 1a                	jns    60 <main+0x60>
+    printf(1, "error opening file: %s\n", fname);
+  46:	83 ec 04             	sub    $0x4,%esp
+  49:	ff 75 f0             	push   -0x10(%ebp)
+  4c:	68 e6 0e 00 00       	push   $0xee6
+  51:	6a 01                	push   $0x1
+  53:	e8 e8 07 00 00       	call   840 <printf>
+  58:	83 c4 10             	add    $0x10,%esp
+    exit();
+  5b:	e8 50 03 00 00       	call   3b0 <exit>
+  }
+
+  for(i = 0; i < 1024; ++i){
+  60:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  67:	eb 61                	jmp    ca <main+0xca>
+    if(write(fd, data, 1024) < 0){
+  69:	83 ec 04             	sub    $0x4,%esp
+  6c:	68 00 04 00 00       	push   $0x400
+  71:	68 00 13 00 00       	push   $0x1300
+  76:	ff 75 ec             	push   -0x14(%ebp)
+  79:	e8 4e 03 00 00       	call   3cc <write>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	85 c0                	test   %eax,%eax
+  83:	79 28                	jns    ad <main+0xad>
+      printf(1, "error writing to file: %s\n", fname);
+  85:	83 ec 04             	sub    $0x4,%esp
+  88:	ff 75 f0             	push   -0x10(%ebp)
+  8b:	68 fe 0e 00 00       	push   $0xefe
+  90:	6a 01                	push   $0x1
+  92:	e8 a9 07 00 00       	call   840 <printf>
+  97:	83 c4 10             	add    $0x10,%esp
+      close(fd);
+  9a:	83 ec 0c             	sub    $0xc,%esp
+  9d:	ff 75 ec             	push   -0x14(%ebp)
+  a0:	e8 2e 03 00 00       	call   3d3 <close>
+  a5:	83 c4 10             	add    $0x10,%esp
+      exit();
+  a8:	e8 03 03 00 00       	call   3b0 <exit>
+    }
+    printf(1, "wrote %d kilobytes\n", i + 1);
+  ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b0:	83 c0 01             	add    $0x1,%eax
+  b3:	83 ec 04             	sub    $0x4,%esp
+  b6:	50                   	push   %eax
+  b7:	68 19 0f 00 00       	push   $0xf19
+  bc:	6a 01                	push   $0x1
+  be:	e8 7d 07 00 00       	call   840 <printf>
+  c3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1024; ++i){
+  c6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  ca:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%ebp)
+  d1:	7e 96                	jle    69 <main+0x69>
+  }
+
+  printf(1, "closing: %s\n", fname);
+  d3:	83 ec 04             	sub    $0x4,%esp
+  d6:	ff 75 f0             	push   -0x10(%ebp)
+  d9:	68 2d 0f 00 00       	push   $0xf2d
+  de:	6a 01                	push   $0x1
+  e0:	e8 5b 07 00 00       	call   840 <printf>
+  e5:	83 c4 10             	add    $0x10,%esp
+  if(close(fd) < 0){
+  e8:	83 ec 0c             	sub    $0xc,%esp
+  eb:	ff 75 ec             	push   -0x14(%ebp)
+  ee:	e8 e0 02 00 00       	call   3d3 <close>
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	85 c0                	test   %eax,%eax
+  f8:	79 1a                	jns    114 <main+0x114>
+    printf(1, "error closing file: %s\n", fname);
+  fa:	83 ec 04             	sub    $0x4,%esp
+  fd:	ff 75 f0             	push   -0x10(%ebp)
+ 100:	68 3a 0f 00 00       	push   $0xf3a
+ 105:	6a 01                	push   $0x1
+ 107:	e8 34 07 00 00       	call   840 <printf>
+ 10c:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 10f:	e8 9c 02 00 00       	call   3b0 <exit>
+  }
+
+  exit();
+ 114:	e8 97 02 00 00       	call   3b0 <exit>
+
+00000119 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 119:	55                   	push   %ebp
+ 11a:	89 e5                	mov    %esp,%ebp
+ 11c:	57                   	push   %edi
+ 11d:	53                   	push   %ebx
+    if(cc < 1)
+ 11e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 121:	8b 55 10             	mov    0x10(%ebp),%edx
+ 124:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 127:	89 cb                	mov    %ecx,%ebx
+ 129:	89 df                	mov    %ebx,%edi
+ 12b:	89 d1                	mov    %edx,%ecx
+ 12d:	fc                   	cld
+ 12e:	f3 aa                	rep stos %al,%es:(%edi)
+ 130:	89 ca                	mov    %ecx,%edx
+ 132:	89 fb                	mov    %edi,%ebx
+ 134:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 137:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 13a:	90                   	nop
+ 13b:	5b                   	pop    %ebx
+ 13c:	5f                   	pop    %edi
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+
+0000013f <strcpy>:
+{
+ 13f:	55                   	push   %ebp
+ 140:	89 e5                	mov    %esp,%ebp
+ 142:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+ 148:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 14b:	90                   	nop
+ 14c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 14f:	8d 42 01             	lea    0x1(%edx),%eax
+ 152:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 155:	8b 45 08             	mov    0x8(%ebp),%eax
+ 158:	8d 48 01             	lea    0x1(%eax),%ecx
+ 15b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 15e:	0f b6 12             	movzbl (%edx),%edx
+ 161:	88 10                	mov    %dl,(%eax)
+ 163:	0f b6 00             	movzbl (%eax),%eax
+ 166:	84 c0                	test   %al,%al
+ 168:	75 e2                	jne    14c <strcpy+0xd>
+  return os;
+ 16a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 16d:	c9                   	leave
+ 16e:	c3                   	ret
+
+0000016f <strcmp>:
+{
+ 16f:	55                   	push   %ebp
+ 170:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 172:	eb 08                	jmp    17c <strcmp+0xd>
+    p++, q++;
+ 174:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 178:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 17c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17f:	0f b6 00             	movzbl (%eax),%eax
+ 182:	84 c0                	test   %al,%al
+ 184:	74 10                	je     196 <strcmp+0x27>
+ 186:	8b 45 08             	mov    0x8(%ebp),%eax
+ 189:	0f b6 10             	movzbl (%eax),%edx
+ 18c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18f:	0f b6 00             	movzbl (%eax),%eax
+ 192:	38 c2                	cmp    %al,%dl
+ 194:	74 de                	je     174 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 196:	8b 45 08             	mov    0x8(%ebp),%eax
+ 199:	0f b6 00             	movzbl (%eax),%eax
+ 19c:	0f b6 d0             	movzbl %al,%edx
+ 19f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a2:	0f b6 00             	movzbl (%eax),%eax
+ 1a5:	0f b6 c0             	movzbl %al,%eax
+ 1a8:	29 c2                	sub    %eax,%edx
+ 1aa:	89 d0                	mov    %edx,%eax
+}
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+
+000001ae <strlen>:
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1bb:	eb 04                	jmp    1c1 <strlen+0x13>
+ 1bd:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1c1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c7:	01 d0                	add    %edx,%eax
+ 1c9:	0f b6 00             	movzbl (%eax),%eax
+ 1cc:	84 c0                	test   %al,%al
+ 1ce:	75 ed                	jne    1bd <strlen+0xf>
+  return n;
+ 1d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1d3:	c9                   	leave
+ 1d4:	c3                   	ret
+
+000001d5 <memset>:
+{
+ 1d5:	55                   	push   %ebp
+ 1d6:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1d8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1db:	50                   	push   %eax
+ 1dc:	ff 75 0c             	push   0xc(%ebp)
+ 1df:	ff 75 08             	push   0x8(%ebp)
+ 1e2:	e8 32 ff ff ff       	call   119 <stosb>
+ 1e7:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ed:	c9                   	leave
+ 1ee:	c3                   	ret
+
+000001ef <strchr>:
+{
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	83 ec 04             	sub    $0x4,%esp
+ 1f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f8:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1fb:	eb 14                	jmp    211 <strchr+0x22>
+    if(*s == c)
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	0f b6 00             	movzbl (%eax),%eax
+ 203:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 206:	75 05                	jne    20d <strchr+0x1e>
+      return (char*)s;
+ 208:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20b:	eb 13                	jmp    220 <strchr+0x31>
+  for(; *s; s++)
+ 20d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 211:	8b 45 08             	mov    0x8(%ebp),%eax
+ 214:	0f b6 00             	movzbl (%eax),%eax
+ 217:	84 c0                	test   %al,%al
+ 219:	75 e2                	jne    1fd <strchr+0xe>
+  return 0;
+ 21b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 220:	c9                   	leave
+ 221:	c3                   	ret
+
+00000222 <gets>:
+{
+ 222:	55                   	push   %ebp
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 228:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 22f:	eb 42                	jmp    273 <gets+0x51>
+    cc = read(0, &c, 1);
+ 231:	83 ec 04             	sub    $0x4,%esp
+ 234:	6a 01                	push   $0x1
+ 236:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	6a 00                	push   $0x0
+ 23c:	e8 84 01 00 00       	call   3c5 <read>
+ 241:	83 c4 10             	add    $0x10,%esp
+ 244:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 247:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 24b:	7e 33                	jle    280 <gets+0x5e>
+    buf[i++] = c;
+ 24d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 250:	8d 50 01             	lea    0x1(%eax),%edx
+ 253:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 256:	89 c2                	mov    %eax,%edx
+ 258:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25b:	01 c2                	add    %eax,%edx
+ 25d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 261:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 263:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 267:	3c 0a                	cmp    $0xa,%al
+ 269:	74 16                	je     281 <gets+0x5f>
+ 26b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 26f:	3c 0d                	cmp    $0xd,%al
+ 271:	74 0e                	je     281 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 273:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 276:	83 c0 01             	add    $0x1,%eax
+ 279:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 27c:	7f b3                	jg     231 <gets+0xf>
+ 27e:	eb 01                	jmp    281 <gets+0x5f>
+      break;
+ 280:	90                   	nop
+  }
+  buf[i] = '\0';
+ 281:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 284:	8b 45 08             	mov    0x8(%ebp),%eax
+ 287:	01 d0                	add    %edx,%eax
+ 289:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 28f:	c9                   	leave
+ 290:	c3                   	ret
+
+00000291 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 291:	55                   	push   %ebp
+ 292:	89 e5                	mov    %esp,%ebp
+ 294:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 297:	83 ec 08             	sub    $0x8,%esp
+ 29a:	6a 00                	push   $0x0
+ 29c:	ff 75 08             	push   0x8(%ebp)
+ 29f:	e8 44 01 00 00       	call   3e8 <open>
+ 2a4:	83 c4 10             	add    $0x10,%esp
+ 2a7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2ae:	79 07                	jns    2b7 <stat+0x26>
+    return -1;
+ 2b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2b5:	eb 25                	jmp    2dc <stat+0x4b>
+  r = fstat(fd, st);
+ 2b7:	83 ec 08             	sub    $0x8,%esp
+ 2ba:	ff 75 0c             	push   0xc(%ebp)
+ 2bd:	ff 75 f4             	push   -0xc(%ebp)
+ 2c0:	e8 41 01 00 00       	call   406 <fstat>
+ 2c5:	83 c4 10             	add    $0x10,%esp
+ 2c8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2cb:	83 ec 0c             	sub    $0xc,%esp
+ 2ce:	ff 75 f4             	push   -0xc(%ebp)
+ 2d1:	e8 fd 00 00 00       	call   3d3 <close>
+ 2d6:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2dc:	c9                   	leave
+ 2dd:	c3                   	ret
+
+000002de <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2de:	55                   	push   %ebp
+ 2df:	89 e5                	mov    %esp,%ebp
+ 2e1:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2e4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2eb:	eb 25                	jmp    312 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2ed:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2f0:	89 d0                	mov    %edx,%eax
+ 2f2:	c1 e0 02             	shl    $0x2,%eax
+ 2f5:	01 d0                	add    %edx,%eax
+ 2f7:	01 c0                	add    %eax,%eax
+ 2f9:	89 c1                	mov    %eax,%ecx
+ 2fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fe:	8d 50 01             	lea    0x1(%eax),%edx
+ 301:	89 55 08             	mov    %edx,0x8(%ebp)
+ 304:	0f b6 00             	movzbl (%eax),%eax
+ 307:	0f be c0             	movsbl %al,%eax
+ 30a:	01 c8                	add    %ecx,%eax
+ 30c:	83 e8 30             	sub    $0x30,%eax
+ 30f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 312:	8b 45 08             	mov    0x8(%ebp),%eax
+ 315:	0f b6 00             	movzbl (%eax),%eax
+ 318:	3c 2f                	cmp    $0x2f,%al
+ 31a:	7e 0a                	jle    326 <atoi+0x48>
+ 31c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31f:	0f b6 00             	movzbl (%eax),%eax
+ 322:	3c 39                	cmp    $0x39,%al
+ 324:	7e c7                	jle    2ed <atoi+0xf>
+  return n;
+ 326:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 331:	8b 45 08             	mov    0x8(%ebp),%eax
+ 334:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 337:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 33d:	eb 17                	jmp    356 <memmove+0x2b>
+    *dst++ = *src++;
+ 33f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 342:	8d 42 01             	lea    0x1(%edx),%eax
+ 345:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 348:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 34b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 34e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 351:	0f b6 12             	movzbl (%edx),%edx
+ 354:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 356:	8b 45 10             	mov    0x10(%ebp),%eax
+ 359:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 35c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 35f:	85 c0                	test   %eax,%eax
+ 361:	7f dc                	jg     33f <memmove+0x14>
+  return vdst;
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 366:	c9                   	leave
+ 367:	c3                   	ret
+
+00000368 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 368:	83 3d e0 12 00 00 00 	cmpl   $0x0,0x12e0
+  jg 2f
+ 36f:	7f 2e                	jg     39f <dosyscall+0x37>
+  jl 1f
+ 371:	7c 29                	jl     39c <dosyscall+0x34>
+  pushl %eax
+ 373:	50                   	push   %eax
+  pushl %ebx
+ 374:	53                   	push   %ebx
+  movl $1, %eax
+ 375:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 37a:	0f a2                	cpuid
+  popl %ebx
+ 37c:	5b                   	pop    %ebx
+  popl %eax
+ 37d:	58                   	pop    %eax
+  movl $-1, sysmode
+ 37e:	c7 05 e0 12 00 00 ff 	movl   $0xffffffff,0x12e0
+ 385:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 388:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 38e:	74 0c                	je     39c <dosyscall+0x34>
+  movl $1, sysmode
+ 390:	c7 05 e0 12 00 00 01 	movl   $0x1,0x12e0
+ 397:	00 00 00 
+  jmp 2f
+ 39a:	eb 03                	jmp    39f <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 39c:	cd 40                	int    $0x40
+  ret
+ 39e:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 39f:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 3a1:	ba a8 03 00 00       	mov    $0x3a8,%edx
+  sysenter
+ 3a6:	0f 34                	sysenter
+3:
+  ret
+ 3a8:	c3                   	ret
+
+000003a9 <fork>:
+
+SYSCALL(fork)
+ 3a9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3ae:	eb b8                	jmp    368 <dosyscall>
+
+000003b0 <exit>:
+SYSCALL(exit)
+ 3b0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b5:	eb b1                	jmp    368 <dosyscall>
+
+000003b7 <wait>:
+SYSCALL(wait)
+ 3b7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3bc:	eb aa                	jmp    368 <dosyscall>
+
+000003be <pipe>:
+SYSCALL(pipe)
+ 3be:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c3:	eb a3                	jmp    368 <dosyscall>
+
+000003c5 <read>:
+SYSCALL(read)
+ 3c5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3ca:	eb 9c                	jmp    368 <dosyscall>
+
+000003cc <write>:
+SYSCALL(write)
+ 3cc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d1:	eb 95                	jmp    368 <dosyscall>
+
+000003d3 <close>:
+SYSCALL(close)
+ 3d3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d8:	eb 8e                	jmp    368 <dosyscall>
+
+000003da <kill>:
+SYSCALL(kill)
+ 3da:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3df:	eb 87                	jmp    368 <dosyscall>
+
+000003e1 <exec>:
+SYSCALL(exec)
+ 3e1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e6:	eb 80                	jmp    368 <dosyscall>
+
+000003e8 <open>:
+SYSCALL(open)
+ 3e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ed:	e9 76 ff ff ff       	jmp    368 <dosyscall>
+
+000003f2 <mknod>:
+SYSCALL(mknod)
+ 3f2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f7:	e9 6c ff ff ff       	jmp    368 <dosyscall>
+
+000003fc <unlink>:
+SYSCALL(unlink)
+ 3fc:	b8 12 00 00 00       	mov    $0x12,%eax
+ 401:	e9 62 ff ff ff       	jmp    368 <dosyscall>
+
+00000406 <fstat>:
+SYSCALL(fstat)
+ 406:	b8 08 00 00 00       	mov    $0x8,%eax
+ 40b:	e9 58 ff ff ff       	jmp    368 <dosyscall>
+
+00000410 <link>:
+SYSCALL(link)
+ 410:	b8 13 00 00 00       	mov    $0x13,%eax
+ 415:	e9 4e ff ff ff       	jmp    368 <dosyscall>
+
+0000041a <mkdir>:
+SYSCALL(mkdir)
+ 41a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 41f:	e9 44 ff ff ff       	jmp    368 <dosyscall>
+
+00000424 <chdir>:
+SYSCALL(chdir)
+ 424:	b8 09 00 00 00       	mov    $0x9,%eax
+ 429:	e9 3a ff ff ff       	jmp    368 <dosyscall>
+
+0000042e <dup>:
+SYSCALL(dup)
+ 42e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 433:	e9 30 ff ff ff       	jmp    368 <dosyscall>
+
+00000438 <getpid>:
+SYSCALL(getpid)
+ 438:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 43d:	e9 26 ff ff ff       	jmp    368 <dosyscall>
+
+00000442 <sbrk>:
+SYSCALL(sbrk)
+ 442:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 447:	e9 1c ff ff ff       	jmp    368 <dosyscall>
+
+0000044c <sleep>:
+SYSCALL(sleep)
+ 44c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 451:	e9 12 ff ff ff       	jmp    368 <dosyscall>
+
+00000456 <uptime>:
+SYSCALL(uptime)
+ 456:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 45b:	e9 08 ff ff ff       	jmp    368 <dosyscall>
+
+00000460 <symlink>:
+SYSCALL(symlink)
+ 460:	b8 16 00 00 00       	mov    $0x16,%eax
+ 465:	e9 fe fe ff ff       	jmp    368 <dosyscall>
+
+0000046a <readlink>:
+SYSCALL(readlink)
+ 46a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 46f:	e9 f4 fe ff ff       	jmp    368 <dosyscall>
+
+00000474 <fprot>:
+SYSCALL(fprot)
+ 474:	b8 18 00 00 00       	mov    $0x18,%eax
+ 479:	e9 ea fe ff ff       	jmp    368 <dosyscall>
+
+0000047e <funprot>:
+SYSCALL(funprot)
+ 47e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 483:	e9 e0 fe ff ff       	jmp    368 <dosyscall>
+
+00000488 <funlock>:
+SYSCALL(funlock)
+ 488:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 48d:	e9 d6 fe ff ff       	jmp    368 <dosyscall>
+
+00000492 <mmap>:
+SYSCALL(mmap)
+ 492:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 497:	e9 cc fe ff ff       	jmp    368 <dosyscall>
+
+0000049c <munmap>:
+SYSCALL(munmap)
+ 49c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a1:	e9 c2 fe ff ff       	jmp    368 <dosyscall>
+
+000004a6 <sendfile>:
+SYSCALL(sendfile)
+ 4a6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4ab:	e9 b8 fe ff ff       	jmp    368 <dosyscall>
+
+000004b0 <readv>:
+SYSCALL(readv)
+ 4b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4b5:	e9 ae fe ff ff       	jmp    368 <dosyscall>
+
+000004ba <writev>:
+SYSCALL(writev)
+ 4ba:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4bf:	e9 a4 fe ff ff       	jmp    368 <dosyscall>
+
+000004c4 <pread>:
+SYSCALL(pread)
+ 4c4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4c9:	e9 9a fe ff ff       	jmp    368 <dosyscall>
+
+000004ce <pwrite>:
+SYSCALL(pwrite)
+ 4ce:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4d3:	e9 90 fe ff ff       	jmp    368 <dosyscall>
+
+000004d8 <lseek>:
+SYSCALL(lseek)
+ 4d8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4dd:	e9 86 fe ff ff       	jmp    368 <dosyscall>
+
+000004e2 <spawn>:
+SYSCALL(spawn)
+ 4e2:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4e7:	e9 7c fe ff ff       	jmp    368 <dosyscall>
+
+000004ec <setpriority>:
+SYSCALL(setpriority)
+ 4ec:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4f1:	e9 72 fe ff ff       	jmp    368 <dosyscall>
+
+000004f6 <kthread_create>:
+SYSCALL(kthread_create)
+ 4f6:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4fb:	e9 68 fe ff ff       	jmp    368 <dosyscall>
+
+00000500 <kthread_id>:
+SYSCALL(kthread_id)
+ 500:	b8 26 00 00 00       	mov    $0x26,%eax
+ 505:	e9 5e fe ff ff       	jmp    368 <dosyscall>
+
+0000050a <kthread_exit>:
+SYSCALL(kthread_exit)
+ 50a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 50f:	e9 54 fe ff ff       	jmp    368 <dosyscall>
+
+00000514 <kthread_join>:
+SYSCALL(kthread_join)
+ 514:	b8 28 00 00 00       	mov    $0x28,%eax
+ 519:	e9 4a fe ff ff       	jmp    368 <dosyscall>
+
+0000051e <futex>:
+SYSCALL(futex)
+ 51e:	b8 29 00 00 00       	mov    $0x29,%eax
+ 523:	e9 40 fe ff ff       	jmp    368 <dosyscall>
+
+00000528 <signal>:
+SYSCALL(signal)
+ 528:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 52d:	e9 36 fe ff ff       	jmp    368 <dosyscall>
+
+00000532 <alarm>:
+SYSCALL(alarm)
+ 532:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 537:	e9 2c fe ff ff       	jmp    368 <dosyscall>
+
+0000053c <usleep>:
+SYSCALL(usleep)
+ 53c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 541:	e9 22 fe ff ff       	jmp    368 <dosyscall>
+
+00000546 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 546:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 54b:	e9 18 fe ff ff       	jmp    368 <dosyscall>
+
+00000550 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 550:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 555:	e9 0e fe ff ff       	jmp    368 <dosyscall>
+
+0000055a <getrusage>:
+SYSCALL(getrusage)
+ 55a:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 55f:	e9 04 fe ff ff       	jmp    368 <dosyscall>
+
+00000564 <mount>:
+SYSCALL(mount)
+ 564:	b8 30 00 00 00       	mov    $0x30,%eax
+ 569:	e9 fa fd ff ff       	jmp    368 <dosyscall>
+
+0000056e <getdents>:
+SYSCALL(getdents)
+ 56e:	b8 31 00 00 00       	mov    $0x31,%eax
+ 573:	e9 f0 fd ff ff       	jmp    368 <dosyscall>
+
+00000578 <yield>:
+SYSCALL(yield)
+ 578:	b8 32 00 00 00       	mov    $0x32,%eax
+ 57d:	e9 e6 fd ff ff       	jmp    368 <dosyscall>
+
+00000582 <ncpu>:
+SYSCALL(ncpu)
+ 582:	b8 33 00 00 00       	mov    $0x33,%eax
+ 587:	e9 dc fd ff ff       	jmp    368 <dosyscall>
+
+0000058c <fallocate>:
+SYSCALL(fallocate)
+ 58c:	b8 34 00 00 00       	mov    $0x34,%eax
+ 591:	e9 d2 fd ff ff       	jmp    368 <dosyscall>
+
+00000596 <ftruncate>:
+SYSCALL(ftruncate)
+ 596:	b8 35 00 00 00       	mov    $0x35,%eax
+ 59b:	e9 c8 fd ff ff       	jmp    368 <dosyscall>
+
+000005a0 <fsync>:
+SYSCALL(fsync)
+ 5a0:	b8 36 00 00 00       	mov    $0x36,%eax
+ 5a5:	e9 be fd ff ff       	jmp    368 <dosyscall>
+
+000005aa <fdatasync>:
+SYSCALL(fdatasync)
+ 5aa:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5af:	e9 b4 fd ff ff       	jmp    368 <dosyscall>
+
+000005b4 <poll>:
+SYSCALL(poll)
+ 5b4:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5b9:	e9 aa fd ff ff       	jmp    368 <dosyscall>
+
+000005be <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 5be:	55                   	push   %ebp
+ 5bf:	89 e5                	mov    %esp,%ebp
+ 5c1:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 5c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ca:	85 c0                	test   %eax,%eax
+ 5cc:	7e 1f                	jle    5ed <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d1:	8b 50 04             	mov    0x4(%eax),%edx
+ 5d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d7:	8d 48 08             	lea    0x8(%eax),%ecx
+ 5da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5dd:	8b 00                	mov    (%eax),%eax
+ 5df:	83 ec 04             	sub    $0x4,%esp
+ 5e2:	52                   	push   %edx
+ 5e3:	51                   	push   %ecx
+ 5e4:	50                   	push   %eax
+ 5e5:	e8 d0 fe ff ff       	call   4ba <writev>
+ 5ea:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f0:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 601:	00 00 00 
+}
+ 604:	90                   	nop
+ 605:	c9                   	leave
+ 606:	c3                   	ret
+
+00000607 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 607:	55                   	push   %ebp
+ 608:	89 e5                	mov    %esp,%ebp
+ 60a:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 60d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 611:	0f 84 94 00 00 00    	je     6ab <put+0xa4>
+    return;
+  if(o->n > 0){
+ 617:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61a:	8b 40 04             	mov    0x4(%eax),%eax
+ 61d:	85 c0                	test   %eax,%eax
+ 61f:	7e 40                	jle    661 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 621:	8b 45 08             	mov    0x8(%ebp),%eax
+ 624:	8b 40 04             	mov    0x4(%eax),%eax
+ 627:	83 e8 01             	sub    $0x1,%eax
+ 62a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 631:	8b 45 08             	mov    0x8(%ebp),%eax
+ 634:	01 d0                	add    %edx,%eax
+ 636:	83 c0 08             	add    $0x8,%eax
+ 639:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 63c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63f:	8b 10                	mov    (%eax),%edx
+ 641:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 644:	8b 40 04             	mov    0x4(%eax),%eax
+ 647:	01 d0                	add    %edx,%eax
+ 649:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 64c:	75 13                	jne    661 <put+0x5a>
+      v->iov_len += n;
+ 64e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 651:	8b 50 04             	mov    0x4(%eax),%edx
+ 654:	8b 45 10             	mov    0x10(%ebp),%eax
+ 657:	01 c2                	add    %eax,%edx
+ 659:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65c:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 65f:	eb 4b                	jmp    6ac <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 661:	8b 45 08             	mov    0x8(%ebp),%eax
+ 664:	8b 40 04             	mov    0x4(%eax),%eax
+ 667:	83 f8 10             	cmp    $0x10,%eax
+ 66a:	75 0e                	jne    67a <put+0x73>
+    flush(o);
+ 66c:	83 ec 0c             	sub    $0xc,%esp
+ 66f:	ff 75 08             	push   0x8(%ebp)
+ 672:	e8 47 ff ff ff       	call   5be <flush>
+ 677:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	8b 50 04             	mov    0x4(%eax),%edx
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 686:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 68a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68d:	8b 50 04             	mov    0x4(%eax),%edx
+ 690:	8b 45 08             	mov    0x8(%ebp),%eax
+ 693:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 696:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 69a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69d:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	89 50 04             	mov    %edx,0x4(%eax)
+ 6a9:	eb 01                	jmp    6ac <put+0xa5>
+    return;
+ 6ab:	90                   	nop
+}
+ 6ac:	c9                   	leave
+ 6ad:	c3                   	ret
+
+000006ae <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 6ae:	55                   	push   %ebp
+ 6af:	89 e5                	mov    %esp,%ebp
+ 6b1:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 6b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b7:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 6bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c0:	01 d0                	add    %edx,%eax
+ 6c2:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 6c7:	77 0b                	ja     6d4 <room+0x26>
+ 6c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cc:	8b 40 04             	mov    0x4(%eax),%eax
+ 6cf:	83 f8 10             	cmp    $0x10,%eax
+ 6d2:	75 0e                	jne    6e2 <room+0x34>
+    flush(o);
+ 6d4:	83 ec 0c             	sub    $0xc,%esp
+ 6d7:	ff 75 08             	push   0x8(%ebp)
+ 6da:	e8 df fe ff ff       	call   5be <flush>
+ 6df:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e5:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 6eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ee:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6f4:	01 d0                	add    %edx,%eax
+}
+ 6f6:	c9                   	leave
+ 6f7:	c3                   	ret
+
+000006f8 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 6f8:	55                   	push   %ebp
+ 6f9:	89 e5                	mov    %esp,%ebp
+ 6fb:	83 ec 28             	sub    $0x28,%esp
+ 6fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 701:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 704:	83 ec 08             	sub    $0x8,%esp
+ 707:	6a 01                	push   $0x1
+ 709:	ff 75 08             	push   0x8(%ebp)
+ 70c:	e8 9d ff ff ff       	call   6ae <room>
+ 711:	83 c4 10             	add    $0x10,%esp
+ 714:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 717:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71a:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 71e:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 720:	8b 45 08             	mov    0x8(%ebp),%eax
+ 723:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 729:	8d 50 01             	lea    0x1(%eax),%edx
+ 72c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	6a 01                	push   $0x1
+ 73a:	ff 75 f4             	push   -0xc(%ebp)
+ 73d:	ff 75 08             	push   0x8(%ebp)
+ 740:	e8 c2 fe ff ff       	call   607 <put>
+ 745:	83 c4 10             	add    $0x10,%esp
+}
+ 748:	90                   	nop
+ 749:	c9                   	leave
+ 74a:	c3                   	ret
+
+0000074b <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 74b:	55                   	push   %ebp
+ 74c:	89 e5                	mov    %esp,%ebp
+ 74e:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 751:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 758:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 75c:	74 17                	je     775 <printint+0x2a>
+ 75e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 762:	79 11                	jns    775 <printint+0x2a>
+    neg = 1;
+ 764:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 76b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 76e:	f7 d8                	neg    %eax
+ 770:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 773:	eb 06                	jmp    77b <printint+0x30>
+  } else {
+    x = xx;
+ 775:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 778:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 77b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 782:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 785:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 788:	ba 00 00 00 00       	mov    $0x0,%edx
+ 78d:	f7 f1                	div    %ecx
+ 78f:	89 d1                	mov    %edx,%ecx
+ 791:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 794:	8d 50 01             	lea    0x1(%eax),%edx
+ 797:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 79a:	0f b6 91 e4 12 00 00 	movzbl 0x12e4(%ecx),%edx
+ 7a1:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7a5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7ab:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7b0:	f7 f1                	div    %ecx
+ 7b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7b9:	75 c7                	jne    782 <printint+0x37>
+  if(neg)
+ 7bb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7bf:	74 0e                	je     7cf <printint+0x84>
+    buf[i++] = '-';
+ 7c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c4:	8d 50 01             	lea    0x1(%eax),%edx
+ 7c7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7ca:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 7cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 7d5:	83 ec 08             	sub    $0x8,%esp
+ 7d8:	ff 75 e8             	push   -0x18(%ebp)
+ 7db:	ff 75 08             	push   0x8(%ebp)
+ 7de:	e8 cb fe ff ff       	call   6ae <room>
+ 7e3:	83 c4 10             	add    $0x10,%esp
+ 7e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 7e9:	eb 1d                	jmp    808 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 7eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ee:	83 e8 01             	sub    $0x1,%eax
+ 7f1:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 7f4:	89 c2                	mov    %eax,%edx
+ 7f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7f9:	01 c2                	add    %eax,%edx
+ 7fb:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 7fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 801:	01 c8                	add    %ecx,%eax
+ 803:	0f b6 00             	movzbl (%eax),%eax
+ 806:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 808:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 80c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 810:	79 d9                	jns    7eb <printint+0xa0>
+  o->used += n;
+ 812:	8b 45 08             	mov    0x8(%ebp),%eax
+ 815:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 81b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 81e:	01 c2                	add    %eax,%edx
+ 820:	8b 45 08             	mov    0x8(%ebp),%eax
+ 823:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 829:	83 ec 04             	sub    $0x4,%esp
+ 82c:	ff 75 e8             	push   -0x18(%ebp)
+ 82f:	ff 75 e4             	push   -0x1c(%ebp)
+ 832:	ff 75 08             	push   0x8(%ebp)
+ 835:	e8 cd fd ff ff       	call   607 <put>
+ 83a:	83 c4 10             	add    $0x10,%esp
+}
+ 83d:	90                   	nop
+ 83e:	c9                   	leave
+ 83f:	c3                   	ret
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84c:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 852:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 859:	00 00 00 
+  o.used = 0;
+ 85c:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 863:	00 00 00 
+  state = 0;
+ 866:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 86d:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 870:	83 c0 04             	add    $0x4,%eax
+ 873:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 876:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 87d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 884:	e9 82 01 00 00       	jmp    a0b <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 889:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 88c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88f:	01 d0                	add    %edx,%eax
+ 891:	0f b6 00             	movzbl (%eax),%eax
+ 894:	0f be c0             	movsbl %al,%eax
+ 897:	25 ff 00 00 00       	and    $0xff,%eax
+ 89c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 89f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 8a3:	75 38                	jne    8dd <printf+0x9d>
+      if(c == '%'){
+ 8a5:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 8a9:	0f 85 58 01 00 00    	jne    a07 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 8af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 8b8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8bb:	01 ca                	add    %ecx,%edx
+ 8bd:	83 ec 04             	sub    $0x4,%esp
+ 8c0:	50                   	push   %eax
+ 8c1:	52                   	push   %edx
+ 8c2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8c8:	50                   	push   %eax
+ 8c9:	e8 39 fd ff ff       	call   607 <put>
+ 8ce:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 8d1:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 8d8:	e9 2a 01 00 00       	jmp    a07 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 8dd:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 8e1:	0f 85 20 01 00 00    	jne    a07 <printf+0x1c7>
+      if(c == 'd'){
+ 8e7:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 8eb:	75 22                	jne    90f <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 8ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8f0:	8b 00                	mov    (%eax),%eax
+ 8f2:	6a 01                	push   $0x1
+ 8f4:	6a 0a                	push   $0xa
+ 8f6:	50                   	push   %eax
+ 8f7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8fd:	50                   	push   %eax
+ 8fe:	e8 48 fe ff ff       	call   74b <printint>
+ 903:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 906:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 90a:	e9 e8 00 00 00       	jmp    9f7 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 90f:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 913:	74 06                	je     91b <printf+0xdb>
+ 915:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 919:	75 22                	jne    93d <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 91b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 91e:	8b 00                	mov    (%eax),%eax
+ 920:	6a 00                	push   $0x0
+ 922:	6a 10                	push   $0x10
+ 924:	50                   	push   %eax
+ 925:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 92b:	50                   	push   %eax
+ 92c:	e8 1a fe ff ff       	call   74b <printint>
+ 931:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 934:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 938:	e9 ba 00 00 00       	jmp    9f7 <printf+0x1b7>
+      } else if(c == 's'){
+ 93d:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 941:	75 3f                	jne    982 <printf+0x142>
+        s = (char*)*ap;
+ 943:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 946:	8b 00                	mov    (%eax),%eax
+ 948:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 94b:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 94f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 953:	75 07                	jne    95c <printf+0x11c>
+          s = "(null)";
+ 955:	c7 45 f4 52 0f 00 00 	movl   $0xf52,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 95c:	83 ec 0c             	sub    $0xc,%esp
+ 95f:	ff 75 f4             	push   -0xc(%ebp)
+ 962:	e8 47 f8 ff ff       	call   1ae <strlen>
+ 967:	83 c4 10             	add    $0x10,%esp
+ 96a:	83 ec 04             	sub    $0x4,%esp
+ 96d:	50                   	push   %eax
+ 96e:	ff 75 f4             	push   -0xc(%ebp)
+ 971:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 977:	50                   	push   %eax
+ 978:	e8 8a fc ff ff       	call   607 <put>
+ 97d:	83 c4 10             	add    $0x10,%esp
+ 980:	eb 75                	jmp    9f7 <printf+0x1b7>
+      } else if(c == 'c'){
+ 982:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 986:	75 21                	jne    9a9 <printf+0x169>
+        putc(&o, *ap);
+ 988:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 98b:	8b 00                	mov    (%eax),%eax
+ 98d:	0f be c0             	movsbl %al,%eax
+ 990:	83 ec 08             	sub    $0x8,%esp
+ 993:	50                   	push   %eax
+ 994:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 99a:	50                   	push   %eax
+ 99b:	e8 58 fd ff ff       	call   6f8 <putc>
+ 9a0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9a3:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9a7:	eb 4e                	jmp    9f7 <printf+0x1b7>
+      } else if(c == '%'){
+ 9a9:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9ad:	75 1b                	jne    9ca <printf+0x18a>
+        putc(&o, c);
+ 9af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9b2:	0f be c0             	movsbl %al,%eax
+ 9b5:	83 ec 08             	sub    $0x8,%esp
+ 9b8:	50                   	push   %eax
+ 9b9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9bf:	50                   	push   %eax
+ 9c0:	e8 33 fd ff ff       	call   6f8 <putc>
+ 9c5:	83 c4 10             	add    $0x10,%esp
+ 9c8:	eb 2d                	jmp    9f7 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 9ca:	83 ec 08             	sub    $0x8,%esp
+ 9cd:	6a 25                	push   $0x25
+ 9cf:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d5:	50                   	push   %eax
+ 9d6:	e8 1d fd ff ff       	call   6f8 <putc>
+ 9db:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 9de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9e1:	0f be c0             	movsbl %al,%eax
+ 9e4:	83 ec 08             	sub    $0x8,%esp
+ 9e7:	50                   	push   %eax
+ 9e8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9ee:	50                   	push   %eax
+ 9ef:	e8 04 fd ff ff       	call   6f8 <putc>
+ 9f4:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9f7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 9fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a01:	83 c0 01             	add    $0x1,%eax
+ a04:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a07:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a0e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a11:	01 d0                	add    %edx,%eax
+ a13:	0f b6 00             	movzbl (%eax),%eax
+ a16:	84 c0                	test   %al,%al
+ a18:	0f 85 6b fe ff ff    	jne    889 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ a1e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ a22:	75 22                	jne    a46 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ a24:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a27:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a2d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a30:	01 ca                	add    %ecx,%edx
+ a32:	83 ec 04             	sub    $0x4,%esp
+ a35:	50                   	push   %eax
+ a36:	52                   	push   %edx
+ a37:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a3d:	50                   	push   %eax
+ a3e:	e8 c4 fb ff ff       	call   607 <put>
+ a43:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ a46:	83 ec 0c             	sub    $0xc,%esp
+ a49:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a4f:	50                   	push   %eax
+ a50:	e8 69 fb ff ff       	call   5be <flush>
+ a55:	83 c4 10             	add    $0x10,%esp
+}
+ a58:	90                   	nop
+ a59:	c9                   	leave
+ a5a:	c3                   	ret
+
+00000a5b <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ a5b:	55                   	push   %ebp
+ a5c:	89 e5                	mov    %esp,%ebp
+ a5e:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ a61:	8b 55 08             	mov    0x8(%ebp),%edx
+ a64:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ a6a:	f0 87 02             	lock xchg %eax,(%edx)
+ a6d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a73:	c9                   	leave
+ a74:	c3                   	ret
+
+00000a75 <lock>:
+{
+ a75:	55                   	push   %ebp
+ a76:	89 e5                	mov    %esp,%ebp
+ a78:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a7b:	a1 00 17 00 00       	mov    0x1700,%eax
+ a80:	85 c0                	test   %eax,%eax
+ a82:	74 09                	je     a8d <lock+0x18>
+ a84:	a1 00 17 00 00       	mov    0x1700,%eax
+ a89:	ff d0                	call   *%eax
+ a8b:	eb 05                	jmp    a92 <lock+0x1d>
+ a8d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a95:	90                   	nop
+ a96:	83 ec 08             	sub    $0x8,%esp
+ a99:	6a 01                	push   $0x1
+ a9b:	68 38 17 00 00       	push   $0x1738
+ aa0:	e8 b6 ff ff ff       	call   a5b <xchg>
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	85 c0                	test   %eax,%eax
+ aaa:	75 ea                	jne    a96 <lock+0x21>
+  return pin;
+ aac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ aaf:	c9                   	leave
+ ab0:	c3                   	ret
+
+00000ab1 <unlock>:
+{
+ ab1:	55                   	push   %ebp
+ ab2:	89 e5                	mov    %esp,%ebp
+ ab4:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ ab7:	6a 00                	push   $0x0
+ ab9:	68 38 17 00 00       	push   $0x1738
+ abe:	e8 98 ff ff ff       	call   a5b <xchg>
+ ac3:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ ac6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ aca:	78 10                	js     adc <unlock+0x2b>
+    mallocunpin(pin);
+ acc:	a1 04 17 00 00       	mov    0x1704,%eax
+ ad1:	83 ec 0c             	sub    $0xc,%esp
+ ad4:	ff 75 08             	push   0x8(%ebp)
+ ad7:	ff d0                	call   *%eax
+ ad9:	83 c4 10             	add    $0x10,%esp
+}
+ adc:	90                   	nop
+ add:	c9                   	leave
+ ade:	c3                   	ret
+
+00000adf <sizeclass>:
+{
+ adf:	55                   	push   %ebp
+ ae0:	89 e5                	mov    %esp,%ebp
+ ae2:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ ae5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ aec:	eb 1c                	jmp    b0a <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ aee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af1:	ba 02 00 00 00       	mov    $0x2,%edx
+ af6:	89 c1                	mov    %eax,%ecx
+ af8:	d3 e2                	shl    %cl,%edx
+ afa:	89 d0                	mov    %edx,%eax
+ afc:	3b 45 08             	cmp    0x8(%ebp),%eax
+ aff:	72 05                	jb     b06 <sizeclass+0x27>
+      return c;
+ b01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b04:	eb 0f                	jmp    b15 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ b06:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ b0a:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ b0e:	7e de                	jle    aee <sizeclass+0xf>
+  return -1;
+ b10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b15:	c9                   	leave
+ b16:	c3                   	ret
+
+00000b17 <bigfree>:
+{
+ b17:	55                   	push   %ebp
+ b18:	89 e5                	mov    %esp,%ebp
+ b1a:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b1d:	a1 10 17 00 00       	mov    0x1710,%eax
+ b22:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b25:	eb 24                	jmp    b4b <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2a:	8b 00                	mov    (%eax),%eax
+ b2c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b2f:	72 12                	jb     b43 <bigfree+0x2c>
+ b31:	8b 45 08             	mov    0x8(%ebp),%eax
+ b34:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b37:	72 24                	jb     b5d <bigfree+0x46>
+ b39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3c:	8b 00                	mov    (%eax),%eax
+ b3e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b41:	72 1a                	jb     b5d <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b46:	8b 00                	mov    (%eax),%eax
+ b48:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b51:	73 d4                	jae    b27 <bigfree+0x10>
+ b53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b56:	8b 00                	mov    (%eax),%eax
+ b58:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b5b:	73 ca                	jae    b27 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b60:	8b 40 04             	mov    0x4(%eax),%eax
+ b63:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6d:	01 c2                	add    %eax,%edx
+ b6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b72:	8b 00                	mov    (%eax),%eax
+ b74:	39 c2                	cmp    %eax,%edx
+ b76:	75 24                	jne    b9c <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b78:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7b:	8b 50 04             	mov    0x4(%eax),%edx
+ b7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b81:	8b 00                	mov    (%eax),%eax
+ b83:	8b 40 04             	mov    0x4(%eax),%eax
+ b86:	01 c2                	add    %eax,%edx
+ b88:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8b:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b91:	8b 00                	mov    (%eax),%eax
+ b93:	8b 10                	mov    (%eax),%edx
+ b95:	8b 45 08             	mov    0x8(%ebp),%eax
+ b98:	89 10                	mov    %edx,(%eax)
+ b9a:	eb 0a                	jmp    ba6 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9f:	8b 10                	mov    (%eax),%edx
+ ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba4:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ba6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba9:	8b 40 04             	mov    0x4(%eax),%eax
+ bac:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb6:	01 d0                	add    %edx,%eax
+ bb8:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bbb:	75 20                	jne    bdd <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ bbd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc0:	8b 50 04             	mov    0x4(%eax),%edx
+ bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc6:	8b 40 04             	mov    0x4(%eax),%eax
+ bc9:	01 c2                	add    %eax,%edx
+ bcb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bce:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd4:	8b 10                	mov    (%eax),%edx
+ bd6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd9:	89 10                	mov    %edx,(%eax)
+ bdb:	eb 08                	jmp    be5 <bigfree+0xce>
+    p->s.ptr = bp;
+ bdd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be0:	8b 55 08             	mov    0x8(%ebp),%edx
+ be3:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ be5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be8:	a3 10 17 00 00       	mov    %eax,0x1710
+}
+ bed:	90                   	nop
+ bee:	c9                   	leave
+ bef:	c3                   	ret
+
+00000bf0 <free>:
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ bf6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bfa:	74 68                	je     c64 <free+0x74>
+  bp = (Header*)ap - 1;
+ bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bff:	83 e8 08             	sub    $0x8,%eax
+ c02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ c05:	e8 6b fe ff ff       	call   a75 <lock>
+ c0a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ c0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c10:	8b 40 04             	mov    0x4(%eax),%eax
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	50                   	push   %eax
+ c17:	e8 c3 fe ff ff       	call   adf <sizeclass>
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ c22:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ c26:	78 1e                	js     c46 <free+0x56>
+    bp->s.ptr = classfree[c];
+ c28:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c2b:	8b 14 85 14 17 00 00 	mov    0x1714(,%eax,4),%edx
+ c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c35:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ c37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c3d:	89 14 85 14 17 00 00 	mov    %edx,0x1714(,%eax,4)
+ c44:	eb 0e                	jmp    c54 <free+0x64>
+    bigfree(bp);
+ c46:	83 ec 0c             	sub    $0xc,%esp
+ c49:	ff 75 f4             	push   -0xc(%ebp)
+ c4c:	e8 c6 fe ff ff       	call   b17 <bigfree>
+ c51:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ c54:	83 ec 0c             	sub    $0xc,%esp
+ c57:	ff 75 f0             	push   -0x10(%ebp)
+ c5a:	e8 52 fe ff ff       	call   ab1 <unlock>
+ c5f:	83 c4 10             	add    $0x10,%esp
+ c62:	eb 01                	jmp    c65 <free+0x75>
+    return;
+ c64:	90                   	nop
+}
+ c65:	c9                   	leave
+ c66:	c3                   	ret
+
+00000c67 <morecore>:
+{
+ c67:	55                   	push   %ebp
+ c68:	89 e5                	mov    %esp,%ebp
+ c6a:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c6d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c74:	77 07                	ja     c7d <morecore+0x16>
+    nu = 4096;
+ c76:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c80:	c1 e0 03             	shl    $0x3,%eax
+ c83:	83 ec 0c             	sub    $0xc,%esp
+ c86:	50                   	push   %eax
+ c87:	e8 b6 f7 ff ff       	call   442 <sbrk>
+ c8c:	83 c4 10             	add    $0x10,%esp
+ c8f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c92:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c96:	75 07                	jne    c9f <morecore+0x38>
+    return 0;
+ c98:	b8 00 00 00 00       	mov    $0x0,%eax
+ c9d:	eb 22                	jmp    cc1 <morecore+0x5a>
+  hp = (Header*)p;
+ c9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ ca5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+ cab:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ cae:	83 ec 0c             	sub    $0xc,%esp
+ cb1:	ff 75 f0             	push   -0x10(%ebp)
+ cb4:	e8 5e fe ff ff       	call   b17 <bigfree>
+ cb9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cbc:	a1 10 17 00 00       	mov    0x1710,%eax
+}
+ cc1:	c9                   	leave
+ cc2:	c3                   	ret
+
+00000cc3 <bigalloc>:
+{
+ cc3:	55                   	push   %ebp
+ cc4:	89 e5                	mov    %esp,%ebp
+ cc6:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ cc9:	a1 10 17 00 00       	mov    0x1710,%eax
+ cce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cd1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cd5:	75 23                	jne    cfa <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ cd7:	c7 45 f0 08 17 00 00 	movl   $0x1708,-0x10(%ebp)
+ cde:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce1:	a3 10 17 00 00       	mov    %eax,0x1710
+ ce6:	a1 10 17 00 00       	mov    0x1710,%eax
+ ceb:	a3 08 17 00 00       	mov    %eax,0x1708
+    base.s.size = 0;
+ cf0:	c7 05 0c 17 00 00 00 	movl   $0x0,0x170c
+ cf7:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cfa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cfd:	8b 00                	mov    (%eax),%eax
+ cff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d05:	8b 40 04             	mov    0x4(%eax),%eax
+ d08:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d0b:	72 4a                	jb     d57 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ d0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d10:	8b 40 04             	mov    0x4(%eax),%eax
+ d13:	39 45 08             	cmp    %eax,0x8(%ebp)
+ d16:	75 0c                	jne    d24 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ d18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1b:	8b 10                	mov    (%eax),%edx
+ d1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d20:	89 10                	mov    %edx,(%eax)
+ d22:	eb 26                	jmp    d4a <bigalloc+0x87>
+        p->s.size -= nunits;
+ d24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d27:	8b 40 04             	mov    0x4(%eax),%eax
+ d2a:	2b 45 08             	sub    0x8(%ebp),%eax
+ d2d:	89 c2                	mov    %eax,%edx
+ d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d32:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d38:	8b 40 04             	mov    0x4(%eax),%eax
+ d3b:	c1 e0 03             	shl    $0x3,%eax
+ d3e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d44:	8b 55 08             	mov    0x8(%ebp),%edx
+ d47:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ d4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d4d:	a3 10 17 00 00       	mov    %eax,0x1710
+      return p;
+ d52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d55:	eb 3b                	jmp    d92 <bigalloc+0xcf>
+    if(p == freep)
+ d57:	a1 10 17 00 00       	mov    0x1710,%eax
+ d5c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d5f:	75 1e                	jne    d7f <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ d61:	83 ec 0c             	sub    $0xc,%esp
+ d64:	ff 75 08             	push   0x8(%ebp)
+ d67:	e8 fb fe ff ff       	call   c67 <morecore>
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d72:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d76:	75 07                	jne    d7f <bigalloc+0xbc>
+        return 0;
+ d78:	b8 00 00 00 00       	mov    $0x0,%eax
+ d7d:	eb 13                	jmp    d92 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d82:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d88:	8b 00                	mov    (%eax),%eax
+ d8a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d8d:	e9 70 ff ff ff       	jmp    d02 <bigalloc+0x3f>
+}
+ d92:	c9                   	leave
+ d93:	c3                   	ret
+
+00000d94 <alloc>:
+alloc(uint nbytes)
+{
+ d94:	55                   	push   %ebp
+ d95:	89 e5                	mov    %esp,%ebp
+ d97:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ d9d:	83 c0 07             	add    $0x7,%eax
+ da0:	c1 e8 03             	shr    $0x3,%eax
+ da3:	83 c0 01             	add    $0x1,%eax
+ da6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ da9:	ff 75 f4             	push   -0xc(%ebp)
+ dac:	e8 2e fd ff ff       	call   adf <sizeclass>
+ db1:	83 c4 04             	add    $0x4,%esp
+ db4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ db7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ dbb:	79 2c                	jns    de9 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ dbd:	83 ec 0c             	sub    $0xc,%esp
+ dc0:	ff 75 f4             	push   -0xc(%ebp)
+ dc3:	e8 fb fe ff ff       	call   cc3 <bigalloc>
+ dc8:	83 c4 10             	add    $0x10,%esp
+ dcb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ dce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dd2:	75 0a                	jne    dde <alloc+0x4a>
+      return 0;
+ dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+ dd9:	e9 c8 00 00 00       	jmp    ea6 <alloc+0x112>
+    return (void*)(p + 1);
+ dde:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ de1:	83 c0 08             	add    $0x8,%eax
+ de4:	e9 bd 00 00 00       	jmp    ea6 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ de9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dec:	8b 04 85 14 17 00 00 	mov    0x1714(,%eax,4),%eax
+ df3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ df6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dfa:	74 1a                	je     e16 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ dfc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dff:	8b 10                	mov    (%eax),%edx
+ e01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e04:	89 14 85 14 17 00 00 	mov    %edx,0x1714(,%eax,4)
+    return (void*)(p + 1);
+ e0b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e0e:	83 c0 08             	add    $0x8,%eax
+ e11:	e9 90 00 00 00       	jmp    ea6 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ e16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e19:	ba 02 00 00 00       	mov    $0x2,%edx
+ e1e:	89 c1                	mov    %eax,%ecx
+ e20:	d3 e2                	shl    %cl,%edx
+ e22:	89 d0                	mov    %edx,%eax
+ e24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ e27:	a1 30 17 00 00       	mov    0x1730,%eax
+ e2c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e2f:	c1 e2 03             	shl    $0x3,%edx
+ e32:	01 d0                	add    %edx,%eax
+ e34:	8b 15 34 17 00 00    	mov    0x1734,%edx
+ e3a:	39 c2                	cmp    %eax,%edx
+ e3c:	73 3f                	jae    e7d <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ e3e:	83 ec 0c             	sub    $0xc,%esp
+ e41:	68 00 08 00 00       	push   $0x800
+ e46:	e8 78 fe ff ff       	call   cc3 <bigalloc>
+ e4b:	83 c4 10             	add    $0x10,%esp
+ e4e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e51:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e55:	75 07                	jne    e5e <alloc+0xca>
+      return 0;
+ e57:	b8 00 00 00 00       	mov    $0x0,%eax
+ e5c:	eb 48                	jmp    ea6 <alloc+0x112>
+    bump = (char*)p;
+ e5e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e61:	a3 30 17 00 00       	mov    %eax,0x1730
+    bumpend = (char*)(p + p->s.size);
+ e66:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e69:	8b 40 04             	mov    0x4(%eax),%eax
+ e6c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e76:	01 d0                	add    %edx,%eax
+ e78:	a3 34 17 00 00       	mov    %eax,0x1734
+  }
+  p = (Header*)bump;
+ e7d:	a1 30 17 00 00       	mov    0x1730,%eax
+ e82:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ e85:	a1 30 17 00 00       	mov    0x1730,%eax
+ e8a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e8d:	c1 e2 03             	shl    $0x3,%edx
+ e90:	01 d0                	add    %edx,%eax
+ e92:	a3 30 17 00 00       	mov    %eax,0x1730
+  p->s.size = nunits;
+ e97:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e9a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e9d:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ ea0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ea3:	83 c0 08             	add    $0x8,%eax
+}
+ ea6:	c9                   	leave
+ ea7:	c3                   	ret
+
+00000ea8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ea8:	55                   	push   %ebp
+ ea9:	89 e5                	mov    %esp,%ebp
+ eab:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ eae:	e8 c2 fb ff ff       	call   a75 <lock>
+ eb3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ eb6:	83 ec 0c             	sub    $0xc,%esp
+ eb9:	ff 75 08             	push   0x8(%ebp)
+ ebc:	e8 d3 fe ff ff       	call   d94 <alloc>
+ ec1:	83 c4 10             	add    $0x10,%esp
+ ec4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ ec7:	83 ec 0c             	sub    $0xc,%esp
+ eca:	ff 75 f4             	push   -0xc(%ebp)
+ ecd:	e8 df fb ff ff       	call   ab1 <unlock>
+ ed2:	83 c4 10             	add    $0x10,%esp
+  return p;
+ ed5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ed8:	c9                   	leave
+ ed9:	c3                   	ret
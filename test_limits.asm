@@ -0,0 +1,1951 @@
+
+_test_limits:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define NFD 200    // well past the initial fd table
+#define NCHILD 100 // more processes than the old fixed table
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec c4 04 00 00    	sub    $0x4c4,%esp
+  int i, fd[NFD], pid[NCHILD];
+
+  for(i = 0; i < NFD; i++){
+  14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  1b:	eb 43                	jmp    60 <main+0x60>
+    if((fd[i] = dup(1)) < 0){
+  1d:	83 ec 0c             	sub    $0xc,%esp
+  20:	6a 01                	push   $0x1
+  22:	e8 0f 05 00 00       	call   536 <dup>
+  27:	83 c4 10             	add    $0x10,%esp
+  2a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  2d:	89 84 95 d4 fc ff ff 	mov    %eax,-0x32c(%ebp,%edx,4)
+  34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  37:	8b 84 85 d4 fc ff ff 	mov    -0x32c(%ebp,%eax,4),%eax
+  3e:	85 c0                	test   %eax,%eax
+  40:	79 1a                	jns    5c <main+0x5c>
+      printf(1, "error: dup %d\n", i);
+  42:	83 ec 04             	sub    $0x4,%esp
+  45:	ff 75 f4             	push   -0xc(%ebp)
+  48:	68 e4 0f 00 00       	push   $0xfe4
+  4d:	6a 01                	push   $0x1
+  4f:	e8 f4 08 00 00       	call   948 <printf>
+  54:	83 c4 10             	add    $0x10,%esp
+      exit();
+  57:	e8 5c 04 00 00       	call   4b8 <exit>
+  for(i = 0; i < NFD; i++){
+  5c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  60:	81 7d f4 c7 00 00 00 	cmpl   $0xc7,-0xc(%ebp)
+  67:	7e b4                	jle    1d <main+0x1d>
+    }
+  }
+  close(fd[10]);
+  69:	8b 85 fc fc ff ff    	mov    -0x304(%ebp),%eax
+  6f:	83 ec 0c             	sub    $0xc,%esp
+  72:	50                   	push   %eax
+  73:	e8 63 04 00 00       	call   4db <close>
+  78:	83 c4 10             	add    $0x10,%esp
+  if(dup(1) != fd[10]){
+  7b:	83 ec 0c             	sub    $0xc,%esp
+  7e:	6a 01                	push   $0x1
+  80:	e8 b1 04 00 00       	call   536 <dup>
+  85:	83 c4 10             	add    $0x10,%esp
+  88:	89 c2                	mov    %eax,%edx
+  8a:	8b 85 fc fc ff ff    	mov    -0x304(%ebp),%eax
+  90:	39 c2                	cmp    %eax,%edx
+  92:	74 17                	je     ab <main+0xab>
+    printf(1, "error: lowest descriptor not reused\n");
+  94:	83 ec 08             	sub    $0x8,%esp
+  97:	68 f4 0f 00 00       	push   $0xff4
+  9c:	6a 01                	push   $0x1
+  9e:	e8 a5 08 00 00       	call   948 <printf>
+  a3:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a6:	e8 0d 04 00 00       	call   4b8 <exit>
+  }
+  if(write(fd[NFD-1], "fds ok\n", 7) != 7){
+  ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  ae:	83 ec 04             	sub    $0x4,%esp
+  b1:	6a 07                	push   $0x7
+  b3:	68 19 10 00 00       	push   $0x1019
+  b8:	50                   	push   %eax
+  b9:	e8 16 04 00 00       	call   4d4 <write>
+  be:	83 c4 10             	add    $0x10,%esp
+  c1:	83 f8 07             	cmp    $0x7,%eax
+  c4:	74 17                	je     dd <main+0xdd>
+    printf(1, "error: write to high fd\n");
+  c6:	83 ec 08             	sub    $0x8,%esp
+  c9:	68 21 10 00 00       	push   $0x1021
+  ce:	6a 01                	push   $0x1
+  d0:	e8 73 08 00 00       	call   948 <printf>
+  d5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  d8:	e8 db 03 00 00       	call   4b8 <exit>
+  }
+  for(i = 0; i < NFD; i++)
+  dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  e4:	eb 1a                	jmp    100 <main+0x100>
+    close(fd[i]);
+  e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  e9:	8b 84 85 d4 fc ff ff 	mov    -0x32c(%ebp,%eax,4),%eax
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	50                   	push   %eax
+  f4:	e8 e2 03 00 00       	call   4db <close>
+  f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NFD; i++)
+  fc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 100:	81 7d f4 c7 00 00 00 	cmpl   $0xc7,-0xc(%ebp)
+ 107:	7e dd                	jle    e6 <main+0xe6>
+
+  for(i = 0; i < NCHILD; i++){
+ 109:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 110:	eb 5e                	jmp    170 <main+0x170>
+    if((pid[i] = fork()) < 0){
+ 112:	e8 9a 03 00 00       	call   4b1 <fork>
+ 117:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 11a:	89 84 95 44 fb ff ff 	mov    %eax,-0x4bc(%ebp,%edx,4)
+ 121:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 124:	8b 84 85 44 fb ff ff 	mov    -0x4bc(%ebp,%eax,4),%eax
+ 12b:	85 c0                	test   %eax,%eax
+ 12d:	79 1a                	jns    149 <main+0x149>
+      printf(1, "error: fork %d\n", i);
+ 12f:	83 ec 04             	sub    $0x4,%esp
+ 132:	ff 75 f4             	push   -0xc(%ebp)
+ 135:	68 3a 10 00 00       	push   $0x103a
+ 13a:	6a 01                	push   $0x1
+ 13c:	e8 07 08 00 00       	call   948 <printf>
+ 141:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 144:	e8 6f 03 00 00       	call   4b8 <exit>
+    }
+    if(pid[i] == 0){
+ 149:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 14c:	8b 84 85 44 fb ff ff 	mov    -0x4bc(%ebp,%eax,4),%eax
+ 153:	85 c0                	test   %eax,%eax
+ 155:	75 15                	jne    16c <main+0x16c>
+      sleep(1000);
+ 157:	83 ec 0c             	sub    $0xc,%esp
+ 15a:	68 e8 03 00 00       	push   $0x3e8
+ 15f:	e8 f0 03 00 00       	call   554 <sleep>
+ 164:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 167:	e8 4c 03 00 00       	call   4b8 <exit>
+  for(i = 0; i < NCHILD; i++){
+ 16c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 170:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+ 174:	7e 9c                	jle    112 <main+0x112>
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+ 176:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17d:	eb 1a                	jmp    199 <main+0x199>
+    kill(pid[i]);
+ 17f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 182:	8b 84 85 44 fb ff ff 	mov    -0x4bc(%ebp,%eax,4),%eax
+ 189:	83 ec 0c             	sub    $0xc,%esp
+ 18c:	50                   	push   %eax
+ 18d:	e8 50 03 00 00       	call   4e2 <kill>
+ 192:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NCHILD; i++)
+ 195:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 199:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+ 19d:	7e e0                	jle    17f <main+0x17f>
+  for(i = 0; i < NCHILD; i++)
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 24                	jmp    1cc <main+0x1cc>
+    if(wait() < 0){
+ 1a8:	e8 12 03 00 00       	call   4bf <wait>
+ 1ad:	85 c0                	test   %eax,%eax
+ 1af:	79 17                	jns    1c8 <main+0x1c8>
+      printf(1, "error: wait\n");
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	68 4a 10 00 00       	push   $0x104a
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	e8 88 07 00 00       	call   948 <printf>
+ 1c0:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 1c3:	e8 f0 02 00 00       	call   4b8 <exit>
+  for(i = 0; i < NCHILD; i++)
+ 1c8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1cc:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+ 1d0:	7e d6                	jle    1a8 <main+0x1a8>
+    }
+  if(wait() != -1 || kill(pid[0]) != -1){
+ 1d2:	e8 e8 02 00 00       	call   4bf <wait>
+ 1d7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1da:	75 17                	jne    1f3 <main+0x1f3>
+ 1dc:	8b 85 44 fb ff ff    	mov    -0x4bc(%ebp),%eax
+ 1e2:	83 ec 0c             	sub    $0xc,%esp
+ 1e5:	50                   	push   %eax
+ 1e6:	e8 f7 02 00 00       	call   4e2 <kill>
+ 1eb:	83 c4 10             	add    $0x10,%esp
+ 1ee:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1f1:	74 17                	je     20a <main+0x20a>
+    printf(1, "error: stale child\n");
+ 1f3:	83 ec 08             	sub    $0x8,%esp
+ 1f6:	68 57 10 00 00       	push   $0x1057
+ 1fb:	6a 01                	push   $0x1
+ 1fd:	e8 46 07 00 00       	call   948 <printf>
+ 202:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 205:	e8 ae 02 00 00       	call   4b8 <exit>
+  }
+  printf(1, "procs ok\n");
+ 20a:	83 ec 08             	sub    $0x8,%esp
+ 20d:	68 6b 10 00 00       	push   $0x106b
+ 212:	6a 01                	push   $0x1
+ 214:	e8 2f 07 00 00       	call   948 <printf>
+ 219:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 21c:	e8 97 02 00 00       	call   4b8 <exit>
+
+00000221 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 221:	55                   	push   %ebp
+ 222:	89 e5                	mov    %esp,%ebp
+ 224:	57                   	push   %edi
+ 225:	53                   	push   %ebx
+    if(cc < 1)
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 55 10             	mov    0x10(%ebp),%edx
+ 22c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22f:	89 cb                	mov    %ecx,%ebx
+ 231:	89 df                	mov    %ebx,%edi
+ 233:	89 d1                	mov    %edx,%ecx
+ 235:	fc                   	cld
+ 236:	f3 aa                	rep stos %al,%es:(%edi)
+ 238:	89 ca                	mov    %ecx,%edx
+ 23a:	89 fb                	mov    %edi,%ebx
+ 23c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 23f:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 242:	90                   	nop
+ 243:	5b                   	pop    %ebx
+ 244:	5f                   	pop    %edi
+ 245:	5d                   	pop    %ebp
+ 246:	c3                   	ret
+
+00000247 <strcpy>:
+{
+ 247:	55                   	push   %ebp
+ 248:	89 e5                	mov    %esp,%ebp
+ 24a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 24d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 250:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 253:	90                   	nop
+ 254:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 257:	8d 42 01             	lea    0x1(%edx),%eax
+ 25a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 25d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 260:	8d 48 01             	lea    0x1(%eax),%ecx
+ 263:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 266:	0f b6 12             	movzbl (%edx),%edx
+ 269:	88 10                	mov    %dl,(%eax)
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	84 c0                	test   %al,%al
+ 270:	75 e2                	jne    254 <strcpy+0xd>
+  return os;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <strcmp>:
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 27a:	eb 08                	jmp    284 <strcmp+0xd>
+    p++, q++;
+ 27c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 280:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 284:	8b 45 08             	mov    0x8(%ebp),%eax
+ 287:	0f b6 00             	movzbl (%eax),%eax
+ 28a:	84 c0                	test   %al,%al
+ 28c:	74 10                	je     29e <strcmp+0x27>
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 291:	0f b6 10             	movzbl (%eax),%edx
+ 294:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 297:	0f b6 00             	movzbl (%eax),%eax
+ 29a:	38 c2                	cmp    %al,%dl
+ 29c:	74 de                	je     27c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 29e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a1:	0f b6 00             	movzbl (%eax),%eax
+ 2a4:	0f b6 d0             	movzbl %al,%edx
+ 2a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2aa:	0f b6 00             	movzbl (%eax),%eax
+ 2ad:	0f b6 c0             	movzbl %al,%eax
+ 2b0:	29 c2                	sub    %eax,%edx
+ 2b2:	89 d0                	mov    %edx,%eax
+}
+ 2b4:	5d                   	pop    %ebp
+ 2b5:	c3                   	ret
+
+000002b6 <strlen>:
+{
+ 2b6:	55                   	push   %ebp
+ 2b7:	89 e5                	mov    %esp,%ebp
+ 2b9:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 2bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2c3:	eb 04                	jmp    2c9 <strlen+0x13>
+ 2c5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2c9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cf:	01 d0                	add    %edx,%eax
+ 2d1:	0f b6 00             	movzbl (%eax),%eax
+ 2d4:	84 c0                	test   %al,%al
+ 2d6:	75 ed                	jne    2c5 <strlen+0xf>
+  return n;
+ 2d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+
+000002dd <memset>:
+{
+ 2dd:	55                   	push   %ebp
+ 2de:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2e0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2e3:	50                   	push   %eax
+ 2e4:	ff 75 0c             	push   0xc(%ebp)
+ 2e7:	ff 75 08             	push   0x8(%ebp)
+ 2ea:	e8 32 ff ff ff       	call   221 <stosb>
+ 2ef:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2f5:	c9                   	leave
+ 2f6:	c3                   	ret
+
+000002f7 <strchr>:
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	83 ec 04             	sub    $0x4,%esp
+ 2fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 300:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 303:	eb 14                	jmp    319 <strchr+0x22>
+    if(*s == c)
+ 305:	8b 45 08             	mov    0x8(%ebp),%eax
+ 308:	0f b6 00             	movzbl (%eax),%eax
+ 30b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 30e:	75 05                	jne    315 <strchr+0x1e>
+      return (char*)s;
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+ 313:	eb 13                	jmp    328 <strchr+0x31>
+  for(; *s; s++)
+ 315:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	0f b6 00             	movzbl (%eax),%eax
+ 31f:	84 c0                	test   %al,%al
+ 321:	75 e2                	jne    305 <strchr+0xe>
+  return 0;
+ 323:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 328:	c9                   	leave
+ 329:	c3                   	ret
+
+0000032a <gets>:
+{
+ 32a:	55                   	push   %ebp
+ 32b:	89 e5                	mov    %esp,%ebp
+ 32d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 330:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 337:	eb 42                	jmp    37b <gets+0x51>
+    cc = read(0, &c, 1);
+ 339:	83 ec 04             	sub    $0x4,%esp
+ 33c:	6a 01                	push   $0x1
+ 33e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 341:	50                   	push   %eax
+ 342:	6a 00                	push   $0x0
+ 344:	e8 84 01 00 00       	call   4cd <read>
+ 349:	83 c4 10             	add    $0x10,%esp
+ 34c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 34f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 353:	7e 33                	jle    388 <gets+0x5e>
+    buf[i++] = c;
+ 355:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 358:	8d 50 01             	lea    0x1(%eax),%edx
+ 35b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 35e:	89 c2                	mov    %eax,%edx
+ 360:	8b 45 08             	mov    0x8(%ebp),%eax
+ 363:	01 c2                	add    %eax,%edx
+ 365:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 369:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 36b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 36f:	3c 0a                	cmp    $0xa,%al
+ 371:	74 16                	je     389 <gets+0x5f>
+ 373:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 377:	3c 0d                	cmp    $0xd,%al
+ 379:	74 0e                	je     389 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 37b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 37e:	83 c0 01             	add    $0x1,%eax
+ 381:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 384:	7f b3                	jg     339 <gets+0xf>
+ 386:	eb 01                	jmp    389 <gets+0x5f>
+      break;
+ 388:	90                   	nop
+  }
+  buf[i] = '\0';
+ 389:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 38c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38f:	01 d0                	add    %edx,%eax
+ 391:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 394:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+
+00000399 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39f:	83 ec 08             	sub    $0x8,%esp
+ 3a2:	6a 00                	push   $0x0
+ 3a4:	ff 75 08             	push   0x8(%ebp)
+ 3a7:	e8 44 01 00 00       	call   4f0 <open>
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3b6:	79 07                	jns    3bf <stat+0x26>
+    return -1;
+ 3b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3bd:	eb 25                	jmp    3e4 <stat+0x4b>
+  r = fstat(fd, st);
+ 3bf:	83 ec 08             	sub    $0x8,%esp
+ 3c2:	ff 75 0c             	push   0xc(%ebp)
+ 3c5:	ff 75 f4             	push   -0xc(%ebp)
+ 3c8:	e8 41 01 00 00       	call   50e <fstat>
+ 3cd:	83 c4 10             	add    $0x10,%esp
+ 3d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3d3:	83 ec 0c             	sub    $0xc,%esp
+ 3d6:	ff 75 f4             	push   -0xc(%ebp)
+ 3d9:	e8 fd 00 00 00       	call   4db <close>
+ 3de:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3e4:	c9                   	leave
+ 3e5:	c3                   	ret
+
+000003e6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e6:	55                   	push   %ebp
+ 3e7:	89 e5                	mov    %esp,%ebp
+ 3e9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3f3:	eb 25                	jmp    41a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3f5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3f8:	89 d0                	mov    %edx,%eax
+ 3fa:	c1 e0 02             	shl    $0x2,%eax
+ 3fd:	01 d0                	add    %edx,%eax
+ 3ff:	01 c0                	add    %eax,%eax
+ 401:	89 c1                	mov    %eax,%ecx
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	8d 50 01             	lea    0x1(%eax),%edx
+ 409:	89 55 08             	mov    %edx,0x8(%ebp)
+ 40c:	0f b6 00             	movzbl (%eax),%eax
+ 40f:	0f be c0             	movsbl %al,%eax
+ 412:	01 c8                	add    %ecx,%eax
+ 414:	83 e8 30             	sub    $0x30,%eax
+ 417:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 41a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41d:	0f b6 00             	movzbl (%eax),%eax
+ 420:	3c 2f                	cmp    $0x2f,%al
+ 422:	7e 0a                	jle    42e <atoi+0x48>
+ 424:	8b 45 08             	mov    0x8(%ebp),%eax
+ 427:	0f b6 00             	movzbl (%eax),%eax
+ 42a:	3c 39                	cmp    $0x39,%al
+ 42c:	7e c7                	jle    3f5 <atoi+0xf>
+  return n;
+ 42e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 431:	c9                   	leave
+ 432:	c3                   	ret
+
+00000433 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 433:	55                   	push   %ebp
+ 434:	89 e5                	mov    %esp,%ebp
+ 436:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 439:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 43f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 442:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 445:	eb 17                	jmp    45e <memmove+0x2b>
+    *dst++ = *src++;
+ 447:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 44a:	8d 42 01             	lea    0x1(%edx),%eax
+ 44d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 450:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 453:	8d 48 01             	lea    0x1(%eax),%ecx
+ 456:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 459:	0f b6 12             	movzbl (%edx),%edx
+ 45c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 45e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 461:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 464:	89 55 10             	mov    %edx,0x10(%ebp)
+ 467:	85 c0                	test   %eax,%eax
+ 469:	7f dc                	jg     447 <memmove+0x14>
+  return vdst;
+ 46b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 46e:	c9                   	leave
+ 46f:	c3                   	ret
+
+00000470 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 470:	83 3d 00 14 00 00 00 	cmpl   $0x0,0x1400
+  jg 2f
+ 477:	7f 2e                	jg     4a7 <dosyscall+0x37>
+  jl 1f
+ 479:	7c 29                	jl     4a4 <dosyscall+0x34>
+  pushl %eax
+ 47b:	50                   	push   %eax
+  pushl %ebx
+ 47c:	53                   	push   %ebx
+  movl $1, %eax
+ 47d:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 482:	0f a2                	cpuid
+  popl %ebx
+ 484:	5b                   	pop    %ebx
+  popl %eax
+ 485:	58                   	pop    %eax
+  movl $-1, sysmode
+ 486:	c7 05 00 14 00 00 ff 	movl   $0xffffffff,0x1400
+ 48d:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 490:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 496:	74 0c                	je     4a4 <dosyscall+0x34>
+  movl $1, sysmode
+ 498:	c7 05 00 14 00 00 01 	movl   $0x1,0x1400
+ 49f:	00 00 00 
+  jmp 2f
+ 4a2:	eb 03                	jmp    4a7 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 4a4:	cd 40                	int    $0x40
+  ret
+ 4a6:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 4a7:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 4a9:	ba b0 04 00 00       	mov    $0x4b0,%edx
+  sysenter
+ 4ae:	0f 34                	sysenter
+3:
+  ret
+ 4b0:	c3                   	ret
+
+000004b1 <fork>:
+
+SYSCALL(fork)
+ 4b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b6:	eb b8                	jmp    470 <dosyscall>
+
+000004b8 <exit>:
+SYSCALL(exit)
+ 4b8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4bd:	eb b1                	jmp    470 <dosyscall>
+
+000004bf <wait>:
+SYSCALL(wait)
+ 4bf:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c4:	eb aa                	jmp    470 <dosyscall>
+
+000004c6 <pipe>:
+SYSCALL(pipe)
+ 4c6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4cb:	eb a3                	jmp    470 <dosyscall>
+
+000004cd <read>:
+SYSCALL(read)
+ 4cd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d2:	eb 9c                	jmp    470 <dosyscall>
+
+000004d4 <write>:
+SYSCALL(write)
+ 4d4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d9:	eb 95                	jmp    470 <dosyscall>
+
+000004db <close>:
+SYSCALL(close)
+ 4db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e0:	eb 8e                	jmp    470 <dosyscall>
+
+000004e2 <kill>:
+SYSCALL(kill)
+ 4e2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e7:	eb 87                	jmp    470 <dosyscall>
+
+000004e9 <exec>:
+SYSCALL(exec)
+ 4e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ee:	eb 80                	jmp    470 <dosyscall>
+
+000004f0 <open>:
+SYSCALL(open)
+ 4f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f5:	e9 76 ff ff ff       	jmp    470 <dosyscall>
+
+000004fa <mknod>:
+SYSCALL(mknod)
+ 4fa:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4ff:	e9 6c ff ff ff       	jmp    470 <dosyscall>
+
+00000504 <unlink>:
+SYSCALL(unlink)
+ 504:	b8 12 00 00 00       	mov    $0x12,%eax
+ 509:	e9 62 ff ff ff       	jmp    470 <dosyscall>
+
+0000050e <fstat>:
+SYSCALL(fstat)
+ 50e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 513:	e9 58 ff ff ff       	jmp    470 <dosyscall>
+
+00000518 <link>:
+SYSCALL(link)
+ 518:	b8 13 00 00 00       	mov    $0x13,%eax
+ 51d:	e9 4e ff ff ff       	jmp    470 <dosyscall>
+
+00000522 <mkdir>:
+SYSCALL(mkdir)
+ 522:	b8 14 00 00 00       	mov    $0x14,%eax
+ 527:	e9 44 ff ff ff       	jmp    470 <dosyscall>
+
+0000052c <chdir>:
+SYSCALL(chdir)
+ 52c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 531:	e9 3a ff ff ff       	jmp    470 <dosyscall>
+
+00000536 <dup>:
+SYSCALL(dup)
+ 536:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 53b:	e9 30 ff ff ff       	jmp    470 <dosyscall>
+
+00000540 <getpid>:
+SYSCALL(getpid)
+ 540:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 545:	e9 26 ff ff ff       	jmp    470 <dosyscall>
+
+0000054a <sbrk>:
+SYSCALL(sbrk)
+ 54a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 54f:	e9 1c ff ff ff       	jmp    470 <dosyscall>
+
+00000554 <sleep>:
+SYSCALL(sleep)
+ 554:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 559:	e9 12 ff ff ff       	jmp    470 <dosyscall>
+
+0000055e <uptime>:
+SYSCALL(uptime)
+ 55e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 563:	e9 08 ff ff ff       	jmp    470 <dosyscall>
+
+00000568 <symlink>:
+SYSCALL(symlink)
+ 568:	b8 16 00 00 00       	mov    $0x16,%eax
+ 56d:	e9 fe fe ff ff       	jmp    470 <dosyscall>
+
+00000572 <readlink>:
+SYSCALL(readlink)
+ 572:	b8 17 00 00 00       	mov    $0x17,%eax
+ 577:	e9 f4 fe ff ff       	jmp    470 <dosyscall>
+
+0000057c <fprot>:
+SYSCALL(fprot)
+ 57c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 581:	e9 ea fe ff ff       	jmp    470 <dosyscall>
+
+00000586 <funprot>:
+SYSCALL(funprot)
+ 586:	b8 19 00 00 00       	mov    $0x19,%eax
+ 58b:	e9 e0 fe ff ff       	jmp    470 <dosyscall>
+
+00000590 <funlock>:
+SYSCALL(funlock)
+ 590:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 595:	e9 d6 fe ff ff       	jmp    470 <dosyscall>
+
+0000059a <mmap>:
+SYSCALL(mmap)
+ 59a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 59f:	e9 cc fe ff ff       	jmp    470 <dosyscall>
+
+000005a4 <munmap>:
+SYSCALL(munmap)
+ 5a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5a9:	e9 c2 fe ff ff       	jmp    470 <dosyscall>
+
+000005ae <sendfile>:
+SYSCALL(sendfile)
+ 5ae:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5b3:	e9 b8 fe ff ff       	jmp    470 <dosyscall>
+
+000005b8 <readv>:
+SYSCALL(readv)
+ 5b8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5bd:	e9 ae fe ff ff       	jmp    470 <dosyscall>
+
+000005c2 <writev>:
+SYSCALL(writev)
+ 5c2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5c7:	e9 a4 fe ff ff       	jmp    470 <dosyscall>
+
+000005cc <pread>:
+SYSCALL(pread)
+ 5cc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5d1:	e9 9a fe ff ff       	jmp    470 <dosyscall>
+
+000005d6 <pwrite>:
+SYSCALL(pwrite)
+ 5d6:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5db:	e9 90 fe ff ff       	jmp    470 <dosyscall>
+
+000005e0 <lseek>:
+SYSCALL(lseek)
+ 5e0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e5:	e9 86 fe ff ff       	jmp    470 <dosyscall>
+
+000005ea <spawn>:
+SYSCALL(spawn)
+ 5ea:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5ef:	e9 7c fe ff ff       	jmp    470 <dosyscall>
+
+000005f4 <setpriority>:
+SYSCALL(setpriority)
+ 5f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5f9:	e9 72 fe ff ff       	jmp    470 <dosyscall>
+
+000005fe <kthread_create>:
+SYSCALL(kthread_create)
+ 5fe:	b8 25 00 00 00       	mov    $0x25,%eax
+ 603:	e9 68 fe ff ff       	jmp    470 <dosyscall>
+
+00000608 <kthread_id>:
+SYSCALL(kthread_id)
+ 608:	b8 26 00 00 00       	mov    $0x26,%eax
+ 60d:	e9 5e fe ff ff       	jmp    470 <dosyscall>
+
+00000612 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 612:	b8 27 00 00 00       	mov    $0x27,%eax
+ 617:	e9 54 fe ff ff       	jmp    470 <dosyscall>
+
+0000061c <kthread_join>:
+SYSCALL(kthread_join)
+ 61c:	b8 28 00 00 00       	mov    $0x28,%eax
+ 621:	e9 4a fe ff ff       	jmp    470 <dosyscall>
+
+00000626 <futex>:
+SYSCALL(futex)
+ 626:	b8 29 00 00 00       	mov    $0x29,%eax
+ 62b:	e9 40 fe ff ff       	jmp    470 <dosyscall>
+
+00000630 <signal>:
+SYSCALL(signal)
+ 630:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 635:	e9 36 fe ff ff       	jmp    470 <dosyscall>
+
+0000063a <alarm>:
+SYSCALL(alarm)
+ 63a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 63f:	e9 2c fe ff ff       	jmp    470 <dosyscall>
+
+00000644 <usleep>:
+SYSCALL(usleep)
+ 644:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 649:	e9 22 fe ff ff       	jmp    470 <dosyscall>
+
+0000064e <ioring_setup>:
+SYSCALL(ioring_setup)
+ 64e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 653:	e9 18 fe ff ff       	jmp    470 <dosyscall>
+
+00000658 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 658:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 65d:	e9 0e fe ff ff       	jmp    470 <dosyscall>
+
+00000662 <getrusage>:
+SYSCALL(getrusage)
+ 662:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 667:	e9 04 fe ff ff       	jmp    470 <dosyscall>
+
+0000066c <mount>:
+SYSCALL(mount)
+ 66c:	b8 30 00 00 00       	mov    $0x30,%eax
+ 671:	e9 fa fd ff ff       	jmp    470 <dosyscall>
+
+00000676 <getdents>:
+SYSCALL(getdents)
+ 676:	b8 31 00 00 00       	mov    $0x31,%eax
+ 67b:	e9 f0 fd ff ff       	jmp    470 <dosyscall>
+
+00000680 <yield>:
+SYSCALL(yield)
+ 680:	b8 32 00 00 00       	mov    $0x32,%eax
+ 685:	e9 e6 fd ff ff       	jmp    470 <dosyscall>
+
+0000068a <ncpu>:
+SYSCALL(ncpu)
+ 68a:	b8 33 00 00 00       	mov    $0x33,%eax
+ 68f:	e9 dc fd ff ff       	jmp    470 <dosyscall>
+
+00000694 <fallocate>:
+SYSCALL(fallocate)
+ 694:	b8 34 00 00 00       	mov    $0x34,%eax
+ 699:	e9 d2 fd ff ff       	jmp    470 <dosyscall>
+
+0000069e <ftruncate>:
+SYSCALL(ftruncate)
+ 69e:	b8 35 00 00 00       	mov    $0x35,%eax
+ 6a3:	e9 c8 fd ff ff       	jmp    470 <dosyscall>
+
+000006a8 <fsync>:
+SYSCALL(fsync)
+ 6a8:	b8 36 00 00 00       	mov    $0x36,%eax
+ 6ad:	e9 be fd ff ff       	jmp    470 <dosyscall>
+
+000006b2 <fdatasync>:
+SYSCALL(fdatasync)
+ 6b2:	b8 37 00 00 00       	mov    $0x37,%eax
+ 6b7:	e9 b4 fd ff ff       	jmp    470 <dosyscall>
+
+000006bc <poll>:
+SYSCALL(poll)
+ 6bc:	b8 38 00 00 00       	mov    $0x38,%eax
+ 6c1:	e9 aa fd ff ff       	jmp    470 <dosyscall>
+
+000006c6 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 6c6:	55                   	push   %ebp
+ 6c7:	89 e5                	mov    %esp,%ebp
+ 6c9:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 6cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cf:	8b 40 04             	mov    0x4(%eax),%eax
+ 6d2:	85 c0                	test   %eax,%eax
+ 6d4:	7e 1f                	jle    6f5 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 6d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d9:	8b 50 04             	mov    0x4(%eax),%edx
+ 6dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6df:	8d 48 08             	lea    0x8(%eax),%ecx
+ 6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e5:	8b 00                	mov    (%eax),%eax
+ 6e7:	83 ec 04             	sub    $0x4,%esp
+ 6ea:	52                   	push   %edx
+ 6eb:	51                   	push   %ecx
+ 6ec:	50                   	push   %eax
+ 6ed:	e8 d0 fe ff ff       	call   5c2 <writev>
+ 6f2:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 6f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 702:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 709:	00 00 00 
+}
+ 70c:	90                   	nop
+ 70d:	c9                   	leave
+ 70e:	c3                   	ret
+
+0000070f <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 70f:	55                   	push   %ebp
+ 710:	89 e5                	mov    %esp,%ebp
+ 712:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 715:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 719:	0f 84 94 00 00 00    	je     7b3 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 71f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 722:	8b 40 04             	mov    0x4(%eax),%eax
+ 725:	85 c0                	test   %eax,%eax
+ 727:	7e 40                	jle    769 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72c:	8b 40 04             	mov    0x4(%eax),%eax
+ 72f:	83 e8 01             	sub    $0x1,%eax
+ 732:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 739:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73c:	01 d0                	add    %edx,%eax
+ 73e:	83 c0 08             	add    $0x8,%eax
+ 741:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 744:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 747:	8b 10                	mov    (%eax),%edx
+ 749:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 74c:	8b 40 04             	mov    0x4(%eax),%eax
+ 74f:	01 d0                	add    %edx,%eax
+ 751:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 754:	75 13                	jne    769 <put+0x5a>
+      v->iov_len += n;
+ 756:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 759:	8b 50 04             	mov    0x4(%eax),%edx
+ 75c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 75f:	01 c2                	add    %eax,%edx
+ 761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 764:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 767:	eb 4b                	jmp    7b4 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 769:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76c:	8b 40 04             	mov    0x4(%eax),%eax
+ 76f:	83 f8 10             	cmp    $0x10,%eax
+ 772:	75 0e                	jne    782 <put+0x73>
+    flush(o);
+ 774:	83 ec 0c             	sub    $0xc,%esp
+ 777:	ff 75 08             	push   0x8(%ebp)
+ 77a:	e8 47 ff ff ff       	call   6c6 <flush>
+ 77f:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 782:	8b 45 08             	mov    0x8(%ebp),%eax
+ 785:	8b 50 04             	mov    0x4(%eax),%edx
+ 788:	8b 45 08             	mov    0x8(%ebp),%eax
+ 78b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 78e:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 792:	8b 45 08             	mov    0x8(%ebp),%eax
+ 795:	8b 50 04             	mov    0x4(%eax),%edx
+ 798:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 79e:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 7a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a5:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a8:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ae:	89 50 04             	mov    %edx,0x4(%eax)
+ 7b1:	eb 01                	jmp    7b4 <put+0xa5>
+    return;
+ 7b3:	90                   	nop
+}
+ 7b4:	c9                   	leave
+ 7b5:	c3                   	ret
+
+000007b6 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 7b6:	55                   	push   %ebp
+ 7b7:	89 e5                	mov    %esp,%ebp
+ 7b9:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 7bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bf:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c8:	01 d0                	add    %edx,%eax
+ 7ca:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 7cf:	77 0b                	ja     7dc <room+0x26>
+ 7d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d4:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d7:	83 f8 10             	cmp    $0x10,%eax
+ 7da:	75 0e                	jne    7ea <room+0x34>
+    flush(o);
+ 7dc:	83 ec 0c             	sub    $0xc,%esp
+ 7df:	ff 75 08             	push   0x8(%ebp)
+ 7e2:	e8 df fe ff ff       	call   6c6 <flush>
+ 7e7:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 7ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ed:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 7f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f6:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7fc:	01 d0                	add    %edx,%eax
+}
+ 7fe:	c9                   	leave
+ 7ff:	c3                   	ret
+
+00000800 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	83 ec 28             	sub    $0x28,%esp
+ 806:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 809:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 80c:	83 ec 08             	sub    $0x8,%esp
+ 80f:	6a 01                	push   $0x1
+ 811:	ff 75 08             	push   0x8(%ebp)
+ 814:	e8 9d ff ff ff       	call   7b6 <room>
+ 819:	83 c4 10             	add    $0x10,%esp
+ 81c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 81f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 822:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 826:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 828:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 831:	8d 50 01             	lea    0x1(%eax),%edx
+ 834:	8b 45 08             	mov    0x8(%ebp),%eax
+ 837:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 83d:	83 ec 04             	sub    $0x4,%esp
+ 840:	6a 01                	push   $0x1
+ 842:	ff 75 f4             	push   -0xc(%ebp)
+ 845:	ff 75 08             	push   0x8(%ebp)
+ 848:	e8 c2 fe ff ff       	call   70f <put>
+ 84d:	83 c4 10             	add    $0x10,%esp
+}
+ 850:	90                   	nop
+ 851:	c9                   	leave
+ 852:	c3                   	ret
+
+00000853 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 853:	55                   	push   %ebp
+ 854:	89 e5                	mov    %esp,%ebp
+ 856:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 859:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 860:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 864:	74 17                	je     87d <printint+0x2a>
+ 866:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 86a:	79 11                	jns    87d <printint+0x2a>
+    neg = 1;
+ 86c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 873:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 876:	f7 d8                	neg    %eax
+ 878:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 87b:	eb 06                	jmp    883 <printint+0x30>
+  } else {
+    x = xx;
+ 87d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 880:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 883:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 88a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 88d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 890:	ba 00 00 00 00       	mov    $0x0,%edx
+ 895:	f7 f1                	div    %ecx
+ 897:	89 d1                	mov    %edx,%ecx
+ 899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89c:	8d 50 01             	lea    0x1(%eax),%edx
+ 89f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8a2:	0f b6 91 04 14 00 00 	movzbl 0x1404(%ecx),%edx
+ 8a9:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8b3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8b8:	f7 f1                	div    %ecx
+ 8ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8c1:	75 c7                	jne    88a <printint+0x37>
+  if(neg)
+ 8c3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8c7:	74 0e                	je     8d7 <printint+0x84>
+    buf[i++] = '-';
+ 8c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 8cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8d2:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 8d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8da:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 8dd:	83 ec 08             	sub    $0x8,%esp
+ 8e0:	ff 75 e8             	push   -0x18(%ebp)
+ 8e3:	ff 75 08             	push   0x8(%ebp)
+ 8e6:	e8 cb fe ff ff       	call   7b6 <room>
+ 8eb:	83 c4 10             	add    $0x10,%esp
+ 8ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 8f1:	eb 1d                	jmp    910 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 8f3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f6:	83 e8 01             	sub    $0x1,%eax
+ 8f9:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8fc:	89 c2                	mov    %eax,%edx
+ 8fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 901:	01 c2                	add    %eax,%edx
+ 903:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 906:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 909:	01 c8                	add    %ecx,%eax
+ 90b:	0f b6 00             	movzbl (%eax),%eax
+ 90e:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 910:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 914:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 918:	79 d9                	jns    8f3 <printint+0xa0>
+  o->used += n;
+ 91a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91d:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 923:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 926:	01 c2                	add    %eax,%edx
+ 928:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92b:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 931:	83 ec 04             	sub    $0x4,%esp
+ 934:	ff 75 e8             	push   -0x18(%ebp)
+ 937:	ff 75 e4             	push   -0x1c(%ebp)
+ 93a:	ff 75 08             	push   0x8(%ebp)
+ 93d:	e8 cd fd ff ff       	call   70f <put>
+ 942:	83 c4 10             	add    $0x10,%esp
+}
+ 945:	90                   	nop
+ 946:	c9                   	leave
+ 947:	c3                   	ret
+
+00000948 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 948:	55                   	push   %ebp
+ 949:	89 e5                	mov    %esp,%ebp
+ 94b:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 951:	8b 45 08             	mov    0x8(%ebp),%eax
+ 954:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 95a:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 961:	00 00 00 
+  o.used = 0;
+ 964:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 96b:	00 00 00 
+  state = 0;
+ 96e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 975:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 978:	83 c0 04             	add    $0x4,%eax
+ 97b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 97e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 985:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 98c:	e9 82 01 00 00       	jmp    b13 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 991:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 994:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 997:	01 d0                	add    %edx,%eax
+ 999:	0f b6 00             	movzbl (%eax),%eax
+ 99c:	0f be c0             	movsbl %al,%eax
+ 99f:	25 ff 00 00 00       	and    $0xff,%eax
+ 9a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 9a7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 9ab:	75 38                	jne    9e5 <printf+0x9d>
+      if(c == '%'){
+ 9ad:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9b1:	0f 85 58 01 00 00    	jne    b0f <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 9b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ba:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9c0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9c3:	01 ca                	add    %ecx,%edx
+ 9c5:	83 ec 04             	sub    $0x4,%esp
+ 9c8:	50                   	push   %eax
+ 9c9:	52                   	push   %edx
+ 9ca:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d0:	50                   	push   %eax
+ 9d1:	e8 39 fd ff ff       	call   70f <put>
+ 9d6:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 9d9:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 9e0:	e9 2a 01 00 00       	jmp    b0f <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 9e5:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 9e9:	0f 85 20 01 00 00    	jne    b0f <printf+0x1c7>
+      if(c == 'd'){
+ 9ef:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 9f3:	75 22                	jne    a17 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 9f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f8:	8b 00                	mov    (%eax),%eax
+ 9fa:	6a 01                	push   $0x1
+ 9fc:	6a 0a                	push   $0xa
+ 9fe:	50                   	push   %eax
+ 9ff:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a05:	50                   	push   %eax
+ a06:	e8 48 fe ff ff       	call   853 <printint>
+ a0b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a0e:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a12:	e9 e8 00 00 00       	jmp    aff <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ a17:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ a1b:	74 06                	je     a23 <printf+0xdb>
+ a1d:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ a21:	75 22                	jne    a45 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ a23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a26:	8b 00                	mov    (%eax),%eax
+ a28:	6a 00                	push   $0x0
+ a2a:	6a 10                	push   $0x10
+ a2c:	50                   	push   %eax
+ a2d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a33:	50                   	push   %eax
+ a34:	e8 1a fe ff ff       	call   853 <printint>
+ a39:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a3c:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a40:	e9 ba 00 00 00       	jmp    aff <printf+0x1b7>
+      } else if(c == 's'){
+ a45:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ a49:	75 3f                	jne    a8a <printf+0x142>
+        s = (char*)*ap;
+ a4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a4e:	8b 00                	mov    (%eax),%eax
+ a50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a53:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ a57:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a5b:	75 07                	jne    a64 <printf+0x11c>
+          s = "(null)";
+ a5d:	c7 45 f4 75 10 00 00 	movl   $0x1075,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a64:	83 ec 0c             	sub    $0xc,%esp
+ a67:	ff 75 f4             	push   -0xc(%ebp)
+ a6a:	e8 47 f8 ff ff       	call   2b6 <strlen>
+ a6f:	83 c4 10             	add    $0x10,%esp
+ a72:	83 ec 04             	sub    $0x4,%esp
+ a75:	50                   	push   %eax
+ a76:	ff 75 f4             	push   -0xc(%ebp)
+ a79:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a7f:	50                   	push   %eax
+ a80:	e8 8a fc ff ff       	call   70f <put>
+ a85:	83 c4 10             	add    $0x10,%esp
+ a88:	eb 75                	jmp    aff <printf+0x1b7>
+      } else if(c == 'c'){
+ a8a:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a8e:	75 21                	jne    ab1 <printf+0x169>
+        putc(&o, *ap);
+ a90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a93:	8b 00                	mov    (%eax),%eax
+ a95:	0f be c0             	movsbl %al,%eax
+ a98:	83 ec 08             	sub    $0x8,%esp
+ a9b:	50                   	push   %eax
+ a9c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ aa2:	50                   	push   %eax
+ aa3:	e8 58 fd ff ff       	call   800 <putc>
+ aa8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ aab:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ aaf:	eb 4e                	jmp    aff <printf+0x1b7>
+      } else if(c == '%'){
+ ab1:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ ab5:	75 1b                	jne    ad2 <printf+0x18a>
+        putc(&o, c);
+ ab7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ aba:	0f be c0             	movsbl %al,%eax
+ abd:	83 ec 08             	sub    $0x8,%esp
+ ac0:	50                   	push   %eax
+ ac1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ac7:	50                   	push   %eax
+ ac8:	e8 33 fd ff ff       	call   800 <putc>
+ acd:	83 c4 10             	add    $0x10,%esp
+ ad0:	eb 2d                	jmp    aff <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ ad2:	83 ec 08             	sub    $0x8,%esp
+ ad5:	6a 25                	push   $0x25
+ ad7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ add:	50                   	push   %eax
+ ade:	e8 1d fd ff ff       	call   800 <putc>
+ ae3:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ ae6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ae9:	0f be c0             	movsbl %al,%eax
+ aec:	83 ec 08             	sub    $0x8,%esp
+ aef:	50                   	push   %eax
+ af0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ af6:	50                   	push   %eax
+ af7:	e8 04 fd ff ff       	call   800 <putc>
+ afc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ aff:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ b06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b09:	83 c0 01             	add    $0x1,%eax
+ b0c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b0f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b13:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b19:	01 d0                	add    %edx,%eax
+ b1b:	0f b6 00             	movzbl (%eax),%eax
+ b1e:	84 c0                	test   %al,%al
+ b20:	0f 85 6b fe ff ff    	jne    991 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ b26:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ b2a:	75 22                	jne    b4e <printf+0x206>
+    put(&o, fmt + start, i - start);
+ b2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b2f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b35:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b38:	01 ca                	add    %ecx,%edx
+ b3a:	83 ec 04             	sub    $0x4,%esp
+ b3d:	50                   	push   %eax
+ b3e:	52                   	push   %edx
+ b3f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b45:	50                   	push   %eax
+ b46:	e8 c4 fb ff ff       	call   70f <put>
+ b4b:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ b4e:	83 ec 0c             	sub    $0xc,%esp
+ b51:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b57:	50                   	push   %eax
+ b58:	e8 69 fb ff ff       	call   6c6 <flush>
+ b5d:	83 c4 10             	add    $0x10,%esp
+}
+ b60:	90                   	nop
+ b61:	c9                   	leave
+ b62:	c3                   	ret
+
+00000b63 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b63:	55                   	push   %ebp
+ b64:	89 e5                	mov    %esp,%ebp
+ b66:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b69:	8b 55 08             	mov    0x8(%ebp),%edx
+ b6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b72:	f0 87 02             	lock xchg %eax,(%edx)
+ b75:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b7b:	c9                   	leave
+ b7c:	c3                   	ret
+
+00000b7d <lock>:
+{
+ b7d:	55                   	push   %ebp
+ b7e:	89 e5                	mov    %esp,%ebp
+ b80:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b83:	a1 18 14 00 00       	mov    0x1418,%eax
+ b88:	85 c0                	test   %eax,%eax
+ b8a:	74 09                	je     b95 <lock+0x18>
+ b8c:	a1 18 14 00 00       	mov    0x1418,%eax
+ b91:	ff d0                	call   *%eax
+ b93:	eb 05                	jmp    b9a <lock+0x1d>
+ b95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b9a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b9d:	90                   	nop
+ b9e:	83 ec 08             	sub    $0x8,%esp
+ ba1:	6a 01                	push   $0x1
+ ba3:	68 50 14 00 00       	push   $0x1450
+ ba8:	e8 b6 ff ff ff       	call   b63 <xchg>
+ bad:	83 c4 10             	add    $0x10,%esp
+ bb0:	85 c0                	test   %eax,%eax
+ bb2:	75 ea                	jne    b9e <lock+0x21>
+  return pin;
+ bb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ bb7:	c9                   	leave
+ bb8:	c3                   	ret
+
+00000bb9 <unlock>:
+{
+ bb9:	55                   	push   %ebp
+ bba:	89 e5                	mov    %esp,%ebp
+ bbc:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ bbf:	6a 00                	push   $0x0
+ bc1:	68 50 14 00 00       	push   $0x1450
+ bc6:	e8 98 ff ff ff       	call   b63 <xchg>
+ bcb:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ bce:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bd2:	78 10                	js     be4 <unlock+0x2b>
+    mallocunpin(pin);
+ bd4:	a1 1c 14 00 00       	mov    0x141c,%eax
+ bd9:	83 ec 0c             	sub    $0xc,%esp
+ bdc:	ff 75 08             	push   0x8(%ebp)
+ bdf:	ff d0                	call   *%eax
+ be1:	83 c4 10             	add    $0x10,%esp
+}
+ be4:	90                   	nop
+ be5:	c9                   	leave
+ be6:	c3                   	ret
+
+00000be7 <sizeclass>:
+{
+ be7:	55                   	push   %ebp
+ be8:	89 e5                	mov    %esp,%ebp
+ bea:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ bed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ bf4:	eb 1c                	jmp    c12 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ bf6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf9:	ba 02 00 00 00       	mov    $0x2,%edx
+ bfe:	89 c1                	mov    %eax,%ecx
+ c00:	d3 e2                	shl    %cl,%edx
+ c02:	89 d0                	mov    %edx,%eax
+ c04:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c07:	72 05                	jb     c0e <sizeclass+0x27>
+      return c;
+ c09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0c:	eb 0f                	jmp    c1d <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ c0e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ c12:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ c16:	7e de                	jle    bf6 <sizeclass+0xf>
+  return -1;
+ c18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ c1d:	c9                   	leave
+ c1e:	c3                   	ret
+
+00000c1f <bigfree>:
+{
+ c1f:	55                   	push   %ebp
+ c20:	89 e5                	mov    %esp,%ebp
+ c22:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c25:	a1 28 14 00 00       	mov    0x1428,%eax
+ c2a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c2d:	eb 24                	jmp    c53 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c32:	8b 00                	mov    (%eax),%eax
+ c34:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c37:	72 12                	jb     c4b <bigfree+0x2c>
+ c39:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c3f:	72 24                	jb     c65 <bigfree+0x46>
+ c41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c44:	8b 00                	mov    (%eax),%eax
+ c46:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c49:	72 1a                	jb     c65 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c4b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4e:	8b 00                	mov    (%eax),%eax
+ c50:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c53:	8b 45 08             	mov    0x8(%ebp),%eax
+ c56:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c59:	73 d4                	jae    c2f <bigfree+0x10>
+ c5b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5e:	8b 00                	mov    (%eax),%eax
+ c60:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c63:	73 ca                	jae    c2f <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c65:	8b 45 08             	mov    0x8(%ebp),%eax
+ c68:	8b 40 04             	mov    0x4(%eax),%eax
+ c6b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c72:	8b 45 08             	mov    0x8(%ebp),%eax
+ c75:	01 c2                	add    %eax,%edx
+ c77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7a:	8b 00                	mov    (%eax),%eax
+ c7c:	39 c2                	cmp    %eax,%edx
+ c7e:	75 24                	jne    ca4 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c80:	8b 45 08             	mov    0x8(%ebp),%eax
+ c83:	8b 50 04             	mov    0x4(%eax),%edx
+ c86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c89:	8b 00                	mov    (%eax),%eax
+ c8b:	8b 40 04             	mov    0x4(%eax),%eax
+ c8e:	01 c2                	add    %eax,%edx
+ c90:	8b 45 08             	mov    0x8(%ebp),%eax
+ c93:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c99:	8b 00                	mov    (%eax),%eax
+ c9b:	8b 10                	mov    (%eax),%edx
+ c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca0:	89 10                	mov    %edx,(%eax)
+ ca2:	eb 0a                	jmp    cae <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ ca4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca7:	8b 10                	mov    (%eax),%edx
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cac:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ cae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb1:	8b 40 04             	mov    0x4(%eax),%eax
+ cb4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ cbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cbe:	01 d0                	add    %edx,%eax
+ cc0:	39 45 08             	cmp    %eax,0x8(%ebp)
+ cc3:	75 20                	jne    ce5 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ cc5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc8:	8b 50 04             	mov    0x4(%eax),%edx
+ ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+ cce:	8b 40 04             	mov    0x4(%eax),%eax
+ cd1:	01 c2                	add    %eax,%edx
+ cd3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cd6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdc:	8b 10                	mov    (%eax),%edx
+ cde:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce1:	89 10                	mov    %edx,(%eax)
+ ce3:	eb 08                	jmp    ced <bigfree+0xce>
+    p->s.ptr = bp;
+ ce5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+ ceb:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ced:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf0:	a3 28 14 00 00       	mov    %eax,0x1428
+}
+ cf5:	90                   	nop
+ cf6:	c9                   	leave
+ cf7:	c3                   	ret
+
+00000cf8 <free>:
+{
+ cf8:	55                   	push   %ebp
+ cf9:	89 e5                	mov    %esp,%ebp
+ cfb:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ cfe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ d02:	74 68                	je     d6c <free+0x74>
+  bp = (Header*)ap - 1;
+ d04:	8b 45 08             	mov    0x8(%ebp),%eax
+ d07:	83 e8 08             	sub    $0x8,%eax
+ d0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ d0d:	e8 6b fe ff ff       	call   b7d <lock>
+ d12:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ d15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d18:	8b 40 04             	mov    0x4(%eax),%eax
+ d1b:	83 ec 0c             	sub    $0xc,%esp
+ d1e:	50                   	push   %eax
+ d1f:	e8 c3 fe ff ff       	call   be7 <sizeclass>
+ d24:	83 c4 10             	add    $0x10,%esp
+ d27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d2e:	78 1e                	js     d4e <free+0x56>
+    bp->s.ptr = classfree[c];
+ d30:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d33:	8b 14 85 2c 14 00 00 	mov    0x142c(,%eax,4),%edx
+ d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d3d:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ d3f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d42:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d45:	89 14 85 2c 14 00 00 	mov    %edx,0x142c(,%eax,4)
+ d4c:	eb 0e                	jmp    d5c <free+0x64>
+    bigfree(bp);
+ d4e:	83 ec 0c             	sub    $0xc,%esp
+ d51:	ff 75 f4             	push   -0xc(%ebp)
+ d54:	e8 c6 fe ff ff       	call   c1f <bigfree>
+ d59:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d5c:	83 ec 0c             	sub    $0xc,%esp
+ d5f:	ff 75 f0             	push   -0x10(%ebp)
+ d62:	e8 52 fe ff ff       	call   bb9 <unlock>
+ d67:	83 c4 10             	add    $0x10,%esp
+ d6a:	eb 01                	jmp    d6d <free+0x75>
+    return;
+ d6c:	90                   	nop
+}
+ d6d:	c9                   	leave
+ d6e:	c3                   	ret
+
+00000d6f <morecore>:
+{
+ d6f:	55                   	push   %ebp
+ d70:	89 e5                	mov    %esp,%ebp
+ d72:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d75:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d7c:	77 07                	ja     d85 <morecore+0x16>
+    nu = 4096;
+ d7e:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d85:	8b 45 08             	mov    0x8(%ebp),%eax
+ d88:	c1 e0 03             	shl    $0x3,%eax
+ d8b:	83 ec 0c             	sub    $0xc,%esp
+ d8e:	50                   	push   %eax
+ d8f:	e8 b6 f7 ff ff       	call   54a <sbrk>
+ d94:	83 c4 10             	add    $0x10,%esp
+ d97:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d9a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d9e:	75 07                	jne    da7 <morecore+0x38>
+    return 0;
+ da0:	b8 00 00 00 00       	mov    $0x0,%eax
+ da5:	eb 22                	jmp    dc9 <morecore+0x5a>
+  hp = (Header*)p;
+ da7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ daa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ dad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db0:	8b 55 08             	mov    0x8(%ebp),%edx
+ db3:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ db6:	83 ec 0c             	sub    $0xc,%esp
+ db9:	ff 75 f0             	push   -0x10(%ebp)
+ dbc:	e8 5e fe ff ff       	call   c1f <bigfree>
+ dc1:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ dc4:	a1 28 14 00 00       	mov    0x1428,%eax
+}
+ dc9:	c9                   	leave
+ dca:	c3                   	ret
+
+00000dcb <bigalloc>:
+{
+ dcb:	55                   	push   %ebp
+ dcc:	89 e5                	mov    %esp,%ebp
+ dce:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ dd1:	a1 28 14 00 00       	mov    0x1428,%eax
+ dd6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dd9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ddd:	75 23                	jne    e02 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ ddf:	c7 45 f0 20 14 00 00 	movl   $0x1420,-0x10(%ebp)
+ de6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ de9:	a3 28 14 00 00       	mov    %eax,0x1428
+ dee:	a1 28 14 00 00       	mov    0x1428,%eax
+ df3:	a3 20 14 00 00       	mov    %eax,0x1420
+    base.s.size = 0;
+ df8:	c7 05 24 14 00 00 00 	movl   $0x0,0x1424
+ dff:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e05:	8b 00                	mov    (%eax),%eax
+ e07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e0d:	8b 40 04             	mov    0x4(%eax),%eax
+ e10:	3b 45 08             	cmp    0x8(%ebp),%eax
+ e13:	72 4a                	jb     e5f <bigalloc+0x94>
+      if(p->s.size == nunits)
+ e15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e18:	8b 40 04             	mov    0x4(%eax),%eax
+ e1b:	39 45 08             	cmp    %eax,0x8(%ebp)
+ e1e:	75 0c                	jne    e2c <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e23:	8b 10                	mov    (%eax),%edx
+ e25:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e28:	89 10                	mov    %edx,(%eax)
+ e2a:	eb 26                	jmp    e52 <bigalloc+0x87>
+        p->s.size -= nunits;
+ e2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2f:	8b 40 04             	mov    0x4(%eax),%eax
+ e32:	2b 45 08             	sub    0x8(%ebp),%eax
+ e35:	89 c2                	mov    %eax,%edx
+ e37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e40:	8b 40 04             	mov    0x4(%eax),%eax
+ e43:	c1 e0 03             	shl    $0x3,%eax
+ e46:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+ e4f:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ e52:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e55:	a3 28 14 00 00       	mov    %eax,0x1428
+      return p;
+ e5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e5d:	eb 3b                	jmp    e9a <bigalloc+0xcf>
+    if(p == freep)
+ e5f:	a1 28 14 00 00       	mov    0x1428,%eax
+ e64:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e67:	75 1e                	jne    e87 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e69:	83 ec 0c             	sub    $0xc,%esp
+ e6c:	ff 75 08             	push   0x8(%ebp)
+ e6f:	e8 fb fe ff ff       	call   d6f <morecore>
+ e74:	83 c4 10             	add    $0x10,%esp
+ e77:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e7a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e7e:	75 07                	jne    e87 <bigalloc+0xbc>
+        return 0;
+ e80:	b8 00 00 00 00       	mov    $0x0,%eax
+ e85:	eb 13                	jmp    e9a <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e90:	8b 00                	mov    (%eax),%eax
+ e92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e95:	e9 70 ff ff ff       	jmp    e0a <bigalloc+0x3f>
+}
+ e9a:	c9                   	leave
+ e9b:	c3                   	ret
+
+00000e9c <alloc>:
+alloc(uint nbytes)
+{
+ e9c:	55                   	push   %ebp
+ e9d:	89 e5                	mov    %esp,%ebp
+ e9f:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ea5:	83 c0 07             	add    $0x7,%eax
+ ea8:	c1 e8 03             	shr    $0x3,%eax
+ eab:	83 c0 01             	add    $0x1,%eax
+ eae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ eb1:	ff 75 f4             	push   -0xc(%ebp)
+ eb4:	e8 2e fd ff ff       	call   be7 <sizeclass>
+ eb9:	83 c4 04             	add    $0x4,%esp
+ ebc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ebf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ec3:	79 2c                	jns    ef1 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ ec5:	83 ec 0c             	sub    $0xc,%esp
+ ec8:	ff 75 f4             	push   -0xc(%ebp)
+ ecb:	e8 fb fe ff ff       	call   dcb <bigalloc>
+ ed0:	83 c4 10             	add    $0x10,%esp
+ ed3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ed6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ eda:	75 0a                	jne    ee6 <alloc+0x4a>
+      return 0;
+ edc:	b8 00 00 00 00       	mov    $0x0,%eax
+ ee1:	e9 c8 00 00 00       	jmp    fae <alloc+0x112>
+    return (void*)(p + 1);
+ ee6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ee9:	83 c0 08             	add    $0x8,%eax
+ eec:	e9 bd 00 00 00       	jmp    fae <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ ef1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ef4:	8b 04 85 2c 14 00 00 	mov    0x142c(,%eax,4),%eax
+ efb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ efe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f02:	74 1a                	je     f1e <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ f04:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f07:	8b 10                	mov    (%eax),%edx
+ f09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f0c:	89 14 85 2c 14 00 00 	mov    %edx,0x142c(,%eax,4)
+    return (void*)(p + 1);
+ f13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f16:	83 c0 08             	add    $0x8,%eax
+ f19:	e9 90 00 00 00       	jmp    fae <alloc+0x112>
+  }
+  nunits = 2 << c;
+ f1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f21:	ba 02 00 00 00       	mov    $0x2,%edx
+ f26:	89 c1                	mov    %eax,%ecx
+ f28:	d3 e2                	shl    %cl,%edx
+ f2a:	89 d0                	mov    %edx,%eax
+ f2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ f2f:	a1 48 14 00 00       	mov    0x1448,%eax
+ f34:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f37:	c1 e2 03             	shl    $0x3,%edx
+ f3a:	01 d0                	add    %edx,%eax
+ f3c:	8b 15 4c 14 00 00    	mov    0x144c,%edx
+ f42:	39 c2                	cmp    %eax,%edx
+ f44:	73 3f                	jae    f85 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ f46:	83 ec 0c             	sub    $0xc,%esp
+ f49:	68 00 08 00 00       	push   $0x800
+ f4e:	e8 78 fe ff ff       	call   dcb <bigalloc>
+ f53:	83 c4 10             	add    $0x10,%esp
+ f56:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ f59:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f5d:	75 07                	jne    f66 <alloc+0xca>
+      return 0;
+ f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+ f64:	eb 48                	jmp    fae <alloc+0x112>
+    bump = (char*)p;
+ f66:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f69:	a3 48 14 00 00       	mov    %eax,0x1448
+    bumpend = (char*)(p + p->s.size);
+ f6e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f71:	8b 40 04             	mov    0x4(%eax),%eax
+ f74:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f7e:	01 d0                	add    %edx,%eax
+ f80:	a3 4c 14 00 00       	mov    %eax,0x144c
+  }
+  p = (Header*)bump;
+ f85:	a1 48 14 00 00       	mov    0x1448,%eax
+ f8a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f8d:	a1 48 14 00 00       	mov    0x1448,%eax
+ f92:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f95:	c1 e2 03             	shl    $0x3,%edx
+ f98:	01 d0                	add    %edx,%eax
+ f9a:	a3 48 14 00 00       	mov    %eax,0x1448
+  p->s.size = nunits;
+ f9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ fa2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ fa5:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ fa8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ fab:	83 c0 08             	add    $0x8,%eax
+}
+ fae:	c9                   	leave
+ faf:	c3                   	ret
+
+00000fb0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ fb0:	55                   	push   %ebp
+ fb1:	89 e5                	mov    %esp,%ebp
+ fb3:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ fb6:	e8 c2 fb ff ff       	call   b7d <lock>
+ fbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ fbe:	83 ec 0c             	sub    $0xc,%esp
+ fc1:	ff 75 08             	push   0x8(%ebp)
+ fc4:	e8 d3 fe ff ff       	call   e9c <alloc>
+ fc9:	83 c4 10             	add    $0x10,%esp
+ fcc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ fcf:	83 ec 0c             	sub    $0xc,%esp
+ fd2:	ff 75 f4             	push   -0xc(%ebp)
+ fd5:	e8 df fb ff ff       	call   bb9 <unlock>
+ fda:	83 c4 10             	add    $0x10,%esp
+  return p;
+ fdd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fe0:	c9                   	leave
+ fe1:	c3                   	ret
@@ -0,0 +1,54 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NFD 200    // well past the initial fd table
+#define NCHILD 100 // more processes than the old fixed table
+
+int
+main(int argc, char *argv[])
+{
+  int i, fd[NFD], pid[NCHILD];
+
+  for(i = 0; i < NFD; i++){
+    if((fd[i] = dup(1)) < 0){
+      printf(1, "error: dup %d\n", i);
+      exit();
+    }
+  }
+  close(fd[10]);
+  if(dup(1) != fd[10]){
+    printf(1, "error: lowest descriptor not reused\n");
+    exit();
+  }
+  if(write(fd[NFD-1], "fds ok\n", 7) != 7){
+    printf(1, "error: write to high fd\n");
+    exit();
+  }
+  for(i = 0; i < NFD; i++)
+    close(fd[i]);
+
+  for(i = 0; i < NCHILD; i++){
+    if((pid[i] = fork()) < 0){
+      printf(1, "error: fork %d\n", i);
+      exit();
+    }
+    if(pid[i] == 0){
+      sleep(1000);
+      exit();
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+    kill(pid[i]);
+  for(i = 0; i < NCHILD; i++)
+    if(wait() < 0){
+      printf(1, "error: wait\n");
+      exit();
+    }
+  if(wait() != -1 || kill(pid[0]) != -1){
+    printf(1, "error: stale child\n");
+    exit();
+  }
+  printf(1, "procs ok\n");
+  exit();
+}
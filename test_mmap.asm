@@ -0,0 +1,2039 @@
+
+_test_mmap:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static char buf[SIZE];
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 14             	sub    $0x14,%esp
+  int fd, i;
+  char *p;
+
+  for(i = 0; i < SIZE; i++)
+      11:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      18:	eb 32                	jmp    4c <main+0x4c>
+    buf[i] = 'a' + i % 26;
+      1a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      1d:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+      22:	89 c8                	mov    %ecx,%eax
+      24:	f7 ea                	imul   %edx
+      26:	89 d0                	mov    %edx,%eax
+      28:	c1 f8 03             	sar    $0x3,%eax
+      2b:	89 ca                	mov    %ecx,%edx
+      2d:	c1 fa 1f             	sar    $0x1f,%edx
+      30:	29 d0                	sub    %edx,%eax
+      32:	6b d0 1a             	imul   $0x1a,%eax,%edx
+      35:	89 c8                	mov    %ecx,%eax
+      37:	29 d0                	sub    %edx,%eax
+      39:	83 c0 61             	add    $0x61,%eax
+      3c:	89 c2                	mov    %eax,%edx
+      3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      41:	05 40 15 00 00       	add    $0x1540,%eax
+      46:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+      48:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      4c:	81 7d f4 0f 27 00 00 	cmpl   $0x270f,-0xc(%ebp)
+      53:	7e c5                	jle    1a <main+0x1a>
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, buf, SIZE) != SIZE){
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	68 02 02 00 00       	push   $0x202
+      5d:	68 cc 10 00 00       	push   $0x10cc
+      62:	e8 73 05 00 00       	call   5da <open>
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      6d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      71:	78 1f                	js     92 <main+0x92>
+      73:	83 ec 04             	sub    $0x4,%esp
+      76:	68 10 27 00 00       	push   $0x2710
+      7b:	68 40 15 00 00       	push   $0x1540
+      80:	ff 75 f0             	push   -0x10(%ebp)
+      83:	e8 36 05 00 00       	call   5be <write>
+      88:	83 c4 10             	add    $0x10,%esp
+      8b:	3d 10 27 00 00       	cmp    $0x2710,%eax
+      90:	74 1c                	je     ae <main+0xae>
+    printf(1, "error creating file: %s\n", TEST_FILE);
+      92:	83 ec 04             	sub    $0x4,%esp
+      95:	68 cc 10 00 00       	push   $0x10cc
+      9a:	68 d7 10 00 00       	push   $0x10d7
+      9f:	6a 01                	push   $0x1
+      a1:	e8 8c 09 00 00       	call   a32 <printf>
+      a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a9:	e8 f4 04 00 00       	call   5a2 <exit>
+  }
+
+  // Pages fault in from the file.
+  if((p = mmap(0, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == (char*)-1){
+      ae:	83 ec 08             	sub    $0x8,%esp
+      b1:	6a 00                	push   $0x0
+      b3:	ff 75 f0             	push   -0x10(%ebp)
+      b6:	6a 01                	push   $0x1
+      b8:	6a 03                	push   $0x3
+      ba:	68 10 27 00 00       	push   $0x2710
+      bf:	6a 00                	push   $0x0
+      c1:	e8 be 05 00 00       	call   684 <mmap>
+      c6:	83 c4 20             	add    $0x20,%esp
+      c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      cc:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%ebp)
+      d0:	75 17                	jne    e9 <main+0xe9>
+    printf(1, "error: mmap\n");
+      d2:	83 ec 08             	sub    $0x8,%esp
+      d5:	68 f0 10 00 00       	push   $0x10f0
+      da:	6a 01                	push   $0x1
+      dc:	e8 51 09 00 00       	call   a32 <printf>
+      e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      e4:	e8 b9 04 00 00       	call   5a2 <exit>
+  }
+  for(i = 0; i < SIZE; i++){
+      e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      f0:	eb 38                	jmp    12a <main+0x12a>
+    if(p[i] != buf[i]){
+      f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+      f8:	01 d0                	add    %edx,%eax
+      fa:	0f b6 10             	movzbl (%eax),%edx
+      fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     100:	05 40 15 00 00       	add    $0x1540,%eax
+     105:	0f b6 00             	movzbl (%eax),%eax
+     108:	38 c2                	cmp    %al,%dl
+     10a:	74 1a                	je     126 <main+0x126>
+      printf(1, "wrong data at %d\n", i);
+     10c:	83 ec 04             	sub    $0x4,%esp
+     10f:	ff 75 f4             	push   -0xc(%ebp)
+     112:	68 fd 10 00 00       	push   $0x10fd
+     117:	6a 01                	push   $0x1
+     119:	e8 14 09 00 00       	call   a32 <printf>
+     11e:	83 c4 10             	add    $0x10,%esp
+      exit();
+     121:	e8 7c 04 00 00       	call   5a2 <exit>
+  for(i = 0; i < SIZE; i++){
+     126:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     12a:	81 7d f4 0f 27 00 00 	cmpl   $0x270f,-0xc(%ebp)
+     131:	7e bf                	jle    f2 <main+0xf2>
+    }
+  }
+  printf(1, "read ok\n");
+     133:	83 ec 08             	sub    $0x8,%esp
+     136:	68 0f 11 00 00       	push   $0x110f
+     13b:	6a 01                	push   $0x1
+     13d:	e8 f0 08 00 00       	call   a32 <printf>
+     142:	83 c4 10             	add    $0x10,%esp
+
+  // The child gets a copy of the mapping.
+  if(fork() == 0){
+     145:	e8 51 04 00 00       	call   59b <fork>
+     14a:	85 c0                	test   %eax,%eax
+     14c:	75 2d                	jne    17b <main+0x17b>
+    if(p[SIZE-1] != buf[SIZE-1])
+     14e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     151:	05 0f 27 00 00       	add    $0x270f,%eax
+     156:	0f b6 10             	movzbl (%eax),%edx
+     159:	0f b6 05 4f 3c 00 00 	movzbl 0x3c4f,%eax
+     160:	38 c2                	cmp    %al,%dl
+     162:	74 12                	je     176 <main+0x176>
+      printf(1, "child: wrong data\n");
+     164:	83 ec 08             	sub    $0x8,%esp
+     167:	68 18 11 00 00       	push   $0x1118
+     16c:	6a 01                	push   $0x1
+     16e:	e8 bf 08 00 00       	call   a32 <printf>
+     173:	83 c4 10             	add    $0x10,%esp
+    exit();
+     176:	e8 27 04 00 00       	call   5a2 <exit>
+  }
+  wait();
+     17b:	e8 29 04 00 00       	call   5a9 <wait>
+
+  // Shared writes reach the file on munmap.
+  p[0] = 'X';
+     180:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     183:	c6 00 58             	movb   $0x58,(%eax)
+  p[SIZE-1] = 'Y';
+     186:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     189:	05 0f 27 00 00       	add    $0x270f,%eax
+     18e:	c6 00 59             	movb   $0x59,(%eax)
+  if(munmap(p, SIZE) < 0){
+     191:	83 ec 08             	sub    $0x8,%esp
+     194:	68 10 27 00 00       	push   $0x2710
+     199:	ff 75 ec             	push   -0x14(%ebp)
+     19c:	e8 ed 04 00 00       	call   68e <munmap>
+     1a1:	83 c4 10             	add    $0x10,%esp
+     1a4:	85 c0                	test   %eax,%eax
+     1a6:	79 17                	jns    1bf <main+0x1bf>
+    printf(1, "error: munmap\n");
+     1a8:	83 ec 08             	sub    $0x8,%esp
+     1ab:	68 2b 11 00 00       	push   $0x112b
+     1b0:	6a 01                	push   $0x1
+     1b2:	e8 7b 08 00 00       	call   a32 <printf>
+     1b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1ba:	e8 e3 03 00 00       	call   5a2 <exit>
+  }
+  close(fd);
+     1bf:	83 ec 0c             	sub    $0xc,%esp
+     1c2:	ff 75 f0             	push   -0x10(%ebp)
+     1c5:	e8 fb 03 00 00       	call   5c5 <close>
+     1ca:	83 c4 10             	add    $0x10,%esp
+  fd = open(TEST_FILE, O_RDONLY);
+     1cd:	83 ec 08             	sub    $0x8,%esp
+     1d0:	6a 00                	push   $0x0
+     1d2:	68 cc 10 00 00       	push   $0x10cc
+     1d7:	e8 fe 03 00 00       	call   5da <open>
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(read(fd, buf, SIZE) != SIZE || buf[0] != 'X' || buf[SIZE-1] != 'Y'){
+     1e2:	83 ec 04             	sub    $0x4,%esp
+     1e5:	68 10 27 00 00       	push   $0x2710
+     1ea:	68 40 15 00 00       	push   $0x1540
+     1ef:	ff 75 f0             	push   -0x10(%ebp)
+     1f2:	e8 c0 03 00 00       	call   5b7 <read>
+     1f7:	83 c4 10             	add    $0x10,%esp
+     1fa:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     1ff:	75 16                	jne    217 <main+0x217>
+     201:	0f b6 05 40 15 00 00 	movzbl 0x1540,%eax
+     208:	3c 58                	cmp    $0x58,%al
+     20a:	75 0b                	jne    217 <main+0x217>
+     20c:	0f b6 05 4f 3c 00 00 	movzbl 0x3c4f,%eax
+     213:	3c 59                	cmp    $0x59,%al
+     215:	74 17                	je     22e <main+0x22e>
+    printf(1, "shared write lost\n");
+     217:	83 ec 08             	sub    $0x8,%esp
+     21a:	68 3a 11 00 00       	push   $0x113a
+     21f:	6a 01                	push   $0x1
+     221:	e8 0c 08 00 00       	call   a32 <printf>
+     226:	83 c4 10             	add    $0x10,%esp
+    exit();
+     229:	e8 74 03 00 00       	call   5a2 <exit>
+  }
+  printf(1, "write back ok\n");
+     22e:	83 ec 08             	sub    $0x8,%esp
+     231:	68 4d 11 00 00       	push   $0x114d
+     236:	6a 01                	push   $0x1
+     238:	e8 f5 07 00 00       	call   a32 <printf>
+     23d:	83 c4 10             	add    $0x10,%esp
+
+  // Private writes do not.
+  p = mmap(0, SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+     240:	83 ec 08             	sub    $0x8,%esp
+     243:	6a 00                	push   $0x0
+     245:	ff 75 f0             	push   -0x10(%ebp)
+     248:	6a 02                	push   $0x2
+     24a:	6a 03                	push   $0x3
+     24c:	68 10 27 00 00       	push   $0x2710
+     251:	6a 00                	push   $0x0
+     253:	e8 2c 04 00 00       	call   684 <mmap>
+     258:	83 c4 20             	add    $0x20,%esp
+     25b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  p[0] = 'Z';
+     25e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     261:	c6 00 5a             	movb   $0x5a,(%eax)
+  munmap(p, SIZE);
+     264:	83 ec 08             	sub    $0x8,%esp
+     267:	68 10 27 00 00       	push   $0x2710
+     26c:	ff 75 ec             	push   -0x14(%ebp)
+     26f:	e8 1a 04 00 00       	call   68e <munmap>
+     274:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     277:	83 ec 0c             	sub    $0xc,%esp
+     27a:	ff 75 f0             	push   -0x10(%ebp)
+     27d:	e8 43 03 00 00       	call   5c5 <close>
+     282:	83 c4 10             	add    $0x10,%esp
+  fd = open(TEST_FILE, O_RDONLY);
+     285:	83 ec 08             	sub    $0x8,%esp
+     288:	6a 00                	push   $0x0
+     28a:	68 cc 10 00 00       	push   $0x10cc
+     28f:	e8 46 03 00 00       	call   5da <open>
+     294:	83 c4 10             	add    $0x10,%esp
+     297:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(read(fd, buf, 1) != 1 || buf[0] != 'X'){
+     29a:	83 ec 04             	sub    $0x4,%esp
+     29d:	6a 01                	push   $0x1
+     29f:	68 40 15 00 00       	push   $0x1540
+     2a4:	ff 75 f0             	push   -0x10(%ebp)
+     2a7:	e8 0b 03 00 00       	call   5b7 <read>
+     2ac:	83 c4 10             	add    $0x10,%esp
+     2af:	83 f8 01             	cmp    $0x1,%eax
+     2b2:	75 0b                	jne    2bf <main+0x2bf>
+     2b4:	0f b6 05 40 15 00 00 	movzbl 0x1540,%eax
+     2bb:	3c 58                	cmp    $0x58,%al
+     2bd:	74 17                	je     2d6 <main+0x2d6>
+    printf(1, "private write reached the file\n");
+     2bf:	83 ec 08             	sub    $0x8,%esp
+     2c2:	68 5c 11 00 00       	push   $0x115c
+     2c7:	6a 01                	push   $0x1
+     2c9:	e8 64 07 00 00       	call   a32 <printf>
+     2ce:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2d1:	e8 cc 02 00 00       	call   5a2 <exit>
+  }
+  close(fd);
+     2d6:	83 ec 0c             	sub    $0xc,%esp
+     2d9:	ff 75 f0             	push   -0x10(%ebp)
+     2dc:	e8 e4 02 00 00       	call   5c5 <close>
+     2e1:	83 c4 10             	add    $0x10,%esp
+  unlink(TEST_FILE);
+     2e4:	83 ec 0c             	sub    $0xc,%esp
+     2e7:	68 cc 10 00 00       	push   $0x10cc
+     2ec:	e8 fd 02 00 00       	call   5ee <unlink>
+     2f1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "private ok\n");
+     2f4:	83 ec 08             	sub    $0x8,%esp
+     2f7:	68 7c 11 00 00       	push   $0x117c
+     2fc:	6a 01                	push   $0x1
+     2fe:	e8 2f 07 00 00       	call   a32 <printf>
+     303:	83 c4 10             	add    $0x10,%esp
+  exit();
+     306:	e8 97 02 00 00       	call   5a2 <exit>
+
+0000030b <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     30b:	55                   	push   %ebp
+     30c:	89 e5                	mov    %esp,%ebp
+     30e:	57                   	push   %edi
+     30f:	53                   	push   %ebx
+    if(cc < 1)
+     310:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     313:	8b 55 10             	mov    0x10(%ebp),%edx
+     316:	8b 45 0c             	mov    0xc(%ebp),%eax
+     319:	89 cb                	mov    %ecx,%ebx
+     31b:	89 df                	mov    %ebx,%edi
+     31d:	89 d1                	mov    %edx,%ecx
+     31f:	fc                   	cld
+     320:	f3 aa                	rep stos %al,%es:(%edi)
+     322:	89 ca                	mov    %ecx,%edx
+     324:	89 fb                	mov    %edi,%ebx
+     326:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     329:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     32c:	90                   	nop
+     32d:	5b                   	pop    %ebx
+     32e:	5f                   	pop    %edi
+     32f:	5d                   	pop    %ebp
+     330:	c3                   	ret
+
+00000331 <strcpy>:
+{
+     331:	55                   	push   %ebp
+     332:	89 e5                	mov    %esp,%ebp
+     334:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     337:	8b 45 08             	mov    0x8(%ebp),%eax
+     33a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     33d:	90                   	nop
+     33e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     341:	8d 42 01             	lea    0x1(%edx),%eax
+     344:	89 45 0c             	mov    %eax,0xc(%ebp)
+     347:	8b 45 08             	mov    0x8(%ebp),%eax
+     34a:	8d 48 01             	lea    0x1(%eax),%ecx
+     34d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     350:	0f b6 12             	movzbl (%edx),%edx
+     353:	88 10                	mov    %dl,(%eax)
+     355:	0f b6 00             	movzbl (%eax),%eax
+     358:	84 c0                	test   %al,%al
+     35a:	75 e2                	jne    33e <strcpy+0xd>
+  return os;
+     35c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     35f:	c9                   	leave
+     360:	c3                   	ret
+
+00000361 <strcmp>:
+{
+     361:	55                   	push   %ebp
+     362:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     364:	eb 08                	jmp    36e <strcmp+0xd>
+    p++, q++;
+     366:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     36a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     36e:	8b 45 08             	mov    0x8(%ebp),%eax
+     371:	0f b6 00             	movzbl (%eax),%eax
+     374:	84 c0                	test   %al,%al
+     376:	74 10                	je     388 <strcmp+0x27>
+     378:	8b 45 08             	mov    0x8(%ebp),%eax
+     37b:	0f b6 10             	movzbl (%eax),%edx
+     37e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     381:	0f b6 00             	movzbl (%eax),%eax
+     384:	38 c2                	cmp    %al,%dl
+     386:	74 de                	je     366 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     388:	8b 45 08             	mov    0x8(%ebp),%eax
+     38b:	0f b6 00             	movzbl (%eax),%eax
+     38e:	0f b6 d0             	movzbl %al,%edx
+     391:	8b 45 0c             	mov    0xc(%ebp),%eax
+     394:	0f b6 00             	movzbl (%eax),%eax
+     397:	0f b6 c0             	movzbl %al,%eax
+     39a:	29 c2                	sub    %eax,%edx
+     39c:	89 d0                	mov    %edx,%eax
+}
+     39e:	5d                   	pop    %ebp
+     39f:	c3                   	ret
+
+000003a0 <strlen>:
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     3a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     3ad:	eb 04                	jmp    3b3 <strlen+0x13>
+     3af:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3b3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b9:	01 d0                	add    %edx,%eax
+     3bb:	0f b6 00             	movzbl (%eax),%eax
+     3be:	84 c0                	test   %al,%al
+     3c0:	75 ed                	jne    3af <strlen+0xf>
+  return n;
+     3c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     3c5:	c9                   	leave
+     3c6:	c3                   	ret
+
+000003c7 <memset>:
+{
+     3c7:	55                   	push   %ebp
+     3c8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     3ca:	8b 45 10             	mov    0x10(%ebp),%eax
+     3cd:	50                   	push   %eax
+     3ce:	ff 75 0c             	push   0xc(%ebp)
+     3d1:	ff 75 08             	push   0x8(%ebp)
+     3d4:	e8 32 ff ff ff       	call   30b <stosb>
+     3d9:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     3dc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     3df:	c9                   	leave
+     3e0:	c3                   	ret
+
+000003e1 <strchr>:
+{
+     3e1:	55                   	push   %ebp
+     3e2:	89 e5                	mov    %esp,%ebp
+     3e4:	83 ec 04             	sub    $0x4,%esp
+     3e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ea:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     3ed:	eb 14                	jmp    403 <strchr+0x22>
+    if(*s == c)
+     3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f2:	0f b6 00             	movzbl (%eax),%eax
+     3f5:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     3f8:	75 05                	jne    3ff <strchr+0x1e>
+      return (char*)s;
+     3fa:	8b 45 08             	mov    0x8(%ebp),%eax
+     3fd:	eb 13                	jmp    412 <strchr+0x31>
+  for(; *s; s++)
+     3ff:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     403:	8b 45 08             	mov    0x8(%ebp),%eax
+     406:	0f b6 00             	movzbl (%eax),%eax
+     409:	84 c0                	test   %al,%al
+     40b:	75 e2                	jne    3ef <strchr+0xe>
+  return 0;
+     40d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     412:	c9                   	leave
+     413:	c3                   	ret
+
+00000414 <gets>:
+{
+     414:	55                   	push   %ebp
+     415:	89 e5                	mov    %esp,%ebp
+     417:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     41a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     421:	eb 42                	jmp    465 <gets+0x51>
+    cc = read(0, &c, 1);
+     423:	83 ec 04             	sub    $0x4,%esp
+     426:	6a 01                	push   $0x1
+     428:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     42b:	50                   	push   %eax
+     42c:	6a 00                	push   $0x0
+     42e:	e8 84 01 00 00       	call   5b7 <read>
+     433:	83 c4 10             	add    $0x10,%esp
+     436:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     439:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     43d:	7e 33                	jle    472 <gets+0x5e>
+    buf[i++] = c;
+     43f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     442:	8d 50 01             	lea    0x1(%eax),%edx
+     445:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     448:	89 c2                	mov    %eax,%edx
+     44a:	8b 45 08             	mov    0x8(%ebp),%eax
+     44d:	01 c2                	add    %eax,%edx
+     44f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     453:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     455:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     459:	3c 0a                	cmp    $0xa,%al
+     45b:	74 16                	je     473 <gets+0x5f>
+     45d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     461:	3c 0d                	cmp    $0xd,%al
+     463:	74 0e                	je     473 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     465:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     468:	83 c0 01             	add    $0x1,%eax
+     46b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     46e:	7f b3                	jg     423 <gets+0xf>
+     470:	eb 01                	jmp    473 <gets+0x5f>
+      break;
+     472:	90                   	nop
+  }
+  buf[i] = '\0';
+     473:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     476:	8b 45 08             	mov    0x8(%ebp),%eax
+     479:	01 d0                	add    %edx,%eax
+     47b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     47e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     481:	c9                   	leave
+     482:	c3                   	ret
+
+00000483 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     483:	55                   	push   %ebp
+     484:	89 e5                	mov    %esp,%ebp
+     486:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     489:	83 ec 08             	sub    $0x8,%esp
+     48c:	6a 00                	push   $0x0
+     48e:	ff 75 08             	push   0x8(%ebp)
+     491:	e8 44 01 00 00       	call   5da <open>
+     496:	83 c4 10             	add    $0x10,%esp
+     499:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     49c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4a0:	79 07                	jns    4a9 <stat+0x26>
+    return -1;
+     4a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4a7:	eb 25                	jmp    4ce <stat+0x4b>
+  r = fstat(fd, st);
+     4a9:	83 ec 08             	sub    $0x8,%esp
+     4ac:	ff 75 0c             	push   0xc(%ebp)
+     4af:	ff 75 f4             	push   -0xc(%ebp)
+     4b2:	e8 41 01 00 00       	call   5f8 <fstat>
+     4b7:	83 c4 10             	add    $0x10,%esp
+     4ba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4bd:	83 ec 0c             	sub    $0xc,%esp
+     4c0:	ff 75 f4             	push   -0xc(%ebp)
+     4c3:	e8 fd 00 00 00       	call   5c5 <close>
+     4c8:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4ce:	c9                   	leave
+     4cf:	c3                   	ret
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4dd:	eb 25                	jmp    504 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4df:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4e2:	89 d0                	mov    %edx,%eax
+     4e4:	c1 e0 02             	shl    $0x2,%eax
+     4e7:	01 d0                	add    %edx,%eax
+     4e9:	01 c0                	add    %eax,%eax
+     4eb:	89 c1                	mov    %eax,%ecx
+     4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f0:	8d 50 01             	lea    0x1(%eax),%edx
+     4f3:	89 55 08             	mov    %edx,0x8(%ebp)
+     4f6:	0f b6 00             	movzbl (%eax),%eax
+     4f9:	0f be c0             	movsbl %al,%eax
+     4fc:	01 c8                	add    %ecx,%eax
+     4fe:	83 e8 30             	sub    $0x30,%eax
+     501:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     504:	8b 45 08             	mov    0x8(%ebp),%eax
+     507:	0f b6 00             	movzbl (%eax),%eax
+     50a:	3c 2f                	cmp    $0x2f,%al
+     50c:	7e 0a                	jle    518 <atoi+0x48>
+     50e:	8b 45 08             	mov    0x8(%ebp),%eax
+     511:	0f b6 00             	movzbl (%eax),%eax
+     514:	3c 39                	cmp    $0x39,%al
+     516:	7e c7                	jle    4df <atoi+0xf>
+  return n;
+     518:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     51b:	c9                   	leave
+     51c:	c3                   	ret
+
+0000051d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     51d:	55                   	push   %ebp
+     51e:	89 e5                	mov    %esp,%ebp
+     520:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     523:	8b 45 08             	mov    0x8(%ebp),%eax
+     526:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     529:	8b 45 0c             	mov    0xc(%ebp),%eax
+     52c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     52f:	eb 17                	jmp    548 <memmove+0x2b>
+    *dst++ = *src++;
+     531:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     534:	8d 42 01             	lea    0x1(%edx),%eax
+     537:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     53a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     53d:	8d 48 01             	lea    0x1(%eax),%ecx
+     540:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     543:	0f b6 12             	movzbl (%edx),%edx
+     546:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     548:	8b 45 10             	mov    0x10(%ebp),%eax
+     54b:	8d 50 ff             	lea    -0x1(%eax),%edx
+     54e:	89 55 10             	mov    %edx,0x10(%ebp)
+     551:	85 c0                	test   %eax,%eax
+     553:	7f dc                	jg     531 <memmove+0x14>
+  return vdst;
+     555:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     558:	c9                   	leave
+     559:	c3                   	ret
+
+0000055a <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     55a:	83 3d 14 15 00 00 00 	cmpl   $0x0,0x1514
+  jg 2f
+     561:	7f 2e                	jg     591 <dosyscall+0x37>
+  jl 1f
+     563:	7c 29                	jl     58e <dosyscall+0x34>
+  pushl %eax
+     565:	50                   	push   %eax
+  pushl %ebx
+     566:	53                   	push   %ebx
+  movl $1, %eax
+     567:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     56c:	0f a2                	cpuid
+  popl %ebx
+     56e:	5b                   	pop    %ebx
+  popl %eax
+     56f:	58                   	pop    %eax
+  movl $-1, sysmode
+     570:	c7 05 14 15 00 00 ff 	movl   $0xffffffff,0x1514
+     577:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     57a:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     580:	74 0c                	je     58e <dosyscall+0x34>
+  movl $1, sysmode
+     582:	c7 05 14 15 00 00 01 	movl   $0x1,0x1514
+     589:	00 00 00 
+  jmp 2f
+     58c:	eb 03                	jmp    591 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     58e:	cd 40                	int    $0x40
+  ret
+     590:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     591:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     593:	ba 9a 05 00 00       	mov    $0x59a,%edx
+  sysenter
+     598:	0f 34                	sysenter
+3:
+  ret
+     59a:	c3                   	ret
+
+0000059b <fork>:
+
+SYSCALL(fork)
+     59b:	b8 01 00 00 00       	mov    $0x1,%eax
+     5a0:	eb b8                	jmp    55a <dosyscall>
+
+000005a2 <exit>:
+SYSCALL(exit)
+     5a2:	b8 02 00 00 00       	mov    $0x2,%eax
+     5a7:	eb b1                	jmp    55a <dosyscall>
+
+000005a9 <wait>:
+SYSCALL(wait)
+     5a9:	b8 03 00 00 00       	mov    $0x3,%eax
+     5ae:	eb aa                	jmp    55a <dosyscall>
+
+000005b0 <pipe>:
+SYSCALL(pipe)
+     5b0:	b8 04 00 00 00       	mov    $0x4,%eax
+     5b5:	eb a3                	jmp    55a <dosyscall>
+
+000005b7 <read>:
+SYSCALL(read)
+     5b7:	b8 05 00 00 00       	mov    $0x5,%eax
+     5bc:	eb 9c                	jmp    55a <dosyscall>
+
+000005be <write>:
+SYSCALL(write)
+     5be:	b8 10 00 00 00       	mov    $0x10,%eax
+     5c3:	eb 95                	jmp    55a <dosyscall>
+
+000005c5 <close>:
+SYSCALL(close)
+     5c5:	b8 15 00 00 00       	mov    $0x15,%eax
+     5ca:	eb 8e                	jmp    55a <dosyscall>
+
+000005cc <kill>:
+SYSCALL(kill)
+     5cc:	b8 06 00 00 00       	mov    $0x6,%eax
+     5d1:	eb 87                	jmp    55a <dosyscall>
+
+000005d3 <exec>:
+SYSCALL(exec)
+     5d3:	b8 07 00 00 00       	mov    $0x7,%eax
+     5d8:	eb 80                	jmp    55a <dosyscall>
+
+000005da <open>:
+SYSCALL(open)
+     5da:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5df:	e9 76 ff ff ff       	jmp    55a <dosyscall>
+
+000005e4 <mknod>:
+SYSCALL(mknod)
+     5e4:	b8 11 00 00 00       	mov    $0x11,%eax
+     5e9:	e9 6c ff ff ff       	jmp    55a <dosyscall>
+
+000005ee <unlink>:
+SYSCALL(unlink)
+     5ee:	b8 12 00 00 00       	mov    $0x12,%eax
+     5f3:	e9 62 ff ff ff       	jmp    55a <dosyscall>
+
+000005f8 <fstat>:
+SYSCALL(fstat)
+     5f8:	b8 08 00 00 00       	mov    $0x8,%eax
+     5fd:	e9 58 ff ff ff       	jmp    55a <dosyscall>
+
+00000602 <link>:
+SYSCALL(link)
+     602:	b8 13 00 00 00       	mov    $0x13,%eax
+     607:	e9 4e ff ff ff       	jmp    55a <dosyscall>
+
+0000060c <mkdir>:
+SYSCALL(mkdir)
+     60c:	b8 14 00 00 00       	mov    $0x14,%eax
+     611:	e9 44 ff ff ff       	jmp    55a <dosyscall>
+
+00000616 <chdir>:
+SYSCALL(chdir)
+     616:	b8 09 00 00 00       	mov    $0x9,%eax
+     61b:	e9 3a ff ff ff       	jmp    55a <dosyscall>
+
+00000620 <dup>:
+SYSCALL(dup)
+     620:	b8 0a 00 00 00       	mov    $0xa,%eax
+     625:	e9 30 ff ff ff       	jmp    55a <dosyscall>
+
+0000062a <getpid>:
+SYSCALL(getpid)
+     62a:	b8 0b 00 00 00       	mov    $0xb,%eax
+     62f:	e9 26 ff ff ff       	jmp    55a <dosyscall>
+
+00000634 <sbrk>:
+SYSCALL(sbrk)
+     634:	b8 0c 00 00 00       	mov    $0xc,%eax
+     639:	e9 1c ff ff ff       	jmp    55a <dosyscall>
+
+0000063e <sleep>:
+SYSCALL(sleep)
+     63e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     643:	e9 12 ff ff ff       	jmp    55a <dosyscall>
+
+00000648 <uptime>:
+SYSCALL(uptime)
+     648:	b8 0e 00 00 00       	mov    $0xe,%eax
+     64d:	e9 08 ff ff ff       	jmp    55a <dosyscall>
+
+00000652 <symlink>:
+SYSCALL(symlink)
+     652:	b8 16 00 00 00       	mov    $0x16,%eax
+     657:	e9 fe fe ff ff       	jmp    55a <dosyscall>
+
+0000065c <readlink>:
+SYSCALL(readlink)
+     65c:	b8 17 00 00 00       	mov    $0x17,%eax
+     661:	e9 f4 fe ff ff       	jmp    55a <dosyscall>
+
+00000666 <fprot>:
+SYSCALL(fprot)
+     666:	b8 18 00 00 00       	mov    $0x18,%eax
+     66b:	e9 ea fe ff ff       	jmp    55a <dosyscall>
+
+00000670 <funprot>:
+SYSCALL(funprot)
+     670:	b8 19 00 00 00       	mov    $0x19,%eax
+     675:	e9 e0 fe ff ff       	jmp    55a <dosyscall>
+
+0000067a <funlock>:
+SYSCALL(funlock)
+     67a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     67f:	e9 d6 fe ff ff       	jmp    55a <dosyscall>
+
+00000684 <mmap>:
+SYSCALL(mmap)
+     684:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     689:	e9 cc fe ff ff       	jmp    55a <dosyscall>
+
+0000068e <munmap>:
+SYSCALL(munmap)
+     68e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     693:	e9 c2 fe ff ff       	jmp    55a <dosyscall>
+
+00000698 <sendfile>:
+SYSCALL(sendfile)
+     698:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     69d:	e9 b8 fe ff ff       	jmp    55a <dosyscall>
+
+000006a2 <readv>:
+SYSCALL(readv)
+     6a2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6a7:	e9 ae fe ff ff       	jmp    55a <dosyscall>
+
+000006ac <writev>:
+SYSCALL(writev)
+     6ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6b1:	e9 a4 fe ff ff       	jmp    55a <dosyscall>
+
+000006b6 <pread>:
+SYSCALL(pread)
+     6b6:	b8 20 00 00 00       	mov    $0x20,%eax
+     6bb:	e9 9a fe ff ff       	jmp    55a <dosyscall>
+
+000006c0 <pwrite>:
+SYSCALL(pwrite)
+     6c0:	b8 21 00 00 00       	mov    $0x21,%eax
+     6c5:	e9 90 fe ff ff       	jmp    55a <dosyscall>
+
+000006ca <lseek>:
+SYSCALL(lseek)
+     6ca:	b8 22 00 00 00       	mov    $0x22,%eax
+     6cf:	e9 86 fe ff ff       	jmp    55a <dosyscall>
+
+000006d4 <spawn>:
+SYSCALL(spawn)
+     6d4:	b8 23 00 00 00       	mov    $0x23,%eax
+     6d9:	e9 7c fe ff ff       	jmp    55a <dosyscall>
+
+000006de <setpriority>:
+SYSCALL(setpriority)
+     6de:	b8 24 00 00 00       	mov    $0x24,%eax
+     6e3:	e9 72 fe ff ff       	jmp    55a <dosyscall>
+
+000006e8 <kthread_create>:
+SYSCALL(kthread_create)
+     6e8:	b8 25 00 00 00       	mov    $0x25,%eax
+     6ed:	e9 68 fe ff ff       	jmp    55a <dosyscall>
+
+000006f2 <kthread_id>:
+SYSCALL(kthread_id)
+     6f2:	b8 26 00 00 00       	mov    $0x26,%eax
+     6f7:	e9 5e fe ff ff       	jmp    55a <dosyscall>
+
+000006fc <kthread_exit>:
+SYSCALL(kthread_exit)
+     6fc:	b8 27 00 00 00       	mov    $0x27,%eax
+     701:	e9 54 fe ff ff       	jmp    55a <dosyscall>
+
+00000706 <kthread_join>:
+SYSCALL(kthread_join)
+     706:	b8 28 00 00 00       	mov    $0x28,%eax
+     70b:	e9 4a fe ff ff       	jmp    55a <dosyscall>
+
+00000710 <futex>:
+SYSCALL(futex)
+     710:	b8 29 00 00 00       	mov    $0x29,%eax
+     715:	e9 40 fe ff ff       	jmp    55a <dosyscall>
+
+0000071a <signal>:
+SYSCALL(signal)
+     71a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     71f:	e9 36 fe ff ff       	jmp    55a <dosyscall>
+
+00000724 <alarm>:
+SYSCALL(alarm)
+     724:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     729:	e9 2c fe ff ff       	jmp    55a <dosyscall>
+
+0000072e <usleep>:
+SYSCALL(usleep)
+     72e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     733:	e9 22 fe ff ff       	jmp    55a <dosyscall>
+
+00000738 <ioring_setup>:
+SYSCALL(ioring_setup)
+     738:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     73d:	e9 18 fe ff ff       	jmp    55a <dosyscall>
+
+00000742 <ioring_enter>:
+SYSCALL(ioring_enter)
+     742:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     747:	e9 0e fe ff ff       	jmp    55a <dosyscall>
+
+0000074c <getrusage>:
+SYSCALL(getrusage)
+     74c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     751:	e9 04 fe ff ff       	jmp    55a <dosyscall>
+
+00000756 <mount>:
+SYSCALL(mount)
+     756:	b8 30 00 00 00       	mov    $0x30,%eax
+     75b:	e9 fa fd ff ff       	jmp    55a <dosyscall>
+
+00000760 <getdents>:
+SYSCALL(getdents)
+     760:	b8 31 00 00 00       	mov    $0x31,%eax
+     765:	e9 f0 fd ff ff       	jmp    55a <dosyscall>
+
+0000076a <yield>:
+SYSCALL(yield)
+     76a:	b8 32 00 00 00       	mov    $0x32,%eax
+     76f:	e9 e6 fd ff ff       	jmp    55a <dosyscall>
+
+00000774 <ncpu>:
+SYSCALL(ncpu)
+     774:	b8 33 00 00 00       	mov    $0x33,%eax
+     779:	e9 dc fd ff ff       	jmp    55a <dosyscall>
+
+0000077e <fallocate>:
+SYSCALL(fallocate)
+     77e:	b8 34 00 00 00       	mov    $0x34,%eax
+     783:	e9 d2 fd ff ff       	jmp    55a <dosyscall>
+
+00000788 <ftruncate>:
+SYSCALL(ftruncate)
+     788:	b8 35 00 00 00       	mov    $0x35,%eax
+     78d:	e9 c8 fd ff ff       	jmp    55a <dosyscall>
+
+00000792 <fsync>:
+SYSCALL(fsync)
+     792:	b8 36 00 00 00       	mov    $0x36,%eax
+     797:	e9 be fd ff ff       	jmp    55a <dosyscall>
+
+0000079c <fdatasync>:
+SYSCALL(fdatasync)
+     79c:	b8 37 00 00 00       	mov    $0x37,%eax
+     7a1:	e9 b4 fd ff ff       	jmp    55a <dosyscall>
+
+000007a6 <poll>:
+SYSCALL(poll)
+     7a6:	b8 38 00 00 00       	mov    $0x38,%eax
+     7ab:	e9 aa fd ff ff       	jmp    55a <dosyscall>
+
+000007b0 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     7b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b9:	8b 40 04             	mov    0x4(%eax),%eax
+     7bc:	85 c0                	test   %eax,%eax
+     7be:	7e 1f                	jle    7df <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     7c0:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c3:	8b 50 04             	mov    0x4(%eax),%edx
+     7c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c9:	8d 48 08             	lea    0x8(%eax),%ecx
+     7cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     7cf:	8b 00                	mov    (%eax),%eax
+     7d1:	83 ec 04             	sub    $0x4,%esp
+     7d4:	52                   	push   %edx
+     7d5:	51                   	push   %ecx
+     7d6:	50                   	push   %eax
+     7d7:	e8 d0 fe ff ff       	call   6ac <writev>
+     7dc:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     7df:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     7e9:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ec:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     7f3:	00 00 00 
+}
+     7f6:	90                   	nop
+     7f7:	c9                   	leave
+     7f8:	c3                   	ret
+
+000007f9 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     7f9:	55                   	push   %ebp
+     7fa:	89 e5                	mov    %esp,%ebp
+     7fc:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     7ff:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     803:	0f 84 94 00 00 00    	je     89d <put+0xa4>
+    return;
+  if(o->n > 0){
+     809:	8b 45 08             	mov    0x8(%ebp),%eax
+     80c:	8b 40 04             	mov    0x4(%eax),%eax
+     80f:	85 c0                	test   %eax,%eax
+     811:	7e 40                	jle    853 <put+0x5a>
+    v = &o->iov[o->n-1];
+     813:	8b 45 08             	mov    0x8(%ebp),%eax
+     816:	8b 40 04             	mov    0x4(%eax),%eax
+     819:	83 e8 01             	sub    $0x1,%eax
+     81c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     823:	8b 45 08             	mov    0x8(%ebp),%eax
+     826:	01 d0                	add    %edx,%eax
+     828:	83 c0 08             	add    $0x8,%eax
+     82b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     82e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     831:	8b 10                	mov    (%eax),%edx
+     833:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     836:	8b 40 04             	mov    0x4(%eax),%eax
+     839:	01 d0                	add    %edx,%eax
+     83b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     83e:	75 13                	jne    853 <put+0x5a>
+      v->iov_len += n;
+     840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     843:	8b 50 04             	mov    0x4(%eax),%edx
+     846:	8b 45 10             	mov    0x10(%ebp),%eax
+     849:	01 c2                	add    %eax,%edx
+     84b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     84e:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     851:	eb 4b                	jmp    89e <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     853:	8b 45 08             	mov    0x8(%ebp),%eax
+     856:	8b 40 04             	mov    0x4(%eax),%eax
+     859:	83 f8 10             	cmp    $0x10,%eax
+     85c:	75 0e                	jne    86c <put+0x73>
+    flush(o);
+     85e:	83 ec 0c             	sub    $0xc,%esp
+     861:	ff 75 08             	push   0x8(%ebp)
+     864:	e8 47 ff ff ff       	call   7b0 <flush>
+     869:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     86c:	8b 45 08             	mov    0x8(%ebp),%eax
+     86f:	8b 50 04             	mov    0x4(%eax),%edx
+     872:	8b 45 08             	mov    0x8(%ebp),%eax
+     875:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     878:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     87c:	8b 45 08             	mov    0x8(%ebp),%eax
+     87f:	8b 50 04             	mov    0x4(%eax),%edx
+     882:	8b 45 08             	mov    0x8(%ebp),%eax
+     885:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     888:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     88c:	8b 45 08             	mov    0x8(%ebp),%eax
+     88f:	8b 40 04             	mov    0x4(%eax),%eax
+     892:	8d 50 01             	lea    0x1(%eax),%edx
+     895:	8b 45 08             	mov    0x8(%ebp),%eax
+     898:	89 50 04             	mov    %edx,0x4(%eax)
+     89b:	eb 01                	jmp    89e <put+0xa5>
+    return;
+     89d:	90                   	nop
+}
+     89e:	c9                   	leave
+     89f:	c3                   	ret
+
+000008a0 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a9:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     8af:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8b2:	01 d0                	add    %edx,%eax
+     8b4:	3d 80 00 00 00       	cmp    $0x80,%eax
+     8b9:	77 0b                	ja     8c6 <room+0x26>
+     8bb:	8b 45 08             	mov    0x8(%ebp),%eax
+     8be:	8b 40 04             	mov    0x4(%eax),%eax
+     8c1:	83 f8 10             	cmp    $0x10,%eax
+     8c4:	75 0e                	jne    8d4 <room+0x34>
+    flush(o);
+     8c6:	83 ec 0c             	sub    $0xc,%esp
+     8c9:	ff 75 08             	push   0x8(%ebp)
+     8cc:	e8 df fe ff ff       	call   7b0 <flush>
+     8d1:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     8d4:	8b 45 08             	mov    0x8(%ebp),%eax
+     8d7:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     8dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8e6:	01 d0                	add    %edx,%eax
+}
+     8e8:	c9                   	leave
+     8e9:	c3                   	ret
+
+000008ea <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     8ea:	55                   	push   %ebp
+     8eb:	89 e5                	mov    %esp,%ebp
+     8ed:	83 ec 28             	sub    $0x28,%esp
+     8f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8f3:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     8f6:	83 ec 08             	sub    $0x8,%esp
+     8f9:	6a 01                	push   $0x1
+     8fb:	ff 75 08             	push   0x8(%ebp)
+     8fe:	e8 9d ff ff ff       	call   8a0 <room>
+     903:	83 c4 10             	add    $0x10,%esp
+     906:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     90c:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     910:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     912:	8b 45 08             	mov    0x8(%ebp),%eax
+     915:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     91b:	8d 50 01             	lea    0x1(%eax),%edx
+     91e:	8b 45 08             	mov    0x8(%ebp),%eax
+     921:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     927:	83 ec 04             	sub    $0x4,%esp
+     92a:	6a 01                	push   $0x1
+     92c:	ff 75 f4             	push   -0xc(%ebp)
+     92f:	ff 75 08             	push   0x8(%ebp)
+     932:	e8 c2 fe ff ff       	call   7f9 <put>
+     937:	83 c4 10             	add    $0x10,%esp
+}
+     93a:	90                   	nop
+     93b:	c9                   	leave
+     93c:	c3                   	ret
+
+0000093d <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     93d:	55                   	push   %ebp
+     93e:	89 e5                	mov    %esp,%ebp
+     940:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     943:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     94a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     94e:	74 17                	je     967 <printint+0x2a>
+     950:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     954:	79 11                	jns    967 <printint+0x2a>
+    neg = 1;
+     956:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     95d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     960:	f7 d8                	neg    %eax
+     962:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     965:	eb 06                	jmp    96d <printint+0x30>
+  } else {
+    x = xx;
+     967:	8b 45 0c             	mov    0xc(%ebp),%eax
+     96a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     96d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     974:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     977:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     97a:	ba 00 00 00 00       	mov    $0x0,%edx
+     97f:	f7 f1                	div    %ecx
+     981:	89 d1                	mov    %edx,%ecx
+     983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     986:	8d 50 01             	lea    0x1(%eax),%edx
+     989:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     98c:	0f b6 91 18 15 00 00 	movzbl 0x1518(%ecx),%edx
+     993:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     997:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     99a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     99d:	ba 00 00 00 00       	mov    $0x0,%edx
+     9a2:	f7 f1                	div    %ecx
+     9a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9ab:	75 c7                	jne    974 <printint+0x37>
+  if(neg)
+     9ad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     9b1:	74 0e                	je     9c1 <printint+0x84>
+    buf[i++] = '-';
+     9b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9b6:	8d 50 01             	lea    0x1(%eax),%edx
+     9b9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     9bc:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     9c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9c4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     9c7:	83 ec 08             	sub    $0x8,%esp
+     9ca:	ff 75 e8             	push   -0x18(%ebp)
+     9cd:	ff 75 08             	push   0x8(%ebp)
+     9d0:	e8 cb fe ff ff       	call   8a0 <room>
+     9d5:	83 c4 10             	add    $0x10,%esp
+     9d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     9db:	eb 1d                	jmp    9fa <printint+0xbd>
+    p[n-1-i] = buf[i];
+     9dd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9e0:	83 e8 01             	sub    $0x1,%eax
+     9e3:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     9e6:	89 c2                	mov    %eax,%edx
+     9e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9eb:	01 c2                	add    %eax,%edx
+     9ed:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     9f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9f3:	01 c8                	add    %ecx,%eax
+     9f5:	0f b6 00             	movzbl (%eax),%eax
+     9f8:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     9fa:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     9fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a02:	79 d9                	jns    9dd <printint+0xa0>
+  o->used += n;
+     a04:	8b 45 08             	mov    0x8(%ebp),%eax
+     a07:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     a0d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a10:	01 c2                	add    %eax,%edx
+     a12:	8b 45 08             	mov    0x8(%ebp),%eax
+     a15:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     a1b:	83 ec 04             	sub    $0x4,%esp
+     a1e:	ff 75 e8             	push   -0x18(%ebp)
+     a21:	ff 75 e4             	push   -0x1c(%ebp)
+     a24:	ff 75 08             	push   0x8(%ebp)
+     a27:	e8 cd fd ff ff       	call   7f9 <put>
+     a2c:	83 c4 10             	add    $0x10,%esp
+}
+     a2f:	90                   	nop
+     a30:	c9                   	leave
+     a31:	c3                   	ret
+
+00000a32 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     a32:	55                   	push   %ebp
+     a33:	89 e5                	mov    %esp,%ebp
+     a35:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3e:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     a44:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     a4b:	00 00 00 
+  o.used = 0;
+     a4e:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     a55:	00 00 00 
+  state = 0;
+     a58:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a5f:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a62:	83 c0 04             	add    $0x4,%eax
+     a65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     a68:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a6f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a76:	e9 82 01 00 00       	jmp    bfd <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a7e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a81:	01 d0                	add    %edx,%eax
+     a83:	0f b6 00             	movzbl (%eax),%eax
+     a86:	0f be c0             	movsbl %al,%eax
+     a89:	25 ff 00 00 00       	and    $0xff,%eax
+     a8e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a91:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a95:	75 38                	jne    acf <printf+0x9d>
+      if(c == '%'){
+     a97:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a9b:	0f 85 58 01 00 00    	jne    bf9 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     aa1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     aa4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     aa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     aaa:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     aad:	01 ca                	add    %ecx,%edx
+     aaf:	83 ec 04             	sub    $0x4,%esp
+     ab2:	50                   	push   %eax
+     ab3:	52                   	push   %edx
+     ab4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     aba:	50                   	push   %eax
+     abb:	e8 39 fd ff ff       	call   7f9 <put>
+     ac0:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     ac3:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     aca:	e9 2a 01 00 00       	jmp    bf9 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     acf:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     ad3:	0f 85 20 01 00 00    	jne    bf9 <printf+0x1c7>
+      if(c == 'd'){
+     ad9:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     add:	75 22                	jne    b01 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     adf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ae2:	8b 00                	mov    (%eax),%eax
+     ae4:	6a 01                	push   $0x1
+     ae6:	6a 0a                	push   $0xa
+     ae8:	50                   	push   %eax
+     ae9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     aef:	50                   	push   %eax
+     af0:	e8 48 fe ff ff       	call   93d <printint>
+     af5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     af8:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     afc:	e9 e8 00 00 00       	jmp    be9 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     b01:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     b05:	74 06                	je     b0d <printf+0xdb>
+     b07:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     b0b:	75 22                	jne    b2f <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     b0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b10:	8b 00                	mov    (%eax),%eax
+     b12:	6a 00                	push   $0x0
+     b14:	6a 10                	push   $0x10
+     b16:	50                   	push   %eax
+     b17:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b1d:	50                   	push   %eax
+     b1e:	e8 1a fe ff ff       	call   93d <printint>
+     b23:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b26:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b2a:	e9 ba 00 00 00       	jmp    be9 <printf+0x1b7>
+      } else if(c == 's'){
+     b2f:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     b33:	75 3f                	jne    b74 <printf+0x142>
+        s = (char*)*ap;
+     b35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b38:	8b 00                	mov    (%eax),%eax
+     b3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     b3d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     b41:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b45:	75 07                	jne    b4e <printf+0x11c>
+          s = "(null)";
+     b47:	c7 45 f4 88 11 00 00 	movl   $0x1188,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     b4e:	83 ec 0c             	sub    $0xc,%esp
+     b51:	ff 75 f4             	push   -0xc(%ebp)
+     b54:	e8 47 f8 ff ff       	call   3a0 <strlen>
+     b59:	83 c4 10             	add    $0x10,%esp
+     b5c:	83 ec 04             	sub    $0x4,%esp
+     b5f:	50                   	push   %eax
+     b60:	ff 75 f4             	push   -0xc(%ebp)
+     b63:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b69:	50                   	push   %eax
+     b6a:	e8 8a fc ff ff       	call   7f9 <put>
+     b6f:	83 c4 10             	add    $0x10,%esp
+     b72:	eb 75                	jmp    be9 <printf+0x1b7>
+      } else if(c == 'c'){
+     b74:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b78:	75 21                	jne    b9b <printf+0x169>
+        putc(&o, *ap);
+     b7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b7d:	8b 00                	mov    (%eax),%eax
+     b7f:	0f be c0             	movsbl %al,%eax
+     b82:	83 ec 08             	sub    $0x8,%esp
+     b85:	50                   	push   %eax
+     b86:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b8c:	50                   	push   %eax
+     b8d:	e8 58 fd ff ff       	call   8ea <putc>
+     b92:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b95:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b99:	eb 4e                	jmp    be9 <printf+0x1b7>
+      } else if(c == '%'){
+     b9b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b9f:	75 1b                	jne    bbc <printf+0x18a>
+        putc(&o, c);
+     ba1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ba4:	0f be c0             	movsbl %al,%eax
+     ba7:	83 ec 08             	sub    $0x8,%esp
+     baa:	50                   	push   %eax
+     bab:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bb1:	50                   	push   %eax
+     bb2:	e8 33 fd ff ff       	call   8ea <putc>
+     bb7:	83 c4 10             	add    $0x10,%esp
+     bba:	eb 2d                	jmp    be9 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     bbc:	83 ec 08             	sub    $0x8,%esp
+     bbf:	6a 25                	push   $0x25
+     bc1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bc7:	50                   	push   %eax
+     bc8:	e8 1d fd ff ff       	call   8ea <putc>
+     bcd:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     bd0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bd3:	0f be c0             	movsbl %al,%eax
+     bd6:	83 ec 08             	sub    $0x8,%esp
+     bd9:	50                   	push   %eax
+     bda:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     be0:	50                   	push   %eax
+     be1:	e8 04 fd ff ff       	call   8ea <putc>
+     be6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     be9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     bf0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bf3:	83 c0 01             	add    $0x1,%eax
+     bf6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bf9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     bfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c03:	01 d0                	add    %edx,%eax
+     c05:	0f b6 00             	movzbl (%eax),%eax
+     c08:	84 c0                	test   %al,%al
+     c0a:	0f 85 6b fe ff ff    	jne    a7b <printf+0x49>
+    }
+  }
+  if(state == 0)
+     c10:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     c14:	75 22                	jne    c38 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     c16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c19:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     c1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c1f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     c22:	01 ca                	add    %ecx,%edx
+     c24:	83 ec 04             	sub    $0x4,%esp
+     c27:	50                   	push   %eax
+     c28:	52                   	push   %edx
+     c29:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c2f:	50                   	push   %eax
+     c30:	e8 c4 fb ff ff       	call   7f9 <put>
+     c35:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     c38:	83 ec 0c             	sub    $0xc,%esp
+     c3b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c41:	50                   	push   %eax
+     c42:	e8 69 fb ff ff       	call   7b0 <flush>
+     c47:	83 c4 10             	add    $0x10,%esp
+}
+     c4a:	90                   	nop
+     c4b:	c9                   	leave
+     c4c:	c3                   	ret
+
+00000c4d <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     c4d:	55                   	push   %ebp
+     c4e:	89 e5                	mov    %esp,%ebp
+     c50:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     c53:	8b 55 08             	mov    0x8(%ebp),%edx
+     c56:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c5c:	f0 87 02             	lock xchg %eax,(%edx)
+     c5f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     c62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     c65:	c9                   	leave
+     c66:	c3                   	ret
+
+00000c67 <lock>:
+{
+     c67:	55                   	push   %ebp
+     c68:	89 e5                	mov    %esp,%ebp
+     c6a:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     c6d:	a1 50 3c 00 00       	mov    0x3c50,%eax
+     c72:	85 c0                	test   %eax,%eax
+     c74:	74 09                	je     c7f <lock+0x18>
+     c76:	a1 50 3c 00 00       	mov    0x3c50,%eax
+     c7b:	ff d0                	call   *%eax
+     c7d:	eb 05                	jmp    c84 <lock+0x1d>
+     c7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c84:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c87:	90                   	nop
+     c88:	83 ec 08             	sub    $0x8,%esp
+     c8b:	6a 01                	push   $0x1
+     c8d:	68 88 3c 00 00       	push   $0x3c88
+     c92:	e8 b6 ff ff ff       	call   c4d <xchg>
+     c97:	83 c4 10             	add    $0x10,%esp
+     c9a:	85 c0                	test   %eax,%eax
+     c9c:	75 ea                	jne    c88 <lock+0x21>
+  return pin;
+     c9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     ca1:	c9                   	leave
+     ca2:	c3                   	ret
+
+00000ca3 <unlock>:
+{
+     ca3:	55                   	push   %ebp
+     ca4:	89 e5                	mov    %esp,%ebp
+     ca6:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     ca9:	6a 00                	push   $0x0
+     cab:	68 88 3c 00 00       	push   $0x3c88
+     cb0:	e8 98 ff ff ff       	call   c4d <xchg>
+     cb5:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     cb8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     cbc:	78 10                	js     cce <unlock+0x2b>
+    mallocunpin(pin);
+     cbe:	a1 54 3c 00 00       	mov    0x3c54,%eax
+     cc3:	83 ec 0c             	sub    $0xc,%esp
+     cc6:	ff 75 08             	push   0x8(%ebp)
+     cc9:	ff d0                	call   *%eax
+     ccb:	83 c4 10             	add    $0x10,%esp
+}
+     cce:	90                   	nop
+     ccf:	c9                   	leave
+     cd0:	c3                   	ret
+
+00000cd1 <sizeclass>:
+{
+     cd1:	55                   	push   %ebp
+     cd2:	89 e5                	mov    %esp,%ebp
+     cd4:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     cd7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     cde:	eb 1c                	jmp    cfc <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     ce0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ce3:	ba 02 00 00 00       	mov    $0x2,%edx
+     ce8:	89 c1                	mov    %eax,%ecx
+     cea:	d3 e2                	shl    %cl,%edx
+     cec:	89 d0                	mov    %edx,%eax
+     cee:	3b 45 08             	cmp    0x8(%ebp),%eax
+     cf1:	72 05                	jb     cf8 <sizeclass+0x27>
+      return c;
+     cf3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cf6:	eb 0f                	jmp    d07 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     cf8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     cfc:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     d00:	7e de                	jle    ce0 <sizeclass+0xf>
+  return -1;
+     d02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     d07:	c9                   	leave
+     d08:	c3                   	ret
+
+00000d09 <bigfree>:
+{
+     d09:	55                   	push   %ebp
+     d0a:	89 e5                	mov    %esp,%ebp
+     d0c:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d0f:	a1 60 3c 00 00       	mov    0x3c60,%eax
+     d14:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     d17:	eb 24                	jmp    d3d <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d1c:	8b 00                	mov    (%eax),%eax
+     d1e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d21:	72 12                	jb     d35 <bigfree+0x2c>
+     d23:	8b 45 08             	mov    0x8(%ebp),%eax
+     d26:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d29:	72 24                	jb     d4f <bigfree+0x46>
+     d2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d2e:	8b 00                	mov    (%eax),%eax
+     d30:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d33:	72 1a                	jb     d4f <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d35:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d38:	8b 00                	mov    (%eax),%eax
+     d3a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d40:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d43:	73 d4                	jae    d19 <bigfree+0x10>
+     d45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d48:	8b 00                	mov    (%eax),%eax
+     d4a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d4d:	73 ca                	jae    d19 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d52:	8b 40 04             	mov    0x4(%eax),%eax
+     d55:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5f:	01 c2                	add    %eax,%edx
+     d61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d64:	8b 00                	mov    (%eax),%eax
+     d66:	39 c2                	cmp    %eax,%edx
+     d68:	75 24                	jne    d8e <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d6d:	8b 50 04             	mov    0x4(%eax),%edx
+     d70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d73:	8b 00                	mov    (%eax),%eax
+     d75:	8b 40 04             	mov    0x4(%eax),%eax
+     d78:	01 c2                	add    %eax,%edx
+     d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d83:	8b 00                	mov    (%eax),%eax
+     d85:	8b 10                	mov    (%eax),%edx
+     d87:	8b 45 08             	mov    0x8(%ebp),%eax
+     d8a:	89 10                	mov    %edx,(%eax)
+     d8c:	eb 0a                	jmp    d98 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d91:	8b 10                	mov    (%eax),%edx
+     d93:	8b 45 08             	mov    0x8(%ebp),%eax
+     d96:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d9b:	8b 40 04             	mov    0x4(%eax),%eax
+     d9e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     da5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     da8:	01 d0                	add    %edx,%eax
+     daa:	39 45 08             	cmp    %eax,0x8(%ebp)
+     dad:	75 20                	jne    dcf <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     daf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     db2:	8b 50 04             	mov    0x4(%eax),%edx
+     db5:	8b 45 08             	mov    0x8(%ebp),%eax
+     db8:	8b 40 04             	mov    0x4(%eax),%eax
+     dbb:	01 c2                	add    %eax,%edx
+     dbd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dc0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc6:	8b 10                	mov    (%eax),%edx
+     dc8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dcb:	89 10                	mov    %edx,(%eax)
+     dcd:	eb 08                	jmp    dd7 <bigfree+0xce>
+    p->s.ptr = bp;
+     dcf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+     dd5:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     dd7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dda:	a3 60 3c 00 00       	mov    %eax,0x3c60
+}
+     ddf:	90                   	nop
+     de0:	c9                   	leave
+     de1:	c3                   	ret
+
+00000de2 <free>:
+{
+     de2:	55                   	push   %ebp
+     de3:	89 e5                	mov    %esp,%ebp
+     de5:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     de8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     dec:	74 68                	je     e56 <free+0x74>
+  bp = (Header*)ap - 1;
+     dee:	8b 45 08             	mov    0x8(%ebp),%eax
+     df1:	83 e8 08             	sub    $0x8,%eax
+     df4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     df7:	e8 6b fe ff ff       	call   c67 <lock>
+     dfc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     dff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e02:	8b 40 04             	mov    0x4(%eax),%eax
+     e05:	83 ec 0c             	sub    $0xc,%esp
+     e08:	50                   	push   %eax
+     e09:	e8 c3 fe ff ff       	call   cd1 <sizeclass>
+     e0e:	83 c4 10             	add    $0x10,%esp
+     e11:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e14:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     e18:	78 1e                	js     e38 <free+0x56>
+    bp->s.ptr = classfree[c];
+     e1a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e1d:	8b 14 85 64 3c 00 00 	mov    0x3c64(,%eax,4),%edx
+     e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e27:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     e29:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e2c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e2f:	89 14 85 64 3c 00 00 	mov    %edx,0x3c64(,%eax,4)
+     e36:	eb 0e                	jmp    e46 <free+0x64>
+    bigfree(bp);
+     e38:	83 ec 0c             	sub    $0xc,%esp
+     e3b:	ff 75 f4             	push   -0xc(%ebp)
+     e3e:	e8 c6 fe ff ff       	call   d09 <bigfree>
+     e43:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     e46:	83 ec 0c             	sub    $0xc,%esp
+     e49:	ff 75 f0             	push   -0x10(%ebp)
+     e4c:	e8 52 fe ff ff       	call   ca3 <unlock>
+     e51:	83 c4 10             	add    $0x10,%esp
+     e54:	eb 01                	jmp    e57 <free+0x75>
+    return;
+     e56:	90                   	nop
+}
+     e57:	c9                   	leave
+     e58:	c3                   	ret
+
+00000e59 <morecore>:
+{
+     e59:	55                   	push   %ebp
+     e5a:	89 e5                	mov    %esp,%ebp
+     e5c:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     e5f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     e66:	77 07                	ja     e6f <morecore+0x16>
+    nu = 4096;
+     e68:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     e6f:	8b 45 08             	mov    0x8(%ebp),%eax
+     e72:	c1 e0 03             	shl    $0x3,%eax
+     e75:	83 ec 0c             	sub    $0xc,%esp
+     e78:	50                   	push   %eax
+     e79:	e8 b6 f7 ff ff       	call   634 <sbrk>
+     e7e:	83 c4 10             	add    $0x10,%esp
+     e81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e84:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e88:	75 07                	jne    e91 <morecore+0x38>
+    return 0;
+     e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e8f:	eb 22                	jmp    eb3 <morecore+0x5a>
+  hp = (Header*)p;
+     e91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e9a:	8b 55 08             	mov    0x8(%ebp),%edx
+     e9d:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     ea0:	83 ec 0c             	sub    $0xc,%esp
+     ea3:	ff 75 f0             	push   -0x10(%ebp)
+     ea6:	e8 5e fe ff ff       	call   d09 <bigfree>
+     eab:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     eae:	a1 60 3c 00 00       	mov    0x3c60,%eax
+}
+     eb3:	c9                   	leave
+     eb4:	c3                   	ret
+
+00000eb5 <bigalloc>:
+{
+     eb5:	55                   	push   %ebp
+     eb6:	89 e5                	mov    %esp,%ebp
+     eb8:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     ebb:	a1 60 3c 00 00       	mov    0x3c60,%eax
+     ec0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ec3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ec7:	75 23                	jne    eec <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     ec9:	c7 45 f0 58 3c 00 00 	movl   $0x3c58,-0x10(%ebp)
+     ed0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed3:	a3 60 3c 00 00       	mov    %eax,0x3c60
+     ed8:	a1 60 3c 00 00       	mov    0x3c60,%eax
+     edd:	a3 58 3c 00 00       	mov    %eax,0x3c58
+    base.s.size = 0;
+     ee2:	c7 05 5c 3c 00 00 00 	movl   $0x0,0x3c5c
+     ee9:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eef:	8b 00                	mov    (%eax),%eax
+     ef1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     ef4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef7:	8b 40 04             	mov    0x4(%eax),%eax
+     efa:	3b 45 08             	cmp    0x8(%ebp),%eax
+     efd:	72 4a                	jb     f49 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     eff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f02:	8b 40 04             	mov    0x4(%eax),%eax
+     f05:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f08:	75 0c                	jne    f16 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0d:	8b 10                	mov    (%eax),%edx
+     f0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f12:	89 10                	mov    %edx,(%eax)
+     f14:	eb 26                	jmp    f3c <bigalloc+0x87>
+        p->s.size -= nunits;
+     f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f19:	8b 40 04             	mov    0x4(%eax),%eax
+     f1c:	2b 45 08             	sub    0x8(%ebp),%eax
+     f1f:	89 c2                	mov    %eax,%edx
+     f21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f24:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f2a:	8b 40 04             	mov    0x4(%eax),%eax
+     f2d:	c1 e0 03             	shl    $0x3,%eax
+     f30:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f36:	8b 55 08             	mov    0x8(%ebp),%edx
+     f39:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     f3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f3f:	a3 60 3c 00 00       	mov    %eax,0x3c60
+      return p;
+     f44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f47:	eb 3b                	jmp    f84 <bigalloc+0xcf>
+    if(p == freep)
+     f49:	a1 60 3c 00 00       	mov    0x3c60,%eax
+     f4e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     f51:	75 1e                	jne    f71 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     f53:	83 ec 0c             	sub    $0xc,%esp
+     f56:	ff 75 08             	push   0x8(%ebp)
+     f59:	e8 fb fe ff ff       	call   e59 <morecore>
+     f5e:	83 c4 10             	add    $0x10,%esp
+     f61:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f64:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f68:	75 07                	jne    f71 <bigalloc+0xbc>
+        return 0;
+     f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6f:	eb 13                	jmp    f84 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f74:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7a:	8b 00                	mov    (%eax),%eax
+     f7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f7f:	e9 70 ff ff ff       	jmp    ef4 <bigalloc+0x3f>
+}
+     f84:	c9                   	leave
+     f85:	c3                   	ret
+
+00000f86 <alloc>:
+alloc(uint nbytes)
+{
+     f86:	55                   	push   %ebp
+     f87:	89 e5                	mov    %esp,%ebp
+     f89:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8f:	83 c0 07             	add    $0x7,%eax
+     f92:	c1 e8 03             	shr    $0x3,%eax
+     f95:	83 c0 01             	add    $0x1,%eax
+     f98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f9b:	ff 75 f4             	push   -0xc(%ebp)
+     f9e:	e8 2e fd ff ff       	call   cd1 <sizeclass>
+     fa3:	83 c4 04             	add    $0x4,%esp
+     fa6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fa9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     fad:	79 2c                	jns    fdb <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     faf:	83 ec 0c             	sub    $0xc,%esp
+     fb2:	ff 75 f4             	push   -0xc(%ebp)
+     fb5:	e8 fb fe ff ff       	call   eb5 <bigalloc>
+     fba:	83 c4 10             	add    $0x10,%esp
+     fbd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fc0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fc4:	75 0a                	jne    fd0 <alloc+0x4a>
+      return 0;
+     fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+     fcb:	e9 c8 00 00 00       	jmp    1098 <alloc+0x112>
+    return (void*)(p + 1);
+     fd0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fd3:	83 c0 08             	add    $0x8,%eax
+     fd6:	e9 bd 00 00 00       	jmp    1098 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     fdb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fde:	8b 04 85 64 3c 00 00 	mov    0x3c64(,%eax,4),%eax
+     fe5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fe8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fec:	74 1a                	je     1008 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     fee:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff1:	8b 10                	mov    (%eax),%edx
+     ff3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff6:	89 14 85 64 3c 00 00 	mov    %edx,0x3c64(,%eax,4)
+    return (void*)(p + 1);
+     ffd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1000:	83 c0 08             	add    $0x8,%eax
+    1003:	e9 90 00 00 00       	jmp    1098 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    1008:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    100b:	ba 02 00 00 00       	mov    $0x2,%edx
+    1010:	89 c1                	mov    %eax,%ecx
+    1012:	d3 e2                	shl    %cl,%edx
+    1014:	89 d0                	mov    %edx,%eax
+    1016:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    1019:	a1 80 3c 00 00       	mov    0x3c80,%eax
+    101e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1021:	c1 e2 03             	shl    $0x3,%edx
+    1024:	01 d0                	add    %edx,%eax
+    1026:	8b 15 84 3c 00 00    	mov    0x3c84,%edx
+    102c:	39 c2                	cmp    %eax,%edx
+    102e:	73 3f                	jae    106f <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1030:	83 ec 0c             	sub    $0xc,%esp
+    1033:	68 00 08 00 00       	push   $0x800
+    1038:	e8 78 fe ff ff       	call   eb5 <bigalloc>
+    103d:	83 c4 10             	add    $0x10,%esp
+    1040:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1043:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1047:	75 07                	jne    1050 <alloc+0xca>
+      return 0;
+    1049:	b8 00 00 00 00       	mov    $0x0,%eax
+    104e:	eb 48                	jmp    1098 <alloc+0x112>
+    bump = (char*)p;
+    1050:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1053:	a3 80 3c 00 00       	mov    %eax,0x3c80
+    bumpend = (char*)(p + p->s.size);
+    1058:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    105b:	8b 40 04             	mov    0x4(%eax),%eax
+    105e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1065:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1068:	01 d0                	add    %edx,%eax
+    106a:	a3 84 3c 00 00       	mov    %eax,0x3c84
+  }
+  p = (Header*)bump;
+    106f:	a1 80 3c 00 00       	mov    0x3c80,%eax
+    1074:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1077:	a1 80 3c 00 00       	mov    0x3c80,%eax
+    107c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    107f:	c1 e2 03             	shl    $0x3,%edx
+    1082:	01 d0                	add    %edx,%eax
+    1084:	a3 80 3c 00 00       	mov    %eax,0x3c80
+  p->s.size = nunits;
+    1089:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    108c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    108f:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1092:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1095:	83 c0 08             	add    $0x8,%eax
+}
+    1098:	c9                   	leave
+    1099:	c3                   	ret
+
+0000109a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    109a:	55                   	push   %ebp
+    109b:	89 e5                	mov    %esp,%ebp
+    109d:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    10a0:	e8 c2 fb ff ff       	call   c67 <lock>
+    10a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    10a8:	83 ec 0c             	sub    $0xc,%esp
+    10ab:	ff 75 08             	push   0x8(%ebp)
+    10ae:	e8 d3 fe ff ff       	call   f86 <alloc>
+    10b3:	83 c4 10             	add    $0x10,%esp
+    10b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    10b9:	83 ec 0c             	sub    $0xc,%esp
+    10bc:	ff 75 f4             	push   -0xc(%ebp)
+    10bf:	e8 df fb ff ff       	call   ca3 <unlock>
+    10c4:	83 c4 10             	add    $0x10,%esp
+  return p;
+    10c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    10ca:	c9                   	leave
+    10cb:	c3                   	ret
@@ -0,0 +1,74 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define TEST_FILE "/mmap_file"
+#define SIZE 10000
+
+static char buf[SIZE];
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+  char *p;
+
+  for(i = 0; i < SIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, buf, SIZE) != SIZE){
+    printf(1, "error creating file: %s\n", TEST_FILE);
+    exit();
+  }
+
+  // Pages fault in from the file.
+  if((p = mmap(0, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == (char*)-1){
+    printf(1, "error: mmap\n");
+    exit();
+  }
+  for(i = 0; i < SIZE; i++){
+    if(p[i] != buf[i]){
+      printf(1, "wrong data at %d\n", i);
+      exit();
+    }
+  }
+  printf(1, "read ok\n");
+
+  // The child gets a copy of the mapping.
+  if(fork() == 0){
+    if(p[SIZE-1] != buf[SIZE-1])
+      printf(1, "child: wrong data\n");
+    exit();
+  }
+  wait();
+
+  // Shared writes reach the file on munmap.
+  p[0] = 'X';
+  p[SIZE-1] = 'Y';
+  if(munmap(p, SIZE) < 0){
+    printf(1, "error: munmap\n");
+    exit();
+  }
+  close(fd);
+  fd = open(TEST_FILE, O_RDONLY);
+  if(read(fd, buf, SIZE) != SIZE || buf[0] != 'X' || buf[SIZE-1] != 'Y'){
+    printf(1, "shared write lost\n");
+    exit();
+  }
+  printf(1, "write back ok\n");
+
+  // Private writes do not.
+  p = mmap(0, SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  p[0] = 'Z';
+  munmap(p, SIZE);
+  close(fd);
+  fd = open(TEST_FILE, O_RDONLY);
+  if(read(fd, buf, 1) != 1 || buf[0] != 'X'){
+    printf(1, "private write reached the file\n");
+    exit();
+  }
+  close(fd);
+  unlink(TEST_FILE);
+  printf(1, "private ok\n");
+  exit();
+}
@@ -0,0 +1,2047 @@
+
+_test_poll:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fail>:
+#include "user.h"
+#include "poll.h"
+
+static void
+fail(char *what)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "error: %s\n", what);
+       6:	83 ec 04             	sub    $0x4,%esp
+       9:	ff 75 08             	push   0x8(%ebp)
+       c:	68 94 10 00 00       	push   $0x1094
+      11:	6a 01                	push   $0x1
+      13:	e8 e2 09 00 00       	call   9fa <printf>
+      18:	83 c4 10             	add    $0x10,%esp
+  exit();
+      1b:	e8 4a 05 00 00       	call   56a <exit>
+
+00000020 <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+      20:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      24:	83 e4 f0             	and    $0xfffffff0,%esp
+      27:	ff 71 fc             	push   -0x4(%ecx)
+      2a:	55                   	push   %ebp
+      2b:	89 e5                	mov    %esp,%ebp
+      2d:	51                   	push   %ecx
+      2e:	83 ec 34             	sub    $0x34,%esp
+  struct pollfd fds[3];
+  int p[2], q[2], t;
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+      31:	83 ec 0c             	sub    $0xc,%esp
+      34:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      37:	50                   	push   %eax
+      38:	e8 3b 05 00 00       	call   578 <pipe>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	85 c0                	test   %eax,%eax
+      42:	78 13                	js     57 <main+0x37>
+      44:	83 ec 0c             	sub    $0xc,%esp
+      47:	8d 45 cc             	lea    -0x34(%ebp),%eax
+      4a:	50                   	push   %eax
+      4b:	e8 28 05 00 00       	call   578 <pipe>
+      50:	83 c4 10             	add    $0x10,%esp
+      53:	85 c0                	test   %eax,%eax
+      55:	79 10                	jns    67 <main+0x47>
+    fail("pipe");
+      57:	83 ec 0c             	sub    $0xc,%esp
+      5a:	68 9f 10 00 00       	push   $0x109f
+      5f:	e8 9c ff ff ff       	call   0 <fail>
+      64:	83 c4 10             	add    $0x10,%esp
+  fds[0].fd = p[0];
+      67:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      6a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  fds[0].events = POLLIN;
+      6d:	66 c7 45 e0 01 00    	movw   $0x1,-0x20(%ebp)
+  fds[1].fd = q[0];
+      73:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  fds[1].events = POLLIN;
+      79:	66 c7 45 e8 01 00    	movw   $0x1,-0x18(%ebp)
+  fds[2].fd = -1;
+      7f:	c7 45 ec ff ff ff ff 	movl   $0xffffffff,-0x14(%ebp)
+
+  // Nothing to read: a zero timeout returns at once, a short one
+  // after a while.
+  if(poll(fds, 2, 0) != 0 || fds[0].revents || fds[1].revents)
+      86:	83 ec 04             	sub    $0x4,%esp
+      89:	6a 00                	push   $0x0
+      8b:	6a 02                	push   $0x2
+      8d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+      90:	50                   	push   %eax
+      91:	e8 d8 06 00 00       	call   76e <poll>
+      96:	83 c4 10             	add    $0x10,%esp
+      99:	85 c0                	test   %eax,%eax
+      9b:	75 12                	jne    af <main+0x8f>
+      9d:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+      a1:	66 85 c0             	test   %ax,%ax
+      a4:	75 09                	jne    af <main+0x8f>
+      a6:	0f b7 45 ea          	movzwl -0x16(%ebp),%eax
+      aa:	66 85 c0             	test   %ax,%ax
+      ad:	74 10                	je     bf <main+0x9f>
+    fail("poll of empty pipes");
+      af:	83 ec 0c             	sub    $0xc,%esp
+      b2:	68 a4 10 00 00       	push   $0x10a4
+      b7:	e8 44 ff ff ff       	call   0 <fail>
+      bc:	83 c4 10             	add    $0x10,%esp
+  t = uptime();
+      bf:	e8 4c 05 00 00       	call   610 <uptime>
+      c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(poll(fds, 3, 50) != 0 || uptime() - t < 4)
+      c7:	83 ec 04             	sub    $0x4,%esp
+      ca:	6a 32                	push   $0x32
+      cc:	6a 03                	push   $0x3
+      ce:	8d 45 dc             	lea    -0x24(%ebp),%eax
+      d1:	50                   	push   %eax
+      d2:	e8 97 06 00 00       	call   76e <poll>
+      d7:	83 c4 10             	add    $0x10,%esp
+      da:	85 c0                	test   %eax,%eax
+      dc:	75 0d                	jne    eb <main+0xcb>
+      de:	e8 2d 05 00 00       	call   610 <uptime>
+      e3:	2b 45 f4             	sub    -0xc(%ebp),%eax
+      e6:	83 f8 03             	cmp    $0x3,%eax
+      e9:	7f 10                	jg     fb <main+0xdb>
+    fail("poll timeout");
+      eb:	83 ec 0c             	sub    $0xc,%esp
+      ee:	68 b8 10 00 00       	push   $0x10b8
+      f3:	e8 08 ff ff ff       	call   0 <fail>
+      f8:	83 c4 10             	add    $0x10,%esp
+
+  // Only the pipe with data is ready.
+  if(write(q[1], "x", 1) != 1 || poll(fds, 3, -1) != 1 ||
+      fb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      fe:	83 ec 04             	sub    $0x4,%esp
+     101:	6a 01                	push   $0x1
+     103:	68 c5 10 00 00       	push   $0x10c5
+     108:	50                   	push   %eax
+     109:	e8 78 04 00 00       	call   586 <write>
+     10e:	83 c4 10             	add    $0x10,%esp
+     111:	83 f8 01             	cmp    $0x1,%eax
+     114:	75 34                	jne    14a <main+0x12a>
+     116:	83 ec 04             	sub    $0x4,%esp
+     119:	6a ff                	push   $0xffffffff
+     11b:	6a 03                	push   $0x3
+     11d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     120:	50                   	push   %eax
+     121:	e8 48 06 00 00       	call   76e <poll>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	83 f8 01             	cmp    $0x1,%eax
+     12c:	75 1c                	jne    14a <main+0x12a>
+     fds[0].revents != 0 || fds[1].revents != POLLIN || fds[2].revents != 0)
+     12e:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+  if(write(q[1], "x", 1) != 1 || poll(fds, 3, -1) != 1 ||
+     132:	66 85 c0             	test   %ax,%ax
+     135:	75 13                	jne    14a <main+0x12a>
+     fds[0].revents != 0 || fds[1].revents != POLLIN || fds[2].revents != 0)
+     137:	0f b7 45 ea          	movzwl -0x16(%ebp),%eax
+     13b:	66 83 f8 01          	cmp    $0x1,%ax
+     13f:	75 09                	jne    14a <main+0x12a>
+     141:	0f b7 45 f2          	movzwl -0xe(%ebp),%eax
+     145:	66 85 c0             	test   %ax,%ax
+     148:	74 10                	je     15a <main+0x13a>
+    fail("poll of one full pipe");
+     14a:	83 ec 0c             	sub    $0xc,%esp
+     14d:	68 c7 10 00 00       	push   $0x10c7
+     152:	e8 a9 fe ff ff       	call   0 <fail>
+     157:	83 c4 10             	add    $0x10,%esp
+  read(q[0], &c, 1);
+     15a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     15d:	83 ec 04             	sub    $0x4,%esp
+     160:	6a 01                	push   $0x1
+     162:	8d 55 cb             	lea    -0x35(%ebp),%edx
+     165:	52                   	push   %edx
+     166:	50                   	push   %eax
+     167:	e8 13 04 00 00       	call   57f <read>
+     16c:	83 c4 10             	add    $0x10,%esp
+
+  // A write from another process wakes a blocked poll.
+  if(fork() == 0){
+     16f:	e8 ef 03 00 00       	call   563 <fork>
+     174:	85 c0                	test   %eax,%eax
+     176:	75 28                	jne    1a0 <main+0x180>
+    sleep(5);
+     178:	83 ec 0c             	sub    $0xc,%esp
+     17b:	6a 05                	push   $0x5
+     17d:	e8 84 04 00 00       	call   606 <sleep>
+     182:	83 c4 10             	add    $0x10,%esp
+    write(p[1], "y", 1);
+     185:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     188:	83 ec 04             	sub    $0x4,%esp
+     18b:	6a 01                	push   $0x1
+     18d:	68 dd 10 00 00       	push   $0x10dd
+     192:	50                   	push   %eax
+     193:	e8 ee 03 00 00       	call   586 <write>
+     198:	83 c4 10             	add    $0x10,%esp
+    exit();
+     19b:	e8 ca 03 00 00       	call   56a <exit>
+  }
+  if(poll(fds, 2, -1) != 1 || fds[0].revents != POLLIN)
+     1a0:	83 ec 04             	sub    $0x4,%esp
+     1a3:	6a ff                	push   $0xffffffff
+     1a5:	6a 02                	push   $0x2
+     1a7:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     1aa:	50                   	push   %eax
+     1ab:	e8 be 05 00 00       	call   76e <poll>
+     1b0:	83 c4 10             	add    $0x10,%esp
+     1b3:	83 f8 01             	cmp    $0x1,%eax
+     1b6:	75 0a                	jne    1c2 <main+0x1a2>
+     1b8:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     1bc:	66 83 f8 01          	cmp    $0x1,%ax
+     1c0:	74 10                	je     1d2 <main+0x1b2>
+    fail("poll woken by write");
+     1c2:	83 ec 0c             	sub    $0xc,%esp
+     1c5:	68 df 10 00 00       	push   $0x10df
+     1ca:	e8 31 fe ff ff       	call   0 <fail>
+     1cf:	83 c4 10             	add    $0x10,%esp
+  read(p[0], &c, 1);
+     1d2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     1d5:	83 ec 04             	sub    $0x4,%esp
+     1d8:	6a 01                	push   $0x1
+     1da:	8d 55 cb             	lea    -0x35(%ebp),%edx
+     1dd:	52                   	push   %edx
+     1de:	50                   	push   %eax
+     1df:	e8 9b 03 00 00       	call   57f <read>
+     1e4:	83 c4 10             	add    $0x10,%esp
+  wait();
+     1e7:	e8 85 03 00 00       	call   571 <wait>
+
+  // Hang-ups, write ends and closed fds.
+  close(q[1]);
+     1ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     1ef:	83 ec 0c             	sub    $0xc,%esp
+     1f2:	50                   	push   %eax
+     1f3:	e8 95 03 00 00       	call   58d <close>
+     1f8:	83 c4 10             	add    $0x10,%esp
+  if(poll(fds, 2, -1) != 1 || fds[1].revents != POLLHUP)
+     1fb:	83 ec 04             	sub    $0x4,%esp
+     1fe:	6a ff                	push   $0xffffffff
+     200:	6a 02                	push   $0x2
+     202:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     205:	50                   	push   %eax
+     206:	e8 63 05 00 00       	call   76e <poll>
+     20b:	83 c4 10             	add    $0x10,%esp
+     20e:	83 f8 01             	cmp    $0x1,%eax
+     211:	75 0a                	jne    21d <main+0x1fd>
+     213:	0f b7 45 ea          	movzwl -0x16(%ebp),%eax
+     217:	66 83 f8 10          	cmp    $0x10,%ax
+     21b:	74 10                	je     22d <main+0x20d>
+    fail("poll of hung-up pipe");
+     21d:	83 ec 0c             	sub    $0xc,%esp
+     220:	68 f3 10 00 00       	push   $0x10f3
+     225:	e8 d6 fd ff ff       	call   0 <fail>
+     22a:	83 c4 10             	add    $0x10,%esp
+  fds[0].fd = p[1];
+     22d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     230:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  fds[0].events = POLLOUT;
+     233:	66 c7 45 e0 04 00    	movw   $0x4,-0x20(%ebp)
+  fds[1].fd = q[1];
+     239:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     23c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(poll(fds, 2, 0) != 2 || fds[0].revents != POLLOUT || fds[1].revents != POLLNVAL)
+     23f:	83 ec 04             	sub    $0x4,%esp
+     242:	6a 00                	push   $0x0
+     244:	6a 02                	push   $0x2
+     246:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     249:	50                   	push   %eax
+     24a:	e8 1f 05 00 00       	call   76e <poll>
+     24f:	83 c4 10             	add    $0x10,%esp
+     252:	83 f8 02             	cmp    $0x2,%eax
+     255:	75 14                	jne    26b <main+0x24b>
+     257:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     25b:	66 83 f8 04          	cmp    $0x4,%ax
+     25f:	75 0a                	jne    26b <main+0x24b>
+     261:	0f b7 45 ea          	movzwl -0x16(%ebp),%eax
+     265:	66 83 f8 20          	cmp    $0x20,%ax
+     269:	74 10                	je     27b <main+0x25b>
+    fail("poll of write end and closed fd");
+     26b:	83 ec 0c             	sub    $0xc,%esp
+     26e:	68 08 11 00 00       	push   $0x1108
+     273:	e8 88 fd ff ff       	call   0 <fail>
+     278:	83 c4 10             	add    $0x10,%esp
+  close(p[0]);
+     27b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     27e:	83 ec 0c             	sub    $0xc,%esp
+     281:	50                   	push   %eax
+     282:	e8 06 03 00 00       	call   58d <close>
+     287:	83 c4 10             	add    $0x10,%esp
+  if(poll(fds, 1, 0) != 1 || fds[0].revents != (POLLOUT | POLLERR))
+     28a:	83 ec 04             	sub    $0x4,%esp
+     28d:	6a 00                	push   $0x0
+     28f:	6a 01                	push   $0x1
+     291:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     294:	50                   	push   %eax
+     295:	e8 d4 04 00 00       	call   76e <poll>
+     29a:	83 c4 10             	add    $0x10,%esp
+     29d:	83 f8 01             	cmp    $0x1,%eax
+     2a0:	75 0a                	jne    2ac <main+0x28c>
+     2a2:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     2a6:	66 83 f8 0c          	cmp    $0xc,%ax
+     2aa:	74 10                	je     2bc <main+0x29c>
+    fail("poll of write end without reader");
+     2ac:	83 ec 0c             	sub    $0xc,%esp
+     2af:	68 28 11 00 00       	push   $0x1128
+     2b4:	e8 47 fd ff ff       	call   0 <fail>
+     2b9:	83 c4 10             	add    $0x10,%esp
+  printf(1, "poll ok\n");
+     2bc:	83 ec 08             	sub    $0x8,%esp
+     2bf:	68 49 11 00 00       	push   $0x1149
+     2c4:	6a 01                	push   $0x1
+     2c6:	e8 2f 07 00 00       	call   9fa <printf>
+     2cb:	83 c4 10             	add    $0x10,%esp
+  exit();
+     2ce:	e8 97 02 00 00       	call   56a <exit>
+
+000002d3 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     2d3:	55                   	push   %ebp
+     2d4:	89 e5                	mov    %esp,%ebp
+     2d6:	57                   	push   %edi
+     2d7:	53                   	push   %ebx
+    if(cc < 1)
+     2d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2db:	8b 55 10             	mov    0x10(%ebp),%edx
+     2de:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2e1:	89 cb                	mov    %ecx,%ebx
+     2e3:	89 df                	mov    %ebx,%edi
+     2e5:	89 d1                	mov    %edx,%ecx
+     2e7:	fc                   	cld
+     2e8:	f3 aa                	rep stos %al,%es:(%edi)
+     2ea:	89 ca                	mov    %ecx,%edx
+     2ec:	89 fb                	mov    %edi,%ebx
+     2ee:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2f1:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     2f4:	90                   	nop
+     2f5:	5b                   	pop    %ebx
+     2f6:	5f                   	pop    %edi
+     2f7:	5d                   	pop    %ebp
+     2f8:	c3                   	ret
+
+000002f9 <strcpy>:
+{
+     2f9:	55                   	push   %ebp
+     2fa:	89 e5                	mov    %esp,%ebp
+     2fc:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     302:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     305:	90                   	nop
+     306:	8b 55 0c             	mov    0xc(%ebp),%edx
+     309:	8d 42 01             	lea    0x1(%edx),%eax
+     30c:	89 45 0c             	mov    %eax,0xc(%ebp)
+     30f:	8b 45 08             	mov    0x8(%ebp),%eax
+     312:	8d 48 01             	lea    0x1(%eax),%ecx
+     315:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     318:	0f b6 12             	movzbl (%edx),%edx
+     31b:	88 10                	mov    %dl,(%eax)
+     31d:	0f b6 00             	movzbl (%eax),%eax
+     320:	84 c0                	test   %al,%al
+     322:	75 e2                	jne    306 <strcpy+0xd>
+  return os;
+     324:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     327:	c9                   	leave
+     328:	c3                   	ret
+
+00000329 <strcmp>:
+{
+     329:	55                   	push   %ebp
+     32a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     32c:	eb 08                	jmp    336 <strcmp+0xd>
+    p++, q++;
+     32e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     332:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     336:	8b 45 08             	mov    0x8(%ebp),%eax
+     339:	0f b6 00             	movzbl (%eax),%eax
+     33c:	84 c0                	test   %al,%al
+     33e:	74 10                	je     350 <strcmp+0x27>
+     340:	8b 45 08             	mov    0x8(%ebp),%eax
+     343:	0f b6 10             	movzbl (%eax),%edx
+     346:	8b 45 0c             	mov    0xc(%ebp),%eax
+     349:	0f b6 00             	movzbl (%eax),%eax
+     34c:	38 c2                	cmp    %al,%dl
+     34e:	74 de                	je     32e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     350:	8b 45 08             	mov    0x8(%ebp),%eax
+     353:	0f b6 00             	movzbl (%eax),%eax
+     356:	0f b6 d0             	movzbl %al,%edx
+     359:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35c:	0f b6 00             	movzbl (%eax),%eax
+     35f:	0f b6 c0             	movzbl %al,%eax
+     362:	29 c2                	sub    %eax,%edx
+     364:	89 d0                	mov    %edx,%eax
+}
+     366:	5d                   	pop    %ebp
+     367:	c3                   	ret
+
+00000368 <strlen>:
+{
+     368:	55                   	push   %ebp
+     369:	89 e5                	mov    %esp,%ebp
+     36b:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     36e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     375:	eb 04                	jmp    37b <strlen+0x13>
+     377:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     37b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     37e:	8b 45 08             	mov    0x8(%ebp),%eax
+     381:	01 d0                	add    %edx,%eax
+     383:	0f b6 00             	movzbl (%eax),%eax
+     386:	84 c0                	test   %al,%al
+     388:	75 ed                	jne    377 <strlen+0xf>
+  return n;
+     38a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     38d:	c9                   	leave
+     38e:	c3                   	ret
+
+0000038f <memset>:
+{
+     38f:	55                   	push   %ebp
+     390:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     392:	8b 45 10             	mov    0x10(%ebp),%eax
+     395:	50                   	push   %eax
+     396:	ff 75 0c             	push   0xc(%ebp)
+     399:	ff 75 08             	push   0x8(%ebp)
+     39c:	e8 32 ff ff ff       	call   2d3 <stosb>
+     3a1:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     3a4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     3a7:	c9                   	leave
+     3a8:	c3                   	ret
+
+000003a9 <strchr>:
+{
+     3a9:	55                   	push   %ebp
+     3aa:	89 e5                	mov    %esp,%ebp
+     3ac:	83 ec 04             	sub    $0x4,%esp
+     3af:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3b2:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     3b5:	eb 14                	jmp    3cb <strchr+0x22>
+    if(*s == c)
+     3b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ba:	0f b6 00             	movzbl (%eax),%eax
+     3bd:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     3c0:	75 05                	jne    3c7 <strchr+0x1e>
+      return (char*)s;
+     3c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c5:	eb 13                	jmp    3da <strchr+0x31>
+  for(; *s; s++)
+     3c7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     3cb:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ce:	0f b6 00             	movzbl (%eax),%eax
+     3d1:	84 c0                	test   %al,%al
+     3d3:	75 e2                	jne    3b7 <strchr+0xe>
+  return 0;
+     3d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3da:	c9                   	leave
+     3db:	c3                   	ret
+
+000003dc <gets>:
+{
+     3dc:	55                   	push   %ebp
+     3dd:	89 e5                	mov    %esp,%ebp
+     3df:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     3e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3e9:	eb 42                	jmp    42d <gets+0x51>
+    cc = read(0, &c, 1);
+     3eb:	83 ec 04             	sub    $0x4,%esp
+     3ee:	6a 01                	push   $0x1
+     3f0:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     3f3:	50                   	push   %eax
+     3f4:	6a 00                	push   $0x0
+     3f6:	e8 84 01 00 00       	call   57f <read>
+     3fb:	83 c4 10             	add    $0x10,%esp
+     3fe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     401:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     405:	7e 33                	jle    43a <gets+0x5e>
+    buf[i++] = c;
+     407:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     40a:	8d 50 01             	lea    0x1(%eax),%edx
+     40d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     410:	89 c2                	mov    %eax,%edx
+     412:	8b 45 08             	mov    0x8(%ebp),%eax
+     415:	01 c2                	add    %eax,%edx
+     417:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     41b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     41d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     421:	3c 0a                	cmp    $0xa,%al
+     423:	74 16                	je     43b <gets+0x5f>
+     425:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     429:	3c 0d                	cmp    $0xd,%al
+     42b:	74 0e                	je     43b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     42d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     430:	83 c0 01             	add    $0x1,%eax
+     433:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     436:	7f b3                	jg     3eb <gets+0xf>
+     438:	eb 01                	jmp    43b <gets+0x5f>
+      break;
+     43a:	90                   	nop
+  }
+  buf[i] = '\0';
+     43b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     43e:	8b 45 08             	mov    0x8(%ebp),%eax
+     441:	01 d0                	add    %edx,%eax
+     443:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     446:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     449:	c9                   	leave
+     44a:	c3                   	ret
+
+0000044b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     44b:	55                   	push   %ebp
+     44c:	89 e5                	mov    %esp,%ebp
+     44e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     451:	83 ec 08             	sub    $0x8,%esp
+     454:	6a 00                	push   $0x0
+     456:	ff 75 08             	push   0x8(%ebp)
+     459:	e8 44 01 00 00       	call   5a2 <open>
+     45e:	83 c4 10             	add    $0x10,%esp
+     461:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     464:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     468:	79 07                	jns    471 <stat+0x26>
+    return -1;
+     46a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     46f:	eb 25                	jmp    496 <stat+0x4b>
+  r = fstat(fd, st);
+     471:	83 ec 08             	sub    $0x8,%esp
+     474:	ff 75 0c             	push   0xc(%ebp)
+     477:	ff 75 f4             	push   -0xc(%ebp)
+     47a:	e8 41 01 00 00       	call   5c0 <fstat>
+     47f:	83 c4 10             	add    $0x10,%esp
+     482:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     485:	83 ec 0c             	sub    $0xc,%esp
+     488:	ff 75 f4             	push   -0xc(%ebp)
+     48b:	e8 fd 00 00 00       	call   58d <close>
+     490:	83 c4 10             	add    $0x10,%esp
+  return r;
+     493:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     496:	c9                   	leave
+     497:	c3                   	ret
+
+00000498 <atoi>:
+
+int
+atoi(const char *s)
+{
+     498:	55                   	push   %ebp
+     499:	89 e5                	mov    %esp,%ebp
+     49b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     49e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4a5:	eb 25                	jmp    4cc <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4a7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4aa:	89 d0                	mov    %edx,%eax
+     4ac:	c1 e0 02             	shl    $0x2,%eax
+     4af:	01 d0                	add    %edx,%eax
+     4b1:	01 c0                	add    %eax,%eax
+     4b3:	89 c1                	mov    %eax,%ecx
+     4b5:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b8:	8d 50 01             	lea    0x1(%eax),%edx
+     4bb:	89 55 08             	mov    %edx,0x8(%ebp)
+     4be:	0f b6 00             	movzbl (%eax),%eax
+     4c1:	0f be c0             	movsbl %al,%eax
+     4c4:	01 c8                	add    %ecx,%eax
+     4c6:	83 e8 30             	sub    $0x30,%eax
+     4c9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     4cf:	0f b6 00             	movzbl (%eax),%eax
+     4d2:	3c 2f                	cmp    $0x2f,%al
+     4d4:	7e 0a                	jle    4e0 <atoi+0x48>
+     4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d9:	0f b6 00             	movzbl (%eax),%eax
+     4dc:	3c 39                	cmp    $0x39,%al
+     4de:	7e c7                	jle    4a7 <atoi+0xf>
+  return n;
+     4e0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4e3:	c9                   	leave
+     4e4:	c3                   	ret
+
+000004e5 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4e5:	55                   	push   %ebp
+     4e6:	89 e5                	mov    %esp,%ebp
+     4e8:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     4eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     4f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4f4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     4f7:	eb 17                	jmp    510 <memmove+0x2b>
+    *dst++ = *src++;
+     4f9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4fc:	8d 42 01             	lea    0x1(%edx),%eax
+     4ff:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     502:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     505:	8d 48 01             	lea    0x1(%eax),%ecx
+     508:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     50b:	0f b6 12             	movzbl (%edx),%edx
+     50e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     510:	8b 45 10             	mov    0x10(%ebp),%eax
+     513:	8d 50 ff             	lea    -0x1(%eax),%edx
+     516:	89 55 10             	mov    %edx,0x10(%ebp)
+     519:	85 c0                	test   %eax,%eax
+     51b:	7f dc                	jg     4f9 <memmove+0x14>
+  return vdst;
+     51d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     520:	c9                   	leave
+     521:	c3                   	ret
+
+00000522 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     522:	83 3d fc 14 00 00 00 	cmpl   $0x0,0x14fc
+  jg 2f
+     529:	7f 2e                	jg     559 <dosyscall+0x37>
+  jl 1f
+     52b:	7c 29                	jl     556 <dosyscall+0x34>
+  pushl %eax
+     52d:	50                   	push   %eax
+  pushl %ebx
+     52e:	53                   	push   %ebx
+  movl $1, %eax
+     52f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     534:	0f a2                	cpuid
+  popl %ebx
+     536:	5b                   	pop    %ebx
+  popl %eax
+     537:	58                   	pop    %eax
+  movl $-1, sysmode
+     538:	c7 05 fc 14 00 00 ff 	movl   $0xffffffff,0x14fc
+     53f:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     542:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     548:	74 0c                	je     556 <dosyscall+0x34>
+  movl $1, sysmode
+     54a:	c7 05 fc 14 00 00 01 	movl   $0x1,0x14fc
+     551:	00 00 00 
+  jmp 2f
+     554:	eb 03                	jmp    559 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     556:	cd 40                	int    $0x40
+  ret
+     558:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     559:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     55b:	ba 62 05 00 00       	mov    $0x562,%edx
+  sysenter
+     560:	0f 34                	sysenter
+3:
+  ret
+     562:	c3                   	ret
+
+00000563 <fork>:
+
+SYSCALL(fork)
+     563:	b8 01 00 00 00       	mov    $0x1,%eax
+     568:	eb b8                	jmp    522 <dosyscall>
+
+0000056a <exit>:
+SYSCALL(exit)
+     56a:	b8 02 00 00 00       	mov    $0x2,%eax
+     56f:	eb b1                	jmp    522 <dosyscall>
+
+00000571 <wait>:
+SYSCALL(wait)
+     571:	b8 03 00 00 00       	mov    $0x3,%eax
+     576:	eb aa                	jmp    522 <dosyscall>
+
+00000578 <pipe>:
+SYSCALL(pipe)
+     578:	b8 04 00 00 00       	mov    $0x4,%eax
+     57d:	eb a3                	jmp    522 <dosyscall>
+
+0000057f <read>:
+SYSCALL(read)
+     57f:	b8 05 00 00 00       	mov    $0x5,%eax
+     584:	eb 9c                	jmp    522 <dosyscall>
+
+00000586 <write>:
+SYSCALL(write)
+     586:	b8 10 00 00 00       	mov    $0x10,%eax
+     58b:	eb 95                	jmp    522 <dosyscall>
+
+0000058d <close>:
+SYSCALL(close)
+     58d:	b8 15 00 00 00       	mov    $0x15,%eax
+     592:	eb 8e                	jmp    522 <dosyscall>
+
+00000594 <kill>:
+SYSCALL(kill)
+     594:	b8 06 00 00 00       	mov    $0x6,%eax
+     599:	eb 87                	jmp    522 <dosyscall>
+
+0000059b <exec>:
+SYSCALL(exec)
+     59b:	b8 07 00 00 00       	mov    $0x7,%eax
+     5a0:	eb 80                	jmp    522 <dosyscall>
+
+000005a2 <open>:
+SYSCALL(open)
+     5a2:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5a7:	e9 76 ff ff ff       	jmp    522 <dosyscall>
+
+000005ac <mknod>:
+SYSCALL(mknod)
+     5ac:	b8 11 00 00 00       	mov    $0x11,%eax
+     5b1:	e9 6c ff ff ff       	jmp    522 <dosyscall>
+
+000005b6 <unlink>:
+SYSCALL(unlink)
+     5b6:	b8 12 00 00 00       	mov    $0x12,%eax
+     5bb:	e9 62 ff ff ff       	jmp    522 <dosyscall>
+
+000005c0 <fstat>:
+SYSCALL(fstat)
+     5c0:	b8 08 00 00 00       	mov    $0x8,%eax
+     5c5:	e9 58 ff ff ff       	jmp    522 <dosyscall>
+
+000005ca <link>:
+SYSCALL(link)
+     5ca:	b8 13 00 00 00       	mov    $0x13,%eax
+     5cf:	e9 4e ff ff ff       	jmp    522 <dosyscall>
+
+000005d4 <mkdir>:
+SYSCALL(mkdir)
+     5d4:	b8 14 00 00 00       	mov    $0x14,%eax
+     5d9:	e9 44 ff ff ff       	jmp    522 <dosyscall>
+
+000005de <chdir>:
+SYSCALL(chdir)
+     5de:	b8 09 00 00 00       	mov    $0x9,%eax
+     5e3:	e9 3a ff ff ff       	jmp    522 <dosyscall>
+
+000005e8 <dup>:
+SYSCALL(dup)
+     5e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5ed:	e9 30 ff ff ff       	jmp    522 <dosyscall>
+
+000005f2 <getpid>:
+SYSCALL(getpid)
+     5f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5f7:	e9 26 ff ff ff       	jmp    522 <dosyscall>
+
+000005fc <sbrk>:
+SYSCALL(sbrk)
+     5fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+     601:	e9 1c ff ff ff       	jmp    522 <dosyscall>
+
+00000606 <sleep>:
+SYSCALL(sleep)
+     606:	b8 0d 00 00 00       	mov    $0xd,%eax
+     60b:	e9 12 ff ff ff       	jmp    522 <dosyscall>
+
+00000610 <uptime>:
+SYSCALL(uptime)
+     610:	b8 0e 00 00 00       	mov    $0xe,%eax
+     615:	e9 08 ff ff ff       	jmp    522 <dosyscall>
+
+0000061a <symlink>:
+SYSCALL(symlink)
+     61a:	b8 16 00 00 00       	mov    $0x16,%eax
+     61f:	e9 fe fe ff ff       	jmp    522 <dosyscall>
+
+00000624 <readlink>:
+SYSCALL(readlink)
+     624:	b8 17 00 00 00       	mov    $0x17,%eax
+     629:	e9 f4 fe ff ff       	jmp    522 <dosyscall>
+
+0000062e <fprot>:
+SYSCALL(fprot)
+     62e:	b8 18 00 00 00       	mov    $0x18,%eax
+     633:	e9 ea fe ff ff       	jmp    522 <dosyscall>
+
+00000638 <funprot>:
+SYSCALL(funprot)
+     638:	b8 19 00 00 00       	mov    $0x19,%eax
+     63d:	e9 e0 fe ff ff       	jmp    522 <dosyscall>
+
+00000642 <funlock>:
+SYSCALL(funlock)
+     642:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     647:	e9 d6 fe ff ff       	jmp    522 <dosyscall>
+
+0000064c <mmap>:
+SYSCALL(mmap)
+     64c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     651:	e9 cc fe ff ff       	jmp    522 <dosyscall>
+
+00000656 <munmap>:
+SYSCALL(munmap)
+     656:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     65b:	e9 c2 fe ff ff       	jmp    522 <dosyscall>
+
+00000660 <sendfile>:
+SYSCALL(sendfile)
+     660:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     665:	e9 b8 fe ff ff       	jmp    522 <dosyscall>
+
+0000066a <readv>:
+SYSCALL(readv)
+     66a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     66f:	e9 ae fe ff ff       	jmp    522 <dosyscall>
+
+00000674 <writev>:
+SYSCALL(writev)
+     674:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     679:	e9 a4 fe ff ff       	jmp    522 <dosyscall>
+
+0000067e <pread>:
+SYSCALL(pread)
+     67e:	b8 20 00 00 00       	mov    $0x20,%eax
+     683:	e9 9a fe ff ff       	jmp    522 <dosyscall>
+
+00000688 <pwrite>:
+SYSCALL(pwrite)
+     688:	b8 21 00 00 00       	mov    $0x21,%eax
+     68d:	e9 90 fe ff ff       	jmp    522 <dosyscall>
+
+00000692 <lseek>:
+SYSCALL(lseek)
+     692:	b8 22 00 00 00       	mov    $0x22,%eax
+     697:	e9 86 fe ff ff       	jmp    522 <dosyscall>
+
+0000069c <spawn>:
+SYSCALL(spawn)
+     69c:	b8 23 00 00 00       	mov    $0x23,%eax
+     6a1:	e9 7c fe ff ff       	jmp    522 <dosyscall>
+
+000006a6 <setpriority>:
+SYSCALL(setpriority)
+     6a6:	b8 24 00 00 00       	mov    $0x24,%eax
+     6ab:	e9 72 fe ff ff       	jmp    522 <dosyscall>
+
+000006b0 <kthread_create>:
+SYSCALL(kthread_create)
+     6b0:	b8 25 00 00 00       	mov    $0x25,%eax
+     6b5:	e9 68 fe ff ff       	jmp    522 <dosyscall>
+
+000006ba <kthread_id>:
+SYSCALL(kthread_id)
+     6ba:	b8 26 00 00 00       	mov    $0x26,%eax
+     6bf:	e9 5e fe ff ff       	jmp    522 <dosyscall>
+
+000006c4 <kthread_exit>:
+SYSCALL(kthread_exit)
+     6c4:	b8 27 00 00 00       	mov    $0x27,%eax
+     6c9:	e9 54 fe ff ff       	jmp    522 <dosyscall>
+
+000006ce <kthread_join>:
+SYSCALL(kthread_join)
+     6ce:	b8 28 00 00 00       	mov    $0x28,%eax
+     6d3:	e9 4a fe ff ff       	jmp    522 <dosyscall>
+
+000006d8 <futex>:
+SYSCALL(futex)
+     6d8:	b8 29 00 00 00       	mov    $0x29,%eax
+     6dd:	e9 40 fe ff ff       	jmp    522 <dosyscall>
+
+000006e2 <signal>:
+SYSCALL(signal)
+     6e2:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     6e7:	e9 36 fe ff ff       	jmp    522 <dosyscall>
+
+000006ec <alarm>:
+SYSCALL(alarm)
+     6ec:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6f1:	e9 2c fe ff ff       	jmp    522 <dosyscall>
+
+000006f6 <usleep>:
+SYSCALL(usleep)
+     6f6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6fb:	e9 22 fe ff ff       	jmp    522 <dosyscall>
+
+00000700 <ioring_setup>:
+SYSCALL(ioring_setup)
+     700:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     705:	e9 18 fe ff ff       	jmp    522 <dosyscall>
+
+0000070a <ioring_enter>:
+SYSCALL(ioring_enter)
+     70a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     70f:	e9 0e fe ff ff       	jmp    522 <dosyscall>
+
+00000714 <getrusage>:
+SYSCALL(getrusage)
+     714:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     719:	e9 04 fe ff ff       	jmp    522 <dosyscall>
+
+0000071e <mount>:
+SYSCALL(mount)
+     71e:	b8 30 00 00 00       	mov    $0x30,%eax
+     723:	e9 fa fd ff ff       	jmp    522 <dosyscall>
+
+00000728 <getdents>:
+SYSCALL(getdents)
+     728:	b8 31 00 00 00       	mov    $0x31,%eax
+     72d:	e9 f0 fd ff ff       	jmp    522 <dosyscall>
+
+00000732 <yield>:
+SYSCALL(yield)
+     732:	b8 32 00 00 00       	mov    $0x32,%eax
+     737:	e9 e6 fd ff ff       	jmp    522 <dosyscall>
+
+0000073c <ncpu>:
+SYSCALL(ncpu)
+     73c:	b8 33 00 00 00       	mov    $0x33,%eax
+     741:	e9 dc fd ff ff       	jmp    522 <dosyscall>
+
+00000746 <fallocate>:
+SYSCALL(fallocate)
+     746:	b8 34 00 00 00       	mov    $0x34,%eax
+     74b:	e9 d2 fd ff ff       	jmp    522 <dosyscall>
+
+00000750 <ftruncate>:
+SYSCALL(ftruncate)
+     750:	b8 35 00 00 00       	mov    $0x35,%eax
+     755:	e9 c8 fd ff ff       	jmp    522 <dosyscall>
+
+0000075a <fsync>:
+SYSCALL(fsync)
+     75a:	b8 36 00 00 00       	mov    $0x36,%eax
+     75f:	e9 be fd ff ff       	jmp    522 <dosyscall>
+
+00000764 <fdatasync>:
+SYSCALL(fdatasync)
+     764:	b8 37 00 00 00       	mov    $0x37,%eax
+     769:	e9 b4 fd ff ff       	jmp    522 <dosyscall>
+
+0000076e <poll>:
+SYSCALL(poll)
+     76e:	b8 38 00 00 00       	mov    $0x38,%eax
+     773:	e9 aa fd ff ff       	jmp    522 <dosyscall>
+
+00000778 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     778:	55                   	push   %ebp
+     779:	89 e5                	mov    %esp,%ebp
+     77b:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     77e:	8b 45 08             	mov    0x8(%ebp),%eax
+     781:	8b 40 04             	mov    0x4(%eax),%eax
+     784:	85 c0                	test   %eax,%eax
+     786:	7e 1f                	jle    7a7 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     788:	8b 45 08             	mov    0x8(%ebp),%eax
+     78b:	8b 50 04             	mov    0x4(%eax),%edx
+     78e:	8b 45 08             	mov    0x8(%ebp),%eax
+     791:	8d 48 08             	lea    0x8(%eax),%ecx
+     794:	8b 45 08             	mov    0x8(%ebp),%eax
+     797:	8b 00                	mov    (%eax),%eax
+     799:	83 ec 04             	sub    $0x4,%esp
+     79c:	52                   	push   %edx
+     79d:	51                   	push   %ecx
+     79e:	50                   	push   %eax
+     79f:	e8 d0 fe ff ff       	call   674 <writev>
+     7a4:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     7aa:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     7b1:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b4:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     7bb:	00 00 00 
+}
+     7be:	90                   	nop
+     7bf:	c9                   	leave
+     7c0:	c3                   	ret
+
+000007c1 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     7c1:	55                   	push   %ebp
+     7c2:	89 e5                	mov    %esp,%ebp
+     7c4:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     7c7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7cb:	0f 84 94 00 00 00    	je     865 <put+0xa4>
+    return;
+  if(o->n > 0){
+     7d1:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d4:	8b 40 04             	mov    0x4(%eax),%eax
+     7d7:	85 c0                	test   %eax,%eax
+     7d9:	7e 40                	jle    81b <put+0x5a>
+    v = &o->iov[o->n-1];
+     7db:	8b 45 08             	mov    0x8(%ebp),%eax
+     7de:	8b 40 04             	mov    0x4(%eax),%eax
+     7e1:	83 e8 01             	sub    $0x1,%eax
+     7e4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     7eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ee:	01 d0                	add    %edx,%eax
+     7f0:	83 c0 08             	add    $0x8,%eax
+     7f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     7f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f9:	8b 10                	mov    (%eax),%edx
+     7fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7fe:	8b 40 04             	mov    0x4(%eax),%eax
+     801:	01 d0                	add    %edx,%eax
+     803:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     806:	75 13                	jne    81b <put+0x5a>
+      v->iov_len += n;
+     808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     80b:	8b 50 04             	mov    0x4(%eax),%edx
+     80e:	8b 45 10             	mov    0x10(%ebp),%eax
+     811:	01 c2                	add    %eax,%edx
+     813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     816:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     819:	eb 4b                	jmp    866 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     81b:	8b 45 08             	mov    0x8(%ebp),%eax
+     81e:	8b 40 04             	mov    0x4(%eax),%eax
+     821:	83 f8 10             	cmp    $0x10,%eax
+     824:	75 0e                	jne    834 <put+0x73>
+    flush(o);
+     826:	83 ec 0c             	sub    $0xc,%esp
+     829:	ff 75 08             	push   0x8(%ebp)
+     82c:	e8 47 ff ff ff       	call   778 <flush>
+     831:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     834:	8b 45 08             	mov    0x8(%ebp),%eax
+     837:	8b 50 04             	mov    0x4(%eax),%edx
+     83a:	8b 45 08             	mov    0x8(%ebp),%eax
+     83d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     840:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     844:	8b 45 08             	mov    0x8(%ebp),%eax
+     847:	8b 50 04             	mov    0x4(%eax),%edx
+     84a:	8b 45 08             	mov    0x8(%ebp),%eax
+     84d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     850:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     854:	8b 45 08             	mov    0x8(%ebp),%eax
+     857:	8b 40 04             	mov    0x4(%eax),%eax
+     85a:	8d 50 01             	lea    0x1(%eax),%edx
+     85d:	8b 45 08             	mov    0x8(%ebp),%eax
+     860:	89 50 04             	mov    %edx,0x4(%eax)
+     863:	eb 01                	jmp    866 <put+0xa5>
+    return;
+     865:	90                   	nop
+}
+     866:	c9                   	leave
+     867:	c3                   	ret
+
+00000868 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     868:	55                   	push   %ebp
+     869:	89 e5                	mov    %esp,%ebp
+     86b:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     86e:	8b 45 08             	mov    0x8(%ebp),%eax
+     871:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     877:	8b 45 0c             	mov    0xc(%ebp),%eax
+     87a:	01 d0                	add    %edx,%eax
+     87c:	3d 80 00 00 00       	cmp    $0x80,%eax
+     881:	77 0b                	ja     88e <room+0x26>
+     883:	8b 45 08             	mov    0x8(%ebp),%eax
+     886:	8b 40 04             	mov    0x4(%eax),%eax
+     889:	83 f8 10             	cmp    $0x10,%eax
+     88c:	75 0e                	jne    89c <room+0x34>
+    flush(o);
+     88e:	83 ec 0c             	sub    $0xc,%esp
+     891:	ff 75 08             	push   0x8(%ebp)
+     894:	e8 df fe ff ff       	call   778 <flush>
+     899:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     89c:	8b 45 08             	mov    0x8(%ebp),%eax
+     89f:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     8a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8ae:	01 d0                	add    %edx,%eax
+}
+     8b0:	c9                   	leave
+     8b1:	c3                   	ret
+
+000008b2 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     8b2:	55                   	push   %ebp
+     8b3:	89 e5                	mov    %esp,%ebp
+     8b5:	83 ec 28             	sub    $0x28,%esp
+     8b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8bb:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     8be:	83 ec 08             	sub    $0x8,%esp
+     8c1:	6a 01                	push   $0x1
+     8c3:	ff 75 08             	push   0x8(%ebp)
+     8c6:	e8 9d ff ff ff       	call   868 <room>
+     8cb:	83 c4 10             	add    $0x10,%esp
+     8ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     8d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d4:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     8d8:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     8da:	8b 45 08             	mov    0x8(%ebp),%eax
+     8dd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8e3:	8d 50 01             	lea    0x1(%eax),%edx
+     8e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e9:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     8ef:	83 ec 04             	sub    $0x4,%esp
+     8f2:	6a 01                	push   $0x1
+     8f4:	ff 75 f4             	push   -0xc(%ebp)
+     8f7:	ff 75 08             	push   0x8(%ebp)
+     8fa:	e8 c2 fe ff ff       	call   7c1 <put>
+     8ff:	83 c4 10             	add    $0x10,%esp
+}
+     902:	90                   	nop
+     903:	c9                   	leave
+     904:	c3                   	ret
+
+00000905 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     905:	55                   	push   %ebp
+     906:	89 e5                	mov    %esp,%ebp
+     908:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     90b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     912:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     916:	74 17                	je     92f <printint+0x2a>
+     918:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     91c:	79 11                	jns    92f <printint+0x2a>
+    neg = 1;
+     91e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     925:	8b 45 0c             	mov    0xc(%ebp),%eax
+     928:	f7 d8                	neg    %eax
+     92a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     92d:	eb 06                	jmp    935 <printint+0x30>
+  } else {
+    x = xx;
+     92f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     932:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     935:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     93c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     93f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     942:	ba 00 00 00 00       	mov    $0x0,%edx
+     947:	f7 f1                	div    %ecx
+     949:	89 d1                	mov    %edx,%ecx
+     94b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     94e:	8d 50 01             	lea    0x1(%eax),%edx
+     951:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     954:	0f b6 91 00 15 00 00 	movzbl 0x1500(%ecx),%edx
+     95b:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     95f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     962:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     965:	ba 00 00 00 00       	mov    $0x0,%edx
+     96a:	f7 f1                	div    %ecx
+     96c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     96f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     973:	75 c7                	jne    93c <printint+0x37>
+  if(neg)
+     975:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     979:	74 0e                	je     989 <printint+0x84>
+    buf[i++] = '-';
+     97b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97e:	8d 50 01             	lea    0x1(%eax),%edx
+     981:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     984:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     98c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     98f:	83 ec 08             	sub    $0x8,%esp
+     992:	ff 75 e8             	push   -0x18(%ebp)
+     995:	ff 75 08             	push   0x8(%ebp)
+     998:	e8 cb fe ff ff       	call   868 <room>
+     99d:	83 c4 10             	add    $0x10,%esp
+     9a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     9a3:	eb 1d                	jmp    9c2 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     9a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a8:	83 e8 01             	sub    $0x1,%eax
+     9ab:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     9ae:	89 c2                	mov    %eax,%edx
+     9b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9b3:	01 c2                	add    %eax,%edx
+     9b5:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     9b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9bb:	01 c8                	add    %ecx,%eax
+     9bd:	0f b6 00             	movzbl (%eax),%eax
+     9c0:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     9c2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     9c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9ca:	79 d9                	jns    9a5 <printint+0xa0>
+  o->used += n;
+     9cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     9cf:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     9d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9d8:	01 c2                	add    %eax,%edx
+     9da:	8b 45 08             	mov    0x8(%ebp),%eax
+     9dd:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     9e3:	83 ec 04             	sub    $0x4,%esp
+     9e6:	ff 75 e8             	push   -0x18(%ebp)
+     9e9:	ff 75 e4             	push   -0x1c(%ebp)
+     9ec:	ff 75 08             	push   0x8(%ebp)
+     9ef:	e8 cd fd ff ff       	call   7c1 <put>
+     9f4:	83 c4 10             	add    $0x10,%esp
+}
+     9f7:	90                   	nop
+     9f8:	c9                   	leave
+     9f9:	c3                   	ret
+
+000009fa <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9fa:	55                   	push   %ebp
+     9fb:	89 e5                	mov    %esp,%ebp
+     9fd:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     a03:	8b 45 08             	mov    0x8(%ebp),%eax
+     a06:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     a0c:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     a13:	00 00 00 
+  o.used = 0;
+     a16:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     a1d:	00 00 00 
+  state = 0;
+     a20:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a27:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a2a:	83 c0 04             	add    $0x4,%eax
+     a2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     a30:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a37:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a3e:	e9 82 01 00 00       	jmp    bc5 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a43:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a49:	01 d0                	add    %edx,%eax
+     a4b:	0f b6 00             	movzbl (%eax),%eax
+     a4e:	0f be c0             	movsbl %al,%eax
+     a51:	25 ff 00 00 00       	and    $0xff,%eax
+     a56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a59:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a5d:	75 38                	jne    a97 <printf+0x9d>
+      if(c == '%'){
+     a5f:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a63:	0f 85 58 01 00 00    	jne    bc1 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a69:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a6c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a72:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a75:	01 ca                	add    %ecx,%edx
+     a77:	83 ec 04             	sub    $0x4,%esp
+     a7a:	50                   	push   %eax
+     a7b:	52                   	push   %edx
+     a7c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a82:	50                   	push   %eax
+     a83:	e8 39 fd ff ff       	call   7c1 <put>
+     a88:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a8b:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a92:	e9 2a 01 00 00       	jmp    bc1 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a97:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a9b:	0f 85 20 01 00 00    	jne    bc1 <printf+0x1c7>
+      if(c == 'd'){
+     aa1:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     aa5:	75 22                	jne    ac9 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     aa7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aaa:	8b 00                	mov    (%eax),%eax
+     aac:	6a 01                	push   $0x1
+     aae:	6a 0a                	push   $0xa
+     ab0:	50                   	push   %eax
+     ab1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ab7:	50                   	push   %eax
+     ab8:	e8 48 fe ff ff       	call   905 <printint>
+     abd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ac0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     ac4:	e9 e8 00 00 00       	jmp    bb1 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     ac9:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     acd:	74 06                	je     ad5 <printf+0xdb>
+     acf:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     ad3:	75 22                	jne    af7 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     ad5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ad8:	8b 00                	mov    (%eax),%eax
+     ada:	6a 00                	push   $0x0
+     adc:	6a 10                	push   $0x10
+     ade:	50                   	push   %eax
+     adf:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ae5:	50                   	push   %eax
+     ae6:	e8 1a fe ff ff       	call   905 <printint>
+     aeb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     aee:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     af2:	e9 ba 00 00 00       	jmp    bb1 <printf+0x1b7>
+      } else if(c == 's'){
+     af7:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     afb:	75 3f                	jne    b3c <printf+0x142>
+        s = (char*)*ap;
+     afd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b00:	8b 00                	mov    (%eax),%eax
+     b02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     b05:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     b09:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b0d:	75 07                	jne    b16 <printf+0x11c>
+          s = "(null)";
+     b0f:	c7 45 f4 52 11 00 00 	movl   $0x1152,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     b16:	83 ec 0c             	sub    $0xc,%esp
+     b19:	ff 75 f4             	push   -0xc(%ebp)
+     b1c:	e8 47 f8 ff ff       	call   368 <strlen>
+     b21:	83 c4 10             	add    $0x10,%esp
+     b24:	83 ec 04             	sub    $0x4,%esp
+     b27:	50                   	push   %eax
+     b28:	ff 75 f4             	push   -0xc(%ebp)
+     b2b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b31:	50                   	push   %eax
+     b32:	e8 8a fc ff ff       	call   7c1 <put>
+     b37:	83 c4 10             	add    $0x10,%esp
+     b3a:	eb 75                	jmp    bb1 <printf+0x1b7>
+      } else if(c == 'c'){
+     b3c:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b40:	75 21                	jne    b63 <printf+0x169>
+        putc(&o, *ap);
+     b42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b45:	8b 00                	mov    (%eax),%eax
+     b47:	0f be c0             	movsbl %al,%eax
+     b4a:	83 ec 08             	sub    $0x8,%esp
+     b4d:	50                   	push   %eax
+     b4e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b54:	50                   	push   %eax
+     b55:	e8 58 fd ff ff       	call   8b2 <putc>
+     b5a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b5d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b61:	eb 4e                	jmp    bb1 <printf+0x1b7>
+      } else if(c == '%'){
+     b63:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b67:	75 1b                	jne    b84 <printf+0x18a>
+        putc(&o, c);
+     b69:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b6c:	0f be c0             	movsbl %al,%eax
+     b6f:	83 ec 08             	sub    $0x8,%esp
+     b72:	50                   	push   %eax
+     b73:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b79:	50                   	push   %eax
+     b7a:	e8 33 fd ff ff       	call   8b2 <putc>
+     b7f:	83 c4 10             	add    $0x10,%esp
+     b82:	eb 2d                	jmp    bb1 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b84:	83 ec 08             	sub    $0x8,%esp
+     b87:	6a 25                	push   $0x25
+     b89:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b8f:	50                   	push   %eax
+     b90:	e8 1d fd ff ff       	call   8b2 <putc>
+     b95:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b98:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b9b:	0f be c0             	movsbl %al,%eax
+     b9e:	83 ec 08             	sub    $0x8,%esp
+     ba1:	50                   	push   %eax
+     ba2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ba8:	50                   	push   %eax
+     ba9:	e8 04 fd ff ff       	call   8b2 <putc>
+     bae:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     bb1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     bb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bbb:	83 c0 01             	add    $0x1,%eax
+     bbe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bc1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bc8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bcb:	01 d0                	add    %edx,%eax
+     bcd:	0f b6 00             	movzbl (%eax),%eax
+     bd0:	84 c0                	test   %al,%al
+     bd2:	0f 85 6b fe ff ff    	jne    a43 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     bd8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     bdc:	75 22                	jne    c00 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     bde:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     be1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     be4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     be7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     bea:	01 ca                	add    %ecx,%edx
+     bec:	83 ec 04             	sub    $0x4,%esp
+     bef:	50                   	push   %eax
+     bf0:	52                   	push   %edx
+     bf1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bf7:	50                   	push   %eax
+     bf8:	e8 c4 fb ff ff       	call   7c1 <put>
+     bfd:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c09:	50                   	push   %eax
+     c0a:	e8 69 fb ff ff       	call   778 <flush>
+     c0f:	83 c4 10             	add    $0x10,%esp
+}
+     c12:	90                   	nop
+     c13:	c9                   	leave
+     c14:	c3                   	ret
+
+00000c15 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     c15:	55                   	push   %ebp
+     c16:	89 e5                	mov    %esp,%ebp
+     c18:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     c1b:	8b 55 08             	mov    0x8(%ebp),%edx
+     c1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c24:	f0 87 02             	lock xchg %eax,(%edx)
+     c27:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     c2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     c2d:	c9                   	leave
+     c2e:	c3                   	ret
+
+00000c2f <lock>:
+{
+     c2f:	55                   	push   %ebp
+     c30:	89 e5                	mov    %esp,%ebp
+     c32:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     c35:	a1 14 15 00 00       	mov    0x1514,%eax
+     c3a:	85 c0                	test   %eax,%eax
+     c3c:	74 09                	je     c47 <lock+0x18>
+     c3e:	a1 14 15 00 00       	mov    0x1514,%eax
+     c43:	ff d0                	call   *%eax
+     c45:	eb 05                	jmp    c4c <lock+0x1d>
+     c47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c4f:	90                   	nop
+     c50:	83 ec 08             	sub    $0x8,%esp
+     c53:	6a 01                	push   $0x1
+     c55:	68 4c 15 00 00       	push   $0x154c
+     c5a:	e8 b6 ff ff ff       	call   c15 <xchg>
+     c5f:	83 c4 10             	add    $0x10,%esp
+     c62:	85 c0                	test   %eax,%eax
+     c64:	75 ea                	jne    c50 <lock+0x21>
+  return pin;
+     c66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c69:	c9                   	leave
+     c6a:	c3                   	ret
+
+00000c6b <unlock>:
+{
+     c6b:	55                   	push   %ebp
+     c6c:	89 e5                	mov    %esp,%ebp
+     c6e:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c71:	6a 00                	push   $0x0
+     c73:	68 4c 15 00 00       	push   $0x154c
+     c78:	e8 98 ff ff ff       	call   c15 <xchg>
+     c7d:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c80:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c84:	78 10                	js     c96 <unlock+0x2b>
+    mallocunpin(pin);
+     c86:	a1 18 15 00 00       	mov    0x1518,%eax
+     c8b:	83 ec 0c             	sub    $0xc,%esp
+     c8e:	ff 75 08             	push   0x8(%ebp)
+     c91:	ff d0                	call   *%eax
+     c93:	83 c4 10             	add    $0x10,%esp
+}
+     c96:	90                   	nop
+     c97:	c9                   	leave
+     c98:	c3                   	ret
+
+00000c99 <sizeclass>:
+{
+     c99:	55                   	push   %ebp
+     c9a:	89 e5                	mov    %esp,%ebp
+     c9c:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c9f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     ca6:	eb 1c                	jmp    cc4 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     ca8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cab:	ba 02 00 00 00       	mov    $0x2,%edx
+     cb0:	89 c1                	mov    %eax,%ecx
+     cb2:	d3 e2                	shl    %cl,%edx
+     cb4:	89 d0                	mov    %edx,%eax
+     cb6:	3b 45 08             	cmp    0x8(%ebp),%eax
+     cb9:	72 05                	jb     cc0 <sizeclass+0x27>
+      return c;
+     cbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cbe:	eb 0f                	jmp    ccf <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     cc0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     cc4:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     cc8:	7e de                	jle    ca8 <sizeclass+0xf>
+  return -1;
+     cca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     ccf:	c9                   	leave
+     cd0:	c3                   	ret
+
+00000cd1 <bigfree>:
+{
+     cd1:	55                   	push   %ebp
+     cd2:	89 e5                	mov    %esp,%ebp
+     cd4:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cd7:	a1 24 15 00 00       	mov    0x1524,%eax
+     cdc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cdf:	eb 24                	jmp    d05 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ce1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ce4:	8b 00                	mov    (%eax),%eax
+     ce6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ce9:	72 12                	jb     cfd <bigfree+0x2c>
+     ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cee:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cf1:	72 24                	jb     d17 <bigfree+0x46>
+     cf3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cf6:	8b 00                	mov    (%eax),%eax
+     cf8:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cfb:	72 1a                	jb     d17 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cfd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d00:	8b 00                	mov    (%eax),%eax
+     d02:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     d05:	8b 45 08             	mov    0x8(%ebp),%eax
+     d08:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d0b:	73 d4                	jae    ce1 <bigfree+0x10>
+     d0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d10:	8b 00                	mov    (%eax),%eax
+     d12:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d15:	73 ca                	jae    ce1 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     d17:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1a:	8b 40 04             	mov    0x4(%eax),%eax
+     d1d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d24:	8b 45 08             	mov    0x8(%ebp),%eax
+     d27:	01 c2                	add    %eax,%edx
+     d29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d2c:	8b 00                	mov    (%eax),%eax
+     d2e:	39 c2                	cmp    %eax,%edx
+     d30:	75 24                	jne    d56 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     d32:	8b 45 08             	mov    0x8(%ebp),%eax
+     d35:	8b 50 04             	mov    0x4(%eax),%edx
+     d38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d3b:	8b 00                	mov    (%eax),%eax
+     d3d:	8b 40 04             	mov    0x4(%eax),%eax
+     d40:	01 c2                	add    %eax,%edx
+     d42:	8b 45 08             	mov    0x8(%ebp),%eax
+     d45:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d48:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d4b:	8b 00                	mov    (%eax),%eax
+     d4d:	8b 10                	mov    (%eax),%edx
+     d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d52:	89 10                	mov    %edx,(%eax)
+     d54:	eb 0a                	jmp    d60 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d59:	8b 10                	mov    (%eax),%edx
+     d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d63:	8b 40 04             	mov    0x4(%eax),%eax
+     d66:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d70:	01 d0                	add    %edx,%eax
+     d72:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d75:	75 20                	jne    d97 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d7a:	8b 50 04             	mov    0x4(%eax),%edx
+     d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d80:	8b 40 04             	mov    0x4(%eax),%eax
+     d83:	01 c2                	add    %eax,%edx
+     d85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d88:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d8e:	8b 10                	mov    (%eax),%edx
+     d90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d93:	89 10                	mov    %edx,(%eax)
+     d95:	eb 08                	jmp    d9f <bigfree+0xce>
+    p->s.ptr = bp;
+     d97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+     d9d:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     da2:	a3 24 15 00 00       	mov    %eax,0x1524
+}
+     da7:	90                   	nop
+     da8:	c9                   	leave
+     da9:	c3                   	ret
+
+00000daa <free>:
+{
+     daa:	55                   	push   %ebp
+     dab:	89 e5                	mov    %esp,%ebp
+     dad:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     db0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     db4:	74 68                	je     e1e <free+0x74>
+  bp = (Header*)ap - 1;
+     db6:	8b 45 08             	mov    0x8(%ebp),%eax
+     db9:	83 e8 08             	sub    $0x8,%eax
+     dbc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     dbf:	e8 6b fe ff ff       	call   c2f <lock>
+     dc4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     dc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dca:	8b 40 04             	mov    0x4(%eax),%eax
+     dcd:	83 ec 0c             	sub    $0xc,%esp
+     dd0:	50                   	push   %eax
+     dd1:	e8 c3 fe ff ff       	call   c99 <sizeclass>
+     dd6:	83 c4 10             	add    $0x10,%esp
+     dd9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     ddc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     de0:	78 1e                	js     e00 <free+0x56>
+    bp->s.ptr = classfree[c];
+     de2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     de5:	8b 14 85 28 15 00 00 	mov    0x1528(,%eax,4),%edx
+     dec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     def:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     df1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     df4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     df7:	89 14 85 28 15 00 00 	mov    %edx,0x1528(,%eax,4)
+     dfe:	eb 0e                	jmp    e0e <free+0x64>
+    bigfree(bp);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	ff 75 f4             	push   -0xc(%ebp)
+     e06:	e8 c6 fe ff ff       	call   cd1 <bigfree>
+     e0b:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     e0e:	83 ec 0c             	sub    $0xc,%esp
+     e11:	ff 75 f0             	push   -0x10(%ebp)
+     e14:	e8 52 fe ff ff       	call   c6b <unlock>
+     e19:	83 c4 10             	add    $0x10,%esp
+     e1c:	eb 01                	jmp    e1f <free+0x75>
+    return;
+     e1e:	90                   	nop
+}
+     e1f:	c9                   	leave
+     e20:	c3                   	ret
+
+00000e21 <morecore>:
+{
+     e21:	55                   	push   %ebp
+     e22:	89 e5                	mov    %esp,%ebp
+     e24:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     e27:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     e2e:	77 07                	ja     e37 <morecore+0x16>
+    nu = 4096;
+     e30:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     e37:	8b 45 08             	mov    0x8(%ebp),%eax
+     e3a:	c1 e0 03             	shl    $0x3,%eax
+     e3d:	83 ec 0c             	sub    $0xc,%esp
+     e40:	50                   	push   %eax
+     e41:	e8 b6 f7 ff ff       	call   5fc <sbrk>
+     e46:	83 c4 10             	add    $0x10,%esp
+     e49:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e4c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e50:	75 07                	jne    e59 <morecore+0x38>
+    return 0;
+     e52:	b8 00 00 00 00       	mov    $0x0,%eax
+     e57:	eb 22                	jmp    e7b <morecore+0x5a>
+  hp = (Header*)p;
+     e59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e62:	8b 55 08             	mov    0x8(%ebp),%edx
+     e65:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e68:	83 ec 0c             	sub    $0xc,%esp
+     e6b:	ff 75 f0             	push   -0x10(%ebp)
+     e6e:	e8 5e fe ff ff       	call   cd1 <bigfree>
+     e73:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e76:	a1 24 15 00 00       	mov    0x1524,%eax
+}
+     e7b:	c9                   	leave
+     e7c:	c3                   	ret
+
+00000e7d <bigalloc>:
+{
+     e7d:	55                   	push   %ebp
+     e7e:	89 e5                	mov    %esp,%ebp
+     e80:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e83:	a1 24 15 00 00       	mov    0x1524,%eax
+     e88:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e8b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e8f:	75 23                	jne    eb4 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e91:	c7 45 f0 1c 15 00 00 	movl   $0x151c,-0x10(%ebp)
+     e98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e9b:	a3 24 15 00 00       	mov    %eax,0x1524
+     ea0:	a1 24 15 00 00       	mov    0x1524,%eax
+     ea5:	a3 1c 15 00 00       	mov    %eax,0x151c
+    base.s.size = 0;
+     eaa:	c7 05 20 15 00 00 00 	movl   $0x0,0x1520
+     eb1:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eb7:	8b 00                	mov    (%eax),%eax
+     eb9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     ebc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebf:	8b 40 04             	mov    0x4(%eax),%eax
+     ec2:	3b 45 08             	cmp    0x8(%ebp),%eax
+     ec5:	72 4a                	jb     f11 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eca:	8b 40 04             	mov    0x4(%eax),%eax
+     ecd:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ed0:	75 0c                	jne    ede <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     ed2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed5:	8b 10                	mov    (%eax),%edx
+     ed7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eda:	89 10                	mov    %edx,(%eax)
+     edc:	eb 26                	jmp    f04 <bigalloc+0x87>
+        p->s.size -= nunits;
+     ede:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee1:	8b 40 04             	mov    0x4(%eax),%eax
+     ee4:	2b 45 08             	sub    0x8(%ebp),%eax
+     ee7:	89 c2                	mov    %eax,%edx
+     ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eec:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     eef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef2:	8b 40 04             	mov    0x4(%eax),%eax
+     ef5:	c1 e0 03             	shl    $0x3,%eax
+     ef8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     efe:	8b 55 08             	mov    0x8(%ebp),%edx
+     f01:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     f04:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f07:	a3 24 15 00 00       	mov    %eax,0x1524
+      return p;
+     f0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0f:	eb 3b                	jmp    f4c <bigalloc+0xcf>
+    if(p == freep)
+     f11:	a1 24 15 00 00       	mov    0x1524,%eax
+     f16:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     f19:	75 1e                	jne    f39 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     f1b:	83 ec 0c             	sub    $0xc,%esp
+     f1e:	ff 75 08             	push   0x8(%ebp)
+     f21:	e8 fb fe ff ff       	call   e21 <morecore>
+     f26:	83 c4 10             	add    $0x10,%esp
+     f29:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f2c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f30:	75 07                	jne    f39 <bigalloc+0xbc>
+        return 0;
+     f32:	b8 00 00 00 00       	mov    $0x0,%eax
+     f37:	eb 13                	jmp    f4c <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f3c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f42:	8b 00                	mov    (%eax),%eax
+     f44:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f47:	e9 70 ff ff ff       	jmp    ebc <bigalloc+0x3f>
+}
+     f4c:	c9                   	leave
+     f4d:	c3                   	ret
+
+00000f4e <alloc>:
+alloc(uint nbytes)
+{
+     f4e:	55                   	push   %ebp
+     f4f:	89 e5                	mov    %esp,%ebp
+     f51:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f54:	8b 45 08             	mov    0x8(%ebp),%eax
+     f57:	83 c0 07             	add    $0x7,%eax
+     f5a:	c1 e8 03             	shr    $0x3,%eax
+     f5d:	83 c0 01             	add    $0x1,%eax
+     f60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f63:	ff 75 f4             	push   -0xc(%ebp)
+     f66:	e8 2e fd ff ff       	call   c99 <sizeclass>
+     f6b:	83 c4 04             	add    $0x4,%esp
+     f6e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f71:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f75:	79 2c                	jns    fa3 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f77:	83 ec 0c             	sub    $0xc,%esp
+     f7a:	ff 75 f4             	push   -0xc(%ebp)
+     f7d:	e8 fb fe ff ff       	call   e7d <bigalloc>
+     f82:	83 c4 10             	add    $0x10,%esp
+     f85:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f88:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f8c:	75 0a                	jne    f98 <alloc+0x4a>
+      return 0;
+     f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f93:	e9 c8 00 00 00       	jmp    1060 <alloc+0x112>
+    return (void*)(p + 1);
+     f98:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f9b:	83 c0 08             	add    $0x8,%eax
+     f9e:	e9 bd 00 00 00       	jmp    1060 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     fa3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fa6:	8b 04 85 28 15 00 00 	mov    0x1528(,%eax,4),%eax
+     fad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fb0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fb4:	74 1a                	je     fd0 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     fb6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fb9:	8b 10                	mov    (%eax),%edx
+     fbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fbe:	89 14 85 28 15 00 00 	mov    %edx,0x1528(,%eax,4)
+    return (void*)(p + 1);
+     fc5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc8:	83 c0 08             	add    $0x8,%eax
+     fcb:	e9 90 00 00 00       	jmp    1060 <alloc+0x112>
+  }
+  nunits = 2 << c;
+     fd0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fd3:	ba 02 00 00 00       	mov    $0x2,%edx
+     fd8:	89 c1                	mov    %eax,%ecx
+     fda:	d3 e2                	shl    %cl,%edx
+     fdc:	89 d0                	mov    %edx,%eax
+     fde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     fe1:	a1 44 15 00 00       	mov    0x1544,%eax
+     fe6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fe9:	c1 e2 03             	shl    $0x3,%edx
+     fec:	01 d0                	add    %edx,%eax
+     fee:	8b 15 48 15 00 00    	mov    0x1548,%edx
+     ff4:	39 c2                	cmp    %eax,%edx
+     ff6:	73 3f                	jae    1037 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     ff8:	83 ec 0c             	sub    $0xc,%esp
+     ffb:	68 00 08 00 00       	push   $0x800
+    1000:	e8 78 fe ff ff       	call   e7d <bigalloc>
+    1005:	83 c4 10             	add    $0x10,%esp
+    1008:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    100b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    100f:	75 07                	jne    1018 <alloc+0xca>
+      return 0;
+    1011:	b8 00 00 00 00       	mov    $0x0,%eax
+    1016:	eb 48                	jmp    1060 <alloc+0x112>
+    bump = (char*)p;
+    1018:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101b:	a3 44 15 00 00       	mov    %eax,0x1544
+    bumpend = (char*)(p + p->s.size);
+    1020:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1023:	8b 40 04             	mov    0x4(%eax),%eax
+    1026:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    102d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1030:	01 d0                	add    %edx,%eax
+    1032:	a3 48 15 00 00       	mov    %eax,0x1548
+  }
+  p = (Header*)bump;
+    1037:	a1 44 15 00 00       	mov    0x1544,%eax
+    103c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    103f:	a1 44 15 00 00       	mov    0x1544,%eax
+    1044:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1047:	c1 e2 03             	shl    $0x3,%edx
+    104a:	01 d0                	add    %edx,%eax
+    104c:	a3 44 15 00 00       	mov    %eax,0x1544
+  p->s.size = nunits;
+    1051:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1054:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1057:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    105a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    105d:	83 c0 08             	add    $0x8,%eax
+}
+    1060:	c9                   	leave
+    1061:	c3                   	ret
+
+00001062 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1062:	55                   	push   %ebp
+    1063:	89 e5                	mov    %esp,%ebp
+    1065:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1068:	e8 c2 fb ff ff       	call   c2f <lock>
+    106d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	ff 75 08             	push   0x8(%ebp)
+    1076:	e8 d3 fe ff ff       	call   f4e <alloc>
+    107b:	83 c4 10             	add    $0x10,%esp
+    107e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1081:	83 ec 0c             	sub    $0xc,%esp
+    1084:	ff 75 f4             	push   -0xc(%ebp)
+    1087:	e8 df fb ff ff       	call   c6b <unlock>
+    108c:	83 c4 10             	add    $0x10,%esp
+  return p;
+    108f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1092:	c9                   	leave
+    1093:	c3                   	ret
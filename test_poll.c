@@ -0,0 +1,67 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "poll.h"
+
+static void
+fail(char *what)
+{
+  printf(1, "error: %s\n", what);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct pollfd fds[3];
+  int p[2], q[2], t;
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+    fail("pipe");
+  fds[0].fd = p[0];
+  fds[0].events = POLLIN;
+  fds[1].fd = q[0];
+  fds[1].events = POLLIN;
+  fds[2].fd = -1;
+
+  // Nothing to read: a zero timeout returns at once, a short one
+  // after a while.
+  if(poll(fds, 2, 0) != 0 || fds[0].revents || fds[1].revents)
+    fail("poll of empty pipes");
+  t = uptime();
+  if(poll(fds, 3, 50) != 0 || uptime() - t < 4)
+    fail("poll timeout");
+
+  // Only the pipe with data is ready.
+  if(write(q[1], "x", 1) != 1 || poll(fds, 3, -1) != 1 ||
+     fds[0].revents != 0 || fds[1].revents != POLLIN || fds[2].revents != 0)
+    fail("poll of one full pipe");
+  read(q[0], &c, 1);
+
+  // A write from another process wakes a blocked poll.
+  if(fork() == 0){
+    sleep(5);
+    write(p[1], "y", 1);
+    exit();
+  }
+  if(poll(fds, 2, -1) != 1 || fds[0].revents != POLLIN)
+    fail("poll woken by write");
+  read(p[0], &c, 1);
+  wait();
+
+  // Hang-ups, write ends and closed fds.
+  close(q[1]);
+  if(poll(fds, 2, -1) != 1 || fds[1].revents != POLLHUP)
+    fail("poll of hung-up pipe");
+  fds[0].fd = p[1];
+  fds[0].events = POLLOUT;
+  fds[1].fd = q[1];
+  if(poll(fds, 2, 0) != 2 || fds[0].revents != POLLOUT || fds[1].revents != POLLNVAL)
+    fail("poll of write end and closed fd");
+  close(p[0]);
+  if(poll(fds, 1, 0) != 1 || fds[0].revents != (POLLOUT | POLLERR))
+    fail("poll of write end without reader");
+  printf(1, "poll ok\n");
+  exit();
+}
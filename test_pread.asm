@@ -0,0 +1,1994 @@
+
+_test_pread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static char buf[SIZE];
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 14             	sub    $0x14,%esp
+  int fd, i;
+  char c;
+
+  for(i = 0; i < SIZE; i++)
+      11:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      18:	eb 32                	jmp    4c <main+0x4c>
+    buf[i] = 'a' + i % 26;
+      1a:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      1d:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+      22:	89 c8                	mov    %ecx,%eax
+      24:	f7 ea                	imul   %edx
+      26:	89 d0                	mov    %edx,%eax
+      28:	c1 f8 03             	sar    $0x3,%eax
+      2b:	89 ca                	mov    %ecx,%edx
+      2d:	c1 fa 1f             	sar    $0x1f,%edx
+      30:	29 d0                	sub    %edx,%eax
+      32:	6b d0 1a             	imul   $0x1a,%eax,%edx
+      35:	89 c8                	mov    %ecx,%eax
+      37:	29 d0                	sub    %edx,%eax
+      39:	83 c0 61             	add    $0x61,%eax
+      3c:	89 c2                	mov    %eax,%edx
+      3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      41:	05 c0 14 00 00       	add    $0x14c0,%eax
+      46:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+      48:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      4c:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+      53:	7e c5                	jle    1a <main+0x1a>
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, buf, SIZE) != SIZE){
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	68 02 02 00 00       	push   $0x202
+      5d:	68 58 10 00 00       	push   $0x1058
+      62:	e8 fd 04 00 00       	call   564 <open>
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      6d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      71:	78 1f                	js     92 <main+0x92>
+      73:	83 ec 04             	sub    $0x4,%esp
+      76:	68 d0 07 00 00       	push   $0x7d0
+      7b:	68 c0 14 00 00       	push   $0x14c0
+      80:	ff 75 f0             	push   -0x10(%ebp)
+      83:	e8 c0 04 00 00       	call   548 <write>
+      88:	83 c4 10             	add    $0x10,%esp
+      8b:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+      90:	74 1c                	je     ae <main+0xae>
+    printf(1, "error creating file: %s\n", TEST_FILE);
+      92:	83 ec 04             	sub    $0x4,%esp
+      95:	68 58 10 00 00       	push   $0x1058
+      9a:	68 64 10 00 00       	push   $0x1064
+      9f:	6a 01                	push   $0x1
+      a1:	e8 16 09 00 00       	call   9bc <printf>
+      a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a9:	e8 7e 04 00 00       	call   52c <exit>
+  }
+
+  // pread and pwrite leave the offset alone.
+  if(pread(fd, &c, 1, 1000) != 1 || c != buf[1000]){
+      ae:	68 e8 03 00 00       	push   $0x3e8
+      b3:	6a 01                	push   $0x1
+      b5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+      b8:	50                   	push   %eax
+      b9:	ff 75 f0             	push   -0x10(%ebp)
+      bc:	e8 7f 05 00 00       	call   640 <pread>
+      c1:	83 c4 10             	add    $0x10,%esp
+      c4:	83 f8 01             	cmp    $0x1,%eax
+      c7:	75 0f                	jne    d8 <main+0xd8>
+      c9:	0f b6 15 a8 18 00 00 	movzbl 0x18a8,%edx
+      d0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+      d4:	38 c2                	cmp    %al,%dl
+      d6:	74 17                	je     ef <main+0xef>
+    printf(1, "error: pread\n");
+      d8:	83 ec 08             	sub    $0x8,%esp
+      db:	68 7d 10 00 00       	push   $0x107d
+      e0:	6a 01                	push   $0x1
+      e2:	e8 d5 08 00 00       	call   9bc <printf>
+      e7:	83 c4 10             	add    $0x10,%esp
+    exit();
+      ea:	e8 3d 04 00 00       	call   52c <exit>
+  }
+  if(pwrite(fd, "Z", 1, 5) != 1 || pread(fd, &c, 1, 5) != 1 || c != 'Z'){
+      ef:	6a 05                	push   $0x5
+      f1:	6a 01                	push   $0x1
+      f3:	68 8b 10 00 00       	push   $0x108b
+      f8:	ff 75 f0             	push   -0x10(%ebp)
+      fb:	e8 4a 05 00 00       	call   64a <pwrite>
+     100:	83 c4 10             	add    $0x10,%esp
+     103:	83 f8 01             	cmp    $0x1,%eax
+     106:	75 20                	jne    128 <main+0x128>
+     108:	6a 05                	push   $0x5
+     10a:	6a 01                	push   $0x1
+     10c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     10f:	50                   	push   %eax
+     110:	ff 75 f0             	push   -0x10(%ebp)
+     113:	e8 28 05 00 00       	call   640 <pread>
+     118:	83 c4 10             	add    $0x10,%esp
+     11b:	83 f8 01             	cmp    $0x1,%eax
+     11e:	75 08                	jne    128 <main+0x128>
+     120:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     124:	3c 5a                	cmp    $0x5a,%al
+     126:	74 17                	je     13f <main+0x13f>
+    printf(1, "error: pwrite\n");
+     128:	83 ec 08             	sub    $0x8,%esp
+     12b:	68 8d 10 00 00       	push   $0x108d
+     130:	6a 01                	push   $0x1
+     132:	e8 85 08 00 00       	call   9bc <printf>
+     137:	83 c4 10             	add    $0x10,%esp
+    exit();
+     13a:	e8 ed 03 00 00       	call   52c <exit>
+  }
+  if(lseek(fd, 0, SEEK_CUR) != SIZE){
+     13f:	83 ec 04             	sub    $0x4,%esp
+     142:	6a 01                	push   $0x1
+     144:	6a 00                	push   $0x0
+     146:	ff 75 f0             	push   -0x10(%ebp)
+     149:	e8 06 05 00 00       	call   654 <lseek>
+     14e:	83 c4 10             	add    $0x10,%esp
+     151:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     156:	74 17                	je     16f <main+0x16f>
+    printf(1, "error: offset moved\n");
+     158:	83 ec 08             	sub    $0x8,%esp
+     15b:	68 9c 10 00 00       	push   $0x109c
+     160:	6a 01                	push   $0x1
+     162:	e8 55 08 00 00       	call   9bc <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+    exit();
+     16a:	e8 bd 03 00 00       	call   52c <exit>
+  }
+  printf(1, "pread ok\n");
+     16f:	83 ec 08             	sub    $0x8,%esp
+     172:	68 b1 10 00 00       	push   $0x10b1
+     177:	6a 01                	push   $0x1
+     179:	e8 3e 08 00 00       	call   9bc <printf>
+     17e:	83 c4 10             	add    $0x10,%esp
+
+  if(lseek(fd, 10, SEEK_SET) != 10 || read(fd, &c, 1) != 1 || c != buf[10]){
+     181:	83 ec 04             	sub    $0x4,%esp
+     184:	6a 00                	push   $0x0
+     186:	6a 0a                	push   $0xa
+     188:	ff 75 f0             	push   -0x10(%ebp)
+     18b:	e8 c4 04 00 00       	call   654 <lseek>
+     190:	83 c4 10             	add    $0x10,%esp
+     193:	83 f8 0a             	cmp    $0xa,%eax
+     196:	75 28                	jne    1c0 <main+0x1c0>
+     198:	83 ec 04             	sub    $0x4,%esp
+     19b:	6a 01                	push   $0x1
+     19d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     1a0:	50                   	push   %eax
+     1a1:	ff 75 f0             	push   -0x10(%ebp)
+     1a4:	e8 98 03 00 00       	call   541 <read>
+     1a9:	83 c4 10             	add    $0x10,%esp
+     1ac:	83 f8 01             	cmp    $0x1,%eax
+     1af:	75 0f                	jne    1c0 <main+0x1c0>
+     1b1:	0f b6 15 ca 14 00 00 	movzbl 0x14ca,%edx
+     1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     1bc:	38 c2                	cmp    %al,%dl
+     1be:	74 17                	je     1d7 <main+0x1d7>
+    printf(1, "error: SEEK_SET\n");
+     1c0:	83 ec 08             	sub    $0x8,%esp
+     1c3:	68 bb 10 00 00       	push   $0x10bb
+     1c8:	6a 01                	push   $0x1
+     1ca:	e8 ed 07 00 00       	call   9bc <printf>
+     1cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1d2:	e8 55 03 00 00       	call   52c <exit>
+  }
+  if(lseek(fd, -1, SEEK_END) != SIZE-1 || read(fd, &c, 1) != 1 || c != buf[SIZE-1]){
+     1d7:	83 ec 04             	sub    $0x4,%esp
+     1da:	6a 02                	push   $0x2
+     1dc:	6a ff                	push   $0xffffffff
+     1de:	ff 75 f0             	push   -0x10(%ebp)
+     1e1:	e8 6e 04 00 00       	call   654 <lseek>
+     1e6:	83 c4 10             	add    $0x10,%esp
+     1e9:	3d cf 07 00 00       	cmp    $0x7cf,%eax
+     1ee:	75 28                	jne    218 <main+0x218>
+     1f0:	83 ec 04             	sub    $0x4,%esp
+     1f3:	6a 01                	push   $0x1
+     1f5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     1f8:	50                   	push   %eax
+     1f9:	ff 75 f0             	push   -0x10(%ebp)
+     1fc:	e8 40 03 00 00       	call   541 <read>
+     201:	83 c4 10             	add    $0x10,%esp
+     204:	83 f8 01             	cmp    $0x1,%eax
+     207:	75 0f                	jne    218 <main+0x218>
+     209:	0f b6 15 8f 1c 00 00 	movzbl 0x1c8f,%edx
+     210:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     214:	38 c2                	cmp    %al,%dl
+     216:	74 17                	je     22f <main+0x22f>
+    printf(1, "error: SEEK_END\n");
+     218:	83 ec 08             	sub    $0x8,%esp
+     21b:	68 cc 10 00 00       	push   $0x10cc
+     220:	6a 01                	push   $0x1
+     222:	e8 95 07 00 00       	call   9bc <printf>
+     227:	83 c4 10             	add    $0x10,%esp
+    exit();
+     22a:	e8 fd 02 00 00       	call   52c <exit>
+  }
+  if(lseek(fd, -SIZE-1, SEEK_CUR) != -1){
+     22f:	83 ec 04             	sub    $0x4,%esp
+     232:	6a 01                	push   $0x1
+     234:	68 2f f8 ff ff       	push   $0xfffff82f
+     239:	ff 75 f0             	push   -0x10(%ebp)
+     23c:	e8 13 04 00 00       	call   654 <lseek>
+     241:	83 c4 10             	add    $0x10,%esp
+     244:	83 f8 ff             	cmp    $0xffffffff,%eax
+     247:	74 17                	je     260 <main+0x260>
+    printf(1, "error: negative offset accepted\n");
+     249:	83 ec 08             	sub    $0x8,%esp
+     24c:	68 e0 10 00 00       	push   $0x10e0
+     251:	6a 01                	push   $0x1
+     253:	e8 64 07 00 00       	call   9bc <printf>
+     258:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25b:	e8 cc 02 00 00       	call   52c <exit>
+  }
+  close(fd);
+     260:	83 ec 0c             	sub    $0xc,%esp
+     263:	ff 75 f0             	push   -0x10(%ebp)
+     266:	e8 e4 02 00 00       	call   54f <close>
+     26b:	83 c4 10             	add    $0x10,%esp
+  unlink(TEST_FILE);
+     26e:	83 ec 0c             	sub    $0xc,%esp
+     271:	68 58 10 00 00       	push   $0x1058
+     276:	e8 fd 02 00 00       	call   578 <unlink>
+     27b:	83 c4 10             	add    $0x10,%esp
+  printf(1, "lseek ok\n");
+     27e:	83 ec 08             	sub    $0x8,%esp
+     281:	68 01 11 00 00       	push   $0x1101
+     286:	6a 01                	push   $0x1
+     288:	e8 2f 07 00 00       	call   9bc <printf>
+     28d:	83 c4 10             	add    $0x10,%esp
+  exit();
+     290:	e8 97 02 00 00       	call   52c <exit>
+
+00000295 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     295:	55                   	push   %ebp
+     296:	89 e5                	mov    %esp,%ebp
+     298:	57                   	push   %edi
+     299:	53                   	push   %ebx
+    if(cc < 1)
+     29a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     29d:	8b 55 10             	mov    0x10(%ebp),%edx
+     2a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a3:	89 cb                	mov    %ecx,%ebx
+     2a5:	89 df                	mov    %ebx,%edi
+     2a7:	89 d1                	mov    %edx,%ecx
+     2a9:	fc                   	cld
+     2aa:	f3 aa                	rep stos %al,%es:(%edi)
+     2ac:	89 ca                	mov    %ecx,%edx
+     2ae:	89 fb                	mov    %edi,%ebx
+     2b0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2b3:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     2b6:	90                   	nop
+     2b7:	5b                   	pop    %ebx
+     2b8:	5f                   	pop    %edi
+     2b9:	5d                   	pop    %ebp
+     2ba:	c3                   	ret
+
+000002bb <strcpy>:
+{
+     2bb:	55                   	push   %ebp
+     2bc:	89 e5                	mov    %esp,%ebp
+     2be:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2c7:	90                   	nop
+     2c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2cb:	8d 42 01             	lea    0x1(%edx),%eax
+     2ce:	89 45 0c             	mov    %eax,0xc(%ebp)
+     2d1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d4:	8d 48 01             	lea    0x1(%eax),%ecx
+     2d7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     2da:	0f b6 12             	movzbl (%edx),%edx
+     2dd:	88 10                	mov    %dl,(%eax)
+     2df:	0f b6 00             	movzbl (%eax),%eax
+     2e2:	84 c0                	test   %al,%al
+     2e4:	75 e2                	jne    2c8 <strcpy+0xd>
+  return os;
+     2e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2e9:	c9                   	leave
+     2ea:	c3                   	ret
+
+000002eb <strcmp>:
+{
+     2eb:	55                   	push   %ebp
+     2ec:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     2ee:	eb 08                	jmp    2f8 <strcmp+0xd>
+    p++, q++;
+     2f0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     2f4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     2f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     2fb:	0f b6 00             	movzbl (%eax),%eax
+     2fe:	84 c0                	test   %al,%al
+     300:	74 10                	je     312 <strcmp+0x27>
+     302:	8b 45 08             	mov    0x8(%ebp),%eax
+     305:	0f b6 10             	movzbl (%eax),%edx
+     308:	8b 45 0c             	mov    0xc(%ebp),%eax
+     30b:	0f b6 00             	movzbl (%eax),%eax
+     30e:	38 c2                	cmp    %al,%dl
+     310:	74 de                	je     2f0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     312:	8b 45 08             	mov    0x8(%ebp),%eax
+     315:	0f b6 00             	movzbl (%eax),%eax
+     318:	0f b6 d0             	movzbl %al,%edx
+     31b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     31e:	0f b6 00             	movzbl (%eax),%eax
+     321:	0f b6 c0             	movzbl %al,%eax
+     324:	29 c2                	sub    %eax,%edx
+     326:	89 d0                	mov    %edx,%eax
+}
+     328:	5d                   	pop    %ebp
+     329:	c3                   	ret
+
+0000032a <strlen>:
+{
+     32a:	55                   	push   %ebp
+     32b:	89 e5                	mov    %esp,%ebp
+     32d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     330:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     337:	eb 04                	jmp    33d <strlen+0x13>
+     339:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     33d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     340:	8b 45 08             	mov    0x8(%ebp),%eax
+     343:	01 d0                	add    %edx,%eax
+     345:	0f b6 00             	movzbl (%eax),%eax
+     348:	84 c0                	test   %al,%al
+     34a:	75 ed                	jne    339 <strlen+0xf>
+  return n;
+     34c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     34f:	c9                   	leave
+     350:	c3                   	ret
+
+00000351 <memset>:
+{
+     351:	55                   	push   %ebp
+     352:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     354:	8b 45 10             	mov    0x10(%ebp),%eax
+     357:	50                   	push   %eax
+     358:	ff 75 0c             	push   0xc(%ebp)
+     35b:	ff 75 08             	push   0x8(%ebp)
+     35e:	e8 32 ff ff ff       	call   295 <stosb>
+     363:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     366:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     369:	c9                   	leave
+     36a:	c3                   	ret
+
+0000036b <strchr>:
+{
+     36b:	55                   	push   %ebp
+     36c:	89 e5                	mov    %esp,%ebp
+     36e:	83 ec 04             	sub    $0x4,%esp
+     371:	8b 45 0c             	mov    0xc(%ebp),%eax
+     374:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     377:	eb 14                	jmp    38d <strchr+0x22>
+    if(*s == c)
+     379:	8b 45 08             	mov    0x8(%ebp),%eax
+     37c:	0f b6 00             	movzbl (%eax),%eax
+     37f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     382:	75 05                	jne    389 <strchr+0x1e>
+      return (char*)s;
+     384:	8b 45 08             	mov    0x8(%ebp),%eax
+     387:	eb 13                	jmp    39c <strchr+0x31>
+  for(; *s; s++)
+     389:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+     390:	0f b6 00             	movzbl (%eax),%eax
+     393:	84 c0                	test   %al,%al
+     395:	75 e2                	jne    379 <strchr+0xe>
+  return 0;
+     397:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     39c:	c9                   	leave
+     39d:	c3                   	ret
+
+0000039e <gets>:
+{
+     39e:	55                   	push   %ebp
+     39f:	89 e5                	mov    %esp,%ebp
+     3a1:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     3a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3ab:	eb 42                	jmp    3ef <gets+0x51>
+    cc = read(0, &c, 1);
+     3ad:	83 ec 04             	sub    $0x4,%esp
+     3b0:	6a 01                	push   $0x1
+     3b2:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     3b5:	50                   	push   %eax
+     3b6:	6a 00                	push   $0x0
+     3b8:	e8 84 01 00 00       	call   541 <read>
+     3bd:	83 c4 10             	add    $0x10,%esp
+     3c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     3c3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3c7:	7e 33                	jle    3fc <gets+0x5e>
+    buf[i++] = c;
+     3c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3cc:	8d 50 01             	lea    0x1(%eax),%edx
+     3cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     3d2:	89 c2                	mov    %eax,%edx
+     3d4:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d7:	01 c2                	add    %eax,%edx
+     3d9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3dd:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     3df:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3e3:	3c 0a                	cmp    $0xa,%al
+     3e5:	74 16                	je     3fd <gets+0x5f>
+     3e7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3eb:	3c 0d                	cmp    $0xd,%al
+     3ed:	74 0e                	je     3fd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     3ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3f2:	83 c0 01             	add    $0x1,%eax
+     3f5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     3f8:	7f b3                	jg     3ad <gets+0xf>
+     3fa:	eb 01                	jmp    3fd <gets+0x5f>
+      break;
+     3fc:	90                   	nop
+  }
+  buf[i] = '\0';
+     3fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     400:	8b 45 08             	mov    0x8(%ebp),%eax
+     403:	01 d0                	add    %edx,%eax
+     405:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     408:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     40b:	c9                   	leave
+     40c:	c3                   	ret
+
+0000040d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     40d:	55                   	push   %ebp
+     40e:	89 e5                	mov    %esp,%ebp
+     410:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     413:	83 ec 08             	sub    $0x8,%esp
+     416:	6a 00                	push   $0x0
+     418:	ff 75 08             	push   0x8(%ebp)
+     41b:	e8 44 01 00 00       	call   564 <open>
+     420:	83 c4 10             	add    $0x10,%esp
+     423:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     426:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     42a:	79 07                	jns    433 <stat+0x26>
+    return -1;
+     42c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     431:	eb 25                	jmp    458 <stat+0x4b>
+  r = fstat(fd, st);
+     433:	83 ec 08             	sub    $0x8,%esp
+     436:	ff 75 0c             	push   0xc(%ebp)
+     439:	ff 75 f4             	push   -0xc(%ebp)
+     43c:	e8 41 01 00 00       	call   582 <fstat>
+     441:	83 c4 10             	add    $0x10,%esp
+     444:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     447:	83 ec 0c             	sub    $0xc,%esp
+     44a:	ff 75 f4             	push   -0xc(%ebp)
+     44d:	e8 fd 00 00 00       	call   54f <close>
+     452:	83 c4 10             	add    $0x10,%esp
+  return r;
+     455:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     458:	c9                   	leave
+     459:	c3                   	ret
+
+0000045a <atoi>:
+
+int
+atoi(const char *s)
+{
+     45a:	55                   	push   %ebp
+     45b:	89 e5                	mov    %esp,%ebp
+     45d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     460:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     467:	eb 25                	jmp    48e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     469:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     46c:	89 d0                	mov    %edx,%eax
+     46e:	c1 e0 02             	shl    $0x2,%eax
+     471:	01 d0                	add    %edx,%eax
+     473:	01 c0                	add    %eax,%eax
+     475:	89 c1                	mov    %eax,%ecx
+     477:	8b 45 08             	mov    0x8(%ebp),%eax
+     47a:	8d 50 01             	lea    0x1(%eax),%edx
+     47d:	89 55 08             	mov    %edx,0x8(%ebp)
+     480:	0f b6 00             	movzbl (%eax),%eax
+     483:	0f be c0             	movsbl %al,%eax
+     486:	01 c8                	add    %ecx,%eax
+     488:	83 e8 30             	sub    $0x30,%eax
+     48b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     48e:	8b 45 08             	mov    0x8(%ebp),%eax
+     491:	0f b6 00             	movzbl (%eax),%eax
+     494:	3c 2f                	cmp    $0x2f,%al
+     496:	7e 0a                	jle    4a2 <atoi+0x48>
+     498:	8b 45 08             	mov    0x8(%ebp),%eax
+     49b:	0f b6 00             	movzbl (%eax),%eax
+     49e:	3c 39                	cmp    $0x39,%al
+     4a0:	7e c7                	jle    469 <atoi+0xf>
+  return n;
+     4a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4a5:	c9                   	leave
+     4a6:	c3                   	ret
+
+000004a7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4a7:	55                   	push   %ebp
+     4a8:	89 e5                	mov    %esp,%ebp
+     4aa:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     4b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4b6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     4b9:	eb 17                	jmp    4d2 <memmove+0x2b>
+    *dst++ = *src++;
+     4bb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4be:	8d 42 01             	lea    0x1(%edx),%eax
+     4c1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4c7:	8d 48 01             	lea    0x1(%eax),%ecx
+     4ca:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     4cd:	0f b6 12             	movzbl (%edx),%edx
+     4d0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     4d2:	8b 45 10             	mov    0x10(%ebp),%eax
+     4d5:	8d 50 ff             	lea    -0x1(%eax),%edx
+     4d8:	89 55 10             	mov    %edx,0x10(%ebp)
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	7f dc                	jg     4bb <memmove+0x14>
+  return vdst;
+     4df:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4e2:	c9                   	leave
+     4e3:	c3                   	ret
+
+000004e4 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     4e4:	83 3d 98 14 00 00 00 	cmpl   $0x0,0x1498
+  jg 2f
+     4eb:	7f 2e                	jg     51b <dosyscall+0x37>
+  jl 1f
+     4ed:	7c 29                	jl     518 <dosyscall+0x34>
+  pushl %eax
+     4ef:	50                   	push   %eax
+  pushl %ebx
+     4f0:	53                   	push   %ebx
+  movl $1, %eax
+     4f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     4f6:	0f a2                	cpuid
+  popl %ebx
+     4f8:	5b                   	pop    %ebx
+  popl %eax
+     4f9:	58                   	pop    %eax
+  movl $-1, sysmode
+     4fa:	c7 05 98 14 00 00 ff 	movl   $0xffffffff,0x1498
+     501:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     504:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     50a:	74 0c                	je     518 <dosyscall+0x34>
+  movl $1, sysmode
+     50c:	c7 05 98 14 00 00 01 	movl   $0x1,0x1498
+     513:	00 00 00 
+  jmp 2f
+     516:	eb 03                	jmp    51b <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     518:	cd 40                	int    $0x40
+  ret
+     51a:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     51b:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     51d:	ba 24 05 00 00       	mov    $0x524,%edx
+  sysenter
+     522:	0f 34                	sysenter
+3:
+  ret
+     524:	c3                   	ret
+
+00000525 <fork>:
+
+SYSCALL(fork)
+     525:	b8 01 00 00 00       	mov    $0x1,%eax
+     52a:	eb b8                	jmp    4e4 <dosyscall>
+
+0000052c <exit>:
+SYSCALL(exit)
+     52c:	b8 02 00 00 00       	mov    $0x2,%eax
+     531:	eb b1                	jmp    4e4 <dosyscall>
+
+00000533 <wait>:
+SYSCALL(wait)
+     533:	b8 03 00 00 00       	mov    $0x3,%eax
+     538:	eb aa                	jmp    4e4 <dosyscall>
+
+0000053a <pipe>:
+SYSCALL(pipe)
+     53a:	b8 04 00 00 00       	mov    $0x4,%eax
+     53f:	eb a3                	jmp    4e4 <dosyscall>
+
+00000541 <read>:
+SYSCALL(read)
+     541:	b8 05 00 00 00       	mov    $0x5,%eax
+     546:	eb 9c                	jmp    4e4 <dosyscall>
+
+00000548 <write>:
+SYSCALL(write)
+     548:	b8 10 00 00 00       	mov    $0x10,%eax
+     54d:	eb 95                	jmp    4e4 <dosyscall>
+
+0000054f <close>:
+SYSCALL(close)
+     54f:	b8 15 00 00 00       	mov    $0x15,%eax
+     554:	eb 8e                	jmp    4e4 <dosyscall>
+
+00000556 <kill>:
+SYSCALL(kill)
+     556:	b8 06 00 00 00       	mov    $0x6,%eax
+     55b:	eb 87                	jmp    4e4 <dosyscall>
+
+0000055d <exec>:
+SYSCALL(exec)
+     55d:	b8 07 00 00 00       	mov    $0x7,%eax
+     562:	eb 80                	jmp    4e4 <dosyscall>
+
+00000564 <open>:
+SYSCALL(open)
+     564:	b8 0f 00 00 00       	mov    $0xf,%eax
+     569:	e9 76 ff ff ff       	jmp    4e4 <dosyscall>
+
+0000056e <mknod>:
+SYSCALL(mknod)
+     56e:	b8 11 00 00 00       	mov    $0x11,%eax
+     573:	e9 6c ff ff ff       	jmp    4e4 <dosyscall>
+
+00000578 <unlink>:
+SYSCALL(unlink)
+     578:	b8 12 00 00 00       	mov    $0x12,%eax
+     57d:	e9 62 ff ff ff       	jmp    4e4 <dosyscall>
+
+00000582 <fstat>:
+SYSCALL(fstat)
+     582:	b8 08 00 00 00       	mov    $0x8,%eax
+     587:	e9 58 ff ff ff       	jmp    4e4 <dosyscall>
+
+0000058c <link>:
+SYSCALL(link)
+     58c:	b8 13 00 00 00       	mov    $0x13,%eax
+     591:	e9 4e ff ff ff       	jmp    4e4 <dosyscall>
+
+00000596 <mkdir>:
+SYSCALL(mkdir)
+     596:	b8 14 00 00 00       	mov    $0x14,%eax
+     59b:	e9 44 ff ff ff       	jmp    4e4 <dosyscall>
+
+000005a0 <chdir>:
+SYSCALL(chdir)
+     5a0:	b8 09 00 00 00       	mov    $0x9,%eax
+     5a5:	e9 3a ff ff ff       	jmp    4e4 <dosyscall>
+
+000005aa <dup>:
+SYSCALL(dup)
+     5aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5af:	e9 30 ff ff ff       	jmp    4e4 <dosyscall>
+
+000005b4 <getpid>:
+SYSCALL(getpid)
+     5b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5b9:	e9 26 ff ff ff       	jmp    4e4 <dosyscall>
+
+000005be <sbrk>:
+SYSCALL(sbrk)
+     5be:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5c3:	e9 1c ff ff ff       	jmp    4e4 <dosyscall>
+
+000005c8 <sleep>:
+SYSCALL(sleep)
+     5c8:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5cd:	e9 12 ff ff ff       	jmp    4e4 <dosyscall>
+
+000005d2 <uptime>:
+SYSCALL(uptime)
+     5d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5d7:	e9 08 ff ff ff       	jmp    4e4 <dosyscall>
+
+000005dc <symlink>:
+SYSCALL(symlink)
+     5dc:	b8 16 00 00 00       	mov    $0x16,%eax
+     5e1:	e9 fe fe ff ff       	jmp    4e4 <dosyscall>
+
+000005e6 <readlink>:
+SYSCALL(readlink)
+     5e6:	b8 17 00 00 00       	mov    $0x17,%eax
+     5eb:	e9 f4 fe ff ff       	jmp    4e4 <dosyscall>
+
+000005f0 <fprot>:
+SYSCALL(fprot)
+     5f0:	b8 18 00 00 00       	mov    $0x18,%eax
+     5f5:	e9 ea fe ff ff       	jmp    4e4 <dosyscall>
+
+000005fa <funprot>:
+SYSCALL(funprot)
+     5fa:	b8 19 00 00 00       	mov    $0x19,%eax
+     5ff:	e9 e0 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000604 <funlock>:
+SYSCALL(funlock)
+     604:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     609:	e9 d6 fe ff ff       	jmp    4e4 <dosyscall>
+
+0000060e <mmap>:
+SYSCALL(mmap)
+     60e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     613:	e9 cc fe ff ff       	jmp    4e4 <dosyscall>
+
+00000618 <munmap>:
+SYSCALL(munmap)
+     618:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     61d:	e9 c2 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000622 <sendfile>:
+SYSCALL(sendfile)
+     622:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     627:	e9 b8 fe ff ff       	jmp    4e4 <dosyscall>
+
+0000062c <readv>:
+SYSCALL(readv)
+     62c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     631:	e9 ae fe ff ff       	jmp    4e4 <dosyscall>
+
+00000636 <writev>:
+SYSCALL(writev)
+     636:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     63b:	e9 a4 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000640 <pread>:
+SYSCALL(pread)
+     640:	b8 20 00 00 00       	mov    $0x20,%eax
+     645:	e9 9a fe ff ff       	jmp    4e4 <dosyscall>
+
+0000064a <pwrite>:
+SYSCALL(pwrite)
+     64a:	b8 21 00 00 00       	mov    $0x21,%eax
+     64f:	e9 90 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000654 <lseek>:
+SYSCALL(lseek)
+     654:	b8 22 00 00 00       	mov    $0x22,%eax
+     659:	e9 86 fe ff ff       	jmp    4e4 <dosyscall>
+
+0000065e <spawn>:
+SYSCALL(spawn)
+     65e:	b8 23 00 00 00       	mov    $0x23,%eax
+     663:	e9 7c fe ff ff       	jmp    4e4 <dosyscall>
+
+00000668 <setpriority>:
+SYSCALL(setpriority)
+     668:	b8 24 00 00 00       	mov    $0x24,%eax
+     66d:	e9 72 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000672 <kthread_create>:
+SYSCALL(kthread_create)
+     672:	b8 25 00 00 00       	mov    $0x25,%eax
+     677:	e9 68 fe ff ff       	jmp    4e4 <dosyscall>
+
+0000067c <kthread_id>:
+SYSCALL(kthread_id)
+     67c:	b8 26 00 00 00       	mov    $0x26,%eax
+     681:	e9 5e fe ff ff       	jmp    4e4 <dosyscall>
+
+00000686 <kthread_exit>:
+SYSCALL(kthread_exit)
+     686:	b8 27 00 00 00       	mov    $0x27,%eax
+     68b:	e9 54 fe ff ff       	jmp    4e4 <dosyscall>
+
+00000690 <kthread_join>:
+SYSCALL(kthread_join)
+     690:	b8 28 00 00 00       	mov    $0x28,%eax
+     695:	e9 4a fe ff ff       	jmp    4e4 <dosyscall>
+
+0000069a <futex>:
+SYSCALL(futex)
+     69a:	b8 29 00 00 00       	mov    $0x29,%eax
+     69f:	e9 40 fe ff ff       	jmp    4e4 <dosyscall>
+
+000006a4 <signal>:
+SYSCALL(signal)
+     6a4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     6a9:	e9 36 fe ff ff       	jmp    4e4 <dosyscall>
+
+000006ae <alarm>:
+SYSCALL(alarm)
+     6ae:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6b3:	e9 2c fe ff ff       	jmp    4e4 <dosyscall>
+
+000006b8 <usleep>:
+SYSCALL(usleep)
+     6b8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6bd:	e9 22 fe ff ff       	jmp    4e4 <dosyscall>
+
+000006c2 <ioring_setup>:
+SYSCALL(ioring_setup)
+     6c2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6c7:	e9 18 fe ff ff       	jmp    4e4 <dosyscall>
+
+000006cc <ioring_enter>:
+SYSCALL(ioring_enter)
+     6cc:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6d1:	e9 0e fe ff ff       	jmp    4e4 <dosyscall>
+
+000006d6 <getrusage>:
+SYSCALL(getrusage)
+     6d6:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6db:	e9 04 fe ff ff       	jmp    4e4 <dosyscall>
+
+000006e0 <mount>:
+SYSCALL(mount)
+     6e0:	b8 30 00 00 00       	mov    $0x30,%eax
+     6e5:	e9 fa fd ff ff       	jmp    4e4 <dosyscall>
+
+000006ea <getdents>:
+SYSCALL(getdents)
+     6ea:	b8 31 00 00 00       	mov    $0x31,%eax
+     6ef:	e9 f0 fd ff ff       	jmp    4e4 <dosyscall>
+
+000006f4 <yield>:
+SYSCALL(yield)
+     6f4:	b8 32 00 00 00       	mov    $0x32,%eax
+     6f9:	e9 e6 fd ff ff       	jmp    4e4 <dosyscall>
+
+000006fe <ncpu>:
+SYSCALL(ncpu)
+     6fe:	b8 33 00 00 00       	mov    $0x33,%eax
+     703:	e9 dc fd ff ff       	jmp    4e4 <dosyscall>
+
+00000708 <fallocate>:
+SYSCALL(fallocate)
+     708:	b8 34 00 00 00       	mov    $0x34,%eax
+     70d:	e9 d2 fd ff ff       	jmp    4e4 <dosyscall>
+
+00000712 <ftruncate>:
+SYSCALL(ftruncate)
+     712:	b8 35 00 00 00       	mov    $0x35,%eax
+     717:	e9 c8 fd ff ff       	jmp    4e4 <dosyscall>
+
+0000071c <fsync>:
+SYSCALL(fsync)
+     71c:	b8 36 00 00 00       	mov    $0x36,%eax
+     721:	e9 be fd ff ff       	jmp    4e4 <dosyscall>
+
+00000726 <fdatasync>:
+SYSCALL(fdatasync)
+     726:	b8 37 00 00 00       	mov    $0x37,%eax
+     72b:	e9 b4 fd ff ff       	jmp    4e4 <dosyscall>
+
+00000730 <poll>:
+SYSCALL(poll)
+     730:	b8 38 00 00 00       	mov    $0x38,%eax
+     735:	e9 aa fd ff ff       	jmp    4e4 <dosyscall>
+
+0000073a <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     73a:	55                   	push   %ebp
+     73b:	89 e5                	mov    %esp,%ebp
+     73d:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     740:	8b 45 08             	mov    0x8(%ebp),%eax
+     743:	8b 40 04             	mov    0x4(%eax),%eax
+     746:	85 c0                	test   %eax,%eax
+     748:	7e 1f                	jle    769 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     74a:	8b 45 08             	mov    0x8(%ebp),%eax
+     74d:	8b 50 04             	mov    0x4(%eax),%edx
+     750:	8b 45 08             	mov    0x8(%ebp),%eax
+     753:	8d 48 08             	lea    0x8(%eax),%ecx
+     756:	8b 45 08             	mov    0x8(%ebp),%eax
+     759:	8b 00                	mov    (%eax),%eax
+     75b:	83 ec 04             	sub    $0x4,%esp
+     75e:	52                   	push   %edx
+     75f:	51                   	push   %ecx
+     760:	50                   	push   %eax
+     761:	e8 d0 fe ff ff       	call   636 <writev>
+     766:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     769:	8b 45 08             	mov    0x8(%ebp),%eax
+     76c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     773:	8b 45 08             	mov    0x8(%ebp),%eax
+     776:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     77d:	00 00 00 
+}
+     780:	90                   	nop
+     781:	c9                   	leave
+     782:	c3                   	ret
+
+00000783 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     783:	55                   	push   %ebp
+     784:	89 e5                	mov    %esp,%ebp
+     786:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     789:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     78d:	0f 84 94 00 00 00    	je     827 <put+0xa4>
+    return;
+  if(o->n > 0){
+     793:	8b 45 08             	mov    0x8(%ebp),%eax
+     796:	8b 40 04             	mov    0x4(%eax),%eax
+     799:	85 c0                	test   %eax,%eax
+     79b:	7e 40                	jle    7dd <put+0x5a>
+    v = &o->iov[o->n-1];
+     79d:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a0:	8b 40 04             	mov    0x4(%eax),%eax
+     7a3:	83 e8 01             	sub    $0x1,%eax
+     7a6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     7ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b0:	01 d0                	add    %edx,%eax
+     7b2:	83 c0 08             	add    $0x8,%eax
+     7b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     7b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7bb:	8b 10                	mov    (%eax),%edx
+     7bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7c0:	8b 40 04             	mov    0x4(%eax),%eax
+     7c3:	01 d0                	add    %edx,%eax
+     7c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     7c8:	75 13                	jne    7dd <put+0x5a>
+      v->iov_len += n;
+     7ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7cd:	8b 50 04             	mov    0x4(%eax),%edx
+     7d0:	8b 45 10             	mov    0x10(%ebp),%eax
+     7d3:	01 c2                	add    %eax,%edx
+     7d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d8:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     7db:	eb 4b                	jmp    828 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     7dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e0:	8b 40 04             	mov    0x4(%eax),%eax
+     7e3:	83 f8 10             	cmp    $0x10,%eax
+     7e6:	75 0e                	jne    7f6 <put+0x73>
+    flush(o);
+     7e8:	83 ec 0c             	sub    $0xc,%esp
+     7eb:	ff 75 08             	push   0x8(%ebp)
+     7ee:	e8 47 ff ff ff       	call   73a <flush>
+     7f3:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     7f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f9:	8b 50 04             	mov    0x4(%eax),%edx
+     7fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     802:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     806:	8b 45 08             	mov    0x8(%ebp),%eax
+     809:	8b 50 04             	mov    0x4(%eax),%edx
+     80c:	8b 45 08             	mov    0x8(%ebp),%eax
+     80f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     812:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     816:	8b 45 08             	mov    0x8(%ebp),%eax
+     819:	8b 40 04             	mov    0x4(%eax),%eax
+     81c:	8d 50 01             	lea    0x1(%eax),%edx
+     81f:	8b 45 08             	mov    0x8(%ebp),%eax
+     822:	89 50 04             	mov    %edx,0x4(%eax)
+     825:	eb 01                	jmp    828 <put+0xa5>
+    return;
+     827:	90                   	nop
+}
+     828:	c9                   	leave
+     829:	c3                   	ret
+
+0000082a <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     82a:	55                   	push   %ebp
+     82b:	89 e5                	mov    %esp,%ebp
+     82d:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     830:	8b 45 08             	mov    0x8(%ebp),%eax
+     833:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     839:	8b 45 0c             	mov    0xc(%ebp),%eax
+     83c:	01 d0                	add    %edx,%eax
+     83e:	3d 80 00 00 00       	cmp    $0x80,%eax
+     843:	77 0b                	ja     850 <room+0x26>
+     845:	8b 45 08             	mov    0x8(%ebp),%eax
+     848:	8b 40 04             	mov    0x4(%eax),%eax
+     84b:	83 f8 10             	cmp    $0x10,%eax
+     84e:	75 0e                	jne    85e <room+0x34>
+    flush(o);
+     850:	83 ec 0c             	sub    $0xc,%esp
+     853:	ff 75 08             	push   0x8(%ebp)
+     856:	e8 df fe ff ff       	call   73a <flush>
+     85b:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     85e:	8b 45 08             	mov    0x8(%ebp),%eax
+     861:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     867:	8b 45 08             	mov    0x8(%ebp),%eax
+     86a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     870:	01 d0                	add    %edx,%eax
+}
+     872:	c9                   	leave
+     873:	c3                   	ret
+
+00000874 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     874:	55                   	push   %ebp
+     875:	89 e5                	mov    %esp,%ebp
+     877:	83 ec 28             	sub    $0x28,%esp
+     87a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     87d:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     880:	83 ec 08             	sub    $0x8,%esp
+     883:	6a 01                	push   $0x1
+     885:	ff 75 08             	push   0x8(%ebp)
+     888:	e8 9d ff ff ff       	call   82a <room>
+     88d:	83 c4 10             	add    $0x10,%esp
+     890:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     896:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     89a:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     89c:	8b 45 08             	mov    0x8(%ebp),%eax
+     89f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8a5:	8d 50 01             	lea    0x1(%eax),%edx
+     8a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ab:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     8b1:	83 ec 04             	sub    $0x4,%esp
+     8b4:	6a 01                	push   $0x1
+     8b6:	ff 75 f4             	push   -0xc(%ebp)
+     8b9:	ff 75 08             	push   0x8(%ebp)
+     8bc:	e8 c2 fe ff ff       	call   783 <put>
+     8c1:	83 c4 10             	add    $0x10,%esp
+}
+     8c4:	90                   	nop
+     8c5:	c9                   	leave
+     8c6:	c3                   	ret
+
+000008c7 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     8c7:	55                   	push   %ebp
+     8c8:	89 e5                	mov    %esp,%ebp
+     8ca:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     8cd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8d4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8d8:	74 17                	je     8f1 <printint+0x2a>
+     8da:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8de:	79 11                	jns    8f1 <printint+0x2a>
+    neg = 1;
+     8e0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     8e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8ea:	f7 d8                	neg    %eax
+     8ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8ef:	eb 06                	jmp    8f7 <printint+0x30>
+  } else {
+    x = xx;
+     8f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     8f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     901:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     904:	ba 00 00 00 00       	mov    $0x0,%edx
+     909:	f7 f1                	div    %ecx
+     90b:	89 d1                	mov    %edx,%ecx
+     90d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     910:	8d 50 01             	lea    0x1(%eax),%edx
+     913:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     916:	0f b6 91 9c 14 00 00 	movzbl 0x149c(%ecx),%edx
+     91d:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     921:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     924:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     927:	ba 00 00 00 00       	mov    $0x0,%edx
+     92c:	f7 f1                	div    %ecx
+     92e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     931:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     935:	75 c7                	jne    8fe <printint+0x37>
+  if(neg)
+     937:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     93b:	74 0e                	je     94b <printint+0x84>
+    buf[i++] = '-';
+     93d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     940:	8d 50 01             	lea    0x1(%eax),%edx
+     943:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     946:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     94b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     94e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     951:	83 ec 08             	sub    $0x8,%esp
+     954:	ff 75 e8             	push   -0x18(%ebp)
+     957:	ff 75 08             	push   0x8(%ebp)
+     95a:	e8 cb fe ff ff       	call   82a <room>
+     95f:	83 c4 10             	add    $0x10,%esp
+     962:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     965:	eb 1d                	jmp    984 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     967:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     96a:	83 e8 01             	sub    $0x1,%eax
+     96d:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     970:	89 c2                	mov    %eax,%edx
+     972:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     975:	01 c2                	add    %eax,%edx
+     977:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     97a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97d:	01 c8                	add    %ecx,%eax
+     97f:	0f b6 00             	movzbl (%eax),%eax
+     982:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     984:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     988:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     98c:	79 d9                	jns    967 <printint+0xa0>
+  o->used += n;
+     98e:	8b 45 08             	mov    0x8(%ebp),%eax
+     991:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     997:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     99a:	01 c2                	add    %eax,%edx
+     99c:	8b 45 08             	mov    0x8(%ebp),%eax
+     99f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     9a5:	83 ec 04             	sub    $0x4,%esp
+     9a8:	ff 75 e8             	push   -0x18(%ebp)
+     9ab:	ff 75 e4             	push   -0x1c(%ebp)
+     9ae:	ff 75 08             	push   0x8(%ebp)
+     9b1:	e8 cd fd ff ff       	call   783 <put>
+     9b6:	83 c4 10             	add    $0x10,%esp
+}
+     9b9:	90                   	nop
+     9ba:	c9                   	leave
+     9bb:	c3                   	ret
+
+000009bc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9bc:	55                   	push   %ebp
+     9bd:	89 e5                	mov    %esp,%ebp
+     9bf:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     9c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c8:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     9ce:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     9d5:	00 00 00 
+  o.used = 0;
+     9d8:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     9df:	00 00 00 
+  state = 0;
+     9e2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     9e9:	8d 45 0c             	lea    0xc(%ebp),%eax
+     9ec:	83 c0 04             	add    $0x4,%eax
+     9ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     9f2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     9f9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a00:	e9 82 01 00 00       	jmp    b87 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a05:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a0b:	01 d0                	add    %edx,%eax
+     a0d:	0f b6 00             	movzbl (%eax),%eax
+     a10:	0f be c0             	movsbl %al,%eax
+     a13:	25 ff 00 00 00       	and    $0xff,%eax
+     a18:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a1b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a1f:	75 38                	jne    a59 <printf+0x9d>
+      if(c == '%'){
+     a21:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a25:	0f 85 58 01 00 00    	jne    b83 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a2b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a2e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a34:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a37:	01 ca                	add    %ecx,%edx
+     a39:	83 ec 04             	sub    $0x4,%esp
+     a3c:	50                   	push   %eax
+     a3d:	52                   	push   %edx
+     a3e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a44:	50                   	push   %eax
+     a45:	e8 39 fd ff ff       	call   783 <put>
+     a4a:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a4d:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a54:	e9 2a 01 00 00       	jmp    b83 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a59:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a5d:	0f 85 20 01 00 00    	jne    b83 <printf+0x1c7>
+      if(c == 'd'){
+     a63:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a67:	75 22                	jne    a8b <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a6c:	8b 00                	mov    (%eax),%eax
+     a6e:	6a 01                	push   $0x1
+     a70:	6a 0a                	push   $0xa
+     a72:	50                   	push   %eax
+     a73:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a79:	50                   	push   %eax
+     a7a:	e8 48 fe ff ff       	call   8c7 <printint>
+     a7f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a82:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a86:	e9 e8 00 00 00       	jmp    b73 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     a8b:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     a8f:	74 06                	je     a97 <printf+0xdb>
+     a91:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     a95:	75 22                	jne    ab9 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     a97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a9a:	8b 00                	mov    (%eax),%eax
+     a9c:	6a 00                	push   $0x0
+     a9e:	6a 10                	push   $0x10
+     aa0:	50                   	push   %eax
+     aa1:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     aa7:	50                   	push   %eax
+     aa8:	e8 1a fe ff ff       	call   8c7 <printint>
+     aad:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ab0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     ab4:	e9 ba 00 00 00       	jmp    b73 <printf+0x1b7>
+      } else if(c == 's'){
+     ab9:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     abd:	75 3f                	jne    afe <printf+0x142>
+        s = (char*)*ap;
+     abf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ac2:	8b 00                	mov    (%eax),%eax
+     ac4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     ac7:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     acb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     acf:	75 07                	jne    ad8 <printf+0x11c>
+          s = "(null)";
+     ad1:	c7 45 f4 0b 11 00 00 	movl   $0x110b,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     ad8:	83 ec 0c             	sub    $0xc,%esp
+     adb:	ff 75 f4             	push   -0xc(%ebp)
+     ade:	e8 47 f8 ff ff       	call   32a <strlen>
+     ae3:	83 c4 10             	add    $0x10,%esp
+     ae6:	83 ec 04             	sub    $0x4,%esp
+     ae9:	50                   	push   %eax
+     aea:	ff 75 f4             	push   -0xc(%ebp)
+     aed:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     af3:	50                   	push   %eax
+     af4:	e8 8a fc ff ff       	call   783 <put>
+     af9:	83 c4 10             	add    $0x10,%esp
+     afc:	eb 75                	jmp    b73 <printf+0x1b7>
+      } else if(c == 'c'){
+     afe:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b02:	75 21                	jne    b25 <printf+0x169>
+        putc(&o, *ap);
+     b04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b07:	8b 00                	mov    (%eax),%eax
+     b09:	0f be c0             	movsbl %al,%eax
+     b0c:	83 ec 08             	sub    $0x8,%esp
+     b0f:	50                   	push   %eax
+     b10:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b16:	50                   	push   %eax
+     b17:	e8 58 fd ff ff       	call   874 <putc>
+     b1c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b1f:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b23:	eb 4e                	jmp    b73 <printf+0x1b7>
+      } else if(c == '%'){
+     b25:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b29:	75 1b                	jne    b46 <printf+0x18a>
+        putc(&o, c);
+     b2b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b2e:	0f be c0             	movsbl %al,%eax
+     b31:	83 ec 08             	sub    $0x8,%esp
+     b34:	50                   	push   %eax
+     b35:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b3b:	50                   	push   %eax
+     b3c:	e8 33 fd ff ff       	call   874 <putc>
+     b41:	83 c4 10             	add    $0x10,%esp
+     b44:	eb 2d                	jmp    b73 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b46:	83 ec 08             	sub    $0x8,%esp
+     b49:	6a 25                	push   $0x25
+     b4b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b51:	50                   	push   %eax
+     b52:	e8 1d fd ff ff       	call   874 <putc>
+     b57:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b5a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b5d:	0f be c0             	movsbl %al,%eax
+     b60:	83 ec 08             	sub    $0x8,%esp
+     b63:	50                   	push   %eax
+     b64:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b6a:	50                   	push   %eax
+     b6b:	e8 04 fd ff ff       	call   874 <putc>
+     b70:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b73:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     b7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b7d:	83 c0 01             	add    $0x1,%eax
+     b80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b83:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b87:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b8a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b8d:	01 d0                	add    %edx,%eax
+     b8f:	0f b6 00             	movzbl (%eax),%eax
+     b92:	84 c0                	test   %al,%al
+     b94:	0f 85 6b fe ff ff    	jne    a05 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     b9a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b9e:	75 22                	jne    bc2 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     ba0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ba3:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     ba6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ba9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     bac:	01 ca                	add    %ecx,%edx
+     bae:	83 ec 04             	sub    $0x4,%esp
+     bb1:	50                   	push   %eax
+     bb2:	52                   	push   %edx
+     bb3:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bb9:	50                   	push   %eax
+     bba:	e8 c4 fb ff ff       	call   783 <put>
+     bbf:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     bc2:	83 ec 0c             	sub    $0xc,%esp
+     bc5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bcb:	50                   	push   %eax
+     bcc:	e8 69 fb ff ff       	call   73a <flush>
+     bd1:	83 c4 10             	add    $0x10,%esp
+}
+     bd4:	90                   	nop
+     bd5:	c9                   	leave
+     bd6:	c3                   	ret
+
+00000bd7 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     bd7:	55                   	push   %ebp
+     bd8:	89 e5                	mov    %esp,%ebp
+     bda:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     bdd:	8b 55 08             	mov    0x8(%ebp),%edx
+     be0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     be3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     be6:	f0 87 02             	lock xchg %eax,(%edx)
+     be9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     bec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     bef:	c9                   	leave
+     bf0:	c3                   	ret
+
+00000bf1 <lock>:
+{
+     bf1:	55                   	push   %ebp
+     bf2:	89 e5                	mov    %esp,%ebp
+     bf4:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     bf7:	a1 90 1c 00 00       	mov    0x1c90,%eax
+     bfc:	85 c0                	test   %eax,%eax
+     bfe:	74 09                	je     c09 <lock+0x18>
+     c00:	a1 90 1c 00 00       	mov    0x1c90,%eax
+     c05:	ff d0                	call   *%eax
+     c07:	eb 05                	jmp    c0e <lock+0x1d>
+     c09:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c11:	90                   	nop
+     c12:	83 ec 08             	sub    $0x8,%esp
+     c15:	6a 01                	push   $0x1
+     c17:	68 c8 1c 00 00       	push   $0x1cc8
+     c1c:	e8 b6 ff ff ff       	call   bd7 <xchg>
+     c21:	83 c4 10             	add    $0x10,%esp
+     c24:	85 c0                	test   %eax,%eax
+     c26:	75 ea                	jne    c12 <lock+0x21>
+  return pin;
+     c28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c2b:	c9                   	leave
+     c2c:	c3                   	ret
+
+00000c2d <unlock>:
+{
+     c2d:	55                   	push   %ebp
+     c2e:	89 e5                	mov    %esp,%ebp
+     c30:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c33:	6a 00                	push   $0x0
+     c35:	68 c8 1c 00 00       	push   $0x1cc8
+     c3a:	e8 98 ff ff ff       	call   bd7 <xchg>
+     c3f:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c42:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c46:	78 10                	js     c58 <unlock+0x2b>
+    mallocunpin(pin);
+     c48:	a1 94 1c 00 00       	mov    0x1c94,%eax
+     c4d:	83 ec 0c             	sub    $0xc,%esp
+     c50:	ff 75 08             	push   0x8(%ebp)
+     c53:	ff d0                	call   *%eax
+     c55:	83 c4 10             	add    $0x10,%esp
+}
+     c58:	90                   	nop
+     c59:	c9                   	leave
+     c5a:	c3                   	ret
+
+00000c5b <sizeclass>:
+{
+     c5b:	55                   	push   %ebp
+     c5c:	89 e5                	mov    %esp,%ebp
+     c5e:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c61:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c68:	eb 1c                	jmp    c86 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     c6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c6d:	ba 02 00 00 00       	mov    $0x2,%edx
+     c72:	89 c1                	mov    %eax,%ecx
+     c74:	d3 e2                	shl    %cl,%edx
+     c76:	89 d0                	mov    %edx,%eax
+     c78:	3b 45 08             	cmp    0x8(%ebp),%eax
+     c7b:	72 05                	jb     c82 <sizeclass+0x27>
+      return c;
+     c7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c80:	eb 0f                	jmp    c91 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     c82:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     c86:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     c8a:	7e de                	jle    c6a <sizeclass+0xf>
+  return -1;
+     c8c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     c91:	c9                   	leave
+     c92:	c3                   	ret
+
+00000c93 <bigfree>:
+{
+     c93:	55                   	push   %ebp
+     c94:	89 e5                	mov    %esp,%ebp
+     c96:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c99:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+     c9e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ca1:	eb 24                	jmp    cc7 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ca3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ca6:	8b 00                	mov    (%eax),%eax
+     ca8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cab:	72 12                	jb     cbf <bigfree+0x2c>
+     cad:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cb3:	72 24                	jb     cd9 <bigfree+0x46>
+     cb5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cb8:	8b 00                	mov    (%eax),%eax
+     cba:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cbd:	72 1a                	jb     cd9 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cbf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cc2:	8b 00                	mov    (%eax),%eax
+     cc4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+     cca:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ccd:	73 d4                	jae    ca3 <bigfree+0x10>
+     ccf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cd2:	8b 00                	mov    (%eax),%eax
+     cd4:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cd7:	73 ca                	jae    ca3 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     cdc:	8b 40 04             	mov    0x4(%eax),%eax
+     cdf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce9:	01 c2                	add    %eax,%edx
+     ceb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cee:	8b 00                	mov    (%eax),%eax
+     cf0:	39 c2                	cmp    %eax,%edx
+     cf2:	75 24                	jne    d18 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf7:	8b 50 04             	mov    0x4(%eax),%edx
+     cfa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cfd:	8b 00                	mov    (%eax),%eax
+     cff:	8b 40 04             	mov    0x4(%eax),%eax
+     d02:	01 c2                	add    %eax,%edx
+     d04:	8b 45 08             	mov    0x8(%ebp),%eax
+     d07:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d0d:	8b 00                	mov    (%eax),%eax
+     d0f:	8b 10                	mov    (%eax),%edx
+     d11:	8b 45 08             	mov    0x8(%ebp),%eax
+     d14:	89 10                	mov    %edx,(%eax)
+     d16:	eb 0a                	jmp    d22 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d1b:	8b 10                	mov    (%eax),%edx
+     d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d20:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d25:	8b 40 04             	mov    0x4(%eax),%eax
+     d28:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d32:	01 d0                	add    %edx,%eax
+     d34:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d37:	75 20                	jne    d59 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d3c:	8b 50 04             	mov    0x4(%eax),%edx
+     d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d42:	8b 40 04             	mov    0x4(%eax),%eax
+     d45:	01 c2                	add    %eax,%edx
+     d47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d4a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d50:	8b 10                	mov    (%eax),%edx
+     d52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d55:	89 10                	mov    %edx,(%eax)
+     d57:	eb 08                	jmp    d61 <bigfree+0xce>
+    p->s.ptr = bp;
+     d59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d5c:	8b 55 08             	mov    0x8(%ebp),%edx
+     d5f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d64:	a3 a0 1c 00 00       	mov    %eax,0x1ca0
+}
+     d69:	90                   	nop
+     d6a:	c9                   	leave
+     d6b:	c3                   	ret
+
+00000d6c <free>:
+{
+     d6c:	55                   	push   %ebp
+     d6d:	89 e5                	mov    %esp,%ebp
+     d6f:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     d72:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d76:	74 68                	je     de0 <free+0x74>
+  bp = (Header*)ap - 1;
+     d78:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7b:	83 e8 08             	sub    $0x8,%eax
+     d7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     d81:	e8 6b fe ff ff       	call   bf1 <lock>
+     d86:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d8c:	8b 40 04             	mov    0x4(%eax),%eax
+     d8f:	83 ec 0c             	sub    $0xc,%esp
+     d92:	50                   	push   %eax
+     d93:	e8 c3 fe ff ff       	call   c5b <sizeclass>
+     d98:	83 c4 10             	add    $0x10,%esp
+     d9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     d9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     da2:	78 1e                	js     dc2 <free+0x56>
+    bp->s.ptr = classfree[c];
+     da4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     da7:	8b 14 85 a4 1c 00 00 	mov    0x1ca4(,%eax,4),%edx
+     dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     db1:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     db3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     db6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     db9:	89 14 85 a4 1c 00 00 	mov    %edx,0x1ca4(,%eax,4)
+     dc0:	eb 0e                	jmp    dd0 <free+0x64>
+    bigfree(bp);
+     dc2:	83 ec 0c             	sub    $0xc,%esp
+     dc5:	ff 75 f4             	push   -0xc(%ebp)
+     dc8:	e8 c6 fe ff ff       	call   c93 <bigfree>
+     dcd:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	ff 75 f0             	push   -0x10(%ebp)
+     dd6:	e8 52 fe ff ff       	call   c2d <unlock>
+     ddb:	83 c4 10             	add    $0x10,%esp
+     dde:	eb 01                	jmp    de1 <free+0x75>
+    return;
+     de0:	90                   	nop
+}
+     de1:	c9                   	leave
+     de2:	c3                   	ret
+
+00000de3 <morecore>:
+{
+     de3:	55                   	push   %ebp
+     de4:	89 e5                	mov    %esp,%ebp
+     de6:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     de9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     df0:	77 07                	ja     df9 <morecore+0x16>
+    nu = 4096;
+     df2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     df9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dfc:	c1 e0 03             	shl    $0x3,%eax
+     dff:	83 ec 0c             	sub    $0xc,%esp
+     e02:	50                   	push   %eax
+     e03:	e8 b6 f7 ff ff       	call   5be <sbrk>
+     e08:	83 c4 10             	add    $0x10,%esp
+     e0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e0e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e12:	75 07                	jne    e1b <morecore+0x38>
+    return 0;
+     e14:	b8 00 00 00 00       	mov    $0x0,%eax
+     e19:	eb 22                	jmp    e3d <morecore+0x5a>
+  hp = (Header*)p;
+     e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e1e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e24:	8b 55 08             	mov    0x8(%ebp),%edx
+     e27:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e2a:	83 ec 0c             	sub    $0xc,%esp
+     e2d:	ff 75 f0             	push   -0x10(%ebp)
+     e30:	e8 5e fe ff ff       	call   c93 <bigfree>
+     e35:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e38:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+}
+     e3d:	c9                   	leave
+     e3e:	c3                   	ret
+
+00000e3f <bigalloc>:
+{
+     e3f:	55                   	push   %ebp
+     e40:	89 e5                	mov    %esp,%ebp
+     e42:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e45:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+     e4a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e4d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e51:	75 23                	jne    e76 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e53:	c7 45 f0 98 1c 00 00 	movl   $0x1c98,-0x10(%ebp)
+     e5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e5d:	a3 a0 1c 00 00       	mov    %eax,0x1ca0
+     e62:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+     e67:	a3 98 1c 00 00       	mov    %eax,0x1c98
+    base.s.size = 0;
+     e6c:	c7 05 9c 1c 00 00 00 	movl   $0x0,0x1c9c
+     e73:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e79:	8b 00                	mov    (%eax),%eax
+     e7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     e7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e81:	8b 40 04             	mov    0x4(%eax),%eax
+     e84:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e87:	72 4a                	jb     ed3 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8c:	8b 40 04             	mov    0x4(%eax),%eax
+     e8f:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e92:	75 0c                	jne    ea0 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e97:	8b 10                	mov    (%eax),%edx
+     e99:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e9c:	89 10                	mov    %edx,(%eax)
+     e9e:	eb 26                	jmp    ec6 <bigalloc+0x87>
+        p->s.size -= nunits;
+     ea0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea3:	8b 40 04             	mov    0x4(%eax),%eax
+     ea6:	2b 45 08             	sub    0x8(%ebp),%eax
+     ea9:	89 c2                	mov    %eax,%edx
+     eab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eae:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     eb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb4:	8b 40 04             	mov    0x4(%eax),%eax
+     eb7:	c1 e0 03             	shl    $0x3,%eax
+     eba:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     ebd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+     ec3:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     ec6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ec9:	a3 a0 1c 00 00       	mov    %eax,0x1ca0
+      return p;
+     ece:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed1:	eb 3b                	jmp    f0e <bigalloc+0xcf>
+    if(p == freep)
+     ed3:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+     ed8:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     edb:	75 1e                	jne    efb <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     edd:	83 ec 0c             	sub    $0xc,%esp
+     ee0:	ff 75 08             	push   0x8(%ebp)
+     ee3:	e8 fb fe ff ff       	call   de3 <morecore>
+     ee8:	83 c4 10             	add    $0x10,%esp
+     eeb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     eee:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ef2:	75 07                	jne    efb <bigalloc+0xbc>
+        return 0;
+     ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef9:	eb 13                	jmp    f0e <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     efe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f04:	8b 00                	mov    (%eax),%eax
+     f06:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f09:	e9 70 ff ff ff       	jmp    e7e <bigalloc+0x3f>
+}
+     f0e:	c9                   	leave
+     f0f:	c3                   	ret
+
+00000f10 <alloc>:
+alloc(uint nbytes)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f16:	8b 45 08             	mov    0x8(%ebp),%eax
+     f19:	83 c0 07             	add    $0x7,%eax
+     f1c:	c1 e8 03             	shr    $0x3,%eax
+     f1f:	83 c0 01             	add    $0x1,%eax
+     f22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f25:	ff 75 f4             	push   -0xc(%ebp)
+     f28:	e8 2e fd ff ff       	call   c5b <sizeclass>
+     f2d:	83 c4 04             	add    $0x4,%esp
+     f30:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f33:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f37:	79 2c                	jns    f65 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f39:	83 ec 0c             	sub    $0xc,%esp
+     f3c:	ff 75 f4             	push   -0xc(%ebp)
+     f3f:	e8 fb fe ff ff       	call   e3f <bigalloc>
+     f44:	83 c4 10             	add    $0x10,%esp
+     f47:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f4e:	75 0a                	jne    f5a <alloc+0x4a>
+      return 0;
+     f50:	b8 00 00 00 00       	mov    $0x0,%eax
+     f55:	e9 c8 00 00 00       	jmp    1022 <alloc+0x112>
+    return (void*)(p + 1);
+     f5a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f5d:	83 c0 08             	add    $0x8,%eax
+     f60:	e9 bd 00 00 00       	jmp    1022 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f68:	8b 04 85 a4 1c 00 00 	mov    0x1ca4(,%eax,4),%eax
+     f6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f72:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f76:	74 1a                	je     f92 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     f78:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f7b:	8b 10                	mov    (%eax),%edx
+     f7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f80:	89 14 85 a4 1c 00 00 	mov    %edx,0x1ca4(,%eax,4)
+    return (void*)(p + 1);
+     f87:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f8a:	83 c0 08             	add    $0x8,%eax
+     f8d:	e9 90 00 00 00       	jmp    1022 <alloc+0x112>
+  }
+  nunits = 2 << c;
+     f92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f95:	ba 02 00 00 00       	mov    $0x2,%edx
+     f9a:	89 c1                	mov    %eax,%ecx
+     f9c:	d3 e2                	shl    %cl,%edx
+     f9e:	89 d0                	mov    %edx,%eax
+     fa0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     fa3:	a1 c0 1c 00 00       	mov    0x1cc0,%eax
+     fa8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fab:	c1 e2 03             	shl    $0x3,%edx
+     fae:	01 d0                	add    %edx,%eax
+     fb0:	8b 15 c4 1c 00 00    	mov    0x1cc4,%edx
+     fb6:	39 c2                	cmp    %eax,%edx
+     fb8:	73 3f                	jae    ff9 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     fba:	83 ec 0c             	sub    $0xc,%esp
+     fbd:	68 00 08 00 00       	push   $0x800
+     fc2:	e8 78 fe ff ff       	call   e3f <bigalloc>
+     fc7:	83 c4 10             	add    $0x10,%esp
+     fca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fcd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fd1:	75 07                	jne    fda <alloc+0xca>
+      return 0;
+     fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd8:	eb 48                	jmp    1022 <alloc+0x112>
+    bump = (char*)p;
+     fda:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fdd:	a3 c0 1c 00 00       	mov    %eax,0x1cc0
+    bumpend = (char*)(p + p->s.size);
+     fe2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fe5:	8b 40 04             	mov    0x4(%eax),%eax
+     fe8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     fef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff2:	01 d0                	add    %edx,%eax
+     ff4:	a3 c4 1c 00 00       	mov    %eax,0x1cc4
+  }
+  p = (Header*)bump;
+     ff9:	a1 c0 1c 00 00       	mov    0x1cc0,%eax
+     ffe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1001:	a1 c0 1c 00 00       	mov    0x1cc0,%eax
+    1006:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1009:	c1 e2 03             	shl    $0x3,%edx
+    100c:	01 d0                	add    %edx,%eax
+    100e:	a3 c0 1c 00 00       	mov    %eax,0x1cc0
+  p->s.size = nunits;
+    1013:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1016:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1019:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    101c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101f:	83 c0 08             	add    $0x8,%eax
+}
+    1022:	c9                   	leave
+    1023:	c3                   	ret
+
+00001024 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1024:	55                   	push   %ebp
+    1025:	89 e5                	mov    %esp,%ebp
+    1027:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    102a:	e8 c2 fb ff ff       	call   bf1 <lock>
+    102f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1032:	83 ec 0c             	sub    $0xc,%esp
+    1035:	ff 75 08             	push   0x8(%ebp)
+    1038:	e8 d3 fe ff ff       	call   f10 <alloc>
+    103d:	83 c4 10             	add    $0x10,%esp
+    1040:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1043:	83 ec 0c             	sub    $0xc,%esp
+    1046:	ff 75 f4             	push   -0xc(%ebp)
+    1049:	e8 df fb ff ff       	call   c2d <unlock>
+    104e:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1051:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1054:	c9                   	leave
+    1055:	c3                   	ret
@@ -0,0 +1,55 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define TEST_FILE "/pread_file"
+#define SIZE 2000
+
+static char buf[SIZE];
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+  char c;
+
+  for(i = 0; i < SIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, buf, SIZE) != SIZE){
+    printf(1, "error creating file: %s\n", TEST_FILE);
+    exit();
+  }
+
+  // pread and pwrite leave the offset alone.
+  if(pread(fd, &c, 1, 1000) != 1 || c != buf[1000]){
+    printf(1, "error: pread\n");
+    exit();
+  }
+  if(pwrite(fd, "Z", 1, 5) != 1 || pread(fd, &c, 1, 5) != 1 || c != 'Z'){
+    printf(1, "error: pwrite\n");
+    exit();
+  }
+  if(lseek(fd, 0, SEEK_CUR) != SIZE){
+    printf(1, "error: offset moved\n");
+    exit();
+  }
+  printf(1, "pread ok\n");
+
+  if(lseek(fd, 10, SEEK_SET) != 10 || read(fd, &c, 1) != 1 || c != buf[10]){
+    printf(1, "error: SEEK_SET\n");
+    exit();
+  }
+  if(lseek(fd, -1, SEEK_END) != SIZE-1 || read(fd, &c, 1) != 1 || c != buf[SIZE-1]){
+    printf(1, "error: SEEK_END\n");
+    exit();
+  }
+  if(lseek(fd, -SIZE-1, SEEK_CUR) != -1){
+    printf(1, "error: negative offset accepted\n");
+    exit();
+  }
+  close(fd);
+  unlink(TEST_FILE);
+  printf(1, "lseek ok\n");
+  exit();
+}
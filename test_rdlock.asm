@@ -0,0 +1,2000 @@
+
+_test_rdlock:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <reader>:
+static char want[SIZE];
+static char buf[SIZE];
+
+static void
+reader(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  struct stat st;
+  int fd, i, r;
+
+  for(r = 0; r < ROUNDS; r++){
+       6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+       d:	e9 19 01 00 00       	jmp    12b <reader+0x12b>
+    if((fd = open(TEST_FILE, O_RDONLY)) < 0 || fstat(fd, &st) < 0 || st.size != SIZE){
+      12:	83 ec 08             	sub    $0x8,%esp
+      15:	6a 00                	push   $0x0
+      17:	68 5f 10 00 00       	push   $0x105f
+      1c:	e8 4c 05 00 00       	call   56d <open>
+      21:	83 c4 10             	add    $0x10,%esp
+      24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      27:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+      2b:	78 20                	js     4d <reader+0x4d>
+      2d:	83 ec 08             	sub    $0x8,%esp
+      30:	8d 45 d8             	lea    -0x28(%ebp),%eax
+      33:	50                   	push   %eax
+      34:	ff 75 ec             	push   -0x14(%ebp)
+      37:	e8 4f 05 00 00       	call   58b <fstat>
+      3c:	83 c4 10             	add    $0x10,%esp
+      3f:	85 c0                	test   %eax,%eax
+      41:	78 0a                	js     4d <reader+0x4d>
+      43:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      46:	3d 64 30 00 00       	cmp    $0x3064,%eax
+      4b:	74 17                	je     64 <reader+0x64>
+      printf(1, "error: open or stat\n");
+      4d:	83 ec 08             	sub    $0x8,%esp
+      50:	68 6c 10 00 00       	push   $0x106c
+      55:	6a 01                	push   $0x1
+      57:	e8 69 09 00 00       	call   9c5 <printf>
+      5c:	83 c4 10             	add    $0x10,%esp
+      exit();
+      5f:	e8 d1 04 00 00       	call   535 <exit>
+    }
+    memset(buf, 0, SIZE);
+      64:	83 ec 04             	sub    $0x4,%esp
+      67:	68 64 30 00 00       	push   $0x3064
+      6c:	6a 00                	push   $0x0
+      6e:	68 40 45 00 00       	push   $0x4540
+      73:	e8 e2 02 00 00       	call   35a <memset>
+      78:	83 c4 10             	add    $0x10,%esp
+    if(read(fd, buf, SIZE) != SIZE){
+      7b:	83 ec 04             	sub    $0x4,%esp
+      7e:	68 64 30 00 00       	push   $0x3064
+      83:	68 40 45 00 00       	push   $0x4540
+      88:	ff 75 ec             	push   -0x14(%ebp)
+      8b:	e8 ba 04 00 00       	call   54a <read>
+      90:	83 c4 10             	add    $0x10,%esp
+      93:	3d 64 30 00 00       	cmp    $0x3064,%eax
+      98:	74 17                	je     b1 <reader+0xb1>
+      printf(1, "error: short read\n");
+      9a:	83 ec 08             	sub    $0x8,%esp
+      9d:	68 81 10 00 00       	push   $0x1081
+      a2:	6a 01                	push   $0x1
+      a4:	e8 1c 09 00 00       	call   9c5 <printf>
+      a9:	83 c4 10             	add    $0x10,%esp
+      exit();
+      ac:	e8 84 04 00 00       	call   535 <exit>
+    }
+    for(i = 0; i < SIZE; i++)
+      b1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      b8:	eb 56                	jmp    110 <reader+0x110>
+      if(buf[i] != want[i]){
+      ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      bd:	05 40 45 00 00       	add    $0x4540,%eax
+      c2:	0f b6 10             	movzbl (%eax),%edx
+      c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      c8:	05 c0 14 00 00       	add    $0x14c0,%eax
+      cd:	0f b6 00             	movzbl (%eax),%eax
+      d0:	38 c2                	cmp    %al,%dl
+      d2:	74 38                	je     10c <reader+0x10c>
+        printf(1, "error: byte %d is %d, not %d\n", i, buf[i], want[i]);
+      d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      d7:	05 c0 14 00 00       	add    $0x14c0,%eax
+      dc:	0f b6 00             	movzbl (%eax),%eax
+      df:	0f be d0             	movsbl %al,%edx
+      e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      e5:	05 40 45 00 00       	add    $0x4540,%eax
+      ea:	0f b6 00             	movzbl (%eax),%eax
+      ed:	0f be c0             	movsbl %al,%eax
+      f0:	83 ec 0c             	sub    $0xc,%esp
+      f3:	52                   	push   %edx
+      f4:	50                   	push   %eax
+      f5:	ff 75 f4             	push   -0xc(%ebp)
+      f8:	68 94 10 00 00       	push   $0x1094
+      fd:	6a 01                	push   $0x1
+      ff:	e8 c1 08 00 00       	call   9c5 <printf>
+     104:	83 c4 20             	add    $0x20,%esp
+        exit();
+     107:	e8 29 04 00 00       	call   535 <exit>
+    for(i = 0; i < SIZE; i++)
+     10c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     110:	81 7d f4 63 30 00 00 	cmpl   $0x3063,-0xc(%ebp)
+     117:	7e a1                	jle    ba <reader+0xba>
+      }
+    close(fd);
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	ff 75 ec             	push   -0x14(%ebp)
+     11f:	e8 34 04 00 00       	call   558 <close>
+     124:	83 c4 10             	add    $0x10,%esp
+  for(r = 0; r < ROUNDS; r++){
+     127:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     12b:	83 7d f0 13          	cmpl   $0x13,-0x10(%ebp)
+     12f:	0f 8e dd fe ff ff    	jle    12 <reader+0x12>
+  }
+  exit();
+     135:	e8 fb 03 00 00       	call   535 <exit>
+
+0000013a <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+     13a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     13e:	83 e4 f0             	and    $0xfffffff0,%esp
+     141:	ff 71 fc             	push   -0x4(%ecx)
+     144:	55                   	push   %ebp
+     145:	89 e5                	mov    %esp,%ebp
+     147:	51                   	push   %ecx
+     148:	83 ec 14             	sub    $0x14,%esp
+  int fd, i;
+
+  for(i = 0; i < SIZE; i++)
+     14b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     152:	eb 32                	jmp    186 <main+0x4c>
+    want[i] = 'a' + i % 26;
+     154:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     157:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+     15c:	89 c8                	mov    %ecx,%eax
+     15e:	f7 ea                	imul   %edx
+     160:	89 d0                	mov    %edx,%eax
+     162:	c1 f8 03             	sar    $0x3,%eax
+     165:	89 ca                	mov    %ecx,%edx
+     167:	c1 fa 1f             	sar    $0x1f,%edx
+     16a:	29 d0                	sub    %edx,%eax
+     16c:	6b d0 1a             	imul   $0x1a,%eax,%edx
+     16f:	89 c8                	mov    %ecx,%eax
+     171:	29 d0                	sub    %edx,%eax
+     173:	83 c0 61             	add    $0x61,%eax
+     176:	89 c2                	mov    %eax,%edx
+     178:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     17b:	05 c0 14 00 00       	add    $0x14c0,%eax
+     180:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+     182:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     186:	81 7d f4 63 30 00 00 	cmpl   $0x3063,-0xc(%ebp)
+     18d:	7e c5                	jle    154 <main+0x1a>
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, want, SIZE) != SIZE){
+     18f:	83 ec 08             	sub    $0x8,%esp
+     192:	68 02 02 00 00       	push   $0x202
+     197:	68 5f 10 00 00       	push   $0x105f
+     19c:	e8 cc 03 00 00       	call   56d <open>
+     1a1:	83 c4 10             	add    $0x10,%esp
+     1a4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     1a7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1ab:	78 1f                	js     1cc <main+0x92>
+     1ad:	83 ec 04             	sub    $0x4,%esp
+     1b0:	68 64 30 00 00       	push   $0x3064
+     1b5:	68 c0 14 00 00       	push   $0x14c0
+     1ba:	ff 75 f0             	push   -0x10(%ebp)
+     1bd:	e8 8f 03 00 00       	call   551 <write>
+     1c2:	83 c4 10             	add    $0x10,%esp
+     1c5:	3d 64 30 00 00       	cmp    $0x3064,%eax
+     1ca:	74 1c                	je     1e8 <main+0xae>
+    printf(1, "error creating file: %s\n", TEST_FILE);
+     1cc:	83 ec 04             	sub    $0x4,%esp
+     1cf:	68 5f 10 00 00       	push   $0x105f
+     1d4:	68 b2 10 00 00       	push   $0x10b2
+     1d9:	6a 01                	push   $0x1
+     1db:	e8 e5 07 00 00       	call   9c5 <printf>
+     1e0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1e3:	e8 4d 03 00 00       	call   535 <exit>
+  }
+
+  for(i = 0; i < NREADER; i++){
+     1e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1ef:	eb 12                	jmp    203 <main+0xc9>
+    if(fork() == 0)
+     1f1:	e8 38 03 00 00       	call   52e <fork>
+     1f6:	85 c0                	test   %eax,%eax
+     1f8:	75 05                	jne    1ff <main+0xc5>
+      reader();
+     1fa:	e8 01 fe ff ff       	call   0 <reader>
+  for(i = 0; i < NREADER; i++){
+     1ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     203:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     207:	7e e8                	jle    1f1 <main+0xb7>
+  }
+  for(i = 0; i < ROUNDS; i++)
+     209:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     210:	eb 39                	jmp    24b <main+0x111>
+    if(pwrite(fd, want, SIZE, 0) != SIZE){
+     212:	6a 00                	push   $0x0
+     214:	68 64 30 00 00       	push   $0x3064
+     219:	68 c0 14 00 00       	push   $0x14c0
+     21e:	ff 75 f0             	push   -0x10(%ebp)
+     221:	e8 2d 04 00 00       	call   653 <pwrite>
+     226:	83 c4 10             	add    $0x10,%esp
+     229:	3d 64 30 00 00       	cmp    $0x3064,%eax
+     22e:	74 17                	je     247 <main+0x10d>
+      printf(1, "error: pwrite\n");
+     230:	83 ec 08             	sub    $0x8,%esp
+     233:	68 cb 10 00 00       	push   $0x10cb
+     238:	6a 01                	push   $0x1
+     23a:	e8 86 07 00 00       	call   9c5 <printf>
+     23f:	83 c4 10             	add    $0x10,%esp
+      exit();
+     242:	e8 ee 02 00 00       	call   535 <exit>
+  for(i = 0; i < ROUNDS; i++)
+     247:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     24b:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+     24f:	7e c1                	jle    212 <main+0xd8>
+    }
+  for(i = 0; i < NREADER; i++)
+     251:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     258:	eb 09                	jmp    263 <main+0x129>
+    wait();
+     25a:	e8 dd 02 00 00       	call   53c <wait>
+  for(i = 0; i < NREADER; i++)
+     25f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     263:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     267:	7e f1                	jle    25a <main+0x120>
+  close(fd);
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	ff 75 f0             	push   -0x10(%ebp)
+     26f:	e8 e4 02 00 00       	call   558 <close>
+     274:	83 c4 10             	add    $0x10,%esp
+  unlink(TEST_FILE);
+     277:	83 ec 0c             	sub    $0xc,%esp
+     27a:	68 5f 10 00 00       	push   $0x105f
+     27f:	e8 fd 02 00 00       	call   581 <unlink>
+     284:	83 c4 10             	add    $0x10,%esp
+  printf(1, "rdlock ok\n");
+     287:	83 ec 08             	sub    $0x8,%esp
+     28a:	68 da 10 00 00       	push   $0x10da
+     28f:	6a 01                	push   $0x1
+     291:	e8 2f 07 00 00       	call   9c5 <printf>
+     296:	83 c4 10             	add    $0x10,%esp
+  exit();
+     299:	e8 97 02 00 00       	call   535 <exit>
+
+0000029e <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     29e:	55                   	push   %ebp
+     29f:	89 e5                	mov    %esp,%ebp
+     2a1:	57                   	push   %edi
+     2a2:	53                   	push   %ebx
+    if(cc < 1)
+     2a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2a6:	8b 55 10             	mov    0x10(%ebp),%edx
+     2a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ac:	89 cb                	mov    %ecx,%ebx
+     2ae:	89 df                	mov    %ebx,%edi
+     2b0:	89 d1                	mov    %edx,%ecx
+     2b2:	fc                   	cld
+     2b3:	f3 aa                	rep stos %al,%es:(%edi)
+     2b5:	89 ca                	mov    %ecx,%edx
+     2b7:	89 fb                	mov    %edi,%ebx
+     2b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2bc:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     2bf:	90                   	nop
+     2c0:	5b                   	pop    %ebx
+     2c1:	5f                   	pop    %edi
+     2c2:	5d                   	pop    %ebp
+     2c3:	c3                   	ret
+
+000002c4 <strcpy>:
+{
+     2c4:	55                   	push   %ebp
+     2c5:	89 e5                	mov    %esp,%ebp
+     2c7:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     2ca:	8b 45 08             	mov    0x8(%ebp),%eax
+     2cd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2d0:	90                   	nop
+     2d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2d4:	8d 42 01             	lea    0x1(%edx),%eax
+     2d7:	89 45 0c             	mov    %eax,0xc(%ebp)
+     2da:	8b 45 08             	mov    0x8(%ebp),%eax
+     2dd:	8d 48 01             	lea    0x1(%eax),%ecx
+     2e0:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     2e3:	0f b6 12             	movzbl (%edx),%edx
+     2e6:	88 10                	mov    %dl,(%eax)
+     2e8:	0f b6 00             	movzbl (%eax),%eax
+     2eb:	84 c0                	test   %al,%al
+     2ed:	75 e2                	jne    2d1 <strcpy+0xd>
+  return os;
+     2ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2f2:	c9                   	leave
+     2f3:	c3                   	ret
+
+000002f4 <strcmp>:
+{
+     2f4:	55                   	push   %ebp
+     2f5:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     2f7:	eb 08                	jmp    301 <strcmp+0xd>
+    p++, q++;
+     2f9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     2fd:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     301:	8b 45 08             	mov    0x8(%ebp),%eax
+     304:	0f b6 00             	movzbl (%eax),%eax
+     307:	84 c0                	test   %al,%al
+     309:	74 10                	je     31b <strcmp+0x27>
+     30b:	8b 45 08             	mov    0x8(%ebp),%eax
+     30e:	0f b6 10             	movzbl (%eax),%edx
+     311:	8b 45 0c             	mov    0xc(%ebp),%eax
+     314:	0f b6 00             	movzbl (%eax),%eax
+     317:	38 c2                	cmp    %al,%dl
+     319:	74 de                	je     2f9 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     31b:	8b 45 08             	mov    0x8(%ebp),%eax
+     31e:	0f b6 00             	movzbl (%eax),%eax
+     321:	0f b6 d0             	movzbl %al,%edx
+     324:	8b 45 0c             	mov    0xc(%ebp),%eax
+     327:	0f b6 00             	movzbl (%eax),%eax
+     32a:	0f b6 c0             	movzbl %al,%eax
+     32d:	29 c2                	sub    %eax,%edx
+     32f:	89 d0                	mov    %edx,%eax
+}
+     331:	5d                   	pop    %ebp
+     332:	c3                   	ret
+
+00000333 <strlen>:
+{
+     333:	55                   	push   %ebp
+     334:	89 e5                	mov    %esp,%ebp
+     336:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     339:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     340:	eb 04                	jmp    346 <strlen+0x13>
+     342:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     346:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     349:	8b 45 08             	mov    0x8(%ebp),%eax
+     34c:	01 d0                	add    %edx,%eax
+     34e:	0f b6 00             	movzbl (%eax),%eax
+     351:	84 c0                	test   %al,%al
+     353:	75 ed                	jne    342 <strlen+0xf>
+  return n;
+     355:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     358:	c9                   	leave
+     359:	c3                   	ret
+
+0000035a <memset>:
+{
+     35a:	55                   	push   %ebp
+     35b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     35d:	8b 45 10             	mov    0x10(%ebp),%eax
+     360:	50                   	push   %eax
+     361:	ff 75 0c             	push   0xc(%ebp)
+     364:	ff 75 08             	push   0x8(%ebp)
+     367:	e8 32 ff ff ff       	call   29e <stosb>
+     36c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     36f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     372:	c9                   	leave
+     373:	c3                   	ret
+
+00000374 <strchr>:
+{
+     374:	55                   	push   %ebp
+     375:	89 e5                	mov    %esp,%ebp
+     377:	83 ec 04             	sub    $0x4,%esp
+     37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     380:	eb 14                	jmp    396 <strchr+0x22>
+    if(*s == c)
+     382:	8b 45 08             	mov    0x8(%ebp),%eax
+     385:	0f b6 00             	movzbl (%eax),%eax
+     388:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     38b:	75 05                	jne    392 <strchr+0x1e>
+      return (char*)s;
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+     390:	eb 13                	jmp    3a5 <strchr+0x31>
+  for(; *s; s++)
+     392:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     396:	8b 45 08             	mov    0x8(%ebp),%eax
+     399:	0f b6 00             	movzbl (%eax),%eax
+     39c:	84 c0                	test   %al,%al
+     39e:	75 e2                	jne    382 <strchr+0xe>
+  return 0;
+     3a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3a5:	c9                   	leave
+     3a6:	c3                   	ret
+
+000003a7 <gets>:
+{
+     3a7:	55                   	push   %ebp
+     3a8:	89 e5                	mov    %esp,%ebp
+     3aa:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     3ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3b4:	eb 42                	jmp    3f8 <gets+0x51>
+    cc = read(0, &c, 1);
+     3b6:	83 ec 04             	sub    $0x4,%esp
+     3b9:	6a 01                	push   $0x1
+     3bb:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     3be:	50                   	push   %eax
+     3bf:	6a 00                	push   $0x0
+     3c1:	e8 84 01 00 00       	call   54a <read>
+     3c6:	83 c4 10             	add    $0x10,%esp
+     3c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     3cc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3d0:	7e 33                	jle    405 <gets+0x5e>
+    buf[i++] = c;
+     3d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3d5:	8d 50 01             	lea    0x1(%eax),%edx
+     3d8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     3db:	89 c2                	mov    %eax,%edx
+     3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e0:	01 c2                	add    %eax,%edx
+     3e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3e6:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     3e8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3ec:	3c 0a                	cmp    $0xa,%al
+     3ee:	74 16                	je     406 <gets+0x5f>
+     3f0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     3f4:	3c 0d                	cmp    $0xd,%al
+     3f6:	74 0e                	je     406 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     3f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3fb:	83 c0 01             	add    $0x1,%eax
+     3fe:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     401:	7f b3                	jg     3b6 <gets+0xf>
+     403:	eb 01                	jmp    406 <gets+0x5f>
+      break;
+     405:	90                   	nop
+  }
+  buf[i] = '\0';
+     406:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     409:	8b 45 08             	mov    0x8(%ebp),%eax
+     40c:	01 d0                	add    %edx,%eax
+     40e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     411:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     414:	c9                   	leave
+     415:	c3                   	ret
+
+00000416 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     416:	55                   	push   %ebp
+     417:	89 e5                	mov    %esp,%ebp
+     419:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     41c:	83 ec 08             	sub    $0x8,%esp
+     41f:	6a 00                	push   $0x0
+     421:	ff 75 08             	push   0x8(%ebp)
+     424:	e8 44 01 00 00       	call   56d <open>
+     429:	83 c4 10             	add    $0x10,%esp
+     42c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     42f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     433:	79 07                	jns    43c <stat+0x26>
+    return -1;
+     435:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     43a:	eb 25                	jmp    461 <stat+0x4b>
+  r = fstat(fd, st);
+     43c:	83 ec 08             	sub    $0x8,%esp
+     43f:	ff 75 0c             	push   0xc(%ebp)
+     442:	ff 75 f4             	push   -0xc(%ebp)
+     445:	e8 41 01 00 00       	call   58b <fstat>
+     44a:	83 c4 10             	add    $0x10,%esp
+     44d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     450:	83 ec 0c             	sub    $0xc,%esp
+     453:	ff 75 f4             	push   -0xc(%ebp)
+     456:	e8 fd 00 00 00       	call   558 <close>
+     45b:	83 c4 10             	add    $0x10,%esp
+  return r;
+     45e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     461:	c9                   	leave
+     462:	c3                   	ret
+
+00000463 <atoi>:
+
+int
+atoi(const char *s)
+{
+     463:	55                   	push   %ebp
+     464:	89 e5                	mov    %esp,%ebp
+     466:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     469:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     470:	eb 25                	jmp    497 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     472:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     475:	89 d0                	mov    %edx,%eax
+     477:	c1 e0 02             	shl    $0x2,%eax
+     47a:	01 d0                	add    %edx,%eax
+     47c:	01 c0                	add    %eax,%eax
+     47e:	89 c1                	mov    %eax,%ecx
+     480:	8b 45 08             	mov    0x8(%ebp),%eax
+     483:	8d 50 01             	lea    0x1(%eax),%edx
+     486:	89 55 08             	mov    %edx,0x8(%ebp)
+     489:	0f b6 00             	movzbl (%eax),%eax
+     48c:	0f be c0             	movsbl %al,%eax
+     48f:	01 c8                	add    %ecx,%eax
+     491:	83 e8 30             	sub    $0x30,%eax
+     494:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     497:	8b 45 08             	mov    0x8(%ebp),%eax
+     49a:	0f b6 00             	movzbl (%eax),%eax
+     49d:	3c 2f                	cmp    $0x2f,%al
+     49f:	7e 0a                	jle    4ab <atoi+0x48>
+     4a1:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a4:	0f b6 00             	movzbl (%eax),%eax
+     4a7:	3c 39                	cmp    $0x39,%al
+     4a9:	7e c7                	jle    472 <atoi+0xf>
+  return n;
+     4ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4ae:	c9                   	leave
+     4af:	c3                   	ret
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     4bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4bf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     4c2:	eb 17                	jmp    4db <memmove+0x2b>
+    *dst++ = *src++;
+     4c4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     4c7:	8d 42 01             	lea    0x1(%edx),%eax
+     4ca:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     4cd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4d0:	8d 48 01             	lea    0x1(%eax),%ecx
+     4d3:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     4d6:	0f b6 12             	movzbl (%edx),%edx
+     4d9:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     4db:	8b 45 10             	mov    0x10(%ebp),%eax
+     4de:	8d 50 ff             	lea    -0x1(%eax),%edx
+     4e1:	89 55 10             	mov    %edx,0x10(%ebp)
+     4e4:	85 c0                	test   %eax,%eax
+     4e6:	7f dc                	jg     4c4 <memmove+0x14>
+  return vdst;
+     4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4eb:	c9                   	leave
+     4ec:	c3                   	ret
+
+000004ed <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     4ed:	83 3d 8c 14 00 00 00 	cmpl   $0x0,0x148c
+  jg 2f
+     4f4:	7f 2e                	jg     524 <dosyscall+0x37>
+  jl 1f
+     4f6:	7c 29                	jl     521 <dosyscall+0x34>
+  pushl %eax
+     4f8:	50                   	push   %eax
+  pushl %ebx
+     4f9:	53                   	push   %ebx
+  movl $1, %eax
+     4fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     4ff:	0f a2                	cpuid
+  popl %ebx
+     501:	5b                   	pop    %ebx
+  popl %eax
+     502:	58                   	pop    %eax
+  movl $-1, sysmode
+     503:	c7 05 8c 14 00 00 ff 	movl   $0xffffffff,0x148c
+     50a:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     50d:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     513:	74 0c                	je     521 <dosyscall+0x34>
+  movl $1, sysmode
+     515:	c7 05 8c 14 00 00 01 	movl   $0x1,0x148c
+     51c:	00 00 00 
+  jmp 2f
+     51f:	eb 03                	jmp    524 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     521:	cd 40                	int    $0x40
+  ret
+     523:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     524:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+  sysenter
+     52b:	0f 34                	sysenter
+3:
+  ret
+     52d:	c3                   	ret
+
+0000052e <fork>:
+
+SYSCALL(fork)
+     52e:	b8 01 00 00 00       	mov    $0x1,%eax
+     533:	eb b8                	jmp    4ed <dosyscall>
+
+00000535 <exit>:
+SYSCALL(exit)
+     535:	b8 02 00 00 00       	mov    $0x2,%eax
+     53a:	eb b1                	jmp    4ed <dosyscall>
+
+0000053c <wait>:
+SYSCALL(wait)
+     53c:	b8 03 00 00 00       	mov    $0x3,%eax
+     541:	eb aa                	jmp    4ed <dosyscall>
+
+00000543 <pipe>:
+SYSCALL(pipe)
+     543:	b8 04 00 00 00       	mov    $0x4,%eax
+     548:	eb a3                	jmp    4ed <dosyscall>
+
+0000054a <read>:
+SYSCALL(read)
+     54a:	b8 05 00 00 00       	mov    $0x5,%eax
+     54f:	eb 9c                	jmp    4ed <dosyscall>
+
+00000551 <write>:
+SYSCALL(write)
+     551:	b8 10 00 00 00       	mov    $0x10,%eax
+     556:	eb 95                	jmp    4ed <dosyscall>
+
+00000558 <close>:
+SYSCALL(close)
+     558:	b8 15 00 00 00       	mov    $0x15,%eax
+     55d:	eb 8e                	jmp    4ed <dosyscall>
+
+0000055f <kill>:
+SYSCALL(kill)
+     55f:	b8 06 00 00 00       	mov    $0x6,%eax
+     564:	eb 87                	jmp    4ed <dosyscall>
+
+00000566 <exec>:
+SYSCALL(exec)
+     566:	b8 07 00 00 00       	mov    $0x7,%eax
+     56b:	eb 80                	jmp    4ed <dosyscall>
+
+0000056d <open>:
+SYSCALL(open)
+     56d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     572:	e9 76 ff ff ff       	jmp    4ed <dosyscall>
+
+00000577 <mknod>:
+SYSCALL(mknod)
+     577:	b8 11 00 00 00       	mov    $0x11,%eax
+     57c:	e9 6c ff ff ff       	jmp    4ed <dosyscall>
+
+00000581 <unlink>:
+SYSCALL(unlink)
+     581:	b8 12 00 00 00       	mov    $0x12,%eax
+     586:	e9 62 ff ff ff       	jmp    4ed <dosyscall>
+
+0000058b <fstat>:
+SYSCALL(fstat)
+     58b:	b8 08 00 00 00       	mov    $0x8,%eax
+     590:	e9 58 ff ff ff       	jmp    4ed <dosyscall>
+
+00000595 <link>:
+SYSCALL(link)
+     595:	b8 13 00 00 00       	mov    $0x13,%eax
+     59a:	e9 4e ff ff ff       	jmp    4ed <dosyscall>
+
+0000059f <mkdir>:
+SYSCALL(mkdir)
+     59f:	b8 14 00 00 00       	mov    $0x14,%eax
+     5a4:	e9 44 ff ff ff       	jmp    4ed <dosyscall>
+
+000005a9 <chdir>:
+SYSCALL(chdir)
+     5a9:	b8 09 00 00 00       	mov    $0x9,%eax
+     5ae:	e9 3a ff ff ff       	jmp    4ed <dosyscall>
+
+000005b3 <dup>:
+SYSCALL(dup)
+     5b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5b8:	e9 30 ff ff ff       	jmp    4ed <dosyscall>
+
+000005bd <getpid>:
+SYSCALL(getpid)
+     5bd:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5c2:	e9 26 ff ff ff       	jmp    4ed <dosyscall>
+
+000005c7 <sbrk>:
+SYSCALL(sbrk)
+     5c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5cc:	e9 1c ff ff ff       	jmp    4ed <dosyscall>
+
+000005d1 <sleep>:
+SYSCALL(sleep)
+     5d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5d6:	e9 12 ff ff ff       	jmp    4ed <dosyscall>
+
+000005db <uptime>:
+SYSCALL(uptime)
+     5db:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5e0:	e9 08 ff ff ff       	jmp    4ed <dosyscall>
+
+000005e5 <symlink>:
+SYSCALL(symlink)
+     5e5:	b8 16 00 00 00       	mov    $0x16,%eax
+     5ea:	e9 fe fe ff ff       	jmp    4ed <dosyscall>
+
+000005ef <readlink>:
+SYSCALL(readlink)
+     5ef:	b8 17 00 00 00       	mov    $0x17,%eax
+     5f4:	e9 f4 fe ff ff       	jmp    4ed <dosyscall>
+
+000005f9 <fprot>:
+SYSCALL(fprot)
+     5f9:	b8 18 00 00 00       	mov    $0x18,%eax
+     5fe:	e9 ea fe ff ff       	jmp    4ed <dosyscall>
+
+00000603 <funprot>:
+SYSCALL(funprot)
+     603:	b8 19 00 00 00       	mov    $0x19,%eax
+     608:	e9 e0 fe ff ff       	jmp    4ed <dosyscall>
+
+0000060d <funlock>:
+SYSCALL(funlock)
+     60d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     612:	e9 d6 fe ff ff       	jmp    4ed <dosyscall>
+
+00000617 <mmap>:
+SYSCALL(mmap)
+     617:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     61c:	e9 cc fe ff ff       	jmp    4ed <dosyscall>
+
+00000621 <munmap>:
+SYSCALL(munmap)
+     621:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     626:	e9 c2 fe ff ff       	jmp    4ed <dosyscall>
+
+0000062b <sendfile>:
+SYSCALL(sendfile)
+     62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     630:	e9 b8 fe ff ff       	jmp    4ed <dosyscall>
+
+00000635 <readv>:
+SYSCALL(readv)
+     635:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     63a:	e9 ae fe ff ff       	jmp    4ed <dosyscall>
+
+0000063f <writev>:
+SYSCALL(writev)
+     63f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     644:	e9 a4 fe ff ff       	jmp    4ed <dosyscall>
+
+00000649 <pread>:
+SYSCALL(pread)
+     649:	b8 20 00 00 00       	mov    $0x20,%eax
+     64e:	e9 9a fe ff ff       	jmp    4ed <dosyscall>
+
+00000653 <pwrite>:
+SYSCALL(pwrite)
+     653:	b8 21 00 00 00       	mov    $0x21,%eax
+     658:	e9 90 fe ff ff       	jmp    4ed <dosyscall>
+
+0000065d <lseek>:
+SYSCALL(lseek)
+     65d:	b8 22 00 00 00       	mov    $0x22,%eax
+     662:	e9 86 fe ff ff       	jmp    4ed <dosyscall>
+
+00000667 <spawn>:
+SYSCALL(spawn)
+     667:	b8 23 00 00 00       	mov    $0x23,%eax
+     66c:	e9 7c fe ff ff       	jmp    4ed <dosyscall>
+
+00000671 <setpriority>:
+SYSCALL(setpriority)
+     671:	b8 24 00 00 00       	mov    $0x24,%eax
+     676:	e9 72 fe ff ff       	jmp    4ed <dosyscall>
+
+0000067b <kthread_create>:
+SYSCALL(kthread_create)
+     67b:	b8 25 00 00 00       	mov    $0x25,%eax
+     680:	e9 68 fe ff ff       	jmp    4ed <dosyscall>
+
+00000685 <kthread_id>:
+SYSCALL(kthread_id)
+     685:	b8 26 00 00 00       	mov    $0x26,%eax
+     68a:	e9 5e fe ff ff       	jmp    4ed <dosyscall>
+
+0000068f <kthread_exit>:
+SYSCALL(kthread_exit)
+     68f:	b8 27 00 00 00       	mov    $0x27,%eax
+     694:	e9 54 fe ff ff       	jmp    4ed <dosyscall>
+
+00000699 <kthread_join>:
+SYSCALL(kthread_join)
+     699:	b8 28 00 00 00       	mov    $0x28,%eax
+     69e:	e9 4a fe ff ff       	jmp    4ed <dosyscall>
+
+000006a3 <futex>:
+SYSCALL(futex)
+     6a3:	b8 29 00 00 00       	mov    $0x29,%eax
+     6a8:	e9 40 fe ff ff       	jmp    4ed <dosyscall>
+
+000006ad <signal>:
+SYSCALL(signal)
+     6ad:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     6b2:	e9 36 fe ff ff       	jmp    4ed <dosyscall>
+
+000006b7 <alarm>:
+SYSCALL(alarm)
+     6b7:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6bc:	e9 2c fe ff ff       	jmp    4ed <dosyscall>
+
+000006c1 <usleep>:
+SYSCALL(usleep)
+     6c1:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6c6:	e9 22 fe ff ff       	jmp    4ed <dosyscall>
+
+000006cb <ioring_setup>:
+SYSCALL(ioring_setup)
+     6cb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6d0:	e9 18 fe ff ff       	jmp    4ed <dosyscall>
+
+000006d5 <ioring_enter>:
+SYSCALL(ioring_enter)
+     6d5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6da:	e9 0e fe ff ff       	jmp    4ed <dosyscall>
+
+000006df <getrusage>:
+SYSCALL(getrusage)
+     6df:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6e4:	e9 04 fe ff ff       	jmp    4ed <dosyscall>
+
+000006e9 <mount>:
+SYSCALL(mount)
+     6e9:	b8 30 00 00 00       	mov    $0x30,%eax
+     6ee:	e9 fa fd ff ff       	jmp    4ed <dosyscall>
+
+000006f3 <getdents>:
+SYSCALL(getdents)
+     6f3:	b8 31 00 00 00       	mov    $0x31,%eax
+     6f8:	e9 f0 fd ff ff       	jmp    4ed <dosyscall>
+
+000006fd <yield>:
+SYSCALL(yield)
+     6fd:	b8 32 00 00 00       	mov    $0x32,%eax
+     702:	e9 e6 fd ff ff       	jmp    4ed <dosyscall>
+
+00000707 <ncpu>:
+SYSCALL(ncpu)
+     707:	b8 33 00 00 00       	mov    $0x33,%eax
+     70c:	e9 dc fd ff ff       	jmp    4ed <dosyscall>
+
+00000711 <fallocate>:
+SYSCALL(fallocate)
+     711:	b8 34 00 00 00       	mov    $0x34,%eax
+     716:	e9 d2 fd ff ff       	jmp    4ed <dosyscall>
+
+0000071b <ftruncate>:
+SYSCALL(ftruncate)
+     71b:	b8 35 00 00 00       	mov    $0x35,%eax
+     720:	e9 c8 fd ff ff       	jmp    4ed <dosyscall>
+
+00000725 <fsync>:
+SYSCALL(fsync)
+     725:	b8 36 00 00 00       	mov    $0x36,%eax
+     72a:	e9 be fd ff ff       	jmp    4ed <dosyscall>
+
+0000072f <fdatasync>:
+SYSCALL(fdatasync)
+     72f:	b8 37 00 00 00       	mov    $0x37,%eax
+     734:	e9 b4 fd ff ff       	jmp    4ed <dosyscall>
+
+00000739 <poll>:
+SYSCALL(poll)
+     739:	b8 38 00 00 00       	mov    $0x38,%eax
+     73e:	e9 aa fd ff ff       	jmp    4ed <dosyscall>
+
+00000743 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     743:	55                   	push   %ebp
+     744:	89 e5                	mov    %esp,%ebp
+     746:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     749:	8b 45 08             	mov    0x8(%ebp),%eax
+     74c:	8b 40 04             	mov    0x4(%eax),%eax
+     74f:	85 c0                	test   %eax,%eax
+     751:	7e 1f                	jle    772 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     753:	8b 45 08             	mov    0x8(%ebp),%eax
+     756:	8b 50 04             	mov    0x4(%eax),%edx
+     759:	8b 45 08             	mov    0x8(%ebp),%eax
+     75c:	8d 48 08             	lea    0x8(%eax),%ecx
+     75f:	8b 45 08             	mov    0x8(%ebp),%eax
+     762:	8b 00                	mov    (%eax),%eax
+     764:	83 ec 04             	sub    $0x4,%esp
+     767:	52                   	push   %edx
+     768:	51                   	push   %ecx
+     769:	50                   	push   %eax
+     76a:	e8 d0 fe ff ff       	call   63f <writev>
+     76f:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     772:	8b 45 08             	mov    0x8(%ebp),%eax
+     775:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     77c:	8b 45 08             	mov    0x8(%ebp),%eax
+     77f:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     786:	00 00 00 
+}
+     789:	90                   	nop
+     78a:	c9                   	leave
+     78b:	c3                   	ret
+
+0000078c <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     78c:	55                   	push   %ebp
+     78d:	89 e5                	mov    %esp,%ebp
+     78f:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     792:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     796:	0f 84 94 00 00 00    	je     830 <put+0xa4>
+    return;
+  if(o->n > 0){
+     79c:	8b 45 08             	mov    0x8(%ebp),%eax
+     79f:	8b 40 04             	mov    0x4(%eax),%eax
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	7e 40                	jle    7e6 <put+0x5a>
+    v = &o->iov[o->n-1];
+     7a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a9:	8b 40 04             	mov    0x4(%eax),%eax
+     7ac:	83 e8 01             	sub    $0x1,%eax
+     7af:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     7b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b9:	01 d0                	add    %edx,%eax
+     7bb:	83 c0 08             	add    $0x8,%eax
+     7be:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     7c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7c4:	8b 10                	mov    (%eax),%edx
+     7c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7c9:	8b 40 04             	mov    0x4(%eax),%eax
+     7cc:	01 d0                	add    %edx,%eax
+     7ce:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     7d1:	75 13                	jne    7e6 <put+0x5a>
+      v->iov_len += n;
+     7d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d6:	8b 50 04             	mov    0x4(%eax),%edx
+     7d9:	8b 45 10             	mov    0x10(%ebp),%eax
+     7dc:	01 c2                	add    %eax,%edx
+     7de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7e1:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     7e4:	eb 4b                	jmp    831 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e9:	8b 40 04             	mov    0x4(%eax),%eax
+     7ec:	83 f8 10             	cmp    $0x10,%eax
+     7ef:	75 0e                	jne    7ff <put+0x73>
+    flush(o);
+     7f1:	83 ec 0c             	sub    $0xc,%esp
+     7f4:	ff 75 08             	push   0x8(%ebp)
+     7f7:	e8 47 ff ff ff       	call   743 <flush>
+     7fc:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     7ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     802:	8b 50 04             	mov    0x4(%eax),%edx
+     805:	8b 45 08             	mov    0x8(%ebp),%eax
+     808:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     80b:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     80f:	8b 45 08             	mov    0x8(%ebp),%eax
+     812:	8b 50 04             	mov    0x4(%eax),%edx
+     815:	8b 45 08             	mov    0x8(%ebp),%eax
+     818:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     81b:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     81f:	8b 45 08             	mov    0x8(%ebp),%eax
+     822:	8b 40 04             	mov    0x4(%eax),%eax
+     825:	8d 50 01             	lea    0x1(%eax),%edx
+     828:	8b 45 08             	mov    0x8(%ebp),%eax
+     82b:	89 50 04             	mov    %edx,0x4(%eax)
+     82e:	eb 01                	jmp    831 <put+0xa5>
+    return;
+     830:	90                   	nop
+}
+     831:	c9                   	leave
+     832:	c3                   	ret
+
+00000833 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     833:	55                   	push   %ebp
+     834:	89 e5                	mov    %esp,%ebp
+     836:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     839:	8b 45 08             	mov    0x8(%ebp),%eax
+     83c:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     842:	8b 45 0c             	mov    0xc(%ebp),%eax
+     845:	01 d0                	add    %edx,%eax
+     847:	3d 80 00 00 00       	cmp    $0x80,%eax
+     84c:	77 0b                	ja     859 <room+0x26>
+     84e:	8b 45 08             	mov    0x8(%ebp),%eax
+     851:	8b 40 04             	mov    0x4(%eax),%eax
+     854:	83 f8 10             	cmp    $0x10,%eax
+     857:	75 0e                	jne    867 <room+0x34>
+    flush(o);
+     859:	83 ec 0c             	sub    $0xc,%esp
+     85c:	ff 75 08             	push   0x8(%ebp)
+     85f:	e8 df fe ff ff       	call   743 <flush>
+     864:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     867:	8b 45 08             	mov    0x8(%ebp),%eax
+     86a:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     870:	8b 45 08             	mov    0x8(%ebp),%eax
+     873:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     879:	01 d0                	add    %edx,%eax
+}
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+0000087d <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     87d:	55                   	push   %ebp
+     87e:	89 e5                	mov    %esp,%ebp
+     880:	83 ec 28             	sub    $0x28,%esp
+     883:	8b 45 0c             	mov    0xc(%ebp),%eax
+     886:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     889:	83 ec 08             	sub    $0x8,%esp
+     88c:	6a 01                	push   $0x1
+     88e:	ff 75 08             	push   0x8(%ebp)
+     891:	e8 9d ff ff ff       	call   833 <room>
+     896:	83 c4 10             	add    $0x10,%esp
+     899:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     89c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     89f:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     8a3:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     8a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     8ae:	8d 50 01             	lea    0x1(%eax),%edx
+     8b1:	8b 45 08             	mov    0x8(%ebp),%eax
+     8b4:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     8ba:	83 ec 04             	sub    $0x4,%esp
+     8bd:	6a 01                	push   $0x1
+     8bf:	ff 75 f4             	push   -0xc(%ebp)
+     8c2:	ff 75 08             	push   0x8(%ebp)
+     8c5:	e8 c2 fe ff ff       	call   78c <put>
+     8ca:	83 c4 10             	add    $0x10,%esp
+}
+     8cd:	90                   	nop
+     8ce:	c9                   	leave
+     8cf:	c3                   	ret
+
+000008d0 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     8d6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8dd:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8e1:	74 17                	je     8fa <printint+0x2a>
+     8e3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8e7:	79 11                	jns    8fa <printint+0x2a>
+    neg = 1;
+     8e9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     8f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8f3:	f7 d8                	neg    %eax
+     8f5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8f8:	eb 06                	jmp    900 <printint+0x30>
+  } else {
+    x = xx;
+     8fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     900:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     907:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     90a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     90d:	ba 00 00 00 00       	mov    $0x0,%edx
+     912:	f7 f1                	div    %ecx
+     914:	89 d1                	mov    %edx,%ecx
+     916:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     919:	8d 50 01             	lea    0x1(%eax),%edx
+     91c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     91f:	0f b6 91 90 14 00 00 	movzbl 0x1490(%ecx),%edx
+     926:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     92a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     92d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     930:	ba 00 00 00 00       	mov    $0x0,%edx
+     935:	f7 f1                	div    %ecx
+     937:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     93a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     93e:	75 c7                	jne    907 <printint+0x37>
+  if(neg)
+     940:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     944:	74 0e                	je     954 <printint+0x84>
+    buf[i++] = '-';
+     946:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     949:	8d 50 01             	lea    0x1(%eax),%edx
+     94c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     94f:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     954:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     957:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     95a:	83 ec 08             	sub    $0x8,%esp
+     95d:	ff 75 e8             	push   -0x18(%ebp)
+     960:	ff 75 08             	push   0x8(%ebp)
+     963:	e8 cb fe ff ff       	call   833 <room>
+     968:	83 c4 10             	add    $0x10,%esp
+     96b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     96e:	eb 1d                	jmp    98d <printint+0xbd>
+    p[n-1-i] = buf[i];
+     970:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     973:	83 e8 01             	sub    $0x1,%eax
+     976:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     979:	89 c2                	mov    %eax,%edx
+     97b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     97e:	01 c2                	add    %eax,%edx
+     980:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     986:	01 c8                	add    %ecx,%eax
+     988:	0f b6 00             	movzbl (%eax),%eax
+     98b:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     98d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     991:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     995:	79 d9                	jns    970 <printint+0xa0>
+  o->used += n;
+     997:	8b 45 08             	mov    0x8(%ebp),%eax
+     99a:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     9a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a3:	01 c2                	add    %eax,%edx
+     9a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a8:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     9ae:	83 ec 04             	sub    $0x4,%esp
+     9b1:	ff 75 e8             	push   -0x18(%ebp)
+     9b4:	ff 75 e4             	push   -0x1c(%ebp)
+     9b7:	ff 75 08             	push   0x8(%ebp)
+     9ba:	e8 cd fd ff ff       	call   78c <put>
+     9bf:	83 c4 10             	add    $0x10,%esp
+}
+     9c2:	90                   	nop
+     9c3:	c9                   	leave
+     9c4:	c3                   	ret
+
+000009c5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9c5:	55                   	push   %ebp
+     9c6:	89 e5                	mov    %esp,%ebp
+     9c8:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     9ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d1:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     9d7:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     9de:	00 00 00 
+  o.used = 0;
+     9e1:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     9e8:	00 00 00 
+  state = 0;
+     9eb:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     9f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+     9f5:	83 c0 04             	add    $0x4,%eax
+     9f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     9fb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a02:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a09:	e9 82 01 00 00       	jmp    b90 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     a0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a14:	01 d0                	add    %edx,%eax
+     a16:	0f b6 00             	movzbl (%eax),%eax
+     a19:	0f be c0             	movsbl %al,%eax
+     a1c:	25 ff 00 00 00       	and    $0xff,%eax
+     a21:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     a24:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     a28:	75 38                	jne    a62 <printf+0x9d>
+      if(c == '%'){
+     a2a:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     a2e:	0f 85 58 01 00 00    	jne    b8c <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     a34:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a37:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     a3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a3d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a40:	01 ca                	add    %ecx,%edx
+     a42:	83 ec 04             	sub    $0x4,%esp
+     a45:	50                   	push   %eax
+     a46:	52                   	push   %edx
+     a47:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a4d:	50                   	push   %eax
+     a4e:	e8 39 fd ff ff       	call   78c <put>
+     a53:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     a56:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     a5d:	e9 2a 01 00 00       	jmp    b8c <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     a62:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     a66:	0f 85 20 01 00 00    	jne    b8c <printf+0x1c7>
+      if(c == 'd'){
+     a6c:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a70:	75 22                	jne    a94 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a75:	8b 00                	mov    (%eax),%eax
+     a77:	6a 01                	push   $0x1
+     a79:	6a 0a                	push   $0xa
+     a7b:	50                   	push   %eax
+     a7c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a82:	50                   	push   %eax
+     a83:	e8 48 fe ff ff       	call   8d0 <printint>
+     a88:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a8b:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a8f:	e9 e8 00 00 00       	jmp    b7c <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     a94:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     a98:	74 06                	je     aa0 <printf+0xdb>
+     a9a:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     a9e:	75 22                	jne    ac2 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     aa0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aa3:	8b 00                	mov    (%eax),%eax
+     aa5:	6a 00                	push   $0x0
+     aa7:	6a 10                	push   $0x10
+     aa9:	50                   	push   %eax
+     aaa:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ab0:	50                   	push   %eax
+     ab1:	e8 1a fe ff ff       	call   8d0 <printint>
+     ab6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ab9:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     abd:	e9 ba 00 00 00       	jmp    b7c <printf+0x1b7>
+      } else if(c == 's'){
+     ac2:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     ac6:	75 3f                	jne    b07 <printf+0x142>
+        s = (char*)*ap;
+     ac8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     acb:	8b 00                	mov    (%eax),%eax
+     acd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     ad0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     ad4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ad8:	75 07                	jne    ae1 <printf+0x11c>
+          s = "(null)";
+     ada:	c7 45 f4 e5 10 00 00 	movl   $0x10e5,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     ae1:	83 ec 0c             	sub    $0xc,%esp
+     ae4:	ff 75 f4             	push   -0xc(%ebp)
+     ae7:	e8 47 f8 ff ff       	call   333 <strlen>
+     aec:	83 c4 10             	add    $0x10,%esp
+     aef:	83 ec 04             	sub    $0x4,%esp
+     af2:	50                   	push   %eax
+     af3:	ff 75 f4             	push   -0xc(%ebp)
+     af6:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     afc:	50                   	push   %eax
+     afd:	e8 8a fc ff ff       	call   78c <put>
+     b02:	83 c4 10             	add    $0x10,%esp
+     b05:	eb 75                	jmp    b7c <printf+0x1b7>
+      } else if(c == 'c'){
+     b07:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     b0b:	75 21                	jne    b2e <printf+0x169>
+        putc(&o, *ap);
+     b0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b10:	8b 00                	mov    (%eax),%eax
+     b12:	0f be c0             	movsbl %al,%eax
+     b15:	83 ec 08             	sub    $0x8,%esp
+     b18:	50                   	push   %eax
+     b19:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b1f:	50                   	push   %eax
+     b20:	e8 58 fd ff ff       	call   87d <putc>
+     b25:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b28:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     b2c:	eb 4e                	jmp    b7c <printf+0x1b7>
+      } else if(c == '%'){
+     b2e:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b32:	75 1b                	jne    b4f <printf+0x18a>
+        putc(&o, c);
+     b34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b37:	0f be c0             	movsbl %al,%eax
+     b3a:	83 ec 08             	sub    $0x8,%esp
+     b3d:	50                   	push   %eax
+     b3e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b44:	50                   	push   %eax
+     b45:	e8 33 fd ff ff       	call   87d <putc>
+     b4a:	83 c4 10             	add    $0x10,%esp
+     b4d:	eb 2d                	jmp    b7c <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     b4f:	83 ec 08             	sub    $0x8,%esp
+     b52:	6a 25                	push   $0x25
+     b54:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b5a:	50                   	push   %eax
+     b5b:	e8 1d fd ff ff       	call   87d <putc>
+     b60:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     b63:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b66:	0f be c0             	movsbl %al,%eax
+     b69:	83 ec 08             	sub    $0x8,%esp
+     b6c:	50                   	push   %eax
+     b6d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b73:	50                   	push   %eax
+     b74:	e8 04 fd ff ff       	call   87d <putc>
+     b79:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b7c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     b83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b86:	83 c0 01             	add    $0x1,%eax
+     b89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b8c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b90:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b96:	01 d0                	add    %edx,%eax
+     b98:	0f b6 00             	movzbl (%eax),%eax
+     b9b:	84 c0                	test   %al,%al
+     b9d:	0f 85 6b fe ff ff    	jne    a0e <printf+0x49>
+    }
+  }
+  if(state == 0)
+     ba3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ba7:	75 22                	jne    bcb <printf+0x206>
+    put(&o, fmt + start, i - start);
+     ba9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bac:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     baf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     bb2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     bb5:	01 ca                	add    %ecx,%edx
+     bb7:	83 ec 04             	sub    $0x4,%esp
+     bba:	50                   	push   %eax
+     bbb:	52                   	push   %edx
+     bbc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bc2:	50                   	push   %eax
+     bc3:	e8 c4 fb ff ff       	call   78c <put>
+     bc8:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     bcb:	83 ec 0c             	sub    $0xc,%esp
+     bce:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bd4:	50                   	push   %eax
+     bd5:	e8 69 fb ff ff       	call   743 <flush>
+     bda:	83 c4 10             	add    $0x10,%esp
+}
+     bdd:	90                   	nop
+     bde:	c9                   	leave
+     bdf:	c3                   	ret
+
+00000be0 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     be6:	8b 55 08             	mov    0x8(%ebp),%edx
+     be9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     bef:	f0 87 02             	lock xchg %eax,(%edx)
+     bf2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     bf5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     bf8:	c9                   	leave
+     bf9:	c3                   	ret
+
+00000bfa <lock>:
+{
+     bfa:	55                   	push   %ebp
+     bfb:	89 e5                	mov    %esp,%ebp
+     bfd:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     c00:	a1 a4 75 00 00       	mov    0x75a4,%eax
+     c05:	85 c0                	test   %eax,%eax
+     c07:	74 09                	je     c12 <lock+0x18>
+     c09:	a1 a4 75 00 00       	mov    0x75a4,%eax
+     c0e:	ff d0                	call   *%eax
+     c10:	eb 05                	jmp    c17 <lock+0x1d>
+     c12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c17:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     c1a:	90                   	nop
+     c1b:	83 ec 08             	sub    $0x8,%esp
+     c1e:	6a 01                	push   $0x1
+     c20:	68 dc 75 00 00       	push   $0x75dc
+     c25:	e8 b6 ff ff ff       	call   be0 <xchg>
+     c2a:	83 c4 10             	add    $0x10,%esp
+     c2d:	85 c0                	test   %eax,%eax
+     c2f:	75 ea                	jne    c1b <lock+0x21>
+  return pin;
+     c31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     c34:	c9                   	leave
+     c35:	c3                   	ret
+
+00000c36 <unlock>:
+{
+     c36:	55                   	push   %ebp
+     c37:	89 e5                	mov    %esp,%ebp
+     c39:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     c3c:	6a 00                	push   $0x0
+     c3e:	68 dc 75 00 00       	push   $0x75dc
+     c43:	e8 98 ff ff ff       	call   be0 <xchg>
+     c48:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     c4b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c4f:	78 10                	js     c61 <unlock+0x2b>
+    mallocunpin(pin);
+     c51:	a1 a8 75 00 00       	mov    0x75a8,%eax
+     c56:	83 ec 0c             	sub    $0xc,%esp
+     c59:	ff 75 08             	push   0x8(%ebp)
+     c5c:	ff d0                	call   *%eax
+     c5e:	83 c4 10             	add    $0x10,%esp
+}
+     c61:	90                   	nop
+     c62:	c9                   	leave
+     c63:	c3                   	ret
+
+00000c64 <sizeclass>:
+{
+     c64:	55                   	push   %ebp
+     c65:	89 e5                	mov    %esp,%ebp
+     c67:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c6a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c71:	eb 1c                	jmp    c8f <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     c73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c76:	ba 02 00 00 00       	mov    $0x2,%edx
+     c7b:	89 c1                	mov    %eax,%ecx
+     c7d:	d3 e2                	shl    %cl,%edx
+     c7f:	89 d0                	mov    %edx,%eax
+     c81:	3b 45 08             	cmp    0x8(%ebp),%eax
+     c84:	72 05                	jb     c8b <sizeclass+0x27>
+      return c;
+     c86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c89:	eb 0f                	jmp    c9a <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     c8b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     c8f:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     c93:	7e de                	jle    c73 <sizeclass+0xf>
+  return -1;
+     c95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     c9a:	c9                   	leave
+     c9b:	c3                   	ret
+
+00000c9c <bigfree>:
+{
+     c9c:	55                   	push   %ebp
+     c9d:	89 e5                	mov    %esp,%ebp
+     c9f:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ca2:	a1 b4 75 00 00       	mov    0x75b4,%eax
+     ca7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     caa:	eb 24                	jmp    cd0 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     caf:	8b 00                	mov    (%eax),%eax
+     cb1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cb4:	72 12                	jb     cc8 <bigfree+0x2c>
+     cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cbc:	72 24                	jb     ce2 <bigfree+0x46>
+     cbe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cc1:	8b 00                	mov    (%eax),%eax
+     cc3:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cc6:	72 1a                	jb     ce2 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cc8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ccb:	8b 00                	mov    (%eax),%eax
+     ccd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     cd6:	73 d4                	jae    cac <bigfree+0x10>
+     cd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cdb:	8b 00                	mov    (%eax),%eax
+     cdd:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ce0:	73 ca                	jae    cac <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce5:	8b 40 04             	mov    0x4(%eax),%eax
+     ce8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     cef:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf2:	01 c2                	add    %eax,%edx
+     cf4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cf7:	8b 00                	mov    (%eax),%eax
+     cf9:	39 c2                	cmp    %eax,%edx
+     cfb:	75 24                	jne    d21 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+     d00:	8b 50 04             	mov    0x4(%eax),%edx
+     d03:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d06:	8b 00                	mov    (%eax),%eax
+     d08:	8b 40 04             	mov    0x4(%eax),%eax
+     d0b:	01 c2                	add    %eax,%edx
+     d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d10:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d16:	8b 00                	mov    (%eax),%eax
+     d18:	8b 10                	mov    (%eax),%edx
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1d:	89 10                	mov    %edx,(%eax)
+     d1f:	eb 0a                	jmp    d2b <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     d21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d24:	8b 10                	mov    (%eax),%edx
+     d26:	8b 45 08             	mov    0x8(%ebp),%eax
+     d29:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     d2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d2e:	8b 40 04             	mov    0x4(%eax),%eax
+     d31:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     d38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d3b:	01 d0                	add    %edx,%eax
+     d3d:	39 45 08             	cmp    %eax,0x8(%ebp)
+     d40:	75 20                	jne    d62 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     d42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d45:	8b 50 04             	mov    0x4(%eax),%edx
+     d48:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4b:	8b 40 04             	mov    0x4(%eax),%eax
+     d4e:	01 c2                	add    %eax,%edx
+     d50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d53:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     d56:	8b 45 08             	mov    0x8(%ebp),%eax
+     d59:	8b 10                	mov    (%eax),%edx
+     d5b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d5e:	89 10                	mov    %edx,(%eax)
+     d60:	eb 08                	jmp    d6a <bigfree+0xce>
+    p->s.ptr = bp;
+     d62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d65:	8b 55 08             	mov    0x8(%ebp),%edx
+     d68:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d6d:	a3 b4 75 00 00       	mov    %eax,0x75b4
+}
+     d72:	90                   	nop
+     d73:	c9                   	leave
+     d74:	c3                   	ret
+
+00000d75 <free>:
+{
+     d75:	55                   	push   %ebp
+     d76:	89 e5                	mov    %esp,%ebp
+     d78:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     d7b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d7f:	74 68                	je     de9 <free+0x74>
+  bp = (Header*)ap - 1;
+     d81:	8b 45 08             	mov    0x8(%ebp),%eax
+     d84:	83 e8 08             	sub    $0x8,%eax
+     d87:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     d8a:	e8 6b fe ff ff       	call   bfa <lock>
+     d8f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     d92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d95:	8b 40 04             	mov    0x4(%eax),%eax
+     d98:	83 ec 0c             	sub    $0xc,%esp
+     d9b:	50                   	push   %eax
+     d9c:	e8 c3 fe ff ff       	call   c64 <sizeclass>
+     da1:	83 c4 10             	add    $0x10,%esp
+     da4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     da7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     dab:	78 1e                	js     dcb <free+0x56>
+    bp->s.ptr = classfree[c];
+     dad:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     db0:	8b 14 85 b8 75 00 00 	mov    0x75b8(,%eax,4),%edx
+     db7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dba:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     dbc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dbf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     dc2:	89 14 85 b8 75 00 00 	mov    %edx,0x75b8(,%eax,4)
+     dc9:	eb 0e                	jmp    dd9 <free+0x64>
+    bigfree(bp);
+     dcb:	83 ec 0c             	sub    $0xc,%esp
+     dce:	ff 75 f4             	push   -0xc(%ebp)
+     dd1:	e8 c6 fe ff ff       	call   c9c <bigfree>
+     dd6:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     dd9:	83 ec 0c             	sub    $0xc,%esp
+     ddc:	ff 75 f0             	push   -0x10(%ebp)
+     ddf:	e8 52 fe ff ff       	call   c36 <unlock>
+     de4:	83 c4 10             	add    $0x10,%esp
+     de7:	eb 01                	jmp    dea <free+0x75>
+    return;
+     de9:	90                   	nop
+}
+     dea:	c9                   	leave
+     deb:	c3                   	ret
+
+00000dec <morecore>:
+{
+     dec:	55                   	push   %ebp
+     ded:	89 e5                	mov    %esp,%ebp
+     def:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     df2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     df9:	77 07                	ja     e02 <morecore+0x16>
+    nu = 4096;
+     dfb:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     e02:	8b 45 08             	mov    0x8(%ebp),%eax
+     e05:	c1 e0 03             	shl    $0x3,%eax
+     e08:	83 ec 0c             	sub    $0xc,%esp
+     e0b:	50                   	push   %eax
+     e0c:	e8 b6 f7 ff ff       	call   5c7 <sbrk>
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     e17:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     e1b:	75 07                	jne    e24 <morecore+0x38>
+    return 0;
+     e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e22:	eb 22                	jmp    e46 <morecore+0x5a>
+  hp = (Header*)p;
+     e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e27:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     e2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+     e30:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     e33:	83 ec 0c             	sub    $0xc,%esp
+     e36:	ff 75 f0             	push   -0x10(%ebp)
+     e39:	e8 5e fe ff ff       	call   c9c <bigfree>
+     e3e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     e41:	a1 b4 75 00 00       	mov    0x75b4,%eax
+}
+     e46:	c9                   	leave
+     e47:	c3                   	ret
+
+00000e48 <bigalloc>:
+{
+     e48:	55                   	push   %ebp
+     e49:	89 e5                	mov    %esp,%ebp
+     e4b:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     e4e:	a1 b4 75 00 00       	mov    0x75b4,%eax
+     e53:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e56:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e5a:	75 23                	jne    e7f <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     e5c:	c7 45 f0 ac 75 00 00 	movl   $0x75ac,-0x10(%ebp)
+     e63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e66:	a3 b4 75 00 00       	mov    %eax,0x75b4
+     e6b:	a1 b4 75 00 00       	mov    0x75b4,%eax
+     e70:	a3 ac 75 00 00       	mov    %eax,0x75ac
+    base.s.size = 0;
+     e75:	c7 05 b0 75 00 00 00 	movl   $0x0,0x75b0
+     e7c:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e82:	8b 00                	mov    (%eax),%eax
+     e84:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     e87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8a:	8b 40 04             	mov    0x4(%eax),%eax
+     e8d:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e90:	72 4a                	jb     edc <bigalloc+0x94>
+      if(p->s.size == nunits)
+     e92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e95:	8b 40 04             	mov    0x4(%eax),%eax
+     e98:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e9b:	75 0c                	jne    ea9 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	8b 10                	mov    (%eax),%edx
+     ea2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ea5:	89 10                	mov    %edx,(%eax)
+     ea7:	eb 26                	jmp    ecf <bigalloc+0x87>
+        p->s.size -= nunits;
+     ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eac:	8b 40 04             	mov    0x4(%eax),%eax
+     eaf:	2b 45 08             	sub    0x8(%ebp),%eax
+     eb2:	89 c2                	mov    %eax,%edx
+     eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     eba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebd:	8b 40 04             	mov    0x4(%eax),%eax
+     ec0:	c1 e0 03             	shl    $0x3,%eax
+     ec3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     ec6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec9:	8b 55 08             	mov    0x8(%ebp),%edx
+     ecc:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     ecf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed2:	a3 b4 75 00 00       	mov    %eax,0x75b4
+      return p;
+     ed7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eda:	eb 3b                	jmp    f17 <bigalloc+0xcf>
+    if(p == freep)
+     edc:	a1 b4 75 00 00       	mov    0x75b4,%eax
+     ee1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     ee4:	75 1e                	jne    f04 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     ee6:	83 ec 0c             	sub    $0xc,%esp
+     ee9:	ff 75 08             	push   0x8(%ebp)
+     eec:	e8 fb fe ff ff       	call   dec <morecore>
+     ef1:	83 c4 10             	add    $0x10,%esp
+     ef4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ef7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     efb:	75 07                	jne    f04 <bigalloc+0xbc>
+        return 0;
+     efd:	b8 00 00 00 00       	mov    $0x0,%eax
+     f02:	eb 13                	jmp    f17 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f07:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0d:	8b 00                	mov    (%eax),%eax
+     f0f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f12:	e9 70 ff ff ff       	jmp    e87 <bigalloc+0x3f>
+}
+     f17:	c9                   	leave
+     f18:	c3                   	ret
+
+00000f19 <alloc>:
+alloc(uint nbytes)
+{
+     f19:	55                   	push   %ebp
+     f1a:	89 e5                	mov    %esp,%ebp
+     f1c:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f22:	83 c0 07             	add    $0x7,%eax
+     f25:	c1 e8 03             	shr    $0x3,%eax
+     f28:	83 c0 01             	add    $0x1,%eax
+     f2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     f2e:	ff 75 f4             	push   -0xc(%ebp)
+     f31:	e8 2e fd ff ff       	call   c64 <sizeclass>
+     f36:	83 c4 04             	add    $0x4,%esp
+     f39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f3c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f40:	79 2c                	jns    f6e <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     f42:	83 ec 0c             	sub    $0xc,%esp
+     f45:	ff 75 f4             	push   -0xc(%ebp)
+     f48:	e8 fb fe ff ff       	call   e48 <bigalloc>
+     f4d:	83 c4 10             	add    $0x10,%esp
+     f50:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f53:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f57:	75 0a                	jne    f63 <alloc+0x4a>
+      return 0;
+     f59:	b8 00 00 00 00       	mov    $0x0,%eax
+     f5e:	e9 c8 00 00 00       	jmp    102b <alloc+0x112>
+    return (void*)(p + 1);
+     f63:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f66:	83 c0 08             	add    $0x8,%eax
+     f69:	e9 bd 00 00 00       	jmp    102b <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f6e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f71:	8b 04 85 b8 75 00 00 	mov    0x75b8(,%eax,4),%eax
+     f78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f7b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f7f:	74 1a                	je     f9b <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     f81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f84:	8b 10                	mov    (%eax),%edx
+     f86:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f89:	89 14 85 b8 75 00 00 	mov    %edx,0x75b8(,%eax,4)
+    return (void*)(p + 1);
+     f90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f93:	83 c0 08             	add    $0x8,%eax
+     f96:	e9 90 00 00 00       	jmp    102b <alloc+0x112>
+  }
+  nunits = 2 << c;
+     f9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f9e:	ba 02 00 00 00       	mov    $0x2,%edx
+     fa3:	89 c1                	mov    %eax,%ecx
+     fa5:	d3 e2                	shl    %cl,%edx
+     fa7:	89 d0                	mov    %edx,%eax
+     fa9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     fac:	a1 d4 75 00 00       	mov    0x75d4,%eax
+     fb1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fb4:	c1 e2 03             	shl    $0x3,%edx
+     fb7:	01 d0                	add    %edx,%eax
+     fb9:	8b 15 d8 75 00 00    	mov    0x75d8,%edx
+     fbf:	39 c2                	cmp    %eax,%edx
+     fc1:	73 3f                	jae    1002 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     fc3:	83 ec 0c             	sub    $0xc,%esp
+     fc6:	68 00 08 00 00       	push   $0x800
+     fcb:	e8 78 fe ff ff       	call   e48 <bigalloc>
+     fd0:	83 c4 10             	add    $0x10,%esp
+     fd3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fd6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fda:	75 07                	jne    fe3 <alloc+0xca>
+      return 0;
+     fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe1:	eb 48                	jmp    102b <alloc+0x112>
+    bump = (char*)p;
+     fe3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fe6:	a3 d4 75 00 00       	mov    %eax,0x75d4
+    bumpend = (char*)(p + p->s.size);
+     feb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fee:	8b 40 04             	mov    0x4(%eax),%eax
+     ff1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     ff8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ffb:	01 d0                	add    %edx,%eax
+     ffd:	a3 d8 75 00 00       	mov    %eax,0x75d8
+  }
+  p = (Header*)bump;
+    1002:	a1 d4 75 00 00       	mov    0x75d4,%eax
+    1007:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    100a:	a1 d4 75 00 00       	mov    0x75d4,%eax
+    100f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1012:	c1 e2 03             	shl    $0x3,%edx
+    1015:	01 d0                	add    %edx,%eax
+    1017:	a3 d4 75 00 00       	mov    %eax,0x75d4
+  p->s.size = nunits;
+    101c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1022:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1025:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1028:	83 c0 08             	add    $0x8,%eax
+}
+    102b:	c9                   	leave
+    102c:	c3                   	ret
+
+0000102d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    102d:	55                   	push   %ebp
+    102e:	89 e5                	mov    %esp,%ebp
+    1030:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1033:	e8 c2 fb ff ff       	call   bfa <lock>
+    1038:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    103b:	83 ec 0c             	sub    $0xc,%esp
+    103e:	ff 75 08             	push   0x8(%ebp)
+    1041:	e8 d3 fe ff ff       	call   f19 <alloc>
+    1046:	83 c4 10             	add    $0x10,%esp
+    1049:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    104c:	83 ec 0c             	sub    $0xc,%esp
+    104f:	ff 75 f4             	push   -0xc(%ebp)
+    1052:	e8 df fb ff ff       	call   c36 <unlock>
+    1057:	83 c4 10             	add    $0x10,%esp
+  return p;
+    105a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    105d:	c9                   	leave
+    105e:	c3                   	ret
@@ -0,0 +1,70 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Readers of one file share its inode lock; a writer rewriting
+// the same bytes in place must not let them see anything else.
+
+#define TEST_FILE "/rdlock_file"
+#define SIZE (3*4096 + 100)
+#define NREADER 4
+#define ROUNDS 20
+
+static char want[SIZE];
+static char buf[SIZE];
+
+static void
+reader(void)
+{
+  struct stat st;
+  int fd, i, r;
+
+  for(r = 0; r < ROUNDS; r++){
+    if((fd = open(TEST_FILE, O_RDONLY)) < 0 || fstat(fd, &st) < 0 || st.size != SIZE){
+      printf(1, "error: open or stat\n");
+      exit();
+    }
+    memset(buf, 0, SIZE);
+    if(read(fd, buf, SIZE) != SIZE){
+      printf(1, "error: short read\n");
+      exit();
+    }
+    for(i = 0; i < SIZE; i++)
+      if(buf[i] != want[i]){
+        printf(1, "error: byte %d is %d, not %d\n", i, buf[i], want[i]);
+        exit();
+      }
+    close(fd);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+
+  for(i = 0; i < SIZE; i++)
+    want[i] = 'a' + i % 26;
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0 || write(fd, want, SIZE) != SIZE){
+    printf(1, "error creating file: %s\n", TEST_FILE);
+    exit();
+  }
+
+  for(i = 0; i < NREADER; i++){
+    if(fork() == 0)
+      reader();
+  }
+  for(i = 0; i < ROUNDS; i++)
+    if(pwrite(fd, want, SIZE, 0) != SIZE){
+      printf(1, "error: pwrite\n");
+      exit();
+    }
+  for(i = 0; i < NREADER; i++)
+    wait();
+  close(fd);
+  unlink(TEST_FILE);
+  printf(1, "rdlock ok\n");
+  exit();
+}
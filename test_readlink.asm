@@ -0,0 +1,1821 @@
+
+_test_readlink:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 04 02 00 00    	sub    $0x204,%esp
+  14:	89 c8                	mov    %ecx,%eax
+  if(argc != 2){
+  16:	83 38 02             	cmpl   $0x2,(%eax)
+  19:	74 17                	je     32 <main+0x32>
+    printf(1, "Usage: test_readlink file\n");
+  1b:	83 ec 08             	sub    $0x8,%esp
+  1e:	68 71 0e 00 00       	push   $0xe71
+  23:	6a 01                	push   $0x1
+  25:	e8 ad 07 00 00       	call   7d7 <printf>
+  2a:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2d:	e8 15 03 00 00       	call   347 <exit>
+  }
+
+  char output[512];
+  if(readlink(argv[1], output, 512) < 0){
+  32:	8b 40 04             	mov    0x4(%eax),%eax
+  35:	83 c0 04             	add    $0x4,%eax
+  38:	8b 00                	mov    (%eax),%eax
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	8d 95 f8 fd ff ff    	lea    -0x208(%ebp),%edx
+  48:	52                   	push   %edx
+  49:	50                   	push   %eax
+  4a:	e8 b2 03 00 00       	call   401 <readlink>
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	85 c0                	test   %eax,%eax
+  54:	79 17                	jns    6d <main+0x6d>
+    printf(1, "error: readlink\n");
+  56:	83 ec 08             	sub    $0x8,%esp
+  59:	68 8c 0e 00 00       	push   $0xe8c
+  5e:	6a 01                	push   $0x1
+  60:	e8 72 07 00 00       	call   7d7 <printf>
+  65:	83 c4 10             	add    $0x10,%esp
+    exit();
+  68:	e8 da 02 00 00       	call   347 <exit>
+  }
+
+  printf(1, "%d\n", strlen(output));
+  6d:	83 ec 0c             	sub    $0xc,%esp
+  70:	8d 85 f8 fd ff ff    	lea    -0x208(%ebp),%eax
+  76:	50                   	push   %eax
+  77:	e8 c9 00 00 00       	call   145 <strlen>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	83 ec 04             	sub    $0x4,%esp
+  82:	50                   	push   %eax
+  83:	68 9d 0e 00 00       	push   $0xe9d
+  88:	6a 01                	push   $0x1
+  8a:	e8 48 07 00 00       	call   7d7 <printf>
+  8f:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%s\n", output);
+  92:	83 ec 04             	sub    $0x4,%esp
+  95:	8d 85 f8 fd ff ff    	lea    -0x208(%ebp),%eax
+  9b:	50                   	push   %eax
+  9c:	68 a1 0e 00 00       	push   $0xea1
+  a1:	6a 01                	push   $0x1
+  a3:	e8 2f 07 00 00       	call   7d7 <printf>
+  a8:	83 c4 10             	add    $0x10,%esp
+  exit();
+  ab:	e8 97 02 00 00       	call   347 <exit>
+
+000000b0 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	57                   	push   %edi
+  b4:	53                   	push   %ebx
+    if(cc < 1)
+  b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  b8:	8b 55 10             	mov    0x10(%ebp),%edx
+  bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  be:	89 cb                	mov    %ecx,%ebx
+  c0:	89 df                	mov    %ebx,%edi
+  c2:	89 d1                	mov    %edx,%ecx
+  c4:	fc                   	cld
+  c5:	f3 aa                	rep stos %al,%es:(%edi)
+  c7:	89 ca                	mov    %ecx,%edx
+  c9:	89 fb                	mov    %edi,%ebx
+  cb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ce:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  d1:	90                   	nop
+  d2:	5b                   	pop    %ebx
+  d3:	5f                   	pop    %edi
+  d4:	5d                   	pop    %ebp
+  d5:	c3                   	ret
+
+000000d6 <strcpy>:
+{
+  d6:	55                   	push   %ebp
+  d7:	89 e5                	mov    %esp,%ebp
+  d9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  e2:	90                   	nop
+  e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  e6:	8d 42 01             	lea    0x1(%edx),%eax
+  e9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  ef:	8d 48 01             	lea    0x1(%eax),%ecx
+  f2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  f5:	0f b6 12             	movzbl (%edx),%edx
+  f8:	88 10                	mov    %dl,(%eax)
+  fa:	0f b6 00             	movzbl (%eax),%eax
+  fd:	84 c0                	test   %al,%al
+  ff:	75 e2                	jne    e3 <strcpy+0xd>
+  return os;
+ 101:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 104:	c9                   	leave
+ 105:	c3                   	ret
+
+00000106 <strcmp>:
+{
+ 106:	55                   	push   %ebp
+ 107:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 109:	eb 08                	jmp    113 <strcmp+0xd>
+    p++, q++;
+ 10b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 10f:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 00             	movzbl (%eax),%eax
+ 119:	84 c0                	test   %al,%al
+ 11b:	74 10                	je     12d <strcmp+0x27>
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	0f b6 10             	movzbl (%eax),%edx
+ 123:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 126:	0f b6 00             	movzbl (%eax),%eax
+ 129:	38 c2                	cmp    %al,%dl
+ 12b:	74 de                	je     10b <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	0f b6 00             	movzbl (%eax),%eax
+ 133:	0f b6 d0             	movzbl %al,%edx
+ 136:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 139:	0f b6 00             	movzbl (%eax),%eax
+ 13c:	0f b6 c0             	movzbl %al,%eax
+ 13f:	29 c2                	sub    %eax,%edx
+ 141:	89 d0                	mov    %edx,%eax
+}
+ 143:	5d                   	pop    %ebp
+ 144:	c3                   	ret
+
+00000145 <strlen>:
+{
+ 145:	55                   	push   %ebp
+ 146:	89 e5                	mov    %esp,%ebp
+ 148:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 14b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 152:	eb 04                	jmp    158 <strlen+0x13>
+ 154:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 158:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 15b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15e:	01 d0                	add    %edx,%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 ed                	jne    154 <strlen+0xf>
+  return n;
+ 167:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 16a:	c9                   	leave
+ 16b:	c3                   	ret
+
+0000016c <memset>:
+{
+ 16c:	55                   	push   %ebp
+ 16d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 16f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 172:	50                   	push   %eax
+ 173:	ff 75 0c             	push   0xc(%ebp)
+ 176:	ff 75 08             	push   0x8(%ebp)
+ 179:	e8 32 ff ff ff       	call   b0 <stosb>
+ 17e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 181:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+
+00000186 <strchr>:
+{
+ 186:	55                   	push   %ebp
+ 187:	89 e5                	mov    %esp,%ebp
+ 189:	83 ec 04             	sub    $0x4,%esp
+ 18c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 192:	eb 14                	jmp    1a8 <strchr+0x22>
+    if(*s == c)
+ 194:	8b 45 08             	mov    0x8(%ebp),%eax
+ 197:	0f b6 00             	movzbl (%eax),%eax
+ 19a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 19d:	75 05                	jne    1a4 <strchr+0x1e>
+      return (char*)s;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a2:	eb 13                	jmp    1b7 <strchr+0x31>
+  for(; *s; s++)
+ 1a4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ab:	0f b6 00             	movzbl (%eax),%eax
+ 1ae:	84 c0                	test   %al,%al
+ 1b0:	75 e2                	jne    194 <strchr+0xe>
+  return 0;
+ 1b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+
+000001b9 <gets>:
+{
+ 1b9:	55                   	push   %ebp
+ 1ba:	89 e5                	mov    %esp,%ebp
+ 1bc:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1c6:	eb 42                	jmp    20a <gets+0x51>
+    cc = read(0, &c, 1);
+ 1c8:	83 ec 04             	sub    $0x4,%esp
+ 1cb:	6a 01                	push   $0x1
+ 1cd:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1d0:	50                   	push   %eax
+ 1d1:	6a 00                	push   $0x0
+ 1d3:	e8 84 01 00 00       	call   35c <read>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1de:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1e2:	7e 33                	jle    217 <gets+0x5e>
+    buf[i++] = c;
+ 1e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ea:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1ed:	89 c2                	mov    %eax,%edx
+ 1ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f2:	01 c2                	add    %eax,%edx
+ 1f4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1f8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1fa:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1fe:	3c 0a                	cmp    $0xa,%al
+ 200:	74 16                	je     218 <gets+0x5f>
+ 202:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 206:	3c 0d                	cmp    $0xd,%al
+ 208:	74 0e                	je     218 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 20a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 20d:	83 c0 01             	add    $0x1,%eax
+ 210:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 213:	7f b3                	jg     1c8 <gets+0xf>
+ 215:	eb 01                	jmp    218 <gets+0x5f>
+      break;
+ 217:	90                   	nop
+  }
+  buf[i] = '\0';
+ 218:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 21b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21e:	01 d0                	add    %edx,%eax
+ 220:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	6a 00                	push   $0x0
+ 233:	ff 75 08             	push   0x8(%ebp)
+ 236:	e8 44 01 00 00       	call   37f <open>
+ 23b:	83 c4 10             	add    $0x10,%esp
+ 23e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 241:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 245:	79 07                	jns    24e <stat+0x26>
+    return -1;
+ 247:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 24c:	eb 25                	jmp    273 <stat+0x4b>
+  r = fstat(fd, st);
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	ff 75 0c             	push   0xc(%ebp)
+ 254:	ff 75 f4             	push   -0xc(%ebp)
+ 257:	e8 41 01 00 00       	call   39d <fstat>
+ 25c:	83 c4 10             	add    $0x10,%esp
+ 25f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 262:	83 ec 0c             	sub    $0xc,%esp
+ 265:	ff 75 f4             	push   -0xc(%ebp)
+ 268:	e8 fd 00 00 00       	call   36a <close>
+ 26d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 270:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+
+00000275 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 275:	55                   	push   %ebp
+ 276:	89 e5                	mov    %esp,%ebp
+ 278:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 27b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 282:	eb 25                	jmp    2a9 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 284:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 287:	89 d0                	mov    %edx,%eax
+ 289:	c1 e0 02             	shl    $0x2,%eax
+ 28c:	01 d0                	add    %edx,%eax
+ 28e:	01 c0                	add    %eax,%eax
+ 290:	89 c1                	mov    %eax,%ecx
+ 292:	8b 45 08             	mov    0x8(%ebp),%eax
+ 295:	8d 50 01             	lea    0x1(%eax),%edx
+ 298:	89 55 08             	mov    %edx,0x8(%ebp)
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	0f be c0             	movsbl %al,%eax
+ 2a1:	01 c8                	add    %ecx,%eax
+ 2a3:	83 e8 30             	sub    $0x30,%eax
+ 2a6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ac:	0f b6 00             	movzbl (%eax),%eax
+ 2af:	3c 2f                	cmp    $0x2f,%al
+ 2b1:	7e 0a                	jle    2bd <atoi+0x48>
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 00             	movzbl (%eax),%eax
+ 2b9:	3c 39                	cmp    $0x39,%al
+ 2bb:	7e c7                	jle    284 <atoi+0xf>
+  return n;
+ 2bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2c2:	55                   	push   %ebp
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2d4:	eb 17                	jmp    2ed <memmove+0x2b>
+    *dst++ = *src++;
+ 2d6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2d9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2e2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2e5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2e8:	0f b6 12             	movzbl (%edx),%edx
+ 2eb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2ed:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2f3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2f6:	85 c0                	test   %eax,%eax
+ 2f8:	7f dc                	jg     2d6 <memmove+0x14>
+  return vdst;
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2fd:	c9                   	leave
+ 2fe:	c3                   	ret
+
+000002ff <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 2ff:	83 3d 30 12 00 00 00 	cmpl   $0x0,0x1230
+  jg 2f
+ 306:	7f 2e                	jg     336 <dosyscall+0x37>
+  jl 1f
+ 308:	7c 29                	jl     333 <dosyscall+0x34>
+  pushl %eax
+ 30a:	50                   	push   %eax
+  pushl %ebx
+ 30b:	53                   	push   %ebx
+  movl $1, %eax
+ 30c:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 311:	0f a2                	cpuid
+  popl %ebx
+ 313:	5b                   	pop    %ebx
+  popl %eax
+ 314:	58                   	pop    %eax
+  movl $-1, sysmode
+ 315:	c7 05 30 12 00 00 ff 	movl   $0xffffffff,0x1230
+ 31c:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 31f:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 325:	74 0c                	je     333 <dosyscall+0x34>
+  movl $1, sysmode
+ 327:	c7 05 30 12 00 00 01 	movl   $0x1,0x1230
+ 32e:	00 00 00 
+  jmp 2f
+ 331:	eb 03                	jmp    336 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 333:	cd 40                	int    $0x40
+  ret
+ 335:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 336:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 338:	ba 3f 03 00 00       	mov    $0x33f,%edx
+  sysenter
+ 33d:	0f 34                	sysenter
+3:
+  ret
+ 33f:	c3                   	ret
+
+00000340 <fork>:
+
+SYSCALL(fork)
+ 340:	b8 01 00 00 00       	mov    $0x1,%eax
+ 345:	eb b8                	jmp    2ff <dosyscall>
+
+00000347 <exit>:
+SYSCALL(exit)
+ 347:	b8 02 00 00 00       	mov    $0x2,%eax
+ 34c:	eb b1                	jmp    2ff <dosyscall>
+
+0000034e <wait>:
+SYSCALL(wait)
+ 34e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 353:	eb aa                	jmp    2ff <dosyscall>
+
+00000355 <pipe>:
+SYSCALL(pipe)
+ 355:	b8 04 00 00 00       	mov    $0x4,%eax
+ 35a:	eb a3                	jmp    2ff <dosyscall>
+
+0000035c <read>:
+SYSCALL(read)
+ 35c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 361:	eb 9c                	jmp    2ff <dosyscall>
+
+00000363 <write>:
+SYSCALL(write)
+ 363:	b8 10 00 00 00       	mov    $0x10,%eax
+ 368:	eb 95                	jmp    2ff <dosyscall>
+
+0000036a <close>:
+SYSCALL(close)
+ 36a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36f:	eb 8e                	jmp    2ff <dosyscall>
+
+00000371 <kill>:
+SYSCALL(kill)
+ 371:	b8 06 00 00 00       	mov    $0x6,%eax
+ 376:	eb 87                	jmp    2ff <dosyscall>
+
+00000378 <exec>:
+SYSCALL(exec)
+ 378:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37d:	eb 80                	jmp    2ff <dosyscall>
+
+0000037f <open>:
+SYSCALL(open)
+ 37f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 384:	e9 76 ff ff ff       	jmp    2ff <dosyscall>
+
+00000389 <mknod>:
+SYSCALL(mknod)
+ 389:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38e:	e9 6c ff ff ff       	jmp    2ff <dosyscall>
+
+00000393 <unlink>:
+SYSCALL(unlink)
+ 393:	b8 12 00 00 00       	mov    $0x12,%eax
+ 398:	e9 62 ff ff ff       	jmp    2ff <dosyscall>
+
+0000039d <fstat>:
+SYSCALL(fstat)
+ 39d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3a2:	e9 58 ff ff ff       	jmp    2ff <dosyscall>
+
+000003a7 <link>:
+SYSCALL(link)
+ 3a7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3ac:	e9 4e ff ff ff       	jmp    2ff <dosyscall>
+
+000003b1 <mkdir>:
+SYSCALL(mkdir)
+ 3b1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3b6:	e9 44 ff ff ff       	jmp    2ff <dosyscall>
+
+000003bb <chdir>:
+SYSCALL(chdir)
+ 3bb:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c0:	e9 3a ff ff ff       	jmp    2ff <dosyscall>
+
+000003c5 <dup>:
+SYSCALL(dup)
+ 3c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ca:	e9 30 ff ff ff       	jmp    2ff <dosyscall>
+
+000003cf <getpid>:
+SYSCALL(getpid)
+ 3cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d4:	e9 26 ff ff ff       	jmp    2ff <dosyscall>
+
+000003d9 <sbrk>:
+SYSCALL(sbrk)
+ 3d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3de:	e9 1c ff ff ff       	jmp    2ff <dosyscall>
+
+000003e3 <sleep>:
+SYSCALL(sleep)
+ 3e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e8:	e9 12 ff ff ff       	jmp    2ff <dosyscall>
+
+000003ed <uptime>:
+SYSCALL(uptime)
+ 3ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f2:	e9 08 ff ff ff       	jmp    2ff <dosyscall>
+
+000003f7 <symlink>:
+SYSCALL(symlink)
+ 3f7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fc:	e9 fe fe ff ff       	jmp    2ff <dosyscall>
+
+00000401 <readlink>:
+SYSCALL(readlink)
+ 401:	b8 17 00 00 00       	mov    $0x17,%eax
+ 406:	e9 f4 fe ff ff       	jmp    2ff <dosyscall>
+
+0000040b <fprot>:
+SYSCALL(fprot)
+ 40b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 410:	e9 ea fe ff ff       	jmp    2ff <dosyscall>
+
+00000415 <funprot>:
+SYSCALL(funprot)
+ 415:	b8 19 00 00 00       	mov    $0x19,%eax
+ 41a:	e9 e0 fe ff ff       	jmp    2ff <dosyscall>
+
+0000041f <funlock>:
+SYSCALL(funlock)
+ 41f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 424:	e9 d6 fe ff ff       	jmp    2ff <dosyscall>
+
+00000429 <mmap>:
+SYSCALL(mmap)
+ 429:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 42e:	e9 cc fe ff ff       	jmp    2ff <dosyscall>
+
+00000433 <munmap>:
+SYSCALL(munmap)
+ 433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 438:	e9 c2 fe ff ff       	jmp    2ff <dosyscall>
+
+0000043d <sendfile>:
+SYSCALL(sendfile)
+ 43d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 442:	e9 b8 fe ff ff       	jmp    2ff <dosyscall>
+
+00000447 <readv>:
+SYSCALL(readv)
+ 447:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 44c:	e9 ae fe ff ff       	jmp    2ff <dosyscall>
+
+00000451 <writev>:
+SYSCALL(writev)
+ 451:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 456:	e9 a4 fe ff ff       	jmp    2ff <dosyscall>
+
+0000045b <pread>:
+SYSCALL(pread)
+ 45b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 460:	e9 9a fe ff ff       	jmp    2ff <dosyscall>
+
+00000465 <pwrite>:
+SYSCALL(pwrite)
+ 465:	b8 21 00 00 00       	mov    $0x21,%eax
+ 46a:	e9 90 fe ff ff       	jmp    2ff <dosyscall>
+
+0000046f <lseek>:
+SYSCALL(lseek)
+ 46f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 474:	e9 86 fe ff ff       	jmp    2ff <dosyscall>
+
+00000479 <spawn>:
+SYSCALL(spawn)
+ 479:	b8 23 00 00 00       	mov    $0x23,%eax
+ 47e:	e9 7c fe ff ff       	jmp    2ff <dosyscall>
+
+00000483 <setpriority>:
+SYSCALL(setpriority)
+ 483:	b8 24 00 00 00       	mov    $0x24,%eax
+ 488:	e9 72 fe ff ff       	jmp    2ff <dosyscall>
+
+0000048d <kthread_create>:
+SYSCALL(kthread_create)
+ 48d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 492:	e9 68 fe ff ff       	jmp    2ff <dosyscall>
+
+00000497 <kthread_id>:
+SYSCALL(kthread_id)
+ 497:	b8 26 00 00 00       	mov    $0x26,%eax
+ 49c:	e9 5e fe ff ff       	jmp    2ff <dosyscall>
+
+000004a1 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 4a1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4a6:	e9 54 fe ff ff       	jmp    2ff <dosyscall>
+
+000004ab <kthread_join>:
+SYSCALL(kthread_join)
+ 4ab:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4b0:	e9 4a fe ff ff       	jmp    2ff <dosyscall>
+
+000004b5 <futex>:
+SYSCALL(futex)
+ 4b5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ba:	e9 40 fe ff ff       	jmp    2ff <dosyscall>
+
+000004bf <signal>:
+SYSCALL(signal)
+ 4bf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4c4:	e9 36 fe ff ff       	jmp    2ff <dosyscall>
+
+000004c9 <alarm>:
+SYSCALL(alarm)
+ 4c9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4ce:	e9 2c fe ff ff       	jmp    2ff <dosyscall>
+
+000004d3 <usleep>:
+SYSCALL(usleep)
+ 4d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4d8:	e9 22 fe ff ff       	jmp    2ff <dosyscall>
+
+000004dd <ioring_setup>:
+SYSCALL(ioring_setup)
+ 4dd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4e2:	e9 18 fe ff ff       	jmp    2ff <dosyscall>
+
+000004e7 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 4e7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4ec:	e9 0e fe ff ff       	jmp    2ff <dosyscall>
+
+000004f1 <getrusage>:
+SYSCALL(getrusage)
+ 4f1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4f6:	e9 04 fe ff ff       	jmp    2ff <dosyscall>
+
+000004fb <mount>:
+SYSCALL(mount)
+ 4fb:	b8 30 00 00 00       	mov    $0x30,%eax
+ 500:	e9 fa fd ff ff       	jmp    2ff <dosyscall>
+
+00000505 <getdents>:
+SYSCALL(getdents)
+ 505:	b8 31 00 00 00       	mov    $0x31,%eax
+ 50a:	e9 f0 fd ff ff       	jmp    2ff <dosyscall>
+
+0000050f <yield>:
+SYSCALL(yield)
+ 50f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 514:	e9 e6 fd ff ff       	jmp    2ff <dosyscall>
+
+00000519 <ncpu>:
+SYSCALL(ncpu)
+ 519:	b8 33 00 00 00       	mov    $0x33,%eax
+ 51e:	e9 dc fd ff ff       	jmp    2ff <dosyscall>
+
+00000523 <fallocate>:
+SYSCALL(fallocate)
+ 523:	b8 34 00 00 00       	mov    $0x34,%eax
+ 528:	e9 d2 fd ff ff       	jmp    2ff <dosyscall>
+
+0000052d <ftruncate>:
+SYSCALL(ftruncate)
+ 52d:	b8 35 00 00 00       	mov    $0x35,%eax
+ 532:	e9 c8 fd ff ff       	jmp    2ff <dosyscall>
+
+00000537 <fsync>:
+SYSCALL(fsync)
+ 537:	b8 36 00 00 00       	mov    $0x36,%eax
+ 53c:	e9 be fd ff ff       	jmp    2ff <dosyscall>
+
+00000541 <fdatasync>:
+SYSCALL(fdatasync)
+ 541:	b8 37 00 00 00       	mov    $0x37,%eax
+ 546:	e9 b4 fd ff ff       	jmp    2ff <dosyscall>
+
+0000054b <poll>:
+SYSCALL(poll)
+ 54b:	b8 38 00 00 00       	mov    $0x38,%eax
+ 550:	e9 aa fd ff ff       	jmp    2ff <dosyscall>
+
+00000555 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 555:	55                   	push   %ebp
+ 556:	89 e5                	mov    %esp,%ebp
+ 558:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 55b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55e:	8b 40 04             	mov    0x4(%eax),%eax
+ 561:	85 c0                	test   %eax,%eax
+ 563:	7e 1f                	jle    584 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 565:	8b 45 08             	mov    0x8(%ebp),%eax
+ 568:	8b 50 04             	mov    0x4(%eax),%edx
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	8d 48 08             	lea    0x8(%eax),%ecx
+ 571:	8b 45 08             	mov    0x8(%ebp),%eax
+ 574:	8b 00                	mov    (%eax),%eax
+ 576:	83 ec 04             	sub    $0x4,%esp
+ 579:	52                   	push   %edx
+ 57a:	51                   	push   %ecx
+ 57b:	50                   	push   %eax
+ 57c:	e8 d0 fe ff ff       	call   451 <writev>
+ 581:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 584:	8b 45 08             	mov    0x8(%ebp),%eax
+ 587:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 58e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 591:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 598:	00 00 00 
+}
+ 59b:	90                   	nop
+ 59c:	c9                   	leave
+ 59d:	c3                   	ret
+
+0000059e <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 59e:	55                   	push   %ebp
+ 59f:	89 e5                	mov    %esp,%ebp
+ 5a1:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 5a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5a8:	0f 84 94 00 00 00    	je     642 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b1:	8b 40 04             	mov    0x4(%eax),%eax
+ 5b4:	85 c0                	test   %eax,%eax
+ 5b6:	7e 40                	jle    5f8 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 5b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bb:	8b 40 04             	mov    0x4(%eax),%eax
+ 5be:	83 e8 01             	sub    $0x1,%eax
+ 5c1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 5c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cb:	01 d0                	add    %edx,%eax
+ 5cd:	83 c0 08             	add    $0x8,%eax
+ 5d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 5d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d6:	8b 10                	mov    (%eax),%edx
+ 5d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5db:	8b 40 04             	mov    0x4(%eax),%eax
+ 5de:	01 d0                	add    %edx,%eax
+ 5e0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 5e3:	75 13                	jne    5f8 <put+0x5a>
+      v->iov_len += n;
+ 5e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e8:	8b 50 04             	mov    0x4(%eax),%edx
+ 5eb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5ee:	01 c2                	add    %eax,%edx
+ 5f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f3:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 5f6:	eb 4b                	jmp    643 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fb:	8b 40 04             	mov    0x4(%eax),%eax
+ 5fe:	83 f8 10             	cmp    $0x10,%eax
+ 601:	75 0e                	jne    611 <put+0x73>
+    flush(o);
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	ff 75 08             	push   0x8(%ebp)
+ 609:	e8 47 ff ff ff       	call   555 <flush>
+ 60e:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 611:	8b 45 08             	mov    0x8(%ebp),%eax
+ 614:	8b 50 04             	mov    0x4(%eax),%edx
+ 617:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 61d:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 621:	8b 45 08             	mov    0x8(%ebp),%eax
+ 624:	8b 50 04             	mov    0x4(%eax),%edx
+ 627:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62d:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 631:	8b 45 08             	mov    0x8(%ebp),%eax
+ 634:	8b 40 04             	mov    0x4(%eax),%eax
+ 637:	8d 50 01             	lea    0x1(%eax),%edx
+ 63a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63d:	89 50 04             	mov    %edx,0x4(%eax)
+ 640:	eb 01                	jmp    643 <put+0xa5>
+    return;
+ 642:	90                   	nop
+}
+ 643:	c9                   	leave
+ 644:	c3                   	ret
+
+00000645 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 645:	55                   	push   %ebp
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 64b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64e:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 654:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 657:	01 d0                	add    %edx,%eax
+ 659:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 65e:	77 0b                	ja     66b <room+0x26>
+ 660:	8b 45 08             	mov    0x8(%ebp),%eax
+ 663:	8b 40 04             	mov    0x4(%eax),%eax
+ 666:	83 f8 10             	cmp    $0x10,%eax
+ 669:	75 0e                	jne    679 <room+0x34>
+    flush(o);
+ 66b:	83 ec 0c             	sub    $0xc,%esp
+ 66e:	ff 75 08             	push   0x8(%ebp)
+ 671:	e8 df fe ff ff       	call   555 <flush>
+ 676:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 679:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67c:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 682:	8b 45 08             	mov    0x8(%ebp),%eax
+ 685:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 68b:	01 d0                	add    %edx,%eax
+}
+ 68d:	c9                   	leave
+ 68e:	c3                   	ret
+
+0000068f <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 68f:	55                   	push   %ebp
+ 690:	89 e5                	mov    %esp,%ebp
+ 692:	83 ec 28             	sub    $0x28,%esp
+ 695:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 698:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 69b:	83 ec 08             	sub    $0x8,%esp
+ 69e:	6a 01                	push   $0x1
+ 6a0:	ff 75 08             	push   0x8(%ebp)
+ 6a3:	e8 9d ff ff ff       	call   645 <room>
+ 6a8:	83 c4 10             	add    $0x10,%esp
+ 6ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 6ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b1:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 6b5:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 6b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ba:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6c0:	8d 50 01             	lea    0x1(%eax),%edx
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 6cc:	83 ec 04             	sub    $0x4,%esp
+ 6cf:	6a 01                	push   $0x1
+ 6d1:	ff 75 f4             	push   -0xc(%ebp)
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 c2 fe ff ff       	call   59e <put>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+}
+ 6df:	90                   	nop
+ 6e0:	c9                   	leave
+ 6e1:	c3                   	ret
+
+000006e2 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 6e2:	55                   	push   %ebp
+ 6e3:	89 e5                	mov    %esp,%ebp
+ 6e5:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 6e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6ef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6f3:	74 17                	je     70c <printint+0x2a>
+ 6f5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6f9:	79 11                	jns    70c <printint+0x2a>
+    neg = 1;
+ 6fb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 702:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 705:	f7 d8                	neg    %eax
+ 707:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 70a:	eb 06                	jmp    712 <printint+0x30>
+  } else {
+    x = xx;
+ 70c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 70f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 712:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 719:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 71f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 724:	f7 f1                	div    %ecx
+ 726:	89 d1                	mov    %edx,%ecx
+ 728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72b:	8d 50 01             	lea    0x1(%eax),%edx
+ 72e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 731:	0f b6 91 34 12 00 00 	movzbl 0x1234(%ecx),%edx
+ 738:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 73c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 742:	ba 00 00 00 00       	mov    $0x0,%edx
+ 747:	f7 f1                	div    %ecx
+ 749:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 74c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 750:	75 c7                	jne    719 <printint+0x37>
+  if(neg)
+ 752:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 756:	74 0e                	je     766 <printint+0x84>
+    buf[i++] = '-';
+ 758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75b:	8d 50 01             	lea    0x1(%eax),%edx
+ 75e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 761:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 766:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 769:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 76c:	83 ec 08             	sub    $0x8,%esp
+ 76f:	ff 75 e8             	push   -0x18(%ebp)
+ 772:	ff 75 08             	push   0x8(%ebp)
+ 775:	e8 cb fe ff ff       	call   645 <room>
+ 77a:	83 c4 10             	add    $0x10,%esp
+ 77d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 780:	eb 1d                	jmp    79f <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 782:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 785:	83 e8 01             	sub    $0x1,%eax
+ 788:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 78b:	89 c2                	mov    %eax,%edx
+ 78d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 790:	01 c2                	add    %eax,%edx
+ 792:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 798:	01 c8                	add    %ecx,%eax
+ 79a:	0f b6 00             	movzbl (%eax),%eax
+ 79d:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 79f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7a3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7a7:	79 d9                	jns    782 <printint+0xa0>
+  o->used += n;
+ 7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ac:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7b2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b5:	01 c2                	add    %eax,%edx
+ 7b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ba:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	ff 75 e8             	push   -0x18(%ebp)
+ 7c6:	ff 75 e4             	push   -0x1c(%ebp)
+ 7c9:	ff 75 08             	push   0x8(%ebp)
+ 7cc:	e8 cd fd ff ff       	call   59e <put>
+ 7d1:	83 c4 10             	add    $0x10,%esp
+}
+ 7d4:	90                   	nop
+ 7d5:	c9                   	leave
+ 7d6:	c3                   	ret
+
+000007d7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7d7:	55                   	push   %ebp
+ 7d8:	89 e5                	mov    %esp,%ebp
+ 7da:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 7e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 7e9:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 7f0:	00 00 00 
+  o.used = 0;
+ 7f3:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 7fa:	00 00 00 
+  state = 0;
+ 7fd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 804:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 807:	83 c0 04             	add    $0x4,%eax
+ 80a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 80d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 814:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 81b:	e9 82 01 00 00       	jmp    9a2 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 820:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 823:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 826:	01 d0                	add    %edx,%eax
+ 828:	0f b6 00             	movzbl (%eax),%eax
+ 82b:	0f be c0             	movsbl %al,%eax
+ 82e:	25 ff 00 00 00       	and    $0xff,%eax
+ 833:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 836:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 83a:	75 38                	jne    874 <printf+0x9d>
+      if(c == '%'){
+ 83c:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 840:	0f 85 58 01 00 00    	jne    99e <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 846:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 849:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 84c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 84f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 852:	01 ca                	add    %ecx,%edx
+ 854:	83 ec 04             	sub    $0x4,%esp
+ 857:	50                   	push   %eax
+ 858:	52                   	push   %edx
+ 859:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 85f:	50                   	push   %eax
+ 860:	e8 39 fd ff ff       	call   59e <put>
+ 865:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 868:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 86f:	e9 2a 01 00 00       	jmp    99e <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 874:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 878:	0f 85 20 01 00 00    	jne    99e <printf+0x1c7>
+      if(c == 'd'){
+ 87e:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 882:	75 22                	jne    8a6 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 887:	8b 00                	mov    (%eax),%eax
+ 889:	6a 01                	push   $0x1
+ 88b:	6a 0a                	push   $0xa
+ 88d:	50                   	push   %eax
+ 88e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 894:	50                   	push   %eax
+ 895:	e8 48 fe ff ff       	call   6e2 <printint>
+ 89a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 89d:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8a1:	e9 e8 00 00 00       	jmp    98e <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 8a6:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 8aa:	74 06                	je     8b2 <printf+0xdb>
+ 8ac:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 8b0:	75 22                	jne    8d4 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 8b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b5:	8b 00                	mov    (%eax),%eax
+ 8b7:	6a 00                	push   $0x0
+ 8b9:	6a 10                	push   $0x10
+ 8bb:	50                   	push   %eax
+ 8bc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8c2:	50                   	push   %eax
+ 8c3:	e8 1a fe ff ff       	call   6e2 <printint>
+ 8c8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8cb:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8cf:	e9 ba 00 00 00       	jmp    98e <printf+0x1b7>
+      } else if(c == 's'){
+ 8d4:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 8d8:	75 3f                	jne    919 <printf+0x142>
+        s = (char*)*ap;
+ 8da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8dd:	8b 00                	mov    (%eax),%eax
+ 8df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8e2:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 8e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ea:	75 07                	jne    8f3 <printf+0x11c>
+          s = "(null)";
+ 8ec:	c7 45 f4 a5 0e 00 00 	movl   $0xea5,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	ff 75 f4             	push   -0xc(%ebp)
+ 8f9:	e8 47 f8 ff ff       	call   145 <strlen>
+ 8fe:	83 c4 10             	add    $0x10,%esp
+ 901:	83 ec 04             	sub    $0x4,%esp
+ 904:	50                   	push   %eax
+ 905:	ff 75 f4             	push   -0xc(%ebp)
+ 908:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 90e:	50                   	push   %eax
+ 90f:	e8 8a fc ff ff       	call   59e <put>
+ 914:	83 c4 10             	add    $0x10,%esp
+ 917:	eb 75                	jmp    98e <printf+0x1b7>
+      } else if(c == 'c'){
+ 919:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 91d:	75 21                	jne    940 <printf+0x169>
+        putc(&o, *ap);
+ 91f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 922:	8b 00                	mov    (%eax),%eax
+ 924:	0f be c0             	movsbl %al,%eax
+ 927:	83 ec 08             	sub    $0x8,%esp
+ 92a:	50                   	push   %eax
+ 92b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 931:	50                   	push   %eax
+ 932:	e8 58 fd ff ff       	call   68f <putc>
+ 937:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 93a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 93e:	eb 4e                	jmp    98e <printf+0x1b7>
+      } else if(c == '%'){
+ 940:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 944:	75 1b                	jne    961 <printf+0x18a>
+        putc(&o, c);
+ 946:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 949:	0f be c0             	movsbl %al,%eax
+ 94c:	83 ec 08             	sub    $0x8,%esp
+ 94f:	50                   	push   %eax
+ 950:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 956:	50                   	push   %eax
+ 957:	e8 33 fd ff ff       	call   68f <putc>
+ 95c:	83 c4 10             	add    $0x10,%esp
+ 95f:	eb 2d                	jmp    98e <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 961:	83 ec 08             	sub    $0x8,%esp
+ 964:	6a 25                	push   $0x25
+ 966:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 96c:	50                   	push   %eax
+ 96d:	e8 1d fd ff ff       	call   68f <putc>
+ 972:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 975:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 978:	0f be c0             	movsbl %al,%eax
+ 97b:	83 ec 08             	sub    $0x8,%esp
+ 97e:	50                   	push   %eax
+ 97f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 985:	50                   	push   %eax
+ 986:	e8 04 fd ff ff       	call   68f <putc>
+ 98b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 98e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 995:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 998:	83 c0 01             	add    $0x1,%eax
+ 99b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 99e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a8:	01 d0                	add    %edx,%eax
+ 9aa:	0f b6 00             	movzbl (%eax),%eax
+ 9ad:	84 c0                	test   %al,%al
+ 9af:	0f 85 6b fe ff ff    	jne    820 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 9b5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 9b9:	75 22                	jne    9dd <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 9bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9be:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9c4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9c7:	01 ca                	add    %ecx,%edx
+ 9c9:	83 ec 04             	sub    $0x4,%esp
+ 9cc:	50                   	push   %eax
+ 9cd:	52                   	push   %edx
+ 9ce:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9d4:	50                   	push   %eax
+ 9d5:	e8 c4 fb ff ff       	call   59e <put>
+ 9da:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 9dd:	83 ec 0c             	sub    $0xc,%esp
+ 9e0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9e6:	50                   	push   %eax
+ 9e7:	e8 69 fb ff ff       	call   555 <flush>
+ 9ec:	83 c4 10             	add    $0x10,%esp
+}
+ 9ef:	90                   	nop
+ 9f0:	c9                   	leave
+ 9f1:	c3                   	ret
+
+000009f2 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 9f2:	55                   	push   %ebp
+ 9f3:	89 e5                	mov    %esp,%ebp
+ 9f5:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 9f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ a01:	f0 87 02             	lock xchg %eax,(%edx)
+ a04:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a0a:	c9                   	leave
+ a0b:	c3                   	ret
+
+00000a0c <lock>:
+{
+ a0c:	55                   	push   %ebp
+ a0d:	89 e5                	mov    %esp,%ebp
+ a0f:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a12:	a1 48 12 00 00       	mov    0x1248,%eax
+ a17:	85 c0                	test   %eax,%eax
+ a19:	74 09                	je     a24 <lock+0x18>
+ a1b:	a1 48 12 00 00       	mov    0x1248,%eax
+ a20:	ff d0                	call   *%eax
+ a22:	eb 05                	jmp    a29 <lock+0x1d>
+ a24:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a29:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a2c:	90                   	nop
+ a2d:	83 ec 08             	sub    $0x8,%esp
+ a30:	6a 01                	push   $0x1
+ a32:	68 80 12 00 00       	push   $0x1280
+ a37:	e8 b6 ff ff ff       	call   9f2 <xchg>
+ a3c:	83 c4 10             	add    $0x10,%esp
+ a3f:	85 c0                	test   %eax,%eax
+ a41:	75 ea                	jne    a2d <lock+0x21>
+  return pin;
+ a43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ a46:	c9                   	leave
+ a47:	c3                   	ret
+
+00000a48 <unlock>:
+{
+ a48:	55                   	push   %ebp
+ a49:	89 e5                	mov    %esp,%ebp
+ a4b:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ a4e:	6a 00                	push   $0x0
+ a50:	68 80 12 00 00       	push   $0x1280
+ a55:	e8 98 ff ff ff       	call   9f2 <xchg>
+ a5a:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ a5d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ a61:	78 10                	js     a73 <unlock+0x2b>
+    mallocunpin(pin);
+ a63:	a1 4c 12 00 00       	mov    0x124c,%eax
+ a68:	83 ec 0c             	sub    $0xc,%esp
+ a6b:	ff 75 08             	push   0x8(%ebp)
+ a6e:	ff d0                	call   *%eax
+ a70:	83 c4 10             	add    $0x10,%esp
+}
+ a73:	90                   	nop
+ a74:	c9                   	leave
+ a75:	c3                   	ret
+
+00000a76 <sizeclass>:
+{
+ a76:	55                   	push   %ebp
+ a77:	89 e5                	mov    %esp,%ebp
+ a79:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ a7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ a83:	eb 1c                	jmp    aa1 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a88:	ba 02 00 00 00       	mov    $0x2,%edx
+ a8d:	89 c1                	mov    %eax,%ecx
+ a8f:	d3 e2                	shl    %cl,%edx
+ a91:	89 d0                	mov    %edx,%eax
+ a93:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a96:	72 05                	jb     a9d <sizeclass+0x27>
+      return c;
+ a98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9b:	eb 0f                	jmp    aac <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a9d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ aa1:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ aa5:	7e de                	jle    a85 <sizeclass+0xf>
+  return -1;
+ aa7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ aac:	c9                   	leave
+ aad:	c3                   	ret
+
+00000aae <bigfree>:
+{
+ aae:	55                   	push   %ebp
+ aaf:	89 e5                	mov    %esp,%ebp
+ ab1:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab4:	a1 58 12 00 00       	mov    0x1258,%eax
+ ab9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ abc:	eb 24                	jmp    ae2 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ abe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac1:	8b 00                	mov    (%eax),%eax
+ ac3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ac6:	72 12                	jb     ada <bigfree+0x2c>
+ ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+ acb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ace:	72 24                	jb     af4 <bigfree+0x46>
+ ad0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad3:	8b 00                	mov    (%eax),%eax
+ ad5:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ad8:	72 1a                	jb     af4 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ada:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ add:	8b 00                	mov    (%eax),%eax
+ adf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ae8:	73 d4                	jae    abe <bigfree+0x10>
+ aea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aed:	8b 00                	mov    (%eax),%eax
+ aef:	39 45 08             	cmp    %eax,0x8(%ebp)
+ af2:	73 ca                	jae    abe <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ af4:	8b 45 08             	mov    0x8(%ebp),%eax
+ af7:	8b 40 04             	mov    0x4(%eax),%eax
+ afa:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b01:	8b 45 08             	mov    0x8(%ebp),%eax
+ b04:	01 c2                	add    %eax,%edx
+ b06:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b09:	8b 00                	mov    (%eax),%eax
+ b0b:	39 c2                	cmp    %eax,%edx
+ b0d:	75 24                	jne    b33 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b12:	8b 50 04             	mov    0x4(%eax),%edx
+ b15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b18:	8b 00                	mov    (%eax),%eax
+ b1a:	8b 40 04             	mov    0x4(%eax),%eax
+ b1d:	01 c2                	add    %eax,%edx
+ b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b22:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	8b 10                	mov    (%eax),%edx
+ b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2f:	89 10                	mov    %edx,(%eax)
+ b31:	eb 0a                	jmp    b3d <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b36:	8b 10                	mov    (%eax),%edx
+ b38:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b3d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b40:	8b 40 04             	mov    0x4(%eax),%eax
+ b43:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4d:	01 d0                	add    %edx,%eax
+ b4f:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b52:	75 20                	jne    b74 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b57:	8b 50 04             	mov    0x4(%eax),%edx
+ b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5d:	8b 40 04             	mov    0x4(%eax),%eax
+ b60:	01 c2                	add    %eax,%edx
+ b62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b65:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b68:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6b:	8b 10                	mov    (%eax),%edx
+ b6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b70:	89 10                	mov    %edx,(%eax)
+ b72:	eb 08                	jmp    b7c <bigfree+0xce>
+    p->s.ptr = bp;
+ b74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b77:	8b 55 08             	mov    0x8(%ebp),%edx
+ b7a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7f:	a3 58 12 00 00       	mov    %eax,0x1258
+}
+ b84:	90                   	nop
+ b85:	c9                   	leave
+ b86:	c3                   	ret
+
+00000b87 <free>:
+{
+ b87:	55                   	push   %ebp
+ b88:	89 e5                	mov    %esp,%ebp
+ b8a:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b8d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b91:	74 68                	je     bfb <free+0x74>
+  bp = (Header*)ap - 1;
+ b93:	8b 45 08             	mov    0x8(%ebp),%eax
+ b96:	83 e8 08             	sub    $0x8,%eax
+ b99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b9c:	e8 6b fe ff ff       	call   a0c <lock>
+ ba1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ ba4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba7:	8b 40 04             	mov    0x4(%eax),%eax
+ baa:	83 ec 0c             	sub    $0xc,%esp
+ bad:	50                   	push   %eax
+ bae:	e8 c3 fe ff ff       	call   a76 <sizeclass>
+ bb3:	83 c4 10             	add    $0x10,%esp
+ bb6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ bb9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ bbd:	78 1e                	js     bdd <free+0x56>
+    bp->s.ptr = classfree[c];
+ bbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bc2:	8b 14 85 5c 12 00 00 	mov    0x125c(,%eax,4),%edx
+ bc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bcc:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ bce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bd1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ bd4:	89 14 85 5c 12 00 00 	mov    %edx,0x125c(,%eax,4)
+ bdb:	eb 0e                	jmp    beb <free+0x64>
+    bigfree(bp);
+ bdd:	83 ec 0c             	sub    $0xc,%esp
+ be0:	ff 75 f4             	push   -0xc(%ebp)
+ be3:	e8 c6 fe ff ff       	call   aae <bigfree>
+ be8:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ beb:	83 ec 0c             	sub    $0xc,%esp
+ bee:	ff 75 f0             	push   -0x10(%ebp)
+ bf1:	e8 52 fe ff ff       	call   a48 <unlock>
+ bf6:	83 c4 10             	add    $0x10,%esp
+ bf9:	eb 01                	jmp    bfc <free+0x75>
+    return;
+ bfb:	90                   	nop
+}
+ bfc:	c9                   	leave
+ bfd:	c3                   	ret
+
+00000bfe <morecore>:
+{
+ bfe:	55                   	push   %ebp
+ bff:	89 e5                	mov    %esp,%ebp
+ c01:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c04:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c0b:	77 07                	ja     c14 <morecore+0x16>
+    nu = 4096;
+ c0d:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c14:	8b 45 08             	mov    0x8(%ebp),%eax
+ c17:	c1 e0 03             	shl    $0x3,%eax
+ c1a:	83 ec 0c             	sub    $0xc,%esp
+ c1d:	50                   	push   %eax
+ c1e:	e8 b6 f7 ff ff       	call   3d9 <sbrk>
+ c23:	83 c4 10             	add    $0x10,%esp
+ c26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c29:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c2d:	75 07                	jne    c36 <morecore+0x38>
+    return 0;
+ c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c34:	eb 22                	jmp    c58 <morecore+0x5a>
+  hp = (Header*)p;
+ c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c3f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c42:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ c45:	83 ec 0c             	sub    $0xc,%esp
+ c48:	ff 75 f0             	push   -0x10(%ebp)
+ c4b:	e8 5e fe ff ff       	call   aae <bigfree>
+ c50:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c53:	a1 58 12 00 00       	mov    0x1258,%eax
+}
+ c58:	c9                   	leave
+ c59:	c3                   	ret
+
+00000c5a <bigalloc>:
+{
+ c5a:	55                   	push   %ebp
+ c5b:	89 e5                	mov    %esp,%ebp
+ c5d:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ c60:	a1 58 12 00 00       	mov    0x1258,%eax
+ c65:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c68:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c6c:	75 23                	jne    c91 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ c6e:	c7 45 f0 50 12 00 00 	movl   $0x1250,-0x10(%ebp)
+ c75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c78:	a3 58 12 00 00       	mov    %eax,0x1258
+ c7d:	a1 58 12 00 00       	mov    0x1258,%eax
+ c82:	a3 50 12 00 00       	mov    %eax,0x1250
+    base.s.size = 0;
+ c87:	c7 05 54 12 00 00 00 	movl   $0x0,0x1254
+ c8e:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c94:	8b 00                	mov    (%eax),%eax
+ c96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9c:	8b 40 04             	mov    0x4(%eax),%eax
+ c9f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ca2:	72 4a                	jb     cee <bigalloc+0x94>
+      if(p->s.size == nunits)
+ ca4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca7:	8b 40 04             	mov    0x4(%eax),%eax
+ caa:	39 45 08             	cmp    %eax,0x8(%ebp)
+ cad:	75 0c                	jne    cbb <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ caf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb2:	8b 10                	mov    (%eax),%edx
+ cb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cb7:	89 10                	mov    %edx,(%eax)
+ cb9:	eb 26                	jmp    ce1 <bigalloc+0x87>
+        p->s.size -= nunits;
+ cbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbe:	8b 40 04             	mov    0x4(%eax),%eax
+ cc1:	2b 45 08             	sub    0x8(%ebp),%eax
+ cc4:	89 c2                	mov    %eax,%edx
+ cc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc9:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ccc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ccf:	8b 40 04             	mov    0x4(%eax),%eax
+ cd2:	c1 e0 03             	shl    $0x3,%eax
+ cd5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+ cde:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ ce1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce4:	a3 58 12 00 00       	mov    %eax,0x1258
+      return p;
+ ce9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cec:	eb 3b                	jmp    d29 <bigalloc+0xcf>
+    if(p == freep)
+ cee:	a1 58 12 00 00       	mov    0x1258,%eax
+ cf3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cf6:	75 1e                	jne    d16 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ cf8:	83 ec 0c             	sub    $0xc,%esp
+ cfb:	ff 75 08             	push   0x8(%ebp)
+ cfe:	e8 fb fe ff ff       	call   bfe <morecore>
+ d03:	83 c4 10             	add    $0x10,%esp
+ d06:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d09:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d0d:	75 07                	jne    d16 <bigalloc+0xbc>
+        return 0;
+ d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+ d14:	eb 13                	jmp    d29 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d19:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1f:	8b 00                	mov    (%eax),%eax
+ d21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d24:	e9 70 ff ff ff       	jmp    c99 <bigalloc+0x3f>
+}
+ d29:	c9                   	leave
+ d2a:	c3                   	ret
+
+00000d2b <alloc>:
+alloc(uint nbytes)
+{
+ d2b:	55                   	push   %ebp
+ d2c:	89 e5                	mov    %esp,%ebp
+ d2e:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d31:	8b 45 08             	mov    0x8(%ebp),%eax
+ d34:	83 c0 07             	add    $0x7,%eax
+ d37:	c1 e8 03             	shr    $0x3,%eax
+ d3a:	83 c0 01             	add    $0x1,%eax
+ d3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d40:	ff 75 f4             	push   -0xc(%ebp)
+ d43:	e8 2e fd ff ff       	call   a76 <sizeclass>
+ d48:	83 c4 04             	add    $0x4,%esp
+ d4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d4e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d52:	79 2c                	jns    d80 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ d54:	83 ec 0c             	sub    $0xc,%esp
+ d57:	ff 75 f4             	push   -0xc(%ebp)
+ d5a:	e8 fb fe ff ff       	call   c5a <bigalloc>
+ d5f:	83 c4 10             	add    $0x10,%esp
+ d62:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d65:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d69:	75 0a                	jne    d75 <alloc+0x4a>
+      return 0;
+ d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+ d70:	e9 c8 00 00 00       	jmp    e3d <alloc+0x112>
+    return (void*)(p + 1);
+ d75:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d78:	83 c0 08             	add    $0x8,%eax
+ d7b:	e9 bd 00 00 00       	jmp    e3d <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ d80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d83:	8b 04 85 5c 12 00 00 	mov    0x125c(,%eax,4),%eax
+ d8a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d91:	74 1a                	je     dad <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d93:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d96:	8b 10                	mov    (%eax),%edx
+ d98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d9b:	89 14 85 5c 12 00 00 	mov    %edx,0x125c(,%eax,4)
+    return (void*)(p + 1);
+ da2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ da5:	83 c0 08             	add    $0x8,%eax
+ da8:	e9 90 00 00 00       	jmp    e3d <alloc+0x112>
+  }
+  nunits = 2 << c;
+ dad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db0:	ba 02 00 00 00       	mov    $0x2,%edx
+ db5:	89 c1                	mov    %eax,%ecx
+ db7:	d3 e2                	shl    %cl,%edx
+ db9:	89 d0                	mov    %edx,%eax
+ dbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ dbe:	a1 78 12 00 00       	mov    0x1278,%eax
+ dc3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ dc6:	c1 e2 03             	shl    $0x3,%edx
+ dc9:	01 d0                	add    %edx,%eax
+ dcb:	8b 15 7c 12 00 00    	mov    0x127c,%edx
+ dd1:	39 c2                	cmp    %eax,%edx
+ dd3:	73 3f                	jae    e14 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ dd5:	83 ec 0c             	sub    $0xc,%esp
+ dd8:	68 00 08 00 00       	push   $0x800
+ ddd:	e8 78 fe ff ff       	call   c5a <bigalloc>
+ de2:	83 c4 10             	add    $0x10,%esp
+ de5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ de8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dec:	75 07                	jne    df5 <alloc+0xca>
+      return 0;
+ dee:	b8 00 00 00 00       	mov    $0x0,%eax
+ df3:	eb 48                	jmp    e3d <alloc+0x112>
+    bump = (char*)p;
+ df5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ df8:	a3 78 12 00 00       	mov    %eax,0x1278
+    bumpend = (char*)(p + p->s.size);
+ dfd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e00:	8b 40 04             	mov    0x4(%eax),%eax
+ e03:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e0d:	01 d0                	add    %edx,%eax
+ e0f:	a3 7c 12 00 00       	mov    %eax,0x127c
+  }
+  p = (Header*)bump;
+ e14:	a1 78 12 00 00       	mov    0x1278,%eax
+ e19:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ e1c:	a1 78 12 00 00       	mov    0x1278,%eax
+ e21:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e24:	c1 e2 03             	shl    $0x3,%edx
+ e27:	01 d0                	add    %edx,%eax
+ e29:	a3 78 12 00 00       	mov    %eax,0x1278
+  p->s.size = nunits;
+ e2e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e31:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e34:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ e37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e3a:	83 c0 08             	add    $0x8,%eax
+}
+ e3d:	c9                   	leave
+ e3e:	c3                   	ret
+
+00000e3f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e3f:	55                   	push   %ebp
+ e40:	89 e5                	mov    %esp,%ebp
+ e42:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ e45:	e8 c2 fb ff ff       	call   a0c <lock>
+ e4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ e4d:	83 ec 0c             	sub    $0xc,%esp
+ e50:	ff 75 08             	push   0x8(%ebp)
+ e53:	e8 d3 fe ff ff       	call   d2b <alloc>
+ e58:	83 c4 10             	add    $0x10,%esp
+ e5b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ e5e:	83 ec 0c             	sub    $0xc,%esp
+ e61:	ff 75 f4             	push   -0xc(%ebp)
+ e64:	e8 df fb ff ff       	call   a48 <unlock>
+ e69:	83 c4 10             	add    $0x10,%esp
+  return p;
+ e6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e6f:	c9                   	leave
+ e70:	c3                   	ret
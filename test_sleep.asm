@@ -0,0 +1,1920 @@
+
+_test_sleep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define NSLEEPER 8
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 24             	sub    $0x24,%esp
+  int i, t0, t1, fd[2];
+  char c;
+
+  t0 = uptime();
+  11:	e8 bf 04 00 00       	call   4d5 <uptime>
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(sleep(10) < 0 || usleep(50000) < 0){
+  19:	83 ec 0c             	sub    $0xc,%esp
+  1c:	6a 0a                	push   $0xa
+  1e:	e8 a8 04 00 00       	call   4cb <sleep>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	78 14                	js     3e <main+0x3e>
+  2a:	83 ec 0c             	sub    $0xc,%esp
+  2d:	68 50 c3 00 00       	push   $0xc350
+  32:	e8 84 05 00 00       	call   5bb <usleep>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	79 17                	jns    55 <main+0x55>
+    printf(1, "error: sleep\n");
+  3e:	83 ec 08             	sub    $0x8,%esp
+  41:	68 5c 0f 00 00       	push   $0xf5c
+  46:	6a 01                	push   $0x1
+  48:	e8 72 08 00 00       	call   8bf <printf>
+  4d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  50:	e8 da 03 00 00       	call   42f <exit>
+  }
+  t1 = uptime();
+  55:	e8 7b 04 00 00       	call   4d5 <uptime>
+  5a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(t1 - t0 < 15){
+  5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  60:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  63:	83 f8 0e             	cmp    $0xe,%eax
+  66:	7f 1e                	jg     86 <main+0x86>
+    printf(1, "error: slept %d ticks, not 15\n", t1 - t0);
+  68:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  6b:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  6e:	83 ec 04             	sub    $0x4,%esp
+  71:	50                   	push   %eax
+  72:	68 6c 0f 00 00       	push   $0xf6c
+  77:	6a 01                	push   $0x1
+  79:	e8 41 08 00 00       	call   8bf <printf>
+  7e:	83 c4 10             	add    $0x10,%esp
+    exit();
+  81:	e8 a9 03 00 00       	call   42f <exit>
+  }
+  printf(1, "sleep ok\n");
+  86:	83 ec 08             	sub    $0x8,%esp
+  89:	68 8b 0f 00 00       	push   $0xf8b
+  8e:	6a 01                	push   $0x1
+  90:	e8 2a 08 00 00       	call   8bf <printf>
+  95:	83 c4 10             	add    $0x10,%esp
+
+  // Sleepers with different deadlines wake in deadline order.
+  pipe(fd);
+  98:	83 ec 0c             	sub    $0xc,%esp
+  9b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  9e:	50                   	push   %eax
+  9f:	e8 99 03 00 00       	call   43d <pipe>
+  a4:	83 c4 10             	add    $0x10,%esp
+  for(i = NSLEEPER-1; i >= 0; i--){
+  a7:	c7 45 f4 07 00 00 00 	movl   $0x7,-0xc(%ebp)
+  ae:	eb 4c                	jmp    fc <main+0xfc>
+    if(fork() == 0){
+  b0:	e8 73 03 00 00       	call   428 <fork>
+  b5:	85 c0                	test   %eax,%eax
+  b7:	75 3f                	jne    f8 <main+0xf8>
+      sleep(5 + 20*i);
+  b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  bc:	89 d0                	mov    %edx,%eax
+  be:	c1 e0 02             	shl    $0x2,%eax
+  c1:	01 d0                	add    %edx,%eax
+  c3:	c1 e0 02             	shl    $0x2,%eax
+  c6:	83 c0 05             	add    $0x5,%eax
+  c9:	83 ec 0c             	sub    $0xc,%esp
+  cc:	50                   	push   %eax
+  cd:	e8 f9 03 00 00       	call   4cb <sleep>
+  d2:	83 c4 10             	add    $0x10,%esp
+      c = 'a' + i;
+  d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d8:	83 c0 61             	add    $0x61,%eax
+  db:	88 45 e3             	mov    %al,-0x1d(%ebp)
+      write(fd[1], &c, 1);
+  de:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  e1:	83 ec 04             	sub    $0x4,%esp
+  e4:	6a 01                	push   $0x1
+  e6:	8d 55 e3             	lea    -0x1d(%ebp),%edx
+  e9:	52                   	push   %edx
+  ea:	50                   	push   %eax
+  eb:	e8 5b 03 00 00       	call   44b <write>
+  f0:	83 c4 10             	add    $0x10,%esp
+      exit();
+  f3:	e8 37 03 00 00       	call   42f <exit>
+  for(i = NSLEEPER-1; i >= 0; i--){
+  f8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  fc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 100:	79 ae                	jns    b0 <main+0xb0>
+    }
+  }
+  close(fd[1]);
+ 102:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 105:	83 ec 0c             	sub    $0xc,%esp
+ 108:	50                   	push   %eax
+ 109:	e8 44 03 00 00       	call   452 <close>
+ 10e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSLEEPER; i++){
+ 111:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 118:	eb 49                	jmp    163 <main+0x163>
+    if(read(fd[0], &c, 1) != 1 || c != 'a' + i){
+ 11a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 11d:	83 ec 04             	sub    $0x4,%esp
+ 120:	6a 01                	push   $0x1
+ 122:	8d 55 e3             	lea    -0x1d(%ebp),%edx
+ 125:	52                   	push   %edx
+ 126:	50                   	push   %eax
+ 127:	e8 18 03 00 00       	call   444 <read>
+ 12c:	83 c4 10             	add    $0x10,%esp
+ 12f:	83 f8 01             	cmp    $0x1,%eax
+ 132:	75 11                	jne    145 <main+0x145>
+ 134:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+ 138:	0f be d0             	movsbl %al,%edx
+ 13b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 13e:	83 c0 61             	add    $0x61,%eax
+ 141:	39 c2                	cmp    %eax,%edx
+ 143:	74 1a                	je     15f <main+0x15f>
+      printf(1, "error: sleeper %d woke out of order\n", i);
+ 145:	83 ec 04             	sub    $0x4,%esp
+ 148:	ff 75 f4             	push   -0xc(%ebp)
+ 14b:	68 98 0f 00 00       	push   $0xf98
+ 150:	6a 01                	push   $0x1
+ 152:	e8 68 07 00 00       	call   8bf <printf>
+ 157:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 15a:	e8 d0 02 00 00       	call   42f <exit>
+  for(i = 0; i < NSLEEPER; i++){
+ 15f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 163:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 167:	7e b1                	jle    11a <main+0x11a>
+    }
+  }
+  for(i = 0; i < NSLEEPER; i++)
+ 169:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 170:	eb 09                	jmp    17b <main+0x17b>
+    wait();
+ 172:	e8 bf 02 00 00       	call   436 <wait>
+  for(i = 0; i < NSLEEPER; i++)
+ 177:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 17b:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 17f:	7e f1                	jle    172 <main+0x172>
+  printf(1, "order ok\n");
+ 181:	83 ec 08             	sub    $0x8,%esp
+ 184:	68 bd 0f 00 00       	push   $0xfbd
+ 189:	6a 01                	push   $0x1
+ 18b:	e8 2f 07 00 00       	call   8bf <printf>
+ 190:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 193:	e8 97 02 00 00       	call   42f <exit>
+
+00000198 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 198:	55                   	push   %ebp
+ 199:	89 e5                	mov    %esp,%ebp
+ 19b:	57                   	push   %edi
+ 19c:	53                   	push   %ebx
+    if(cc < 1)
+ 19d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a0:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a6:	89 cb                	mov    %ecx,%ebx
+ 1a8:	89 df                	mov    %ebx,%edi
+ 1aa:	89 d1                	mov    %edx,%ecx
+ 1ac:	fc                   	cld
+ 1ad:	f3 aa                	rep stos %al,%es:(%edi)
+ 1af:	89 ca                	mov    %ecx,%edx
+ 1b1:	89 fb                	mov    %edi,%ebx
+ 1b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1b6:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 1b9:	90                   	nop
+ 1ba:	5b                   	pop    %ebx
+ 1bb:	5f                   	pop    %edi
+ 1bc:	5d                   	pop    %ebp
+ 1bd:	c3                   	ret
+
+000001be <strcpy>:
+{
+ 1be:	55                   	push   %ebp
+ 1bf:	89 e5                	mov    %esp,%ebp
+ 1c1:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ca:	90                   	nop
+ 1cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ce:	8d 42 01             	lea    0x1(%edx),%eax
+ 1d1:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d7:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1da:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1dd:	0f b6 12             	movzbl (%edx),%edx
+ 1e0:	88 10                	mov    %dl,(%eax)
+ 1e2:	0f b6 00             	movzbl (%eax),%eax
+ 1e5:	84 c0                	test   %al,%al
+ 1e7:	75 e2                	jne    1cb <strcpy+0xd>
+  return os;
+ 1e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1ec:	c9                   	leave
+ 1ed:	c3                   	ret
+
+000001ee <strcmp>:
+{
+ 1ee:	55                   	push   %ebp
+ 1ef:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1f1:	eb 08                	jmp    1fb <strcmp+0xd>
+    p++, q++;
+ 1f3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1f7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	0f b6 00             	movzbl (%eax),%eax
+ 201:	84 c0                	test   %al,%al
+ 203:	74 10                	je     215 <strcmp+0x27>
+ 205:	8b 45 08             	mov    0x8(%ebp),%eax
+ 208:	0f b6 10             	movzbl (%eax),%edx
+ 20b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20e:	0f b6 00             	movzbl (%eax),%eax
+ 211:	38 c2                	cmp    %al,%dl
+ 213:	74 de                	je     1f3 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 215:	8b 45 08             	mov    0x8(%ebp),%eax
+ 218:	0f b6 00             	movzbl (%eax),%eax
+ 21b:	0f b6 d0             	movzbl %al,%edx
+ 21e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 221:	0f b6 00             	movzbl (%eax),%eax
+ 224:	0f b6 c0             	movzbl %al,%eax
+ 227:	29 c2                	sub    %eax,%edx
+ 229:	89 d0                	mov    %edx,%eax
+}
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+
+0000022d <strlen>:
+{
+ 22d:	55                   	push   %ebp
+ 22e:	89 e5                	mov    %esp,%ebp
+ 230:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 233:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 23a:	eb 04                	jmp    240 <strlen+0x13>
+ 23c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 240:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	01 d0                	add    %edx,%eax
+ 248:	0f b6 00             	movzbl (%eax),%eax
+ 24b:	84 c0                	test   %al,%al
+ 24d:	75 ed                	jne    23c <strlen+0xf>
+  return n;
+ 24f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 252:	c9                   	leave
+ 253:	c3                   	ret
+
+00000254 <memset>:
+{
+ 254:	55                   	push   %ebp
+ 255:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 257:	8b 45 10             	mov    0x10(%ebp),%eax
+ 25a:	50                   	push   %eax
+ 25b:	ff 75 0c             	push   0xc(%ebp)
+ 25e:	ff 75 08             	push   0x8(%ebp)
+ 261:	e8 32 ff ff ff       	call   198 <stosb>
+ 266:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 269:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 26c:	c9                   	leave
+ 26d:	c3                   	ret
+
+0000026e <strchr>:
+{
+ 26e:	55                   	push   %ebp
+ 26f:	89 e5                	mov    %esp,%ebp
+ 271:	83 ec 04             	sub    $0x4,%esp
+ 274:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 277:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 27a:	eb 14                	jmp    290 <strchr+0x22>
+    if(*s == c)
+ 27c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27f:	0f b6 00             	movzbl (%eax),%eax
+ 282:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 285:	75 05                	jne    28c <strchr+0x1e>
+      return (char*)s;
+ 287:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28a:	eb 13                	jmp    29f <strchr+0x31>
+  for(; *s; s++)
+ 28c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 290:	8b 45 08             	mov    0x8(%ebp),%eax
+ 293:	0f b6 00             	movzbl (%eax),%eax
+ 296:	84 c0                	test   %al,%al
+ 298:	75 e2                	jne    27c <strchr+0xe>
+  return 0;
+ 29a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 29f:	c9                   	leave
+ 2a0:	c3                   	ret
+
+000002a1 <gets>:
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+ 2a4:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ae:	eb 42                	jmp    2f2 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2b8:	50                   	push   %eax
+ 2b9:	6a 00                	push   $0x0
+ 2bb:	e8 84 01 00 00       	call   444 <read>
+ 2c0:	83 c4 10             	add    $0x10,%esp
+ 2c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2c6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ca:	7e 33                	jle    2ff <gets+0x5e>
+    buf[i++] = c;
+ 2cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2cf:	8d 50 01             	lea    0x1(%eax),%edx
+ 2d2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2d5:	89 c2                	mov    %eax,%edx
+ 2d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2da:	01 c2                	add    %eax,%edx
+ 2dc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e0:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e6:	3c 0a                	cmp    $0xa,%al
+ 2e8:	74 16                	je     300 <gets+0x5f>
+ 2ea:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ee:	3c 0d                	cmp    $0xd,%al
+ 2f0:	74 0e                	je     300 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f5:	83 c0 01             	add    $0x1,%eax
+ 2f8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2fb:	7f b3                	jg     2b0 <gets+0xf>
+ 2fd:	eb 01                	jmp    300 <gets+0x5f>
+      break;
+ 2ff:	90                   	nop
+  }
+  buf[i] = '\0';
+ 300:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	01 d0                	add    %edx,%eax
+ 308:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 30e:	c9                   	leave
+ 30f:	c3                   	ret
+
+00000310 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 316:	83 ec 08             	sub    $0x8,%esp
+ 319:	6a 00                	push   $0x0
+ 31b:	ff 75 08             	push   0x8(%ebp)
+ 31e:	e8 44 01 00 00       	call   467 <open>
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 329:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 32d:	79 07                	jns    336 <stat+0x26>
+    return -1;
+ 32f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 334:	eb 25                	jmp    35b <stat+0x4b>
+  r = fstat(fd, st);
+ 336:	83 ec 08             	sub    $0x8,%esp
+ 339:	ff 75 0c             	push   0xc(%ebp)
+ 33c:	ff 75 f4             	push   -0xc(%ebp)
+ 33f:	e8 41 01 00 00       	call   485 <fstat>
+ 344:	83 c4 10             	add    $0x10,%esp
+ 347:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 34a:	83 ec 0c             	sub    $0xc,%esp
+ 34d:	ff 75 f4             	push   -0xc(%ebp)
+ 350:	e8 fd 00 00 00       	call   452 <close>
+ 355:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 358:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+
+0000035d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 35d:	55                   	push   %ebp
+ 35e:	89 e5                	mov    %esp,%ebp
+ 360:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 363:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 36a:	eb 25                	jmp    391 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 36c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 36f:	89 d0                	mov    %edx,%eax
+ 371:	c1 e0 02             	shl    $0x2,%eax
+ 374:	01 d0                	add    %edx,%eax
+ 376:	01 c0                	add    %eax,%eax
+ 378:	89 c1                	mov    %eax,%ecx
+ 37a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37d:	8d 50 01             	lea    0x1(%eax),%edx
+ 380:	89 55 08             	mov    %edx,0x8(%ebp)
+ 383:	0f b6 00             	movzbl (%eax),%eax
+ 386:	0f be c0             	movsbl %al,%eax
+ 389:	01 c8                	add    %ecx,%eax
+ 38b:	83 e8 30             	sub    $0x30,%eax
+ 38e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 391:	8b 45 08             	mov    0x8(%ebp),%eax
+ 394:	0f b6 00             	movzbl (%eax),%eax
+ 397:	3c 2f                	cmp    $0x2f,%al
+ 399:	7e 0a                	jle    3a5 <atoi+0x48>
+ 39b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39e:	0f b6 00             	movzbl (%eax),%eax
+ 3a1:	3c 39                	cmp    $0x39,%al
+ 3a3:	7e c7                	jle    36c <atoi+0xf>
+  return n;
+ 3a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3a8:	c9                   	leave
+ 3a9:	c3                   	ret
+
+000003aa <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3aa:	55                   	push   %ebp
+ 3ab:	89 e5                	mov    %esp,%ebp
+ 3ad:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3bc:	eb 17                	jmp    3d5 <memmove+0x2b>
+    *dst++ = *src++;
+ 3be:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3c1:	8d 42 01             	lea    0x1(%edx),%eax
+ 3c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ca:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3cd:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3d0:	0f b6 12             	movzbl (%edx),%edx
+ 3d3:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3db:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7f dc                	jg     3be <memmove+0x14>
+  return vdst;
+ 3e2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 3e7:	83 3d 54 13 00 00 00 	cmpl   $0x0,0x1354
+  jg 2f
+ 3ee:	7f 2e                	jg     41e <dosyscall+0x37>
+  jl 1f
+ 3f0:	7c 29                	jl     41b <dosyscall+0x34>
+  pushl %eax
+ 3f2:	50                   	push   %eax
+  pushl %ebx
+ 3f3:	53                   	push   %ebx
+  movl $1, %eax
+ 3f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 3f9:	0f a2                	cpuid
+  popl %ebx
+ 3fb:	5b                   	pop    %ebx
+  popl %eax
+ 3fc:	58                   	pop    %eax
+  movl $-1, sysmode
+ 3fd:	c7 05 54 13 00 00 ff 	movl   $0xffffffff,0x1354
+ 404:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 407:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 40d:	74 0c                	je     41b <dosyscall+0x34>
+  movl $1, sysmode
+ 40f:	c7 05 54 13 00 00 01 	movl   $0x1,0x1354
+ 416:	00 00 00 
+  jmp 2f
+ 419:	eb 03                	jmp    41e <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 41b:	cd 40                	int    $0x40
+  ret
+ 41d:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 41e:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 420:	ba 27 04 00 00       	mov    $0x427,%edx
+  sysenter
+ 425:	0f 34                	sysenter
+3:
+  ret
+ 427:	c3                   	ret
+
+00000428 <fork>:
+
+SYSCALL(fork)
+ 428:	b8 01 00 00 00       	mov    $0x1,%eax
+ 42d:	eb b8                	jmp    3e7 <dosyscall>
+
+0000042f <exit>:
+SYSCALL(exit)
+ 42f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 434:	eb b1                	jmp    3e7 <dosyscall>
+
+00000436 <wait>:
+SYSCALL(wait)
+ 436:	b8 03 00 00 00       	mov    $0x3,%eax
+ 43b:	eb aa                	jmp    3e7 <dosyscall>
+
+0000043d <pipe>:
+SYSCALL(pipe)
+ 43d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 442:	eb a3                	jmp    3e7 <dosyscall>
+
+00000444 <read>:
+SYSCALL(read)
+ 444:	b8 05 00 00 00       	mov    $0x5,%eax
+ 449:	eb 9c                	jmp    3e7 <dosyscall>
+
+0000044b <write>:
+SYSCALL(write)
+ 44b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 450:	eb 95                	jmp    3e7 <dosyscall>
+
+00000452 <close>:
+SYSCALL(close)
+ 452:	b8 15 00 00 00       	mov    $0x15,%eax
+ 457:	eb 8e                	jmp    3e7 <dosyscall>
+
+00000459 <kill>:
+SYSCALL(kill)
+ 459:	b8 06 00 00 00       	mov    $0x6,%eax
+ 45e:	eb 87                	jmp    3e7 <dosyscall>
+
+00000460 <exec>:
+SYSCALL(exec)
+ 460:	b8 07 00 00 00       	mov    $0x7,%eax
+ 465:	eb 80                	jmp    3e7 <dosyscall>
+
+00000467 <open>:
+SYSCALL(open)
+ 467:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 46c:	e9 76 ff ff ff       	jmp    3e7 <dosyscall>
+
+00000471 <mknod>:
+SYSCALL(mknod)
+ 471:	b8 11 00 00 00       	mov    $0x11,%eax
+ 476:	e9 6c ff ff ff       	jmp    3e7 <dosyscall>
+
+0000047b <unlink>:
+SYSCALL(unlink)
+ 47b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 480:	e9 62 ff ff ff       	jmp    3e7 <dosyscall>
+
+00000485 <fstat>:
+SYSCALL(fstat)
+ 485:	b8 08 00 00 00       	mov    $0x8,%eax
+ 48a:	e9 58 ff ff ff       	jmp    3e7 <dosyscall>
+
+0000048f <link>:
+SYSCALL(link)
+ 48f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 494:	e9 4e ff ff ff       	jmp    3e7 <dosyscall>
+
+00000499 <mkdir>:
+SYSCALL(mkdir)
+ 499:	b8 14 00 00 00       	mov    $0x14,%eax
+ 49e:	e9 44 ff ff ff       	jmp    3e7 <dosyscall>
+
+000004a3 <chdir>:
+SYSCALL(chdir)
+ 4a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a8:	e9 3a ff ff ff       	jmp    3e7 <dosyscall>
+
+000004ad <dup>:
+SYSCALL(dup)
+ 4ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b2:	e9 30 ff ff ff       	jmp    3e7 <dosyscall>
+
+000004b7 <getpid>:
+SYSCALL(getpid)
+ 4b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4bc:	e9 26 ff ff ff       	jmp    3e7 <dosyscall>
+
+000004c1 <sbrk>:
+SYSCALL(sbrk)
+ 4c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c6:	e9 1c ff ff ff       	jmp    3e7 <dosyscall>
+
+000004cb <sleep>:
+SYSCALL(sleep)
+ 4cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d0:	e9 12 ff ff ff       	jmp    3e7 <dosyscall>
+
+000004d5 <uptime>:
+SYSCALL(uptime)
+ 4d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4da:	e9 08 ff ff ff       	jmp    3e7 <dosyscall>
+
+000004df <symlink>:
+SYSCALL(symlink)
+ 4df:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e4:	e9 fe fe ff ff       	jmp    3e7 <dosyscall>
+
+000004e9 <readlink>:
+SYSCALL(readlink)
+ 4e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4ee:	e9 f4 fe ff ff       	jmp    3e7 <dosyscall>
+
+000004f3 <fprot>:
+SYSCALL(fprot)
+ 4f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f8:	e9 ea fe ff ff       	jmp    3e7 <dosyscall>
+
+000004fd <funprot>:
+SYSCALL(funprot)
+ 4fd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 502:	e9 e0 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000507 <funlock>:
+SYSCALL(funlock)
+ 507:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 50c:	e9 d6 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000511 <mmap>:
+SYSCALL(mmap)
+ 511:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 516:	e9 cc fe ff ff       	jmp    3e7 <dosyscall>
+
+0000051b <munmap>:
+SYSCALL(munmap)
+ 51b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 520:	e9 c2 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000525 <sendfile>:
+SYSCALL(sendfile)
+ 525:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 52a:	e9 b8 fe ff ff       	jmp    3e7 <dosyscall>
+
+0000052f <readv>:
+SYSCALL(readv)
+ 52f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 534:	e9 ae fe ff ff       	jmp    3e7 <dosyscall>
+
+00000539 <writev>:
+SYSCALL(writev)
+ 539:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 53e:	e9 a4 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000543 <pread>:
+SYSCALL(pread)
+ 543:	b8 20 00 00 00       	mov    $0x20,%eax
+ 548:	e9 9a fe ff ff       	jmp    3e7 <dosyscall>
+
+0000054d <pwrite>:
+SYSCALL(pwrite)
+ 54d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 552:	e9 90 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000557 <lseek>:
+SYSCALL(lseek)
+ 557:	b8 22 00 00 00       	mov    $0x22,%eax
+ 55c:	e9 86 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000561 <spawn>:
+SYSCALL(spawn)
+ 561:	b8 23 00 00 00       	mov    $0x23,%eax
+ 566:	e9 7c fe ff ff       	jmp    3e7 <dosyscall>
+
+0000056b <setpriority>:
+SYSCALL(setpriority)
+ 56b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 570:	e9 72 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000575 <kthread_create>:
+SYSCALL(kthread_create)
+ 575:	b8 25 00 00 00       	mov    $0x25,%eax
+ 57a:	e9 68 fe ff ff       	jmp    3e7 <dosyscall>
+
+0000057f <kthread_id>:
+SYSCALL(kthread_id)
+ 57f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 584:	e9 5e fe ff ff       	jmp    3e7 <dosyscall>
+
+00000589 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 589:	b8 27 00 00 00       	mov    $0x27,%eax
+ 58e:	e9 54 fe ff ff       	jmp    3e7 <dosyscall>
+
+00000593 <kthread_join>:
+SYSCALL(kthread_join)
+ 593:	b8 28 00 00 00       	mov    $0x28,%eax
+ 598:	e9 4a fe ff ff       	jmp    3e7 <dosyscall>
+
+0000059d <futex>:
+SYSCALL(futex)
+ 59d:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a2:	e9 40 fe ff ff       	jmp    3e7 <dosyscall>
+
+000005a7 <signal>:
+SYSCALL(signal)
+ 5a7:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5ac:	e9 36 fe ff ff       	jmp    3e7 <dosyscall>
+
+000005b1 <alarm>:
+SYSCALL(alarm)
+ 5b1:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5b6:	e9 2c fe ff ff       	jmp    3e7 <dosyscall>
+
+000005bb <usleep>:
+SYSCALL(usleep)
+ 5bb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5c0:	e9 22 fe ff ff       	jmp    3e7 <dosyscall>
+
+000005c5 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5c5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5ca:	e9 18 fe ff ff       	jmp    3e7 <dosyscall>
+
+000005cf <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5cf:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5d4:	e9 0e fe ff ff       	jmp    3e7 <dosyscall>
+
+000005d9 <getrusage>:
+SYSCALL(getrusage)
+ 5d9:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5de:	e9 04 fe ff ff       	jmp    3e7 <dosyscall>
+
+000005e3 <mount>:
+SYSCALL(mount)
+ 5e3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5e8:	e9 fa fd ff ff       	jmp    3e7 <dosyscall>
+
+000005ed <getdents>:
+SYSCALL(getdents)
+ 5ed:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5f2:	e9 f0 fd ff ff       	jmp    3e7 <dosyscall>
+
+000005f7 <yield>:
+SYSCALL(yield)
+ 5f7:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5fc:	e9 e6 fd ff ff       	jmp    3e7 <dosyscall>
+
+00000601 <ncpu>:
+SYSCALL(ncpu)
+ 601:	b8 33 00 00 00       	mov    $0x33,%eax
+ 606:	e9 dc fd ff ff       	jmp    3e7 <dosyscall>
+
+0000060b <fallocate>:
+SYSCALL(fallocate)
+ 60b:	b8 34 00 00 00       	mov    $0x34,%eax
+ 610:	e9 d2 fd ff ff       	jmp    3e7 <dosyscall>
+
+00000615 <ftruncate>:
+SYSCALL(ftruncate)
+ 615:	b8 35 00 00 00       	mov    $0x35,%eax
+ 61a:	e9 c8 fd ff ff       	jmp    3e7 <dosyscall>
+
+0000061f <fsync>:
+SYSCALL(fsync)
+ 61f:	b8 36 00 00 00       	mov    $0x36,%eax
+ 624:	e9 be fd ff ff       	jmp    3e7 <dosyscall>
+
+00000629 <fdatasync>:
+SYSCALL(fdatasync)
+ 629:	b8 37 00 00 00       	mov    $0x37,%eax
+ 62e:	e9 b4 fd ff ff       	jmp    3e7 <dosyscall>
+
+00000633 <poll>:
+SYSCALL(poll)
+ 633:	b8 38 00 00 00       	mov    $0x38,%eax
+ 638:	e9 aa fd ff ff       	jmp    3e7 <dosyscall>
+
+0000063d <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 63d:	55                   	push   %ebp
+ 63e:	89 e5                	mov    %esp,%ebp
+ 640:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	8b 40 04             	mov    0x4(%eax),%eax
+ 649:	85 c0                	test   %eax,%eax
+ 64b:	7e 1f                	jle    66c <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 64d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 650:	8b 50 04             	mov    0x4(%eax),%edx
+ 653:	8b 45 08             	mov    0x8(%ebp),%eax
+ 656:	8d 48 08             	lea    0x8(%eax),%ecx
+ 659:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65c:	8b 00                	mov    (%eax),%eax
+ 65e:	83 ec 04             	sub    $0x4,%esp
+ 661:	52                   	push   %edx
+ 662:	51                   	push   %ecx
+ 663:	50                   	push   %eax
+ 664:	e8 d0 fe ff ff       	call   539 <writev>
+ 669:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 66c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 676:	8b 45 08             	mov    0x8(%ebp),%eax
+ 679:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 680:	00 00 00 
+}
+ 683:	90                   	nop
+ 684:	c9                   	leave
+ 685:	c3                   	ret
+
+00000686 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 686:	55                   	push   %ebp
+ 687:	89 e5                	mov    %esp,%ebp
+ 689:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 68c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 690:	0f 84 94 00 00 00    	je     72a <put+0xa4>
+    return;
+  if(o->n > 0){
+ 696:	8b 45 08             	mov    0x8(%ebp),%eax
+ 699:	8b 40 04             	mov    0x4(%eax),%eax
+ 69c:	85 c0                	test   %eax,%eax
+ 69e:	7e 40                	jle    6e0 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 6a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a6:	83 e8 01             	sub    $0x1,%eax
+ 6a9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b3:	01 d0                	add    %edx,%eax
+ 6b5:	83 c0 08             	add    $0x8,%eax
+ 6b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 6bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6be:	8b 10                	mov    (%eax),%edx
+ 6c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c6:	01 d0                	add    %edx,%eax
+ 6c8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 6cb:	75 13                	jne    6e0 <put+0x5a>
+      v->iov_len += n;
+ 6cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d0:	8b 50 04             	mov    0x4(%eax),%edx
+ 6d3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6d6:	01 c2                	add    %eax,%edx
+ 6d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6db:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 6de:	eb 4b                	jmp    72b <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 6e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6e6:	83 f8 10             	cmp    $0x10,%eax
+ 6e9:	75 0e                	jne    6f9 <put+0x73>
+    flush(o);
+ 6eb:	83 ec 0c             	sub    $0xc,%esp
+ 6ee:	ff 75 08             	push   0x8(%ebp)
+ 6f1:	e8 47 ff ff ff       	call   63d <flush>
+ 6f6:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 6f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fc:	8b 50 04             	mov    0x4(%eax),%edx
+ 6ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 702:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 705:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 709:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70c:	8b 50 04             	mov    0x4(%eax),%edx
+ 70f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 712:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 715:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 719:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71c:	8b 40 04             	mov    0x4(%eax),%eax
+ 71f:	8d 50 01             	lea    0x1(%eax),%edx
+ 722:	8b 45 08             	mov    0x8(%ebp),%eax
+ 725:	89 50 04             	mov    %edx,0x4(%eax)
+ 728:	eb 01                	jmp    72b <put+0xa5>
+    return;
+ 72a:	90                   	nop
+}
+ 72b:	c9                   	leave
+ 72c:	c3                   	ret
+
+0000072d <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 72d:	55                   	push   %ebp
+ 72e:	89 e5                	mov    %esp,%ebp
+ 730:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 733:	8b 45 08             	mov    0x8(%ebp),%eax
+ 736:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 73c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73f:	01 d0                	add    %edx,%eax
+ 741:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 746:	77 0b                	ja     753 <room+0x26>
+ 748:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74b:	8b 40 04             	mov    0x4(%eax),%eax
+ 74e:	83 f8 10             	cmp    $0x10,%eax
+ 751:	75 0e                	jne    761 <room+0x34>
+    flush(o);
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	ff 75 08             	push   0x8(%ebp)
+ 759:	e8 df fe ff ff       	call   63d <flush>
+ 75e:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 761:	8b 45 08             	mov    0x8(%ebp),%eax
+ 764:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 76a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 773:	01 d0                	add    %edx,%eax
+}
+ 775:	c9                   	leave
+ 776:	c3                   	ret
+
+00000777 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 777:	55                   	push   %ebp
+ 778:	89 e5                	mov    %esp,%ebp
+ 77a:	83 ec 28             	sub    $0x28,%esp
+ 77d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 780:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 783:	83 ec 08             	sub    $0x8,%esp
+ 786:	6a 01                	push   $0x1
+ 788:	ff 75 08             	push   0x8(%ebp)
+ 78b:	e8 9d ff ff ff       	call   72d <room>
+ 790:	83 c4 10             	add    $0x10,%esp
+ 793:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 796:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 799:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 79d:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 79f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7a8:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ae:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 7b4:	83 ec 04             	sub    $0x4,%esp
+ 7b7:	6a 01                	push   $0x1
+ 7b9:	ff 75 f4             	push   -0xc(%ebp)
+ 7bc:	ff 75 08             	push   0x8(%ebp)
+ 7bf:	e8 c2 fe ff ff       	call   686 <put>
+ 7c4:	83 c4 10             	add    $0x10,%esp
+}
+ 7c7:	90                   	nop
+ 7c8:	c9                   	leave
+ 7c9:	c3                   	ret
+
+000007ca <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 7ca:	55                   	push   %ebp
+ 7cb:	89 e5                	mov    %esp,%ebp
+ 7cd:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 7d0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7d7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7db:	74 17                	je     7f4 <printint+0x2a>
+ 7dd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7e1:	79 11                	jns    7f4 <printint+0x2a>
+    neg = 1;
+ 7e3:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ed:	f7 d8                	neg    %eax
+ 7ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7f2:	eb 06                	jmp    7fa <printint+0x30>
+  } else {
+    x = xx;
+ 7f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 801:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 804:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 807:	ba 00 00 00 00       	mov    $0x0,%edx
+ 80c:	f7 f1                	div    %ecx
+ 80e:	89 d1                	mov    %edx,%ecx
+ 810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 813:	8d 50 01             	lea    0x1(%eax),%edx
+ 816:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 819:	0f b6 91 58 13 00 00 	movzbl 0x1358(%ecx),%edx
+ 820:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 824:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 827:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 82a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 82f:	f7 f1                	div    %ecx
+ 831:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 834:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 838:	75 c7                	jne    801 <printint+0x37>
+  if(neg)
+ 83a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 83e:	74 0e                	je     84e <printint+0x84>
+    buf[i++] = '-';
+ 840:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 843:	8d 50 01             	lea    0x1(%eax),%edx
+ 846:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 849:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 84e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 851:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 854:	83 ec 08             	sub    $0x8,%esp
+ 857:	ff 75 e8             	push   -0x18(%ebp)
+ 85a:	ff 75 08             	push   0x8(%ebp)
+ 85d:	e8 cb fe ff ff       	call   72d <room>
+ 862:	83 c4 10             	add    $0x10,%esp
+ 865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 868:	eb 1d                	jmp    887 <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 86a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 86d:	83 e8 01             	sub    $0x1,%eax
+ 870:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 873:	89 c2                	mov    %eax,%edx
+ 875:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 878:	01 c2                	add    %eax,%edx
+ 87a:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 87d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 880:	01 c8                	add    %ecx,%eax
+ 882:	0f b6 00             	movzbl (%eax),%eax
+ 885:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 887:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 88b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 88f:	79 d9                	jns    86a <printint+0xa0>
+  o->used += n;
+ 891:	8b 45 08             	mov    0x8(%ebp),%eax
+ 894:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 89a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89d:	01 c2                	add    %eax,%edx
+ 89f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a2:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 8a8:	83 ec 04             	sub    $0x4,%esp
+ 8ab:	ff 75 e8             	push   -0x18(%ebp)
+ 8ae:	ff 75 e4             	push   -0x1c(%ebp)
+ 8b1:	ff 75 08             	push   0x8(%ebp)
+ 8b4:	e8 cd fd ff ff       	call   686 <put>
+ 8b9:	83 c4 10             	add    $0x10,%esp
+}
+ 8bc:	90                   	nop
+ 8bd:	c9                   	leave
+ 8be:	c3                   	ret
+
+000008bf <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8bf:	55                   	push   %ebp
+ 8c0:	89 e5                	mov    %esp,%ebp
+ 8c2:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 8c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cb:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 8d1:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 8d8:	00 00 00 
+  o.used = 0;
+ 8db:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 8e2:	00 00 00 
+  state = 0;
+ 8e5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8ef:	83 c0 04             	add    $0x4,%eax
+ 8f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 8f5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8fc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 903:	e9 82 01 00 00       	jmp    a8a <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 908:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 90b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90e:	01 d0                	add    %edx,%eax
+ 910:	0f b6 00             	movzbl (%eax),%eax
+ 913:	0f be c0             	movsbl %al,%eax
+ 916:	25 ff 00 00 00       	and    $0xff,%eax
+ 91b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 91e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 922:	75 38                	jne    95c <printf+0x9d>
+      if(c == '%'){
+ 924:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 928:	0f 85 58 01 00 00    	jne    a86 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 92e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 931:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 934:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 937:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 93a:	01 ca                	add    %ecx,%edx
+ 93c:	83 ec 04             	sub    $0x4,%esp
+ 93f:	50                   	push   %eax
+ 940:	52                   	push   %edx
+ 941:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 947:	50                   	push   %eax
+ 948:	e8 39 fd ff ff       	call   686 <put>
+ 94d:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 950:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 957:	e9 2a 01 00 00       	jmp    a86 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 95c:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 960:	0f 85 20 01 00 00    	jne    a86 <printf+0x1c7>
+      if(c == 'd'){
+ 966:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 96a:	75 22                	jne    98e <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 96c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 96f:	8b 00                	mov    (%eax),%eax
+ 971:	6a 01                	push   $0x1
+ 973:	6a 0a                	push   $0xa
+ 975:	50                   	push   %eax
+ 976:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 97c:	50                   	push   %eax
+ 97d:	e8 48 fe ff ff       	call   7ca <printint>
+ 982:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 985:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 989:	e9 e8 00 00 00       	jmp    a76 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 98e:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 992:	74 06                	je     99a <printf+0xdb>
+ 994:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 998:	75 22                	jne    9bc <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 99a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 99d:	8b 00                	mov    (%eax),%eax
+ 99f:	6a 00                	push   $0x0
+ 9a1:	6a 10                	push   $0x10
+ 9a3:	50                   	push   %eax
+ 9a4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9aa:	50                   	push   %eax
+ 9ab:	e8 1a fe ff ff       	call   7ca <printint>
+ 9b0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9b3:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9b7:	e9 ba 00 00 00       	jmp    a76 <printf+0x1b7>
+      } else if(c == 's'){
+ 9bc:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 9c0:	75 3f                	jne    a01 <printf+0x142>
+        s = (char*)*ap;
+ 9c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c5:	8b 00                	mov    (%eax),%eax
+ 9c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9ca:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 9ce:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9d2:	75 07                	jne    9db <printf+0x11c>
+          s = "(null)";
+ 9d4:	c7 45 f4 c7 0f 00 00 	movl   $0xfc7,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 9db:	83 ec 0c             	sub    $0xc,%esp
+ 9de:	ff 75 f4             	push   -0xc(%ebp)
+ 9e1:	e8 47 f8 ff ff       	call   22d <strlen>
+ 9e6:	83 c4 10             	add    $0x10,%esp
+ 9e9:	83 ec 04             	sub    $0x4,%esp
+ 9ec:	50                   	push   %eax
+ 9ed:	ff 75 f4             	push   -0xc(%ebp)
+ 9f0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9f6:	50                   	push   %eax
+ 9f7:	e8 8a fc ff ff       	call   686 <put>
+ 9fc:	83 c4 10             	add    $0x10,%esp
+ 9ff:	eb 75                	jmp    a76 <printf+0x1b7>
+      } else if(c == 'c'){
+ a01:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a05:	75 21                	jne    a28 <printf+0x169>
+        putc(&o, *ap);
+ a07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a0a:	8b 00                	mov    (%eax),%eax
+ a0c:	0f be c0             	movsbl %al,%eax
+ a0f:	83 ec 08             	sub    $0x8,%esp
+ a12:	50                   	push   %eax
+ a13:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a19:	50                   	push   %eax
+ a1a:	e8 58 fd ff ff       	call   777 <putc>
+ a1f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a22:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a26:	eb 4e                	jmp    a76 <printf+0x1b7>
+      } else if(c == '%'){
+ a28:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a2c:	75 1b                	jne    a49 <printf+0x18a>
+        putc(&o, c);
+ a2e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a31:	0f be c0             	movsbl %al,%eax
+ a34:	83 ec 08             	sub    $0x8,%esp
+ a37:	50                   	push   %eax
+ a38:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a3e:	50                   	push   %eax
+ a3f:	e8 33 fd ff ff       	call   777 <putc>
+ a44:	83 c4 10             	add    $0x10,%esp
+ a47:	eb 2d                	jmp    a76 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a49:	83 ec 08             	sub    $0x8,%esp
+ a4c:	6a 25                	push   $0x25
+ a4e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a54:	50                   	push   %eax
+ a55:	e8 1d fd ff ff       	call   777 <putc>
+ a5a:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ a5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a60:	0f be c0             	movsbl %al,%eax
+ a63:	83 ec 08             	sub    $0x8,%esp
+ a66:	50                   	push   %eax
+ a67:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a6d:	50                   	push   %eax
+ a6e:	e8 04 fd ff ff       	call   777 <putc>
+ a73:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a76:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ a7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a80:	83 c0 01             	add    $0x1,%eax
+ a83:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a86:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a90:	01 d0                	add    %edx,%eax
+ a92:	0f b6 00             	movzbl (%eax),%eax
+ a95:	84 c0                	test   %al,%al
+ a97:	0f 85 6b fe ff ff    	jne    908 <printf+0x49>
+    }
+  }
+  if(state == 0)
+ a9d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ aa1:	75 22                	jne    ac5 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ aa3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa6:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ aa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ aac:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ aaf:	01 ca                	add    %ecx,%edx
+ ab1:	83 ec 04             	sub    $0x4,%esp
+ ab4:	50                   	push   %eax
+ ab5:	52                   	push   %edx
+ ab6:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ abc:	50                   	push   %eax
+ abd:	e8 c4 fb ff ff       	call   686 <put>
+ ac2:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ ac5:	83 ec 0c             	sub    $0xc,%esp
+ ac8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ace:	50                   	push   %eax
+ acf:	e8 69 fb ff ff       	call   63d <flush>
+ ad4:	83 c4 10             	add    $0x10,%esp
+}
+ ad7:	90                   	nop
+ ad8:	c9                   	leave
+ ad9:	c3                   	ret
+
+00000ada <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ ada:	55                   	push   %ebp
+ adb:	89 e5                	mov    %esp,%ebp
+ add:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+ ae3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ ae9:	f0 87 02             	lock xchg %eax,(%edx)
+ aec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ aef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ af2:	c9                   	leave
+ af3:	c3                   	ret
+
+00000af4 <lock>:
+{
+ af4:	55                   	push   %ebp
+ af5:	89 e5                	mov    %esp,%ebp
+ af7:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ afa:	a1 6c 13 00 00       	mov    0x136c,%eax
+ aff:	85 c0                	test   %eax,%eax
+ b01:	74 09                	je     b0c <lock+0x18>
+ b03:	a1 6c 13 00 00       	mov    0x136c,%eax
+ b08:	ff d0                	call   *%eax
+ b0a:	eb 05                	jmp    b11 <lock+0x1d>
+ b0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b14:	90                   	nop
+ b15:	83 ec 08             	sub    $0x8,%esp
+ b18:	6a 01                	push   $0x1
+ b1a:	68 a4 13 00 00       	push   $0x13a4
+ b1f:	e8 b6 ff ff ff       	call   ada <xchg>
+ b24:	83 c4 10             	add    $0x10,%esp
+ b27:	85 c0                	test   %eax,%eax
+ b29:	75 ea                	jne    b15 <lock+0x21>
+  return pin;
+ b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b2e:	c9                   	leave
+ b2f:	c3                   	ret
+
+00000b30 <unlock>:
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b36:	6a 00                	push   $0x0
+ b38:	68 a4 13 00 00       	push   $0x13a4
+ b3d:	e8 98 ff ff ff       	call   ada <xchg>
+ b42:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b45:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b49:	78 10                	js     b5b <unlock+0x2b>
+    mallocunpin(pin);
+ b4b:	a1 70 13 00 00       	mov    0x1370,%eax
+ b50:	83 ec 0c             	sub    $0xc,%esp
+ b53:	ff 75 08             	push   0x8(%ebp)
+ b56:	ff d0                	call   *%eax
+ b58:	83 c4 10             	add    $0x10,%esp
+}
+ b5b:	90                   	nop
+ b5c:	c9                   	leave
+ b5d:	c3                   	ret
+
+00000b5e <sizeclass>:
+{
+ b5e:	55                   	push   %ebp
+ b5f:	89 e5                	mov    %esp,%ebp
+ b61:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ b64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ b6b:	eb 1c                	jmp    b89 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ b6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b70:	ba 02 00 00 00       	mov    $0x2,%edx
+ b75:	89 c1                	mov    %eax,%ecx
+ b77:	d3 e2                	shl    %cl,%edx
+ b79:	89 d0                	mov    %edx,%eax
+ b7b:	3b 45 08             	cmp    0x8(%ebp),%eax
+ b7e:	72 05                	jb     b85 <sizeclass+0x27>
+      return c;
+ b80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b83:	eb 0f                	jmp    b94 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ b85:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ b89:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ b8d:	7e de                	jle    b6d <sizeclass+0xf>
+  return -1;
+ b8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b94:	c9                   	leave
+ b95:	c3                   	ret
+
+00000b96 <bigfree>:
+{
+ b96:	55                   	push   %ebp
+ b97:	89 e5                	mov    %esp,%ebp
+ b99:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b9c:	a1 7c 13 00 00       	mov    0x137c,%eax
+ ba1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ba4:	eb 24                	jmp    bca <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba9:	8b 00                	mov    (%eax),%eax
+ bab:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bae:	72 12                	jb     bc2 <bigfree+0x2c>
+ bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bb6:	72 24                	jb     bdc <bigfree+0x46>
+ bb8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbb:	8b 00                	mov    (%eax),%eax
+ bbd:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bc0:	72 1a                	jb     bdc <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc5:	8b 00                	mov    (%eax),%eax
+ bc7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bca:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bd0:	73 d4                	jae    ba6 <bigfree+0x10>
+ bd2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd5:	8b 00                	mov    (%eax),%eax
+ bd7:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bda:	73 ca                	jae    ba6 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdf:	8b 40 04             	mov    0x4(%eax),%eax
+ be2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ be9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bec:	01 c2                	add    %eax,%edx
+ bee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf1:	8b 00                	mov    (%eax),%eax
+ bf3:	39 c2                	cmp    %eax,%edx
+ bf5:	75 24                	jne    c1b <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfa:	8b 50 04             	mov    0x4(%eax),%edx
+ bfd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c00:	8b 00                	mov    (%eax),%eax
+ c02:	8b 40 04             	mov    0x4(%eax),%eax
+ c05:	01 c2                	add    %eax,%edx
+ c07:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c10:	8b 00                	mov    (%eax),%eax
+ c12:	8b 10                	mov    (%eax),%edx
+ c14:	8b 45 08             	mov    0x8(%ebp),%eax
+ c17:	89 10                	mov    %edx,(%eax)
+ c19:	eb 0a                	jmp    c25 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1e:	8b 10                	mov    (%eax),%edx
+ c20:	8b 45 08             	mov    0x8(%ebp),%eax
+ c23:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c28:	8b 40 04             	mov    0x4(%eax),%eax
+ c2b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c35:	01 d0                	add    %edx,%eax
+ c37:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c3a:	75 20                	jne    c5c <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ c3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3f:	8b 50 04             	mov    0x4(%eax),%edx
+ c42:	8b 45 08             	mov    0x8(%ebp),%eax
+ c45:	8b 40 04             	mov    0x4(%eax),%eax
+ c48:	01 c2                	add    %eax,%edx
+ c4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c50:	8b 45 08             	mov    0x8(%ebp),%eax
+ c53:	8b 10                	mov    (%eax),%edx
+ c55:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c58:	89 10                	mov    %edx,(%eax)
+ c5a:	eb 08                	jmp    c64 <bigfree+0xce>
+    p->s.ptr = bp;
+ c5c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c62:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c67:	a3 7c 13 00 00       	mov    %eax,0x137c
+}
+ c6c:	90                   	nop
+ c6d:	c9                   	leave
+ c6e:	c3                   	ret
+
+00000c6f <free>:
+{
+ c6f:	55                   	push   %ebp
+ c70:	89 e5                	mov    %esp,%ebp
+ c72:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ c75:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ c79:	74 68                	je     ce3 <free+0x74>
+  bp = (Header*)ap - 1;
+ c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7e:	83 e8 08             	sub    $0x8,%eax
+ c81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ c84:	e8 6b fe ff ff       	call   af4 <lock>
+ c89:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ c8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8f:	8b 40 04             	mov    0x4(%eax),%eax
+ c92:	83 ec 0c             	sub    $0xc,%esp
+ c95:	50                   	push   %eax
+ c96:	e8 c3 fe ff ff       	call   b5e <sizeclass>
+ c9b:	83 c4 10             	add    $0x10,%esp
+ c9e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ca1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ca5:	78 1e                	js     cc5 <free+0x56>
+    bp->s.ptr = classfree[c];
+ ca7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ caa:	8b 14 85 80 13 00 00 	mov    0x1380(,%eax,4),%edx
+ cb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb4:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ cb6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cb9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ cbc:	89 14 85 80 13 00 00 	mov    %edx,0x1380(,%eax,4)
+ cc3:	eb 0e                	jmp    cd3 <free+0x64>
+    bigfree(bp);
+ cc5:	83 ec 0c             	sub    $0xc,%esp
+ cc8:	ff 75 f4             	push   -0xc(%ebp)
+ ccb:	e8 c6 fe ff ff       	call   b96 <bigfree>
+ cd0:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ cd3:	83 ec 0c             	sub    $0xc,%esp
+ cd6:	ff 75 f0             	push   -0x10(%ebp)
+ cd9:	e8 52 fe ff ff       	call   b30 <unlock>
+ cde:	83 c4 10             	add    $0x10,%esp
+ ce1:	eb 01                	jmp    ce4 <free+0x75>
+    return;
+ ce3:	90                   	nop
+}
+ ce4:	c9                   	leave
+ ce5:	c3                   	ret
+
+00000ce6 <morecore>:
+{
+ ce6:	55                   	push   %ebp
+ ce7:	89 e5                	mov    %esp,%ebp
+ ce9:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ cec:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ cf3:	77 07                	ja     cfc <morecore+0x16>
+    nu = 4096;
+ cf5:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cff:	c1 e0 03             	shl    $0x3,%eax
+ d02:	83 ec 0c             	sub    $0xc,%esp
+ d05:	50                   	push   %eax
+ d06:	e8 b6 f7 ff ff       	call   4c1 <sbrk>
+ d0b:	83 c4 10             	add    $0x10,%esp
+ d0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d11:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d15:	75 07                	jne    d1e <morecore+0x38>
+    return 0;
+ d17:	b8 00 00 00 00       	mov    $0x0,%eax
+ d1c:	eb 22                	jmp    d40 <morecore+0x5a>
+  hp = (Header*)p;
+ d1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d21:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d24:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d27:	8b 55 08             	mov    0x8(%ebp),%edx
+ d2a:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d2d:	83 ec 0c             	sub    $0xc,%esp
+ d30:	ff 75 f0             	push   -0x10(%ebp)
+ d33:	e8 5e fe ff ff       	call   b96 <bigfree>
+ d38:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d3b:	a1 7c 13 00 00       	mov    0x137c,%eax
+}
+ d40:	c9                   	leave
+ d41:	c3                   	ret
+
+00000d42 <bigalloc>:
+{
+ d42:	55                   	push   %ebp
+ d43:	89 e5                	mov    %esp,%ebp
+ d45:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d48:	a1 7c 13 00 00       	mov    0x137c,%eax
+ d4d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d50:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d54:	75 23                	jne    d79 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ d56:	c7 45 f0 74 13 00 00 	movl   $0x1374,-0x10(%ebp)
+ d5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d60:	a3 7c 13 00 00       	mov    %eax,0x137c
+ d65:	a1 7c 13 00 00       	mov    0x137c,%eax
+ d6a:	a3 74 13 00 00       	mov    %eax,0x1374
+    base.s.size = 0;
+ d6f:	c7 05 78 13 00 00 00 	movl   $0x0,0x1378
+ d76:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d7c:	8b 00                	mov    (%eax),%eax
+ d7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d84:	8b 40 04             	mov    0x4(%eax),%eax
+ d87:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d8a:	72 4a                	jb     dd6 <bigalloc+0x94>
+      if(p->s.size == nunits)
+ d8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d8f:	8b 40 04             	mov    0x4(%eax),%eax
+ d92:	39 45 08             	cmp    %eax,0x8(%ebp)
+ d95:	75 0c                	jne    da3 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9a:	8b 10                	mov    (%eax),%edx
+ d9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d9f:	89 10                	mov    %edx,(%eax)
+ da1:	eb 26                	jmp    dc9 <bigalloc+0x87>
+        p->s.size -= nunits;
+ da3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da6:	8b 40 04             	mov    0x4(%eax),%eax
+ da9:	2b 45 08             	sub    0x8(%ebp),%eax
+ dac:	89 c2                	mov    %eax,%edx
+ dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db7:	8b 40 04             	mov    0x4(%eax),%eax
+ dba:	c1 e0 03             	shl    $0x3,%eax
+ dbd:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ dc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+ dc6:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ dc9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dcc:	a3 7c 13 00 00       	mov    %eax,0x137c
+      return p;
+ dd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dd4:	eb 3b                	jmp    e11 <bigalloc+0xcf>
+    if(p == freep)
+ dd6:	a1 7c 13 00 00       	mov    0x137c,%eax
+ ddb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ dde:	75 1e                	jne    dfe <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ de0:	83 ec 0c             	sub    $0xc,%esp
+ de3:	ff 75 08             	push   0x8(%ebp)
+ de6:	e8 fb fe ff ff       	call   ce6 <morecore>
+ deb:	83 c4 10             	add    $0x10,%esp
+ dee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ df1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ df5:	75 07                	jne    dfe <bigalloc+0xbc>
+        return 0;
+ df7:	b8 00 00 00 00       	mov    $0x0,%eax
+ dfc:	eb 13                	jmp    e11 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e01:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e07:	8b 00                	mov    (%eax),%eax
+ e09:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e0c:	e9 70 ff ff ff       	jmp    d81 <bigalloc+0x3f>
+}
+ e11:	c9                   	leave
+ e12:	c3                   	ret
+
+00000e13 <alloc>:
+alloc(uint nbytes)
+{
+ e13:	55                   	push   %ebp
+ e14:	89 e5                	mov    %esp,%ebp
+ e16:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e19:	8b 45 08             	mov    0x8(%ebp),%eax
+ e1c:	83 c0 07             	add    $0x7,%eax
+ e1f:	c1 e8 03             	shr    $0x3,%eax
+ e22:	83 c0 01             	add    $0x1,%eax
+ e25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e28:	ff 75 f4             	push   -0xc(%ebp)
+ e2b:	e8 2e fd ff ff       	call   b5e <sizeclass>
+ e30:	83 c4 04             	add    $0x4,%esp
+ e33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e36:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e3a:	79 2c                	jns    e68 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ e3c:	83 ec 0c             	sub    $0xc,%esp
+ e3f:	ff 75 f4             	push   -0xc(%ebp)
+ e42:	e8 fb fe ff ff       	call   d42 <bigalloc>
+ e47:	83 c4 10             	add    $0x10,%esp
+ e4a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e4d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e51:	75 0a                	jne    e5d <alloc+0x4a>
+      return 0;
+ e53:	b8 00 00 00 00       	mov    $0x0,%eax
+ e58:	e9 c8 00 00 00       	jmp    f25 <alloc+0x112>
+    return (void*)(p + 1);
+ e5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e60:	83 c0 08             	add    $0x8,%eax
+ e63:	e9 bd 00 00 00       	jmp    f25 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ e68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e6b:	8b 04 85 80 13 00 00 	mov    0x1380(,%eax,4),%eax
+ e72:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e75:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e79:	74 1a                	je     e95 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ e7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e7e:	8b 10                	mov    (%eax),%edx
+ e80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e83:	89 14 85 80 13 00 00 	mov    %edx,0x1380(,%eax,4)
+    return (void*)(p + 1);
+ e8a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e8d:	83 c0 08             	add    $0x8,%eax
+ e90:	e9 90 00 00 00       	jmp    f25 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ e95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e98:	ba 02 00 00 00       	mov    $0x2,%edx
+ e9d:	89 c1                	mov    %eax,%ecx
+ e9f:	d3 e2                	shl    %cl,%edx
+ ea1:	89 d0                	mov    %edx,%eax
+ ea3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ea6:	a1 9c 13 00 00       	mov    0x139c,%eax
+ eab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ eae:	c1 e2 03             	shl    $0x3,%edx
+ eb1:	01 d0                	add    %edx,%eax
+ eb3:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+ eb9:	39 c2                	cmp    %eax,%edx
+ ebb:	73 3f                	jae    efc <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ ebd:	83 ec 0c             	sub    $0xc,%esp
+ ec0:	68 00 08 00 00       	push   $0x800
+ ec5:	e8 78 fe ff ff       	call   d42 <bigalloc>
+ eca:	83 c4 10             	add    $0x10,%esp
+ ecd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ed0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ed4:	75 07                	jne    edd <alloc+0xca>
+      return 0;
+ ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+ edb:	eb 48                	jmp    f25 <alloc+0x112>
+    bump = (char*)p;
+ edd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ee0:	a3 9c 13 00 00       	mov    %eax,0x139c
+    bumpend = (char*)(p + p->s.size);
+ ee5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ee8:	8b 40 04             	mov    0x4(%eax),%eax
+ eeb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ef2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ef5:	01 d0                	add    %edx,%eax
+ ef7:	a3 a0 13 00 00       	mov    %eax,0x13a0
+  }
+  p = (Header*)bump;
+ efc:	a1 9c 13 00 00       	mov    0x139c,%eax
+ f01:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f04:	a1 9c 13 00 00       	mov    0x139c,%eax
+ f09:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f0c:	c1 e2 03             	shl    $0x3,%edx
+ f0f:	01 d0                	add    %edx,%eax
+ f11:	a3 9c 13 00 00       	mov    %eax,0x139c
+  p->s.size = nunits;
+ f16:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f19:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f1c:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f1f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f22:	83 c0 08             	add    $0x8,%eax
+}
+ f25:	c9                   	leave
+ f26:	c3                   	ret
+
+00000f27 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f27:	55                   	push   %ebp
+ f28:	89 e5                	mov    %esp,%ebp
+ f2a:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f2d:	e8 c2 fb ff ff       	call   af4 <lock>
+ f32:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f35:	83 ec 0c             	sub    $0xc,%esp
+ f38:	ff 75 08             	push   0x8(%ebp)
+ f3b:	e8 d3 fe ff ff       	call   e13 <alloc>
+ f40:	83 c4 10             	add    $0x10,%esp
+ f43:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f46:	83 ec 0c             	sub    $0xc,%esp
+ f49:	ff 75 f4             	push   -0xc(%ebp)
+ f4c:	e8 df fb ff ff       	call   b30 <unlock>
+ f51:	83 c4 10             	add    $0x10,%esp
+  return p;
+ f54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f57:	c9                   	leave
+ f58:	c3                   	ret
@@ -0,0 +1,46 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NSLEEPER 8
+
+int
+main(int argc, char *argv[])
+{
+  int i, t0, t1, fd[2];
+  char c;
+
+  t0 = uptime();
+  if(sleep(10) < 0 || usleep(50000) < 0){
+    printf(1, "error: sleep\n");
+    exit();
+  }
+  t1 = uptime();
+  if(t1 - t0 < 15){
+    printf(1, "error: slept %d ticks, not 15\n", t1 - t0);
+    exit();
+  }
+  printf(1, "sleep ok\n");
+
+  // Sleepers with different deadlines wake in deadline order.
+  pipe(fd);
+  for(i = NSLEEPER-1; i >= 0; i--){
+    if(fork() == 0){
+      sleep(5 + 20*i);
+      c = 'a' + i;
+      write(fd[1], &c, 1);
+      exit();
+    }
+  }
+  close(fd[1]);
+  for(i = 0; i < NSLEEPER; i++){
+    if(read(fd[0], &c, 1) != 1 || c != 'a' + i){
+      printf(1, "error: sleeper %d woke out of order\n", i);
+      exit();
+    }
+  }
+  for(i = 0; i < NSLEEPER; i++)
+    wait();
+  printf(1, "order ok\n");
+  exit();
+}
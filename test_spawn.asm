@@ -0,0 +1,1944 @@
+
+_test_spawn:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *echoargv[] = { "echo", "spawned", 0 };
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 44             	sub    $0x44,%esp
+  int fd, fds[3], pid;
+  char buf[32];
+
+  // The child's stdout is the file; its stdin and stderr are ours.
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	68 02 02 00 00       	push   $0x202
+  19:	68 cd 0f 00 00       	push   $0xfcd
+  1e:	e8 ab 04 00 00       	call   4ce <open>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  29:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  2d:	79 1c                	jns    4b <main+0x4b>
+    printf(1, "error creating file: %s\n", TEST_FILE);
+  2f:	83 ec 04             	sub    $0x4,%esp
+  32:	68 cd 0f 00 00       	push   $0xfcd
+  37:	68 d9 0f 00 00       	push   $0xfd9
+  3c:	6a 01                	push   $0x1
+  3e:	e8 e3 08 00 00       	call   926 <printf>
+  43:	83 c4 10             	add    $0x10,%esp
+    exit();
+  46:	e8 4b 04 00 00       	call   496 <exit>
+  }
+  fds[0] = 0;
+  4b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fds[1] = fd;
+  52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  55:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  fds[2] = 2;
+  58:	c7 45 ec 02 00 00 00 	movl   $0x2,-0x14(%ebp)
+  if((pid = spawn("echo", echoargv, fds, 3)) < 0){
+  5f:	6a 03                	push   $0x3
+  61:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  64:	50                   	push   %eax
+  65:	68 fc 13 00 00       	push   $0x13fc
+  6a:	68 c0 0f 00 00       	push   $0xfc0
+  6f:	e8 54 05 00 00       	call   5c8 <spawn>
+  74:	83 c4 10             	add    $0x10,%esp
+  77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  7e:	79 17                	jns    97 <main+0x97>
+    printf(1, "error: spawn\n");
+  80:	83 ec 08             	sub    $0x8,%esp
+  83:	68 f2 0f 00 00       	push   $0xff2
+  88:	6a 01                	push   $0x1
+  8a:	e8 97 08 00 00       	call   926 <printf>
+  8f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  92:	e8 ff 03 00 00       	call   496 <exit>
+  }
+  if(wait() != pid){
+  97:	e8 01 04 00 00       	call   49d <wait>
+  9c:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  9f:	74 17                	je     b8 <main+0xb8>
+    printf(1, "error: wait\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 00 10 00 00       	push   $0x1000
+  a9:	6a 01                	push   $0x1
+  ab:	e8 76 08 00 00       	call   926 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+    exit();
+  b3:	e8 de 03 00 00       	call   496 <exit>
+  }
+  close(fd);
+  b8:	83 ec 0c             	sub    $0xc,%esp
+  bb:	ff 75 f4             	push   -0xc(%ebp)
+  be:	e8 f6 03 00 00       	call   4b9 <close>
+  c3:	83 c4 10             	add    $0x10,%esp
+
+  memset(buf, 0, sizeof(buf));
+  c6:	83 ec 04             	sub    $0x4,%esp
+  c9:	6a 20                	push   $0x20
+  cb:	6a 00                	push   $0x0
+  cd:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  d0:	50                   	push   %eax
+  d1:	e8 e5 01 00 00       	call   2bb <memset>
+  d6:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(TEST_FILE, O_RDONLY)) < 0 || read(fd, buf, sizeof(buf)) != 8 ||
+  d9:	83 ec 08             	sub    $0x8,%esp
+  dc:	6a 00                	push   $0x0
+  de:	68 cd 0f 00 00       	push   $0xfcd
+  e3:	e8 e6 03 00 00       	call   4ce <open>
+  e8:	83 c4 10             	add    $0x10,%esp
+  eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  ee:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  f2:	78 31                	js     125 <main+0x125>
+  f4:	83 ec 04             	sub    $0x4,%esp
+  f7:	6a 20                	push   $0x20
+  f9:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  fc:	50                   	push   %eax
+  fd:	ff 75 f4             	push   -0xc(%ebp)
+ 100:	e8 a6 03 00 00       	call   4ab <read>
+ 105:	83 c4 10             	add    $0x10,%esp
+ 108:	83 f8 08             	cmp    $0x8,%eax
+ 10b:	75 18                	jne    125 <main+0x125>
+     strcmp(buf, "spawned\n") != 0){
+ 10d:	83 ec 08             	sub    $0x8,%esp
+ 110:	68 0d 10 00 00       	push   $0x100d
+ 115:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+ 118:	50                   	push   %eax
+ 119:	e8 37 01 00 00       	call   255 <strcmp>
+ 11e:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(TEST_FILE, O_RDONLY)) < 0 || read(fd, buf, sizeof(buf)) != 8 ||
+ 121:	85 c0                	test   %eax,%eax
+ 123:	74 17                	je     13c <main+0x13c>
+    printf(1, "error: child output\n");
+ 125:	83 ec 08             	sub    $0x8,%esp
+ 128:	68 16 10 00 00       	push   $0x1016
+ 12d:	6a 01                	push   $0x1
+ 12f:	e8 f2 07 00 00       	call   926 <printf>
+ 134:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 137:	e8 5a 03 00 00       	call   496 <exit>
+  }
+  close(fd);
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	ff 75 f4             	push   -0xc(%ebp)
+ 142:	e8 72 03 00 00       	call   4b9 <close>
+ 147:	83 c4 10             	add    $0x10,%esp
+  unlink(TEST_FILE);
+ 14a:	83 ec 0c             	sub    $0xc,%esp
+ 14d:	68 cd 0f 00 00       	push   $0xfcd
+ 152:	e8 8b 03 00 00       	call   4e2 <unlink>
+ 157:	83 c4 10             	add    $0x10,%esp
+
+  if(spawn("/nonexistent", echoargv, 0, 0) != -1 || spawn("echo", echoargv, fds, 1) < 0){
+ 15a:	6a 00                	push   $0x0
+ 15c:	6a 00                	push   $0x0
+ 15e:	68 fc 13 00 00       	push   $0x13fc
+ 163:	68 2b 10 00 00       	push   $0x102b
+ 168:	e8 5b 04 00 00       	call   5c8 <spawn>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 173:	75 1c                	jne    191 <main+0x191>
+ 175:	6a 01                	push   $0x1
+ 177:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 17a:	50                   	push   %eax
+ 17b:	68 fc 13 00 00       	push   $0x13fc
+ 180:	68 c0 0f 00 00       	push   $0xfc0
+ 185:	e8 3e 04 00 00       	call   5c8 <spawn>
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	85 c0                	test   %eax,%eax
+ 18f:	79 17                	jns    1a8 <main+0x1a8>
+    printf(1, "error: spawn result\n");
+ 191:	83 ec 08             	sub    $0x8,%esp
+ 194:	68 38 10 00 00       	push   $0x1038
+ 199:	6a 01                	push   $0x1
+ 19b:	e8 86 07 00 00       	call   926 <printf>
+ 1a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1a3:	e8 ee 02 00 00       	call   496 <exit>
+  }
+  wait();
+ 1a8:	e8 f0 02 00 00       	call   49d <wait>
+  fds[0] = 100;
+ 1ad:	c7 45 e4 64 00 00 00 	movl   $0x64,-0x1c(%ebp)
+  if(spawn("echo", echoargv, fds, 1) != -1){
+ 1b4:	6a 01                	push   $0x1
+ 1b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 1b9:	50                   	push   %eax
+ 1ba:	68 fc 13 00 00       	push   $0x13fc
+ 1bf:	68 c0 0f 00 00       	push   $0xfc0
+ 1c4:	e8 ff 03 00 00       	call   5c8 <spawn>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+ 1cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1cf:	74 17                	je     1e8 <main+0x1e8>
+    printf(1, "error: bad fd accepted\n");
+ 1d1:	83 ec 08             	sub    $0x8,%esp
+ 1d4:	68 4d 10 00 00       	push   $0x104d
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 46 07 00 00       	call   926 <printf>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1e3:	e8 ae 02 00 00       	call   496 <exit>
+  }
+  printf(1, "spawn ok\n");
+ 1e8:	83 ec 08             	sub    $0x8,%esp
+ 1eb:	68 65 10 00 00       	push   $0x1065
+ 1f0:	6a 01                	push   $0x1
+ 1f2:	e8 2f 07 00 00       	call   926 <printf>
+ 1f7:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 1fa:	e8 97 02 00 00       	call   496 <exit>
+
+000001ff <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1ff:	55                   	push   %ebp
+ 200:	89 e5                	mov    %esp,%ebp
+ 202:	57                   	push   %edi
+ 203:	53                   	push   %ebx
+    if(cc < 1)
+ 204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 207:	8b 55 10             	mov    0x10(%ebp),%edx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	89 cb                	mov    %ecx,%ebx
+ 20f:	89 df                	mov    %ebx,%edi
+ 211:	89 d1                	mov    %edx,%ecx
+ 213:	fc                   	cld
+ 214:	f3 aa                	rep stos %al,%es:(%edi)
+ 216:	89 ca                	mov    %ecx,%edx
+ 218:	89 fb                	mov    %edi,%ebx
+ 21a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 21d:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 220:	90                   	nop
+ 221:	5b                   	pop    %ebx
+ 222:	5f                   	pop    %edi
+ 223:	5d                   	pop    %ebp
+ 224:	c3                   	ret
+
+00000225 <strcpy>:
+{
+ 225:	55                   	push   %ebp
+ 226:	89 e5                	mov    %esp,%ebp
+ 228:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 231:	90                   	nop
+ 232:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 235:	8d 42 01             	lea    0x1(%edx),%eax
+ 238:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 23b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 241:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 244:	0f b6 12             	movzbl (%edx),%edx
+ 247:	88 10                	mov    %dl,(%eax)
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	84 c0                	test   %al,%al
+ 24e:	75 e2                	jne    232 <strcpy+0xd>
+  return os;
+ 250:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <strcmp>:
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 258:	eb 08                	jmp    262 <strcmp+0xd>
+    p++, q++;
+ 25a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 25e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 262:	8b 45 08             	mov    0x8(%ebp),%eax
+ 265:	0f b6 00             	movzbl (%eax),%eax
+ 268:	84 c0                	test   %al,%al
+ 26a:	74 10                	je     27c <strcmp+0x27>
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	0f b6 10             	movzbl (%eax),%edx
+ 272:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 275:	0f b6 00             	movzbl (%eax),%eax
+ 278:	38 c2                	cmp    %al,%dl
+ 27a:	74 de                	je     25a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 27c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27f:	0f b6 00             	movzbl (%eax),%eax
+ 282:	0f b6 d0             	movzbl %al,%edx
+ 285:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 288:	0f b6 00             	movzbl (%eax),%eax
+ 28b:	0f b6 c0             	movzbl %al,%eax
+ 28e:	29 c2                	sub    %eax,%edx
+ 290:	89 d0                	mov    %edx,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+
+00000294 <strlen>:
+{
+ 294:	55                   	push   %ebp
+ 295:	89 e5                	mov    %esp,%ebp
+ 297:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 29a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2a1:	eb 04                	jmp    2a7 <strlen+0x13>
+ 2a3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2a7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ad:	01 d0                	add    %edx,%eax
+ 2af:	0f b6 00             	movzbl (%eax),%eax
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	75 ed                	jne    2a3 <strlen+0xf>
+  return n;
+ 2b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2b9:	c9                   	leave
+ 2ba:	c3                   	ret
+
+000002bb <memset>:
+{
+ 2bb:	55                   	push   %ebp
+ 2bc:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2be:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c1:	50                   	push   %eax
+ 2c2:	ff 75 0c             	push   0xc(%ebp)
+ 2c5:	ff 75 08             	push   0x8(%ebp)
+ 2c8:	e8 32 ff ff ff       	call   1ff <stosb>
+ 2cd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+
+000002d5 <strchr>:
+{
+ 2d5:	55                   	push   %ebp
+ 2d6:	89 e5                	mov    %esp,%ebp
+ 2d8:	83 ec 04             	sub    $0x4,%esp
+ 2db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2de:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2e1:	eb 14                	jmp    2f7 <strchr+0x22>
+    if(*s == c)
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 00             	movzbl (%eax),%eax
+ 2e9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2ec:	75 05                	jne    2f3 <strchr+0x1e>
+      return (char*)s;
+ 2ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f1:	eb 13                	jmp    306 <strchr+0x31>
+  for(; *s; s++)
+ 2f3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fa:	0f b6 00             	movzbl (%eax),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 e2                	jne    2e3 <strchr+0xe>
+  return 0;
+ 301:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 306:	c9                   	leave
+ 307:	c3                   	ret
+
+00000308 <gets>:
+{
+ 308:	55                   	push   %ebp
+ 309:	89 e5                	mov    %esp,%ebp
+ 30b:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 30e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 315:	eb 42                	jmp    359 <gets+0x51>
+    cc = read(0, &c, 1);
+ 317:	83 ec 04             	sub    $0x4,%esp
+ 31a:	6a 01                	push   $0x1
+ 31c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 31f:	50                   	push   %eax
+ 320:	6a 00                	push   $0x0
+ 322:	e8 84 01 00 00       	call   4ab <read>
+ 327:	83 c4 10             	add    $0x10,%esp
+ 32a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 32d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 331:	7e 33                	jle    366 <gets+0x5e>
+    buf[i++] = c;
+ 333:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 336:	8d 50 01             	lea    0x1(%eax),%edx
+ 339:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 33c:	89 c2                	mov    %eax,%edx
+ 33e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 341:	01 c2                	add    %eax,%edx
+ 343:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 347:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 349:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 34d:	3c 0a                	cmp    $0xa,%al
+ 34f:	74 16                	je     367 <gets+0x5f>
+ 351:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 355:	3c 0d                	cmp    $0xd,%al
+ 357:	74 0e                	je     367 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 362:	7f b3                	jg     317 <gets+0xf>
+ 364:	eb 01                	jmp    367 <gets+0x5f>
+      break;
+ 366:	90                   	nop
+  }
+  buf[i] = '\0';
+ 367:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	01 d0                	add    %edx,%eax
+ 36f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 375:	c9                   	leave
+ 376:	c3                   	ret
+
+00000377 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 377:	55                   	push   %ebp
+ 378:	89 e5                	mov    %esp,%ebp
+ 37a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 37d:	83 ec 08             	sub    $0x8,%esp
+ 380:	6a 00                	push   $0x0
+ 382:	ff 75 08             	push   0x8(%ebp)
+ 385:	e8 44 01 00 00       	call   4ce <open>
+ 38a:	83 c4 10             	add    $0x10,%esp
+ 38d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 390:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 394:	79 07                	jns    39d <stat+0x26>
+    return -1;
+ 396:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 39b:	eb 25                	jmp    3c2 <stat+0x4b>
+  r = fstat(fd, st);
+ 39d:	83 ec 08             	sub    $0x8,%esp
+ 3a0:	ff 75 0c             	push   0xc(%ebp)
+ 3a3:	ff 75 f4             	push   -0xc(%ebp)
+ 3a6:	e8 41 01 00 00       	call   4ec <fstat>
+ 3ab:	83 c4 10             	add    $0x10,%esp
+ 3ae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3b1:	83 ec 0c             	sub    $0xc,%esp
+ 3b4:	ff 75 f4             	push   -0xc(%ebp)
+ 3b7:	e8 fd 00 00 00       	call   4b9 <close>
+ 3bc:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3c2:	c9                   	leave
+ 3c3:	c3                   	ret
+
+000003c4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c4:	55                   	push   %ebp
+ 3c5:	89 e5                	mov    %esp,%ebp
+ 3c7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3d1:	eb 25                	jmp    3f8 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	c1 e0 02             	shl    $0x2,%eax
+ 3db:	01 d0                	add    %edx,%eax
+ 3dd:	01 c0                	add    %eax,%eax
+ 3df:	89 c1                	mov    %eax,%ecx
+ 3e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e4:	8d 50 01             	lea    0x1(%eax),%edx
+ 3e7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3ea:	0f b6 00             	movzbl (%eax),%eax
+ 3ed:	0f be c0             	movsbl %al,%eax
+ 3f0:	01 c8                	add    %ecx,%eax
+ 3f2:	83 e8 30             	sub    $0x30,%eax
+ 3f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fb:	0f b6 00             	movzbl (%eax),%eax
+ 3fe:	3c 2f                	cmp    $0x2f,%al
+ 400:	7e 0a                	jle    40c <atoi+0x48>
+ 402:	8b 45 08             	mov    0x8(%ebp),%eax
+ 405:	0f b6 00             	movzbl (%eax),%eax
+ 408:	3c 39                	cmp    $0x39,%al
+ 40a:	7e c7                	jle    3d3 <atoi+0xf>
+  return n;
+ 40c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 40f:	c9                   	leave
+ 410:	c3                   	ret
+
+00000411 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 411:	55                   	push   %ebp
+ 412:	89 e5                	mov    %esp,%ebp
+ 414:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 417:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 41d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 420:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 423:	eb 17                	jmp    43c <memmove+0x2b>
+    *dst++ = *src++;
+ 425:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 428:	8d 42 01             	lea    0x1(%edx),%eax
+ 42b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 42e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 431:	8d 48 01             	lea    0x1(%eax),%ecx
+ 434:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 437:	0f b6 12             	movzbl (%edx),%edx
+ 43a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 43c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 43f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 442:	89 55 10             	mov    %edx,0x10(%ebp)
+ 445:	85 c0                	test   %eax,%eax
+ 447:	7f dc                	jg     425 <memmove+0x14>
+  return vdst;
+ 449:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 44c:	c9                   	leave
+ 44d:	c3                   	ret
+
+0000044e <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 44e:	83 3d 08 14 00 00 00 	cmpl   $0x0,0x1408
+  jg 2f
+ 455:	7f 2e                	jg     485 <dosyscall+0x37>
+  jl 1f
+ 457:	7c 29                	jl     482 <dosyscall+0x34>
+  pushl %eax
+ 459:	50                   	push   %eax
+  pushl %ebx
+ 45a:	53                   	push   %ebx
+  movl $1, %eax
+ 45b:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 460:	0f a2                	cpuid
+  popl %ebx
+ 462:	5b                   	pop    %ebx
+  popl %eax
+ 463:	58                   	pop    %eax
+  movl $-1, sysmode
+ 464:	c7 05 08 14 00 00 ff 	movl   $0xffffffff,0x1408
+ 46b:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 46e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 474:	74 0c                	je     482 <dosyscall+0x34>
+  movl $1, sysmode
+ 476:	c7 05 08 14 00 00 01 	movl   $0x1,0x1408
+ 47d:	00 00 00 
+  jmp 2f
+ 480:	eb 03                	jmp    485 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 482:	cd 40                	int    $0x40
+  ret
+ 484:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 485:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 487:	ba 8e 04 00 00       	mov    $0x48e,%edx
+  sysenter
+ 48c:	0f 34                	sysenter
+3:
+  ret
+ 48e:	c3                   	ret
+
+0000048f <fork>:
+
+SYSCALL(fork)
+ 48f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 494:	eb b8                	jmp    44e <dosyscall>
+
+00000496 <exit>:
+SYSCALL(exit)
+ 496:	b8 02 00 00 00       	mov    $0x2,%eax
+ 49b:	eb b1                	jmp    44e <dosyscall>
+
+0000049d <wait>:
+SYSCALL(wait)
+ 49d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a2:	eb aa                	jmp    44e <dosyscall>
+
+000004a4 <pipe>:
+SYSCALL(pipe)
+ 4a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a9:	eb a3                	jmp    44e <dosyscall>
+
+000004ab <read>:
+SYSCALL(read)
+ 4ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b0:	eb 9c                	jmp    44e <dosyscall>
+
+000004b2 <write>:
+SYSCALL(write)
+ 4b2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b7:	eb 95                	jmp    44e <dosyscall>
+
+000004b9 <close>:
+SYSCALL(close)
+ 4b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4be:	eb 8e                	jmp    44e <dosyscall>
+
+000004c0 <kill>:
+SYSCALL(kill)
+ 4c0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c5:	eb 87                	jmp    44e <dosyscall>
+
+000004c7 <exec>:
+SYSCALL(exec)
+ 4c7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4cc:	eb 80                	jmp    44e <dosyscall>
+
+000004ce <open>:
+SYSCALL(open)
+ 4ce:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d3:	e9 76 ff ff ff       	jmp    44e <dosyscall>
+
+000004d8 <mknod>:
+SYSCALL(mknod)
+ 4d8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4dd:	e9 6c ff ff ff       	jmp    44e <dosyscall>
+
+000004e2 <unlink>:
+SYSCALL(unlink)
+ 4e2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e7:	e9 62 ff ff ff       	jmp    44e <dosyscall>
+
+000004ec <fstat>:
+SYSCALL(fstat)
+ 4ec:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f1:	e9 58 ff ff ff       	jmp    44e <dosyscall>
+
+000004f6 <link>:
+SYSCALL(link)
+ 4f6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4fb:	e9 4e ff ff ff       	jmp    44e <dosyscall>
+
+00000500 <mkdir>:
+SYSCALL(mkdir)
+ 500:	b8 14 00 00 00       	mov    $0x14,%eax
+ 505:	e9 44 ff ff ff       	jmp    44e <dosyscall>
+
+0000050a <chdir>:
+SYSCALL(chdir)
+ 50a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 50f:	e9 3a ff ff ff       	jmp    44e <dosyscall>
+
+00000514 <dup>:
+SYSCALL(dup)
+ 514:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 519:	e9 30 ff ff ff       	jmp    44e <dosyscall>
+
+0000051e <getpid>:
+SYSCALL(getpid)
+ 51e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 523:	e9 26 ff ff ff       	jmp    44e <dosyscall>
+
+00000528 <sbrk>:
+SYSCALL(sbrk)
+ 528:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 52d:	e9 1c ff ff ff       	jmp    44e <dosyscall>
+
+00000532 <sleep>:
+SYSCALL(sleep)
+ 532:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 537:	e9 12 ff ff ff       	jmp    44e <dosyscall>
+
+0000053c <uptime>:
+SYSCALL(uptime)
+ 53c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 541:	e9 08 ff ff ff       	jmp    44e <dosyscall>
+
+00000546 <symlink>:
+SYSCALL(symlink)
+ 546:	b8 16 00 00 00       	mov    $0x16,%eax
+ 54b:	e9 fe fe ff ff       	jmp    44e <dosyscall>
+
+00000550 <readlink>:
+SYSCALL(readlink)
+ 550:	b8 17 00 00 00       	mov    $0x17,%eax
+ 555:	e9 f4 fe ff ff       	jmp    44e <dosyscall>
+
+0000055a <fprot>:
+SYSCALL(fprot)
+ 55a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 55f:	e9 ea fe ff ff       	jmp    44e <dosyscall>
+
+00000564 <funprot>:
+SYSCALL(funprot)
+ 564:	b8 19 00 00 00       	mov    $0x19,%eax
+ 569:	e9 e0 fe ff ff       	jmp    44e <dosyscall>
+
+0000056e <funlock>:
+SYSCALL(funlock)
+ 56e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 573:	e9 d6 fe ff ff       	jmp    44e <dosyscall>
+
+00000578 <mmap>:
+SYSCALL(mmap)
+ 578:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 57d:	e9 cc fe ff ff       	jmp    44e <dosyscall>
+
+00000582 <munmap>:
+SYSCALL(munmap)
+ 582:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 587:	e9 c2 fe ff ff       	jmp    44e <dosyscall>
+
+0000058c <sendfile>:
+SYSCALL(sendfile)
+ 58c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 591:	e9 b8 fe ff ff       	jmp    44e <dosyscall>
+
+00000596 <readv>:
+SYSCALL(readv)
+ 596:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 59b:	e9 ae fe ff ff       	jmp    44e <dosyscall>
+
+000005a0 <writev>:
+SYSCALL(writev)
+ 5a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5a5:	e9 a4 fe ff ff       	jmp    44e <dosyscall>
+
+000005aa <pread>:
+SYSCALL(pread)
+ 5aa:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5af:	e9 9a fe ff ff       	jmp    44e <dosyscall>
+
+000005b4 <pwrite>:
+SYSCALL(pwrite)
+ 5b4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5b9:	e9 90 fe ff ff       	jmp    44e <dosyscall>
+
+000005be <lseek>:
+SYSCALL(lseek)
+ 5be:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c3:	e9 86 fe ff ff       	jmp    44e <dosyscall>
+
+000005c8 <spawn>:
+SYSCALL(spawn)
+ 5c8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5cd:	e9 7c fe ff ff       	jmp    44e <dosyscall>
+
+000005d2 <setpriority>:
+SYSCALL(setpriority)
+ 5d2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d7:	e9 72 fe ff ff       	jmp    44e <dosyscall>
+
+000005dc <kthread_create>:
+SYSCALL(kthread_create)
+ 5dc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e1:	e9 68 fe ff ff       	jmp    44e <dosyscall>
+
+000005e6 <kthread_id>:
+SYSCALL(kthread_id)
+ 5e6:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5eb:	e9 5e fe ff ff       	jmp    44e <dosyscall>
+
+000005f0 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 5f0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f5:	e9 54 fe ff ff       	jmp    44e <dosyscall>
+
+000005fa <kthread_join>:
+SYSCALL(kthread_join)
+ 5fa:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5ff:	e9 4a fe ff ff       	jmp    44e <dosyscall>
+
+00000604 <futex>:
+SYSCALL(futex)
+ 604:	b8 29 00 00 00       	mov    $0x29,%eax
+ 609:	e9 40 fe ff ff       	jmp    44e <dosyscall>
+
+0000060e <signal>:
+SYSCALL(signal)
+ 60e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 613:	e9 36 fe ff ff       	jmp    44e <dosyscall>
+
+00000618 <alarm>:
+SYSCALL(alarm)
+ 618:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 61d:	e9 2c fe ff ff       	jmp    44e <dosyscall>
+
+00000622 <usleep>:
+SYSCALL(usleep)
+ 622:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 627:	e9 22 fe ff ff       	jmp    44e <dosyscall>
+
+0000062c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 62c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 631:	e9 18 fe ff ff       	jmp    44e <dosyscall>
+
+00000636 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 636:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 63b:	e9 0e fe ff ff       	jmp    44e <dosyscall>
+
+00000640 <getrusage>:
+SYSCALL(getrusage)
+ 640:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 645:	e9 04 fe ff ff       	jmp    44e <dosyscall>
+
+0000064a <mount>:
+SYSCALL(mount)
+ 64a:	b8 30 00 00 00       	mov    $0x30,%eax
+ 64f:	e9 fa fd ff ff       	jmp    44e <dosyscall>
+
+00000654 <getdents>:
+SYSCALL(getdents)
+ 654:	b8 31 00 00 00       	mov    $0x31,%eax
+ 659:	e9 f0 fd ff ff       	jmp    44e <dosyscall>
+
+0000065e <yield>:
+SYSCALL(yield)
+ 65e:	b8 32 00 00 00       	mov    $0x32,%eax
+ 663:	e9 e6 fd ff ff       	jmp    44e <dosyscall>
+
+00000668 <ncpu>:
+SYSCALL(ncpu)
+ 668:	b8 33 00 00 00       	mov    $0x33,%eax
+ 66d:	e9 dc fd ff ff       	jmp    44e <dosyscall>
+
+00000672 <fallocate>:
+SYSCALL(fallocate)
+ 672:	b8 34 00 00 00       	mov    $0x34,%eax
+ 677:	e9 d2 fd ff ff       	jmp    44e <dosyscall>
+
+0000067c <ftruncate>:
+SYSCALL(ftruncate)
+ 67c:	b8 35 00 00 00       	mov    $0x35,%eax
+ 681:	e9 c8 fd ff ff       	jmp    44e <dosyscall>
+
+00000686 <fsync>:
+SYSCALL(fsync)
+ 686:	b8 36 00 00 00       	mov    $0x36,%eax
+ 68b:	e9 be fd ff ff       	jmp    44e <dosyscall>
+
+00000690 <fdatasync>:
+SYSCALL(fdatasync)
+ 690:	b8 37 00 00 00       	mov    $0x37,%eax
+ 695:	e9 b4 fd ff ff       	jmp    44e <dosyscall>
+
+0000069a <poll>:
+SYSCALL(poll)
+ 69a:	b8 38 00 00 00       	mov    $0x38,%eax
+ 69f:	e9 aa fd ff ff       	jmp    44e <dosyscall>
+
+000006a4 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 6a4:	55                   	push   %ebp
+ 6a5:	89 e5                	mov    %esp,%ebp
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 6aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ad:	8b 40 04             	mov    0x4(%eax),%eax
+ 6b0:	85 c0                	test   %eax,%eax
+ 6b2:	7e 1f                	jle    6d3 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 6b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b7:	8b 50 04             	mov    0x4(%eax),%edx
+ 6ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bd:	8d 48 08             	lea    0x8(%eax),%ecx
+ 6c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c3:	8b 00                	mov    (%eax),%eax
+ 6c5:	83 ec 04             	sub    $0x4,%esp
+ 6c8:	52                   	push   %edx
+ 6c9:	51                   	push   %ecx
+ 6ca:	50                   	push   %eax
+ 6cb:	e8 d0 fe ff ff       	call   5a0 <writev>
+ 6d0:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 6dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e0:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 6e7:	00 00 00 
+}
+ 6ea:	90                   	nop
+ 6eb:	c9                   	leave
+ 6ec:	c3                   	ret
+
+000006ed <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 6ed:	55                   	push   %ebp
+ 6ee:	89 e5                	mov    %esp,%ebp
+ 6f0:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 6f3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 6f7:	0f 84 94 00 00 00    	je     791 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 6fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 700:	8b 40 04             	mov    0x4(%eax),%eax
+ 703:	85 c0                	test   %eax,%eax
+ 705:	7e 40                	jle    747 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 707:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70a:	8b 40 04             	mov    0x4(%eax),%eax
+ 70d:	83 e8 01             	sub    $0x1,%eax
+ 710:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 717:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71a:	01 d0                	add    %edx,%eax
+ 71c:	83 c0 08             	add    $0x8,%eax
+ 71f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 725:	8b 10                	mov    (%eax),%edx
+ 727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72a:	8b 40 04             	mov    0x4(%eax),%eax
+ 72d:	01 d0                	add    %edx,%eax
+ 72f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 732:	75 13                	jne    747 <put+0x5a>
+      v->iov_len += n;
+ 734:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 737:	8b 50 04             	mov    0x4(%eax),%edx
+ 73a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 73d:	01 c2                	add    %eax,%edx
+ 73f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 742:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 745:	eb 4b                	jmp    792 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 747:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74a:	8b 40 04             	mov    0x4(%eax),%eax
+ 74d:	83 f8 10             	cmp    $0x10,%eax
+ 750:	75 0e                	jne    760 <put+0x73>
+    flush(o);
+ 752:	83 ec 0c             	sub    $0xc,%esp
+ 755:	ff 75 08             	push   0x8(%ebp)
+ 758:	e8 47 ff ff ff       	call   6a4 <flush>
+ 75d:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 760:	8b 45 08             	mov    0x8(%ebp),%eax
+ 763:	8b 50 04             	mov    0x4(%eax),%edx
+ 766:	8b 45 08             	mov    0x8(%ebp),%eax
+ 769:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 76c:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 770:	8b 45 08             	mov    0x8(%ebp),%eax
+ 773:	8b 50 04             	mov    0x4(%eax),%edx
+ 776:	8b 45 08             	mov    0x8(%ebp),%eax
+ 779:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 77c:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 780:	8b 45 08             	mov    0x8(%ebp),%eax
+ 783:	8b 40 04             	mov    0x4(%eax),%eax
+ 786:	8d 50 01             	lea    0x1(%eax),%edx
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+ 78c:	89 50 04             	mov    %edx,0x4(%eax)
+ 78f:	eb 01                	jmp    792 <put+0xa5>
+    return;
+ 791:	90                   	nop
+}
+ 792:	c9                   	leave
+ 793:	c3                   	ret
+
+00000794 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 794:	55                   	push   %ebp
+ 795:	89 e5                	mov    %esp,%ebp
+ 797:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 79a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79d:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 7a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7a6:	01 d0                	add    %edx,%eax
+ 7a8:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 7ad:	77 0b                	ja     7ba <room+0x26>
+ 7af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b2:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b5:	83 f8 10             	cmp    $0x10,%eax
+ 7b8:	75 0e                	jne    7c8 <room+0x34>
+    flush(o);
+ 7ba:	83 ec 0c             	sub    $0xc,%esp
+ 7bd:	ff 75 08             	push   0x8(%ebp)
+ 7c0:	e8 df fe ff ff       	call   6a4 <flush>
+ 7c5:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 7c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cb:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 7d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7da:	01 d0                	add    %edx,%eax
+}
+ 7dc:	c9                   	leave
+ 7dd:	c3                   	ret
+
+000007de <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 7de:	55                   	push   %ebp
+ 7df:	89 e5                	mov    %esp,%ebp
+ 7e1:	83 ec 28             	sub    $0x28,%esp
+ 7e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7e7:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 7ea:	83 ec 08             	sub    $0x8,%esp
+ 7ed:	6a 01                	push   $0x1
+ 7ef:	ff 75 08             	push   0x8(%ebp)
+ 7f2:	e8 9d ff ff ff       	call   794 <room>
+ 7f7:	83 c4 10             	add    $0x10,%esp
+ 7fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 7fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 800:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 804:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 806:	8b 45 08             	mov    0x8(%ebp),%eax
+ 809:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 80f:	8d 50 01             	lea    0x1(%eax),%edx
+ 812:	8b 45 08             	mov    0x8(%ebp),%eax
+ 815:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	6a 01                	push   $0x1
+ 820:	ff 75 f4             	push   -0xc(%ebp)
+ 823:	ff 75 08             	push   0x8(%ebp)
+ 826:	e8 c2 fe ff ff       	call   6ed <put>
+ 82b:	83 c4 10             	add    $0x10,%esp
+}
+ 82e:	90                   	nop
+ 82f:	c9                   	leave
+ 830:	c3                   	ret
+
+00000831 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 831:	55                   	push   %ebp
+ 832:	89 e5                	mov    %esp,%ebp
+ 834:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 837:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 83e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 842:	74 17                	je     85b <printint+0x2a>
+ 844:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 848:	79 11                	jns    85b <printint+0x2a>
+    neg = 1;
+ 84a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 851:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 854:	f7 d8                	neg    %eax
+ 856:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 859:	eb 06                	jmp    861 <printint+0x30>
+  } else {
+    x = xx;
+ 85b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 85e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 861:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 868:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 86b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 86e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 873:	f7 f1                	div    %ecx
+ 875:	89 d1                	mov    %edx,%ecx
+ 877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87a:	8d 50 01             	lea    0x1(%eax),%edx
+ 87d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 880:	0f b6 91 0c 14 00 00 	movzbl 0x140c(%ecx),%edx
+ 887:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 88b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 88e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 891:	ba 00 00 00 00       	mov    $0x0,%edx
+ 896:	f7 f1                	div    %ecx
+ 898:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 89b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 89f:	75 c7                	jne    868 <printint+0x37>
+  if(neg)
+ 8a1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8a5:	74 0e                	je     8b5 <printint+0x84>
+    buf[i++] = '-';
+ 8a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8aa:	8d 50 01             	lea    0x1(%eax),%edx
+ 8ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8b0:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 8b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 8bb:	83 ec 08             	sub    $0x8,%esp
+ 8be:	ff 75 e8             	push   -0x18(%ebp)
+ 8c1:	ff 75 08             	push   0x8(%ebp)
+ 8c4:	e8 cb fe ff ff       	call   794 <room>
+ 8c9:	83 c4 10             	add    $0x10,%esp
+ 8cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 8cf:	eb 1d                	jmp    8ee <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 8d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8d4:	83 e8 01             	sub    $0x1,%eax
+ 8d7:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 8da:	89 c2                	mov    %eax,%edx
+ 8dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8df:	01 c2                	add    %eax,%edx
+ 8e1:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 8e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e7:	01 c8                	add    %ecx,%eax
+ 8e9:	0f b6 00             	movzbl (%eax),%eax
+ 8ec:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 8ee:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8f6:	79 d9                	jns    8d1 <printint+0xa0>
+  o->used += n;
+ 8f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8fb:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 901:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 904:	01 c2                	add    %eax,%edx
+ 906:	8b 45 08             	mov    0x8(%ebp),%eax
+ 909:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 90f:	83 ec 04             	sub    $0x4,%esp
+ 912:	ff 75 e8             	push   -0x18(%ebp)
+ 915:	ff 75 e4             	push   -0x1c(%ebp)
+ 918:	ff 75 08             	push   0x8(%ebp)
+ 91b:	e8 cd fd ff ff       	call   6ed <put>
+ 920:	83 c4 10             	add    $0x10,%esp
+}
+ 923:	90                   	nop
+ 924:	c9                   	leave
+ 925:	c3                   	ret
+
+00000926 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 926:	55                   	push   %ebp
+ 927:	89 e5                	mov    %esp,%ebp
+ 929:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 92f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 932:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 938:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 93f:	00 00 00 
+  o.used = 0;
+ 942:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 949:	00 00 00 
+  state = 0;
+ 94c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 953:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 956:	83 c0 04             	add    $0x4,%eax
+ 959:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 95c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 963:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 96a:	e9 82 01 00 00       	jmp    af1 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 96f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 972:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 975:	01 d0                	add    %edx,%eax
+ 977:	0f b6 00             	movzbl (%eax),%eax
+ 97a:	0f be c0             	movsbl %al,%eax
+ 97d:	25 ff 00 00 00       	and    $0xff,%eax
+ 982:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 985:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 989:	75 38                	jne    9c3 <printf+0x9d>
+      if(c == '%'){
+ 98b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 98f:	0f 85 58 01 00 00    	jne    aed <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 995:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 998:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 99b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 99e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9a1:	01 ca                	add    %ecx,%edx
+ 9a3:	83 ec 04             	sub    $0x4,%esp
+ 9a6:	50                   	push   %eax
+ 9a7:	52                   	push   %edx
+ 9a8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9ae:	50                   	push   %eax
+ 9af:	e8 39 fd ff ff       	call   6ed <put>
+ 9b4:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 9b7:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 9be:	e9 2a 01 00 00       	jmp    aed <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 9c3:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 9c7:	0f 85 20 01 00 00    	jne    aed <printf+0x1c7>
+      if(c == 'd'){
+ 9cd:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 9d1:	75 22                	jne    9f5 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 9d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9d6:	8b 00                	mov    (%eax),%eax
+ 9d8:	6a 01                	push   $0x1
+ 9da:	6a 0a                	push   $0xa
+ 9dc:	50                   	push   %eax
+ 9dd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9e3:	50                   	push   %eax
+ 9e4:	e8 48 fe ff ff       	call   831 <printint>
+ 9e9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9ec:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9f0:	e9 e8 00 00 00       	jmp    add <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 9f5:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 9f9:	74 06                	je     a01 <printf+0xdb>
+ 9fb:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 9ff:	75 22                	jne    a23 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ a01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a04:	8b 00                	mov    (%eax),%eax
+ a06:	6a 00                	push   $0x0
+ a08:	6a 10                	push   $0x10
+ a0a:	50                   	push   %eax
+ a0b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a11:	50                   	push   %eax
+ a12:	e8 1a fe ff ff       	call   831 <printint>
+ a17:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a1a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a1e:	e9 ba 00 00 00       	jmp    add <printf+0x1b7>
+      } else if(c == 's'){
+ a23:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ a27:	75 3f                	jne    a68 <printf+0x142>
+        s = (char*)*ap;
+ a29:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a2c:	8b 00                	mov    (%eax),%eax
+ a2e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a31:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ a35:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a39:	75 07                	jne    a42 <printf+0x11c>
+          s = "(null)";
+ a3b:	c7 45 f4 6f 10 00 00 	movl   $0x106f,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a42:	83 ec 0c             	sub    $0xc,%esp
+ a45:	ff 75 f4             	push   -0xc(%ebp)
+ a48:	e8 47 f8 ff ff       	call   294 <strlen>
+ a4d:	83 c4 10             	add    $0x10,%esp
+ a50:	83 ec 04             	sub    $0x4,%esp
+ a53:	50                   	push   %eax
+ a54:	ff 75 f4             	push   -0xc(%ebp)
+ a57:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 8a fc ff ff       	call   6ed <put>
+ a63:	83 c4 10             	add    $0x10,%esp
+ a66:	eb 75                	jmp    add <printf+0x1b7>
+      } else if(c == 'c'){
+ a68:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a6c:	75 21                	jne    a8f <printf+0x169>
+        putc(&o, *ap);
+ a6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a71:	8b 00                	mov    (%eax),%eax
+ a73:	0f be c0             	movsbl %al,%eax
+ a76:	83 ec 08             	sub    $0x8,%esp
+ a79:	50                   	push   %eax
+ a7a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a80:	50                   	push   %eax
+ a81:	e8 58 fd ff ff       	call   7de <putc>
+ a86:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a89:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a8d:	eb 4e                	jmp    add <printf+0x1b7>
+      } else if(c == '%'){
+ a8f:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a93:	75 1b                	jne    ab0 <printf+0x18a>
+        putc(&o, c);
+ a95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a98:	0f be c0             	movsbl %al,%eax
+ a9b:	83 ec 08             	sub    $0x8,%esp
+ a9e:	50                   	push   %eax
+ a9f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ aa5:	50                   	push   %eax
+ aa6:	e8 33 fd ff ff       	call   7de <putc>
+ aab:	83 c4 10             	add    $0x10,%esp
+ aae:	eb 2d                	jmp    add <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ ab0:	83 ec 08             	sub    $0x8,%esp
+ ab3:	6a 25                	push   $0x25
+ ab5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ abb:	50                   	push   %eax
+ abc:	e8 1d fd ff ff       	call   7de <putc>
+ ac1:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ ac4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ac7:	0f be c0             	movsbl %al,%eax
+ aca:	83 ec 08             	sub    $0x8,%esp
+ acd:	50                   	push   %eax
+ ace:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ad4:	50                   	push   %eax
+ ad5:	e8 04 fd ff ff       	call   7de <putc>
+ ada:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ add:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ ae4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae7:	83 c0 01             	add    $0x1,%eax
+ aea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ aed:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ af1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ af4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af7:	01 d0                	add    %edx,%eax
+ af9:	0f b6 00             	movzbl (%eax),%eax
+ afc:	84 c0                	test   %al,%al
+ afe:	0f 85 6b fe ff ff    	jne    96f <printf+0x49>
+    }
+  }
+  if(state == 0)
+ b04:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ b08:	75 22                	jne    b2c <printf+0x206>
+    put(&o, fmt + start, i - start);
+ b0a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b0d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b13:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b16:	01 ca                	add    %ecx,%edx
+ b18:	83 ec 04             	sub    $0x4,%esp
+ b1b:	50                   	push   %eax
+ b1c:	52                   	push   %edx
+ b1d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b23:	50                   	push   %eax
+ b24:	e8 c4 fb ff ff       	call   6ed <put>
+ b29:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ b2c:	83 ec 0c             	sub    $0xc,%esp
+ b2f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ b35:	50                   	push   %eax
+ b36:	e8 69 fb ff ff       	call   6a4 <flush>
+ b3b:	83 c4 10             	add    $0x10,%esp
+}
+ b3e:	90                   	nop
+ b3f:	c9                   	leave
+ b40:	c3                   	ret
+
+00000b41 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ b41:	55                   	push   %ebp
+ b42:	89 e5                	mov    %esp,%ebp
+ b44:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b47:	8b 55 08             	mov    0x8(%ebp),%edx
+ b4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b50:	f0 87 02             	lock xchg %eax,(%edx)
+ b53:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b59:	c9                   	leave
+ b5a:	c3                   	ret
+
+00000b5b <lock>:
+{
+ b5b:	55                   	push   %ebp
+ b5c:	89 e5                	mov    %esp,%ebp
+ b5e:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b61:	a1 20 14 00 00       	mov    0x1420,%eax
+ b66:	85 c0                	test   %eax,%eax
+ b68:	74 09                	je     b73 <lock+0x18>
+ b6a:	a1 20 14 00 00       	mov    0x1420,%eax
+ b6f:	ff d0                	call   *%eax
+ b71:	eb 05                	jmp    b78 <lock+0x1d>
+ b73:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b78:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b7b:	90                   	nop
+ b7c:	83 ec 08             	sub    $0x8,%esp
+ b7f:	6a 01                	push   $0x1
+ b81:	68 58 14 00 00       	push   $0x1458
+ b86:	e8 b6 ff ff ff       	call   b41 <xchg>
+ b8b:	83 c4 10             	add    $0x10,%esp
+ b8e:	85 c0                	test   %eax,%eax
+ b90:	75 ea                	jne    b7c <lock+0x21>
+  return pin;
+ b92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b95:	c9                   	leave
+ b96:	c3                   	ret
+
+00000b97 <unlock>:
+{
+ b97:	55                   	push   %ebp
+ b98:	89 e5                	mov    %esp,%ebp
+ b9a:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b9d:	6a 00                	push   $0x0
+ b9f:	68 58 14 00 00       	push   $0x1458
+ ba4:	e8 98 ff ff ff       	call   b41 <xchg>
+ ba9:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ bac:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bb0:	78 10                	js     bc2 <unlock+0x2b>
+    mallocunpin(pin);
+ bb2:	a1 24 14 00 00       	mov    0x1424,%eax
+ bb7:	83 ec 0c             	sub    $0xc,%esp
+ bba:	ff 75 08             	push   0x8(%ebp)
+ bbd:	ff d0                	call   *%eax
+ bbf:	83 c4 10             	add    $0x10,%esp
+}
+ bc2:	90                   	nop
+ bc3:	c9                   	leave
+ bc4:	c3                   	ret
+
+00000bc5 <sizeclass>:
+{
+ bc5:	55                   	push   %ebp
+ bc6:	89 e5                	mov    %esp,%ebp
+ bc8:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ bcb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ bd2:	eb 1c                	jmp    bf0 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ bd4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd7:	ba 02 00 00 00       	mov    $0x2,%edx
+ bdc:	89 c1                	mov    %eax,%ecx
+ bde:	d3 e2                	shl    %cl,%edx
+ be0:	89 d0                	mov    %edx,%eax
+ be2:	3b 45 08             	cmp    0x8(%ebp),%eax
+ be5:	72 05                	jb     bec <sizeclass+0x27>
+      return c;
+ be7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bea:	eb 0f                	jmp    bfb <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ bec:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ bf0:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ bf4:	7e de                	jle    bd4 <sizeclass+0xf>
+  return -1;
+ bf6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ bfb:	c9                   	leave
+ bfc:	c3                   	ret
+
+00000bfd <bigfree>:
+{
+ bfd:	55                   	push   %ebp
+ bfe:	89 e5                	mov    %esp,%ebp
+ c00:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c03:	a1 30 14 00 00       	mov    0x1430,%eax
+ c08:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c0b:	eb 24                	jmp    c31 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c10:	8b 00                	mov    (%eax),%eax
+ c12:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c15:	72 12                	jb     c29 <bigfree+0x2c>
+ c17:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c1d:	72 24                	jb     c43 <bigfree+0x46>
+ c1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c22:	8b 00                	mov    (%eax),%eax
+ c24:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c27:	72 1a                	jb     c43 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2c:	8b 00                	mov    (%eax),%eax
+ c2e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c31:	8b 45 08             	mov    0x8(%ebp),%eax
+ c34:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c37:	73 d4                	jae    c0d <bigfree+0x10>
+ c39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3c:	8b 00                	mov    (%eax),%eax
+ c3e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c41:	73 ca                	jae    c0d <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c43:	8b 45 08             	mov    0x8(%ebp),%eax
+ c46:	8b 40 04             	mov    0x4(%eax),%eax
+ c49:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c50:	8b 45 08             	mov    0x8(%ebp),%eax
+ c53:	01 c2                	add    %eax,%edx
+ c55:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c58:	8b 00                	mov    (%eax),%eax
+ c5a:	39 c2                	cmp    %eax,%edx
+ c5c:	75 24                	jne    c82 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c61:	8b 50 04             	mov    0x4(%eax),%edx
+ c64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c67:	8b 00                	mov    (%eax),%eax
+ c69:	8b 40 04             	mov    0x4(%eax),%eax
+ c6c:	01 c2                	add    %eax,%edx
+ c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c71:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c77:	8b 00                	mov    (%eax),%eax
+ c79:	8b 10                	mov    (%eax),%edx
+ c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7e:	89 10                	mov    %edx,(%eax)
+ c80:	eb 0a                	jmp    c8c <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c85:	8b 10                	mov    (%eax),%edx
+ c87:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c8f:	8b 40 04             	mov    0x4(%eax),%eax
+ c92:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c9c:	01 d0                	add    %edx,%eax
+ c9e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ca1:	75 20                	jne    cc3 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ ca3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca6:	8b 50 04             	mov    0x4(%eax),%edx
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cac:	8b 40 04             	mov    0x4(%eax),%eax
+ caf:	01 c2                	add    %eax,%edx
+ cb1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ cb7:	8b 45 08             	mov    0x8(%ebp),%eax
+ cba:	8b 10                	mov    (%eax),%edx
+ cbc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cbf:	89 10                	mov    %edx,(%eax)
+ cc1:	eb 08                	jmp    ccb <bigfree+0xce>
+    p->s.ptr = bp;
+ cc3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc6:	8b 55 08             	mov    0x8(%ebp),%edx
+ cc9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ccb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cce:	a3 30 14 00 00       	mov    %eax,0x1430
+}
+ cd3:	90                   	nop
+ cd4:	c9                   	leave
+ cd5:	c3                   	ret
+
+00000cd6 <free>:
+{
+ cd6:	55                   	push   %ebp
+ cd7:	89 e5                	mov    %esp,%ebp
+ cd9:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ cdc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ce0:	74 68                	je     d4a <free+0x74>
+  bp = (Header*)ap - 1;
+ ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce5:	83 e8 08             	sub    $0x8,%eax
+ ce8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ ceb:	e8 6b fe ff ff       	call   b5b <lock>
+ cf0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ cf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf6:	8b 40 04             	mov    0x4(%eax),%eax
+ cf9:	83 ec 0c             	sub    $0xc,%esp
+ cfc:	50                   	push   %eax
+ cfd:	e8 c3 fe ff ff       	call   bc5 <sizeclass>
+ d02:	83 c4 10             	add    $0x10,%esp
+ d05:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d08:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d0c:	78 1e                	js     d2c <free+0x56>
+    bp->s.ptr = classfree[c];
+ d0e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d11:	8b 14 85 34 14 00 00 	mov    0x1434(,%eax,4),%edx
+ d18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1b:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ d1d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d20:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d23:	89 14 85 34 14 00 00 	mov    %edx,0x1434(,%eax,4)
+ d2a:	eb 0e                	jmp    d3a <free+0x64>
+    bigfree(bp);
+ d2c:	83 ec 0c             	sub    $0xc,%esp
+ d2f:	ff 75 f4             	push   -0xc(%ebp)
+ d32:	e8 c6 fe ff ff       	call   bfd <bigfree>
+ d37:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ d3a:	83 ec 0c             	sub    $0xc,%esp
+ d3d:	ff 75 f0             	push   -0x10(%ebp)
+ d40:	e8 52 fe ff ff       	call   b97 <unlock>
+ d45:	83 c4 10             	add    $0x10,%esp
+ d48:	eb 01                	jmp    d4b <free+0x75>
+    return;
+ d4a:	90                   	nop
+}
+ d4b:	c9                   	leave
+ d4c:	c3                   	ret
+
+00000d4d <morecore>:
+{
+ d4d:	55                   	push   %ebp
+ d4e:	89 e5                	mov    %esp,%ebp
+ d50:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d53:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d5a:	77 07                	ja     d63 <morecore+0x16>
+    nu = 4096;
+ d5c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d63:	8b 45 08             	mov    0x8(%ebp),%eax
+ d66:	c1 e0 03             	shl    $0x3,%eax
+ d69:	83 ec 0c             	sub    $0xc,%esp
+ d6c:	50                   	push   %eax
+ d6d:	e8 b6 f7 ff ff       	call   528 <sbrk>
+ d72:	83 c4 10             	add    $0x10,%esp
+ d75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d78:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d7c:	75 07                	jne    d85 <morecore+0x38>
+    return 0;
+ d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+ d83:	eb 22                	jmp    da7 <morecore+0x5a>
+  hp = (Header*)p;
+ d85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d88:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d8b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+ d91:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d94:	83 ec 0c             	sub    $0xc,%esp
+ d97:	ff 75 f0             	push   -0x10(%ebp)
+ d9a:	e8 5e fe ff ff       	call   bfd <bigfree>
+ d9f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ da2:	a1 30 14 00 00       	mov    0x1430,%eax
+}
+ da7:	c9                   	leave
+ da8:	c3                   	ret
+
+00000da9 <bigalloc>:
+{
+ da9:	55                   	push   %ebp
+ daa:	89 e5                	mov    %esp,%ebp
+ dac:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ daf:	a1 30 14 00 00       	mov    0x1430,%eax
+ db4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ db7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ dbb:	75 23                	jne    de0 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ dbd:	c7 45 f0 28 14 00 00 	movl   $0x1428,-0x10(%ebp)
+ dc4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dc7:	a3 30 14 00 00       	mov    %eax,0x1430
+ dcc:	a1 30 14 00 00       	mov    0x1430,%eax
+ dd1:	a3 28 14 00 00       	mov    %eax,0x1428
+    base.s.size = 0;
+ dd6:	c7 05 2c 14 00 00 00 	movl   $0x0,0x142c
+ ddd:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ de0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ de3:	8b 00                	mov    (%eax),%eax
+ de5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ de8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ deb:	8b 40 04             	mov    0x4(%eax),%eax
+ dee:	3b 45 08             	cmp    0x8(%ebp),%eax
+ df1:	72 4a                	jb     e3d <bigalloc+0x94>
+      if(p->s.size == nunits)
+ df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df6:	8b 40 04             	mov    0x4(%eax),%eax
+ df9:	39 45 08             	cmp    %eax,0x8(%ebp)
+ dfc:	75 0c                	jne    e0a <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e01:	8b 10                	mov    (%eax),%edx
+ e03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e06:	89 10                	mov    %edx,(%eax)
+ e08:	eb 26                	jmp    e30 <bigalloc+0x87>
+        p->s.size -= nunits;
+ e0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e0d:	8b 40 04             	mov    0x4(%eax),%eax
+ e10:	2b 45 08             	sub    0x8(%ebp),%eax
+ e13:	89 c2                	mov    %eax,%edx
+ e15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e18:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1e:	8b 40 04             	mov    0x4(%eax),%eax
+ e21:	c1 e0 03             	shl    $0x3,%eax
+ e24:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+ e2d:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ e30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e33:	a3 30 14 00 00       	mov    %eax,0x1430
+      return p;
+ e38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3b:	eb 3b                	jmp    e78 <bigalloc+0xcf>
+    if(p == freep)
+ e3d:	a1 30 14 00 00       	mov    0x1430,%eax
+ e42:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e45:	75 1e                	jne    e65 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e47:	83 ec 0c             	sub    $0xc,%esp
+ e4a:	ff 75 08             	push   0x8(%ebp)
+ e4d:	e8 fb fe ff ff       	call   d4d <morecore>
+ e52:	83 c4 10             	add    $0x10,%esp
+ e55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e58:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e5c:	75 07                	jne    e65 <bigalloc+0xbc>
+        return 0;
+ e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+ e63:	eb 13                	jmp    e78 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e6e:	8b 00                	mov    (%eax),%eax
+ e70:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e73:	e9 70 ff ff ff       	jmp    de8 <bigalloc+0x3f>
+}
+ e78:	c9                   	leave
+ e79:	c3                   	ret
+
+00000e7a <alloc>:
+alloc(uint nbytes)
+{
+ e7a:	55                   	push   %ebp
+ e7b:	89 e5                	mov    %esp,%ebp
+ e7d:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e80:	8b 45 08             	mov    0x8(%ebp),%eax
+ e83:	83 c0 07             	add    $0x7,%eax
+ e86:	c1 e8 03             	shr    $0x3,%eax
+ e89:	83 c0 01             	add    $0x1,%eax
+ e8c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e8f:	ff 75 f4             	push   -0xc(%ebp)
+ e92:	e8 2e fd ff ff       	call   bc5 <sizeclass>
+ e97:	83 c4 04             	add    $0x4,%esp
+ e9a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e9d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ea1:	79 2c                	jns    ecf <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ ea3:	83 ec 0c             	sub    $0xc,%esp
+ ea6:	ff 75 f4             	push   -0xc(%ebp)
+ ea9:	e8 fb fe ff ff       	call   da9 <bigalloc>
+ eae:	83 c4 10             	add    $0x10,%esp
+ eb1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ eb4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ eb8:	75 0a                	jne    ec4 <alloc+0x4a>
+      return 0;
+ eba:	b8 00 00 00 00       	mov    $0x0,%eax
+ ebf:	e9 c8 00 00 00       	jmp    f8c <alloc+0x112>
+    return (void*)(p + 1);
+ ec4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ec7:	83 c0 08             	add    $0x8,%eax
+ eca:	e9 bd 00 00 00       	jmp    f8c <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ ecf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ed2:	8b 04 85 34 14 00 00 	mov    0x1434(,%eax,4),%eax
+ ed9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ edc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ee0:	74 1a                	je     efc <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ ee2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ee5:	8b 10                	mov    (%eax),%edx
+ ee7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eea:	89 14 85 34 14 00 00 	mov    %edx,0x1434(,%eax,4)
+    return (void*)(p + 1);
+ ef1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ef4:	83 c0 08             	add    $0x8,%eax
+ ef7:	e9 90 00 00 00       	jmp    f8c <alloc+0x112>
+  }
+  nunits = 2 << c;
+ efc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eff:	ba 02 00 00 00       	mov    $0x2,%edx
+ f04:	89 c1                	mov    %eax,%ecx
+ f06:	d3 e2                	shl    %cl,%edx
+ f08:	89 d0                	mov    %edx,%eax
+ f0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ f0d:	a1 50 14 00 00       	mov    0x1450,%eax
+ f12:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f15:	c1 e2 03             	shl    $0x3,%edx
+ f18:	01 d0                	add    %edx,%eax
+ f1a:	8b 15 54 14 00 00    	mov    0x1454,%edx
+ f20:	39 c2                	cmp    %eax,%edx
+ f22:	73 3f                	jae    f63 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ f24:	83 ec 0c             	sub    $0xc,%esp
+ f27:	68 00 08 00 00       	push   $0x800
+ f2c:	e8 78 fe ff ff       	call   da9 <bigalloc>
+ f31:	83 c4 10             	add    $0x10,%esp
+ f34:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ f37:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ f3b:	75 07                	jne    f44 <alloc+0xca>
+      return 0;
+ f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+ f42:	eb 48                	jmp    f8c <alloc+0x112>
+    bump = (char*)p;
+ f44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f47:	a3 50 14 00 00       	mov    %eax,0x1450
+    bumpend = (char*)(p + p->s.size);
+ f4c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f4f:	8b 40 04             	mov    0x4(%eax),%eax
+ f52:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f59:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f5c:	01 d0                	add    %edx,%eax
+ f5e:	a3 54 14 00 00       	mov    %eax,0x1454
+  }
+  p = (Header*)bump;
+ f63:	a1 50 14 00 00       	mov    0x1450,%eax
+ f68:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f6b:	a1 50 14 00 00       	mov    0x1450,%eax
+ f70:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f73:	c1 e2 03             	shl    $0x3,%edx
+ f76:	01 d0                	add    %edx,%eax
+ f78:	a3 50 14 00 00       	mov    %eax,0x1450
+  p->s.size = nunits;
+ f7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f80:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f83:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f86:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f89:	83 c0 08             	add    $0x8,%eax
+}
+ f8c:	c9                   	leave
+ f8d:	c3                   	ret
+
+00000f8e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f8e:	55                   	push   %ebp
+ f8f:	89 e5                	mov    %esp,%ebp
+ f91:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f94:	e8 c2 fb ff ff       	call   b5b <lock>
+ f99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f9c:	83 ec 0c             	sub    $0xc,%esp
+ f9f:	ff 75 08             	push   0x8(%ebp)
+ fa2:	e8 d3 fe ff ff       	call   e7a <alloc>
+ fa7:	83 c4 10             	add    $0x10,%esp
+ faa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ fad:	83 ec 0c             	sub    $0xc,%esp
+ fb0:	ff 75 f4             	push   -0xc(%ebp)
+ fb3:	e8 df fb ff ff       	call   b97 <unlock>
+ fb8:	83 c4 10             	add    $0x10,%esp
+  return p;
+ fbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fbe:	c9                   	leave
+ fbf:	c3                   	ret
@@ -0,0 +1,55 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define TEST_FILE "/spawn_file"
+
+char *echoargv[] = { "echo", "spawned", 0 };
+
+int
+main(int argc, char *argv[])
+{
+  int fd, fds[3], pid;
+  char buf[32];
+
+  // The child's stdout is the file; its stdin and stderr are ours.
+  if((fd = open(TEST_FILE, O_CREATE | O_RDWR)) < 0){
+    printf(1, "error creating file: %s\n", TEST_FILE);
+    exit();
+  }
+  fds[0] = 0;
+  fds[1] = fd;
+  fds[2] = 2;
+  if((pid = spawn("echo", echoargv, fds, 3)) < 0){
+    printf(1, "error: spawn\n");
+    exit();
+  }
+  if(wait() != pid){
+    printf(1, "error: wait\n");
+    exit();
+  }
+  close(fd);
+
+  memset(buf, 0, sizeof(buf));
+  if((fd = open(TEST_FILE, O_RDONLY)) < 0 || read(fd, buf, sizeof(buf)) != 8 ||
+     strcmp(buf, "spawned\n") != 0){
+    printf(1, "error: child output\n");
+    exit();
+  }
+  close(fd);
+  unlink(TEST_FILE);
+
+  if(spawn("/nonexistent", echoargv, 0, 0) != -1 || spawn("echo", echoargv, fds, 1) < 0){
+    printf(1, "error: spawn result\n");
+    exit();
+  }
+  wait();
+  fds[0] = 100;
+  if(spawn("echo", echoargv, fds, 1) != -1){
+    printf(1, "error: bad fd accepted\n");
+    exit();
+  }
+  printf(1, "spawn ok\n");
+  exit();
+}
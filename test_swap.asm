@@ -0,0 +1,2243 @@
+
+_test_swap:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <statval>:
+char buf[1024];
+
+// The value on the line for name in /stats file path, or -1.
+static int
+statval(char *path, char *name)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int fd, n, i;
+  char *p;
+
+  if((fd = open(path, O_RDONLY)) < 0)
+       6:	83 ec 08             	sub    $0x8,%esp
+       9:	6a 00                	push   $0x0
+       b:	ff 75 08             	push   0x8(%ebp)
+       e:	e8 72 07 00 00       	call   785 <open>
+      13:	83 c4 10             	add    $0x10,%esp
+      16:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      19:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+      1d:	79 0a                	jns    29 <statval+0x29>
+    return -1;
+      1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      24:	e9 fb 00 00 00       	jmp    124 <statval+0x124>
+  n = read(fd, buf, sizeof(buf) - 1);
+      29:	83 ec 04             	sub    $0x4,%esp
+      2c:	68 ff 03 00 00       	push   $0x3ff
+      31:	68 a0 17 00 00       	push   $0x17a0
+      36:	ff 75 ec             	push   -0x14(%ebp)
+      39:	e8 24 07 00 00       	call   762 <read>
+      3e:	83 c4 10             	add    $0x10,%esp
+      41:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  close(fd);
+      44:	83 ec 0c             	sub    $0xc,%esp
+      47:	ff 75 ec             	push   -0x14(%ebp)
+      4a:	e8 21 07 00 00       	call   770 <close>
+      4f:	83 c4 10             	add    $0x10,%esp
+  if(n <= 0)
+      52:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+      56:	7f 0a                	jg     62 <statval+0x62>
+    return -1;
+      58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      5d:	e9 c2 00 00 00       	jmp    124 <statval+0x124>
+  buf[n] = 0;
+      62:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      65:	05 a0 17 00 00       	add    $0x17a0,%eax
+      6a:	c6 00 00             	movb   $0x0,(%eax)
+  for(p = buf; p; ){
+      6d:	c7 45 f0 a0 17 00 00 	movl   $0x17a0,-0x10(%ebp)
+      74:	e9 9c 00 00 00       	jmp    115 <statval+0x115>
+    for(i = 0; name[i] && p[i] == name[i]; i++)
+      79:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      80:	eb 04                	jmp    86 <statval+0x86>
+      82:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      89:	8b 45 0c             	mov    0xc(%ebp),%eax
+      8c:	01 d0                	add    %edx,%eax
+      8e:	0f b6 00             	movzbl (%eax),%eax
+      91:	84 c0                	test   %al,%al
+      93:	74 1a                	je     af <statval+0xaf>
+      95:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      9b:	01 d0                	add    %edx,%eax
+      9d:	0f b6 10             	movzbl (%eax),%edx
+      a0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+      a6:	01 c8                	add    %ecx,%eax
+      a8:	0f b6 00             	movzbl (%eax),%eax
+      ab:	38 c2                	cmp    %al,%dl
+      ad:	74 d3                	je     82 <statval+0x82>
+      ;
+    if(name[i] == 0 && p[i] == ' '){
+      af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+      b5:	01 d0                	add    %edx,%eax
+      b7:	0f b6 00             	movzbl (%eax),%eax
+      ba:	84 c0                	test   %al,%al
+      bc:	75 3a                	jne    f8 <statval+0xf8>
+      be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      c4:	01 d0                	add    %edx,%eax
+      c6:	0f b6 00             	movzbl (%eax),%eax
+      c9:	3c 20                	cmp    $0x20,%al
+      cb:	75 2b                	jne    f8 <statval+0xf8>
+      while(p[i] == ' ')
+      cd:	eb 04                	jmp    d3 <statval+0xd3>
+        i++;
+      cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      while(p[i] == ' ')
+      d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      d9:	01 d0                	add    %edx,%eax
+      db:	0f b6 00             	movzbl (%eax),%eax
+      de:	3c 20                	cmp    $0x20,%al
+      e0:	74 ed                	je     cf <statval+0xcf>
+      return atoi(p + i);
+      e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      e8:	01 d0                	add    %edx,%eax
+      ea:	83 ec 0c             	sub    $0xc,%esp
+      ed:	50                   	push   %eax
+      ee:	e8 88 05 00 00       	call   67b <atoi>
+      f3:	83 c4 10             	add    $0x10,%esp
+      f6:	eb 2c                	jmp    124 <statval+0x124>
+    }
+    if((p = strchr(p, '\n')) != 0)
+      f8:	83 ec 08             	sub    $0x8,%esp
+      fb:	6a 0a                	push   $0xa
+      fd:	ff 75 f0             	push   -0x10(%ebp)
+     100:	e8 87 04 00 00       	call   58c <strchr>
+     105:	83 c4 10             	add    $0x10,%esp
+     108:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     10b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     10f:	74 04                	je     115 <statval+0x115>
+      p++;
+     111:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  for(p = buf; p; ){
+     115:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     119:	0f 85 5a ff ff ff    	jne    79 <statval+0x79>
+  }
+  return -1;
+     11f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     124:	c9                   	leave
+     125:	c3                   	ret
+
+00000126 <child>:
+
+// Fill npage pages with words naming child c and the page, then
+// read them back, over and over.
+static int
+child(int c, int npage)
+{
+     126:	55                   	push   %ebp
+     127:	89 e5                	mov    %esp,%ebp
+     129:	53                   	push   %ebx
+     12a:	83 ec 14             	sub    $0x14,%esp
+  uint *p;
+  int i, j, pass;
+
+  if((p = (uint*)sbrk(npage * PGSIZE)) == (uint*)-1)
+     12d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     130:	c1 e0 0c             	shl    $0xc,%eax
+     133:	83 ec 0c             	sub    $0xc,%esp
+     136:	50                   	push   %eax
+     137:	e8 a3 06 00 00       	call   7df <sbrk>
+     13c:	83 c4 10             	add    $0x10,%esp
+     13f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     142:	83 7d e8 ff          	cmpl   $0xffffffff,-0x18(%ebp)
+     146:	75 0a                	jne    152 <child+0x2c>
+    return 0;
+     148:	b8 00 00 00 00       	mov    $0x0,%eax
+     14d:	e9 f5 00 00 00       	jmp    247 <child+0x121>
+  for(i = 0; i < npage; i++)
+     152:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     159:	eb 59                	jmp    1b4 <child+0x8e>
+    for(j = 0; j < PGSIZE/4; j += 128)
+     15b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     162:	eb 43                	jmp    1a7 <child+0x81>
+      p[i*PGSIZE/4 + j] = c << 24 | i << 8 | j / 128;
+     164:	8b 45 08             	mov    0x8(%ebp),%eax
+     167:	c1 e0 18             	shl    $0x18,%eax
+     16a:	89 c2                	mov    %eax,%edx
+     16c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     16f:	c1 e0 08             	shl    $0x8,%eax
+     172:	89 d1                	mov    %edx,%ecx
+     174:	09 c1                	or     %eax,%ecx
+     176:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     179:	8d 50 7f             	lea    0x7f(%eax),%edx
+     17c:	85 c0                	test   %eax,%eax
+     17e:	0f 48 c2             	cmovs  %edx,%eax
+     181:	c1 f8 07             	sar    $0x7,%eax
+     184:	09 c1                	or     %eax,%ecx
+     186:	89 ca                	mov    %ecx,%edx
+     188:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     18b:	c1 e0 0a             	shl    $0xa,%eax
+     18e:	89 c1                	mov    %eax,%ecx
+     190:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     193:	01 c8                	add    %ecx,%eax
+     195:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+     19c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     19f:	01 c8                	add    %ecx,%eax
+     1a1:	89 10                	mov    %edx,(%eax)
+    for(j = 0; j < PGSIZE/4; j += 128)
+     1a3:	83 6d f0 80          	subl   $0xffffff80,-0x10(%ebp)
+     1a7:	81 7d f0 ff 03 00 00 	cmpl   $0x3ff,-0x10(%ebp)
+     1ae:	7e b4                	jle    164 <child+0x3e>
+  for(i = 0; i < npage; i++)
+     1b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1b7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     1ba:	7c 9f                	jl     15b <child+0x35>
+  for(pass = 0; pass < NPASS; pass++)
+     1bc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     1c3:	eb 77                	jmp    23c <child+0x116>
+    for(i = 0; i < npage; i++)
+     1c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     1cc:	eb 62                	jmp    230 <child+0x10a>
+      for(j = 0; j < PGSIZE/4; j += 128)
+     1ce:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     1d5:	eb 4c                	jmp    223 <child+0xfd>
+        if(p[i*PGSIZE/4 + j] != (c << 24 | i << 8 | j / 128))
+     1d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1da:	c1 e0 0a             	shl    $0xa,%eax
+     1dd:	89 c2                	mov    %eax,%edx
+     1df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1e2:	01 d0                	add    %edx,%eax
+     1e4:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     1eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     1ee:	01 d0                	add    %edx,%eax
+     1f0:	8b 10                	mov    (%eax),%edx
+     1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f5:	c1 e0 18             	shl    $0x18,%eax
+     1f8:	89 c1                	mov    %eax,%ecx
+     1fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1fd:	c1 e0 08             	shl    $0x8,%eax
+     200:	89 cb                	mov    %ecx,%ebx
+     202:	09 c3                	or     %eax,%ebx
+     204:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     207:	8d 48 7f             	lea    0x7f(%eax),%ecx
+     20a:	85 c0                	test   %eax,%eax
+     20c:	0f 48 c1             	cmovs  %ecx,%eax
+     20f:	c1 f8 07             	sar    $0x7,%eax
+     212:	09 d8                	or     %ebx,%eax
+     214:	39 c2                	cmp    %eax,%edx
+     216:	74 07                	je     21f <child+0xf9>
+          return 0;
+     218:	b8 00 00 00 00       	mov    $0x0,%eax
+     21d:	eb 28                	jmp    247 <child+0x121>
+      for(j = 0; j < PGSIZE/4; j += 128)
+     21f:	83 6d f0 80          	subl   $0xffffff80,-0x10(%ebp)
+     223:	81 7d f0 ff 03 00 00 	cmpl   $0x3ff,-0x10(%ebp)
+     22a:	7e ab                	jle    1d7 <child+0xb1>
+    for(i = 0; i < npage; i++)
+     22c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     233:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     236:	7c 96                	jl     1ce <child+0xa8>
+  for(pass = 0; pass < NPASS; pass++)
+     238:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     23c:	83 7d ec 02          	cmpl   $0x2,-0x14(%ebp)
+     240:	7e 83                	jle    1c5 <child+0x9f>
+  return 1;
+     242:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     24a:	c9                   	leave
+     24b:	c3                   	ret
+
+0000024c <main>:
+
+int
+main(int argc, char *argv[])
+{
+     24c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     250:	83 e4 f0             	and    $0xfffffff0,%esp
+     253:	ff 71 fc             	push   -0x4(%ecx)
+     256:	55                   	push   %ebp
+     257:	89 e5                	mov    %esp,%ebp
+     259:	53                   	push   %ebx
+     25a:	51                   	push   %ecx
+     25b:	83 ec 30             	sub    $0x30,%esp
+  int nfree, nswap, nout, npage, fds[2], i, ok;
+  char c;
+
+  nfree = statval("/stats/kmem", "free");
+     25e:	83 ec 08             	sub    $0x8,%esp
+     261:	68 78 12 00 00       	push   $0x1278
+     266:	68 7d 12 00 00       	push   $0x127d
+     26b:	e8 90 fd ff ff       	call   0 <statval>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  nswap = statval("/stats/swap", "free");
+     276:	83 ec 08             	sub    $0x8,%esp
+     279:	68 78 12 00 00       	push   $0x1278
+     27e:	68 89 12 00 00       	push   $0x1289
+     283:	e8 78 fd ff ff       	call   0 <statval>
+     288:	83 c4 10             	add    $0x10,%esp
+     28b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(nfree < 0 || nswap < 0){
+     28e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     292:	78 06                	js     29a <main+0x4e>
+     294:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     298:	79 17                	jns    2b1 <main+0x65>
+    printf(1, "error: cannot read /stats\n");
+     29a:	83 ec 08             	sub    $0x8,%esp
+     29d:	68 95 12 00 00       	push   $0x1295
+     2a2:	6a 01                	push   $0x1
+     2a4:	e8 34 09 00 00       	call   bdd <printf>
+     2a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2ac:	e8 9c 04 00 00       	call   74d <exit>
+  }
+  if(nswap < nfree / 2){
+     2b1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     2b4:	89 c2                	mov    %eax,%edx
+     2b6:	c1 ea 1f             	shr    $0x1f,%edx
+     2b9:	01 d0                	add    %edx,%eax
+     2bb:	d1 f8                	sar    %eax
+     2bd:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+     2c0:	7d 1a                	jge    2dc <main+0x90>
+    printf(1, "error: %d free pages but %d of swap; build with MEMMB=16\n",
+     2c2:	ff 75 e8             	push   -0x18(%ebp)
+     2c5:	ff 75 ec             	push   -0x14(%ebp)
+     2c8:	68 b0 12 00 00       	push   $0x12b0
+     2cd:	6a 01                	push   $0x1
+     2cf:	e8 09 09 00 00       	call   bdd <printf>
+     2d4:	83 c4 10             	add    $0x10,%esp
+           nfree, nswap);
+    exit();
+     2d7:	e8 71 04 00 00       	call   74d <exit>
+  }
+  nout = statval("/stats/swap", "pageouts");
+     2dc:	83 ec 08             	sub    $0x8,%esp
+     2df:	68 ea 12 00 00       	push   $0x12ea
+     2e4:	68 89 12 00 00       	push   $0x1289
+     2e9:	e8 12 fd ff ff       	call   0 <statval>
+     2ee:	83 c4 10             	add    $0x10,%esp
+     2f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  // A quarter more than is free.
+  npage = (nfree + nfree / 4) / NCHILD;
+     2f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     2f7:	8d 50 03             	lea    0x3(%eax),%edx
+     2fa:	85 c0                	test   %eax,%eax
+     2fc:	0f 48 c2             	cmovs  %edx,%eax
+     2ff:	c1 f8 02             	sar    $0x2,%eax
+     302:	89 c2                	mov    %eax,%edx
+     304:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     307:	01 d0                	add    %edx,%eax
+     309:	8d 50 03             	lea    0x3(%eax),%edx
+     30c:	85 c0                	test   %eax,%eax
+     30e:	0f 48 c2             	cmovs  %edx,%eax
+     311:	c1 f8 02             	sar    $0x2,%eax
+     314:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(pipe(fds) < 0){
+     317:	83 ec 0c             	sub    $0xc,%esp
+     31a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     31d:	50                   	push   %eax
+     31e:	e8 38 04 00 00       	call   75b <pipe>
+     323:	83 c4 10             	add    $0x10,%esp
+     326:	85 c0                	test   %eax,%eax
+     328:	79 17                	jns    341 <main+0xf5>
+    printf(1, "error: pipe\n");
+     32a:	83 ec 08             	sub    $0x8,%esp
+     32d:	68 f3 12 00 00       	push   $0x12f3
+     332:	6a 01                	push   $0x1
+     334:	e8 a4 08 00 00       	call   bdd <printf>
+     339:	83 c4 10             	add    $0x10,%esp
+    exit();
+     33c:	e8 0c 04 00 00       	call   74d <exit>
+  }
+  for(i = 0; i < NCHILD; i++){
+     341:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     348:	eb 4b                	jmp    395 <main+0x149>
+    if(fork() == 0){
+     34a:	e8 f7 03 00 00       	call   746 <fork>
+     34f:	85 c0                	test   %eax,%eax
+     351:	75 3e                	jne    391 <main+0x145>
+      c = child(i, npage) ? 'y' : 'n';
+     353:	83 ec 08             	sub    $0x8,%esp
+     356:	ff 75 e0             	push   -0x20(%ebp)
+     359:	ff 75 f4             	push   -0xc(%ebp)
+     35c:	e8 c5 fd ff ff       	call   126 <child>
+     361:	83 c4 10             	add    $0x10,%esp
+     364:	85 c0                	test   %eax,%eax
+     366:	74 07                	je     36f <main+0x123>
+     368:	b8 79 00 00 00       	mov    $0x79,%eax
+     36d:	eb 05                	jmp    374 <main+0x128>
+     36f:	b8 6e 00 00 00       	mov    $0x6e,%eax
+     374:	88 45 d7             	mov    %al,-0x29(%ebp)
+      write(fds[1], &c, 1);
+     377:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     37a:	83 ec 04             	sub    $0x4,%esp
+     37d:	6a 01                	push   $0x1
+     37f:	8d 55 d7             	lea    -0x29(%ebp),%edx
+     382:	52                   	push   %edx
+     383:	50                   	push   %eax
+     384:	e8 e0 03 00 00       	call   769 <write>
+     389:	83 c4 10             	add    $0x10,%esp
+      exit();
+     38c:	e8 bc 03 00 00       	call   74d <exit>
+  for(i = 0; i < NCHILD; i++){
+     391:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     395:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     399:	7e af                	jle    34a <main+0xfe>
+    }
+  }
+  close(fds[1]);
+     39b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     39e:	83 ec 0c             	sub    $0xc,%esp
+     3a1:	50                   	push   %eax
+     3a2:	e8 c9 03 00 00       	call   770 <close>
+     3a7:	83 c4 10             	add    $0x10,%esp
+  ok = 0;
+     3aa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fds[0], &c, 1) == 1)
+     3b1:	eb 0f                	jmp    3c2 <main+0x176>
+    ok += c == 'y';
+     3b3:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+     3b7:	3c 79                	cmp    $0x79,%al
+     3b9:	0f 94 c0             	sete   %al
+     3bc:	0f b6 c0             	movzbl %al,%eax
+     3bf:	01 45 f0             	add    %eax,-0x10(%ebp)
+  while(read(fds[0], &c, 1) == 1)
+     3c2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     3c5:	83 ec 04             	sub    $0x4,%esp
+     3c8:	6a 01                	push   $0x1
+     3ca:	8d 55 d7             	lea    -0x29(%ebp),%edx
+     3cd:	52                   	push   %edx
+     3ce:	50                   	push   %eax
+     3cf:	e8 8e 03 00 00       	call   762 <read>
+     3d4:	83 c4 10             	add    $0x10,%esp
+     3d7:	83 f8 01             	cmp    $0x1,%eax
+     3da:	74 d7                	je     3b3 <main+0x167>
+  for(i = 0; i < NCHILD; i++)
+     3dc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3e3:	eb 09                	jmp    3ee <main+0x1a2>
+    wait();
+     3e5:	e8 6a 03 00 00       	call   754 <wait>
+  for(i = 0; i < NCHILD; i++)
+     3ea:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3ee:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     3f2:	7e f1                	jle    3e5 <main+0x199>
+  if(ok != NCHILD){
+     3f4:	83 7d f0 04          	cmpl   $0x4,-0x10(%ebp)
+     3f8:	74 1f                	je     419 <main+0x1cd>
+    printf(1, "error: %d of %d processes lost memory\n", NCHILD - ok, NCHILD);
+     3fa:	b8 04 00 00 00       	mov    $0x4,%eax
+     3ff:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     402:	6a 04                	push   $0x4
+     404:	50                   	push   %eax
+     405:	68 00 13 00 00       	push   $0x1300
+     40a:	6a 01                	push   $0x1
+     40c:	e8 cc 07 00 00       	call   bdd <printf>
+     411:	83 c4 10             	add    $0x10,%esp
+    exit();
+     414:	e8 34 03 00 00       	call   74d <exit>
+  }
+  if(statval("/stats/swap", "pageouts") <= nout){
+     419:	83 ec 08             	sub    $0x8,%esp
+     41c:	68 ea 12 00 00       	push   $0x12ea
+     421:	68 89 12 00 00       	push   $0x1289
+     426:	e8 d5 fb ff ff       	call   0 <statval>
+     42b:	83 c4 10             	add    $0x10,%esp
+     42e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+     431:	7c 23                	jl     456 <main+0x20a>
+    printf(1, "error: %d pages in %d processes, %d free, but no pageouts\n",
+     433:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     436:	c1 e0 02             	shl    $0x2,%eax
+     439:	83 ec 0c             	sub    $0xc,%esp
+     43c:	ff 75 ec             	push   -0x14(%ebp)
+     43f:	6a 04                	push   $0x4
+     441:	50                   	push   %eax
+     442:	68 28 13 00 00       	push   $0x1328
+     447:	6a 01                	push   $0x1
+     449:	e8 8f 07 00 00       	call   bdd <printf>
+     44e:	83 c4 20             	add    $0x20,%esp
+           npage * NCHILD, NCHILD, nfree);
+    exit();
+     451:	e8 f7 02 00 00       	call   74d <exit>
+  }
+  printf(1, "%d pages in %d processes, %d free: swap ok\n",
+     456:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     459:	c1 e0 02             	shl    $0x2,%eax
+     45c:	83 ec 0c             	sub    $0xc,%esp
+     45f:	ff 75 ec             	push   -0x14(%ebp)
+     462:	6a 04                	push   $0x4
+     464:	50                   	push   %eax
+     465:	68 64 13 00 00       	push   $0x1364
+     46a:	6a 01                	push   $0x1
+     46c:	e8 6c 07 00 00       	call   bdd <printf>
+     471:	83 c4 20             	add    $0x20,%esp
+         npage * NCHILD, NCHILD, nfree);
+  printf(1, "pageouts %d pageins %d\n", statval("/stats/swap", "pageouts"),
+     474:	83 ec 08             	sub    $0x8,%esp
+     477:	68 90 13 00 00       	push   $0x1390
+     47c:	68 89 12 00 00       	push   $0x1289
+     481:	e8 7a fb ff ff       	call   0 <statval>
+     486:	83 c4 10             	add    $0x10,%esp
+     489:	89 c3                	mov    %eax,%ebx
+     48b:	83 ec 08             	sub    $0x8,%esp
+     48e:	68 ea 12 00 00       	push   $0x12ea
+     493:	68 89 12 00 00       	push   $0x1289
+     498:	e8 63 fb ff ff       	call   0 <statval>
+     49d:	83 c4 10             	add    $0x10,%esp
+     4a0:	53                   	push   %ebx
+     4a1:	50                   	push   %eax
+     4a2:	68 98 13 00 00       	push   $0x1398
+     4a7:	6a 01                	push   $0x1
+     4a9:	e8 2f 07 00 00       	call   bdd <printf>
+     4ae:	83 c4 10             	add    $0x10,%esp
+         statval("/stats/swap", "pageins"));
+  exit();
+     4b1:	e8 97 02 00 00       	call   74d <exit>
+
+000004b6 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     4b6:	55                   	push   %ebp
+     4b7:	89 e5                	mov    %esp,%ebp
+     4b9:	57                   	push   %edi
+     4ba:	53                   	push   %ebx
+    if(cc < 1)
+     4bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4be:	8b 55 10             	mov    0x10(%ebp),%edx
+     4c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4c4:	89 cb                	mov    %ecx,%ebx
+     4c6:	89 df                	mov    %ebx,%edi
+     4c8:	89 d1                	mov    %edx,%ecx
+     4ca:	fc                   	cld
+     4cb:	f3 aa                	rep stos %al,%es:(%edi)
+     4cd:	89 ca                	mov    %ecx,%edx
+     4cf:	89 fb                	mov    %edi,%ebx
+     4d1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4d4:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     4d7:	90                   	nop
+     4d8:	5b                   	pop    %ebx
+     4d9:	5f                   	pop    %edi
+     4da:	5d                   	pop    %ebp
+     4db:	c3                   	ret
+
+000004dc <strcpy>:
+{
+     4dc:	55                   	push   %ebp
+     4dd:	89 e5                	mov    %esp,%ebp
+     4df:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     4e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     4e8:	90                   	nop
+     4e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4ec:	8d 42 01             	lea    0x1(%edx),%eax
+     4ef:	89 45 0c             	mov    %eax,0xc(%ebp)
+     4f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f5:	8d 48 01             	lea    0x1(%eax),%ecx
+     4f8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     4fb:	0f b6 12             	movzbl (%edx),%edx
+     4fe:	88 10                	mov    %dl,(%eax)
+     500:	0f b6 00             	movzbl (%eax),%eax
+     503:	84 c0                	test   %al,%al
+     505:	75 e2                	jne    4e9 <strcpy+0xd>
+  return os;
+     507:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+
+0000050c <strcmp>:
+{
+     50c:	55                   	push   %ebp
+     50d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     50f:	eb 08                	jmp    519 <strcmp+0xd>
+    p++, q++;
+     511:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     515:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     519:	8b 45 08             	mov    0x8(%ebp),%eax
+     51c:	0f b6 00             	movzbl (%eax),%eax
+     51f:	84 c0                	test   %al,%al
+     521:	74 10                	je     533 <strcmp+0x27>
+     523:	8b 45 08             	mov    0x8(%ebp),%eax
+     526:	0f b6 10             	movzbl (%eax),%edx
+     529:	8b 45 0c             	mov    0xc(%ebp),%eax
+     52c:	0f b6 00             	movzbl (%eax),%eax
+     52f:	38 c2                	cmp    %al,%dl
+     531:	74 de                	je     511 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     533:	8b 45 08             	mov    0x8(%ebp),%eax
+     536:	0f b6 00             	movzbl (%eax),%eax
+     539:	0f b6 d0             	movzbl %al,%edx
+     53c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     53f:	0f b6 00             	movzbl (%eax),%eax
+     542:	0f b6 c0             	movzbl %al,%eax
+     545:	29 c2                	sub    %eax,%edx
+     547:	89 d0                	mov    %edx,%eax
+}
+     549:	5d                   	pop    %ebp
+     54a:	c3                   	ret
+
+0000054b <strlen>:
+{
+     54b:	55                   	push   %ebp
+     54c:	89 e5                	mov    %esp,%ebp
+     54e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     551:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     558:	eb 04                	jmp    55e <strlen+0x13>
+     55a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     55e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     561:	8b 45 08             	mov    0x8(%ebp),%eax
+     564:	01 d0                	add    %edx,%eax
+     566:	0f b6 00             	movzbl (%eax),%eax
+     569:	84 c0                	test   %al,%al
+     56b:	75 ed                	jne    55a <strlen+0xf>
+  return n;
+     56d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     570:	c9                   	leave
+     571:	c3                   	ret
+
+00000572 <memset>:
+{
+     572:	55                   	push   %ebp
+     573:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     575:	8b 45 10             	mov    0x10(%ebp),%eax
+     578:	50                   	push   %eax
+     579:	ff 75 0c             	push   0xc(%ebp)
+     57c:	ff 75 08             	push   0x8(%ebp)
+     57f:	e8 32 ff ff ff       	call   4b6 <stosb>
+     584:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     587:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     58a:	c9                   	leave
+     58b:	c3                   	ret
+
+0000058c <strchr>:
+{
+     58c:	55                   	push   %ebp
+     58d:	89 e5                	mov    %esp,%ebp
+     58f:	83 ec 04             	sub    $0x4,%esp
+     592:	8b 45 0c             	mov    0xc(%ebp),%eax
+     595:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     598:	eb 14                	jmp    5ae <strchr+0x22>
+    if(*s == c)
+     59a:	8b 45 08             	mov    0x8(%ebp),%eax
+     59d:	0f b6 00             	movzbl (%eax),%eax
+     5a0:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     5a3:	75 05                	jne    5aa <strchr+0x1e>
+      return (char*)s;
+     5a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a8:	eb 13                	jmp    5bd <strchr+0x31>
+  for(; *s; s++)
+     5aa:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b1:	0f b6 00             	movzbl (%eax),%eax
+     5b4:	84 c0                	test   %al,%al
+     5b6:	75 e2                	jne    59a <strchr+0xe>
+  return 0;
+     5b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     5bd:	c9                   	leave
+     5be:	c3                   	ret
+
+000005bf <gets>:
+{
+     5bf:	55                   	push   %ebp
+     5c0:	89 e5                	mov    %esp,%ebp
+     5c2:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     5c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     5cc:	eb 42                	jmp    610 <gets+0x51>
+    cc = read(0, &c, 1);
+     5ce:	83 ec 04             	sub    $0x4,%esp
+     5d1:	6a 01                	push   $0x1
+     5d3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     5d6:	50                   	push   %eax
+     5d7:	6a 00                	push   $0x0
+     5d9:	e8 84 01 00 00       	call   762 <read>
+     5de:	83 c4 10             	add    $0x10,%esp
+     5e1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     5e4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     5e8:	7e 33                	jle    61d <gets+0x5e>
+    buf[i++] = c;
+     5ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5ed:	8d 50 01             	lea    0x1(%eax),%edx
+     5f0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     5f3:	89 c2                	mov    %eax,%edx
+     5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f8:	01 c2                	add    %eax,%edx
+     5fa:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     5fe:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     600:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     604:	3c 0a                	cmp    $0xa,%al
+     606:	74 16                	je     61e <gets+0x5f>
+     608:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     60c:	3c 0d                	cmp    $0xd,%al
+     60e:	74 0e                	je     61e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     610:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     613:	83 c0 01             	add    $0x1,%eax
+     616:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     619:	7f b3                	jg     5ce <gets+0xf>
+     61b:	eb 01                	jmp    61e <gets+0x5f>
+      break;
+     61d:	90                   	nop
+  }
+  buf[i] = '\0';
+     61e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     621:	8b 45 08             	mov    0x8(%ebp),%eax
+     624:	01 d0                	add    %edx,%eax
+     626:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     629:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     62c:	c9                   	leave
+     62d:	c3                   	ret
+
+0000062e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     62e:	55                   	push   %ebp
+     62f:	89 e5                	mov    %esp,%ebp
+     631:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     634:	83 ec 08             	sub    $0x8,%esp
+     637:	6a 00                	push   $0x0
+     639:	ff 75 08             	push   0x8(%ebp)
+     63c:	e8 44 01 00 00       	call   785 <open>
+     641:	83 c4 10             	add    $0x10,%esp
+     644:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     647:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     64b:	79 07                	jns    654 <stat+0x26>
+    return -1;
+     64d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     652:	eb 25                	jmp    679 <stat+0x4b>
+  r = fstat(fd, st);
+     654:	83 ec 08             	sub    $0x8,%esp
+     657:	ff 75 0c             	push   0xc(%ebp)
+     65a:	ff 75 f4             	push   -0xc(%ebp)
+     65d:	e8 41 01 00 00       	call   7a3 <fstat>
+     662:	83 c4 10             	add    $0x10,%esp
+     665:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     668:	83 ec 0c             	sub    $0xc,%esp
+     66b:	ff 75 f4             	push   -0xc(%ebp)
+     66e:	e8 fd 00 00 00       	call   770 <close>
+     673:	83 c4 10             	add    $0x10,%esp
+  return r;
+     676:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     679:	c9                   	leave
+     67a:	c3                   	ret
+
+0000067b <atoi>:
+
+int
+atoi(const char *s)
+{
+     67b:	55                   	push   %ebp
+     67c:	89 e5                	mov    %esp,%ebp
+     67e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     681:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     688:	eb 25                	jmp    6af <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     68a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     68d:	89 d0                	mov    %edx,%eax
+     68f:	c1 e0 02             	shl    $0x2,%eax
+     692:	01 d0                	add    %edx,%eax
+     694:	01 c0                	add    %eax,%eax
+     696:	89 c1                	mov    %eax,%ecx
+     698:	8b 45 08             	mov    0x8(%ebp),%eax
+     69b:	8d 50 01             	lea    0x1(%eax),%edx
+     69e:	89 55 08             	mov    %edx,0x8(%ebp)
+     6a1:	0f b6 00             	movzbl (%eax),%eax
+     6a4:	0f be c0             	movsbl %al,%eax
+     6a7:	01 c8                	add    %ecx,%eax
+     6a9:	83 e8 30             	sub    $0x30,%eax
+     6ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     6af:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b2:	0f b6 00             	movzbl (%eax),%eax
+     6b5:	3c 2f                	cmp    $0x2f,%al
+     6b7:	7e 0a                	jle    6c3 <atoi+0x48>
+     6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+     6bc:	0f b6 00             	movzbl (%eax),%eax
+     6bf:	3c 39                	cmp    $0x39,%al
+     6c1:	7e c7                	jle    68a <atoi+0xf>
+  return n;
+     6c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     6c6:	c9                   	leave
+     6c7:	c3                   	ret
+
+000006c8 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     6c8:	55                   	push   %ebp
+     6c9:	89 e5                	mov    %esp,%ebp
+     6cb:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     6ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     6d1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     6d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6d7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     6da:	eb 17                	jmp    6f3 <memmove+0x2b>
+    *dst++ = *src++;
+     6dc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     6df:	8d 42 01             	lea    0x1(%edx),%eax
+     6e2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     6e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6e8:	8d 48 01             	lea    0x1(%eax),%ecx
+     6eb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     6ee:	0f b6 12             	movzbl (%edx),%edx
+     6f1:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     6f3:	8b 45 10             	mov    0x10(%ebp),%eax
+     6f6:	8d 50 ff             	lea    -0x1(%eax),%edx
+     6f9:	89 55 10             	mov    %edx,0x10(%ebp)
+     6fc:	85 c0                	test   %eax,%eax
+     6fe:	7f dc                	jg     6dc <memmove+0x14>
+  return vdst;
+     700:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     703:	c9                   	leave
+     704:	c3                   	ret
+
+00000705 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     705:	83 3d 84 17 00 00 00 	cmpl   $0x0,0x1784
+  jg 2f
+     70c:	7f 2e                	jg     73c <dosyscall+0x37>
+  jl 1f
+     70e:	7c 29                	jl     739 <dosyscall+0x34>
+  pushl %eax
+     710:	50                   	push   %eax
+  pushl %ebx
+     711:	53                   	push   %ebx
+  movl $1, %eax
+     712:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     717:	0f a2                	cpuid
+  popl %ebx
+     719:	5b                   	pop    %ebx
+  popl %eax
+     71a:	58                   	pop    %eax
+  movl $-1, sysmode
+     71b:	c7 05 84 17 00 00 ff 	movl   $0xffffffff,0x1784
+     722:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     725:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     72b:	74 0c                	je     739 <dosyscall+0x34>
+  movl $1, sysmode
+     72d:	c7 05 84 17 00 00 01 	movl   $0x1,0x1784
+     734:	00 00 00 
+  jmp 2f
+     737:	eb 03                	jmp    73c <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     739:	cd 40                	int    $0x40
+  ret
+     73b:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     73c:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     73e:	ba 45 07 00 00       	mov    $0x745,%edx
+  sysenter
+     743:	0f 34                	sysenter
+3:
+  ret
+     745:	c3                   	ret
+
+00000746 <fork>:
+
+SYSCALL(fork)
+     746:	b8 01 00 00 00       	mov    $0x1,%eax
+     74b:	eb b8                	jmp    705 <dosyscall>
+
+0000074d <exit>:
+SYSCALL(exit)
+     74d:	b8 02 00 00 00       	mov    $0x2,%eax
+     752:	eb b1                	jmp    705 <dosyscall>
+
+00000754 <wait>:
+SYSCALL(wait)
+     754:	b8 03 00 00 00       	mov    $0x3,%eax
+     759:	eb aa                	jmp    705 <dosyscall>
+
+0000075b <pipe>:
+SYSCALL(pipe)
+     75b:	b8 04 00 00 00       	mov    $0x4,%eax
+     760:	eb a3                	jmp    705 <dosyscall>
+
+00000762 <read>:
+SYSCALL(read)
+     762:	b8 05 00 00 00       	mov    $0x5,%eax
+     767:	eb 9c                	jmp    705 <dosyscall>
+
+00000769 <write>:
+SYSCALL(write)
+     769:	b8 10 00 00 00       	mov    $0x10,%eax
+     76e:	eb 95                	jmp    705 <dosyscall>
+
+00000770 <close>:
+SYSCALL(close)
+     770:	b8 15 00 00 00       	mov    $0x15,%eax
+     775:	eb 8e                	jmp    705 <dosyscall>
+
+00000777 <kill>:
+SYSCALL(kill)
+     777:	b8 06 00 00 00       	mov    $0x6,%eax
+     77c:	eb 87                	jmp    705 <dosyscall>
+
+0000077e <exec>:
+SYSCALL(exec)
+     77e:	b8 07 00 00 00       	mov    $0x7,%eax
+     783:	eb 80                	jmp    705 <dosyscall>
+
+00000785 <open>:
+SYSCALL(open)
+     785:	b8 0f 00 00 00       	mov    $0xf,%eax
+     78a:	e9 76 ff ff ff       	jmp    705 <dosyscall>
+
+0000078f <mknod>:
+SYSCALL(mknod)
+     78f:	b8 11 00 00 00       	mov    $0x11,%eax
+     794:	e9 6c ff ff ff       	jmp    705 <dosyscall>
+
+00000799 <unlink>:
+SYSCALL(unlink)
+     799:	b8 12 00 00 00       	mov    $0x12,%eax
+     79e:	e9 62 ff ff ff       	jmp    705 <dosyscall>
+
+000007a3 <fstat>:
+SYSCALL(fstat)
+     7a3:	b8 08 00 00 00       	mov    $0x8,%eax
+     7a8:	e9 58 ff ff ff       	jmp    705 <dosyscall>
+
+000007ad <link>:
+SYSCALL(link)
+     7ad:	b8 13 00 00 00       	mov    $0x13,%eax
+     7b2:	e9 4e ff ff ff       	jmp    705 <dosyscall>
+
+000007b7 <mkdir>:
+SYSCALL(mkdir)
+     7b7:	b8 14 00 00 00       	mov    $0x14,%eax
+     7bc:	e9 44 ff ff ff       	jmp    705 <dosyscall>
+
+000007c1 <chdir>:
+SYSCALL(chdir)
+     7c1:	b8 09 00 00 00       	mov    $0x9,%eax
+     7c6:	e9 3a ff ff ff       	jmp    705 <dosyscall>
+
+000007cb <dup>:
+SYSCALL(dup)
+     7cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7d0:	e9 30 ff ff ff       	jmp    705 <dosyscall>
+
+000007d5 <getpid>:
+SYSCALL(getpid)
+     7d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7da:	e9 26 ff ff ff       	jmp    705 <dosyscall>
+
+000007df <sbrk>:
+SYSCALL(sbrk)
+     7df:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7e4:	e9 1c ff ff ff       	jmp    705 <dosyscall>
+
+000007e9 <sleep>:
+SYSCALL(sleep)
+     7e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7ee:	e9 12 ff ff ff       	jmp    705 <dosyscall>
+
+000007f3 <uptime>:
+SYSCALL(uptime)
+     7f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7f8:	e9 08 ff ff ff       	jmp    705 <dosyscall>
+
+000007fd <symlink>:
+SYSCALL(symlink)
+     7fd:	b8 16 00 00 00       	mov    $0x16,%eax
+     802:	e9 fe fe ff ff       	jmp    705 <dosyscall>
+
+00000807 <readlink>:
+SYSCALL(readlink)
+     807:	b8 17 00 00 00       	mov    $0x17,%eax
+     80c:	e9 f4 fe ff ff       	jmp    705 <dosyscall>
+
+00000811 <fprot>:
+SYSCALL(fprot)
+     811:	b8 18 00 00 00       	mov    $0x18,%eax
+     816:	e9 ea fe ff ff       	jmp    705 <dosyscall>
+
+0000081b <funprot>:
+SYSCALL(funprot)
+     81b:	b8 19 00 00 00       	mov    $0x19,%eax
+     820:	e9 e0 fe ff ff       	jmp    705 <dosyscall>
+
+00000825 <funlock>:
+SYSCALL(funlock)
+     825:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     82a:	e9 d6 fe ff ff       	jmp    705 <dosyscall>
+
+0000082f <mmap>:
+SYSCALL(mmap)
+     82f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     834:	e9 cc fe ff ff       	jmp    705 <dosyscall>
+
+00000839 <munmap>:
+SYSCALL(munmap)
+     839:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     83e:	e9 c2 fe ff ff       	jmp    705 <dosyscall>
+
+00000843 <sendfile>:
+SYSCALL(sendfile)
+     843:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     848:	e9 b8 fe ff ff       	jmp    705 <dosyscall>
+
+0000084d <readv>:
+SYSCALL(readv)
+     84d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     852:	e9 ae fe ff ff       	jmp    705 <dosyscall>
+
+00000857 <writev>:
+SYSCALL(writev)
+     857:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     85c:	e9 a4 fe ff ff       	jmp    705 <dosyscall>
+
+00000861 <pread>:
+SYSCALL(pread)
+     861:	b8 20 00 00 00       	mov    $0x20,%eax
+     866:	e9 9a fe ff ff       	jmp    705 <dosyscall>
+
+0000086b <pwrite>:
+SYSCALL(pwrite)
+     86b:	b8 21 00 00 00       	mov    $0x21,%eax
+     870:	e9 90 fe ff ff       	jmp    705 <dosyscall>
+
+00000875 <lseek>:
+SYSCALL(lseek)
+     875:	b8 22 00 00 00       	mov    $0x22,%eax
+     87a:	e9 86 fe ff ff       	jmp    705 <dosyscall>
+
+0000087f <spawn>:
+SYSCALL(spawn)
+     87f:	b8 23 00 00 00       	mov    $0x23,%eax
+     884:	e9 7c fe ff ff       	jmp    705 <dosyscall>
+
+00000889 <setpriority>:
+SYSCALL(setpriority)
+     889:	b8 24 00 00 00       	mov    $0x24,%eax
+     88e:	e9 72 fe ff ff       	jmp    705 <dosyscall>
+
+00000893 <kthread_create>:
+SYSCALL(kthread_create)
+     893:	b8 25 00 00 00       	mov    $0x25,%eax
+     898:	e9 68 fe ff ff       	jmp    705 <dosyscall>
+
+0000089d <kthread_id>:
+SYSCALL(kthread_id)
+     89d:	b8 26 00 00 00       	mov    $0x26,%eax
+     8a2:	e9 5e fe ff ff       	jmp    705 <dosyscall>
+
+000008a7 <kthread_exit>:
+SYSCALL(kthread_exit)
+     8a7:	b8 27 00 00 00       	mov    $0x27,%eax
+     8ac:	e9 54 fe ff ff       	jmp    705 <dosyscall>
+
+000008b1 <kthread_join>:
+SYSCALL(kthread_join)
+     8b1:	b8 28 00 00 00       	mov    $0x28,%eax
+     8b6:	e9 4a fe ff ff       	jmp    705 <dosyscall>
+
+000008bb <futex>:
+SYSCALL(futex)
+     8bb:	b8 29 00 00 00       	mov    $0x29,%eax
+     8c0:	e9 40 fe ff ff       	jmp    705 <dosyscall>
+
+000008c5 <signal>:
+SYSCALL(signal)
+     8c5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     8ca:	e9 36 fe ff ff       	jmp    705 <dosyscall>
+
+000008cf <alarm>:
+SYSCALL(alarm)
+     8cf:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     8d4:	e9 2c fe ff ff       	jmp    705 <dosyscall>
+
+000008d9 <usleep>:
+SYSCALL(usleep)
+     8d9:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     8de:	e9 22 fe ff ff       	jmp    705 <dosyscall>
+
+000008e3 <ioring_setup>:
+SYSCALL(ioring_setup)
+     8e3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     8e8:	e9 18 fe ff ff       	jmp    705 <dosyscall>
+
+000008ed <ioring_enter>:
+SYSCALL(ioring_enter)
+     8ed:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     8f2:	e9 0e fe ff ff       	jmp    705 <dosyscall>
+
+000008f7 <getrusage>:
+SYSCALL(getrusage)
+     8f7:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     8fc:	e9 04 fe ff ff       	jmp    705 <dosyscall>
+
+00000901 <mount>:
+SYSCALL(mount)
+     901:	b8 30 00 00 00       	mov    $0x30,%eax
+     906:	e9 fa fd ff ff       	jmp    705 <dosyscall>
+
+0000090b <getdents>:
+SYSCALL(getdents)
+     90b:	b8 31 00 00 00       	mov    $0x31,%eax
+     910:	e9 f0 fd ff ff       	jmp    705 <dosyscall>
+
+00000915 <yield>:
+SYSCALL(yield)
+     915:	b8 32 00 00 00       	mov    $0x32,%eax
+     91a:	e9 e6 fd ff ff       	jmp    705 <dosyscall>
+
+0000091f <ncpu>:
+SYSCALL(ncpu)
+     91f:	b8 33 00 00 00       	mov    $0x33,%eax
+     924:	e9 dc fd ff ff       	jmp    705 <dosyscall>
+
+00000929 <fallocate>:
+SYSCALL(fallocate)
+     929:	b8 34 00 00 00       	mov    $0x34,%eax
+     92e:	e9 d2 fd ff ff       	jmp    705 <dosyscall>
+
+00000933 <ftruncate>:
+SYSCALL(ftruncate)
+     933:	b8 35 00 00 00       	mov    $0x35,%eax
+     938:	e9 c8 fd ff ff       	jmp    705 <dosyscall>
+
+0000093d <fsync>:
+SYSCALL(fsync)
+     93d:	b8 36 00 00 00       	mov    $0x36,%eax
+     942:	e9 be fd ff ff       	jmp    705 <dosyscall>
+
+00000947 <fdatasync>:
+SYSCALL(fdatasync)
+     947:	b8 37 00 00 00       	mov    $0x37,%eax
+     94c:	e9 b4 fd ff ff       	jmp    705 <dosyscall>
+
+00000951 <poll>:
+SYSCALL(poll)
+     951:	b8 38 00 00 00       	mov    $0x38,%eax
+     956:	e9 aa fd ff ff       	jmp    705 <dosyscall>
+
+0000095b <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     95b:	55                   	push   %ebp
+     95c:	89 e5                	mov    %esp,%ebp
+     95e:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     961:	8b 45 08             	mov    0x8(%ebp),%eax
+     964:	8b 40 04             	mov    0x4(%eax),%eax
+     967:	85 c0                	test   %eax,%eax
+     969:	7e 1f                	jle    98a <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     96b:	8b 45 08             	mov    0x8(%ebp),%eax
+     96e:	8b 50 04             	mov    0x4(%eax),%edx
+     971:	8b 45 08             	mov    0x8(%ebp),%eax
+     974:	8d 48 08             	lea    0x8(%eax),%ecx
+     977:	8b 45 08             	mov    0x8(%ebp),%eax
+     97a:	8b 00                	mov    (%eax),%eax
+     97c:	83 ec 04             	sub    $0x4,%esp
+     97f:	52                   	push   %edx
+     980:	51                   	push   %ecx
+     981:	50                   	push   %eax
+     982:	e8 d0 fe ff ff       	call   857 <writev>
+     987:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     98a:	8b 45 08             	mov    0x8(%ebp),%eax
+     98d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     994:	8b 45 08             	mov    0x8(%ebp),%eax
+     997:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     99e:	00 00 00 
+}
+     9a1:	90                   	nop
+     9a2:	c9                   	leave
+     9a3:	c3                   	ret
+
+000009a4 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     9a4:	55                   	push   %ebp
+     9a5:	89 e5                	mov    %esp,%ebp
+     9a7:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     9aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     9ae:	0f 84 94 00 00 00    	je     a48 <put+0xa4>
+    return;
+  if(o->n > 0){
+     9b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9b7:	8b 40 04             	mov    0x4(%eax),%eax
+     9ba:	85 c0                	test   %eax,%eax
+     9bc:	7e 40                	jle    9fe <put+0x5a>
+    v = &o->iov[o->n-1];
+     9be:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c1:	8b 40 04             	mov    0x4(%eax),%eax
+     9c4:	83 e8 01             	sub    $0x1,%eax
+     9c7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     9ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d1:	01 d0                	add    %edx,%eax
+     9d3:	83 c0 08             	add    $0x8,%eax
+     9d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     9d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9dc:	8b 10                	mov    (%eax),%edx
+     9de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9e1:	8b 40 04             	mov    0x4(%eax),%eax
+     9e4:	01 d0                	add    %edx,%eax
+     9e6:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     9e9:	75 13                	jne    9fe <put+0x5a>
+      v->iov_len += n;
+     9eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9ee:	8b 50 04             	mov    0x4(%eax),%edx
+     9f1:	8b 45 10             	mov    0x10(%ebp),%eax
+     9f4:	01 c2                	add    %eax,%edx
+     9f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9f9:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     9fc:	eb 4b                	jmp    a49 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     9fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     a01:	8b 40 04             	mov    0x4(%eax),%eax
+     a04:	83 f8 10             	cmp    $0x10,%eax
+     a07:	75 0e                	jne    a17 <put+0x73>
+    flush(o);
+     a09:	83 ec 0c             	sub    $0xc,%esp
+     a0c:	ff 75 08             	push   0x8(%ebp)
+     a0f:	e8 47 ff ff ff       	call   95b <flush>
+     a14:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     a17:	8b 45 08             	mov    0x8(%ebp),%eax
+     a1a:	8b 50 04             	mov    0x4(%eax),%edx
+     a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     a20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     a23:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     a27:	8b 45 08             	mov    0x8(%ebp),%eax
+     a2a:	8b 50 04             	mov    0x4(%eax),%edx
+     a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+     a30:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a33:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     a37:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3a:	8b 40 04             	mov    0x4(%eax),%eax
+     a3d:	8d 50 01             	lea    0x1(%eax),%edx
+     a40:	8b 45 08             	mov    0x8(%ebp),%eax
+     a43:	89 50 04             	mov    %edx,0x4(%eax)
+     a46:	eb 01                	jmp    a49 <put+0xa5>
+    return;
+     a48:	90                   	nop
+}
+     a49:	c9                   	leave
+     a4a:	c3                   	ret
+
+00000a4b <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     a4b:	55                   	push   %ebp
+     a4c:	89 e5                	mov    %esp,%ebp
+     a4e:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     a51:	8b 45 08             	mov    0x8(%ebp),%eax
+     a54:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a5d:	01 d0                	add    %edx,%eax
+     a5f:	3d 80 00 00 00       	cmp    $0x80,%eax
+     a64:	77 0b                	ja     a71 <room+0x26>
+     a66:	8b 45 08             	mov    0x8(%ebp),%eax
+     a69:	8b 40 04             	mov    0x4(%eax),%eax
+     a6c:	83 f8 10             	cmp    $0x10,%eax
+     a6f:	75 0e                	jne    a7f <room+0x34>
+    flush(o);
+     a71:	83 ec 0c             	sub    $0xc,%esp
+     a74:	ff 75 08             	push   0x8(%ebp)
+     a77:	e8 df fe ff ff       	call   95b <flush>
+     a7c:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+     a82:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     a88:	8b 45 08             	mov    0x8(%ebp),%eax
+     a8b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     a91:	01 d0                	add    %edx,%eax
+}
+     a93:	c9                   	leave
+     a94:	c3                   	ret
+
+00000a95 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     a95:	55                   	push   %ebp
+     a96:	89 e5                	mov    %esp,%ebp
+     a98:	83 ec 28             	sub    $0x28,%esp
+     a9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a9e:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     aa1:	83 ec 08             	sub    $0x8,%esp
+     aa4:	6a 01                	push   $0x1
+     aa6:	ff 75 08             	push   0x8(%ebp)
+     aa9:	e8 9d ff ff ff       	call   a4b <room>
+     aae:	83 c4 10             	add    $0x10,%esp
+     ab1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ab7:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     abb:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     abd:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     ac6:	8d 50 01             	lea    0x1(%eax),%edx
+     ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+     acc:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     ad2:	83 ec 04             	sub    $0x4,%esp
+     ad5:	6a 01                	push   $0x1
+     ad7:	ff 75 f4             	push   -0xc(%ebp)
+     ada:	ff 75 08             	push   0x8(%ebp)
+     add:	e8 c2 fe ff ff       	call   9a4 <put>
+     ae2:	83 c4 10             	add    $0x10,%esp
+}
+     ae5:	90                   	nop
+     ae6:	c9                   	leave
+     ae7:	c3                   	ret
+
+00000ae8 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     ae8:	55                   	push   %ebp
+     ae9:	89 e5                	mov    %esp,%ebp
+     aeb:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     aee:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     af5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     af9:	74 17                	je     b12 <printint+0x2a>
+     afb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     aff:	79 11                	jns    b12 <printint+0x2a>
+    neg = 1;
+     b01:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b0b:	f7 d8                	neg    %eax
+     b0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b10:	eb 06                	jmp    b18 <printint+0x30>
+  } else {
+    x = xx;
+     b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b15:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b18:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b1f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b22:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b25:	ba 00 00 00 00       	mov    $0x0,%edx
+     b2a:	f7 f1                	div    %ecx
+     b2c:	89 d1                	mov    %edx,%ecx
+     b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b31:	8d 50 01             	lea    0x1(%eax),%edx
+     b34:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b37:	0f b6 91 88 17 00 00 	movzbl 0x1788(%ecx),%edx
+     b3e:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     b42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b45:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b48:	ba 00 00 00 00       	mov    $0x0,%edx
+     b4d:	f7 f1                	div    %ecx
+     b4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b52:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b56:	75 c7                	jne    b1f <printint+0x37>
+  if(neg)
+     b58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b5c:	74 0e                	je     b6c <printint+0x84>
+    buf[i++] = '-';
+     b5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b61:	8d 50 01             	lea    0x1(%eax),%edx
+     b64:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b67:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b6f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     b72:	83 ec 08             	sub    $0x8,%esp
+     b75:	ff 75 e8             	push   -0x18(%ebp)
+     b78:	ff 75 08             	push   0x8(%ebp)
+     b7b:	e8 cb fe ff ff       	call   a4b <room>
+     b80:	83 c4 10             	add    $0x10,%esp
+     b83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     b86:	eb 1d                	jmp    ba5 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     b88:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b8b:	83 e8 01             	sub    $0x1,%eax
+     b8e:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     b91:	89 c2                	mov    %eax,%edx
+     b93:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b96:	01 c2                	add    %eax,%edx
+     b98:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     b9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b9e:	01 c8                	add    %ecx,%eax
+     ba0:	0f b6 00             	movzbl (%eax),%eax
+     ba3:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     ba5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     ba9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bad:	79 d9                	jns    b88 <printint+0xa0>
+  o->used += n;
+     baf:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb2:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     bb8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     bbb:	01 c2                	add    %eax,%edx
+     bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc0:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     bc6:	83 ec 04             	sub    $0x4,%esp
+     bc9:	ff 75 e8             	push   -0x18(%ebp)
+     bcc:	ff 75 e4             	push   -0x1c(%ebp)
+     bcf:	ff 75 08             	push   0x8(%ebp)
+     bd2:	e8 cd fd ff ff       	call   9a4 <put>
+     bd7:	83 c4 10             	add    $0x10,%esp
+}
+     bda:	90                   	nop
+     bdb:	c9                   	leave
+     bdc:	c3                   	ret
+
+00000bdd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     bdd:	55                   	push   %ebp
+     bde:	89 e5                	mov    %esp,%ebp
+     be0:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     be6:	8b 45 08             	mov    0x8(%ebp),%eax
+     be9:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     bef:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     bf6:	00 00 00 
+  o.used = 0;
+     bf9:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     c00:	00 00 00 
+  state = 0;
+     c03:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     c0a:	8d 45 0c             	lea    0xc(%ebp),%eax
+     c0d:	83 c0 04             	add    $0x4,%eax
+     c10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     c13:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c1a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     c21:	e9 82 01 00 00       	jmp    da8 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c2c:	01 d0                	add    %edx,%eax
+     c2e:	0f b6 00             	movzbl (%eax),%eax
+     c31:	0f be c0             	movsbl %al,%eax
+     c34:	25 ff 00 00 00       	and    $0xff,%eax
+     c39:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     c3c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     c40:	75 38                	jne    c7a <printf+0x9d>
+      if(c == '%'){
+     c42:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     c46:	0f 85 58 01 00 00    	jne    da4 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     c4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c4f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c55:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     c58:	01 ca                	add    %ecx,%edx
+     c5a:	83 ec 04             	sub    $0x4,%esp
+     c5d:	50                   	push   %eax
+     c5e:	52                   	push   %edx
+     c5f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c65:	50                   	push   %eax
+     c66:	e8 39 fd ff ff       	call   9a4 <put>
+     c6b:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     c6e:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     c75:	e9 2a 01 00 00       	jmp    da4 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     c7a:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     c7e:	0f 85 20 01 00 00    	jne    da4 <printf+0x1c7>
+      if(c == 'd'){
+     c84:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     c88:	75 22                	jne    cac <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     c8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c8d:	8b 00                	mov    (%eax),%eax
+     c8f:	6a 01                	push   $0x1
+     c91:	6a 0a                	push   $0xa
+     c93:	50                   	push   %eax
+     c94:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c9a:	50                   	push   %eax
+     c9b:	e8 48 fe ff ff       	call   ae8 <printint>
+     ca0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ca3:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     ca7:	e9 e8 00 00 00       	jmp    d94 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     cac:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     cb0:	74 06                	je     cb8 <printf+0xdb>
+     cb2:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     cb6:	75 22                	jne    cda <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     cb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     cbb:	8b 00                	mov    (%eax),%eax
+     cbd:	6a 00                	push   $0x0
+     cbf:	6a 10                	push   $0x10
+     cc1:	50                   	push   %eax
+     cc2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cc8:	50                   	push   %eax
+     cc9:	e8 1a fe ff ff       	call   ae8 <printint>
+     cce:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cd1:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     cd5:	e9 ba 00 00 00       	jmp    d94 <printf+0x1b7>
+      } else if(c == 's'){
+     cda:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     cde:	75 3f                	jne    d1f <printf+0x142>
+        s = (char*)*ap;
+     ce0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ce3:	8b 00                	mov    (%eax),%eax
+     ce5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     ce8:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     cec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     cf0:	75 07                	jne    cf9 <printf+0x11c>
+          s = "(null)";
+     cf2:	c7 45 f4 b0 13 00 00 	movl   $0x13b0,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     cf9:	83 ec 0c             	sub    $0xc,%esp
+     cfc:	ff 75 f4             	push   -0xc(%ebp)
+     cff:	e8 47 f8 ff ff       	call   54b <strlen>
+     d04:	83 c4 10             	add    $0x10,%esp
+     d07:	83 ec 04             	sub    $0x4,%esp
+     d0a:	50                   	push   %eax
+     d0b:	ff 75 f4             	push   -0xc(%ebp)
+     d0e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d14:	50                   	push   %eax
+     d15:	e8 8a fc ff ff       	call   9a4 <put>
+     d1a:	83 c4 10             	add    $0x10,%esp
+     d1d:	eb 75                	jmp    d94 <printf+0x1b7>
+      } else if(c == 'c'){
+     d1f:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     d23:	75 21                	jne    d46 <printf+0x169>
+        putc(&o, *ap);
+     d25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d28:	8b 00                	mov    (%eax),%eax
+     d2a:	0f be c0             	movsbl %al,%eax
+     d2d:	83 ec 08             	sub    $0x8,%esp
+     d30:	50                   	push   %eax
+     d31:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d37:	50                   	push   %eax
+     d38:	e8 58 fd ff ff       	call   a95 <putc>
+     d3d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d40:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     d44:	eb 4e                	jmp    d94 <printf+0x1b7>
+      } else if(c == '%'){
+     d46:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     d4a:	75 1b                	jne    d67 <printf+0x18a>
+        putc(&o, c);
+     d4c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d4f:	0f be c0             	movsbl %al,%eax
+     d52:	83 ec 08             	sub    $0x8,%esp
+     d55:	50                   	push   %eax
+     d56:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d5c:	50                   	push   %eax
+     d5d:	e8 33 fd ff ff       	call   a95 <putc>
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	eb 2d                	jmp    d94 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     d67:	83 ec 08             	sub    $0x8,%esp
+     d6a:	6a 25                	push   $0x25
+     d6c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d72:	50                   	push   %eax
+     d73:	e8 1d fd ff ff       	call   a95 <putc>
+     d78:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     d7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d7e:	0f be c0             	movsbl %al,%eax
+     d81:	83 ec 08             	sub    $0x8,%esp
+     d84:	50                   	push   %eax
+     d85:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d8b:	50                   	push   %eax
+     d8c:	e8 04 fd ff ff       	call   a95 <putc>
+     d91:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     d94:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     d9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d9e:	83 c0 01             	add    $0x1,%eax
+     da1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     da4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     da8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     dab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dae:	01 d0                	add    %edx,%eax
+     db0:	0f b6 00             	movzbl (%eax),%eax
+     db3:	84 c0                	test   %al,%al
+     db5:	0f 85 6b fe ff ff    	jne    c26 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     dbb:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     dbf:	75 22                	jne    de3 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     dc1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dc4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     dca:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     dcd:	01 ca                	add    %ecx,%edx
+     dcf:	83 ec 04             	sub    $0x4,%esp
+     dd2:	50                   	push   %eax
+     dd3:	52                   	push   %edx
+     dd4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     dda:	50                   	push   %eax
+     ddb:	e8 c4 fb ff ff       	call   9a4 <put>
+     de0:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     de3:	83 ec 0c             	sub    $0xc,%esp
+     de6:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     dec:	50                   	push   %eax
+     ded:	e8 69 fb ff ff       	call   95b <flush>
+     df2:	83 c4 10             	add    $0x10,%esp
+}
+     df5:	90                   	nop
+     df6:	c9                   	leave
+     df7:	c3                   	ret
+
+00000df8 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     df8:	55                   	push   %ebp
+     df9:	89 e5                	mov    %esp,%ebp
+     dfb:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     dfe:	8b 55 08             	mov    0x8(%ebp),%edx
+     e01:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e07:	f0 87 02             	lock xchg %eax,(%edx)
+     e0a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     e0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     e10:	c9                   	leave
+     e11:	c3                   	ret
+
+00000e12 <lock>:
+{
+     e12:	55                   	push   %ebp
+     e13:	89 e5                	mov    %esp,%ebp
+     e15:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     e18:	a1 a0 1b 00 00       	mov    0x1ba0,%eax
+     e1d:	85 c0                	test   %eax,%eax
+     e1f:	74 09                	je     e2a <lock+0x18>
+     e21:	a1 a0 1b 00 00       	mov    0x1ba0,%eax
+     e26:	ff d0                	call   *%eax
+     e28:	eb 05                	jmp    e2f <lock+0x1d>
+     e2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     e32:	90                   	nop
+     e33:	83 ec 08             	sub    $0x8,%esp
+     e36:	6a 01                	push   $0x1
+     e38:	68 d8 1b 00 00       	push   $0x1bd8
+     e3d:	e8 b6 ff ff ff       	call   df8 <xchg>
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	85 c0                	test   %eax,%eax
+     e47:	75 ea                	jne    e33 <lock+0x21>
+  return pin;
+     e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e4c:	c9                   	leave
+     e4d:	c3                   	ret
+
+00000e4e <unlock>:
+{
+     e4e:	55                   	push   %ebp
+     e4f:	89 e5                	mov    %esp,%ebp
+     e51:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     e54:	6a 00                	push   $0x0
+     e56:	68 d8 1b 00 00       	push   $0x1bd8
+     e5b:	e8 98 ff ff ff       	call   df8 <xchg>
+     e60:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     e63:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     e67:	78 10                	js     e79 <unlock+0x2b>
+    mallocunpin(pin);
+     e69:	a1 a4 1b 00 00       	mov    0x1ba4,%eax
+     e6e:	83 ec 0c             	sub    $0xc,%esp
+     e71:	ff 75 08             	push   0x8(%ebp)
+     e74:	ff d0                	call   *%eax
+     e76:	83 c4 10             	add    $0x10,%esp
+}
+     e79:	90                   	nop
+     e7a:	c9                   	leave
+     e7b:	c3                   	ret
+
+00000e7c <sizeclass>:
+{
+     e7c:	55                   	push   %ebp
+     e7d:	89 e5                	mov    %esp,%ebp
+     e7f:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     e82:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     e89:	eb 1c                	jmp    ea7 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     e8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e8e:	ba 02 00 00 00       	mov    $0x2,%edx
+     e93:	89 c1                	mov    %eax,%ecx
+     e95:	d3 e2                	shl    %cl,%edx
+     e97:	89 d0                	mov    %edx,%eax
+     e99:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e9c:	72 05                	jb     ea3 <sizeclass+0x27>
+      return c;
+     e9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ea1:	eb 0f                	jmp    eb2 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     ea3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     ea7:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     eab:	7e de                	jle    e8b <sizeclass+0xf>
+  return -1;
+     ead:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     eb2:	c9                   	leave
+     eb3:	c3                   	ret
+
+00000eb4 <bigfree>:
+{
+     eb4:	55                   	push   %ebp
+     eb5:	89 e5                	mov    %esp,%ebp
+     eb7:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eba:	a1 b0 1b 00 00       	mov    0x1bb0,%eax
+     ebf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ec2:	eb 24                	jmp    ee8 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ec4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ec7:	8b 00                	mov    (%eax),%eax
+     ec9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ecc:	72 12                	jb     ee0 <bigfree+0x2c>
+     ece:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ed4:	72 24                	jb     efa <bigfree+0x46>
+     ed6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ed9:	8b 00                	mov    (%eax),%eax
+     edb:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ede:	72 1a                	jb     efa <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ee0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee3:	8b 00                	mov    (%eax),%eax
+     ee5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+     eeb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     eee:	73 d4                	jae    ec4 <bigfree+0x10>
+     ef0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef3:	8b 00                	mov    (%eax),%eax
+     ef5:	39 45 08             	cmp    %eax,0x8(%ebp)
+     ef8:	73 ca                	jae    ec4 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     efa:	8b 45 08             	mov    0x8(%ebp),%eax
+     efd:	8b 40 04             	mov    0x4(%eax),%eax
+     f00:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f07:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0a:	01 c2                	add    %eax,%edx
+     f0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f0f:	8b 00                	mov    (%eax),%eax
+     f11:	39 c2                	cmp    %eax,%edx
+     f13:	75 24                	jne    f39 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     f15:	8b 45 08             	mov    0x8(%ebp),%eax
+     f18:	8b 50 04             	mov    0x4(%eax),%edx
+     f1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f1e:	8b 00                	mov    (%eax),%eax
+     f20:	8b 40 04             	mov    0x4(%eax),%eax
+     f23:	01 c2                	add    %eax,%edx
+     f25:	8b 45 08             	mov    0x8(%ebp),%eax
+     f28:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f2e:	8b 00                	mov    (%eax),%eax
+     f30:	8b 10                	mov    (%eax),%edx
+     f32:	8b 45 08             	mov    0x8(%ebp),%eax
+     f35:	89 10                	mov    %edx,(%eax)
+     f37:	eb 0a                	jmp    f43 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     f39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f3c:	8b 10                	mov    (%eax),%edx
+     f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f41:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     f43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f46:	8b 40 04             	mov    0x4(%eax),%eax
+     f49:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f53:	01 d0                	add    %edx,%eax
+     f55:	39 45 08             	cmp    %eax,0x8(%ebp)
+     f58:	75 20                	jne    f7a <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     f5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f5d:	8b 50 04             	mov    0x4(%eax),%edx
+     f60:	8b 45 08             	mov    0x8(%ebp),%eax
+     f63:	8b 40 04             	mov    0x4(%eax),%eax
+     f66:	01 c2                	add    %eax,%edx
+     f68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f6b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f71:	8b 10                	mov    (%eax),%edx
+     f73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f76:	89 10                	mov    %edx,(%eax)
+     f78:	eb 08                	jmp    f82 <bigfree+0xce>
+    p->s.ptr = bp;
+     f7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+     f80:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     f82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f85:	a3 b0 1b 00 00       	mov    %eax,0x1bb0
+}
+     f8a:	90                   	nop
+     f8b:	c9                   	leave
+     f8c:	c3                   	ret
+
+00000f8d <free>:
+{
+     f8d:	55                   	push   %ebp
+     f8e:	89 e5                	mov    %esp,%ebp
+     f90:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     f93:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f97:	74 68                	je     1001 <free+0x74>
+  bp = (Header*)ap - 1;
+     f99:	8b 45 08             	mov    0x8(%ebp),%eax
+     f9c:	83 e8 08             	sub    $0x8,%eax
+     f9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     fa2:	e8 6b fe ff ff       	call   e12 <lock>
+     fa7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     faa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fad:	8b 40 04             	mov    0x4(%eax),%eax
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	50                   	push   %eax
+     fb4:	e8 c3 fe ff ff       	call   e7c <sizeclass>
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     fbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     fc3:	78 1e                	js     fe3 <free+0x56>
+    bp->s.ptr = classfree[c];
+     fc5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc8:	8b 14 85 b4 1b 00 00 	mov    0x1bb4(,%eax,4),%edx
+     fcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd2:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     fd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fd7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fda:	89 14 85 b4 1b 00 00 	mov    %edx,0x1bb4(,%eax,4)
+     fe1:	eb 0e                	jmp    ff1 <free+0x64>
+    bigfree(bp);
+     fe3:	83 ec 0c             	sub    $0xc,%esp
+     fe6:	ff 75 f4             	push   -0xc(%ebp)
+     fe9:	e8 c6 fe ff ff       	call   eb4 <bigfree>
+     fee:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     ff1:	83 ec 0c             	sub    $0xc,%esp
+     ff4:	ff 75 f0             	push   -0x10(%ebp)
+     ff7:	e8 52 fe ff ff       	call   e4e <unlock>
+     ffc:	83 c4 10             	add    $0x10,%esp
+     fff:	eb 01                	jmp    1002 <free+0x75>
+    return;
+    1001:	90                   	nop
+}
+    1002:	c9                   	leave
+    1003:	c3                   	ret
+
+00001004 <morecore>:
+{
+    1004:	55                   	push   %ebp
+    1005:	89 e5                	mov    %esp,%ebp
+    1007:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+    100a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1011:	77 07                	ja     101a <morecore+0x16>
+    nu = 4096;
+    1013:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    101a:	8b 45 08             	mov    0x8(%ebp),%eax
+    101d:	c1 e0 03             	shl    $0x3,%eax
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	50                   	push   %eax
+    1024:	e8 b6 f7 ff ff       	call   7df <sbrk>
+    1029:	83 c4 10             	add    $0x10,%esp
+    102c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    102f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1033:	75 07                	jne    103c <morecore+0x38>
+    return 0;
+    1035:	b8 00 00 00 00       	mov    $0x0,%eax
+    103a:	eb 22                	jmp    105e <morecore+0x5a>
+  hp = (Header*)p;
+    103c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    1042:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1045:	8b 55 08             	mov    0x8(%ebp),%edx
+    1048:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+    104b:	83 ec 0c             	sub    $0xc,%esp
+    104e:	ff 75 f0             	push   -0x10(%ebp)
+    1051:	e8 5e fe ff ff       	call   eb4 <bigfree>
+    1056:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1059:	a1 b0 1b 00 00       	mov    0x1bb0,%eax
+}
+    105e:	c9                   	leave
+    105f:	c3                   	ret
+
+00001060 <bigalloc>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+    1066:	a1 b0 1b 00 00       	mov    0x1bb0,%eax
+    106b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    106e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1072:	75 23                	jne    1097 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+    1074:	c7 45 f0 a8 1b 00 00 	movl   $0x1ba8,-0x10(%ebp)
+    107b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    107e:	a3 b0 1b 00 00       	mov    %eax,0x1bb0
+    1083:	a1 b0 1b 00 00       	mov    0x1bb0,%eax
+    1088:	a3 a8 1b 00 00       	mov    %eax,0x1ba8
+    base.s.size = 0;
+    108d:	c7 05 ac 1b 00 00 00 	movl   $0x0,0x1bac
+    1094:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1097:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    109a:	8b 00                	mov    (%eax),%eax
+    109c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    109f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a2:	8b 40 04             	mov    0x4(%eax),%eax
+    10a5:	3b 45 08             	cmp    0x8(%ebp),%eax
+    10a8:	72 4a                	jb     10f4 <bigalloc+0x94>
+      if(p->s.size == nunits)
+    10aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ad:	8b 40 04             	mov    0x4(%eax),%eax
+    10b0:	39 45 08             	cmp    %eax,0x8(%ebp)
+    10b3:	75 0c                	jne    10c1 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+    10b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b8:	8b 10                	mov    (%eax),%edx
+    10ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10bd:	89 10                	mov    %edx,(%eax)
+    10bf:	eb 26                	jmp    10e7 <bigalloc+0x87>
+        p->s.size -= nunits;
+    10c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c4:	8b 40 04             	mov    0x4(%eax),%eax
+    10c7:	2b 45 08             	sub    0x8(%ebp),%eax
+    10ca:	89 c2                	mov    %eax,%edx
+    10cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10cf:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    10d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d5:	8b 40 04             	mov    0x4(%eax),%eax
+    10d8:	c1 e0 03             	shl    $0x3,%eax
+    10db:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    10de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e1:	8b 55 08             	mov    0x8(%ebp),%edx
+    10e4:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    10e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10ea:	a3 b0 1b 00 00       	mov    %eax,0x1bb0
+      return p;
+    10ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10f2:	eb 3b                	jmp    112f <bigalloc+0xcf>
+    if(p == freep)
+    10f4:	a1 b0 1b 00 00       	mov    0x1bb0,%eax
+    10f9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    10fc:	75 1e                	jne    111c <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    10fe:	83 ec 0c             	sub    $0xc,%esp
+    1101:	ff 75 08             	push   0x8(%ebp)
+    1104:	e8 fb fe ff ff       	call   1004 <morecore>
+    1109:	83 c4 10             	add    $0x10,%esp
+    110c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    110f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1113:	75 07                	jne    111c <bigalloc+0xbc>
+        return 0;
+    1115:	b8 00 00 00 00       	mov    $0x0,%eax
+    111a:	eb 13                	jmp    112f <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    111c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    111f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1125:	8b 00                	mov    (%eax),%eax
+    1127:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    112a:	e9 70 ff ff ff       	jmp    109f <bigalloc+0x3f>
+}
+    112f:	c9                   	leave
+    1130:	c3                   	ret
+
+00001131 <alloc>:
+alloc(uint nbytes)
+{
+    1131:	55                   	push   %ebp
+    1132:	89 e5                	mov    %esp,%ebp
+    1134:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1137:	8b 45 08             	mov    0x8(%ebp),%eax
+    113a:	83 c0 07             	add    $0x7,%eax
+    113d:	c1 e8 03             	shr    $0x3,%eax
+    1140:	83 c0 01             	add    $0x1,%eax
+    1143:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    1146:	ff 75 f4             	push   -0xc(%ebp)
+    1149:	e8 2e fd ff ff       	call   e7c <sizeclass>
+    114e:	83 c4 04             	add    $0x4,%esp
+    1151:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1154:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1158:	79 2c                	jns    1186 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    115a:	83 ec 0c             	sub    $0xc,%esp
+    115d:	ff 75 f4             	push   -0xc(%ebp)
+    1160:	e8 fb fe ff ff       	call   1060 <bigalloc>
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    116b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    116f:	75 0a                	jne    117b <alloc+0x4a>
+      return 0;
+    1171:	b8 00 00 00 00       	mov    $0x0,%eax
+    1176:	e9 c8 00 00 00       	jmp    1243 <alloc+0x112>
+    return (void*)(p + 1);
+    117b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    117e:	83 c0 08             	add    $0x8,%eax
+    1181:	e9 bd 00 00 00       	jmp    1243 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    1186:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1189:	8b 04 85 b4 1b 00 00 	mov    0x1bb4(,%eax,4),%eax
+    1190:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1193:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1197:	74 1a                	je     11b3 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    1199:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    119c:	8b 10                	mov    (%eax),%edx
+    119e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11a1:	89 14 85 b4 1b 00 00 	mov    %edx,0x1bb4(,%eax,4)
+    return (void*)(p + 1);
+    11a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11ab:	83 c0 08             	add    $0x8,%eax
+    11ae:	e9 90 00 00 00       	jmp    1243 <alloc+0x112>
+  }
+  nunits = 2 << c;
+    11b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11b6:	ba 02 00 00 00       	mov    $0x2,%edx
+    11bb:	89 c1                	mov    %eax,%ecx
+    11bd:	d3 e2                	shl    %cl,%edx
+    11bf:	89 d0                	mov    %edx,%eax
+    11c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    11c4:	a1 d0 1b 00 00       	mov    0x1bd0,%eax
+    11c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11cc:	c1 e2 03             	shl    $0x3,%edx
+    11cf:	01 d0                	add    %edx,%eax
+    11d1:	8b 15 d4 1b 00 00    	mov    0x1bd4,%edx
+    11d7:	39 c2                	cmp    %eax,%edx
+    11d9:	73 3f                	jae    121a <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    11db:	83 ec 0c             	sub    $0xc,%esp
+    11de:	68 00 08 00 00       	push   $0x800
+    11e3:	e8 78 fe ff ff       	call   1060 <bigalloc>
+    11e8:	83 c4 10             	add    $0x10,%esp
+    11eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11f2:	75 07                	jne    11fb <alloc+0xca>
+      return 0;
+    11f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    11f9:	eb 48                	jmp    1243 <alloc+0x112>
+    bump = (char*)p;
+    11fb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11fe:	a3 d0 1b 00 00       	mov    %eax,0x1bd0
+    bumpend = (char*)(p + p->s.size);
+    1203:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1206:	8b 40 04             	mov    0x4(%eax),%eax
+    1209:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1210:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1213:	01 d0                	add    %edx,%eax
+    1215:	a3 d4 1b 00 00       	mov    %eax,0x1bd4
+  }
+  p = (Header*)bump;
+    121a:	a1 d0 1b 00 00       	mov    0x1bd0,%eax
+    121f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    1222:	a1 d0 1b 00 00       	mov    0x1bd0,%eax
+    1227:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    122a:	c1 e2 03             	shl    $0x3,%edx
+    122d:	01 d0                	add    %edx,%eax
+    122f:	a3 d0 1b 00 00       	mov    %eax,0x1bd0
+  p->s.size = nunits;
+    1234:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1237:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    123a:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    123d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1240:	83 c0 08             	add    $0x8,%eax
+}
+    1243:	c9                   	leave
+    1244:	c3                   	ret
+
+00001245 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1245:	55                   	push   %ebp
+    1246:	89 e5                	mov    %esp,%ebp
+    1248:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    124b:	e8 c2 fb ff ff       	call   e12 <lock>
+    1250:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    1253:	83 ec 0c             	sub    $0xc,%esp
+    1256:	ff 75 08             	push   0x8(%ebp)
+    1259:	e8 d3 fe ff ff       	call   1131 <alloc>
+    125e:	83 c4 10             	add    $0x10,%esp
+    1261:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    1264:	83 ec 0c             	sub    $0xc,%esp
+    1267:	ff 75 f4             	push   -0xc(%ebp)
+    126a:	e8 df fb ff ff       	call   e4e <unlock>
+    126f:	83 c4 10             	add    $0x10,%esp
+  return p;
+    1272:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1275:	c9                   	leave
+    1276:	c3                   	ret
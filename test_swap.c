@@ -0,0 +1,118 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Runs more memory than there is free, in NCHILD processes at
+// once, and checks that each gets its own pages back and that some
+// went out to swap.  The excess must fit in swap space, so build
+// with a small MEMMB (make MEMMB=16) or boot with mem=16.
+
+#define PGSIZE 4096
+#define NCHILD 4
+#define NPASS  3
+
+char buf[1024];
+
+// The value on the line for name in /stats file path, or -1.
+static int
+statval(char *path, char *name)
+{
+  int fd, n, i;
+  char *p;
+
+  if((fd = open(path, O_RDONLY)) < 0)
+    return -1;
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if(n <= 0)
+    return -1;
+  buf[n] = 0;
+  for(p = buf; p; ){
+    for(i = 0; name[i] && p[i] == name[i]; i++)
+      ;
+    if(name[i] == 0 && p[i] == ' '){
+      while(p[i] == ' ')
+        i++;
+      return atoi(p + i);
+    }
+    if((p = strchr(p, '\n')) != 0)
+      p++;
+  }
+  return -1;
+}
+
+// Fill npage pages with words naming child c and the page, then
+// read them back, over and over.
+static int
+child(int c, int npage)
+{
+  uint *p;
+  int i, j, pass;
+
+  if((p = (uint*)sbrk(npage * PGSIZE)) == (uint*)-1)
+    return 0;
+  for(i = 0; i < npage; i++)
+    for(j = 0; j < PGSIZE/4; j += 128)
+      p[i*PGSIZE/4 + j] = c << 24 | i << 8 | j / 128;
+  for(pass = 0; pass < NPASS; pass++)
+    for(i = 0; i < npage; i++)
+      for(j = 0; j < PGSIZE/4; j += 128)
+        if(p[i*PGSIZE/4 + j] != (c << 24 | i << 8 | j / 128))
+          return 0;
+  return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nfree, nswap, nout, npage, fds[2], i, ok;
+  char c;
+
+  nfree = statval("/stats/kmem", "free");
+  nswap = statval("/stats/swap", "free");
+  if(nfree < 0 || nswap < 0){
+    printf(1, "error: cannot read /stats\n");
+    exit();
+  }
+  if(nswap < nfree / 2){
+    printf(1, "error: %d free pages but %d of swap; build with MEMMB=16\n",
+           nfree, nswap);
+    exit();
+  }
+  nout = statval("/stats/swap", "pageouts");
+
+  // A quarter more than is free.
+  npage = (nfree + nfree / 4) / NCHILD;
+  if(pipe(fds) < 0){
+    printf(1, "error: pipe\n");
+    exit();
+  }
+  for(i = 0; i < NCHILD; i++){
+    if(fork() == 0){
+      c = child(i, npage) ? 'y' : 'n';
+      write(fds[1], &c, 1);
+      exit();
+    }
+  }
+  close(fds[1]);
+  ok = 0;
+  while(read(fds[0], &c, 1) == 1)
+    ok += c == 'y';
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  if(ok != NCHILD){
+    printf(1, "error: %d of %d processes lost memory\n", NCHILD - ok, NCHILD);
+    exit();
+  }
+  if(statval("/stats/swap", "pageouts") <= nout){
+    printf(1, "error: %d pages in %d processes, %d free, but no pageouts\n",
+           npage * NCHILD, NCHILD, nfree);
+    exit();
+  }
+  printf(1, "%d pages in %d processes, %d free: swap ok\n",
+         npage * NCHILD, NCHILD, nfree);
+  printf(1, "pageouts %d pageins %d\n", statval("/stats/swap", "pageouts"),
+         statval("/stats/swap", "pageins"));
+  exit();
+}
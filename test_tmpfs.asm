@@ -0,0 +1,2127 @@
+
+_test_tmpfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <same>:
+
+static char buf[SIZE], buf2[SIZE];
+
+static int
+same(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < SIZE; i++)
+       6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+       d:	eb 25                	jmp    34 <same+0x34>
+    if(buf[i] != buf2[i])
+       f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      12:	05 a0 16 00 00       	add    $0x16a0,%eax
+      17:	0f b6 10             	movzbl (%eax),%edx
+      1a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      1d:	05 c0 3d 00 00       	add    $0x3dc0,%eax
+      22:	0f b6 00             	movzbl (%eax),%eax
+      25:	38 c2                	cmp    %al,%dl
+      27:	74 07                	je     30 <same+0x30>
+      return 0;
+      29:	b8 00 00 00 00       	mov    $0x0,%eax
+      2e:	eb 12                	jmp    42 <same+0x42>
+  for(i = 0; i < SIZE; i++)
+      30:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+      34:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%ebp)
+      3b:	7e d2                	jle    f <same+0xf>
+  return 1;
+      3d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      42:	c9                   	leave
+      43:	c3                   	ret
+
+00000044 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      44:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      48:	83 e4 f0             	and    $0xfffffff0,%esp
+      4b:	ff 71 fc             	push   -0x4(%ecx)
+      4e:	55                   	push   %ebp
+      4f:	89 e5                	mov    %esp,%ebp
+      51:	51                   	push   %ecx
+      52:	83 ec 34             	sub    $0x34,%esp
+  struct stat st, root;
+  int fd, i;
+
+  // init mounts a tmpfs on /tmp.
+  if(stat("/tmp", &st) < 0 || stat("/", &root) < 0 || st.dev == root.dev){
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	8d 45 dc             	lea    -0x24(%ebp),%eax
+      5b:	50                   	push   %eax
+      5c:	68 b0 11 00 00       	push   $0x11b0
+      61:	e8 00 05 00 00       	call   566 <stat>
+      66:	83 c4 10             	add    $0x10,%esp
+      69:	85 c0                	test   %eax,%eax
+      6b:	78 22                	js     8f <main+0x4b>
+      6d:	83 ec 08             	sub    $0x8,%esp
+      70:	8d 45 c8             	lea    -0x38(%ebp),%eax
+      73:	50                   	push   %eax
+      74:	68 b5 11 00 00       	push   $0x11b5
+      79:	e8 e8 04 00 00       	call   566 <stat>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	85 c0                	test   %eax,%eax
+      83:	78 0a                	js     8f <main+0x4b>
+      85:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      88:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      8b:	39 c2                	cmp    %eax,%edx
+      8d:	75 17                	jne    a6 <main+0x62>
+    printf(1, "error: /tmp is not mounted\n");
+      8f:	83 ec 08             	sub    $0x8,%esp
+      92:	68 b7 11 00 00       	push   $0x11b7
+      97:	6a 01                	push   $0x1
+      99:	e8 77 0a 00 00       	call   b15 <printf>
+      9e:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a1:	e8 df 05 00 00       	call   685 <exit>
+  }
+  if(mount("/tmp") >= 0 || unlink("/tmp") >= 0){
+      a6:	83 ec 0c             	sub    $0xc,%esp
+      a9:	68 b0 11 00 00       	push   $0x11b0
+      ae:	e8 86 07 00 00       	call   839 <mount>
+      b3:	83 c4 10             	add    $0x10,%esp
+      b6:	85 c0                	test   %eax,%eax
+      b8:	79 14                	jns    ce <main+0x8a>
+      ba:	83 ec 0c             	sub    $0xc,%esp
+      bd:	68 b0 11 00 00       	push   $0x11b0
+      c2:	e8 0a 06 00 00       	call   6d1 <unlink>
+      c7:	83 c4 10             	add    $0x10,%esp
+      ca:	85 c0                	test   %eax,%eax
+      cc:	78 17                	js     e5 <main+0xa1>
+    printf(1, "error: mount point not kept\n");
+      ce:	83 ec 08             	sub    $0x8,%esp
+      d1:	68 d3 11 00 00       	push   $0x11d3
+      d6:	6a 01                	push   $0x1
+      d8:	e8 38 0a 00 00       	call   b15 <printf>
+      dd:	83 c4 10             	add    $0x10,%esp
+    exit();
+      e0:	e8 a0 05 00 00       	call   685 <exit>
+  }
+
+  for(i = 0; i < SIZE; i++)
+      e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      ec:	eb 32                	jmp    120 <main+0xdc>
+    buf[i] = 'a' + i % 26;
+      ee:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      f1:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+      f6:	89 c8                	mov    %ecx,%eax
+      f8:	f7 ea                	imul   %edx
+      fa:	89 d0                	mov    %edx,%eax
+      fc:	c1 f8 03             	sar    $0x3,%eax
+      ff:	89 ca                	mov    %ecx,%edx
+     101:	c1 fa 1f             	sar    $0x1f,%edx
+     104:	29 d0                	sub    %edx,%eax
+     106:	6b d0 1a             	imul   $0x1a,%eax,%edx
+     109:	89 c8                	mov    %ecx,%eax
+     10b:	29 d0                	sub    %edx,%eax
+     10d:	83 c0 61             	add    $0x61,%eax
+     110:	89 c2                	mov    %eax,%edx
+     112:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     115:	05 a0 16 00 00       	add    $0x16a0,%eax
+     11a:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < SIZE; i++)
+     11c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     120:	81 7d f4 0f 27 00 00 	cmpl   $0x270f,-0xc(%ebp)
+     127:	7e c5                	jle    ee <main+0xaa>
+  if(mkdir("/tmp/d") < 0 || (fd = open("/tmp/d/f", O_CREATE | O_RDWR)) < 0){
+     129:	83 ec 0c             	sub    $0xc,%esp
+     12c:	68 f0 11 00 00       	push   $0x11f0
+     131:	e8 b9 05 00 00       	call   6ef <mkdir>
+     136:	83 c4 10             	add    $0x10,%esp
+     139:	85 c0                	test   %eax,%eax
+     13b:	78 1e                	js     15b <main+0x117>
+     13d:	83 ec 08             	sub    $0x8,%esp
+     140:	68 02 02 00 00       	push   $0x202
+     145:	68 f7 11 00 00       	push   $0x11f7
+     14a:	e8 6e 05 00 00       	call   6bd <open>
+     14f:	83 c4 10             	add    $0x10,%esp
+     152:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     155:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     159:	79 17                	jns    172 <main+0x12e>
+    printf(1, "error: create in /tmp\n");
+     15b:	83 ec 08             	sub    $0x8,%esp
+     15e:	68 00 12 00 00       	push   $0x1200
+     163:	6a 01                	push   $0x1
+     165:	e8 ab 09 00 00       	call   b15 <printf>
+     16a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     16d:	e8 13 05 00 00       	call   685 <exit>
+  }
+  if(write(fd, buf, SIZE) != SIZE || pread(fd, buf2, SIZE, 0) != SIZE || !same()){
+     172:	83 ec 04             	sub    $0x4,%esp
+     175:	68 10 27 00 00       	push   $0x2710
+     17a:	68 a0 16 00 00       	push   $0x16a0
+     17f:	ff 75 f0             	push   -0x10(%ebp)
+     182:	e8 1a 05 00 00       	call   6a1 <write>
+     187:	83 c4 10             	add    $0x10,%esp
+     18a:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     18f:	75 27                	jne    1b8 <main+0x174>
+     191:	6a 00                	push   $0x0
+     193:	68 10 27 00 00       	push   $0x2710
+     198:	68 c0 3d 00 00       	push   $0x3dc0
+     19d:	ff 75 f0             	push   -0x10(%ebp)
+     1a0:	e8 f4 05 00 00       	call   799 <pread>
+     1a5:	83 c4 10             	add    $0x10,%esp
+     1a8:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     1ad:	75 09                	jne    1b8 <main+0x174>
+     1af:	e8 4c fe ff ff       	call   0 <same>
+     1b4:	85 c0                	test   %eax,%eax
+     1b6:	75 17                	jne    1cf <main+0x18b>
+    printf(1, "error: write and read back\n");
+     1b8:	83 ec 08             	sub    $0x8,%esp
+     1bb:	68 17 12 00 00       	push   $0x1217
+     1c0:	6a 01                	push   $0x1
+     1c2:	e8 4e 09 00 00       	call   b15 <printf>
+     1c7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1ca:	e8 b6 04 00 00       	call   685 <exit>
+  }
+  if(fstat(fd, &st) < 0 || st.size != SIZE || st.dev == root.dev){
+     1cf:	83 ec 08             	sub    $0x8,%esp
+     1d2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     1d5:	50                   	push   %eax
+     1d6:	ff 75 f0             	push   -0x10(%ebp)
+     1d9:	e8 fd 04 00 00       	call   6db <fstat>
+     1de:	83 c4 10             	add    $0x10,%esp
+     1e1:	85 c0                	test   %eax,%eax
+     1e3:	78 14                	js     1f9 <main+0x1b5>
+     1e5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1e8:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     1ed:	75 0a                	jne    1f9 <main+0x1b5>
+     1ef:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     1f2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     1f5:	39 c2                	cmp    %eax,%edx
+     1f7:	75 17                	jne    210 <main+0x1cc>
+    printf(1, "error: fstat\n");
+     1f9:	83 ec 08             	sub    $0x8,%esp
+     1fc:	68 33 12 00 00       	push   $0x1233
+     201:	6a 01                	push   $0x1
+     203:	e8 0d 09 00 00       	call   b15 <printf>
+     208:	83 c4 10             	add    $0x10,%esp
+    exit();
+     20b:	e8 75 04 00 00       	call   685 <exit>
+  }
+  close(fd);
+     210:	83 ec 0c             	sub    $0xc,%esp
+     213:	ff 75 f0             	push   -0x10(%ebp)
+     216:	e8 8d 04 00 00       	call   6a8 <close>
+     21b:	83 c4 10             	add    $0x10,%esp
+  printf(1, "tmpfs files ok\n");
+     21e:	83 ec 08             	sub    $0x8,%esp
+     221:	68 41 12 00 00       	push   $0x1241
+     226:	6a 01                	push   $0x1
+     228:	e8 e8 08 00 00       	call   b15 <printf>
+     22d:	83 c4 10             	add    $0x10,%esp
+
+  // Names and ".." around the mount point.
+  if(chdir("/tmp/d") < 0 || stat("../d/f", &st) < 0 || st.size != SIZE ||
+     230:	83 ec 0c             	sub    $0xc,%esp
+     233:	68 f0 11 00 00       	push   $0x11f0
+     238:	e8 bc 04 00 00       	call   6f9 <chdir>
+     23d:	83 c4 10             	add    $0x10,%esp
+     240:	85 c0                	test   %eax,%eax
+     242:	78 4e                	js     292 <main+0x24e>
+     244:	83 ec 08             	sub    $0x8,%esp
+     247:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     24a:	50                   	push   %eax
+     24b:	68 51 12 00 00       	push   $0x1251
+     250:	e8 11 03 00 00       	call   566 <stat>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	78 36                	js     292 <main+0x24e>
+     25c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     25f:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     264:	75 2c                	jne    292 <main+0x24e>
+     stat("../..", &st) < 0 || st.dev != root.dev || st.ino != root.ino){
+     266:	83 ec 08             	sub    $0x8,%esp
+     269:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     26c:	50                   	push   %eax
+     26d:	68 58 12 00 00       	push   $0x1258
+     272:	e8 ef 02 00 00       	call   566 <stat>
+     277:	83 c4 10             	add    $0x10,%esp
+  if(chdir("/tmp/d") < 0 || stat("../d/f", &st) < 0 || st.size != SIZE ||
+     27a:	85 c0                	test   %eax,%eax
+     27c:	78 14                	js     292 <main+0x24e>
+     stat("../..", &st) < 0 || st.dev != root.dev || st.ino != root.ino){
+     27e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     281:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     284:	39 c2                	cmp    %eax,%edx
+     286:	75 0a                	jne    292 <main+0x24e>
+     288:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     28b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     28e:	39 c2                	cmp    %eax,%edx
+     290:	74 17                	je     2a9 <main+0x265>
+    printf(1, "error: paths\n");
+     292:	83 ec 08             	sub    $0x8,%esp
+     295:	68 5e 12 00 00       	push   $0x125e
+     29a:	6a 01                	push   $0x1
+     29c:	e8 74 08 00 00       	call   b15 <printf>
+     2a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2a4:	e8 dc 03 00 00       	call   685 <exit>
+  }
+  if(link("f", "g") < 0 || unlink("f") < 0 || (fd = open("g", O_RDONLY)) < 0 ||
+     2a9:	83 ec 08             	sub    $0x8,%esp
+     2ac:	68 6c 12 00 00       	push   $0x126c
+     2b1:	68 6e 12 00 00       	push   $0x126e
+     2b6:	e8 2a 04 00 00       	call   6e5 <link>
+     2bb:	83 c4 10             	add    $0x10,%esp
+     2be:	85 c0                	test   %eax,%eax
+     2c0:	78 57                	js     319 <main+0x2d5>
+     2c2:	83 ec 0c             	sub    $0xc,%esp
+     2c5:	68 6e 12 00 00       	push   $0x126e
+     2ca:	e8 02 04 00 00       	call   6d1 <unlink>
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	85 c0                	test   %eax,%eax
+     2d4:	78 43                	js     319 <main+0x2d5>
+     2d6:	83 ec 08             	sub    $0x8,%esp
+     2d9:	6a 00                	push   $0x0
+     2db:	68 6c 12 00 00       	push   $0x126c
+     2e0:	e8 d8 03 00 00       	call   6bd <open>
+     2e5:	83 c4 10             	add    $0x10,%esp
+     2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     2ef:	78 28                	js     319 <main+0x2d5>
+     read(fd, buf2, SIZE) != SIZE || !same()){
+     2f1:	83 ec 04             	sub    $0x4,%esp
+     2f4:	68 10 27 00 00       	push   $0x2710
+     2f9:	68 c0 3d 00 00       	push   $0x3dc0
+     2fe:	ff 75 f0             	push   -0x10(%ebp)
+     301:	e8 94 03 00 00       	call   69a <read>
+     306:	83 c4 10             	add    $0x10,%esp
+  if(link("f", "g") < 0 || unlink("f") < 0 || (fd = open("g", O_RDONLY)) < 0 ||
+     309:	3d 10 27 00 00       	cmp    $0x2710,%eax
+     30e:	75 09                	jne    319 <main+0x2d5>
+     read(fd, buf2, SIZE) != SIZE || !same()){
+     310:	e8 eb fc ff ff       	call   0 <same>
+     315:	85 c0                	test   %eax,%eax
+     317:	75 17                	jne    330 <main+0x2ec>
+    printf(1, "error: link and unlink\n");
+     319:	83 ec 08             	sub    $0x8,%esp
+     31c:	68 70 12 00 00       	push   $0x1270
+     321:	6a 01                	push   $0x1
+     323:	e8 ed 07 00 00       	call   b15 <printf>
+     328:	83 c4 10             	add    $0x10,%esp
+    exit();
+     32b:	e8 55 03 00 00       	call   685 <exit>
+  }
+  close(fd);
+     330:	83 ec 0c             	sub    $0xc,%esp
+     333:	ff 75 f0             	push   -0x10(%ebp)
+     336:	e8 6d 03 00 00       	call   6a8 <close>
+     33b:	83 c4 10             	add    $0x10,%esp
+  if(link("g", "/h") >= 0){
+     33e:	83 ec 08             	sub    $0x8,%esp
+     341:	68 88 12 00 00       	push   $0x1288
+     346:	68 6c 12 00 00       	push   $0x126c
+     34b:	e8 95 03 00 00       	call   6e5 <link>
+     350:	83 c4 10             	add    $0x10,%esp
+     353:	85 c0                	test   %eax,%eax
+     355:	78 17                	js     36e <main+0x32a>
+    printf(1, "error: link across file systems\n");
+     357:	83 ec 08             	sub    $0x8,%esp
+     35a:	68 8c 12 00 00       	push   $0x128c
+     35f:	6a 01                	push   $0x1
+     361:	e8 af 07 00 00       	call   b15 <printf>
+     366:	83 c4 10             	add    $0x10,%esp
+    exit();
+     369:	e8 17 03 00 00       	call   685 <exit>
+  }
+  if(unlink("g") < 0 || chdir("/") < 0 || unlink("/tmp/d") < 0 ||
+     36e:	83 ec 0c             	sub    $0xc,%esp
+     371:	68 6c 12 00 00       	push   $0x126c
+     376:	e8 56 03 00 00       	call   6d1 <unlink>
+     37b:	83 c4 10             	add    $0x10,%esp
+     37e:	85 c0                	test   %eax,%eax
+     380:	78 3e                	js     3c0 <main+0x37c>
+     382:	83 ec 0c             	sub    $0xc,%esp
+     385:	68 b5 11 00 00       	push   $0x11b5
+     38a:	e8 6a 03 00 00       	call   6f9 <chdir>
+     38f:	83 c4 10             	add    $0x10,%esp
+     392:	85 c0                	test   %eax,%eax
+     394:	78 2a                	js     3c0 <main+0x37c>
+     396:	83 ec 0c             	sub    $0xc,%esp
+     399:	68 f0 11 00 00       	push   $0x11f0
+     39e:	e8 2e 03 00 00       	call   6d1 <unlink>
+     3a3:	83 c4 10             	add    $0x10,%esp
+     3a6:	85 c0                	test   %eax,%eax
+     3a8:	78 16                	js     3c0 <main+0x37c>
+     open("/tmp/d/g", O_RDONLY) >= 0){
+     3aa:	83 ec 08             	sub    $0x8,%esp
+     3ad:	6a 00                	push   $0x0
+     3af:	68 ad 12 00 00       	push   $0x12ad
+     3b4:	e8 04 03 00 00       	call   6bd <open>
+     3b9:	83 c4 10             	add    $0x10,%esp
+  if(unlink("g") < 0 || chdir("/") < 0 || unlink("/tmp/d") < 0 ||
+     3bc:	85 c0                	test   %eax,%eax
+     3be:	78 17                	js     3d7 <main+0x393>
+    printf(1, "error: cleanup\n");
+     3c0:	83 ec 08             	sub    $0x8,%esp
+     3c3:	68 b6 12 00 00       	push   $0x12b6
+     3c8:	6a 01                	push   $0x1
+     3ca:	e8 46 07 00 00       	call   b15 <printf>
+     3cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3d2:	e8 ae 02 00 00       	call   685 <exit>
+  }
+  printf(1, "tmpfs names ok\n");
+     3d7:	83 ec 08             	sub    $0x8,%esp
+     3da:	68 c6 12 00 00       	push   $0x12c6
+     3df:	6a 01                	push   $0x1
+     3e1:	e8 2f 07 00 00       	call   b15 <printf>
+     3e6:	83 c4 10             	add    $0x10,%esp
+  exit();
+     3e9:	e8 97 02 00 00       	call   685 <exit>
+
+000003ee <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     3ee:	55                   	push   %ebp
+     3ef:	89 e5                	mov    %esp,%ebp
+     3f1:	57                   	push   %edi
+     3f2:	53                   	push   %ebx
+    if(cc < 1)
+     3f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3f6:	8b 55 10             	mov    0x10(%ebp),%edx
+     3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3fc:	89 cb                	mov    %ecx,%ebx
+     3fe:	89 df                	mov    %ebx,%edi
+     400:	89 d1                	mov    %edx,%ecx
+     402:	fc                   	cld
+     403:	f3 aa                	rep stos %al,%es:(%edi)
+     405:	89 ca                	mov    %ecx,%edx
+     407:	89 fb                	mov    %edi,%ebx
+     409:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     40c:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     40f:	90                   	nop
+     410:	5b                   	pop    %ebx
+     411:	5f                   	pop    %edi
+     412:	5d                   	pop    %ebp
+     413:	c3                   	ret
+
+00000414 <strcpy>:
+{
+     414:	55                   	push   %ebp
+     415:	89 e5                	mov    %esp,%ebp
+     417:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     41a:	8b 45 08             	mov    0x8(%ebp),%eax
+     41d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     420:	90                   	nop
+     421:	8b 55 0c             	mov    0xc(%ebp),%edx
+     424:	8d 42 01             	lea    0x1(%edx),%eax
+     427:	89 45 0c             	mov    %eax,0xc(%ebp)
+     42a:	8b 45 08             	mov    0x8(%ebp),%eax
+     42d:	8d 48 01             	lea    0x1(%eax),%ecx
+     430:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     433:	0f b6 12             	movzbl (%edx),%edx
+     436:	88 10                	mov    %dl,(%eax)
+     438:	0f b6 00             	movzbl (%eax),%eax
+     43b:	84 c0                	test   %al,%al
+     43d:	75 e2                	jne    421 <strcpy+0xd>
+  return os;
+     43f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     442:	c9                   	leave
+     443:	c3                   	ret
+
+00000444 <strcmp>:
+{
+     444:	55                   	push   %ebp
+     445:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     447:	eb 08                	jmp    451 <strcmp+0xd>
+    p++, q++;
+     449:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     44d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     451:	8b 45 08             	mov    0x8(%ebp),%eax
+     454:	0f b6 00             	movzbl (%eax),%eax
+     457:	84 c0                	test   %al,%al
+     459:	74 10                	je     46b <strcmp+0x27>
+     45b:	8b 45 08             	mov    0x8(%ebp),%eax
+     45e:	0f b6 10             	movzbl (%eax),%edx
+     461:	8b 45 0c             	mov    0xc(%ebp),%eax
+     464:	0f b6 00             	movzbl (%eax),%eax
+     467:	38 c2                	cmp    %al,%dl
+     469:	74 de                	je     449 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     46b:	8b 45 08             	mov    0x8(%ebp),%eax
+     46e:	0f b6 00             	movzbl (%eax),%eax
+     471:	0f b6 d0             	movzbl %al,%edx
+     474:	8b 45 0c             	mov    0xc(%ebp),%eax
+     477:	0f b6 00             	movzbl (%eax),%eax
+     47a:	0f b6 c0             	movzbl %al,%eax
+     47d:	29 c2                	sub    %eax,%edx
+     47f:	89 d0                	mov    %edx,%eax
+}
+     481:	5d                   	pop    %ebp
+     482:	c3                   	ret
+
+00000483 <strlen>:
+{
+     483:	55                   	push   %ebp
+     484:	89 e5                	mov    %esp,%ebp
+     486:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     489:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     490:	eb 04                	jmp    496 <strlen+0x13>
+     492:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     496:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     499:	8b 45 08             	mov    0x8(%ebp),%eax
+     49c:	01 d0                	add    %edx,%eax
+     49e:	0f b6 00             	movzbl (%eax),%eax
+     4a1:	84 c0                	test   %al,%al
+     4a3:	75 ed                	jne    492 <strlen+0xf>
+  return n;
+     4a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4a8:	c9                   	leave
+     4a9:	c3                   	ret
+
+000004aa <memset>:
+{
+     4aa:	55                   	push   %ebp
+     4ab:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     4ad:	8b 45 10             	mov    0x10(%ebp),%eax
+     4b0:	50                   	push   %eax
+     4b1:	ff 75 0c             	push   0xc(%ebp)
+     4b4:	ff 75 08             	push   0x8(%ebp)
+     4b7:	e8 32 ff ff ff       	call   3ee <stosb>
+     4bc:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     4bf:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4c2:	c9                   	leave
+     4c3:	c3                   	ret
+
+000004c4 <strchr>:
+{
+     4c4:	55                   	push   %ebp
+     4c5:	89 e5                	mov    %esp,%ebp
+     4c7:	83 ec 04             	sub    $0x4,%esp
+     4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4cd:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     4d0:	eb 14                	jmp    4e6 <strchr+0x22>
+    if(*s == c)
+     4d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d5:	0f b6 00             	movzbl (%eax),%eax
+     4d8:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     4db:	75 05                	jne    4e2 <strchr+0x1e>
+      return (char*)s;
+     4dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e0:	eb 13                	jmp    4f5 <strchr+0x31>
+  for(; *s; s++)
+     4e2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e9:	0f b6 00             	movzbl (%eax),%eax
+     4ec:	84 c0                	test   %al,%al
+     4ee:	75 e2                	jne    4d2 <strchr+0xe>
+  return 0;
+     4f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4f5:	c9                   	leave
+     4f6:	c3                   	ret
+
+000004f7 <gets>:
+{
+     4f7:	55                   	push   %ebp
+     4f8:	89 e5                	mov    %esp,%ebp
+     4fa:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     4fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     504:	eb 42                	jmp    548 <gets+0x51>
+    cc = read(0, &c, 1);
+     506:	83 ec 04             	sub    $0x4,%esp
+     509:	6a 01                	push   $0x1
+     50b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     50e:	50                   	push   %eax
+     50f:	6a 00                	push   $0x0
+     511:	e8 84 01 00 00       	call   69a <read>
+     516:	83 c4 10             	add    $0x10,%esp
+     519:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     51c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     520:	7e 33                	jle    555 <gets+0x5e>
+    buf[i++] = c;
+     522:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     525:	8d 50 01             	lea    0x1(%eax),%edx
+     528:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     52b:	89 c2                	mov    %eax,%edx
+     52d:	8b 45 08             	mov    0x8(%ebp),%eax
+     530:	01 c2                	add    %eax,%edx
+     532:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     536:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     538:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     53c:	3c 0a                	cmp    $0xa,%al
+     53e:	74 16                	je     556 <gets+0x5f>
+     540:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     544:	3c 0d                	cmp    $0xd,%al
+     546:	74 0e                	je     556 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     548:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     54b:	83 c0 01             	add    $0x1,%eax
+     54e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     551:	7f b3                	jg     506 <gets+0xf>
+     553:	eb 01                	jmp    556 <gets+0x5f>
+      break;
+     555:	90                   	nop
+  }
+  buf[i] = '\0';
+     556:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     559:	8b 45 08             	mov    0x8(%ebp),%eax
+     55c:	01 d0                	add    %edx,%eax
+     55e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     561:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     564:	c9                   	leave
+     565:	c3                   	ret
+
+00000566 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     566:	55                   	push   %ebp
+     567:	89 e5                	mov    %esp,%ebp
+     569:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     56c:	83 ec 08             	sub    $0x8,%esp
+     56f:	6a 00                	push   $0x0
+     571:	ff 75 08             	push   0x8(%ebp)
+     574:	e8 44 01 00 00       	call   6bd <open>
+     579:	83 c4 10             	add    $0x10,%esp
+     57c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     57f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     583:	79 07                	jns    58c <stat+0x26>
+    return -1;
+     585:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     58a:	eb 25                	jmp    5b1 <stat+0x4b>
+  r = fstat(fd, st);
+     58c:	83 ec 08             	sub    $0x8,%esp
+     58f:	ff 75 0c             	push   0xc(%ebp)
+     592:	ff 75 f4             	push   -0xc(%ebp)
+     595:	e8 41 01 00 00       	call   6db <fstat>
+     59a:	83 c4 10             	add    $0x10,%esp
+     59d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     5a0:	83 ec 0c             	sub    $0xc,%esp
+     5a3:	ff 75 f4             	push   -0xc(%ebp)
+     5a6:	e8 fd 00 00 00       	call   6a8 <close>
+     5ab:	83 c4 10             	add    $0x10,%esp
+  return r;
+     5ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     5b1:	c9                   	leave
+     5b2:	c3                   	ret
+
+000005b3 <atoi>:
+
+int
+atoi(const char *s)
+{
+     5b3:	55                   	push   %ebp
+     5b4:	89 e5                	mov    %esp,%ebp
+     5b6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     5b9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5c0:	eb 25                	jmp    5e7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     5c2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5c5:	89 d0                	mov    %edx,%eax
+     5c7:	c1 e0 02             	shl    $0x2,%eax
+     5ca:	01 d0                	add    %edx,%eax
+     5cc:	01 c0                	add    %eax,%eax
+     5ce:	89 c1                	mov    %eax,%ecx
+     5d0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d3:	8d 50 01             	lea    0x1(%eax),%edx
+     5d6:	89 55 08             	mov    %edx,0x8(%ebp)
+     5d9:	0f b6 00             	movzbl (%eax),%eax
+     5dc:	0f be c0             	movsbl %al,%eax
+     5df:	01 c8                	add    %ecx,%eax
+     5e1:	83 e8 30             	sub    $0x30,%eax
+     5e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ea:	0f b6 00             	movzbl (%eax),%eax
+     5ed:	3c 2f                	cmp    $0x2f,%al
+     5ef:	7e 0a                	jle    5fb <atoi+0x48>
+     5f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f4:	0f b6 00             	movzbl (%eax),%eax
+     5f7:	3c 39                	cmp    $0x39,%al
+     5f9:	7e c7                	jle    5c2 <atoi+0xf>
+  return n;
+     5fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5fe:	c9                   	leave
+     5ff:	c3                   	ret
+
+00000600 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     606:	8b 45 08             	mov    0x8(%ebp),%eax
+     609:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     60c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     60f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     612:	eb 17                	jmp    62b <memmove+0x2b>
+    *dst++ = *src++;
+     614:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     617:	8d 42 01             	lea    0x1(%edx),%eax
+     61a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     61d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     620:	8d 48 01             	lea    0x1(%eax),%ecx
+     623:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     626:	0f b6 12             	movzbl (%edx),%edx
+     629:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     62b:	8b 45 10             	mov    0x10(%ebp),%eax
+     62e:	8d 50 ff             	lea    -0x1(%eax),%edx
+     631:	89 55 10             	mov    %edx,0x10(%ebp)
+     634:	85 c0                	test   %eax,%eax
+     636:	7f dc                	jg     614 <memmove+0x14>
+  return vdst;
+     638:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     63b:	c9                   	leave
+     63c:	c3                   	ret
+
+0000063d <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     63d:	83 3d 84 16 00 00 00 	cmpl   $0x0,0x1684
+  jg 2f
+     644:	7f 2e                	jg     674 <dosyscall+0x37>
+  jl 1f
+     646:	7c 29                	jl     671 <dosyscall+0x34>
+  pushl %eax
+     648:	50                   	push   %eax
+  pushl %ebx
+     649:	53                   	push   %ebx
+  movl $1, %eax
+     64a:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     64f:	0f a2                	cpuid
+  popl %ebx
+     651:	5b                   	pop    %ebx
+  popl %eax
+     652:	58                   	pop    %eax
+  movl $-1, sysmode
+     653:	c7 05 84 16 00 00 ff 	movl   $0xffffffff,0x1684
+     65a:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     65d:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     663:	74 0c                	je     671 <dosyscall+0x34>
+  movl $1, sysmode
+     665:	c7 05 84 16 00 00 01 	movl   $0x1,0x1684
+     66c:	00 00 00 
+  jmp 2f
+     66f:	eb 03                	jmp    674 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     671:	cd 40                	int    $0x40
+  ret
+     673:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     674:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+  sysenter
+     67b:	0f 34                	sysenter
+3:
+  ret
+     67d:	c3                   	ret
+
+0000067e <fork>:
+
+SYSCALL(fork)
+     67e:	b8 01 00 00 00       	mov    $0x1,%eax
+     683:	eb b8                	jmp    63d <dosyscall>
+
+00000685 <exit>:
+SYSCALL(exit)
+     685:	b8 02 00 00 00       	mov    $0x2,%eax
+     68a:	eb b1                	jmp    63d <dosyscall>
+
+0000068c <wait>:
+SYSCALL(wait)
+     68c:	b8 03 00 00 00       	mov    $0x3,%eax
+     691:	eb aa                	jmp    63d <dosyscall>
+
+00000693 <pipe>:
+SYSCALL(pipe)
+     693:	b8 04 00 00 00       	mov    $0x4,%eax
+     698:	eb a3                	jmp    63d <dosyscall>
+
+0000069a <read>:
+SYSCALL(read)
+     69a:	b8 05 00 00 00       	mov    $0x5,%eax
+     69f:	eb 9c                	jmp    63d <dosyscall>
+
+000006a1 <write>:
+SYSCALL(write)
+     6a1:	b8 10 00 00 00       	mov    $0x10,%eax
+     6a6:	eb 95                	jmp    63d <dosyscall>
+
+000006a8 <close>:
+SYSCALL(close)
+     6a8:	b8 15 00 00 00       	mov    $0x15,%eax
+     6ad:	eb 8e                	jmp    63d <dosyscall>
+
+000006af <kill>:
+SYSCALL(kill)
+     6af:	b8 06 00 00 00       	mov    $0x6,%eax
+     6b4:	eb 87                	jmp    63d <dosyscall>
+
+000006b6 <exec>:
+SYSCALL(exec)
+     6b6:	b8 07 00 00 00       	mov    $0x7,%eax
+     6bb:	eb 80                	jmp    63d <dosyscall>
+
+000006bd <open>:
+SYSCALL(open)
+     6bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6c2:	e9 76 ff ff ff       	jmp    63d <dosyscall>
+
+000006c7 <mknod>:
+SYSCALL(mknod)
+     6c7:	b8 11 00 00 00       	mov    $0x11,%eax
+     6cc:	e9 6c ff ff ff       	jmp    63d <dosyscall>
+
+000006d1 <unlink>:
+SYSCALL(unlink)
+     6d1:	b8 12 00 00 00       	mov    $0x12,%eax
+     6d6:	e9 62 ff ff ff       	jmp    63d <dosyscall>
+
+000006db <fstat>:
+SYSCALL(fstat)
+     6db:	b8 08 00 00 00       	mov    $0x8,%eax
+     6e0:	e9 58 ff ff ff       	jmp    63d <dosyscall>
+
+000006e5 <link>:
+SYSCALL(link)
+     6e5:	b8 13 00 00 00       	mov    $0x13,%eax
+     6ea:	e9 4e ff ff ff       	jmp    63d <dosyscall>
+
+000006ef <mkdir>:
+SYSCALL(mkdir)
+     6ef:	b8 14 00 00 00       	mov    $0x14,%eax
+     6f4:	e9 44 ff ff ff       	jmp    63d <dosyscall>
+
+000006f9 <chdir>:
+SYSCALL(chdir)
+     6f9:	b8 09 00 00 00       	mov    $0x9,%eax
+     6fe:	e9 3a ff ff ff       	jmp    63d <dosyscall>
+
+00000703 <dup>:
+SYSCALL(dup)
+     703:	b8 0a 00 00 00       	mov    $0xa,%eax
+     708:	e9 30 ff ff ff       	jmp    63d <dosyscall>
+
+0000070d <getpid>:
+SYSCALL(getpid)
+     70d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     712:	e9 26 ff ff ff       	jmp    63d <dosyscall>
+
+00000717 <sbrk>:
+SYSCALL(sbrk)
+     717:	b8 0c 00 00 00       	mov    $0xc,%eax
+     71c:	e9 1c ff ff ff       	jmp    63d <dosyscall>
+
+00000721 <sleep>:
+SYSCALL(sleep)
+     721:	b8 0d 00 00 00       	mov    $0xd,%eax
+     726:	e9 12 ff ff ff       	jmp    63d <dosyscall>
+
+0000072b <uptime>:
+SYSCALL(uptime)
+     72b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     730:	e9 08 ff ff ff       	jmp    63d <dosyscall>
+
+00000735 <symlink>:
+SYSCALL(symlink)
+     735:	b8 16 00 00 00       	mov    $0x16,%eax
+     73a:	e9 fe fe ff ff       	jmp    63d <dosyscall>
+
+0000073f <readlink>:
+SYSCALL(readlink)
+     73f:	b8 17 00 00 00       	mov    $0x17,%eax
+     744:	e9 f4 fe ff ff       	jmp    63d <dosyscall>
+
+00000749 <fprot>:
+SYSCALL(fprot)
+     749:	b8 18 00 00 00       	mov    $0x18,%eax
+     74e:	e9 ea fe ff ff       	jmp    63d <dosyscall>
+
+00000753 <funprot>:
+SYSCALL(funprot)
+     753:	b8 19 00 00 00       	mov    $0x19,%eax
+     758:	e9 e0 fe ff ff       	jmp    63d <dosyscall>
+
+0000075d <funlock>:
+SYSCALL(funlock)
+     75d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     762:	e9 d6 fe ff ff       	jmp    63d <dosyscall>
+
+00000767 <mmap>:
+SYSCALL(mmap)
+     767:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     76c:	e9 cc fe ff ff       	jmp    63d <dosyscall>
+
+00000771 <munmap>:
+SYSCALL(munmap)
+     771:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     776:	e9 c2 fe ff ff       	jmp    63d <dosyscall>
+
+0000077b <sendfile>:
+SYSCALL(sendfile)
+     77b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     780:	e9 b8 fe ff ff       	jmp    63d <dosyscall>
+
+00000785 <readv>:
+SYSCALL(readv)
+     785:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     78a:	e9 ae fe ff ff       	jmp    63d <dosyscall>
+
+0000078f <writev>:
+SYSCALL(writev)
+     78f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     794:	e9 a4 fe ff ff       	jmp    63d <dosyscall>
+
+00000799 <pread>:
+SYSCALL(pread)
+     799:	b8 20 00 00 00       	mov    $0x20,%eax
+     79e:	e9 9a fe ff ff       	jmp    63d <dosyscall>
+
+000007a3 <pwrite>:
+SYSCALL(pwrite)
+     7a3:	b8 21 00 00 00       	mov    $0x21,%eax
+     7a8:	e9 90 fe ff ff       	jmp    63d <dosyscall>
+
+000007ad <lseek>:
+SYSCALL(lseek)
+     7ad:	b8 22 00 00 00       	mov    $0x22,%eax
+     7b2:	e9 86 fe ff ff       	jmp    63d <dosyscall>
+
+000007b7 <spawn>:
+SYSCALL(spawn)
+     7b7:	b8 23 00 00 00       	mov    $0x23,%eax
+     7bc:	e9 7c fe ff ff       	jmp    63d <dosyscall>
+
+000007c1 <setpriority>:
+SYSCALL(setpriority)
+     7c1:	b8 24 00 00 00       	mov    $0x24,%eax
+     7c6:	e9 72 fe ff ff       	jmp    63d <dosyscall>
+
+000007cb <kthread_create>:
+SYSCALL(kthread_create)
+     7cb:	b8 25 00 00 00       	mov    $0x25,%eax
+     7d0:	e9 68 fe ff ff       	jmp    63d <dosyscall>
+
+000007d5 <kthread_id>:
+SYSCALL(kthread_id)
+     7d5:	b8 26 00 00 00       	mov    $0x26,%eax
+     7da:	e9 5e fe ff ff       	jmp    63d <dosyscall>
+
+000007df <kthread_exit>:
+SYSCALL(kthread_exit)
+     7df:	b8 27 00 00 00       	mov    $0x27,%eax
+     7e4:	e9 54 fe ff ff       	jmp    63d <dosyscall>
+
+000007e9 <kthread_join>:
+SYSCALL(kthread_join)
+     7e9:	b8 28 00 00 00       	mov    $0x28,%eax
+     7ee:	e9 4a fe ff ff       	jmp    63d <dosyscall>
+
+000007f3 <futex>:
+SYSCALL(futex)
+     7f3:	b8 29 00 00 00       	mov    $0x29,%eax
+     7f8:	e9 40 fe ff ff       	jmp    63d <dosyscall>
+
+000007fd <signal>:
+SYSCALL(signal)
+     7fd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     802:	e9 36 fe ff ff       	jmp    63d <dosyscall>
+
+00000807 <alarm>:
+SYSCALL(alarm)
+     807:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     80c:	e9 2c fe ff ff       	jmp    63d <dosyscall>
+
+00000811 <usleep>:
+SYSCALL(usleep)
+     811:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     816:	e9 22 fe ff ff       	jmp    63d <dosyscall>
+
+0000081b <ioring_setup>:
+SYSCALL(ioring_setup)
+     81b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     820:	e9 18 fe ff ff       	jmp    63d <dosyscall>
+
+00000825 <ioring_enter>:
+SYSCALL(ioring_enter)
+     825:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     82a:	e9 0e fe ff ff       	jmp    63d <dosyscall>
+
+0000082f <getrusage>:
+SYSCALL(getrusage)
+     82f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     834:	e9 04 fe ff ff       	jmp    63d <dosyscall>
+
+00000839 <mount>:
+SYSCALL(mount)
+     839:	b8 30 00 00 00       	mov    $0x30,%eax
+     83e:	e9 fa fd ff ff       	jmp    63d <dosyscall>
+
+00000843 <getdents>:
+SYSCALL(getdents)
+     843:	b8 31 00 00 00       	mov    $0x31,%eax
+     848:	e9 f0 fd ff ff       	jmp    63d <dosyscall>
+
+0000084d <yield>:
+SYSCALL(yield)
+     84d:	b8 32 00 00 00       	mov    $0x32,%eax
+     852:	e9 e6 fd ff ff       	jmp    63d <dosyscall>
+
+00000857 <ncpu>:
+SYSCALL(ncpu)
+     857:	b8 33 00 00 00       	mov    $0x33,%eax
+     85c:	e9 dc fd ff ff       	jmp    63d <dosyscall>
+
+00000861 <fallocate>:
+SYSCALL(fallocate)
+     861:	b8 34 00 00 00       	mov    $0x34,%eax
+     866:	e9 d2 fd ff ff       	jmp    63d <dosyscall>
+
+0000086b <ftruncate>:
+SYSCALL(ftruncate)
+     86b:	b8 35 00 00 00       	mov    $0x35,%eax
+     870:	e9 c8 fd ff ff       	jmp    63d <dosyscall>
+
+00000875 <fsync>:
+SYSCALL(fsync)
+     875:	b8 36 00 00 00       	mov    $0x36,%eax
+     87a:	e9 be fd ff ff       	jmp    63d <dosyscall>
+
+0000087f <fdatasync>:
+SYSCALL(fdatasync)
+     87f:	b8 37 00 00 00       	mov    $0x37,%eax
+     884:	e9 b4 fd ff ff       	jmp    63d <dosyscall>
+
+00000889 <poll>:
+SYSCALL(poll)
+     889:	b8 38 00 00 00       	mov    $0x38,%eax
+     88e:	e9 aa fd ff ff       	jmp    63d <dosyscall>
+
+00000893 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     893:	55                   	push   %ebp
+     894:	89 e5                	mov    %esp,%ebp
+     896:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     899:	8b 45 08             	mov    0x8(%ebp),%eax
+     89c:	8b 40 04             	mov    0x4(%eax),%eax
+     89f:	85 c0                	test   %eax,%eax
+     8a1:	7e 1f                	jle    8c2 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a6:	8b 50 04             	mov    0x4(%eax),%edx
+     8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ac:	8d 48 08             	lea    0x8(%eax),%ecx
+     8af:	8b 45 08             	mov    0x8(%ebp),%eax
+     8b2:	8b 00                	mov    (%eax),%eax
+     8b4:	83 ec 04             	sub    $0x4,%esp
+     8b7:	52                   	push   %edx
+     8b8:	51                   	push   %ecx
+     8b9:	50                   	push   %eax
+     8ba:	e8 d0 fe ff ff       	call   78f <writev>
+     8bf:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     8c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     8c5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     8cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     8cf:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     8d6:	00 00 00 
+}
+     8d9:	90                   	nop
+     8da:	c9                   	leave
+     8db:	c3                   	ret
+
+000008dc <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     8dc:	55                   	push   %ebp
+     8dd:	89 e5                	mov    %esp,%ebp
+     8df:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     8e2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     8e6:	0f 84 94 00 00 00    	je     980 <put+0xa4>
+    return;
+  if(o->n > 0){
+     8ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ef:	8b 40 04             	mov    0x4(%eax),%eax
+     8f2:	85 c0                	test   %eax,%eax
+     8f4:	7e 40                	jle    936 <put+0x5a>
+    v = &o->iov[o->n-1];
+     8f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f9:	8b 40 04             	mov    0x4(%eax),%eax
+     8fc:	83 e8 01             	sub    $0x1,%eax
+     8ff:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     906:	8b 45 08             	mov    0x8(%ebp),%eax
+     909:	01 d0                	add    %edx,%eax
+     90b:	83 c0 08             	add    $0x8,%eax
+     90e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     914:	8b 10                	mov    (%eax),%edx
+     916:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     919:	8b 40 04             	mov    0x4(%eax),%eax
+     91c:	01 d0                	add    %edx,%eax
+     91e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     921:	75 13                	jne    936 <put+0x5a>
+      v->iov_len += n;
+     923:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     926:	8b 50 04             	mov    0x4(%eax),%edx
+     929:	8b 45 10             	mov    0x10(%ebp),%eax
+     92c:	01 c2                	add    %eax,%edx
+     92e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     931:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     934:	eb 4b                	jmp    981 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     936:	8b 45 08             	mov    0x8(%ebp),%eax
+     939:	8b 40 04             	mov    0x4(%eax),%eax
+     93c:	83 f8 10             	cmp    $0x10,%eax
+     93f:	75 0e                	jne    94f <put+0x73>
+    flush(o);
+     941:	83 ec 0c             	sub    $0xc,%esp
+     944:	ff 75 08             	push   0x8(%ebp)
+     947:	e8 47 ff ff ff       	call   893 <flush>
+     94c:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     94f:	8b 45 08             	mov    0x8(%ebp),%eax
+     952:	8b 50 04             	mov    0x4(%eax),%edx
+     955:	8b 45 08             	mov    0x8(%ebp),%eax
+     958:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     95b:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     95f:	8b 45 08             	mov    0x8(%ebp),%eax
+     962:	8b 50 04             	mov    0x4(%eax),%edx
+     965:	8b 45 08             	mov    0x8(%ebp),%eax
+     968:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     96b:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     96f:	8b 45 08             	mov    0x8(%ebp),%eax
+     972:	8b 40 04             	mov    0x4(%eax),%eax
+     975:	8d 50 01             	lea    0x1(%eax),%edx
+     978:	8b 45 08             	mov    0x8(%ebp),%eax
+     97b:	89 50 04             	mov    %edx,0x4(%eax)
+     97e:	eb 01                	jmp    981 <put+0xa5>
+    return;
+     980:	90                   	nop
+}
+     981:	c9                   	leave
+     982:	c3                   	ret
+
+00000983 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     983:	55                   	push   %ebp
+     984:	89 e5                	mov    %esp,%ebp
+     986:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     989:	8b 45 08             	mov    0x8(%ebp),%eax
+     98c:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     992:	8b 45 0c             	mov    0xc(%ebp),%eax
+     995:	01 d0                	add    %edx,%eax
+     997:	3d 80 00 00 00       	cmp    $0x80,%eax
+     99c:	77 0b                	ja     9a9 <room+0x26>
+     99e:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a1:	8b 40 04             	mov    0x4(%eax),%eax
+     9a4:	83 f8 10             	cmp    $0x10,%eax
+     9a7:	75 0e                	jne    9b7 <room+0x34>
+    flush(o);
+     9a9:	83 ec 0c             	sub    $0xc,%esp
+     9ac:	ff 75 08             	push   0x8(%ebp)
+     9af:	e8 df fe ff ff       	call   893 <flush>
+     9b4:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     9b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ba:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     9c0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     9c9:	01 d0                	add    %edx,%eax
+}
+     9cb:	c9                   	leave
+     9cc:	c3                   	ret
+
+000009cd <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     9cd:	55                   	push   %ebp
+     9ce:	89 e5                	mov    %esp,%ebp
+     9d0:	83 ec 28             	sub    $0x28,%esp
+     9d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9d6:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     9d9:	83 ec 08             	sub    $0x8,%esp
+     9dc:	6a 01                	push   $0x1
+     9de:	ff 75 08             	push   0x8(%ebp)
+     9e1:	e8 9d ff ff ff       	call   983 <room>
+     9e6:	83 c4 10             	add    $0x10,%esp
+     9e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     9ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9ef:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     9f3:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     9f5:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     9fe:	8d 50 01             	lea    0x1(%eax),%edx
+     a01:	8b 45 08             	mov    0x8(%ebp),%eax
+     a04:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     a0a:	83 ec 04             	sub    $0x4,%esp
+     a0d:	6a 01                	push   $0x1
+     a0f:	ff 75 f4             	push   -0xc(%ebp)
+     a12:	ff 75 08             	push   0x8(%ebp)
+     a15:	e8 c2 fe ff ff       	call   8dc <put>
+     a1a:	83 c4 10             	add    $0x10,%esp
+}
+     a1d:	90                   	nop
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+
+00000a20 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     a26:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     a2d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     a31:	74 17                	je     a4a <printint+0x2a>
+     a33:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     a37:	79 11                	jns    a4a <printint+0x2a>
+    neg = 1;
+     a39:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     a40:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a43:	f7 d8                	neg    %eax
+     a45:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a48:	eb 06                	jmp    a50 <printint+0x30>
+  } else {
+    x = xx;
+     a4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a4d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     a50:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a5a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+     a62:	f7 f1                	div    %ecx
+     a64:	89 d1                	mov    %edx,%ecx
+     a66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a69:	8d 50 01             	lea    0x1(%eax),%edx
+     a6c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a6f:	0f b6 91 88 16 00 00 	movzbl 0x1688(%ecx),%edx
+     a76:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     a7a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a80:	ba 00 00 00 00       	mov    $0x0,%edx
+     a85:	f7 f1                	div    %ecx
+     a87:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a8e:	75 c7                	jne    a57 <printint+0x37>
+  if(neg)
+     a90:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a94:	74 0e                	je     aa4 <printint+0x84>
+    buf[i++] = '-';
+     a96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a99:	8d 50 01             	lea    0x1(%eax),%edx
+     a9c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a9f:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     aa7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     aaa:	83 ec 08             	sub    $0x8,%esp
+     aad:	ff 75 e8             	push   -0x18(%ebp)
+     ab0:	ff 75 08             	push   0x8(%ebp)
+     ab3:	e8 cb fe ff ff       	call   983 <room>
+     ab8:	83 c4 10             	add    $0x10,%esp
+     abb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     abe:	eb 1d                	jmp    add <printint+0xbd>
+    p[n-1-i] = buf[i];
+     ac0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ac3:	83 e8 01             	sub    $0x1,%eax
+     ac6:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     ac9:	89 c2                	mov    %eax,%edx
+     acb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ace:	01 c2                	add    %eax,%edx
+     ad0:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad6:	01 c8                	add    %ecx,%eax
+     ad8:	0f b6 00             	movzbl (%eax),%eax
+     adb:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     add:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     ae1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ae5:	79 d9                	jns    ac0 <printint+0xa0>
+  o->used += n;
+     ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+     aea:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     af0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     af3:	01 c2                	add    %eax,%edx
+     af5:	8b 45 08             	mov    0x8(%ebp),%eax
+     af8:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     afe:	83 ec 04             	sub    $0x4,%esp
+     b01:	ff 75 e8             	push   -0x18(%ebp)
+     b04:	ff 75 e4             	push   -0x1c(%ebp)
+     b07:	ff 75 08             	push   0x8(%ebp)
+     b0a:	e8 cd fd ff ff       	call   8dc <put>
+     b0f:	83 c4 10             	add    $0x10,%esp
+}
+     b12:	90                   	nop
+     b13:	c9                   	leave
+     b14:	c3                   	ret
+
+00000b15 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b15:	55                   	push   %ebp
+     b16:	89 e5                	mov    %esp,%ebp
+     b18:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b21:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     b27:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     b2e:	00 00 00 
+  o.used = 0;
+     b31:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     b38:	00 00 00 
+  state = 0;
+     b3b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     b42:	8d 45 0c             	lea    0xc(%ebp),%eax
+     b45:	83 c0 04             	add    $0x4,%eax
+     b48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     b4b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b52:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     b59:	e9 82 01 00 00       	jmp    ce0 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     b5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b61:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b64:	01 d0                	add    %edx,%eax
+     b66:	0f b6 00             	movzbl (%eax),%eax
+     b69:	0f be c0             	movsbl %al,%eax
+     b6c:	25 ff 00 00 00       	and    $0xff,%eax
+     b71:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     b74:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b78:	75 38                	jne    bb2 <printf+0x9d>
+      if(c == '%'){
+     b7a:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     b7e:	0f 85 58 01 00 00    	jne    cdc <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     b84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b87:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     b8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     b8d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     b90:	01 ca                	add    %ecx,%edx
+     b92:	83 ec 04             	sub    $0x4,%esp
+     b95:	50                   	push   %eax
+     b96:	52                   	push   %edx
+     b97:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b9d:	50                   	push   %eax
+     b9e:	e8 39 fd ff ff       	call   8dc <put>
+     ba3:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     ba6:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     bad:	e9 2a 01 00 00       	jmp    cdc <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     bb2:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     bb6:	0f 85 20 01 00 00    	jne    cdc <printf+0x1c7>
+      if(c == 'd'){
+     bbc:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     bc0:	75 22                	jne    be4 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     bc2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bc5:	8b 00                	mov    (%eax),%eax
+     bc7:	6a 01                	push   $0x1
+     bc9:	6a 0a                	push   $0xa
+     bcb:	50                   	push   %eax
+     bcc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     bd2:	50                   	push   %eax
+     bd3:	e8 48 fe ff ff       	call   a20 <printint>
+     bd8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     bdb:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     bdf:	e9 e8 00 00 00       	jmp    ccc <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     be4:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     be8:	74 06                	je     bf0 <printf+0xdb>
+     bea:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     bee:	75 22                	jne    c12 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     bf0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf3:	8b 00                	mov    (%eax),%eax
+     bf5:	6a 00                	push   $0x0
+     bf7:	6a 10                	push   $0x10
+     bf9:	50                   	push   %eax
+     bfa:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c00:	50                   	push   %eax
+     c01:	e8 1a fe ff ff       	call   a20 <printint>
+     c06:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c09:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c0d:	e9 ba 00 00 00       	jmp    ccc <printf+0x1b7>
+      } else if(c == 's'){
+     c12:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     c16:	75 3f                	jne    c57 <printf+0x142>
+        s = (char*)*ap;
+     c18:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c1b:	8b 00                	mov    (%eax),%eax
+     c1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c20:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     c24:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c28:	75 07                	jne    c31 <printf+0x11c>
+          s = "(null)";
+     c2a:	c7 45 f4 d6 12 00 00 	movl   $0x12d6,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     c31:	83 ec 0c             	sub    $0xc,%esp
+     c34:	ff 75 f4             	push   -0xc(%ebp)
+     c37:	e8 47 f8 ff ff       	call   483 <strlen>
+     c3c:	83 c4 10             	add    $0x10,%esp
+     c3f:	83 ec 04             	sub    $0x4,%esp
+     c42:	50                   	push   %eax
+     c43:	ff 75 f4             	push   -0xc(%ebp)
+     c46:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c4c:	50                   	push   %eax
+     c4d:	e8 8a fc ff ff       	call   8dc <put>
+     c52:	83 c4 10             	add    $0x10,%esp
+     c55:	eb 75                	jmp    ccc <printf+0x1b7>
+      } else if(c == 'c'){
+     c57:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     c5b:	75 21                	jne    c7e <printf+0x169>
+        putc(&o, *ap);
+     c5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c60:	8b 00                	mov    (%eax),%eax
+     c62:	0f be c0             	movsbl %al,%eax
+     c65:	83 ec 08             	sub    $0x8,%esp
+     c68:	50                   	push   %eax
+     c69:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c6f:	50                   	push   %eax
+     c70:	e8 58 fd ff ff       	call   9cd <putc>
+     c75:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c78:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     c7c:	eb 4e                	jmp    ccc <printf+0x1b7>
+      } else if(c == '%'){
+     c7e:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     c82:	75 1b                	jne    c9f <printf+0x18a>
+        putc(&o, c);
+     c84:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c87:	0f be c0             	movsbl %al,%eax
+     c8a:	83 ec 08             	sub    $0x8,%esp
+     c8d:	50                   	push   %eax
+     c8e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     c94:	50                   	push   %eax
+     c95:	e8 33 fd ff ff       	call   9cd <putc>
+     c9a:	83 c4 10             	add    $0x10,%esp
+     c9d:	eb 2d                	jmp    ccc <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     c9f:	83 ec 08             	sub    $0x8,%esp
+     ca2:	6a 25                	push   $0x25
+     ca4:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     caa:	50                   	push   %eax
+     cab:	e8 1d fd ff ff       	call   9cd <putc>
+     cb0:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     cb3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     cb6:	0f be c0             	movsbl %al,%eax
+     cb9:	83 ec 08             	sub    $0x8,%esp
+     cbc:	50                   	push   %eax
+     cbd:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     cc3:	50                   	push   %eax
+     cc4:	e8 04 fd ff ff       	call   9cd <putc>
+     cc9:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ccc:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     cd3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cd6:	83 c0 01             	add    $0x1,%eax
+     cd9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     cdc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     ce0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ce3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ce6:	01 d0                	add    %edx,%eax
+     ce8:	0f b6 00             	movzbl (%eax),%eax
+     ceb:	84 c0                	test   %al,%al
+     ced:	0f 85 6b fe ff ff    	jne    b5e <printf+0x49>
+    }
+  }
+  if(state == 0)
+     cf3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     cf7:	75 22                	jne    d1b <printf+0x206>
+    put(&o, fmt + start, i - start);
+     cf9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cfc:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     cff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     d02:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     d05:	01 ca                	add    %ecx,%edx
+     d07:	83 ec 04             	sub    $0x4,%esp
+     d0a:	50                   	push   %eax
+     d0b:	52                   	push   %edx
+     d0c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d12:	50                   	push   %eax
+     d13:	e8 c4 fb ff ff       	call   8dc <put>
+     d18:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     d1b:	83 ec 0c             	sub    $0xc,%esp
+     d1e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     d24:	50                   	push   %eax
+     d25:	e8 69 fb ff ff       	call   893 <flush>
+     d2a:	83 c4 10             	add    $0x10,%esp
+}
+     d2d:	90                   	nop
+     d2e:	c9                   	leave
+     d2f:	c3                   	ret
+
+00000d30 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     d36:	8b 55 08             	mov    0x8(%ebp),%edx
+     d39:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     d3f:	f0 87 02             	lock xchg %eax,(%edx)
+     d42:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     d45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     d48:	c9                   	leave
+     d49:	c3                   	ret
+
+00000d4a <lock>:
+{
+     d4a:	55                   	push   %ebp
+     d4b:	89 e5                	mov    %esp,%ebp
+     d4d:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     d50:	a1 d0 64 00 00       	mov    0x64d0,%eax
+     d55:	85 c0                	test   %eax,%eax
+     d57:	74 09                	je     d62 <lock+0x18>
+     d59:	a1 d0 64 00 00       	mov    0x64d0,%eax
+     d5e:	ff d0                	call   *%eax
+     d60:	eb 05                	jmp    d67 <lock+0x1d>
+     d62:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     d6a:	90                   	nop
+     d6b:	83 ec 08             	sub    $0x8,%esp
+     d6e:	6a 01                	push   $0x1
+     d70:	68 08 65 00 00       	push   $0x6508
+     d75:	e8 b6 ff ff ff       	call   d30 <xchg>
+     d7a:	83 c4 10             	add    $0x10,%esp
+     d7d:	85 c0                	test   %eax,%eax
+     d7f:	75 ea                	jne    d6b <lock+0x21>
+  return pin;
+     d81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     d84:	c9                   	leave
+     d85:	c3                   	ret
+
+00000d86 <unlock>:
+{
+     d86:	55                   	push   %ebp
+     d87:	89 e5                	mov    %esp,%ebp
+     d89:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     d8c:	6a 00                	push   $0x0
+     d8e:	68 08 65 00 00       	push   $0x6508
+     d93:	e8 98 ff ff ff       	call   d30 <xchg>
+     d98:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     d9b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d9f:	78 10                	js     db1 <unlock+0x2b>
+    mallocunpin(pin);
+     da1:	a1 d4 64 00 00       	mov    0x64d4,%eax
+     da6:	83 ec 0c             	sub    $0xc,%esp
+     da9:	ff 75 08             	push   0x8(%ebp)
+     dac:	ff d0                	call   *%eax
+     dae:	83 c4 10             	add    $0x10,%esp
+}
+     db1:	90                   	nop
+     db2:	c9                   	leave
+     db3:	c3                   	ret
+
+00000db4 <sizeclass>:
+{
+     db4:	55                   	push   %ebp
+     db5:	89 e5                	mov    %esp,%ebp
+     db7:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     dba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     dc1:	eb 1c                	jmp    ddf <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     dc3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dc6:	ba 02 00 00 00       	mov    $0x2,%edx
+     dcb:	89 c1                	mov    %eax,%ecx
+     dcd:	d3 e2                	shl    %cl,%edx
+     dcf:	89 d0                	mov    %edx,%eax
+     dd1:	3b 45 08             	cmp    0x8(%ebp),%eax
+     dd4:	72 05                	jb     ddb <sizeclass+0x27>
+      return c;
+     dd6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dd9:	eb 0f                	jmp    dea <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     ddb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     ddf:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     de3:	7e de                	jle    dc3 <sizeclass+0xf>
+  return -1;
+     de5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     dea:	c9                   	leave
+     deb:	c3                   	ret
+
+00000dec <bigfree>:
+{
+     dec:	55                   	push   %ebp
+     ded:	89 e5                	mov    %esp,%ebp
+     def:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     df2:	a1 e0 64 00 00       	mov    0x64e0,%eax
+     df7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     dfa:	eb 24                	jmp    e20 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dfc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dff:	8b 00                	mov    (%eax),%eax
+     e01:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e04:	72 12                	jb     e18 <bigfree+0x2c>
+     e06:	8b 45 08             	mov    0x8(%ebp),%eax
+     e09:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e0c:	72 24                	jb     e32 <bigfree+0x46>
+     e0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e11:	8b 00                	mov    (%eax),%eax
+     e13:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e16:	72 1a                	jb     e32 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e1b:	8b 00                	mov    (%eax),%eax
+     e1d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e20:	8b 45 08             	mov    0x8(%ebp),%eax
+     e23:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e26:	73 d4                	jae    dfc <bigfree+0x10>
+     e28:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e2b:	8b 00                	mov    (%eax),%eax
+     e2d:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e30:	73 ca                	jae    dfc <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     e32:	8b 45 08             	mov    0x8(%ebp),%eax
+     e35:	8b 40 04             	mov    0x4(%eax),%eax
+     e38:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     e42:	01 c2                	add    %eax,%edx
+     e44:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e47:	8b 00                	mov    (%eax),%eax
+     e49:	39 c2                	cmp    %eax,%edx
+     e4b:	75 24                	jne    e71 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e50:	8b 50 04             	mov    0x4(%eax),%edx
+     e53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e56:	8b 00                	mov    (%eax),%eax
+     e58:	8b 40 04             	mov    0x4(%eax),%eax
+     e5b:	01 c2                	add    %eax,%edx
+     e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e60:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e66:	8b 00                	mov    (%eax),%eax
+     e68:	8b 10                	mov    (%eax),%edx
+     e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e6d:	89 10                	mov    %edx,(%eax)
+     e6f:	eb 0a                	jmp    e7b <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     e71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e74:	8b 10                	mov    (%eax),%edx
+     e76:	8b 45 08             	mov    0x8(%ebp),%eax
+     e79:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     e7b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e7e:	8b 40 04             	mov    0x4(%eax),%eax
+     e81:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e8b:	01 d0                	add    %edx,%eax
+     e8d:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e90:	75 20                	jne    eb2 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     e92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e95:	8b 50 04             	mov    0x4(%eax),%edx
+     e98:	8b 45 08             	mov    0x8(%ebp),%eax
+     e9b:	8b 40 04             	mov    0x4(%eax),%eax
+     e9e:	01 c2                	add    %eax,%edx
+     ea0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ea3:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea9:	8b 10                	mov    (%eax),%edx
+     eab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eae:	89 10                	mov    %edx,(%eax)
+     eb0:	eb 08                	jmp    eba <bigfree+0xce>
+    p->s.ptr = bp;
+     eb2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+     eb8:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     eba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ebd:	a3 e0 64 00 00       	mov    %eax,0x64e0
+}
+     ec2:	90                   	nop
+     ec3:	c9                   	leave
+     ec4:	c3                   	ret
+
+00000ec5 <free>:
+{
+     ec5:	55                   	push   %ebp
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     ecb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     ecf:	74 68                	je     f39 <free+0x74>
+  bp = (Header*)ap - 1;
+     ed1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed4:	83 e8 08             	sub    $0x8,%eax
+     ed7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     eda:	e8 6b fe ff ff       	call   d4a <lock>
+     edf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee5:	8b 40 04             	mov    0x4(%eax),%eax
+     ee8:	83 ec 0c             	sub    $0xc,%esp
+     eeb:	50                   	push   %eax
+     eec:	e8 c3 fe ff ff       	call   db4 <sizeclass>
+     ef1:	83 c4 10             	add    $0x10,%esp
+     ef4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     ef7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     efb:	78 1e                	js     f1b <free+0x56>
+    bp->s.ptr = classfree[c];
+     efd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f00:	8b 14 85 e4 64 00 00 	mov    0x64e4(,%eax,4),%edx
+     f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0a:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     f0c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f0f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f12:	89 14 85 e4 64 00 00 	mov    %edx,0x64e4(,%eax,4)
+     f19:	eb 0e                	jmp    f29 <free+0x64>
+    bigfree(bp);
+     f1b:	83 ec 0c             	sub    $0xc,%esp
+     f1e:	ff 75 f4             	push   -0xc(%ebp)
+     f21:	e8 c6 fe ff ff       	call   dec <bigfree>
+     f26:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     f29:	83 ec 0c             	sub    $0xc,%esp
+     f2c:	ff 75 f0             	push   -0x10(%ebp)
+     f2f:	e8 52 fe ff ff       	call   d86 <unlock>
+     f34:	83 c4 10             	add    $0x10,%esp
+     f37:	eb 01                	jmp    f3a <free+0x75>
+    return;
+     f39:	90                   	nop
+}
+     f3a:	c9                   	leave
+     f3b:	c3                   	ret
+
+00000f3c <morecore>:
+{
+     f3c:	55                   	push   %ebp
+     f3d:	89 e5                	mov    %esp,%ebp
+     f3f:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     f42:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     f49:	77 07                	ja     f52 <morecore+0x16>
+    nu = 4096;
+     f4b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     f52:	8b 45 08             	mov    0x8(%ebp),%eax
+     f55:	c1 e0 03             	shl    $0x3,%eax
+     f58:	83 ec 0c             	sub    $0xc,%esp
+     f5b:	50                   	push   %eax
+     f5c:	e8 b6 f7 ff ff       	call   717 <sbrk>
+     f61:	83 c4 10             	add    $0x10,%esp
+     f64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     f67:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     f6b:	75 07                	jne    f74 <morecore+0x38>
+    return 0;
+     f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f72:	eb 22                	jmp    f96 <morecore+0x5a>
+  hp = (Header*)p;
+     f74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     f7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+     f80:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     f83:	83 ec 0c             	sub    $0xc,%esp
+     f86:	ff 75 f0             	push   -0x10(%ebp)
+     f89:	e8 5e fe ff ff       	call   dec <bigfree>
+     f8e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     f91:	a1 e0 64 00 00       	mov    0x64e0,%eax
+}
+     f96:	c9                   	leave
+     f97:	c3                   	ret
+
+00000f98 <bigalloc>:
+{
+     f98:	55                   	push   %ebp
+     f99:	89 e5                	mov    %esp,%ebp
+     f9b:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     f9e:	a1 e0 64 00 00       	mov    0x64e0,%eax
+     fa3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fa6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     faa:	75 23                	jne    fcf <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     fac:	c7 45 f0 d8 64 00 00 	movl   $0x64d8,-0x10(%ebp)
+     fb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fb6:	a3 e0 64 00 00       	mov    %eax,0x64e0
+     fbb:	a1 e0 64 00 00       	mov    0x64e0,%eax
+     fc0:	a3 d8 64 00 00       	mov    %eax,0x64d8
+    base.s.size = 0;
+     fc5:	c7 05 dc 64 00 00 00 	movl   $0x0,0x64dc
+     fcc:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fcf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fd2:	8b 00                	mov    (%eax),%eax
+     fd4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fda:	8b 40 04             	mov    0x4(%eax),%eax
+     fdd:	3b 45 08             	cmp    0x8(%ebp),%eax
+     fe0:	72 4a                	jb     102c <bigalloc+0x94>
+      if(p->s.size == nunits)
+     fe2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fe5:	8b 40 04             	mov    0x4(%eax),%eax
+     fe8:	39 45 08             	cmp    %eax,0x8(%ebp)
+     feb:	75 0c                	jne    ff9 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     fed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff0:	8b 10                	mov    (%eax),%edx
+     ff2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff5:	89 10                	mov    %edx,(%eax)
+     ff7:	eb 26                	jmp    101f <bigalloc+0x87>
+        p->s.size -= nunits;
+     ff9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ffc:	8b 40 04             	mov    0x4(%eax),%eax
+     fff:	2b 45 08             	sub    0x8(%ebp),%eax
+    1002:	89 c2                	mov    %eax,%edx
+    1004:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1007:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    100a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100d:	8b 40 04             	mov    0x4(%eax),%eax
+    1010:	c1 e0 03             	shl    $0x3,%eax
+    1013:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1016:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1019:	8b 55 08             	mov    0x8(%ebp),%edx
+    101c:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+    101f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1022:	a3 e0 64 00 00       	mov    %eax,0x64e0
+      return p;
+    1027:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102a:	eb 3b                	jmp    1067 <bigalloc+0xcf>
+    if(p == freep)
+    102c:	a1 e0 64 00 00       	mov    0x64e0,%eax
+    1031:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1034:	75 1e                	jne    1054 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+    1036:	83 ec 0c             	sub    $0xc,%esp
+    1039:	ff 75 08             	push   0x8(%ebp)
+    103c:	e8 fb fe ff ff       	call   f3c <morecore>
+    1041:	83 c4 10             	add    $0x10,%esp
+    1044:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1047:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    104b:	75 07                	jne    1054 <bigalloc+0xbc>
+        return 0;
+    104d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1052:	eb 13                	jmp    1067 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1054:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1057:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    105a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105d:	8b 00                	mov    (%eax),%eax
+    105f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1062:	e9 70 ff ff ff       	jmp    fd7 <bigalloc+0x3f>
+}
+    1067:	c9                   	leave
+    1068:	c3                   	ret
+
+00001069 <alloc>:
+alloc(uint nbytes)
+{
+    1069:	55                   	push   %ebp
+    106a:	89 e5                	mov    %esp,%ebp
+    106c:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    106f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1072:	83 c0 07             	add    $0x7,%eax
+    1075:	c1 e8 03             	shr    $0x3,%eax
+    1078:	83 c0 01             	add    $0x1,%eax
+    107b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+    107e:	ff 75 f4             	push   -0xc(%ebp)
+    1081:	e8 2e fd ff ff       	call   db4 <sizeclass>
+    1086:	83 c4 04             	add    $0x4,%esp
+    1089:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    108c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1090:	79 2c                	jns    10be <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+    1092:	83 ec 0c             	sub    $0xc,%esp
+    1095:	ff 75 f4             	push   -0xc(%ebp)
+    1098:	e8 fb fe ff ff       	call   f98 <bigalloc>
+    109d:	83 c4 10             	add    $0x10,%esp
+    10a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10a7:	75 0a                	jne    10b3 <alloc+0x4a>
+      return 0;
+    10a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ae:	e9 c8 00 00 00       	jmp    117b <alloc+0x112>
+    return (void*)(p + 1);
+    10b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10b6:	83 c0 08             	add    $0x8,%eax
+    10b9:	e9 bd 00 00 00       	jmp    117b <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+    10be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10c1:	8b 04 85 e4 64 00 00 	mov    0x64e4(,%eax,4),%eax
+    10c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10cf:	74 1a                	je     10eb <alloc+0x82>
+    classfree[c] = p->s.ptr;
+    10d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10d4:	8b 10                	mov    (%eax),%edx
+    10d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10d9:	89 14 85 e4 64 00 00 	mov    %edx,0x64e4(,%eax,4)
+    return (void*)(p + 1);
+    10e0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10e3:	83 c0 08             	add    $0x8,%eax
+    10e6:	e9 90 00 00 00       	jmp    117b <alloc+0x112>
+  }
+  nunits = 2 << c;
+    10eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10ee:	ba 02 00 00 00       	mov    $0x2,%edx
+    10f3:	89 c1                	mov    %eax,%ecx
+    10f5:	d3 e2                	shl    %cl,%edx
+    10f7:	89 d0                	mov    %edx,%eax
+    10f9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+    10fc:	a1 00 65 00 00       	mov    0x6500,%eax
+    1101:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1104:	c1 e2 03             	shl    $0x3,%edx
+    1107:	01 d0                	add    %edx,%eax
+    1109:	8b 15 04 65 00 00    	mov    0x6504,%edx
+    110f:	39 c2                	cmp    %eax,%edx
+    1111:	73 3f                	jae    1152 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+    1113:	83 ec 0c             	sub    $0xc,%esp
+    1116:	68 00 08 00 00       	push   $0x800
+    111b:	e8 78 fe ff ff       	call   f98 <bigalloc>
+    1120:	83 c4 10             	add    $0x10,%esp
+    1123:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1126:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    112a:	75 07                	jne    1133 <alloc+0xca>
+      return 0;
+    112c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1131:	eb 48                	jmp    117b <alloc+0x112>
+    bump = (char*)p;
+    1133:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1136:	a3 00 65 00 00       	mov    %eax,0x6500
+    bumpend = (char*)(p + p->s.size);
+    113b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    113e:	8b 40 04             	mov    0x4(%eax),%eax
+    1141:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1148:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    114b:	01 d0                	add    %edx,%eax
+    114d:	a3 04 65 00 00       	mov    %eax,0x6504
+  }
+  p = (Header*)bump;
+    1152:	a1 00 65 00 00       	mov    0x6500,%eax
+    1157:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+    115a:	a1 00 65 00 00       	mov    0x6500,%eax
+    115f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1162:	c1 e2 03             	shl    $0x3,%edx
+    1165:	01 d0                	add    %edx,%eax
+    1167:	a3 00 65 00 00       	mov    %eax,0x6500
+  p->s.size = nunits;
+    116c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    116f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1172:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+    1175:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1178:	83 c0 08             	add    $0x8,%eax
+}
+    117b:	c9                   	leave
+    117c:	c3                   	ret
+
+0000117d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    117d:	55                   	push   %ebp
+    117e:	89 e5                	mov    %esp,%ebp
+    1180:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+    1183:	e8 c2 fb ff ff       	call   d4a <lock>
+    1188:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+    118b:	83 ec 0c             	sub    $0xc,%esp
+    118e:	ff 75 08             	push   0x8(%ebp)
+    1191:	e8 d3 fe ff ff       	call   1069 <alloc>
+    1196:	83 c4 10             	add    $0x10,%esp
+    1199:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+    119c:	83 ec 0c             	sub    $0xc,%esp
+    119f:	ff 75 f4             	push   -0xc(%ebp)
+    11a2:	e8 df fb ff ff       	call   d86 <unlock>
+    11a7:	83 c4 10             	add    $0x10,%esp
+  return p;
+    11aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    11ad:	c9                   	leave
+    11ae:	c3                   	ret
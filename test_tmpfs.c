@@ -0,0 +1,77 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define SIZE 10000
+
+static char buf[SIZE], buf2[SIZE];
+
+static int
+same(void)
+{
+  int i;
+
+  for(i = 0; i < SIZE; i++)
+    if(buf[i] != buf2[i])
+      return 0;
+  return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct stat st, root;
+  int fd, i;
+
+  // init mounts a tmpfs on /tmp.
+  if(stat("/tmp", &st) < 0 || stat("/", &root) < 0 || st.dev == root.dev){
+    printf(1, "error: /tmp is not mounted\n");
+    exit();
+  }
+  if(mount("/tmp") >= 0 || unlink("/tmp") >= 0){
+    printf(1, "error: mount point not kept\n");
+    exit();
+  }
+
+  for(i = 0; i < SIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if(mkdir("/tmp/d") < 0 || (fd = open("/tmp/d/f", O_CREATE | O_RDWR)) < 0){
+    printf(1, "error: create in /tmp\n");
+    exit();
+  }
+  if(write(fd, buf, SIZE) != SIZE || pread(fd, buf2, SIZE, 0) != SIZE || !same()){
+    printf(1, "error: write and read back\n");
+    exit();
+  }
+  if(fstat(fd, &st) < 0 || st.size != SIZE || st.dev == root.dev){
+    printf(1, "error: fstat\n");
+    exit();
+  }
+  close(fd);
+  printf(1, "tmpfs files ok\n");
+
+  // Names and ".." around the mount point.
+  if(chdir("/tmp/d") < 0 || stat("../d/f", &st) < 0 || st.size != SIZE ||
+     stat("../..", &st) < 0 || st.dev != root.dev || st.ino != root.ino){
+    printf(1, "error: paths\n");
+    exit();
+  }
+  if(link("f", "g") < 0 || unlink("f") < 0 || (fd = open("g", O_RDONLY)) < 0 ||
+     read(fd, buf2, SIZE) != SIZE || !same()){
+    printf(1, "error: link and unlink\n");
+    exit();
+  }
+  close(fd);
+  if(link("g", "/h") >= 0){
+    printf(1, "error: link across file systems\n");
+    exit();
+  }
+  if(unlink("g") < 0 || chdir("/") < 0 || unlink("/tmp/d") < 0 ||
+     open("/tmp/d/g", O_RDONLY) >= 0){
+    printf(1, "error: cleanup\n");
+    exit();
+  }
+  printf(1, "tmpfs names ok\n");
+  exit();
+}
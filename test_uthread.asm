@@ -0,0 +1,2987 @@
+
+_test_uthread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <counter>:
+int count[NCOUNT];
+volatile int go;
+
+void
+counter(void *arg)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+
+  n = (int)arg;
+       6:	8b 45 08             	mov    0x8(%ebp),%eax
+       9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < ROUNDS; i++){
+       c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      13:	eb 47                	jmp    5c <counter+0x5c>
+    count[n]++;
+      15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      18:	8b 04 85 e0 1e 00 00 	mov    0x1ee0(,%eax,4),%eax
+      1f:	8d 50 01             	lea    0x1(%eax),%edx
+      22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      25:	89 14 85 e0 1e 00 00 	mov    %edx,0x1ee0(,%eax,4)
+    if(i % 10 == 0)
+      2c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+      2f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+      34:	89 c8                	mov    %ecx,%eax
+      36:	f7 ea                	imul   %edx
+      38:	c1 fa 02             	sar    $0x2,%edx
+      3b:	89 c8                	mov    %ecx,%eax
+      3d:	c1 f8 1f             	sar    $0x1f,%eax
+      40:	29 c2                	sub    %eax,%edx
+      42:	89 d0                	mov    %edx,%eax
+      44:	c1 e0 02             	shl    $0x2,%eax
+      47:	01 d0                	add    %edx,%eax
+      49:	01 c0                	add    %eax,%eax
+      4b:	29 c1                	sub    %eax,%ecx
+      4d:	89 ca                	mov    %ecx,%edx
+      4f:	85 d2                	test   %edx,%edx
+      51:	75 05                	jne    58 <counter+0x58>
+      uthread_yield();
+      53:	e8 e7 15 00 00       	call   163f <uthread_yield>
+  for(i = 0; i < ROUNDS; i++){
+      58:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      5c:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+      60:	7e b3                	jle    15 <counter+0x15>
+  }
+}
+      62:	90                   	nop
+      63:	90                   	nop
+      64:	c9                   	leave
+      65:	c3                   	ret
+
+00000066 <spinner>:
+
+// Never yields: only preemption lets the setter run.
+void
+spinner(void *arg)
+{
+      66:	55                   	push   %ebp
+      67:	89 e5                	mov    %esp,%ebp
+  while(!go)
+      69:	90                   	nop
+      6a:	a1 80 1f 00 00       	mov    0x1f80,%eax
+      6f:	85 c0                	test   %eax,%eax
+      71:	74 f7                	je     6a <spinner+0x4>
+    ;
+}
+      73:	90                   	nop
+      74:	90                   	nop
+      75:	5d                   	pop    %ebp
+      76:	c3                   	ret
+
+00000077 <setter>:
+
+void
+setter(void *arg)
+{
+      77:	55                   	push   %ebp
+      78:	89 e5                	mov    %esp,%ebp
+  go = 1;
+      7a:	c7 05 80 1f 00 00 01 	movl   $0x1,0x1f80
+      81:	00 00 00 
+}
+      84:	90                   	nop
+      85:	5d                   	pop    %ebp
+      86:	c3                   	ret
+
+00000087 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      87:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      8b:	83 e4 f0             	and    $0xfffffff0,%esp
+      8e:	ff 71 fc             	push   -0x4(%ecx)
+      91:	55                   	push   %ebp
+      92:	89 e5                	mov    %esp,%ebp
+      94:	53                   	push   %ebx
+      95:	51                   	push   %ecx
+      96:	81 ec c0 00 00 00    	sub    $0xc0,%esp
+  int i, tid[NCOUNT+NSPIN+1];
+
+  uthread_init();
+      9c:	e8 e6 12 00 00       	call   1387 <uthread_init>
+
+  for(i = 0; i < NSPIN; i++)
+      a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      a8:	eb 20                	jmp    ca <main+0x43>
+    tid[i] = uthread_create(spinner, 0);
+      aa:	83 ec 08             	sub    $0x8,%esp
+      ad:	6a 00                	push   $0x0
+      af:	68 66 00 00 00       	push   $0x66
+      b4:	e8 12 14 00 00       	call   14cb <uthread_create>
+      b9:	83 c4 10             	add    $0x10,%esp
+      bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      bf:	89 84 95 44 ff ff ff 	mov    %eax,-0xbc(%ebp,%edx,4)
+  for(i = 0; i < NSPIN; i++)
+      c6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      ca:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+      ce:	7e da                	jle    aa <main+0x23>
+  tid[i++] = uthread_create(setter, 0);
+      d0:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+      d3:	8d 43 01             	lea    0x1(%ebx),%eax
+      d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      d9:	83 ec 08             	sub    $0x8,%esp
+      dc:	6a 00                	push   $0x0
+      de:	68 77 00 00 00       	push   $0x77
+      e3:	e8 e3 13 00 00       	call   14cb <uthread_create>
+      e8:	83 c4 10             	add    $0x10,%esp
+      eb:	89 84 9d 44 ff ff ff 	mov    %eax,-0xbc(%ebp,%ebx,4)
+  for(; i < NSPIN+1+NCOUNT; i++)
+      f2:	eb 25                	jmp    119 <main+0x92>
+    tid[i] = uthread_create(counter, (void*)(i-NSPIN-1));
+      f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      f7:	83 e8 04             	sub    $0x4,%eax
+      fa:	83 ec 08             	sub    $0x8,%esp
+      fd:	50                   	push   %eax
+      fe:	68 00 00 00 00       	push   $0x0
+     103:	e8 c3 13 00 00       	call   14cb <uthread_create>
+     108:	83 c4 10             	add    $0x10,%esp
+     10b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     10e:	89 84 95 44 ff ff ff 	mov    %eax,-0xbc(%ebp,%edx,4)
+  for(; i < NSPIN+1+NCOUNT; i++)
+     115:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     119:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     11d:	7e d5                	jle    f4 <main+0x6d>
+  for(i = 0; i < NSPIN+1+NCOUNT; i++){
+     11f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     126:	eb 46                	jmp    16e <main+0xe7>
+    if(tid[i] < 0 || uthred_join(tid[i]) < 0){
+     128:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     12b:	8b 84 85 44 ff ff ff 	mov    -0xbc(%ebp,%eax,4),%eax
+     132:	85 c0                	test   %eax,%eax
+     134:	78 1a                	js     150 <main+0xc9>
+     136:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     139:	8b 84 85 44 ff ff ff 	mov    -0xbc(%ebp,%eax,4),%eax
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	50                   	push   %eax
+     144:	e8 3b 15 00 00       	call   1684 <uthred_join>
+     149:	83 c4 10             	add    $0x10,%esp
+     14c:	85 c0                	test   %eax,%eax
+     14e:	79 1a                	jns    16a <main+0xe3>
+      printf(1, "error: thread %d\n", i);
+     150:	83 ec 04             	sub    $0x4,%esp
+     153:	ff 75 f4             	push   -0xc(%ebp)
+     156:	68 60 17 00 00       	push   $0x1760
+     15b:	6a 01                	push   $0x1
+     15d:	e8 fc 07 00 00       	call   95e <printf>
+     162:	83 c4 10             	add    $0x10,%esp
+      exit();
+     165:	e8 64 03 00 00       	call   4ce <exit>
+  for(i = 0; i < NSPIN+1+NCOUNT; i++){
+     16a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     16e:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     172:	7e b4                	jle    128 <main+0xa1>
+    }
+  }
+  if(!go){
+     174:	a1 80 1f 00 00       	mov    0x1f80,%eax
+     179:	85 c0                	test   %eax,%eax
+     17b:	75 17                	jne    194 <main+0x10d>
+    printf(1, "error: spinners done before setter\n");
+     17d:	83 ec 08             	sub    $0x8,%esp
+     180:	68 74 17 00 00       	push   $0x1774
+     185:	6a 01                	push   $0x1
+     187:	e8 d2 07 00 00       	call   95e <printf>
+     18c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     18f:	e8 3a 03 00 00       	call   4ce <exit>
+  }
+  for(i = 0; i < NCOUNT; i++){
+     194:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     19b:	eb 3a                	jmp    1d7 <main+0x150>
+    if(count[i] != ROUNDS){
+     19d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1a0:	8b 04 85 e0 1e 00 00 	mov    0x1ee0(,%eax,4),%eax
+     1a7:	83 f8 64             	cmp    $0x64,%eax
+     1aa:	74 27                	je     1d3 <main+0x14c>
+      printf(1, "error: count[%d] %d, not %d\n", i, count[i], ROUNDS);
+     1ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1af:	8b 04 85 e0 1e 00 00 	mov    0x1ee0(,%eax,4),%eax
+     1b6:	83 ec 0c             	sub    $0xc,%esp
+     1b9:	6a 64                	push   $0x64
+     1bb:	50                   	push   %eax
+     1bc:	ff 75 f4             	push   -0xc(%ebp)
+     1bf:	68 98 17 00 00       	push   $0x1798
+     1c4:	6a 01                	push   $0x1
+     1c6:	e8 93 07 00 00       	call   95e <printf>
+     1cb:	83 c4 20             	add    $0x20,%esp
+      exit();
+     1ce:	e8 fb 02 00 00       	call   4ce <exit>
+  for(i = 0; i < NCOUNT; i++){
+     1d3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1d7:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+     1db:	7e c0                	jle    19d <main+0x116>
+    }
+  }
+  if(uthred_join(tid[0]) != 0 || uthred_join(uthred_self()) != -1){
+     1dd:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+     1e3:	83 ec 0c             	sub    $0xc,%esp
+     1e6:	50                   	push   %eax
+     1e7:	e8 98 14 00 00       	call   1684 <uthred_join>
+     1ec:	83 c4 10             	add    $0x10,%esp
+     1ef:	85 c0                	test   %eax,%eax
+     1f1:	75 16                	jne    209 <main+0x182>
+     1f3:	e8 80 14 00 00       	call   1678 <uthred_self>
+     1f8:	83 ec 0c             	sub    $0xc,%esp
+     1fb:	50                   	push   %eax
+     1fc:	e8 83 14 00 00       	call   1684 <uthred_join>
+     201:	83 c4 10             	add    $0x10,%esp
+     204:	83 f8 ff             	cmp    $0xffffffff,%eax
+     207:	74 17                	je     220 <main+0x199>
+    printf(1, "error: join\n");
+     209:	83 ec 08             	sub    $0x8,%esp
+     20c:	68 b5 17 00 00       	push   $0x17b5
+     211:	6a 01                	push   $0x1
+     213:	e8 46 07 00 00       	call   95e <printf>
+     218:	83 c4 10             	add    $0x10,%esp
+    exit();
+     21b:	e8 ae 02 00 00       	call   4ce <exit>
+  }
+  printf(1, "uthread ok\n");
+     220:	83 ec 08             	sub    $0x8,%esp
+     223:	68 c2 17 00 00       	push   $0x17c2
+     228:	6a 01                	push   $0x1
+     22a:	e8 2f 07 00 00       	call   95e <printf>
+     22f:	83 c4 10             	add    $0x10,%esp
+  exit();
+     232:	e8 97 02 00 00       	call   4ce <exit>
+
+00000237 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     237:	55                   	push   %ebp
+     238:	89 e5                	mov    %esp,%ebp
+     23a:	57                   	push   %edi
+     23b:	53                   	push   %ebx
+    if(cc < 1)
+     23c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     23f:	8b 55 10             	mov    0x10(%ebp),%edx
+     242:	8b 45 0c             	mov    0xc(%ebp),%eax
+     245:	89 cb                	mov    %ecx,%ebx
+     247:	89 df                	mov    %ebx,%edi
+     249:	89 d1                	mov    %edx,%ecx
+     24b:	fc                   	cld
+     24c:	f3 aa                	rep stos %al,%es:(%edi)
+     24e:	89 ca                	mov    %ecx,%edx
+     250:	89 fb                	mov    %edi,%ebx
+     252:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     255:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+     258:	90                   	nop
+     259:	5b                   	pop    %ebx
+     25a:	5f                   	pop    %edi
+     25b:	5d                   	pop    %ebp
+     25c:	c3                   	ret
+
+0000025d <strcpy>:
+{
+     25d:	55                   	push   %ebp
+     25e:	89 e5                	mov    %esp,%ebp
+     260:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     263:	8b 45 08             	mov    0x8(%ebp),%eax
+     266:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     269:	90                   	nop
+     26a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     26d:	8d 42 01             	lea    0x1(%edx),%eax
+     270:	89 45 0c             	mov    %eax,0xc(%ebp)
+     273:	8b 45 08             	mov    0x8(%ebp),%eax
+     276:	8d 48 01             	lea    0x1(%eax),%ecx
+     279:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     27c:	0f b6 12             	movzbl (%edx),%edx
+     27f:	88 10                	mov    %dl,(%eax)
+     281:	0f b6 00             	movzbl (%eax),%eax
+     284:	84 c0                	test   %al,%al
+     286:	75 e2                	jne    26a <strcpy+0xd>
+  return os;
+     288:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     28b:	c9                   	leave
+     28c:	c3                   	ret
+
+0000028d <strcmp>:
+{
+     28d:	55                   	push   %ebp
+     28e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     290:	eb 08                	jmp    29a <strcmp+0xd>
+    p++, q++;
+     292:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     296:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     29a:	8b 45 08             	mov    0x8(%ebp),%eax
+     29d:	0f b6 00             	movzbl (%eax),%eax
+     2a0:	84 c0                	test   %al,%al
+     2a2:	74 10                	je     2b4 <strcmp+0x27>
+     2a4:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a7:	0f b6 10             	movzbl (%eax),%edx
+     2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ad:	0f b6 00             	movzbl (%eax),%eax
+     2b0:	38 c2                	cmp    %al,%dl
+     2b2:	74 de                	je     292 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     2b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     2b7:	0f b6 00             	movzbl (%eax),%eax
+     2ba:	0f b6 d0             	movzbl %al,%edx
+     2bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2c0:	0f b6 00             	movzbl (%eax),%eax
+     2c3:	0f b6 c0             	movzbl %al,%eax
+     2c6:	29 c2                	sub    %eax,%edx
+     2c8:	89 d0                	mov    %edx,%eax
+}
+     2ca:	5d                   	pop    %ebp
+     2cb:	c3                   	ret
+
+000002cc <strlen>:
+{
+     2cc:	55                   	push   %ebp
+     2cd:	89 e5                	mov    %esp,%ebp
+     2cf:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     2d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     2d9:	eb 04                	jmp    2df <strlen+0x13>
+     2db:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2df:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e5:	01 d0                	add    %edx,%eax
+     2e7:	0f b6 00             	movzbl (%eax),%eax
+     2ea:	84 c0                	test   %al,%al
+     2ec:	75 ed                	jne    2db <strlen+0xf>
+  return n;
+     2ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2f1:	c9                   	leave
+     2f2:	c3                   	ret
+
+000002f3 <memset>:
+{
+     2f3:	55                   	push   %ebp
+     2f4:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     2f6:	8b 45 10             	mov    0x10(%ebp),%eax
+     2f9:	50                   	push   %eax
+     2fa:	ff 75 0c             	push   0xc(%ebp)
+     2fd:	ff 75 08             	push   0x8(%ebp)
+     300:	e8 32 ff ff ff       	call   237 <stosb>
+     305:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     308:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     30b:	c9                   	leave
+     30c:	c3                   	ret
+
+0000030d <strchr>:
+{
+     30d:	55                   	push   %ebp
+     30e:	89 e5                	mov    %esp,%ebp
+     310:	83 ec 04             	sub    $0x4,%esp
+     313:	8b 45 0c             	mov    0xc(%ebp),%eax
+     316:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     319:	eb 14                	jmp    32f <strchr+0x22>
+    if(*s == c)
+     31b:	8b 45 08             	mov    0x8(%ebp),%eax
+     31e:	0f b6 00             	movzbl (%eax),%eax
+     321:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     324:	75 05                	jne    32b <strchr+0x1e>
+      return (char*)s;
+     326:	8b 45 08             	mov    0x8(%ebp),%eax
+     329:	eb 13                	jmp    33e <strchr+0x31>
+  for(; *s; s++)
+     32b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     32f:	8b 45 08             	mov    0x8(%ebp),%eax
+     332:	0f b6 00             	movzbl (%eax),%eax
+     335:	84 c0                	test   %al,%al
+     337:	75 e2                	jne    31b <strchr+0xe>
+  return 0;
+     339:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     33e:	c9                   	leave
+     33f:	c3                   	ret
+
+00000340 <gets>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     346:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     34d:	eb 42                	jmp    391 <gets+0x51>
+    cc = read(0, &c, 1);
+     34f:	83 ec 04             	sub    $0x4,%esp
+     352:	6a 01                	push   $0x1
+     354:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     357:	50                   	push   %eax
+     358:	6a 00                	push   $0x0
+     35a:	e8 84 01 00 00       	call   4e3 <read>
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     365:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     369:	7e 33                	jle    39e <gets+0x5e>
+    buf[i++] = c;
+     36b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     36e:	8d 50 01             	lea    0x1(%eax),%edx
+     371:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     374:	89 c2                	mov    %eax,%edx
+     376:	8b 45 08             	mov    0x8(%ebp),%eax
+     379:	01 c2                	add    %eax,%edx
+     37b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     37f:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     381:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     385:	3c 0a                	cmp    $0xa,%al
+     387:	74 16                	je     39f <gets+0x5f>
+     389:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     38d:	3c 0d                	cmp    $0xd,%al
+     38f:	74 0e                	je     39f <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     391:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     394:	83 c0 01             	add    $0x1,%eax
+     397:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     39a:	7f b3                	jg     34f <gets+0xf>
+     39c:	eb 01                	jmp    39f <gets+0x5f>
+      break;
+     39e:	90                   	nop
+  }
+  buf[i] = '\0';
+     39f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     3a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a5:	01 d0                	add    %edx,%eax
+     3a7:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     3ad:	c9                   	leave
+     3ae:	c3                   	ret
+
+000003af <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     3af:	55                   	push   %ebp
+     3b0:	89 e5                	mov    %esp,%ebp
+     3b2:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     3b5:	83 ec 08             	sub    $0x8,%esp
+     3b8:	6a 00                	push   $0x0
+     3ba:	ff 75 08             	push   0x8(%ebp)
+     3bd:	e8 44 01 00 00       	call   506 <open>
+     3c2:	83 c4 10             	add    $0x10,%esp
+     3c5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     3c8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     3cc:	79 07                	jns    3d5 <stat+0x26>
+    return -1;
+     3ce:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     3d3:	eb 25                	jmp    3fa <stat+0x4b>
+  r = fstat(fd, st);
+     3d5:	83 ec 08             	sub    $0x8,%esp
+     3d8:	ff 75 0c             	push   0xc(%ebp)
+     3db:	ff 75 f4             	push   -0xc(%ebp)
+     3de:	e8 41 01 00 00       	call   524 <fstat>
+     3e3:	83 c4 10             	add    $0x10,%esp
+     3e6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     3e9:	83 ec 0c             	sub    $0xc,%esp
+     3ec:	ff 75 f4             	push   -0xc(%ebp)
+     3ef:	e8 fd 00 00 00       	call   4f1 <close>
+     3f4:	83 c4 10             	add    $0x10,%esp
+  return r;
+     3f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     3fa:	c9                   	leave
+     3fb:	c3                   	ret
+
+000003fc <atoi>:
+
+int
+atoi(const char *s)
+{
+     3fc:	55                   	push   %ebp
+     3fd:	89 e5                	mov    %esp,%ebp
+     3ff:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     402:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     409:	eb 25                	jmp    430 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     40b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     40e:	89 d0                	mov    %edx,%eax
+     410:	c1 e0 02             	shl    $0x2,%eax
+     413:	01 d0                	add    %edx,%eax
+     415:	01 c0                	add    %eax,%eax
+     417:	89 c1                	mov    %eax,%ecx
+     419:	8b 45 08             	mov    0x8(%ebp),%eax
+     41c:	8d 50 01             	lea    0x1(%eax),%edx
+     41f:	89 55 08             	mov    %edx,0x8(%ebp)
+     422:	0f b6 00             	movzbl (%eax),%eax
+     425:	0f be c0             	movsbl %al,%eax
+     428:	01 c8                	add    %ecx,%eax
+     42a:	83 e8 30             	sub    $0x30,%eax
+     42d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     430:	8b 45 08             	mov    0x8(%ebp),%eax
+     433:	0f b6 00             	movzbl (%eax),%eax
+     436:	3c 2f                	cmp    $0x2f,%al
+     438:	7e 0a                	jle    444 <atoi+0x48>
+     43a:	8b 45 08             	mov    0x8(%ebp),%eax
+     43d:	0f b6 00             	movzbl (%eax),%eax
+     440:	3c 39                	cmp    $0x39,%al
+     442:	7e c7                	jle    40b <atoi+0xf>
+  return n;
+     444:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     447:	c9                   	leave
+     448:	c3                   	ret
+
+00000449 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     449:	55                   	push   %ebp
+     44a:	89 e5                	mov    %esp,%ebp
+     44c:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     44f:	8b 45 08             	mov    0x8(%ebp),%eax
+     452:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     455:	8b 45 0c             	mov    0xc(%ebp),%eax
+     458:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     45b:	eb 17                	jmp    474 <memmove+0x2b>
+    *dst++ = *src++;
+     45d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     460:	8d 42 01             	lea    0x1(%edx),%eax
+     463:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     466:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     469:	8d 48 01             	lea    0x1(%eax),%ecx
+     46c:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     46f:	0f b6 12             	movzbl (%edx),%edx
+     472:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     474:	8b 45 10             	mov    0x10(%ebp),%eax
+     477:	8d 50 ff             	lea    -0x1(%eax),%edx
+     47a:	89 55 10             	mov    %edx,0x10(%ebp)
+     47d:	85 c0                	test   %eax,%eax
+     47f:	7f dc                	jg     45d <memmove+0x14>
+  return vdst;
+     481:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     484:	c9                   	leave
+     485:	c3                   	ret
+
+00000486 <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+     486:	83 3d c0 1e 00 00 00 	cmpl   $0x0,0x1ec0
+  jg 2f
+     48d:	7f 2e                	jg     4bd <dosyscall+0x37>
+  jl 1f
+     48f:	7c 29                	jl     4ba <dosyscall+0x34>
+  pushl %eax
+     491:	50                   	push   %eax
+  pushl %ebx
+     492:	53                   	push   %ebx
+  movl $1, %eax
+     493:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     498:	0f a2                	cpuid
+  popl %ebx
+     49a:	5b                   	pop    %ebx
+  popl %eax
+     49b:	58                   	pop    %eax
+  movl $-1, sysmode
+     49c:	c7 05 c0 1e 00 00 ff 	movl   $0xffffffff,0x1ec0
+     4a3:	ff ff ff 
+  testl $CPUID_SEP, %edx
+     4a6:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+     4ac:	74 0c                	je     4ba <dosyscall+0x34>
+  movl $1, sysmode
+     4ae:	c7 05 c0 1e 00 00 01 	movl   $0x1,0x1ec0
+     4b5:	00 00 00 
+  jmp 2f
+     4b8:	eb 03                	jmp    4bd <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+     4ba:	cd 40                	int    $0x40
+  ret
+     4bc:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+     4bd:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+     4bf:	ba c6 04 00 00       	mov    $0x4c6,%edx
+  sysenter
+     4c4:	0f 34                	sysenter
+3:
+  ret
+     4c6:	c3                   	ret
+
+000004c7 <fork>:
+
+SYSCALL(fork)
+     4c7:	b8 01 00 00 00       	mov    $0x1,%eax
+     4cc:	eb b8                	jmp    486 <dosyscall>
+
+000004ce <exit>:
+SYSCALL(exit)
+     4ce:	b8 02 00 00 00       	mov    $0x2,%eax
+     4d3:	eb b1                	jmp    486 <dosyscall>
+
+000004d5 <wait>:
+SYSCALL(wait)
+     4d5:	b8 03 00 00 00       	mov    $0x3,%eax
+     4da:	eb aa                	jmp    486 <dosyscall>
+
+000004dc <pipe>:
+SYSCALL(pipe)
+     4dc:	b8 04 00 00 00       	mov    $0x4,%eax
+     4e1:	eb a3                	jmp    486 <dosyscall>
+
+000004e3 <read>:
+SYSCALL(read)
+     4e3:	b8 05 00 00 00       	mov    $0x5,%eax
+     4e8:	eb 9c                	jmp    486 <dosyscall>
+
+000004ea <write>:
+SYSCALL(write)
+     4ea:	b8 10 00 00 00       	mov    $0x10,%eax
+     4ef:	eb 95                	jmp    486 <dosyscall>
+
+000004f1 <close>:
+SYSCALL(close)
+     4f1:	b8 15 00 00 00       	mov    $0x15,%eax
+     4f6:	eb 8e                	jmp    486 <dosyscall>
+
+000004f8 <kill>:
+SYSCALL(kill)
+     4f8:	b8 06 00 00 00       	mov    $0x6,%eax
+     4fd:	eb 87                	jmp    486 <dosyscall>
+
+000004ff <exec>:
+SYSCALL(exec)
+     4ff:	b8 07 00 00 00       	mov    $0x7,%eax
+     504:	eb 80                	jmp    486 <dosyscall>
+
+00000506 <open>:
+SYSCALL(open)
+     506:	b8 0f 00 00 00       	mov    $0xf,%eax
+     50b:	e9 76 ff ff ff       	jmp    486 <dosyscall>
+
+00000510 <mknod>:
+SYSCALL(mknod)
+     510:	b8 11 00 00 00       	mov    $0x11,%eax
+     515:	e9 6c ff ff ff       	jmp    486 <dosyscall>
+
+0000051a <unlink>:
+SYSCALL(unlink)
+     51a:	b8 12 00 00 00       	mov    $0x12,%eax
+     51f:	e9 62 ff ff ff       	jmp    486 <dosyscall>
+
+00000524 <fstat>:
+SYSCALL(fstat)
+     524:	b8 08 00 00 00       	mov    $0x8,%eax
+     529:	e9 58 ff ff ff       	jmp    486 <dosyscall>
+
+0000052e <link>:
+SYSCALL(link)
+     52e:	b8 13 00 00 00       	mov    $0x13,%eax
+     533:	e9 4e ff ff ff       	jmp    486 <dosyscall>
+
+00000538 <mkdir>:
+SYSCALL(mkdir)
+     538:	b8 14 00 00 00       	mov    $0x14,%eax
+     53d:	e9 44 ff ff ff       	jmp    486 <dosyscall>
+
+00000542 <chdir>:
+SYSCALL(chdir)
+     542:	b8 09 00 00 00       	mov    $0x9,%eax
+     547:	e9 3a ff ff ff       	jmp    486 <dosyscall>
+
+0000054c <dup>:
+SYSCALL(dup)
+     54c:	b8 0a 00 00 00       	mov    $0xa,%eax
+     551:	e9 30 ff ff ff       	jmp    486 <dosyscall>
+
+00000556 <getpid>:
+SYSCALL(getpid)
+     556:	b8 0b 00 00 00       	mov    $0xb,%eax
+     55b:	e9 26 ff ff ff       	jmp    486 <dosyscall>
+
+00000560 <sbrk>:
+SYSCALL(sbrk)
+     560:	b8 0c 00 00 00       	mov    $0xc,%eax
+     565:	e9 1c ff ff ff       	jmp    486 <dosyscall>
+
+0000056a <sleep>:
+SYSCALL(sleep)
+     56a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     56f:	e9 12 ff ff ff       	jmp    486 <dosyscall>
+
+00000574 <uptime>:
+SYSCALL(uptime)
+     574:	b8 0e 00 00 00       	mov    $0xe,%eax
+     579:	e9 08 ff ff ff       	jmp    486 <dosyscall>
+
+0000057e <symlink>:
+SYSCALL(symlink)
+     57e:	b8 16 00 00 00       	mov    $0x16,%eax
+     583:	e9 fe fe ff ff       	jmp    486 <dosyscall>
+
+00000588 <readlink>:
+SYSCALL(readlink)
+     588:	b8 17 00 00 00       	mov    $0x17,%eax
+     58d:	e9 f4 fe ff ff       	jmp    486 <dosyscall>
+
+00000592 <fprot>:
+SYSCALL(fprot)
+     592:	b8 18 00 00 00       	mov    $0x18,%eax
+     597:	e9 ea fe ff ff       	jmp    486 <dosyscall>
+
+0000059c <funprot>:
+SYSCALL(funprot)
+     59c:	b8 19 00 00 00       	mov    $0x19,%eax
+     5a1:	e9 e0 fe ff ff       	jmp    486 <dosyscall>
+
+000005a6 <funlock>:
+SYSCALL(funlock)
+     5a6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5ab:	e9 d6 fe ff ff       	jmp    486 <dosyscall>
+
+000005b0 <mmap>:
+SYSCALL(mmap)
+     5b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5b5:	e9 cc fe ff ff       	jmp    486 <dosyscall>
+
+000005ba <munmap>:
+SYSCALL(munmap)
+     5ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5bf:	e9 c2 fe ff ff       	jmp    486 <dosyscall>
+
+000005c4 <sendfile>:
+SYSCALL(sendfile)
+     5c4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5c9:	e9 b8 fe ff ff       	jmp    486 <dosyscall>
+
+000005ce <readv>:
+SYSCALL(readv)
+     5ce:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5d3:	e9 ae fe ff ff       	jmp    486 <dosyscall>
+
+000005d8 <writev>:
+SYSCALL(writev)
+     5d8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5dd:	e9 a4 fe ff ff       	jmp    486 <dosyscall>
+
+000005e2 <pread>:
+SYSCALL(pread)
+     5e2:	b8 20 00 00 00       	mov    $0x20,%eax
+     5e7:	e9 9a fe ff ff       	jmp    486 <dosyscall>
+
+000005ec <pwrite>:
+SYSCALL(pwrite)
+     5ec:	b8 21 00 00 00       	mov    $0x21,%eax
+     5f1:	e9 90 fe ff ff       	jmp    486 <dosyscall>
+
+000005f6 <lseek>:
+SYSCALL(lseek)
+     5f6:	b8 22 00 00 00       	mov    $0x22,%eax
+     5fb:	e9 86 fe ff ff       	jmp    486 <dosyscall>
+
+00000600 <spawn>:
+SYSCALL(spawn)
+     600:	b8 23 00 00 00       	mov    $0x23,%eax
+     605:	e9 7c fe ff ff       	jmp    486 <dosyscall>
+
+0000060a <setpriority>:
+SYSCALL(setpriority)
+     60a:	b8 24 00 00 00       	mov    $0x24,%eax
+     60f:	e9 72 fe ff ff       	jmp    486 <dosyscall>
+
+00000614 <kthread_create>:
+SYSCALL(kthread_create)
+     614:	b8 25 00 00 00       	mov    $0x25,%eax
+     619:	e9 68 fe ff ff       	jmp    486 <dosyscall>
+
+0000061e <kthread_id>:
+SYSCALL(kthread_id)
+     61e:	b8 26 00 00 00       	mov    $0x26,%eax
+     623:	e9 5e fe ff ff       	jmp    486 <dosyscall>
+
+00000628 <kthread_exit>:
+SYSCALL(kthread_exit)
+     628:	b8 27 00 00 00       	mov    $0x27,%eax
+     62d:	e9 54 fe ff ff       	jmp    486 <dosyscall>
+
+00000632 <kthread_join>:
+SYSCALL(kthread_join)
+     632:	b8 28 00 00 00       	mov    $0x28,%eax
+     637:	e9 4a fe ff ff       	jmp    486 <dosyscall>
+
+0000063c <futex>:
+SYSCALL(futex)
+     63c:	b8 29 00 00 00       	mov    $0x29,%eax
+     641:	e9 40 fe ff ff       	jmp    486 <dosyscall>
+
+00000646 <signal>:
+SYSCALL(signal)
+     646:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     64b:	e9 36 fe ff ff       	jmp    486 <dosyscall>
+
+00000650 <alarm>:
+SYSCALL(alarm)
+     650:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     655:	e9 2c fe ff ff       	jmp    486 <dosyscall>
+
+0000065a <usleep>:
+SYSCALL(usleep)
+     65a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     65f:	e9 22 fe ff ff       	jmp    486 <dosyscall>
+
+00000664 <ioring_setup>:
+SYSCALL(ioring_setup)
+     664:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     669:	e9 18 fe ff ff       	jmp    486 <dosyscall>
+
+0000066e <ioring_enter>:
+SYSCALL(ioring_enter)
+     66e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     673:	e9 0e fe ff ff       	jmp    486 <dosyscall>
+
+00000678 <getrusage>:
+SYSCALL(getrusage)
+     678:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     67d:	e9 04 fe ff ff       	jmp    486 <dosyscall>
+
+00000682 <mount>:
+SYSCALL(mount)
+     682:	b8 30 00 00 00       	mov    $0x30,%eax
+     687:	e9 fa fd ff ff       	jmp    486 <dosyscall>
+
+0000068c <getdents>:
+SYSCALL(getdents)
+     68c:	b8 31 00 00 00       	mov    $0x31,%eax
+     691:	e9 f0 fd ff ff       	jmp    486 <dosyscall>
+
+00000696 <yield>:
+SYSCALL(yield)
+     696:	b8 32 00 00 00       	mov    $0x32,%eax
+     69b:	e9 e6 fd ff ff       	jmp    486 <dosyscall>
+
+000006a0 <ncpu>:
+SYSCALL(ncpu)
+     6a0:	b8 33 00 00 00       	mov    $0x33,%eax
+     6a5:	e9 dc fd ff ff       	jmp    486 <dosyscall>
+
+000006aa <fallocate>:
+SYSCALL(fallocate)
+     6aa:	b8 34 00 00 00       	mov    $0x34,%eax
+     6af:	e9 d2 fd ff ff       	jmp    486 <dosyscall>
+
+000006b4 <ftruncate>:
+SYSCALL(ftruncate)
+     6b4:	b8 35 00 00 00       	mov    $0x35,%eax
+     6b9:	e9 c8 fd ff ff       	jmp    486 <dosyscall>
+
+000006be <fsync>:
+SYSCALL(fsync)
+     6be:	b8 36 00 00 00       	mov    $0x36,%eax
+     6c3:	e9 be fd ff ff       	jmp    486 <dosyscall>
+
+000006c8 <fdatasync>:
+SYSCALL(fdatasync)
+     6c8:	b8 37 00 00 00       	mov    $0x37,%eax
+     6cd:	e9 b4 fd ff ff       	jmp    486 <dosyscall>
+
+000006d2 <poll>:
+SYSCALL(poll)
+     6d2:	b8 38 00 00 00       	mov    $0x38,%eax
+     6d7:	e9 aa fd ff ff       	jmp    486 <dosyscall>
+
+000006dc <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+     6dc:	55                   	push   %ebp
+     6dd:	89 e5                	mov    %esp,%ebp
+     6df:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+     6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e5:	8b 40 04             	mov    0x4(%eax),%eax
+     6e8:	85 c0                	test   %eax,%eax
+     6ea:	7e 1f                	jle    70b <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+     6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ef:	8b 50 04             	mov    0x4(%eax),%edx
+     6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     6f5:	8d 48 08             	lea    0x8(%eax),%ecx
+     6f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     6fb:	8b 00                	mov    (%eax),%eax
+     6fd:	83 ec 04             	sub    $0x4,%esp
+     700:	52                   	push   %edx
+     701:	51                   	push   %ecx
+     702:	50                   	push   %eax
+     703:	e8 d0 fe ff ff       	call   5d8 <writev>
+     708:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+     70b:	8b 45 08             	mov    0x8(%ebp),%eax
+     70e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+     715:	8b 45 08             	mov    0x8(%ebp),%eax
+     718:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+     71f:	00 00 00 
+}
+     722:	90                   	nop
+     723:	c9                   	leave
+     724:	c3                   	ret
+
+00000725 <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+     725:	55                   	push   %ebp
+     726:	89 e5                	mov    %esp,%ebp
+     728:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+     72b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     72f:	0f 84 94 00 00 00    	je     7c9 <put+0xa4>
+    return;
+  if(o->n > 0){
+     735:	8b 45 08             	mov    0x8(%ebp),%eax
+     738:	8b 40 04             	mov    0x4(%eax),%eax
+     73b:	85 c0                	test   %eax,%eax
+     73d:	7e 40                	jle    77f <put+0x5a>
+    v = &o->iov[o->n-1];
+     73f:	8b 45 08             	mov    0x8(%ebp),%eax
+     742:	8b 40 04             	mov    0x4(%eax),%eax
+     745:	83 e8 01             	sub    $0x1,%eax
+     748:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     74f:	8b 45 08             	mov    0x8(%ebp),%eax
+     752:	01 d0                	add    %edx,%eax
+     754:	83 c0 08             	add    $0x8,%eax
+     757:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+     75a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     75d:	8b 10                	mov    (%eax),%edx
+     75f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     762:	8b 40 04             	mov    0x4(%eax),%eax
+     765:	01 d0                	add    %edx,%eax
+     767:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     76a:	75 13                	jne    77f <put+0x5a>
+      v->iov_len += n;
+     76c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     76f:	8b 50 04             	mov    0x4(%eax),%edx
+     772:	8b 45 10             	mov    0x10(%ebp),%eax
+     775:	01 c2                	add    %eax,%edx
+     777:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     77a:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+     77d:	eb 4b                	jmp    7ca <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+     77f:	8b 45 08             	mov    0x8(%ebp),%eax
+     782:	8b 40 04             	mov    0x4(%eax),%eax
+     785:	83 f8 10             	cmp    $0x10,%eax
+     788:	75 0e                	jne    798 <put+0x73>
+    flush(o);
+     78a:	83 ec 0c             	sub    $0xc,%esp
+     78d:	ff 75 08             	push   0x8(%ebp)
+     790:	e8 47 ff ff ff       	call   6dc <flush>
+     795:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+     798:	8b 45 08             	mov    0x8(%ebp),%eax
+     79b:	8b 50 04             	mov    0x4(%eax),%edx
+     79e:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     7a4:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+     7a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ab:	8b 50 04             	mov    0x4(%eax),%edx
+     7ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7b4:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+     7b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     7bb:	8b 40 04             	mov    0x4(%eax),%eax
+     7be:	8d 50 01             	lea    0x1(%eax),%edx
+     7c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c4:	89 50 04             	mov    %edx,0x4(%eax)
+     7c7:	eb 01                	jmp    7ca <put+0xa5>
+    return;
+     7c9:	90                   	nop
+}
+     7ca:	c9                   	leave
+     7cb:	c3                   	ret
+
+000007cc <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+     7cc:	55                   	push   %ebp
+     7cd:	89 e5                	mov    %esp,%ebp
+     7cf:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+     7d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d5:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     7db:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7de:	01 d0                	add    %edx,%eax
+     7e0:	3d 80 00 00 00       	cmp    $0x80,%eax
+     7e5:	77 0b                	ja     7f2 <room+0x26>
+     7e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ea:	8b 40 04             	mov    0x4(%eax),%eax
+     7ed:	83 f8 10             	cmp    $0x10,%eax
+     7f0:	75 0e                	jne    800 <room+0x34>
+    flush(o);
+     7f2:	83 ec 0c             	sub    $0xc,%esp
+     7f5:	ff 75 08             	push   0x8(%ebp)
+     7f8:	e8 df fe ff ff       	call   6dc <flush>
+     7fd:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+     800:	8b 45 08             	mov    0x8(%ebp),%eax
+     803:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+     809:	8b 45 08             	mov    0x8(%ebp),%eax
+     80c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     812:	01 d0                	add    %edx,%eax
+}
+     814:	c9                   	leave
+     815:	c3                   	ret
+
+00000816 <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+     816:	55                   	push   %ebp
+     817:	89 e5                	mov    %esp,%ebp
+     819:	83 ec 28             	sub    $0x28,%esp
+     81c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     81f:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+     822:	83 ec 08             	sub    $0x8,%esp
+     825:	6a 01                	push   $0x1
+     827:	ff 75 08             	push   0x8(%ebp)
+     82a:	e8 9d ff ff ff       	call   7cc <room>
+     82f:	83 c4 10             	add    $0x10,%esp
+     832:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+     835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     838:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+     83c:	88 10                	mov    %dl,(%eax)
+  o->used++;
+     83e:	8b 45 08             	mov    0x8(%ebp),%eax
+     841:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+     847:	8d 50 01             	lea    0x1(%eax),%edx
+     84a:	8b 45 08             	mov    0x8(%ebp),%eax
+     84d:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+     853:	83 ec 04             	sub    $0x4,%esp
+     856:	6a 01                	push   $0x1
+     858:	ff 75 f4             	push   -0xc(%ebp)
+     85b:	ff 75 08             	push   0x8(%ebp)
+     85e:	e8 c2 fe ff ff       	call   725 <put>
+     863:	83 c4 10             	add    $0x10,%esp
+}
+     866:	90                   	nop
+     867:	c9                   	leave
+     868:	c3                   	ret
+
+00000869 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     869:	55                   	push   %ebp
+     86a:	89 e5                	mov    %esp,%ebp
+     86c:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+     86f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     876:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     87a:	74 17                	je     893 <printint+0x2a>
+     87c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     880:	79 11                	jns    893 <printint+0x2a>
+    neg = 1;
+     882:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     889:	8b 45 0c             	mov    0xc(%ebp),%eax
+     88c:	f7 d8                	neg    %eax
+     88e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     891:	eb 06                	jmp    899 <printint+0x30>
+  } else {
+    x = xx;
+     893:	8b 45 0c             	mov    0xc(%ebp),%eax
+     896:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     899:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8a0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8a3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8a6:	ba 00 00 00 00       	mov    $0x0,%edx
+     8ab:	f7 f1                	div    %ecx
+     8ad:	89 d1                	mov    %edx,%ecx
+     8af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8b2:	8d 50 01             	lea    0x1(%eax),%edx
+     8b5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8b8:	0f b6 91 c4 1e 00 00 	movzbl 0x1ec4(%ecx),%edx
+     8bf:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     8c3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8c6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8c9:	ba 00 00 00 00       	mov    $0x0,%edx
+     8ce:	f7 f1                	div    %ecx
+     8d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     8d7:	75 c7                	jne    8a0 <printint+0x37>
+  if(neg)
+     8d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     8dd:	74 0e                	je     8ed <printint+0x84>
+    buf[i++] = '-';
+     8df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8e2:	8d 50 01             	lea    0x1(%eax),%edx
+     8e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8e8:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+     8ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8f0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+     8f3:	83 ec 08             	sub    $0x8,%esp
+     8f6:	ff 75 e8             	push   -0x18(%ebp)
+     8f9:	ff 75 08             	push   0x8(%ebp)
+     8fc:	e8 cb fe ff ff       	call   7cc <room>
+     901:	83 c4 10             	add    $0x10,%esp
+     904:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+     907:	eb 1d                	jmp    926 <printint+0xbd>
+    p[n-1-i] = buf[i];
+     909:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     90c:	83 e8 01             	sub    $0x1,%eax
+     90f:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     912:	89 c2                	mov    %eax,%edx
+     914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     917:	01 c2                	add    %eax,%edx
+     919:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+     91c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     91f:	01 c8                	add    %ecx,%eax
+     921:	0f b6 00             	movzbl (%eax),%eax
+     924:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+     926:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     92a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     92e:	79 d9                	jns    909 <printint+0xa0>
+  o->used += n;
+     930:	8b 45 08             	mov    0x8(%ebp),%eax
+     933:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+     939:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     93c:	01 c2                	add    %eax,%edx
+     93e:	8b 45 08             	mov    0x8(%ebp),%eax
+     941:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+     947:	83 ec 04             	sub    $0x4,%esp
+     94a:	ff 75 e8             	push   -0x18(%ebp)
+     94d:	ff 75 e4             	push   -0x1c(%ebp)
+     950:	ff 75 08             	push   0x8(%ebp)
+     953:	e8 cd fd ff ff       	call   725 <put>
+     958:	83 c4 10             	add    $0x10,%esp
+}
+     95b:	90                   	nop
+     95c:	c9                   	leave
+     95d:	c3                   	ret
+
+0000095e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     95e:	55                   	push   %ebp
+     95f:	89 e5                	mov    %esp,%ebp
+     961:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+     967:	8b 45 08             	mov    0x8(%ebp),%eax
+     96a:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+     970:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+     977:	00 00 00 
+  o.used = 0;
+     97a:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     981:	00 00 00 
+  state = 0;
+     984:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     98b:	8d 45 0c             	lea    0xc(%ebp),%eax
+     98e:	83 c0 04             	add    $0x4,%eax
+     991:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+     994:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     99b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     9a2:	e9 82 01 00 00       	jmp    b29 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+     9a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9ad:	01 d0                	add    %edx,%eax
+     9af:	0f b6 00             	movzbl (%eax),%eax
+     9b2:	0f be c0             	movsbl %al,%eax
+     9b5:	25 ff 00 00 00       	and    $0xff,%eax
+     9ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+     9bd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     9c1:	75 38                	jne    9fb <printf+0x9d>
+      if(c == '%'){
+     9c3:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     9c7:	0f 85 58 01 00 00    	jne    b25 <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+     9cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9d0:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     9d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     9d6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     9d9:	01 ca                	add    %ecx,%edx
+     9db:	83 ec 04             	sub    $0x4,%esp
+     9de:	50                   	push   %eax
+     9df:	52                   	push   %edx
+     9e0:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     9e6:	50                   	push   %eax
+     9e7:	e8 39 fd ff ff       	call   725 <put>
+     9ec:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+     9ef:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+     9f6:	e9 2a 01 00 00       	jmp    b25 <printf+0x1c7>
+      }
+    } else if(state == '%'){
+     9fb:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+     9ff:	0f 85 20 01 00 00    	jne    b25 <printf+0x1c7>
+      if(c == 'd'){
+     a05:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+     a09:	75 22                	jne    a2d <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+     a0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a0e:	8b 00                	mov    (%eax),%eax
+     a10:	6a 01                	push   $0x1
+     a12:	6a 0a                	push   $0xa
+     a14:	50                   	push   %eax
+     a15:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a1b:	50                   	push   %eax
+     a1c:	e8 48 fe ff ff       	call   869 <printint>
+     a21:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a24:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a28:	e9 e8 00 00 00       	jmp    b15 <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+     a2d:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+     a31:	74 06                	je     a39 <printf+0xdb>
+     a33:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+     a37:	75 22                	jne    a5b <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+     a39:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a3c:	8b 00                	mov    (%eax),%eax
+     a3e:	6a 00                	push   $0x0
+     a40:	6a 10                	push   $0x10
+     a42:	50                   	push   %eax
+     a43:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a49:	50                   	push   %eax
+     a4a:	e8 1a fe ff ff       	call   869 <printint>
+     a4f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a52:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     a56:	e9 ba 00 00 00       	jmp    b15 <printf+0x1b7>
+      } else if(c == 's'){
+     a5b:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+     a5f:	75 3f                	jne    aa0 <printf+0x142>
+        s = (char*)*ap;
+     a61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a64:	8b 00                	mov    (%eax),%eax
+     a66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     a69:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+     a6d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a71:	75 07                	jne    a7a <printf+0x11c>
+          s = "(null)";
+     a73:	c7 45 f4 ce 17 00 00 	movl   $0x17ce,-0xc(%ebp)
+        put(&o, s, strlen(s));
+     a7a:	83 ec 0c             	sub    $0xc,%esp
+     a7d:	ff 75 f4             	push   -0xc(%ebp)
+     a80:	e8 47 f8 ff ff       	call   2cc <strlen>
+     a85:	83 c4 10             	add    $0x10,%esp
+     a88:	83 ec 04             	sub    $0x4,%esp
+     a8b:	50                   	push   %eax
+     a8c:	ff 75 f4             	push   -0xc(%ebp)
+     a8f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     a95:	50                   	push   %eax
+     a96:	e8 8a fc ff ff       	call   725 <put>
+     a9b:	83 c4 10             	add    $0x10,%esp
+     a9e:	eb 75                	jmp    b15 <printf+0x1b7>
+      } else if(c == 'c'){
+     aa0:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+     aa4:	75 21                	jne    ac7 <printf+0x169>
+        putc(&o, *ap);
+     aa6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aa9:	8b 00                	mov    (%eax),%eax
+     aab:	0f be c0             	movsbl %al,%eax
+     aae:	83 ec 08             	sub    $0x8,%esp
+     ab1:	50                   	push   %eax
+     ab2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     ab8:	50                   	push   %eax
+     ab9:	e8 58 fd ff ff       	call   816 <putc>
+     abe:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ac1:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+     ac5:	eb 4e                	jmp    b15 <printf+0x1b7>
+      } else if(c == '%'){
+     ac7:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+     acb:	75 1b                	jne    ae8 <printf+0x18a>
+        putc(&o, c);
+     acd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ad0:	0f be c0             	movsbl %al,%eax
+     ad3:	83 ec 08             	sub    $0x8,%esp
+     ad6:	50                   	push   %eax
+     ad7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     add:	50                   	push   %eax
+     ade:	e8 33 fd ff ff       	call   816 <putc>
+     ae3:	83 c4 10             	add    $0x10,%esp
+     ae6:	eb 2d                	jmp    b15 <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+     ae8:	83 ec 08             	sub    $0x8,%esp
+     aeb:	6a 25                	push   $0x25
+     aed:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     af3:	50                   	push   %eax
+     af4:	e8 1d fd ff ff       	call   816 <putc>
+     af9:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+     afc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     aff:	0f be c0             	movsbl %al,%eax
+     b02:	83 ec 08             	sub    $0x8,%esp
+     b05:	50                   	push   %eax
+     b06:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b0c:	50                   	push   %eax
+     b0d:	e8 04 fd ff ff       	call   816 <putc>
+     b12:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b15:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+     b1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b1f:	83 c0 01             	add    $0x1,%eax
+     b22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b25:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b29:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b2f:	01 d0                	add    %edx,%eax
+     b31:	0f b6 00             	movzbl (%eax),%eax
+     b34:	84 c0                	test   %al,%al
+     b36:	0f 85 6b fe ff ff    	jne    9a7 <printf+0x49>
+    }
+  }
+  if(state == 0)
+     b3c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b40:	75 22                	jne    b64 <printf+0x206>
+    put(&o, fmt + start, i - start);
+     b42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b45:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     b48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     b4b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     b4e:	01 ca                	add    %ecx,%edx
+     b50:	83 ec 04             	sub    $0x4,%esp
+     b53:	50                   	push   %eax
+     b54:	52                   	push   %edx
+     b55:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b5b:	50                   	push   %eax
+     b5c:	e8 c4 fb ff ff       	call   725 <put>
+     b61:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+     b64:	83 ec 0c             	sub    $0xc,%esp
+     b67:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+     b6d:	50                   	push   %eax
+     b6e:	e8 69 fb ff ff       	call   6dc <flush>
+     b73:	83 c4 10             	add    $0x10,%esp
+}
+     b76:	90                   	nop
+     b77:	c9                   	leave
+     b78:	c3                   	ret
+
+00000b79 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+     b79:	55                   	push   %ebp
+     b7a:	89 e5                	mov    %esp,%ebp
+     b7c:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+     b7f:	8b 55 08             	mov    0x8(%ebp),%edx
+     b82:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b88:	f0 87 02             	lock xchg %eax,(%edx)
+     b8b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+     b8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+     b91:	c9                   	leave
+     b92:	c3                   	ret
+
+00000b93 <lock>:
+{
+     b93:	55                   	push   %ebp
+     b94:	89 e5                	mov    %esp,%ebp
+     b96:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+     b99:	a1 84 1f 00 00       	mov    0x1f84,%eax
+     b9e:	85 c0                	test   %eax,%eax
+     ba0:	74 09                	je     bab <lock+0x18>
+     ba2:	a1 84 1f 00 00       	mov    0x1f84,%eax
+     ba7:	ff d0                	call   *%eax
+     ba9:	eb 05                	jmp    bb0 <lock+0x1d>
+     bab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bb0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+     bb3:	90                   	nop
+     bb4:	83 ec 08             	sub    $0x8,%esp
+     bb7:	6a 01                	push   $0x1
+     bb9:	68 bc 1f 00 00       	push   $0x1fbc
+     bbe:	e8 b6 ff ff ff       	call   b79 <xchg>
+     bc3:	83 c4 10             	add    $0x10,%esp
+     bc6:	85 c0                	test   %eax,%eax
+     bc8:	75 ea                	jne    bb4 <lock+0x21>
+  return pin;
+     bca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     bcd:	c9                   	leave
+     bce:	c3                   	ret
+
+00000bcf <unlock>:
+{
+     bcf:	55                   	push   %ebp
+     bd0:	89 e5                	mov    %esp,%ebp
+     bd2:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+     bd5:	6a 00                	push   $0x0
+     bd7:	68 bc 1f 00 00       	push   $0x1fbc
+     bdc:	e8 98 ff ff ff       	call   b79 <xchg>
+     be1:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+     be4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     be8:	78 10                	js     bfa <unlock+0x2b>
+    mallocunpin(pin);
+     bea:	a1 88 1f 00 00       	mov    0x1f88,%eax
+     bef:	83 ec 0c             	sub    $0xc,%esp
+     bf2:	ff 75 08             	push   0x8(%ebp)
+     bf5:	ff d0                	call   *%eax
+     bf7:	83 c4 10             	add    $0x10,%esp
+}
+     bfa:	90                   	nop
+     bfb:	c9                   	leave
+     bfc:	c3                   	ret
+
+00000bfd <sizeclass>:
+{
+     bfd:	55                   	push   %ebp
+     bfe:	89 e5                	mov    %esp,%ebp
+     c00:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+     c03:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     c0a:	eb 1c                	jmp    c28 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+     c0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c0f:	ba 02 00 00 00       	mov    $0x2,%edx
+     c14:	89 c1                	mov    %eax,%ecx
+     c16:	d3 e2                	shl    %cl,%edx
+     c18:	89 d0                	mov    %edx,%eax
+     c1a:	3b 45 08             	cmp    0x8(%ebp),%eax
+     c1d:	72 05                	jb     c24 <sizeclass+0x27>
+      return c;
+     c1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c22:	eb 0f                	jmp    c33 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+     c24:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     c28:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+     c2c:	7e de                	jle    c0c <sizeclass+0xf>
+  return -1;
+     c2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     c33:	c9                   	leave
+     c34:	c3                   	ret
+
+00000c35 <bigfree>:
+{
+     c35:	55                   	push   %ebp
+     c36:	89 e5                	mov    %esp,%ebp
+     c38:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c3b:	a1 94 1f 00 00       	mov    0x1f94,%eax
+     c40:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     c43:	eb 24                	jmp    c69 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c48:	8b 00                	mov    (%eax),%eax
+     c4a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     c4d:	72 12                	jb     c61 <bigfree+0x2c>
+     c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c52:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     c55:	72 24                	jb     c7b <bigfree+0x46>
+     c57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c5a:	8b 00                	mov    (%eax),%eax
+     c5c:	39 45 08             	cmp    %eax,0x8(%ebp)
+     c5f:	72 1a                	jb     c7b <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c64:	8b 00                	mov    (%eax),%eax
+     c66:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     c69:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     c6f:	73 d4                	jae    c45 <bigfree+0x10>
+     c71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c74:	8b 00                	mov    (%eax),%eax
+     c76:	39 45 08             	cmp    %eax,0x8(%ebp)
+     c79:	73 ca                	jae    c45 <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+     c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7e:	8b 40 04             	mov    0x4(%eax),%eax
+     c81:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     c88:	8b 45 08             	mov    0x8(%ebp),%eax
+     c8b:	01 c2                	add    %eax,%edx
+     c8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c90:	8b 00                	mov    (%eax),%eax
+     c92:	39 c2                	cmp    %eax,%edx
+     c94:	75 24                	jne    cba <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+     c96:	8b 45 08             	mov    0x8(%ebp),%eax
+     c99:	8b 50 04             	mov    0x4(%eax),%edx
+     c9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c9f:	8b 00                	mov    (%eax),%eax
+     ca1:	8b 40 04             	mov    0x4(%eax),%eax
+     ca4:	01 c2                	add    %eax,%edx
+     ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ca9:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     cac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     caf:	8b 00                	mov    (%eax),%eax
+     cb1:	8b 10                	mov    (%eax),%edx
+     cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb6:	89 10                	mov    %edx,(%eax)
+     cb8:	eb 0a                	jmp    cc4 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+     cba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cbd:	8b 10                	mov    (%eax),%edx
+     cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc2:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     cc4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cc7:	8b 40 04             	mov    0x4(%eax),%eax
+     cca:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     cd1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cd4:	01 d0                	add    %edx,%eax
+     cd6:	39 45 08             	cmp    %eax,0x8(%ebp)
+     cd9:	75 20                	jne    cfb <bigfree+0xc6>
+    p->s.size += bp->s.size;
+     cdb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cde:	8b 50 04             	mov    0x4(%eax),%edx
+     ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce4:	8b 40 04             	mov    0x4(%eax),%eax
+     ce7:	01 c2                	add    %eax,%edx
+     ce9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cec:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     cef:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf2:	8b 10                	mov    (%eax),%edx
+     cf4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cf7:	89 10                	mov    %edx,(%eax)
+     cf9:	eb 08                	jmp    d03 <bigfree+0xce>
+    p->s.ptr = bp;
+     cfb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+     d01:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     d03:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d06:	a3 94 1f 00 00       	mov    %eax,0x1f94
+}
+     d0b:	90                   	nop
+     d0c:	c9                   	leave
+     d0d:	c3                   	ret
+
+00000d0e <free>:
+{
+     d0e:	55                   	push   %ebp
+     d0f:	89 e5                	mov    %esp,%ebp
+     d11:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+     d14:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d18:	74 68                	je     d82 <free+0x74>
+  bp = (Header*)ap - 1;
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1d:	83 e8 08             	sub    $0x8,%eax
+     d20:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+     d23:	e8 6b fe ff ff       	call   b93 <lock>
+     d28:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+     d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d2e:	8b 40 04             	mov    0x4(%eax),%eax
+     d31:	83 ec 0c             	sub    $0xc,%esp
+     d34:	50                   	push   %eax
+     d35:	e8 c3 fe ff ff       	call   bfd <sizeclass>
+     d3a:	83 c4 10             	add    $0x10,%esp
+     d3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     d40:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d44:	78 1e                	js     d64 <free+0x56>
+    bp->s.ptr = classfree[c];
+     d46:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d49:	8b 14 85 98 1f 00 00 	mov    0x1f98(,%eax,4),%edx
+     d50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d53:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+     d55:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d58:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     d5b:	89 14 85 98 1f 00 00 	mov    %edx,0x1f98(,%eax,4)
+     d62:	eb 0e                	jmp    d72 <free+0x64>
+    bigfree(bp);
+     d64:	83 ec 0c             	sub    $0xc,%esp
+     d67:	ff 75 f4             	push   -0xc(%ebp)
+     d6a:	e8 c6 fe ff ff       	call   c35 <bigfree>
+     d6f:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+     d72:	83 ec 0c             	sub    $0xc,%esp
+     d75:	ff 75 f0             	push   -0x10(%ebp)
+     d78:	e8 52 fe ff ff       	call   bcf <unlock>
+     d7d:	83 c4 10             	add    $0x10,%esp
+     d80:	eb 01                	jmp    d83 <free+0x75>
+    return;
+     d82:	90                   	nop
+}
+     d83:	c9                   	leave
+     d84:	c3                   	ret
+
+00000d85 <morecore>:
+{
+     d85:	55                   	push   %ebp
+     d86:	89 e5                	mov    %esp,%ebp
+     d88:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+     d8b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     d92:	77 07                	ja     d9b <morecore+0x16>
+    nu = 4096;
+     d94:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d9e:	c1 e0 03             	shl    $0x3,%eax
+     da1:	83 ec 0c             	sub    $0xc,%esp
+     da4:	50                   	push   %eax
+     da5:	e8 b6 f7 ff ff       	call   560 <sbrk>
+     daa:	83 c4 10             	add    $0x10,%esp
+     dad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     db0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     db4:	75 07                	jne    dbd <morecore+0x38>
+    return 0;
+     db6:	b8 00 00 00 00       	mov    $0x0,%eax
+     dbb:	eb 22                	jmp    ddf <morecore+0x5a>
+  hp = (Header*)p;
+     dbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     dc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+     dc9:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+     dcc:	83 ec 0c             	sub    $0xc,%esp
+     dcf:	ff 75 f0             	push   -0x10(%ebp)
+     dd2:	e8 5e fe ff ff       	call   c35 <bigfree>
+     dd7:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     dda:	a1 94 1f 00 00       	mov    0x1f94,%eax
+}
+     ddf:	c9                   	leave
+     de0:	c3                   	ret
+
+00000de1 <bigalloc>:
+{
+     de1:	55                   	push   %ebp
+     de2:	89 e5                	mov    %esp,%ebp
+     de4:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+     de7:	a1 94 1f 00 00       	mov    0x1f94,%eax
+     dec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     def:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     df3:	75 23                	jne    e18 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+     df5:	c7 45 f0 8c 1f 00 00 	movl   $0x1f8c,-0x10(%ebp)
+     dfc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dff:	a3 94 1f 00 00       	mov    %eax,0x1f94
+     e04:	a1 94 1f 00 00       	mov    0x1f94,%eax
+     e09:	a3 8c 1f 00 00       	mov    %eax,0x1f8c
+    base.s.size = 0;
+     e0e:	c7 05 90 1f 00 00 00 	movl   $0x0,0x1f90
+     e15:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e18:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e1b:	8b 00                	mov    (%eax),%eax
+     e1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     e20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e23:	8b 40 04             	mov    0x4(%eax),%eax
+     e26:	3b 45 08             	cmp    0x8(%ebp),%eax
+     e29:	72 4a                	jb     e75 <bigalloc+0x94>
+      if(p->s.size == nunits)
+     e2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e2e:	8b 40 04             	mov    0x4(%eax),%eax
+     e31:	39 45 08             	cmp    %eax,0x8(%ebp)
+     e34:	75 0c                	jne    e42 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+     e36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e39:	8b 10                	mov    (%eax),%edx
+     e3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e3e:	89 10                	mov    %edx,(%eax)
+     e40:	eb 26                	jmp    e68 <bigalloc+0x87>
+        p->s.size -= nunits;
+     e42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e45:	8b 40 04             	mov    0x4(%eax),%eax
+     e48:	2b 45 08             	sub    0x8(%ebp),%eax
+     e4b:	89 c2                	mov    %eax,%edx
+     e4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e50:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     e53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e56:	8b 40 04             	mov    0x4(%eax),%eax
+     e59:	c1 e0 03             	shl    $0x3,%eax
+     e5c:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     e5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e62:	8b 55 08             	mov    0x8(%ebp),%edx
+     e65:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+     e68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e6b:	a3 94 1f 00 00       	mov    %eax,0x1f94
+      return p;
+     e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e73:	eb 3b                	jmp    eb0 <bigalloc+0xcf>
+    if(p == freep)
+     e75:	a1 94 1f 00 00       	mov    0x1f94,%eax
+     e7a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     e7d:	75 1e                	jne    e9d <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+     e7f:	83 ec 0c             	sub    $0xc,%esp
+     e82:	ff 75 08             	push   0x8(%ebp)
+     e85:	e8 fb fe ff ff       	call   d85 <morecore>
+     e8a:	83 c4 10             	add    $0x10,%esp
+     e8d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e90:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e94:	75 07                	jne    e9d <bigalloc+0xbc>
+        return 0;
+     e96:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9b:	eb 13                	jmp    eb0 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ea3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea6:	8b 00                	mov    (%eax),%eax
+     ea8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     eab:	e9 70 ff ff ff       	jmp    e20 <bigalloc+0x3f>
+}
+     eb0:	c9                   	leave
+     eb1:	c3                   	ret
+
+00000eb2 <alloc>:
+alloc(uint nbytes)
+{
+     eb2:	55                   	push   %ebp
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+     ebb:	83 c0 07             	add    $0x7,%eax
+     ebe:	c1 e8 03             	shr    $0x3,%eax
+     ec1:	83 c0 01             	add    $0x1,%eax
+     ec4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+     ec7:	ff 75 f4             	push   -0xc(%ebp)
+     eca:	e8 2e fd ff ff       	call   bfd <sizeclass>
+     ecf:	83 c4 04             	add    $0x4,%esp
+     ed2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ed5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ed9:	79 2c                	jns    f07 <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+     edb:	83 ec 0c             	sub    $0xc,%esp
+     ede:	ff 75 f4             	push   -0xc(%ebp)
+     ee1:	e8 fb fe ff ff       	call   de1 <bigalloc>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     eec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     ef0:	75 0a                	jne    efc <alloc+0x4a>
+      return 0;
+     ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef7:	e9 c8 00 00 00       	jmp    fc4 <alloc+0x112>
+    return (void*)(p + 1);
+     efc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     eff:	83 c0 08             	add    $0x8,%eax
+     f02:	e9 bd 00 00 00       	jmp    fc4 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+     f07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f0a:	8b 04 85 98 1f 00 00 	mov    0x1f98(,%eax,4),%eax
+     f11:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f14:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f18:	74 1a                	je     f34 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+     f1a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f1d:	8b 10                	mov    (%eax),%edx
+     f1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f22:	89 14 85 98 1f 00 00 	mov    %edx,0x1f98(,%eax,4)
+    return (void*)(p + 1);
+     f29:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f2c:	83 c0 08             	add    $0x8,%eax
+     f2f:	e9 90 00 00 00       	jmp    fc4 <alloc+0x112>
+  }
+  nunits = 2 << c;
+     f34:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f37:	ba 02 00 00 00       	mov    $0x2,%edx
+     f3c:	89 c1                	mov    %eax,%ecx
+     f3e:	d3 e2                	shl    %cl,%edx
+     f40:	89 d0                	mov    %edx,%eax
+     f42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+     f45:	a1 b4 1f 00 00       	mov    0x1fb4,%eax
+     f4a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f4d:	c1 e2 03             	shl    $0x3,%edx
+     f50:	01 d0                	add    %edx,%eax
+     f52:	8b 15 b8 1f 00 00    	mov    0x1fb8,%edx
+     f58:	39 c2                	cmp    %eax,%edx
+     f5a:	73 3f                	jae    f9b <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+     f5c:	83 ec 0c             	sub    $0xc,%esp
+     f5f:	68 00 08 00 00       	push   $0x800
+     f64:	e8 78 fe ff ff       	call   de1 <bigalloc>
+     f69:	83 c4 10             	add    $0x10,%esp
+     f6c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f6f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f73:	75 07                	jne    f7c <alloc+0xca>
+      return 0;
+     f75:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7a:	eb 48                	jmp    fc4 <alloc+0x112>
+    bump = (char*)p;
+     f7c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f7f:	a3 b4 1f 00 00       	mov    %eax,0x1fb4
+    bumpend = (char*)(p + p->s.size);
+     f84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f87:	8b 40 04             	mov    0x4(%eax),%eax
+     f8a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f91:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f94:	01 d0                	add    %edx,%eax
+     f96:	a3 b8 1f 00 00       	mov    %eax,0x1fb8
+  }
+  p = (Header*)bump;
+     f9b:	a1 b4 1f 00 00       	mov    0x1fb4,%eax
+     fa0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+     fa3:	a1 b4 1f 00 00       	mov    0x1fb4,%eax
+     fa8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fab:	c1 e2 03             	shl    $0x3,%edx
+     fae:	01 d0                	add    %edx,%eax
+     fb0:	a3 b4 1f 00 00       	mov    %eax,0x1fb4
+  p->s.size = nunits;
+     fb5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fbb:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+     fbe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc1:	83 c0 08             	add    $0x8,%eax
+}
+     fc4:	c9                   	leave
+     fc5:	c3                   	ret
+
+00000fc6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fc6:	55                   	push   %ebp
+     fc7:	89 e5                	mov    %esp,%ebp
+     fc9:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+     fcc:	e8 c2 fb ff ff       	call   b93 <lock>
+     fd1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+     fd4:	83 ec 0c             	sub    $0xc,%esp
+     fd7:	ff 75 08             	push   0x8(%ebp)
+     fda:	e8 d3 fe ff ff       	call   eb2 <alloc>
+     fdf:	83 c4 10             	add    $0x10,%esp
+     fe2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+     fe5:	83 ec 0c             	sub    $0xc,%esp
+     fe8:	ff 75 f4             	push   -0xc(%ebp)
+     feb:	e8 df fb ff ff       	call   bcf <unlock>
+     ff0:	83 c4 10             	add    $0x10,%esp
+  return p;
+     ff3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     ff6:	c9                   	leave
+     ff7:	c3                   	ret
+
+00000ff8 <xchg>:
+}
+
+// Switch from cur, whose state says what becomes of it, to the
+// first queued thread, or to the worker's idle thread if there is
+// none.  The caller has locked the run queue and set cur->busy;
+// both are undone by the time cur runs again.
+     ff8:	55                   	push   %ebp
+     ff9:	89 e5                	mov    %esp,%ebp
+     ffb:	83 ec 10             	sub    $0x10,%esp
+static void
+sched(struct task *cur)
+{
+  struct task *t;
+     ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+    1001:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1004:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1007:	f0 87 02             	lock xchg %eax,(%edx)
+    100a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+  if((t = dequeue()) == 0)
+    t = &cur->w->idle;
+  t->u.state = T_RUNNING;
+    100d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  if(t != cur){
+    1010:	c9                   	leave
+    1011:	c3                   	ret
+
+00001012 <current>:
+{
+    1012:	55                   	push   %ebp
+    1013:	89 e5                	mov    %esp,%ebp
+    1015:	83 ec 10             	sub    $0x10,%esp
+  asm volatile("movl %%esp, %0" : "=r" (sp));
+    1018:	89 e0                	mov    %esp,%eax
+    101a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  return *(struct task**)(sp & ~(STACK_SIZE-1));
+    101d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1020:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1025:	8b 00                	mov    (%eax),%eax
+}
+    1027:	c9                   	leave
+    1028:	c3                   	ret
+
+00001029 <lock>:
+{
+    1029:	55                   	push   %ebp
+    102a:	89 e5                	mov    %esp,%ebp
+  while(xchg(&rq.lock, 1) != 0)
+    102c:	90                   	nop
+    102d:	6a 01                	push   $0x1
+    102f:	68 c0 1f 00 00       	push   $0x1fc0
+    1034:	e8 bf ff ff ff       	call   ff8 <xchg>
+    1039:	83 c4 08             	add    $0x8,%esp
+    103c:	85 c0                	test   %eax,%eax
+    103e:	75 ed                	jne    102d <lock+0x4>
+}
+    1040:	90                   	nop
+    1041:	90                   	nop
+    1042:	c9                   	leave
+    1043:	c3                   	ret
+
+00001044 <unlock>:
+{
+    1044:	55                   	push   %ebp
+    1045:	89 e5                	mov    %esp,%ebp
+    1047:	83 ec 18             	sub    $0x18,%esp
+  wake = rq.nidle > 0 && rq.head != 0;
+    104a:	a1 d0 1f 00 00       	mov    0x1fd0,%eax
+    104f:	85 c0                	test   %eax,%eax
+    1051:	7e 10                	jle    1063 <unlock+0x1f>
+    1053:	a1 c4 1f 00 00       	mov    0x1fc4,%eax
+    1058:	85 c0                	test   %eax,%eax
+    105a:	74 07                	je     1063 <unlock+0x1f>
+    105c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1061:	eb 05                	jmp    1068 <unlock+0x24>
+    1063:	b8 00 00 00 00       	mov    $0x0,%eax
+    1068:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  xchg(&rq.lock, 0);
+    106b:	6a 00                	push   $0x0
+    106d:	68 c0 1f 00 00       	push   $0x1fc0
+    1072:	e8 81 ff ff ff       	call   ff8 <xchg>
+    1077:	83 c4 08             	add    $0x8,%esp
+  if(wake)
+    107a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    107e:	74 14                	je     1094 <unlock+0x50>
+    futex((int*)&rq.n, FUTEX_WAKE, 1);
+    1080:	83 ec 04             	sub    $0x4,%esp
+    1083:	6a 01                	push   $0x1
+    1085:	6a 01                	push   $0x1
+    1087:	68 cc 1f 00 00       	push   $0x1fcc
+    108c:	e8 ab f5 ff ff       	call   63c <futex>
+    1091:	83 c4 10             	add    $0x10,%esp
+}
+    1094:	90                   	nop
+    1095:	c9                   	leave
+    1096:	c3                   	ret
+
+00001097 <enqueue>:
+{
+    1097:	55                   	push   %ebp
+    1098:	89 e5                	mov    %esp,%ebp
+  t->u.state = T_RUNNABLE;
+    109a:	8b 45 08             	mov    0x8(%ebp),%eax
+    109d:	c7 40 10 02 00 00 00 	movl   $0x2,0x10(%eax)
+  t->next = 0;
+    10a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a7:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+  if(rq.head)
+    10ae:	a1 c4 1f 00 00       	mov    0x1fc4,%eax
+    10b3:	85 c0                	test   %eax,%eax
+    10b5:	74 0d                	je     10c4 <enqueue+0x2d>
+    rq.tail->next = t;
+    10b7:	a1 c8 1f 00 00       	mov    0x1fc8,%eax
+    10bc:	8b 55 08             	mov    0x8(%ebp),%edx
+    10bf:	89 50 18             	mov    %edx,0x18(%eax)
+    10c2:	eb 08                	jmp    10cc <enqueue+0x35>
+    rq.head = t;
+    10c4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c7:	a3 c4 1f 00 00       	mov    %eax,0x1fc4
+  rq.tail = t;
+    10cc:	8b 45 08             	mov    0x8(%ebp),%eax
+    10cf:	a3 c8 1f 00 00       	mov    %eax,0x1fc8
+  rq.n++;
+    10d4:	a1 cc 1f 00 00       	mov    0x1fcc,%eax
+    10d9:	83 c0 01             	add    $0x1,%eax
+    10dc:	a3 cc 1f 00 00       	mov    %eax,0x1fcc
+}
+    10e1:	90                   	nop
+    10e2:	5d                   	pop    %ebp
+    10e3:	c3                   	ret
+
+000010e4 <dequeue>:
+{
+    10e4:	55                   	push   %ebp
+    10e5:	89 e5                	mov    %esp,%ebp
+    10e7:	83 ec 10             	sub    $0x10,%esp
+  if((t = rq.head) != 0){
+    10ea:	a1 c4 1f 00 00       	mov    0x1fc4,%eax
+    10ef:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    10f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    10f6:	74 18                	je     1110 <dequeue+0x2c>
+    rq.head = t->next;
+    10f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    10fb:	8b 40 18             	mov    0x18(%eax),%eax
+    10fe:	a3 c4 1f 00 00       	mov    %eax,0x1fc4
+    rq.n--;
+    1103:	a1 cc 1f 00 00       	mov    0x1fcc,%eax
+    1108:	83 e8 01             	sub    $0x1,%eax
+    110b:	a3 cc 1f 00 00       	mov    %eax,0x1fcc
+  return t;
+    1110:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1113:	c9                   	leave
+    1114:	c3                   	ret
+
+00001115 <allocstack>:
+{
+    1115:	55                   	push   %ebp
+    1116:	89 e5                	mov    %esp,%ebp
+    1118:	83 ec 08             	sub    $0x8,%esp
+  if(t->mem == 0 && (t->mem = malloc(2*STACK_SIZE)) == 0)
+    111b:	8b 45 08             	mov    0x8(%ebp),%eax
+    111e:	8b 40 1c             	mov    0x1c(%eax),%eax
+    1121:	85 c0                	test   %eax,%eax
+    1123:	75 27                	jne    114c <allocstack+0x37>
+    1125:	83 ec 0c             	sub    $0xc,%esp
+    1128:	68 00 20 00 00       	push   $0x2000
+    112d:	e8 94 fe ff ff       	call   fc6 <malloc>
+    1132:	83 c4 10             	add    $0x10,%esp
+    1135:	8b 55 08             	mov    0x8(%ebp),%edx
+    1138:	89 42 1c             	mov    %eax,0x1c(%edx)
+    113b:	8b 45 08             	mov    0x8(%ebp),%eax
+    113e:	8b 40 1c             	mov    0x1c(%eax),%eax
+    1141:	85 c0                	test   %eax,%eax
+    1143:	75 07                	jne    114c <allocstack+0x37>
+    return -1;
+    1145:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    114a:	eb 28                	jmp    1174 <allocstack+0x5f>
+  t->u.stack = (char*)(((uint)t->mem + STACK_SIZE-1) & ~(STACK_SIZE-1));
+    114c:	8b 45 08             	mov    0x8(%ebp),%eax
+    114f:	8b 40 1c             	mov    0x1c(%eax),%eax
+    1152:	05 ff 0f 00 00       	add    $0xfff,%eax
+    1157:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    115c:	89 c2                	mov    %eax,%edx
+    115e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1161:	89 50 0c             	mov    %edx,0xc(%eax)
+  *(struct task**)t->u.stack = t;
+    1164:	8b 45 08             	mov    0x8(%ebp),%eax
+    1167:	8b 40 0c             	mov    0xc(%eax),%eax
+    116a:	8b 55 08             	mov    0x8(%ebp),%edx
+    116d:	89 10                	mov    %edx,(%eax)
+  return 0;
+    116f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+
+00001176 <setstart>:
+{
+    1176:	55                   	push   %ebp
+    1177:	89 e5                	mov    %esp,%ebp
+    1179:	83 ec 18             	sub    $0x18,%esp
+  if(allocstack(t) < 0)
+    117c:	83 ec 0c             	sub    $0xc,%esp
+    117f:	ff 75 08             	push   0x8(%ebp)
+    1182:	e8 8e ff ff ff       	call   1115 <allocstack>
+    1187:	83 c4 10             	add    $0x10,%esp
+    118a:	85 c0                	test   %eax,%eax
+    118c:	79 07                	jns    1195 <setstart+0x1f>
+    return -1;
+    118e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1193:	eb 66                	jmp    11fb <setstart+0x85>
+  sp = (uint*)(t->u.stack + STACK_SIZE);
+    1195:	8b 45 08             	mov    0x8(%ebp),%eax
+    1198:	8b 40 0c             	mov    0xc(%eax),%eax
+    119b:	05 00 10 00 00       	add    $0x1000,%eax
+    11a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *--sp = 0xffffffff;          // fake return PC for start
+    11a3:	83 6d f4 04          	subl   $0x4,-0xc(%ebp)
+    11a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11aa:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+  *--sp = (uint)start;
+    11b0:	83 6d f4 04          	subl   $0x4,-0xc(%ebp)
+    11b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+    11b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ba:	89 10                	mov    %edx,(%eax)
+  *--sp = 0;                   // %ebx
+    11bc:	83 6d f4 04          	subl   $0x4,-0xc(%ebp)
+    11c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11c3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  *--sp = 0;                   // %esi
+    11c9:	83 6d f4 04          	subl   $0x4,-0xc(%ebp)
+    11cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11d0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  *--sp = 0;                   // %edi
+    11d6:	83 6d f4 04          	subl   $0x4,-0xc(%ebp)
+    11da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11dd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  t->u.esp = (int)sp;
+    11e3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e9:	89 50 04             	mov    %edx,0x4(%eax)
+  t->u.ebp = 0;
+    11ec:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ef:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  return 0;
+    11f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11fb:	c9                   	leave
+    11fc:	c3                   	ret
+
+000011fd <resumed>:
+{
+    11fd:	55                   	push   %ebp
+    11fe:	89 e5                	mov    %esp,%ebp
+    1200:	83 ec 18             	sub    $0x18,%esp
+  t = current();
+    1203:	e8 0a fe ff ff       	call   1012 <current>
+    1208:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  unlock();
+    120b:	e8 34 fe ff ff       	call   1044 <unlock>
+  if(t != &t->w->idle)
+    1210:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1213:	8b 40 14             	mov    0x14(%eax),%eax
+    1216:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1219:	74 0a                	je     1225 <resumed+0x28>
+    t->busy = 0;
+    121b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    121e:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+}
+    1225:	90                   	nop
+    1226:	c9                   	leave
+    1227:	c3                   	ret
+
+00001228 <sched>:
+{
+    1228:	55                   	push   %ebp
+    1229:	89 e5                	mov    %esp,%ebp
+    122b:	83 ec 18             	sub    $0x18,%esp
+  if((t = dequeue()) == 0)
+    122e:	e8 b1 fe ff ff       	call   10e4 <dequeue>
+    1233:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1236:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    123a:	75 09                	jne    1245 <sched+0x1d>
+    t = &cur->w->idle;
+    123c:	8b 45 08             	mov    0x8(%ebp),%eax
+    123f:	8b 40 14             	mov    0x14(%eax),%eax
+    1242:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t->u.state = T_RUNNING;
+    1245:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1248:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+  if(t != cur){
+    124f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1252:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1255:	74 1f                	je     1276 <sched+0x4e>
+    t->w = cur->w;
+    1257:	8b 45 08             	mov    0x8(%ebp),%eax
+    125a:	8b 50 14             	mov    0x14(%eax),%edx
+    125d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1260:	89 50 14             	mov    %edx,0x14(%eax)
+    uswtch(&cur->u, &t->u);
+    1263:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1266:	8b 45 08             	mov    0x8(%ebp),%eax
+    1269:	83 ec 08             	sub    $0x8,%esp
+    126c:	52                   	push   %edx
+    126d:	50                   	push   %eax
+    126e:	e8 c6 04 00 00       	call   1739 <uswtch>
+    1273:	83 c4 10             	add    $0x10,%esp
+  }
+  resumed();
+    1276:	e8 82 ff ff ff       	call   11fd <resumed>
+}
+    127b:	90                   	nop
+    127c:	c9                   	leave
+    127d:	c3                   	ret
+
+0000127e <idle>:
+
+// A worker's idle thread: wait for a thread to be queued, run it.
+static void
+idle(void)
+{
+    127e:	55                   	push   %ebp
+    127f:	89 e5                	mov    %esp,%ebp
+    1281:	83 ec 18             	sub    $0x18,%esp
+  struct task *self;
+
+  self = current();
+    1284:	e8 89 fd ff ff       	call   1012 <current>
+    1289:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(;;){
+    lock();
+    128c:	e8 98 fd ff ff       	call   1029 <lock>
+    while(rq.head == 0){
+    1291:	eb 42                	jmp    12d5 <idle+0x57>
+      rq.nidle++;
+    1293:	a1 d0 1f 00 00       	mov    0x1fd0,%eax
+    1298:	83 c0 01             	add    $0x1,%eax
+    129b:	a3 d0 1f 00 00       	mov    %eax,0x1fd0
+      xchg(&rq.lock, 0);
+    12a0:	6a 00                	push   $0x0
+    12a2:	68 c0 1f 00 00       	push   $0x1fc0
+    12a7:	e8 4c fd ff ff       	call   ff8 <xchg>
+    12ac:	83 c4 08             	add    $0x8,%esp
+      futex((int*)&rq.n, FUTEX_WAIT, 0);
+    12af:	83 ec 04             	sub    $0x4,%esp
+    12b2:	6a 00                	push   $0x0
+    12b4:	6a 00                	push   $0x0
+    12b6:	68 cc 1f 00 00       	push   $0x1fcc
+    12bb:	e8 7c f3 ff ff       	call   63c <futex>
+    12c0:	83 c4 10             	add    $0x10,%esp
+      lock();
+    12c3:	e8 61 fd ff ff       	call   1029 <lock>
+      rq.nidle--;
+    12c8:	a1 d0 1f 00 00       	mov    0x1fd0,%eax
+    12cd:	83 e8 01             	sub    $0x1,%eax
+    12d0:	a3 d0 1f 00 00       	mov    %eax,0x1fd0
+    while(rq.head == 0){
+    12d5:	a1 c4 1f 00 00       	mov    0x1fc4,%eax
+    12da:	85 c0                	test   %eax,%eax
+    12dc:	74 b5                	je     1293 <idle+0x15>
+    }
+    sched(self);
+    12de:	83 ec 0c             	sub    $0xc,%esp
+    12e1:	ff 75 f4             	push   -0xc(%ebp)
+    12e4:	e8 3f ff ff ff       	call   1228 <sched>
+    12e9:	83 c4 10             	add    $0x10,%esp
+    lock();
+    12ec:	eb 9e                	jmp    128c <idle+0xe>
+
+000012ee <idlestart>:
+  }
+}
+
+static void
+idlestart(void)
+{
+    12ee:	55                   	push   %ebp
+    12ef:	89 e5                	mov    %esp,%ebp
+    12f1:	83 ec 08             	sub    $0x8,%esp
+  resumed();
+    12f4:	e8 04 ff ff ff       	call   11fd <resumed>
+  idle();
+    12f9:	e8 80 ff ff ff       	call   127e <idle>
+}
+    12fe:	90                   	nop
+    12ff:	c9                   	leave
+    1300:	c3                   	ret
+
+00001301 <workerstart>:
+
+static void*
+workerstart(void)
+{
+    1301:	55                   	push   %ebp
+    1302:	89 e5                	mov    %esp,%ebp
+    1304:	83 ec 08             	sub    $0x8,%esp
+  alarm(THREAD_QUANTA);
+    1307:	83 ec 0c             	sub    $0xc,%esp
+    130a:	6a 05                	push   $0x5
+    130c:	e8 3f f3 ff ff       	call   650 <alarm>
+    1311:	83 c4 10             	add    $0x10,%esp
+  idle();
+    1314:	e8 65 ff ff ff       	call   127e <idle>
+  return 0;
+    1319:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    131e:	c9                   	leave
+    131f:	c3                   	ret
+
+00001320 <pin>:
+// malloc's hooks, for its lock: keep the current thread from
+// being preempted meanwhile.  Returns what to hand unpin; pins
+// nest.
+static int
+pin(void)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	83 ec 10             	sub    $0x10,%esp
+  struct task *t;
+  int busy;
+
+  t = current();
+    1326:	e8 e7 fc ff ff       	call   1012 <current>
+    132b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  busy = t->busy;
+    132e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1331:	8b 40 20             	mov    0x20(%eax),%eax
+    1334:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  t->busy = 1;
+    1337:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    133a:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  return busy;
+    1341:	8b 45 f8             	mov    -0x8(%ebp),%eax
+}
+    1344:	c9                   	leave
+    1345:	c3                   	ret
+
+00001346 <unpin>:
+
+static void
+unpin(int busy)
+{
+    1346:	55                   	push   %ebp
+    1347:	89 e5                	mov    %esp,%ebp
+  current()->busy = busy;
+    1349:	e8 c4 fc ff ff       	call   1012 <current>
+    134e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1351:	89 50 20             	mov    %edx,0x20(%eax)
+}
+    1354:	90                   	nop
+    1355:	5d                   	pop    %ebp
+    1356:	c3                   	ret
+
+00001357 <threadstart>:
+
+static void
+threadstart(void)
+{
+    1357:	55                   	push   %ebp
+    1358:	89 e5                	mov    %esp,%ebp
+    135a:	83 ec 18             	sub    $0x18,%esp
+  struct task *t;
+
+  resumed();
+    135d:	e8 9b fe ff ff       	call   11fd <resumed>
+  t = current();
+    1362:	e8 ab fc ff ff       	call   1012 <current>
+    1367:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t->func(t->arg);
+    136a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    136d:	8b 40 28             	mov    0x28(%eax),%eax
+    1370:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1373:	8b 52 2c             	mov    0x2c(%edx),%edx
+    1376:	83 ec 0c             	sub    $0xc,%esp
+    1379:	52                   	push   %edx
+    137a:	ff d0                	call   *%eax
+    137c:	83 c4 10             	add    $0x10,%esp
+  uthread_exit();
+    137f:	e8 2d 02 00 00       	call   15b1 <uthread_exit>
+}
+    1384:	90                   	nop
+    1385:	c9                   	leave
+    1386:	c3                   	ret
+
+00001387 <uthread_init>:
+
+// Make the calling thread, which must be the process's main one,
+// thread 0, and start the workers.  Call before anything else here.
+void
+uthread_init(void)
+{
+    1387:	55                   	push   %ebp
+    1388:	89 e5                	mov    %esp,%ebp
+    138a:	83 ec 18             	sub    $0x18,%esp
+  struct task *t;
+  struct worker *w;
+  uint sp;
+
+  t = &task[0];
+    138d:	c7 45 f0 e0 1f 00 00 	movl   $0x1fe0,-0x10(%ebp)
+  asm volatile("movl %%esp, %0" : "=r" (sp));
+    1394:	89 e0                	mov    %esp,%eax
+    1396:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  t->u.stack = (char*)(sp & ~(STACK_SIZE-1));
+    1399:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    139c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    13a1:	89 c2                	mov    %eax,%edx
+    13a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13a6:	89 50 0c             	mov    %edx,0xc(%eax)
+  *(struct task**)t->u.stack = t;
+    13a9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13ac:	8b 40 0c             	mov    0xc(%eax),%eax
+    13af:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13b2:	89 10                	mov    %edx,(%eax)
+  t->u.tid = 0;
+    13b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13b7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  t->u.state = T_RUNNING;
+    13bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13c0:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+  t->w = &worker[0];
+    13c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13ca:	c7 40 14 e0 2b 00 00 	movl   $0x2be0,0x14(%eax)
+  rq.nlive = 1;
+    13d1:	c7 05 d4 1f 00 00 01 	movl   $0x1,0x1fd4
+    13d8:	00 00 00 
+  mallocpin = pin;
+    13db:	c7 05 84 1f 00 00 20 	movl   $0x1320,0x1f84
+    13e2:	13 00 00 
+  mallocunpin = unpin;
+    13e5:	c7 05 88 1f 00 00 46 	movl   $0x1346,0x1f88
+    13ec:	13 00 00 
+
+  for(w = worker; w < &worker[NWORKER]; w++){
+    13ef:	c7 45 f4 e0 2b 00 00 	movl   $0x2be0,-0xc(%ebp)
+    13f6:	eb 6d                	jmp    1465 <uthread_init+0xde>
+    w->idle.w = w;
+    13f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13fe:	89 50 14             	mov    %edx,0x14(%eax)
+    w->idle.busy = 1;
+    1401:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1404:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+    if(w == worker){
+    140b:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    1412:	75 1a                	jne    142e <uthread_init+0xa7>
+      if(setstart(&w->idle, idlestart) < 0)
+    1414:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1417:	83 ec 08             	sub    $0x8,%esp
+    141a:	68 ee 12 00 00       	push   $0x12ee
+    141f:	50                   	push   %eax
+    1420:	e8 51 fd ff ff       	call   1176 <setstart>
+    1425:	83 c4 10             	add    $0x10,%esp
+    1428:	85 c0                	test   %eax,%eax
+    142a:	79 35                	jns    1461 <uthread_init+0xda>
+        goto bad;
+    142c:	eb 62                	jmp    1490 <uthread_init+0x109>
+    } else if(allocstack(&w->idle) < 0 ||
+    142e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1431:	83 ec 0c             	sub    $0xc,%esp
+    1434:	50                   	push   %eax
+    1435:	e8 db fc ff ff       	call   1115 <allocstack>
+    143a:	83 c4 10             	add    $0x10,%esp
+    143d:	85 c0                	test   %eax,%eax
+    143f:	78 4e                	js     148f <uthread_init+0x108>
+              kthread_create(workerstart, w->idle.u.stack, STACK_SIZE) < 0)
+    1441:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1444:	8b 40 0c             	mov    0xc(%eax),%eax
+    1447:	83 ec 04             	sub    $0x4,%esp
+    144a:	68 00 10 00 00       	push   $0x1000
+    144f:	50                   	push   %eax
+    1450:	68 01 13 00 00       	push   $0x1301
+    1455:	e8 ba f1 ff ff       	call   614 <kthread_create>
+    145a:	83 c4 10             	add    $0x10,%esp
+    } else if(allocstack(&w->idle) < 0 ||
+    145d:	85 c0                	test   %eax,%eax
+    145f:	78 2e                	js     148f <uthread_init+0x108>
+  for(w = worker; w < &worker[NWORKER]; w++){
+    1461:	83 45 f4 30          	addl   $0x30,-0xc(%ebp)
+    1465:	81 7d f4 40 2c 00 00 	cmpl   $0x2c40,-0xc(%ebp)
+    146c:	72 8a                	jb     13f8 <uthread_init+0x71>
+      goto bad;
+  }
+  signal(SIGALRM, ualarm);
+    146e:	83 ec 08             	sub    $0x8,%esp
+    1471:	68 54 17 00 00       	push   $0x1754
+    1476:	6a 0e                	push   $0xe
+    1478:	e8 c9 f1 ff ff       	call   646 <signal>
+    147d:	83 c4 10             	add    $0x10,%esp
+  alarm(THREAD_QUANTA);
+    1480:	83 ec 0c             	sub    $0xc,%esp
+    1483:	6a 05                	push   $0x5
+    1485:	e8 c6 f1 ff ff       	call   650 <alarm>
+    148a:	83 c4 10             	add    $0x10,%esp
+  return;
+    148d:	eb 18                	jmp    14a7 <uthread_init+0x120>
+      goto bad;
+    148f:	90                   	nop
+
+ bad:
+  printf(2, "uthread_init: cannot start workers\n");
+    1490:	83 ec 08             	sub    $0x8,%esp
+    1493:	68 d8 17 00 00       	push   $0x17d8
+    1498:	6a 02                	push   $0x2
+    149a:	e8 bf f4 ff ff       	call   95e <printf>
+    149f:	83 c4 10             	add    $0x10,%esp
+  exit();
+    14a2:	e8 27 f0 ff ff       	call   4ce <exit>
+}
+    14a7:	c9                   	leave
+    14a8:	c3                   	ret
+
+000014a9 <uthread_alarm>:
+
+// Called by ualarm for SIGALRM: preempt the running thread unless
+// it is in the middle of a switch.
+void
+uthread_alarm(void)
+{
+    14a9:	55                   	push   %ebp
+    14aa:	89 e5                	mov    %esp,%ebp
+    14ac:	83 ec 18             	sub    $0x18,%esp
+  struct task *t;
+
+  t = current();
+    14af:	e8 5e fb ff ff       	call   1012 <current>
+    14b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(t->busy)
+    14b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14ba:	8b 40 20             	mov    0x20(%eax),%eax
+    14bd:	85 c0                	test   %eax,%eax
+    14bf:	75 07                	jne    14c8 <uthread_alarm+0x1f>
+    return;
+  uthread_yield();
+    14c1:	e8 79 01 00 00       	call   163f <uthread_yield>
+    14c6:	eb 01                	jmp    14c9 <uthread_alarm+0x20>
+    return;
+    14c8:	90                   	nop
+}
+    14c9:	c9                   	leave
+    14ca:	c3                   	ret
+
+000014cb <uthread_create>:
+
+int
+uthread_create(void (*func)(void *), void* value)
+{
+    14cb:	55                   	push   %ebp
+    14cc:	89 e5                	mov    %esp,%ebp
+    14ce:	83 ec 18             	sub    $0x18,%esp
+  struct task *cur, *t;
+  int tid;
+
+  cur = current();
+    14d1:	e8 3c fb ff ff       	call   1012 <current>
+    14d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cur->busy = 1;
+    14d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    14dc:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  lock();
+    14e3:	e8 41 fb ff ff       	call   1029 <lock>
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    14e8:	c7 45 f4 e0 1f 00 00 	movl   $0x1fe0,-0xc(%ebp)
+    14ef:	eb 16                	jmp    1507 <uthread_create+0x3c>
+    if(t->u.state == T_FREE && t != cur)
+    14f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14f4:	8b 40 10             	mov    0x10(%eax),%eax
+    14f7:	85 c0                	test   %eax,%eax
+    14f9:	75 08                	jne    1503 <uthread_create+0x38>
+    14fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14fe:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1501:	75 0f                	jne    1512 <uthread_create+0x47>
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    1503:	83 45 f4 30          	addl   $0x30,-0xc(%ebp)
+    1507:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    150e:	72 e1                	jb     14f1 <uthread_create+0x26>
+    1510:	eb 01                	jmp    1513 <uthread_create+0x48>
+      break;
+    1512:	90                   	nop
+  if(t == &task[MAX_THREAD] || setstart(t, threadstart) < 0){
+    1513:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    151a:	74 17                	je     1533 <uthread_create+0x68>
+    151c:	83 ec 08             	sub    $0x8,%esp
+    151f:	68 57 13 00 00       	push   $0x1357
+    1524:	ff 75 f4             	push   -0xc(%ebp)
+    1527:	e8 4a fc ff ff       	call   1176 <setstart>
+    152c:	83 c4 10             	add    $0x10,%esp
+    152f:	85 c0                	test   %eax,%eax
+    1531:	79 16                	jns    1549 <uthread_create+0x7e>
+    unlock();
+    1533:	e8 0c fb ff ff       	call   1044 <unlock>
+    cur->busy = 0;
+    1538:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    153b:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+    return -1;
+    1542:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1547:	eb 66                	jmp    15af <uthread_create+0xe4>
+  }
+  t->u.tid = tid = ++rq.nexttid;
+    1549:	a1 d8 1f 00 00       	mov    0x1fd8,%eax
+    154e:	83 c0 01             	add    $0x1,%eax
+    1551:	a3 d8 1f 00 00       	mov    %eax,0x1fd8
+    1556:	a1 d8 1f 00 00       	mov    0x1fd8,%eax
+    155b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    155e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1561:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1564:	89 10                	mov    %edx,(%eax)
+  t->func = func;
+    1566:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1569:	8b 55 08             	mov    0x8(%ebp),%edx
+    156c:	89 50 28             	mov    %edx,0x28(%eax)
+  t->arg = value;
+    156f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1572:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1575:	89 50 2c             	mov    %edx,0x2c(%eax)
+  t->busy = 1;
+    1578:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    157b:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  rq.nlive++;
+    1582:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+    1587:	83 c0 01             	add    $0x1,%eax
+    158a:	a3 d4 1f 00 00       	mov    %eax,0x1fd4
+  enqueue(t);
+    158f:	83 ec 0c             	sub    $0xc,%esp
+    1592:	ff 75 f4             	push   -0xc(%ebp)
+    1595:	e8 fd fa ff ff       	call   1097 <enqueue>
+    159a:	83 c4 10             	add    $0x10,%esp
+  unlock();
+    159d:	e8 a2 fa ff ff       	call   1044 <unlock>
+  cur->busy = 0;
+    15a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15a5:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  return tid;
+    15ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+    15af:	c9                   	leave
+    15b0:	c3                   	ret
+
+000015b1 <uthread_exit>:
+// End the current thread.  The last one to end ends the process.
+// Its stack stays in use until the switch away is over, which is
+// before anyone else can take the run queue lock and reuse it.
+void
+uthread_exit(void)
+{
+    15b1:	55                   	push   %ebp
+    15b2:	89 e5                	mov    %esp,%ebp
+    15b4:	83 ec 18             	sub    $0x18,%esp
+  struct task *cur, *t;
+
+  cur = current();
+    15b7:	e8 56 fa ff ff       	call   1012 <current>
+    15bc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cur->busy = 1;
+    15bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15c2:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  lock();
+    15c9:	e8 5b fa ff ff       	call   1029 <lock>
+  cur->u.state = T_FREE;
+    15ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15d1:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    15d8:	c7 45 f4 e0 1f 00 00 	movl   $0x1fe0,-0xc(%ebp)
+    15df:	eb 29                	jmp    160a <uthread_exit+0x59>
+    if(t->u.state == T_SLEEPING && t->join == cur->u.tid)
+    15e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15e4:	8b 40 10             	mov    0x10(%eax),%eax
+    15e7:	83 f8 03             	cmp    $0x3,%eax
+    15ea:	75 1a                	jne    1606 <uthread_exit+0x55>
+    15ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15ef:	8b 50 24             	mov    0x24(%eax),%edx
+    15f2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15f5:	8b 00                	mov    (%eax),%eax
+    15f7:	39 c2                	cmp    %eax,%edx
+    15f9:	75 0b                	jne    1606 <uthread_exit+0x55>
+      enqueue(t);
+    15fb:	ff 75 f4             	push   -0xc(%ebp)
+    15fe:	e8 94 fa ff ff       	call   1097 <enqueue>
+    1603:	83 c4 04             	add    $0x4,%esp
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    1606:	83 45 f4 30          	addl   $0x30,-0xc(%ebp)
+    160a:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    1611:	72 ce                	jb     15e1 <uthread_exit+0x30>
+  if(--rq.nlive == 0)
+    1613:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+    1618:	83 e8 01             	sub    $0x1,%eax
+    161b:	a3 d4 1f 00 00       	mov    %eax,0x1fd4
+    1620:	a1 d4 1f 00 00       	mov    0x1fd4,%eax
+    1625:	85 c0                	test   %eax,%eax
+    1627:	75 05                	jne    162e <uthread_exit+0x7d>
+    exit();
+    1629:	e8 a0 ee ff ff       	call   4ce <exit>
+  sched(cur);
+    162e:	83 ec 0c             	sub    $0xc,%esp
+    1631:	ff 75 f0             	push   -0x10(%ebp)
+    1634:	e8 ef fb ff ff       	call   1228 <sched>
+    1639:	83 c4 10             	add    $0x10,%esp
+}
+    163c:	90                   	nop
+    163d:	c9                   	leave
+    163e:	c3                   	ret
+
+0000163f <uthread_yield>:
+
+void
+uthread_yield(void)
+{
+    163f:	55                   	push   %ebp
+    1640:	89 e5                	mov    %esp,%ebp
+    1642:	83 ec 18             	sub    $0x18,%esp
+  struct task *cur;
+
+  cur = current();
+    1645:	e8 c8 f9 ff ff       	call   1012 <current>
+    164a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cur->busy = 1;
+    164d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1650:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  lock();
+    1657:	e8 cd f9 ff ff       	call   1029 <lock>
+  enqueue(cur);
+    165c:	ff 75 f4             	push   -0xc(%ebp)
+    165f:	e8 33 fa ff ff       	call   1097 <enqueue>
+    1664:	83 c4 04             	add    $0x4,%esp
+  sched(cur);
+    1667:	83 ec 0c             	sub    $0xc,%esp
+    166a:	ff 75 f4             	push   -0xc(%ebp)
+    166d:	e8 b6 fb ff ff       	call   1228 <sched>
+    1672:	83 c4 10             	add    $0x10,%esp
+}
+    1675:	90                   	nop
+    1676:	c9                   	leave
+    1677:	c3                   	ret
+
+00001678 <uthred_self>:
+
+int
+uthred_self(void)
+{
+    1678:	55                   	push   %ebp
+    1679:	89 e5                	mov    %esp,%ebp
+  return current()->u.tid;
+    167b:	e8 92 f9 ff ff       	call   1012 <current>
+    1680:	8b 00                	mov    (%eax),%eax
+}
+    1682:	5d                   	pop    %ebp
+    1683:	c3                   	ret
+
+00001684 <uthred_join>:
+
+// Wait for thread tid to exit.  Return 0, at once if it already
+// has, or -1 if there is no such thread.
+int
+uthred_join(int tid)
+{
+    1684:	55                   	push   %ebp
+    1685:	89 e5                	mov    %esp,%ebp
+    1687:	83 ec 18             	sub    $0x18,%esp
+  struct task *cur, *t;
+
+  cur = current();
+    168a:	e8 83 f9 ff ff       	call   1012 <current>
+    168f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(tid < 0 || tid > rq.nexttid || tid == cur->u.tid)
+    1692:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1696:	78 14                	js     16ac <uthred_join+0x28>
+    1698:	a1 d8 1f 00 00       	mov    0x1fd8,%eax
+    169d:	39 45 08             	cmp    %eax,0x8(%ebp)
+    16a0:	7f 0a                	jg     16ac <uthred_join+0x28>
+    16a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    16a5:	8b 00                	mov    (%eax),%eax
+    16a7:	39 45 08             	cmp    %eax,0x8(%ebp)
+    16aa:	75 0a                	jne    16b6 <uthred_join+0x32>
+    return -1;
+    16ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    16b1:	e9 81 00 00 00       	jmp    1737 <uthred_join+0xb3>
+  cur->busy = 1;
+    16b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    16b9:	c7 40 20 01 00 00 00 	movl   $0x1,0x20(%eax)
+  lock();
+    16c0:	e8 64 f9 ff ff       	call   1029 <lock>
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    16c5:	c7 45 f4 e0 1f 00 00 	movl   $0x1fe0,-0xc(%ebp)
+    16cc:	eb 18                	jmp    16e6 <uthred_join+0x62>
+    if(t->u.state != T_FREE && t->u.tid == tid)
+    16ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16d1:	8b 40 10             	mov    0x10(%eax),%eax
+    16d4:	85 c0                	test   %eax,%eax
+    16d6:	74 0a                	je     16e2 <uthred_join+0x5e>
+    16d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16db:	8b 00                	mov    (%eax),%eax
+    16dd:	39 45 08             	cmp    %eax,0x8(%ebp)
+    16e0:	74 0f                	je     16f1 <uthred_join+0x6d>
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    16e2:	83 45 f4 30          	addl   $0x30,-0xc(%ebp)
+    16e6:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    16ed:	72 df                	jb     16ce <uthred_join+0x4a>
+    16ef:	eb 01                	jmp    16f2 <uthred_join+0x6e>
+      break;
+    16f1:	90                   	nop
+  if(t == &task[MAX_THREAD]){
+    16f2:	81 7d f4 e0 2b 00 00 	cmpl   $0x2be0,-0xc(%ebp)
+    16f9:	75 16                	jne    1711 <uthred_join+0x8d>
+    unlock();
+    16fb:	e8 44 f9 ff ff       	call   1044 <unlock>
+    cur->busy = 0;
+    1700:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1703:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+    return 0;
+    170a:	b8 00 00 00 00       	mov    $0x0,%eax
+    170f:	eb 26                	jmp    1737 <uthred_join+0xb3>
+  }
+  cur->u.state = T_SLEEPING;
+    1711:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1714:	c7 40 10 03 00 00 00 	movl   $0x3,0x10(%eax)
+  cur->join = tid;
+    171b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    171e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1721:	89 50 24             	mov    %edx,0x24(%eax)
+  sched(cur);
+    1724:	83 ec 0c             	sub    $0xc,%esp
+    1727:	ff 75 f0             	push   -0x10(%ebp)
+    172a:	e8 f9 fa ff ff       	call   1228 <sched>
+    172f:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1737:	c9                   	leave
+    1738:	c3                   	ret
+
+00001739 <uswtch>:
+# Save the current callee-save registers on the stack and %esp
+# and %ebp in old, and resume new the same way.
+
+.globl uswtch
+uswtch:
+  movl 4(%esp), %eax
+    1739:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+    173d:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebx
+    1741:	53                   	push   %ebx
+  pushl %esi
+    1742:	56                   	push   %esi
+  pushl %edi
+    1743:	57                   	push   %edi
+  movl %esp, 4(%eax)       # old->esp
+    1744:	89 60 04             	mov    %esp,0x4(%eax)
+  movl %ebp, 8(%eax)       # old->ebp
+    1747:	89 68 08             	mov    %ebp,0x8(%eax)
+
+  # Switch stacks and load new callee-save registers
+  movl 4(%edx), %esp       # new->esp
+    174a:	8b 62 04             	mov    0x4(%edx),%esp
+  movl 8(%edx), %ebp       # new->ebp
+    174d:	8b 6a 08             	mov    0x8(%edx),%ebp
+  popl %edi
+    1750:	5f                   	pop    %edi
+  popl %esi
+    1751:	5e                   	pop    %esi
+  popl %ebx
+    1752:	5b                   	pop    %ebx
+  ret
+    1753:	c3                   	ret
+
+00001754 <ualarm>:
+
+# SIGALRM handler.  The kernel pushed the interrupted %eip; keep
+# every register and the flags for the code that was running.
+.globl ualarm
+ualarm:
+  pushfl
+    1754:	9c                   	pushf
+  pushal
+    1755:	60                   	pusha
+  call uthread_alarm
+    1756:	e8 4e fd ff ff       	call   14a9 <uthread_alarm>
+  popal
+    175b:	61                   	popa
+  popfl
+    175c:	9d                   	popf
+  ret
+    175d:	c3                   	ret
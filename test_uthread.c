@@ -0,0 +1,74 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "uthread.h"
+
+#define NCOUNT 40
+#define NSPIN 3
+#define ROUNDS 100
+
+int count[NCOUNT];
+volatile int go;
+
+void
+counter(void *arg)
+{
+  int i, n;
+
+  n = (int)arg;
+  for(i = 0; i < ROUNDS; i++){
+    count[n]++;
+    if(i % 10 == 0)
+      uthread_yield();
+  }
+}
+
+// Never yields: only preemption lets the setter run.
+void
+spinner(void *arg)
+{
+  while(!go)
+    ;
+}
+
+void
+setter(void *arg)
+{
+  go = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, tid[NCOUNT+NSPIN+1];
+
+  uthread_init();
+
+  for(i = 0; i < NSPIN; i++)
+    tid[i] = uthread_create(spinner, 0);
+  tid[i++] = uthread_create(setter, 0);
+  for(; i < NSPIN+1+NCOUNT; i++)
+    tid[i] = uthread_create(counter, (void*)(i-NSPIN-1));
+  for(i = 0; i < NSPIN+1+NCOUNT; i++){
+    if(tid[i] < 0 || uthred_join(tid[i]) < 0){
+      printf(1, "error: thread %d\n", i);
+      exit();
+    }
+  }
+  if(!go){
+    printf(1, "error: spinners done before setter\n");
+    exit();
+  }
+  for(i = 0; i < NCOUNT; i++){
+    if(count[i] != ROUNDS){
+      printf(1, "error: count[%d] %d, not %d\n", i, count[i], ROUNDS);
+      exit();
+    }
+  }
+  if(uthred_join(tid[0]) != 0 || uthred_join(uthred_self()) != -1){
+    printf(1, "error: join\n");
+    exit();
+  }
+  printf(1, "uthread ok\n");
+  exit();
+}
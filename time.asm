@@ -0,0 +1,1870 @@
+
+_time:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "rusage.h"
+
+// Run a command and report the time and events charged to it.
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 3c             	sub    $0x3c,%esp
+  13:	89 cb                	mov    %ecx,%ebx
+  struct rusage ru;
+  int pid, w, t0;
+
+  if(argc < 2){
+  15:	83 3b 01             	cmpl   $0x1,(%ebx)
+  18:	7f 17                	jg     31 <main+0x31>
+    printf(2, "usage: time cmd [arg...]\n");
+  1a:	83 ec 08             	sub    $0x8,%esp
+  1d:	68 d0 0e 00 00       	push   $0xed0
+  22:	6a 02                	push   $0x2
+  24:	e8 0d 08 00 00       	call   836 <printf>
+  29:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2c:	e8 75 03 00 00       	call   3a6 <exit>
+  }
+  t0 = uptime();
+  31:	e8 16 04 00 00       	call   44c <uptime>
+  36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((pid = spawn(argv[1], argv+1, 0, 0)) < 0){
+  39:	8b 43 04             	mov    0x4(%ebx),%eax
+  3c:	8d 50 04             	lea    0x4(%eax),%edx
+  3f:	8b 43 04             	mov    0x4(%ebx),%eax
+  42:	83 c0 04             	add    $0x4,%eax
+  45:	8b 00                	mov    (%eax),%eax
+  47:	6a 00                	push   $0x0
+  49:	6a 00                	push   $0x0
+  4b:	52                   	push   %edx
+  4c:	50                   	push   %eax
+  4d:	e8 86 04 00 00       	call   4d8 <spawn>
+  52:	83 c4 10             	add    $0x10,%esp
+  55:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  58:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  5c:	79 20                	jns    7e <main+0x7e>
+    printf(2, "time: spawn %s failed\n", argv[1]);
+  5e:	8b 43 04             	mov    0x4(%ebx),%eax
+  61:	83 c0 04             	add    $0x4,%eax
+  64:	8b 00                	mov    (%eax),%eax
+  66:	83 ec 04             	sub    $0x4,%esp
+  69:	50                   	push   %eax
+  6a:	68 ea 0e 00 00       	push   $0xeea
+  6f:	6a 02                	push   $0x2
+  71:	e8 c0 07 00 00       	call   836 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    exit();
+  79:	e8 28 03 00 00       	call   3a6 <exit>
+  }
+  while((w = wait()) >= 0 && w != pid)
+  7e:	90                   	nop
+  7f:	e8 29 03 00 00       	call   3ad <wait>
+  84:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  87:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  8b:	78 08                	js     95 <main+0x95>
+  8d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  90:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  93:	75 ea                	jne    7f <main+0x7f>
+    ;
+  if(getrusage(RUSAGE_CHILDREN, &ru) < 0){
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  9b:	50                   	push   %eax
+  9c:	6a ff                	push   $0xffffffff
+  9e:	e8 ad 04 00 00       	call   550 <getrusage>
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	85 c0                	test   %eax,%eax
+  a8:	79 17                	jns    c1 <main+0xc1>
+    printf(2, "time: getrusage failed\n");
+  aa:	83 ec 08             	sub    $0x8,%esp
+  ad:	68 01 0f 00 00       	push   $0xf01
+  b2:	6a 02                	push   $0x2
+  b4:	e8 7d 07 00 00       	call   836 <printf>
+  b9:	83 c4 10             	add    $0x10,%esp
+    exit();
+  bc:	e8 e5 02 00 00       	call   3a6 <exit>
+  }
+  printf(2, "%d real %d user %d sys (ticks)\n", uptime() - t0, ru.utime, ru.stime);
+  c1:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  c4:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  c7:	e8 80 03 00 00       	call   44c <uptime>
+  cc:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+  cf:	83 ec 0c             	sub    $0xc,%esp
+  d2:	56                   	push   %esi
+  d3:	53                   	push   %ebx
+  d4:	50                   	push   %eax
+  d5:	68 1c 0f 00 00       	push   $0xf1c
+  da:	6a 02                	push   $0x2
+  dc:	e8 55 07 00 00       	call   836 <printf>
+  e1:	83 c4 20             	add    $0x20,%esp
+  printf(2, "%d voluntary %d involuntary switches, %d faults, %d blocks in %d out\n",
+  e4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  e7:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  ea:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  ed:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  f3:	83 ec 04             	sub    $0x4,%esp
+  f6:	56                   	push   %esi
+  f7:	53                   	push   %ebx
+  f8:	51                   	push   %ecx
+  f9:	52                   	push   %edx
+  fa:	50                   	push   %eax
+  fb:	68 3c 0f 00 00       	push   $0xf3c
+ 100:	6a 02                	push   $0x2
+ 102:	e8 2f 07 00 00       	call   836 <printf>
+ 107:	83 c4 20             	add    $0x20,%esp
+         ru.nvcsw, ru.nivcsw, ru.nfault, ru.nblkin, ru.nblkout);
+  exit();
+ 10a:	e8 97 02 00 00       	call   3a6 <exit>
+
+0000010f <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	57                   	push   %edi
+ 113:	53                   	push   %ebx
+    if(cc < 1)
+ 114:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 117:	8b 55 10             	mov    0x10(%ebp),%edx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	89 cb                	mov    %ecx,%ebx
+ 11f:	89 df                	mov    %ebx,%edi
+ 121:	89 d1                	mov    %edx,%ecx
+ 123:	fc                   	cld
+ 124:	f3 aa                	rep stos %al,%es:(%edi)
+ 126:	89 ca                	mov    %ecx,%edx
+ 128:	89 fb                	mov    %edi,%ebx
+ 12a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 12d:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 130:	90                   	nop
+ 131:	5b                   	pop    %ebx
+ 132:	5f                   	pop    %edi
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <strcpy>:
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 141:	90                   	nop
+ 142:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 145:	8d 42 01             	lea    0x1(%edx),%eax
+ 148:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 14b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 151:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 154:	0f b6 12             	movzbl (%edx),%edx
+ 157:	88 10                	mov    %dl,(%eax)
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	84 c0                	test   %al,%al
+ 15e:	75 e2                	jne    142 <strcpy+0xd>
+  return os;
+ 160:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+
+00000165 <strcmp>:
+{
+ 165:	55                   	push   %ebp
+ 166:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 168:	eb 08                	jmp    172 <strcmp+0xd>
+    p++, q++;
+ 16a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	74 10                	je     18c <strcmp+0x27>
+ 17c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17f:	0f b6 10             	movzbl (%eax),%edx
+ 182:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 185:	0f b6 00             	movzbl (%eax),%eax
+ 188:	38 c2                	cmp    %al,%dl
+ 18a:	74 de                	je     16a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 18c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18f:	0f b6 00             	movzbl (%eax),%eax
+ 192:	0f b6 d0             	movzbl %al,%edx
+ 195:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 198:	0f b6 00             	movzbl (%eax),%eax
+ 19b:	0f b6 c0             	movzbl %al,%eax
+ 19e:	29 c2                	sub    %eax,%edx
+ 1a0:	89 d0                	mov    %edx,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+
+000001a4 <strlen>:
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1b1:	eb 04                	jmp    1b7 <strlen+0x13>
+ 1b3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bd:	01 d0                	add    %edx,%eax
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	75 ed                	jne    1b3 <strlen+0xf>
+  return n;
+ 1c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c9:	c9                   	leave
+ 1ca:	c3                   	ret
+
+000001cb <memset>:
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ce:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d1:	50                   	push   %eax
+ 1d2:	ff 75 0c             	push   0xc(%ebp)
+ 1d5:	ff 75 08             	push   0x8(%ebp)
+ 1d8:	e8 32 ff ff ff       	call   10f <stosb>
+ 1dd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+
+000001e5 <strchr>:
+{
+ 1e5:	55                   	push   %ebp
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	83 ec 04             	sub    $0x4,%esp
+ 1eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ee:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1f1:	eb 14                	jmp    207 <strchr+0x22>
+    if(*s == c)
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 00             	movzbl (%eax),%eax
+ 1f9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1fc:	75 05                	jne    203 <strchr+0x1e>
+      return (char*)s;
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	eb 13                	jmp    216 <strchr+0x31>
+  for(; *s; s++)
+ 203:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20a:	0f b6 00             	movzbl (%eax),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 e2                	jne    1f3 <strchr+0xe>
+  return 0;
+ 211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 216:	c9                   	leave
+ 217:	c3                   	ret
+
+00000218 <gets>:
+{
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 225:	eb 42                	jmp    269 <gets+0x51>
+    cc = read(0, &c, 1);
+ 227:	83 ec 04             	sub    $0x4,%esp
+ 22a:	6a 01                	push   $0x1
+ 22c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 22f:	50                   	push   %eax
+ 230:	6a 00                	push   $0x0
+ 232:	e8 84 01 00 00       	call   3bb <read>
+ 237:	83 c4 10             	add    $0x10,%esp
+ 23a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 23d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 241:	7e 33                	jle    276 <gets+0x5e>
+    buf[i++] = c;
+ 243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 246:	8d 50 01             	lea    0x1(%eax),%edx
+ 249:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 24c:	89 c2                	mov    %eax,%edx
+ 24e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 251:	01 c2                	add    %eax,%edx
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 259:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25d:	3c 0a                	cmp    $0xa,%al
+ 25f:	74 16                	je     277 <gets+0x5f>
+ 261:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 265:	3c 0d                	cmp    $0xd,%al
+ 267:	74 0e                	je     277 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 269:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 272:	7f b3                	jg     227 <gets+0xf>
+ 274:	eb 01                	jmp    277 <gets+0x5f>
+      break;
+ 276:	90                   	nop
+  }
+  buf[i] = '\0';
+ 277:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27d:	01 d0                	add    %edx,%eax
+ 27f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 28d:	83 ec 08             	sub    $0x8,%esp
+ 290:	6a 00                	push   $0x0
+ 292:	ff 75 08             	push   0x8(%ebp)
+ 295:	e8 44 01 00 00       	call   3de <open>
+ 29a:	83 c4 10             	add    $0x10,%esp
+ 29d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a4:	79 07                	jns    2ad <stat+0x26>
+    return -1;
+ 2a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ab:	eb 25                	jmp    2d2 <stat+0x4b>
+  r = fstat(fd, st);
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	ff 75 0c             	push   0xc(%ebp)
+ 2b3:	ff 75 f4             	push   -0xc(%ebp)
+ 2b6:	e8 41 01 00 00       	call   3fc <fstat>
+ 2bb:	83 c4 10             	add    $0x10,%esp
+ 2be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2c1:	83 ec 0c             	sub    $0xc,%esp
+ 2c4:	ff 75 f4             	push   -0xc(%ebp)
+ 2c7:	e8 fd 00 00 00       	call   3c9 <close>
+ 2cc:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2d2:	c9                   	leave
+ 2d3:	c3                   	ret
+
+000002d4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d4:	55                   	push   %ebp
+ 2d5:	89 e5                	mov    %esp,%ebp
+ 2d7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2e1:	eb 25                	jmp    308 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2e3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	c1 e0 02             	shl    $0x2,%eax
+ 2eb:	01 d0                	add    %edx,%eax
+ 2ed:	01 c0                	add    %eax,%eax
+ 2ef:	89 c1                	mov    %eax,%ecx
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2fa:	0f b6 00             	movzbl (%eax),%eax
+ 2fd:	0f be c0             	movsbl %al,%eax
+ 300:	01 c8                	add    %ecx,%eax
+ 302:	83 e8 30             	sub    $0x30,%eax
+ 305:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 308:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30b:	0f b6 00             	movzbl (%eax),%eax
+ 30e:	3c 2f                	cmp    $0x2f,%al
+ 310:	7e 0a                	jle    31c <atoi+0x48>
+ 312:	8b 45 08             	mov    0x8(%ebp),%eax
+ 315:	0f b6 00             	movzbl (%eax),%eax
+ 318:	3c 39                	cmp    $0x39,%al
+ 31a:	7e c7                	jle    2e3 <atoi+0xf>
+  return n;
+ 31c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 31f:	c9                   	leave
+ 320:	c3                   	ret
+
+00000321 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 32d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 330:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 333:	eb 17                	jmp    34c <memmove+0x2b>
+    *dst++ = *src++;
+ 335:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 338:	8d 42 01             	lea    0x1(%edx),%eax
+ 33b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 33e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 341:	8d 48 01             	lea    0x1(%eax),%ecx
+ 344:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 347:	0f b6 12             	movzbl (%edx),%edx
+ 34a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 352:	89 55 10             	mov    %edx,0x10(%ebp)
+ 355:	85 c0                	test   %eax,%eax
+ 357:	7f dc                	jg     335 <memmove+0x14>
+  return vdst;
+ 359:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 35c:	c9                   	leave
+ 35d:	c3                   	ret
+
+0000035e <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 35e:	83 3d 18 13 00 00 00 	cmpl   $0x0,0x1318
+  jg 2f
+ 365:	7f 2e                	jg     395 <dosyscall+0x37>
+  jl 1f
+ 367:	7c 29                	jl     392 <dosyscall+0x34>
+  pushl %eax
+ 369:	50                   	push   %eax
+  pushl %ebx
+ 36a:	53                   	push   %ebx
+  movl $1, %eax
+ 36b:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 370:	0f a2                	cpuid
+  popl %ebx
+ 372:	5b                   	pop    %ebx
+  popl %eax
+ 373:	58                   	pop    %eax
+  movl $-1, sysmode
+ 374:	c7 05 18 13 00 00 ff 	movl   $0xffffffff,0x1318
+ 37b:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 37e:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 384:	74 0c                	je     392 <dosyscall+0x34>
+  movl $1, sysmode
+ 386:	c7 05 18 13 00 00 01 	movl   $0x1,0x1318
+ 38d:	00 00 00 
+  jmp 2f
+ 390:	eb 03                	jmp    395 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 392:	cd 40                	int    $0x40
+  ret
+ 394:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 395:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 397:	ba 9e 03 00 00       	mov    $0x39e,%edx
+  sysenter
+ 39c:	0f 34                	sysenter
+3:
+  ret
+ 39e:	c3                   	ret
+
+0000039f <fork>:
+
+SYSCALL(fork)
+ 39f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a4:	eb b8                	jmp    35e <dosyscall>
+
+000003a6 <exit>:
+SYSCALL(exit)
+ 3a6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ab:	eb b1                	jmp    35e <dosyscall>
+
+000003ad <wait>:
+SYSCALL(wait)
+ 3ad:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b2:	eb aa                	jmp    35e <dosyscall>
+
+000003b4 <pipe>:
+SYSCALL(pipe)
+ 3b4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b9:	eb a3                	jmp    35e <dosyscall>
+
+000003bb <read>:
+SYSCALL(read)
+ 3bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c0:	eb 9c                	jmp    35e <dosyscall>
+
+000003c2 <write>:
+SYSCALL(write)
+ 3c2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c7:	eb 95                	jmp    35e <dosyscall>
+
+000003c9 <close>:
+SYSCALL(close)
+ 3c9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ce:	eb 8e                	jmp    35e <dosyscall>
+
+000003d0 <kill>:
+SYSCALL(kill)
+ 3d0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d5:	eb 87                	jmp    35e <dosyscall>
+
+000003d7 <exec>:
+SYSCALL(exec)
+ 3d7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3dc:	eb 80                	jmp    35e <dosyscall>
+
+000003de <open>:
+SYSCALL(open)
+ 3de:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e3:	e9 76 ff ff ff       	jmp    35e <dosyscall>
+
+000003e8 <mknod>:
+SYSCALL(mknod)
+ 3e8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3ed:	e9 6c ff ff ff       	jmp    35e <dosyscall>
+
+000003f2 <unlink>:
+SYSCALL(unlink)
+ 3f2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f7:	e9 62 ff ff ff       	jmp    35e <dosyscall>
+
+000003fc <fstat>:
+SYSCALL(fstat)
+ 3fc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 401:	e9 58 ff ff ff       	jmp    35e <dosyscall>
+
+00000406 <link>:
+SYSCALL(link)
+ 406:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40b:	e9 4e ff ff ff       	jmp    35e <dosyscall>
+
+00000410 <mkdir>:
+SYSCALL(mkdir)
+ 410:	b8 14 00 00 00       	mov    $0x14,%eax
+ 415:	e9 44 ff ff ff       	jmp    35e <dosyscall>
+
+0000041a <chdir>:
+SYSCALL(chdir)
+ 41a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41f:	e9 3a ff ff ff       	jmp    35e <dosyscall>
+
+00000424 <dup>:
+SYSCALL(dup)
+ 424:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 429:	e9 30 ff ff ff       	jmp    35e <dosyscall>
+
+0000042e <getpid>:
+SYSCALL(getpid)
+ 42e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 433:	e9 26 ff ff ff       	jmp    35e <dosyscall>
+
+00000438 <sbrk>:
+SYSCALL(sbrk)
+ 438:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 43d:	e9 1c ff ff ff       	jmp    35e <dosyscall>
+
+00000442 <sleep>:
+SYSCALL(sleep)
+ 442:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 447:	e9 12 ff ff ff       	jmp    35e <dosyscall>
+
+0000044c <uptime>:
+SYSCALL(uptime)
+ 44c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 451:	e9 08 ff ff ff       	jmp    35e <dosyscall>
+
+00000456 <symlink>:
+SYSCALL(symlink)
+ 456:	b8 16 00 00 00       	mov    $0x16,%eax
+ 45b:	e9 fe fe ff ff       	jmp    35e <dosyscall>
+
+00000460 <readlink>:
+SYSCALL(readlink)
+ 460:	b8 17 00 00 00       	mov    $0x17,%eax
+ 465:	e9 f4 fe ff ff       	jmp    35e <dosyscall>
+
+0000046a <fprot>:
+SYSCALL(fprot)
+ 46a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 46f:	e9 ea fe ff ff       	jmp    35e <dosyscall>
+
+00000474 <funprot>:
+SYSCALL(funprot)
+ 474:	b8 19 00 00 00       	mov    $0x19,%eax
+ 479:	e9 e0 fe ff ff       	jmp    35e <dosyscall>
+
+0000047e <funlock>:
+SYSCALL(funlock)
+ 47e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 483:	e9 d6 fe ff ff       	jmp    35e <dosyscall>
+
+00000488 <mmap>:
+SYSCALL(mmap)
+ 488:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 48d:	e9 cc fe ff ff       	jmp    35e <dosyscall>
+
+00000492 <munmap>:
+SYSCALL(munmap)
+ 492:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 497:	e9 c2 fe ff ff       	jmp    35e <dosyscall>
+
+0000049c <sendfile>:
+SYSCALL(sendfile)
+ 49c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a1:	e9 b8 fe ff ff       	jmp    35e <dosyscall>
+
+000004a6 <readv>:
+SYSCALL(readv)
+ 4a6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4ab:	e9 ae fe ff ff       	jmp    35e <dosyscall>
+
+000004b0 <writev>:
+SYSCALL(writev)
+ 4b0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b5:	e9 a4 fe ff ff       	jmp    35e <dosyscall>
+
+000004ba <pread>:
+SYSCALL(pread)
+ 4ba:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4bf:	e9 9a fe ff ff       	jmp    35e <dosyscall>
+
+000004c4 <pwrite>:
+SYSCALL(pwrite)
+ 4c4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c9:	e9 90 fe ff ff       	jmp    35e <dosyscall>
+
+000004ce <lseek>:
+SYSCALL(lseek)
+ 4ce:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4d3:	e9 86 fe ff ff       	jmp    35e <dosyscall>
+
+000004d8 <spawn>:
+SYSCALL(spawn)
+ 4d8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4dd:	e9 7c fe ff ff       	jmp    35e <dosyscall>
+
+000004e2 <setpriority>:
+SYSCALL(setpriority)
+ 4e2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4e7:	e9 72 fe ff ff       	jmp    35e <dosyscall>
+
+000004ec <kthread_create>:
+SYSCALL(kthread_create)
+ 4ec:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4f1:	e9 68 fe ff ff       	jmp    35e <dosyscall>
+
+000004f6 <kthread_id>:
+SYSCALL(kthread_id)
+ 4f6:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4fb:	e9 5e fe ff ff       	jmp    35e <dosyscall>
+
+00000500 <kthread_exit>:
+SYSCALL(kthread_exit)
+ 500:	b8 27 00 00 00       	mov    $0x27,%eax
+ 505:	e9 54 fe ff ff       	jmp    35e <dosyscall>
+
+0000050a <kthread_join>:
+SYSCALL(kthread_join)
+ 50a:	b8 28 00 00 00       	mov    $0x28,%eax
+ 50f:	e9 4a fe ff ff       	jmp    35e <dosyscall>
+
+00000514 <futex>:
+SYSCALL(futex)
+ 514:	b8 29 00 00 00       	mov    $0x29,%eax
+ 519:	e9 40 fe ff ff       	jmp    35e <dosyscall>
+
+0000051e <signal>:
+SYSCALL(signal)
+ 51e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 523:	e9 36 fe ff ff       	jmp    35e <dosyscall>
+
+00000528 <alarm>:
+SYSCALL(alarm)
+ 528:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 52d:	e9 2c fe ff ff       	jmp    35e <dosyscall>
+
+00000532 <usleep>:
+SYSCALL(usleep)
+ 532:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 537:	e9 22 fe ff ff       	jmp    35e <dosyscall>
+
+0000053c <ioring_setup>:
+SYSCALL(ioring_setup)
+ 53c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 541:	e9 18 fe ff ff       	jmp    35e <dosyscall>
+
+00000546 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 546:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 54b:	e9 0e fe ff ff       	jmp    35e <dosyscall>
+
+00000550 <getrusage>:
+SYSCALL(getrusage)
+ 550:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 555:	e9 04 fe ff ff       	jmp    35e <dosyscall>
+
+0000055a <mount>:
+SYSCALL(mount)
+ 55a:	b8 30 00 00 00       	mov    $0x30,%eax
+ 55f:	e9 fa fd ff ff       	jmp    35e <dosyscall>
+
+00000564 <getdents>:
+SYSCALL(getdents)
+ 564:	b8 31 00 00 00       	mov    $0x31,%eax
+ 569:	e9 f0 fd ff ff       	jmp    35e <dosyscall>
+
+0000056e <yield>:
+SYSCALL(yield)
+ 56e:	b8 32 00 00 00       	mov    $0x32,%eax
+ 573:	e9 e6 fd ff ff       	jmp    35e <dosyscall>
+
+00000578 <ncpu>:
+SYSCALL(ncpu)
+ 578:	b8 33 00 00 00       	mov    $0x33,%eax
+ 57d:	e9 dc fd ff ff       	jmp    35e <dosyscall>
+
+00000582 <fallocate>:
+SYSCALL(fallocate)
+ 582:	b8 34 00 00 00       	mov    $0x34,%eax
+ 587:	e9 d2 fd ff ff       	jmp    35e <dosyscall>
+
+0000058c <ftruncate>:
+SYSCALL(ftruncate)
+ 58c:	b8 35 00 00 00       	mov    $0x35,%eax
+ 591:	e9 c8 fd ff ff       	jmp    35e <dosyscall>
+
+00000596 <fsync>:
+SYSCALL(fsync)
+ 596:	b8 36 00 00 00       	mov    $0x36,%eax
+ 59b:	e9 be fd ff ff       	jmp    35e <dosyscall>
+
+000005a0 <fdatasync>:
+SYSCALL(fdatasync)
+ 5a0:	b8 37 00 00 00       	mov    $0x37,%eax
+ 5a5:	e9 b4 fd ff ff       	jmp    35e <dosyscall>
+
+000005aa <poll>:
+SYSCALL(poll)
+ 5aa:	b8 38 00 00 00       	mov    $0x38,%eax
+ 5af:	e9 aa fd ff ff       	jmp    35e <dosyscall>
+
+000005b4 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 5b4:	55                   	push   %ebp
+ 5b5:	89 e5                	mov    %esp,%ebp
+ 5b7:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 5ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 5c0:	85 c0                	test   %eax,%eax
+ 5c2:	7e 1f                	jle    5e3 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 5c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c7:	8b 50 04             	mov    0x4(%eax),%edx
+ 5ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cd:	8d 48 08             	lea    0x8(%eax),%ecx
+ 5d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d3:	8b 00                	mov    (%eax),%eax
+ 5d5:	83 ec 04             	sub    $0x4,%esp
+ 5d8:	52                   	push   %edx
+ 5d9:	51                   	push   %ecx
+ 5da:	50                   	push   %eax
+ 5db:	e8 d0 fe ff ff       	call   4b0 <writev>
+ 5e0:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f0:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 5f7:	00 00 00 
+}
+ 5fa:	90                   	nop
+ 5fb:	c9                   	leave
+ 5fc:	c3                   	ret
+
+000005fd <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 5fd:	55                   	push   %ebp
+ 5fe:	89 e5                	mov    %esp,%ebp
+ 600:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 603:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 607:	0f 84 94 00 00 00    	je     6a1 <put+0xa4>
+    return;
+  if(o->n > 0){
+ 60d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 610:	8b 40 04             	mov    0x4(%eax),%eax
+ 613:	85 c0                	test   %eax,%eax
+ 615:	7e 40                	jle    657 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 617:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61a:	8b 40 04             	mov    0x4(%eax),%eax
+ 61d:	83 e8 01             	sub    $0x1,%eax
+ 620:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 627:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62a:	01 d0                	add    %edx,%eax
+ 62c:	83 c0 08             	add    $0x8,%eax
+ 62f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 635:	8b 10                	mov    (%eax),%edx
+ 637:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63a:	8b 40 04             	mov    0x4(%eax),%eax
+ 63d:	01 d0                	add    %edx,%eax
+ 63f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 642:	75 13                	jne    657 <put+0x5a>
+      v->iov_len += n;
+ 644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 647:	8b 50 04             	mov    0x4(%eax),%edx
+ 64a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 64d:	01 c2                	add    %eax,%edx
+ 64f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 652:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 655:	eb 4b                	jmp    6a2 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 657:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65a:	8b 40 04             	mov    0x4(%eax),%eax
+ 65d:	83 f8 10             	cmp    $0x10,%eax
+ 660:	75 0e                	jne    670 <put+0x73>
+    flush(o);
+ 662:	83 ec 0c             	sub    $0xc,%esp
+ 665:	ff 75 08             	push   0x8(%ebp)
+ 668:	e8 47 ff ff ff       	call   5b4 <flush>
+ 66d:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 670:	8b 45 08             	mov    0x8(%ebp),%eax
+ 673:	8b 50 04             	mov    0x4(%eax),%edx
+ 676:	8b 45 08             	mov    0x8(%ebp),%eax
+ 679:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 67c:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	8b 50 04             	mov    0x4(%eax),%edx
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+ 689:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 68c:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 690:	8b 45 08             	mov    0x8(%ebp),%eax
+ 693:	8b 40 04             	mov    0x4(%eax),%eax
+ 696:	8d 50 01             	lea    0x1(%eax),%edx
+ 699:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69c:	89 50 04             	mov    %edx,0x4(%eax)
+ 69f:	eb 01                	jmp    6a2 <put+0xa5>
+    return;
+ 6a1:	90                   	nop
+}
+ 6a2:	c9                   	leave
+ 6a3:	c3                   	ret
+
+000006a4 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 6a4:	55                   	push   %ebp
+ 6a5:	89 e5                	mov    %esp,%ebp
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 6aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ad:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 6b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6b6:	01 d0                	add    %edx,%eax
+ 6b8:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 6bd:	77 0b                	ja     6ca <room+0x26>
+ 6bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c2:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c5:	83 f8 10             	cmp    $0x10,%eax
+ 6c8:	75 0e                	jne    6d8 <room+0x34>
+    flush(o);
+ 6ca:	83 ec 0c             	sub    $0xc,%esp
+ 6cd:	ff 75 08             	push   0x8(%ebp)
+ 6d0:	e8 df fe ff ff       	call   5b4 <flush>
+ 6d5:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 6d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6db:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 6e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 6ea:	01 d0                	add    %edx,%eax
+}
+ 6ec:	c9                   	leave
+ 6ed:	c3                   	ret
+
+000006ee <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 6ee:	55                   	push   %ebp
+ 6ef:	89 e5                	mov    %esp,%ebp
+ 6f1:	83 ec 28             	sub    $0x28,%esp
+ 6f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6f7:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 6fa:	83 ec 08             	sub    $0x8,%esp
+ 6fd:	6a 01                	push   $0x1
+ 6ff:	ff 75 08             	push   0x8(%ebp)
+ 702:	e8 9d ff ff ff       	call   6a4 <room>
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 70d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 710:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 714:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 716:	8b 45 08             	mov    0x8(%ebp),%eax
+ 719:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 71f:	8d 50 01             	lea    0x1(%eax),%edx
+ 722:	8b 45 08             	mov    0x8(%ebp),%eax
+ 725:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	6a 01                	push   $0x1
+ 730:	ff 75 f4             	push   -0xc(%ebp)
+ 733:	ff 75 08             	push   0x8(%ebp)
+ 736:	e8 c2 fe ff ff       	call   5fd <put>
+ 73b:	83 c4 10             	add    $0x10,%esp
+}
+ 73e:	90                   	nop
+ 73f:	c9                   	leave
+ 740:	c3                   	ret
+
+00000741 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 741:	55                   	push   %ebp
+ 742:	89 e5                	mov    %esp,%ebp
+ 744:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 747:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 74e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 752:	74 17                	je     76b <printint+0x2a>
+ 754:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 758:	79 11                	jns    76b <printint+0x2a>
+    neg = 1;
+ 75a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 761:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 764:	f7 d8                	neg    %eax
+ 766:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 769:	eb 06                	jmp    771 <printint+0x30>
+  } else {
+    x = xx;
+ 76b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 76e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 771:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 778:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 77b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 77e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 783:	f7 f1                	div    %ecx
+ 785:	89 d1                	mov    %edx,%ecx
+ 787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78a:	8d 50 01             	lea    0x1(%eax),%edx
+ 78d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 790:	0f b6 91 1c 13 00 00 	movzbl 0x131c(%ecx),%edx
+ 797:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 79b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 79e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7a1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7a6:	f7 f1                	div    %ecx
+ 7a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7af:	75 c7                	jne    778 <printint+0x37>
+  if(neg)
+ 7b1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7b5:	74 0e                	je     7c5 <printint+0x84>
+    buf[i++] = '-';
+ 7b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ba:	8d 50 01             	lea    0x1(%eax),%edx
+ 7bd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7c0:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 7c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 7cb:	83 ec 08             	sub    $0x8,%esp
+ 7ce:	ff 75 e8             	push   -0x18(%ebp)
+ 7d1:	ff 75 08             	push   0x8(%ebp)
+ 7d4:	e8 cb fe ff ff       	call   6a4 <room>
+ 7d9:	83 c4 10             	add    $0x10,%esp
+ 7dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 7df:	eb 1d                	jmp    7fe <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 7e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e4:	83 e8 01             	sub    $0x1,%eax
+ 7e7:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 7ea:	89 c2                	mov    %eax,%edx
+ 7ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ef:	01 c2                	add    %eax,%edx
+ 7f1:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 7f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f7:	01 c8                	add    %ecx,%eax
+ 7f9:	0f b6 00             	movzbl (%eax),%eax
+ 7fc:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 7fe:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 802:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 806:	79 d9                	jns    7e1 <printint+0xa0>
+  o->used += n;
+ 808:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80b:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 811:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 814:	01 c2                	add    %eax,%edx
+ 816:	8b 45 08             	mov    0x8(%ebp),%eax
+ 819:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 81f:	83 ec 04             	sub    $0x4,%esp
+ 822:	ff 75 e8             	push   -0x18(%ebp)
+ 825:	ff 75 e4             	push   -0x1c(%ebp)
+ 828:	ff 75 08             	push   0x8(%ebp)
+ 82b:	e8 cd fd ff ff       	call   5fd <put>
+ 830:	83 c4 10             	add    $0x10,%esp
+}
+ 833:	90                   	nop
+ 834:	c9                   	leave
+ 835:	c3                   	ret
+
+00000836 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 836:	55                   	push   %ebp
+ 837:	89 e5                	mov    %esp,%ebp
+ 839:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 83f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 842:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 848:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 84f:	00 00 00 
+  o.used = 0;
+ 852:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 859:	00 00 00 
+  state = 0;
+ 85c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 863:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 866:	83 c0 04             	add    $0x4,%eax
+ 869:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 86c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 873:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 87a:	e9 82 01 00 00       	jmp    a01 <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 87f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 882:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 885:	01 d0                	add    %edx,%eax
+ 887:	0f b6 00             	movzbl (%eax),%eax
+ 88a:	0f be c0             	movsbl %al,%eax
+ 88d:	25 ff 00 00 00       	and    $0xff,%eax
+ 892:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 895:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 899:	75 38                	jne    8d3 <printf+0x9d>
+      if(c == '%'){
+ 89b:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 89f:	0f 85 58 01 00 00    	jne    9fd <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 8a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 8ae:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8b1:	01 ca                	add    %ecx,%edx
+ 8b3:	83 ec 04             	sub    $0x4,%esp
+ 8b6:	50                   	push   %eax
+ 8b7:	52                   	push   %edx
+ 8b8:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8be:	50                   	push   %eax
+ 8bf:	e8 39 fd ff ff       	call   5fd <put>
+ 8c4:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 8c7:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 8ce:	e9 2a 01 00 00       	jmp    9fd <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 8d3:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 8d7:	0f 85 20 01 00 00    	jne    9fd <printf+0x1c7>
+      if(c == 'd'){
+ 8dd:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 8e1:	75 22                	jne    905 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 8e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e6:	8b 00                	mov    (%eax),%eax
+ 8e8:	6a 01                	push   $0x1
+ 8ea:	6a 0a                	push   $0xa
+ 8ec:	50                   	push   %eax
+ 8ed:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8f3:	50                   	push   %eax
+ 8f4:	e8 48 fe ff ff       	call   741 <printint>
+ 8f9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8fc:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 900:	e9 e8 00 00 00       	jmp    9ed <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 905:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 909:	74 06                	je     911 <printf+0xdb>
+ 90b:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 90f:	75 22                	jne    933 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 911:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 914:	8b 00                	mov    (%eax),%eax
+ 916:	6a 00                	push   $0x0
+ 918:	6a 10                	push   $0x10
+ 91a:	50                   	push   %eax
+ 91b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 921:	50                   	push   %eax
+ 922:	e8 1a fe ff ff       	call   741 <printint>
+ 927:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 92a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 92e:	e9 ba 00 00 00       	jmp    9ed <printf+0x1b7>
+      } else if(c == 's'){
+ 933:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 937:	75 3f                	jne    978 <printf+0x142>
+        s = (char*)*ap;
+ 939:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93c:	8b 00                	mov    (%eax),%eax
+ 93e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 941:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 945:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 949:	75 07                	jne    952 <printf+0x11c>
+          s = "(null)";
+ 94b:	c7 45 f4 82 0f 00 00 	movl   $0xf82,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 952:	83 ec 0c             	sub    $0xc,%esp
+ 955:	ff 75 f4             	push   -0xc(%ebp)
+ 958:	e8 47 f8 ff ff       	call   1a4 <strlen>
+ 95d:	83 c4 10             	add    $0x10,%esp
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	50                   	push   %eax
+ 964:	ff 75 f4             	push   -0xc(%ebp)
+ 967:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 96d:	50                   	push   %eax
+ 96e:	e8 8a fc ff ff       	call   5fd <put>
+ 973:	83 c4 10             	add    $0x10,%esp
+ 976:	eb 75                	jmp    9ed <printf+0x1b7>
+      } else if(c == 'c'){
+ 978:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 97c:	75 21                	jne    99f <printf+0x169>
+        putc(&o, *ap);
+ 97e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 981:	8b 00                	mov    (%eax),%eax
+ 983:	0f be c0             	movsbl %al,%eax
+ 986:	83 ec 08             	sub    $0x8,%esp
+ 989:	50                   	push   %eax
+ 98a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 990:	50                   	push   %eax
+ 991:	e8 58 fd ff ff       	call   6ee <putc>
+ 996:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 999:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 99d:	eb 4e                	jmp    9ed <printf+0x1b7>
+      } else if(c == '%'){
+ 99f:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 9a3:	75 1b                	jne    9c0 <printf+0x18a>
+        putc(&o, c);
+ 9a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9a8:	0f be c0             	movsbl %al,%eax
+ 9ab:	83 ec 08             	sub    $0x8,%esp
+ 9ae:	50                   	push   %eax
+ 9af:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9b5:	50                   	push   %eax
+ 9b6:	e8 33 fd ff ff       	call   6ee <putc>
+ 9bb:	83 c4 10             	add    $0x10,%esp
+ 9be:	eb 2d                	jmp    9ed <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 9c0:	83 ec 08             	sub    $0x8,%esp
+ 9c3:	6a 25                	push   $0x25
+ 9c5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9cb:	50                   	push   %eax
+ 9cc:	e8 1d fd ff ff       	call   6ee <putc>
+ 9d1:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 9d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 9d7:	0f be c0             	movsbl %al,%eax
+ 9da:	83 ec 08             	sub    $0x8,%esp
+ 9dd:	50                   	push   %eax
+ 9de:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9e4:	50                   	push   %eax
+ 9e5:	e8 04 fd ff ff       	call   6ee <putc>
+ 9ea:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9ed:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 9f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f7:	83 c0 01             	add    $0x1,%eax
+ 9fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9fd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a01:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a04:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a07:	01 d0                	add    %edx,%eax
+ a09:	0f b6 00             	movzbl (%eax),%eax
+ a0c:	84 c0                	test   %al,%al
+ a0e:	0f 85 6b fe ff ff    	jne    87f <printf+0x49>
+    }
+  }
+  if(state == 0)
+ a14:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ a18:	75 22                	jne    a3c <printf+0x206>
+    put(&o, fmt + start, i - start);
+ a1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a23:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a26:	01 ca                	add    %ecx,%edx
+ a28:	83 ec 04             	sub    $0x4,%esp
+ a2b:	50                   	push   %eax
+ a2c:	52                   	push   %edx
+ a2d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a33:	50                   	push   %eax
+ a34:	e8 c4 fb ff ff       	call   5fd <put>
+ a39:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ a3c:	83 ec 0c             	sub    $0xc,%esp
+ a3f:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a45:	50                   	push   %eax
+ a46:	e8 69 fb ff ff       	call   5b4 <flush>
+ a4b:	83 c4 10             	add    $0x10,%esp
+}
+ a4e:	90                   	nop
+ a4f:	c9                   	leave
+ a50:	c3                   	ret
+
+00000a51 <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ a51:	55                   	push   %ebp
+ a52:	89 e5                	mov    %esp,%ebp
+ a54:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ a57:	8b 55 08             	mov    0x8(%ebp),%edx
+ a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ a60:	f0 87 02             	lock xchg %eax,(%edx)
+ a63:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ a66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ a69:	c9                   	leave
+ a6a:	c3                   	ret
+
+00000a6b <lock>:
+{
+ a6b:	55                   	push   %ebp
+ a6c:	89 e5                	mov    %esp,%ebp
+ a6e:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ a71:	a1 30 13 00 00       	mov    0x1330,%eax
+ a76:	85 c0                	test   %eax,%eax
+ a78:	74 09                	je     a83 <lock+0x18>
+ a7a:	a1 30 13 00 00       	mov    0x1330,%eax
+ a7f:	ff d0                	call   *%eax
+ a81:	eb 05                	jmp    a88 <lock+0x1d>
+ a83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ a8b:	90                   	nop
+ a8c:	83 ec 08             	sub    $0x8,%esp
+ a8f:	6a 01                	push   $0x1
+ a91:	68 68 13 00 00       	push   $0x1368
+ a96:	e8 b6 ff ff ff       	call   a51 <xchg>
+ a9b:	83 c4 10             	add    $0x10,%esp
+ a9e:	85 c0                	test   %eax,%eax
+ aa0:	75 ea                	jne    a8c <lock+0x21>
+  return pin;
+ aa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ aa5:	c9                   	leave
+ aa6:	c3                   	ret
+
+00000aa7 <unlock>:
+{
+ aa7:	55                   	push   %ebp
+ aa8:	89 e5                	mov    %esp,%ebp
+ aaa:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ aad:	6a 00                	push   $0x0
+ aaf:	68 68 13 00 00       	push   $0x1368
+ ab4:	e8 98 ff ff ff       	call   a51 <xchg>
+ ab9:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ abc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ac0:	78 10                	js     ad2 <unlock+0x2b>
+    mallocunpin(pin);
+ ac2:	a1 34 13 00 00       	mov    0x1334,%eax
+ ac7:	83 ec 0c             	sub    $0xc,%esp
+ aca:	ff 75 08             	push   0x8(%ebp)
+ acd:	ff d0                	call   *%eax
+ acf:	83 c4 10             	add    $0x10,%esp
+}
+ ad2:	90                   	nop
+ ad3:	c9                   	leave
+ ad4:	c3                   	ret
+
+00000ad5 <sizeclass>:
+{
+ ad5:	55                   	push   %ebp
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ adb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ ae2:	eb 1c                	jmp    b00 <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ ae4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae7:	ba 02 00 00 00       	mov    $0x2,%edx
+ aec:	89 c1                	mov    %eax,%ecx
+ aee:	d3 e2                	shl    %cl,%edx
+ af0:	89 d0                	mov    %edx,%eax
+ af2:	3b 45 08             	cmp    0x8(%ebp),%eax
+ af5:	72 05                	jb     afc <sizeclass+0x27>
+      return c;
+ af7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afa:	eb 0f                	jmp    b0b <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ afc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ b00:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ b04:	7e de                	jle    ae4 <sizeclass+0xf>
+  return -1;
+ b06:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b0b:	c9                   	leave
+ b0c:	c3                   	ret
+
+00000b0d <bigfree>:
+{
+ b0d:	55                   	push   %ebp
+ b0e:	89 e5                	mov    %esp,%ebp
+ b10:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b13:	a1 40 13 00 00       	mov    0x1340,%eax
+ b18:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b1b:	eb 24                	jmp    b41 <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b1d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b20:	8b 00                	mov    (%eax),%eax
+ b22:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b25:	72 12                	jb     b39 <bigfree+0x2c>
+ b27:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b2d:	72 24                	jb     b53 <bigfree+0x46>
+ b2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b32:	8b 00                	mov    (%eax),%eax
+ b34:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b37:	72 1a                	jb     b53 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3c:	8b 00                	mov    (%eax),%eax
+ b3e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b41:	8b 45 08             	mov    0x8(%ebp),%eax
+ b44:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b47:	73 d4                	jae    b1d <bigfree+0x10>
+ b49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4c:	8b 00                	mov    (%eax),%eax
+ b4e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b51:	73 ca                	jae    b1d <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ b53:	8b 45 08             	mov    0x8(%ebp),%eax
+ b56:	8b 40 04             	mov    0x4(%eax),%eax
+ b59:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b60:	8b 45 08             	mov    0x8(%ebp),%eax
+ b63:	01 c2                	add    %eax,%edx
+ b65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b68:	8b 00                	mov    (%eax),%eax
+ b6a:	39 c2                	cmp    %eax,%edx
+ b6c:	75 24                	jne    b92 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b71:	8b 50 04             	mov    0x4(%eax),%edx
+ b74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b77:	8b 00                	mov    (%eax),%eax
+ b79:	8b 40 04             	mov    0x4(%eax),%eax
+ b7c:	01 c2                	add    %eax,%edx
+ b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b81:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b84:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b87:	8b 00                	mov    (%eax),%eax
+ b89:	8b 10                	mov    (%eax),%edx
+ b8b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8e:	89 10                	mov    %edx,(%eax)
+ b90:	eb 0a                	jmp    b9c <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ b92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b95:	8b 10                	mov    (%eax),%edx
+ b97:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9f:	8b 40 04             	mov    0x4(%eax),%eax
+ ba2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ba9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bac:	01 d0                	add    %edx,%eax
+ bae:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bb1:	75 20                	jne    bd3 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ bb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb6:	8b 50 04             	mov    0x4(%eax),%edx
+ bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbc:	8b 40 04             	mov    0x4(%eax),%eax
+ bbf:	01 c2                	add    %eax,%edx
+ bc1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bca:	8b 10                	mov    (%eax),%edx
+ bcc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bcf:	89 10                	mov    %edx,(%eax)
+ bd1:	eb 08                	jmp    bdb <bigfree+0xce>
+    p->s.ptr = bp;
+ bd3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd6:	8b 55 08             	mov    0x8(%ebp),%edx
+ bd9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ bdb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bde:	a3 40 13 00 00       	mov    %eax,0x1340
+}
+ be3:	90                   	nop
+ be4:	c9                   	leave
+ be5:	c3                   	ret
+
+00000be6 <free>:
+{
+ be6:	55                   	push   %ebp
+ be7:	89 e5                	mov    %esp,%ebp
+ be9:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ bec:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bf0:	74 68                	je     c5a <free+0x74>
+  bp = (Header*)ap - 1;
+ bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf5:	83 e8 08             	sub    $0x8,%eax
+ bf8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ bfb:	e8 6b fe ff ff       	call   a6b <lock>
+ c00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ c03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c06:	8b 40 04             	mov    0x4(%eax),%eax
+ c09:	83 ec 0c             	sub    $0xc,%esp
+ c0c:	50                   	push   %eax
+ c0d:	e8 c3 fe ff ff       	call   ad5 <sizeclass>
+ c12:	83 c4 10             	add    $0x10,%esp
+ c15:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ c18:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ c1c:	78 1e                	js     c3c <free+0x56>
+    bp->s.ptr = classfree[c];
+ c1e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c21:	8b 14 85 44 13 00 00 	mov    0x1344(,%eax,4),%edx
+ c28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2b:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ c2d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c30:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c33:	89 14 85 44 13 00 00 	mov    %edx,0x1344(,%eax,4)
+ c3a:	eb 0e                	jmp    c4a <free+0x64>
+    bigfree(bp);
+ c3c:	83 ec 0c             	sub    $0xc,%esp
+ c3f:	ff 75 f4             	push   -0xc(%ebp)
+ c42:	e8 c6 fe ff ff       	call   b0d <bigfree>
+ c47:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ c4a:	83 ec 0c             	sub    $0xc,%esp
+ c4d:	ff 75 f0             	push   -0x10(%ebp)
+ c50:	e8 52 fe ff ff       	call   aa7 <unlock>
+ c55:	83 c4 10             	add    $0x10,%esp
+ c58:	eb 01                	jmp    c5b <free+0x75>
+    return;
+ c5a:	90                   	nop
+}
+ c5b:	c9                   	leave
+ c5c:	c3                   	ret
+
+00000c5d <morecore>:
+{
+ c5d:	55                   	push   %ebp
+ c5e:	89 e5                	mov    %esp,%ebp
+ c60:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ c63:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c6a:	77 07                	ja     c73 <morecore+0x16>
+    nu = 4096;
+ c6c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c73:	8b 45 08             	mov    0x8(%ebp),%eax
+ c76:	c1 e0 03             	shl    $0x3,%eax
+ c79:	83 ec 0c             	sub    $0xc,%esp
+ c7c:	50                   	push   %eax
+ c7d:	e8 b6 f7 ff ff       	call   438 <sbrk>
+ c82:	83 c4 10             	add    $0x10,%esp
+ c85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c88:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c8c:	75 07                	jne    c95 <morecore+0x38>
+    return 0;
+ c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+ c93:	eb 22                	jmp    cb7 <morecore+0x5a>
+  hp = (Header*)p;
+ c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c98:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+ ca1:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ ca4:	83 ec 0c             	sub    $0xc,%esp
+ ca7:	ff 75 f0             	push   -0x10(%ebp)
+ caa:	e8 5e fe ff ff       	call   b0d <bigfree>
+ caf:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cb2:	a1 40 13 00 00       	mov    0x1340,%eax
+}
+ cb7:	c9                   	leave
+ cb8:	c3                   	ret
+
+00000cb9 <bigalloc>:
+{
+ cb9:	55                   	push   %ebp
+ cba:	89 e5                	mov    %esp,%ebp
+ cbc:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ cbf:	a1 40 13 00 00       	mov    0x1340,%eax
+ cc4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cc7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ccb:	75 23                	jne    cf0 <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ ccd:	c7 45 f0 38 13 00 00 	movl   $0x1338,-0x10(%ebp)
+ cd4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd7:	a3 40 13 00 00       	mov    %eax,0x1340
+ cdc:	a1 40 13 00 00       	mov    0x1340,%eax
+ ce1:	a3 38 13 00 00       	mov    %eax,0x1338
+    base.s.size = 0;
+ ce6:	c7 05 3c 13 00 00 00 	movl   $0x0,0x133c
+ ced:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cf3:	8b 00                	mov    (%eax),%eax
+ cf5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfb:	8b 40 04             	mov    0x4(%eax),%eax
+ cfe:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d01:	72 4a                	jb     d4d <bigalloc+0x94>
+      if(p->s.size == nunits)
+ d03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d06:	8b 40 04             	mov    0x4(%eax),%eax
+ d09:	39 45 08             	cmp    %eax,0x8(%ebp)
+ d0c:	75 0c                	jne    d1a <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d11:	8b 10                	mov    (%eax),%edx
+ d13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d16:	89 10                	mov    %edx,(%eax)
+ d18:	eb 26                	jmp    d40 <bigalloc+0x87>
+        p->s.size -= nunits;
+ d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1d:	8b 40 04             	mov    0x4(%eax),%eax
+ d20:	2b 45 08             	sub    0x8(%ebp),%eax
+ d23:	89 c2                	mov    %eax,%edx
+ d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d28:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2e:	8b 40 04             	mov    0x4(%eax),%eax
+ d31:	c1 e0 03             	shl    $0x3,%eax
+ d34:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+ d3d:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ d40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d43:	a3 40 13 00 00       	mov    %eax,0x1340
+      return p;
+ d48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4b:	eb 3b                	jmp    d88 <bigalloc+0xcf>
+    if(p == freep)
+ d4d:	a1 40 13 00 00       	mov    0x1340,%eax
+ d52:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d55:	75 1e                	jne    d75 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ d57:	83 ec 0c             	sub    $0xc,%esp
+ d5a:	ff 75 08             	push   0x8(%ebp)
+ d5d:	e8 fb fe ff ff       	call   c5d <morecore>
+ d62:	83 c4 10             	add    $0x10,%esp
+ d65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d68:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d6c:	75 07                	jne    d75 <bigalloc+0xbc>
+        return 0;
+ d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+ d73:	eb 13                	jmp    d88 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d78:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d7e:	8b 00                	mov    (%eax),%eax
+ d80:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d83:	e9 70 ff ff ff       	jmp    cf8 <bigalloc+0x3f>
+}
+ d88:	c9                   	leave
+ d89:	c3                   	ret
+
+00000d8a <alloc>:
+alloc(uint nbytes)
+{
+ d8a:	55                   	push   %ebp
+ d8b:	89 e5                	mov    %esp,%ebp
+ d8d:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d90:	8b 45 08             	mov    0x8(%ebp),%eax
+ d93:	83 c0 07             	add    $0x7,%eax
+ d96:	c1 e8 03             	shr    $0x3,%eax
+ d99:	83 c0 01             	add    $0x1,%eax
+ d9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ d9f:	ff 75 f4             	push   -0xc(%ebp)
+ da2:	e8 2e fd ff ff       	call   ad5 <sizeclass>
+ da7:	83 c4 04             	add    $0x4,%esp
+ daa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ db1:	79 2c                	jns    ddf <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ db3:	83 ec 0c             	sub    $0xc,%esp
+ db6:	ff 75 f4             	push   -0xc(%ebp)
+ db9:	e8 fb fe ff ff       	call   cb9 <bigalloc>
+ dbe:	83 c4 10             	add    $0x10,%esp
+ dc1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ dc4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ dc8:	75 0a                	jne    dd4 <alloc+0x4a>
+      return 0;
+ dca:	b8 00 00 00 00       	mov    $0x0,%eax
+ dcf:	e9 c8 00 00 00       	jmp    e9c <alloc+0x112>
+    return (void*)(p + 1);
+ dd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dd7:	83 c0 08             	add    $0x8,%eax
+ dda:	e9 bd 00 00 00       	jmp    e9c <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ ddf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ de2:	8b 04 85 44 13 00 00 	mov    0x1344(,%eax,4),%eax
+ de9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ dec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ df0:	74 1a                	je     e0c <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ df2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ df5:	8b 10                	mov    (%eax),%edx
+ df7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dfa:	89 14 85 44 13 00 00 	mov    %edx,0x1344(,%eax,4)
+    return (void*)(p + 1);
+ e01:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e04:	83 c0 08             	add    $0x8,%eax
+ e07:	e9 90 00 00 00       	jmp    e9c <alloc+0x112>
+  }
+  nunits = 2 << c;
+ e0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e0f:	ba 02 00 00 00       	mov    $0x2,%edx
+ e14:	89 c1                	mov    %eax,%ecx
+ e16:	d3 e2                	shl    %cl,%edx
+ e18:	89 d0                	mov    %edx,%eax
+ e1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ e1d:	a1 60 13 00 00       	mov    0x1360,%eax
+ e22:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e25:	c1 e2 03             	shl    $0x3,%edx
+ e28:	01 d0                	add    %edx,%eax
+ e2a:	8b 15 64 13 00 00    	mov    0x1364,%edx
+ e30:	39 c2                	cmp    %eax,%edx
+ e32:	73 3f                	jae    e73 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ e34:	83 ec 0c             	sub    $0xc,%esp
+ e37:	68 00 08 00 00       	push   $0x800
+ e3c:	e8 78 fe ff ff       	call   cb9 <bigalloc>
+ e41:	83 c4 10             	add    $0x10,%esp
+ e44:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e47:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e4b:	75 07                	jne    e54 <alloc+0xca>
+      return 0;
+ e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+ e52:	eb 48                	jmp    e9c <alloc+0x112>
+    bump = (char*)p;
+ e54:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e57:	a3 60 13 00 00       	mov    %eax,0x1360
+    bumpend = (char*)(p + p->s.size);
+ e5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e5f:	8b 40 04             	mov    0x4(%eax),%eax
+ e62:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ e69:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e6c:	01 d0                	add    %edx,%eax
+ e6e:	a3 64 13 00 00       	mov    %eax,0x1364
+  }
+  p = (Header*)bump;
+ e73:	a1 60 13 00 00       	mov    0x1360,%eax
+ e78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ e7b:	a1 60 13 00 00       	mov    0x1360,%eax
+ e80:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e83:	c1 e2 03             	shl    $0x3,%edx
+ e86:	01 d0                	add    %edx,%eax
+ e88:	a3 60 13 00 00       	mov    %eax,0x1360
+  p->s.size = nunits;
+ e8d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e93:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ e96:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e99:	83 c0 08             	add    $0x8,%eax
+}
+ e9c:	c9                   	leave
+ e9d:	c3                   	ret
+
+00000e9e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e9e:	55                   	push   %ebp
+ e9f:	89 e5                	mov    %esp,%ebp
+ ea1:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ ea4:	e8 c2 fb ff ff       	call   a6b <lock>
+ ea9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ eac:	83 ec 0c             	sub    $0xc,%esp
+ eaf:	ff 75 08             	push   0x8(%ebp)
+ eb2:	e8 d3 fe ff ff       	call   d8a <alloc>
+ eb7:	83 c4 10             	add    $0x10,%esp
+ eba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ ebd:	83 ec 0c             	sub    $0xc,%esp
+ ec0:	ff 75 f4             	push   -0xc(%ebp)
+ ec3:	e8 df fb ff ff       	call   aa7 <unlock>
+ ec8:	83 c4 10             	add    $0x10,%esp
+  return p;
+ ecb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ece:	c9                   	leave
+ ecf:	c3                   	ret
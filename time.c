@@ -0,0 +1,32 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "rusage.h"
+
+// Run a command and report the time and events charged to it.
+int
+main(int argc, char **argv)
+{
+  struct rusage ru;
+  int pid, w, t0;
+
+  if(argc < 2){
+    printf(2, "usage: time cmd [arg...]\n");
+    exit();
+  }
+  t0 = uptime();
+  if((pid = spawn(argv[1], argv+1, 0, 0)) < 0){
+    printf(2, "time: spawn %s failed\n", argv[1]);
+    exit();
+  }
+  while((w = wait()) >= 0 && w != pid)
+    ;
+  if(getrusage(RUSAGE_CHILDREN, &ru) < 0){
+    printf(2, "time: getrusage failed\n");
+    exit();
+  }
+  printf(2, "%d real %d user %d sys (ticks)\n", uptime() - t0, ru.utime, ru.stime);
+  printf(2, "%d voluntary %d involuntary switches, %d faults, %d blocks in %d out\n",
+         ru.nvcsw, ru.nivcsw, ru.nfault, ru.nblkin, ru.nblkout);
+  exit();
+}
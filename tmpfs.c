@@ -0,0 +1,201 @@
+// In-memory file systems.
+//
+// mount() puts a new, empty tmpfs on a directory.  A tmpfs has
+// no disk, no log and no buffer cache: its inodes exist only in
+// the inode cache and its data only in the page cache, directories
+// and symbolic links included.  The i-node layer in fs.c tells
+// them apart by device number, TMPDEV and up, one per mount.
+//
+// An inode holds a reference to itself while it has links, so it
+// stays cached (see iupdate), and its pages are pinned, so they
+// stay cached until it is truncated (see tmppage).  Together the
+// file systems may use up to tmpfs.max pages.
+//
+// namex crosses mounts: a lookup that finds a covered directory
+// goes on in the root of the file system mounted there, and ".."
+// of that root goes to the parent of the covered directory.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "stat.h"
+#include "fs.h"
+#include "file.h"
+
+struct mount {
+  struct inode *dir;    // directory it covers; 0: unused
+  struct inode *root;   // 0 while being set up
+  uint ninode;          // last inum handed out
+};
+
+static struct {
+  struct spinlock lock;
+  struct mount mount[NMOUNT];
+  int npage;            // pages of data in all of them
+  int max;
+} tmpfs;
+
+void
+tmpinit(void)
+{
+  int n;
+
+  initlock(&tmpfs.lock, "tmpfs");
+  n = bootarg("tmppages", NTMPPAGE);
+  if(n <= 0)
+    n = kfreepages() / TMPFSFRAC;
+  tmpfs.max = n;
+}
+
+// Mount a new tmpfs on directory dp, which the caller holds a
+// reference to and has locked.  The mount keeps the reference.
+// Return 0, or -1 if dp is covered already or there is no room.
+int
+tmpmount(struct inode *dp)
+{
+  struct mount *m, *fm;
+  struct inode *root;
+
+  acquire(&tmpfs.lock);
+  fm = 0;
+  for(m = tmpfs.mount; m < tmpfs.mount + NMOUNT; m++){
+    if(m->dir == dp || m->root == dp){
+      release(&tmpfs.lock);
+      return -1;
+    }
+    if(m->dir == 0 && fm == 0)
+      fm = m;
+  }
+  if(fm == 0){
+    release(&tmpfs.lock);
+    return -1;
+  }
+  fm->dir = dp;
+  fm->ninode = 0;
+  release(&tmpfs.lock);
+
+  root = ialloc(TMPDEV + (fm - tmpfs.mount), T_DIR);
+  ilock(root);
+  root->nlink = 1;
+  iupdate(root);
+  // ".." is the root itself; namex goes above it.
+  if(dirlink(root, ".", root->inum) < 0 || dirlink(root, "..", root->inum) < 0)
+    panic("tmpmount");
+  iunlock(root);
+
+  acquire(&tmpfs.lock);
+  fm->root = root;
+  release(&tmpfs.lock);
+  return 0;
+}
+
+// Return a new inode number on tmpfs device dev.
+uint
+tmpinum(uint dev)
+{
+  uint inum;
+
+  if(dev < TMPDEV || dev >= TMPDEV + NMOUNT)
+    panic("tmpinum");
+  acquire(&tmpfs.lock);
+  inum = ++tmpfs.mount[dev - TMPDEV].ninode;
+  release(&tmpfs.lock);
+  return inum;
+}
+
+// If a tmpfs is mounted on ip, put ip and return the root of the
+// tmpfs instead.  Otherwise return ip.
+struct inode*
+mountcross(struct inode *ip)
+{
+  struct mount *m;
+  struct inode *root;
+
+  root = 0;
+  acquire(&tmpfs.lock);
+  for(m = tmpfs.mount; m < tmpfs.mount + NMOUNT; m++)
+    if(m->dir == ip && m->root)
+      root = m->root;
+  release(&tmpfs.lock);
+  if(root == 0)
+    return ip;
+  iput(ip);
+  return idup(root);
+}
+
+// If dp is the root of a mounted tmpfs, return the directory it
+// covers, with a reference held.  Otherwise return 0.
+struct inode*
+mountup(struct inode *dp)
+{
+  struct mount *m;
+  struct inode *dir;
+
+  if(dp->dev < TMPDEV)
+    return 0;
+  dir = 0;
+  acquire(&tmpfs.lock);
+  for(m = tmpfs.mount; m < tmpfs.mount + NMOUNT; m++)
+    if(m->root == dp)
+      dir = m->dir;
+  release(&tmpfs.lock);
+  return dir ? idup(dir) : 0;
+}
+
+// Is a tmpfs mounted on ip?
+int
+ismount(struct inode *ip)
+{
+  struct mount *m;
+  int r;
+
+  r = 0;
+  acquire(&tmpfs.lock);
+  for(m = tmpfs.mount; m < tmpfs.mount + NMOUNT; m++)
+    if(m->dir == ip)
+      r = 1;
+  release(&tmpfs.lock);
+  return r;
+}
+
+// Return page pgno of tmpfs inode ip with a reference held, as
+// ipage does.  A page the file does not have yet starts out zero
+// and is pinned.  Returns 0 if the file systems are full.  Caller
+// must hold ip locked.
+struct page*
+tmppage(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+
+  if((pg = pclookup(ip, pgno)) != 0 && pg->valid)
+    return pg;
+  if(pg)
+    pcput(pg);
+
+  acquire(&tmpfs.lock);
+  if(tmpfs.npage >= tmpfs.max){
+    release(&tmpfs.lock);
+    return 0;
+  }
+  tmpfs.npage++;
+  release(&tmpfs.lock);
+
+  if((pg = pcget(ip, pgno)) == 0 || pg->valid || !pcfill(pg)){
+    tmpfree(1);  // no page, or another locker made it
+    return pg;
+  }
+  memset(pg->data, 0, PGSIZE);
+  pcpin(pg);
+  return pg;
+}
+
+// Give back n pages that a truncated tmpfs inode had.
+void
+tmpfree(int n)
+{
+  acquire(&tmpfs.lock);
+  tmpfs.npage -= n;
+  release(&tmpfs.lock);
+}
@@ -32,36 +32,64 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Handle the system call whose trap frame is tf, made with
+// int $T_SYSCALL or, by way of sysentry, with sysenter.
+void
+systrap(struct trapframe *tf)
+{
+  if(proc->killed)
+    exit();
+  proc->tf = tf;
+  syscall();
+  if(proc->killed)
+    exit();
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
   if(tf->trapno == T_SYSCALL){
-    if(proc->killed)
-      exit();
-    proc->tf = tf;
-    syscall();
-    if(proc->killed)
-      exit();
+    systrap(tf);
     return;
   }
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+    if(!proftick(tf)){
+      // Only a profiler sample, not a clock tick.
+      lapiceoi();
+      return;
+    }
+    if(proc){
+      if((tf->cs&3) == DPL_USER)
+        proc->ru.utime++;
+      else
+        proc->ru.stime++;
+    }
     if(cpu->id == 0){
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      callouttick();
       release(&tickslock);
+      if(ticks % BOOSTTICKS == 0)
+        boost();
+    }
+    if(proc && proc->alarm && ++proc->alarmticks >= proc->alarm){
+      proc->alarmticks = 0;
+      proc->alarmdue = 1;
     }
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
-    ideintr();
+    ideintr(0);
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE+1:
-    // Bochs generates spurious IDE1 interrupts.
+    // Bochs generates spurious IDE1 interrupts; ideintr
+    // ignores those.
+    ideintr(1);
+    lapiceoi();
     break;
   case T_IRQ0 + IRQ_KBD:
     kbdintr();
@@ -71,6 +99,10 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlbintr();
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -78,6 +110,11 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
    
+  case T_PGFLT:
+    if(proc && rcr2() < KERNBASE && pagefault(rcr2(), tf->err & 2) == 0)
+      break;
+    // fall through
+   
   //PAGEBREAK: 13
   default:
     if(proc == 0 || (tf->cs&3) == 0){
@@ -100,10 +137,23 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU once its time slice is used up.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  // Preempted in user mode, the process is using no kernel state,
+  // so until it runs again swapout may take its pages.
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER && tick()){
+    proc->upreempt = (tf->cs&3) == DPL_USER;
     yield();
+    proc->upreempt = 0;
+  }
+
+  // Run a due SIGALRM handler on the way back to user space.
+  if(proc && proc->alarmdue && (tf->cs&3) == DPL_USER){
+    proc->alarmdue = 0;
+    if(proc->group->sighandler &&
+       register_handler((void (*)(void))proc->group->sighandler) < 0)
+      proc->killed = 1;
+  }
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
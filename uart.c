@@ -13,16 +13,34 @@
 
 #define COM1    0x3f8
 
+// Output goes through a ring, and the UART's transmit interrupt
+// moves it to the chip a FIFO's worth at a time, so writers do not
+// wait on the line.  A writer who finds the ring full sends the
+// oldest character itself, polling, as all output used to be sent;
+// consolewrite sleeps instead (uartwait).  After a panic, output
+// is sent as it comes.
+#define TXBUF 1024
+
 static int uart;    // is there a uart?
+static int fifo;    // characters the transmitter takes at once
+
+static struct {
+  struct spinlock lock;
+  char buf[TXBUF];
+  uint r;           // next to send
+  uint w;           // next to fill
+  int sync;         // send as it comes, without the ring
+} tx;
 
 void
 uartinit(void)
 {
   char *p;
 
-  // Turn off the FIFO
-  outb(COM1+2, 0);
-  
+  // Turn on the FIFOs, if it has them (a 16550A).
+  outb(COM1+2, 0x07);
+  fifo = (inb(COM1+2) & 0xC0) == 0xC0 ? 16 : 1;
+
   // 9600 baud, 8 data bits, 1 stop bit, parity off.
   outb(COM1+3, 0x80);    // Unlock divisor
   outb(COM1+0, 115200/9600);
@@ -34,6 +52,7 @@ uartinit(void)
   // If status is 0xFF, no serial port.
   if(inb(COM1+5) == 0xFF)
     return;
+  initlock(&tx.lock, "uart");
   uart = 1;
 
   // Acknowledge pre-existing interrupt conditions;
@@ -41,23 +60,103 @@ uartinit(void)
   inb(COM1+2);
   inb(COM1+0);
   picenable(IRQ_COM1);
-  ioapicenable(IRQ_COM1, 0);
+  ioapicenable(IRQ_COM1, -1);
   
   // Announce that we're here.
   for(p="xv6...\n"; *p; p++)
     uartputc(*p);
 }
 
+// Send c, waiting for the transmitter if it is busy.
+static void
+uartpoll(int c)
+{
+  int i;
+
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+    microdelay(10);
+  outb(COM1+0, c);
+}
+
+// Give the transmitter what it can take from the ring, and have it
+// interrupt when it wants more, if there is more.  If wake is set,
+// wake writers waiting for room; only the interrupt does, since
+// cprintf may be called with ptable.lock held.  Caller holds
+// tx.lock.
+static void
+uartstart(int wake)
+{
+  int i;
+
+  if(inb(COM1+5) & 0x20){
+    for(i = 0; i < fifo && tx.r != tx.w; i++)
+      outb(COM1+0, tx.buf[tx.r++ % TXBUF]);
+    if(i > 0 && wake)
+      wakeup(&tx);
+  }
+  outb(COM1+1, tx.r != tx.w ? 0x03 : 0x01);
+}
+
 void
 uartputc(int c)
+{
+  if(!uart)
+    return;
+  if(tx.sync){
+    uartpoll(c);
+    return;
+  }
+  acquire(&tx.lock);
+  if(tx.w - tx.r == TXBUF)
+    uartpoll(tx.buf[tx.r++ % TXBUF]);
+  tx.buf[tx.w++ % TXBUF] = c;
+  uartstart(0);
+  release(&tx.lock);
+}
+
+// Queue as many of the n characters at s as the ring has room
+// for, without waiting.  Return how many.
+int
+uartwrite(char *s, int n)
 {
   int i;
 
+  if(!uart || tx.sync){
+    for(i = 0; i < n; i++)
+      uartputc(s[i]);
+    return n;
+  }
+  acquire(&tx.lock);
+  for(i = 0; i < n && tx.w - tx.r < TXBUF; i++)
+    tx.buf[tx.w++ % TXBUF] = s[i];
+  uartstart(0);
+  release(&tx.lock);
+  return i;
+}
+
+// Sleep until the ring has room, or the process is killed.
+void
+uartwait(void)
+{
   if(!uart)
     return;
-  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
-    microdelay(10);
-  outb(COM1+0, c);
+  acquire(&tx.lock);
+  while(tx.w - tx.r == TXBUF && !tx.sync && !proc->killed)
+    sleep(&tx, &tx.lock);
+  release(&tx.lock);
+}
+
+// Send what is in the ring and then send as output comes, without
+// locks or interrupts, for panic.
+void
+uartpanic(void)
+{
+  if(!uart)
+    return;
+  tx.sync = 1;
+  outb(COM1+1, 0x01);
+  while(tx.r != tx.w)
+    uartpoll(tx.buf[tx.r++ % TXBUF]);
 }
 
 static int
@@ -74,4 +173,9 @@ void
 uartintr(void)
 {
   consoleintr(uartgetc);
+  if(!uart || tx.sync)
+    return;
+  acquire(&tx.lock);
+  uartstart(1);
+  release(&tx.lock);
 }
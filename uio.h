@@ -0,0 +1,7 @@
+// Scatter/gather I/O for readv and writev.
+struct iovec {
+  void *iov_base;
+  int iov_len;
+};
+
+#define UIO_MAXIOV 16  // most iovecs per readv or writev
@@ -0,0 +1,200 @@
+// The mutexes and condition variables of kthread.h, in user space.
+//
+// A mutex is a word: 0 if free, 1 if held, 2 if held and perhaps
+// waited for.  Taking a free mutex, or letting go of one no one
+// waits for, is one atomic instruction; only otherwise does a
+// thread enter the kernel, with futex().  A condition variable is
+// a count of signals, which a waiter sleeps on until it changes.
+
+#include "types.h"
+#include "user.h"
+#include "kthread.h"
+#include "futex.h"
+
+struct mutex {
+  volatile int used;
+  volatile int val;
+};
+
+struct cond {
+  volatile int used;
+  volatile int seq;            // signals so far
+  volatile int waiters;        // threads in kthread_cond_wait
+};
+
+static struct mutex mutex[MAX_MUTEXES];
+static struct cond cond[MAX_CONDS];
+
+static inline int
+xchg(volatile int *addr, int newval)
+{
+  int result;
+
+  asm volatile("lock; xchgl %0, %1" :
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+}
+
+static inline int
+cmpxchg(volatile int *addr, int old, int newval)
+{
+  int prev;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (prev), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "cc", "memory");
+  return prev;
+}
+
+static inline void
+atomicadd(volatile int *addr, int n)
+{
+  asm volatile("lock; addl %1, %0" : "+m" (*addr) : "r" (n) : "cc", "memory");
+}
+
+static volatile int*
+getmutex(int id)
+{
+  if(id < 0 || id >= MAX_MUTEXES || !mutex[id].used)
+    return 0;
+  return &mutex[id].val;
+}
+
+static struct cond*
+getcond(int id)
+{
+  if(id < 0 || id >= MAX_CONDS || !cond[id].used)
+    return 0;
+  return &cond[id];
+}
+
+// Take mutex word m, which was c when last looked at, marking it
+// waited for whenever it has to sleep.
+static void
+lockword(volatile int *m, int c)
+{
+  if(c != 2)
+    c = xchg(m, 2);
+  while(c != 0){
+    futex((int*)m, FUTEX_WAIT, 2);
+    c = xchg(m, 2);
+  }
+}
+
+int
+kthread_mutex_alloc()
+{
+  int i;
+
+  for(i = 0; i < MAX_MUTEXES; i++){
+    if(xchg(&mutex[i].used, 1) == 0){
+      mutex[i].val = 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Free mutex_id, which must not be held.
+int
+kthread_mutex_dealloc(int mutex_id)
+{
+  volatile int *m;
+
+  if((m = getmutex(mutex_id)) == 0 || *m != 0)
+    return -1;
+  xchg(&mutex[mutex_id].used, 0);
+  return 0;
+}
+
+int
+kthread_mutex_lock(int mutex_id)
+{
+  volatile int *m;
+  int c;
+
+  if((m = getmutex(mutex_id)) == 0)
+    return -1;
+  if((c = cmpxchg(m, 0, 1)) != 0)
+    lockword(m, c);
+  return 0;
+}
+
+// Release mutex_id, which must be held.
+int
+kthread_mutex_unlock(int mutex_id)
+{
+  volatile int *m;
+  int c;
+
+  if((m = getmutex(mutex_id)) == 0 || (c = xchg(m, 0)) == 0)
+    return -1;
+  if(c == 2)
+    futex((int*)m, FUTEX_WAKE, 1);
+  return 0;
+}
+
+int
+kthread_cond_alloc()
+{
+  int i;
+
+  for(i = 0; i < MAX_CONDS; i++){
+    if(xchg(&cond[i].used, 1) == 0){
+      cond[i].seq = 0;
+      cond[i].waiters = 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+int
+kthread_cond_dealloc(int cond_id)
+{
+  if(getcond(cond_id) == 0)
+    return -1;
+  xchg(&cond[cond_id].used, 0);
+  return 0;
+}
+
+// Release mutex_id, which must be held, wait for cond_id to be
+// signalled, and take the mutex again.  A signal between the
+// release and the sleep changes seq, so the sleep does not happen.
+int
+kthread_cond_wait(int cond_id, int mutex_id)
+{
+  struct cond *c;
+  volatile int *m;
+  int seq;
+
+  if((c = getcond(cond_id)) == 0 || (m = getmutex(mutex_id)) == 0)
+    return -1;
+  seq = c->seq;
+  atomicadd(&c->waiters, 1);
+  if(kthread_mutex_unlock(mutex_id) < 0){
+    atomicadd(&c->waiters, -1);
+    return -1;
+  }
+  futex((int*)&c->seq, FUTEX_WAIT, seq);
+  atomicadd(&c->waiters, -1);
+  lockword(m, 1);
+  return 0;
+}
+
+// Wake one thread waiting on cond_id, if there is one.
+int
+kthread_cond_signal(int cond_id)
+{
+  struct cond *c;
+
+  if((c = getcond(cond_id)) == 0)
+    return -1;
+  atomicadd(&c->seq, 1);
+  if(c->waiters > 0)
+    futex((int*)&c->seq, FUTEX_WAKE, 1);
+  return 0;
+}
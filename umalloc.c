@@ -2,9 +2,25 @@
 #include "stat.h"
 #include "user.h"
 #include "param.h"
+#include "x86.h"
 
 // Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// The C programming Language, 2nd ed.  Section 8.7,
+// with size classes in front of it for small blocks.
+//
+// A request of up to 1024 bytes, counting the header, is rounded
+// up to a power of two, and each such size class has its own free
+// list: malloc and free are a push or pop.  A class with nothing
+// free cuts a new block off the current chunk, a CHUNK-byte block
+// from the first-fit allocator.  Small blocks are never merged or
+// returned to the first-fit allocator, which only sees the chunks
+// and larger requests.
+//
+// Threads share the heap, so malloc and free hold a spin lock.  A
+// user-level thread holding it must not be switched out for
+// another on its worker, which would spin on it, so the uthread
+// runtime, once started, sets mallocpin and mallocunpin to keep
+// the holder running.
 
 typedef long Align;
 
@@ -18,15 +34,54 @@ union header {
 
 typedef union header Header;
 
+#define NCLASS 7       // size classes of 2, 4, ..., 128 units
+#define CHUNK  16384   // bytes cut up for small blocks at a time
+
 static Header base;
 static Header *freep;
+static Header *classfree[NCLASS];
+static char *bump, *bumpend;  // rest of the current chunk
+static volatile uint mlock;
+int (*mallocpin)(void);
+void (*mallocunpin)(int);
 
-void
-free(void *ap)
+// Returns what to hand unlock: -1 if there was no pin.
+static int
+lock(void)
 {
-  Header *bp, *p;
+  int pin;
+
+  pin = mallocpin ? mallocpin() : -1;
+  while(xchg(&mlock, 1) != 0)
+    ;
+  return pin;
+}
+
+static void
+unlock(int pin)
+{
+  xchg(&mlock, 0);
+  if(pin >= 0)
+    mallocunpin(pin);
+}
+
+// Size class for a block of nu units, or -1 if it is too large.
+static int
+sizeclass(uint nu)
+{
+  int c;
+
+  for(c = 0; c < NCLASS; c++)
+    if(nu <= (2 << c))
+      return c;
+  return -1;
+}
+
+static void
+bigfree(Header *bp)
+{
+  Header *p;
 
-  bp = (Header*)ap - 1;
   for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
     if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
       break;
@@ -43,6 +98,24 @@ free(void *ap)
   freep = p;
 }
 
+void
+free(void *ap)
+{
+  Header *bp;
+  int c, pin;
+
+  if(ap == 0)
+    return;
+  bp = (Header*)ap - 1;
+  pin = lock();
+  if((c = sizeclass(bp->s.size)) >= 0){
+    bp->s.ptr = classfree[c];
+    classfree[c] = bp;
+  } else
+    bigfree(bp);
+  unlock(pin);
+}
+
 static Header*
 morecore(uint nu)
 {
@@ -56,17 +129,16 @@ morecore(uint nu)
     return 0;
   hp = (Header*)p;
   hp->s.size = nu;
-  free((void*)(hp + 1));
+  bigfree(hp);
   return freep;
 }
 
-void*
-malloc(uint nbytes)
+// First fit: return a block of nunits units, header included.
+static Header*
+bigalloc(uint nunits)
 {
   Header *p, *prevp;
-  uint nunits;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;
@@ -81,10 +153,53 @@ malloc(uint nbytes)
         p->s.size = nunits;
       }
       freep = prevp;
-      return (void*)(p + 1);
+      return p;
     }
     if(p == freep)
       if((p = morecore(nunits)) == 0)
         return 0;
   }
 }
+
+static void*
+alloc(uint nbytes)
+{
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  if((c = sizeclass(nunits)) < 0){
+    if((p = bigalloc(nunits)) == 0)
+      return 0;
+    return (void*)(p + 1);
+  }
+
+  if((p = classfree[c]) != 0){
+    classfree[c] = p->s.ptr;
+    return (void*)(p + 1);
+  }
+  nunits = 2 << c;
+  if(bump + nunits*sizeof(Header) > bumpend){
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+      return 0;
+    bump = (char*)p;
+    bumpend = (char*)(p + p->s.size);
+  }
+  p = (Header*)bump;
+  bump += nunits*sizeof(Header);
+  p->s.size = nunits;
+  return (void*)(p + 1);
+}
+
+void*
+malloc(uint nbytes)
+{
+  void *p;
+  int pin;
+
+  pin = lock();
+  p = alloc(nbytes);
+  unlock(pin);
+  return p;
+}
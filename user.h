@@ -1,4 +1,9 @@
 struct stat;
+struct iovec;
+struct ioring;
+struct rusage;
+struct dent;
+struct pollfd;
 
 // system calls
 int fork(void);
@@ -27,6 +32,32 @@ int readlink(const char*, char*, int);
 int fprot(const char *pathname, const char *password);
 int funprot(const char *pathname, const char *password);
 int funlock(const char *pathname, const char *password);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int sendfile(int, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int pread(int, void*, int, int);
+int pwrite(int, void*, int, int);
+int lseek(int, int, int);
+int spawn(char*, char**, int*, int);
+int setpriority(int, int);
+int futex(int*, int, int);
+int signal(int, void (*)(void));
+int alarm(int);
+int usleep(int);
+int ioring_setup(struct ioring*);
+int ioring_enter(int, int);
+int getrusage(int, struct rusage*);
+int mount(char*);
+int getdents(int, struct dent*, int);
+int yield(void);
+int ncpu(void);
+int fallocate(int, int, int);
+int ftruncate(int, int);
+int fsync(int);
+int fdatasync(int);
+int poll(struct pollfd*, int, int);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -40,4 +71,6 @@ uint strlen(char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
+extern int (*mallocpin)(void);
+extern void (*mallocunpin)(int);
 int atoi(const char*);
@@ -0,0 +1,380 @@
+// User-level threads for uthread.h, preemptive and M:N.
+//
+// Threads run on a pool of NWORKER kernel threads, the workers,
+// and take turns through one FIFO run queue under a spin lock.
+// uswtch() moves a worker from one thread to another by saving and
+// loading only the callee-save registers; SIGALRM, raised every
+// THREAD_QUANTA ticks a worker runs, makes the thread it is
+// running yield.  A worker with nothing to run switches to an idle
+// thread of its own, which waits on the queue with futex().
+//
+// Each stack is STACK_SIZE bytes on a STACK_SIZE boundary, with a
+// pointer to its thread in the lowest word, so the running thread
+// is found from %esp.  Thread 0 keeps the stack exec gave it,
+// which is a page on a page boundary.
+
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+#include "signal.h"
+#include "kthread.h"
+#include "futex.h"
+#include "uthread.h"
+
+#define NWORKER 2              // kernel threads, the main one included
+
+struct task {
+  struct uthread u;            // first, for uswtch
+  struct worker *w;            // worker running it
+  struct task *next;           // next in the run queue
+  char *mem;                   // malloc'd block holding the stack
+  int busy;                    // switching threads: do not preempt
+  int join;                    // T_SLEEPING: tid being joined
+  void (*func)(void*);
+  void *arg;
+};
+
+struct worker {
+  struct task idle;            // runs when no thread can
+};
+
+void uswtch(struct uthread*, struct uthread*);
+void ualarm(void);
+
+static struct {
+  volatile uint lock;
+  struct task *head;
+  struct task *tail;
+  volatile int n;              // threads queued; idle workers wait on it
+  int nidle;                   // idle workers waiting
+  int nlive;                   // threads that have not exited
+  int nexttid;                 // last tid given out
+} rq;
+
+static struct task task[MAX_THREAD];
+static struct worker worker[NWORKER];
+
+static struct task*
+current(void)
+{
+  uint sp;
+
+  asm volatile("movl %%esp, %0" : "=r" (sp));
+  return *(struct task**)(sp & ~(STACK_SIZE-1));
+}
+
+static void
+lock(void)
+{
+  while(xchg(&rq.lock, 1) != 0)
+    ;
+}
+
+// Release the run queue, waking an idle worker if it holds work.
+static void
+unlock(void)
+{
+  int wake;
+
+  wake = rq.nidle > 0 && rq.head != 0;
+  xchg(&rq.lock, 0);
+  if(wake)
+    futex((int*)&rq.n, FUTEX_WAKE, 1);
+}
+
+static void
+enqueue(struct task *t)
+{
+  t->u.state = T_RUNNABLE;
+  t->next = 0;
+  if(rq.head)
+    rq.tail->next = t;
+  else
+    rq.head = t;
+  rq.tail = t;
+  rq.n++;
+}
+
+static struct task*
+dequeue(void)
+{
+  struct task *t;
+
+  if((t = rq.head) != 0){
+    rq.head = t->next;
+    rq.n--;
+  }
+  return t;
+}
+
+// Give t a stack, if it has none, and point the stack at t.
+static int
+allocstack(struct task *t)
+{
+  if(t->mem == 0 && (t->mem = malloc(2*STACK_SIZE)) == 0)
+    return -1;
+  t->u.stack = (char*)(((uint)t->mem + STACK_SIZE-1) & ~(STACK_SIZE-1));
+  *(struct task**)t->u.stack = t;
+  return 0;
+}
+
+// Set t up to start at start when uswtch() first loads it.
+static int
+setstart(struct task *t, void (*start)(void))
+{
+  uint *sp;
+
+  if(allocstack(t) < 0)
+    return -1;
+  sp = (uint*)(t->u.stack + STACK_SIZE);
+  *--sp = 0xffffffff;          // fake return PC for start
+  *--sp = (uint)start;
+  *--sp = 0;                   // %ebx
+  *--sp = 0;                   // %esi
+  *--sp = 0;                   // %edi
+  t->u.esp = (int)sp;
+  t->u.ebp = 0;
+  return 0;
+}
+
+// Finish a switch to the current thread.
+static void
+resumed(void)
+{
+  struct task *t;
+
+  t = current();
+  unlock();
+  if(t != &t->w->idle)
+    t->busy = 0;
+}
+
+// Switch from cur, whose state says what becomes of it, to the
+// first queued thread, or to the worker's idle thread if there is
+// none.  The caller has locked the run queue and set cur->busy;
+// both are undone by the time cur runs again.
+static void
+sched(struct task *cur)
+{
+  struct task *t;
+
+  if((t = dequeue()) == 0)
+    t = &cur->w->idle;
+  t->u.state = T_RUNNING;
+  if(t != cur){
+    t->w = cur->w;
+    uswtch(&cur->u, &t->u);
+  }
+  resumed();
+}
+
+// A worker's idle thread: wait for a thread to be queued, run it.
+static void
+idle(void)
+{
+  struct task *self;
+
+  self = current();
+  for(;;){
+    lock();
+    while(rq.head == 0){
+      rq.nidle++;
+      xchg(&rq.lock, 0);
+      futex((int*)&rq.n, FUTEX_WAIT, 0);
+      lock();
+      rq.nidle--;
+    }
+    sched(self);
+  }
+}
+
+static void
+idlestart(void)
+{
+  resumed();
+  idle();
+}
+
+static void*
+workerstart(void)
+{
+  alarm(THREAD_QUANTA);
+  idle();
+  return 0;
+}
+
+// malloc's hooks, for its lock: keep the current thread from
+// being preempted meanwhile.  Returns what to hand unpin; pins
+// nest.
+static int
+pin(void)
+{
+  struct task *t;
+  int busy;
+
+  t = current();
+  busy = t->busy;
+  t->busy = 1;
+  return busy;
+}
+
+static void
+unpin(int busy)
+{
+  current()->busy = busy;
+}
+
+static void
+threadstart(void)
+{
+  struct task *t;
+
+  resumed();
+  t = current();
+  t->func(t->arg);
+  uthread_exit();
+}
+
+// Make the calling thread, which must be the process's main one,
+// thread 0, and start the workers.  Call before anything else here.
+void
+uthread_init(void)
+{
+  struct task *t;
+  struct worker *w;
+  uint sp;
+
+  t = &task[0];
+  asm volatile("movl %%esp, %0" : "=r" (sp));
+  t->u.stack = (char*)(sp & ~(STACK_SIZE-1));
+  *(struct task**)t->u.stack = t;
+  t->u.tid = 0;
+  t->u.state = T_RUNNING;
+  t->w = &worker[0];
+  rq.nlive = 1;
+  mallocpin = pin;
+  mallocunpin = unpin;
+
+  for(w = worker; w < &worker[NWORKER]; w++){
+    w->idle.w = w;
+    w->idle.busy = 1;
+    if(w == worker){
+      if(setstart(&w->idle, idlestart) < 0)
+        goto bad;
+    } else if(allocstack(&w->idle) < 0 ||
+              kthread_create(workerstart, w->idle.u.stack, STACK_SIZE) < 0)
+      goto bad;
+  }
+  signal(SIGALRM, ualarm);
+  alarm(THREAD_QUANTA);
+  return;
+
+ bad:
+  printf(2, "uthread_init: cannot start workers\n");
+  exit();
+}
+
+// Called by ualarm for SIGALRM: preempt the running thread unless
+// it is in the middle of a switch.
+void
+uthread_alarm(void)
+{
+  struct task *t;
+
+  t = current();
+  if(t->busy)
+    return;
+  uthread_yield();
+}
+
+int
+uthread_create(void (*func)(void *), void* value)
+{
+  struct task *cur, *t;
+  int tid;
+
+  cur = current();
+  cur->busy = 1;
+  lock();
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    if(t->u.state == T_FREE && t != cur)
+      break;
+  if(t == &task[MAX_THREAD] || setstart(t, threadstart) < 0){
+    unlock();
+    cur->busy = 0;
+    return -1;
+  }
+  t->u.tid = tid = ++rq.nexttid;
+  t->func = func;
+  t->arg = value;
+  t->busy = 1;
+  rq.nlive++;
+  enqueue(t);
+  unlock();
+  cur->busy = 0;
+  return tid;
+}
+
+// End the current thread.  The last one to end ends the process.
+// Its stack stays in use until the switch away is over, which is
+// before anyone else can take the run queue lock and reuse it.
+void
+uthread_exit(void)
+{
+  struct task *cur, *t;
+
+  cur = current();
+  cur->busy = 1;
+  lock();
+  cur->u.state = T_FREE;
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    if(t->u.state == T_SLEEPING && t->join == cur->u.tid)
+      enqueue(t);
+  if(--rq.nlive == 0)
+    exit();
+  sched(cur);
+}
+
+void
+uthread_yield(void)
+{
+  struct task *cur;
+
+  cur = current();
+  cur->busy = 1;
+  lock();
+  enqueue(cur);
+  sched(cur);
+}
+
+int
+uthred_self(void)
+{
+  return current()->u.tid;
+}
+
+// Wait for thread tid to exit.  Return 0, at once if it already
+// has, or -1 if there is no such thread.
+int
+uthred_join(int tid)
+{
+  struct task *cur, *t;
+
+  cur = current();
+  if(tid < 0 || tid > rq.nexttid || tid == cur->u.tid)
+    return -1;
+  cur->busy = 1;
+  lock();
+  for(t = task; t < &task[MAX_THREAD]; t++)
+    if(t->u.state != T_FREE && t->u.tid == tid)
+      break;
+  if(t == &task[MAX_THREAD]){
+    unlock();
+    cur->busy = 0;
+    return 0;
+  }
+  cur->u.state = T_SLEEPING;
+  cur->join = tid;
+  sched(cur);
+  return 0;
+}
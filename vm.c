@@ -6,17 +6,32 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "stat.h"
+#include "fs.h"
+#include "file.h"
+#include "fcntl.h"
+#include "spinlock.h"
+#include "traps.h"
+#include "kstat.h"
 
 extern char data[];  // defined by kernel.ld
+extern void sysentry(void);  // in trapasm.S
 pde_t *kpgdir;  // for use in scheduler()
 struct segdesc gdt[NSEGS];
 
+struct {                // see uflush
+  struct spinlock lock;
+  int busy;
+  int acks;
+} tlb;
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
 seginit(void)
 {
   struct cpu *c;
+  uint edx;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
@@ -33,6 +48,15 @@ seginit(void)
 
   lgdt(c->gdt, sizeof(c->gdt));
   loadgs(SEG_KCPU << 3);
+
+  // sysenter goes to sysentry with %esp pointing at ts.esp0,
+  // which switchuvm keeps at the top of the process's kernel stack.
+  cpuid(1, 0, 0, 0, &edx);
+  if(edx & CPUID_SEP){
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+    wrmsr(MSR_SYSENTER_ESP, (uint)&c->ts.esp0);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+  }
   
   // Initialize cpu-local storage.
   cpu = c;
@@ -52,10 +76,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)p2v(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table 
     // entries, if necessary.
@@ -67,7 +90,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -111,7 +134,12 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // (directly addressable from end..P2V(PHYSTOP)).
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  kvmalloc() builds them once, in
+// kpgdir, using 4MB pages wherever a mapping covers a whole
+// aligned 4MB and 4KB pages in page tables elsewhere, all marked
+// global so that they survive the %cr3 load of every switch;
+// setupkvm() just copies kpgdir's kernel page directory entries,
+// so every page table shares the kernel's page tables.
 static struct kmap {
   void *virt;
   uint phys_start;
@@ -124,31 +152,59 @@ static struct kmap {
   { (void*) DEVSPACE, DEVSPACE,      0,         PTE_W},  // more devices
 };
 
+// Map size bytes at va to pa in pgdir for the kernel, with 4MB
+// pages where alignment allows.
+static int
+kmapregion(pde_t *pgdir, uint va, uint pa, uint size, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    if(va % BIGPGSIZE == 0 && pa % BIGPGSIZE == 0 && size >= BIGPGSIZE){
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS | PTE_G;
+      n = BIGPGSIZE;
+    } else {
+      if(mappages(pgdir, (void*)va, PGSIZE, pa, perm | PTE_G) < 0)
+        return -1;
+      n = PGSIZE;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
 // Set up kernel part of a page table.
 pde_t*
 setupkvm()
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (p2v(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start, 
-                (uint)k->phys_start, k->perm) < 0)
-      return 0;
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, and build the kernel mappings
+// that every page table shares.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if (p2v(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  if((kpgdir = (pde_t*)kalloc_zeroed()) == 0)
+    panic("kvmalloc");
+  initlock(&tlb.lock, "tlb");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(kmapregion(kpgdir, (uint)k->virt, k->phys_start,
+                  k->phys_end - k->phys_start, k->perm) < 0)
+      panic("kvmalloc");
   switchkvm();
 }
 
@@ -185,36 +241,11 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, v2p(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, p2v(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -230,13 +261,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     mappages(pgdir, (char*)a, PGSIZE, v2p(mem), PTE_W|PTE_U);
   }
   return newsz;
@@ -259,7 +289,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // skip to next page table
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
@@ -267,13 +297,17 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = p2v(pa);
       kfree(v);
       *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTE_SLOT(*pte));
+      *pte = 0;
     }
   }
   return newsz;
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part's page tables are
+// shared and stay.
 void
 freevm(pde_t *pgdir)
 {
@@ -282,7 +316,7 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = p2v(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -304,37 +338,544 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Map the page that *pte maps at va into page table d as well,
+// copy-on-write for both if it is writable.  A pinned page must
+// stay where it is, so d gets a copy of it instead.
+static int
+cowshare(pde_t *d, pte_t *pte, uint va)
+{
+  uint pa, flags;
+  char *mem;
+
+  pa = PTE_ADDR(*pte);
+  flags = PTE_FLAGS(*pte);
+  if(flags & PTE_PIN){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, p2v(pa), PGSIZE);
+    if(mappages(d, (void*)va, PGSIZE, v2p(mem), flags & (PTE_U|PTE_W)) < 0){
+      kfree(mem);
+      return -1;
+    }
+    return 0;
+  }
+  if(flags & PTE_W){
+    flags = (flags & ~PTE_W) | PTE_COW;
+    *pte = pa | flags;
+  }
+  if(mappages(d, (void*)va, PGSIZE, pa, flags & (PTE_U|PTE_COW)) < 0)
+    return -1;
+  kdup(p2v(pa));
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  The two share the pages until one
+// writes to them; see cowfault.  Heap pages that were
+// never touched stay absent in both, and paged-out ones
+// name the same swap slot, for each to read back.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i;
-  char *mem;
+  pte_t *pte, *dpte;
+  uint i;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;  // skip to next page table
+      continue;
+    }
+    if(*pte & PTE_SWAP){
+      if((dpte = walkpgdir(d, (void*)i, 1)) == 0)
+        goto bad;
+      swapdup(PTE_SLOT(*pte));
+      *dpte = *pte;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)p2v(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, v2p(mem), PTE_W|PTE_U) < 0)
+      continue;
+    if(cowshare(d, pte, i) < 0)
       goto bad;
   }
+  // The parent's pages may have become read-only.
+  if(pgdir == proc->pgdir)
+    uflush();
   return d;
 
 bad:
+  if(pgdir == proc->pgdir)
+    uflush();
   freevm(d);
   return 0;
 }
 
+// Read the parts of the program that lie in page va of the
+// current process into mem, which is zero.  Caller holds
+// proc->exe locked.
+static int
+execfill(uint va, char *mem)
+{
+  struct execseg *s;
+  uint start, end;
+
+  for(s = proc->group->seg; s < proc->group->seg + proc->group->nseg; s++){
+    start = va > s->va ? va : s->va;
+    end = va + PGSIZE < s->va + s->filesz ? va + PGSIZE : s->va + s->filesz;
+    if(start < end && readi(proc->group->exe, mem + (start - va), s->off + (start - s->va), end - start) != end - start)
+      return -1;
+  }
+  return 0;
+}
+
+// Shared program pages.
+//
+// A page of a program's segments holds the same bytes in every
+// process running the program, so the first process to touch it
+// builds it once and keeps it in the executable's inode, in
+// ip->xpages, indexed by page number; every process maps that
+// page copy-on-write.  The inode holds one reference to each page
+// and each mapping another.  xdrop() lets go of the inode's pages
+// when the file changes or leaves the inode cache; mappings keep
+// the pages they have.
+
+#define NXPAGE (PGSIZE / sizeof(char*))
+
+// Is page va in one of the current process's segments?
+static int
+inseg(uint va)
+{
+  struct execseg *s;
+
+  for(s = proc->group->seg; s < proc->group->seg + proc->group->nseg; s++)
+    if(va + PGSIZE > s->va && va < s->va + s->memsz)
+      return 1;
+  return 0;
+}
+
+// Return the shared copy of page va of the current process's
+// program, with a reference for the caller, or 0.  Caller holds
+// proc->exe locked.
+static char*
+xpage(uint va)
+{
+  struct inode *ip;
+  char *mem;
+
+  ip = proc->group->exe;
+  if(va / PGSIZE >= NXPAGE)
+    return 0;
+  if(ip->xpages == 0 && (ip->xpages = (char**)kalloc_zeroed()) == 0)
+    return 0;
+  if((mem = ip->xpages[va / PGSIZE]) == 0){
+    if((mem = kalloc_zeroed()) == 0)
+      return 0;
+    if(execfill(va, mem) < 0){
+      kfree(mem);
+      return 0;
+    }
+    ip->xpages[va / PGSIZE] = mem;
+  }
+  kdup(mem);
+  return mem;
+}
+
+// Let go of ip's shared program pages.  Caller holds ip locked,
+// or it has no references.
+void
+xdrop(struct inode *ip)
+{
+  int i;
+
+  if(ip->xpages == 0)
+    return;
+  for(i = 0; i < NXPAGE; i++)
+    if(ip->xpages[i])
+      kfree(ip->xpages[i]);
+  kfree((char*)ip->xpages);
+  ip->xpages = 0;
+}
+
+// Read page va of the current process, which swapout paged
+// out, back from swap.  Caller holds lockgroup.
+static int
+swapin(uint va)
+{
+  pte_t *pte;
+  char *mem;
+  uint e;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  // Only the process changes an entry that is not present, so
+  // the one kalloc may have slept past is the same.
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  e = *pte;
+  swapio(PTE_SLOT(e), mem, 0);
+  *pte = v2p(mem) | (e & (PTE_U|PTE_W|PTE_COW)) | PTE_P;
+  swapfree(PTE_SLOT(e));
+  return 0;
+}
+
+// Handle a fault at va in the current process.  If va is below
+// proc->sz but was never touched, map a page there, filled from
+// the program if va is in one of its segments and zero otherwise,
+// and return 0; if it was paged out, read it back; else return
+// -1.  May sleep reading the program or swap.
+int
+lazyfault(uint va)
+{
+  pte_t *pte;
+  char *mem;
+  int r;
+
+  if(va >= proc->group->sz)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(proc->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if(pte && (*pte & PTE_SWAP))
+    return swapin(va);
+  if(proc->group->exe && inseg(va)){
+    ilock(proc->group->exe);
+    if(proc->group->xshare && (mem = xpage(va)) != 0){
+      iunlock(proc->group->exe);
+      if(mappages(proc->pgdir, (char*)va, PGSIZE, v2p(mem), PTE_U|PTE_COW) < 0){
+        kfree(mem);
+        return -1;
+      }
+      return 0;
+    }
+    r = -1;
+    if((mem = kalloc_zeroed()) != 0 && (r = execfill(va, mem)) < 0)
+      kfree(mem);
+    iunlock(proc->group->exe);
+    if(r < 0)
+      return -1;
+  } else if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(mappages(proc->pgdir, (char*)va, PGSIZE, v2p(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Make user page a of the current process, which is present,
+// writable by the kernel: copy it now if it is copy-on-write.
+static int
+writetouch(uint a)
+{
+  pte_t *pte;
+
+  pte = walkpgdir(proc->pgdir, (char*)a, 0);
+  if(*pte & PTE_W)
+    return 0;
+  return cowfault(a);
+}
+
+// Make sure the heap pages in the n bytes at va, which must be
+// below proc->sz, are present, and writable if write, so the
+// kernel can use them without faulting.
+int
+lazytouch(uint va, uint n, int write)
+{
+  uint a;
+  pte_t *pte;
+
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    if(((pte = walkpgdir(proc->pgdir, (char*)a, 0)) == 0 || !(*pte & PTE_P)) &&
+       lazyfault(a) < 0)
+      return -1;
+    if(write && writetouch(a) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Handle a write fault at va in the current process.  If the page
+// there is copy-on-write, give the process a copy of its own, or
+// just make it writable if no one else shares it any more, and
+// return 0; else return -1.
+int
+cowfault(uint va)
+{
+  pte_t *pte;
+  char *mem, *old;
+  uint flags;
+
+  va = PGROUNDDOWN(va);
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_COW)) != (PTE_P|PTE_COW))
+    return -1;
+  old = p2v(PTE_ADDR(*pte));
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefs(old) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = v2p(mem) | flags;
+    kfree(old);
+  } else
+    *pte = PTE_ADDR(*pte) | flags;
+  uflush();
+  return 0;
+}
+
+// Handle a page fault at va in the current process, for a write
+// if write != 0.  Return 0 if the access can be retried.
+int
+pagefault(uint va, int write)
+{
+  pte_t *pte;
+  int r;
+
+  lockgroup();
+  // Another thread may have dealt with the page while we waited,
+  // and the fault come from a translation since flushed.
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte && (*pte & (PTE_P|PTE_U)) == (PTE_P|PTE_U) && (!write || (*pte & PTE_W)))
+    r = 0;
+  else if(lazyfault(va) == 0 || (write && cowfault(va) == 0) || mmapfault(va, write) == 0)
+    r = 0;
+  else
+    r = -1;
+  unlockgroup();
+  if(r == 0)
+    proc->ru.nfault++;
+  return r;
+}
+
+//PAGEBREAK!
+// Paging out.  When kalloc is out of pages and the caches have
+// none to give back, swapout writes a page of process memory to
+// swap and frees it.  A clock goes round the processes swaplock
+// allows, over their pages below sz: a page used since the hand
+// last passed (PTE_A) is spared once more, and the first one that
+// was not goes, if it is the only mapping of its page and not
+// pinned.  The swap entry that replaces it keeps its permissions,
+// for lazyfault to read it back with.
+//
+// The process may run while the page is written.  So its dirty
+// bit is cleared before, with the process off every CPU and its
+// translations gone from their TLBs, and the page is only taken
+// if the entry is unchanged after: neither read nor written.
+
+#define SWAPSCAN  (2 * PHYSTOP/PGSIZE)  // most entries swapout looks at
+#define SWAPBATCH 64                    // entries looked at per swaplock
+
+static struct {
+  int pid;
+  uint va;
+} hand;  // changed under swaplock
+
+// Page out one page.  Return 1 if a page was freed, 0 if none
+// could be.  Sleeps writing it.
+int
+swapout(void)
+{
+  struct proc *p;
+  pde_t *pgdir;
+  pte_t *pte;
+  char *mem;
+  uint va, e;
+  int pid, n, i, s, ok;
+
+  if(!swapready())
+    return 0;
+  for(n = 0; n < SWAPSCAN; n += i){
+    if((p = swaplock(hand.pid, 0)) == 0 || hand.va >= p->sz){
+      if(p)
+        swapunlock();
+      if((p = swaplock(hand.pid, 1)) == 0)
+        return 0;
+      hand.pid = p->pid;
+      hand.va = 0;
+    }
+    mem = 0;
+    for(i = 0; i < SWAPBATCH && hand.va < p->sz && mem == 0; i++, hand.va += PGSIZE){
+      if((pte = walkpgdir(p->pgdir, (char*)hand.va, 0)) == 0){
+        hand.va = PGADDR(PDX(hand.va) + 1, 0, 0) - PGSIZE;  // skip to next page table
+        continue;
+      }
+      e = *pte;
+      if((e & (PTE_P|PTE_U|PTE_PIN)) != (PTE_P|PTE_U) || krefs(p2v(PTE_ADDR(e))) != 1)
+        continue;
+      if(e & PTE_A){
+        *pte = e & ~PTE_A;
+        continue;
+      }
+      e &= ~PTE_D;
+      *pte = e;
+      mem = p2v(PTE_ADDR(e));
+      kdup(mem);
+      pid = p->pid;
+      pgdir = p->pgdir;
+      va = hand.va;
+    }
+    swapunlock();
+    kstatadd(KS_SWAPSCAN, i);
+    if(mem == 0)
+      continue;
+
+    if((s = swapalloc()) < 0){
+      kfree(mem);
+      return 0;
+    }
+    swapio(s, mem, 1);
+    ok = 0;
+    if((p = swaplock(pid, 0)) != 0){
+      if(p->pgdir == pgdir && (pte = walkpgdir(pgdir, (char*)va, 0)) != 0 &&
+         *pte == e && krefs(mem) == 2){
+        *pte = s << PTXSHIFT | PTE_SWAP | (e & (PTE_U|PTE_W|PTE_COW));
+        ok = 1;
+      }
+      swapunlock();
+    }
+    if(ok)
+      kfree(mem);  // the mapping's reference
+    else
+      swapfree(s);
+    kfree(mem);
+    if(ok)
+      return 1;
+  }
+  return 0;
+}
+
+// Return the kernel address of the word at user address va of the
+// current process, which names that word for every process that
+// maps the same memory, or 0 if va is not mapped.  A copy-on-write
+// page is copied first, since the next write there would move it.
+char*
+ukey(uint va)
+{
+  pte_t *pte;
+  char *k;
+
+  if(checkptr(va, 4, 0) < 0)
+    return 0;
+  lockgroup();
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_COW))
+    cowfault(va);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || (*pte & PTE_COW))
+    k = 0;
+  else
+    k = (char*)p2v(PTE_ADDR(*pte)) + (va & (PGSIZE-1));
+  unlockgroup();
+  return k;
+}
+
+// Fill pcs with the user call chain from frame pointer ebp in the
+// current process, for the profiler.  It runs in an interrupt and
+// cannot fault, so it reads frames through the kernel's mapping
+// and stops at one that is not mapped.
+void
+ucallerpcs(uint ebp, uint *pcs, int n)
+{
+  pte_t *pte;
+  uint *fp;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(ebp % 4 != 0 || ebp % PGSIZE > PGSIZE - 8 || ebp >= KERNBASE)
+      break;
+    pte = walkpgdir(proc->pgdir, (char*)ebp, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+      break;
+    fp = (uint*)((char*)p2v(PTE_ADDR(*pte)) + ebp % PGSIZE);
+    if(fp[1] == 0)
+      break;
+    pcs[i] = fp[1];
+    ebp = fp[0];
+  }
+  for(; i < n; i++)
+    pcs[i] = 0;
+}
+
+// Pin the heap page at user address va of the current process, for
+// the kernel to use from now on: a copy-on-write page is copied
+// first so that it stays put, and fork copies it rather than share
+// it.  Return its kernel address with a reference for the caller,
+// or 0 if va is not a writable heap page.
+char*
+upin(uint va)
+{
+  pte_t *pte;
+  char *k;
+
+  if(va % PGSIZE != 0 || va + PGSIZE > proc->group->sz || va + PGSIZE < va)
+    return 0;
+  if(checkptr(va, PGSIZE, 1) < 0)
+    return 0;
+  lockgroup();
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_COW))
+    cowfault(va);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_W)) != (PTE_P|PTE_U|PTE_W))
+    k = 0;
+  else {
+    *pte |= PTE_PIN;
+    k = p2v(PTE_ADDR(*pte));
+    kdup(k);
+  }
+  unlockgroup();
+  return k;
+}
+
+//PAGEBREAK!
+// TLB shootdown.  Threads of one process on several CPUs share a
+// page table, and each CPU's TLB may hold its translations.  After
+// taking a translation away or making it stricter, uflush has the
+// other CPUs reload %cr3, and waits until they have, before the
+// old page can be reused.  There is one shootdown at a time; the
+// CPUs acknowledge under tlb.lock, which the sender does not hold
+// while it waits.
+
+// Flush stale translations of the current process's page table:
+// on this CPU, and on the others if its other threads may have
+// them cached.
+void
+uflush(void)
+{
+  int n;
+
+  lcr3(v2p(proc->pgdir));
+  if(proc->group->nthreads == 1 || ncpu == 1)
+    return;
+  acquire(&tlb.lock);
+  while(tlb.busy)
+    sleep(&tlb, &tlb.lock);
+  tlb.busy = 1;
+  tlb.acks = 0;
+  release(&tlb.lock);
+
+  lapicipi(T_TLBFLUSH);
+  do {
+    acquire(&tlb.lock);
+    n = tlb.acks;
+    release(&tlb.lock);
+  } while(n < ncpu - 1);
+
+  acquire(&tlb.lock);
+  tlb.busy = 0;
+  wakeup(&tlb);
+  release(&tlb.lock);
+}
+
+// Handle a shootdown interrupt from another CPU.
+void
+tlbintr(void)
+{
+  lcr3(rcr3());
+  acquire(&tlb.lock);
+  tlb.acks++;
+  release(&tlb.lock);
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -343,13 +884,30 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
   return (char*)p2v(PTE_ADDR(*pte));
 }
 
+// Map user virtual address uva of the current process to a
+// kernel address as uva2ka does, first faulting the page in, and
+// making it writable for write.  Return 0 if it cannot be.
+char*
+uva2kafault(char *uva, int write)
+{
+  pte_t *pte;
+
+  pte = walkpgdir(proc->pgdir, uva, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || (write && !(*pte & PTE_W))){
+    if(pagefault((uint)uva, write) < 0)
+      return 0;
+    pte = walkpgdir(proc->pgdir, uva, 0);
+  }
+  return (char*)p2v(PTE_ADDR(*pte));
+}
+
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
@@ -375,3 +933,336 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   }
   return 0;
 }
+
+//PAGEBREAK!
+// Memory-mapped files.
+//
+// A process has up to NVMA mappings of file ranges, placed top-down
+// below KERNBASE so that they stay clear of the heap.  Nothing is
+// mapped until it is touched: mmapfault maps the page on its first
+// fault.  A MAP_SHARED mapping maps the page cache's own page, so
+// every process mapping the file, and read() and write(), see the
+// same data; a MAP_PRIVATE mapping gets a copy.  When a mapping
+// goes away (munmap, exit, exec), dirty pages of a MAP_SHARED
+// mapping are written back to the file, up to its current size.
+// If the page cache is out of pages, a shared mapping falls back
+// to a copy too, which is written back the same way.
+
+// Return the page cache page pg that page va of shared mapping v
+// maps at physical address pa, with a reference held, or 0 if the
+// page there is a private copy.
+static struct page*
+vmapage(struct vma *v, uint va, uint pa)
+{
+  struct page *pg;
+
+  if(v->flags != MAP_SHARED)
+    return 0;
+  pg = pclookup(v->f->ip, (v->off + (va - v->start)) / PGSIZE);
+  if(pg && v2p(pg->data) != pa){
+    pcput(pg);
+    pg = 0;
+  }
+  return pg;
+}
+
+static struct vma*
+vmalookup(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < p->vma + NVMA; v++)
+    if(v->start != 0 && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Does [start, end) overlap a mapping of p?
+int
+vmaoverlap(struct proc *p, uint start, uint end)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < p->vma + NVMA; v++)
+    if(v->start != 0 && start < v->end && v->start < end)
+      return 1;
+  return 0;
+}
+
+// Map n bytes of file f, from page-aligned offset off on, into
+// the current process.  Return the address, or -1.
+int
+mmap(struct file *f, uint off, uint n, int prot, int flags)
+{
+  struct vma *v;
+  uint va;
+  int i, type;
+
+  if(f->type != FD_INODE || n == 0 || n > KERNBASE || off % PGSIZE != 0)
+    return -1;
+  if(flags != MAP_SHARED && flags != MAP_PRIVATE)
+    return -1;
+  if(!f->readable || (flags == MAP_SHARED && (prot & PROT_WRITE) && !f->writable))
+    return -1;
+  ilock(f->ip);
+  type = f->ip->type;
+  iunlock(f->ip);
+  if(type != T_FILE)
+    return -1;
+
+  for(v = proc->group->vma; v < proc->group->vma + NVMA; v++)
+    if(v->start == 0)
+      break;
+  if(v == proc->group->vma + NVMA)
+    return -1;
+
+  // Take the highest free range.
+  n = PGROUNDUP(n);
+  va = KERNBASE - n;
+  for(i = 0; i < NVMA; i++){
+    if(proc->group->vma[i].start != 0 && va < proc->group->vma[i].end && proc->group->vma[i].start < va + n){
+      if(proc->group->vma[i].start < n)
+        return -1;
+      va = proc->group->vma[i].start - n;
+      i = -1;  // start over
+    }
+  }
+  if(va < PGROUNDUP(proc->group->sz))
+    return -1;
+
+  v->start = va;
+  v->end = va + n;
+  v->f = filedup(f);
+  v->off = off;
+  v->prot = prot;
+  v->flags = flags;
+  return va;
+}
+
+// Handle a page fault at va in the current process, for a write if
+// write != 0.  Read the page in and return 0 if va is in a mapping
+// that allows the access; else return -1.
+int
+mmapfault(uint va, int write)
+{
+  struct vma *v;
+  struct inode *ip;
+  struct page *pg;
+  pte_t *pte;
+  char *mem;
+  uint off;
+  int perm;
+
+  if((v = vmalookup(proc->group, va)) == 0 || (v->prot & (PROT_READ|PROT_WRITE)) == 0)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(proc->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;  // present, so not allowed
+  perm = PTE_U;
+  if(v->prot & PROT_WRITE)
+    perm |= PTE_W;
+
+  ip = v->f->ip;
+  off = v->off + (va - v->start);
+  ilock(ip);
+  pg = 0;
+  if(v->flags == MAP_SHARED && !(ip->flags & I_INLINE))
+    pg = ipage(ip, off / PGSIZE);
+  if(pg){
+    iunlock(ip);
+    // The mapping keeps the reference.
+    if(mappages(proc->pgdir, (char*)va, PGSIZE, v2p(pg->data), perm) < 0){
+      pcput(pg);
+      return -1;
+    }
+    return 0;
+  }
+  if((mem = kalloc_zeroed()) == 0){
+    iunlock(ip);
+    return -1;
+  }
+  // Past the end of the file, the page stays zero.
+  readi(ip, mem, off, PGSIZE);
+  iunlock(ip);
+  if(mappages(proc->pgdir, (char*)va, PGSIZE, v2p(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Make sure the n bytes at va, which must be in mappings of the
+// current process, are present, and writable if write, so the
+// kernel can use them.
+int
+mmaptouch(uint va, uint n, int write)
+{
+  uint a, end;
+  pte_t *pte;
+
+  end = n ? va + n : va + 1;
+  if(end < va)
+    return -1;
+  for(a = PGROUNDDOWN(va); a < end; a += PGSIZE){
+    if(vmalookup(proc->group, a) == 0)
+      return -1;
+    if(((pte = walkpgdir(proc->pgdir, (char*)a, 0)) == 0 || !(*pte & PTE_P)) &&
+       mmapfault(a, write) < 0)
+      return -1;
+    if(write && writetouch(a) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Write back the dirty page mem at va of mapping v.
+static void
+vmawriteback(struct vma *v, uint va, char *mem)
+{
+  uint off, size;
+
+  ilock(v->f->ip);
+  size = v->f->ip->size;
+  iunlock(v->f->ip);
+  off = v->off + (va - v->start);
+  if(off < size)
+    filewriteat(v->f, mem, size - off < PGSIZE ? size - off : PGSIZE, off);
+}
+
+// Unmap the pages of p's mapping v in [start, end), writing
+// back the dirty ones if the mapping is shared.
+static void
+vmaunmap(struct proc *p, struct vma *v, uint start, uint end)
+{
+  struct page *pg;
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  for(a = start; a < end; a += PGSIZE){
+    if((pte = walkpgdir(p->pgdir, (char*)a, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    mem = p2v(PTE_ADDR(*pte));
+    if((*pte & PTE_D) && v->flags == MAP_SHARED)
+      vmawriteback(v, a, mem);
+    if((pg = vmapage(v, a, PTE_ADDR(*pte))) != 0){
+      pcput(pg);  // vmapage's
+      pcput(pg);  // the mapping's
+    } else
+      kfree(mem);
+    *pte = 0;
+  }
+}
+
+// Remove the mappings of the current process in [va, va+n).
+int
+munmap(uint va, uint n)
+{
+  struct vma *v, *w;
+  uint end, s, e;
+
+  end = va + PGROUNDUP(n);
+  if(va % PGSIZE != 0 || n == 0 || end < va || end > KERNBASE)
+    return -1;
+  for(v = proc->group->vma; v < proc->group->vma + NVMA; v++){
+    if(v->start == 0 || v->end <= va || end <= v->start)
+      continue;
+    s = v->start > va ? v->start : va;
+    e = v->end < end ? v->end : end;
+    w = 0;
+    if(s > v->start && e < v->end){
+      // Punching a hole: the part above it needs a slot.
+      for(w = proc->group->vma; w < proc->group->vma + NVMA; w++)
+        if(w->start == 0)
+          break;
+      if(w == proc->group->vma + NVMA)
+        return -1;
+    }
+    vmaunmap(proc->group, v, s, e);
+    if(w){
+      *w = *v;
+      w->start = e;
+      w->off += e - v->start;
+      filedup(w->f);
+      v->end = s;
+    } else if(s == v->start && e == v->end){
+      fileclose(v->f);
+      v->start = 0;
+    } else if(s == v->start){
+      v->off += e - v->start;
+      v->start = e;
+    } else
+      v->end = s;
+  }
+  uflush();
+  return 0;
+}
+
+// Remove all of p's mappings, for exit and exec.
+void
+munmapall(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < p->vma + NVMA; v++){
+    if(v->start == 0)
+      continue;
+    vmaunmap(p, v, v->start, v->end);
+    fileclose(v->f);
+    v->start = 0;
+  }
+}
+
+// Give child np copies of the current process's mappings,
+// including the pages present in them; the pages of private
+// mappings are shared copy-on-write.
+int
+mmapcopy(struct proc *np)
+{
+  struct vma *v, *nv;
+  struct page *pg;
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  for(v = proc->group->vma, nv = np->vma; v < proc->group->vma + NVMA; v++, nv++){
+    if(v->start == 0)
+      continue;
+    *nv = *v;
+    filedup(nv->f);
+    for(a = v->start; a < v->end; a += PGSIZE){
+      if((pte = walkpgdir(proc->pgdir, (char*)a, 0)) == 0 || !(*pte & PTE_P))
+        continue;
+      if((pg = vmapage(v, a, PTE_ADDR(*pte))) != 0){
+        // Share the cached page; the child's mapping keeps
+        // vmapage's reference.
+        if(mappages(np->pgdir, (char*)a, PGSIZE, PTE_ADDR(*pte), PTE_FLAGS(*pte) & (PTE_W|PTE_U)) < 0){
+          pcput(pg);
+          goto bad;
+        }
+        continue;
+      }
+      if(v->flags == MAP_PRIVATE){
+        if(cowshare(np->pgdir, pte, a) < 0)
+          goto bad;
+        continue;
+      }
+      if((mem = kalloc()) == 0)
+        goto bad;
+      memmove(mem, p2v(PTE_ADDR(*pte)), PGSIZE);
+      if(mappages(np->pgdir, (char*)a, PGSIZE, v2p(mem), PTE_FLAGS(*pte) & (PTE_W|PTE_U)) < 0){
+        kfree(mem);
+        goto bad;
+      }
+    }
+  }
+  uflush();  // private pages may be copy-on-write now
+  return 0;
+
+bad:
+  uflush();
+  munmapall(np);
+  return -1;
+}
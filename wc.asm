@@ -0,0 +1,1935 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 80 13 00 00       	add    $0x1380,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 80 13 00 00       	add    $0x1380,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 7e 0f 00 00       	push   $0xf7e
+  59:	e8 35 02 00 00       	call   293 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 80 13 00 00       	push   $0x1380
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 c9 03 00 00       	call   469 <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 84 0f 00 00       	push   $0xf84
+  be:	6a 01                	push   $0x1
+  c0:	e8 1f 08 00 00       	call   8e4 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 87 03 00 00       	call   454 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 94 0f 00 00       	push   $0xf94
+  e1:	6a 01                	push   $0x1
+  e3:	e8 fc 07 00 00       	call   8e4 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 a1 0f 00 00       	push   $0xfa1
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 36 03 00 00       	call   454 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 46 03 00 00       	call   48c <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 a2 0f 00 00       	push   $0xfa2
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 71 07 00 00       	call   8e4 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 d9 02 00 00       	call   454 <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 d1 02 00 00       	call   477 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 97 02 00 00       	call   454 <exit>
+
+000001bd <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+    if(cc < 1)
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+  return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strcmp>:
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 216:	eb 08                	jmp    220 <strcmp+0xd>
+    p++, q++;
+ 218:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	84 c0                	test   %al,%al
+ 228:	74 10                	je     23a <strcmp+0x27>
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22d:	0f b6 10             	movzbl (%eax),%edx
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 c2                	cmp    %al,%dl
+ 238:	74 de                	je     218 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 d0             	movzbl %al,%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	0f b6 c0             	movzbl %al,%eax
+ 24c:	29 c2                	sub    %eax,%edx
+ 24e:	89 d0                	mov    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 258:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 25f:	eb 04                	jmp    265 <strlen+0x13>
+ 261:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 265:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	84 c0                	test   %al,%al
+ 272:	75 ed                	jne    261 <strlen+0xf>
+  return n;
+ 274:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <memset>:
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 27c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 27f:	50                   	push   %eax
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 32 ff ff ff       	call   1bd <stosb>
+ 28b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <strchr>:
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 29f:	eb 14                	jmp    2b5 <strchr+0x22>
+    if(*s == c)
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2aa:	75 05                	jne    2b1 <strchr+0x1e>
+      return (char*)s;
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	eb 13                	jmp    2c4 <strchr+0x31>
+  for(; *s; s++)
+ 2b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	0f b6 00             	movzbl (%eax),%eax
+ 2bb:	84 c0                	test   %al,%al
+ 2bd:	75 e2                	jne    2a1 <strchr+0xe>
+  return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <gets>:
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d3:	eb 42                	jmp    317 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2d5:	83 ec 04             	sub    $0x4,%esp
+ 2d8:	6a 01                	push   $0x1
+ 2da:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2dd:	50                   	push   %eax
+ 2de:	6a 00                	push   $0x0
+ 2e0:	e8 84 01 00 00       	call   469 <read>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ef:	7e 33                	jle    324 <gets+0x5e>
+    buf[i++] = c;
+ 2f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fa:	89 c2                	mov    %eax,%edx
+ 2fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ff:	01 c2                	add    %eax,%edx
+ 301:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 305:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 307:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30b:	3c 0a                	cmp    $0xa,%al
+ 30d:	74 16                	je     325 <gets+0x5f>
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0e                	je     325 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	83 c0 01             	add    $0x1,%eax
+ 31d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 320:	7f b3                	jg     2d5 <gets+0xf>
+ 322:	eb 01                	jmp    325 <gets+0x5f>
+      break;
+ 324:	90                   	nop
+  }
+  buf[i] = '\0';
+ 325:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	01 d0                	add    %edx,%eax
+ 32d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 33b:	83 ec 08             	sub    $0x8,%esp
+ 33e:	6a 00                	push   $0x0
+ 340:	ff 75 08             	push   0x8(%ebp)
+ 343:	e8 44 01 00 00       	call   48c <open>
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 34e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 352:	79 07                	jns    35b <stat+0x26>
+    return -1;
+ 354:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 359:	eb 25                	jmp    380 <stat+0x4b>
+  r = fstat(fd, st);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	ff 75 0c             	push   0xc(%ebp)
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	e8 41 01 00 00       	call   4aa <fstat>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 fd 00 00 00       	call   477 <close>
+ 37a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 37d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 388:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 38f:	eb 25                	jmp    3b6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 391:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 394:	89 d0                	mov    %edx,%eax
+ 396:	c1 e0 02             	shl    $0x2,%eax
+ 399:	01 d0                	add    %edx,%eax
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c1                	mov    %eax,%ecx
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	0f be c0             	movsbl %al,%eax
+ 3ae:	01 c8                	add    %ecx,%eax
+ 3b0:	83 e8 30             	sub    $0x30,%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	3c 2f                	cmp    $0x2f,%al
+ 3be:	7e 0a                	jle    3ca <atoi+0x48>
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	3c 39                	cmp    $0x39,%al
+ 3c8:	7e c7                	jle    391 <atoi+0xf>
+  return n;
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3e1:	eb 17                	jmp    3fa <memmove+0x2b>
+    *dst++ = *src++;
+ 3e3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3e6:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ef:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3f2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3f5:	0f b6 12             	movzbl (%edx),%edx
+ 3f8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3fa:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3fd:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 400:	89 55 10             	mov    %edx,0x10(%ebp)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	7f dc                	jg     3e3 <memmove+0x14>
+  return vdst;
+ 407:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+0000040c <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 40c:	83 3d 68 13 00 00 00 	cmpl   $0x0,0x1368
+  jg 2f
+ 413:	7f 2e                	jg     443 <dosyscall+0x37>
+  jl 1f
+ 415:	7c 29                	jl     440 <dosyscall+0x34>
+  pushl %eax
+ 417:	50                   	push   %eax
+  pushl %ebx
+ 418:	53                   	push   %ebx
+  movl $1, %eax
+ 419:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 41e:	0f a2                	cpuid
+  popl %ebx
+ 420:	5b                   	pop    %ebx
+  popl %eax
+ 421:	58                   	pop    %eax
+  movl $-1, sysmode
+ 422:	c7 05 68 13 00 00 ff 	movl   $0xffffffff,0x1368
+ 429:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 42c:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 432:	74 0c                	je     440 <dosyscall+0x34>
+  movl $1, sysmode
+ 434:	c7 05 68 13 00 00 01 	movl   $0x1,0x1368
+ 43b:	00 00 00 
+  jmp 2f
+ 43e:	eb 03                	jmp    443 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 440:	cd 40                	int    $0x40
+  ret
+ 442:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 443:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 445:	ba 4c 04 00 00       	mov    $0x44c,%edx
+  sysenter
+ 44a:	0f 34                	sysenter
+3:
+  ret
+ 44c:	c3                   	ret
+
+0000044d <fork>:
+
+SYSCALL(fork)
+ 44d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 452:	eb b8                	jmp    40c <dosyscall>
+
+00000454 <exit>:
+SYSCALL(exit)
+ 454:	b8 02 00 00 00       	mov    $0x2,%eax
+ 459:	eb b1                	jmp    40c <dosyscall>
+
+0000045b <wait>:
+SYSCALL(wait)
+ 45b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 460:	eb aa                	jmp    40c <dosyscall>
+
+00000462 <pipe>:
+SYSCALL(pipe)
+ 462:	b8 04 00 00 00       	mov    $0x4,%eax
+ 467:	eb a3                	jmp    40c <dosyscall>
+
+00000469 <read>:
+SYSCALL(read)
+ 469:	b8 05 00 00 00       	mov    $0x5,%eax
+ 46e:	eb 9c                	jmp    40c <dosyscall>
+
+00000470 <write>:
+SYSCALL(write)
+ 470:	b8 10 00 00 00       	mov    $0x10,%eax
+ 475:	eb 95                	jmp    40c <dosyscall>
+
+00000477 <close>:
+SYSCALL(close)
+ 477:	b8 15 00 00 00       	mov    $0x15,%eax
+ 47c:	eb 8e                	jmp    40c <dosyscall>
+
+0000047e <kill>:
+SYSCALL(kill)
+ 47e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 483:	eb 87                	jmp    40c <dosyscall>
+
+00000485 <exec>:
+SYSCALL(exec)
+ 485:	b8 07 00 00 00       	mov    $0x7,%eax
+ 48a:	eb 80                	jmp    40c <dosyscall>
+
+0000048c <open>:
+SYSCALL(open)
+ 48c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 491:	e9 76 ff ff ff       	jmp    40c <dosyscall>
+
+00000496 <mknod>:
+SYSCALL(mknod)
+ 496:	b8 11 00 00 00       	mov    $0x11,%eax
+ 49b:	e9 6c ff ff ff       	jmp    40c <dosyscall>
+
+000004a0 <unlink>:
+SYSCALL(unlink)
+ 4a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a5:	e9 62 ff ff ff       	jmp    40c <dosyscall>
+
+000004aa <fstat>:
+SYSCALL(fstat)
+ 4aa:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4af:	e9 58 ff ff ff       	jmp    40c <dosyscall>
+
+000004b4 <link>:
+SYSCALL(link)
+ 4b4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b9:	e9 4e ff ff ff       	jmp    40c <dosyscall>
+
+000004be <mkdir>:
+SYSCALL(mkdir)
+ 4be:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c3:	e9 44 ff ff ff       	jmp    40c <dosyscall>
+
+000004c8 <chdir>:
+SYSCALL(chdir)
+ 4c8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4cd:	e9 3a ff ff ff       	jmp    40c <dosyscall>
+
+000004d2 <dup>:
+SYSCALL(dup)
+ 4d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d7:	e9 30 ff ff ff       	jmp    40c <dosyscall>
+
+000004dc <getpid>:
+SYSCALL(getpid)
+ 4dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e1:	e9 26 ff ff ff       	jmp    40c <dosyscall>
+
+000004e6 <sbrk>:
+SYSCALL(sbrk)
+ 4e6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4eb:	e9 1c ff ff ff       	jmp    40c <dosyscall>
+
+000004f0 <sleep>:
+SYSCALL(sleep)
+ 4f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f5:	e9 12 ff ff ff       	jmp    40c <dosyscall>
+
+000004fa <uptime>:
+SYSCALL(uptime)
+ 4fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4ff:	e9 08 ff ff ff       	jmp    40c <dosyscall>
+
+00000504 <symlink>:
+SYSCALL(symlink)
+ 504:	b8 16 00 00 00       	mov    $0x16,%eax
+ 509:	e9 fe fe ff ff       	jmp    40c <dosyscall>
+
+0000050e <readlink>:
+SYSCALL(readlink)
+ 50e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 513:	e9 f4 fe ff ff       	jmp    40c <dosyscall>
+
+00000518 <fprot>:
+SYSCALL(fprot)
+ 518:	b8 18 00 00 00       	mov    $0x18,%eax
+ 51d:	e9 ea fe ff ff       	jmp    40c <dosyscall>
+
+00000522 <funprot>:
+SYSCALL(funprot)
+ 522:	b8 19 00 00 00       	mov    $0x19,%eax
+ 527:	e9 e0 fe ff ff       	jmp    40c <dosyscall>
+
+0000052c <funlock>:
+SYSCALL(funlock)
+ 52c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 531:	e9 d6 fe ff ff       	jmp    40c <dosyscall>
+
+00000536 <mmap>:
+SYSCALL(mmap)
+ 536:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 53b:	e9 cc fe ff ff       	jmp    40c <dosyscall>
+
+00000540 <munmap>:
+SYSCALL(munmap)
+ 540:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 545:	e9 c2 fe ff ff       	jmp    40c <dosyscall>
+
+0000054a <sendfile>:
+SYSCALL(sendfile)
+ 54a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 54f:	e9 b8 fe ff ff       	jmp    40c <dosyscall>
+
+00000554 <readv>:
+SYSCALL(readv)
+ 554:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 559:	e9 ae fe ff ff       	jmp    40c <dosyscall>
+
+0000055e <writev>:
+SYSCALL(writev)
+ 55e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 563:	e9 a4 fe ff ff       	jmp    40c <dosyscall>
+
+00000568 <pread>:
+SYSCALL(pread)
+ 568:	b8 20 00 00 00       	mov    $0x20,%eax
+ 56d:	e9 9a fe ff ff       	jmp    40c <dosyscall>
+
+00000572 <pwrite>:
+SYSCALL(pwrite)
+ 572:	b8 21 00 00 00       	mov    $0x21,%eax
+ 577:	e9 90 fe ff ff       	jmp    40c <dosyscall>
+
+0000057c <lseek>:
+SYSCALL(lseek)
+ 57c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 581:	e9 86 fe ff ff       	jmp    40c <dosyscall>
+
+00000586 <spawn>:
+SYSCALL(spawn)
+ 586:	b8 23 00 00 00       	mov    $0x23,%eax
+ 58b:	e9 7c fe ff ff       	jmp    40c <dosyscall>
+
+00000590 <setpriority>:
+SYSCALL(setpriority)
+ 590:	b8 24 00 00 00       	mov    $0x24,%eax
+ 595:	e9 72 fe ff ff       	jmp    40c <dosyscall>
+
+0000059a <kthread_create>:
+SYSCALL(kthread_create)
+ 59a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 59f:	e9 68 fe ff ff       	jmp    40c <dosyscall>
+
+000005a4 <kthread_id>:
+SYSCALL(kthread_id)
+ 5a4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5a9:	e9 5e fe ff ff       	jmp    40c <dosyscall>
+
+000005ae <kthread_exit>:
+SYSCALL(kthread_exit)
+ 5ae:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5b3:	e9 54 fe ff ff       	jmp    40c <dosyscall>
+
+000005b8 <kthread_join>:
+SYSCALL(kthread_join)
+ 5b8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5bd:	e9 4a fe ff ff       	jmp    40c <dosyscall>
+
+000005c2 <futex>:
+SYSCALL(futex)
+ 5c2:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5c7:	e9 40 fe ff ff       	jmp    40c <dosyscall>
+
+000005cc <signal>:
+SYSCALL(signal)
+ 5cc:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5d1:	e9 36 fe ff ff       	jmp    40c <dosyscall>
+
+000005d6 <alarm>:
+SYSCALL(alarm)
+ 5d6:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5db:	e9 2c fe ff ff       	jmp    40c <dosyscall>
+
+000005e0 <usleep>:
+SYSCALL(usleep)
+ 5e0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5e5:	e9 22 fe ff ff       	jmp    40c <dosyscall>
+
+000005ea <ioring_setup>:
+SYSCALL(ioring_setup)
+ 5ea:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5ef:	e9 18 fe ff ff       	jmp    40c <dosyscall>
+
+000005f4 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5f4:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5f9:	e9 0e fe ff ff       	jmp    40c <dosyscall>
+
+000005fe <getrusage>:
+SYSCALL(getrusage)
+ 5fe:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 603:	e9 04 fe ff ff       	jmp    40c <dosyscall>
+
+00000608 <mount>:
+SYSCALL(mount)
+ 608:	b8 30 00 00 00       	mov    $0x30,%eax
+ 60d:	e9 fa fd ff ff       	jmp    40c <dosyscall>
+
+00000612 <getdents>:
+SYSCALL(getdents)
+ 612:	b8 31 00 00 00       	mov    $0x31,%eax
+ 617:	e9 f0 fd ff ff       	jmp    40c <dosyscall>
+
+0000061c <yield>:
+SYSCALL(yield)
+ 61c:	b8 32 00 00 00       	mov    $0x32,%eax
+ 621:	e9 e6 fd ff ff       	jmp    40c <dosyscall>
+
+00000626 <ncpu>:
+SYSCALL(ncpu)
+ 626:	b8 33 00 00 00       	mov    $0x33,%eax
+ 62b:	e9 dc fd ff ff       	jmp    40c <dosyscall>
+
+00000630 <fallocate>:
+SYSCALL(fallocate)
+ 630:	b8 34 00 00 00       	mov    $0x34,%eax
+ 635:	e9 d2 fd ff ff       	jmp    40c <dosyscall>
+
+0000063a <ftruncate>:
+SYSCALL(ftruncate)
+ 63a:	b8 35 00 00 00       	mov    $0x35,%eax
+ 63f:	e9 c8 fd ff ff       	jmp    40c <dosyscall>
+
+00000644 <fsync>:
+SYSCALL(fsync)
+ 644:	b8 36 00 00 00       	mov    $0x36,%eax
+ 649:	e9 be fd ff ff       	jmp    40c <dosyscall>
+
+0000064e <fdatasync>:
+SYSCALL(fdatasync)
+ 64e:	b8 37 00 00 00       	mov    $0x37,%eax
+ 653:	e9 b4 fd ff ff       	jmp    40c <dosyscall>
+
+00000658 <poll>:
+SYSCALL(poll)
+ 658:	b8 38 00 00 00       	mov    $0x38,%eax
+ 65d:	e9 aa fd ff ff       	jmp    40c <dosyscall>
+
+00000662 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 662:	55                   	push   %ebp
+ 663:	89 e5                	mov    %esp,%ebp
+ 665:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 668:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66b:	8b 40 04             	mov    0x4(%eax),%eax
+ 66e:	85 c0                	test   %eax,%eax
+ 670:	7e 1f                	jle    691 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 672:	8b 45 08             	mov    0x8(%ebp),%eax
+ 675:	8b 50 04             	mov    0x4(%eax),%edx
+ 678:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67b:	8d 48 08             	lea    0x8(%eax),%ecx
+ 67e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 681:	8b 00                	mov    (%eax),%eax
+ 683:	83 ec 04             	sub    $0x4,%esp
+ 686:	52                   	push   %edx
+ 687:	51                   	push   %ecx
+ 688:	50                   	push   %eax
+ 689:	e8 d0 fe ff ff       	call   55e <writev>
+ 68e:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 6a5:	00 00 00 
+}
+ 6a8:	90                   	nop
+ 6a9:	c9                   	leave
+ 6aa:	c3                   	ret
+
+000006ab <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 6ab:	55                   	push   %ebp
+ 6ac:	89 e5                	mov    %esp,%ebp
+ 6ae:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 6b1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 6b5:	0f 84 94 00 00 00    	je     74f <put+0xa4>
+    return;
+  if(o->n > 0){
+ 6bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6be:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	7e 40                	jle    705 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 6c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6cb:	83 e8 01             	sub    $0x1,%eax
+ 6ce:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d8:	01 d0                	add    %edx,%eax
+ 6da:	83 c0 08             	add    $0x8,%eax
+ 6dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 6e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e3:	8b 10                	mov    (%eax),%edx
+ 6e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6eb:	01 d0                	add    %edx,%eax
+ 6ed:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 6f0:	75 13                	jne    705 <put+0x5a>
+      v->iov_len += n;
+ 6f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f5:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6fb:	01 c2                	add    %eax,%edx
+ 6fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 700:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 703:	eb 4b                	jmp    750 <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 705:	8b 45 08             	mov    0x8(%ebp),%eax
+ 708:	8b 40 04             	mov    0x4(%eax),%eax
+ 70b:	83 f8 10             	cmp    $0x10,%eax
+ 70e:	75 0e                	jne    71e <put+0x73>
+    flush(o);
+ 710:	83 ec 0c             	sub    $0xc,%esp
+ 713:	ff 75 08             	push   0x8(%ebp)
+ 716:	e8 47 ff ff ff       	call   662 <flush>
+ 71b:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 71e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 721:	8b 50 04             	mov    0x4(%eax),%edx
+ 724:	8b 45 08             	mov    0x8(%ebp),%eax
+ 727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 72a:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 72e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 731:	8b 50 04             	mov    0x4(%eax),%edx
+ 734:	8b 45 08             	mov    0x8(%ebp),%eax
+ 737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73a:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 73e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 741:	8b 40 04             	mov    0x4(%eax),%eax
+ 744:	8d 50 01             	lea    0x1(%eax),%edx
+ 747:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74a:	89 50 04             	mov    %edx,0x4(%eax)
+ 74d:	eb 01                	jmp    750 <put+0xa5>
+    return;
+ 74f:	90                   	nop
+}
+ 750:	c9                   	leave
+ 751:	c3                   	ret
+
+00000752 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 752:	55                   	push   %ebp
+ 753:	89 e5                	mov    %esp,%ebp
+ 755:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 758:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75b:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 761:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 76b:	77 0b                	ja     778 <room+0x26>
+ 76d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 770:	8b 40 04             	mov    0x4(%eax),%eax
+ 773:	83 f8 10             	cmp    $0x10,%eax
+ 776:	75 0e                	jne    786 <room+0x34>
+    flush(o);
+ 778:	83 ec 0c             	sub    $0xc,%esp
+ 77b:	ff 75 08             	push   0x8(%ebp)
+ 77e:	e8 df fe ff ff       	call   662 <flush>
+ 783:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 786:	8b 45 08             	mov    0x8(%ebp),%eax
+ 789:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 78f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 792:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 798:	01 d0                	add    %edx,%eax
+}
+ 79a:	c9                   	leave
+ 79b:	c3                   	ret
+
+0000079c <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 79c:	55                   	push   %ebp
+ 79d:	89 e5                	mov    %esp,%ebp
+ 79f:	83 ec 28             	sub    $0x28,%esp
+ 7a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7a5:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 7a8:	83 ec 08             	sub    $0x8,%esp
+ 7ab:	6a 01                	push   $0x1
+ 7ad:	ff 75 08             	push   0x8(%ebp)
+ 7b0:	e8 9d ff ff ff       	call   752 <room>
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 7bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7be:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 7c2:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 7c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 7cd:	8d 50 01             	lea    0x1(%eax),%edx
+ 7d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d3:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 7d9:	83 ec 04             	sub    $0x4,%esp
+ 7dc:	6a 01                	push   $0x1
+ 7de:	ff 75 f4             	push   -0xc(%ebp)
+ 7e1:	ff 75 08             	push   0x8(%ebp)
+ 7e4:	e8 c2 fe ff ff       	call   6ab <put>
+ 7e9:	83 c4 10             	add    $0x10,%esp
+}
+ 7ec:	90                   	nop
+ 7ed:	c9                   	leave
+ 7ee:	c3                   	ret
+
+000007ef <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 7ef:	55                   	push   %ebp
+ 7f0:	89 e5                	mov    %esp,%ebp
+ 7f2:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 7f5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7fc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 800:	74 17                	je     819 <printint+0x2a>
+ 802:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 806:	79 11                	jns    819 <printint+0x2a>
+    neg = 1;
+ 808:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 80f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 812:	f7 d8                	neg    %eax
+ 814:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 817:	eb 06                	jmp    81f <printint+0x30>
+  } else {
+    x = xx;
+ 819:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 81c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 81f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 826:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 829:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 82c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 831:	f7 f1                	div    %ecx
+ 833:	89 d1                	mov    %edx,%ecx
+ 835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 838:	8d 50 01             	lea    0x1(%eax),%edx
+ 83b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 83e:	0f b6 91 6c 13 00 00 	movzbl 0x136c(%ecx),%edx
+ 845:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 849:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 84c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 84f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 854:	f7 f1                	div    %ecx
+ 856:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 859:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 85d:	75 c7                	jne    826 <printint+0x37>
+  if(neg)
+ 85f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 863:	74 0e                	je     873 <printint+0x84>
+    buf[i++] = '-';
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8d 50 01             	lea    0x1(%eax),%edx
+ 86b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 86e:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 876:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 879:	83 ec 08             	sub    $0x8,%esp
+ 87c:	ff 75 e8             	push   -0x18(%ebp)
+ 87f:	ff 75 08             	push   0x8(%ebp)
+ 882:	e8 cb fe ff ff       	call   752 <room>
+ 887:	83 c4 10             	add    $0x10,%esp
+ 88a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 88d:	eb 1d                	jmp    8ac <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 88f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 892:	83 e8 01             	sub    $0x1,%eax
+ 895:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 898:	89 c2                	mov    %eax,%edx
+ 89a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 89d:	01 c2                	add    %eax,%edx
+ 89f:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 8a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a5:	01 c8                	add    %ecx,%eax
+ 8a7:	0f b6 00             	movzbl (%eax),%eax
+ 8aa:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 8ac:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b4:	79 d9                	jns    88f <printint+0xa0>
+  o->used += n;
+ 8b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b9:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 8bf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8c2:	01 c2                	add    %eax,%edx
+ 8c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c7:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 8cd:	83 ec 04             	sub    $0x4,%esp
+ 8d0:	ff 75 e8             	push   -0x18(%ebp)
+ 8d3:	ff 75 e4             	push   -0x1c(%ebp)
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 cd fd ff ff       	call   6ab <put>
+ 8de:	83 c4 10             	add    $0x10,%esp
+}
+ 8e1:	90                   	nop
+ 8e2:	c9                   	leave
+ 8e3:	c3                   	ret
+
+000008e4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8e4:	55                   	push   %ebp
+ 8e5:	89 e5                	mov    %esp,%ebp
+ 8e7:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 8ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f0:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 8f6:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 8fd:	00 00 00 
+  o.used = 0;
+ 900:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 907:	00 00 00 
+  state = 0;
+ 90a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 911:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 914:	83 c0 04             	add    $0x4,%eax
+ 917:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 91a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 921:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 928:	e9 82 01 00 00       	jmp    aaf <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 92d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 930:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 933:	01 d0                	add    %edx,%eax
+ 935:	0f b6 00             	movzbl (%eax),%eax
+ 938:	0f be c0             	movsbl %al,%eax
+ 93b:	25 ff 00 00 00       	and    $0xff,%eax
+ 940:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 943:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 947:	75 38                	jne    981 <printf+0x9d>
+      if(c == '%'){
+ 949:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 94d:	0f 85 58 01 00 00    	jne    aab <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 953:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 956:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 959:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 95c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 95f:	01 ca                	add    %ecx,%edx
+ 961:	83 ec 04             	sub    $0x4,%esp
+ 964:	50                   	push   %eax
+ 965:	52                   	push   %edx
+ 966:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 96c:	50                   	push   %eax
+ 96d:	e8 39 fd ff ff       	call   6ab <put>
+ 972:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 975:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 97c:	e9 2a 01 00 00       	jmp    aab <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 981:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 985:	0f 85 20 01 00 00    	jne    aab <printf+0x1c7>
+      if(c == 'd'){
+ 98b:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 98f:	75 22                	jne    9b3 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 991:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 994:	8b 00                	mov    (%eax),%eax
+ 996:	6a 01                	push   $0x1
+ 998:	6a 0a                	push   $0xa
+ 99a:	50                   	push   %eax
+ 99b:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9a1:	50                   	push   %eax
+ 9a2:	e8 48 fe ff ff       	call   7ef <printint>
+ 9a7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9aa:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9ae:	e9 e8 00 00 00       	jmp    a9b <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 9b3:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 9b7:	74 06                	je     9bf <printf+0xdb>
+ 9b9:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 9bd:	75 22                	jne    9e1 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 9bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c2:	8b 00                	mov    (%eax),%eax
+ 9c4:	6a 00                	push   $0x0
+ 9c6:	6a 10                	push   $0x10
+ 9c8:	50                   	push   %eax
+ 9c9:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 9cf:	50                   	push   %eax
+ 9d0:	e8 1a fe ff ff       	call   7ef <printint>
+ 9d5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9d8:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 9dc:	e9 ba 00 00 00       	jmp    a9b <printf+0x1b7>
+      } else if(c == 's'){
+ 9e1:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 9e5:	75 3f                	jne    a26 <printf+0x142>
+        s = (char*)*ap;
+ 9e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ea:	8b 00                	mov    (%eax),%eax
+ 9ec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9ef:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 9f3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9f7:	75 07                	jne    a00 <printf+0x11c>
+          s = "(null)";
+ 9f9:	c7 45 f4 b7 0f 00 00 	movl   $0xfb7,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ a00:	83 ec 0c             	sub    $0xc,%esp
+ a03:	ff 75 f4             	push   -0xc(%ebp)
+ a06:	e8 47 f8 ff ff       	call   252 <strlen>
+ a0b:	83 c4 10             	add    $0x10,%esp
+ a0e:	83 ec 04             	sub    $0x4,%esp
+ a11:	50                   	push   %eax
+ a12:	ff 75 f4             	push   -0xc(%ebp)
+ a15:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a1b:	50                   	push   %eax
+ a1c:	e8 8a fc ff ff       	call   6ab <put>
+ a21:	83 c4 10             	add    $0x10,%esp
+ a24:	eb 75                	jmp    a9b <printf+0x1b7>
+      } else if(c == 'c'){
+ a26:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ a2a:	75 21                	jne    a4d <printf+0x169>
+        putc(&o, *ap);
+ a2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a2f:	8b 00                	mov    (%eax),%eax
+ a31:	0f be c0             	movsbl %al,%eax
+ a34:	83 ec 08             	sub    $0x8,%esp
+ a37:	50                   	push   %eax
+ a38:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a3e:	50                   	push   %eax
+ a3f:	e8 58 fd ff ff       	call   79c <putc>
+ a44:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a47:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ a4b:	eb 4e                	jmp    a9b <printf+0x1b7>
+      } else if(c == '%'){
+ a4d:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ a51:	75 1b                	jne    a6e <printf+0x18a>
+        putc(&o, c);
+ a53:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a56:	0f be c0             	movsbl %al,%eax
+ a59:	83 ec 08             	sub    $0x8,%esp
+ a5c:	50                   	push   %eax
+ a5d:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a63:	50                   	push   %eax
+ a64:	e8 33 fd ff ff       	call   79c <putc>
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	eb 2d                	jmp    a9b <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ a6e:	83 ec 08             	sub    $0x8,%esp
+ a71:	6a 25                	push   $0x25
+ a73:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a79:	50                   	push   %eax
+ a7a:	e8 1d fd ff ff       	call   79c <putc>
+ a7f:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ a82:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a85:	0f be c0             	movsbl %al,%eax
+ a88:	83 ec 08             	sub    $0x8,%esp
+ a8b:	50                   	push   %eax
+ a8c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ a92:	50                   	push   %eax
+ a93:	e8 04 fd ff ff       	call   79c <putc>
+ a98:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a9b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ aa2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa5:	83 c0 01             	add    $0x1,%eax
+ aa8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ aab:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ab2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab5:	01 d0                	add    %edx,%eax
+ ab7:	0f b6 00             	movzbl (%eax),%eax
+ aba:	84 c0                	test   %al,%al
+ abc:	0f 85 6b fe ff ff    	jne    92d <printf+0x49>
+    }
+  }
+  if(state == 0)
+ ac2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ ac6:	75 22                	jne    aea <printf+0x206>
+    put(&o, fmt + start, i - start);
+ ac8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ acb:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ace:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ ad1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ad4:	01 ca                	add    %ecx,%edx
+ ad6:	83 ec 04             	sub    $0x4,%esp
+ ad9:	50                   	push   %eax
+ ada:	52                   	push   %edx
+ adb:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ ae1:	50                   	push   %eax
+ ae2:	e8 c4 fb ff ff       	call   6ab <put>
+ ae7:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ aea:	83 ec 0c             	sub    $0xc,%esp
+ aed:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ af3:	50                   	push   %eax
+ af4:	e8 69 fb ff ff       	call   662 <flush>
+ af9:	83 c4 10             	add    $0x10,%esp
+}
+ afc:	90                   	nop
+ afd:	c9                   	leave
+ afe:	c3                   	ret
+
+00000aff <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ aff:	55                   	push   %ebp
+ b00:	89 e5                	mov    %esp,%ebp
+ b02:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ b05:	8b 55 08             	mov    0x8(%ebp),%edx
+ b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b0e:	f0 87 02             	lock xchg %eax,(%edx)
+ b11:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ b14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ b17:	c9                   	leave
+ b18:	c3                   	ret
+
+00000b19 <lock>:
+{
+ b19:	55                   	push   %ebp
+ b1a:	89 e5                	mov    %esp,%ebp
+ b1c:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ b1f:	a1 80 15 00 00       	mov    0x1580,%eax
+ b24:	85 c0                	test   %eax,%eax
+ b26:	74 09                	je     b31 <lock+0x18>
+ b28:	a1 80 15 00 00       	mov    0x1580,%eax
+ b2d:	ff d0                	call   *%eax
+ b2f:	eb 05                	jmp    b36 <lock+0x1d>
+ b31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ b39:	90                   	nop
+ b3a:	83 ec 08             	sub    $0x8,%esp
+ b3d:	6a 01                	push   $0x1
+ b3f:	68 b8 15 00 00       	push   $0x15b8
+ b44:	e8 b6 ff ff ff       	call   aff <xchg>
+ b49:	83 c4 10             	add    $0x10,%esp
+ b4c:	85 c0                	test   %eax,%eax
+ b4e:	75 ea                	jne    b3a <lock+0x21>
+  return pin;
+ b50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ b53:	c9                   	leave
+ b54:	c3                   	ret
+
+00000b55 <unlock>:
+{
+ b55:	55                   	push   %ebp
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ b5b:	6a 00                	push   $0x0
+ b5d:	68 b8 15 00 00       	push   $0x15b8
+ b62:	e8 98 ff ff ff       	call   aff <xchg>
+ b67:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ b6a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b6e:	78 10                	js     b80 <unlock+0x2b>
+    mallocunpin(pin);
+ b70:	a1 84 15 00 00       	mov    0x1584,%eax
+ b75:	83 ec 0c             	sub    $0xc,%esp
+ b78:	ff 75 08             	push   0x8(%ebp)
+ b7b:	ff d0                	call   *%eax
+ b7d:	83 c4 10             	add    $0x10,%esp
+}
+ b80:	90                   	nop
+ b81:	c9                   	leave
+ b82:	c3                   	ret
+
+00000b83 <sizeclass>:
+{
+ b83:	55                   	push   %ebp
+ b84:	89 e5                	mov    %esp,%ebp
+ b86:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ b89:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ b90:	eb 1c                	jmp    bae <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ b92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b95:	ba 02 00 00 00       	mov    $0x2,%edx
+ b9a:	89 c1                	mov    %eax,%ecx
+ b9c:	d3 e2                	shl    %cl,%edx
+ b9e:	89 d0                	mov    %edx,%eax
+ ba0:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ba3:	72 05                	jb     baa <sizeclass+0x27>
+      return c;
+ ba5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba8:	eb 0f                	jmp    bb9 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ baa:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ bae:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ bb2:	7e de                	jle    b92 <sizeclass+0xf>
+  return -1;
+ bb4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ bb9:	c9                   	leave
+ bba:	c3                   	ret
+
+00000bbb <bigfree>:
+{
+ bbb:	55                   	push   %ebp
+ bbc:	89 e5                	mov    %esp,%ebp
+ bbe:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc1:	a1 90 15 00 00       	mov    0x1590,%eax
+ bc6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bc9:	eb 24                	jmp    bef <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bcb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bce:	8b 00                	mov    (%eax),%eax
+ bd0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bd3:	72 12                	jb     be7 <bigfree+0x2c>
+ bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bdb:	72 24                	jb     c01 <bigfree+0x46>
+ bdd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be0:	8b 00                	mov    (%eax),%eax
+ be2:	39 45 08             	cmp    %eax,0x8(%ebp)
+ be5:	72 1a                	jb     c01 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bea:	8b 00                	mov    (%eax),%eax
+ bec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bef:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bf5:	73 d4                	jae    bcb <bigfree+0x10>
+ bf7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfa:	8b 00                	mov    (%eax),%eax
+ bfc:	39 45 08             	cmp    %eax,0x8(%ebp)
+ bff:	73 ca                	jae    bcb <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ c01:	8b 45 08             	mov    0x8(%ebp),%eax
+ c04:	8b 40 04             	mov    0x4(%eax),%eax
+ c07:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c11:	01 c2                	add    %eax,%edx
+ c13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c16:	8b 00                	mov    (%eax),%eax
+ c18:	39 c2                	cmp    %eax,%edx
+ c1a:	75 24                	jne    c40 <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1f:	8b 50 04             	mov    0x4(%eax),%edx
+ c22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c25:	8b 00                	mov    (%eax),%eax
+ c27:	8b 40 04             	mov    0x4(%eax),%eax
+ c2a:	01 c2                	add    %eax,%edx
+ c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2f:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c35:	8b 00                	mov    (%eax),%eax
+ c37:	8b 10                	mov    (%eax),%edx
+ c39:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3c:	89 10                	mov    %edx,(%eax)
+ c3e:	eb 0a                	jmp    c4a <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ c40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c43:	8b 10                	mov    (%eax),%edx
+ c45:	8b 45 08             	mov    0x8(%ebp),%eax
+ c48:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4d:	8b 40 04             	mov    0x4(%eax),%eax
+ c50:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5a:	01 d0                	add    %edx,%eax
+ c5c:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c5f:	75 20                	jne    c81 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ c61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c64:	8b 50 04             	mov    0x4(%eax),%edx
+ c67:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6a:	8b 40 04             	mov    0x4(%eax),%eax
+ c6d:	01 c2                	add    %eax,%edx
+ c6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c72:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c75:	8b 45 08             	mov    0x8(%ebp),%eax
+ c78:	8b 10                	mov    (%eax),%edx
+ c7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7d:	89 10                	mov    %edx,(%eax)
+ c7f:	eb 08                	jmp    c89 <bigfree+0xce>
+    p->s.ptr = bp;
+ c81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c84:	8b 55 08             	mov    0x8(%ebp),%edx
+ c87:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c8c:	a3 90 15 00 00       	mov    %eax,0x1590
+}
+ c91:	90                   	nop
+ c92:	c9                   	leave
+ c93:	c3                   	ret
+
+00000c94 <free>:
+{
+ c94:	55                   	push   %ebp
+ c95:	89 e5                	mov    %esp,%ebp
+ c97:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ c9a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ c9e:	74 68                	je     d08 <free+0x74>
+  bp = (Header*)ap - 1;
+ ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca3:	83 e8 08             	sub    $0x8,%eax
+ ca6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ ca9:	e8 6b fe ff ff       	call   b19 <lock>
+ cae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ cb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb4:	8b 40 04             	mov    0x4(%eax),%eax
+ cb7:	83 ec 0c             	sub    $0xc,%esp
+ cba:	50                   	push   %eax
+ cbb:	e8 c3 fe ff ff       	call   b83 <sizeclass>
+ cc0:	83 c4 10             	add    $0x10,%esp
+ cc3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ cc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ cca:	78 1e                	js     cea <free+0x56>
+    bp->s.ptr = classfree[c];
+ ccc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ccf:	8b 14 85 94 15 00 00 	mov    0x1594(,%eax,4),%edx
+ cd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd9:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ cdb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cde:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ce1:	89 14 85 94 15 00 00 	mov    %edx,0x1594(,%eax,4)
+ ce8:	eb 0e                	jmp    cf8 <free+0x64>
+    bigfree(bp);
+ cea:	83 ec 0c             	sub    $0xc,%esp
+ ced:	ff 75 f4             	push   -0xc(%ebp)
+ cf0:	e8 c6 fe ff ff       	call   bbb <bigfree>
+ cf5:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ cf8:	83 ec 0c             	sub    $0xc,%esp
+ cfb:	ff 75 f0             	push   -0x10(%ebp)
+ cfe:	e8 52 fe ff ff       	call   b55 <unlock>
+ d03:	83 c4 10             	add    $0x10,%esp
+ d06:	eb 01                	jmp    d09 <free+0x75>
+    return;
+ d08:	90                   	nop
+}
+ d09:	c9                   	leave
+ d0a:	c3                   	ret
+
+00000d0b <morecore>:
+{
+ d0b:	55                   	push   %ebp
+ d0c:	89 e5                	mov    %esp,%ebp
+ d0e:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ d11:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d18:	77 07                	ja     d21 <morecore+0x16>
+    nu = 4096;
+ d1a:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d21:	8b 45 08             	mov    0x8(%ebp),%eax
+ d24:	c1 e0 03             	shl    $0x3,%eax
+ d27:	83 ec 0c             	sub    $0xc,%esp
+ d2a:	50                   	push   %eax
+ d2b:	e8 b6 f7 ff ff       	call   4e6 <sbrk>
+ d30:	83 c4 10             	add    $0x10,%esp
+ d33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d36:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d3a:	75 07                	jne    d43 <morecore+0x38>
+    return 0;
+ d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+ d41:	eb 22                	jmp    d65 <morecore+0x5a>
+  hp = (Header*)p;
+ d43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d46:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+ d4f:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ d52:	83 ec 0c             	sub    $0xc,%esp
+ d55:	ff 75 f0             	push   -0x10(%ebp)
+ d58:	e8 5e fe ff ff       	call   bbb <bigfree>
+ d5d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d60:	a1 90 15 00 00       	mov    0x1590,%eax
+}
+ d65:	c9                   	leave
+ d66:	c3                   	ret
+
+00000d67 <bigalloc>:
+{
+ d67:	55                   	push   %ebp
+ d68:	89 e5                	mov    %esp,%ebp
+ d6a:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ d6d:	a1 90 15 00 00       	mov    0x1590,%eax
+ d72:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d75:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d79:	75 23                	jne    d9e <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ d7b:	c7 45 f0 88 15 00 00 	movl   $0x1588,-0x10(%ebp)
+ d82:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d85:	a3 90 15 00 00       	mov    %eax,0x1590
+ d8a:	a1 90 15 00 00       	mov    0x1590,%eax
+ d8f:	a3 88 15 00 00       	mov    %eax,0x1588
+    base.s.size = 0;
+ d94:	c7 05 8c 15 00 00 00 	movl   $0x0,0x158c
+ d9b:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da1:	8b 00                	mov    (%eax),%eax
+ da3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ da6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da9:	8b 40 04             	mov    0x4(%eax),%eax
+ dac:	3b 45 08             	cmp    0x8(%ebp),%eax
+ daf:	72 4a                	jb     dfb <bigalloc+0x94>
+      if(p->s.size == nunits)
+ db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db4:	8b 40 04             	mov    0x4(%eax),%eax
+ db7:	39 45 08             	cmp    %eax,0x8(%ebp)
+ dba:	75 0c                	jne    dc8 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dbf:	8b 10                	mov    (%eax),%edx
+ dc1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dc4:	89 10                	mov    %edx,(%eax)
+ dc6:	eb 26                	jmp    dee <bigalloc+0x87>
+        p->s.size -= nunits;
+ dc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dcb:	8b 40 04             	mov    0x4(%eax),%eax
+ dce:	2b 45 08             	sub    0x8(%ebp),%eax
+ dd1:	89 c2                	mov    %eax,%edx
+ dd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dd6:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ dd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ddc:	8b 40 04             	mov    0x4(%eax),%eax
+ ddf:	c1 e0 03             	shl    $0x3,%eax
+ de2:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ de5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de8:	8b 55 08             	mov    0x8(%ebp),%edx
+ deb:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ dee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df1:	a3 90 15 00 00       	mov    %eax,0x1590
+      return p;
+ df6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df9:	eb 3b                	jmp    e36 <bigalloc+0xcf>
+    if(p == freep)
+ dfb:	a1 90 15 00 00       	mov    0x1590,%eax
+ e00:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e03:	75 1e                	jne    e23 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ e05:	83 ec 0c             	sub    $0xc,%esp
+ e08:	ff 75 08             	push   0x8(%ebp)
+ e0b:	e8 fb fe ff ff       	call   d0b <morecore>
+ e10:	83 c4 10             	add    $0x10,%esp
+ e13:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e16:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e1a:	75 07                	jne    e23 <bigalloc+0xbc>
+        return 0;
+ e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+ e21:	eb 13                	jmp    e36 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e26:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2c:	8b 00                	mov    (%eax),%eax
+ e2e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e31:	e9 70 ff ff ff       	jmp    da6 <bigalloc+0x3f>
+}
+ e36:	c9                   	leave
+ e37:	c3                   	ret
+
+00000e38 <alloc>:
+alloc(uint nbytes)
+{
+ e38:	55                   	push   %ebp
+ e39:	89 e5                	mov    %esp,%ebp
+ e3b:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e41:	83 c0 07             	add    $0x7,%eax
+ e44:	c1 e8 03             	shr    $0x3,%eax
+ e47:	83 c0 01             	add    $0x1,%eax
+ e4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ e4d:	ff 75 f4             	push   -0xc(%ebp)
+ e50:	e8 2e fd ff ff       	call   b83 <sizeclass>
+ e55:	83 c4 04             	add    $0x4,%esp
+ e58:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e5b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e5f:	79 2c                	jns    e8d <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ e61:	83 ec 0c             	sub    $0xc,%esp
+ e64:	ff 75 f4             	push   -0xc(%ebp)
+ e67:	e8 fb fe ff ff       	call   d67 <bigalloc>
+ e6c:	83 c4 10             	add    $0x10,%esp
+ e6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e72:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e76:	75 0a                	jne    e82 <alloc+0x4a>
+      return 0;
+ e78:	b8 00 00 00 00       	mov    $0x0,%eax
+ e7d:	e9 c8 00 00 00       	jmp    f4a <alloc+0x112>
+    return (void*)(p + 1);
+ e82:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e85:	83 c0 08             	add    $0x8,%eax
+ e88:	e9 bd 00 00 00       	jmp    f4a <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ e8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e90:	8b 04 85 94 15 00 00 	mov    0x1594(,%eax,4),%eax
+ e97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ e9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ e9e:	74 1a                	je     eba <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ ea0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ea3:	8b 10                	mov    (%eax),%edx
+ ea5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ea8:	89 14 85 94 15 00 00 	mov    %edx,0x1594(,%eax,4)
+    return (void*)(p + 1);
+ eaf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ eb2:	83 c0 08             	add    $0x8,%eax
+ eb5:	e9 90 00 00 00       	jmp    f4a <alloc+0x112>
+  }
+  nunits = 2 << c;
+ eba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ebd:	ba 02 00 00 00       	mov    $0x2,%edx
+ ec2:	89 c1                	mov    %eax,%ecx
+ ec4:	d3 e2                	shl    %cl,%edx
+ ec6:	89 d0                	mov    %edx,%eax
+ ec8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ ecb:	a1 b0 15 00 00       	mov    0x15b0,%eax
+ ed0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ed3:	c1 e2 03             	shl    $0x3,%edx
+ ed6:	01 d0                	add    %edx,%eax
+ ed8:	8b 15 b4 15 00 00    	mov    0x15b4,%edx
+ ede:	39 c2                	cmp    %eax,%edx
+ ee0:	73 3f                	jae    f21 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ ee2:	83 ec 0c             	sub    $0xc,%esp
+ ee5:	68 00 08 00 00       	push   $0x800
+ eea:	e8 78 fe ff ff       	call   d67 <bigalloc>
+ eef:	83 c4 10             	add    $0x10,%esp
+ ef2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ef5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ef9:	75 07                	jne    f02 <alloc+0xca>
+      return 0;
+ efb:	b8 00 00 00 00       	mov    $0x0,%eax
+ f00:	eb 48                	jmp    f4a <alloc+0x112>
+    bump = (char*)p;
+ f02:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f05:	a3 b0 15 00 00       	mov    %eax,0x15b0
+    bumpend = (char*)(p + p->s.size);
+ f0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f0d:	8b 40 04             	mov    0x4(%eax),%eax
+ f10:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ f17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f1a:	01 d0                	add    %edx,%eax
+ f1c:	a3 b4 15 00 00       	mov    %eax,0x15b4
+  }
+  p = (Header*)bump;
+ f21:	a1 b0 15 00 00       	mov    0x15b0,%eax
+ f26:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ f29:	a1 b0 15 00 00       	mov    0x15b0,%eax
+ f2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f31:	c1 e2 03             	shl    $0x3,%edx
+ f34:	01 d0                	add    %edx,%eax
+ f36:	a3 b0 15 00 00       	mov    %eax,0x15b0
+  p->s.size = nunits;
+ f3b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f3e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f41:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ f44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f47:	83 c0 08             	add    $0x8,%eax
+}
+ f4a:	c9                   	leave
+ f4b:	c3                   	ret
+
+00000f4c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ f4c:	55                   	push   %ebp
+ f4d:	89 e5                	mov    %esp,%ebp
+ f4f:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ f52:	e8 c2 fb ff ff       	call   b19 <lock>
+ f57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ f5a:	83 ec 0c             	sub    $0xc,%esp
+ f5d:	ff 75 08             	push   0x8(%ebp)
+ f60:	e8 d3 fe ff ff       	call   e38 <alloc>
+ f65:	83 c4 10             	add    $0x10,%esp
+ f68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ f6b:	83 ec 0c             	sub    $0xc,%esp
+ f6e:	ff 75 f4             	push   -0xc(%ebp)
+ f71:	e8 df fb ff ff       	call   b55 <unlock>
+ f76:	83 c4 10             	add    $0x10,%esp
+  return p;
+ f79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f7c:	c9                   	leave
+ f7d:	c3                   	ret
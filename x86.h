@@ -9,6 +9,15 @@ inb(ushort port)
   return data;
 }
 
+static inline uint
+inl(ushort port)
+{
+  uint data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
 static inline void
 insl(int port, void *addr, int cnt)
 {
@@ -30,6 +39,12 @@ outw(ushort port, ushort data)
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline void
+outl(ushort port, uint data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -99,6 +114,24 @@ readeflags(void)
   return eflags;
 }
 
+// Low 32 bits of the time-stamp counter.
+static inline uint
+rdtsc(void)
+{
+  uint lo, hi;
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+// Index of the highest set bit of x, which must not be 0.
+static inline uint
+bsr(uint x)
+{
+  uint r;
+  asm volatile("bsrl %1, %0" : "=r" (r) : "rm" (x));
+  return r;
+}
+
 static inline void
 loadgs(ushort v)
 {
@@ -130,6 +163,24 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically add n to *addr and return the old value.
+static inline uint
+xadd(volatile uint *addr, uint n)
+{
+  asm volatile("lock; xaddl %0, %1" :
+               "+r" (n), "+m" (*addr) :
+               :
+               "cc", "memory");
+  return n;
+}
+
+// Tell the CPU this is a spin-wait loop.
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +195,38 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+cpuid(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+               "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+               "a" (info));
+  if(eaxp)
+    *eaxp = eax;
+  if(ebxp)
+    *ebxp = ebx;
+  if(ecxp)
+    *ecxp = ecx;
+  if(edxp)
+    *edxp = edx;
+}
+
+static inline void
+wrmsr(uint msr, uint val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "a" (val), "d" (0));
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,1772 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 a6 02 00 00       	call   2bc <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 3b 03 00 00       	call   35f <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 97 02 00 00       	call   2c3 <exit>
+
+0000002c <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+    if(cc < 1)
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 84 01 00 00       	call   2d8 <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 44 01 00 00       	call   2fb <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 41 01 00 00       	call   319 <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 fd 00 00 00       	call   2e6 <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <dosyscall>:
+.data
+sysmode:
+  .long 0
+.text
+dosyscall:
+  cmpl $0, sysmode
+ 27b:	83 3d 78 11 00 00 00 	cmpl   $0x0,0x1178
+  jg 2f
+ 282:	7f 2e                	jg     2b2 <dosyscall+0x37>
+  jl 1f
+ 284:	7c 29                	jl     2af <dosyscall+0x34>
+  pushl %eax
+ 286:	50                   	push   %eax
+  pushl %ebx
+ 287:	53                   	push   %ebx
+  movl $1, %eax
+ 288:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 28d:	0f a2                	cpuid
+  popl %ebx
+ 28f:	5b                   	pop    %ebx
+  popl %eax
+ 290:	58                   	pop    %eax
+  movl $-1, sysmode
+ 291:	c7 05 78 11 00 00 ff 	movl   $0xffffffff,0x1178
+ 298:	ff ff ff 
+  testl $CPUID_SEP, %edx
+ 29b:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 1f
+ 2a1:	74 0c                	je     2af <dosyscall+0x34>
+  movl $1, sysmode
+ 2a3:	c7 05 78 11 00 00 01 	movl   $0x1,0x1178
+ 2aa:	00 00 00 
+  jmp 2f
+ 2ad:	eb 03                	jmp    2b2 <dosyscall+0x37>
+1:
+  int $T_SYSCALL
+ 2af:	cd 40                	int    $0x40
+  ret
+ 2b1:	c3                   	ret
+2:
+  # The kernel returns to %edx with %esp set to %ecx, and finds
+  # the arguments above the return address, as int leaves them.
+  movl %esp, %ecx
+ 2b2:	89 e1                	mov    %esp,%ecx
+  movl $3f, %edx
+ 2b4:	ba bb 02 00 00       	mov    $0x2bb,%edx
+  sysenter
+ 2b9:	0f 34                	sysenter
+3:
+  ret
+ 2bb:	c3                   	ret
+
+000002bc <fork>:
+
+SYSCALL(fork)
+ 2bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c1:	eb b8                	jmp    27b <dosyscall>
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	eb b1                	jmp    27b <dosyscall>
+
+000002ca <wait>:
+SYSCALL(wait)
+ 2ca:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cf:	eb aa                	jmp    27b <dosyscall>
+
+000002d1 <pipe>:
+SYSCALL(pipe)
+ 2d1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d6:	eb a3                	jmp    27b <dosyscall>
+
+000002d8 <read>:
+SYSCALL(read)
+ 2d8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2dd:	eb 9c                	jmp    27b <dosyscall>
+
+000002df <write>:
+SYSCALL(write)
+ 2df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e4:	eb 95                	jmp    27b <dosyscall>
+
+000002e6 <close>:
+SYSCALL(close)
+ 2e6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2eb:	eb 8e                	jmp    27b <dosyscall>
+
+000002ed <kill>:
+SYSCALL(kill)
+ 2ed:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f2:	eb 87                	jmp    27b <dosyscall>
+
+000002f4 <exec>:
+SYSCALL(exec)
+ 2f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f9:	eb 80                	jmp    27b <dosyscall>
+
+000002fb <open>:
+SYSCALL(open)
+ 2fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 300:	e9 76 ff ff ff       	jmp    27b <dosyscall>
+
+00000305 <mknod>:
+SYSCALL(mknod)
+ 305:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30a:	e9 6c ff ff ff       	jmp    27b <dosyscall>
+
+0000030f <unlink>:
+SYSCALL(unlink)
+ 30f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 314:	e9 62 ff ff ff       	jmp    27b <dosyscall>
+
+00000319 <fstat>:
+SYSCALL(fstat)
+ 319:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31e:	e9 58 ff ff ff       	jmp    27b <dosyscall>
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	e9 4e ff ff ff       	jmp    27b <dosyscall>
+
+0000032d <mkdir>:
+SYSCALL(mkdir)
+ 32d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 332:	e9 44 ff ff ff       	jmp    27b <dosyscall>
+
+00000337 <chdir>:
+SYSCALL(chdir)
+ 337:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33c:	e9 3a ff ff ff       	jmp    27b <dosyscall>
+
+00000341 <dup>:
+SYSCALL(dup)
+ 341:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 346:	e9 30 ff ff ff       	jmp    27b <dosyscall>
+
+0000034b <getpid>:
+SYSCALL(getpid)
+ 34b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 350:	e9 26 ff ff ff       	jmp    27b <dosyscall>
+
+00000355 <sbrk>:
+SYSCALL(sbrk)
+ 355:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 35a:	e9 1c ff ff ff       	jmp    27b <dosyscall>
+
+0000035f <sleep>:
+SYSCALL(sleep)
+ 35f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 364:	e9 12 ff ff ff       	jmp    27b <dosyscall>
+
+00000369 <uptime>:
+SYSCALL(uptime)
+ 369:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 36e:	e9 08 ff ff ff       	jmp    27b <dosyscall>
+
+00000373 <symlink>:
+SYSCALL(symlink)
+ 373:	b8 16 00 00 00       	mov    $0x16,%eax
+ 378:	e9 fe fe ff ff       	jmp    27b <dosyscall>
+
+0000037d <readlink>:
+SYSCALL(readlink)
+ 37d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 382:	e9 f4 fe ff ff       	jmp    27b <dosyscall>
+
+00000387 <fprot>:
+SYSCALL(fprot)
+ 387:	b8 18 00 00 00       	mov    $0x18,%eax
+ 38c:	e9 ea fe ff ff       	jmp    27b <dosyscall>
+
+00000391 <funprot>:
+SYSCALL(funprot)
+ 391:	b8 19 00 00 00       	mov    $0x19,%eax
+ 396:	e9 e0 fe ff ff       	jmp    27b <dosyscall>
+
+0000039b <funlock>:
+SYSCALL(funlock)
+ 39b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a0:	e9 d6 fe ff ff       	jmp    27b <dosyscall>
+
+000003a5 <mmap>:
+SYSCALL(mmap)
+ 3a5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3aa:	e9 cc fe ff ff       	jmp    27b <dosyscall>
+
+000003af <munmap>:
+SYSCALL(munmap)
+ 3af:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b4:	e9 c2 fe ff ff       	jmp    27b <dosyscall>
+
+000003b9 <sendfile>:
+SYSCALL(sendfile)
+ 3b9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3be:	e9 b8 fe ff ff       	jmp    27b <dosyscall>
+
+000003c3 <readv>:
+SYSCALL(readv)
+ 3c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3c8:	e9 ae fe ff ff       	jmp    27b <dosyscall>
+
+000003cd <writev>:
+SYSCALL(writev)
+ 3cd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3d2:	e9 a4 fe ff ff       	jmp    27b <dosyscall>
+
+000003d7 <pread>:
+SYSCALL(pread)
+ 3d7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3dc:	e9 9a fe ff ff       	jmp    27b <dosyscall>
+
+000003e1 <pwrite>:
+SYSCALL(pwrite)
+ 3e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3e6:	e9 90 fe ff ff       	jmp    27b <dosyscall>
+
+000003eb <lseek>:
+SYSCALL(lseek)
+ 3eb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3f0:	e9 86 fe ff ff       	jmp    27b <dosyscall>
+
+000003f5 <spawn>:
+SYSCALL(spawn)
+ 3f5:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3fa:	e9 7c fe ff ff       	jmp    27b <dosyscall>
+
+000003ff <setpriority>:
+SYSCALL(setpriority)
+ 3ff:	b8 24 00 00 00       	mov    $0x24,%eax
+ 404:	e9 72 fe ff ff       	jmp    27b <dosyscall>
+
+00000409 <kthread_create>:
+SYSCALL(kthread_create)
+ 409:	b8 25 00 00 00       	mov    $0x25,%eax
+ 40e:	e9 68 fe ff ff       	jmp    27b <dosyscall>
+
+00000413 <kthread_id>:
+SYSCALL(kthread_id)
+ 413:	b8 26 00 00 00       	mov    $0x26,%eax
+ 418:	e9 5e fe ff ff       	jmp    27b <dosyscall>
+
+0000041d <kthread_exit>:
+SYSCALL(kthread_exit)
+ 41d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 422:	e9 54 fe ff ff       	jmp    27b <dosyscall>
+
+00000427 <kthread_join>:
+SYSCALL(kthread_join)
+ 427:	b8 28 00 00 00       	mov    $0x28,%eax
+ 42c:	e9 4a fe ff ff       	jmp    27b <dosyscall>
+
+00000431 <futex>:
+SYSCALL(futex)
+ 431:	b8 29 00 00 00       	mov    $0x29,%eax
+ 436:	e9 40 fe ff ff       	jmp    27b <dosyscall>
+
+0000043b <signal>:
+SYSCALL(signal)
+ 43b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 440:	e9 36 fe ff ff       	jmp    27b <dosyscall>
+
+00000445 <alarm>:
+SYSCALL(alarm)
+ 445:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 44a:	e9 2c fe ff ff       	jmp    27b <dosyscall>
+
+0000044f <usleep>:
+SYSCALL(usleep)
+ 44f:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 454:	e9 22 fe ff ff       	jmp    27b <dosyscall>
+
+00000459 <ioring_setup>:
+SYSCALL(ioring_setup)
+ 459:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 45e:	e9 18 fe ff ff       	jmp    27b <dosyscall>
+
+00000463 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 463:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 468:	e9 0e fe ff ff       	jmp    27b <dosyscall>
+
+0000046d <getrusage>:
+SYSCALL(getrusage)
+ 46d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 472:	e9 04 fe ff ff       	jmp    27b <dosyscall>
+
+00000477 <mount>:
+SYSCALL(mount)
+ 477:	b8 30 00 00 00       	mov    $0x30,%eax
+ 47c:	e9 fa fd ff ff       	jmp    27b <dosyscall>
+
+00000481 <getdents>:
+SYSCALL(getdents)
+ 481:	b8 31 00 00 00       	mov    $0x31,%eax
+ 486:	e9 f0 fd ff ff       	jmp    27b <dosyscall>
+
+0000048b <yield>:
+SYSCALL(yield)
+ 48b:	b8 32 00 00 00       	mov    $0x32,%eax
+ 490:	e9 e6 fd ff ff       	jmp    27b <dosyscall>
+
+00000495 <ncpu>:
+SYSCALL(ncpu)
+ 495:	b8 33 00 00 00       	mov    $0x33,%eax
+ 49a:	e9 dc fd ff ff       	jmp    27b <dosyscall>
+
+0000049f <fallocate>:
+SYSCALL(fallocate)
+ 49f:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4a4:	e9 d2 fd ff ff       	jmp    27b <dosyscall>
+
+000004a9 <ftruncate>:
+SYSCALL(ftruncate)
+ 4a9:	b8 35 00 00 00       	mov    $0x35,%eax
+ 4ae:	e9 c8 fd ff ff       	jmp    27b <dosyscall>
+
+000004b3 <fsync>:
+SYSCALL(fsync)
+ 4b3:	b8 36 00 00 00       	mov    $0x36,%eax
+ 4b8:	e9 be fd ff ff       	jmp    27b <dosyscall>
+
+000004bd <fdatasync>:
+SYSCALL(fdatasync)
+ 4bd:	b8 37 00 00 00       	mov    $0x37,%eax
+ 4c2:	e9 b4 fd ff ff       	jmp    27b <dosyscall>
+
+000004c7 <poll>:
+SYSCALL(poll)
+ 4c7:	b8 38 00 00 00       	mov    $0x38,%eax
+ 4cc:	e9 aa fd ff ff       	jmp    27b <dosyscall>
+
+000004d1 <flush>:
+  char buf[128];
+};
+
+static void
+flush(struct out *o)
+{
+ 4d1:	55                   	push   %ebp
+ 4d2:	89 e5                	mov    %esp,%ebp
+ 4d4:	83 ec 08             	sub    $0x8,%esp
+  if(o->n > 0)
+ 4d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4da:	8b 40 04             	mov    0x4(%eax),%eax
+ 4dd:	85 c0                	test   %eax,%eax
+ 4df:	7e 1f                	jle    500 <flush+0x2f>
+    writev(o->fd, o->iov, o->n);
+ 4e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e4:	8b 50 04             	mov    0x4(%eax),%edx
+ 4e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ea:	8d 48 08             	lea    0x8(%eax),%ecx
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f0:	8b 00                	mov    (%eax),%eax
+ 4f2:	83 ec 04             	sub    $0x4,%esp
+ 4f5:	52                   	push   %edx
+ 4f6:	51                   	push   %ecx
+ 4f7:	50                   	push   %eax
+ 4f8:	e8 d0 fe ff ff       	call   3cd <writev>
+ 4fd:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+ 500:	8b 45 08             	mov    0x8(%ebp),%eax
+ 503:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  o->used = 0;
+ 50a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50d:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+ 514:	00 00 00 
+}
+ 517:	90                   	nop
+ 518:	c9                   	leave
+ 519:	c3                   	ret
+
+0000051a <put>:
+
+// Add the n bytes at s to the output.
+static void
+put(struct out *o, char *s, int n)
+{
+ 51a:	55                   	push   %ebp
+ 51b:	89 e5                	mov    %esp,%ebp
+ 51d:	83 ec 18             	sub    $0x18,%esp
+  struct iovec *v;
+
+  if(n == 0)
+ 520:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 524:	0f 84 94 00 00 00    	je     5be <put+0xa4>
+    return;
+  if(o->n > 0){
+ 52a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52d:	8b 40 04             	mov    0x4(%eax),%eax
+ 530:	85 c0                	test   %eax,%eax
+ 532:	7e 40                	jle    574 <put+0x5a>
+    v = &o->iov[o->n-1];
+ 534:	8b 45 08             	mov    0x8(%ebp),%eax
+ 537:	8b 40 04             	mov    0x4(%eax),%eax
+ 53a:	83 e8 01             	sub    $0x1,%eax
+ 53d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 544:	8b 45 08             	mov    0x8(%ebp),%eax
+ 547:	01 d0                	add    %edx,%eax
+ 549:	83 c0 08             	add    $0x8,%eax
+ 54c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if((char*)v->iov_base + v->iov_len == s){
+ 54f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 552:	8b 10                	mov    (%eax),%edx
+ 554:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 557:	8b 40 04             	mov    0x4(%eax),%eax
+ 55a:	01 d0                	add    %edx,%eax
+ 55c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 55f:	75 13                	jne    574 <put+0x5a>
+      v->iov_len += n;
+ 561:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 564:	8b 50 04             	mov    0x4(%eax),%edx
+ 567:	8b 45 10             	mov    0x10(%ebp),%eax
+ 56a:	01 c2                	add    %eax,%edx
+ 56c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 56f:	89 50 04             	mov    %edx,0x4(%eax)
+      return;
+ 572:	eb 4b                	jmp    5bf <put+0xa5>
+    }
+  }
+  if(o->n == UIO_MAXIOV)
+ 574:	8b 45 08             	mov    0x8(%ebp),%eax
+ 577:	8b 40 04             	mov    0x4(%eax),%eax
+ 57a:	83 f8 10             	cmp    $0x10,%eax
+ 57d:	75 0e                	jne    58d <put+0x73>
+    flush(o);
+ 57f:	83 ec 0c             	sub    $0xc,%esp
+ 582:	ff 75 08             	push   0x8(%ebp)
+ 585:	e8 47 ff ff ff       	call   4d1 <flush>
+ 58a:	83 c4 10             	add    $0x10,%esp
+  o->iov[o->n].iov_base = s;
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	8b 50 04             	mov    0x4(%eax),%edx
+ 593:	8b 45 08             	mov    0x8(%ebp),%eax
+ 596:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 599:	89 4c d0 08          	mov    %ecx,0x8(%eax,%edx,8)
+  o->iov[o->n].iov_len = n;
+ 59d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a0:	8b 50 04             	mov    0x4(%eax),%edx
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5a9:	89 4c d0 0c          	mov    %ecx,0xc(%eax,%edx,8)
+  o->n++;
+ 5ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b0:	8b 40 04             	mov    0x4(%eax),%eax
+ 5b3:	8d 50 01             	lea    0x1(%eax),%edx
+ 5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b9:	89 50 04             	mov    %edx,0x4(%eax)
+ 5bc:	eb 01                	jmp    5bf <put+0xa5>
+    return;
+ 5be:	90                   	nop
+}
+ 5bf:	c9                   	leave
+ 5c0:	c3                   	ret
+
+000005c1 <room>:
+
+// Room for n bytes at the end of buf, and an iovec for them:
+// put must not flush while the bytes it adds are in buf.
+static char*
+room(struct out *o, int n)
+{
+ 5c1:	55                   	push   %ebp
+ 5c2:	89 e5                	mov    %esp,%ebp
+ 5c4:	83 ec 08             	sub    $0x8,%esp
+  if(o->used + n > sizeof(o->buf) || o->n == UIO_MAXIOV)
+ 5c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ca:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 5d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5d3:	01 d0                	add    %edx,%eax
+ 5d5:	3d 80 00 00 00       	cmp    $0x80,%eax
+ 5da:	77 0b                	ja     5e7 <room+0x26>
+ 5dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5df:	8b 40 04             	mov    0x4(%eax),%eax
+ 5e2:	83 f8 10             	cmp    $0x10,%eax
+ 5e5:	75 0e                	jne    5f5 <room+0x34>
+    flush(o);
+ 5e7:	83 ec 0c             	sub    $0xc,%esp
+ 5ea:	ff 75 08             	push   0x8(%ebp)
+ 5ed:	e8 df fe ff ff       	call   4d1 <flush>
+ 5f2:	83 c4 10             	add    $0x10,%esp
+  return o->buf + o->used;
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+ 5fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 601:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 607:	01 d0                	add    %edx,%eax
+}
+ 609:	c9                   	leave
+ 60a:	c3                   	ret
+
+0000060b <putc>:
+
+static void
+putc(struct out *o, char c)
+{
+ 60b:	55                   	push   %ebp
+ 60c:	89 e5                	mov    %esp,%ebp
+ 60e:	83 ec 28             	sub    $0x28,%esp
+ 611:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 614:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char *p;
+
+  p = room(o, 1);
+ 617:	83 ec 08             	sub    $0x8,%esp
+ 61a:	6a 01                	push   $0x1
+ 61c:	ff 75 08             	push   0x8(%ebp)
+ 61f:	e8 9d ff ff ff       	call   5c1 <room>
+ 624:	83 c4 10             	add    $0x10,%esp
+ 627:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  *p = c;
+ 62a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62d:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+ 631:	88 10                	mov    %dl,(%eax)
+  o->used++;
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+ 63c:	8d 50 01             	lea    0x1(%eax),%edx
+ 63f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 642:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, 1);
+ 648:	83 ec 04             	sub    $0x4,%esp
+ 64b:	6a 01                	push   $0x1
+ 64d:	ff 75 f4             	push   -0xc(%ebp)
+ 650:	ff 75 08             	push   0x8(%ebp)
+ 653:	e8 c2 fe ff ff       	call   51a <put>
+ 658:	83 c4 10             	add    $0x10,%esp
+}
+ 65b:	90                   	nop
+ 65c:	c9                   	leave
+ 65d:	c3                   	ret
+
+0000065e <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+ 65e:	55                   	push   %ebp
+ 65f:	89 e5                	mov    %esp,%ebp
+ 661:	83 ec 38             	sub    $0x38,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16], *p;
+  int i, n, neg;
+  uint x;
+
+  neg = 0;
+ 664:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 66b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 66f:	74 17                	je     688 <printint+0x2a>
+ 671:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 675:	79 11                	jns    688 <printint+0x2a>
+    neg = 1;
+ 677:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 67e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 681:	f7 d8                	neg    %eax
+ 683:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 686:	eb 06                	jmp    68e <printint+0x30>
+  } else {
+    x = xx;
+ 688:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 68e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 695:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 698:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 69b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6a0:	f7 f1                	div    %ecx
+ 6a2:	89 d1                	mov    %edx,%ecx
+ 6a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a7:	8d 50 01             	lea    0x1(%eax),%edx
+ 6aa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6ad:	0f b6 91 7c 11 00 00 	movzbl 0x117c(%ecx),%edx
+ 6b4:	88 54 05 d4          	mov    %dl,-0x2c(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c3:	f7 f1                	div    %ecx
+ 6c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6cc:	75 c7                	jne    695 <printint+0x37>
+  if(neg)
+ 6ce:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6d2:	74 0e                	je     6e2 <printint+0x84>
+    buf[i++] = '-';
+ 6d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d7:	8d 50 01             	lea    0x1(%eax),%edx
+ 6da:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6dd:	c6 44 05 d4 2d       	movb   $0x2d,-0x2c(%ebp,%eax,1)
+
+  n = i;
+ 6e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  p = room(o, n);
+ 6e8:	83 ec 08             	sub    $0x8,%esp
+ 6eb:	ff 75 e8             	push   -0x18(%ebp)
+ 6ee:	ff 75 08             	push   0x8(%ebp)
+ 6f1:	e8 cb fe ff ff       	call   5c1 <room>
+ 6f6:	83 c4 10             	add    $0x10,%esp
+ 6f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(--i >= 0)
+ 6fc:	eb 1d                	jmp    71b <printint+0xbd>
+    p[n-1-i] = buf[i];
+ 6fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 701:	83 e8 01             	sub    $0x1,%eax
+ 704:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 707:	89 c2                	mov    %eax,%edx
+ 709:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 70c:	01 c2                	add    %eax,%edx
+ 70e:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+ 711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 714:	01 c8                	add    %ecx,%eax
+ 716:	0f b6 00             	movzbl (%eax),%eax
+ 719:	88 02                	mov    %al,(%edx)
+  while(--i >= 0)
+ 71b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 71f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 723:	79 d9                	jns    6fe <printint+0xa0>
+  o->used += n;
+ 725:	8b 45 08             	mov    0x8(%ebp),%eax
+ 728:	8b 90 88 00 00 00    	mov    0x88(%eax),%edx
+ 72e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 731:	01 c2                	add    %eax,%edx
+ 733:	8b 45 08             	mov    0x8(%ebp),%eax
+ 736:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+  put(o, p, n);
+ 73c:	83 ec 04             	sub    $0x4,%esp
+ 73f:	ff 75 e8             	push   -0x18(%ebp)
+ 742:	ff 75 e4             	push   -0x1c(%ebp)
+ 745:	ff 75 08             	push   0x8(%ebp)
+ 748:	e8 cd fd ff ff       	call   51a <put>
+ 74d:	83 c4 10             	add    $0x10,%esp
+}
+ 750:	90                   	nop
+ 751:	c9                   	leave
+ 752:	c3                   	ret
+
+00000753 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 753:	55                   	push   %ebp
+ 754:	89 e5                	mov    %esp,%ebp
+ 756:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct out o;
+  char *s;
+  int c, i, start, state;
+  uint *ap;
+
+  o.fd = fd;
+ 75c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75f:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  o.n = 0;
+ 765:	c7 85 d8 fe ff ff 00 	movl   $0x0,-0x128(%ebp)
+ 76c:	00 00 00 
+  o.used = 0;
+ 76f:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+ 776:	00 00 00 
+  state = 0;
+ 779:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 780:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 783:	83 c0 04             	add    $0x4,%eax
+ 786:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  start = 0;
+ 789:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 790:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 797:	e9 82 01 00 00       	jmp    91e <printf+0x1cb>
+    c = fmt[i] & 0xff;
+ 79c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 79f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a2:	01 d0                	add    %edx,%eax
+ 7a4:	0f b6 00             	movzbl (%eax),%eax
+ 7a7:	0f be c0             	movsbl %al,%eax
+ 7aa:	25 ff 00 00 00       	and    $0xff,%eax
+ 7af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(state == 0){
+ 7b2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 7b6:	75 38                	jne    7f0 <printf+0x9d>
+      if(c == '%'){
+ 7b8:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 7bc:	0f 85 58 01 00 00    	jne    91a <printf+0x1c7>
+        put(&o, fmt + start, i - start);
+ 7c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c5:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 7cb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7ce:	01 ca                	add    %ecx,%edx
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	50                   	push   %eax
+ 7d4:	52                   	push   %edx
+ 7d5:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 7db:	50                   	push   %eax
+ 7dc:	e8 39 fd ff ff       	call   51a <put>
+ 7e1:	83 c4 10             	add    $0x10,%esp
+        state = '%';
+ 7e4:	c7 45 e8 25 00 00 00 	movl   $0x25,-0x18(%ebp)
+ 7eb:	e9 2a 01 00 00       	jmp    91a <printf+0x1c7>
+      }
+    } else if(state == '%'){
+ 7f0:	83 7d e8 25          	cmpl   $0x25,-0x18(%ebp)
+ 7f4:	0f 85 20 01 00 00    	jne    91a <printf+0x1c7>
+      if(c == 'd'){
+ 7fa:	83 7d e0 64          	cmpl   $0x64,-0x20(%ebp)
+ 7fe:	75 22                	jne    822 <printf+0xcf>
+        printint(&o, *ap, 10, 1);
+ 800:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 803:	8b 00                	mov    (%eax),%eax
+ 805:	6a 01                	push   $0x1
+ 807:	6a 0a                	push   $0xa
+ 809:	50                   	push   %eax
+ 80a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 810:	50                   	push   %eax
+ 811:	e8 48 fe ff ff       	call   65e <printint>
+ 816:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 819:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 81d:	e9 e8 00 00 00       	jmp    90a <printf+0x1b7>
+      } else if(c == 'x' || c == 'p'){
+ 822:	83 7d e0 78          	cmpl   $0x78,-0x20(%ebp)
+ 826:	74 06                	je     82e <printf+0xdb>
+ 828:	83 7d e0 70          	cmpl   $0x70,-0x20(%ebp)
+ 82c:	75 22                	jne    850 <printf+0xfd>
+        printint(&o, *ap, 16, 0);
+ 82e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 831:	8b 00                	mov    (%eax),%eax
+ 833:	6a 00                	push   $0x0
+ 835:	6a 10                	push   $0x10
+ 837:	50                   	push   %eax
+ 838:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 83e:	50                   	push   %eax
+ 83f:	e8 1a fe ff ff       	call   65e <printint>
+ 844:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 847:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 84b:	e9 ba 00 00 00       	jmp    90a <printf+0x1b7>
+      } else if(c == 's'){
+ 850:	83 7d e0 73          	cmpl   $0x73,-0x20(%ebp)
+ 854:	75 3f                	jne    895 <printf+0x142>
+        s = (char*)*ap;
+ 856:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 859:	8b 00                	mov    (%eax),%eax
+ 85b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 85e:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+        if(s == 0)
+ 862:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 866:	75 07                	jne    86f <printf+0x11c>
+          s = "(null)";
+ 868:	c7 45 f4 ed 0d 00 00 	movl   $0xded,-0xc(%ebp)
+        put(&o, s, strlen(s));
+ 86f:	83 ec 0c             	sub    $0xc,%esp
+ 872:	ff 75 f4             	push   -0xc(%ebp)
+ 875:	e8 47 f8 ff ff       	call   c1 <strlen>
+ 87a:	83 c4 10             	add    $0x10,%esp
+ 87d:	83 ec 04             	sub    $0x4,%esp
+ 880:	50                   	push   %eax
+ 881:	ff 75 f4             	push   -0xc(%ebp)
+ 884:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 88a:	50                   	push   %eax
+ 88b:	e8 8a fc ff ff       	call   51a <put>
+ 890:	83 c4 10             	add    $0x10,%esp
+ 893:	eb 75                	jmp    90a <printf+0x1b7>
+      } else if(c == 'c'){
+ 895:	83 7d e0 63          	cmpl   $0x63,-0x20(%ebp)
+ 899:	75 21                	jne    8bc <printf+0x169>
+        putc(&o, *ap);
+ 89b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 89e:	8b 00                	mov    (%eax),%eax
+ 8a0:	0f be c0             	movsbl %al,%eax
+ 8a3:	83 ec 08             	sub    $0x8,%esp
+ 8a6:	50                   	push   %eax
+ 8a7:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8ad:	50                   	push   %eax
+ 8ae:	e8 58 fd ff ff       	call   60b <putc>
+ 8b3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8b6:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+ 8ba:	eb 4e                	jmp    90a <printf+0x1b7>
+      } else if(c == '%'){
+ 8bc:	83 7d e0 25          	cmpl   $0x25,-0x20(%ebp)
+ 8c0:	75 1b                	jne    8dd <printf+0x18a>
+        putc(&o, c);
+ 8c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 8c5:	0f be c0             	movsbl %al,%eax
+ 8c8:	83 ec 08             	sub    $0x8,%esp
+ 8cb:	50                   	push   %eax
+ 8cc:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8d2:	50                   	push   %eax
+ 8d3:	e8 33 fd ff ff       	call   60b <putc>
+ 8d8:	83 c4 10             	add    $0x10,%esp
+ 8db:	eb 2d                	jmp    90a <printf+0x1b7>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(&o, '%');
+ 8dd:	83 ec 08             	sub    $0x8,%esp
+ 8e0:	6a 25                	push   $0x25
+ 8e2:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 8e8:	50                   	push   %eax
+ 8e9:	e8 1d fd ff ff       	call   60b <putc>
+ 8ee:	83 c4 10             	add    $0x10,%esp
+        putc(&o, c);
+ 8f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 8f4:	0f be c0             	movsbl %al,%eax
+ 8f7:	83 ec 08             	sub    $0x8,%esp
+ 8fa:	50                   	push   %eax
+ 8fb:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 901:	50                   	push   %eax
+ 902:	e8 04 fd ff ff       	call   60b <putc>
+ 907:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 90a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+      start = i + 1;
+ 911:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 914:	83 c0 01             	add    $0x1,%eax
+ 917:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 91a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 91e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 921:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 924:	01 d0                	add    %edx,%eax
+ 926:	0f b6 00             	movzbl (%eax),%eax
+ 929:	84 c0                	test   %al,%al
+ 92b:	0f 85 6b fe ff ff    	jne    79c <printf+0x49>
+    }
+  }
+  if(state == 0)
+ 931:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 935:	75 22                	jne    959 <printf+0x206>
+    put(&o, fmt + start, i - start);
+ 937:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 93d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 940:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 943:	01 ca                	add    %ecx,%edx
+ 945:	83 ec 04             	sub    $0x4,%esp
+ 948:	50                   	push   %eax
+ 949:	52                   	push   %edx
+ 94a:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 950:	50                   	push   %eax
+ 951:	e8 c4 fb ff ff       	call   51a <put>
+ 956:	83 c4 10             	add    $0x10,%esp
+  flush(&o);
+ 959:	83 ec 0c             	sub    $0xc,%esp
+ 95c:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 962:	50                   	push   %eax
+ 963:	e8 69 fb ff ff       	call   4d1 <flush>
+ 968:	83 c4 10             	add    $0x10,%esp
+}
+ 96b:	90                   	nop
+ 96c:	c9                   	leave
+ 96d:	c3                   	ret
+
+0000096e <xchg>:
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+ 96e:	55                   	push   %ebp
+ 96f:	89 e5                	mov    %esp,%ebp
+ 971:	83 ec 10             	sub    $0x10,%esp
+      return p;
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+ 974:	8b 55 08             	mov    0x8(%ebp),%edx
+ 977:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 97a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 97d:	f0 87 02             	lock xchg %eax,(%edx)
+ 980:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        return 0;
+  }
+}
+
+ 983:	8b 45 fc             	mov    -0x4(%ebp),%eax
+static void*
+ 986:	c9                   	leave
+ 987:	c3                   	ret
+
+00000988 <lock>:
+{
+ 988:	55                   	push   %ebp
+ 989:	89 e5                	mov    %esp,%ebp
+ 98b:	83 ec 18             	sub    $0x18,%esp
+  pin = mallocpin ? mallocpin() : -1;
+ 98e:	a1 90 11 00 00       	mov    0x1190,%eax
+ 993:	85 c0                	test   %eax,%eax
+ 995:	74 09                	je     9a0 <lock+0x18>
+ 997:	a1 90 11 00 00       	mov    0x1190,%eax
+ 99c:	ff d0                	call   *%eax
+ 99e:	eb 05                	jmp    9a5 <lock+0x1d>
+ 9a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(xchg(&mlock, 1) != 0)
+ 9a8:	90                   	nop
+ 9a9:	83 ec 08             	sub    $0x8,%esp
+ 9ac:	6a 01                	push   $0x1
+ 9ae:	68 c8 11 00 00       	push   $0x11c8
+ 9b3:	e8 b6 ff ff ff       	call   96e <xchg>
+ 9b8:	83 c4 10             	add    $0x10,%esp
+ 9bb:	85 c0                	test   %eax,%eax
+ 9bd:	75 ea                	jne    9a9 <lock+0x21>
+  return pin;
+ 9bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 9c2:	c9                   	leave
+ 9c3:	c3                   	ret
+
+000009c4 <unlock>:
+{
+ 9c4:	55                   	push   %ebp
+ 9c5:	89 e5                	mov    %esp,%ebp
+ 9c7:	83 ec 08             	sub    $0x8,%esp
+  xchg(&mlock, 0);
+ 9ca:	6a 00                	push   $0x0
+ 9cc:	68 c8 11 00 00       	push   $0x11c8
+ 9d1:	e8 98 ff ff ff       	call   96e <xchg>
+ 9d6:	83 c4 08             	add    $0x8,%esp
+  if(pin >= 0)
+ 9d9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 9dd:	78 10                	js     9ef <unlock+0x2b>
+    mallocunpin(pin);
+ 9df:	a1 94 11 00 00       	mov    0x1194,%eax
+ 9e4:	83 ec 0c             	sub    $0xc,%esp
+ 9e7:	ff 75 08             	push   0x8(%ebp)
+ 9ea:	ff d0                	call   *%eax
+ 9ec:	83 c4 10             	add    $0x10,%esp
+}
+ 9ef:	90                   	nop
+ 9f0:	c9                   	leave
+ 9f1:	c3                   	ret
+
+000009f2 <sizeclass>:
+{
+ 9f2:	55                   	push   %ebp
+ 9f3:	89 e5                	mov    %esp,%ebp
+ 9f5:	83 ec 10             	sub    $0x10,%esp
+  for(c = 0; c < NCLASS; c++)
+ 9f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 9ff:	eb 1c                	jmp    a1d <sizeclass+0x2b>
+    if(nu <= (2 << c))
+ a01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a04:	ba 02 00 00 00       	mov    $0x2,%edx
+ a09:	89 c1                	mov    %eax,%ecx
+ a0b:	d3 e2                	shl    %cl,%edx
+ a0d:	89 d0                	mov    %edx,%eax
+ a0f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a12:	72 05                	jb     a19 <sizeclass+0x27>
+      return c;
+ a14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a17:	eb 0f                	jmp    a28 <sizeclass+0x36>
+  for(c = 0; c < NCLASS; c++)
+ a19:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ a1d:	83 7d fc 06          	cmpl   $0x6,-0x4(%ebp)
+ a21:	7e de                	jle    a01 <sizeclass+0xf>
+  return -1;
+ a23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ a28:	c9                   	leave
+ a29:	c3                   	ret
+
+00000a2a <bigfree>:
+{
+ a2a:	55                   	push   %ebp
+ a2b:	89 e5                	mov    %esp,%ebp
+ a2d:	83 ec 10             	sub    $0x10,%esp
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a30:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ a35:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a38:	eb 24                	jmp    a5e <bigfree+0x34>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	8b 00                	mov    (%eax),%eax
+ a3f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a42:	72 12                	jb     a56 <bigfree+0x2c>
+ a44:	8b 45 08             	mov    0x8(%ebp),%eax
+ a47:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a4a:	72 24                	jb     a70 <bigfree+0x46>
+ a4c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4f:	8b 00                	mov    (%eax),%eax
+ a51:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a54:	72 1a                	jb     a70 <bigfree+0x46>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a59:	8b 00                	mov    (%eax),%eax
+ a5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a61:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a64:	73 d4                	jae    a3a <bigfree+0x10>
+ a66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a69:	8b 00                	mov    (%eax),%eax
+ a6b:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a6e:	73 ca                	jae    a3a <bigfree+0x10>
+  if(bp + bp->s.size == p->s.ptr){
+ a70:	8b 45 08             	mov    0x8(%ebp),%eax
+ a73:	8b 40 04             	mov    0x4(%eax),%eax
+ a76:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a80:	01 c2                	add    %eax,%edx
+ a82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a85:	8b 00                	mov    (%eax),%eax
+ a87:	39 c2                	cmp    %eax,%edx
+ a89:	75 24                	jne    aaf <bigfree+0x85>
+    bp->s.size += p->s.ptr->s.size;
+ a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8e:	8b 50 04             	mov    0x4(%eax),%edx
+ a91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a94:	8b 00                	mov    (%eax),%eax
+ a96:	8b 40 04             	mov    0x4(%eax),%eax
+ a99:	01 c2                	add    %eax,%edx
+ a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a9e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aa1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa4:	8b 00                	mov    (%eax),%eax
+ aa6:	8b 10                	mov    (%eax),%edx
+ aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+ aab:	89 10                	mov    %edx,(%eax)
+ aad:	eb 0a                	jmp    ab9 <bigfree+0x8f>
+    bp->s.ptr = p->s.ptr;
+ aaf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab2:	8b 10                	mov    (%eax),%edx
+ ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab7:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ab9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abc:	8b 40 04             	mov    0x4(%eax),%eax
+ abf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ac6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac9:	01 d0                	add    %edx,%eax
+ acb:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ace:	75 20                	jne    af0 <bigfree+0xc6>
+    p->s.size += bp->s.size;
+ ad0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad3:	8b 50 04             	mov    0x4(%eax),%edx
+ ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad9:	8b 40 04             	mov    0x4(%eax),%eax
+ adc:	01 c2                	add    %eax,%edx
+ ade:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae7:	8b 10                	mov    (%eax),%edx
+ ae9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aec:	89 10                	mov    %edx,(%eax)
+ aee:	eb 08                	jmp    af8 <bigfree+0xce>
+    p->s.ptr = bp;
+ af0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af3:	8b 55 08             	mov    0x8(%ebp),%edx
+ af6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ af8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afb:	a3 a0 11 00 00       	mov    %eax,0x11a0
+}
+ b00:	90                   	nop
+ b01:	c9                   	leave
+ b02:	c3                   	ret
+
+00000b03 <free>:
+{
+ b03:	55                   	push   %ebp
+ b04:	89 e5                	mov    %esp,%ebp
+ b06:	83 ec 18             	sub    $0x18,%esp
+  if(ap == 0)
+ b09:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ b0d:	74 68                	je     b77 <free+0x74>
+  bp = (Header*)ap - 1;
+ b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b12:	83 e8 08             	sub    $0x8,%eax
+ b15:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  pin = lock();
+ b18:	e8 6b fe ff ff       	call   988 <lock>
+ b1d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((c = sizeclass(bp->s.size)) >= 0){
+ b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b23:	8b 40 04             	mov    0x4(%eax),%eax
+ b26:	83 ec 0c             	sub    $0xc,%esp
+ b29:	50                   	push   %eax
+ b2a:	e8 c3 fe ff ff       	call   9f2 <sizeclass>
+ b2f:	83 c4 10             	add    $0x10,%esp
+ b32:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b35:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b39:	78 1e                	js     b59 <free+0x56>
+    bp->s.ptr = classfree[c];
+ b3b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b3e:	8b 14 85 a4 11 00 00 	mov    0x11a4(,%eax,4),%edx
+ b45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b48:	89 10                	mov    %edx,(%eax)
+    classfree[c] = bp;
+ b4a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b4d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b50:	89 14 85 a4 11 00 00 	mov    %edx,0x11a4(,%eax,4)
+ b57:	eb 0e                	jmp    b67 <free+0x64>
+    bigfree(bp);
+ b59:	83 ec 0c             	sub    $0xc,%esp
+ b5c:	ff 75 f4             	push   -0xc(%ebp)
+ b5f:	e8 c6 fe ff ff       	call   a2a <bigfree>
+ b64:	83 c4 10             	add    $0x10,%esp
+  unlock(pin);
+ b67:	83 ec 0c             	sub    $0xc,%esp
+ b6a:	ff 75 f0             	push   -0x10(%ebp)
+ b6d:	e8 52 fe ff ff       	call   9c4 <unlock>
+ b72:	83 c4 10             	add    $0x10,%esp
+ b75:	eb 01                	jmp    b78 <free+0x75>
+    return;
+ b77:	90                   	nop
+}
+ b78:	c9                   	leave
+ b79:	c3                   	ret
+
+00000b7a <morecore>:
+{
+ b7a:	55                   	push   %ebp
+ b7b:	89 e5                	mov    %esp,%ebp
+ b7d:	83 ec 18             	sub    $0x18,%esp
+  if(nu < 4096)
+ b80:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b87:	77 07                	ja     b90 <morecore+0x16>
+    nu = 4096;
+ b89:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b90:	8b 45 08             	mov    0x8(%ebp),%eax
+ b93:	c1 e0 03             	shl    $0x3,%eax
+ b96:	83 ec 0c             	sub    $0xc,%esp
+ b99:	50                   	push   %eax
+ b9a:	e8 b6 f7 ff ff       	call   355 <sbrk>
+ b9f:	83 c4 10             	add    $0x10,%esp
+ ba2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ ba5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ ba9:	75 07                	jne    bb2 <morecore+0x38>
+    return 0;
+ bab:	b8 00 00 00 00       	mov    $0x0,%eax
+ bb0:	eb 22                	jmp    bd4 <morecore+0x5a>
+  hp = (Header*)p;
+ bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ bb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+ bbe:	89 50 04             	mov    %edx,0x4(%eax)
+  bigfree(hp);
+ bc1:	83 ec 0c             	sub    $0xc,%esp
+ bc4:	ff 75 f0             	push   -0x10(%ebp)
+ bc7:	e8 5e fe ff ff       	call   a2a <bigfree>
+ bcc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ bcf:	a1 a0 11 00 00       	mov    0x11a0,%eax
+}
+ bd4:	c9                   	leave
+ bd5:	c3                   	ret
+
+00000bd6 <bigalloc>:
+{
+ bd6:	55                   	push   %ebp
+ bd7:	89 e5                	mov    %esp,%ebp
+ bd9:	83 ec 18             	sub    $0x18,%esp
+  if((prevp = freep) == 0){
+ bdc:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ be1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ be4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ be8:	75 23                	jne    c0d <bigalloc+0x37>
+    base.s.ptr = freep = prevp = &base;
+ bea:	c7 45 f0 98 11 00 00 	movl   $0x1198,-0x10(%ebp)
+ bf1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf4:	a3 a0 11 00 00       	mov    %eax,0x11a0
+ bf9:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ bfe:	a3 98 11 00 00       	mov    %eax,0x1198
+    base.s.size = 0;
+ c03:	c7 05 9c 11 00 00 00 	movl   $0x0,0x119c
+ c0a:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c10:	8b 00                	mov    (%eax),%eax
+ c12:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c18:	8b 40 04             	mov    0x4(%eax),%eax
+ c1b:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c1e:	72 4a                	jb     c6a <bigalloc+0x94>
+      if(p->s.size == nunits)
+ c20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c23:	8b 40 04             	mov    0x4(%eax),%eax
+ c26:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c29:	75 0c                	jne    c37 <bigalloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+ c2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2e:	8b 10                	mov    (%eax),%edx
+ c30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c33:	89 10                	mov    %edx,(%eax)
+ c35:	eb 26                	jmp    c5d <bigalloc+0x87>
+        p->s.size -= nunits;
+ c37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3a:	8b 40 04             	mov    0x4(%eax),%eax
+ c3d:	2b 45 08             	sub    0x8(%ebp),%eax
+ c40:	89 c2                	mov    %eax,%edx
+ c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c45:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4b:	8b 40 04             	mov    0x4(%eax),%eax
+ c4e:	c1 e0 03             	shl    $0x3,%eax
+ c51:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c57:	8b 55 08             	mov    0x8(%ebp),%edx
+ c5a:	89 50 04             	mov    %edx,0x4(%eax)
+      freep = prevp;
+ c5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c60:	a3 a0 11 00 00       	mov    %eax,0x11a0
+      return p;
+ c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c68:	eb 3b                	jmp    ca5 <bigalloc+0xcf>
+    if(p == freep)
+ c6a:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ c6f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c72:	75 1e                	jne    c92 <bigalloc+0xbc>
+      if((p = morecore(nunits)) == 0)
+ c74:	83 ec 0c             	sub    $0xc,%esp
+ c77:	ff 75 08             	push   0x8(%ebp)
+ c7a:	e8 fb fe ff ff       	call   b7a <morecore>
+ c7f:	83 c4 10             	add    $0x10,%esp
+ c82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c85:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c89:	75 07                	jne    c92 <bigalloc+0xbc>
+        return 0;
+ c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+ c90:	eb 13                	jmp    ca5 <bigalloc+0xcf>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9b:	8b 00                	mov    (%eax),%eax
+ c9d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ca0:	e9 70 ff ff ff       	jmp    c15 <bigalloc+0x3f>
+}
+ ca5:	c9                   	leave
+ ca6:	c3                   	ret
+
+00000ca7 <alloc>:
+alloc(uint nbytes)
+{
+ ca7:	55                   	push   %ebp
+ ca8:	89 e5                	mov    %esp,%ebp
+ caa:	83 ec 18             	sub    $0x18,%esp
+  Header *p;
+  uint nunits;
+  int c;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cad:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb0:	83 c0 07             	add    $0x7,%eax
+ cb3:	c1 e8 03             	shr    $0x3,%eax
+ cb6:	83 c0 01             	add    $0x1,%eax
+ cb9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if((c = sizeclass(nunits)) < 0){
+ cbc:	ff 75 f4             	push   -0xc(%ebp)
+ cbf:	e8 2e fd ff ff       	call   9f2 <sizeclass>
+ cc4:	83 c4 04             	add    $0x4,%esp
+ cc7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cca:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cce:	79 2c                	jns    cfc <alloc+0x55>
+    if((p = bigalloc(nunits)) == 0)
+ cd0:	83 ec 0c             	sub    $0xc,%esp
+ cd3:	ff 75 f4             	push   -0xc(%ebp)
+ cd6:	e8 fb fe ff ff       	call   bd6 <bigalloc>
+ cdb:	83 c4 10             	add    $0x10,%esp
+ cde:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ce1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ce5:	75 0a                	jne    cf1 <alloc+0x4a>
+      return 0;
+ ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+ cec:	e9 c8 00 00 00       	jmp    db9 <alloc+0x112>
+    return (void*)(p + 1);
+ cf1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cf4:	83 c0 08             	add    $0x8,%eax
+ cf7:	e9 bd 00 00 00       	jmp    db9 <alloc+0x112>
+  }
+
+  if((p = classfree[c]) != 0){
+ cfc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cff:	8b 04 85 a4 11 00 00 	mov    0x11a4(,%eax,4),%eax
+ d06:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d09:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d0d:	74 1a                	je     d29 <alloc+0x82>
+    classfree[c] = p->s.ptr;
+ d0f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d12:	8b 10                	mov    (%eax),%edx
+ d14:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d17:	89 14 85 a4 11 00 00 	mov    %edx,0x11a4(,%eax,4)
+    return (void*)(p + 1);
+ d1e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d21:	83 c0 08             	add    $0x8,%eax
+ d24:	e9 90 00 00 00       	jmp    db9 <alloc+0x112>
+  }
+  nunits = 2 << c;
+ d29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d2c:	ba 02 00 00 00       	mov    $0x2,%edx
+ d31:	89 c1                	mov    %eax,%ecx
+ d33:	d3 e2                	shl    %cl,%edx
+ d35:	89 d0                	mov    %edx,%eax
+ d37:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(bump + nunits*sizeof(Header) > bumpend){
+ d3a:	a1 c0 11 00 00       	mov    0x11c0,%eax
+ d3f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d42:	c1 e2 03             	shl    $0x3,%edx
+ d45:	01 d0                	add    %edx,%eax
+ d47:	8b 15 c4 11 00 00    	mov    0x11c4,%edx
+ d4d:	39 c2                	cmp    %eax,%edx
+ d4f:	73 3f                	jae    d90 <alloc+0xe9>
+    if((p = bigalloc(CHUNK/sizeof(Header))) == 0)
+ d51:	83 ec 0c             	sub    $0xc,%esp
+ d54:	68 00 08 00 00       	push   $0x800
+ d59:	e8 78 fe ff ff       	call   bd6 <bigalloc>
+ d5e:	83 c4 10             	add    $0x10,%esp
+ d61:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ d64:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ d68:	75 07                	jne    d71 <alloc+0xca>
+      return 0;
+ d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6f:	eb 48                	jmp    db9 <alloc+0x112>
+    bump = (char*)p;
+ d71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d74:	a3 c0 11 00 00       	mov    %eax,0x11c0
+    bumpend = (char*)(p + p->s.size);
+ d79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d7c:	8b 40 04             	mov    0x4(%eax),%eax
+ d7f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d86:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d89:	01 d0                	add    %edx,%eax
+ d8b:	a3 c4 11 00 00       	mov    %eax,0x11c4
+  }
+  p = (Header*)bump;
+ d90:	a1 c0 11 00 00       	mov    0x11c0,%eax
+ d95:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  bump += nunits*sizeof(Header);
+ d98:	a1 c0 11 00 00       	mov    0x11c0,%eax
+ d9d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ da0:	c1 e2 03             	shl    $0x3,%edx
+ da3:	01 d0                	add    %edx,%eax
+ da5:	a3 c0 11 00 00       	mov    %eax,0x11c0
+  p->s.size = nunits;
+ daa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ dad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ db0:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(p + 1);
+ db3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ db6:	83 c0 08             	add    $0x8,%eax
+}
+ db9:	c9                   	leave
+ dba:	c3                   	ret
+
+00000dbb <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ dbb:	55                   	push   %ebp
+ dbc:	89 e5                	mov    %esp,%ebp
+ dbe:	83 ec 18             	sub    $0x18,%esp
+  void *p;
+  int pin;
+
+  pin = lock();
+ dc1:	e8 c2 fb ff ff       	call   988 <lock>
+ dc6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  p = alloc(nbytes);
+ dc9:	83 ec 0c             	sub    $0xc,%esp
+ dcc:	ff 75 08             	push   0x8(%ebp)
+ dcf:	e8 d3 fe ff ff       	call   ca7 <alloc>
+ dd4:	83 c4 10             	add    $0x10,%esp
+ dd7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  unlock(pin);
+ dda:	83 ec 0c             	sub    $0xc,%esp
+ ddd:	ff 75 f4             	push   -0xc(%ebp)
+ de0:	e8 df fb ff ff       	call   9c4 <unlock>
+ de5:	83 c4 10             	add    $0x10,%esp
+  return p;
+ de8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ deb:	c9                   	leave
+ dec:	c3                   	ret